@@ -27,17 +27,188 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <new>
 #include <Crypto.h>
 #include <base64.hpp>    
 #include <Ed25519.h>
+#include <ChaChaPoly.h>
+#include <SHA256.h>
+#include <HKDF.h>
 #include "base32decode.h" // Base32 decoding for Algorand addresses
 #include "bip39enwords.h" // BIP39 english words to convert Algorand private key from mnemonics
 #include "AlgoIoT.h"
+#include "mpkschema.h"
 
 #define LIB_DEBUGMODE
 #define DEBUG_SERIAL Serial
 
 
+// Transaction field schemas (see mpkschema.h): key order and map sizes are checked at compile time
+namespace
+{
+  typedef mpkschema::FixedBin<ALGORAND_ADDRESS_BYTES> Address;
+
+  // Note, optionally followed by a reserved trailer (e.g. an AEAD tag) and transformed in place before signing
+  struct NoteField
+  {
+    typedef struct
+    {
+      const char* notes;
+      uint16_t notesLen;
+      uint16_t trailerBytes;
+      uint8_t** payload;   // Where the note starts inside the messagepack, if trailerBytes > 0
+    } Value;
+    static bool present(const Value& v) { return (v.notes != NULL) && (v.notesLen > 0); }
+    static int write(msgPack mPack, const Value& v)
+    {
+      uint8_t* payload = NULL;
+      int iErr = 0;
+
+      if (v.trailerBytes == 0)
+      {
+        return msgpackAddBinary(mPack, (const uint8_t*)v.notes, v.notesLen);
+      }
+      iErr = msgpackReserveByteArray(mPack, v.notesLen + v.trailerBytes, &payload);
+      if (iErr)
+      {
+        return iErr;
+      }
+      memcpy(payload, v.notes, v.notesLen);
+      memset(payload + v.notesLen, 0, v.trailerBytes);
+      if (v.payload != NULL)
+      {
+        *(v.payload) = payload;
+      }
+      return MPK_NO_ERROR;
+    }
+  };
+
+  // Application call arguments: array of byte arrays, empty ones included
+  struct AppArgsField
+  {
+    typedef struct
+    {
+      const uint8_t** args;
+      const uint8_t* lengths;
+      uint8_t count;
+    } Value;
+    static bool present(const Value& v) { return v.count > 0; }
+    static int write(msgPack mPack, const Value& v)
+    {
+      int iErr = msgpackAddArray(mPack, v.count);
+      for (uint8_t i = 0; (i < v.count) && !iErr; i++)
+      {
+        iErr = msgpackAddBinary(mPack, v.args[i], (v.args[i] != NULL) ? v.lengths[i] : 0);
+      }
+      return iErr;
+    }
+  };
+
+  // Array of asset / application IDs
+  struct IDArrayField
+  {
+    typedef struct
+    {
+      const uint64_t* ids;
+      uint8_t count;
+    } Value;
+    static bool present(const Value& v) { return v.count > 0; }
+    static int write(msgPack mPack, const Value& v)
+    {
+      int iErr = msgpackAddArray(mPack, v.count);
+      for (uint8_t i = 0; (i < v.count) && !iErr; i++)
+      {
+        iErr = msgpackAddUInt(mPack, v.ids[i]);
+      }
+      return iErr;
+    }
+  };
+
+  // Array of addresses
+  struct AddressArrayField
+  {
+    typedef struct
+    {
+      const uint8_t (*addresses)[ALGORAND_ADDRESS_BYTES];
+      uint8_t count;
+    } Value;
+    static bool present(const Value& v) { return v.count > 0; }
+    static int write(msgPack mPack, const Value& v)
+    {
+      int iErr = msgpackAddArray(mPack, v.count);
+      for (uint8_t i = 0; (i < v.count) && !iErr; i++)
+      {
+        iErr = msgpackAddBinary(mPack, v.addresses[i], ALGORAND_ADDRESS_BYTES);
+      }
+      return iErr;
+    }
+  };
+
+  // Asset parameters ("apar"), a nested map
+  MPK_FIELD(AssetName, "an", mpkschema::Str);
+  MPK_FIELD(AssetURL, "au", mpkschema::Str);
+  MPK_FIELD(AssetDecimals, "dc", mpkschema::UInt);
+  MPK_FIELD(AssetTotal, "t", mpkschema::UInt);
+  MPK_FIELD(AssetUnitName, "un", mpkschema::Str);
+  typedef mpkschema::Map<AssetName, AssetURL, AssetDecimals, AssetTotal, AssetUnitName> AssetParams;
+
+  struct AssetParamsField
+  {
+    typedef struct
+    {
+      const char* name;
+      const char* url;
+      uint8_t decimals;
+      uint64_t total;
+      const char* unitName;
+    } Value;
+    static bool present(const Value& v) { return AssetParams::count(v.name, v.url, v.decimals, v.total, v.unitName) > 0; }
+    static int write(msgPack mPack, const Value& v) { return AssetParams::encode(mPack, v.name, v.url, v.decimals, v.total, v.unitName); }
+  };
+
+  // Transaction fields
+  MPK_FIELD(TxAssetAmount, "aamt", mpkschema::UInt);
+  MPK_FIELD(TxAssetCloseTo, "aclose", Address);
+  MPK_FIELD(TxAssetFrozen, "afrz", mpkschema::Bool);
+  MPK_FIELD(TxAmount, "amt", mpkschema::UInt);
+  MPK_FIELD(TxAppArgs, "apaa", AppArgsField);
+  MPK_FIELD(TxOnCompletion, "apan", mpkschema::UInt);
+  MPK_FIELD(TxAssetParams, "apar", AssetParamsField);
+  MPK_FIELD(TxForeignAssets, "apas", IDArrayField);
+  MPK_FIELD(TxAccounts, "apat", AddressArrayField);
+  MPK_FIELD(TxForeignApps, "apfa", IDArrayField);
+  MPK_FIELD(TxApplicationID, "apid", mpkschema::UInt);
+  MPK_FIELD(TxAssetReceiver, "arcv", Address);
+  MPK_FIELD(TxAssetSender, "asnd", Address);
+  MPK_FIELD(TxConfigAsset, "caid", mpkschema::UInt);
+  MPK_FIELD(TxFreezeAccount, "fadd", Address);
+  MPK_FIELD(TxFreezeAsset, "faid", mpkschema::UInt);
+  MPK_FIELD(TxFee, "fee", mpkschema::UInt);
+  MPK_FIELD(TxFirstValid, "fv", mpkschema::UInt);
+  MPK_FIELD(TxGenesisID, "gen", mpkschema::Str);
+  MPK_FIELD(TxGenesisHash, "gh", mpkschema::FixedBin<ALGORAND_NET_HASH_BYTES>);
+  MPK_FIELD(TxGroup, "grp", mpkschema::FixedBin<ALGORAND_GROUP_ID_BYTES>);
+  MPK_FIELD(TxLastValid, "lv", mpkschema::UInt);
+  MPK_FIELD(TxNote, "note", NoteField);
+  MPK_FIELD(TxReceiver, "rcv", Address);
+  MPK_FIELD(TxSender, "snd", Address);
+  MPK_FIELD(TxType, "type", mpkschema::Str);
+  MPK_FIELD(TxTransferAsset, "xaid", mpkschema::UInt);
+
+  // One schema per transaction type
+  typedef mpkschema::Map<TxAmount, TxFee, TxFirstValid, TxGenesisID, TxGenesisHash, TxGroup, TxLastValid,
+                         TxNote, TxReceiver, TxSender, TxType> PaymentTx;
+  typedef mpkschema::Map<TxAssetAmount, TxAssetCloseTo, TxAssetReceiver, TxAssetSender, TxFee, TxFirstValid,
+                         TxGenesisID, TxGenesisHash, TxLastValid, TxSender, TxType, TxTransferAsset> AssetTransferTx;
+  typedef mpkschema::Map<TxAssetParams, TxConfigAsset, TxFee, TxFirstValid, TxGenesisID, TxGenesisHash,
+                         TxLastValid, TxSender, TxType> AssetConfigTx;
+  typedef mpkschema::Map<TxAssetFrozen, TxFreezeAccount, TxFreezeAsset, TxFee, TxFirstValid, TxGenesisID,
+                         TxGenesisHash, TxLastValid, TxSender, TxType> AssetFreezeTx;
+  typedef mpkschema::Map<TxAppArgs, TxOnCompletion, TxForeignAssets, TxAccounts, TxForeignApps, TxApplicationID,
+                         TxFee, TxFirstValid, TxGenesisID, TxGenesisHash, TxLastValid, TxSender, TxType> ApplicationCallTx;
+}
+
+
 // Class AlgoIoT
 
 ///////////////////////////////
@@ -45,10 +216,12 @@
 ///////////////////////////////
 
 // Constructor
-AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics)
+AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics, AlgoIoTWorkspace* workspace)
 {
   int iErr = 0;
 
+  m_ws = workspace;
+
   if (sAppName == NULL)
   {
     #ifdef LIB_DEBUGMODE
@@ -73,9 +246,6 @@ AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics)
     return;
   }
 
-    // Configure HTTP client
-  m_httpClient.setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
-
   // Decode private key from mnemonics
   iErr = decodePrivateKeyFromMnemonics(nodeAccountMnemonics, m_privateKey);
   if (iErr)
@@ -103,6 +273,87 @@ AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics)
 }
 
 
+AlgoIoT::AlgoIoT(AlgoIoTWorkspace* workspace, const char* sAppName)
+{
+  m_ws = workspace;
+
+  if ( (sAppName == NULL) || (strlen(sAppName) > DAPP_NAME_MAX_LEN) )
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("\n Error: bad AppName passed to constructor\n");
+    #endif
+    return;
+  }
+  strcpy(m_appName, sAppName);
+
+  // Sender and receiver are set for each transaction
+  m_receiverAddressBytes = (uint8_t*)calloc(1, ALGORAND_ADDRESS_BYTES);
+}
+
+
+AlgoIoT::~AlgoIoT()
+{
+  if (m_ownsWorkspace)
+  {
+    delete m_ws;
+  }
+  free(m_receiverAddressBytes);
+  free(m_attestLeaves);
+}
+
+
+int AlgoIoT::setWorkspace(AlgoIoTWorkspace* workspace)
+{
+  if (m_ownsWorkspace)
+  {
+    delete m_ws;
+    m_ownsWorkspace = false;
+  }
+  m_ws = workspace;
+  m_noteLen = 0;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::useWorkspace()
+{
+  if (m_ws != NULL)
+  {
+    return ALGOIOT_NO_ERROR;
+  }
+
+  m_ws = new (std::nothrow) AlgoIoTWorkspace();
+  if (m_ws == NULL)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("\n Memory error allocating workspace\n");
+    #endif
+    return ALGOIOT_MEMORY_ERROR;
+  }
+  m_ownsWorkspace = true;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::claimNoteDocument()
+{
+  if (useWorkspace() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+  if (m_ws->noteOwner != this)
+  {
+    m_ws->noteJDoc.clear();
+    m_ws->noteOwner = this;
+    m_noteLen = 0;
+  }
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
 int AlgoIoT::setDestinationAddress(const char* algorandAddress)
 {
   int iErr = 0;
@@ -140,6 +391,102 @@ int AlgoIoT::setAlgorandNetwork(const uint8_t networkType)
   {
     m_httpBaseURL = ALGORAND_MAINNET_API_ENDPOINT;
   }
+  clearAlgodEndpoints();
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::setAPIToken(const char* token)
+{
+  if (token == NULL)
+  {
+    APItoken[0] = 0;
+    return ALGOIOT_NO_ERROR;
+  }
+  if (strlen(token) > ALGORAND_API_TOKEN_CHARS)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  strcpy(APItoken, token);
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::addAlgodEndpoint(const char* url, const char* token)
+{
+  AlgodEndpoint* endpoint = NULL;
+
+  if (url == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if ( (strlen(url) == 0) || (strlen(url) > ALGORAND_API_ENDPOINT_CHARS) )
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  if ( (token != NULL) && (strlen(token) > ALGORAND_API_TOKEN_CHARS) )
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  if (useWorkspace() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+  if (m_ws->endpointCount >= ALGOIOT_MAX_ENDPOINTS)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  endpoint = &(m_ws->endpoints[m_ws->endpointCount]);
+  memset(endpoint, 0, sizeof(AlgodEndpoint));
+  strcpy(endpoint->url, url);
+  if (token != NULL)
+  {
+    strcpy(endpoint->token, token);
+  }
+  m_ws->endpointCount++;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+void AlgoIoT::clearAlgodEndpoints()
+{
+  if (m_ws == NULL)
+  {
+    return;
+  }
+  memset(m_ws->endpoints, 0, sizeof(m_ws->endpoints));
+  m_ws->endpointCount = 0;
+}
+
+
+// An endpoint is down after ALGOIOT_ENDPOINT_MAX_FAILURES consecutive failures,
+// until ALGOIOT_ENDPOINT_RETRY_MS have elapsed since the last one
+static bool isAlgodEndpointHealthy(const AlgodEndpoint* endpoint)
+{
+  if (endpoint->failures < ALGOIOT_ENDPOINT_MAX_FAILURES)
+  {
+    return true;
+  }
+  return ((uint32_t)millis() - endpoint->lastFailureMs) >= ALGOIOT_ENDPOINT_RETRY_MS;
+}
+
+
+int AlgoIoT::getAlgodEndpointStatus(const uint8_t index, uint32_t* latencyMs, bool* healthy)
+{
+  if ( (latencyMs == NULL) || (healthy == NULL) )
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if ( (m_ws == NULL) || (index >= m_ws->endpointCount) )
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  *latencyMs = m_ws->endpoints[index].latencyMs;
+  *healthy = isAlgodEndpointHealthy(&(m_ws->endpoints[index]));
 
   return ALGOIOT_NO_ERROR;
 }
@@ -173,11 +520,16 @@ int AlgoIoT::dataAddInt8Field(const char* label, const int8_t value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -202,11 +554,16 @@ int AlgoIoT::dataAddUInt8Field(const char* label, const uint8_t value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -231,11 +588,16 @@ int AlgoIoT::dataAddInt16Field(const char* label, const int16_t value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -260,11 +622,16 @@ int AlgoIoT::dataAddUInt16Field(const char* label, const uint16_t value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -289,11 +656,16 @@ int AlgoIoT::dataAddInt32Field(const char* label, const int32_t value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -318,11 +690,16 @@ int AlgoIoT::dataAddUInt32Field(const char* label, const uint32_t value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -347,11 +724,16 @@ int AlgoIoT::dataAddFloatField(const char* label, const float value)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = value;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = value;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -376,11 +758,16 @@ int AlgoIoT::dataAddShortStringField(const char* label, char* shortCString)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_noteJDoc[label] = shortCString;
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  m_ws->noteJDoc[label] = shortCString;
   
   // It is not trivial to anticipate how many chars we are going to add,
   // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
+  len = m_noteOffset + measureJson(m_ws->noteJDoc);
   if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
@@ -395,33 +782,62 @@ int AlgoIoT::dataAddShortStringField(const char* label, char* shortCString)
 // Submit transaction to Algorand network
 // Return: error code (0 = OK)
 // We have the Note field ready, in ARC-2 JSON format
-int AlgoIoT::submitTransactionToAlgorand()
+int AlgoIoT::submitTransactionToAlgorand(const bool encryptNote)
 {
-  uint32_t fv = 0;
-  uint16_t fee = 0;
-  int iErr = 0;
-  uint8_t signature[ALGORAND_SIG_BYTES];
-  char notes[ALGORAND_MAX_NOTES_SIZE + 1] = "";
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
-  char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1];
-  msgPack msgPackTx = NULL;
+  char* notes = NULL;
+  uint16_t clearNoteBytes = 0;
 
+  if (encryptNote && !m_noteKeySet)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  if (claimNoteDocument() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+  notes = m_ws->notes;
   
   // Add preamble to ARC-2 note field
   // Write app name and format specifier for ARC-2 (we use the JSON flavour of ARC-2)
+  // Encrypted notes use the binary flavour: "<app-name>:b" || counter || ChaChaPoly(JSON) || tag
   memcpy((void*)&(notes[0]), (void*)m_appName, strlen(m_appName));
   m_noteOffset = strlen(m_appName);
   notes[m_noteOffset++] = ':';
-  notes[m_noteOffset++] = 'j';
+  notes[m_noteOffset++] = encryptNote ? 'b' : 'j';
+  if (encryptNote)
+  { // Room for the nonce counter, filled by encryptNoteInPlace()
+    m_noteOffset += ALGOIOT_NOTE_COUNTER_BYTES;
+    clearNoteBytes = m_noteOffset;
+  }
   m_noteLen += m_noteOffset;
 
   // Serialize Note field to binary buffer after "<app-name>:j"
-  int jlen = serializeJson(m_noteJDoc, (char*) (notes + m_noteOffset), ALGORAND_MAX_NOTES_SIZE);
+  int jlen = serializeJson(m_ws->noteJDoc, (char*) (notes + m_noteOffset), ALGORAND_MAX_NOTES_SIZE);
   if (jlen < 1)
   {
     return ALGOIOT_JSON_ERROR;
   }
   int notesLen = jlen + m_noteOffset;
+  if ( encryptNote && (notesLen + ALGOIOT_NOTE_TAG_BYTES > ALGORAND_MAX_NOTE_PROTOCOL_BYTES) )
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  return submitPaymentWithNote(notes, (uint16_t)notesLen, clearNoteBytes);
+}
+
+// Fetches params, builds, signs and submits a payment transaction carrying "notes"
+// Shared by sensor data and attestation root submissions
+// Return: error code (0 = OK)
+int AlgoIoT::submitPaymentWithNote(const char* notes, const uint16_t notesLen, const uint16_t clearNoteBytes,
+                                   const uint32_t amountMicroAlgos)
+{
+  uint32_t fv = 0;
+  uint16_t fee = 0;
+  int iErr = 0;
+  uint8_t signature[ALGORAND_SIG_BYTES];
+  uint8_t* notePayload = NULL;
+  msgPack msgPackTx = NULL;
 
   // Get current Algorand parameters
   int httpResCode = getAlgorandTxParams(&fv, &fee);
@@ -431,7 +847,7 @@ int AlgoIoT::submitTransactionToAlgorand()
   }
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -439,12 +855,23 @@ int AlgoIoT::submitTransactionToAlgorand()
     #endif
     return ALGOIOT_MESSAGEPACK_ERROR;
   }  
-  iErr = prepareTransactionMessagePack(msgPackTx, fv, fee, PAYMENT_AMOUNT_MICROALGOS, notes, (uint16_t)notesLen);
+  iErr = prepareTransactionMessagePack(msgPackTx, fv, fee, amountMicroAlgos, notes, notesLen,
+                                       (clearNoteBytes > 0) ? ALGOIOT_NOTE_TAG_BYTES : 0, &notePayload);
   if (iErr)
   {
     return ALGOIOT_MESSAGEPACK_ERROR;
   }
 
+  // Encrypted note: transform the note in place inside the messagepack, tag included, before signing
+  if (clearNoteBytes > 0)
+  {
+    iErr = encryptNoteInPlace(notePayload, clearNoteBytes, notesLen - clearNoteBytes, fv);
+    if (iErr)
+    {
+      return iErr;
+    }
+  }
+
   // Payment transaction correctly assembled. Now sign it
   iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
   if (iErr)
@@ -485,6 +912,7 @@ int AlgoIoT::submitTransactionToAlgorand()
   return ALGOIOT_NO_ERROR;
 }
 
+
 // Add this implementation after the existing submitTransactionToAlgorand method
 
 // Submit asset opt-in transaction to Algorand network
@@ -495,7 +923,6 @@ int AlgoIoT::submitAssetOptInToAlgorand(uint64_t assetId)
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1];
   msgPack msgPackTx = NULL;
 
@@ -515,7 +942,7 @@ int AlgoIoT::submitAssetOptInToAlgorand(uint64_t assetId)
   #endif
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -609,7 +1036,6 @@ int AlgoIoT::prepareAssetTransferMessagePack(msgPack msgPackTx,
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
   uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
   const char type[] = "axfer";
-  uint8_t nFields = ALGORAND_ASSET_TRANSFER_MIN_FIELDS;
 
   if (msgPackTx == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
@@ -663,517 +1089,390 @@ int AlgoIoT::prepareAssetTransferMessagePack(msgPack msgPackTx,
     return 5;
   }
 
-  // IMPORTANT: Make sure we include the xaid field in the field count
-  // Asset transfer requires 9 fields: arcv, fee, fv, gen, gh, lv, snd, type, xaid
-  nFields = 9;  // Change from 9 to 10 to include aamt field
-  
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
+  // Fields in canonical order, checked at compile time
+  iErr = AssetTransferTx::encode(msgPackTx, 0, NULL, m_senderAddressBytes, NULL, fee, lastRound, gen, m_netHash,
+                                  lv, m_senderAddressBytes, type, assetId);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, nFields);
+    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
 
-  // Fields must follow alphabetical order
+  // End of messagepack
 
-  // "arcv" label (asset receiver - same as sender for opt-in)
-  iErr = msgpackAddShortString(msgPackTx, "arcv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding arcv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // arcv value (binary buffer) - same as sender for opt-in
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding arcv value\n\n", iErr);
-    #endif
-    return 5;
+  return 0;
+}
+
+// Debug function to print MessagePack content in hexadecimal format
+void AlgoIoT::debugPrintMessagePack(msgPack msgPackTx) {
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("\nMessagePack content (hex):");
+  for (uint32_t i = 0; i < msgPackTx->currentMsgLen; i++) {
+    DEBUG_SERIAL.printf("%02X ", msgPackTx->msgBuffer[i]);
+    if ((i + 1) % 16 == 0) {
+      DEBUG_SERIAL.println();
+    }
   }
+  DEBUG_SERIAL.println("\n");
+  #endif
+}
 
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
+// Prints transaction data in a readable string format
+void AlgoIoT::printTransactionData(msgPack msgPackTx) {
+  #ifdef LIB_DEBUGMODE
+  mpkReader reader;
+  mpkValue value;
+  uint32_t fields = 0;
+  
+  DEBUG_SERIAL.println("\n----- TRANSACTION DATA (READABLE FORMAT) -----");
+  
+  // Signed transaction: {"sig": ..., "txn": {...}} from the start of the buffer
+  // Unsigned: the transaction map follows the blank header
+  msgpackReaderInit(&reader, msgPackTx->msgBuffer, msgPackTx->currentMsgLen);
+  if ( (msgpackReadMapHeader(&reader, &fields) != MPK_NO_ERROR) || 
+       (msgpackReaderFindKey(&reader, fields, "txn") != MPK_NO_ERROR) )
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding fee label\n\n", iErr);
-    #endif
-    return 5;
+    msgpackReaderInit(&reader, msgPackTx->msgBuffer + BLANK_MSGPACK_HEADER, msgPackTx->currentMsgLen);
   }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
+  if (msgpackReadMapHeader(&reader, &fields) != MPK_NO_ERROR)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding fee value\n\n", iErr);
-    #endif
-    return 5;
+    DEBUG_SERIAL.println("  Not a transaction map");
+    DEBUG_SERIAL.println("----- END TRANSACTION DATA -----\n");
+    return;
   }
-
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
+  
+  DEBUG_SERIAL.println("Transaction Fields:");
+  for (uint32_t i = 0; i < fields; i++)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
+    const char* label = NULL;
+    uint32_t labelLen = 0;
+    
+    if ( (msgpackReadString(&reader, &label, &labelLen) != MPK_NO_ERROR) ||
+         (msgpackReadValue(&reader, &value) != MPK_NO_ERROR) )
+    {
+      DEBUG_SERIAL.printf("  Malformed at byte %u\n", reader.currentPosition);
+      break;
+    }
+    DEBUG_SERIAL.printf("  %.*s: ", (int)labelLen, label);
+    switch (value.type)
+    {
+      case MPK_TYPE_UINT:
+        DEBUG_SERIAL.printf("%llu\n", (unsigned long long)value.u);
+        break;
+      case MPK_TYPE_INT:
+        DEBUG_SERIAL.printf("%lld\n", (long long)value.i);
+        break;
+      case MPK_TYPE_BOOL:
+        DEBUG_SERIAL.println(value.boolean ? "true" : "false");
+        break;
+      case MPK_TYPE_STR:
+        DEBUG_SERIAL.printf("%.*s\n", (int)value.len, (const char*)value.data);
+        break;
+      case MPK_TYPE_BIN:
+        if ((labelLen == 4) && (memcmp(label, "note", 4) == 0))
+        { // Print the note content as a string (if printable), limited to 100 chars
+          for (uint32_t j = 0; (j < value.len) && (j < 100); j++)
+          {
+            char c = (char)value.data[j];
+            DEBUG_SERIAL.print(((c >= 32) && (c <= 126)) ? c : '.');
+          }
+          if (value.len > 100)
+          {
+            DEBUG_SERIAL.print("... (truncated)");
+          }
+        }
+        else
+        { // Addresses, hashes: first bytes in hex
+          for (uint32_t j = 0; (j < value.len) && (j < 8); j++)
+          {
+            DEBUG_SERIAL.printf("%02X", value.data[j]);
+          }
+          DEBUG_SERIAL.printf("... (%u bytes)", value.len);
+        }
+        DEBUG_SERIAL.println();
+        break;
+      case MPK_TYPE_MAP:
+      case MPK_TYPE_ARRAY:
+        // Nested (e.g. asset params): show the size and skip the content
+        DEBUG_SERIAL.printf("%s of %u\n", (value.type == MPK_TYPE_MAP) ? "map" : "array", value.count);
+        reader.currentPosition = value.offset;
+        msgpackSkipValue(&reader);
+        break;
+      default:
+        DEBUG_SERIAL.printf("(type %u)\n", value.type);
+        break;
+    }
   }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
+  
+  DEBUG_SERIAL.println("----- END TRANSACTION DATA -----\n");
+  #endif
+}
+
+// Encrypted notes
+// Key is derived per device, so one master key can be provisioned on a whole fleet
+
+int AlgoIoT::setNoteEncryptionKey(const uint8_t* masterKey, const size_t masterKeyLen, const uint32_t initialCounter)
+{
+  if (masterKey == NULL)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (masterKeyLen < ALGOIOT_NOTE_KEY_BYTES)
+  {
+    return ALGOIOT_BAD_PARAM;
   }
 
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
+  hkdf<SHA256>(m_noteKey, ALGOIOT_NOTE_KEY_BYTES, masterKey, masterKeyLen,
+               m_senderAddressBytes, ALGORAND_ADDRESS_BYTES,
+               ALGOIOT_NOTE_KDF_INFO, strlen(ALGOIOT_NOTE_KDF_INFO));
+  m_noteCounter = initialCounter;
+  m_noteKeySet = true;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+uint32_t AlgoIoT::getNoteCounter() const
+{
+  return m_noteCounter;
+}
+
+
+int AlgoIoT::encryptNoteInPlace(uint8_t* note, const uint16_t clearBytes, const uint16_t bodyBytes, const uint32_t firstRound)
+{
+  uint8_t nonce[ALGOIOT_NOTE_NONCE_BYTES];
+  uint8_t* counter = NULL;
+  ChaChaPoly cipher;
+
+  if (note == NULL)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NULL_POINTER_ERROR;
   }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
+  if ( (!m_noteKeySet) || (clearBytes < ALGOIOT_NOTE_COUNTER_BYTES) )
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding gen string\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_BAD_PARAM;
   }
+  
+  // Counter is the last part of the clear prefix; nonce = counter || firstRound (BE)
+  counter = note + clearBytes - ALGOIOT_NOTE_COUNTER_BYTES;
+  counter[0] = (uint8_t)(m_noteCounter >> 24);
+  counter[1] = (uint8_t)(m_noteCounter >> 16);
+  counter[2] = (uint8_t)(m_noteCounter >> 8);
+  counter[3] = (uint8_t)m_noteCounter;
+  memcpy(nonce, counter, ALGOIOT_NOTE_COUNTER_BYTES);
+  memset(nonce + ALGOIOT_NOTE_COUNTER_BYTES, 0, 4);
+  nonce[8] = (uint8_t)(firstRound >> 24);
+  nonce[9] = (uint8_t)(firstRound >> 16);
+  nonce[10] = (uint8_t)(firstRound >> 8);
+  nonce[11] = (uint8_t)firstRound;
 
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
+  if ( (!cipher.setKey(m_noteKey, ALGOIOT_NOTE_KEY_BYTES)) || (!cipher.setIV(nonce, ALGOIOT_NOTE_NONCE_BYTES)) )
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
+    cipher.clear();
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
   }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
+  cipher.addAuthData(note, clearBytes);
+  cipher.encrypt(note + clearBytes, note + clearBytes, bodyBytes);
+  cipher.computeTag(note + clearBytes + bodyBytes, ALGOIOT_NOTE_TAG_BYTES);
+  cipher.clear();
+
+  m_noteCounter++;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Off-chain attestations
+// Each reading is signed ("MX" || reading, as algosdk signBytes) and its leaf hash logged;
+// submitAttestationRootToAlgorand() anchors the Merkle root of the whole log in one note
+
+int AlgoIoT::attestReading(const uint8_t* reading, const uint16_t readingLen,
+                           uint8_t signature[ALGORAND_SIG_BYTES], uint32_t* leafIndex)
+{
+  uint8_t sig[ALGORAND_SIG_BYTES];
+  uint8_t* signedBytes = NULL;
+
+  if (reading == NULL)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding gh value\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (readingLen == 0)
+  {
+    return ALGOIOT_BAD_PARAM;
   }
 
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
+  // Log is allocated on first use, so devices not using attestations pay nothing
+  if (m_attestLeaves == NULL)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding lv label\n\n", iErr);
-    #endif
-    return 5;
+    m_attestLeaves = (uint8_t (*)[MERKLE_HASH_BYTES])malloc(ALGOIOT_ATTEST_MAX_LEAVES * MERKLE_HASH_BYTES);
+    if (!m_attestLeaves)
+    {
+      return ALGOIOT_MEMORY_ERROR;
+    }
+    m_attestCount = 0;
   }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
+  // First reading after a successful anchor starts a new batch
+  if (m_attestAnchored)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding lv value\n\n", iErr);
-    #endif
-    return 5;
+    m_attestCount = 0;
+    m_attestAnchored = false;
+  }
+  if (m_attestCount >= ALGOIOT_ATTEST_MAX_LEAVES)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
   }
 
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
+  signedBytes = (uint8_t*)malloc(readingLen + MERKLE_SIGN_PREFIX_BYTES);
+  if (!signedBytes)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_MEMORY_ERROR;
   }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
+  memcpy(signedBytes, MERKLE_SIGN_PREFIX, MERKLE_SIGN_PREFIX_BYTES);
+  memcpy(signedBytes + MERKLE_SIGN_PREFIX_BYTES, reading, readingLen);
+  Ed25519::sign(sig, m_privateKey, m_senderAddressBytes, signedBytes, readingLen + MERKLE_SIGN_PREFIX_BYTES);
+  free(signedBytes);
+
+  AlgoMerkle::hashLeaf(m_attestLeaves[m_attestCount], sig, reading, readingLen);
+
+  if (signature != NULL)
+    memcpy(signature, sig, ALGORAND_SIG_BYTES);
+  if (leafIndex != NULL)
+    *leafIndex = m_attestCount;
+  m_attestCount++;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+uint32_t AlgoIoT::getAttestationCount() const
+{
+  return m_attestCount;
+}
+
+int AlgoIoT::getAttestationRoot(uint8_t root[MERKLE_HASH_BYTES])
+{
+  if (root == NULL)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding snd value\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if ((m_attestLeaves == NULL) || (m_attestCount == 0))
+  {
+    return ALGOIOT_BAD_PARAM;
   }
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr)
+  AlgoMerkle::computeRoot(root, m_attestLeaves, m_attestCount);
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::getAttestationProof(const uint32_t leafIndex, uint8_t proof[][MERKLE_HASH_BYTES], uint8_t* proofLen)
+{
+  int len = 0;
+
+  if ((proof == NULL) || (proofLen == NULL))
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding type label\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NULL_POINTER_ERROR;
   }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "axfer");
-  if (iErr)
+  if ((m_attestLeaves == NULL) || (leafIndex >= m_attestCount))
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding type string\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  len = AlgoMerkle::buildProof(proof, m_attestLeaves, m_attestCount, leafIndex);
+  if (len < 0)
+  {
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
   }
+  *proofLen = (uint8_t)len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+// Note is ARC-2 JSON: <app-name>:j{"mroot":"<base64 root>","n":<leaf count>}
+int AlgoIoT::submitAttestationRootToAlgorand()
+{
+  uint8_t root[MERKLE_HASH_BYTES];
+  unsigned char rootB64[ALGOIOT_MERKLE_ROOT_B64_CHARS + 1];
+  char notes[DAPP_NAME_MAX_LEN + ALGOIOT_ATTEST_NOTE_MARGIN + ALGOIOT_MERKLE_ROOT_B64_CHARS + 1];
+  int notesLen = 0;
+  int iErr = 0;
 
-  // "xaid" label
-  iErr = msgpackAddShortString(msgPackTx, "xaid");
+  iErr = getAttestationRoot(root);
   if (iErr)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding xaid label\n\n", iErr);
-    #endif
-    return 5;
+    return iErr;
   }
-  
-  // xaid value - Use UInt32 for asset IDs that fit in 32 bits to match Algo SDK encoding
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nAdding asset ID: %llu\n", assetId);
-  #endif
-  
-  // Check if the asset ID fits in a uint32
-  if (assetId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)assetId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, assetId);
+
+  encode_base64(root, MERKLE_HASH_BYTES, rootB64);
+  rootB64[ALGOIOT_MERKLE_ROOT_B64_CHARS] = '\0';
+  notesLen = snprintf(notes, sizeof(notes), "%s:j{\"mroot\":\"%s\",\"n\":%lu}",
+                      m_appName, (const char*)rootB64, (unsigned long)m_attestCount);
+  if ((notesLen < 1) || (notesLen >= (int)sizeof(notes)))
+  {
+    return ALGOIOT_JSON_ERROR;
   }
-  
+
+  iErr = submitPaymentWithNote(notes, (uint16_t)notesLen);
   if (iErr)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetTransferMessagePack(): ERROR %d adding xaid value\n\n", iErr);
-    #endif
-    return 5;
+    return iErr;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nAsset transfer MessagePack preparation complete");
-  #endif
 
-  // End of messagepack
-  return 0;
-}
+  // Anchored: proofs stay available until the next attestReading() opens a new batch
+  m_attestAnchored = true;
 
-// Debug function to print MessagePack content in hexadecimal format
-void AlgoIoT::debugPrintMessagePack(msgPack msgPackTx) {
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nMessagePack content (hex):");
-  for (uint32_t i = 0; i < msgPackTx->currentMsgLen; i++) {
-    DEBUG_SERIAL.printf("%02X ", msgPackTx->msgBuffer[i]);
-    if ((i + 1) % 16 == 0) {
-      DEBUG_SERIAL.println();
-    }
-  }
-  DEBUG_SERIAL.println("\n");
+  DEBUG_SERIAL.printf("\t Merkle root of %lu readings anchored\n", (unsigned long)m_attestCount);
   #endif
+
+  return ALGOIOT_NO_ERROR;
 }
 
-// Prints transaction data in a readable string format
-void AlgoIoT::printTransactionData(msgPack msgPackTx) {
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\n----- TRANSACTION DATA (READABLE FORMAT) -----");
-  
-  // Skip to the transaction content (after header or after "txn" field if signed)
-  uint32_t startPos = 0;
-  bool isSigned = false;
-  
-  // Check if this is a signed transaction (has "sig" and "txn" fields)
-  for (uint32_t i = 0; i < 20 && i < msgPackTx->currentMsgLen; i++) {
-    // Look for "sig" string in the first few bytes
-    if (i + 3 < msgPackTx->currentMsgLen && 
-        msgPackTx->msgBuffer[i] == 's' && 
-        msgPackTx->msgBuffer[i+1] == 'i' && 
-        msgPackTx->msgBuffer[i+2] == 'g') {
-      isSigned = true;
-      break;
-    }
-  }
-  
-  if (isSigned) {
-    // For signed transactions, find the "txn" field
-    for (uint32_t i = 0; i < msgPackTx->currentMsgLen - 3; i++) {
-      if (msgPackTx->msgBuffer[i] == 't' && 
-          msgPackTx->msgBuffer[i+1] == 'x' && 
-          msgPackTx->msgBuffer[i+2] == 'n') {
-        startPos = i + 3; // Skip past "txn"
-        break;
-      }
-    }
-  } else {
-    // For unsigned transactions, start after the header
-    startPos = BLANK_MSGPACK_HEADER;
-  }
+///////////////////////////
+//
+// End exported functions
+//
+///////////////////////////
+
+
+// Private methods
+
+// Decodes Base64 Algorand network hash to 32-byte binary buffer suitable for our functions
+// outBinaryHash has to be freed by caller
+// Returns error code (0 = OK)
+int AlgoIoT::decodeAlgorandNetHash(const char* hashB64, uint8_t*& outBinaryHash)
+{ 
+  if (hashB64 == NULL)
+    return 1;
   
-  // Parse and print transaction fields
-  DEBUG_SERIAL.println("Transaction Fields:");
+  int inputLen = strlen(hashB64);
+  if (inputLen > encode_base64_length(ALGORAND_NET_HASH_BYTES))
+    return 2;
   
-  // Transaction type
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 4; i++) {
-    if (msgPackTx->msgBuffer[i] == 't' && 
-        msgPackTx->msgBuffer[i+1] == 'y' && 
-        msgPackTx->msgBuffer[i+2] == 'p' && 
-        msgPackTx->msgBuffer[i+3] == 'e') {
-      // Find the type value (usually "pay" or "axfer")
-      char typeStr[10] = {0};
-      uint8_t typeLen = 0;
-      
-      // Skip to the value (usually 5 bytes after "type")
-      i += 5;
-      
-      // Copy the string value
-      while (i < msgPackTx->currentMsgLen && typeLen < 9 && 
-             msgPackTx->msgBuffer[i] >= 32 && msgPackTx->msgBuffer[i] <= 126) {
-        typeStr[typeLen++] = msgPackTx->msgBuffer[i++];
-      }
-      
-      DEBUG_SERIAL.printf("  Type: %s\n", typeStr);
-      break;
-    }
-  }
+  outBinaryHash = (uint8_t*) malloc(ALGORAND_NET_HASH_BYTES);
   
-  // Fee
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 3; i++) {
-    if (msgPackTx->msgBuffer[i] == 'f' && 
-        msgPackTx->msgBuffer[i+1] == 'e' && 
-        msgPackTx->msgBuffer[i+2] == 'e') {
-      // Fee is usually encoded as a uint16, so look for the value 2-3 bytes after "fee"
-      uint16_t fee = 0;
-      
-      // Skip to the value (usually 3-4 bytes after "fee")
-      i += 4;
-      
-      // Simple extraction - this is a rough approximation
-      if (i+1 < msgPackTx->currentMsgLen) {
-        fee = (msgPackTx->msgBuffer[i] << 8) | msgPackTx->msgBuffer[i+1];
-        DEBUG_SERIAL.printf("  Fee: %u microAlgos\n", fee);
-      }
-      break;
-    }
+  int hashLen = decode_base64((unsigned char*)hashB64, outBinaryHash);
+  if (hashLen != ALGORAND_NET_HASH_BYTES)
+  {
+    free(outBinaryHash);
+    return 3;
   }
+
+  return 0;
+}
+
+
+int AlgoIoT::decodeAlgorandAddress(const char* addressB32, uint8_t*& outBinaryAddress)
+{
+  if (addressB32 == NULL)
+    return 1;
   
-  // First valid round (fv)
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 2; i++) {
-    if (msgPackTx->msgBuffer[i] == 'f' && 
-        msgPackTx->msgBuffer[i+1] == 'v') {
-      // fv is usually encoded as a uint32, so look for the value 2-3 bytes after "fv"
-      uint32_t fv = 0;
-      
-      // Skip to the value (usually 3-5 bytes after "fv")
-      i += 3;
-      
-      // Simple extraction - this is a rough approximation
-      if (i+3 < msgPackTx->currentMsgLen) {
-        fv = (msgPackTx->msgBuffer[i] << 24) | 
-             (msgPackTx->msgBuffer[i+1] << 16) | 
-             (msgPackTx->msgBuffer[i+2] << 8) | 
-             msgPackTx->msgBuffer[i+3];
-        DEBUG_SERIAL.printf("  First Valid Round: %u\n", fv);
-      }
-      break;
-    }
-  }
-  
-  // Last valid round (lv)
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 2; i++) {
-    if (msgPackTx->msgBuffer[i] == 'l' && 
-        msgPackTx->msgBuffer[i+1] == 'v') {
-      // lv is usually encoded as a uint32, so look for the value 2-3 bytes after "lv"
-      uint32_t lv = 0;
-      
-      // Skip to the value (usually 3-5 bytes after "lv")
-      i += 3;
-      
-      // Simple extraction - this is a rough approximation
-      if (i+3 < msgPackTx->currentMsgLen) {
-        lv = (msgPackTx->msgBuffer[i] << 24) | 
-             (msgPackTx->msgBuffer[i+1] << 16) | 
-             (msgPackTx->msgBuffer[i+2] << 8) | 
-             msgPackTx->msgBuffer[i+3];
-        DEBUG_SERIAL.printf("  Last Valid Round: %u\n", lv);
-      }
-      break;
-    }
-  }
-  
-  // For asset transfers, print the asset ID
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 4; i++) {
-    if (msgPackTx->msgBuffer[i] == 'x' && 
-        msgPackTx->msgBuffer[i+1] == 'a' && 
-        msgPackTx->msgBuffer[i+2] == 'i' && 
-        msgPackTx->msgBuffer[i+3] == 'd') {
-      // xaid could be uint32 or uint64
-      uint64_t assetId = 0;
-      
-      // Skip to the value
-      i += 5;
-      
-      // Check if it's a uint32 or uint64 by looking at the format byte
-      if (msgPackTx->msgBuffer[i-1] == 0xCE) {  // uint32 format
-        if (i+3 < msgPackTx->currentMsgLen) {
-          assetId = (uint32_t)((msgPackTx->msgBuffer[i] << 24) | 
-                   (msgPackTx->msgBuffer[i+1] << 16) | 
-                   (msgPackTx->msgBuffer[i+2] << 8) | 
-                   msgPackTx->msgBuffer[i+3]);
-        }
-      } else if (msgPackTx->msgBuffer[i-1] == 0xCF) {  // uint64 format
-        if (i+7 < msgPackTx->currentMsgLen) {
-          assetId = ((uint64_t)msgPackTx->msgBuffer[i] << 56) | 
-                    ((uint64_t)msgPackTx->msgBuffer[i+1] << 48) | 
-                    ((uint64_t)msgPackTx->msgBuffer[i+2] << 40) | 
-                    ((uint64_t)msgPackTx->msgBuffer[i+3] << 32) | 
-                    ((uint64_t)msgPackTx->msgBuffer[i+4] << 24) | 
-                    ((uint64_t)msgPackTx->msgBuffer[i+5] << 16) | 
-                    ((uint64_t)msgPackTx->msgBuffer[i+6] << 8) | 
-                    (uint64_t)msgPackTx->msgBuffer[i+7];
-        }
-      }
-      
-      DEBUG_SERIAL.printf("  Asset ID: %llu\n", assetId);
-      break;
-    }
-  }
-  
-  // For payment transactions, print the amount
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 3; i++) {
-    if (msgPackTx->msgBuffer[i] == 'a' && 
-        msgPackTx->msgBuffer[i+1] == 'm' && 
-        msgPackTx->msgBuffer[i+2] == 't') {
-      // Amount could be encoded in various ways
-      uint32_t amount = 0;
-      
-      // Skip to the value
-      i += 4;
-      
-      // Simple extraction - this is a rough approximation
-      if (i < msgPackTx->currentMsgLen) {
-        // Check format byte
-        if (msgPackTx->msgBuffer[i-1] < 0x80) {  // positive fixint
-          amount = msgPackTx->msgBuffer[i-1];
-        } else if (msgPackTx->msgBuffer[i-1] == 0xCC) {  // uint8
-          amount = msgPackTx->msgBuffer[i];
-        } else if (msgPackTx->msgBuffer[i-1] == 0xCD) {  // uint16
-          amount = (msgPackTx->msgBuffer[i] << 8) | msgPackTx->msgBuffer[i+1];
-        } else if (msgPackTx->msgBuffer[i-1] == 0xCE) {  // uint32
-          amount = (msgPackTx->msgBuffer[i] << 24) | 
-                   (msgPackTx->msgBuffer[i+1] << 16) | 
-                   (msgPackTx->msgBuffer[i+2] << 8) | 
-                   msgPackTx->msgBuffer[i+3];
-        }
-        
-        DEBUG_SERIAL.printf("  Amount: %u microAlgos\n", amount);
-      }
-      break;
-    }
-  }
-  
-  // Print note field if present
-  for (uint32_t i = startPos; i < msgPackTx->currentMsgLen - 4; i++) {
-    if (msgPackTx->msgBuffer[i] == 'n' && 
-        msgPackTx->msgBuffer[i+1] == 'o' && 
-        msgPackTx->msgBuffer[i+2] == 't' && 
-        msgPackTx->msgBuffer[i+3] == 'e') {
-      
-      // Skip to the value
-      i += 5;
-      
-      // Check format byte to determine length
-      uint16_t noteLen = 0;
-      uint32_t noteStart = 0;
-      
-      if (msgPackTx->msgBuffer[i-1] == 0xC4) {  // bin 8 format
-        noteLen = msgPackTx->msgBuffer[i];
-        noteStart = i + 1;
-      } else if (msgPackTx->msgBuffer[i-1] == 0xC5) {  // bin 16 format
-        noteLen = (msgPackTx->msgBuffer[i] << 8) | msgPackTx->msgBuffer[i+1];
-        noteStart = i + 2;
-      }
-      
-      if (noteLen > 0 && noteStart + noteLen <= msgPackTx->currentMsgLen) {
-        DEBUG_SERIAL.print("  Note: ");
-        
-        // Print the note content as a string (if printable)
-        for (uint16_t j = 0; j < noteLen && j < 100; j++) {  // Limit to 100 chars
-          char c = msgPackTx->msgBuffer[noteStart + j];
-          if (c >= 32 && c <= 126) {  // Printable ASCII
-            DEBUG_SERIAL.print(c);
-          } else {
-            DEBUG_SERIAL.print('.');  // Replace non-printable with dot
-          }
-        }
-        
-        if (noteLen > 100) {
-          DEBUG_SERIAL.print("... (truncated)");
-        }
-        
-        DEBUG_SERIAL.println();
-      }
-      break;
-    }
-  }
-  
-  DEBUG_SERIAL.println("----- END TRANSACTION DATA -----\n");
-  #endif
-}
-
-///////////////////////////
-//
-// End exported functions
-//
-///////////////////////////
-
-
-// Private methods
-
-// Decodes Base64 Algorand network hash to 32-byte binary buffer suitable for our functions
-// outBinaryHash has to be freed by caller
-// Returns error code (0 = OK)
-int AlgoIoT::decodeAlgorandNetHash(const char* hashB64, uint8_t*& outBinaryHash)
-{ 
-  if (hashB64 == NULL)
-    return 1;
-  
-  int inputLen = strlen(hashB64);
-  if (inputLen > encode_base64_length(ALGORAND_NET_HASH_BYTES))
-    return 2;
-  
-  outBinaryHash = (uint8_t*) malloc(ALGORAND_NET_HASH_BYTES);
-  
-  int hashLen = decode_base64((unsigned char*)hashB64, outBinaryHash);
-  if (hashLen != ALGORAND_NET_HASH_BYTES)
-  {
-    free(outBinaryHash);
-    return 3;
-  }
-
-  return 0;
-}
-
-
-int AlgoIoT::decodeAlgorandAddress(const char* addressB32, uint8_t*& outBinaryAddress)
-{
-  if (addressB32 == NULL)
-    return 1;
-  
-  int iLen = Base32::fromBase32((uint8_t*)addressB32, strlen(addressB32), outBinaryAddress);
-  if (iLen < ALGORAND_ADDRESS_BYTES + 4)  // Decoded address len from Base32 has to be exactly 36 bytes (but we use only the first 32 bytes)
-  {
-    free(outBinaryAddress);
-    return 2;
+  int iLen = Base32::fromBase32((uint8_t*)addressB32, strlen(addressB32), outBinaryAddress);
+  if (iLen < ALGORAND_ADDRESS_BYTES + 4)  // Decoded address len from Base32 has to be exactly 36 bytes (but we use only the first 32 bytes)
+  {
+    free(outBinaryAddress);
+    return 2;
   }
 
   return 0;
@@ -1272,995 +1571,150 @@ int AlgoIoT::decodePrivateKeyFromMnemonics(const char* inMnemonicWords, uint8_t
   }
   
   // Handle any remaining bits
-  if (numBits > 0)
-  {
-    decodedBytes[destIndex] = (uint8_t)(tempInt & 0xff);
-  }
-
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("Derived private key (first 8 bytes):");
-  for (int i = 0; i < 8; i++) {
-    DEBUG_SERIAL.printf("%02X ", decodedBytes[i]);
-  }
-  DEBUG_SERIAL.println();
-  #endif
-
-  // Copy key to output array (first 32 bytes)
-  memcpy((void*)privateKey, (void*)decodedBytes, ALGORAND_KEY_BYTES);
-
-  return 0;
-}
-
-
-// Retrieves current Algorand transaction parameters
-// Returns HTTP error code
-// TODO: On error codes 5xx (server error), maybe we should retry after 5s?
-int AlgoIoT::getAlgorandTxParams(uint32_t* round, uint16_t* minFee)
-{
-  String httpRequest = m_httpBaseURL + GET_TRANSACTION_PARAMS;
-          
-  *round = 0;
-  *minFee = 0;
-
-  // configure server and url               
-  m_httpClient.begin(httpRequest);
-    
-  int httpResponseCode = m_httpClient.GET();
-
-      
-  // httpResponseCode will be negative on error
-  if (httpResponseCode < 0)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.print("HTTP GET failed, error: "); DEBUG_SERIAL.println(m_httpClient.errorToString(httpResponseCode).c_str());
-    #endif
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  }
-  else
-  {
-    switch (httpResponseCode)
-    {
-      case 200:
-      {   // No error: let's get the response
-        String payload = m_httpClient.getString();
-        StaticJsonDocument<ALGORAND_MAX_RESPONSE_LEN> JSONResDoc;
-                        
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("GetParams server response:");
-        DEBUG_SERIAL.println(payload);
-        #endif
-
-        DeserializationError error = deserializeJson(JSONResDoc, payload);                
-        if (error) 
-        {
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("GetParams: JSON response parsing failed!");
-          #endif
-          return ALGOIOT_INTERNAL_GENERIC_ERROR;
-        }
-        else
-        { // Fetch interesting fields
-          *minFee = JSONResDoc["min-fee"];
-          *round = JSONResDoc["last-round"];
-
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("Algorand transaction parameters received:");
-          DEBUG_SERIAL.print("min-fee = "); DEBUG_SERIAL.print(*minFee); DEBUG_SERIAL.println(" microAlgo");
-          DEBUG_SERIAL.print("last-round = "); DEBUG_SERIAL.println(*round);                  
-          #endif                  
-        }
-      }
-      break;
-      case 204:
-      {   // No error, but no data available from server
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("Server returned no data");
-        #endif
-        return ALGOIOT_NETWORK_ERROR;
-      }
-      break;
-      default:
-      {
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.print("Unmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
-        #endif
-        return ALGOIOT_INTERNAL_GENERIC_ERROR;
-      }
-      break;
-    }
-  }        
-  
-  m_httpClient.end();
-
-  return httpResponseCode;
-}
-
-
-
-// To be called AFTER getAlgorandTxParams(), because we need current "min-fee" and "last-round" values from algod
-// Returns error code (0 = OK)
-int AlgoIoT::prepareTransactionMessagePack(msgPack msgPackTx,
-                                  const uint32_t lastRound, 
-                                  const uint16_t fee, 
-                                  const uint32_t paymentAmountMicroAlgos,
-                                  const char* notes,
-                                  const uint16_t notesLen)
-{ 
-  int iErr = 0;
-  char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
-  uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  const char type[] = "pay";
-  uint8_t nFields = ALGORAND_PAYMENT_TRANSACTION_MIN_FIELDS;
-
-  if (msgPackTx == NULL)
-    return ALGOIOT_NULL_POINTER_ERROR;
-  if (msgPackTx->msgBuffer == NULL)
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  if ((lastRound == 0) || (fee == 0) || (paymentAmountMicroAlgos < ALGORAND_MIN_PAYMENT_MICROALGOS))
-  {
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  }
-  
-  if ( (notes != NULL) && (notesLen > 0) )
-    nFields++;  // We have 9 fields without Note, 10 with Note
-
-  if (m_networkType == ALGORAND_TESTNET)
-  { // TestNet
-    strncpy(gen, ALGORAND_TESTNET_ID, ALGORAND_NETWORK_ID_CHARS);
-    // Decode Algorand network hash
-    iErr = decodeAlgorandNetHash(ALGORAND_TESTNET_HASH, m_netHash);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  else
-  { // MainNet
-    strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
-    iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
-
-
-  // We leave a blank space header so we can add:
-  // - "TX" prefix before signing
-  // - m_signature field and "txn" node field after signing
-  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding root map\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // Fields must follow alphabetical order
-
-  // "amt" label
-  iErr = msgpackAddShortString(msgPackTx, "amt");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding amt label\n\n");
-    #endif
-
-    return 5;
-  }
-  // amt value
-  // Note: encoding depends on payment amount
-  if (paymentAmountMicroAlgos < 128)
-  {
-    iErr = msgpackAddUInt7(msgPackTx, (uint8_t)paymentAmountMicroAlgos);
-  }
-  else
-  {
-    if (paymentAmountMicroAlgos < 256)
-    {
-      iErr = msgpackAddUInt8(msgPackTx, (uint8_t)paymentAmountMicroAlgos);
-    }
-    else
-    {
-      if (paymentAmountMicroAlgos < 65536)
-      {
-        iErr = msgpackAddUInt16(msgPackTx, (uint16_t)paymentAmountMicroAlgos);
-      }
-      else    
-      {
-        iErr = msgpackAddUInt32(msgPackTx, paymentAmountMicroAlgos);
-      }
-    }
-  }
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding amt value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fee label\n\n");
-    #endif
-
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fee value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fv label\n\n");
-    #endif
-
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fv value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gen label\n\n");
-    #endif
-
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gen string\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gh label\n\n");
-    #endif
-
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gh value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding lv label\n\n");
-    #endif
-
-    return 5;
-  }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding lv value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  if ((notes != NULL) && (notesLen > 0))
-  {
-    // Add "note" label
-    iErr = msgpackAddShortString(msgPackTx, "note");
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding note label\n\n");
-      #endif
-
-      return 5;
-    }
-    // Add note content as binary buffer
-    // WARNING: if note len is < 256, we have to encode Bin 8 so msgpackAddShortByteArray
-    // Otherwise, m_signature does not pass verification
-    if (notesLen < 256)
-      iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)notes, (const uint8_t)notesLen);    
-    else
-      iErr = msgpackAddByteArray(msgPackTx, (const uint8_t*)notes, (const uint16_t)notesLen);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding notes content\n\n");
-      #endif
-
-      return 5;
-    }
-  }
-
-  // "rcv" label
-  iErr = msgpackAddShortString(msgPackTx, "rcv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding rcv label\n\n");
-    #endif
-
-    return 5;
-  }
-  // rcv value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_receiverAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding rcv value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding snd label\n\n");
-    #endif
-
-    return 5;
-  }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding snd value\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding type label\n\n");
-    #endif
-
-    return 5;
-  }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "pay");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding type string\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // End of messagepack
-
-  return 0;
-}
-
-
-
-// Obtains Ed25519 signature of passed MessagePack, adding "TX" prefix; fills "signature" return buffer
-// To be called AFTER convertToMessagePack()
-// Returns error code (0 = OK)
-// Caller passes a 64-byte array in "signature", to be filled
-int AlgoIoT::signMessagePackAddingPrefix(msgPack msgPackTx, uint8_t signature[ALGORAND_SIG_BYTES])
-{
-  uint8_t* payloadPointer = NULL;
-  uint32_t payloadBytes = 0;
-
-  if (msgPackTx == NULL)
-    return 1;
-  if (msgPackTx->msgBuffer == NULL)
-    return 2;
-  if (msgPackTx->currentMsgLen == 0)
-    return 2;
-
-  // We sign from prefix (included), leaving out the rest of the blank header
-  payloadPointer = msgPackTx->msgBuffer + BLANK_MSGPACK_HEADER - ALGORAND_TRANSACTION_PREFIX_BYTES;
-  payloadBytes = msgPackTx->currentMsgLen + ALGORAND_TRANSACTION_PREFIX_BYTES;
-
-  // Add prefix to messagepack; we purposedly left a blank header, with length BLANK_MSGPACK_HEADER
-  payloadPointer[0] = 'T';
-  payloadPointer[1] = 'X';
-
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("Transaction data to be signed (with TX prefix):");
-  for (uint32_t i = 0; i < 16 && i < payloadBytes; i++) {
-    DEBUG_SERIAL.printf("%02X ", payloadPointer[i]);
-  }
-  DEBUG_SERIAL.println("...");
-  
-  DEBUG_SERIAL.println("Private key (first 8 bytes):");
-  for (int i = 0; i < 8; i++) {
-    DEBUG_SERIAL.printf("%02X ", m_privateKey[i]);
-  }
-  DEBUG_SERIAL.println();
-  
-  DEBUG_SERIAL.println("Public key (first 8 bytes):");
-  for (int i = 0; i < 8; i++) {
-    DEBUG_SERIAL.printf("%02X ", m_senderAddressBytes[i]);
-  }
-  DEBUG_SERIAL.println();
-  #endif
-
-  // Sign pack+prefix
-  Ed25519::sign(signature, m_privateKey, m_senderAddressBytes, payloadPointer, payloadBytes);
-
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("Generated signature (first 16 bytes):");
-  for (int i = 0; i < 16; i++) {
-    DEBUG_SERIAL.printf("%02X ", signature[i]);
-  }
-  DEBUG_SERIAL.println("...");
-  #endif
-
-  return 0;
-}
-
-
-// Add signature to MessagePack. We reserved a blank space header for this purpose
-// To be called AFTER signMessagePackAddingPrefix()
-// Returns error code (0 = OK)
-int AlgoIoT::createSignedBinaryTransaction(msgPack mPack, const uint8_t signature[ALGORAND_SIG_BYTES])
-{
-  int iErr = 0;
-  // When adding the m_signature "sig" field, the messagepack has to be changed into a 2-level structure,
-  // with a "txn" node holding existing fields and a new "sig" field directly in root
-  // The JSON equivalent would be something like:
-  /*
-  {
-    "sig": <array>,
-    "txn": 
-    {
-     "amt": 10000000,
-     "fee": 1000,
-     "fv": 32752600,
-     "gen": "testnet-v1.0",
-      [...]
-    }
-  }
-  */
-
-  // We reset internal msgpack pointer, since we now start from the beginning of the messagepack (filling the blank space)
-  iErr = msgPackModifyCurrentPosition(mPack, 0);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d resetting position\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // Add a Map holding 2 fields (sig and txn)
-  iErr = msgpackAddShortMap(mPack, 2);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding map\n\n");
-    #endif
-
-    return 5;
-  }
-  
-  // Add "sig" label
-  iErr = msgpackAddShortString(mPack, "sig");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding sign label\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // Add m_signature, which is a 64-bytes byte array 
-  iErr = msgpackAddShortByteArray(mPack, signature, (const uint8_t)ALGORAND_SIG_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding m_signature\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // Add "txn" label
-  iErr = msgpackAddShortString(mPack, "txn");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding txn label\n\n");
-    #endif
-
-    return 5;
-  }
-
-  // The rest stays as it is
-
-  return 0;
-}
-
-
-// Submits transaction messagepack to algod
-// Last method to be called, after all the others
-// Returns http response code (200 = OK) or AlgoIoT error code
-// TODO: On error codes 5xx (server error), maybe we should retry after 5s?
-int AlgoIoT::submitTransaction(msgPack msgPackTx)
-{
-  String httpRequest = m_httpBaseURL + POST_TRANSACTION;
-          
-  // Configure server and url               
-  m_httpClient.begin(httpRequest);
-  
-  // Configure MIME type
-  m_httpClient.addHeader("Content-Type", ALGORAND_POST_MIME_TYPE);
-
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nSubmitting transaction to: %s\n", httpRequest.c_str());
-  DEBUG_SERIAL.printf("Content-Type: %s\n", ALGORAND_POST_MIME_TYPE);
-  DEBUG_SERIAL.printf("Payload size: %d bytes\n", msgPackTx->currentMsgLen);
-  #endif
-
-  int httpResponseCode = m_httpClient.POST(msgPackTx->msgBuffer, msgPackTx->currentMsgLen);
-      
-  // httpResponseCode will be negative on error
-  if (httpResponseCode < 0)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.print("\n[HTTP] POST failed, error: "); DEBUG_SERIAL.println(m_httpClient.errorToString(httpResponseCode).c_str());
-    #endif
-  }
-  else
-  {
-    switch (httpResponseCode)
-    {
-      case 200:
-      {   // No error: let's get the response for debug purposes
-        String payload = m_httpClient.getString();
-        StaticJsonDocument<ALGORAND_MAX_RESPONSE_LEN> JSONResDoc;
-                        
-        DeserializationError error = deserializeJson(JSONResDoc, payload);                
-        if (error) 
-        {
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("JSON response parsing failed!");
-          DEBUG_SERIAL.println(payload);
-          #endif
-          return ALGOIOT_INTERNAL_GENERIC_ERROR;
-        }
-        else
-        { // Fetch interesting fields                  
-          strncpy(m_transactionID, JSONResDoc["txId"], 64);
-          
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("Server response:");
-          DEBUG_SERIAL.println(payload);
-          #endif
-        }
-      }
-      break;
-      case 204:
-      {   // No error, but no data available from server
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("\nServer returned no data");
-        #endif
-        return ALGOIOT_NETWORK_ERROR;
-      }
-      break;
-      case 400:
-      {   // Malformed request
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("\nTransaction format error");
-        DEBUG_SERIAL.println("Server response:");
-        String payload = m_httpClient.getString();
-        DEBUG_SERIAL.println(payload);
-        
-        // Extract the position number from the error message if available
-        uint32_t errorPosition = 0;
-        if (payload.indexOf("pos ") >= 0) {
-          int posStart = payload.indexOf("pos ") + 4;
-          int posEnd = payload.indexOf("]", posStart);
-          if (posEnd > posStart) {
-            String posStr = payload.substring(posStart, posEnd);
-            errorPosition = posStr.toInt();
-            
-            // Debug the MessagePack at the error position
-            debugMessagePackAtPosition(msgPackTx, errorPosition);
-          }
-        } else {
-          // If we can't find a specific position, debug around position 242 (from your error)
-          debugMessagePackAtPosition(msgPackTx, 242);
-        }
-        #endif
-        return ALGOIOT_TRANSACTION_ERROR;
-      }
-      break;
-      default:
-      {
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.print("\nUnmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
-        String payload = m_httpClient.getString();
-        DEBUG_SERIAL.println("Server response:");
-        DEBUG_SERIAL.println(payload);
-        #endif
-        return ALGOIOT_INTERNAL_GENERIC_ERROR;
-      }
-      break;
-    }
-  }        
-  
-  m_httpClient.end();
-
-  return httpResponseCode;
-}
-
-
-
-// Add this debugging function to examine the MessagePack content at a specific position
-void AlgoIoT::debugMessagePackAtPosition(msgPack msgPackTx, uint32_t errorPosition) {
-  #ifdef LIB_DEBUGMODE
-  if (msgPackTx == NULL || msgPackTx->msgBuffer == NULL || errorPosition >= msgPackTx->currentMsgLen) {
-    DEBUG_SERIAL.println("Invalid parameters for debugging");
-    return;
-  }
-
-  // Define the range to examine (20 bytes before and after the error position)
-  uint32_t startPos = (errorPosition > 20) ? errorPosition - 20 : 0;
-  uint32_t endPos = (errorPosition + 20 < msgPackTx->currentMsgLen) ? errorPosition + 20 : msgPackTx->currentMsgLen - 1;
-
-  DEBUG_SERIAL.println("\n===== MESSAGEPACK DEBUG AT ERROR POSITION =====");
-  DEBUG_SERIAL.printf("Error reported at position: %u\n", errorPosition);
-  DEBUG_SERIAL.printf("Total MessagePack length: %u bytes\n", msgPackTx->currentMsgLen);
-  
-  // Print the byte at the error position
-  DEBUG_SERIAL.printf("Byte at position %u: 0x%02X (decimal: %u, ASCII: %c)\n", 
-                     errorPosition, 
-                     msgPackTx->msgBuffer[errorPosition],
-                     msgPackTx->msgBuffer[errorPosition],
-                     (msgPackTx->msgBuffer[errorPosition] >= 32 && msgPackTx->msgBuffer[errorPosition] <= 126) ? 
-                      (char)msgPackTx->msgBuffer[errorPosition] : '.');
-
-  // Print surrounding bytes in hex
-  DEBUG_SERIAL.println("\nSurrounding bytes (hex):");
-  for (uint32_t i = startPos; i <= endPos; i++) {
-    if (i == errorPosition) {
-      DEBUG_SERIAL.printf("[0x%02X] ", msgPackTx->msgBuffer[i]); // Highlight the error position
-    } else {
-      DEBUG_SERIAL.printf("0x%02X ", msgPackTx->msgBuffer[i]);
-    }
-    
-    // Add a newline every 8 bytes for readability
-    if ((i - startPos + 1) % 8 == 0) {
-      DEBUG_SERIAL.println();
-    }
-  }
-  DEBUG_SERIAL.println();
-
-  // Try to identify MessagePack format types around the error position
-  DEBUG_SERIAL.println("\nMessagePack format analysis:");
-  
-  // Check for common MessagePack format markers
-  for (uint32_t i = startPos; i <= endPos; i++) {
-    uint8_t byte = msgPackTx->msgBuffer[i];
-    String formatType = "";
-    
-    // Identify MessagePack format types based on the byte value
-    if (byte < 0x80) {
-      formatType = "positive fixint";
-    } else if (byte >= 0x80 && byte <= 0x8f) {
-      formatType = "fixmap (size " + String(byte & 0x0f) + ")";
-    } else if (byte >= 0x90 && byte <= 0x9f) {
-      formatType = "fixarray (size " + String(byte & 0x0f) + ")";
-    } else if (byte >= 0xa0 && byte <= 0xbf) {
-      formatType = "fixstr (length " + String(byte & 0x1f) + ")";
-    } else if (byte == 0xc0) {
-      formatType = "nil";
-    } else if (byte == 0xc2) {
-      formatType = "false";
-    } else if (byte == 0xc3) {
-      formatType = "true";
-    } else if (byte == 0xc4) {
-      formatType = "bin 8";
-    } else if (byte == 0xc5) {
-      formatType = "bin 16";
-    } else if (byte == 0xc6) {
-      formatType = "bin 32";
-    } else if (byte == 0xca) {
-      formatType = "float 32";
-    } else if (byte == 0xcb) {
-      formatType = "float 64";
-    } else if (byte == 0xcc) {
-      formatType = "uint 8";
-    } else if (byte == 0xcd) {
-      formatType = "uint 16";
-    } else if (byte == 0xce) {
-      formatType = "uint 32";
-    } else if (byte == 0xcf) {
-      formatType = "uint 64";
-    } else if (byte == 0xd0) {
-      formatType = "int 8";
-    } else if (byte == 0xd1) {
-      formatType = "int 16";
-    } else if (byte == 0xd2) {
-      formatType = "int 32";
-    } else if (byte == 0xd3) {
-      formatType = "int 64";
-    } else if (byte == 0xd9) {
-      formatType = "str 8";
-    } else if (byte == 0xda) {
-      formatType = "str 16";
-    } else if (byte == 0xdb) {
-      formatType = "str 32";
-    } else if (byte == 0xdc) {
-      formatType = "array 16";
-    } else if (byte == 0xdd) {
-      formatType = "array 32";
-    } else if (byte == 0xde) {
-      formatType = "map 16";
-    } else if (byte == 0xdf) {
-      formatType = "map 32";
-    } else if (byte >= 0xe0) {
-      formatType = "negative fixint";
-    }
-    
-    if (formatType != "") {
-      if (i == errorPosition) {
-        DEBUG_SERIAL.printf("Position %u: [0x%02X] - %s\n", i, byte, formatType.c_str());
-      } else {
-        DEBUG_SERIAL.printf("Position %u: 0x%02X - %s\n", i, byte, formatType.c_str());
-      }
-    }
-  }
-  
-  // Try to identify string fields near the error position
-  DEBUG_SERIAL.println("\nAttempting to identify string fields:");
-  for (uint32_t i = startPos; i <= endPos - 3; i++) {
-    // Look for fixstr format (0xa0-0xbf) or str8 format (0xd9)
-    if ((msgPackTx->msgBuffer[i] >= 0xa0 && msgPackTx->msgBuffer[i] <= 0xbf) || 
-        msgPackTx->msgBuffer[i] == 0xd9) {
-      
-      uint8_t strLen = 0;
-      uint32_t strStart = 0;
-      
-      if (msgPackTx->msgBuffer[i] >= 0xa0 && msgPackTx->msgBuffer[i] <= 0xbf) {
-        // fixstr format
-        strLen = msgPackTx->msgBuffer[i] & 0x1f;
-        strStart = i + 1;
-      } else if (msgPackTx->msgBuffer[i] == 0xd9) {
-        // str8 format
-        strLen = msgPackTx->msgBuffer[i+1];
-        strStart = i + 2;
-      }
-      
-      if (strLen > 0 && strStart + strLen <= endPos) {
-        String fieldName = "";
-        for (uint8_t j = 0; j < strLen; j++) {
-          char c = msgPackTx->msgBuffer[strStart + j];
-          if (c >= 32 && c <= 126) {  // Printable ASCII
-            fieldName += c;
-          } else {
-            fieldName += '.';  // Replace non-printable with dot
-          }
-        }
-        
-        DEBUG_SERIAL.printf("Position %u: String field \"%s\" (length %u)\n", 
-                           i, fieldName.c_str(), strLen);
-        
-        // Skip ahead past this string
-        i = strStart + strLen - 1;
-      }
-    }
-  }
-  
-  DEBUG_SERIAL.println("\n===== END MESSAGEPACK DEBUG =====");
-  #endif
-}
-
-// Add this implementation after the submitAssetOptInToAlgorand method
-
-// Submit application opt-in transaction to Algorand network
-// Return: error code (0 = OK)
-int AlgoIoT::submitApplicationOptInToAlgorand(uint64_t applicationId)
-{
-  uint32_t fv = 0;
-  uint16_t fee = 0;
-  int iErr = 0;
-  uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
-  char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
-  msgPack msgPackTx = NULL;
-
-  // Get current Algorand parameters
-  int httpResCode = getAlgorandTxParams(&fv, &fee);
-  if (httpResCode != 200)
-  {
-    return ALGOIOT_NETWORK_ERROR;
-  }
-
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing application opt-in transaction for application ID: %llu\n", applicationId);
-  DEBUG_SERIAL.printf("First valid round: %u, Fee: %u\n", fv, fee);
-  DEBUG_SERIAL.printf("Sender address (first 8 bytes): %02X %02X %02X %02X %02X %02X %02X %02X\n", 
-                     m_senderAddressBytes[0], m_senderAddressBytes[1], m_senderAddressBytes[2], m_senderAddressBytes[3],
-                     m_senderAddressBytes[4], m_senderAddressBytes[5], m_senderAddressBytes[6], m_senderAddressBytes[7]);
-  #endif
-
-  // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
-  if (msgPackTx == NULL)  
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.println("\n Error initializing transaction MessagePack\n");
-    #endif
-    return ALGOIOT_MESSAGEPACK_ERROR;
-  }  
-  
-  iErr = prepareApplicationOptInMessagePack(msgPackTx, fv, fee, applicationId);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d preparing application opt-in MessagePack\n", iErr);
-    #endif
-    return ALGOIOT_MESSAGEPACK_ERROR;
-  }
-
-  // Debug print the MessagePack content
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nUnsigned MessagePack content:");
-  debugPrintMessagePack(msgPackTx);
-  #endif
-
-  // Application opt-in transaction correctly assembled. Now sign it
-  iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
-  if (iErr)
+  if (numBits > 0)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d signing MessagePack\n", iErr);
-    #endif
-    return ALGOIOT_SIGNATURE_ERROR;
+    decodedBytes[destIndex] = (uint8_t)(tempInt & 0xff);
   }
 
-  // Debug print the signature
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nSignature (64 bytes):");
-  for (int i = 0; i < ALGORAND_SIG_BYTES; i++) {
-    DEBUG_SERIAL.printf("%02X ", signature[i]);
-    if ((i + 1) % 16 == 0) DEBUG_SERIAL.println();
+  DEBUG_SERIAL.println("Derived private key (first 8 bytes):");
+  for (int i = 0; i < 8; i++) {
+    DEBUG_SERIAL.printf("%02X ", decodedBytes[i]);
   }
   DEBUG_SERIAL.println();
   #endif
 
-  // Signed OK: now compose payload
-  iErr = createSignedBinaryTransaction(msgPackTx, signature);
-  if (iErr)
+  // Copy key to output array (first 32 bytes)
+  memcpy((void*)privateKey, (void*)decodedBytes, ALGORAND_KEY_BYTES);
+
+  return 0;
+}
+
+
+// Retrieves current Algorand transaction parameters
+// Returns HTTP error code
+// TODO: On error codes 5xx (server error), maybe we should retry after 5s?
+int AlgoIoT::getAlgorandTxParams(uint32_t* round, uint16_t* minFee)
+{
+  *round = 0;
+  *minFee = 0;
+
+  if (useWorkspace() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  // Recent enough params for our network?
+  if ( (m_ws->paramsCacheMs > 0) && (m_ws->paramsRound != 0) && (m_ws->paramsNetwork == m_networkType) &&
+       (((uint32_t)millis() - m_ws->paramsFetchedMs) < m_ws->paramsCacheMs) )
+  {
+    *round = m_ws->paramsRound;
+    *minFee = m_ws->paramsFee;
+    return 200;
+  }
+
+  int httpResponseCode = algodRequest(GET_TRANSACTION_PARAMS);
+
+      
+  // httpResponseCode will be negative on error
+  if (httpResponseCode < 0)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d creating signed binary transaction\n", iErr);
+    DEBUG_SERIAL.print("HTTP GET failed, error: "); DEBUG_SERIAL.println(m_ws->httpClient.errorToString(httpResponseCode).c_str());
     #endif
     return ALGOIOT_INTERNAL_GENERIC_ERROR;
   }
+  else
+  {
+    switch (httpResponseCode)
+    {
+      case 200:
+      {   // No error: let's get the response
+        String payload = m_ws->httpClient.getString();
+        StaticJsonDocument<ALGORAND_MAX_RESPONSE_LEN> JSONResDoc;
+                        
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.println("GetParams server response:");
+        DEBUG_SERIAL.println(payload);
+        #endif
 
-  // Debug print the final signed MessagePack
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nSigned MessagePack content:");
-  debugPrintMessagePack(msgPackTx);
-  
-  // Payload ready. Now we can submit it via algod REST API
-  DEBUG_SERIAL.println("\nReady to submit application opt-in transaction to Algorand network");
-  #endif
-  
-  // Print transaction data in readable format
-  #ifdef LIB_DEBUGMODE
-  printTransactionData(msgPackTx);
-  #endif
-  
-  iErr = submitTransaction(msgPackTx); // Returns HTTP code
-  if (iErr != 200)  // 200 = HTTP OK
-  { // Something went wrong
-    return ALGOIOT_TRANSACTION_ERROR;
-  }
-  
-  // OK: our transaction for application opt-in was successfully submitted to the Algorand blockchain
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.print("\t Application opt-in transaction successfully submitted with ID=");
-  DEBUG_SERIAL.println(getTransactionID());
-  #endif
+        DeserializationError error = deserializeJson(JSONResDoc, payload);                
+        if (error) 
+        {
+          #ifdef LIB_DEBUGMODE
+          DEBUG_SERIAL.println("GetParams: JSON response parsing failed!");
+          #endif
+          return ALGOIOT_INTERNAL_GENERIC_ERROR;
+        }
+        else
+        { // Fetch interesting fields
+          *minFee = JSONResDoc["min-fee"];
+          *round = JSONResDoc["last-round"];
+          m_ws->paramsRound = *round;
+          m_ws->paramsFee = *minFee;
+          m_ws->paramsNetwork = m_networkType;
+          m_ws->paramsFetchedMs = millis();
+
+          #ifdef LIB_DEBUGMODE
+          DEBUG_SERIAL.println("Algorand transaction parameters received:");
+          DEBUG_SERIAL.print("min-fee = "); DEBUG_SERIAL.print(*minFee); DEBUG_SERIAL.println(" microAlgo");
+          DEBUG_SERIAL.print("last-round = "); DEBUG_SERIAL.println(*round);                  
+          #endif                  
+        }
+      }
+      break;
+      case 204:
+      {   // No error, but no data available from server
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.println("Server returned no data");
+        #endif
+        return ALGOIOT_NETWORK_ERROR;
+      }
+      break;
+      default:
+      {
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.print("Unmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
+        #endif
+        return ALGOIOT_INTERNAL_GENERIC_ERROR;
+      }
+      break;
+    }
+  }        
   
-  return ALGOIOT_NO_ERROR;
+  m_ws->httpClient.end();
+
+  return httpResponseCode;
 }
 
-// Prepares an application opt-in transaction MessagePack
+
+
+// To be called AFTER getAlgorandTxParams(), because we need current "min-fee" and "last-round" values from algod
 // Returns error code (0 = OK)
-int AlgoIoT::prepareApplicationOptInMessagePack(msgPack msgPackTx,
+int AlgoIoT::prepareTransactionMessagePack(msgPack msgPackTx,
                                   const uint32_t lastRound, 
-                                  const uint16_t fee,
-                                  const uint64_t applicationId)
+                                  const uint16_t fee, 
+                                  const uint32_t paymentAmountMicroAlgos,
+                                  const char* notes,
+                                  const uint16_t notesLen,
+                                  const uint16_t noteTrailerBytes,
+                                  uint8_t** notePayload,
+                                  const uint8_t* groupId)
 { 
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
   uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  uint8_t nFields = ALGORAND_APPLICATION_OPTIN_MIN_FIELDS;
+  const char type[] = "pay";
 
   if (msgPackTx == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
   if (msgPackTx->msgBuffer == NULL)
     return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  if ((lastRound == 0) || (fee == 0))
+  if ((lastRound == 0) || (fee == 0) || (paymentAmountMicroAlgos < ALGORAND_MIN_PAYMENT_MICROALGOS))
   {
     return ALGOIOT_INTERNAL_GENERIC_ERROR;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing application opt-in with application ID: %llu\n", applicationId);
-  #endif
-  
+
   if (m_networkType == ALGORAND_TESTNET)
   { // TestNet
     strncpy(gen, ALGORAND_TESTNET_ID, ALGORAND_NETWORK_ID_CHARS);
@@ -2269,7 +1723,7 @@ int AlgoIoT::prepareApplicationOptInMessagePack(msgPack msgPackTx,
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
       return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
@@ -2281,255 +1735,603 @@ int AlgoIoT::prepareApplicationOptInMessagePack(msgPack msgPackTx,
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
       return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
   }
-  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
+  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
+
+
+  // We leave a blank space header so we can add:
+  // - "TX" prefix before signing
+  // - m_signature field and "txn" node field after signing
+  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
+  if (iErr)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n");
+    #endif
+
+    return 5;
+  }
+
+  // Note: caller may transform it in place (after our memcpy) and fill the trailer before signing
+  NoteField::Value note = { notes, notesLen, noteTrailerBytes, notePayload };
+
+  // Fields in canonical order, checked at compile time
+  iErr = PaymentTx::encode(msgPackTx, paymentAmountMicroAlgos, fee, lastRound, gen, m_netHash, groupId, lv,
+                            note, m_receiverAddressBytes, m_senderAddressBytes, type);
+  if (iErr)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
+    #endif
+    return 5;
+  }
+
+  // End of messagepack
+
+  return 0;
+}
+
+
+
+// Obtains Ed25519 signature of passed MessagePack, adding "TX" prefix; fills "signature" return buffer
+// To be called AFTER convertToMessagePack()
+// Returns error code (0 = OK)
+// Caller passes a 64-byte array in "signature", to be filled
+int AlgoIoT::signMessagePackAddingPrefix(msgPack msgPackTx, uint8_t signature[ALGORAND_SIG_BYTES])
+{
+  uint8_t* payloadPointer = NULL;
+  uint32_t payloadBytes = 0;
+
+  if (msgPackTx == NULL)
+    return 1;
+  if (msgPackTx->msgBuffer == NULL)
+    return 2;
+  if (msgPackTx->currentMsgLen == 0)
+    return 2;
+
+  // We sign from prefix (included), leaving out the rest of the blank header
+  payloadPointer = msgPackTx->msgBuffer + BLANK_MSGPACK_HEADER - ALGORAND_TRANSACTION_PREFIX_BYTES;
+  payloadBytes = msgPackTx->currentMsgLen + ALGORAND_TRANSACTION_PREFIX_BYTES;
+
+  // Add prefix to messagepack; we purposedly left a blank header, with length BLANK_MSGPACK_HEADER
+  payloadPointer[0] = 'T';
+  payloadPointer[1] = 'X';
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("Transaction data to be signed (with TX prefix):");
+  for (uint32_t i = 0; i < 16 && i < payloadBytes; i++) {
+    DEBUG_SERIAL.printf("%02X ", payloadPointer[i]);
+  }
+  DEBUG_SERIAL.println("...");
+  
+  DEBUG_SERIAL.println("Private key (first 8 bytes):");
+  for (int i = 0; i < 8; i++) {
+    DEBUG_SERIAL.printf("%02X ", m_privateKey[i]);
+  }
+  DEBUG_SERIAL.println();
+  
+  DEBUG_SERIAL.println("Public key (first 8 bytes):");
+  for (int i = 0; i < 8; i++) {
+    DEBUG_SERIAL.printf("%02X ", m_senderAddressBytes[i]);
+  }
+  DEBUG_SERIAL.println();
+  #endif
+
+  // Sign pack+prefix
+  if (m_signingKey != NULL)
+    Ed25519::signExpanded(signature, m_signingKey, m_senderAddressBytes, payloadPointer, payloadBytes);
+  else
+    Ed25519::sign(signature, m_privateKey, m_senderAddressBytes, payloadPointer, payloadBytes);
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("Generated signature (first 16 bytes):");
+  for (int i = 0; i < 16; i++) {
+    DEBUG_SERIAL.printf("%02X ", signature[i]);
+  }
+  DEBUG_SERIAL.println("...");
+  #endif
+
+  return 0;
+}
+
+
+// Add signature to MessagePack. We reserved a blank space header for this purpose
+// To be called AFTER signMessagePackAddingPrefix()
+// Returns error code (0 = OK)
+int AlgoIoT::createSignedBinaryTransaction(msgPack mPack, const uint8_t signature[ALGORAND_SIG_BYTES])
+{
+  int iErr = 0;
+  // When adding the m_signature "sig" field, the messagepack has to be changed into a 2-level structure,
+  // with a "txn" node holding existing fields and a new "sig" field directly in root
+  // The JSON equivalent would be something like:
+  /*
+  {
+    "sig": <array>,
+    "txn": 
+    {
+     "amt": 10000000,
+     "fee": 1000,
+     "fv": 32752600,
+     "gen": "testnet-v1.0",
+      [...]
+    }
+  }
+  */
 
-  // We leave a blank space header so we can add:
-  // - "TX" prefix before signing
-  // - m_signature field and "txn" node field after signing
-  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
+  // We reset internal msgpack pointer, since we now start from the beginning of the messagepack (filling the blank space)
+  iErr = msgPackModifyCurrentPosition(mPack, 0);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
+    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d resetting position\n\n");
     #endif
+
     return 5;
   }
 
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
+  // Add a Map holding 2 fields (sig and txn)
+  iErr = msgpackAddShortMap(mPack, 2);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, nFields);
+    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding map\n\n");
     #endif
+
     return 5;
   }
-
-  // Fields must follow alphabetical order
-
-  // "apan" label (OnComplete type - 1 for OptIn)
-  iErr = msgpackAddShortString(msgPackTx, "apan");
+  
+  // Add "sig" label
+  iErr = msgpackAddShortString(mPack, "sig");
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding apan label\n\n", iErr);
+    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding sign label\n\n");
     #endif
+
     return 5;
   }
-  // apan value (1 for OptIn)
-  iErr = msgpackAddUInt7(msgPackTx, 1);
+
+  // Add m_signature, which is a 64-bytes byte array 
+  iErr = msgpackAddShortByteArray(mPack, signature, (const uint8_t)ALGORAND_SIG_BYTES);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding apan value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding m_signature\n\n");
     #endif
+
     return 5;
   }
 
-  // "apid" label (Application ID)
-  iErr = msgpackAddShortString(msgPackTx, "apid");
+  // Add "txn" label
+  iErr = msgpackAddShortString(mPack, "txn");
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding apid label\n\n", iErr);
+    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding txn label\n\n");
     #endif
+
     return 5;
   }
-  
-  // apid value - Use UInt32 for application IDs that fit in 32 bits to match Algo SDK encoding
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nAdding application ID: %llu\n", applicationId);
-  #endif
-  
-  // Check if the application ID fits in a uint32
-  if (applicationId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)applicationId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, applicationId);
+
+  // The rest stays as it is
+
+  return 0;
+}
+
+
+// Read-only Stream over a segment chain: HTTPClient pulls the request body from it a chunk at a time,
+// so a body larger than any single buffer is sent straight from its segments
+class MsgPackChainStream : public Stream
+{
+  public:
+  MsgPackChainStream(const mpkChain* chain) : m_segment(chain->head), m_left(chain->totalLen) {}
+
+  int available() { return (int)m_left; }
+
+  int peek()
+  {
+    skipEmptySegments();
+    return (m_left == 0) ? -1 : m_segment->data[m_offset];
   }
-  
-  if (iErr)
+
+  int read()
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding apid value\n\n", iErr);
-    #endif
-    return 5;
+    int c = peek();
+    if (c >= 0)
+    {
+      m_offset++;
+      m_left--;
+    }
+    return c;
   }
 
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
+  size_t readBytes(char* buffer, size_t length)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding fee label\n\n", iErr);
-    #endif
-    return 5;
+    size_t done = 0;
+
+    while ( (done < length) && (m_left > 0) )
+    {
+      skipEmptySegments();
+      size_t chunk = m_segment->len - m_offset;
+      if (chunk > length - done)
+      {
+        chunk = length - done;
+      }
+      memcpy(buffer + done, &(m_segment->data[m_offset]), chunk);
+      m_offset += chunk;
+      m_left -= chunk;
+      done += chunk;
+    }
+    return done;
   }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
+
+  size_t write(uint8_t) { return 0; }
+
+  private:
+  void skipEmptySegments()
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding fee value\n\n", iErr);
-    #endif
-    return 5;
+    while ( (m_left > 0) && (m_offset >= m_segment->len) )
+    {
+      m_segment = m_segment->next;
+      m_offset = 0;
+    }
   }
 
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
+  const mpkSegment* m_segment;
+  uint32_t m_offset = 0;
+  uint32_t m_left;
+};
+
+
+// Sends a single GET/POST request, leaving m_httpClient open for the caller
+int AlgoIoT::algodSend(const char* baseURL, const char* token, const char* path, uint8_t* postBody, const size_t postLen,
+                       const mpkChain* postChain)
+{
+  String httpRequest = String(baseURL) + path;
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.printf("\nalgod request: %s\n", httpRequest.c_str());
+  #endif
+
+  // Configure server and url
+  m_ws->httpClient.setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
+  m_ws->httpClient.begin(httpRequest);
+  if (token[0] != 0)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
+    m_ws->httpClient.addHeader(ALGORAND_API_TOKEN_HEADER, token);
   }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
+
+  if ( (postBody == NULL) && (postChain == NULL) )
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
+    return m_ws->httpClient.GET();
+  }
+  m_ws->httpClient.addHeader("Content-Type", ALGORAND_POST_MIME_TYPE);
+  if (postChain != NULL)
+  { // A fresh stream for each attempt: failing over resends the body from the start
+    MsgPackChainStream body(postChain);
+    return m_ws->httpClient.sendRequest("POST", &body, msgpackChainGetLen(postChain));
   }
+  
+  return m_ws->httpClient.POST(postBody, postLen);
+}
 
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
+
+int AlgoIoT::selectAlgodEndpoint(const uint32_t triedMask)
+{
+  int best = -1;
+  bool bestHealthy = false;
+
+  for (uint8_t i = 0; i < m_ws->endpointCount; i++)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
+    if (triedMask & (1UL << i))
+    {
+      continue;
+    }
+    bool healthy = isAlgodEndpointHealthy(&(m_ws->endpoints[i]));
+    // Healthy endpoints first; among them, lowest latency (unmeasured ones count as 0, so they get measured)
+    // Among down ones, the one which failed longest ago
+    if ( (best < 0) || (healthy && !bestHealthy) ||
+         ( (healthy == bestHealthy) && healthy && (m_ws->endpoints[i].latencyMs < m_ws->endpoints[best].latencyMs) ) ||
+         ( (healthy == bestHealthy) && !healthy &&
+           ((int32_t)(m_ws->endpoints[i].lastFailureMs - m_ws->endpoints[best].lastFailureMs) < 0) ) )
+    {
+      best = i;
+      bestHealthy = healthy;
+    }
   }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
+
+  return best;
+}
+
+
+int AlgoIoT::algodRequest(const char* path, uint8_t* postBody, const size_t postLen, const mpkChain* postChain)
+{
+  uint32_t triedMask = 0;
+  int httpResponseCode = HTTPC_ERROR_CONNECTION_REFUSED;
+  int index = 0;
+
+  if (m_ws->endpointCount == 0)
+  { // No pool: default endpoint only
+    return algodSend(m_httpBaseURL.c_str(), APItoken, path, postBody, postLen, postChain);
+  }
+
+  while ((index = selectAlgodEndpoint(triedMask)) >= 0)
   {
+    AlgodEndpoint* endpoint = &(m_ws->endpoints[index]);
+    uint32_t startMs = millis();
+
+    triedMask |= (1UL << index);
+    httpResponseCode = algodSend(endpoint->url, endpoint->token, path, postBody, postLen, postChain);
+    if ( (httpResponseCode > 0) && (httpResponseCode < 500) )
+    { // Endpoint answered: update its latency average
+      uint32_t elapsedMs = (uint32_t)millis() - startMs;
+      if (elapsedMs == 0)
+      {
+        elapsedMs = 1;
+      }
+      if (endpoint->latencyMs == 0)
+      {
+        endpoint->latencyMs = elapsedMs;
+      }
+      else
+      {
+        endpoint->latencyMs = (uint32_t)((int32_t)endpoint->latencyMs + 
+                                         (((int32_t)elapsedMs - (int32_t)endpoint->latencyMs) >> ALGOIOT_ENDPOINT_EWMA_SHIFT));
+      }
+      endpoint->failures = 0;
+      return httpResponseCode;
+    }
+
+    // Network or server error: mark it and fail over to the next endpoint
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding gen string\n\n", iErr);
+    DEBUG_SERIAL.printf("\nalgod endpoint %s failed (%d), failing over\n", endpoint->url, httpResponseCode);
     #endif
-    return 5;
+    if (endpoint->failures < 255)
+    {
+      endpoint->failures++;
+    }
+    endpoint->lastFailureMs = millis();
+    if (selectAlgodEndpoint(triedMask) >= 0)
+    { // Last answer stays readable by the caller
+      m_ws->httpClient.end();
+    }
   }
 
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
+  return httpResponseCode;
+}
+
+
+// Submits transaction messagepack to algod
+// Last method to be called, after all the others
+// Returns http response code (200 = OK) or AlgoIoT error code
+// TODO: On error codes 5xx (server error), maybe we should retry after 5s?
+int AlgoIoT::submitTransaction(msgPack msgPackTx, const mpkChain* group)
+{
+  if (useWorkspace() != ALGOIOT_NO_ERROR)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_MEMORY_ERROR;
   }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.printf("\nSubmitting transaction, Content-Type: %s\n", ALGORAND_POST_MIME_TYPE);
+  DEBUG_SERIAL.printf("Payload size: %d bytes\n", (group != NULL) ? msgpackChainGetLen(group) : msgPackTx->currentMsgLen);
+  #endif
+
+  // Failing over is safe: a signed transaction submitted twice has the same ID and is accepted once
+  int httpResponseCode = (group != NULL) ? algodRequest(POST_TRANSACTION, NULL, 0, group) :
+                                           algodRequest(POST_TRANSACTION, msgPackTx->msgBuffer, msgPackTx->currentMsgLen);
+      
+  // httpResponseCode will be negative on error
+  if (httpResponseCode < 0)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding gh value\n\n", iErr);
+    DEBUG_SERIAL.print("\n[HTTP] POST failed, error: "); DEBUG_SERIAL.println(m_ws->httpClient.errorToString(httpResponseCode).c_str());
     #endif
-    return 5;
   }
+  else
+  {
+    switch (httpResponseCode)
+    {
+      case 200:
+      {   // No error: let's get the response for debug purposes
+        String payload = m_ws->httpClient.getString();
+        StaticJsonDocument<ALGORAND_MAX_RESPONSE_LEN> JSONResDoc;
+                        
+        DeserializationError error = deserializeJson(JSONResDoc, payload);                
+        if (error) 
+        {
+          #ifdef LIB_DEBUGMODE
+          DEBUG_SERIAL.println("JSON response parsing failed!");
+          DEBUG_SERIAL.println(payload);
+          #endif
+          return ALGOIOT_INTERNAL_GENERIC_ERROR;
+        }
+        else
+        { // Fetch interesting fields                  
+          strncpy(m_transactionID, JSONResDoc["txId"], 64);
+          
+          #ifdef LIB_DEBUGMODE
+          DEBUG_SERIAL.println("Server response:");
+          DEBUG_SERIAL.println(payload);
+          #endif
+        }
+      }
+      break;
+      case 204:
+      {   // No error, but no data available from server
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.println("\nServer returned no data");
+        #endif
+        return ALGOIOT_NETWORK_ERROR;
+      }
+      break;
+      case 400:
+      {   // Malformed request
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.println("\nTransaction format error");
+        DEBUG_SERIAL.println("Server response:");
+        String payload = m_ws->httpClient.getString();
+        DEBUG_SERIAL.println(payload);
+        
+        // Extract the position number from the error message if available
+        uint32_t errorPosition = 0;
+        if (payload.indexOf("pos ") >= 0) {
+          int posStart = payload.indexOf("pos ") + 4;
+          int posEnd = payload.indexOf("]", posStart);
+          if (posEnd > posStart) {
+            String posStr = payload.substring(posStart, posEnd);
+            errorPosition = posStr.toInt();
+            
+            // Debug the MessagePack at the error position
+            debugMessagePackAtPosition(msgPackTx, errorPosition);
+          }
+        }
+        #endif
+        return ALGOIOT_TRANSACTION_ERROR;
+      }
+      break;
+      default:
+      {
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.print("\nUnmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
+        String payload = m_ws->httpClient.getString();
+        DEBUG_SERIAL.println("Server response:");
+        DEBUG_SERIAL.println(payload);
+        #endif
+        return ALGOIOT_INTERNAL_GENERIC_ERROR;
+      }
+      break;
+    }
+  }        
+  
+  m_ws->httpClient.end();
+
+  return httpResponseCode;
+}
+
 
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
+
+// Names of the MPK_TYPE_* values, for debug output
+static const char* const mpkTypeNames[] = { "nil", "bool", "uint", "int", "float32", "float64",
+                                            "str", "bin", "array", "map", "ext" };
+
+// Walks down from the value at the reader cursor to the innermost value containing
+// byte "position" of the buffer, appending map keys and array indexes to "path"
+// "found" receives the innermost value (a map or array if "position" is in its header)
+// Returns error code (0 = OK, MPK_ERR_NOT_FOUND if "position" is not inside the value)
+static int findValueAtPosition(mpkReader* reader, const uint32_t position, mpkValue* found, 
+                               char* path, const size_t pathSize)
+{
+  const uint32_t start = reader->currentPosition;
+  int iErr = msgpackSkipValue(reader);
   if (iErr)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding lv label\n\n", iErr);
-    #endif
-    return 5;
+    return iErr;
   }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
+  if ((position < start) || (position >= reader->currentPosition))
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding lv value\n\n", iErr);
-    #endif
-    return 5;
+    return MPK_ERR_NOT_FOUND;
   }
 
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
+  // Containers: only the header is read, the cursor is left on the first element
+  reader->currentPosition = start;
+  iErr = msgpackReadValue(reader, found);
   if (iErr)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
+    return iErr;
   }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
+  if ( ((found->type != MPK_TYPE_MAP) && (found->type != MPK_TYPE_ARRAY)) ||
+       (position < reader->currentPosition) )
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding snd value\n\n", iErr);
-    #endif
-    return 5;
+    return MPK_NO_ERROR;
+  }
+
+  for (uint32_t i = 0; i < found->count; i++)
+  {
+    const size_t pathLen = strlen(path);
+    if (found->type == MPK_TYPE_MAP)
+    { // Algorand maps only have string keys
+      const uint32_t keyStart = reader->currentPosition;
+      const char* key = NULL;
+      uint32_t keyLen = 0;
+      iErr = msgpackReadString(reader, &key, &keyLen);
+      if (iErr)
+      {
+        return iErr;
+      }
+      snprintf(path + pathLen, pathSize - pathLen, "/%.*s", (int)keyLen, key);
+      if (position < reader->currentPosition)
+      { // Inside the key itself
+        reader->currentPosition = keyStart;
+        return msgpackReadValue(reader, found);
+      }
+    }
+    else
+    {
+      snprintf(path + pathLen, pathSize - pathLen, "[%lu]", (unsigned long)i);
+    }
+
+    mpkValue element;
+    iErr = findValueAtPosition(reader, position, &element, path, pathSize);
+    if (iErr != MPK_ERR_NOT_FOUND)
+    {
+      if (iErr == MPK_NO_ERROR)
+      {
+        *found = element;
+      }
+      return iErr;
+    }
+    path[pathLen] = '\0';
   }
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr)
+  return MPK_ERR_INVALID; // Not reached: the elements cover the rest of the value
+}
+
+
+// Prints the key path of the transaction field containing byte "errorPosition",
+// as reported by algod on a malformed transaction
+void AlgoIoT::debugMessagePackAtPosition(msgPack msgPackTx, uint32_t errorPosition) 
+{
+  #ifdef LIB_DEBUGMODE
+  if ((msgPackTx == NULL) || (msgPackTx->msgBuffer == NULL))
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding type label\n\n", iErr);
-    #endif
-    return 5;
+    return;
   }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "appl");
+
+  mpkReader reader;
+  mpkValue value;
+  char path[96] = "";
+
+  msgpackReaderInit(&reader, msgPackTx->msgBuffer, msgPackTx->currentMsgLen);
+  int iErr = findValueAtPosition(&reader, errorPosition, &value, path, sizeof(path));
   if (iErr)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d adding type string\n\n", iErr);
-    #endif
-    return 5;
+    DEBUG_SERIAL.printf("Error position %lu not found in transaction (error %d)\n", (unsigned long)errorPosition, iErr);
+    return;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nApplication opt-in MessagePack preparation complete");
-  #endif
 
-  // End of messagepack
-  return 0;
+  DEBUG_SERIAL.printf("Error position %lu is in %s (%s starting at %lu)\n", (unsigned long)errorPosition,
+                      (path[0] != '\0') ? path : "/", mpkTypeNames[value.type], (unsigned long)value.offset);
+  #endif
 }
 
-// Add this implementation after the submitApplicationOptInToAlgorand method
+// Add this implementation after the submitAssetOptInToAlgorand method
 
-// Submit asset creation transaction to Algorand network
+// Submit application opt-in transaction to Algorand network
 // Return: error code (0 = OK)
-int AlgoIoT::submitAssetCreationToAlgorand(
-    const char* assetName, 
-    const char* unitName, 
-    const char* assetURL,
-    uint8_t decimals,
-    uint64_t total)
+int AlgoIoT::submitApplicationOptInToAlgorand(uint64_t applicationId)
 {
   uint32_t fv = 0;
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   msgPack msgPackTx = NULL;
 
-  // Validate parameters
-  if (assetName == NULL || unitName == NULL) {
-    return ALGOIOT_BAD_PARAM;
-  }
-  
-  if (strlen(assetName) > 32 || strlen(unitName) > 8) {
-    return ALGOIOT_BAD_PARAM;
-  }
-
   // Get current Algorand parameters
   int httpResCode = getAlgorandTxParams(&fv, &fee);
   if (httpResCode != 200)
@@ -2537,13 +2339,8 @@ int AlgoIoT::submitAssetCreationToAlgorand(
     return ALGOIOT_NETWORK_ERROR;
   }
 
-  // Asset creation may require higher fees
-  if (fee < 1000) {
-    fee = 1000;
-  }
-
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing asset creation transaction for asset: %s (%s)\n", assetName, unitName);
+  DEBUG_SERIAL.printf("\nPreparing application opt-in transaction for application ID: %llu\n", applicationId);
   DEBUG_SERIAL.printf("First valid round: %u, Fee: %u\n", fv, fee);
   DEBUG_SERIAL.printf("Sender address (first 8 bytes): %02X %02X %02X %02X %02X %02X %02X %02X\n", 
                      m_senderAddressBytes[0], m_senderAddressBytes[1], m_senderAddressBytes[2], m_senderAddressBytes[3],
@@ -2551,7 +2348,7 @@ int AlgoIoT::submitAssetCreationToAlgorand(
   #endif
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -2560,11 +2357,11 @@ int AlgoIoT::submitAssetCreationToAlgorand(
     return ALGOIOT_MESSAGEPACK_ERROR;
   }  
   
-  iErr = prepareAssetCreationMessagePack(msgPackTx, fv, fee, assetName, unitName, assetURL, decimals, total);
+  iErr = prepareApplicationOptInMessagePack(msgPackTx, fv, fee, applicationId);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d preparing asset creation MessagePack\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d preparing application opt-in MessagePack\n", iErr);
     #endif
     return ALGOIOT_MESSAGEPACK_ERROR;
   }
@@ -2575,7 +2372,7 @@ int AlgoIoT::submitAssetCreationToAlgorand(
   debugPrintMessagePack(msgPackTx);
   #endif
 
-  // Asset creation transaction correctly assembled. Now sign it
+  // Application opt-in transaction correctly assembled. Now sign it
   iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
   if (iErr)
   {
@@ -2611,7 +2408,7 @@ int AlgoIoT::submitAssetCreationToAlgorand(
   debugPrintMessagePack(msgPackTx);
   
   // Payload ready. Now we can submit it via algod REST API
-  DEBUG_SERIAL.println("\nReady to submit asset creation transaction to Algorand network");
+  DEBUG_SERIAL.println("\nReady to submit application opt-in transaction to Algorand network");
   #endif
   
   // Print transaction data in readable format
@@ -2622,34 +2419,24 @@ int AlgoIoT::submitAssetCreationToAlgorand(
   iErr = submitTransaction(msgPackTx); // Returns HTTP code
   if (iErr != 200)  // 200 = HTTP OK
   { // Something went wrong
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d submitting asset creation transaction\n", iErr);
-    #endif
     return ALGOIOT_TRANSACTION_ERROR;
   }
   
-  // OK: our transaction for asset creation was successfully submitted to the Algorand blockchain
+  // OK: our transaction for application opt-in was successfully submitted to the Algorand blockchain
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.print("\t Asset creation transaction successfully submitted with ID=");
+  DEBUG_SERIAL.print("\t Application opt-in transaction successfully submitted with ID=");
   DEBUG_SERIAL.println(getTransactionID());
   #endif
   
   return ALGOIOT_NO_ERROR;
 }
 
-// Prepares an asset creation transaction MessagePack
-// Returns error code (0 = OK)
-// Prepares an asset creation transaction MessagePack
+// Prepares an application opt-in transaction MessagePack
 // Returns error code (0 = OK)
-int AlgoIoT::prepareAssetCreationMessagePack(
-   msgPack msgPackTx,
-   const uint32_t lastRound, 
-   const uint16_t fee,
-   const char* assetName,
-   const char* unitName,
-   const char* assetURL,
-   uint8_t decimals,
-   const uint64_t total)
+int AlgoIoT::prepareApplicationOptInMessagePack(msgPack msgPackTx,
+                                  const uint32_t lastRound, 
+                                  const uint16_t fee,
+                                  const uint64_t applicationId)
 { 
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
@@ -2665,8 +2452,7 @@ int AlgoIoT::prepareAssetCreationMessagePack(
   }
   
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing asset creation for asset: %s (%s) with total supply: %llu\n", 
-                     assetName, unitName, total);
+  DEBUG_SERIAL.printf("\nPreparing application opt-in with application ID: %llu\n", applicationId);
   #endif
   
   if (m_networkType == ALGORAND_TESTNET)
@@ -2676,306 +2462,85 @@ int AlgoIoT::prepareAssetCreationMessagePack(
     iErr = decodeAlgorandNetHash(ALGORAND_TESTNET_HASH, m_netHash);
     if (iErr)
     {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  else
-  { // MainNet
-    strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
-    iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
-
-  // We leave a blank space header so we can add:
-  // - "TX" prefix before signing
-  // - m_signature field and "txn" node field after signing
-  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // Count fields for the root map
-  uint8_t rootFieldCount = 8; // apar, fee, fv, gen, gh, lv, snd, type
-  
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, rootFieldCount); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, rootFieldCount);
-    #endif
-    return 5;
-  }
-
-  // Fields must follow alphabetical order
-
-  // "apar" label (Asset Parameters)
-  iErr = msgpackAddShortString(msgPackTx, "apar");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding apar label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // Count apar fields - only include essential fields
-  uint8_t aparFieldCount = 3; // an, t, un
-  
-  // apar value is a map with asset parameters
-  iErr = msgpackAddShortMap(msgPackTx, aparFieldCount);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding apar map\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // "an" label (Asset Name)
-  iErr = msgpackAddShortString(msgPackTx, "an");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding an label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // Asset name value
-  iErr = msgpackAddShortString(msgPackTx, assetName);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding asset name\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // "t" label (Total supply)
-  iErr = msgpackAddShortString(msgPackTx, "t");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding t label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // Total supply value
-  if (total <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)total);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, total);
-  }
-  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding total supply\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // "un" label (Unit name)
-  iErr = msgpackAddShortString(msgPackTx, "un");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding un label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // Unit name value
-  iErr = msgpackAddShortString(msgPackTx, unitName);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding unit name\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fee" label - MUST be after apar is complete
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding fee label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding fee value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding gen string\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding gh value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding lv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding lv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      #endif
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
   }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding snd value\n\n", iErr);
-    #endif
-    return 5;
+  else
+  { // MainNet
+    strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
+    iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      #endif
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
   }
+  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
+  // We leave a blank space header so we can add:
+  // - "TX" prefix before signing
+  // - m_signature field and "txn" node field after signing
+  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding type label\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
     #endif
     return 5;
   }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "acfg");
+
+  AppArgsField::Value noArgs = { NULL, NULL, 0 };
+  IDArrayField::Value noIDs = { NULL, 0 };
+  AddressArrayField::Value noAccounts = { NULL, 0 };
+
+  // Fields in canonical order, checked at compile time
+  iErr = ApplicationCallTx::encode(msgPackTx, noArgs, ALGORAND_ON_COMPLETION_OPTIN, noIDs, noAccounts, noIDs,
+                                    applicationId, fee, lastRound, gen, m_netHash, lv, m_senderAddressBytes, "appl");
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d adding type string\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareApplicationOptInMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nAsset creation MessagePack preparation complete");
-  #endif
 
   // End of messagepack
+
   return 0;
 }
 
+// Add this implementation after the submitApplicationOptInToAlgorand method
 
-
-// Submit application NoOp transaction to Algorand network
+// Submit asset creation transaction to Algorand network
 // Return: error code (0 = OK)
-int AlgoIoT::submitApplicationNoOpToAlgorand(
-    uint64_t applicationId,
-    const uint8_t** appArgs,
-    const uint8_t* appArgLengths,
-    uint8_t appArgsCount,
-    const uint64_t* foreignAssets,
-    uint8_t foreignAssetsCount,
-    const uint64_t* foreignApps,
-    uint8_t foreignAppsCount,
-    const char** accounts,
-    uint8_t accountsCount)
+int AlgoIoT::submitAssetCreationToAlgorand(
+    const char* assetName, 
+    const char* unitName, 
+    const char* assetURL,
+    uint8_t decimals,
+    uint64_t total)
 {
   uint32_t fv = 0;
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   msgPack msgPackTx = NULL;
 
+  // Validate parameters
+  if (assetName == NULL || unitName == NULL) {
+    return ALGOIOT_BAD_PARAM;
+  }
+  
+  if (strlen(assetName) > 32 || strlen(unitName) > 8) {
+    return ALGOIOT_BAD_PARAM;
+  }
+
   // Get current Algorand parameters
   int httpResCode = getAlgorandTxParams(&fv, &fee);
   if (httpResCode != 200)
@@ -2983,23 +2548,21 @@ int AlgoIoT::submitApplicationNoOpToAlgorand(
     return ALGOIOT_NETWORK_ERROR;
   }
 
-  // Application calls may require higher fees
+  // Asset creation may require higher fees
   if (fee < 1000) {
     fee = 1000;
   }
 
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing application NoOp transaction for application ID: %llu\n", applicationId);
+  DEBUG_SERIAL.printf("\nPreparing asset creation transaction for asset: %s (%s)\n", assetName, unitName);
   DEBUG_SERIAL.printf("First valid round: %u, Fee: %u\n", fv, fee);
-  DEBUG_SERIAL.printf("App Args Count: %u, Foreign Assets Count: %u, Foreign Apps Count: %u, Accounts Count: %u\n", 
-                     appArgsCount, foreignAssetsCount, foreignAppsCount, accountsCount);
   DEBUG_SERIAL.printf("Sender address (first 8 bytes): %02X %02X %02X %02X %02X %02X %02X %02X\n", 
                      m_senderAddressBytes[0], m_senderAddressBytes[1], m_senderAddressBytes[2], m_senderAddressBytes[3],
                      m_senderAddressBytes[4], m_senderAddressBytes[5], m_senderAddressBytes[6], m_senderAddressBytes[7]);
   #endif
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -3008,15 +2571,11 @@ int AlgoIoT::submitApplicationNoOpToAlgorand(
     return ALGOIOT_MESSAGEPACK_ERROR;
   }  
   
-  iErr = prepareApplicationNoOpMessagePack(msgPackTx, fv, fee, applicationId, 
-                                         appArgs, appArgLengths, appArgsCount,
-                                         foreignAssets, foreignAssetsCount,
-                                         foreignApps, foreignAppsCount,
-                                         accounts, accountsCount);
+  iErr = prepareAssetCreationMessagePack(msgPackTx, fv, fee, assetName, unitName, assetURL, decimals, total);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d preparing application NoOp MessagePack\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d preparing asset creation MessagePack\n", iErr);
     #endif
     return ALGOIOT_MESSAGEPACK_ERROR;
   }
@@ -3027,7 +2586,7 @@ int AlgoIoT::submitApplicationNoOpToAlgorand(
   debugPrintMessagePack(msgPackTx);
   #endif
 
-  // Application NoOp transaction correctly assembled. Now sign it
+  // Asset creation transaction correctly assembled. Now sign it
   iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
   if (iErr)
   {
@@ -3063,7 +2622,7 @@ int AlgoIoT::submitApplicationNoOpToAlgorand(
   debugPrintMessagePack(msgPackTx);
   
   // Payload ready. Now we can submit it via algod REST API
-  DEBUG_SERIAL.println("\nReady to submit application NoOp transaction to Algorand network");
+  DEBUG_SERIAL.println("\nReady to submit asset creation transaction to Algorand network");
   #endif
   
   // Print transaction data in readable format
@@ -3075,36 +2634,33 @@ int AlgoIoT::submitApplicationNoOpToAlgorand(
   if (iErr != 200)  // 200 = HTTP OK
   { // Something went wrong
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d submitting application NoOp transaction\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d submitting asset creation transaction\n", iErr);
     #endif
     return ALGOIOT_TRANSACTION_ERROR;
   }
   
-  // OK: our transaction for application NoOp was successfully submitted to the Algorand blockchain
+  // OK: our transaction for asset creation was successfully submitted to the Algorand blockchain
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.print("\t Application NoOp transaction successfully submitted with ID=");
+  DEBUG_SERIAL.print("\t Asset creation transaction successfully submitted with ID=");
   DEBUG_SERIAL.println(getTransactionID());
   #endif
   
   return ALGOIOT_NO_ERROR;
 }
 
-// Prepares an application NoOp transaction MessagePack
+// Prepares an asset creation transaction MessagePack
 // Returns error code (0 = OK)
-int AlgoIoT::prepareApplicationNoOpMessagePack(
-    msgPack msgPackTx,
-    const uint32_t lastRound, 
-    const uint16_t fee,
-    const uint64_t applicationId,
-    const uint8_t** appArgs,
-    const uint8_t* appArgLengths,
-    uint8_t appArgsCount,
-    const uint64_t* foreignAssets,
-    uint8_t foreignAssetsCount,
-    const uint64_t* foreignApps,
-    uint8_t foreignAppsCount,
-    const char** accounts,
-    uint8_t accountsCount)
+// Prepares an asset creation transaction MessagePack
+// Returns error code (0 = OK)
+int AlgoIoT::prepareAssetCreationMessagePack(
+   msgPack msgPackTx,
+   const uint32_t lastRound, 
+   const uint16_t fee,
+   const char* assetName,
+   const char* unitName,
+   const char* assetURL,
+   uint8_t decimals,
+   const uint64_t total)
 { 
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
@@ -3120,7 +2676,8 @@ int AlgoIoT::prepareApplicationNoOpMessagePack(
   }
   
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing application NoOp with application ID: %llu\n", applicationId);
+  DEBUG_SERIAL.printf("\nPreparing asset creation for asset: %s (%s) with total supply: %llu\n", 
+                     assetName, unitName, total);
   #endif
   
   if (m_networkType == ALGORAND_TESTNET)
@@ -3131,7 +2688,7 @@ int AlgoIoT::prepareApplicationNoOpMessagePack(
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
       return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
@@ -3143,326 +2700,65 @@ int AlgoIoT::prepareApplicationNoOpMessagePack(
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
-
-  // We leave a blank space header so we can add:
-  // - "TX" prefix before signing
-  // - m_signature field and "txn" node field after signing
-  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // Count fields for the root map - start with minimum required fields
-  uint8_t rootFieldCount = ALGORAND_APPLICATION_NOOP_MIN_FIELDS; // apid, fee, fv, gen, gh, lv, snd, type
-  
-  // Add optional fields if provided
-  if (appArgsCount > 0) rootFieldCount++; // apaa
-  if (foreignAssetsCount > 0) rootFieldCount++; // apas
-  if (foreignAppsCount > 0) rootFieldCount++; // apfa
-  if (accountsCount > 0) rootFieldCount++; // apat
-  
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, rootFieldCount); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, rootFieldCount);
-    #endif
-    return 5;
-  }
-
-  // Fields must follow alphabetical order: apaa, apas, apid, fee, fv, gen, gh, lv, snd, type
-
-  // "apaa" label (Application Arguments) - optional
-  if (appArgsCount > 0) {
-    iErr = msgpackAddShortString(msgPackTx, "apaa");
-    if (iErr) return 5;
-    
-    // Add array with appArgsCount elements
-    if (appArgsCount <= 15) {
-      iErr = msgpackAddShortArray(msgPackTx, appArgsCount);
-    } else {
-      return 5; // Too many args for this implementation
-    }
-    if (iErr) return 5;
-    
-    // Add each argument as byte array
-    for (uint8_t i = 0; i < appArgsCount; i++) {
-      if (appArgs[i] != NULL && appArgLengths[i] > 0) {
-        iErr = msgpackAddShortByteArray(msgPackTx, appArgs[i], appArgLengths[i]);
-        if (iErr) return 5;
-      }
-    }
-  }
-
-  // "apat" label (Accounts) - optional
-  if (accountsCount > 0) {
-    iErr = msgpackAddShortString(msgPackTx, "apat");
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding apat label\n\n", iErr);
-      #endif
-      return 5;
-    }
-    
-    // For now, we'll add just the first account as a simple byte array
-    // TODO: Implement proper array support in MessagePack library
-    if (accounts[0] != NULL) {
-      // Decode and add the account address
-      uint8_t* accountBytes = NULL;
-      iErr = decodeAlgorandAddress(accounts[0], accountBytes);
-      if (iErr)
-      {
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d decoding account[0]\n\n", iErr);
-        #endif
-        return 5;
-      }
-      
-      iErr = msgpackAddShortByteArray(msgPackTx, accountBytes, (const uint8_t)ALGORAND_ADDRESS_BYTES);
-      free(accountBytes); // Free the allocated memory
-      if (iErr)
-      {
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding apat[0]\n\n", iErr);
-        #endif
-        return 5;
-      }
-    }
-  }
-
-  // "apas" label (Foreign Assets) - optional
-  if (foreignAssetsCount > 0) {
-    iErr = msgpackAddShortString(msgPackTx, "apas");
-    if (iErr) return 5;
-    
-    // Add array with foreignAssetsCount elements
-    if (foreignAssetsCount <= 15) {
-      iErr = msgpackAddShortArray(msgPackTx, foreignAssetsCount);
-    } else {
-      return 5;
-    }
-    if (iErr) return 5;
-    
-    // Add each foreign asset ID
-    for (uint8_t i = 0; i < foreignAssetsCount; i++) {
-      if (foreignAssets[i] <= 0xFFFFFFFF) {
-        iErr = msgpackAddUInt32(msgPackTx, (uint32_t)foreignAssets[i]);
-      } else {
-        iErr = msgpackAddUInt64(msgPackTx, foreignAssets[i]);
-      }
-      if (iErr) return 5;
-    }
-  }
-
-  // "apfa" label (Foreign Apps) - optional
-  if (foreignAppsCount > 0) {
-    iErr = msgpackAddShortString(msgPackTx, "apfa");
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding apfa label\n\n", iErr);
-      #endif
-      return 5;
-    }
-    
-    // For now, we'll add just the first foreign app as a simple integer
-    // TODO: Implement proper array support in MessagePack library
-    if (foreignApps[0] <= 0xFFFFFFFF) {
-      iErr = msgpackAddUInt32(msgPackTx, (uint32_t)foreignApps[0]);
-    } else {
-      iErr = msgpackAddUInt64(msgPackTx, foreignApps[0]);
-    }
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding apfa[0]\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
-      return 5;
-    }
-  }
-
-  // "apid" label (Application ID)
-  iErr = msgpackAddShortString(msgPackTx, "apid");
-  if (iErr) return 5;
-  
-  // apid value
-  if (applicationId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)applicationId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, applicationId);
-  }
-  if (iErr) return 5;
-
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding fee label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding fee value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding gen string\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding gh value\n\n", iErr);
-    #endif
-    return 5;
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
   }
+  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
 
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding lv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
+  // We leave a blank space header so we can add:
+  // - "TX" prefix before signing
+  // - m_signature field and "txn" node field after signing
+  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding lv value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
     #endif
     return 5;
   }
 
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding snd value\n\n", iErr);
-    #endif
-    return 5;
-  }
+  AssetParamsField::Value params = { assetName, assetURL, decimals, total, unitName };
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding type label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "appl");
+  // Fields in canonical order, checked at compile time
+  iErr = AssetConfigTx::encode(msgPackTx, params, 0, fee, lastRound, gen, m_netHash, lv, m_senderAddressBytes, "acfg");
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d adding type string\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetCreationMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nApplication NoOp MessagePack preparation complete");
-  #endif
 
   // End of messagepack
+
   return 0;
 }
 
-// Submit asset opt-out transaction to Algorand network
+
+
+// Submit application NoOp transaction to Algorand network
 // Return: error code (0 = OK)
-int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAddress)
+int AlgoIoT::submitApplicationNoOpToAlgorand(
+    uint64_t applicationId,
+    const uint8_t** appArgs,
+    const uint8_t* appArgLengths,
+    uint8_t appArgsCount,
+    const uint64_t* foreignAssets,
+    uint8_t foreignAssetsCount,
+    const uint64_t* foreignApps,
+    uint8_t foreignAppsCount,
+    const char** accounts,
+    uint8_t accountsCount)
 {
   uint32_t fv = 0;
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   msgPack msgPackTx = NULL;
 
-  // Use sender address as close-to address if not provided
-  if (closeToAddress == NULL) {
-    closeToAddress = (const char*)m_senderAddressBytes;
-  }
-
   // Get current Algorand parameters
   int httpResCode = getAlgorandTxParams(&fv, &fee);
   if (httpResCode != 200)
@@ -3470,16 +2766,23 @@ int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAd
     return ALGOIOT_NETWORK_ERROR;
   }
 
+  // Application calls may require higher fees
+  if (fee < 1000) {
+    fee = 1000;
+  }
+
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing asset opt-out transaction for asset ID: %llu\n", assetId);
+  DEBUG_SERIAL.printf("\nPreparing application NoOp transaction for application ID: %llu\n", applicationId);
   DEBUG_SERIAL.printf("First valid round: %u, Fee: %u\n", fv, fee);
+  DEBUG_SERIAL.printf("App Args Count: %u, Foreign Assets Count: %u, Foreign Apps Count: %u, Accounts Count: %u\n", 
+                     appArgsCount, foreignAssetsCount, foreignAppsCount, accountsCount);
   DEBUG_SERIAL.printf("Sender address (first 8 bytes): %02X %02X %02X %02X %02X %02X %02X %02X\n", 
                      m_senderAddressBytes[0], m_senderAddressBytes[1], m_senderAddressBytes[2], m_senderAddressBytes[3],
                      m_senderAddressBytes[4], m_senderAddressBytes[5], m_senderAddressBytes[6], m_senderAddressBytes[7]);
   #endif
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -3488,11 +2791,15 @@ int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAd
     return ALGOIOT_MESSAGEPACK_ERROR;
   }  
   
-  iErr = prepareAssetOptOutMessagePack(msgPackTx, fv, fee, assetId, closeToAddress);
+  iErr = prepareApplicationNoOpMessagePack(msgPackTx, fv, fee, applicationId, 
+                                         appArgs, appArgLengths, appArgsCount,
+                                         foreignAssets, foreignAssetsCount,
+                                         foreignApps, foreignAppsCount,
+                                         accounts, accountsCount);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d preparing asset opt-out MessagePack\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d preparing application NoOp MessagePack\n", iErr);
     #endif
     return ALGOIOT_MESSAGEPACK_ERROR;
   }
@@ -3503,7 +2810,7 @@ int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAd
   debugPrintMessagePack(msgPackTx);
   #endif
 
-  // Asset opt-out transaction correctly assembled. Now sign it
+  // Application NoOp transaction correctly assembled. Now sign it
   iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
   if (iErr)
   {
@@ -3539,7 +2846,7 @@ int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAd
   debugPrintMessagePack(msgPackTx);
   
   // Payload ready. Now we can submit it via algod REST API
-  DEBUG_SERIAL.println("\nReady to submit asset opt-out transaction to Algorand network");
+  DEBUG_SERIAL.println("\nReady to submit application NoOp transaction to Algorand network");
   #endif
   
   // Print transaction data in readable format
@@ -3551,32 +2858,40 @@ int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAd
   if (iErr != 200)  // 200 = HTTP OK
   { // Something went wrong
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d submitting asset opt-out transaction\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d submitting application NoOp transaction\n", iErr);
     #endif
     return ALGOIOT_TRANSACTION_ERROR;
   }
   
-  // OK: our transaction for asset opt-out was successfully submitted to the Algorand blockchain
+  // OK: our transaction for application NoOp was successfully submitted to the Algorand blockchain
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.print("\t Asset opt-out transaction successfully submitted with ID=");
+  DEBUG_SERIAL.print("\t Application NoOp transaction successfully submitted with ID=");
   DEBUG_SERIAL.println(getTransactionID());
   #endif
   
   return ALGOIOT_NO_ERROR;
 }
 
-// Prepares an asset opt-out transaction MessagePack
+// Prepares an application NoOp transaction MessagePack
 // Returns error code (0 = OK)
-int AlgoIoT::prepareAssetOptOutMessagePack(msgPack msgPackTx,
-                                  const uint32_t lastRound, 
-                                  const uint16_t fee,
-                                  const uint64_t assetId,
-                                  const char* closeToAddress)
+int AlgoIoT::prepareApplicationNoOpMessagePack(
+    msgPack msgPackTx,
+    const uint32_t lastRound, 
+    const uint16_t fee,
+    const uint64_t applicationId,
+    const uint8_t** appArgs,
+    const uint8_t* appArgLengths,
+    uint8_t appArgsCount,
+    const uint64_t* foreignAssets,
+    uint8_t foreignAssetsCount,
+    const uint64_t* foreignApps,
+    uint8_t foreignAppsCount,
+    const char** accounts,
+    uint8_t accountsCount)
 { 
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
   uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  uint8_t nFields = ALGORAND_ASSET_OPTOUT_MIN_FIELDS;
 
   if (msgPackTx == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
@@ -3588,7 +2903,7 @@ int AlgoIoT::prepareAssetOptOutMessagePack(msgPack msgPackTx,
   }
   
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing asset opt-out with asset ID: %llu\n", assetId);
+  DEBUG_SERIAL.printf("\nPreparing application NoOp with application ID: %llu\n", applicationId);
   #endif
   
   if (m_networkType == ALGORAND_TESTNET)
@@ -3599,7 +2914,7 @@ int AlgoIoT::prepareAssetOptOutMessagePack(msgPack msgPackTx,
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
       return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
@@ -3608,279 +2923,101 @@ int AlgoIoT::prepareAssetOptOutMessagePack(msgPack msgPackTx,
   { // MainNet
     strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
     iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
-
-  // We leave a blank space header so we can add:
-  // - "TX" prefix before signing
-  // - m_signature field and "txn" node field after signing
-  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, nFields);
-    #endif
-    return 5;
-  }
-
-  // Fields must follow alphabetical order
-
-  // "aclose" label (Asset close-to address)
-  iErr = msgpackAddShortString(msgPackTx, "aclose");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding aclose label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // aclose value (binary buffer)
-  uint8_t* closeToBytes = NULL;
-  if (closeToAddress == (const char*)m_senderAddressBytes) {
-    // Use sender address directly
-    closeToBytes = m_senderAddressBytes;
-  } else {
-    // Decode the provided address
-    iErr = decodeAlgorandAddress(closeToAddress, closeToBytes);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d decoding close-to address\n\n", iErr);
-      #endif
-      return 5;
-    }
-  }
-  iErr = msgpackAddShortByteArray(msgPackTx, closeToBytes, (const uint8_t)ALGORAND_ADDRESS_BYTES);
-  if (closeToAddress != (const char*)m_senderAddressBytes) {
-    free(closeToBytes); // Free the allocated memory
-  }
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding aclose value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "arcv" label (Asset receiver - same as sender for opt-out)
-  iErr = msgpackAddShortString(msgPackTx, "arcv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding arcv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // arcv value (binary buffer) - same as sender for opt-out
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding arcv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding fee label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding fee value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding gen string\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding gh value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding lv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding lv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding snd value\n\n", iErr);
-    #endif
-    return 5;
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      #endif
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
   }
+  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
+  // We leave a blank space header so we can add:
+  // - "TX" prefix before signing
+  // - m_signature field and "txn" node field after signing
+  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding type label\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
     #endif
     return 5;
   }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "axfer");
-  if (iErr)
+
+  AppArgsField::Value args = { appArgs, appArgLengths, appArgsCount };
+  IDArrayField::Value assets = { foreignAssets, foreignAssetsCount };
+  IDArrayField::Value apps = { foreignApps, foreignAppsCount };
+  AddressArrayField::Value accountList = { NULL, 0 };
+
+  if ( ((appArgsCount > 0) && ((appArgs == NULL) || (appArgLengths == NULL))) ||
+       ((foreignAssetsCount > 0) && (foreignAssets == NULL)) || ((foreignAppsCount > 0) && (foreignApps == NULL)) ||
+       ((accountsCount > 0) && (accounts == NULL)) )
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding type string\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NULL_POINTER_ERROR;
   }
 
-  // "xaid" label
-  iErr = msgpackAddShortString(msgPackTx, "xaid");
-  if (iErr)
+  // Accounts: decoded to their 32-byte public keys
+  uint8_t (*accountBytes)[ALGORAND_ADDRESS_BYTES] = NULL;
+  if (accountsCount > 0)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding xaid label\n\n", iErr);
-    #endif
-    return 5;
+    accountBytes = (uint8_t (*)[ALGORAND_ADDRESS_BYTES])malloc((size_t)accountsCount * ALGORAND_ADDRESS_BYTES);
+    if (accountBytes == NULL)
+    {
+      return ALGOIOT_MEMORY_ERROR;
+    }
   }
-  
-  // xaid value - Use UInt32 for asset IDs that fit in 32 bits to match Algo SDK encoding
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nAdding asset ID: %llu\n", assetId);
-  #endif
-  
-  // Check if the asset ID fits in a uint32
-  if (assetId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)assetId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, assetId);
+  for (uint8_t i = 0; i < accountsCount; i++)
+  {
+    uint8_t* decoded = NULL;
+    iErr = (accounts[i] == NULL) ? ALGOIOT_NULL_POINTER_ERROR : decodeAlgorandAddress(accounts[i], decoded);
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d decoding account[%d]\n\n", iErr, i);
+      #endif
+      free(accountBytes);
+      return 5;
+    }
+    memcpy(accountBytes[i], decoded, ALGORAND_ADDRESS_BYTES);
+    free(decoded);
   }
-  
+  accountList.addresses = accountBytes;
+  accountList.count = accountsCount;
+
+  // Fields in canonical order, checked at compile time
+  iErr = ApplicationCallTx::encode(msgPackTx, args, ALGORAND_ON_COMPLETION_NOOP, assets, accountList, apps,
+                                    applicationId, fee, lastRound, gen, m_netHash, lv, m_senderAddressBytes, "appl");
+  free(accountBytes);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d adding xaid value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareApplicationNoOpMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nAsset opt-out MessagePack preparation complete");
-  #endif
 
   // End of messagepack
+
   return 0;
 }
 
-// Submit asset freeze transaction to Algorand network
+// Submit asset opt-out transaction to Algorand network
 // Return: error code (0 = OK)
-int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAddress, bool freeze)
+int AlgoIoT::submitAssetOptOutToAlgorand(uint64_t assetId, const char* closeToAddress)
 {
   uint32_t fv = 0;
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   msgPack msgPackTx = NULL;
 
+  // Use sender address as close-to address if not provided
+  if (closeToAddress == NULL) {
+    closeToAddress = (const char*)m_senderAddressBytes;
+  }
+
   // Get current Algorand parameters
   int httpResCode = getAlgorandTxParams(&fv, &fee);
   if (httpResCode != 200)
@@ -3889,15 +3026,15 @@ int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAdd
   }
 
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing asset freeze transaction for asset ID: %llu\n", assetId);
-  DEBUG_SERIAL.printf("Freeze: %s, First valid round: %u, Fee: %u\n", freeze ? "true" : "false", fv, fee);
+  DEBUG_SERIAL.printf("\nPreparing asset opt-out transaction for asset ID: %llu\n", assetId);
+  DEBUG_SERIAL.printf("First valid round: %u, Fee: %u\n", fv, fee);
   DEBUG_SERIAL.printf("Sender address (first 8 bytes): %02X %02X %02X %02X %02X %02X %02X %02X\n", 
                      m_senderAddressBytes[0], m_senderAddressBytes[1], m_senderAddressBytes[2], m_senderAddressBytes[3],
                      m_senderAddressBytes[4], m_senderAddressBytes[5], m_senderAddressBytes[6], m_senderAddressBytes[7]);
   #endif
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -3906,11 +3043,11 @@ int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAdd
     return ALGOIOT_MESSAGEPACK_ERROR;
   }  
   
-  iErr = prepareAssetFreezeMessagePack(msgPackTx, fv, fee, assetId, freezeAddress, freeze);
+  iErr = prepareAssetOptOutMessagePack(msgPackTx, fv, fee, assetId, closeToAddress);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d preparing asset freeze MessagePack\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d preparing asset opt-out MessagePack\n", iErr);
     #endif
     return ALGOIOT_MESSAGEPACK_ERROR;
   }
@@ -3921,7 +3058,7 @@ int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAdd
   debugPrintMessagePack(msgPackTx);
   #endif
 
-  // Asset freeze transaction correctly assembled. Now sign it
+  // Asset opt-out transaction correctly assembled. Now sign it
   iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
   if (iErr)
   {
@@ -3957,7 +3094,7 @@ int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAdd
   debugPrintMessagePack(msgPackTx);
   
   // Payload ready. Now we can submit it via algod REST API
-  DEBUG_SERIAL.println("\nReady to submit asset freeze transaction to Algorand network");
+  DEBUG_SERIAL.println("\nReady to submit asset opt-out transaction to Algorand network");
   #endif
   
   // Print transaction data in readable format
@@ -3969,33 +3106,31 @@ int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAdd
   if (iErr != 200)  // 200 = HTTP OK
   { // Something went wrong
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d submitting asset freeze transaction\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d submitting asset opt-out transaction\n", iErr);
     #endif
     return ALGOIOT_TRANSACTION_ERROR;
   }
   
-  // OK: our transaction for asset freeze was successfully submitted to the Algorand blockchain
+  // OK: our transaction for asset opt-out was successfully submitted to the Algorand blockchain
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.print("\t Asset freeze transaction successfully submitted with ID=");
+  DEBUG_SERIAL.print("\t Asset opt-out transaction successfully submitted with ID=");
   DEBUG_SERIAL.println(getTransactionID());
   #endif
   
   return ALGOIOT_NO_ERROR;
 }
 
-// Prepares an asset freeze transaction MessagePack
+// Prepares an asset opt-out transaction MessagePack
 // Returns error code (0 = OK)
-int AlgoIoT::prepareAssetFreezeMessagePack(msgPack msgPackTx,
+int AlgoIoT::prepareAssetOptOutMessagePack(msgPack msgPackTx,
                                   const uint32_t lastRound, 
                                   const uint16_t fee,
                                   const uint64_t assetId,
-                                  const char* freezeAddress,
-                                  bool freeze)
+                                  const char* closeToAddress)
 { 
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
   uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  uint8_t nFields = ALGORAND_ASSET_FREEZE_MIN_FIELDS;
 
   if (msgPackTx == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
@@ -4007,7 +3142,7 @@ int AlgoIoT::prepareAssetFreezeMessagePack(msgPack msgPackTx,
   }
   
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nPreparing asset freeze with asset ID: %llu\n", assetId);
+  DEBUG_SERIAL.printf("\nPreparing asset opt-out with asset ID: %llu\n", assetId);
   #endif
   
   if (m_networkType == ALGORAND_TESTNET)
@@ -4018,7 +3153,7 @@ int AlgoIoT::prepareAssetFreezeMessagePack(msgPack msgPackTx,
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
       return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
@@ -4030,7 +3165,7 @@ int AlgoIoT::prepareAssetFreezeMessagePack(msgPack msgPackTx,
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
       return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
@@ -4044,239 +3179,247 @@ int AlgoIoT::prepareAssetFreezeMessagePack(msgPack msgPackTx,
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
     #endif
     return 5;
   }
 
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, nFields);
-    #endif
-    return 5;
+  // Close-to address: the sender itself or a decoded one
+  uint8_t* closeToBytes = NULL;
+  if (closeToAddress == (const char*)m_senderAddressBytes) {
+    closeToBytes = m_senderAddressBytes;
+  } else {
+    iErr = decodeAlgorandAddress(closeToAddress, closeToBytes);
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d decoding close-to address\n\n", iErr);
+      #endif
+      return 5;
+    }
   }
 
-  // Fields must follow alphabetical order
-
-  // "afrz" label (Asset freeze flag)
-  iErr = msgpackAddShortString(msgPackTx, "afrz");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding afrz label\n\n", iErr);
-    #endif
-    return 5;
+  // Fields in canonical order, checked at compile time
+  iErr = AssetTransferTx::encode(msgPackTx, 0, closeToBytes, m_senderAddressBytes, NULL, fee, lastRound, gen,
+                                  m_netHash, lv, m_senderAddressBytes, "axfer", assetId);
+  if (closeToAddress != (const char*)m_senderAddressBytes) {
+    free(closeToBytes);
   }
-  // afrz value (boolean)
-  iErr = msgpackAddBoolean(msgPackTx, freeze);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding afrz value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetOptOutMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
 
-  // "fadd" label (Freeze address)
-  iErr = msgpackAddShortString(msgPackTx, "fadd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding fadd label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fadd value (binary buffer)
-  uint8_t* freezeAddressBytes = NULL;
-  iErr = decodeAlgorandAddress(freezeAddress, freezeAddressBytes);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d decoding freeze address\n\n", iErr);
-    #endif
-    return 5;
-  }
-  iErr = msgpackAddShortByteArray(msgPackTx, freezeAddressBytes, (const uint8_t)ALGORAND_ADDRESS_BYTES);
-  free(freezeAddressBytes); // Free the allocated memory
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding fadd value\n\n", iErr);
-    #endif
-    return 5;
-  }
+  // End of messagepack
 
-  // "faid" label (Freeze asset ID)
-  iErr = msgpackAddShortString(msgPackTx, "faid");
-  if (iErr)
+  return 0;
+}
+
+// Submit asset freeze transaction to Algorand network
+// Return: error code (0 = OK)
+int AlgoIoT::submitAssetFreezeToAlgorand(uint64_t assetId, const char* freezeAddress, bool freeze)
+{
+  uint32_t fv = 0;
+  uint16_t fee = 0;
+  int iErr = 0;
+  uint8_t signature[ALGORAND_SIG_BYTES];
+  char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
+  msgPack msgPackTx = NULL;
+
+  // Get current Algorand parameters
+  int httpResCode = getAlgorandTxParams(&fv, &fee);
+  if (httpResCode != 200)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding faid label\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_NETWORK_ERROR;
   }
-  
-  // faid value - Use UInt32 for asset IDs that fit in 32 bits to match Algo SDK encoding
+
   #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nAdding asset ID: %llu\n", assetId);
+  DEBUG_SERIAL.printf("\nPreparing asset freeze transaction for asset ID: %llu\n", assetId);
+  DEBUG_SERIAL.printf("Freeze: %s, First valid round: %u, Fee: %u\n", freeze ? "true" : "false", fv, fee);
+  DEBUG_SERIAL.printf("Sender address (first 8 bytes): %02X %02X %02X %02X %02X %02X %02X %02X\n", 
+                     m_senderAddressBytes[0], m_senderAddressBytes[1], m_senderAddressBytes[2], m_senderAddressBytes[3],
+                     m_senderAddressBytes[4], m_senderAddressBytes[5], m_senderAddressBytes[6], m_senderAddressBytes[7]);
   #endif
-  
-  // Check if the asset ID fits in a uint32
-  if (assetId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)assetId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, assetId);
-  }
-  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding faid value\n\n", iErr);
-    #endif
-    return 5;
-  }
 
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
+  // Prepare transaction structure as MessagePack
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding fee label\n\n", iErr);
+    DEBUG_SERIAL.println("\n Error initializing transaction MessagePack\n");
     #endif
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
+    return ALGOIOT_MESSAGEPACK_ERROR;
+  }  
+  
+  iErr = prepareAssetFreezeMessagePack(msgPackTx, fv, fee, assetId, freezeAddress, freeze);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding fee value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d preparing asset freeze MessagePack\n", iErr);
     #endif
-    return 5;
+    return ALGOIOT_MESSAGEPACK_ERROR;
   }
 
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
-  }
+  // Debug print the MessagePack content
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("\nUnsigned MessagePack content:");
+  debugPrintMessagePack(msgPackTx);
+  #endif
 
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
+  // Asset freeze transaction correctly assembled. Now sign it
+  iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding gen string\n\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d signing MessagePack\n", iErr);
     #endif
-    return 5;
+    return ALGOIOT_SIGNATURE_ERROR;
   }
 
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding gh value\n\n", iErr);
-    #endif
-    return 5;
+  // Debug print the signature
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("\nSignature (64 bytes):");
+  for (int i = 0; i < ALGORAND_SIG_BYTES; i++) {
+    DEBUG_SERIAL.printf("%02X ", signature[i]);
+    if ((i + 1) % 16 == 0) DEBUG_SERIAL.println();
   }
+  DEBUG_SERIAL.println();
+  #endif
 
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
+  // Signed OK: now compose payload
+  iErr = createSignedBinaryTransaction(msgPackTx, signature);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding lv label\n\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d creating signed binary transaction\n", iErr);
     #endif
-    return 5;
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
   }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
-  {
+
+  // Debug print the final signed MessagePack
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("\nSigned MessagePack content:");
+  debugPrintMessagePack(msgPackTx);
+  
+  // Payload ready. Now we can submit it via algod REST API
+  DEBUG_SERIAL.println("\nReady to submit asset freeze transaction to Algorand network");
+  #endif
+  
+  // Print transaction data in readable format
+  #ifdef LIB_DEBUGMODE
+  printTransactionData(msgPackTx);
+  #endif
+  
+  iErr = submitTransaction(msgPackTx); // Returns HTTP code
+  if (iErr != 200)  // 200 = HTTP OK
+  { // Something went wrong
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding lv value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n Error %d submitting asset freeze transaction\n", iErr);
     #endif
-    return 5;
+    return ALGOIOT_TRANSACTION_ERROR;
   }
+  
+  // OK: our transaction for asset freeze was successfully submitted to the Algorand blockchain
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.print("\t Asset freeze transaction successfully submitted with ID=");
+  DEBUG_SERIAL.println(getTransactionID());
+  #endif
+  
+  return ALGOIOT_NO_ERROR;
+}
 
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
+// Prepares an asset freeze transaction MessagePack
+// Returns error code (0 = OK)
+int AlgoIoT::prepareAssetFreezeMessagePack(msgPack msgPackTx,
+                                  const uint32_t lastRound, 
+                                  const uint16_t fee,
+                                  const uint64_t assetId,
+                                  const char* freezeAddress,
+                                  bool freeze)
+{ 
+  int iErr = 0;
+  char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
+  uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
+
+  if (msgPackTx == NULL)
+    return ALGOIOT_NULL_POINTER_ERROR;
+  if (msgPackTx->msgBuffer == NULL)
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
+  if ((lastRound == 0) || (fee == 0))
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
+  }
+  
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.printf("\nPreparing asset freeze with asset ID: %llu\n", assetId);
+  #endif
+  
+  if (m_networkType == ALGORAND_TESTNET)
+  { // TestNet
+    strncpy(gen, ALGORAND_TESTNET_ID, ALGORAND_NETWORK_ID_CHARS);
+    // Decode Algorand network hash
+    iErr = decodeAlgorandNetHash(ALGORAND_TESTNET_HASH, m_netHash);
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      #endif
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
+  }
+  else
+  { // MainNet
+    strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
+    iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
+      #endif
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
   }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
+  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
+
+  // We leave a blank space header so we can add:
+  // - "TX" prefix before signing
+  // - m_signature field and "txn" node field after signing
+  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding snd value\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n", iErr);
     #endif
     return 5;
   }
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
+  uint8_t* freezeAddressBytes = NULL;
+  iErr = decodeAlgorandAddress(freezeAddress, freezeAddressBytes);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding type label\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d decoding freeze address\n\n", iErr);
     #endif
     return 5;
   }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "afrz");
+
+  // Fields in canonical order, checked at compile time
+  iErr = AssetFreezeTx::encode(msgPackTx, freeze, freezeAddressBytes, assetId, fee, lastRound, gen, m_netHash,
+                                lv, m_senderAddressBytes, "afrz");
+  free(freezeAddressBytes);
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d adding type string\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetFreezeMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nAsset freeze MessagePack preparation complete");
-  #endif
 
   // End of messagepack
+
   return 0;
 }
 
@@ -4288,7 +3431,6 @@ int AlgoIoT::submitAssetDestroyToAlgorand(uint64_t assetId)
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   msgPack msgPackTx = NULL;
 
@@ -4308,7 +3450,7 @@ int AlgoIoT::submitAssetDestroyToAlgorand(uint64_t assetId)
   #endif
 
   // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -4404,7 +3546,6 @@ int AlgoIoT::prepareAssetDestroyMessagePack(msgPack msgPackTx,
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
   uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  uint8_t nFields = ALGORAND_ASSET_DESTROY_MIN_FIELDS;
 
   if (msgPackTx == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
@@ -4458,186 +3599,21 @@ int AlgoIoT::prepareAssetDestroyMessagePack(msgPack msgPackTx,
     return 5;
   }
 
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding root map with %d fields\n\n", iErr, nFields);
-    #endif
-    return 5;
-  }
-
-  // Fields must follow alphabetical order
-
-  // "caid" label (Config Asset ID)
-  iErr = msgpackAddShortString(msgPackTx, "caid");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding caid label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  
-  // caid value - Use UInt32 for asset IDs that fit in 32 bits to match Algo SDK encoding
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.printf("\nAdding asset ID: %llu\n", assetId);
-  #endif
-  
-  // Check if the asset ID fits in a uint32
-  if (assetId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)assetId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, assetId);
-  }
-  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding caid value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding fee label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding fee value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding fv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding fv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding gen label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding gen string\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding gh label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding gh value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding lv label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding lv value\n\n", iErr);
-    #endif
-    return 5;
-  }
-
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding snd label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding snd value\n\n", iErr);
-    #endif
-    return 5;
-  }
+  // No parameters: destroy
+  AssetParamsField::Value noParams = { NULL, NULL, 0, 0, NULL };
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding type label\n\n", iErr);
-    #endif
-    return 5;
-  }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "acfg");
+  // Fields in canonical order, checked at compile time
+  iErr = AssetConfigTx::encode(msgPackTx, noParams, assetId, fee, lastRound, gen, m_netHash, lv, m_senderAddressBytes, "acfg");
   if (iErr)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d adding type string\n\n", iErr);
+    DEBUG_SERIAL.printf("\n prepareAssetDestroyMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
     #endif
     return 5;
   }
-  
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nAsset destroy MessagePack preparation complete");
-  #endif
 
   // End of messagepack
+
   return 0;
 }
 
@@ -4649,7 +3625,6 @@ int AlgoIoT::submitAssetClawbackToAlgorand(uint64_t assetId, const char* fromAdd
   uint16_t fee = 0;
   int iErr = 0;
   uint8_t signature[ALGORAND_SIG_BYTES];
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
   msgPack msgPackTx = NULL;
 
   int httpResCode = getAlgorandTxParams(&fv, &fee);
@@ -4663,7 +3638,7 @@ int AlgoIoT::submitAssetClawbackToAlgorand(uint64_t assetId, const char* fromAdd
   DEBUG_SERIAL.printf("Amount: %llu, First valid round: %u, Fee: %u\n", amount, fv, fee);
   #endif
 
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
+  msgPackTx = msgpackInit(&(m_ws->txBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
   if (msgPackTx == NULL)  
   {
     #ifdef LIB_DEBUGMODE
@@ -4738,7 +3713,6 @@ int AlgoIoT::prepareAssetClawbackMessagePack(msgPack msgPackTx,
   int iErr = 0;
   char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
   uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  uint8_t nFields = ALGORAND_ASSET_CLAWBACK_MIN_FIELDS;
 
   if (msgPackTx == NULL || (lastRound == 0) || (fee == 0))
     return ALGOIOT_INTERNAL_GENERIC_ERROR;
@@ -4759,90 +3733,40 @@ int AlgoIoT::prepareAssetClawbackMessagePack(msgPack msgPackTx,
   iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
   if (iErr) return 5;
 
-  iErr = msgpackAddShortMap(msgPackTx, nFields);
-  if (iErr) return 5;
-
-  // "aamt" - Asset amount
-  iErr = msgpackAddShortString(msgPackTx, "aamt");
-  if (iErr) return 5;
-  if (amount <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)amount);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, amount);
-  }
-  if (iErr) return 5;
-
-  // "arcv" - Asset receiver
-  iErr = msgpackAddShortString(msgPackTx, "arcv");
-  if (iErr) return 5;
   uint8_t* toAddressBytes = NULL;
   iErr = decodeAlgorandAddress(toAddress, toAddressBytes);
-  if (iErr) return 5;
-  iErr = msgpackAddShortByteArray(msgPackTx, toAddressBytes, ALGORAND_ADDRESS_BYTES);
-  free(toAddressBytes);
-  if (iErr) return 5;
-
-  // "asnd" - Asset sender (clawed back from)
-  iErr = msgpackAddShortString(msgPackTx, "asnd");
-  if (iErr) return 5;
+  if (iErr)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n prepareAssetClawbackMessagePack(): ERROR %d decoding receiver address\n\n", iErr);
+    #endif
+    return 5;
+  }
   uint8_t* fromAddressBytes = NULL;
   iErr = decodeAlgorandAddress(fromAddress, fromAddressBytes);
-  if (iErr) return 5;
-  iErr = msgpackAddShortByteArray(msgPackTx, fromAddressBytes, ALGORAND_ADDRESS_BYTES);
-  free(fromAddressBytes);
-  if (iErr) return 5;
-
-  // "fee"
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr) return 5;
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr) return 5;
-
-  // "fv"
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr) return 5;
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr) return 5;
-
-  // "gen"
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr) return 5;
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr) return 5;
-
-  // "gh"
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr) return 5;
-  iErr = msgpackAddShortByteArray(msgPackTx, m_netHash, ALGORAND_NET_HASH_BYTES);
-  if (iErr) return 5;
-
-  // "lv"
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr) return 5;
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr) return 5;
+  if (iErr)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n prepareAssetClawbackMessagePack(): ERROR %d decoding clawed back address\n\n", iErr);
+    #endif
+    free(toAddressBytes);
+    return 5;
+  }
 
-  // "snd" - Transaction sender (clawback address)
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr) return 5;
-  iErr = msgpackAddShortByteArray(msgPackTx, m_senderAddressBytes, ALGORAND_ADDRESS_BYTES);
-  if (iErr) return 5;
+  // Fields in canonical order, checked at compile time
+  iErr = AssetTransferTx::encode(msgPackTx, amount, NULL, toAddressBytes, fromAddressBytes, fee, lastRound, gen,
+                                  m_netHash, lv, m_senderAddressBytes, "axfer", assetId);
+  free(toAddressBytes);
+  free(fromAddressBytes);
+  if (iErr)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n prepareAssetClawbackMessagePack(): ERROR %d encoding transaction fields\n\n", iErr);
+    #endif
+    return 5;
+  }
 
-  // "type"
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr) return 5;
-  iErr = msgpackAddShortString(msgPackTx, "axfer");
-  if (iErr) return 5;
+  // End of messagepack
 
-  // "xaid" - Asset ID
-  iErr = msgpackAddShortString(msgPackTx, "xaid");
-  if (iErr) return 5;
-  if (assetId <= 0xFFFFFFFF) {
-    iErr = msgpackAddUInt32(msgPackTx, (uint32_t)assetId);
-  } else {
-    iErr = msgpackAddUInt64(msgPackTx, assetId);
-  }
-  if (iErr) return 5;
-  
   return 0;
 }
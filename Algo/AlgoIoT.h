@@ -35,6 +35,7 @@
 #include <HTTPClient.h>   // https://github.com/espressif/arduino-esp32/blob/master/libraries/HTTPClient/src/HTTPClient/HTTPClient.h
 #include <ArduinoJson.h>  // JSON needed for Algorand transactions. ArduinoJson because: https://arduinojson.org/news/2019/11/19/arduinojson-vs-arduino_json/
 #include "minmpk.h"
+#include "AlgoMerkle.h"
 // #include "algoiot_user_config.h"
 
 #define BLANK_MSGPACK_HEADER 75  // We leave this space at the head of the buffer, so we can add the m_signature later
@@ -46,11 +47,14 @@
 #define ALGORAND_TRANSACTION_PREFIX "TX"
 #define ALGORAND_TRANSACTION_PREFIX_BYTES 2
 #define ALGORAND_TRANSACTIONID_SIZE 64
+#define ALGORAND_GROUP_PREFIX "TG"
+#define ALGORAND_GROUP_ID_BYTES 32
+#define ALGORAND_MAX_GROUP_SIZE 16  // Consensus limit on transactions in an atomic group
 #define ALGORAND_TESTNET 0
 #define ALGORAND_MAINNET 1
 #define ALGORAND_NETWORK_ID_CHARS 12
 #define ALGORAND_API_ENDPOINT_CHARS 128
-#define ALGORAND_API_TOKEN_CHARS 32
+#define ALGORAND_API_TOKEN_CHARS 64  // algod tokens are 64 hex chars
 #define ALGORAND_TESTNET_ID "testnet-v1.0"
 #define ALGORAND_TESTNET_HASH "SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI="
 #define ALGORAND_TESTNET_API_ENDPOINT "https://testnet-api.algonode.cloud"  // Algonode Testnet API
@@ -80,10 +84,29 @@
 #define HTTP_CONNECT_TIMEOUT_MS 5000UL
 #define HTTP_QUERY_TIMEOUT_S 5
 
+// algod endpoint pool: requests go to the healthy endpoint with the lowest average latency, and fail over on error
+#ifndef ALGOIOT_MAX_ENDPOINTS
+  #define ALGOIOT_MAX_ENDPOINTS 4
+#endif
+#ifndef ALGORAND_API_TOKEN_HEADER
+  #define ALGORAND_API_TOKEN_HEADER "X-Algo-API-Token"
+#endif
+#define ALGOIOT_ENDPOINT_EWMA_SHIFT 2          // Latency average weight of a new sample = 1/4
+#define ALGOIOT_ENDPOINT_MAX_FAILURES 2        // Consecutive failures before an endpoint is considered down
+#define ALGOIOT_ENDPOINT_RETRY_MS 60000UL      // A down endpoint is tried again after this time
+
+// Transaction params (last round, min fee) are reused for this long; 0 = fetched for each transaction
+// Identical transactions from one account sharing cached params would get the same ID: vary the note
+#ifndef ALGOIOT_PARAMS_CACHE_MS
+  #define ALGOIOT_PARAMS_CACHE_MS 0UL
+#endif
+
 #define ALGORAND_ASSET_TRANSFER_MIN_FIELDS 10 // Fields for asset transfer transaction: aamt, arcv, fee, fv, gen, gh, lv, snd, type, xaid
 #define DEFAULT_ASSET_ID 733709260 // Default asset ID to use for asset transfers
 #define ALGORAND_APPLICATION_OPTIN_MIN_FIELDS 9 // Fields for application opt-in: apan, apid, fee, fv, gen, gh, lv, snd, type
 #define DEFAULT_APPLICATION_ID 738608433 // Default application ID to use for application opt-ins
+#define ALGORAND_ON_COMPLETION_NOOP 0   // "apan" values
+#define ALGORAND_ON_COMPLETION_OPTIN 1
 
 // Add these constants after the existing constants
 #define ALGORAND_ASSET_CREATION_MIN_FIELDS 10 // Fields for asset creation: apar, fee, fv, gen, gh, lv, snd, type
@@ -95,6 +118,22 @@
 #define ALGORAND_ASSET_DESTROY_MIN_FIELDS 8 // Fields for asset destroy: caid, fee, fv, gen, gh, lv, snd, type
 #define ALGORAND_ASSET_CLAWBACK_MIN_FIELDS 11 // Fields for asset clawback: aamt, arcv, asnd, fee, fv, gen, gh, lv, snd, type, xaid
 
+// Off-chain attestations: each logged reading costs MERKLE_HASH_BYTES of heap (allocated on first use)
+#ifndef ALGOIOT_ATTEST_MAX_LEAVES
+  #define ALGOIOT_ATTEST_MAX_LEAVES 1024
+#endif
+#define ALGOIOT_MERKLE_ROOT_B64_CHARS 44 // Base64 of a 32-byte root, with padding
+#define ALGOIOT_ATTEST_NOTE_MARGIN 32    // ':j{"mroot":"","n":4294967295}' plus slack
+
+// Encrypted notes: "<app-name>:b" || 4-byte BE counter || ChaChaPoly(JSON) || 16-byte tag
+// Nonce is counter || first valid round (8 bytes BE); prefix and counter are authenticated, not encrypted
+#define ALGOIOT_NOTE_KEY_BYTES 32
+#define ALGOIOT_NOTE_COUNTER_BYTES 4
+#define ALGOIOT_NOTE_TAG_BYTES 16
+#define ALGOIOT_NOTE_NONCE_BYTES 12
+#define ALGOIOT_NOTE_KDF_INFO "AlgoIoT note key v1"
+#define ALGORAND_MAX_NOTE_PROTOCOL_BYTES 1024 // Consensus limit on the note field
+
 
 // Error codes
 #define ALGOIOT_NO_ERROR 0
@@ -110,16 +149,52 @@
 #define ALGOIOT_DATA_STRUCTURE_TOO_LONG 10
 
 
+// algod endpoint, with its health and latency statistics
+typedef struct
+{
+  char url[ALGORAND_API_ENDPOINT_CHARS + 1];
+  char token[ALGORAND_API_TOKEN_CHARS + 1];
+  uint32_t latencyMs;     // Exponentially weighted moving average; 0 = not measured yet
+  uint32_t lastFailureMs;
+  uint8_t failures;       // Consecutive
+} AlgodEndpoint;
+
+
+// Heavy working buffers: HTTP client, JSON note document, note and transaction messagepack buffers
+// By default each AlgoIoT instance allocates its own on first use (on the heap, about 3.5 KB on ESP32 plus the endpoint pool);
+// a caller-supplied one can be shared by several instances (e.g. one per account on a gateway),
+// provided they run in a single task and each one adds its data fields and submits before the next one starts:
+// the note document is cleared whenever a different instance starts writing to it
+class AlgoIoT;
+class AlgoKeyring;
+typedef struct AlgoIoTWorkspace
+{
+  HTTPClient httpClient;
+  AlgodEndpoint endpoints[ALGOIOT_MAX_ENDPOINTS]; // If empty, each instance's m_httpBaseURL and APItoken are used
+  uint8_t endpointCount = 0;
+  uint32_t paramsCacheMs = ALGOIOT_PARAMS_CACHE_MS;
+  uint32_t paramsFetchedMs = 0;
+  uint32_t paramsRound = 0;   // 0 = no cached params
+  uint16_t paramsFee = 0;
+  uint8_t paramsNetwork = 0;
+  StaticJsonDocument <ALGORAND_MAX_NOTES_SIZE + JSON_ENCODING_MARGIN>noteJDoc;  // TO BE TESTED with complete 1000-bytes note field
+  char notes[ALGORAND_MAX_NOTES_SIZE + 1];
+  uint8_t txBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
+  const AlgoIoT* noteOwner = NULL;  // Instance whose data fields are in noteJDoc
+} AlgoIoTWorkspace;
+
+
 // AlgoIoT class
 class AlgoIoT
 {
   private:
   // Private vars
-  HTTPClient m_httpClient;
+  AlgoIoTWorkspace* m_ws = NULL;
+  bool m_ownsWorkspace = false;
+  const uint8_t* m_signingKey = NULL; // Expanded key used instead of m_privateKey when acting for an AlgoKeyring account
   char m_appName[DAPP_NAME_MAX_LEN + 1] = "";
   String m_httpBaseURL = ALGORAND_TESTNET_API_ENDPOINT;
   char APItoken[ALGORAND_API_TOKEN_CHARS + 1] = "";
-  StaticJsonDocument <ALGORAND_MAX_NOTES_SIZE + JSON_ENCODING_MARGIN>m_noteJDoc;  // TO BE TESTED with complete 1000-bytes note field
   char m_transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   uint8_t m_networkType = ALGORAND_TESTNET;
   uint8_t m_privateKey[ALGORAND_KEY_BYTES];
@@ -129,6 +204,12 @@ class AlgoIoT
   uint8_t* m_netHash = NULL;
   uint16_t m_noteOffset = 0;
   uint16_t m_noteLen = 0;
+  uint8_t (*m_attestLeaves)[MERKLE_HASH_BYTES] = NULL; // Attestation log: one leaf hash per reading
+  uint32_t m_attestCount = 0;
+  bool m_attestAnchored = false;
+  uint8_t m_noteKey[ALGOIOT_NOTE_KEY_BYTES]; // Per-device note encryption key (HKDF-SHA256 of master key)
+  bool m_noteKeySet = false;
+  uint32_t m_noteCounter = 0;
   
   // Decodes Base32 Algorand address to 32-byte binary address suitable for our functions
   // outBinaryAddress allocated internally, has to be freed by caller
@@ -162,7 +243,10 @@ class AlgoIoT
                                   const uint16_t fee, 
                                   const uint32_t paymentAmountMicroAlgos,
                                   const char* notes,
-                                  const uint16_t notesLen);
+                                  const uint16_t notesLen,
+                                  const uint16_t noteTrailerBytes = 0,
+                                  uint8_t** notePayload = NULL,
+                                  const uint8_t* groupId = NULL);
 
   // 4. Gets Ed25519 m_signature of binary pack (to which it internally prepends "TX" prefix)
   // Caller passes a 64-bytes buffer in "signature"
@@ -175,10 +259,50 @@ class AlgoIoT
   int createSignedBinaryTransaction(msgPack msgPackTx, const uint8_t signature[ALGORAND_SIG_BYTES]);
 
 
+  // Makes sure a workspace is available, allocating our own if none was supplied
+  // Returns error code (0 = OK)
+  int useWorkspace();
+
+  // Transaction engine of an AlgoKeyring: no account of its own, sender and signing key are set for each transaction
+  friend class AlgoKeyring;
+  AlgoIoT(AlgoIoTWorkspace* workspace, const char* appName);
+
+  // Makes sure the workspace note document holds our data fields, clearing another instance's ones
+  // Returns error code (0 = OK)
+  int claimNoteDocument();
+
+  // Sends a GET (postBody and postChain == NULL) or POST request for "path" to algod
+  // A segmented POST body ("postChain") is streamed segment by segment, without flattening it
+  // Picks the fastest healthy endpoint of the pool and fails over to the next one on network or 5xx errors
+  // On return m_ws->httpClient is still open on the endpoint which answered: caller reads the response and calls end()
+  // Returns HTTP response code (negative on network error)
+  int algodRequest(const char* path, uint8_t* postBody = NULL, const size_t postLen = 0, const mpkChain* postChain = NULL);
+
+  // Sends a single request to "baseURL" (see algodRequest)
+  int algodSend(const char* baseURL, const char* token, const char* path, uint8_t* postBody, const size_t postLen,
+                const mpkChain* postChain);
+
+  // Index of the healthy endpoint with the lowest latency not in "triedMask"; a down one if no healthy one is left
+  // Returns -1 if every endpoint has been tried
+  int selectAlgodEndpoint(const uint32_t triedMask);
+
   // 6. Submits transaction to algod
   // Last method to be called, after all the others
+  // "group" (optional): concatenated signed transactions of a group, submitted instead of msgPackTx (which may be NULL)
   // Returns HTTP response code (200 = OK)
-  int submitTransaction(msgPack msgPackTx); 
+  int submitTransaction(msgPack msgPackTx, const mpkChain* group = NULL); 
+
+  // Runs steps 1-6 for a payment transaction carrying "notes" (max 1000 bytes)
+  // If clearNoteBytes > 0, the note is encrypted in place after its first clearNoteBytes (see encryptNoteInPlace)
+  // Returns error code (0 = OK)
+  int submitPaymentWithNote(const char* notes, const uint16_t notesLen, const uint16_t clearNoteBytes = 0,
+                            const uint32_t amountMicroAlgos = PAYMENT_AMOUNT_MICROALGOS);
+
+  // Encrypts "note" in place inside the messagepack, before signing
+  // note[0..clearBytes) is the clear prefix, ending with ALGOIOT_NOTE_COUNTER_BYTES written here;
+  // bodyBytes of plaintext follow, then ALGOIOT_NOTE_TAG_BYTES reserved for the tag
+  // Returns error code (0 = OK)
+  int encryptNoteInPlace(uint8_t* note, const uint16_t clearBytes, const uint16_t bodyBytes, const uint32_t firstRound);
 
   // Prepares an asset transfer transaction MessagePack for opt-in
   // Returns error code (0 = OK)
@@ -193,7 +317,7 @@ class AlgoIoT
   // Prints transaction data in a readable string format
   void printTransactionData(msgPack msgPackTx);
 
-  // Add this function declaration to the AlgoIoT class in the private section
+  // Prints the key path of the transaction field containing an algod error position
   void debugMessagePackAtPosition(msgPack msgPackTx, uint32_t errorPosition);
 
   // Prepares an application opt-in transaction MessagePack
@@ -281,7 +405,19 @@ class AlgoIoT
   // Constructor
   // "appName" not null and 31 chars max
   // "algoAccountWords" is a string containing the 25 words which encode the Algorand account private key in BIP-39
-  AlgoIoT(const char* appName, const char* algoAccountWords);
+  // "workspace" (optional) holds the heavy working buffers and may be shared with other instances (see AlgoIoTWorkspace)
+  AlgoIoT(const char* appName, const char* algoAccountWords, AlgoIoTWorkspace* workspace = NULL);
+
+  ~AlgoIoT();
+
+  // Instances own heap buffers: no copies
+  AlgoIoT(const AlgoIoT&) = delete;
+  AlgoIoT& operator=(const AlgoIoT&) = delete;
+
+  // Switches to a caller-supplied workspace, releasing our own if any. NULL = allocate our own on next use
+  // Data fields added so far are lost
+  // Return: error code (0 = OK)
+  int setWorkspace(AlgoIoTWorkspace* workspace);
 
   // By default, destination address = this device address (transaction to self). This saves transaction fee
   // User may need a different destination address (Smart Contract, collector address, ...)
@@ -296,6 +432,24 @@ class AlgoIoT
   // Return: error code (0 = OK)
   int setAlgorandNetwork(const uint8_t networkType);
 
+  // Sets the API token sent (as ALGORAND_API_TOKEN_HEADER) to the default endpoint; NULL or "" = no token
+  // Return: error code (0 = OK)
+  int setAPIToken(const char* token);
+
+  // Adds an algod endpoint ("https://host[:port]", no trailing slash) to the pool, with its optional API token
+  // Once at least one is added, the pool replaces the default endpoint: add it explicitly to keep it as fallback
+  // Endpoints belong to the current network: setAlgorandNetwork() empties the pool
+  // The pool lives in the workspace, so instances sharing one also share endpoints and their statistics
+  // Return: error code (0 = OK)
+  int addAlgodEndpoint(const char* url, const char* token = NULL);
+
+  // Empties the pool, going back to the default endpoint
+  void clearAlgodEndpoints();
+
+  // Average latency (ms, 0 = not measured yet) and health of pool endpoint "index"
+  // Return: error code (0 = OK)
+  int getAlgodEndpointStatus(const uint8_t index, uint32_t* latencyMs, bool* healthy);
+
   // Returns the ID of the transaction submitted to the Algorand blockchain (if successfully submitted), or an empty string
   const char* getTransactionID();
 
@@ -329,8 +483,18 @@ class AlgoIoT
   int dataAddShortStringField(const char* label, char* shortCString);
 
   // Submit transaction to Algorand network
+  // If encryptNote, the JSON payload is ChaChaPoly-encrypted with the key set by setNoteEncryptionKey()
   // Return: error code (0 = OK)
-  int submitTransactionToAlgorand();
+  int submitTransactionToAlgorand(const bool encryptNote = false);
+
+  // Derives the per-device note encryption key: HKDF-SHA256(masterKey, salt = device address, ALGOIOT_NOTE_KDF_INFO)
+  // "initialCounter" seeds the nonce counter: persist it across reboots (e.g. in NVS),
+  // otherwise a nonce repeats if two notes share counter and first valid round
+  // Return: error code (0 = OK)
+  int setNoteEncryptionKey(const uint8_t* masterKey, const size_t masterKeyLen, const uint32_t initialCounter = 0);
+
+  // Current nonce counter (next value to be used)
+  uint32_t getNoteCounter() const;
 
   // Submit asset opt-in transaction to Algorand network
   // Return: error code (0 = OK)
@@ -378,6 +542,30 @@ class AlgoIoT
     const char* toAddress,
     uint64_t amount);
 
+  // Off-chain attestations (see AlgoMerkle.h for the tree layout)
+  // Signs "reading" with the device key and appends its leaf to the local log (max ALGOIOT_ATTEST_MAX_LEAVES)
+  // Optionally returns the 64-byte signature and the leaf index, to be stored off-chain with the reading
+  // The first reading after a successful anchor starts a new batch
+  // Return: error code (0 = OK)
+  int attestReading(const uint8_t* reading, const uint16_t readingLen,
+                    uint8_t signature[ALGORAND_SIG_BYTES] = NULL, uint32_t* leafIndex = NULL);
+
+  // Number of readings in the current batch
+  uint32_t getAttestationCount() const;
+
+  // Merkle root of the current batch
+  // Return: error code (0 = OK)
+  int getAttestationRoot(uint8_t root[MERKLE_HASH_BYTES]);
+
+  // Inclusion proof of reading "leafIndex" in the current batch; "proof" holds MERKLE_MAX_DEPTH entries
+  // Check it with AlgoMerkle::verifyReading() against the anchored root and getAttestationCount()
+  // Return: error code (0 = OK)
+  int getAttestationProof(const uint32_t leafIndex, uint8_t proof[][MERKLE_HASH_BYTES], uint8_t* proofLen);
+
+  // Anchors the Merkle root of the current batch in a single payment transaction note
+  // Return: error code (0 = OK)
+  int submitAttestationRootToAlgorand();
+
 
 
 
@@ -0,0 +1,320 @@
+// AlgoKeyring.cpp
+// Multi-account signer for AlgoIoT gateways
+// v20261018-1
+
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <Crypto.h>
+#include <Ed25519.h>
+#include <SHA512_256.h>
+#include "AlgoKeyring.h"
+
+
+AlgoKeyring::AlgoKeyring(const char* appName, const uint32_t maxAccounts, AlgoIoTWorkspace* workspace)
+  : m_engine(workspace, appName)
+{
+  if (maxAccounts == 0)
+  {
+    return;
+  }
+  m_keys = (uint8_t (*)[ALGOKEYRING_ENTRY_BYTES])malloc((size_t)maxAccounts * ALGOKEYRING_ENTRY_BYTES);
+  if (m_keys == NULL)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("\n Memory error allocating keyring\n");
+    #endif
+    return;
+  }
+  m_maxAccounts = maxAccounts;
+
+  // All accounts submit through the same workspace: cache params between them
+  if ( (m_engine.useWorkspace() == ALGOIOT_NO_ERROR) && (m_engine.m_ws->paramsCacheMs == 0) )
+  {
+    m_engine.m_ws->paramsCacheMs = ALGOKEYRING_PARAMS_CACHE_MS;
+  }
+}
+
+
+AlgoKeyring::~AlgoKeyring()
+{
+  if (m_keys != NULL)
+  {
+    clean(m_keys, (size_t)m_maxAccounts * ALGOKEYRING_ENTRY_BYTES);
+    free(m_keys);
+  }
+}
+
+
+int AlgoKeyring::addAccount(const char* algoAccountWords, uint32_t* accountIndex)
+{
+  uint8_t privateKey[ALGORAND_KEY_BYTES];
+  int iErr = 0;
+
+  if (algoAccountWords == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  iErr = m_engine.decodePrivateKeyFromMnemonics(algoAccountWords, privateKey);
+  if (iErr)
+  {
+    clean(privateKey, sizeof(privateKey));
+    return ALGOIOT_BAD_PARAM;
+  }
+  iErr = addAccountFromKey(privateKey, accountIndex);
+  clean(privateKey, sizeof(privateKey));
+
+  return iErr;
+}
+
+
+int AlgoKeyring::addAccountFromKey(const uint8_t privateKey[ALGORAND_KEY_BYTES], uint32_t* accountIndex)
+{
+  uint8_t* entry = NULL;
+
+  if (privateKey == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (m_keys == NULL)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+  if (m_accountCount >= m_maxAccounts)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  entry = m_keys[m_accountCount];
+  Ed25519::expandPrivateKey(entry, privateKey);
+  Ed25519::derivePublicKey(entry + ALGOKEYRING_EXPANDED_KEY_BYTES, privateKey);
+  if (accountIndex != NULL)
+  {
+    *accountIndex = m_accountCount;
+  }
+  m_accountCount++;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+uint32_t AlgoKeyring::getAccountCount() const
+{
+  return m_accountCount;
+}
+
+
+const uint8_t* AlgoKeyring::getAccountAddress(const uint32_t accountIndex) const
+{
+  if (accountIndex >= m_accountCount)
+  {
+    return NULL;
+  }
+  return m_keys[accountIndex] + ALGOKEYRING_EXPANDED_KEY_BYTES;
+}
+
+
+int AlgoKeyring::setAlgorandNetwork(const uint8_t networkType)
+{
+  return m_engine.setAlgorandNetwork(networkType);
+}
+
+
+int AlgoKeyring::setAPIToken(const char* token)
+{
+  return m_engine.setAPIToken(token);
+}
+
+
+int AlgoKeyring::addAlgodEndpoint(const char* url, const char* token)
+{
+  return m_engine.addAlgodEndpoint(url, token);
+}
+
+
+// Sets the engine up to sign "tx" as account "accountIndex"
+// Return: error code (0 = OK)
+int AlgoKeyring::useAccount(const uint32_t accountIndex, const AlgoKeyringTx& tx)
+{
+  const uint8_t* entry = NULL;
+
+  if (accountIndex >= m_accountCount)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  if ( (tx.notes == NULL) && (tx.notesLen > 0) )
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (tx.notesLen > ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+  if (m_engine.m_receiverAddressBytes == NULL)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+
+  entry = m_keys[accountIndex];
+  memcpy(m_engine.m_senderAddressBytes, entry + ALGOKEYRING_EXPANDED_KEY_BYTES, ALGORAND_ADDRESS_BYTES);
+  memcpy(m_engine.m_receiverAddressBytes, (tx.receiver != NULL) ? tx.receiver : m_engine.m_senderAddressBytes,
+         ALGORAND_ADDRESS_BYTES);
+  m_engine.m_signingKey = entry;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoKeyring::submit(const uint32_t accountIndex, const AlgoKeyringTx& tx)
+{
+  int iErr = 0;
+
+  // Act as this account for one transaction
+  iErr = useAccount(accountIndex, tx);
+  if (iErr)
+  {
+    return iErr;
+  }
+
+  iErr = m_engine.submitPaymentWithNote(tx.notes, tx.notesLen, 0, tx.amountMicroAlgos);
+
+  m_engine.m_signingKey = NULL;
+
+  return iErr;
+}
+
+
+int AlgoKeyring::submitGroup(const uint32_t* accountIndexes, const AlgoKeyringTx* txs, const uint8_t count)
+{
+  uint8_t groupId[ALGORAND_GROUP_ID_BYTES];
+  uint8_t txId[ALGORAND_GROUP_ID_BYTES];
+  uint8_t signature[ALGORAND_SIG_BYTES];
+  uint8_t header[16];
+  uint16_t txLen[ALGORAND_MAX_GROUP_SIZE];
+  const uint8_t txIdHeader[2] = { 0xC4, ALGORAND_GROUP_ID_BYTES };  // bin 8
+  const uint32_t grpFieldBytes = 4 + sizeof(txIdHeader) + ALGORAND_GROUP_ID_BYTES;  // fixstr "grp", bin 8
+  uint32_t fv = 0;
+  uint16_t fee = 0;
+  mpkStruct txPack;
+  mpkChain group;
+  SHA512_256 hash;
+  int iErr = 0;
+
+  if ( (accountIndexes == NULL) || (txs == NULL) )
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if ( (count == 0) || (count > ALGORAND_MAX_GROUP_SIZE) )
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+  if (m_engine.useWorkspace() != ALGOIOT_NO_ERROR)
+  {
+    return ALGOIOT_MEMORY_ERROR;
+  }
+  if (m_engine.getAlgorandTxParams(&fv, &fee) != 200)
+  {
+    return ALGOIOT_NETWORK_ERROR;
+  }
+
+  // 1. Group ID = SHA-512/256("TG" || msgpack {"txlist": [ID of each transaction]}),
+  //    transaction ID = SHA-512/256("TX" || transaction without "grp")
+  txPack.msgBuffer = header;
+  txPack.bufferLen = sizeof(header);
+  txPack.currentMsgLen = 0;
+  txPack.currentPosition = 0;
+  if ( msgpackAddMap(&txPack, 1) || msgpackAddString(&txPack, "txlist", 6) || msgpackAddArray(&txPack, count) )
+  {
+    return ALGOIOT_MESSAGEPACK_ERROR;
+  }
+  hash.update(ALGORAND_GROUP_PREFIX, 2);
+  hash.update(header, txPack.currentMsgLen);
+  for (uint8_t i = 0; i < count; i++)
+  {
+    iErr = useAccount(accountIndexes[i], txs[i]);
+    if (!iErr)
+    {
+      txPack.msgBuffer = &(m_engine.m_ws->txBuffer[0]);
+      txPack.bufferLen = ALGORAND_MAX_TX_MSGPACK_SIZE;
+      txPack.currentMsgLen = 0;
+      txPack.currentPosition = 0;
+      iErr = m_engine.prepareTransactionMessagePack(&txPack, fv, fee, txs[i].amountMicroAlgos, txs[i].notes, txs[i].notesLen)
+             ? ALGOIOT_MESSAGEPACK_ERROR : ALGOIOT_NO_ERROR;
+    }
+    m_engine.m_signingKey = NULL;
+    if (iErr)
+    {
+      return iErr;
+    }
+    txLen[i] = (uint16_t)txPack.currentMsgLen;
+
+    SHA512_256 txHash;
+    txHash.update(ALGORAND_TRANSACTION_PREFIX, ALGORAND_TRANSACTION_PREFIX_BYTES);
+    txHash.update(txPack.msgBuffer + BLANK_MSGPACK_HEADER, txLen[i]);
+    txHash.finalize(txId, sizeof(txId));
+    hash.update(txIdHeader, sizeof(txIdHeader));
+    hash.update(txId, sizeof(txId));
+  }
+  hash.finalize(groupId, sizeof(groupId));
+
+  // 2. Rebuild each transaction with "grp", signing it in place inside the segment chain which will be the POST body
+  //    (each one takes exactly header + pass 1 length + "grp" field: small ones share a segment)
+  if (msgpackChainInit(&group, ALGORAND_MAX_TX_MSGPACK_SIZE, count))
+  {
+    return ALGOIOT_MESSAGEPACK_ERROR;
+  }
+  for (uint8_t i = 0; (i < count) && !iErr; i++)
+  {
+    iErr = useAccount(accountIndexes[i], txs[i]);
+    if (iErr)
+    {
+      break;
+    }
+    if ( msgpackChainOpenMsgPack(&group, BLANK_MSGPACK_HEADER + txLen[i] + grpFieldBytes + 1, &txPack) ||
+         m_engine.prepareTransactionMessagePack(&txPack, fv, fee, txs[i].amountMicroAlgos, txs[i].notes, txs[i].notesLen,
+                                                0, NULL, groupId) )
+    {
+      iErr = ALGOIOT_MESSAGEPACK_ERROR;
+    }
+    else if (m_engine.signMessagePackAddingPrefix(&txPack, signature))
+    {
+      iErr = ALGOIOT_SIGNATURE_ERROR;
+    }
+    else if ( m_engine.createSignedBinaryTransaction(&txPack, signature) || msgpackChainCloseMsgPack(&group, &txPack) )
+    {
+      iErr = ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
+    m_engine.m_signingKey = NULL;
+  }
+
+  // 3. Submit the whole group as one request, streamed from the segments
+  if (!iErr)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\nSubmitting group of %u transactions in %u segments\n", count, group.segmentCount);
+    #endif
+    iErr = (m_engine.submitTransaction(NULL, &group) == 200) ? ALGOIOT_NO_ERROR : ALGOIOT_TRANSACTION_ERROR;
+  }
+  msgpackChainFree(&group);
+
+  return iErr;
+}
+
+
+const char* AlgoKeyring::getTransactionID()
+{
+  return m_engine.getTransactionID();
+}
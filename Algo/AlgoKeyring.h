@@ -0,0 +1,106 @@
+// AlgoKeyring.h
+// header for AlgoIoT multi-account signer: one gateway, many device identities
+
+// requires AlgoIoT (included)
+
+// v20261018-1
+
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License governing permissions and limitations under the License.
+ * */
+
+// Accounts are kept as a contiguous array of entries:
+//   expanded Ed25519 key (64 bytes: secret scalar || prefix) || public key = address (32 bytes)
+// so signing skips the private key hashing, and an account costs ALGOKEYRING_ENTRY_BYTES.
+// All accounts share a single transaction engine: one workspace (HTTP client, algod endpoint pool,
+// transaction params cache, buffers). Not thread safe: submit from one task at a time
+
+#ifndef __ALGOKEYRING_H
+#define __ALGOKEYRING_H
+
+#include <stdint.h>
+#include "AlgoIoT.h"
+
+#define ALGOKEYRING_EXPANDED_KEY_BYTES 64
+#define ALGOKEYRING_ENTRY_BYTES (ALGOKEYRING_EXPANDED_KEY_BYTES + ALGORAND_ADDRESS_BYTES)
+#ifndef ALGOKEYRING_PARAMS_CACHE_MS
+  #define ALGOKEYRING_PARAMS_CACHE_MS 3000UL  // About one round
+#endif
+
+// Payment transaction to be submitted for a keyring account
+typedef struct
+{
+  const uint8_t* receiver;    // 32-byte address; NULL = the account itself
+  uint32_t amountMicroAlgos;
+  const char* notes;          // Complete note field (e.g. ARC-2 "<app>:j{...}"); may be NULL
+  uint16_t notesLen;          // Max ALGORAND_MAX_NOTES_SIZE
+} AlgoKeyringTx;
+
+
+class AlgoKeyring
+{
+  public:
+  // "maxAccounts" entries are allocated at once
+  // "workspace" (optional) may be shared with AlgoIoT instances (see AlgoIoTWorkspace); if it does not
+  // cache transaction params yet, they are cached for ALGOKEYRING_PARAMS_CACHE_MS
+  AlgoKeyring(const char* appName, const uint32_t maxAccounts, AlgoIoTWorkspace* workspace = NULL);
+
+  // Wipes key material
+  ~AlgoKeyring();
+
+  AlgoKeyring(const AlgoKeyring&) = delete;
+  AlgoKeyring& operator=(const AlgoKeyring&) = delete;
+
+  // Adds the account encoded by 25 BIP-39 words; optionally returns its index
+  // Return: error code (0 = OK)
+  int addAccount(const char* algoAccountWords, uint32_t* accountIndex = NULL);
+
+  // Adds the account of a 32-byte Ed25519 private key; optionally returns its index
+  // Return: error code (0 = OK)
+  int addAccountFromKey(const uint8_t privateKey[ALGORAND_KEY_BYTES], uint32_t* accountIndex = NULL);
+
+  uint32_t getAccountCount() const;
+
+  // Returns the 32-byte address (public key) of account "accountIndex", or NULL
+  const uint8_t* getAccountAddress(const uint32_t accountIndex) const;
+
+  // Same as the AlgoIoT methods; they apply to every account
+  int setAlgorandNetwork(const uint8_t networkType);
+  int setAPIToken(const char* token);
+  int addAlgodEndpoint(const char* url, const char* token = NULL);
+
+  // Signs with account "accountIndex" and submits a payment transaction
+  // Return: error code (0 = OK)
+  int submit(const uint32_t accountIndex, const AlgoKeyringTx& tx);
+
+  // Signs payments "txs[i]" with accounts "accountIndexes[i]" as one atomic group (all or none are confirmed),
+  // and submits them in a single request. "count" max ALGORAND_MAX_GROUP_SIZE
+  // Signed transactions are built in place in a heap segment chain streamed as the POST body,
+  // so the group is not limited by the transaction buffer size
+  // Return: error code (0 = OK)
+  int submitGroup(const uint32_t* accountIndexes, const AlgoKeyringTx* txs, const uint8_t count);
+
+  // ID of the last transaction successfully submitted (the first one of a group)
+  const char* getTransactionID();
+
+  private:
+  // Sets the engine up to sign "tx" as account "accountIndex"
+  // Return: error code (0 = OK)
+  int useAccount(const uint32_t accountIndex, const AlgoKeyringTx& tx);
+
+  AlgoIoT m_engine;
+  uint8_t (*m_keys)[ALGOKEYRING_ENTRY_BYTES] = NULL;
+  uint32_t m_maxAccounts = 0;
+  uint32_t m_accountCount = 0;
+};
+
+#endif
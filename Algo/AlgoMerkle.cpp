@@ -0,0 +1,191 @@
+// AlgoMerkle.cpp
+// Merkle tree helpers for AlgoIoT off-chain attestations
+// v20261018-1
+
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <Crypto.h>
+#include <Ed25519.h>
+#include <SHA512_256.h>
+#include "AlgoMerkle.h"
+
+
+void AlgoMerkle::hashLeaf(uint8_t leaf[MERKLE_HASH_BYTES],
+                          const uint8_t signature[MERKLE_SIG_BYTES],
+                          const uint8_t* reading, const uint16_t readingLen)
+{
+  SHA512_256 hash;
+  const uint8_t prefix = MERKLE_LEAF_PREFIX;
+
+  hash.update(&prefix, 1);
+  hash.update(signature, MERKLE_SIG_BYTES);
+  hash.update(reading, readingLen);
+  hash.finalize(leaf, MERKLE_HASH_BYTES);
+}
+
+
+void AlgoMerkle::hashNode(uint8_t parent[MERKLE_HASH_BYTES],
+                          const uint8_t left[MERKLE_HASH_BYTES],
+                          const uint8_t right[MERKLE_HASH_BYTES])
+{
+  SHA512_256 hash;
+  const uint8_t prefix = MERKLE_NODE_PREFIX;
+
+  hash.update(&prefix, 1);
+  hash.update(left, MERKLE_HASH_BYTES);
+  hash.update(right, MERKLE_HASH_BYTES);
+  hash.finalize(parent, MERKLE_HASH_BYTES);
+}
+
+
+void AlgoMerkle::computeRoot(uint8_t root[MERKLE_HASH_BYTES],
+                             const uint8_t (*leaves)[MERKLE_HASH_BYTES], const uint32_t count)
+{
+  // Binary-counter reduction: we keep at most one pending subtree per height,
+  // merging whenever two subtrees of the same height meet. Pairing left to right
+  // and promoting lone nodes is then the same as folding what is left from the right
+  uint8_t stack[MERKLE_MAX_DEPTH + 1][MERKLE_HASH_BYTES];
+  uint8_t heights[MERKLE_MAX_DEPTH + 1];
+  uint8_t top = 0;
+
+  if ((leaves == NULL) || (count == 0))
+  {
+    memset(root, 0, MERKLE_HASH_BYTES);
+    return;
+  }
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    memcpy(stack[top], leaves[i], MERKLE_HASH_BYTES);
+    heights[top++] = 0;
+    while ((top > 1) && (heights[top - 1] == heights[top - 2]))
+    {
+      hashNode(stack[top - 2], stack[top - 2], stack[top - 1]);
+      heights[top - 2]++;
+      top--;
+    }
+  }
+  while (top > 1)
+  {
+    hashNode(stack[top - 2], stack[top - 2], stack[top - 1]);
+    top--;
+  }
+
+  memcpy(root, stack[0], MERKLE_HASH_BYTES);
+}
+
+
+int AlgoMerkle::buildProof(uint8_t (*proof)[MERKLE_HASH_BYTES],
+                           const uint8_t (*leaves)[MERKLE_HASH_BYTES], const uint32_t count,
+                           const uint32_t index)
+{
+  uint32_t nodes = count;
+  uint8_t level = 0;
+  int proofLen = 0;
+
+  if ((proof == NULL) || (leaves == NULL) || (index >= count))
+    return -1;
+
+  while (nodes > 1)
+  {
+    uint32_t sibling = (index >> level) ^ 1;
+    if (sibling < nodes)
+    { // Sibling subtree covers leaves [sibling * 2^level, min((sibling + 1) * 2^level, count))
+      uint32_t start = sibling << level;
+      uint32_t span = count - start;
+      if (span > ((uint32_t)1 << level))
+        span = (uint32_t)1 << level;
+      computeRoot(proof[proofLen++], leaves + start, span);
+    }
+    // else: we are the lone last node at this level, promoted as-is
+    nodes = (nodes + 1) >> 1;
+    level++;
+  }
+
+  return proofLen;
+}
+
+
+bool AlgoMerkle::verifyProof(const uint8_t leaf[MERKLE_HASH_BYTES],
+                             const uint32_t index, const uint32_t count,
+                             const uint8_t (*proof)[MERKLE_HASH_BYTES], const uint8_t proofLen,
+                             const uint8_t root[MERKLE_HASH_BYTES])
+{
+  uint8_t current[MERKLE_HASH_BYTES];
+  uint32_t nodes = count;
+  uint8_t level = 0;
+  uint8_t used = 0;
+
+  if ((leaf == NULL) || (root == NULL) || (index >= count))
+    return false;
+  if ((proof == NULL) && (proofLen > 0))
+    return false;
+
+  memcpy(current, leaf, MERKLE_HASH_BYTES);
+  while (nodes > 1)
+  {
+    uint32_t position = index >> level;
+    if ((position ^ 1) < nodes)
+    {
+      if (used >= proofLen)
+        return false;
+      if (position & 1)
+        hashNode(current, proof[used], current);
+      else
+        hashNode(current, current, proof[used]);
+      used++;
+    }
+    nodes = (nodes + 1) >> 1;
+    level++;
+  }
+
+  if (used != proofLen)
+    return false;
+
+  return secure_compare(current, root, MERKLE_HASH_BYTES);
+}
+
+
+bool AlgoMerkle::verifyReading(const uint8_t* reading, const uint16_t readingLen,
+                               const uint8_t signature[MERKLE_SIG_BYTES],
+                               const uint8_t publicKey[MERKLE_KEY_BYTES],
+                               const uint32_t index, const uint32_t count,
+                               const uint8_t (*proof)[MERKLE_HASH_BYTES], const uint8_t proofLen,
+                               const uint8_t root[MERKLE_HASH_BYTES])
+{
+  uint8_t leaf[MERKLE_HASH_BYTES];
+  uint8_t* signedBytes = NULL;
+  bool sigOK = false;
+
+  if ((reading == NULL) || (signature == NULL) || (publicKey == NULL))
+    return false;
+
+  // Ed25519 wants the signed message contiguous: "MX" || reading
+  signedBytes = (uint8_t*)malloc(readingLen + MERKLE_SIGN_PREFIX_BYTES);
+  if (!signedBytes)
+    return false;
+  memcpy(signedBytes, MERKLE_SIGN_PREFIX, MERKLE_SIGN_PREFIX_BYTES);
+  memcpy(signedBytes + MERKLE_SIGN_PREFIX_BYTES, reading, readingLen);
+  sigOK = Ed25519::verify(signature, publicKey, signedBytes, readingLen + MERKLE_SIGN_PREFIX_BYTES);
+  free(signedBytes);
+  if (!sigOK)
+    return false;
+
+  hashLeaf(leaf, signature, reading, readingLen);
+
+  return verifyProof(leaf, index, count, proof, proofLen, root);
+}
@@ -0,0 +1,88 @@
+// AlgoMerkle.h
+// header for AlgoIoT attestation Merkle tree helpers
+
+// requires Crypto library (SHA512_256, Ed25519)
+
+// v20261018-1
+
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License governing permissions and limitations under the License.
+ * */
+
+// Tree layout (SHA-512/256 throughout, RFC 6962-style domain separation):
+//   leaf = H(0x00 || signature(64) || reading)
+//   node = H(0x01 || left(32) || right(32))
+// Levels are paired left to right; a lone last node is promoted unchanged
+// (never duplicated), so node j at level l covers leaves [j*2^l, min((j+1)*2^l, n)).
+// A proof is the list of sibling hashes from the leaf up, skipping promoted levels;
+// verifying it needs the leaf index and the leaf count of the anchored batch.
+//
+// "signature" is the Ed25519 signature of "MX" || reading made with the device key,
+// i.e. the same thing algosdk signBytes()/verifyBytes() produce and check
+
+#ifndef __ALGOMERKLE_H
+#define __ALGOMERKLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MERKLE_HASH_BYTES 32
+#define MERKLE_SIG_BYTES 64
+#define MERKLE_KEY_BYTES 32
+#define MERKLE_LEAF_PREFIX 0x00
+#define MERKLE_NODE_PREFIX 0x01
+#define MERKLE_SIGN_PREFIX "MX"
+#define MERKLE_SIGN_PREFIX_BYTES 2
+#define MERKLE_MAX_DEPTH 32  // Enough for any uint32_t leaf count
+
+class AlgoMerkle
+{
+  public:
+  // Computes the leaf hash of a signed reading
+  static void hashLeaf(uint8_t leaf[MERKLE_HASH_BYTES],
+                       const uint8_t signature[MERKLE_SIG_BYTES],
+                       const uint8_t* reading, const uint16_t readingLen);
+
+  // Computes the parent hash of two sibling nodes
+  static void hashNode(uint8_t parent[MERKLE_HASH_BYTES],
+                       const uint8_t left[MERKLE_HASH_BYTES],
+                       const uint8_t right[MERKLE_HASH_BYTES]);
+
+  // Computes the root over "count" consecutive leaf hashes. Uses O(log n) stack, no heap
+  // Root of an empty tree is all zeroes
+  static void computeRoot(uint8_t root[MERKLE_HASH_BYTES],
+                          const uint8_t (*leaves)[MERKLE_HASH_BYTES], const uint32_t count);
+
+  // Fills "proof" with the sibling hashes of leaf "index", from the bottom up
+  // "proof" must hold MERKLE_MAX_DEPTH entries (or at least ceil(log2(count)))
+  // Returns number of proof entries, or -1 if index is out of range
+  static int buildProof(uint8_t (*proof)[MERKLE_HASH_BYTES],
+                        const uint8_t (*leaves)[MERKLE_HASH_BYTES], const uint32_t count,
+                        const uint32_t index);
+
+  // Checks that "leaf" sits at position "index" of a "count"-leaf tree with root "root"
+  static bool verifyProof(const uint8_t leaf[MERKLE_HASH_BYTES],
+                          const uint32_t index, const uint32_t count,
+                          const uint8_t (*proof)[MERKLE_HASH_BYTES], const uint8_t proofLen,
+                          const uint8_t root[MERKLE_HASH_BYTES]);
+
+  // Full check of an off-chain reading against an anchored root:
+  // device signature on "MX" || reading, then inclusion of the resulting leaf
+  static bool verifyReading(const uint8_t* reading, const uint16_t readingLen,
+                            const uint8_t signature[MERKLE_SIG_BYTES],
+                            const uint8_t publicKey[MERKLE_KEY_BYTES],
+                            const uint32_t index, const uint32_t count,
+                            const uint8_t (*proof)[MERKLE_HASH_BYTES], const uint8_t proofLen,
+                            const uint8_t root[MERKLE_HASH_BYTES]);
+};
+
+#endif
@@ -25,6 +25,26 @@
 #include "utility/LimbUtil.h"
 #include <string.h>
 
+// On x86-64 hosts with 64-bit limbs, mul() and mul_P() use MULX, ADCX and
+// ADOX to run two carry chains side by side when the CPU has BMI2 and ADX.
+// The instructions are in inline assembly and only executed after checking
+// the CPU, so no special compiler flags are needed.  Define BIGNUMBER_MULX
+// to 0 to always use the portable loop.  Below MULX_MIN_LIMBS limbs in x
+// the setup costs more than the second carry chain saves, so the portable
+// loop is used there too (see extras/host/BigNumberMulBench.cpp).
+#if !defined(BIGNUMBER_MULX)
+#if BIGNUMBER_LIMB_64BIT && defined(__x86_64__) && defined(__GNUC__)
+#define BIGNUMBER_MULX 1
+#else
+#define BIGNUMBER_MULX 0
+#endif
+#elif BIGNUMBER_MULX && \
+        !(BIGNUMBER_LIMB_64BIT && defined(__x86_64__) && defined(__GNUC__))
+#error "BIGNUMBER_MULX needs 64-bit limbs on x86-64 with GCC or Clang"
+#endif
+
+#define MULX_MIN_LIMBS 6
+
 /**
  * \class BigNumberUtil BigNumberUtil.h <BigNumberUtil.h>
  * \brief Utilities to assist with implementing big number arithmetic.
@@ -531,20 +551,11 @@ limb_t BigNumberUtil::sub(limb_t *result, const limb_t *x,
     return ((limb_t)(borrow >> LIMB_BITS)) & 0x01;
 }
 
-/**
- * \brief Multiplies two big numbers.
- *
- * \param result The result of the multiplication.  The array must be
- * \a xcount + \a ycount limbs in size.
- * \param x Points to the first value to multiply.
- * \param xcount The number of limbs in \a x.
- * \param y Points to the second value to multiply.
- * \param ycount The number of limbs in \a y.
- *
- * \sa mul_P()
- */
-void BigNumberUtil::mul(limb_t *result, const limb_t *x, size_t xcount,
-                        const limb_t *y, size_t ycount)
+/** @cond bignumber_mul */
+
+// Schoolbook multiplication, which is the portable form of mul().
+static void mulSchoolbook(limb_t *result, const limb_t *x, size_t xcount,
+                          const limb_t *y, size_t ycount)
 {
     size_t i, j;
     dlimb_t carry;
@@ -580,6 +591,74 @@ void BigNumberUtil::mul(limb_t *result, const limb_t *x, size_t xcount,
     }
 }
 
+#if BIGNUMBER_MULX
+
+// Adds x * word to the xcount limbs at result and returns the high limb.
+// MULX leaves the flags alone, so the low halves are added with ADCX on
+// the carry flag while the high halves of the previous products are added
+// with ADOX on the overflow flag.  LEA and JRCXZ keep both chains intact.
+static limb_t mulxAddRow(limb_t *result, const limb_t *x, size_t xcount,
+                         limb_t word)
+{
+    limb_t carry, low, high;
+    __asm__ __volatile__ (
+        "xorl %k[carry], %k[carry]\n\t"
+        "1:\n\t"
+        "mulxq (%[x]), %[low], %[high]\n\t"
+        "adcxq (%[result]), %[low]\n\t"
+        "adoxq %[carry], %[low]\n\t"
+        "movq %[low], (%[result])\n\t"
+        "movq %[high], %[carry]\n\t"
+        "leaq 8(%[x]), %[x]\n\t"
+        "leaq 8(%[result]), %[result]\n\t"
+        "leaq -1(%[count]), %[count]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[low]\n\t"
+        "adcxq %[low], %[carry]\n\t"
+        "adoxq %[low], %[carry]\n\t"
+        : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high),
+          [x] "+r"(x), [result] "+r"(result), [count] "+c"(xcount)
+        : "d"(word)
+        : "cc", "memory");
+    return carry;
+}
+
+#endif // BIGNUMBER_MULX
+
+/** @endcond */
+
+/**
+ * \brief Multiplies two big numbers.
+ *
+ * \param result The result of the multiplication.  The array must be
+ * \a xcount + \a ycount limbs in size.
+ * \param x Points to the first value to multiply.
+ * \param xcount The number of limbs in \a x.
+ * \param y Points to the second value to multiply.
+ * \param ycount The number of limbs in \a y.
+ *
+ * The \a result array cannot be the same as \a x or \a y.  The time
+ * taken depends only upon \a xcount and \a ycount.
+ *
+ * \sa mul_P()
+ */
+void BigNumberUtil::mul(limb_t *result, const limb_t *x, size_t xcount,
+                        const limb_t *y, size_t ycount)
+{
+#if BIGNUMBER_MULX
+    if (xcount >= MULX_MIN_LIMBS && __builtin_cpu_supports("bmi2") &&
+            __builtin_cpu_supports("adx")) {
+        memset(result, 0, xcount * sizeof(limb_t));
+        for (size_t i = 0; i < ycount; ++i)
+            result[i + xcount] = mulxAddRow(result + i, x, xcount, y[i]);
+        return;
+    }
+#endif
+    mulSchoolbook(result, x, xcount, y, ycount);
+}
+
 /**
  * \brief Reduces \a x modulo \a y using subtraction.
  *
@@ -680,6 +759,10 @@ limb_t BigNumberUtil::sub_P(limb_t *result, const limb_t *x,
 void BigNumberUtil::mul_P(limb_t *result, const limb_t *x, size_t xcount,
                           const limb_t *y, size_t ycount)
 {
+#if BIGNUMBER_MULX
+    // Program memory is ordinary memory on x86-64.
+    mul(result, x, xcount, y, ycount);
+#else
     size_t i, j;
     dlimb_t carry;
     limb_t word;
@@ -712,6 +795,7 @@ void BigNumberUtil::mul_P(limb_t *result, const limb_t *x, size_t xcount,
         }
         *rr = (limb_t)carry;
     }
+#endif
 }
 
 /**
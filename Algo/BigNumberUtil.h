@@ -101,6 +101,25 @@ public:
 
     static limb_t isZero(const limb_t *x, size_t size);
 
+    // Arithmetic modulo a fixed odd modulus, defined by the internal
+    // header utility/BigNumberModUtil.h for the modules that use them.
+    template <typename Modulus>
+    static void mulMont(limb_t *result, const limb_t *x, const limb_t *y);
+    template <typename Modulus>
+    static void squareMont(limb_t *result, const limb_t *x);
+    template <typename Modulus>
+    static void reduceMont(limb_t *result, limb_t *x);
+    template <typename Modulus>
+    static void powMont(limb_t *result, const limb_t *x,
+                        const limb_t *exponent, size_t bits);
+
+    template <typename Modulus>
+    static void reduceMod(limb_t *result, limb_t *x);
+    template <typename Modulus>
+    static void mulMod(limb_t *result, const limb_t *x, const limb_t *y);
+    template <typename Modulus>
+    static void recipMod(limb_t *result, const limb_t *x);
+
 private:
     // Constructor and destructor are private - cannot instantiate this class.
     BigNumberUtil() {}
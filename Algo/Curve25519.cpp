@@ -58,6 +58,47 @@
 #define strict_clean(x)     do { ; } while (0)
 #endif
 
+#if CURVE25519_RADIX51
+// Mask for the 51 bits of a limb in the radix-2^51 representation, and the
+// limbs of 4 * (2^255 - 19) which sub() adds so that no limb goes negative.
+#define LIMB51_MASK         ((((limb_t)1) << 51) - 1)
+#define LIMB51_4P_LOW       ((((limb_t)1) << 53) - 76)
+#define LIMB51_4P_HIGH      ((((limb_t)1) << 53) - 4)
+#endif
+
+// Define CURVE25519_AVX2 to 1 on x86-64 hosts to have mul4() and square4()
+// evaluate four field multiplications side by side in the 64-bit lanes of
+// AVX2 registers.  The kernel is built for AVX2 with a function attribute
+// and is only called when the CPU has it, so no special compiler flags are
+// needed.  It is off by default: on the hosts measured it only breaks even
+// with the scalar radix-2^51 mul().  When it is off, mul4() and square4()
+// call mul() and square() four times.  extras/host/Curve25519FieldTest.cpp
+// checks the kernel against the scalar code.
+#if !defined(CURVE25519_AVX2)
+#define CURVE25519_AVX2 0
+#elif CURVE25519_AVX2 && \
+        !(CURVE25519_RADIX51 && defined(__x86_64__) && defined(__GNUC__))
+#error "CURVE25519_AVX2 needs CURVE25519_RADIX51 on x86-64 with GCC or Clang"
+#endif
+
+// Maximum number of values that evalBatch() converts to affine form with a
+// single field inversion.  The ladder outputs are kept on the stack: three
+// field elements per value.
+#if !defined(CURVE25519_BATCH_SIZE)
+#if defined(__AVR__)
+#define CURVE25519_BATCH_SIZE   1
+#else
+#define CURVE25519_BATCH_SIZE   8
+#endif
+#endif
+
+#if CURVE25519_AVX2
+#include <immintrin.h>
+#define CURVE25519_AVX2_TARGET  __attribute__((target("avx2")))
+#define CURVE25519_AVX2_INLINE  \
+    inline __attribute__((target("avx2"), always_inline))
+#endif
+
 /**
  * \brief Evaluates the raw Curve25519 function.
  *
@@ -79,32 +120,17 @@
  */
 bool Curve25519::eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[32])
 {
-    limb_t x_1[NUM_LIMBS_256BIT];
-    limb_t x_2[NUM_LIMBS_256BIT];
-    limb_t x_3[NUM_LIMBS_256BIT];
-    limb_t z_2[NUM_LIMBS_256BIT];
-    limb_t z_3[NUM_LIMBS_256BIT];
-    limb_t A[NUM_LIMBS_256BIT];
-    limb_t B[NUM_LIMBS_256BIT];
-    limb_t C[NUM_LIMBS_256BIT];
-    limb_t D[NUM_LIMBS_256BIT];
-    limb_t E[NUM_LIMBS_256BIT];
-    limb_t AA[NUM_LIMBS_256BIT];
-    limb_t BB[NUM_LIMBS_256BIT];
-    limb_t DA[NUM_LIMBS_256BIT];
-    limb_t CB[NUM_LIMBS_256BIT];
-    uint8_t mask;
-    uint8_t sposn;
-    uint8_t select;
-    uint8_t swap;
+    limb_t x_1[NUM_LIMBS_FIELD25519];
+    limb_t x_2[NUM_LIMBS_FIELD25519];
+    limb_t z_2[NUM_LIMBS_FIELD25519];
+    limb_t z_3[NUM_LIMBS_FIELD25519];
     bool retval;
 
     // Unpack the "x" argument into the limb representation
     // which also masks off the high bit.  NULL means 9.
     if (x) {
         // x1 = x
-        BigNumberUtil::unpackLE(x_1, NUM_LIMBS_256BIT, x, 32);
-        x_1[NUM_LIMBS_256BIT - 1] &= ((((limb_t)1) << (LIMB_BITS - 1)) - 1);
+        unpack(x_1, x);
     } else {
         memset(x_1, 0, sizeof(x_1));    // x_1 = 9
         x_1[0] = 9;
@@ -119,12 +145,165 @@ bool Curve25519::eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[3
     // report the failure at the end.
     retval = (bool)(reduceQuick(x_1) & 0x01);
 
-    // Initialize the other temporary variables.
-    memset(x_2, 0, sizeof(x_2));        // x_2 = 1
+    // Run the Montgomery ladder to compute (x_2 : z_2) = s * x.
+    ladder(x_2, z_2, s, x_1);
+
+    // Compute x_2 * (z_2 ^ (p - 2)) where p = 2^255 - 19.
+    recip(z_3, z_2);
+    mul(x_2, x_2, z_3);
+
+    // Pack the result into the return array.
+    pack(result, x_2);
+
+    // Clean up and exit.
+    clean(x_1);
+    clean(x_2);
+    clean(z_2);
+    clean(z_3);
+    return retval;
+}
+
+/**
+ * \brief Evaluates the raw Curve25519 function for many values at once.
+ *
+ * \param results Points to the \a count results.  Each result may be
+ * the same array as the corresponding \a x value.
+ * \param s Points to the \a count S parameters, which may all be the
+ * same array.
+ * \param x Points to the \a count X(Q) parameters.
+ * \param count The number of values to evaluate.
+ * \param valid Points to \a count flags that are set to false if the
+ * corresponding \a x is weak or not a member of the field, or NULL.
+ *
+ * \return Returns true if every value passed the checks in \a valid.
+ *
+ * Every result is the same as eval() would return, but the conversion
+ * of the ladder outputs to affine form shares one field inversion between
+ * up to CURVE25519_BATCH_SIZE values with Montgomery's simultaneous
+ * inversion trick.  Each value is checked as in dh2(): \a x must be a
+ * member of the field, and neither \a x nor the result may be weak for
+ * contributory behaviour.  The checks are constant-time and do not stop
+ * the other values from being evaluated.
+ *
+ * \sa eval(), dh2()
+ */
+bool Curve25519::evalBatch(uint8_t *const *results, const uint8_t *const *s,
+                           const uint8_t *const *x, size_t count, bool *valid)
+{
+    limb_t x_2[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    limb_t z_2[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    limb_t prod[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    limb_t x_1[NUM_LIMBS_FIELD25519];
+    limb_t inv[NUM_LIMBS_FIELD25519];
+    limb_t zero[NUM_LIMBS_FIELD25519];
+    limb_t one[NUM_LIMBS_FIELD25519];
+    uint8_t weak[CURVE25519_BATCH_SIZE];
+    uint8_t allWeak = 0;
+    limb_t select;
+    size_t chunk, posn;
+
+    memset(zero, 0, sizeof(zero));
+    memset(one, 0, sizeof(one));
+    one[0] = 1;
+
+    while (count > 0) {
+        chunk = (count < CURVE25519_BATCH_SIZE) ? count : CURVE25519_BATCH_SIZE;
+
+        // Run the ladders and accumulate the products of the z values.
+        for (posn = 0; posn < chunk; ++posn) {
+            unpack(x_1, x[posn]);
+            weak[posn] = isWeakPoint(x[posn]);
+            weak[posn] |= (reduceQuick(x_1) & 0x01) ^ 0x01;
+            ladder(x_2[posn], z_2[posn], s[posn], x_1);
+
+            // A zero z, for a point of small order, would zero every
+            // result in the chunk.  Replace it with 1 and zero x instead,
+            // which gives the same result as eval().
+            select = isZero(z_2[posn]);
+            cmove(select, z_2[posn], one);
+            cmove(select, x_2[posn], zero);
+
+            if (posn == 0)
+                memcpy(prod[0], z_2[0], sizeof(prod[0]));
+            else
+                mul(prod[posn], prod[posn - 1], z_2[posn]);
+        }
+
+        // Invert the product of all z values and then peel off the
+        // inverse of each z, from the last to the first.
+        recip(inv, prod[chunk - 1]);
+        for (posn = chunk; posn > 0; --posn) {
+            if (posn > 1) {
+                mul(prod[posn - 1], inv, prod[posn - 2]);
+                mul(inv, inv, z_2[posn - 1]);
+            } else {
+                memcpy(prod[0], inv, sizeof(inv));
+            }
+            mul(x_2[posn - 1], x_2[posn - 1], prod[posn - 1]);
+            pack(results[posn - 1], x_2[posn - 1]);
+            weak[posn - 1] |= isWeakPoint(results[posn - 1]);
+        }
+
+        // Report the checks on each value.
+        for (posn = 0; posn < chunk; ++posn) {
+            if (valid)
+                valid[posn] = (bool)((weak[posn] ^ 0x01) & 0x01);
+            allWeak |= weak[posn];
+        }
+
+        results += chunk;
+        s += chunk;
+        x += chunk;
+        if (valid)
+            valid += chunk;
+        count -= chunk;
+    }
+
+    // Clean up and exit.
+    clean(x_2);
+    clean(z_2);
+    clean(prod);
+    clean(x_1);
+    clean(inv);
+    return (bool)((allWeak ^ 0x01) & 0x01);
+}
+
+/**
+ * \brief Runs the Montgomery ladder to multiply a value by a point.
+ *
+ * \param x_2 The x co-ordinate of the result in projective form.
+ * \param z_2 The z co-ordinate of the result in projective form.
+ * \param s The S parameter to the curve function.  The high bit is ignored.
+ * \param x_1 The X(Q) parameter, which must be reduced modulo 2^255 - 19.
+ *
+ * The result is x_2 / z_2, where z_2 is zero if \a x_1 has small order.
+ * The evaluation is constant-time.
+ */
+void Curve25519::ladder(limb_t *x_2, limb_t *z_2, const uint8_t s[32],
+                        const limb_t *x_1)
+{
+    limb_t x_3[NUM_LIMBS_FIELD25519];
+    limb_t z_3[NUM_LIMBS_FIELD25519];
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+    limb_t E[NUM_LIMBS_FIELD25519];
+    limb_t AA[NUM_LIMBS_FIELD25519];
+    limb_t BB[NUM_LIMBS_FIELD25519];
+    limb_t DA[NUM_LIMBS_FIELD25519];
+    limb_t CB[NUM_LIMBS_FIELD25519];
+    uint8_t mask;
+    uint8_t sposn;
+    uint8_t select;
+    uint8_t swap;
+
+    // Initialize the temporary variables.
+    memset(x_2, 0, sizeof(x_3));        // x_2 = 1
     x_2[0] = 1;
-    memset(z_2, 0, sizeof(z_2));        // z_2 = 0
-    memcpy(x_3, x_1, sizeof(x_1));      // x_3 = x
-    memcpy(z_3, x_2, sizeof(x_2));      // z_3 = 1
+    memset(z_2, 0, sizeof(z_3));        // z_2 = 0
+    memcpy(x_3, x_1, sizeof(x_3));      // x_3 = x
+    memcpy(z_3, x_2, sizeof(z_3));      // z_3 = 1
 
     // Iterate over all 255 bits of "s" from the highest to the lowest.
     // We ignore the high bit of the 256-bit representation of "s".
@@ -174,18 +353,8 @@ bool Curve25519::eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[3
     cswap(swap, x_2, x_3);
     cswap(swap, z_2, z_3);
 
-    // Compute x_2 * (z_2 ^ (p - 2)) where p = 2^255 - 19.
-    recip(z_3, z_2);
-    mul(x_2, x_2, z_3);
-
-    // Pack the result into the return array.
-    BigNumberUtil::packLE(result, 32, x_2, NUM_LIMBS_256BIT);
-
-    // Clean up and exit.
-    clean(x_1);
-    clean(x_2);
+    // Clean up.
     clean(x_3);
-    clean(z_2);
     clean(z_3);
     clean(A);
     clean(B);
@@ -196,7 +365,6 @@ bool Curve25519::eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[3
     clean(BB);
     clean(DA);
     clean(CB);
-    return retval;
 }
 
 /**
@@ -642,10 +810,42 @@ void Curve25519::reduce(limb_t *result, limb_t *x, uint8_t size)
  * This function is intended for reducing the result of additions where
  * the caller knows that \a x is within the described range.  A single
  * trial subtraction is all that is needed to reduce the number.
+ *
+ * With CURVE25519_RADIX51, \a x is a field element of 5 limbs, each less
+ * than 2^54, and it is reduced fully to its canonical value.
  */
 limb_t Curve25519::reduceQuick(limb_t *x)
 {
-#if !defined(CURVE25519_ASM_AVR)
+#if CURVE25519_RADIX51
+    limb_t carry;
+    uint8_t posn;
+
+    // Propagate the carries so that every limb fits in 51 bits, apart
+    // from a small excess in the lowest limb.  The value of "x" is then
+    // less than 2 * (2^255 - 19).
+    for (posn = 0; posn < 4; ++posn) {
+        x[posn + 1] += x[posn] >> 51;
+        x[posn] &= LIMB51_MASK;
+    }
+    carry = x[4] >> 51;
+    x[4] &= LIMB51_MASK;
+    x[0] += carry * 19U;
+
+    // The carry out of x + 19 is 1 if x >= 2^255 - 19.  Subtract that
+    // many copies of 2^255 - 19 by adding 19 and dropping bit 255.
+    carry = (x[0] + 19U) >> 51;
+    for (posn = 1; posn < 5; ++posn)
+        carry = (x[posn] + carry) >> 51;
+    x[0] += carry * 19U;
+    for (posn = 0; posn < 4; ++posn) {
+        x[posn + 1] += x[posn] >> 51;
+        x[posn] &= LIMB51_MASK;
+    }
+    x[4] &= LIMB51_MASK;
+
+    // Return a zero value if we actually subtracted (2^255 - 19) from "x".
+    return carry - 1;
+#elif !defined(CURVE25519_ASM_AVR)
     limb_t temp[NUM_LIMBS_256BIT];
     dlimb_t carry;
     uint8_t posn;
@@ -921,43 +1121,494 @@ void Curve25519::mulNoReduce(limb_t *result, const limb_t *x, const limb_t *y)
 /**
  * \brief Multiplies two values and then reduces the result modulo 2^255 - 19.
  *
- * \param result The result, which must be NUM_LIMBS_256BIT limbs in size
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
  * and can be the same array as \a x or \a y.
- * \param x The first value to multiply, which must be NUM_LIMBS_256BIT limbs
- * in size and less than 2^255 - 19.
- * \param y The second value to multiply, which must be NUM_LIMBS_256BIT limbs
- * in size and less than 2^255 - 19.  This can be the same array as \a x.
+ * \param x The first value to multiply, which must be NUM_LIMBS_FIELD25519
+ * limbs in size and less than 2^255 - 19.
+ * \param y The second value to multiply, which must be NUM_LIMBS_FIELD25519
+ * limbs in size and less than 2^255 - 19.  This can be the same array as \a x.
+ *
+ * With CURVE25519_RADIX51, the limbs of \a x and \a y must be less than
+ * 2^54, which holds for sums of up to four results of mul() or sub().
+ * The limbs of the result are less than 2^52 but it is not fully reduced.
  */
 void Curve25519::mul(limb_t *result, const limb_t *x, const limb_t *y)
 {
+#if CURVE25519_RADIX51
+    dlimb_t t0, t1, t2, t3, t4;
+    limb_t y1_19 = y[1] * 19U;
+    limb_t y2_19 = y[2] * 19U;
+    limb_t y3_19 = y[3] * 19U;
+    limb_t y4_19 = y[4] * 19U;
+
+    // Schoolbook multiplication, folding the products above 2^255 back
+    // in multiplied by 19.  The five columns are independent sums of
+    // 128-bit products with no carries between them.
+    t0 = ((dlimb_t)x[0]) * y[0] + ((dlimb_t)x[1]) * y4_19 +
+         ((dlimb_t)x[2]) * y3_19 + ((dlimb_t)x[3]) * y2_19 +
+         ((dlimb_t)x[4]) * y1_19;
+    t1 = ((dlimb_t)x[0]) * y[1] + ((dlimb_t)x[1]) * y[0] +
+         ((dlimb_t)x[2]) * y4_19 + ((dlimb_t)x[3]) * y3_19 +
+         ((dlimb_t)x[4]) * y2_19;
+    t2 = ((dlimb_t)x[0]) * y[2] + ((dlimb_t)x[1]) * y[1] +
+         ((dlimb_t)x[2]) * y[0] + ((dlimb_t)x[3]) * y4_19 +
+         ((dlimb_t)x[4]) * y3_19;
+    t3 = ((dlimb_t)x[0]) * y[3] + ((dlimb_t)x[1]) * y[2] +
+         ((dlimb_t)x[2]) * y[1] + ((dlimb_t)x[3]) * y[0] +
+         ((dlimb_t)x[4]) * y4_19;
+    t4 = ((dlimb_t)x[0]) * y[4] + ((dlimb_t)x[1]) * y[3] +
+         ((dlimb_t)x[2]) * y[2] + ((dlimb_t)x[3]) * y[1] +
+         ((dlimb_t)x[4]) * y[0];
+
+    // Carry once through the columns and fold the top carry into limb 0.
+    t1 += (limb_t)(t0 >> 51);
+    result[0] = ((limb_t)t0) & LIMB51_MASK;
+    t2 += (limb_t)(t1 >> 51);
+    result[1] = ((limb_t)t1) & LIMB51_MASK;
+    t3 += (limb_t)(t2 >> 51);
+    result[2] = ((limb_t)t2) & LIMB51_MASK;
+    t4 += (limb_t)(t3 >> 51);
+    result[3] = ((limb_t)t3) & LIMB51_MASK;
+    t0 = ((dlimb_t)((limb_t)(t4 >> 51))) * 19U + result[0];
+    result[4] = ((limb_t)t4) & LIMB51_MASK;
+    result[0] = ((limb_t)t0) & LIMB51_MASK;
+    result[1] += (limb_t)(t0 >> 51);
+#else
     limb_t temp[NUM_LIMBS_512BIT];
     mulNoReduce(temp, x, y);
     reduce(result, temp, NUM_LIMBS_256BIT);
     strict_clean(temp);
+#endif
     crypto_feed_watchdog();
 }
 
 /**
- * \fn void Curve25519::square(limb_t *result, const limb_t *x)
  * \brief Squares a value and then reduces it modulo 2^255 - 19.
  *
- * \param result The result, which must be NUM_LIMBS_256BIT limbs in size and
- * can be the same array as \a x.
- * \param x The value to square, which must be NUM_LIMBS_256BIT limbs in size
- * and less than 2^255 - 19.
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to square, which must be NUM_LIMBS_FIELD25519 limbs in
+ * size and less than 2^255 - 19.
+ *
+ * Each cross product x[i] * x[j] is computed once and doubled, which
+ * saves almost half of the limb multiplications of mul().  The limits
+ * on \a x for CURVE25519_RADIX51 are the same as for mul().
+ *
+ * \sa squareN()
+ */
+void Curve25519::square(limb_t *result, const limb_t *x)
+{
+#if CURVE25519_RADIX51
+    squareN(result, x, 1);
+#elif !defined(CURVE25519_ASM_AVR)
+    limb_t temp[NUM_LIMBS_512BIT];
+    dlimb_t carry;
+    limb_t word, top;
+    uint8_t i, j;
+
+    // Sum the cross products x[i] * x[j] with i < j.
+    memset(temp, 0, sizeof(temp));
+    for (i = 0; i < (NUM_LIMBS_256BIT - 1); ++i) {
+        carry = 0;
+        word = x[i];
+        for (j = i + 1; j < NUM_LIMBS_256BIT; ++j) {
+            carry += ((dlimb_t)(x[j])) * word;
+            carry += temp[i + j];
+            temp[i + j] = (limb_t)carry;
+            carry >>= LIMB_BITS;
+        }
+        temp[i + NUM_LIMBS_256BIT] = (limb_t)carry;
+    }
+
+    // Double the cross products, as each one appears twice in the square.
+    top = 0;
+    for (i = 0; i < NUM_LIMBS_512BIT; ++i) {
+        word = temp[i];
+        temp[i] = (word << 1) | top;
+        top = word >> (LIMB_BITS - 1);
+    }
+
+    // Add the squares x[i] * x[i] down the diagonal.
+    carry = 0;
+    for (i = 0; i < NUM_LIMBS_256BIT; ++i) {
+        carry += ((dlimb_t)(x[i])) * x[i];
+        carry += temp[2 * i];
+        temp[2 * i] = (limb_t)carry;
+        carry >>= LIMB_BITS;
+        carry += temp[2 * i + 1];
+        temp[2 * i + 1] = (limb_t)carry;
+        carry >>= LIMB_BITS;
+    }
+
+    // Reduce the intermediate result modulo 2^255 - 19.
+    reduce(result, temp, NUM_LIMBS_256BIT);
+    strict_clean(temp);
+    crypto_feed_watchdog();
+#else
+    mul(result, x, x);
+#endif
+}
+
+/**
+ * \brief Squares a value repeatedly and then reduces it modulo 2^255 - 19.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to square, which must be NUM_LIMBS_FIELD25519 limbs in
+ * size and less than 2^255 - 19.
+ * \param n The number of times to square \a x, which must be at least 1.
+ *
+ * The result is x^(2^n).  With CURVE25519_RADIX51 the value stays in
+ * registers between the squarings.
+ *
+ * \sa square()
+ */
+void Curve25519::squareN(limb_t *result, const limb_t *x, uint8_t n)
+{
+#if CURVE25519_RADIX51
+    limb_t x0 = x[0];
+    limb_t x1 = x[1];
+    limb_t x2 = x[2];
+    limb_t x3 = x[3];
+    limb_t x4 = x[4];
+    limb_t d0, d1, d2, x3_19, x4_19;
+    dlimb_t t0, t1, t2, t3, t4;
+
+    do {
+        // As for mul() but with the cross products doubled instead of
+        // being computed twice: 15 products instead of 25.
+        d0 = x0 * 2U;
+        d1 = x1 * 2U;
+        d2 = x2 * 2U;
+        x3_19 = x3 * 19U;
+        x4_19 = x4 * 19U;
+        t0 = ((dlimb_t)x0) * x0 + ((dlimb_t)d1) * x4_19 +
+             ((dlimb_t)d2) * x3_19;
+        t1 = ((dlimb_t)d0) * x1 + ((dlimb_t)d2) * x4_19 +
+             ((dlimb_t)x3) * x3_19;
+        t2 = ((dlimb_t)d0) * x2 + ((dlimb_t)x1) * x1 +
+             ((dlimb_t)(x3 * 2U)) * x4_19;
+        t3 = ((dlimb_t)d0) * x3 + ((dlimb_t)d1) * x2 +
+             ((dlimb_t)x4) * x4_19;
+        t4 = ((dlimb_t)d0) * x4 + ((dlimb_t)d1) * x3 +
+             ((dlimb_t)x2) * x2;
+
+        // Carry once through the columns and fold the top carry into x0.
+        t1 += (limb_t)(t0 >> 51);
+        x0 = ((limb_t)t0) & LIMB51_MASK;
+        t2 += (limb_t)(t1 >> 51);
+        x1 = ((limb_t)t1) & LIMB51_MASK;
+        t3 += (limb_t)(t2 >> 51);
+        x2 = ((limb_t)t2) & LIMB51_MASK;
+        t4 += (limb_t)(t3 >> 51);
+        x3 = ((limb_t)t3) & LIMB51_MASK;
+        t0 = ((dlimb_t)((limb_t)(t4 >> 51))) * 19U + x0;
+        x4 = ((limb_t)t4) & LIMB51_MASK;
+        x0 = ((limb_t)t0) & LIMB51_MASK;
+        x1 += (limb_t)(t0 >> 51);
+    } while (--n > 0);
+
+    result[0] = x0;
+    result[1] = x1;
+    result[2] = x2;
+    result[3] = x3;
+    result[4] = x4;
+    crypto_feed_watchdog();
+#else
+    square(result, x);
+    while (--n > 0)
+        square(result, result);
+#endif
+}
+
+#if CURVE25519_AVX2
+
+/** @cond curve25519_avx2 */
+
+// Four field elements in radix 2^25.5, one element per 64-bit lane:
+// the even limbs hold 26 bits and the odd limbs 25 bits.
+typedef __m256i Field25519x4[10];
+
+// Multiplies every lane by 19 with shifts, as the lanes may be wider
+// than the 32 bits that _mm256_mul_epu32() reads.
+static CURVE25519_AVX2_INLINE __m256i avx2Mul19(__m256i x)
+{
+    return _mm256_add_epi64(_mm256_add_epi64(x, _mm256_slli_epi64(x, 1)),
+                            _mm256_slli_epi64(x, 4));
+}
+
+// Converts four field elements with radix-2^51 limbs less than 2^54.
+static CURVE25519_AVX2_INLINE void avx2Unpack
+    (Field25519x4 &f, const limb_t *const *x)
+{
+    const __m256i mask51 = _mm256_set1_epi64x(LIMB51_MASK);
+    const __m256i mask26 = _mm256_set1_epi64x((1 << 26) - 1);
+    __m256i v[5];
+    __m256i a, b, c, d;
+    uint8_t posn;
+
+    // Transpose limbs 0 to 3 of the four elements into lanes.
+    a = _mm256_loadu_si256((const __m256i *)(x[0]));
+    b = _mm256_loadu_si256((const __m256i *)(x[1]));
+    c = _mm256_loadu_si256((const __m256i *)(x[2]));
+    d = _mm256_loadu_si256((const __m256i *)(x[3]));
+    v[4] = _mm256_unpacklo_epi64(a, b);
+    a = _mm256_unpackhi_epi64(a, b);
+    b = _mm256_unpacklo_epi64(c, d);
+    c = _mm256_unpackhi_epi64(c, d);
+    v[0] = _mm256_permute2x128_si256(v[4], b, 0x20);
+    v[1] = _mm256_permute2x128_si256(a, c, 0x20);
+    v[2] = _mm256_permute2x128_si256(v[4], b, 0x31);
+    v[3] = _mm256_permute2x128_si256(a, c, 0x31);
+    v[4] = _mm256_set_epi64x((long long)(x[3][4]), (long long)(x[2][4]),
+                             (long long)(x[1][4]), (long long)(x[0][4]));
+
+    // One carry pass brings every limb under 2^51 + 8, so that the halves
+    // fit in 26 and 25 bits plus a carry of at most 1.
+    c = _mm256_srli_epi64(v[4], 51);
+    v[4] = _mm256_and_si256(v[4], mask51);
+    v[0] = _mm256_add_epi64(v[0], avx2Mul19(c));
+    #pragma GCC unroll 10
+    for (posn = 0; posn < 4; ++posn) {
+        c = _mm256_srli_epi64(v[posn], 51);
+        v[posn] = _mm256_and_si256(v[posn], mask51);
+        v[posn + 1] = _mm256_add_epi64(v[posn + 1], c);
+    }
+    #pragma GCC unroll 10
+    for (posn = 0; posn < 5; ++posn) {
+        f[posn * 2] = _mm256_and_si256(v[posn], mask26);
+        f[posn * 2 + 1] = _mm256_srli_epi64(v[posn], 26);
+    }
+}
+
+// Carries the columns of a product back into 26 and 25 bit limbs and
+// converts the lanes into radix-2^51 limbs less than 2^52.
+static CURVE25519_AVX2_INLINE void avx2Pack
+    (limb_t *const *result, Field25519x4 &h)
+{
+    const __m256i mask26 = _mm256_set1_epi64x((1 << 26) - 1);
+    const __m256i mask25 = _mm256_set1_epi64x((1 << 25) - 1);
+    __m256i out[5];
+    __m256i a, b, c, d;
+    limb_t lanes[4];
+    uint8_t posn, lane;
+
+    // Two interleaved carry chains, as in the ref10 code.
+    #define AVX2_CARRY(i, bits) \
+        do { \
+            c = _mm256_srli_epi64(h[(i)], (bits)); \
+            h[(i)] = _mm256_and_si256(h[(i)], mask##bits); \
+            h[(i) + 1] = _mm256_add_epi64(h[(i) + 1], c); \
+        } while (0)
+    AVX2_CARRY(0, 26);
+    AVX2_CARRY(4, 26);
+    AVX2_CARRY(1, 25);
+    AVX2_CARRY(5, 25);
+    AVX2_CARRY(2, 26);
+    AVX2_CARRY(6, 26);
+    AVX2_CARRY(3, 25);
+    AVX2_CARRY(7, 25);
+    AVX2_CARRY(4, 26);
+    AVX2_CARRY(8, 26);
+    c = _mm256_srli_epi64(h[9], 25);
+    h[9] = _mm256_and_si256(h[9], mask25);
+    h[0] = _mm256_add_epi64(h[0], avx2Mul19(c));
+    AVX2_CARRY(0, 26);
+    #undef AVX2_CARRY
+
+    #pragma GCC unroll 10
+    for (posn = 0; posn < 5; ++posn) {
+        out[posn] = _mm256_add_epi64
+            (h[posn * 2], _mm256_slli_epi64(h[posn * 2 + 1], 26));
+    }
+
+    // Transpose limbs 0 to 3 back.  Every result is written after all of
+    // the limbs have been computed, so results may overlap the inputs.
+    a = _mm256_unpacklo_epi64(out[0], out[1]);
+    b = _mm256_unpackhi_epi64(out[0], out[1]);
+    c = _mm256_unpacklo_epi64(out[2], out[3]);
+    d = _mm256_unpackhi_epi64(out[2], out[3]);
+    _mm256_storeu_si256((__m256i *)lanes, out[4]);
+    _mm256_storeu_si256((__m256i *)(result[0]),
+                        _mm256_permute2x128_si256(a, c, 0x20));
+    _mm256_storeu_si256((__m256i *)(result[1]),
+                        _mm256_permute2x128_si256(b, d, 0x20));
+    _mm256_storeu_si256((__m256i *)(result[2]),
+                        _mm256_permute2x128_si256(a, c, 0x31));
+    _mm256_storeu_si256((__m256i *)(result[3]),
+                        _mm256_permute2x128_si256(b, d, 0x31));
+    for (lane = 0; lane < 4; ++lane)
+        result[lane][4] = lanes[lane];
+}
+
+// Multiplies the lanes of f and g.  Products of two odd limbs are doubled
+// because their weights sum to one more than the weight of their column,
+// and columns above 2^255 are folded back in multiplied by 19.
+static CURVE25519_AVX2_INLINE void avx2Mul
+    (Field25519x4 &h, const Field25519x4 &f, const Field25519x4 &g)
+{
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    __m256i g19[10];
+    __m256i f2[10];
+    uint8_t i, k;
+
+    #pragma GCC unroll 10
+    for (i = 1; i < 10; ++i) {
+        g19[i] = _mm256_mul_epu32(g[i], nineteen);
+        f2[i] = (i & 1) ? _mm256_slli_epi64(f[i], 1) : f[i];
+    }
+    f2[0] = f[0];
+    #pragma GCC unroll 10
+    for (k = 0; k < 10; ++k) {
+        h[k] = _mm256_mul_epu32(f[0], g[k]);
+        #pragma GCC unroll 10
+        for (i = 1; i < 10; ++i) {
+            const __m256i &fi = ((i & 1) && !(k & 1)) ? f2[i] : f[i];
+            const __m256i &gj = (i <= k) ? g[k - i] : g19[k + 10 - i];
+            h[k] = _mm256_add_epi64(h[k], _mm256_mul_epu32(fi, gj));
+        }
+    }
+}
+
+// Squares the lanes of f, computing each cross product once.
+static CURVE25519_AVX2_INLINE void avx2Square
+    (Field25519x4 &h, const Field25519x4 &f)
+{
+    __m256i f19[10];
+    __m256i f2[10];
+    __m256i t;
+    uint8_t i, j, k;
+
+    #pragma GCC unroll 10
+    for (i = 0; i < 10; ++i) {
+        f19[i] = avx2Mul19(f[i]);
+        f2[i] = _mm256_slli_epi64(f[i], 1);
+    }
+    #pragma GCC unroll 10
+    for (k = 0; k < 10; ++k)
+        h[k] = _mm256_setzero_si256();
+    #pragma GCC unroll 10
+    for (i = 0; i < 10; ++i) {
+        #pragma GCC unroll 10
+        for (j = i; j < 10; ++j) {
+            // Cross products are doubled, and doubled again for two
+            // odd limbs.  Those above 2^255 are multiplied by 19.
+            const __m256i &fi = (i == j) ? f[i] : f2[i];
+            const __m256i &fj = (i + j < 10) ? f[j] : f19[j];
+            t = _mm256_mul_epu32(fi, fj);
+            if (i & j & 1)
+                t = _mm256_slli_epi64(t, 1);
+            k = i + j;
+            if (k >= 10)
+                k -= 10;
+            h[k] = _mm256_add_epi64(h[k], t);
+        }
+    }
+}
+
+static CURVE25519_AVX2_TARGET void avx2Mul4
+    (limb_t *const *result, const limb_t *const *x, const limb_t *const *y)
+{
+    Field25519x4 f, g, h;
+    avx2Unpack(f, x);
+    avx2Unpack(g, y);
+    avx2Mul(h, f, g);
+    avx2Pack(result, h);
+}
+
+static CURVE25519_AVX2_TARGET void avx2Square4
+    (limb_t *const *result, const limb_t *const *x)
+{
+    Field25519x4 f, h;
+    avx2Unpack(f, x);
+    avx2Square(h, f);
+    avx2Pack(result, h);
+}
+
+/** @endcond */
+
+#endif // CURVE25519_AVX2
+
+/**
+ * \brief Computes four independent products modulo 2^255 - 19.
+ *
+ * \param result Points to the four results.
+ * \param x Points to the four first values to multiply.
+ * \param y Points to the four second values to multiply.
+ *
+ * Computes result[i] = x[i] * y[i] with the same bounds as mul().  With
+ * CURVE25519_AVX2 on x86-64 CPUs that have AVX2, the four products are
+ * computed in parallel and every input is read before any result is
+ * written.  Otherwise they are
+ * computed in order with mul(), so a result may only be the same array as
+ * an input of its own product or of an earlier one.
  */
+void Curve25519::mul4(limb_t *const *result, const limb_t *const *x,
+                      const limb_t *const *y)
+{
+#if CURVE25519_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        avx2Mul4(result, x, y);
+        crypto_feed_watchdog();
+        return;
+    }
+#endif
+    mul(result[0], x[0], y[0]);
+    mul(result[1], x[1], y[1]);
+    mul(result[2], x[2], y[2]);
+    mul(result[3], x[3], y[3]);
+}
+
+/**
+ * \brief Computes four independent squares modulo 2^255 - 19.
+ *
+ * \param result Points to the four results.
+ * \param x Points to the four values to square.
+ *
+ * The same as mul4() with \a y equal to \a x, using square() when the
+ * AVX2 kernel is not in use.
+ */
+void Curve25519::square4(limb_t *const *result, const limb_t *const *x)
+{
+#if CURVE25519_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        avx2Square4(result, x);
+        crypto_feed_watchdog();
+        return;
+    }
+#endif
+    square(result[0], x[0]);
+    square(result[1], x[1]);
+    square(result[2], x[2]);
+    square(result[3], x[3]);
+}
 
 /**
  * \brief Multiplies a value by the a24 constant and then reduces the result
  * modulo 2^255 - 19.
  *
- * \param result The result, which must be NUM_LIMBS_256BIT limbs in size
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
  * and can be the same array as \a x.
- * \param x The value to multiply by a24, which must be NUM_LIMBS_256BIT
+ * \param x The value to multiply by a24, which must be NUM_LIMBS_FIELD25519
  * limbs in size and less than 2^255 - 19.
  */
 void Curve25519::mulA24(limb_t *result, const limb_t *x)
 {
+#if CURVE25519_RADIX51
+    dlimb_t carry;
+    uint8_t posn;
+
+    // Multiply each limb by a24 = 121665 and carry into the next one.
+    carry = 0;
+    for (posn = 0; posn < 5; ++posn) {
+        carry += ((dlimb_t)(x[posn])) * 121665U;
+        result[posn] = ((limb_t)carry) & LIMB51_MASK;
+        carry >>= 51;
+    }
+    carry = carry * 19U + result[0];
+    result[0] = ((limb_t)carry) & LIMB51_MASK;
+    result[1] += (limb_t)(carry >> 51);
+#else
 #if !defined(CURVE25519_ASM_AVR)
     // The constant a24 = 121665 (0x1DB41) as a limb array.
 #if BIGNUMBER_LIMB_8BIT
@@ -1052,21 +1703,30 @@ void Curve25519::mulA24(limb_t *result, const limb_t *x)
     // Reduce the intermediate result modulo 2^255 - 19.
     reduce(result, temp, NUM_A24_LIMBS);
     strict_clean(temp);
+#endif
 }
 
 /**
  * \brief Multiplies two values and then reduces the result modulo 2^255 - 19,
  * where one of the values is in program memory.
  *
- * \param result The result, which must be NUM_LIMBS_256BIT limbs in size
- * and can be the same array as \a x or \a y.
- * \param x The first value to multiply, which must be NUM_LIMBS_256BIT limbs
- * in size and less than 2^255 - 19.
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x.
+ * \param x The first value to multiply, which must be NUM_LIMBS_FIELD25519
+ * limbs in size and less than 2^255 - 19.
  * \param y The second value to multiply, which must be NUM_LIMBS_256BIT limbs
  * in size and less than 2^255 - 19.  This array must be in program memory.
+ *
+ * \sa load_P()
  */
 void Curve25519::mul_P(limb_t *result, const limb_t *x, const limb_t *y)
 {
+#if CURVE25519_RADIX51
+    limb_t temp[NUM_LIMBS_FIELD25519];
+    load_P(temp, y);
+    mul(result, x, temp);
+    strict_clean(temp);
+#else
     limb_t temp[NUM_LIMBS_512BIT];
     uint8_t i, j;
     dlimb_t carry;
@@ -1104,21 +1764,32 @@ void Curve25519::mul_P(limb_t *result, const limb_t *x, const limb_t *y)
     // Reduce the intermediate result modulo 2^255 - 19.
     reduce(result, temp, NUM_LIMBS_256BIT);
     strict_clean(temp);
+#endif
 }
 
 /**
  * \brief Adds two values and then reduces the result modulo 2^255 - 19.
  *
- * \param result The result, which must be NUM_LIMBS_256BIT limbs in size
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
  * and can be the same array as \a x or \a y.
- * \param x The first value to multiply, which must be NUM_LIMBS_256BIT
+ * \param x The first value to multiply, which must be NUM_LIMBS_FIELD25519
  * limbs in size and less than 2^255 - 19.
- * \param y The second value to multiply, which must be NUM_LIMBS_256BIT
+ * \param y The second value to multiply, which must be NUM_LIMBS_FIELD25519
  * limbs in size and less than 2^255 - 19.
+ *
+ * With CURVE25519_RADIX51, the limbs are added without carrying or
+ * reducing.  The limbs of \a x and \a y must be less than 2^53, which
+ * holds for sums of up to two results of mul() or sub().
  */
 void Curve25519::add(limb_t *result, const limb_t *x, const limb_t *y)
 {
-#if !defined(CURVE25519_ASM_AVR)
+#if CURVE25519_RADIX51
+    uint8_t posn;
+
+    // Leave the carries in the spare bits of the limbs for mul().
+    for (posn = 0; posn < 5; ++posn)
+        result[posn] = x[posn] + y[posn];
+#elif !defined(CURVE25519_ASM_AVR)
     dlimb_t carry = 0;
     uint8_t posn;
     limb_t *rr = result;
@@ -1177,23 +1848,48 @@ void Curve25519::add(limb_t *result, const limb_t *x, const limb_t *y)
     );
 #endif // CURVE25519_ASM_AVR
 
+#if !CURVE25519_RADIX51
     // Reduce the result using the quick trial subtraction method.
     reduceQuick(result);
+#endif
 }
 
 /**
  * \brief Subtracts two values and then reduces the result modulo 2^255 - 19.
  *
- * \param result The result, which must be NUM_LIMBS_256BIT limbs in size
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
  * and can be the same array as \a x or \a y.
- * \param x The first value to multiply, which must be NUM_LIMBS_256BIT
+ * \param x The first value to multiply, which must be NUM_LIMBS_FIELD25519
  * limbs in size and less than 2^255 - 19.
- * \param y The second value to multiply, which must be NUM_LIMBS_256BIT
+ * \param y The second value to multiply, which must be NUM_LIMBS_FIELD25519
  * limbs in size and less than 2^255 - 19.
+ *
+ * With CURVE25519_RADIX51, the limbs of \a x must be less than 2^54 and
+ * those of \a y less than 2^53 - 76, which holds for the results of mul()
+ * and sub() and for sums of two of them.  One carry pass brings the limbs
+ * of the result back below 2^52.
  */
 void Curve25519::sub(limb_t *result, const limb_t *x, const limb_t *y)
 {
-#if !defined(CURVE25519_ASM_AVR)
+#if CURVE25519_RADIX51
+    limb_t t0, t1, t2, t3, t4;
+
+    // Add 4 * (2^255 - 19) so that no limb goes negative, then carry.
+    t0 = x[0] + LIMB51_4P_LOW - y[0];
+    t1 = x[1] + LIMB51_4P_HIGH - y[1];
+    t2 = x[2] + LIMB51_4P_HIGH - y[2];
+    t3 = x[3] + LIMB51_4P_HIGH - y[3];
+    t4 = x[4] + LIMB51_4P_HIGH - y[4];
+    t1 += t0 >> 51;
+    t2 += t1 >> 51;
+    t3 += t2 >> 51;
+    t4 += t3 >> 51;
+    result[0] = (t0 & LIMB51_MASK) + (t4 >> 51) * 19U;
+    result[1] = t1 & LIMB51_MASK;
+    result[2] = t2 & LIMB51_MASK;
+    result[3] = t3 & LIMB51_MASK;
+    result[4] = t4 & LIMB51_MASK;
+#elif !defined(CURVE25519_ASM_AVR)
     dlimb_t borrow;
     uint8_t posn;
     limb_t *rr = result;
@@ -1322,7 +2018,7 @@ void Curve25519::cswap(limb_t select, limb_t *x, limb_t *y)
 
     // Swap the two values based on "select".  Algorithm from:
     // http://tools.ietf.org/html/rfc7748
-    for (posn = 0; posn < NUM_LIMBS_256BIT; ++posn) {
+    for (posn = 0; posn < NUM_LIMBS_FIELD25519; ++posn) {
         dummy = sel & (x[posn] ^ y[posn]);
         x[posn] ^= dummy;
         y[posn] ^= dummy;
@@ -1421,7 +2117,7 @@ void Curve25519::cmove(limb_t select, limb_t *x, const limb_t *y)
     --sel;
 
     // Move y into x based on "select".  Similar to conditional swap above.
-    for (posn = 0; posn < NUM_LIMBS_256BIT; ++posn) {
+    for (posn = 0; posn < NUM_LIMBS_FIELD25519; ++posn) {
         dummy = sel & (x[posn] ^ y[posn]);
         x[posn] ^= dummy;
     }
@@ -1485,54 +2181,53 @@ void Curve25519::cmove(limb_t select, limb_t *x, const limb_t *y)
 /**
  * \brief Raise x to the power of (2^250 - 1).
  *
- * \param result The result array, which must be NUM_LIMBS_256BIT limbs in size.
+ * \param result The result array, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
  * \param x The value to raise.
  */
 void Curve25519::pow250(limb_t *result, const limb_t *x)
 {
-    limb_t t1[NUM_LIMBS_256BIT];
-    uint8_t i, j;
+    limb_t t0[NUM_LIMBS_FIELD25519];
+    limb_t t1[NUM_LIMBS_FIELD25519];
+    limb_t t2[NUM_LIMBS_FIELD25519];
 
     // The big-endian hexadecimal expansion of (2^250 - 1) is:
     // 03FFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
     //
-    // The naive implementation needs to do 2 multiplications per 1 bit and
-    // 1 multiplication per 0 bit.  We can improve upon this by creating a
-    // pattern 0000000001 ... 0000000001.  If we square and multiply the
-    // pattern by itself we can turn the pattern into the partial results
-    // 0000000011 ... 0000000011, 0000000111 ... 0000000111, etc.
-    // This averages out to about 1.1 multiplications per 1 bit instead of 2.
-
-    // Build a pattern of 250 bits in length of repeated copies of 0000000001.
-    #define RECIP_GROUP_SIZE 10
-    #define RECIP_GROUP_BITS 250    // Must be a multiple of RECIP_GROUP_SIZE.
-    square(t1, x);
-    for (j = 0; j < (RECIP_GROUP_SIZE - 1); ++j)
-        square(t1, t1);
-    mul(result, t1, x);
-    for (i = 0; i < ((RECIP_GROUP_BITS / RECIP_GROUP_SIZE) - 2); ++i) {
-        for (j = 0; j < RECIP_GROUP_SIZE; ++j)
-            square(t1, t1);
-        mul(result, result, t1);
-    }
-
-    // Multiply bit-shifted versions of the 0000000001 pattern into
-    // the result to "fill in" the gaps in the pattern.
-    square(t1, result);
-    mul(result, result, t1);
-    for (j = 0; j < (RECIP_GROUP_SIZE - 2); ++j) {
-        square(t1, t1);
-        mul(result, result, t1);
-    }
+    // Build up runs of 1 bits: squaring x^(2^k - 1) k times and multiplying
+    // by x^(2^k - 1) again gives x^(2^2k - 1).  This needs 249 squarings
+    // and only 10 multiplications.
+    square(t0, x);                      // t0 = x^2
+    squareN(t1, t0, 2);                 // t1 = x^8
+    mul(t1, t1, x);                     // t1 = x^9
+    mul(t0, t0, t1);                    // t0 = x^11
+    square(t0, t0);                     // t0 = x^22
+    mul(t0, t0, t1);                    // t0 = x^(2^5 - 1)
+    squareN(t1, t0, 5);
+    mul(t0, t1, t0);                    // t0 = x^(2^10 - 1)
+    squareN(t1, t0, 10);
+    mul(t1, t1, t0);                    // t1 = x^(2^20 - 1)
+    squareN(t2, t1, 20);
+    mul(t1, t2, t1);                    // t1 = x^(2^40 - 1)
+    squareN(t1, t1, 10);
+    mul(t0, t1, t0);                    // t0 = x^(2^50 - 1)
+    squareN(t1, t0, 50);
+    mul(t1, t1, t0);                    // t1 = x^(2^100 - 1)
+    squareN(t2, t1, 100);
+    mul(t1, t2, t1);                    // t1 = x^(2^200 - 1)
+    squareN(t1, t1, 50);
+    mul(result, t1, t0);                // result = x^(2^250 - 1)
 
     // Clean up and exit.
+    clean(t0);
     clean(t1);
+    clean(t2);
 }
 
 /**
  * \brief Computes the reciprocal of a number modulo 2^255 - 19.
  *
- * \param result The result as a array of NUM_LIMBS_256BIT limbs in size.
+ * \param result The result as a array of NUM_LIMBS_FIELD25519 limbs in size.
  * This cannot be the same array as \a x.
  * \param x The number to compute the reciprocal for.
  */
@@ -1545,11 +2240,9 @@ void Curve25519::recip(limb_t *result, const limb_t *x)
     pow250(result, x);
 
     // Deal with the 5 lowest bits of (p - 2), 01011, from highest to lowest.
-    square(result, result);
-    square(result, result);
+    squareN(result, result, 2);
     mul(result, result, x);
-    square(result, result);
-    square(result, result);
+    squareN(result, result, 2);
     mul(result, result, x);
     square(result, result);
     mul(result, result, x);
@@ -1558,7 +2251,7 @@ void Curve25519::recip(limb_t *result, const limb_t *x)
 /**
  * \brief Computes the square root of a number modulo 2^255 - 19.
  *
- * \param result The result as a array of NUM_LIMBS_256BIT limbs in size.
+ * \param result The result as a array of NUM_LIMBS_FIELD25519 limbs in size.
  * This must not overlap with \a x.
  * \param x The number to compute the square root for.
  *
@@ -1577,7 +2270,7 @@ bool Curve25519::sqrt(limb_t *result, const limb_t *x)
         LIMB_PAIR(0x4A0EA0B0, 0xC4EE1B27), LIMB_PAIR(0xAD2FE478, 0x2F431806),
         LIMB_PAIR(0x3DFBD7A7, 0x2B4D0099), LIMB_PAIR(0x4FC1DF0B, 0x2B832480)
     };
-    limb_t y[NUM_LIMBS_256BIT];
+    limb_t y[NUM_LIMBS_FIELD25519];
 
     // Algorithm from: http://tools.ietf.org/html/rfc7748
 
@@ -1591,7 +2284,8 @@ bool Curve25519::sqrt(limb_t *result, const limb_t *x)
 
     // Did we get the square root immediately?
     square(y, result);
-    if (memcmp(x, y, sizeof(y)) == 0) {
+    sub(y, y, x);
+    if (isZero(y)) {
         clean(y);
         return true;
     }
@@ -1599,7 +2293,8 @@ bool Curve25519::sqrt(limb_t *result, const limb_t *x)
     // Multiply the result by sqrt(-1) and check again.
     mul_P(result, result, numSqrtM1);
     square(y, result);
-    if (memcmp(x, y, sizeof(y)) == 0) {
+    sub(y, y, x);
+    if (isZero(y)) {
         clean(y);
         return true;
     }
@@ -1608,3 +2303,121 @@ bool Curve25519::sqrt(limb_t *result, const limb_t *x)
     clean(y);
     return false;
 }
+
+/**
+ * \brief Unpacks a field element from its 32-byte little-endian encoding.
+ *
+ * \param result The field element, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
+ * \param x The 32 bytes to unpack.  The high bit is ignored.
+ *
+ * The value is not reduced, so it may be anywhere between 0 and 2^255 - 1.
+ *
+ * \sa pack()
+ */
+void Curve25519::unpack(limb_t *result, const uint8_t *x)
+{
+#if CURVE25519_RADIX51
+    limb_t temp[NUM_LIMBS_256BIT];
+    BigNumberUtil::unpackLE(temp, NUM_LIMBS_256BIT, x, 32);
+    load(result, temp);
+    strict_clean(temp);
+#else
+    BigNumberUtil::unpackLE(result, NUM_LIMBS_256BIT, x, 32);
+    result[NUM_LIMBS_256BIT - 1] &= ((((limb_t)1) << (LIMB_BITS - 1)) - 1);
+#endif
+}
+
+/**
+ * \brief Packs a field element into its 32-byte little-endian encoding.
+ *
+ * \param result The 32 bytes of the encoding.
+ * \param x The field element, which must be NUM_LIMBS_FIELD25519 limbs
+ * in size.
+ *
+ * The encoding is of the fully reduced value.
+ *
+ * \sa unpack()
+ */
+void Curve25519::pack(uint8_t *result, const limb_t *x)
+{
+#if CURVE25519_RADIX51
+    limb_t temp[NUM_LIMBS_FIELD25519];
+    limb_t words[NUM_LIMBS_256BIT];
+    memcpy(temp, x, sizeof(temp));
+    reduceQuick(temp);
+    words[0] = temp[0] | (temp[1] << 51);
+    words[1] = (temp[1] >> 13) | (temp[2] << 38);
+    words[2] = (temp[2] >> 26) | (temp[3] << 25);
+    words[3] = (temp[3] >> 39) | (temp[4] << 12);
+    BigNumberUtil::packLE(result, 32, words, NUM_LIMBS_256BIT);
+    strict_clean(temp);
+    strict_clean(words);
+#else
+    BigNumberUtil::packLE(result, 32, x, NUM_LIMBS_256BIT);
+#endif
+}
+
+/**
+ * \brief Loads a field element from a number in saturated limbs.
+ *
+ * \param result The field element, which must be NUM_LIMBS_FIELD25519
+ * limbs in size and must not overlap with \a x.
+ * \param x The number, which must be NUM_LIMBS_256BIT limbs in size
+ * and less than 2^255.
+ *
+ * \sa load_P()
+ */
+void Curve25519::load(limb_t *result, const limb_t *x)
+{
+#if CURVE25519_RADIX51
+    result[0] = x[0] & LIMB51_MASK;
+    result[1] = ((x[0] >> 51) | (x[1] << 13)) & LIMB51_MASK;
+    result[2] = ((x[1] >> 38) | (x[2] << 26)) & LIMB51_MASK;
+    result[3] = ((x[2] >> 25) | (x[3] << 39)) & LIMB51_MASK;
+    result[4] = (x[3] >> 12) & LIMB51_MASK;
+#else
+    memcpy(result, x, sizeof(limb_t) * NUM_LIMBS_256BIT);
+#endif
+}
+
+/**
+ * \brief Loads a field element from a number in program memory.
+ *
+ * \param result The field element, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
+ * \param x The number in program memory, which must be NUM_LIMBS_256BIT
+ * limbs in size and less than 2^255 - 19.
+ *
+ * \sa load()
+ */
+void Curve25519::load_P(limb_t *result, const limb_t *x)
+{
+#if CURVE25519_RADIX51
+    limb_t temp[NUM_LIMBS_256BIT];
+    memcpy_P(temp, x, sizeof(temp));
+    load(result, temp);
+#else
+    memcpy_P(result, x, sizeof(limb_t) * NUM_LIMBS_256BIT);
+#endif
+}
+
+/**
+ * \brief Determines if a field element is zero modulo 2^255 - 19.
+ *
+ * \param x The field element, which must be NUM_LIMBS_FIELD25519 limbs
+ * in size.
+ *
+ * \return Returns true if \a x is zero; false otherwise.
+ */
+bool Curve25519::isZero(const limb_t *x)
+{
+#if CURVE25519_RADIX51
+    limb_t temp[NUM_LIMBS_FIELD25519];
+    memcpy(temp, x, sizeof(temp));
+    reduceQuick(temp);
+    return BigNumberUtil::isZero(temp, NUM_LIMBS_FIELD25519) != 0;
+#else
+    return BigNumberUtil::isZero(x, NUM_LIMBS_256BIT) != 0;
+#endif
+}
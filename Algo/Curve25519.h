@@ -25,12 +25,38 @@
 
 #include "BigNumberUtil.h"
 
+// Field elements are normally NUM_LIMBS_256BIT saturated limbs, fully
+// reduced modulo 2^255 - 19 after every operation.  Where dlimb_t is a
+// 128-bit type they are instead 5 limbs of 51 bits: add() leaves its carries
+// in the spare bits for the next mul(), and values are only reduced fully
+// when they are packed or compared.  Define CURVE25519_RADIX51 to 0 to use
+// the saturated limbs on 64-bit hosts as well.
+#if !defined(CURVE25519_RADIX51)
+#if BIGNUMBER_LIMB_64BIT
+#define CURVE25519_RADIX51 1
+#else
+#define CURVE25519_RADIX51 0
+#endif
+#elif CURVE25519_RADIX51 && !BIGNUMBER_LIMB_64BIT
+#error "CURVE25519_RADIX51 needs 64-bit limbs"
+#endif
+
+// Number of limbs in a field element.
+#if CURVE25519_RADIX51
+#define NUM_LIMBS_FIELD25519 5
+#else
+#define NUM_LIMBS_FIELD25519 (32 / sizeof(limb_t))
+#endif
+
 class Ed25519;
 
 class Curve25519
 {
 public:
     static bool eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[32]);
+    static bool evalBatch(uint8_t *const *results, const uint8_t *const *s,
+                          const uint8_t *const *x, size_t count,
+                          bool *valid = 0);
 
     static void dh1(uint8_t k[32], uint8_t f[32]);
     static bool dh2(uint8_t k[32], uint8_t f[32]);
@@ -42,16 +68,21 @@ private:
 #endif
     static uint8_t isWeakPoint(const uint8_t k[32]);
 
+    static void ladder(limb_t *x_2, limb_t *z_2, const uint8_t s[32],
+                       const limb_t *x_1);
+
     static void reduce(limb_t *result, limb_t *x, uint8_t size);
     static limb_t reduceQuick(limb_t *x);
 
     static void mulNoReduce(limb_t *result, const limb_t *x, const limb_t *y);
 
     static void mul(limb_t *result, const limb_t *x, const limb_t *y);
-    static void square(limb_t *result, const limb_t *x)
-    {
-        mul(result, x, x);
-    }
+    static void square(limb_t *result, const limb_t *x);
+    static void squareN(limb_t *result, const limb_t *x, uint8_t n);
+
+    static void mul4(limb_t *const *result, const limb_t *const *x,
+                     const limb_t *const *y);
+    static void square4(limb_t *const *result, const limb_t *const *x);
 
     static void mulA24(limb_t *result, const limb_t *x);
 
@@ -67,6 +98,12 @@ private:
     static void recip(limb_t *result, const limb_t *x);
     static bool sqrt(limb_t *result, const limb_t *x);
 
+    static void unpack(limb_t *result, const uint8_t *x);
+    static void pack(uint8_t *result, const limb_t *x);
+    static void load(limb_t *result, const limb_t *x);
+    static void load_P(limb_t *result, const limb_t *x);
+    static bool isZero(const limb_t *x);
+
     // Constructor and destructor are private - cannot instantiate this class.
     Curve25519() {}
     ~Curve25519() {}
@@ -25,6 +25,8 @@
 #include "Crypto.h"
 #include "RNG.h"
 #include "utility/LimbUtil.h"
+#include "utility/BigNumberModUtil.h"
+#include <stdlib.h>
 #include <string.h>
 
 /**
@@ -64,11 +66,36 @@
  * }
  * \endcode
  *
+ * Messages that are too large to hold in memory can be signed with
+ * signStream() and checked with verifyStream().  Instead of a buffer,
+ * these take a function that writes the message into a hash object.
+ * signStream() calls the function twice, so it must produce the same
+ * message each time:
+ *
+ * \code
+ * void writeLog(Hash *hash, void *context)
+ * {
+ *     Log *log = (Log *)context;
+ *     for (size_t index = 0; index < log->count(); ++index)
+ *         hash->update(log->entry(index), log->entryLength(index));
+ * }
+ *
+ * Ed25519::signStream(signature, privateKey, publicKey, writeLog, &log);
+ * \endcode
+ *
+ * Alternatively, signPrehashed() and verifyPrehashed() implement the
+ * Ed25519ph variant from RFC 8032, which signs the SHA-512 hash of the
+ * message and so only needs a single pass over it.  Ed25519ph signatures
+ * are not interchangeable with ordinary Ed25519 signatures of the same
+ * message.
+ *
  * \note The public functions in this class need a substantial amount of
  * stack space to store intermediate results while the curve function is
- * being evaluated.  About 1.5k of free stack space is recommended for safety.
+ * being evaluated.  About 1.5k of free stack space is recommended for safety,
+ * or 2.5k for verify().
  *
- * References: https://tools.ietf.org/html/draft-irtf-cfrg-eddsa-05
+ * References: https://tools.ietf.org/html/draft-irtf-cfrg-eddsa-05,
+ * <a href="https://tools.ietf.org/html/rfc8032">RFC 8032</a>
  *
  * \sa Curve25519
  */
@@ -87,6 +114,12 @@ static limb_t const numDx2[NUM_LIMBS_256BIT] PROGMEM = {
     LIMB_PAIR(0xEEF3D130, 0x198E80F2), LIMB_PAIR(0x56DFFCE7, 0x2406D9DC)
 };
 
+// sqrt(-1) mod (2^255 - 19).
+static limb_t const numSqrtM1[NUM_LIMBS_256BIT] PROGMEM = {
+    LIMB_PAIR(0x4A0EA0B0, 0xC4EE1B27), LIMB_PAIR(0xAD2FE478, 0x2F431806),
+    LIMB_PAIR(0x3DFBD7A7, 0x2B4D0099), LIMB_PAIR(0x4FC1DF0B, 0x2B832480)
+};
+
 // Extended homogenous co-ordinates for the base point.
 static limb_t const numBx[NUM_LIMBS_256BIT] PROGMEM = {
     LIMB_PAIR(0x8F25D51A, 0xC9562D60), LIMB_PAIR(0x9525A7B2, 0x692CC760),
@@ -111,6 +144,90 @@ static limb_t const numQ[NUM_LIMBS_256BIT] PROGMEM = {
     LIMB_PAIR(0x00000000, 0x00000000), LIMB_PAIR(0x00000000, 0x10000000)
 };
 
+// 2^512 mod q, which is R^2 mod q for Montgomery arithmetic modulo q.
+static limb_t const numQR2[NUM_LIMBS_256BIT] PROGMEM = {
+    LIMB_PAIR(0x449C0F01, 0xA40611E3), LIMB_PAIR(0x68859347, 0xD00E1BA7),
+    LIMB_PAIR(0x17F5BE65, 0xCEEC73D2), LIMB_PAIR(0x7C309A3D, 0x0399411B)
+};
+
+// Describes q to the modular arithmetic templates in BigNumberUtil.
+struct Ed25519ModQ
+{
+    static const size_t count = NUM_LIMBS_256BIT;
+    static const limb_t inverse = (limb_t)0xD2B51DA312547E1BULL;
+    static const limb_t *modulus() { return numQ; }
+    static const limb_t *r2() { return numQR2; }
+};
+
+// Multiplication by the base point uses a table of precomputed multiples
+// in program memory: rows of 1 * 16^k * B to 8 * 16^k * B, for each k that
+// is a multiple of ED25519_BASE_TABLE_SPACING.  Larger spacings trade
+// doublings for flash:
+//
+//      spacing     1      2      4      8      16     32     64
+//      table       48K    24K    12K    6K     3K     1.5K   768
+//      doublings   0      4      12     28     60     124    252
+//
+// A further 3K table of the odd multiples 1 * B to 63 * B speeds up verify().
+// Setting the spacing to 0 leaves both tables out: the base point is then
+// multiplied with the generic double-and-add loop, and verify() computes
+// its multiples of B on the fly.
+#if !defined(ED25519_BASE_TABLE_SPACING)
+#if defined(__AVR__)
+#define ED25519_BASE_TABLE_SPACING 0
+#else
+#define ED25519_BASE_TABLE_SPACING 2
+#endif
+#endif
+
+#if ED25519_BASE_TABLE_SPACING
+#if ED25519_BASE_TABLE_SPACING < 0 || ED25519_BASE_TABLE_SPACING > 64 || \
+        (64 % ED25519_BASE_TABLE_SPACING) != 0
+#error "ED25519_BASE_TABLE_SPACING must be 0, 1, 2, 4, 8, 16, 32 or 64"
+#endif
+#include "utility/Ed25519BaseTable.h"
+#endif
+
+// Width of the non-adjacent form of the multiple of B used by verify().
+// The odd multiples of B come from baseOddTable if it is present; those
+// of the public key use ED25519_NAF_WIDTH from Ed25519.h.
+#if ED25519_BASE_TABLE_SPACING
+#define ED25519_NAF_BASE_WIDTH  7
+#else
+#define ED25519_NAF_BASE_WIDTH  ED25519_NAF_WIDTH
+#endif
+
+// Width of the signed windows used by the generic point multiplication.
+// Each window costs one constant-time table lookup and one addition, and
+// the table of 2^(width - 1) multiples lives on the stack (128 bytes per
+// entry with 32-bit limbs).  Setting the width to 0 falls back to one
+// addition per bit of the scalar, which needs no table.
+#if !defined(ED25519_MUL_WINDOW)
+#if defined(__AVR__)
+#define ED25519_MUL_WINDOW      0
+#else
+#define ED25519_MUL_WINDOW      4
+#endif
+#endif
+
+#if ED25519_MUL_WINDOW
+#if ED25519_MUL_WINDOW < 2 || ED25519_MUL_WINDOW > 6
+#error "ED25519_MUL_WINDOW must be 0 or between 2 and 6"
+#endif
+#define ED25519_MUL_ENTRIES     (1 << (ED25519_MUL_WINDOW - 1))
+#define ED25519_MUL_DIGITS      (255 / ED25519_MUL_WINDOW + 1)
+#endif
+
+// Maximum number of signatures that verifyBatch() checks with a single
+// equation.  Its working memory comes from the heap: about 400 bytes per
+// signature plus up to 8K of buckets for the largest windows.
+#if !defined(ED25519_BATCH_SIZE)
+#define ED25519_BATCH_SIZE      64
+#endif
+#define ED25519_BATCH_MIN       4   // Fewer are cheaper one at a time.
+#define ED25519_BATCH_MAX_WIDTH 7
+#define ED25519_BATCH_WINDOWS(width)    (253 / (width) + 2)
+
 /** @endcond */
 
 /**
@@ -126,23 +243,153 @@ static limb_t const numQ[NUM_LIMBS_256BIT] PROGMEM = {
  */
 void Ed25519::sign(uint8_t signature[64], const uint8_t privateKey[32],
                    const uint8_t publicKey[32], const void *message, size_t len)
+{
+    Buffer buffer = {message, len};
+    signStream(signature, privateKey, publicKey, hashBuffer, &buffer);
+}
+
+/**
+ * \brief Signs a message using an expanded Ed25519 private key.
+ *
+ * \param signature The signature value.
+ * \param expandedKey The expanded private key, from expandPrivateKey().
+ * \param publicKey The public key corresponding to \a expandedKey.
+ * \param message Points to the message to be signed.
+ * \param len The length of the \a message to be signed.
+ *
+ * The result is the same as sign() with the original private key, without
+ * hashing the private key again: useful when signing many messages with
+ * many keys.
+ *
+ * \sa sign(), expandPrivateKey()
+ */
+void Ed25519::signExpanded(uint8_t signature[64], const uint8_t expandedKey[64],
+                           const uint8_t publicKey[32], const void *message,
+                           size_t len)
+{
+    SHA512 hash;
+    limb_t a[NUM_LIMBS_256BIT];
+    Buffer buffer = {message, len};
+
+    BigNumberUtil::unpackLE(a, NUM_LIMBS_256BIT, expandedKey, 32);
+    signWithKeys(&hash, signature, a, expandedKey + 32, publicKey,
+                 hashBuffer, &buffer, 0);
+    clean(a);
+}
+
+/**
+ * \brief Signs a message that is supplied in pieces by a function.
+ *
+ * \param signature The signature value.
+ * \param privateKey The private key to use to sign the message.
+ * \param publicKey The public key corresponding to \a privateKey.
+ * \param source Function that writes the message to be signed into the
+ * hash object that it is given with Hash::update(), in any number of
+ * pieces.
+ * \param context Context pointer that is passed to \a source.
+ *
+ * The result is the same as sign() with the whole message in a single
+ * buffer.  Ed25519 hashes the message twice, so \a source is called twice
+ * and must write the same message both times.
+ *
+ * \sa verifyStream(), signPrehashed()
+ */
+void Ed25519::signStream(uint8_t signature[64], const uint8_t privateKey[32],
+                         const uint8_t publicKey[32], MessageSource source,
+                         void *context)
 {
     SHA512 hash;
     uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
     limb_t a[NUM_LIMBS_256BIT];
+
+    // Derive the secret scalar a and the message prefix from the private key.
+    deriveKeys(&hash, a, privateKey);
+
+    signWithKeys(&hash, signature, a, buf + 32, publicKey, source, context, 0);
+    clean(a);
+}
+
+/**
+ * \brief Signs the SHA-512 hash of a message with Ed25519ph.
+ *
+ * \param signature The signature value.
+ * \param privateKey The private key to use to sign the message.
+ * \param publicKey The public key corresponding to \a privateKey.
+ * \param digest The SHA-512 hash of the message to be signed.
+ * \param context Points to the context string, or NULL for none.
+ * \param contextLen The length of the context string, up to 255 bytes.
+ *
+ * This is the Ed25519ph algorithm from RFC 8032, which signs a message
+ * of any length after a single pass of SHA512 over it:
+ *
+ * \code
+ * SHA512 sha512;
+ * uint8_t digest[64];
+ * sha512.update(part1, len1);
+ * sha512.update(part2, len2);
+ * ...
+ * sha512.finalize(digest, 64);
+ * Ed25519::signPrehashed(signature, privateKey, publicKey, digest);
+ * \endcode
+ *
+ * Ed25519ph signatures can only be checked with verifyPrehashed(), with
+ * the same context string.
+ *
+ * \sa verifyPrehashed(), signStream()
+ */
+void Ed25519::signPrehashed(uint8_t signature[64], const uint8_t privateKey[32],
+                            const uint8_t publicKey[32], const uint8_t digest[64],
+                            const void *context, uint8_t contextLen)
+{
+    SHA512 hash;
+    uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    limb_t a[NUM_LIMBS_256BIT];
+    Buffer buffer = {digest, 64};
+    PrehashContext ph = {context, contextLen};
+
+    deriveKeys(&hash, a, privateKey);
+
+    signWithKeys(&hash, signature, a, buf + 32, publicKey,
+                 hashBuffer, &buffer, &ph);
+    clean(a);
+}
+
+/**
+ * \brief Signs a message given the secret scalar and the message prefix.
+ *
+ * \param hash Hash object to use; \a prefix may point into its state.
+ * \param signature The signature value.
+ * \param a The secret scalar.
+ * \param prefix The 32-byte message prefix.
+ * \param publicKey The public key corresponding to \a a.
+ * \param source Function that writes the message into the hash.
+ * \param context Context pointer for \a source.
+ * \param ph The context string for Ed25519ph, or NULL for Ed25519.
+ */
+void Ed25519::signWithKeys(SHA512 *hash, uint8_t signature[64], const limb_t *a,
+                           const uint8_t prefix[32], const uint8_t publicKey[32],
+                           MessageSource source, void *context,
+                           const PrehashContext *ph)
+{
+    uint8_t *buf = (uint8_t *)(hash->state.w); // Reuse hash buffer to save memory.
+    uint8_t copy[32];
     limb_t r[NUM_LIMBS_256BIT];
     limb_t k[NUM_LIMBS_256BIT];
     limb_t t[NUM_LIMBS_512BIT + 1];
     Point rB;
 
-    // Derive the secret scalar a and the message prefix from the private key.
-    deriveKeys(&hash, a, privateKey);
+    // The domain separator would overwrite a prefix in the hash buffer.
+    if (ph) {
+        memcpy(copy, prefix, 32);
+        prefix = copy;
+    }
 
     // Hash the prefix and the message to derive r.
-    hash.reset();
-    hash.update(buf + 32, 32);
-    hash.update(message, len);
-    hash.finalize(buf, 0);
+    hash->reset();
+    hashDomain(hash, ph);
+    hash->update(prefix, 32);
+    (*source)(hash, context);
+    hash->finalize(buf, 0);
     reduceQFromBuffer(r, buf, t);
 
     // Encode rB into the first half of the signature buffer as R.
@@ -150,11 +397,12 @@ void Ed25519::sign(uint8_t signature[64], const uint8_t privateKey[32],
     encodePoint(signature, rB);
 
     // Hash R, A, and the message to get k.
-    hash.reset();
-    hash.update(signature, 32); // R
-    hash.update(publicKey, 32); // A
-    hash.update(message, len);
-    hash.finalize(buf, 0);
+    hash->reset();
+    hashDomain(hash, ph);
+    hash->update(signature, 32); // R
+    hash->update(publicKey, 32); // A
+    (*source)(hash, context);
+    hash->finalize(buf, 0);
     reduceQFromBuffer(k, buf, t);
 
     // Compute s = (r + k * a) mod q.
@@ -166,7 +414,7 @@ void Ed25519::sign(uint8_t signature[64], const uint8_t privateKey[32],
     BigNumberUtil::packLE(signature + 32, 32, t, NUM_LIMBS_256BIT);
 
     // Clean up.
-    clean(a);
+    clean(copy);
     clean(r);
     clean(k);
     clean(t);
@@ -189,42 +437,393 @@ void Ed25519::sign(uint8_t signature[64], const uint8_t privateKey[32],
 bool Ed25519::verify(const uint8_t signature[64], const uint8_t publicKey[32],
                      const void *message, size_t len)
 {
-    SHA512 hash;
+    Buffer buffer = {message, len};
+    return verifyWithKey(signature, publicKey, hashBuffer, &buffer, 0);
+}
+
+/**
+ * \brief Verifies the signature of a message that is supplied in pieces
+ * by a function.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The public key to use to verify the signature.
+ * \param source Function that writes the message into the hash object
+ * that it is given with Hash::update(), in any number of pieces.
+ * \param context Context pointer that is passed to \a source.
+ *
+ * \return Returns true if the \a signature is valid for the message;
+ * or false if the \a signature is not valid.
+ *
+ * The result is the same as verify() with the whole message in a single
+ * buffer.  \a source is called at most once.
+ *
+ * \sa signStream()
+ */
+bool Ed25519::verifyStream(const uint8_t signature[64],
+                           const uint8_t publicKey[32],
+                           MessageSource source, void *context)
+{
+    return verifyWithKey(signature, publicKey, source, context, 0);
+}
+
+/**
+ * \brief Verifies an Ed25519ph signature of the SHA-512 hash of a message.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The public key to use to verify the signature.
+ * \param digest The SHA-512 hash of the message.
+ * \param context Points to the context string, or NULL for none.
+ * \param contextLen The length of the context string, up to 255 bytes.
+ *
+ * \return Returns true if the \a signature is valid for the message;
+ * or false if the \a signature is not valid.
+ *
+ * \sa signPrehashed()
+ */
+bool Ed25519::verifyPrehashed(const uint8_t signature[64],
+                              const uint8_t publicKey[32],
+                              const uint8_t digest[64],
+                              const void *context, uint8_t contextLen)
+{
+    Buffer buffer = {digest, 64};
+    PrehashContext ph = {context, contextLen};
+    return verifyWithKey(signature, publicKey, hashBuffer, &buffer, &ph);
+}
+
+/**
+ * \brief Writes a contiguous message into a hash.
+ *
+ * \param hash The hash object.
+ * \param context Points to the Buffer that holds the message.
+ */
+void Ed25519::hashBuffer(Hash *hash, void *context)
+{
+    const Buffer *buffer = (const Buffer *)context;
+    hash->update(buffer->data, buffer->len);
+}
+
+/**
+ * \brief Writes the dom2 prefix of Ed25519ph into a hash.
+ *
+ * \param hash The hash object.
+ * \param ph The context string, or NULL for Ed25519, which has no prefix.
+ */
+void Ed25519::hashDomain(Hash *hash, const PrehashContext *ph)
+{
+    static char const dom2[] = "SigEd25519 no Ed25519 collisions";
+    uint8_t flags[2];
+
+    if (!ph)
+        return;
+    flags[0] = 1;       // Prehashed.
+    flags[1] = ph->len;
+    hash->update(dom2, 32);
+    hash->update(flags, 2);
+    hash->update(ph->data, ph->len);
+}
+
+/**
+ * \brief Verifies a signature against an encoded public key.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The public key to use to verify the signature.
+ * \param source Function that writes the message into the hash.
+ * \param context Context pointer for \a source.
+ * \param ph The context string for Ed25519ph, or NULL for Ed25519.
+ *
+ * \return Returns true if the \a signature is valid.
+ */
+bool Ed25519::verifyWithKey(const uint8_t signature[64],
+                            const uint8_t publicKey[32],
+                            MessageSource source, void *context,
+                            const PrehashContext *ph)
+{
     Point A;
-    Point R;
-    Point sB;
-    Point kA;
-    uint8_t *k = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    CachedPoint table[ED25519_NAF_ENTRIES];
     bool result = false;
 
-    // Decode the public key and the R component of the signature.
-    if (decodePoint(A, publicKey) && decodePoint(R, signature)) {
+    if (decodeKey(A, publicKey)) {
+        oddMultiples(table, A, ED25519_NAF_ENTRIES);
+        result = verifyWithTable(signature, publicKey, source, context,
+                                 ph, table);
+    }
+
+    clean(A);
+    clean(table);
+    return result;
+}
+
+/**
+ * \brief Decodes a public key into the negated point that verify() uses.
+ *
+ * \param A The point -A.
+ * \param publicKey The public key A.
+ *
+ * \return Returns false if \a publicKey is not a valid point.
+ */
+bool Ed25519::decodeKey(Point &A, const uint8_t publicKey[32])
+{
+    limb_t zero[NUM_LIMBS_FIELD25519];
+
+    if (!decodePoint(A, publicKey))
+        return false;
+    memset(zero, 0, sizeof(zero));
+    Curve25519::sub(A.x, zero, A.x);
+    Curve25519::sub(A.t, zero, A.t);
+    return true;
+}
+
+/**
+ * \brief Verifies a signature against a decoded public key.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The public key to use to verify the signature.
+ * \param source Function that writes the message into the hash.
+ * \param context Context pointer for \a source.
+ * \param ph The context string for Ed25519ph, or NULL for Ed25519.
+ * \param table The odd multiples of -A from decodeKey() and oddMultiples().
+ *
+ * \return Returns true if the \a signature is valid.
+ */
+bool Ed25519::verifyWithTable(const uint8_t signature[64],
+                              const uint8_t publicKey[32],
+                              MessageSource source, void *context,
+                              const PrehashContext *ph,
+                              const CachedPoint *table)
+{
+    SHA512 hash;
+    Point Q;
+    limb_t s[NUM_LIMBS_256BIT];
+    limb_t k[NUM_LIMBS_256BIT];
+    limb_t t[NUM_LIMBS_512BIT + 1];
+    uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    bool result = false;
+
+    // Reject s values that are not reduced modulo q (RFC 8032,
+    // section 5.1.7).
+    BigNumberUtil::unpackLE(s, NUM_LIMBS_256BIT, signature + 32, 32);
+    if (!BigNumberUtil::sub_P(t, s, numQ, NUM_LIMBS_256BIT))
+        goto cleanup;
+
+    // Reconstruct the k value from the signing step.
+    hash.reset();
+    hashDomain(&hash, ph);
+    hash.update(signature, 32);
+    hash.update(publicKey, 32);
+    (*source)(&hash, context);
+    hash.finalize(buf, 0);
+    reduceQFromBuffer(k, buf, t);
+
+    // Calculate s * B + k * (-A) from the odd multiples of -A.  R is not
+    // decoded: the result is encoded and compared with it instead, which
+    // is cheaper.
+    mulDouble(Q, s, k, table);
+
+    // The signature is valid if the result encodes to R.
+    encodePoint(buf, Q);
+    result = secure_compare(buf, signature, 32);
+
+    // Clean up and exit.
+cleanup:
+    clean(Q);
+    clean(s);
+    clean(k);
+    clean(t);
+    return result;
+}
+
+/**
+ * \brief Verifies a batch of signatures, each with its own public key.
+ *
+ * \param signatures Points to the signature of each message.
+ * \param publicKeys Points to the public key of each signature.
+ * \param messages Points to each message whose signature is to be verified.
+ * \param lens The length of each message.
+ * \param count The number of signatures.
+ * \param valid If not NULL, an array of \a count entries that receives
+ * the result for each signature.
+ *
+ * \return Returns true if all signatures are valid; false otherwise.
+ *
+ * Groups of up to ED25519_BATCH_SIZE signatures are checked with a single
+ * equation: the sum of their verification equations, each multiplied by a
+ * random 128-bit value from \link RNGClass::rand() RNG.rand()\endlink.
+ * The sum is evaluated with one multi-scalar multiplication (Pippenger's
+ * bucket method), which costs much less per signature than verify().
+ * If the check of a group fails, its signatures are verified one at a
+ * time to find the invalid ones.
+ *
+ * A group of valid signatures always passes.  An invalid signature makes
+ * the check fail except with negligible probability, unless it was crafted
+ * with a small-order component: such a signature can pass with a
+ * probability of up to 1/8 where verify() would reject it.  Use verify()
+ * where every single signature must be decided exactly.
+ *
+ * The working memory is allocated from the heap.  If it is not available,
+ * all signatures are verified one at a time.
+ *
+ * \sa verify()
+ */
+bool Ed25519::verifyBatch(const uint8_t *const *signatures,
+                          const uint8_t *const *publicKeys,
+                          const void *const *messages, const size_t *lens,
+                          size_t count, bool *valid)
+{
+    size_t chunk = (count < ED25519_BATCH_SIZE) ? count : ED25519_BATCH_SIZE;
+    size_t posn, n, i;
+    size_t size;
+    uint8_t width;
+    uint8_t *mem;
+    bool result = true;
+
+    // Pick the window width for the largest group: about log2 of the
+    // number of points, minus 2.  The last group may be smaller but uses
+    // the same.
+    for (width = 3; width < ED25519_BATCH_MAX_WIDTH &&
+            (((size_t)4) << width) < 2 * chunk; ++width)
+        ;
+
+    // Points, scalars and buckets first to keep them aligned, then digits.
+    size = 2 * chunk * (sizeof(CachedPoint) + sizeof(limb_t) * NUM_LIMBS_256BIT +
+                        ED25519_BATCH_WINDOWS(width)) +
+           (((size_t)1) << (width - 1)) * sizeof(Point);
+    mem = (chunk >= ED25519_BATCH_MIN) ? (uint8_t *)malloc(size) : 0;
+
+    for (posn = 0; posn < count; posn += n) {
+        n = count - posn;
+        if (n > chunk)
+            n = chunk;
+        if (mem && n >= ED25519_BATCH_MIN) {
+            CachedPoint *points = (CachedPoint *)mem;
+            limb_t *scalars = (limb_t *)(points + 2 * chunk);
+            Point *buckets = (Point *)(scalars + 2 * chunk * NUM_LIMBS_256BIT);
+            int8_t *digits = (int8_t *)(buckets + (((size_t)1) << (width - 1)));
+            if (verifyChunk(signatures + posn, publicKeys + posn,
+                            messages + posn, lens + posn, n,
+                            points, scalars, digits, buckets, width)) {
+                if (valid) {
+                    for (i = 0; i < n; ++i)
+                        valid[posn + i] = true;
+                }
+                continue;
+            }
+        }
+
+        // Find the invalid signatures one at a time.
+        for (i = 0; i < n; ++i) {
+            bool ok = verify(signatures[posn + i], publicKeys[posn + i],
+                             messages[posn + i], lens[posn + i]);
+            if (valid)
+                valid[posn + i] = ok;
+            if (!ok)
+                result = false;
+        }
+    }
+
+    if (mem) {
+        clean(mem, size);
+        free(mem);
+    }
+    return result;
+}
+
+/**
+ * \brief Checks a group of signatures with a single equation.
+ *
+ * \param signatures Points to the signature of each message.
+ * \param publicKeys Points to the public key of each signature.
+ * \param messages Points to each message.
+ * \param lens The length of each message.
+ * \param count The number of signatures in the group.
+ * \param points Space for 2 * \a count points.
+ * \param scalars Space for 2 * \a count values of NUM_LIMBS_256BIT limbs.
+ * \param digits Space for 2 * \a count * ED25519_BATCH_WINDOWS(\a width) digits.
+ * \param buckets Space for 2^(\a width - 1) points.
+ * \param width The window width for mulMulti().
+ *
+ * \return Returns true if z_i * (s_i * B - R_i - k_i * A_i) sums to zero
+ * for random z_i, or false if it does not or any value fails to decode.
+ *
+ * \sa verifyBatch()
+ */
+bool Ed25519::verifyChunk(const uint8_t *const *signatures,
+                          const uint8_t *const *publicKeys,
+                          const void *const *messages, const size_t *lens,
+                          size_t count, CachedPoint *points, limb_t *scalars,
+                          int8_t *digits, Point *buckets, uint8_t width)
+{
+    SHA512 hash;
+    Point P;
+    Point Q;
+    limb_t sum[NUM_LIMBS_256BIT];
+    limb_t s[NUM_LIMBS_256BIT];
+    limb_t t[NUM_LIMBS_512BIT + 1];
+    uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    limb_t check;
+    size_t i;
+    bool result = false;
+
+    memset(sum, 0, sizeof(sum));
+    for (i = 0; i < count; ++i) {
+        const uint8_t *signature = signatures[i];
+        limb_t *z = scalars + 2 * i * NUM_LIMBS_256BIT;
+        limb_t *zk = z + NUM_LIMBS_256BIT;
+
+        // Reject s values that are not reduced modulo q, then decode
+        // R and A into the points of the sum.
+        BigNumberUtil::unpackLE(s, NUM_LIMBS_256BIT, signature + 32, 32);
+        if (!BigNumberUtil::sub_P(t, s, numQ, NUM_LIMBS_256BIT))
+            goto cleanup;
+        if (!decodePoint(P, signature))
+            goto cleanup;
+        toCached(points[2 * i], P);
+        if (!decodePoint(P, publicKeys[i]))
+            goto cleanup;
+        toCached(points[2 * i + 1], P);
+
         // Reconstruct the k value from the signing step.
         hash.reset();
         hash.update(signature, 32);
-        hash.update(publicKey, 32);
-        hash.update(message, len);
-        hash.finalize(k, 0);
-
-        // Calculate s * B.  The s value is stored temporarily in kA.t.
-        BigNumberUtil::unpackLE(kA.t, NUM_LIMBS_256BIT, signature + 32, 32);
-        mul(sB, kA.t, false);
-
-        // Calculate R + k * A.  We don't need sB.t in equal() below,
-        // so we reuse that as a temporary buffer when reducing k.
-        reduceQFromBuffer(sB.t, k, kA.x);
-        mul(kA, sB.t, A, false);
-        add(R, kA);
-
-        // Compare s * B and R + k * A for equality.
-        result = equal(sB, R);
+        hash.update(publicKeys[i], 32);
+        hash.update(messages[i], lens[i]);
+        hash.finalize(buf, 0);
+        reduceQFromBuffer(zk, buf, t);
+
+        // Pick the random z and scale the equation: z * R, z * k * A,
+        // and add z * s to the multiple of B.
+        RNG.rand(buf, 16);
+        BigNumberUtil::unpackLE(z, NUM_LIMBS_256BIT, buf, 16);
+        Curve25519::mulNoReduce(t, z, zk);
+        t[NUM_LIMBS_512BIT] = 0;
+        reduceQ(zk, t);
+        Curve25519::mulNoReduce(t, z, s);
+        t[NUM_LIMBS_512BIT] = 0;
+        reduceQ(t, t);
+        BigNumberUtil::add(sum, sum, t, NUM_LIMBS_256BIT);
+        BigNumberUtil::reduceQuick_P(sum, sum, numQ, NUM_LIMBS_256BIT);
     }
 
-    // Clean up and exit.
-    clean(A);
-    clean(R);
-    clean(sB);
-    clean(kA);
+    // Compute the sum of z * R + z * k * A and subtract sum(z * s) * B.
+    mulMulti(P, points, scalars, 2 * count, digits, buckets, width);
+    mul(Q, sum, false);
+    memset(t, 0, sizeof(limb_t) * NUM_LIMBS_FIELD25519);
+    Curve25519::sub(Q.x, t, Q.x);
+    Curve25519::sub(Q.t, t, Q.t);
+    add(P, Q);
+
+    // The result must be the neutral point, which encodes as y = 1.
+    encodePoint(buf, P);
+    check = buf[0] ^ 0x01;
+    for (i = 1; i < 32; ++i)
+        check |= buf[i];
+    result = !check;
+
+cleanup:
+    clean(P);
+    clean(Q);
+    clean(sum);
+    clean(s);
+    clean(t);
     return result;
 }
 
@@ -271,6 +870,27 @@ void Ed25519::derivePublicKey(uint8_t publicKey[32], const uint8_t privateKey[32
     clean(ptA);
 }
 
+/**
+ * \brief Expands an Ed25519 private key for use with signExpanded().
+ *
+ * \param expandedKey The 64-byte expanded key: the clamped secret scalar,
+ * followed by the message prefix.
+ * \param privateKey The private key.
+ *
+ * The expanded key is as sensitive as the private key itself.
+ *
+ * \sa signExpanded(), derivePublicKey()
+ */
+void Ed25519::expandPrivateKey(uint8_t expandedKey[64], const uint8_t privateKey[32])
+{
+    SHA512 hash;
+    hash.update(privateKey, 32);
+    hash.finalize(expandedKey, 64);
+    expandedKey[0]  &= 0xF8;
+    expandedKey[31] &= 0x7F;
+    expandedKey[31] |= 0x40;
+}
+
 /**
  * \brief Reduces a number modulo q that was specified in a 512 bit buffer.
  *
@@ -301,61 +921,96 @@ void Ed25519::reduceQFromBuffer(limb_t *result, const uint8_t buf[64], limb_t *t
  */
 void Ed25519::reduceQ(limb_t *result, limb_t *r)
 {
-    // Algorithm from: http://en.wikipedia.org/wiki/Barrett_reduction
-    //
-    // We assume that r is less than or equal to (q - 1)^2.
-    //
-    // We want to compute result = r mod q.  Find the smallest k such
-    // that 2^k > q.  In our case, k = 253.  Then set m = floor(4^k / q)
-    // and let r = r - q * floor(m * r / 4^k).  This will be the result
-    // or it will be at most one subtraction of q away from the result.
-    //
-    // Note: 4^k = 4^253 = 2^506 = 2^512/2^6.  We can more easily compute
-    // the result we want if we set m = floor(4^k * 2^6 / q) instead and
-    // then r = r - q * floor(m * r / 2^512).  Because the slight extra
-    // precision in m, r is at most two subtractions of q away from the
-    // final result.
-    static limb_t const numM[NUM_LIMBS_256BIT + 1] PROGMEM = {
-        LIMB_PAIR(0x0A2C131B, 0xED9CE5A3), LIMB_PAIR(0x086329A7, 0x2106215D),
-        LIMB_PAIR(0xFFFFFFEB, 0xFFFFFFFF), LIMB_PAIR(0xFFFFFFFF, 0xFFFFFFFF),
-        0x0F
-    };
-    limb_t temp[NUM_LIMBS_512BIT + NUM_LIMBS_256BIT + 1];
-
-    // Multiply r by m.
-    BigNumberUtil::mul_P(temp, r, NUM_LIMBS_512BIT, numM, NUM_LIMBS_256BIT + 1);
-
-    // Multiply (m * r) / 2^512 by q and subtract it from r.
-    // We can ignore the high words of the subtraction result
-    // because they will all turn into zero after the subtraction.
-    BigNumberUtil::mul_P(temp, temp + NUM_LIMBS_512BIT, NUM_LIMBS_256BIT + 1,
-                         numQ, NUM_LIMBS_256BIT);
-    BigNumberUtil::sub(r, r, temp, NUM_LIMBS_256BIT);
-
-    // Perform two subtractions of q from the result to reduce it.
-    BigNumberUtil::reduceQuick_P(result, r, numQ, NUM_LIMBS_256BIT);
-    BigNumberUtil::reduceQuick_P(result, result, numQ, NUM_LIMBS_256BIT);
-
-    // Clean up and exit.
-    clean(temp);
+    // Montgomery reduction divides by R = 2^256, and then multiplying
+    // by R^2 mod q in Montgomery form restores the factor of R.  This
+    // holds for any 512-bit value, so the top limb of r is ignored.
+    BigNumberUtil::reduceMod<Ed25519ModQ>(result, r);
 }
 
 /**
  * \brief Multiplies a value by a curve point.
  *
  * \param result The result of the multiplication.
- * \param s The value, which must be NUM_LIMBS_256BIT limbs in size.
- * \param p The curve point, which will be modified by this function.
+ * \param s The value, which must be NUM_LIMBS_256BIT limbs in size
+ * and less than 2^255.
+ * \param p The curve point, which may be modified by this function.
  * \param constTime Set to true if the evaluation must be constant-time
  * because \a s is a secret value.
+ *
+ * With ED25519_MUL_WINDOW set, \a s is split into signed digits of that
+ * many bits and the multiples 1 * p to 2^(width - 1) * p are computed up
+ * front.  Each digit then costs width doublings and one addition of the
+ * multiple selected by selectMultiple(), which reads every entry.
  */
 void Ed25519::mul(Point &result, const limb_t *s, Point &p, bool constTime)
 {
+#if ED25519_MUL_WINDOW
+    CachedPoint table[ED25519_MUL_ENTRIES];
+    CachedPoint c;
+    uint8_t bytes[33];
+    int8_t e[ED25519_MUL_DIGITS];
+    int8_t carry;
+    uint8_t posn, t;
+
+    // Compute the multiples 1 * p to 2^(width - 1) * p in cached form.
+    toCached(table[0], p);
+    memcpy(&result, &p, sizeof(Point));
+    for (posn = 1; posn < ED25519_MUL_ENTRIES; ++posn) {
+        add(result, table[0]);
+        toCached(table[posn], result);
+    }
+
+    // Split s into digits of ED25519_MUL_WINDOW bits and recode them
+    // into the range -2^(width - 1) to 2^(width - 1).  The top digit
+    // holds fewer than width bits so the final carry cannot overflow it.
+    BigNumberUtil::packLE(bytes, 32, s, NUM_LIMBS_256BIT);
+    bytes[31] &= 0x7F;
+    bytes[32] = 0;
+    carry = 0;
+    for (posn = 0; posn < ED25519_MUL_DIGITS; ++posn) {
+        uint16_t bit = posn * ED25519_MUL_WINDOW;
+        uint16_t window = bytes[bit / 8] | (((uint16_t)(bytes[bit / 8 + 1])) << 8);
+        e[posn] = (int8_t)((window >> (bit % 8)) &
+                           ((1 << ED25519_MUL_WINDOW) - 1)) + carry;
+        if (posn < (ED25519_MUL_DIGITS - 1)) {
+            carry = (e[posn] + ED25519_MUL_ENTRIES) >> ED25519_MUL_WINDOW;
+            e[posn] -= carry << ED25519_MUL_WINDOW;
+        }
+    }
+
+    // Initialize the result to (0, 1, 1, 0).
+    memset(&result, 0, sizeof(Point));
+    result.y[0] = 1;
+    result.z[0] = 1;
+
+    // Process the digits from highest to lowest.
+    for (posn = ED25519_MUL_DIGITS; posn > 0; --posn) {
+        int8_t digit = e[posn - 1];
+        if (posn != ED25519_MUL_DIGITS) {
+            for (t = 0; t < ED25519_MUL_WINDOW; ++t)
+                dbl(result);
+        }
+        if (constTime) {
+            selectMultiple(c, table, digit);
+            add(result, c);
+        } else if (digit > 0) {
+            add(result, table[digit - 1]);
+        } else if (digit < 0) {
+            add(result, table[-digit - 1], true);
+        }
+    }
+
+    // Clean up.
+    clean(table);
+    clean(c);
+    clean(bytes);
+    clean(e);
+#else
     Point q;
-    limb_t A[NUM_LIMBS_256BIT];
-    limb_t B[NUM_LIMBS_256BIT];
-    limb_t C[NUM_LIMBS_256BIT];
-    limb_t D[NUM_LIMBS_256BIT];
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
     limb_t mask, select;
     uint8_t sposn, t;
 
@@ -409,22 +1064,7 @@ void Ed25519::mul(Point &result, const limb_t *s, Point &p, bool constTime)
         }
 
         // Double p for the next iteration.
-        Curve25519::sub(A, p.y, p.x);
-        Curve25519::square(A, A);
-        Curve25519::add(B, p.y, p.x);
-        Curve25519::square(B, B);
-        Curve25519::square(C, p.t);
-        Curve25519::mul_P(C, C, numDx2);
-        Curve25519::square(D, p.z);
-        Curve25519::add(D, D, D);
-        Curve25519::sub(p.t, B, A);             // E = B - A
-        Curve25519::sub(p.z, D, C);             // F = D - C
-        Curve25519::add(D, D, C);               // G = D + C
-        Curve25519::add(B, B, A);               // H = B + A
-        Curve25519::mul(p.x, p.t, p.z);         // p.x = E * F
-        Curve25519::mul(p.y, D, B);             // p.y = G * H
-        Curve25519::mul(p.z, p.z, D);           // p.z = F * G
-        Curve25519::mul(p.t, p.t, B);           // p.t = E * H
+        dbl(p);
 
         // Move onto the next bit of s from lowest to highest.
         if (mask != (((limb_t)1) << (LIMB_BITS - 1))) {
@@ -441,25 +1081,353 @@ void Ed25519::mul(Point &result, const limb_t *s, Point &p, bool constTime)
     clean(B);
     clean(C);
     clean(D);
+#endif
 }
 
 /**
  * \brief Multiplies a value by the base point of the curve.
  *
  * \param result The result of the multiplication.
- * \param s The value, which must be NUM_LIMBS_256BIT limbs in size.
+ * \param s The value, which must be NUM_LIMBS_256BIT limbs in size
+ * and less than 2^255.
  * \param constTime Set to true if the evaluation must be constant-time
  * because \a s is a secret values.
+ *
+ * With the precomputed table, \a s is split into 64 signed radix-16 digits
+ * in the range -8 to 8 and each digit selects its multiple of B from the
+ * table in constant time, so \a constTime is not needed.
  */
 void Ed25519::mul(Point &result, const limb_t *s, bool constTime)
 {
+#if ED25519_BASE_TABLE_SPACING
+    PrecomputedPoint P;
+    int8_t e[64];
+    int8_t carry;
+    uint8_t posn, row;
+    (void)constTime;
+
+    // Unpack s into 64 radix-16 digits, highest byte first so that the
+    // digits can be expanded in place.
+    BigNumberUtil::packLE((uint8_t *)e, 32, s, NUM_LIMBS_256BIT);
+    for (posn = 32; posn > 0; --posn) {
+        uint8_t b = (uint8_t)(e[posn - 1]);
+        e[posn * 2 - 1] = (int8_t)(b >> 4);
+        e[posn * 2 - 2] = (int8_t)(b & 0x0F);
+    }
+
+    // Recode the digits into the range -8 to 8.  The top digit of s is
+    // at most 7 so the final carry cannot push it beyond 8.
+    carry = 0;
+    for (posn = 0; posn < 63; ++posn) {
+        e[posn] += carry;
+        carry = (e[posn] + 8) >> 4;
+        e[posn] -= carry << 4;
+    }
+    e[63] += carry;
+
+    // Initialize the result to (0, 1, 1, 0).
+    memset(&result, 0, sizeof(Point));
+    result.y[0] = 1;
+    result.z[0] = 1;
+
+    // Sum the table entries selected by each digit, with the digits
+    // between the table rows handled by multiplying the result by 16.
+    for (posn = ED25519_BASE_TABLE_SPACING; posn > 0; --posn) {
+        if (posn != ED25519_BASE_TABLE_SPACING) {
+            dbl(result);
+            dbl(result);
+            dbl(result);
+            dbl(result);
+        }
+        for (row = 0; row < (64 / ED25519_BASE_TABLE_SPACING); ++row) {
+            selectBase(P, row, e[row * ED25519_BASE_TABLE_SPACING + posn - 1]);
+            add(result, P);
+        }
+    }
+
+    // Clean up.
+    clean(P);
+    clean(e);
+#else
     Point P;
-    memcpy_P(P.x, numBx, sizeof(P.x));
-    memcpy_P(P.y, numBy, sizeof(P.y));
-    memcpy_P(P.z, numBz, sizeof(P.z));
-    memcpy_P(P.t, numBt, sizeof(P.t));
+    Curve25519::load_P(P.x, numBx);
+    Curve25519::load_P(P.y, numBy);
+    Curve25519::load_P(P.z, numBz);
+    Curve25519::load_P(P.t, numBt);
     mul(result, s, P, constTime);
     clean(P);
+#endif
+}
+
+/**
+ * \brief Computes s * B + k * P for public values.
+ *
+ * \param result The result of the computation.
+ * \param s The multiple of the base point, which must be less than q.
+ * \param k The multiple of P, which must be less than q.
+ * \param table The odd multiples 1 * P to 15 * P, from oddMultiples().
+ *
+ * Both values are written in non-adjacent form and share one chain of
+ * doublings (Straus-Shamir).  This is not constant-time: the additions
+ * follow the digits of \a s and \a k.
+ */
+void Ed25519::mulDouble(Point &result, const limb_t *s, const limb_t *k,
+                        const CachedPoint *table)
+{
+#if ED25519_BASE_TABLE_SPACING
+    PrecomputedPoint P;
+#else
+    CachedPoint tableB[ED25519_NAF_ENTRIES];
+#endif
+    int8_t nafS[256];
+    int8_t nafK[256];
+    int16_t posn;
+    int8_t digit;
+
+    naf(nafS, s, ED25519_NAF_BASE_WIDTH);
+    naf(nafK, k, ED25519_NAF_WIDTH);
+
+#if !ED25519_BASE_TABLE_SPACING
+    // Compute the odd multiples of B.
+    Curve25519::load_P(result.x, numBx);
+    Curve25519::load_P(result.y, numBy);
+    Curve25519::load_P(result.z, numBz);
+    Curve25519::load_P(result.t, numBt);
+    oddMultiples(tableB, result, ED25519_NAF_ENTRIES);
+#endif
+
+    // Initialize the result to (0, 1, 1, 0).
+    memset(&result, 0, sizeof(Point));
+    result.y[0] = 1;
+    result.z[0] = 1;
+
+    // Skip the leading zero digits, then double once per digit and
+    // add or subtract the multiples selected by non-zero digits.
+    posn = 255;
+    while (posn >= 0 && !nafS[posn] && !nafK[posn])
+        --posn;
+    for (; posn >= 0; --posn) {
+        dbl(result);
+        digit = nafS[posn];
+        if (digit) {
+#if ED25519_BASE_TABLE_SPACING
+            const limb_t *entry = baseOddTable[(digit < 0 ? -digit : digit) / 2];
+            Curve25519::load_P(P.ypx, entry);
+            Curve25519::load_P(P.ymx, entry + NUM_LIMBS_256BIT);
+            Curve25519::load_P(P.xy2d, entry + 2 * NUM_LIMBS_256BIT);
+            add(result, P, digit < 0);
+#else
+            add(result, tableB[(digit < 0 ? -digit : digit) / 2], digit < 0);
+#endif
+        }
+        digit = nafK[posn];
+        if (digit)
+            add(result, table[(digit < 0 ? -digit : digit) / 2], digit < 0);
+    }
+
+    // Clean up.
+#if ED25519_BASE_TABLE_SPACING
+    clean(P);
+#else
+    clean(tableB);
+#endif
+    clean(nafS);
+    clean(nafK);
+}
+
+/**
+ * \brief Computes the odd multiples of a curve point for mulDouble().
+ *
+ * \param table The odd multiples 1 * p, 3 * p, ... in cached form.
+ * \param p The curve point.
+ * \param count The number of multiples to compute.
+ */
+void Ed25519::oddMultiples(CachedPoint *table, const Point &p, uint8_t count)
+{
+    Point p2;
+    Point q;
+    uint8_t posn;
+
+    memcpy(&p2, &p, sizeof(Point));
+    dbl(p2);
+    memcpy(&q, &p, sizeof(Point));
+    for (posn = 0; posn < count; ++posn) {
+        if (posn)
+            add(q, p2);
+        toCached(table[posn], q);
+    }
+
+    clean(p2);
+    clean(q);
+}
+
+/**
+ * \brief Converts a curve point into cached form.
+ *
+ * \param c The cached point.
+ * \param p The curve point.
+ */
+void Ed25519::toCached(CachedPoint &c, const Point &p)
+{
+    Curve25519::add(c.ypx, p.y, p.x);
+    Curve25519::sub(c.ymx, p.y, p.x);
+    Curve25519::add(c.z2, p.z, p.z);
+    Curve25519::mul_P(c.t2d, p.t, numDx2);
+}
+
+/**
+ * \brief Computes the sum of multiples of many points for public values.
+ *
+ * \param result The result of the computation.
+ * \param points The points to multiply.
+ * \param scalars The multiple of each point, NUM_LIMBS_256BIT limbs each
+ * and less than 2^253.
+ * \param count The number of points.
+ * \param digits Space for \a count * ED25519_BATCH_WINDOWS(\a width) digits.
+ * \param buckets Space for 2^(\a width - 1) points.
+ * \param width The window width, between 2 and 7.
+ *
+ * Uses Pippenger's bucket method: for each window of \a width bits, from
+ * the highest, every point is added to the bucket selected by its signed
+ * digit, and the buckets are summed with their weights in two additions
+ * each.  This is not constant-time.
+ */
+void Ed25519::mulMulti(Point &result, const CachedPoint *points,
+                       const limb_t *scalars, size_t count,
+                       int8_t *digits, Point *buckets, uint8_t width)
+{
+    Point sum;
+    uint8_t bytes[33];
+    uint8_t used[1 << (ED25519_BATCH_MAX_WIDTH - 1)];
+    bool started = false;
+    bool summed;
+    uint8_t windows = ED25519_BATCH_WINDOWS(width);
+    uint8_t nbuckets = 1 << (width - 1);
+    uint16_t posn;
+    uint16_t bits;
+    uint8_t carry;
+    uint8_t w, b;
+    int8_t digit;
+    size_t i;
+
+    // Recode each scalar into signed digits between -2^(width - 1) and
+    // 2^(width - 1) - 1, lowest first.
+    for (i = 0; i < count; ++i) {
+        BigNumberUtil::packLE(bytes, 32, scalars + i * NUM_LIMBS_256BIT,
+                              NUM_LIMBS_256BIT);
+        bytes[32] = 0;
+        carry = 0;
+        for (w = 0; w < windows; ++w) {
+            posn = w * width;
+            if (posn < 256) {
+                bits = bytes[posn / 8] | (((uint16_t)(bytes[posn / 8 + 1])) << 8);
+                bits = (bits >> (posn % 8)) & ((1 << width) - 1);
+            } else {
+                bits = 0;
+            }
+            bits += carry;
+            carry = (bits >= nbuckets);
+            digits[i * windows + w] = (int8_t)(bits - (((uint16_t)carry) << width));
+        }
+    }
+
+    // Initialize the result to (0, 1, 1, 0).  Empty buckets and sums are
+    // tracked so that no time is spent adding or doubling the neutral point.
+    memset(&result, 0, sizeof(Point));
+    result.y[0] = 1;
+    result.z[0] = 1;
+
+    for (w = windows; w > 0; --w) {
+        if (started) {
+            for (b = 0; b < width; ++b)
+                dbl(result);
+        }
+
+        // Sort the points of this window into the buckets.
+        memset(used, 0, nbuckets);
+        for (i = 0; i < count; ++i) {
+            digit = digits[i * windows + w - 1];
+            if (!digit)
+                continue;
+            b = (uint8_t)(((digit < 0) ? -digit : digit) - 1);
+            if (!used[b]) {
+                memset(&(buckets[b]), 0, sizeof(Point));
+                buckets[b].y[0] = 1;
+                buckets[b].z[0] = 1;
+                used[b] = 1;
+            }
+            add(buckets[b], points[i], digit < 0);
+        }
+
+        // Add (b + 1) * buckets[b] to the result as a running sum.
+        summed = false;
+        for (b = nbuckets; b > 0; --b) {
+            if (used[b - 1]) {
+                if (summed) {
+                    add(sum, buckets[b - 1]);
+                } else {
+                    memcpy(&sum, &(buckets[b - 1]), sizeof(Point));
+                    summed = true;
+                }
+            }
+            if (!summed)
+                continue;
+            if (started) {
+                add(result, sum);
+            } else {
+                memcpy(&result, &sum, sizeof(Point));
+                started = true;
+            }
+        }
+    }
+
+    clean(sum);
+    clean(bytes);
+}
+
+/**
+ * \brief Writes a value in width-w non-adjacent form.
+ *
+ * \param digits The 256 digits of the result, lowest first.  Each one is
+ * zero or odd with an absolute value less than 2^(width - 1), and any
+ * non-zero digit is followed by at least width - 1 zeroes.
+ * \param s The value, which must be NUM_LIMBS_256BIT limbs in size
+ * and less than 2^255.
+ * \param width The width of the form, between 2 and 8.
+ */
+void Ed25519::naf(int8_t *digits, const limb_t *s, uint8_t width)
+{
+    uint8_t bytes[33];
+    uint16_t posn;
+    uint16_t window;
+    uint8_t carry;
+
+    BigNumberUtil::packLE(bytes, 32, s, NUM_LIMBS_256BIT);
+    bytes[32] = 0;
+    memset(digits, 0, 256);
+
+    // Scan the bits from lowest to highest.  Where the next window plus
+    // the carry is odd, make it a signed digit and skip the window.
+    carry = 0;
+    posn = 0;
+    while (posn < 256) {
+        window = bytes[posn / 8] | (((uint16_t)(bytes[posn / 8 + 1])) << 8);
+        window = ((window >> (posn % 8)) & ((1 << width) - 1)) + carry;
+        if (!(window & 1)) {
+            ++posn;
+            continue;
+        }
+        if (window < (1 << (width - 1))) {
+            digits[posn] = (int8_t)window;
+            carry = 0;
+        } else {
+            digits[posn] = (int8_t)(window - (1 << width));
+            carry = 1;
+        }
+        posn += width;
+    }
+
+    clean(bytes);
 }
 
 /**
@@ -470,29 +1438,116 @@ void Ed25519::mul(Point &result, const limb_t *s, bool constTime)
  */
 void Ed25519::add(Point &p, const Point &q)
 {
-    limb_t A[NUM_LIMBS_256BIT];
-    limb_t B[NUM_LIMBS_256BIT];
-    limb_t C[NUM_LIMBS_256BIT];
-    limb_t D[NUM_LIMBS_256BIT];
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+    limb_t *const temps[4] = {A, B, C, D};
+    const limb_t *const lhs1[4] = {A, B, p.t, p.z};
+    const limb_t *const rhs1[4] = {C, D, q.t, q.z};
+    limb_t *const out[4] = {p.x, p.y, p.z, p.t};
+    const limb_t *const lhs[4] = {p.t, D, p.z, p.t};
+    const limb_t *const rhs[4] = {p.z, B, D, B};
 
     Curve25519::sub(A, p.y, p.x);
-    Curve25519::sub(C, q.y, q.x);
-    Curve25519::mul(A, A, C);
     Curve25519::add(B, p.y, p.x);
-    Curve25519::add(C, q.y, q.x);
-    Curve25519::mul(B, B, C);
-    Curve25519::mul(C, p.t, q.t);
+    Curve25519::sub(C, q.y, q.x);
+    Curve25519::add(D, q.y, q.x);
+    Curve25519::mul4(temps, lhs1, rhs1);
     Curve25519::mul_P(C, C, numDx2);
-    Curve25519::mul(D, p.z, q.z);
     Curve25519::add(D, D, D);
     Curve25519::sub(p.t, B, A);             // E = B - A
     Curve25519::sub(p.z, D, C);             // F = D - C
     Curve25519::add(D, D, C);               // G = D + C
     Curve25519::add(B, B, A);               // H = B + A
-    Curve25519::mul(p.x, p.t, p.z);         // p.x = E * F
-    Curve25519::mul(p.y, D, B);             // p.y = G * H
-    Curve25519::mul(p.z, p.z, D);           // p.z = F * G
-    Curve25519::mul(p.t, p.t, B);           // p.t = E * H
+    Curve25519::mul4(out, lhs, rhs);        // p = (E * F, G * H, F * G, E * H)
+
+    clean(A);
+    clean(B);
+    clean(C);
+    clean(D);
+}
+
+/**
+ * \brief Adds a precomputed curve point to another point.
+ *
+ * \param p The first point and the result.
+ * \param q The precomputed point to add.
+ * \param negate Set to true to subtract \a q instead.  The choice is
+ * not constant-time.
+ *
+ * This saves two multiplications over adding a point in extended
+ * co-ordinates because \a q has z = 1 and 2 * d * t already applied.
+ */
+void Ed25519::add(Point &p, const PrecomputedPoint &q, bool negate)
+{
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+    limb_t *const out[4] = {p.x, p.y, p.z, p.t};
+    const limb_t *const lhs[4] = {p.t, D, p.z, p.t};
+    const limb_t *const rhs[4] = {p.z, B, D, B};
+
+    // -(x, y) = (-x, y) swaps y + x with y - x and negates 2 * d * x * y.
+    Curve25519::sub(A, p.y, p.x);
+    Curve25519::mul(A, A, negate ? q.ypx : q.ymx);
+    Curve25519::add(B, p.y, p.x);
+    Curve25519::mul(B, B, negate ? q.ymx : q.ypx);
+    Curve25519::mul(C, p.t, q.xy2d);
+    Curve25519::add(D, p.z, p.z);
+    Curve25519::sub(p.t, B, A);             // E = B - A
+    if (negate) {
+        Curve25519::add(p.z, D, C);         // F = D + C
+        Curve25519::sub(D, D, C);           // G = D - C
+    } else {
+        Curve25519::sub(p.z, D, C);         // F = D - C
+        Curve25519::add(D, D, C);           // G = D + C
+    }
+    Curve25519::add(B, B, A);               // H = B + A
+    Curve25519::mul4(out, lhs, rhs);        // p = (E * F, G * H, F * G, E * H)
+
+    clean(A);
+    clean(B);
+    clean(C);
+    clean(D);
+}
+
+/**
+ * \brief Adds a cached curve point to another point.
+ *
+ * \param p The first point and the result.
+ * \param q The cached point to add.
+ * \param negate Set to true to subtract \a q instead.  The choice is
+ * not constant-time.
+ */
+void Ed25519::add(Point &p, const CachedPoint &q, bool negate)
+{
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+    limb_t *const temps[4] = {A, B, C, D};
+    const limb_t *const lhs1[4] = {A, B, p.t, p.z};
+    const limb_t *const rhs1[4] = {negate ? q.ypx : q.ymx,
+                                   negate ? q.ymx : q.ypx, q.t2d, q.z2};
+    limb_t *const out[4] = {p.x, p.y, p.z, p.t};
+    const limb_t *const lhs[4] = {p.t, D, p.z, p.t};
+    const limb_t *const rhs[4] = {p.z, B, D, B};
+
+    Curve25519::sub(A, p.y, p.x);
+    Curve25519::add(B, p.y, p.x);
+    Curve25519::mul4(temps, lhs1, rhs1);
+    Curve25519::sub(p.t, B, A);             // E = B - A
+    if (negate) {
+        Curve25519::add(p.z, D, C);         // F = D + C
+        Curve25519::sub(D, D, C);           // G = D - C
+    } else {
+        Curve25519::sub(p.z, D, C);         // F = D - C
+        Curve25519::add(D, D, C);           // G = D + C
+    }
+    Curve25519::add(B, B, A);               // H = B + A
+    Curve25519::mul4(out, lhs, rhs);        // p = (E * F, G * H, F * G, E * H)
 
     clean(A);
     clean(B);
@@ -500,6 +1555,143 @@ void Ed25519::add(Point &p, const Point &q)
     clean(D);
 }
 
+/**
+ * \brief Doubles a curve point.
+ *
+ * \param p The point to double and the result.
+ *
+ * Uses the dedicated doubling formula from RFC 8032, section 5.1.4,
+ * which needs 4 squarings and 4 multiplications.
+ */
+void Ed25519::dbl(Point &p)
+{
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t H[NUM_LIMBS_FIELD25519];
+    limb_t *const squares[4] = {A, B, C, p.t};
+    const limb_t *const in[4] = {p.x, p.y, p.z, p.t};
+    limb_t *const out[4] = {p.x, p.y, p.t, p.z};
+    const limb_t *const lhs[4] = {p.t, A, p.t, B};
+    const limb_t *const rhs[4] = {B, H, H, A};
+
+    Curve25519::add(p.t, p.x, p.y);
+    Curve25519::square4(squares, in);       // X1^2, Y1^2, Z1^2, (X1 + Y1)^2
+    Curve25519::add(C, C, C);               // C = 2 * Z1^2
+    Curve25519::add(H, A, B);               // H = A + B
+    Curve25519::sub(p.t, H, p.t);           // E = H - (X1 + Y1)^2
+    Curve25519::sub(A, A, B);               // G = A - B
+    Curve25519::add(B, C, A);               // F = C + G
+    Curve25519::mul4(out, lhs, rhs);        // p = (E * F, G * H, F * G, E * H)
+
+    clean(A);
+    clean(B);
+    clean(C);
+    clean(H);
+}
+
+#if ED25519_BASE_TABLE_SPACING
+
+/**
+ * \brief Selects a multiple of the base point from the precomputed table.
+ *
+ * \param p The selected point.
+ * \param row The table row.
+ * \param digit The multiple to select, between -8 and 8.
+ *
+ * Every entry in the row is read and conditionally moved into \a p,
+ * so the memory accesses and timing do not depend upon \a digit.
+ */
+void Ed25519::selectBase(PrecomputedPoint &p, uint8_t row, int8_t digit)
+{
+    limb_t entry[3 * NUM_LIMBS_256BIT];
+    limb_t neg[NUM_LIMBS_FIELD25519];
+    uint8_t negative = ((uint8_t)digit) >> 7;
+    uint8_t mask = (uint8_t)(0 - negative);
+    uint8_t absDigit = (uint8_t)((((uint8_t)digit) ^ mask) - mask);
+    uint8_t posn, index;
+
+    // Start with the neutral point (1, 1, 0) for a digit of zero.
+    memset(entry, 0, sizeof(entry));
+    entry[0] = 1;
+    entry[NUM_LIMBS_256BIT] = 1;
+
+    // Move in the entry that matches the absolute value of the digit.
+    // The table is in saturated limbs, so the selection is made on those
+    // and only the selected entry is loaded into field elements.
+    for (posn = 1; posn <= 8; ++posn) {
+        limb_t select = (limb_t)((((uint32_t)(absDigit ^ posn)) - 1) >> 31);
+        const limb_t *src = baseTable[row][posn - 1];
+        select = 0 - select;
+        for (index = 0; index < 3 * NUM_LIMBS_256BIT; ++index) {
+            entry[index] ^= select &
+                (entry[index] ^ pgm_read_limb(&(src[index])));
+        }
+    }
+    Curve25519::load(p.ypx, entry);
+    Curve25519::load(p.ymx, entry + NUM_LIMBS_256BIT);
+    Curve25519::load(p.xy2d, entry + 2 * NUM_LIMBS_256BIT);
+
+    // Negate the point if the digit is negative: -(x, y) = (-x, y).
+    memset(neg, 0, sizeof(neg));
+    Curve25519::sub(neg, neg, p.xy2d);
+    Curve25519::cswap(negative, p.ypx, p.ymx);
+    Curve25519::cmove(negative, p.xy2d, neg);
+
+    clean(entry);
+    clean(neg);
+}
+
+#endif
+
+#if ED25519_MUL_WINDOW
+
+/**
+ * \brief Selects a multiple of a point from the table built by mul().
+ *
+ * \param c The selected point.
+ * \param table The multiples 1 * p to 2^(ED25519_MUL_WINDOW - 1) * p.
+ * \param digit The multiple to select, between -2^(ED25519_MUL_WINDOW - 1)
+ * and 2^(ED25519_MUL_WINDOW - 1).
+ *
+ * Every entry in the table is read and conditionally moved into \a c,
+ * so the memory accesses and timing do not depend upon \a digit.
+ */
+void Ed25519::selectMultiple(CachedPoint &c, const CachedPoint *table,
+                             int8_t digit)
+{
+    limb_t neg[NUM_LIMBS_FIELD25519];
+    uint8_t negative = ((uint8_t)digit) >> 7;
+    uint8_t mask = (uint8_t)(0 - negative);
+    uint8_t absDigit = (uint8_t)((((uint8_t)digit) ^ mask) - mask);
+    uint8_t posn;
+
+    // Start with the neutral point (1, 1, 2, 0) for a digit of zero.
+    memset(&c, 0, sizeof(CachedPoint));
+    c.ypx[0] = 1;
+    c.ymx[0] = 1;
+    c.z2[0] = 2;
+
+    // Move in the entry that matches the absolute value of the digit.
+    for (posn = 1; posn <= ED25519_MUL_ENTRIES; ++posn) {
+        limb_t select = (limb_t)((((uint32_t)(absDigit ^ posn)) - 1) >> 31);
+        Curve25519::cmove(select, c.ypx, table[posn - 1].ypx);
+        Curve25519::cmove(select, c.ymx, table[posn - 1].ymx);
+        Curve25519::cmove(select, c.z2, table[posn - 1].z2);
+        Curve25519::cmove(select, c.t2d, table[posn - 1].t2d);
+    }
+
+    // Negate the point if the digit is negative: -(x, y) = (-x, y).
+    memset(neg, 0, sizeof(neg));
+    Curve25519::sub(neg, neg, c.t2d);
+    Curve25519::cswap(negative, c.ypx, c.ymx);
+    Curve25519::cmove(negative, c.t2d, neg);
+
+    clean(neg);
+}
+
+#endif
+
 /**
  * \brief Determine if two curve points are equal.
  *
@@ -510,16 +1702,20 @@ void Ed25519::add(Point &p, const Point &q)
  */
 bool Ed25519::equal(const Point &p, const Point &q)
 {
-    limb_t a[NUM_LIMBS_256BIT];
-    limb_t b[NUM_LIMBS_256BIT];
+    limb_t a[NUM_LIMBS_FIELD25519];
+    limb_t b[NUM_LIMBS_FIELD25519];
     bool result = true;
 
     Curve25519::mul(a, p.x, q.z);
     Curve25519::mul(b, q.x, p.z);
+    Curve25519::reduceQuick(a);
+    Curve25519::reduceQuick(b);
     result &= secure_compare(a, b, sizeof(a));
 
     Curve25519::mul(a, p.y, q.z);
     Curve25519::mul(b, q.y, p.z);
+    Curve25519::reduceQuick(a);
+    Curve25519::reduceQuick(b);
     result &= secure_compare(a, b, sizeof(a));
 
     clean(a);
@@ -547,11 +1743,11 @@ void Ed25519::encodePoint(uint8_t *buf, Point &point)
     Curve25519::mul(point.x, point.x, point.t);
     Curve25519::mul(point.y, point.y, point.t);
 
-    // Copy the lowest bit of x to the highest bit of y.
-    point.y[NUM_LIMBS_256BIT - 1] |= (point.x[0] << (LIMB_BITS - 1));
-
-    // Convert y into little-endian in the return buffer.
-    BigNumberUtil::packLE(buf, 32, point.y, NUM_LIMBS_256BIT);
+    // Convert y into little-endian in the return buffer and copy the
+    // lowest bit of the fully reduced x to the highest bit.
+    Curve25519::pack(buf, point.y);
+    Curve25519::reduceQuick(point.x);
+    buf[31] |= (uint8_t)((point.x[0] & 0x01) << 7);
 }
 
 /**
@@ -568,52 +1764,72 @@ void Ed25519::encodePoint(uint8_t *buf, Point &point)
  */
 bool Ed25519::decodePoint(Point &point, const uint8_t *buf)
 {
-    limb_t temp[NUM_LIMBS_256BIT];
+    limb_t u[NUM_LIMBS_FIELD25519];
+    limb_t v[NUM_LIMBS_FIELD25519];
+    limb_t w[NUM_LIMBS_FIELD25519];
+    bool result = false;
 
     // Convert the input buffer from little-endian into the limbs of y.
-    BigNumberUtil::unpackLE(point.y, NUM_LIMBS_256BIT, buf, 32);
-
-    // The high bit of y is the sign bit for x.
-    limb_t sign = point.y[NUM_LIMBS_256BIT - 1] >> (LIMB_BITS - 1);
-    point.y[NUM_LIMBS_256BIT - 1] &= ~(((limb_t)1) << (LIMB_BITS - 1));
+    // The high bit of the buffer is the sign bit for x.
+    Curve25519::unpack(point.y, buf);
+    limb_t sign = buf[31] >> 7;
 
     // Set z to 1.
-    memcpy_P(point.z, numBz, sizeof(point.z));
-
-    // Compute t = (y * y - 1) * modinv(d * y * y + 1).
-    Curve25519::square(point.t, point.y);
-    Curve25519::sub(point.x, point.t, point.z);
-    Curve25519::mul_P(point.t, point.t, numD);
-    Curve25519::add(point.t, point.t, point.z);
-    Curve25519::recip(temp, point.t);
-    Curve25519::mul(point.t, point.x, temp);
-    clean(temp);
-
-    // Check for t = 0.
-    limb_t check = point.t[0];
-    for (uint8_t posn = 1; posn < NUM_LIMBS_256BIT; ++posn)
-        check |= point.t[posn];
-    if (!check) {
-        // If the sign bit is set, then decoding has failed.
-        // Otherwise x is zero and we're done.
-        if (sign)
-            return false;
-        memset(point.x, 0, sizeof(point.x));
-        return true;
+    Curve25519::load_P(point.z, numBz);
+
+    // Compute u = y * y - 1 and v = d * y * y + 1.
+    Curve25519::square(v, point.y);
+    Curve25519::sub(u, v, point.z);
+    Curve25519::mul_P(v, v, numD);
+    Curve25519::add(v, v, point.z);
+
+    // x is the square root of u / v.  Compute the candidate root with a
+    // single exponentiation (RFC 8032, section 5.1.3):
+    //      x = u * v^3 * (u * v^7)^((p - 5) / 8)
+    // where (p - 5) / 8 = 2^252 - 3 = (2^250 - 1) * 4 + 1.
+    Curve25519::square(point.t, v);
+    Curve25519::mul(point.t, point.t, v);       // t = v^3
+    Curve25519::square(w, point.t);
+    Curve25519::mul(w, w, v);
+    Curve25519::mul(w, w, u);                   // w = u * v^7
+    Curve25519::pow250(point.x, w);
+    Curve25519::squareN(point.x, point.x, 2);
+    Curve25519::mul(point.x, point.x, w);
+    Curve25519::mul(point.x, point.x, point.t);
+    Curve25519::mul(point.x, point.x, u);
+
+    // If v * x^2 = u then x is the root.  If v * x^2 = -u then the root
+    // is x * sqrt(-1).  Otherwise there is no root.
+    Curve25519::square(w, point.x);
+    Curve25519::mul(w, w, v);
+    Curve25519::sub(point.t, w, u);
+    if (!Curve25519::isZero(point.t)) {
+        Curve25519::add(point.t, w, u);
+        if (!Curve25519::isZero(point.t))
+            goto cleanup;
+        Curve25519::mul_P(point.x, point.x, numSqrtM1);
     }
 
-    // Recover x by taking the sqrt of t and flipping the sign if necessary.
-    if (!Curve25519::sqrt(point.x, point.t))
-        return false;
-    if (sign != (point.x[0] & ((limb_t)1))) {
-        // The signs are different so we want the other square root.
+    // Flip the sign of x if necessary.  The sign bit cannot be set if
+    // x is zero.  The parity is that of the fully reduced value.
+    Curve25519::reduceQuick(point.x);
+    if (Curve25519::isZero(point.x)) {
+        if (sign)
+            goto cleanup;
+    } else if (sign != (point.x[0] & ((limb_t)1))) {
         memset(point.t, 0, sizeof(point.t));
         Curve25519::sub(point.x, point.t, point.x);
     }
 
     // Finally, t = x * y.
     Curve25519::mul(point.t, point.x, point.y);
-    return true;
+    result = true;
+
+cleanup:
+    clean(u);
+    clean(v);
+    clean(w);
+    return result;
 }
 
 /**
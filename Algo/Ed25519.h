@@ -24,19 +24,53 @@
 #define CRYPTO_ED25519_h
 
 #include "BigNumberUtil.h"
+#include "Curve25519.h"
 #include "SHA512.h"
 
+// Width of the non-adjacent form of the multiple of the public key in
+// verify(), and the number of odd multiples of the key that it needs.
+#define ED25519_NAF_WIDTH       5
+#define ED25519_NAF_ENTRIES     (1 << (ED25519_NAF_WIDTH - 2))
+
+class Ed25519KeyCache;
+
 class Ed25519
 {
 public:
+    typedef void (*MessageSource)(Hash *hash, void *context);
+
     static void sign(uint8_t signature[64], const uint8_t privateKey[32],
                      const uint8_t publicKey[32], const void *message,
                      size_t len);
     static bool verify(const uint8_t signature[64], const uint8_t publicKey[32],
                        const void *message, size_t len);
+    static bool verifyBatch(const uint8_t *const *signatures,
+                            const uint8_t *const *publicKeys,
+                            const void *const *messages, const size_t *lens,
+                            size_t count, bool *valid = 0);
+
+    static void signExpanded(uint8_t signature[64], const uint8_t expandedKey[64],
+                             const uint8_t publicKey[32], const void *message,
+                             size_t len);
+
+    static void signStream(uint8_t signature[64], const uint8_t privateKey[32],
+                           const uint8_t publicKey[32], MessageSource source,
+                           void *context);
+    static bool verifyStream(const uint8_t signature[64],
+                             const uint8_t publicKey[32],
+                             MessageSource source, void *context);
+
+    static void signPrehashed(uint8_t signature[64], const uint8_t privateKey[32],
+                              const uint8_t publicKey[32], const uint8_t digest[64],
+                              const void *context = 0, uint8_t contextLen = 0);
+    static bool verifyPrehashed(const uint8_t signature[64],
+                                const uint8_t publicKey[32],
+                                const uint8_t digest[64],
+                                const void *context = 0, uint8_t contextLen = 0);
 
     static void generatePrivateKey(uint8_t privateKey[32]);
     static void derivePublicKey(uint8_t publicKey[32], const uint8_t privateKey[32]);
+    static void expandPrivateKey(uint8_t expandedKey[64], const uint8_t privateKey[32]);
 
 private:
     // Constructor and destructor are private - cannot instantiate this class.
@@ -46,10 +80,28 @@ private:
     // Curve point represented in extended homogeneous coordinates.
     struct Point
     {
-        limb_t x[32 / sizeof(limb_t)];
-        limb_t y[32 / sizeof(limb_t)];
-        limb_t z[32 / sizeof(limb_t)];
-        limb_t t[32 / sizeof(limb_t)];
+        limb_t x[NUM_LIMBS_FIELD25519];
+        limb_t y[NUM_LIMBS_FIELD25519];
+        limb_t z[NUM_LIMBS_FIELD25519];
+        limb_t t[NUM_LIMBS_FIELD25519];
+    };
+
+    // Affine curve point precomputed as (y + x, y - x, 2 * d * x * y).
+    struct PrecomputedPoint
+    {
+        limb_t ypx[NUM_LIMBS_FIELD25519];
+        limb_t ymx[NUM_LIMBS_FIELD25519];
+        limb_t xy2d[NUM_LIMBS_FIELD25519];
+    };
+
+    // Curve point cached for repeated additions as
+    // (y + x, y - x, 2 * z, 2 * d * t).
+    struct CachedPoint
+    {
+        limb_t ypx[NUM_LIMBS_FIELD25519];
+        limb_t ymx[NUM_LIMBS_FIELD25519];
+        limb_t z2[NUM_LIMBS_FIELD25519];
+        limb_t t2d[NUM_LIMBS_FIELD25519];
     };
 
     static void reduceQFromBuffer(limb_t *result, const uint8_t buf[64], limb_t *temp);
@@ -59,13 +111,68 @@ private:
     static void mul(Point &result, const limb_t *s, bool constTime = true);
 
     static void add(Point &p, const Point &q);
+    static void add(Point &p, const PrecomputedPoint &q, bool negate = false);
+    static void add(Point &p, const CachedPoint &q, bool negate = false);
+    static void dbl(Point &p);
+
+    static void selectBase(PrecomputedPoint &p, uint8_t row, int8_t digit);
+    static void selectMultiple(CachedPoint &c, const CachedPoint *table,
+                               int8_t digit);
+
+    static void mulDouble(Point &result, const limb_t *s, const limb_t *k,
+                          const CachedPoint *table);
+    static void oddMultiples(CachedPoint *table, const Point &p, uint8_t count);
+    static void toCached(CachedPoint &c, const Point &p);
+    static void mulMulti(Point &result, const CachedPoint *points,
+                         const limb_t *scalars, size_t count,
+                         int8_t *digits, Point *buckets, uint8_t width);
+    static bool verifyChunk(const uint8_t *const *signatures,
+                            const uint8_t *const *publicKeys,
+                            const void *const *messages, const size_t *lens,
+                            size_t count, CachedPoint *points, limb_t *scalars,
+                            int8_t *digits, Point *buckets, uint8_t width);
+    static void naf(int8_t *digits, const limb_t *s, uint8_t width);
 
     static bool equal(const Point &p, const Point &q);
 
     static void encodePoint(uint8_t *buf, Point &point);
     static bool decodePoint(Point &point, const uint8_t *buf);
 
+    // Contiguous message for hashBuffer().
+    struct Buffer
+    {
+        const void *data;
+        size_t len;
+    };
+
+    // Context string of an Ed25519ph signature.
+    struct PrehashContext
+    {
+        const void *data;
+        uint8_t len;
+    };
+
+    static void hashBuffer(Hash *hash, void *context);
+    static void hashDomain(Hash *hash, const PrehashContext *ph);
+
+    static bool decodeKey(Point &A, const uint8_t publicKey[32]);
+    static bool verifyWithKey(const uint8_t signature[64],
+                              const uint8_t publicKey[32],
+                              MessageSource source, void *context,
+                              const PrehashContext *ph);
+    static bool verifyWithTable(const uint8_t signature[64],
+                                const uint8_t publicKey[32],
+                                MessageSource source, void *context,
+                                const PrehashContext *ph,
+                                const CachedPoint *table);
+
     static void deriveKeys(SHA512 *hash, limb_t *a, const uint8_t privateKey[32]);
+    static void signWithKeys(SHA512 *hash, uint8_t signature[64], const limb_t *a,
+                             const uint8_t prefix[32], const uint8_t publicKey[32],
+                             MessageSource source, void *context,
+                             const PrehashContext *ph);
+
+    friend class Ed25519KeyCache;
 };
 
 #endif
@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Ed25519KeyCache.h"
+#include "Crypto.h"
+#include <stdlib.h>
+#include <string.h>
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#define ED25519_KEYCACHE_FREERTOS 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#define ED25519_KEYCACHE_PTHREAD 1
+#endif
+
+/**
+ * \class Ed25519KeyCache Ed25519KeyCache.h <Ed25519KeyCache.h>
+ * \brief Cache of decoded public keys for repeated Ed25519 verification.
+ *
+ * Ed25519::verify() decodes the public key on every call, which needs a
+ * field square root, and then computes the odd multiples of the key for
+ * its double-scalar multiplication.  Applications that verify signatures
+ * from the same keys over and over can keep the decoded keys in a cache:
+ *
+ * \code
+ * Ed25519KeyCache cache(1000);
+ * ...
+ * if (!cache.verify(signature, publicKey, message, len)) {
+ *     // The signature is not valid.
+ * }
+ * \endcode
+ *
+ * The cache holds up to a fixed number of keys and evicts the least
+ * recently used key when it is full.  Each entry holds the decoded point,
+ * or if \a tables is set the odd multiples of the point, which saves more
+ * time per verification but takes about 8 times the memory: see
+ * entrySize().  Keys that do not decode are not cached.
+ *
+ * On ESP32 and POSIX systems the cache can be shared between threads.
+ * Lookups and updates hold a mutex, and the verification itself works
+ * on a copy of the entry outside of the lock.  There is no locking on
+ * other platforms.
+ *
+ * \sa Ed25519
+ */
+
+/** @cond */
+
+// Cache entry, with its value in the same position of the "data" array.
+// The entries form a list from the most to the least recently used, and
+// a chain for each hash bucket.
+struct Ed25519KeyCache::Entry
+{
+    uint8_t key[32];
+    uint32_t prev;
+    uint32_t next;
+    uint32_t chain;
+};
+
+#define ED25519_KEYCACHE_NONE   0xFFFFFFFFU
+
+/** @endcond */
+
+/**
+ * \brief Constructs a new cache of decoded Ed25519 public keys.
+ *
+ * \param capacity The maximum number of keys in the cache.
+ * \param tables Set to true to cache the odd multiples of each key that
+ * verify() uses instead of just the decoded key.
+ *
+ * If the memory for the cache cannot be allocated then capacity() will
+ * be zero and verify() will not cache anything.
+ */
+Ed25519KeyCache::Ed25519KeyCache(size_t capacity, bool tables)
+    : entries(0)
+    , data(0)
+    , buckets(0)
+    , cap(0)
+    , used(0)
+    , bucketMask(0)
+    , head(ED25519_KEYCACHE_NONE)
+    , tail(ED25519_KEYCACHE_NONE)
+    , tables(tables)
+    , mutex(0)
+{
+    size_t size = valueSize();
+    size_t numBuckets = 1;
+
+    if (capacity == 0 || capacity >= ED25519_KEYCACHE_NONE / 2 ||
+            capacity > ((size_t)-1) / size)
+        return;
+    while (numBuckets < capacity)
+        numBuckets <<= 1;
+
+    entries = (Entry *)malloc(capacity * sizeof(Entry));
+    data = (uint8_t *)malloc(capacity * size);
+    buckets = (uint32_t *)malloc(numBuckets * sizeof(uint32_t));
+#if defined(ED25519_KEYCACHE_FREERTOS)
+    mutex = (void *)xSemaphoreCreateMutex();
+#elif defined(ED25519_KEYCACHE_PTHREAD)
+    mutex = malloc(sizeof(pthread_mutex_t));
+    if (mutex && pthread_mutex_init((pthread_mutex_t *)mutex, 0) != 0) {
+        free(mutex);
+        mutex = 0;
+    }
+#else
+    mutex = (void *)this;   // No locking, but mark as allocated.
+#endif
+    if (!entries || !data || !buckets || !mutex) {
+        free(entries);
+        free(data);
+        free(buckets);
+        entries = 0;
+        data = 0;
+        buckets = 0;
+        return;
+    }
+
+    memset(buckets, 0xFF, numBuckets * sizeof(uint32_t));
+    bucketMask = (uint32_t)(numBuckets - 1);
+    cap = capacity;
+}
+
+/**
+ * \brief Destroys this cache.
+ */
+Ed25519KeyCache::~Ed25519KeyCache()
+{
+    if (data) {
+        clean(data, cap * valueSize());
+        free(data);
+    }
+    free(entries);
+    free(buckets);
+#if defined(ED25519_KEYCACHE_FREERTOS)
+    if (mutex)
+        vSemaphoreDelete((SemaphoreHandle_t)mutex);
+#elif defined(ED25519_KEYCACHE_PTHREAD)
+    if (mutex) {
+        pthread_mutex_destroy((pthread_mutex_t *)mutex);
+        free(mutex);
+    }
+#endif
+}
+
+/**
+ * \brief Verifies a signature using a specific Ed25519 public key,
+ * decoding the key only if it is not already in the cache.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The public key to use to verify the signature.
+ * \param message The message whose signature is to be verified.
+ * \param len The length of the \a message to be verified.
+ *
+ * \return Returns true if the \a signature is valid for \a message;
+ * or false if the \a signature is not valid.
+ *
+ * The result is always the same as for Ed25519::verify().
+ */
+bool Ed25519KeyCache::verify(const uint8_t signature[64],
+                             const uint8_t publicKey[32],
+                             const void *message, size_t len)
+{
+    Ed25519::Point A;
+    Ed25519::CachedPoint table[ED25519_NAF_ENTRIES];
+    Ed25519::Buffer buffer = {message, len};
+    bool result = false;
+
+    if (!cap)
+        return Ed25519::verify(signature, publicKey, message, len);
+
+    if (!lookup(publicKey, tables ? (void *)table : (void *)&A)) {
+        if (!Ed25519::decodeKey(A, publicKey))
+            goto cleanup;
+        if (tables) {
+            Ed25519::oddMultiples(table, A, ED25519_NAF_ENTRIES);
+            insert(publicKey, table);
+        } else {
+            insert(publicKey, &A);
+        }
+    }
+    if (!tables)
+        Ed25519::oddMultiples(table, A, ED25519_NAF_ENTRIES);
+    result = Ed25519::verifyWithTable(signature, publicKey,
+                                      Ed25519::hashBuffer, &buffer, 0, table);
+
+cleanup:
+    clean(A);
+    clean(table);
+    return result;
+}
+
+/**
+ * \fn size_t Ed25519KeyCache::capacity() const
+ * \brief Returns the maximum number of keys in the cache, or zero if
+ * the memory for the cache could not be allocated.
+ */
+
+/**
+ * \brief Returns the number of bytes of memory used by each entry.
+ *
+ * This is the decoded key or its multiples and the bookkeeping for the
+ * entry.  The hash table adds up to 8 bytes per entry.
+ */
+size_t Ed25519KeyCache::entrySize() const
+{
+    return valueSize() + sizeof(Entry);
+}
+
+/**
+ * \brief Removes all keys from the cache.
+ */
+void Ed25519KeyCache::clear()
+{
+    if (!cap)
+        return;
+    lock();
+    memset(buckets, 0xFF, (bucketMask + 1) * sizeof(uint32_t));
+    clean(data, used * valueSize());
+    used = 0;
+    head = ED25519_KEYCACHE_NONE;
+    tail = ED25519_KEYCACHE_NONE;
+    unlock();
+}
+
+/**
+ * \brief Returns the size of the value stored for each key.
+ */
+size_t Ed25519KeyCache::valueSize() const
+{
+    if (tables)
+        return sizeof(Ed25519::CachedPoint) * ED25519_NAF_ENTRIES;
+    else
+        return sizeof(Ed25519::Point);
+}
+
+/**
+ * \brief Looks up a key and makes it the most recently used.
+ *
+ * \param publicKey The public key to look for.
+ * \param value Returns a copy of the value for the key if it was found.
+ *
+ * \return Returns true if the key was found.
+ */
+bool Ed25519KeyCache::lookup(const uint8_t publicKey[32], void *value)
+{
+    size_t size = valueSize();
+    uint32_t index;
+
+    lock();
+    index = find(publicKey, hash(publicKey) & bucketMask);
+    if (index != ED25519_KEYCACHE_NONE) {
+        unlink(index);
+        pushFront(index);
+        memcpy(value, data + index * size, size);
+    }
+    unlock();
+    return index != ED25519_KEYCACHE_NONE;
+}
+
+/**
+ * \brief Adds a key to the cache as the most recently used.
+ *
+ * \param publicKey The public key to add.
+ * \param value The value for the key.
+ *
+ * The least recently used key is evicted if the cache is full.
+ */
+void Ed25519KeyCache::insert(const uint8_t publicKey[32], const void *value)
+{
+    size_t size = valueSize();
+    uint32_t bucket = hash(publicKey) & bucketMask;
+    uint32_t index;
+    uint32_t *link;
+
+    lock();
+
+    // Another thread may have added the key since the lookup.
+    index = find(publicKey, bucket);
+    if (index != ED25519_KEYCACHE_NONE) {
+        unlink(index);
+    } else {
+        if (used < cap) {
+            index = (uint32_t)(used++);
+        } else {
+            // Evict the least recently used key from its bucket.
+            index = tail;
+            unlink(index);
+            link = &(buckets[hash(entries[index].key) & bucketMask]);
+            while (*link != index)
+                link = &(entries[*link].chain);
+            *link = entries[index].chain;
+        }
+        memcpy(entries[index].key, publicKey, 32);
+        memcpy(data + index * size, value, size);
+        entries[index].chain = buckets[bucket];
+        buckets[bucket] = index;
+    }
+    pushFront(index);
+
+    unlock();
+}
+
+/**
+ * \brief Finds the entry for a key.
+ *
+ * \param publicKey The public key to look for.
+ * \param bucket The hash bucket for \a publicKey.
+ *
+ * \return The index of the entry, or ED25519_KEYCACHE_NONE.
+ */
+uint32_t Ed25519KeyCache::find(const uint8_t publicKey[32],
+                               uint32_t bucket) const
+{
+    uint32_t index = buckets[bucket];
+    while (index != ED25519_KEYCACHE_NONE &&
+           memcmp(entries[index].key, publicKey, 32) != 0)
+        index = entries[index].chain;
+    return index;
+}
+
+/**
+ * \brief Hashes a public key with 32-bit FNV-1a.
+ *
+ * \param publicKey The public key.
+ *
+ * \return The hash value.
+ */
+uint32_t Ed25519KeyCache::hash(const uint8_t publicKey[32]) const
+{
+    uint32_t h = 2166136261U;
+    for (uint8_t posn = 0; posn < 32; ++posn) {
+        h ^= publicKey[posn];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+/**
+ * \brief Removes an entry from the list of recently used entries.
+ *
+ * \param index The index of the entry.
+ */
+void Ed25519KeyCache::unlink(uint32_t index)
+{
+    Entry &entry = entries[index];
+    if (entry.prev != ED25519_KEYCACHE_NONE)
+        entries[entry.prev].next = entry.next;
+    else
+        head = entry.next;
+    if (entry.next != ED25519_KEYCACHE_NONE)
+        entries[entry.next].prev = entry.prev;
+    else
+        tail = entry.prev;
+}
+
+/**
+ * \brief Adds an entry to the front of the list of recently used entries.
+ *
+ * \param index The index of the entry.
+ */
+void Ed25519KeyCache::pushFront(uint32_t index)
+{
+    Entry &entry = entries[index];
+    entry.prev = ED25519_KEYCACHE_NONE;
+    entry.next = head;
+    if (head != ED25519_KEYCACHE_NONE)
+        entries[head].prev = index;
+    else
+        tail = index;
+    head = index;
+}
+
+/**
+ * \brief Acquires the lock on the cache.
+ */
+void Ed25519KeyCache::lock()
+{
+#if defined(ED25519_KEYCACHE_FREERTOS)
+    xSemaphoreTake((SemaphoreHandle_t)mutex, portMAX_DELAY);
+#elif defined(ED25519_KEYCACHE_PTHREAD)
+    pthread_mutex_lock((pthread_mutex_t *)mutex);
+#endif
+}
+
+/**
+ * \brief Releases the lock on the cache.
+ */
+void Ed25519KeyCache::unlock()
+{
+#if defined(ED25519_KEYCACHE_FREERTOS)
+    xSemaphoreGive((SemaphoreHandle_t)mutex);
+#elif defined(ED25519_KEYCACHE_PTHREAD)
+    pthread_mutex_unlock((pthread_mutex_t *)mutex);
+#endif
+}
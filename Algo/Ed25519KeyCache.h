@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_ED25519KEYCACHE_h
+#define CRYPTO_ED25519KEYCACHE_h
+
+#include "Ed25519.h"
+
+class Ed25519KeyCache
+{
+public:
+    explicit Ed25519KeyCache(size_t capacity, bool tables = false);
+    ~Ed25519KeyCache();
+
+    bool verify(const uint8_t signature[64], const uint8_t publicKey[32],
+                const void *message, size_t len);
+
+    size_t capacity() const { return cap; }
+    size_t entrySize() const;
+
+    void clear();
+
+private:
+    struct Entry;
+
+    Entry *entries;
+    uint8_t *data;
+    uint32_t *buckets;
+    size_t cap;
+    size_t used;
+    uint32_t bucketMask;
+    uint32_t head;
+    uint32_t tail;
+    bool tables;
+    void *mutex;
+
+    size_t valueSize() const;
+    bool lookup(const uint8_t publicKey[32], void *value);
+    void insert(const uint8_t publicKey[32], const void *value);
+    uint32_t find(const uint8_t publicKey[32], uint32_t bucket) const;
+    uint32_t hash(const uint8_t publicKey[32]) const;
+    void unlink(uint32_t index);
+    void pushFront(uint32_t index);
+    void lock();
+    void unlock();
+
+    // Copying would share the entries and the lock.
+    Ed25519KeyCache(const Ed25519KeyCache &);
+    Ed25519KeyCache &operator=(const Ed25519KeyCache &);
+};
+
+#endif
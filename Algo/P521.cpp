@@ -25,6 +25,7 @@
 #include "RNG.h"
 #include "SHA512.h"
 #include "utility/LimbUtil.h"
+#include "utility/BigNumberModUtil.h"
 #include <string.h>
 
 /**
@@ -35,7 +36,9 @@
  *
  * \note The public functions in this class need a substantial amount of
  * stack space to store intermediate results while the curve function is
- * being evaluated.  About 2k of free stack space is recommended for safety.
+ * being evaluated.  About 5k of free stack space is recommended for safety.
+ * If P521_MUL_WINDOW and P521_BASE_TABLE_SPACING are set to 0, as they are
+ * on AVR, 2k is enough for everything except verify(), which needs about 4.5k.
  *
  * References: NIST FIPS 186-4,
  * <a href="http://tools.ietf.org/html/rfc6090">RFC 6090</a>,
@@ -63,6 +66,16 @@
 #define strict_clean(x)     do { ; } while (0)
 #endif
 
+#if P521_RADIX58
+// Masks for the 58 bits of a limb in the radix-2^58 representation and the
+// 57 bits of the top limb, and the limbs of 4 * (2^521 - 1) which sub()
+// adds so that no limb goes negative.
+#define LIMB58_MASK         ((((limb_t)1) << 58) - 1)
+#define LIMB57_MASK         ((((limb_t)1) << 57) - 1)
+#define LIMB58_4P           ((((limb_t)1) << 60) - 4)
+#define LIMB58_4P_HIGH      ((((limb_t)1) << 59) - 4)
+#endif
+
 // Expand the partial 9-bit left over limb at the top of a 521-bit number.
 #if BIGNUMBER_LIMB_8BIT
 #define LIMB_PARTIAL(value) ((uint8_t)(value)), \
@@ -83,6 +96,39 @@ static limb_t const P521_q[NUM_LIMBS_521BIT] PROGMEM = {
     LIMB_PARTIAL(0x1ff)
 };
 
+// R^2 mod q for Montgomery arithmetic modulo q, where R = 2^(LIMB_BITS *
+// NUM_LIMBS_521BIT) depends upon the limb size.
+static limb_t const P521_q_r2[NUM_LIMBS_521BIT] PROGMEM = {
+#if BIGNUMBER_LIMB_64BIT
+    LIMB_PAIR(0xcf15dd04, 0x137cd04d), LIMB_PAIR(0xe5547ea3, 0xf707badc),
+    LIMB_PAIR(0x794573ff, 0x12a78d38), LIMB_PAIR(0x57f75e06, 0xd3721ef5),
+    LIMB_PAIR(0x2e49c7db, 0xdd6e23d8), LIMB_PAIR(0xb7756e3e, 0xcff3d142),
+    LIMB_PAIR(0xa8e567bc, 0x5bcc6d61), LIMB_PAIR(0x492d0d45, 0x2d8e03d1),
+    LIMB_PARTIAL(0x03d)
+#elif BIGNUMBER_LIMB_32BIT
+    LIMB_PAIR(0x61c64ca7, 0x1163115a), LIMB_PAIR(0x4374a642, 0x18354a56),
+    LIMB_PAIR(0x0791d9dc, 0x5d4dd6d3), LIMB_PAIR(0xd3402705, 0x4fb35b72),
+    LIMB_PAIR(0xb7756e3a, 0xcff3d142), LIMB_PAIR(0xa8e567bc, 0x5bcc6d61),
+    LIMB_PAIR(0x492d0d45, 0x2d8e03d1), LIMB_PAIR(0x8c44383d, 0x5b5a3afe),
+    LIMB_PARTIAL(0x19a)
+#else
+    LIMB_PAIR(0x56c0fbb8, 0x351c5408), LIMB_PAIR(0x42a23fb7, 0x2ef21d46),
+    LIMB_PAIR(0xe991171e, 0x8e57ada6), LIMB_PAIR(0x95e33583, 0x47710a7f),
+    LIMB_PAIR(0xcff3d13d, 0xa8e567bc), LIMB_PAIR(0x5bcc6d61, 0x492d0d45),
+    LIMB_PAIR(0x2d8e03d1, 0x8c44383d), LIMB_PAIR(0x5b5a3afe, 0x0391a39a),
+    LIMB_PARTIAL(0x1ea)
+#endif
+};
+
+// Describes q to the modular arithmetic templates in BigNumberUtil.
+struct P521ModQ
+{
+    static const size_t count = NUM_LIMBS_521BIT;
+    static const limb_t inverse = (limb_t)0x1d2f5ccd79a995c7ULL;
+    static const limb_t *modulus() { return P521_q; }
+    static const limb_t *r2() { return P521_q_r2; }
+};
+
 // The "b" value from Appendix D.1.2.5 of NIST FIPS 186-4.
 static limb_t const P521_b[NUM_LIMBS_521BIT] PROGMEM = {
     LIMB_PAIR(0x6b503f00, 0xef451fd4), LIMB_PAIR(0x3d2c34f1, 0x3573df88),
@@ -110,6 +156,80 @@ static limb_t const P521_Gy[NUM_LIMBS_521BIT] PROGMEM = {
     LIMB_PARTIAL(0x118)
 };
 
+// Multiplication by the generator uses a table of precomputed multiples
+// in program memory: rows of 1 * 16^k * G to 8 * 16^k * G, for each k that
+// is a multiple of P521_BASE_TABLE_SPACING.  Larger spacings trade
+// doublings for flash (sizes for 64-bit limbs, a little less for 32-bit):
+//
+//      spacing     1      2      4      8      16     32
+//      table       147K   74K    37K    19K    10K    6K
+//      doublings   0      4      12     28     60     124
+//
+// Setting the spacing to 0 leaves the table out: the generator is then
+// multiplied like any other point.
+#if !defined(P521_BASE_TABLE_SPACING)
+#if defined(__AVR__)
+#define P521_BASE_TABLE_SPACING 0
+#else
+#define P521_BASE_TABLE_SPACING 8
+#endif
+#endif
+
+#if P521_BASE_TABLE_SPACING
+#if P521_BASE_TABLE_SPACING < 0 || P521_BASE_TABLE_SPACING > 32 || \
+        (P521_BASE_TABLE_SPACING & (P521_BASE_TABLE_SPACING - 1)) != 0
+#error "P521_BASE_TABLE_SPACING must be 0, 1, 2, 4, 8, 16 or 32"
+#endif
+#define P521_BASE_DIGITS    131     // Signed radix-16 digits of 521 bits.
+#define P521_BASE_ROWS      ((P521_BASE_DIGITS + P521_BASE_TABLE_SPACING - 1) / \
+                             P521_BASE_TABLE_SPACING)
+#include "utility/P521BaseTable.h"
+#endif
+
+// Multiplication of other points splits the scalar into signed digits of
+// P521_MUL_WINDOW bits and adds a multiple of the point for each digit,
+// instead of once per bit.  The 2^(width - 1) multiples are kept on the
+// stack in affine form, which is about 1.1K for the default width of 4
+// and doubles with each extra bit.  Setting the width to 0 selects the
+// plain double-and-add loop.
+#if !defined(P521_MUL_WINDOW)
+#if defined(__AVR__)
+#define P521_MUL_WINDOW     0
+#else
+#define P521_MUL_WINDOW     4
+#endif
+#endif
+
+#if P521_MUL_WINDOW
+#if P521_MUL_WINDOW < 2 || P521_MUL_WINDOW > 5
+#error "P521_MUL_WINDOW must be 0 or between 2 and 5"
+#endif
+#define P521_MUL_ENTRIES    (1 << (P521_MUL_WINDOW - 1))
+#define P521_MUL_DIGITS     (521 / P521_MUL_WINDOW + 1)
+#endif
+
+// verify() computes u1 * G + u2 * Q with a single chain of doublings, from
+// non-adjacent forms of u1 and u2 and the odd multiples of G and Q.  The
+// multiples of Q are computed on the fly.  Those of G come from
+// P521_baseOddTable if the table is present, which allows a wider form.
+// Otherwise they are computed too, with narrower forms to save stack space.
+#if P521_BASE_TABLE_SPACING
+#define P521_NAF_WIDTH      5
+#define P521_NAF_BASE_WIDTH 7
+#else
+#define P521_NAF_WIDTH      4
+#define P521_NAF_BASE_WIDTH P521_NAF_WIDTH
+#endif
+#define P521_NAF_ENTRIES    (1 << (P521_NAF_WIDTH - 2))
+#define P521_NAF_DIGITS     522
+
+// Largest number of multiples that multiples() has to compute.
+#if P521_MUL_WINDOW && P521_MUL_ENTRIES > P521_NAF_ENTRIES
+#define P521_MULTIPLES      P521_MUL_ENTRIES
+#else
+#define P521_MULTIPLES      P521_NAF_ENTRIES
+#endif
+
 /** @endcond */
 
 /**
@@ -138,20 +258,18 @@ bool P521::eval(uint8_t result[132], const uint8_t f[66], const uint8_t point[13
     limb_t y[NUM_LIMBS_521BIT];
     bool ok;
 
-    // Unpack the curve point from the parameters and validate it.
+    // Unpack the curve point from the parameters, validate it, and
+    // evaluate the curve function.
     if (point) {
         BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, point, 66);
         BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, point + 66, 66);
         ok = validate(x, y);
+        evaluate(x, y, f);
     } else {
-        memcpy_P(x, P521_Gx, sizeof(x));
-        memcpy_P(y, P521_Gy, sizeof(y));
+        evaluateBase(x, y, f);
         ok = true;
     }
 
-    // Evaluate the curve function.
-    evaluate(x, y, f);
-
     // Pack the answer into the result array.
     BigNumberUtil::packBE(result, 66, x, NUM_LIMBS_521BIT);
     BigNumberUtil::packBE(result + 66, 66, y, NUM_LIMBS_521BIT);
@@ -310,9 +428,7 @@ void P521::sign(uint8_t signature[132], const uint8_t privateKey[66],
             generateK(k, hm, privateKey, count);
 
         // Generate r = kG.x mod q.
-        memcpy_P(x, P521_Gx, sizeof(x));
-        memcpy_P(y, P521_Gy, sizeof(y));
-        evaluate(x, y, k);
+        evaluateBase(x, y, k);
         BigNumberUtil::reduceQuick_P(x, x, P521_q, NUM_LIMBS_521BIT);
         BigNumberUtil::packBE(signature, 66, x, NUM_LIMBS_521BIT);
 
@@ -380,7 +496,6 @@ bool P521::verify(const uint8_t signature[132],
     limb_t s[NUM_LIMBS_521BIT];
     limb_t u1[NUM_LIMBS_521BIT];
     limb_t u2[NUM_LIMBS_521BIT];
-    uint8_t t[66];
     bool ok = false;
 
     // Because we are operating on public values, we don't need to
@@ -426,17 +541,11 @@ bool P521::verify(const uint8_t signature[132],
     mulQ(u1, u1, u2);
     mulQ(u2, r, u2);
 
-    // Compute the curve point R = u2 * publicKey + u1 * G.
-    BigNumberUtil::packBE(t, 66, u2, NUM_LIMBS_521BIT);
-    evaluate(x, y, t);
-    memcpy_P(u2, P521_Gx, sizeof(x));
-    memcpy_P(s, P521_Gy, sizeof(y));
-    BigNumberUtil::packBE(t, 66, u1, NUM_LIMBS_521BIT);
-    evaluate(u2, s, t);
-    addAffine(u2, s, x, y);
+    // Compute the curve point R = u1 * G + u2 * publicKey.
+    evaluateDouble(x, y, u1, u2);
 
     // If R.x = r mod q, then the signature is valid.
-    BigNumberUtil::reduceQuick_P(u1, u2, P521_q, NUM_LIMBS_521BIT);
+    BigNumberUtil::reduceQuick_P(u1, x, P521_q, NUM_LIMBS_521BIT);
     ok = secure_compare(u1, r, NUM_LIMBS_521BIT * sizeof(limb_t));
 
     // Clean up and exit.
@@ -447,7 +556,6 @@ failed:
     clean(s);
     clean(u1);
     clean(u2);
-    clean(t);
     return ok;
 }
 
@@ -499,9 +607,7 @@ void P521::derivePublicKey(uint8_t publicKey[132], const uint8_t privateKey[66])
     // Evaluate the curve function starting with the generator.
     limb_t x[NUM_LIMBS_521BIT];
     limb_t y[NUM_LIMBS_521BIT];
-    memcpy_P(x, P521_Gx, sizeof(x));
-    memcpy_P(y, P521_Gy, sizeof(y));
-    evaluate(x, y, privateKey);
+    evaluateBase(x, y, privateKey);
 
     // Pack the (x, y) point into the public key.
     BigNumberUtil::packBE(publicKey, 66, x, NUM_LIMBS_521BIT);
@@ -593,9 +699,70 @@ bool P521::isValidPublicKey(const uint8_t publicKey[132])
  * co-ordinate of the result on exit.
  * \param f The 521-bit scalar to multiply (x, y) by, most significant
  * bit first.
+ *
+ * The co-ordinates are numbers in saturated limbs, as for load() and
+ * store(), rather than field elements.
+ *
+ * With P521_MUL_WINDOW set, \a f is split into signed digits of that many
+ * bits and each digit selects its multiple of (x, y) in constant time.
  */
 void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
 {
+#if P521_MUL_WINDOW
+    limb_t table[P521_MUL_ENTRIES * 2 * NUM_LIMBS_521BIT];
+    limb_t x1[NUM_LIMBS_521BIT];
+    limb_t y1[NUM_LIMBS_521BIT];
+    limb_t z1[NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t z2[NUM_LIMBS_521BIT];
+    int8_t e[P521_MUL_DIGITS];
+    uint16_t posn;
+    uint8_t t;
+    limb_t select;
+
+    // Compute the multiples 1 * (x, y) to 2^(width - 1) * (x, y).
+    load(x, x);
+    load(y, y);
+    multiples(table, x, y, P521_MUL_ENTRIES, false);
+
+    // Split f into signed digits.
+    recode(e, f, P521_MUL_WINDOW, P521_MUL_DIGITS);
+
+    // Set the answer to the point-at-infinity initially (z = 0).
+    memset(x1, 0, sizeof(x1));
+    memset(y1, 0, sizeof(y1));
+    memset(z1, 0, sizeof(z1));
+
+    // Process the digits from highest to lowest.  A multiple of (x, y)
+    // is added for every digit to preserve the timing, and the sum is
+    // discarded if the digit is zero.
+    for (posn = P521_MUL_DIGITS; posn > 0; --posn) {
+        if (posn != P521_MUL_DIGITS) {
+            for (t = 0; t < P521_MUL_WINDOW; ++t)
+                dblPoint(x1, y1, z1, x1, y1, z1);
+        }
+        selectMultiple(x, y, table, e[posn - 1]);
+        addPoint(x2, y2, z2, x1, y1, z1, x, y);
+        select = (uint8_t)(e[posn - 1]);
+        cmove(select, x1, x2);
+        cmove(select, y1, y2);
+        cmove(select, z1, z2);
+    }
+
+    // Convert from Jacobian co-ordinates back into affine co-ordinates.
+    toAffine(x, y, x1, y1, z1);
+
+    // Clean up.
+    clean(table);
+    clean(x1);
+    clean(y1);
+    clean(z1);
+    clean(x2);
+    clean(y2);
+    clean(z2);
+    clean(e);
+#else
     limb_t x1[NUM_LIMBS_521BIT];
     limb_t y1[NUM_LIMBS_521BIT];
     limb_t z1[NUM_LIMBS_521BIT];
@@ -607,6 +774,8 @@ void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
     // corresponds to the affine point (x / z^2, y / z^3), so if we set z
     // to 1 we end up with Jacobian co-ordinates.  Remember that z is 1
     // and continue on.
+    load(x, x);
+    load(y, y);
 
     // Set the answer to the point-at-infinity initially (z = 0).
     memset(x1, 0, sizeof(x1));
@@ -647,12 +816,7 @@ void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
     }
 
     // Convert from Jacobian co-ordinates back into affine co-ordinates.
-    // x = x1 * (z1^2)^-1, y = y1 * (z1^3)^-1.
-    recip(x2, z1);
-    square(y2, x2);
-    mul(x, x1, y2);
-    mul(y2, y2, x2);
-    mul(y, y1, y2);
+    toAffine(x, y, x1, y1, z1);
 
     // Clean up.
     clean(x1);
@@ -661,45 +825,198 @@ void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
     clean(x2);
     clean(y2);
     clean(z2);
+#endif
 }
 
 /**
- * \brief Adds two affine points.
+ * \brief Evaluates the curve function by multiplying the generator by f.
  *
- * \param x1 The X value for the first point to add, and the result.
- * \param y1 The Y value for the first point to add, and the result.
- * \param x2 The X value for the second point to add.
- * \param y2 The Y value for the second point to add.
+ * \param x The X co-ordinate of the result on exit.
+ * \param y The Y co-ordinate of the result on exit.
+ * \param f The 521-bit scalar to multiply the generator by, most
+ * significant bit first.
+ *
+ * With the precomputed table, \a f is split into 131 signed radix-16
+ * digits and each digit selects its multiple of the generator from the
+ * table in constant time.
+ */
+void P521::evaluateBase(limb_t *x, limb_t *y, const uint8_t f[66])
+{
+#if P521_BASE_TABLE_SPACING
+    limb_t x1[NUM_LIMBS_521BIT];
+    limb_t y1[NUM_LIMBS_521BIT];
+    limb_t z1[NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t z2[NUM_LIMBS_521BIT];
+    int8_t e[P521_BASE_ROWS * P521_BASE_TABLE_SPACING];
+    uint8_t posn, row;
+    int8_t digit;
+
+    // Split f into signed radix-16 digits.  The last row of the table
+    // may extend beyond the top digit.
+    recode(e, f, 4, P521_BASE_DIGITS);
+    memset(e + P521_BASE_DIGITS, 0, sizeof(e) - P521_BASE_DIGITS);
+
+    // Set the answer to the point-at-infinity initially (z = 0).
+    memset(x1, 0, sizeof(x1));
+    memset(y1, 0, sizeof(y1));
+    memset(z1, 0, sizeof(z1));
+
+    // Sum the table entries selected by each digit, with the digits
+    // between the table rows handled by multiplying the result by 16.
+    for (posn = P521_BASE_TABLE_SPACING; posn > 0; --posn) {
+        if (posn != P521_BASE_TABLE_SPACING) {
+            dblPoint(x1, y1, z1, x1, y1, z1);
+            dblPoint(x1, y1, z1, x1, y1, z1);
+            dblPoint(x1, y1, z1, x1, y1, z1);
+            dblPoint(x1, y1, z1, x1, y1, z1);
+        }
+        for (row = 0; row < P521_BASE_ROWS; ++row) {
+            digit = e[row * P521_BASE_TABLE_SPACING + posn - 1];
+            selectBase(x, y, row, digit);
+            addPoint(x2, y2, z2, x1, y1, z1, x, y);
+            cmove((uint8_t)digit, x1, x2);
+            cmove((uint8_t)digit, y1, y2);
+            cmove((uint8_t)digit, z1, z2);
+        }
+    }
+
+    // Convert from Jacobian co-ordinates back into affine co-ordinates.
+    toAffine(x, y, x1, y1, z1);
+
+    // Clean up.
+    clean(x1);
+    clean(y1);
+    clean(z1);
+    clean(x2);
+    clean(y2);
+    clean(z2);
+    clean(e);
+#else
+    memcpy_P(x, P521_Gx, NUM_LIMBS_521BIT * sizeof(limb_t));
+    memcpy_P(y, P521_Gy, NUM_LIMBS_521BIT * sizeof(limb_t));
+    evaluate(x, y, f);
+#endif
+}
+
+/**
+ * \brief Computes u1 * G + u2 * (x, y) for public values.
  *
- * The Z values for the two points are assumed to be 1.
+ * \param x The X co-ordinate of the curve point.  Replaced with the X
+ * co-ordinate of the result on exit.
+ * \param y The Y co-ordinate of the curve point.  Replaced with the Y
+ * co-ordinate of the result on exit.
+ * \param u1 The multiple of the generator G, which must be less than q.
+ * \param u2 The multiple of (x, y), which must be less than q.
+ *
+ * The co-ordinates are numbers in saturated limbs, as for evaluate().
+ *
+ * Both values are written in non-adjacent form and share one chain of
+ * doublings (Straus-Shamir).  This is not constant-time: the additions
+ * follow the digits of \a u1 and \a u2.
  */
-void P521::addAffine(limb_t *x1, limb_t *y1, const limb_t *x2, const limb_t *y2)
+void P521::evaluateDouble(limb_t *x, limb_t *y, const limb_t *u1,
+                          const limb_t *u2)
 {
-    limb_t xout[NUM_LIMBS_521BIT];
-    limb_t yout[NUM_LIMBS_521BIT];
-    limb_t zout[NUM_LIMBS_521BIT];
+    limb_t table[P521_NAF_ENTRIES * 2 * NUM_LIMBS_521BIT];
+#if !P521_BASE_TABLE_SPACING
+    limb_t tableG[P521_NAF_ENTRIES * 2 * NUM_LIMBS_521BIT];
+#endif
+    limb_t x1[NUM_LIMBS_521BIT];
+    limb_t y1[NUM_LIMBS_521BIT];
     limb_t z1[NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t z2[NUM_LIMBS_521BIT];
+    int8_t naf1[P521_NAF_DIGITS];
+    int8_t naf2[P521_NAF_DIGITS];
+    int16_t posn;
+    int8_t digit;
+    uint8_t index;
+    uint8_t which;
+
+    // Compute the odd multiples of (x, y), and of G if there is no table.
+    load(x, x);
+    load(y, y);
+    multiples(table, x, y, P521_NAF_ENTRIES, true);
+#if !P521_BASE_TABLE_SPACING
+    memcpy_P(x, P521_Gx, NUM_LIMBS_521BIT * sizeof(limb_t));
+    memcpy_P(y, P521_Gy, NUM_LIMBS_521BIT * sizeof(limb_t));
+    load(x, x);
+    load(y, y);
+    multiples(tableG, x, y, P521_NAF_ENTRIES, true);
+#endif
 
-    // z1 = 1
-    z1[0] = 1;
-    memset(z1 + 1, 0, (NUM_LIMBS_521BIT - 1) * sizeof(limb_t));
+    naf(naf1, u1, P521_NAF_BASE_WIDTH);
+    naf(naf2, u2, P521_NAF_WIDTH);
 
-    // Add the two points.
-    addPoint(xout, yout, zout, x1, y1, z1, x2, y2/*, z2*/);
+    // Set the answer to the point-at-infinity initially (z = 0).
+    memset(x1, 0, sizeof(x1));
+    memset(y1, 0, sizeof(y1));
+    memset(z1, 0, sizeof(z1));
+
+    // Skip the leading zero digits, then double once per digit and
+    // add the multiples of G and (x, y) that the digits select.
+    posn = P521_NAF_DIGITS - 1;
+    while (posn >= 0 && !naf1[posn] && !naf2[posn])
+        --posn;
+    for (; posn >= 0; --posn) {
+        dblPoint(x1, y1, z1, x1, y1, z1);
+        for (which = 0; which < 2; ++which) {
+            digit = which ? naf2[posn] : naf1[posn];
+            if (!digit)
+                continue;
+            index = (digit < 0 ? -digit : digit) / 2;
+            if (which) {
+                memcpy(x, table + index * 2 * NUM_LIMBS_521BIT,
+                       NUM_LIMBS_521BIT * sizeof(limb_t));
+                memcpy(y, table + (index * 2 + 1) * NUM_LIMBS_521BIT,
+                       NUM_LIMBS_521BIT * sizeof(limb_t));
+            } else {
+#if P521_BASE_TABLE_SPACING
+                memcpy_P(x, P521_baseOddTable[index],
+                         NUM_LIMBS_521BIT * sizeof(limb_t));
+                memcpy_P(y, P521_baseOddTable[index] + NUM_LIMBS_521BIT,
+                         NUM_LIMBS_521BIT * sizeof(limb_t));
+                load(x, x);
+                load(y, y);
+#else
+                memcpy(x, tableG + index * 2 * NUM_LIMBS_521BIT,
+                       NUM_LIMBS_521BIT * sizeof(limb_t));
+                memcpy(y, tableG + (index * 2 + 1) * NUM_LIMBS_521BIT,
+                       NUM_LIMBS_521BIT * sizeof(limb_t));
+#endif
+            }
+
+            // Negate the multiple if the digit is negative: -(x, y) = (x, -y).
+            if (digit < 0) {
+                memset(z2, 0, sizeof(z2));
+                sub(y, z2, y);
+            }
+            addPointPublic(x2, y2, z2, x1, y1, z1, x, y);
+            memcpy(x1, x2, sizeof(x1));
+            memcpy(y1, y2, sizeof(y1));
+            memcpy(z1, z2, sizeof(z1));
+        }
+    }
 
     // Convert from Jacobian co-ordinates back into affine co-ordinates.
-    // x1 = xout * (zout^2)^-1, y1 = yout * (zout^3)^-1.
-    recip(z1, zout);
-    square(zout, z1);
-    mul(x1, xout, zout);
-    mul(zout, zout, z1);
-    mul(y1, yout, zout);
+    toAffine(x, y, x1, y1, z1);
 
     // Clean up.
-    clean(xout);
-    clean(yout);
-    clean(zout);
+    clean(table);
+#if !P521_BASE_TABLE_SPACING
+    clean(tableG);
+#endif
+    clean(x1);
+    clean(y1);
     clean(z1);
+    clean(x2);
+    clean(y2);
+    clean(z2);
+    clean(naf1);
+    clean(naf2);
 }
 
 /**
@@ -724,16 +1041,23 @@ bool P521::validate(const limb_t *x, const limb_t *y)
     // We need to check that y^2 = x^3 - 3 * x + b mod 2^521 - 1.
     limb_t t1[NUM_LIMBS_521BIT];
     limb_t t2[NUM_LIMBS_521BIT];
-    square(t1, x);
-    mul(t1, t1, x);
-    mulLiteral(t2, x, 3);
+    limb_t t3[NUM_LIMBS_521BIT];
+    load(t3, x);
+    square(t1, t3);
+    mul(t1, t1, t3);
+    mulLiteral(t2, t3, 3);
     sub(t1, t1, t2);
     memcpy_P(t2, P521_b, sizeof(t2));
+    load(t2, t2);
     add(t1, t1, t2);
-    square(t2, y);
+    load(t3, y);
+    square(t2, t3);
+    store(t1, t1);
+    store(t2, t2);
     result &= secure_compare(t1, t2, sizeof(t1));
     clean(t1);
     clean(t2);
+    clean(t3);
     return result;
 }
 
@@ -862,9 +1186,40 @@ void P521::reduce(limb_t *result, const limb_t *x)
  * This function is intended for reducing the result of additions where
  * the caller knows that \a x is within the described range.  A single
  * trial subtraction is all that is needed to reduce the number.
+ *
+ * With P521_RADIX58, \a x is a field element with limbs less than 2^62,
+ * and it is reduced fully to its canonical value.
  */
 void P521::reduceQuick(limb_t *x)
 {
+#if P521_RADIX58
+    limb_t carry;
+    uint8_t posn;
+
+    // Propagate the carries so that every limb fits in 58 bits (57 bits
+    // for the top limb), apart from a small excess in the lowest limb.
+    // The value of "x" is then less than 2 * (2^521 - 1).
+    for (posn = 0; posn < 8; ++posn) {
+        x[posn + 1] += x[posn] >> 58;
+        x[posn] &= LIMB58_MASK;
+    }
+    carry = x[8] >> 57;
+    x[8] &= LIMB57_MASK;
+    x[0] += carry;
+
+    // The carry out of x + 1 is 1 if x >= 2^521 - 1.  Subtract that
+    // many copies of 2^521 - 1 by adding 1 and dropping bit 521.
+    carry = (x[0] + 1) >> 58;
+    for (posn = 1; posn < 8; ++posn)
+        carry = (x[posn] + carry) >> 58;
+    carry = (x[8] + carry) >> 57;
+    x[0] += carry;
+    for (posn = 0; posn < 8; ++posn) {
+        x[posn + 1] += x[posn] >> 58;
+        x[posn] &= LIMB58_MASK;
+    }
+    x[8] &= LIMB57_MASK;
+#else
     // Perform a trial subtraction of 2^521 - 1 from x.  This is
     // equivalent to adding 1 and subtracting 2^521 - 1.
     uint8_t index;
@@ -899,6 +1254,7 @@ void P521::reduceQuick(limb_t *x)
     }
     *(--xx) &= 0x01;
 #endif
+#endif
 }
 
 /**
@@ -958,25 +1314,114 @@ void P521::mulNoReduce(limb_t *result, const limb_t *x, const limb_t *y)
  * in size and less than 2^521 - 1.
  * \param y The second value to multiply, which must be NUM_LIMBS_521BIT limbs
  * in size and less than 2^521 - 1.  This can be the same array as \a x.
+ *
+ * With P521_RADIX58, the limbs of \a x and \a y must be less than 2^61,
+ * which holds for sums of up to four results of mul() or sub().  The limbs
+ * of the result are less than 2^58 + 2^12 but it is not fully reduced.
  */
 void P521::mul(limb_t *result, const limb_t *x, const limb_t *y)
 {
+#if P521_RADIX58
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t r[NUM_LIMBS_521BIT];
+    dlimb_t t;
+    uint8_t i, k;
+
+    // Schoolbook multiplication by columns.  Products at 2^522 and above
+    // are folded back in doubled, as 2^522 = 2 mod 2^521 - 1, so every
+    // column is a sum of 128-bit products.  Only the carry out of each
+    // column is propagated into the next.
+    for (i = 1; i < 9; ++i)
+        y2[i] = y[i] << 1;
+    t = 0;
+    for (k = 0; k < 8; ++k) {
+        for (i = 0; i <= k; ++i)
+            t += ((dlimb_t)(x[i])) * y[k - i];
+        for (i = k + 1; i < 9; ++i)
+            t += ((dlimb_t)(x[i])) * y2[k + 9 - i];
+        r[k] = ((limb_t)t) & LIMB58_MASK;
+        t >>= 58;
+    }
+    for (i = 0; i < 9; ++i)
+        t += ((dlimb_t)(x[i])) * y[8 - i];
+    r[8] = ((limb_t)t) & LIMB57_MASK;
+    t >>= 57;
+
+    // Fold the carry out of the top limb into the lowest, as 2^521 = 1.
+    t += r[0];
+    result[0] = ((limb_t)t) & LIMB58_MASK;
+    result[1] = r[1] + (limb_t)(t >> 58);
+    memcpy(result + 2, r + 2, 7 * sizeof(limb_t));
+    strict_clean(y2);
+    strict_clean(r);
+#else
     limb_t temp[NUM_LIMBS_1042BIT];
     mulNoReduce(temp, x, y);
     reduce(result, temp);
     strict_clean(temp);
+#endif
     crypto_feed_watchdog();
 }
 
 /**
- * \fn void P521::square(limb_t *result, const limb_t *x)
  * \brief Squares a value and then reduces it modulo 2^521 - 1.
  *
  * \param result The result, which must be NUM_LIMBS_521BIT limbs in size and
  * can be the same array as \a x.
  * \param x The value to square, which must be NUM_LIMBS_521BIT limbs in size
  * and less than 2^521 - 1.
+ *
+ * With P521_RADIX58, each cross product x[i] * x[j] is computed once and
+ * doubled, which saves almost half of the limb multiplications of mul().
+ * The limits on \a x are the same as for mul().
  */
+void P521::square(limb_t *result, const limb_t *x)
+{
+#if P521_RADIX58
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t r[NUM_LIMBS_521BIT];
+    dlimb_t t;
+    uint8_t i, j, k;
+
+    // As for mul(), but each column sums the products x[i] * x[j] with
+    // i < j doubled, then the square on the diagonal.  Products that are
+    // folded back in from 2^522 and above are doubled again.
+    for (i = 0; i < 9; ++i)
+        x2[i] = x[i] << 1;
+    t = 0;
+    for (k = 0; k < 9; ++k) {
+        for (i = 0, j = k; i < j; ++i, --j)
+            t += ((dlimb_t)(x2[i])) * x[j];
+        if (k & 1) {
+            for (i = k + 1, j = 8; i < j; ++i, --j)
+                t += ((dlimb_t)(x2[i])) * x2[j];
+            t += ((dlimb_t)(x2[(k + 9) / 2])) * x[(k + 9) / 2];
+        } else {
+            t += ((dlimb_t)(x[k / 2])) * x[k / 2];
+            for (i = k + 1, j = 8; i < j; ++i, --j)
+                t += ((dlimb_t)(x2[i])) * x2[j];
+        }
+        if (k < 8) {
+            r[k] = ((limb_t)t) & LIMB58_MASK;
+            t >>= 58;
+        } else {
+            r[k] = ((limb_t)t) & LIMB57_MASK;
+            t >>= 57;
+        }
+    }
+
+    // Fold the carry out of the top limb into the lowest, as 2^521 = 1.
+    t += r[0];
+    result[0] = ((limb_t)t) & LIMB58_MASK;
+    result[1] = r[1] + (limb_t)(t >> 58);
+    memcpy(result + 2, r + 2, 7 * sizeof(limb_t));
+    strict_clean(x2);
+    strict_clean(r);
+    crypto_feed_watchdog();
+#else
+    mul(result, x, x);
+#endif
+}
 
 /**
  * \brief Multiply a value by a single-limb literal modulo 2^521 - 1.
@@ -986,9 +1431,28 @@ void P521::mul(limb_t *result, const limb_t *x, const limb_t *y)
  * \param x The first value to multiply, which must be NUM_LIMBS_521BIT limbs
  * in size and less than 2^521 - 1.
  * \param y The second value to multiply, which must be less than 128.
+ *
+ * With P521_RADIX58, the limits on \a x and the result are as for mul().
  */
 void P521::mulLiteral(limb_t *result, const limb_t *x, limb_t y)
 {
+#if P521_RADIX58
+    dlimb_t carry = 0;
+    uint8_t index;
+
+    // Multiply and carry once, folding the top carry into the lowest limb.
+    for (index = 0; index < 8; ++index) {
+        carry += ((dlimb_t)(x[index])) * y;
+        result[index] = ((limb_t)carry) & LIMB58_MASK;
+        carry >>= 58;
+    }
+    carry += ((dlimb_t)(x[8])) * y;
+    result[8] = ((limb_t)carry) & LIMB57_MASK;
+    carry >>= 57;
+    carry += result[0];
+    result[0] = ((limb_t)carry) & LIMB58_MASK;
+    result[1] += (limb_t)(carry >> 58);
+#else
     uint8_t index;
     dlimb_t carry = 0;
     const limb_t *xx = x;
@@ -1054,6 +1518,7 @@ void P521::mulLiteral(limb_t *result, const limb_t *x, limb_t y)
     }
     *(--rr) &= 0x01;
 #endif
+#endif
 }
 
 /**
@@ -1065,9 +1530,16 @@ void P521::mulLiteral(limb_t *result, const limb_t *x, limb_t y)
  * limbs in size and less than 2^521 - 1.
  * \param y The second value to multiply, which must be NUM_LIMBS_521BIT
  * limbs in size and less than 2^521 - 1.
+ *
+ * With P521_RADIX58, the limbs are added without carrying or reducing.
  */
 void P521::add(limb_t *result, const limb_t *x, const limb_t *y)
 {
+#if P521_RADIX58
+    // Leave the carries in the spare bits of the limbs for mul().
+    for (uint8_t posn = 0; posn < NUM_LIMBS_521BIT; ++posn)
+        result[posn] = x[posn] + y[posn];
+#else
     dlimb_t carry = 0;
     limb_t *rr = result;
     for (uint8_t posn = 0; posn < NUM_LIMBS_521BIT; ++posn) {
@@ -1077,6 +1549,7 @@ void P521::add(limb_t *result, const limb_t *x, const limb_t *y)
         carry >>= LIMB_BITS;
     }
     reduceQuick(result);
+#endif
 }
 
 /**
@@ -1088,9 +1561,28 @@ void P521::add(limb_t *result, const limb_t *x, const limb_t *y)
  * limbs in size and less than 2^521 - 1.
  * \param y The second value to multiply, which must be NUM_LIMBS_521BIT
  * limbs in size and less than 2^521 - 1.
+ *
+ * With P521_RADIX58, the limbs of \a x must be less than 2^61 and those
+ * of \a y less than 2^60 - 4 (2^59 - 4 for the top limb), which holds for
+ * the results of mul() and sub() and for sums of two of them.  One carry
+ * pass brings the limbs of the result back below 2^58 + 2^5.
  */
 void P521::sub(limb_t *result, const limb_t *x, const limb_t *y)
 {
+#if P521_RADIX58
+    uint8_t posn;
+
+    // Add 4 * (2^521 - 1) so that no limb goes negative, then carry.
+    for (posn = 0; posn < 8; ++posn)
+        result[posn] = x[posn] + LIMB58_4P - y[posn];
+    result[8] = x[8] + LIMB58_4P_HIGH - y[8];
+    for (posn = 0; posn < 8; ++posn) {
+        result[posn + 1] += result[posn] >> 58;
+        result[posn] &= LIMB58_MASK;
+    }
+    result[0] += result[8] >> 57;
+    result[8] &= LIMB57_MASK;
+#else
     dlimb_t borrow;
     uint8_t posn;
     limb_t *rr = result;
@@ -1120,6 +1612,7 @@ void P521::sub(limb_t *result, const limb_t *x, const limb_t *y)
 #else
     *(--rr) &= 0x1FF;
 #endif
+#endif
 }
 
 /**
@@ -1196,7 +1689,13 @@ void P521::dblPoint(limb_t *xout, limb_t *yout, limb_t *zout,
  *
  * The Z value of the second point is implicitly assumed to be 1.
  *
+ * The points must not be equal, which scalar multiplication by a secret
+ * only runs into with negligible probability.  The time taken does not
+ * depend upon the points.
+ *
  * Reference: http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#addition-add-2007-bl
+ *
+ * \sa addPointPublic()
  */
 void P521::addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
                     const limb_t *x1, const limb_t *y1,
@@ -1214,7 +1713,7 @@ void P521::addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
 
     // Determine if the first value is the point-at-infinity identity element.
     // The second z value is always 1 so it cannot be the point-at-infinity.
-    limb_t p1IsIdentity = BigNumberUtil::isZero(z1, NUM_LIMBS_521BIT);
+    limb_t p1IsIdentity = isZero(z1);
 
     // Multiply the points, assuming that z2 = 1.
     square(z1z1, z1);               // z1z1 = z1^2
@@ -1258,6 +1757,329 @@ void P521::addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
     strict_clean(v);
 }
 
+/**
+ * \brief Adds two curve points that are public, one represented in Jacobian
+ * co-ordinates, and the other represented in affine co-ordinates.
+ *
+ * \param xout The X value for the result.
+ * \param yout The Y value for the result.
+ * \param zout The Z value for the result.
+ * \param x1 The X value for the first point to add.
+ * \param y1 The Y value for the first point to add.
+ * \param z1 The Z value for the first point to add.
+ * \param x2 The X value for the second point to add.
+ * \param y2 The Y value for the second point to add.
+ *
+ * The same as addPoint(), except that the points may also be equal.  The
+ * formula in addPoint() gives the point-at-infinity in that case, which
+ * a verifier cannot rule out when the points come from the signature and
+ * public key.  This function is not constant-time and must only be used
+ * with public values.
+ */
+void P521::addPointPublic(limb_t *xout, limb_t *yout, limb_t *zout,
+                          const limb_t *x1, const limb_t *y1,
+                          const limb_t *z1, const limb_t *x2,
+                          const limb_t *y2)
+{
+    addPoint(xout, yout, zout, x1, y1, z1, x2, y2);
+
+    // zout = 2 * z1 * h is zero when the first point is the identity or
+    // when x1 / z1^2 = x2.  The points are then either equal, or negatives
+    // that correctly add up to the point-at-infinity.
+    if (!isZero(zout) || isZero(z1))
+        return;
+    limb_t t[NUM_LIMBS_521BIT];
+    square(t, z1);                  // t = y2 * z1^3 - y1
+    mul(t, t, z1);
+    mul(t, t, y2);
+    sub(t, t, y1);
+    if (isZero(t))
+        dblPoint(xout, yout, zout, x1, y1, z1);
+}
+
+/**
+ * \brief Converts a point from Jacobian co-ordinates into affine co-ordinates.
+ *
+ * \param x The X value for the result.
+ * \param y The Y value for the result.
+ * \param xin The X value for the point to convert.
+ * \param yin The Y value for the point to convert.
+ * \param zin The Z value for the point to convert.
+ *
+ * The outputs can be the same as the inputs.  They are fully reduced
+ * numbers in saturated limbs, as from store(), rather than field elements.
+ */
+void P521::toAffine(limb_t *x, limb_t *y, const limb_t *xin,
+                    const limb_t *yin, const limb_t *zin)
+{
+    limb_t t1[NUM_LIMBS_521BIT];
+    limb_t t2[NUM_LIMBS_521BIT];
+
+    // x = xin * (zin^2)^-1, y = yin * (zin^3)^-1.
+    recip(t1, zin);
+    square(t2, t1);
+    mul(x, xin, t2);
+    mul(t2, t2, t1);
+    mul(y, yin, t2);
+    store(x, x);
+    store(y, y);
+
+    clean(t1);
+    clean(t2);
+}
+
+/**
+ * \brief Splits a scalar into signed digits.
+ *
+ * \param digits The digits, lowest first, each between -2^(width - 1)
+ * and 2^(width - 1).
+ * \param f The 521-bit scalar, most significant byte first.
+ * \param width The number of bits in each digit, between 2 and 5.
+ * \param count The number of digits, which must be 521 / width + 1.
+ *
+ * Only the low 521 bits of \a f are used.  The top digit holds fewer than
+ * \a width bits, so the final carry cannot push it out of range.
+ */
+void P521::recode(int8_t *digits, const uint8_t f[66], uint8_t width,
+                  uint16_t count)
+{
+    int8_t carry = 0;
+    int8_t digit;
+    uint16_t posn;
+    for (posn = 0; posn < count; ++posn) {
+        uint16_t bit = posn * width;
+        uint8_t byte = (uint8_t)(bit / 8);
+        uint16_t window = f[65 - byte];
+        if (byte < 65)
+            window |= ((uint16_t)(f[64 - byte])) << 8;
+        window >>= bit % 8;
+        if (posn < (count - 1)) {
+            digit = (int8_t)(window & ((1 << width) - 1)) + carry;
+            carry = (digit + (1 << (width - 1))) >> width;
+            digit -= carry << width;
+        } else {
+            digit = (int8_t)(window & ((1 << (521 - bit)) - 1)) + carry;
+        }
+        digits[posn] = digit;
+    }
+}
+
+/**
+ * \brief Writes a value in width-w non-adjacent form.
+ *
+ * \param digits The 522 digits of the result, lowest first.  Each one is
+ * zero or odd with an absolute value less than 2^(width - 1), and any
+ * non-zero digit is followed by at least width - 1 zeroes.
+ * \param s The value, which must be NUM_LIMBS_521BIT limbs in size
+ * and less than 2^521.
+ * \param width The width of the form, between 2 and 8.
+ */
+void P521::naf(int8_t *digits, const limb_t *s, uint8_t width)
+{
+    uint8_t bytes[67];
+    uint16_t posn;
+    uint16_t window;
+    uint8_t carry;
+
+    BigNumberUtil::packLE(bytes, 66, s, NUM_LIMBS_521BIT);
+    bytes[66] = 0;
+    memset(digits, 0, P521_NAF_DIGITS);
+
+    // Scan the bits from lowest to highest.  Where the next window plus
+    // the carry is odd, make it a signed digit and skip the window.
+    carry = 0;
+    posn = 0;
+    while (posn < P521_NAF_DIGITS) {
+        window = bytes[posn / 8] | (((uint16_t)(bytes[posn / 8 + 1])) << 8);
+        window = ((window >> (posn % 8)) & ((1 << width) - 1)) + carry;
+        if (!(window & 1)) {
+            ++posn;
+            continue;
+        }
+        if (window < (1 << (width - 1))) {
+            digits[posn] = (int8_t)window;
+            carry = 0;
+        } else {
+            digits[posn] = (int8_t)(window - (1 << width));
+            carry = 1;
+        }
+        posn += width;
+    }
+
+    clean(bytes);
+}
+
+/**
+ * \brief Computes multiples of a point in affine form.
+ *
+ * \param table The multiples, each as an X value followed by a Y value.
+ * \param x The X value for the point.
+ * \param y The Y value for the point.
+ * \param count The number of multiples to compute, between 2 and
+ * P521_MULTIPLES.
+ * \param odd Set to false for the multiples 1, 2, 3, ... of (x, y) that
+ * evaluate() uses, or true for the odd multiples 1, 3, 5, ... that
+ * evaluateDouble() uses.
+ *
+ * The multiples are computed in Jacobian co-ordinates and then converted
+ * into affine co-ordinates together with a single reciprocal.
+ */
+void P521::multiples(limb_t *table, const limb_t *x, const limb_t *y,
+                     uint8_t count, bool odd)
+{
+    limb_t z[P521_MULTIPLES][NUM_LIMBS_521BIT];
+    limb_t prod[P521_MULTIPLES][NUM_LIMBS_521BIT];
+    limb_t inv[NUM_LIMBS_521BIT];
+    limb_t t[NUM_LIMBS_521BIT];
+    limb_t ze[NUM_LIMBS_521BIT];
+    limb_t *entry;
+    uint8_t posn;
+
+    // 1 * (x, y) has z = 1, 2 * (x, y) comes from doubling it, and every
+    // other multiple from adding (x, y) to the one before.  The even
+    // multiples are kept in (inv, t, ze) if only the odd ones are wanted.
+    memcpy(table, x, NUM_LIMBS_521BIT * sizeof(limb_t));
+    memcpy(table + NUM_LIMBS_521BIT, y, NUM_LIMBS_521BIT * sizeof(limb_t));
+    memset(z[0], 0, sizeof(z[0]));
+    z[0][0] = 1;
+    if (odd) {
+        dblPoint(inv, t, ze, x, y, z[0]);
+        for (posn = 1; posn < count; ++posn) {
+            entry = table + posn * 2 * NUM_LIMBS_521BIT;
+            addPoint(entry, entry + NUM_LIMBS_521BIT, z[posn],
+                     inv, t, ze, x, y);
+            if (posn < (count - 1)) {
+                addPoint(inv, t, ze, entry, entry + NUM_LIMBS_521BIT,
+                         z[posn], x, y);
+            }
+        }
+    } else {
+        dblPoint(table + 2 * NUM_LIMBS_521BIT, table + 3 * NUM_LIMBS_521BIT,
+                 z[1], x, y, z[0]);
+        for (posn = 2; posn < count; ++posn) {
+            entry = table + posn * 2 * NUM_LIMBS_521BIT;
+            addPoint(entry, entry + NUM_LIMBS_521BIT, z[posn],
+                     entry - 2 * NUM_LIMBS_521BIT, entry - NUM_LIMBS_521BIT,
+                     z[posn - 1], x, y);
+        }
+    }
+
+    // prod[i] = z[1] * ... * z[i], and inv is the reciprocal of all of them.
+    memcpy(prod[1], z[1], sizeof(z[1]));
+    for (posn = 2; posn < count; ++posn)
+        mul(prod[posn], prod[posn - 1], z[posn]);
+    recip(inv, prod[count - 1]);
+
+    // Work back down the multiples to get the reciprocal of each z value
+    // and convert the multiple into affine co-ordinates.
+    for (posn = count - 1; posn > 0; --posn) {
+        if (posn > 1) {
+            mul(t, inv, prod[posn - 1]);
+            mul(inv, inv, z[posn]);
+        } else {
+            memcpy(t, inv, sizeof(t));
+        }
+        entry = table + posn * 2 * NUM_LIMBS_521BIT;
+        square(prod[posn], t);
+        mul(entry, entry, prod[posn]);
+        mul(prod[posn], prod[posn], t);
+        mul(entry + NUM_LIMBS_521BIT, entry + NUM_LIMBS_521BIT, prod[posn]);
+    }
+
+    clean(z);
+    clean(prod);
+    clean(inv);
+    clean(t);
+    clean(ze);
+}
+
+#if P521_MUL_WINDOW
+
+/**
+ * \brief Selects a multiple of a point from a table in constant time.
+ *
+ * \param x The X value of the selected point.
+ * \param y The Y value of the selected point.
+ * \param table The multiples of the point, from multiples().
+ * \param digit The multiple to select, between -2^(width - 1) and
+ * 2^(width - 1).  The result is undefined for zero.
+ *
+ * Every entry in the table is read and conditionally moved into (x, y),
+ * so the memory accesses and timing do not depend upon \a digit.
+ */
+void P521::selectMultiple(limb_t *x, limb_t *y, const limb_t *table,
+                          int8_t digit)
+{
+    limb_t neg[NUM_LIMBS_521BIT];
+    uint8_t negative = ((uint8_t)digit) >> 7;
+    uint8_t mask = (uint8_t)(0 - negative);
+    uint8_t absDigit = (uint8_t)((((uint8_t)digit) ^ mask) - mask);
+    uint8_t posn;
+
+    memset(x, 0, NUM_LIMBS_521BIT * sizeof(limb_t));
+    memset(y, 0, NUM_LIMBS_521BIT * sizeof(limb_t));
+    for (posn = 1; posn <= P521_MUL_ENTRIES; ++posn) {
+        limb_t select = (limb_t)((((uint32_t)(absDigit ^ posn)) - 1) >> 31);
+        cmove(select, x, table);
+        cmove(select, y, table + NUM_LIMBS_521BIT);
+        table += 2 * NUM_LIMBS_521BIT;
+    }
+
+    // Negate the point if the digit is negative: -(x, y) = (x, -y).
+    memset(neg, 0, sizeof(neg));
+    sub(neg, neg, y);
+    cmove(negative, y, neg);
+    clean(neg);
+}
+
+#endif
+
+#if P521_BASE_TABLE_SPACING
+
+/**
+ * \brief Selects a multiple of the generator from the precomputed table.
+ *
+ * \param x The X value of the selected point.
+ * \param y The Y value of the selected point.
+ * \param row The table row.
+ * \param digit The multiple to select, between -8 and 8.  The result is
+ * undefined for zero.
+ *
+ * Every entry in the row is read and conditionally moved into (x, y),
+ * so the memory accesses and timing do not depend upon \a digit.
+ */
+void P521::selectBase(limb_t *x, limb_t *y, uint8_t row, int8_t digit)
+{
+    limb_t neg[NUM_LIMBS_521BIT];
+    uint8_t negative = ((uint8_t)digit) >> 7;
+    uint8_t mask = (uint8_t)(0 - negative);
+    uint8_t absDigit = (uint8_t)((((uint8_t)digit) ^ mask) - mask);
+    uint8_t posn, index;
+
+    memset(x, 0, NUM_LIMBS_521BIT * sizeof(limb_t));
+    memset(y, 0, NUM_LIMBS_521BIT * sizeof(limb_t));
+    for (posn = 1; posn <= 8; ++posn) {
+        limb_t select = (limb_t)((((uint32_t)(absDigit ^ posn)) - 1) >> 31);
+        const limb_t *src = P521_baseTable[row][posn - 1];
+        select = 0 - select;
+        for (index = 0; index < NUM_LIMBS_521BIT; ++index) {
+            x[index] ^= select & (x[index] ^ pgm_read_limb(&(src[index])));
+            y[index] ^= select &
+                (y[index] ^ pgm_read_limb(&(src[NUM_LIMBS_521BIT + index])));
+        }
+    }
+    load(x, x);
+    load(y, y);
+
+    // Negate the point if the digit is negative: -(x, y) = (x, -y).
+    memset(neg, 0, sizeof(neg));
+    sub(neg, neg, y);
+    cmove(negative, y, neg);
+    clean(neg);
+}
+
+#endif
+
 /**
  * \brief Conditionally moves \a y into \a x if a selection value is non-zero.
  *
@@ -1319,6 +2141,87 @@ void P521::cmove1(limb_t select, limb_t *x)
     }
 }
 
+/**
+ * \brief Loads a field element from a number in saturated limbs.
+ *
+ * \param result The field element, which must be NUM_LIMBS_521BIT limbs
+ * in size and can be the same array as \a x.
+ * \param x The number, which must be NUM_LIMBS_521BIT limbs in size and
+ * less than 2^521.
+ *
+ * \sa store()
+ */
+void P521::load(limb_t *result, const limb_t *x)
+{
+#if P521_RADIX58
+    // Work from the top down so that result can be the same as x.
+    result[8] = ((x[7] >> 16) | (x[8] << 48)) & LIMB57_MASK;
+    result[7] = ((x[6] >> 22) | (x[7] << 42)) & LIMB58_MASK;
+    result[6] = ((x[5] >> 28) | (x[6] << 36)) & LIMB58_MASK;
+    result[5] = ((x[4] >> 34) | (x[5] << 30)) & LIMB58_MASK;
+    result[4] = ((x[3] >> 40) | (x[4] << 24)) & LIMB58_MASK;
+    result[3] = ((x[2] >> 46) | (x[3] << 18)) & LIMB58_MASK;
+    result[2] = ((x[1] >> 52) | (x[2] << 12)) & LIMB58_MASK;
+    result[1] = ((x[0] >> 58) | (x[1] << 6)) & LIMB58_MASK;
+    result[0] = x[0] & LIMB58_MASK;
+#else
+    if (result != x)
+        memcpy(result, x, NUM_LIMBS_521BIT * sizeof(limb_t));
+#endif
+}
+
+/**
+ * \brief Stores a field element as a number in saturated limbs.
+ *
+ * \param result The number, which must be NUM_LIMBS_521BIT limbs in size
+ * and can be the same array as \a x.
+ * \param x The field element, which must be NUM_LIMBS_521BIT limbs in size.
+ *
+ * The number is the fully reduced value of \a x, less than 2^521 - 1.
+ *
+ * \sa load()
+ */
+void P521::store(limb_t *result, const limb_t *x)
+{
+#if P521_RADIX58
+    limb_t temp[NUM_LIMBS_521BIT];
+    memcpy(temp, x, sizeof(temp));
+    reduceQuick(temp);
+    result[0] = temp[0] | (temp[1] << 58);
+    result[1] = (temp[1] >> 6) | (temp[2] << 52);
+    result[2] = (temp[2] >> 12) | (temp[3] << 46);
+    result[3] = (temp[3] >> 18) | (temp[4] << 40);
+    result[4] = (temp[4] >> 24) | (temp[5] << 34);
+    result[5] = (temp[5] >> 30) | (temp[6] << 28);
+    result[6] = (temp[6] >> 36) | (temp[7] << 22);
+    result[7] = (temp[7] >> 42) | (temp[8] << 16);
+    result[8] = temp[8] >> 48;
+    strict_clean(temp);
+#else
+    if (result != x)
+        memcpy(result, x, NUM_LIMBS_521BIT * sizeof(limb_t));
+#endif
+}
+
+/**
+ * \brief Determines if a field element is zero modulo 2^521 - 1.
+ *
+ * \param x The field element, which must be NUM_LIMBS_521BIT limbs in size.
+ *
+ * \return Returns true if \a x is zero; false otherwise.
+ */
+bool P521::isZero(const limb_t *x)
+{
+#if P521_RADIX58
+    limb_t temp[NUM_LIMBS_521BIT];
+    memcpy(temp, x, sizeof(temp));
+    reduceQuick(temp);
+    return BigNumberUtil::isZero(temp, NUM_LIMBS_521BIT) != 0;
+#else
+    return BigNumberUtil::isZero(x, NUM_LIMBS_521BIT) != 0;
+#endif
+}
+
 /**
  * \brief Computes the reciprocal of a number modulo 2^521 - 1.
  *
@@ -1370,72 +2273,6 @@ void P521::recip(limb_t *result, const limb_t *x)
     clean(t1);
 }
 
-/**
- * \brief Reduces a number modulo q.
- *
- * \param result The result array, which must be NUM_LIMBS_521BIT limbs in size.
- * \param r The value to reduce, which must be NUM_LIMBS_1042BIT limbs in size.
- *
- * It is allowed for \a result to be the same as \a r.
- */
-void P521::reduceQ(limb_t *result, const limb_t *r)
-{
-    // Algorithm from: http://en.wikipedia.org/wiki/Barrett_reduction
-    //
-    // We assume that r is less than or equal to (q - 1)^2.
-    //
-    // We want to compute result = r mod q.  Find the smallest k such
-    // that 2^k > q.  In our case, k = 521.  Then set m = floor(4^k / q)
-    // and let r = r - q * floor(m * r / 4^k).  This will be the result
-    // or it will be at most one subtraction of q away from the result.
-    //
-    // Note: m is a 522-bit number, which fits in the same number of limbs
-    // as a 521-bit number assuming that limbs are 8 bits or more in size.
-    static limb_t const numM[NUM_LIMBS_521BIT] PROGMEM = {
-        LIMB_PAIR(0x6EC79BF7, 0x449048E1), LIMB_PAIR(0x7663B851, 0xC44A3647),
-        LIMB_PAIR(0x08F65A2F, 0x8033FEB7), LIMB_PAIR(0x40D06994, 0xAE79787C),
-        LIMB_PAIR(0x00000005, 0x00000000), LIMB_PAIR(0x00000000, 0x00000000),
-        LIMB_PAIR(0x00000000, 0x00000000), LIMB_PAIR(0x00000000, 0x00000000),
-        LIMB_PARTIAL(0x200)
-    };
-    limb_t temp[NUM_LIMBS_1042BIT + NUM_LIMBS_521BIT];
-    limb_t temp2[NUM_LIMBS_521BIT];
-
-    // Multiply r by m.
-    BigNumberUtil::mul_P(temp, r, NUM_LIMBS_1042BIT, numM, NUM_LIMBS_521BIT);
-
-    // Compute (m * r / 4^521) = (m * r / 2^1042).
-#if BIGNUMBER_LIMB_8BIT || BIGNUMBER_LIMB_16BIT
-    dlimb_t carry = temp[NUM_LIMBS_BITS(1040)] >> 2;
-    for (uint8_t index = 0; index < NUM_LIMBS_521BIT; ++index) {
-        carry += ((dlimb_t)(temp[NUM_LIMBS_BITS(1040) + index + 1])) << (LIMB_BITS - 2);
-        temp2[index] = (limb_t)carry;
-        carry >>= LIMB_BITS;
-    }
-#elif BIGNUMBER_LIMB_32BIT || BIGNUMBER_LIMB_64BIT
-    dlimb_t carry = temp[NUM_LIMBS_BITS(1024)] >> 18;
-    for (uint8_t index = 0; index < NUM_LIMBS_521BIT; ++index) {
-        carry += ((dlimb_t)(temp[NUM_LIMBS_BITS(1024) + index + 1])) << (LIMB_BITS - 18);
-        temp2[index] = (limb_t)carry;
-        carry >>= LIMB_BITS;
-    }
-#endif
-
-    // Multiply (m * r) / 2^1042 by q and subtract it from r.
-    // We can ignore the high words of the subtraction result
-    // because they will all turn into zero after the subtraction.
-    BigNumberUtil::mul_P(temp, temp2, NUM_LIMBS_521BIT,
-                         P521_q, NUM_LIMBS_521BIT);
-    BigNumberUtil::sub(result, r, temp, NUM_LIMBS_521BIT);
-
-    // Perform a trial subtraction of q from the result to reduce it.
-    BigNumberUtil::reduceQuick_P(result, result, P521_q, NUM_LIMBS_521BIT);
-
-    // Clean up and exit.
-    clean(temp);
-    clean(temp2);
-}
-
 /**
  * \brief Multiplies two values and then reduces the result modulo q.
  *
@@ -1448,10 +2285,7 @@ void P521::reduceQ(limb_t *result, const limb_t *r)
  */
 void P521::mulQ(limb_t *result, const limb_t *x, const limb_t *y)
 {
-    limb_t temp[NUM_LIMBS_1042BIT];
-    mulNoReduce(temp, x, y);
-    reduceQ(result, temp);
-    strict_clean(temp);
+    BigNumberUtil::mulMod<P521ModQ>(result, x, y);
 }
 
 /**
@@ -1464,42 +2298,9 @@ void P521::mulQ(limb_t *result, const limb_t *x, const limb_t *y)
  */
 void P521::recipQ(limb_t *result, const limb_t *x)
 {
-    // Bottom 265 bits of q - 2.  The top 256 bits are all-1's.
-    static limb_t const P521_q_m2[] PROGMEM = {
-        LIMB_PAIR(0x91386407, 0xbb6fb71e), LIMB_PAIR(0x899c47ae, 0x3bb5c9b8),
-        LIMB_PAIR(0xf709a5d0, 0x7fcc0148), LIMB_PAIR(0xbf2f966b, 0x51868783),
-        LIMB_PARTIAL(0x1fa)
-    };
-
-    // Raise x to the power of q - 2, mod q.  We start with the top
-    // 256 bits which are all-1's, using a similar technique to recip().
-    limb_t t1[NUM_LIMBS_521BIT];
-    mulQ(result, x, x);
-    mulQ(result, result, x);
-    mulQ(result, result, result);
-    mulQ(result, result, x);
-    mulQ(result, result, result);
-    mulQ(result, result, x);
-    for (size_t power = 4; power <= 128; power <<= 1) {
-        mulQ(t1, result, result);
-        for (size_t temp = 1; temp < power; ++temp)
-            mulQ(t1, t1, t1);
-        mulQ(result, result, t1);
-    }
-    clean(t1);
-
-    // Deal with the bottom 265 bits from highest to lowest.  Square for
-    // each bit and multiply in x whenever there is a 1 bit.  The timing
+    // Raise x to the power of q - 2 in Montgomery form.  The timing
     // is based on the publicly-known constant q - 2, not on the value of x.
-    size_t bit = 265;
-    while (bit > 0) {
-        --bit;
-        mulQ(result, result, result);
-        if (pgm_read_limb(&(P521_q_m2[bit / LIMB_BITS])) &
-                (((limb_t)1) << (bit % LIMB_BITS))) {
-            mulQ(result, result, x);
-        }
-    }
+    BigNumberUtil::recipMod<P521ModQ>(result, x);
 }
 
 /**
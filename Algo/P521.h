@@ -25,6 +25,22 @@
 
 #include "BigNumberUtil.h"
 
+// Field elements are normally NUM_LIMBS_521BIT saturated limbs, fully
+// reduced modulo 2^521 - 1 after every operation.  Where dlimb_t is a
+// 128-bit type they are instead 9 limbs of 58 bits (57 bits in the top
+// limb): add() leaves its carries in the spare bits for the next mul(),
+// and values are only reduced fully when they are stored or compared.
+// Define P521_RADIX58 to 0 to use the saturated limbs on 64-bit hosts too.
+#if !defined(P521_RADIX58)
+#if BIGNUMBER_LIMB_64BIT
+#define P521_RADIX58 1
+#else
+#define P521_RADIX58 0
+#endif
+#elif P521_RADIX58 && !BIGNUMBER_LIMB_64BIT
+#error "P521_RADIX58 needs 64-bit limbs"
+#endif
+
 class Hash;
 
 class P521
@@ -59,9 +75,9 @@ public:
 private:
 #endif
     static void evaluate(limb_t *x, limb_t *y, const uint8_t f[66]);
-
-    static void addAffine(limb_t *x1, limb_t *y1,
-                          const limb_t *x2, const limb_t *y2);
+    static void evaluateBase(limb_t *x, limb_t *y, const uint8_t f[66]);
+    static void evaluateDouble(limb_t *x, limb_t *y, const limb_t *u1,
+                               const limb_t *u2);
 
     static bool validate(const limb_t *x, const limb_t *y);
     static bool inRange(const limb_t *x);
@@ -72,10 +88,7 @@ private:
     static void mulNoReduce(limb_t *result, const limb_t *x, const limb_t *y);
 
     static void mul(limb_t *result, const limb_t *x, const limb_t *y);
-    static void square(limb_t *result, const limb_t *x)
-    {
-        mul(result, x, x);
-    }
+    static void square(limb_t *result, const limb_t *x);
 
     static void mulLiteral(limb_t *result, const limb_t *x, limb_t y);
 
@@ -89,13 +102,32 @@ private:
                          const limb_t *x1, const limb_t *y1,
                          const limb_t *z1, const limb_t *x2,
                          const limb_t *y2);
+    static void addPointPublic(limb_t *xout, limb_t *yout, limb_t *zout,
+                               const limb_t *x1, const limb_t *y1,
+                               const limb_t *z1, const limb_t *x2,
+                               const limb_t *y2);
+
+    static void toAffine(limb_t *x, limb_t *y, const limb_t *xin,
+                         const limb_t *yin, const limb_t *zin);
+
+    static void recode(int8_t *digits, const uint8_t f[66], uint8_t width,
+                       uint16_t count);
+    static void multiples(limb_t *table, const limb_t *x, const limb_t *y,
+                          uint8_t count, bool odd);
+    static void naf(int8_t *digits, const limb_t *s, uint8_t width);
+    static void selectMultiple(limb_t *x, limb_t *y, const limb_t *table,
+                               int8_t digit);
+    static void selectBase(limb_t *x, limb_t *y, uint8_t row, int8_t digit);
 
     static void cmove(limb_t select, limb_t *x, const limb_t *y);
     static void cmove1(limb_t select, limb_t *x);
 
+    static void load(limb_t *result, const limb_t *x);
+    static void store(limb_t *result, const limb_t *x);
+    static bool isZero(const limb_t *x);
+
     static void recip(limb_t *result, const limb_t *x);
 
-    static void reduceQ(limb_t *result, const limb_t *r);
     static void mulQ(limb_t *result, const limb_t *x, const limb_t *y);
     static void recipQ(limb_t *result, const limb_t *x);
 
@@ -27,6 +27,144 @@
 #include "utility/ProgMemUtil.h"
 #include <string.h>
 
+// Round constants for SHA-256.
+static uint32_t const SHA256_k[64] PROGMEM = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+// On x86-64 hosts, update() and processChunk() use the SHA extensions when
+// CPUID reports them, and update() compresses whole 64-byte blocks straight
+// from the caller's data rather than copying them into state.w first.  The
+// kernel is built with a function attribute, so no special compiler flags
+// are needed.  Define SHA256_SHANI to 0 to always use the portable code.
+#if !defined(SHA256_SHANI)
+#if defined(__x86_64__) && defined(__GNUC__)
+#define SHA256_SHANI 1
+#else
+#define SHA256_SHANI 0
+#endif
+#elif SHA256_SHANI && !(defined(__x86_64__) && defined(__GNUC__))
+#error "SHA256_SHANI needs x86-64 with GCC or Clang"
+#endif
+
+#if SHA256_SHANI
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/** @cond sha256_shani */
+
+// Checks once at startup for the SHA extensions and the SSSE3 and SSE4.1
+// shuffles that the kernel also needs.  Hashing from the constructor of
+// another static object before this has run uses the portable code.
+static bool shaniSupported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+            !(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1))
+        return false;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return false;
+    return (ebx & bit_SHA) != 0;
+}
+
+static bool const haveSHANI = shaniSupported();
+
+// Four rounds for the message words in "cur", which also advances the
+// message schedule: "next" receives the words four rounds ahead with
+// SHA256MSG2, and "prev" gets the first half of its own update with
+// SHA256MSG1 for use three groups later.
+#define SHANI_ROUNDS(group, cur, next, prev) \
+    do { \
+        msg = _mm_add_epi32 \
+            ((cur), _mm_loadu_si128((const __m128i *)(SHA256_k + 4 * (group)))); \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg); \
+        if ((group) >= 3 && (group) <= 14) { \
+            (next) = _mm_add_epi32((next), _mm_alignr_epi8((cur), (prev), 4)); \
+            (next) = _mm_sha256msg2_epu32((next), (cur)); \
+        } \
+        msg = _mm_shuffle_epi32(msg, 0x0E); \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg); \
+        if ((group) >= 1 && (group) <= 12) \
+            (prev) = _mm_sha256msg1_epu32((prev), (cur)); \
+    } while (0)
+
+// Compresses "blocks" 64-byte blocks of "data" into the hash value "h".
+static __attribute__((target("sha,sse4.1"))) void shaniProcessBlocks
+    (uint32_t h[8], const uint8_t *data, size_t blocks)
+{
+    const __m128i swap = _mm_set_epi64x
+        (0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, save0, save1, msg, temp;
+    __m128i w0, w1, w2, w3;
+
+    // The rounds instruction wants the state as ABEF and CDGH.
+    temp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)h), 0xB1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(h + 4)), 0x1B);
+    state0 = _mm_alignr_epi8(temp, state1, 8);
+    state1 = _mm_blend_epi16(state1, temp, 0xF0);
+
+    while (blocks > 0) {
+        save0 = state0;
+        save1 = state1;
+
+        // Load the block as big-endian words.
+        w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), swap);
+        w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), swap);
+        w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), swap);
+        w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), swap);
+
+        SHANI_ROUNDS(0, w0, w1, w3);
+        SHANI_ROUNDS(1, w1, w2, w0);
+        SHANI_ROUNDS(2, w2, w3, w1);
+        SHANI_ROUNDS(3, w3, w0, w2);
+        SHANI_ROUNDS(4, w0, w1, w3);
+        SHANI_ROUNDS(5, w1, w2, w0);
+        SHANI_ROUNDS(6, w2, w3, w1);
+        SHANI_ROUNDS(7, w3, w0, w2);
+        SHANI_ROUNDS(8, w0, w1, w3);
+        SHANI_ROUNDS(9, w1, w2, w0);
+        SHANI_ROUNDS(10, w2, w3, w1);
+        SHANI_ROUNDS(11, w3, w0, w2);
+        SHANI_ROUNDS(12, w0, w1, w3);
+        SHANI_ROUNDS(13, w1, w2, w0);
+        SHANI_ROUNDS(14, w2, w3, w1);
+        SHANI_ROUNDS(15, w3, w0, w2);
+
+        state0 = _mm_add_epi32(state0, save0);
+        state1 = _mm_add_epi32(state1, save1);
+        data += 64;
+        --blocks;
+    }
+
+    // Convert ABEF and CDGH back into ABCD and EFGH.
+    temp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(temp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, temp, 8);
+    _mm_storeu_si128((__m128i *)h, state0);
+    _mm_storeu_si128((__m128i *)(h + 4), state1);
+}
+
+/** @endcond */
+
+#endif // SHA256_SHANI
+
 /**
  * \class SHA256 SHA256.h <SHA256.h>
  * \brief SHA-256 hash algorithm.
@@ -95,6 +233,15 @@ void SHA256::update(const void *data, size_t len)
     // Break the input up into 512-bit chunks and process each in turn.
     const uint8_t *d = (const uint8_t *)data;
     while (len > 0) {
+#if SHA256_SHANI
+        if (state.chunkSize == 0 && len >= 64 && haveSHANI) {
+            size_t blocks = len / 64;
+            shaniProcessBlocks(state.h, d, blocks);
+            len -= blocks * 64;
+            d += blocks * 64;
+            continue;
+        }
+#endif
         uint8_t size = 64 - state.chunkSize;
         if (size > len)
             size = len;
@@ -173,25 +320,12 @@ void SHA256::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t has
  */
 void SHA256::processChunk()
 {
-    // Round constants for SHA-256.
-    static uint32_t const k[64] PROGMEM = {
-        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-    };
+#if SHA256_SHANI
+    if (haveSHANI) {
+        shaniProcessBlocks(state.h, (const uint8_t *)state.w, 1);
+        return;
+    }
+#endif
 
     // Convert the first 16 words from big endian to host byte order.
     uint8_t index;
@@ -211,7 +345,7 @@ void SHA256::processChunk()
     // Perform the first 16 rounds of the compression function main loop.
     uint32_t temp1, temp2;
     for (index = 0; index < 16; ++index) {
-        temp1 = h + pgm_read_dword(k + index) + state.w[index] +
+        temp1 = h + pgm_read_dword(SHA256_k + index) + state.w[index] +
                 (rightRotate6(e) ^ rightRotate11(e) ^ rightRotate25(e)) +
                 ((e & f) ^ ((~e) & g));
         temp2 = (rightRotate2(a) ^ rightRotate13(a) ^ rightRotate22(a)) +
@@ -239,7 +373,7 @@ void SHA256::processChunk()
                 (rightRotate17(temp2) ^ rightRotate19(temp2) ^ (temp2 >> 10));
 
         // Perform the round.
-        temp1 = h + pgm_read_dword(k + index) + temp1 +
+        temp1 = h + pgm_read_dword(SHA256_k + index) + temp1 +
                 (rightRotate6(e) ^ rightRotate11(e) ^ rightRotate25(e)) +
                 ((e & f) ^ ((~e) & g));
         temp2 = (rightRotate2(a) ^ rightRotate13(a) ^ rightRotate22(a)) +
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "SHA512_256.h"
+#include "Crypto.h"
+#include "utility/ProgMemUtil.h"
+#include <string.h>
+
+/**
+ * \class SHA512_256 SHA512_256.h <SHA512_256.h>
+ * \brief SHA-512/256 hash algorithm.
+ *
+ * This is SHA-512 with a distinct set of initial hash values and the
+ * output truncated to 256 bits.  Algorand uses it for transaction IDs,
+ * address and mnemonic checksums, and most other on-chain digests.
+ *
+ * Reference: FIPS 180-4, section 5.3.6.2
+ *
+ * \sa SHA512, SHA384, SHA256
+ */
+
+/**
+ * \var SHA512_256::HASH_SIZE
+ * \brief Constant for the size of the hash output of SHA512_256.
+ */
+
+/**
+ * \brief Constructs a SHA-512/256 hash object.
+ */
+SHA512_256::SHA512_256()
+{
+    reset();
+}
+
+size_t SHA512_256::hashSize() const
+{
+    return 32;
+}
+
+void SHA512_256::reset()
+{
+    static uint64_t const hashStart[8] PROGMEM = {
+        0x22312194FC2BF72CULL, 0x9F555FA3C84C64C2ULL, 0x2393B86B6F53B151ULL,
+        0x963877195940EABDULL, 0x96283EE2A88EFFE3ULL, 0xBE5E1E2553863992ULL,
+        0x2B0199FC2C85B8AAULL, 0x0EB72DDC81C52CA2ULL
+    };
+    memcpy_P(state.h, hashStart, sizeof(hashStart));
+    state.chunkSize = 0;
+    state.lengthLow = 0;
+    state.lengthHigh = 0;
+}
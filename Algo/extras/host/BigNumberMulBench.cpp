@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Host benchmark for BigNumberUtil::mul() on 4 to 17 limb operands.
+ *
+ * Build from the Algo directory with and without the MULX kernel to
+ * compare the two paths:
+ *
+ *   g++ -O2 -I. -o mulbench extras/host/BigNumberMulBench.cpp \
+ *       BigNumberUtil.cpp Crypto.cpp
+ *   g++ -O2 -I. -DBIGNUMBER_MULX=0 -o mulbench-portable \
+ *       extras/host/BigNumberMulBench.cpp BigNumberUtil.cpp Crypto.cpp
+ *
+ * Each size is checked against a schoolbook reference before it is timed.
+ * The time reported is the best of 300 runs of 1000 calls.
+ */
+
+#include "BigNumberUtil.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define MIN_LIMBS   4
+#define MAX_LIMBS   17
+#define RUNS        300
+#define CALLS       1000
+
+static uint64_t seed = 88172645463325252ULL;
+
+static limb_t randomLimb()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return (limb_t)seed;
+}
+
+static void referenceMul(limb_t *result, const limb_t *x, const limb_t *y,
+                         size_t count)
+{
+    memset(result, 0, 2 * count * sizeof(limb_t));
+    for (size_t i = 0; i < count; ++i) {
+        dlimb_t carry = 0;
+        for (size_t j = 0; j < count; ++j) {
+            carry += ((dlimb_t)x[j]) * y[i] + result[i + j];
+            result[i + j] = (limb_t)carry;
+            carry >>= 8 * sizeof(limb_t);
+        }
+        result[i + count] = (limb_t)carry;
+    }
+}
+
+int main()
+{
+    limb_t x[MAX_LIMBS], y[MAX_LIMBS];
+    limb_t result[2 * MAX_LIMBS], expected[2 * MAX_LIMBS];
+    int errors = 0;
+
+    for (size_t i = 0; i < MAX_LIMBS; ++i) {
+        x[i] = randomLimb();
+        y[i] = randomLimb();
+    }
+
+    printf("limbs  ns/mul (%d-bit limbs)\n", (int)(8 * sizeof(limb_t)));
+    for (size_t count = MIN_LIMBS; count <= MAX_LIMBS; ++count) {
+        BigNumberUtil::mul(result, x, count, y, count);
+        referenceMul(expected, x, y, count);
+        if (memcmp(result, expected, 2 * count * sizeof(limb_t)) != 0) {
+            printf("%5d  wrong result\n", (int)count);
+            ++errors;
+            continue;
+        }
+
+        double best = 1e30;
+        for (int run = 0; run < RUNS; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            for (int call = 0; call < CALLS; ++call) {
+                BigNumberUtil::mul(result, x, count, y, count);
+                x[0] ^= result[count];  // Chain the calls together.
+            }
+            double ns = std::chrono::duration<double, std::nano>
+                (std::chrono::steady_clock::now() - start).count() / CALLS;
+            if (ns < best)
+                best = ns;
+        }
+        printf("%5d  %6.1f\n", (int)count, best);
+    }
+    return errors ? 1 : 0;
+}
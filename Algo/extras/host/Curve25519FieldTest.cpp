@@ -0,0 +1,515 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Host tests for Curve25519 and its field arithmetic.  Build from the Algo
+ * directory, once with the default radix-2^51 field on 64-bit hosts and
+ * once with the saturated limbs:
+ *
+ *   g++ -O2 -I. -DTEST_CURVE25519_FIELD_OPS -o curve25519test \
+ *       extras/host/Curve25519FieldTest.cpp extras/host/HostRNG.cpp \
+ *       Curve25519.cpp Ed25519.cpp BigNumberUtil.cpp SHA512.cpp Hash.cpp \
+ *       Crypto.cpp
+ *   g++ -O2 -I. -DTEST_CURVE25519_FIELD_OPS -DCURVE25519_RADIX51=0 \
+ *       -o curve25519test-saturated ...
+ *
+ * Build it a third time with -DCURVE25519_AVX2=1 to check the AVX2 kernel
+ * behind mul4() and square4() against mul() and square().
+ *
+ * The known answer tests are from RFC 7748 (X25519) and RFC 8032 (Ed25519).
+ * The field operations, made visible by TEST_CURVE25519_FIELD_OPS, are
+ * then run on pseudorandom inputs and checked against a plain reference
+ * on 32-bit words.  The inputs are the same on every build, so the digest
+ * printed at the end must be the same for both field representations.
+ */
+
+#include "Curve25519.h"
+#include "Ed25519.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FIELD_TESTS 20000
+
+static int errors = 0;
+
+static void fromHex(uint8_t *data, const char *hex)
+{
+    for (size_t i = 0; hex[2 * i] != '\0'; ++i) {
+        unsigned value;
+        sscanf(hex + 2 * i, "%2x", &value);
+        data[i] = (uint8_t)value;
+    }
+}
+
+static void check(const char *name, const uint8_t *actual, const char *hex)
+{
+    uint8_t expected[64];
+    size_t len = strlen(hex) / 2;
+    fromHex(expected, hex);
+    if (memcmp(actual, expected, len) != 0) {
+        printf("%s ... failed\n", name);
+        ++errors;
+    } else {
+        printf("%s ... ok\n", name);
+    }
+}
+
+// X25519 from RFC 7748, with the scalar clamped as in decodeScalar25519.
+static void x25519(uint8_t result[32], const uint8_t k[32],
+                   const uint8_t u[32])
+{
+    uint8_t s[32];
+    memcpy(s, k, 32);
+    s[0] &= 0xF8;
+    s[31] = (s[31] & 0x7F) | 0x40;
+    Curve25519::eval(result, s, u);
+}
+
+static void testX25519()
+{
+    uint8_t k[32], u[32], result[32];
+
+    // RFC 7748, section 5.2.
+    fromHex(k, "a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4");
+    fromHex(u, "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c");
+    x25519(result, k, u);
+    check("X25519 #1", result,
+          "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552");
+
+    fromHex(k, "4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d");
+    fromHex(u, "e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493");
+    x25519(result, k, u);
+    check("X25519 #2", result,
+          "95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957");
+
+    memset(k, 0, 32);
+    k[0] = 9;
+    memcpy(u, k, 32);
+    for (int iteration = 1; iteration <= 1000; ++iteration) {
+        x25519(result, k, u);
+        memcpy(u, k, 32);
+        memcpy(k, result, 32);
+        if (iteration == 1) {
+            check("X25519 1 iteration", k,
+                  "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079");
+        }
+    }
+    check("X25519 1000 iterations", k,
+          "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51");
+
+    // RFC 7748, section 6.1.
+    uint8_t alice[32], bob[32], alicePublic[32], bobPublic[32];
+    uint8_t base[32] = {9};
+    fromHex(alice, "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a");
+    fromHex(bob, "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb");
+    x25519(alicePublic, alice, base);
+    check("X25519 Alice public key", alicePublic,
+          "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a");
+    x25519(bobPublic, bob, base);
+    check("X25519 Bob public key", bobPublic,
+          "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f");
+    x25519(result, alice, bobPublic);
+    check("X25519 shared secret (Alice)", result,
+          "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742");
+    x25519(result, bob, alicePublic);
+    check("X25519 shared secret (Bob)", result,
+          "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742");
+}
+
+struct Ed25519TestVector
+{
+    const char *name;
+    const char *privateKey;
+    const char *publicKey;
+    const char *message;
+    const char *signature;
+};
+
+// RFC 8032, section 7.1, tests 1 to 3.
+static const Ed25519TestVector ed25519Vectors[] = {
+    {"Ed25519 test 1",
+     "9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+     "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+     "",
+     "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e06522490155"
+     "5fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b"},
+    {"Ed25519 test 2",
+     "4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+     "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+     "72",
+     "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da"
+     "085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00"},
+    {"Ed25519 test 3",
+     "c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+     "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+     "af82",
+     "6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac"
+     "18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a"},
+};
+
+static void testEd25519()
+{
+    for (size_t i = 0; i < sizeof(ed25519Vectors) / sizeof(ed25519Vectors[0]); ++i) {
+        const Ed25519TestVector &test = ed25519Vectors[i];
+        uint8_t privateKey[32], publicKey[32], signature[64];
+        uint8_t message[2];
+        size_t len = strlen(test.message) / 2;
+        char name[64];
+
+        fromHex(privateKey, test.privateKey);
+        fromHex(message, test.message);
+
+        Ed25519::derivePublicKey(publicKey, privateKey);
+        snprintf(name, sizeof(name), "%s public key", test.name);
+        check(name, publicKey, test.publicKey);
+
+        Ed25519::sign(signature, privateKey, publicKey, message, len);
+        snprintf(name, sizeof(name), "%s signature", test.name);
+        check(name, signature, test.signature);
+
+        fromHex(signature, test.signature);
+        bool ok = Ed25519::verify(signature, publicKey, message, len);
+        signature[63] ^= 0x01;
+        ok = ok && !Ed25519::verify(signature, publicKey, message, len);
+        printf("%s verify ... %s\n", test.name, ok ? "ok" : "failed");
+        if (!ok)
+            ++errors;
+    }
+}
+
+// Reference arithmetic modulo p = 2^255 - 19 on eight 32-bit words,
+// least significant first, always fully reduced.
+typedef uint32_t RefElement[8];
+
+static const RefElement refP = {
+    0xFFFFFFED, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF
+};
+
+// Subtracts p from x if x >= p, for x < 2 * p.
+static void refReduceOnce(RefElement x)
+{
+    RefElement t;
+    int64_t borrow = 0;
+    for (int i = 0; i < 8; ++i) {
+        borrow += (int64_t)x[i] - refP[i];
+        t[i] = (uint32_t)borrow;
+        borrow >>= 32;
+    }
+    if (borrow == 0)
+        memcpy(x, t, sizeof(t));
+}
+
+// Reduces the 512-bit value w modulo p, using 2^256 = 38 (mod p).
+static void refReduceWide(RefElement result, const uint32_t w[16])
+{
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; ++i) {
+        carry += w[i] + (uint64_t)w[i + 8] * 38;
+        result[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    while (carry != 0) {
+        carry *= 38;
+        for (int i = 0; i < 8; ++i) {
+            carry += result[i];
+            result[i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+    }
+    carry = (result[7] >> 31) * 19;
+    result[7] &= 0x7FFFFFFF;
+    for (int i = 0; i < 8; ++i) {
+        carry += result[i];
+        result[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    refReduceOnce(result);
+}
+
+static void refMul(RefElement result, const RefElement x, const RefElement y)
+{
+    uint32_t w[16] = {0};
+    for (int i = 0; i < 8; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 8; ++j) {
+            carry += (uint64_t)x[i] * y[j] + w[i + j];
+            w[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        w[i + 8] = (uint32_t)carry;
+    }
+    refReduceWide(result, w);
+}
+
+static void refAdd(RefElement result, const RefElement x, const RefElement y)
+{
+    uint32_t w[16] = {0};
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; ++i) {
+        carry += (uint64_t)x[i] + y[i];
+        w[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    w[8] = (uint32_t)carry;
+    refReduceWide(result, w);
+}
+
+static void refSub(RefElement result, const RefElement x, const RefElement y)
+{
+    RefElement negY;
+    int64_t borrow = 0;
+    for (int i = 0; i < 8; ++i) {
+        borrow += (int64_t)refP[i] - y[i];
+        negY[i] = (uint32_t)borrow;
+        borrow >>= 32;
+    }
+    refAdd(result, x, negY);
+}
+
+static void refFromBytes(RefElement result, const uint8_t bytes[32])
+{
+    uint32_t w[16] = {0};
+    for (int i = 0; i < 32; ++i)
+        w[i / 4] |= ((uint32_t)bytes[i]) << (8 * (i % 4));
+    w[7] &= 0x7FFFFFFF;
+    refReduceWide(result, w);
+}
+
+static void refToBytes(uint8_t bytes[32], const RefElement x)
+{
+    for (int i = 0; i < 32; ++i)
+        bytes[i] = (uint8_t)(x[i / 4] >> (8 * (i % 4)));
+}
+
+static uint64_t seed = 0x2545F4914F6CDD1DULL;
+
+static uint8_t randomByte()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return (uint8_t)(seed >> 24);
+}
+
+// Fills bytes with a pseudorandom value below 2^255, biased towards the
+// edges of the field where the carries and reductions are exercised.
+static void randomValue(uint8_t bytes[32])
+{
+    uint8_t kind = randomByte() % 8;
+    for (int i = 0; i < 32; ++i)
+        bytes[i] = randomByte();
+    if (kind == 0)
+        memset(bytes, 0xFF, 32);            // 2^255 - 1, above p
+    else if (kind == 1)
+        memset(bytes + 1, 0, 31);           // Small value
+    else if (kind == 2)
+        memset(bytes + 1, 0xFF, 31);        // Close to p
+    bytes[31] &= 0x7F;
+}
+
+static uint32_t digest = 2166136261U;
+
+static void addToDigest(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; ++i)
+        digest = (digest ^ data[i]) * 16777619U;
+}
+
+// Compares a field element against the reference result.
+static void checkField(const char *name, int test, const limb_t *actual,
+                       const RefElement expected)
+{
+    uint8_t actualBytes[32], expectedBytes[32];
+    Curve25519::pack(actualBytes, actual);
+    refToBytes(expectedBytes, expected);
+    addToDigest(actualBytes, sizeof(actualBytes));
+    if (memcmp(actualBytes, expectedBytes, 32) != 0) {
+        if (errors < 10)
+            printf("%s, test %d ... failed\n", name, test);
+        ++errors;
+    }
+}
+
+static void testFieldOps()
+{
+    int before = errors;
+    for (int test = 0; test < FIELD_TESTS; ++test) {
+        uint8_t a[32], b[32], c[32], d[32];
+        limb_t x[NUM_LIMBS_FIELD25519], y[NUM_LIMBS_FIELD25519];
+        limb_t z[NUM_LIMBS_FIELD25519], w[NUM_LIMBS_FIELD25519];
+        limb_t s[NUM_LIMBS_FIELD25519], t[NUM_LIMBS_FIELD25519];
+        limb_t result[NUM_LIMBS_FIELD25519];
+        RefElement ra, rb, rc, rd, rs, rt, expected;
+
+        randomValue(a);
+        randomValue(b);
+        randomValue(c);
+        randomValue(d);
+        refFromBytes(ra, a);
+        refFromBytes(rb, b);
+        refFromBytes(rc, c);
+        refFromBytes(rd, d);
+        Curve25519::unpack(x, a);
+        Curve25519::unpack(y, b);
+        Curve25519::unpack(z, c);
+        Curve25519::unpack(w, d);
+
+        // Inputs to the field operations are below p, as after eval()
+        // reduces its argument.
+        Curve25519::reduceQuick(x);
+        Curve25519::reduceQuick(y);
+        Curve25519::reduceQuick(z);
+        Curve25519::reduceQuick(w);
+
+        Curve25519::mul(result, x, y);
+        refMul(expected, ra, rb);
+        checkField("mul", test, result, expected);
+
+        Curve25519::square(result, x);
+        refMul(expected, ra, ra);
+        checkField("square", test, result, expected);
+
+        Curve25519::add(result, x, y);
+        refAdd(expected, ra, rb);
+        checkField("add", test, result, expected);
+
+        Curve25519::sub(result, x, y);
+        refSub(expected, ra, rb);
+        checkField("sub", test, result, expected);
+
+        // Sums and differences feed straight into products in the ladder
+        // and the Edwards formulas, without a full reduction in between.
+        Curve25519::add(s, x, y);
+        Curve25519::sub(t, z, w);
+        Curve25519::mul(result, s, t);
+        refAdd(rs, ra, rb);
+        refSub(rt, rc, rd);
+        refMul(expected, rs, rt);
+        checkField("mul(add, sub)", test, result, expected);
+
+        Curve25519::square(result, t);
+        refMul(expected, rt, rt);
+        checkField("square(sub)", test, result, expected);
+
+        Curve25519::mulA24(result, t);
+        static const RefElement a24 = {121665};
+        refMul(expected, rt, a24);
+        checkField("mulA24(sub)", test, result, expected);
+
+        if (test % 16 == 0) {
+            // x * (1 / x) = 1, with 1 / 0 = 0.
+            Curve25519::recip(s, x);
+            Curve25519::mul(result, s, x);
+            static const RefElement one = {1};
+            static const RefElement zero = {0};
+            bool isZero = !memcmp(ra, zero, sizeof(ra));
+            checkField("recip", test, result, isZero ? zero : one);
+
+            // A square root of x * x is x or -x.
+            Curve25519::square(s, x);
+            if (!Curve25519::sqrt(t, s)) {
+                printf("sqrt, test %d ... failed\n", test);
+                ++errors;
+            } else {
+                Curve25519::square(result, t);
+                refMul(expected, ra, ra);
+                checkField("sqrt", test, result, expected);
+            }
+        }
+    }
+    printf("Field operations (%d tests) ... %s\n", FIELD_TESTS,
+           errors == before ? "ok" : "failed");
+}
+
+// Compares one result of mul4() or square4() against the scalar result.
+static void checkFour(const char *name, int test, const limb_t *actual,
+                      const limb_t *expected)
+{
+    uint8_t actualBytes[32], expectedBytes[32];
+    bool ok;
+    Curve25519::pack(actualBytes, actual);
+    Curve25519::pack(expectedBytes, expected);
+    addToDigest(actualBytes, sizeof(actualBytes));
+    ok = !memcmp(actualBytes, expectedBytes, 32);
+#if CURVE25519_RADIX51
+    // The results must be valid inputs to another multiplication.
+    for (int i = 0; i < NUM_LIMBS_FIELD25519; ++i)
+        ok &= (actual[i] < (((limb_t)1) << 52));
+#endif
+    if (!ok) {
+        if (errors < 10)
+            printf("%s, test %d ... failed\n", name, test);
+        ++errors;
+    }
+}
+
+static void testMul4()
+{
+    int before = errors;
+    for (int test = 0; test < FIELD_TESTS / 4; ++test) {
+        limb_t in[8][NUM_LIMBS_FIELD25519];
+        limb_t out[4][NUM_LIMBS_FIELD25519];
+        limb_t expected[NUM_LIMBS_FIELD25519];
+        uint8_t bytes[32];
+
+        // Half of the inputs are sums and differences, as in Ed25519.
+        for (int i = 0; i < 8; ++i) {
+            randomValue(bytes);
+            Curve25519::unpack(in[i], bytes);
+            Curve25519::reduceQuick(in[i]);
+        }
+        Curve25519::add(in[1], in[1], in[2]);
+        Curve25519::sub(in[3], in[3], in[4]);
+        Curve25519::add(in[5], in[5], in[0]);
+        Curve25519::sub(in[7], in[7], in[6]);
+
+        limb_t *const results[4] = {out[0], out[1], out[2], out[3]};
+        const limb_t *const x[4] = {in[0], in[1], in[2], in[3]};
+        const limb_t *const y[4] = {in[4], in[5], in[6], in[7]};
+        Curve25519::mul4(results, x, y);
+        for (int i = 0; i < 4; ++i) {
+            Curve25519::mul(expected, x[i], y[i]);
+            checkFour("mul4", test, out[i], expected);
+        }
+        Curve25519::square4(results, y);
+        for (int i = 0; i < 4; ++i) {
+            Curve25519::square(expected, y[i]);
+            checkFour("square4", test, out[i], expected);
+        }
+    }
+    printf("mul4 and square4 (%d tests) ... %s\n", FIELD_TESTS / 4,
+           errors == before ? "ok" : "failed");
+}
+
+int main()
+{
+    testX25519();
+    testEd25519();
+    testFieldOps();
+    testMul4();
+    printf("Field representation: %s\n",
+           NUM_LIMBS_FIELD25519 == 5 ? "radix 2^51" : "saturated");
+    printf("Digest of field results: %08lx\n", (unsigned long)digest);
+    printf("%d error(s)\n", errors);
+    return errors ? 1 : 0;
+}
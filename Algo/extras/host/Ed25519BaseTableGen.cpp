@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Generates utility/Ed25519BaseTable.h.  Build and run from the Algo
+ * directory:
+ *
+ *   g++ -O2 -o ed25519gen extras/host/Ed25519BaseTableGen.cpp
+ *   ./ed25519gen > utility/Ed25519BaseTable.h
+ *
+ * The arithmetic is a plain implementation on 32-bit words that does not
+ * use the library, so the tables do not depend upon the code that reads
+ * them.  Every row is written out; ED25519_BASE_TABLE_SPACING picks the
+ * rows that are compiled in.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define WORDS   8
+
+// Element modulo p = 2^255 - 19 in 32-bit words, least significant first,
+// always fully reduced.
+typedef uint32_t Element[WORDS];
+
+static const Element P = {
+    0xFFFFFFED, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF
+};
+
+// Base point B from RFC 8032, section 5.1.
+static const Element Bx = {
+    0x8F25D51A, 0xC9562D60, 0x9525A7B2, 0x692CC760,
+    0xFDD6DC5C, 0xC0A4E231, 0xCD6E53FE, 0x216936D3
+};
+static const Element By = {
+    0x66666658, 0x66666666, 0x66666666, 0x66666666,
+    0x66666666, 0x66666666, 0x66666666, 0x66666666
+};
+
+static Element D;
+
+// Reduces the value of 2 * WORDS words in w modulo p, using
+// 2^256 = 38 (mod p).
+static void reduceWide(Element result, const uint32_t w[2 * WORDS])
+{
+    uint32_t t[WORDS];
+    uint64_t carry = 0;
+    for (int i = 0; i < WORDS; ++i) {
+        carry += w[i] + (uint64_t)w[i + WORDS] * 38;
+        t[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    while (carry != 0) {
+        carry *= 38;
+        for (int i = 0; i < WORDS; ++i) {
+            carry += t[i];
+            t[i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+    }
+
+    // t < 2^256 < 3 * p, so at most two subtractions of p are needed.
+    for (int round = 0; round < 2; ++round) {
+        uint32_t s[WORDS];
+        int64_t borrow = 0;
+        for (int i = 0; i < WORDS; ++i) {
+            borrow += (int64_t)t[i] - P[i];
+            s[i] = (uint32_t)borrow;
+            borrow >>= 32;
+        }
+        if (borrow == 0)
+            memcpy(t, s, sizeof(t));
+    }
+    memcpy(result, t, sizeof(t));
+}
+
+static void mul(Element result, const Element x, const Element y)
+{
+    uint32_t w[2 * WORDS] = {0};
+    for (int i = 0; i < WORDS; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < WORDS; ++j) {
+            carry += (uint64_t)x[i] * y[j] + w[i + j];
+            w[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        w[i + WORDS] = (uint32_t)carry;
+    }
+    reduceWide(result, w);
+}
+
+static void add(Element result, const Element x, const Element y)
+{
+    uint32_t w[2 * WORDS] = {0};
+    uint64_t carry = 0;
+    for (int i = 0; i < WORDS; ++i) {
+        carry += (uint64_t)x[i] + y[i];
+        w[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    w[WORDS] = (uint32_t)carry;
+    reduceWide(result, w);
+}
+
+// x - y is computed as x + p - y, which cannot go negative.
+static void sub(Element result, const Element x, const Element y)
+{
+    uint32_t w[2 * WORDS] = {0};
+    int64_t carry = 0;
+    for (int i = 0; i < WORDS; ++i) {
+        carry += (int64_t)x[i] + P[i] - y[i];
+        w[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    w[WORDS] = (uint32_t)carry;
+    reduceWide(result, w);
+}
+
+static void setSmall(Element result, uint32_t value)
+{
+    memset(result, 0, sizeof(Element));
+    result[0] = value;
+}
+
+// x^(p - 2) = 1 / x.
+static void recip(Element result, const Element x)
+{
+    Element e, r;
+    memcpy(e, P, sizeof(e));
+    e[0] -= 2;
+    setSmall(r, 1);
+    for (int bit = WORDS * 32 - 1; bit >= 0; --bit) {
+        mul(r, r, r);
+        if ((e[bit / 32] >> (bit % 32)) & 1)
+            mul(r, r, x);
+    }
+    memcpy(result, r, sizeof(r));
+}
+
+static bool equal(const Element x, const Element y)
+{
+    return memcmp(x, y, sizeof(Element)) == 0;
+}
+
+struct Point
+{
+    Element x, y;
+};
+
+// Affine point addition on -x^2 + y^2 = 1 + d * x^2 * y^2.  The formula
+// is complete, so it also doubles.
+static void addPoint(Point &result, const Point &p1, const Point &p2)
+{
+    Element t, u, v, num, den, one;
+    setSmall(one, 1);
+    mul(t, p1.x, p2.x);
+    mul(u, p1.y, p2.y);
+    mul(v, t, u);
+    mul(v, v, D);               // v = d * x1 * x2 * y1 * y2
+
+    Point r;
+    mul(num, p1.x, p2.y);
+    mul(den, p2.x, p1.y);
+    add(num, num, den);
+    add(den, one, v);
+    recip(den, den);
+    mul(r.x, num, den);         // (x1 * y2 + x2 * y1) / (1 + v)
+
+    add(num, u, t);
+    sub(den, one, v);
+    recip(den, den);
+    mul(r.y, num, den);         // (y1 * y2 + x1 * x2) / (1 - v)
+    result = r;
+}
+
+static void printElement(const Element x, const char *indent, bool last)
+{
+    printf("%s", indent);
+    for (int i = 0; i < WORDS; i += 2) {
+        printf("LIMB_PAIR(0x%08X, 0x%08X)%s", (unsigned)x[i],
+               (unsigned)x[i + 1], (i + 2 < WORDS) ? ", " : "");
+    }
+    printf("%s\n", last ? "" : ",");
+}
+
+// Writes the point as (y + x, y - x, 2 * d * x * y).
+static void printPoint(const Point &pt, const char *indent)
+{
+    Element ypx, ymx, xy2d;
+    add(ypx, pt.y, pt.x);
+    sub(ymx, pt.y, pt.x);
+    mul(xy2d, pt.x, pt.y);
+    mul(xy2d, xy2d, D);
+    add(xy2d, xy2d, xy2d);
+    printElement(ypx, indent, false);
+    printElement(ymx, indent, false);
+    printElement(xy2d, indent, true);
+}
+
+static const char header[] =
+"/*\n"
+" * Copyright (C) 2015 Southern Storm Software, Pty Ltd.\n"
+" *\n"
+" * Permission is hereby granted, free of charge, to any person obtaining a\n"
+" * copy of this software and associated documentation files (the \"Software\"),\n"
+" * to deal in the Software without restriction, including without limitation\n"
+" * the rights to use, copy, modify, merge, publish, distribute, sublicense,\n"
+" * and/or sell copies of the Software, and to permit persons to whom the\n"
+" * Software is furnished to do so, subject to the following conditions:\n"
+" *\n"
+" * The above copyright notice and this permission notice shall be included\n"
+" * in all copies or substantial portions of the Software.\n"
+" *\n"
+" * THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS\n"
+" * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+" * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+" * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+" * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING\n"
+" * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER\n"
+" * DEALINGS IN THE SOFTWARE.\n"
+" */\n"
+"\n"
+"\n"
+"#ifndef CRYPTO_ED25519BASETABLE_H\n"
+"#define CRYPTO_ED25519BASETABLE_H\n"
+"\n"
+"// Precomputed multiples of the Ed25519 base point B, included by\n"
+"// Ed25519.cpp only.  Every point is in affine form as\n"
+"// (y + x, y - x, 2 * d * x * y) with each value fully reduced modulo p.\n"
+"//\n"
+"// baseTable is used by Ed25519::mul(): row i holds 1 * 16^k * B to\n"
+"// 8 * 16^k * B for k = i * ED25519_BASE_TABLE_SPACING.  Rows for the other\n"
+"// values of k are left out of the build.\n"
+"//\n"
+"// baseOddTable holds the odd multiples 1 * B to 63 * B for the width-7\n"
+"// NAF in Ed25519::mulDouble().\n"
+"//\n"
+"// Generated by extras/host/Ed25519BaseTableGen.cpp from the curve\n"
+"// parameters in RFC 8032; do not edit by hand.\n"
+"\n";
+
+int main()
+{
+    // d = -121665 / 121666.
+    Element t;
+    setSmall(t, 121666);
+    recip(t, t);
+    setSmall(D, 121665);
+    mul(D, D, t);
+    setSmall(t, 0);
+    sub(D, t, D);
+
+    Point B;
+    memcpy(B.x, Bx, sizeof(Element));
+    memcpy(B.y, By, sizeof(Element));
+
+    // Check that B is on the curve before going any further.
+    Element x2, y2, lhs, rhs, one;
+    setSmall(one, 1);
+    mul(x2, B.x, B.x);
+    mul(y2, B.y, B.y);
+    sub(lhs, y2, x2);
+    mul(rhs, x2, y2);
+    mul(rhs, rhs, D);
+    add(rhs, rhs, one);
+    if (!equal(lhs, rhs)) {
+        fprintf(stderr, "base point is not on the curve\n");
+        return 1;
+    }
+
+    printf("%s", header);
+    printf("static limb_t const baseTable[64 / ED25519_BASE_TABLE_SPACING][8][3 * NUM_LIMBS_256BIT] PROGMEM = {\n");
+    Point base = B;
+    for (int row = 0; row < 64; ++row) {
+        printf("#if (%d %% ED25519_BASE_TABLE_SPACING) == 0\n", row);
+        printf("    {\n");
+        Point pt = base;
+        for (int j = 1; j <= 8; ++j) {
+            printf("        {   // %d * 16^%d * B\n", j, row);
+            printPoint(pt, "            ");
+            printf("        }%s\n", (j < 8) ? "," : "");
+            addPoint(pt, pt, base);
+        }
+        printf("    },\n");
+        printf("#endif\n");
+        for (int dbl = 0; dbl < 4; ++dbl)
+            addPoint(base, base, base);
+    }
+    printf("};\n\n");
+
+    printf("static limb_t const baseOddTable[32][3 * NUM_LIMBS_256BIT] PROGMEM = {\n");
+    Point pt = B, B2;
+    addPoint(B2, B, B);
+    for (int j = 0; j < 32; ++j) {
+        printf("    {   // %d * B\n", 2 * j + 1);
+        printPoint(pt, "        ");
+        printf("    }%s\n", (j < 31) ? "," : "");
+        addPoint(pt, pt, B2);
+    }
+    printf("};\n\n");
+    printf("#endif\n");
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Host benchmark for Ed25519::verifyBatch(), sweeping the number of
+ * signatures to show the cost per signature as the batch grows, next to
+ * verify() one signature at a time.  Build from the Algo directory:
+ *
+ *   g++ -O2 -I. -o ed25519batch extras/host/Ed25519BatchBench.cpp \
+ *       extras/host/HostRNG.cpp Ed25519.cpp Curve25519.cpp \
+ *       BigNumberUtil.cpp SHA512.cpp Hash.cpp Crypto.cpp
+ *
+ * Every batch uses distinct keys and messages.  Each size is checked to
+ * accept all signatures and to reject a batch with one corrupted
+ * signature before it is timed.  The time reported is the best of RUNS
+ * runs.
+ */
+
+#include "Ed25519.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define MAX_COUNT   128
+#define RUNS        20
+#define MESSAGE_LEN 64
+
+static uint8_t publicKeys[MAX_COUNT][32];
+static uint8_t signatures[MAX_COUNT][64];
+static uint8_t messages[MAX_COUNT][MESSAGE_LEN];
+static const uint8_t *publicKeyPtrs[MAX_COUNT];
+static const uint8_t *signaturePtrs[MAX_COUNT];
+static const void *messagePtrs[MAX_COUNT];
+static size_t lens[MAX_COUNT];
+
+// Returns the best time in microseconds of calls to func() over RUNS runs.
+template <typename Func>
+static double bestTime(int calls, Func func)
+{
+    double best = 1e30;
+    for (int run = 0; run < RUNS; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        for (int call = 0; call < calls; ++call)
+            func();
+        double us = std::chrono::duration<double, std::micro>
+            (std::chrono::steady_clock::now() - start).count() / calls;
+        if (us < best)
+            best = us;
+    }
+    return best;
+}
+
+int main()
+{
+    static const size_t counts[] = {1, 2, 4, 8, 16, 32, 64, 128};
+
+    for (size_t i = 0; i < MAX_COUNT; ++i) {
+        uint8_t privateKey[32];
+        for (size_t j = 0; j < sizeof(privateKey); ++j)
+            privateKey[j] = (uint8_t)(i * 131 + j * 7 + 1);
+        for (size_t j = 0; j < MESSAGE_LEN; ++j)
+            messages[i][j] = (uint8_t)(i + j * 3);
+        Ed25519::derivePublicKey(publicKeys[i], privateKey);
+        Ed25519::sign(signatures[i], privateKey, publicKeys[i],
+                      messages[i], MESSAGE_LEN);
+        publicKeyPtrs[i] = publicKeys[i];
+        signaturePtrs[i] = signatures[i];
+        messagePtrs[i] = messages[i];
+        lens[i] = MESSAGE_LEN;
+    }
+
+    double single = bestTime(64, [] {
+        Ed25519::verify(signatures[0], publicKeys[0], messages[0],
+                        MESSAGE_LEN);
+    });
+    printf("verify()           %8.1f us/signature\n\n", single);
+
+    printf("count   us/batch   us/signature   vs verify()\n");
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        size_t count = counts[c];
+
+        bool ok = Ed25519::verifyBatch(signaturePtrs, publicKeyPtrs,
+                                       messagePtrs, lens, count);
+        signatures[count - 1][10] ^= 0x01;
+        ok = ok && !Ed25519::verifyBatch(signaturePtrs, publicKeyPtrs,
+                                         messagePtrs, lens, count);
+        signatures[count - 1][10] ^= 0x01;
+        if (!ok) {
+            printf("%5d   verifyBatch() gave the wrong answer\n", (int)count);
+            return 1;
+        }
+
+        int calls = (int)((MAX_COUNT + count - 1) / count);
+        double batch = bestTime(calls, [count] {
+            Ed25519::verifyBatch(signaturePtrs, publicKeyPtrs, messagePtrs,
+                                 lens, count);
+        });
+        printf("%5d   %8.1f   %12.1f   %10.2fx\n", (int)count, batch,
+               batch / count, single * count / batch);
+    }
+    return 0;
+}
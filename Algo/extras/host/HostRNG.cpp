@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Stand-in for the global RNG object on a host build, which draws from
+ * /dev/urandom instead of the board's noise sources.  Only rand() is
+ * provided: it is all that the primitives under test call.
+ */
+
+#include "RNG.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+RNGClass::RNGClass()
+{
+}
+
+RNGClass::~RNGClass()
+{
+}
+
+void RNGClass::rand(uint8_t *data, size_t len)
+{
+    static FILE *urandom = fopen("/dev/urandom", "rb");
+    if (!urandom || fread(data, 1, len, urandom) != len) {
+        perror("/dev/urandom");
+        exit(1);
+    }
+}
+
+RNGClass RNG;
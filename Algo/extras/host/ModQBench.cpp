@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Host benchmark for the arithmetic modulo the group orders q of P521 and
+ * Ed25519: P521 recipQ() and mulQ() directly, and the Ed25519 operations
+ * that reduce modulo q.  TEST_P521_FIELD_OPS makes the P521 internals
+ * visible.  Build from the Algo directory:
+ *
+ *   g++ -O2 -I. -DTEST_P521_FIELD_OPS -o modqbench \
+ *       extras/host/ModQBench.cpp extras/host/HostRNG.cpp P521.cpp \
+ *       Ed25519.cpp Curve25519.cpp BigNumberUtil.cpp SHA512.cpp Hash.cpp \
+ *       Crypto.cpp
+ *
+ * Each figure is the best of 200 runs.
+ */
+
+#include "P521.h"
+#include "Ed25519.h"
+#include "BigNumberUtil.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define RUNS    200
+
+#define NUM_LIMBS_521BIT    ((66 + sizeof(limb_t) - 1) / sizeof(limb_t))
+
+// Returns the best time in nanoseconds of calls to func() over RUNS runs.
+template <typename Func>
+static double bestTime(int calls, Func func)
+{
+    double best = 1e30;
+    for (int run = 0; run < RUNS; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        for (int call = 0; call < calls; ++call)
+            func();
+        double ns = std::chrono::duration<double, std::nano>
+            (std::chrono::steady_clock::now() - start).count() / calls;
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+int main()
+{
+    // Values below 2^520, and so below q, for the P521 operations.
+    uint8_t bytes[66];
+    limb_t x[NUM_LIMBS_521BIT];
+    limb_t y[NUM_LIMBS_521BIT];
+    limb_t result[NUM_LIMBS_521BIT];
+    for (size_t i = 0; i < sizeof(bytes); ++i)
+        bytes[i] = (uint8_t)(i * 73 + 19);
+    bytes[0] = 0;
+    BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, bytes, sizeof(bytes));
+    bytes[1] ^= 0x5A;
+    BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, bytes, sizeof(bytes));
+
+    printf("P521 mulQ       %9.1f ns\n", bestTime(100, [&] {
+        P521::mulQ(result, x, y);
+        x[0] ^= result[0];
+    }));
+    printf("P521 recipQ     %9.1f us\n", bestTime(2, [&] {
+        P521::recipQ(result, x);
+        x[0] ^= result[0] | 1;
+    }) / 1000);
+
+    uint8_t privateKey[32];
+    uint8_t publicKey[32];
+    uint8_t signature[64];
+    static const char message[] = "The quick brown fox jumps over the lazy dog";
+    memset(privateKey, 0x42, sizeof(privateKey));
+    Ed25519::derivePublicKey(publicKey, privateKey);
+
+    printf("Ed25519 sign    %9.1f us\n", bestTime(2, [&] {
+        Ed25519::sign(signature, privateKey, publicKey, message,
+                      sizeof(message) - 1);
+    }) / 1000);
+    bool ok = true;
+    printf("Ed25519 verify  %9.1f us\n", bestTime(2, [&] {
+        ok &= Ed25519::verify(signature, publicKey, message,
+                              sizeof(message) - 1);
+    }) / 1000);
+    if (!ok) {
+        printf("Ed25519 verify failed\n");
+        return 1;
+    }
+    return 0;
+}
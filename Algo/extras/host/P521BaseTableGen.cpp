@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*
+ * Generates utility/P521BaseTable.h.  Build and run from the Algo
+ * directory:
+ *
+ *   g++ -O2 -o p521gen extras/host/P521BaseTableGen.cpp
+ *   ./p521gen > utility/P521BaseTable.h
+ *
+ * The arithmetic is a plain implementation on 32-bit words that does not
+ * use the library, so the tables do not depend upon the code that reads
+ * them.  Every row is written out; P521_BASE_TABLE_SPACING picks the rows
+ * that are compiled in.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define WORDS   17
+#define ROWS    131
+
+// Element modulo p = 2^521 - 1 in 32-bit words, least significant first,
+// always fully reduced.
+typedef uint32_t Element[WORDS];
+
+// Generator G from NIST FIPS 186-4, appendix D.1.2.5.
+static const Element Gx = {
+    0xC2E5BD66, 0xF97E7E31, 0x856A429B, 0x3348B3C1,
+    0xA2FFA8DE, 0xFE1DC127, 0xEFE75928, 0xA14B5E77,
+    0x6B4D3DBA, 0xF828AF60, 0x053FB521, 0x9C648139,
+    0x2395B442, 0x9E3ECB66, 0x0404E9CD, 0x858E06B7,
+    0x000000C6
+};
+static const Element Gy = {
+    0x9FD16650, 0x88BE9476, 0xA272C240, 0x353C7086,
+    0x3FAD0761, 0xC550B901, 0x5EF42640, 0x97EE7299,
+    0x273E662C, 0x17AFBD17, 0x579B4468, 0x98F54449,
+    0x2C7D1BD9, 0x5C8A5FB4, 0x9A3BC004, 0x39296A78,
+    0x00000118
+};
+static const Element B = {
+    0x6B503F00, 0xEF451FD4, 0x3D2C34F1, 0x3573DF88,
+    0x3BB1BF07, 0x1652C0BD, 0xEC7E937B, 0x56193951,
+    0x8EF109E1, 0xB8B48991, 0x99B315F3, 0xA2DA725B,
+    0xB68540EE, 0x929A21A0, 0x8E1C9A1F, 0x953EB961,
+    0x00000051
+};
+
+// Reduces the value of 2 * WORDS words in w modulo p, by adding the bits
+// above 2^521 back in at the bottom until none are left.
+static void reduceWide(Element result, uint32_t w[2 * WORDS])
+{
+    for (;;) {
+        uint32_t high[WORDS + 1];
+        bool any = false;
+        for (int i = 0; i <= WORDS; ++i) {
+            uint32_t lo = (i + 16 < 2 * WORDS) ? w[i + 16] : 0;
+            uint32_t hi = (i + 17 < 2 * WORDS) ? w[i + 17] : 0;
+            high[i] = (lo >> 9) | (hi << 23);
+            any |= (high[i] != 0);
+        }
+        if (!any)
+            break;
+        w[16] &= 0x1FF;
+        for (int i = 17; i < 2 * WORDS; ++i)
+            w[i] = 0;
+        uint64_t carry = 0;
+        for (int i = 0; i < 2 * WORDS; ++i) {
+            carry += w[i];
+            if (i <= WORDS)
+                carry += high[i];
+            w[i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+    }
+
+    // 2^521 - 1 itself is zero.
+    bool allOnes = (w[16] == 0x1FF);
+    for (int i = 0; i < 16; ++i)
+        allOnes &= (w[i] == 0xFFFFFFFF);
+    for (int i = 0; i < WORDS; ++i)
+        result[i] = allOnes ? 0 : w[i];
+}
+
+static void mul(Element result, const Element x, const Element y)
+{
+    uint32_t w[2 * WORDS] = {0};
+    for (int i = 0; i < WORDS; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < WORDS; ++j) {
+            carry += (uint64_t)x[i] * y[j] + w[i + j];
+            w[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        w[i + WORDS] = (uint32_t)carry;
+    }
+    reduceWide(result, w);
+}
+
+static void add(Element result, const Element x, const Element y)
+{
+    uint32_t w[2 * WORDS] = {0};
+    uint64_t carry = 0;
+    for (int i = 0; i < WORDS; ++i) {
+        carry += (uint64_t)x[i] + y[i];
+        w[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    reduceWide(result, w);
+}
+
+// x - y is computed as x + p - y, which cannot go negative.
+static void sub(Element result, const Element x, const Element y)
+{
+    uint32_t w[2 * WORDS] = {0};
+    int64_t carry = 0;
+    for (int i = 0; i < WORDS; ++i) {
+        uint32_t p = (i < 16) ? 0xFFFFFFFF : 0x1FF;
+        carry += (int64_t)x[i] + p - y[i];
+        w[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    reduceWide(result, w);
+}
+
+static void setSmall(Element result, uint32_t value)
+{
+    memset(result, 0, sizeof(Element));
+    result[0] = value;
+}
+
+// x^(p - 2) = 1 / x, where p - 2 is 521 one bits apart from bit 1.
+static void recip(Element result, const Element x)
+{
+    Element r;
+    setSmall(r, 1);
+    for (int bit = 520; bit >= 0; --bit) {
+        mul(r, r, r);
+        if (bit != 1)
+            mul(r, r, x);
+    }
+    memcpy(result, r, sizeof(r));
+}
+
+static bool equal(const Element x, const Element y)
+{
+    return memcmp(x, y, sizeof(Element)) == 0;
+}
+
+struct Point
+{
+    Element x, y;
+};
+
+// Affine point addition on y^2 = x^3 - 3 * x + b.  The points must not be
+// the inverse of each other, which multiples of G below its order are not.
+static void addPoint(Point &result, const Point &p1, const Point &p2)
+{
+    Element lambda, t, u;
+    if (equal(p1.x, p2.x)) {
+        // lambda = (3 * x1^2 - 3) / (2 * y1)
+        Element one, three;
+        setSmall(one, 1);
+        setSmall(three, 3);
+        mul(t, p1.x, p1.x);
+        sub(t, t, one);
+        mul(t, t, three);
+        add(u, p1.y, p1.y);
+    } else {
+        // lambda = (y2 - y1) / (x2 - x1)
+        sub(t, p2.y, p1.y);
+        sub(u, p2.x, p1.x);
+    }
+    recip(u, u);
+    mul(lambda, t, u);
+
+    Point r;
+    mul(r.x, lambda, lambda);
+    sub(r.x, r.x, p1.x);
+    sub(r.x, r.x, p2.x);        // x3 = lambda^2 - x1 - x2
+    sub(t, p1.x, r.x);
+    mul(r.y, lambda, t);
+    sub(r.y, r.y, p1.y);        // y3 = lambda * (x1 - x3) - y1
+    result = r;
+}
+
+// Writes the 16 full words as 8 pairs over two lines, then the top 9 bits.
+static void printElement(const Element x, const char *indent, bool last)
+{
+    printf("%s", indent);
+    for (int i = 0; i < 16; i += 2) {
+        printf("LIMB_PAIR(0x%08X, 0x%08X)", (unsigned)x[i],
+               (unsigned)x[i + 1]);
+        if (i == 6)
+            printf(",\n%s", indent);
+        else
+            printf(", ");
+    }
+    printf("LIMB_PARTIAL(0x%03X)%s\n", (unsigned)x[16], last ? "" : ",");
+}
+
+static void printPoint(const Point &pt, const char *indent)
+{
+    printElement(pt.x, indent, false);
+    printElement(pt.y, indent, true);
+}
+
+static const char header[] =
+"/*\n"
+" * Copyright (C) 2015 Southern Storm Software, Pty Ltd.\n"
+" *\n"
+" * Permission is hereby granted, free of charge, to any person obtaining a\n"
+" * copy of this software and associated documentation files (the \"Software\"),\n"
+" * to deal in the Software without restriction, including without limitation\n"
+" * the rights to use, copy, modify, merge, publish, distribute, sublicense,\n"
+" * and/or sell copies of the Software, and to permit persons to whom the\n"
+" * Software is furnished to do so, subject to the following conditions:\n"
+" *\n"
+" * The above copyright notice and this permission notice shall be included\n"
+" * in all copies or substantial portions of the Software.\n"
+" *\n"
+" * THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS\n"
+" * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+" * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+" * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+" * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING\n"
+" * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER\n"
+" * DEALINGS IN THE SOFTWARE.\n"
+" */\n"
+"\n"
+"\n"
+"#ifndef CRYPTO_P521BASETABLE_H\n"
+"#define CRYPTO_P521BASETABLE_H\n"
+"\n"
+"// Precomputed multiples of the P-521 generator G, included by P521.cpp\n"
+"// only.  Every point is in affine form as (x, y), with each value fully\n"
+"// reduced modulo p.\n"
+"//\n"
+"// Row i holds 1 * 16^k * G to 8 * 16^k * G for k = i * P521_BASE_TABLE_SPACING.\n"
+"// Rows for the other values of k are left out of the build.\n"
+"//\n"
+"// P521_baseOddTable holds the odd multiples 1 * G to 63 * G for the width-7\n"
+"// NAF in P521::evaluateDouble().\n"
+"//\n"
+"// Generated by extras/host/P521BaseTableGen.cpp from the curve parameters\n"
+"// in NIST FIPS 186-4; do not edit by hand.\n"
+"\n";
+
+int main()
+{
+    Point G;
+    memcpy(G.x, Gx, sizeof(Element));
+    memcpy(G.y, Gy, sizeof(Element));
+
+    // Check that G is on the curve before going any further.
+    Element lhs, rhs, t;
+    mul(lhs, G.y, G.y);
+    mul(rhs, G.x, G.x);
+    mul(rhs, rhs, G.x);
+    add(t, G.x, G.x);
+    add(t, t, G.x);
+    sub(rhs, rhs, t);
+    add(rhs, rhs, B);
+    if (!equal(lhs, rhs)) {
+        fprintf(stderr, "generator is not on the curve\n");
+        return 1;
+    }
+
+    printf("%s", header);
+    printf("static limb_t const P521_baseTable[P521_BASE_ROWS][8][2 * NUM_LIMBS_521BIT] PROGMEM = {\n");
+    Point base = G;
+    for (int row = 0; row < ROWS; ++row) {
+        printf("#if (%d %% P521_BASE_TABLE_SPACING) == 0\n", row);
+        printf("    {\n");
+        Point pt = base;
+        for (int j = 1; j <= 8; ++j) {
+            printf("        {   // %d * 16^%d * G\n", j, row);
+            printPoint(pt, "            ");
+            printf("        }%s\n", (j < 8) ? "," : "");
+            addPoint(pt, pt, base);
+        }
+        printf("    },\n");
+        printf("#endif\n");
+        for (int dbl = 0; dbl < 4; ++dbl)
+            addPoint(base, base, base);
+    }
+    printf("};\n\n");
+
+    printf("static limb_t const P521_baseOddTable[32][2 * NUM_LIMBS_521BIT] PROGMEM = {\n");
+    Point pt = G, G2;
+    addPoint(G2, G, G);
+    for (int j = 0; j < 32; ++j) {
+        printf("    {   // %d * G\n", 2 * j + 1);
+        printPoint(pt, "        ");
+        printf("    }%s\n", (j < 31) ? "," : "");
+        addPoint(pt, pt, G2);
+    }
+    printf("};\n\n");
+    printf("#endif\n");
+    return 0;
+}
@@ -0,0 +1,369 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Host differential tests for the P521 field arithmetic modulo 2^521 - 1.
+ * Build from the Algo directory, once with the default radix-2^58 field
+ * on 64-bit hosts and once with the saturated limbs:
+ *
+ *   g++ -O2 -I. -DTEST_P521_FIELD_OPS -o p521test \
+ *       extras/host/P521FieldTest.cpp extras/host/HostRNG.cpp P521.cpp \
+ *       BigNumberUtil.cpp SHA512.cpp Hash.cpp Crypto.cpp
+ *   g++ -O2 -I. -DTEST_P521_FIELD_OPS -DP521_RADIX58=0 \
+ *       -o p521test-saturated ...
+ *
+ * The field operations, made visible by TEST_P521_FIELD_OPS, are run on
+ * pseudorandom inputs and checked against a plain reference on 32-bit
+ * words.  The inputs are the same on every build, so the digest printed
+ * at the end must be the same for both field representations.  Adding a
+ * point to itself and a sign and verify round trip then exercise the
+ * point arithmetic on top.
+ */
+
+#include "P521.h"
+#include "utility/LimbUtil.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FIELD_TESTS 20000
+
+#define NUM_LIMBS_521BIT    NUM_LIMBS_BITS(521)
+#define REF_WORDS           17
+
+static int errors = 0;
+
+// Reference arithmetic modulo p = 2^521 - 1 on 32-bit words, least
+// significant first, always fully reduced.
+typedef uint32_t RefElement[REF_WORDS];
+
+// Reduces the value of 2 * REF_WORDS words in w modulo p, by adding the
+// bits above 2^521 back in at the bottom until none are left.
+static void refReduceWide(RefElement result, uint32_t w[2 * REF_WORDS])
+{
+    for (;;) {
+        uint32_t high[REF_WORDS + 1];
+        bool any = false;
+        for (int i = 0; i <= REF_WORDS; ++i) {
+            uint32_t lo = (i + 16 < 2 * REF_WORDS) ? w[i + 16] : 0;
+            uint32_t hi = (i + 17 < 2 * REF_WORDS) ? w[i + 17] : 0;
+            high[i] = (lo >> 9) | (hi << 23);
+            any |= (high[i] != 0);
+        }
+        if (!any)
+            break;
+        w[16] &= 0x1FF;
+        for (int i = 17; i < 2 * REF_WORDS; ++i)
+            w[i] = 0;
+        uint64_t carry = 0;
+        for (int i = 0; i < 2 * REF_WORDS; ++i) {
+            carry += w[i];
+            if (i <= REF_WORDS)
+                carry += high[i];
+            w[i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+    }
+
+    // 2^521 - 1 itself is zero.
+    bool allOnes = (w[16] == 0x1FF);
+    for (int i = 0; i < 16; ++i)
+        allOnes &= (w[i] == 0xFFFFFFFF);
+    for (int i = 0; i < REF_WORDS; ++i)
+        result[i] = allOnes ? 0 : w[i];
+}
+
+static void refMul(RefElement result, const RefElement x, const RefElement y)
+{
+    uint32_t w[2 * REF_WORDS] = {0};
+    for (int i = 0; i < REF_WORDS; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < REF_WORDS; ++j) {
+            carry += (uint64_t)x[i] * y[j] + w[i + j];
+            w[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        w[i + REF_WORDS] = (uint32_t)carry;
+    }
+    refReduceWide(result, w);
+}
+
+static void refAdd(RefElement result, const RefElement x, const RefElement y)
+{
+    uint32_t w[2 * REF_WORDS] = {0};
+    uint64_t carry = 0;
+    for (int i = 0; i < REF_WORDS; ++i) {
+        carry += (uint64_t)x[i] + y[i];
+        w[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    refReduceWide(result, w);
+}
+
+// x - y = x + (p - y), where p - y is y with its 521 bits inverted.
+static void refSub(RefElement result, const RefElement x, const RefElement y)
+{
+    RefElement negY;
+    for (int i = 0; i < REF_WORDS; ++i)
+        negY[i] = ~y[i];
+    negY[16] &= 0x1FF;
+    refAdd(result, x, negY);
+}
+
+static void refFromBytes(RefElement result, const uint8_t bytes[66])
+{
+    uint32_t w[2 * REF_WORDS] = {0};
+    for (int i = 0; i < 66; ++i)
+        w[i / 4] |= ((uint32_t)bytes[65 - i]) << (8 * (i % 4));
+    refReduceWide(result, w);
+}
+
+static void refToBytes(uint8_t bytes[66], const RefElement x)
+{
+    for (int i = 0; i < 66; ++i)
+        bytes[65 - i] = (uint8_t)(x[i / 4] >> (8 * (i % 4)));
+}
+
+static uint64_t seed = 0x2545F4914F6CDD1DULL;
+
+static uint8_t randomByte()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return (uint8_t)(seed >> 24);
+}
+
+// Fills bytes with a pseudorandom big-endian value below 2^521, biased
+// towards the edges of the field where the carries are exercised.
+static void randomValue(uint8_t bytes[66])
+{
+    uint8_t kind = randomByte() % 8;
+    for (int i = 0; i < 66; ++i)
+        bytes[i] = randomByte();
+    if (kind == 0)
+        memset(bytes, 0xFF, 66);            // 2^521 - 1, which is p
+    else if (kind == 1)
+        memset(bytes, 0, 65);               // Small value
+    else if (kind == 2)
+        memset(bytes, 0xFF, 65);            // Close to p
+    bytes[0] &= 0x01;
+}
+
+// Converts big-endian bytes into a fully reduced field element.
+static void fieldFromBytes(limb_t *result, const uint8_t bytes[66])
+{
+    BigNumberUtil::unpackBE(result, NUM_LIMBS_521BIT, bytes, 66);
+    P521::load(result, result);
+    P521::reduceQuick(result);
+}
+
+static uint32_t digest = 2166136261U;
+
+static void addToDigest(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; ++i)
+        digest = (digest ^ data[i]) * 16777619U;
+}
+
+// Compares a field element against the reference result.
+static void checkField(const char *name, int test, const limb_t *actual,
+                       const RefElement expected)
+{
+    limb_t stored[NUM_LIMBS_521BIT];
+    uint8_t actualBytes[66], expectedBytes[66];
+    P521::store(stored, actual);
+    BigNumberUtil::packBE(actualBytes, 66, stored, NUM_LIMBS_521BIT);
+    refToBytes(expectedBytes, expected);
+    addToDigest(actualBytes, sizeof(actualBytes));
+    if (memcmp(actualBytes, expectedBytes, 66) != 0) {
+        if (errors < 10)
+            printf("%s, test %d ... failed\n", name, test);
+        ++errors;
+    }
+}
+
+static void testFieldOps()
+{
+    int before = errors;
+    for (int test = 0; test < FIELD_TESTS; ++test) {
+        uint8_t a[66], b[66], c[66], d[66];
+        limb_t x[NUM_LIMBS_521BIT], y[NUM_LIMBS_521BIT];
+        limb_t z[NUM_LIMBS_521BIT], w[NUM_LIMBS_521BIT];
+        limb_t s[NUM_LIMBS_521BIT], t[NUM_LIMBS_521BIT];
+        limb_t result[NUM_LIMBS_521BIT];
+        RefElement ra, rb, rc, rd, rs, rt, expected;
+
+        randomValue(a);
+        randomValue(b);
+        randomValue(c);
+        randomValue(d);
+        refFromBytes(ra, a);
+        refFromBytes(rb, b);
+        refFromBytes(rc, c);
+        refFromBytes(rd, d);
+        fieldFromBytes(x, a);
+        fieldFromBytes(y, b);
+        fieldFromBytes(z, c);
+        fieldFromBytes(w, d);
+
+        P521::mul(result, x, y);
+        refMul(expected, ra, rb);
+        checkField("mul", test, result, expected);
+
+        P521::square(result, x);
+        refMul(expected, ra, ra);
+        checkField("square", test, result, expected);
+
+        P521::add(result, x, y);
+        refAdd(expected, ra, rb);
+        checkField("add", test, result, expected);
+
+        P521::sub(result, x, y);
+        refSub(expected, ra, rb);
+        checkField("sub", test, result, expected);
+
+        uint8_t literal = randomByte() & 0x7F;
+        RefElement refLiteral = {literal};
+        P521::mulLiteral(result, x, literal);
+        refMul(expected, ra, refLiteral);
+        checkField("mulLiteral", test, result, expected);
+
+        // Sums and differences feed straight into products in the point
+        // formulas, without a full reduction in between.
+        P521::add(s, x, y);
+        P521::sub(t, z, w);
+        P521::mul(result, s, t);
+        refAdd(rs, ra, rb);
+        refSub(rt, rc, rd);
+        refMul(expected, rs, rt);
+        checkField("mul(add, sub)", test, result, expected);
+
+        P521::square(result, s);
+        refMul(expected, rs, rs);
+        checkField("square(add)", test, result, expected);
+
+        P521::sub(result, s, t);
+        refSub(expected, rs, rt);
+        checkField("sub(add, sub)", test, result, expected);
+
+        if (test % 16 == 0) {
+            // x * (1 / x) = 1, with 1 / 0 = 0.
+            static const RefElement one = {1};
+            static const RefElement zero = {0};
+            P521::recip(s, x);
+            P521::mul(result, s, x);
+            bool isZero = !memcmp(ra, zero, sizeof(ra));
+            checkField("recip", test, result, isZero ? zero : one);
+        }
+    }
+    printf("Field operations (%d tests) ... %s\n", FIELD_TESTS,
+           errors == before ? "ok" : "failed");
+}
+
+// Adds a point to itself and to its negative, with the first point in
+// Jacobian co-ordinates scaled by z = 5.
+static void testAddPointPublic()
+{
+    uint8_t privateKey[66];
+    uint8_t publicKey[132];
+    limb_t x[NUM_LIMBS_521BIT], y[NUM_LIMBS_521BIT];
+    limb_t negY[NUM_LIMBS_521BIT], z[NUM_LIMBS_521BIT];
+    limb_t xj[NUM_LIMBS_521BIT], yj[NUM_LIMBS_521BIT];
+    limb_t t[NUM_LIMBS_521BIT];
+    limb_t xout[NUM_LIMBS_521BIT], yout[NUM_LIMBS_521BIT];
+    limb_t zout[NUM_LIMBS_521BIT];
+    limb_t xsum[NUM_LIMBS_521BIT], ysum[NUM_LIMBS_521BIT];
+    limb_t xdbl[NUM_LIMBS_521BIT], ydbl[NUM_LIMBS_521BIT];
+    bool ok = true;
+
+    for (size_t i = 0; i < sizeof(privateKey); ++i)
+        privateKey[i] = (uint8_t)(i * 53 + 3);
+    privateKey[0] = 0;
+    P521::derivePublicKey(publicKey, privateKey);
+    BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, publicKey, 66);
+    BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, publicKey + 66, 66);
+    P521::load(x, x);
+    P521::load(y, y);
+
+    memset(z, 0, sizeof(z));
+    P521::load(negY, z);
+    P521::sub(negY, negY, y);
+    z[0] = 5;
+    P521::load(z, z);
+    P521::square(t, z);
+    P521::mul(xj, x, t);
+    P521::mul(t, t, z);
+    P521::mul(yj, y, t);
+
+    P521::addPointPublic(xout, yout, zout, xj, yj, z, x, y);
+    P521::toAffine(xsum, ysum, xout, yout, zout);
+    memset(t, 0, sizeof(t));
+    t[0] = 1;
+    P521::load(t, t);
+    P521::dblPoint(xout, yout, zout, x, y, t);
+    P521::toAffine(xdbl, ydbl, xout, yout, zout);
+    ok &= !memcmp(xsum, xdbl, sizeof(xsum)) && !memcmp(ysum, ydbl, sizeof(ysum));
+
+    P521::addPointPublic(xout, yout, zout, xj, yj, z, x, negY);
+    ok &= P521::isZero(zout);
+
+    printf("addPointPublic with equal points ... %s\n", ok ? "ok" : "failed");
+    if (!ok)
+        ++errors;
+}
+
+static void testSignVerify()
+{
+    uint8_t privateKey[66];
+    uint8_t publicKey[132];
+    uint8_t signature[132];
+    static const char message[] = "The quick brown fox jumps over the lazy dog";
+    const size_t len = sizeof(message) - 1;
+
+    for (size_t i = 0; i < sizeof(privateKey); ++i)
+        privateKey[i] = (uint8_t)(i * 37 + 11);
+    privateKey[0] = 0;
+    P521::derivePublicKey(publicKey, privateKey);
+    P521::sign(signature, privateKey, message, len);
+    addToDigest(publicKey, sizeof(publicKey));
+    addToDigest(signature, sizeof(signature));
+
+    bool ok = P521::isValidPublicKey(publicKey) &&
+              P521::verify(signature, publicKey, message, len);
+    signature[100] ^= 0x01;
+    ok = ok && !P521::verify(signature, publicKey, message, len);
+    printf("Sign and verify ... %s\n", ok ? "ok" : "failed");
+    if (!ok)
+        ++errors;
+}
+
+int main()
+{
+    testFieldOps();
+    testAddPointPublic();
+    testSignVerify();
+    printf("Field representation: %s\n",
+           P521_RADIX58 ? "radix 2^58" : "saturated");
+    printf("Digest of results: %08lx\n", (unsigned long)digest);
+    printf("%d error(s)\n", errors);
+    return errors ? 1 : 0;
+}
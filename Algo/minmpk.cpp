@@ -1,5 +1,5 @@
 // minmpk.cpp
-// minimal messagepack builder straight from the specs at https://github.com/msgpack/msgpack/blob/master/spec.md
+// minimal messagepack builder (and zero-copy reader) straight from the specs at https://github.com/msgpack/msgpack/blob/master/spec.md
 // W.I.P. use with care
 // In C because we need it on C-only platforms too
 // v20231012-1
@@ -531,6 +531,48 @@ int msgpackAddByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t
 }
 
 
+int msgpackReserveByteArray(msgPack mPack, const uint16_t inputBytes, uint8_t** payload)
+{
+  uint8_t headerBytes = (inputBytes < 256) ? 2 : 3;
+
+  if (mPack == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (mPack->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+  if (payload == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  if (mPack->currentPosition + inputBytes + headerBytes >= mPack->bufferLen)
+  {
+    return MPK_ERR_BUFFER_TOO_SHORT;
+  }
+
+  // Same encodings as msgpackAddShortByteArray() / msgpackAddByteArray(): smallest one that fits
+  if (headerBytes == 2)
+  {
+    mPack->msgBuffer[mPack->currentPosition++] = 0xC4;
+    mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)inputBytes;
+  }
+  else
+  {
+    mPack->msgBuffer[mPack->currentPosition++] = 0xC5;
+    mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((inputBytes & 0xFF00) >> 8);
+    mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((inputBytes & 0x00FF));
+  }
+  *payload = &(mPack->msgBuffer[mPack->currentPosition]);
+  mPack->currentPosition += inputBytes;
+
+  mPack->currentMsgLen += inputBytes + headerBytes;
+
+  return 0;
+}
+
+
 int msgpackAddBoolean(msgPack mPack, const bool value)
 {
   uint8_t specifier;
@@ -587,3 +629,917 @@ int msgpackAddShortArray(msgPack mPack, const uint8_t nElements)
   
   return 0;
 }
+
+
+// Canonical encodings
+
+// Writes "specifier", then "valueBytes" of "value" big endian, then "payloadBytes" of "payload"
+static int mpkWrite(msgPack mPack, const uint8_t specifier, const uint64_t value, const uint8_t valueBytes,
+                    const uint8_t* payload, const uint32_t payloadBytes)
+{
+  uint32_t totalBytes = 0;
+
+  if (mPack == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (mPack->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+  if ((payload == NULL) && (payloadBytes > 0))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  if ((uint64_t)mPack->currentPosition + 1 + valueBytes + payloadBytes >= mPack->bufferLen)
+  {
+    return MPK_ERR_BUFFER_TOO_SHORT;
+  }
+  totalBytes = 1 + valueBytes + payloadBytes;
+
+  mPack->msgBuffer[mPack->currentPosition++] = specifier;
+  for (uint8_t i = valueBytes; i > 0; i--)
+  {
+    mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value >> (8 * (i - 1))) & 0xFF);
+  }
+  if (payloadBytes > 0)
+  {
+    memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)payload, payloadBytes);
+    mPack->currentPosition += payloadBytes;
+  }
+  mPack->currentMsgLen += totalBytes;
+
+  return 0;
+}
+
+
+// Length-prefixed families: "fixBase" != 0 for a fix format holding up to "fixMax"; then 8 (if "spec8" != 0), 16 and 32-bit lengths
+static int mpkWriteWithLen(msgPack mPack, const uint8_t fixBase, const uint32_t fixMax,
+                           const uint8_t spec8, const uint8_t spec16, const uint8_t spec32,
+                           const uint32_t len, const uint8_t* payload, const uint32_t payloadBytes)
+{
+  if ((fixBase != 0) && (len <= fixMax))
+    return mpkWrite(mPack, (uint8_t)(fixBase + len), 0, 0, payload, payloadBytes);
+  if ((spec8 != 0) && (len <= 0xFF))
+    return mpkWrite(mPack, spec8, len, 1, payload, payloadBytes);
+  if (len <= 0xFFFF)
+    return mpkWrite(mPack, spec16, len, 2, payload, payloadBytes);
+  return mpkWrite(mPack, spec32, len, 4, payload, payloadBytes);
+}
+
+
+int msgpackAddNil(msgPack mPack)
+{
+  return mpkWrite(mPack, 0xC0, 0, 0, NULL, 0);
+}
+
+
+int msgpackAddUInt(msgPack mPack, const uint64_t value)
+{
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  if (value <= 0x7F)
+    return mpkWrite(mPack, (uint8_t)value, 0, 0, NULL, 0);  // Positive fixint
+  if (value <= 0xFF)
+    return mpkWrite(mPack, 0xCC, value, 1, NULL, 0);
+  if (value <= 0xFFFF)
+    return mpkWrite(mPack, 0xCD, value, 2, NULL, 0);
+  if (value <= 0xFFFFFFFFULL)
+    return mpkWrite(mPack, 0xCE, value, 4, NULL, 0);
+  return mpkWrite(mPack, 0xCF, value, 8, NULL, 0);
+}
+
+
+int msgpackAddInt(msgPack mPack, const int64_t value)
+{
+  if (value >= 0)
+    return msgpackAddUInt(mPack, (uint64_t)value);
+  if (value >= -32)
+    return mpkWrite(mPack, (uint8_t)(int8_t)value, 0, 0, NULL, 0);  // Negative fixint
+  if (value >= INT8_MIN)
+    return mpkWrite(mPack, 0xD0, (uint64_t)value & 0xFF, 1, NULL, 0);
+  if (value >= INT16_MIN)
+    return mpkWrite(mPack, 0xD1, (uint64_t)value & 0xFFFF, 2, NULL, 0);
+  if (value >= INT32_MIN)
+    return mpkWrite(mPack, 0xD2, (uint64_t)value & 0xFFFFFFFFULL, 4, NULL, 0);
+  return msgpackAddInt64(mPack, value);
+}
+
+
+int msgpackAddInt64(msgPack mPack, const int64_t value)
+{
+  // We use "int 64" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  return mpkWrite(mPack, 0xD3, (uint64_t)value, 8, NULL, 0);
+}
+
+
+int msgpackAddDouble(msgPack mPack, const double value)
+{
+  uint64_t raw = 0;
+
+  // We use "float 64" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#float-format-family
+  memcpy((void*)&raw, (void*)&value, 8);
+  return mpkWrite(mPack, 0xCB, raw, 8, NULL, 0);
+}
+
+
+int msgpackAddString(msgPack mPack, const char* string, const uint32_t len)
+{
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#str-format-family
+  return mpkWriteWithLen(mPack, 0xA0, 31, 0xD9, 0xDA, 0xDB, len, (const uint8_t*)string, len);
+}
+
+
+int msgpackAddBinary(msgPack mPack, const uint8_t* inputArray, const uint32_t inputBytes)
+{
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#bin-format-family
+  return mpkWriteWithLen(mPack, 0, 0, 0xC4, 0xC5, 0xC6, inputBytes, inputArray, inputBytes);
+}
+
+
+int msgpackAddMap(msgPack mPack, const uint32_t fields)
+{
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#map-format-family
+  return mpkWriteWithLen(mPack, 0x80, 15, 0, 0xDE, 0xDF, fields, NULL, 0);
+}
+
+
+int msgpackAddArray(msgPack mPack, const uint32_t elements)
+{
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#array-format-family
+  return mpkWriteWithLen(mPack, 0x90, 15, 0, 0xDC, 0xDD, elements, NULL, 0);
+}
+
+
+int msgpackAddExt(msgPack mPack, const int8_t extType, const uint8_t* data, const uint32_t dataBytes)
+{
+  uint8_t specifier = 0;
+  uint8_t lenBytes = 0;
+  int iErr = 0;
+
+  if (mPack == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if ((data == NULL) && (dataBytes > 0))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#ext-format-family
+  // Fixext for 1, 2, 4, 8, 16 bytes, otherwise ext 8 / 16 / 32; the type byte follows the length
+  switch (dataBytes)
+  {
+    case 1: specifier = 0xD4; break;
+    case 2: specifier = 0xD5; break;
+    case 4: specifier = 0xD6; break;
+    case 8: specifier = 0xD7; break;
+    case 16: specifier = 0xD8; break;
+    default:
+      if (dataBytes <= 0xFF)
+      {
+        specifier = 0xC7;
+        lenBytes = 1;
+      }
+      else if (dataBytes <= 0xFFFF)
+      {
+        specifier = 0xC8;
+        lenBytes = 2;
+      }
+      else
+      {
+        specifier = 0xC9;
+        lenBytes = 4;
+      }
+      break;
+  }
+  // Check the whole value fits before writing its first part
+  if ((uint64_t)mPack->currentPosition + 2 + lenBytes + dataBytes >= mPack->bufferLen)
+  {
+    return MPK_ERR_BUFFER_TOO_SHORT;
+  }
+
+  iErr = mpkWrite(mPack, specifier, dataBytes, lenBytes, NULL, 0);
+  if (iErr)
+  {
+    return iErr;
+  }
+  return mpkWrite(mPack, (uint8_t)extType, 0, 0, data, dataBytes);
+}
+
+
+// Segmented output
+
+int msgpackChainInit(mpkChain* chain, const uint32_t segmentBytes, const uint16_t maxSegments)
+{
+  if (chain == NULL)
+    return MPK_ERR_NULL_MPACK;
+  if ((segmentBytes == 0) || (maxSegments == 0))
+    return MPK_ERR_BAD_PARAM;
+
+  chain->head = NULL;
+  chain->tail = NULL;
+  chain->segmentBytes = segmentBytes;
+  chain->totalLen = 0;
+  chain->segmentCount = 0;
+  chain->maxSegments = maxSegments;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackChainFree(mpkChain* chain)
+{
+  mpkSegment* segment = NULL;
+
+  if (chain == NULL)
+    return MPK_ERR_NULL_MPACK;
+
+  while (chain->head != NULL)
+  {
+    segment = chain->head;
+    chain->head = segment->next;
+    free(segment);
+  }
+  chain->tail = NULL;
+  chain->totalLen = 0;
+  chain->segmentCount = 0;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackChainReset(mpkChain* chain)
+{
+  if (chain == NULL)
+    return MPK_ERR_NULL_MPACK;
+
+  for (mpkSegment* segment = chain->head; segment != NULL; segment = segment->next)
+  {
+    segment->len = 0;
+  }
+  chain->tail = chain->head;
+  chain->totalLen = 0;
+
+  return MPK_NO_ERROR;
+}
+
+
+// Makes the segment after the tail (a spare one, or a new one) the tail
+static int mpkChainNextSegment(mpkChain* chain)
+{
+  mpkSegment* segment = NULL;
+
+  if ((chain->tail != NULL) && (chain->tail->next != NULL))
+  { // Spare segment left by msgpackChainReset()
+    chain->tail = chain->tail->next;
+    return MPK_NO_ERROR;
+  }
+  if (chain->segmentCount >= chain->maxSegments)
+    return MPK_ERR_BUFFER_TOO_SHORT;
+
+  segment = (mpkSegment*) malloc(sizeof(mpkSegment) + chain->segmentBytes);
+  if (segment == NULL)
+    return MPK_ERR_NO_MEMORY;
+  segment->next = NULL;
+  segment->data = (uint8_t*)(segment + 1);
+  segment->len = 0;
+
+  if (chain->tail == NULL)
+    chain->head = segment;
+  else
+    chain->tail->next = segment;
+  chain->tail = segment;
+  chain->segmentCount++;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackChainAppend(mpkChain* chain, const uint8_t* data, const uint32_t len)
+{
+  uint32_t done = 0;
+  uint32_t chunk = 0;
+  int iErr = 0;
+
+  if (chain == NULL)
+    return MPK_ERR_NULL_MPACK;
+  if ((data == NULL) && (len > 0))
+    return MPK_ERR_BAD_PARAM;
+
+  while (done < len)
+  {
+    if ((chain->tail == NULL) || (chain->tail->len == chain->segmentBytes))
+    {
+      iErr = mpkChainNextSegment(chain);
+      if (iErr)
+        return iErr;  // Bytes copied so far stay in the chain
+    }
+    chunk = chain->segmentBytes - chain->tail->len;
+    if (chunk > len - done)
+      chunk = len - done;
+    memcpy((void*) &(chain->tail->data[chain->tail->len]), (const void*) &(data[done]), chunk);
+    chain->tail->len += chunk;
+    chain->totalLen += chunk;
+    done += chunk;
+  }
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackChainOpenMsgPack(mpkChain* chain, const uint32_t maxBytes, mpkStruct* window)
+{
+  int iErr = 0;
+
+  if ((chain == NULL) || (window == NULL))
+    return MPK_ERR_NULL_MPACK;
+  if ((maxBytes == 0) || (maxBytes > chain->segmentBytes))
+    return MPK_ERR_BAD_PARAM;
+
+  if ((chain->tail == NULL) || (chain->segmentBytes - chain->tail->len < maxBytes))
+  {
+    iErr = mpkChainNextSegment(chain);
+    if (iErr)
+      return iErr;
+  }
+
+  window->msgBuffer = &(chain->tail->data[chain->tail->len]);
+  window->bufferLen = chain->segmentBytes - chain->tail->len;
+  window->currentMsgLen = 0;
+  window->currentPosition = 0;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackChainCloseMsgPack(mpkChain* chain, const mpkStruct* window)
+{
+  if ((chain == NULL) || (window == NULL))
+    return MPK_ERR_NULL_MPACK;
+  if ( (chain->tail == NULL) || (window->msgBuffer != &(chain->tail->data[chain->tail->len])) ||
+       (window->currentMsgLen > chain->segmentBytes - chain->tail->len) )
+    return MPK_ERR_BAD_PARAM;
+
+  chain->tail->len += window->currentMsgLen;
+  chain->totalLen += window->currentMsgLen;
+
+  return MPK_NO_ERROR;
+}
+
+
+uint32_t msgpackChainGetLen(const mpkChain* chain)
+{
+  return (chain == NULL) ? 0 : chain->totalLen;
+}
+
+
+int msgpackChainGetIoVec(const mpkChain* chain, mpkIoVec* iov, const uint16_t maxIov, uint16_t* iovCount)
+{
+  uint16_t count = 0;
+
+  if ((chain == NULL) || (iov == NULL) || (iovCount == NULL))
+    return MPK_ERR_NULL_MPACK;
+
+  *iovCount = 0;
+  for (const mpkSegment* segment = chain->head; segment != NULL; segment = segment->next)
+  {
+    if (segment->len == 0)
+      continue;
+    if (count >= maxIov)
+      return MPK_ERR_BUFFER_TOO_SHORT;
+    iov[count].base = segment->data;
+    iov[count].len = segment->len;
+    count++;
+    if (segment == chain->tail)
+      break;
+  }
+  *iovCount = count;
+
+  return MPK_NO_ERROR;
+}
+
+
+// Reader
+
+static uint64_t mpkReadBE(const uint8_t* p, const uint8_t bytes)
+{
+  uint64_t value = 0;
+
+  for (uint8_t i = 0; i < bytes; i++)
+    value = (value << 8) | p[i];
+
+  return value;
+}
+
+
+// Decodes the value at the cursor without moving it
+// "totalBytes" = type byte + header + payload (for arrays and maps: header only)
+static int mpkDecode(const mpkReader* reader, mpkValue* value, uint32_t* totalBytes)
+{
+  const uint8_t* p = NULL;
+  uint32_t available = 0;
+  uint32_t headerBytes = 1; // Type byte included
+  uint8_t lenBytes = 0;     // Length field of str / bin / ext / array / map
+  uint8_t specifier = 0;
+
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (reader->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+  if (reader->currentPosition >= reader->msgLen)
+  {
+    return MPK_ERR_TRUNCATED;
+  }
+  p = reader->msgBuffer + reader->currentPosition;
+  available = reader->msgLen - reader->currentPosition;
+  specifier = p[0];
+
+  value->offset = reader->currentPosition;
+  value->data = NULL;
+  value->len = 0;
+  value->extType = 0;
+  value->u = 0;
+
+  // Fixed-length encodings https://github.com/msgpack/msgpack/blob/master/spec.md#formats
+  if (specifier <= 0x7F)
+  { // Positive fixint
+    value->type = MPK_TYPE_UINT;
+    value->u = specifier;
+    *totalBytes = 1;
+    return MPK_NO_ERROR;
+  }
+  if (specifier >= 0xE0)
+  { // Negative fixint
+    value->type = MPK_TYPE_INT;
+    value->i = (int8_t)specifier;
+    *totalBytes = 1;
+    return MPK_NO_ERROR;
+  }
+  if ((specifier & 0xF0) == 0x80)
+  { // Fixmap
+    value->type = MPK_TYPE_MAP;
+    value->count = specifier & 0x0F;
+    *totalBytes = 1;
+    return MPK_NO_ERROR;
+  }
+  if ((specifier & 0xF0) == 0x90)
+  { // Fixarray
+    value->type = MPK_TYPE_ARRAY;
+    value->count = specifier & 0x0F;
+    *totalBytes = 1;
+    return MPK_NO_ERROR;
+  }
+  if ((specifier & 0xE0) == 0xA0)
+  { // Fixstr
+    value->type = MPK_TYPE_STR;
+    value->len = specifier & 0x1F;
+  }
+  else
+  {
+    switch (specifier)
+    {
+      case 0xC0: value->type = MPK_TYPE_NIL; break;
+      case 0xC2: value->type = MPK_TYPE_BOOL; value->boolean = false; break;
+      case 0xC3: value->type = MPK_TYPE_BOOL; value->boolean = true; break;
+      case 0xC4: value->type = MPK_TYPE_BIN; lenBytes = 1; break;
+      case 0xC5: value->type = MPK_TYPE_BIN; lenBytes = 2; break;
+      case 0xC6: value->type = MPK_TYPE_BIN; lenBytes = 4; break;
+      case 0xC7: value->type = MPK_TYPE_EXT; lenBytes = 1; break;
+      case 0xC8: value->type = MPK_TYPE_EXT; lenBytes = 2; break;
+      case 0xC9: value->type = MPK_TYPE_EXT; lenBytes = 4; break;
+      case 0xCA: value->type = MPK_TYPE_FLOAT32; headerBytes = 5; break;
+      case 0xCB: value->type = MPK_TYPE_FLOAT64; headerBytes = 9; break;
+      case 0xCC: value->type = MPK_TYPE_UINT; headerBytes = 2; break;
+      case 0xCD: value->type = MPK_TYPE_UINT; headerBytes = 3; break;
+      case 0xCE: value->type = MPK_TYPE_UINT; headerBytes = 5; break;
+      case 0xCF: value->type = MPK_TYPE_UINT; headerBytes = 9; break;
+      case 0xD0: value->type = MPK_TYPE_INT; headerBytes = 2; break;
+      case 0xD1: value->type = MPK_TYPE_INT; headerBytes = 3; break;
+      case 0xD2: value->type = MPK_TYPE_INT; headerBytes = 5; break;
+      case 0xD3: value->type = MPK_TYPE_INT; headerBytes = 9; break;
+      case 0xD4: value->type = MPK_TYPE_EXT; value->len = 1; headerBytes = 2; break;
+      case 0xD5: value->type = MPK_TYPE_EXT; value->len = 2; headerBytes = 2; break;
+      case 0xD6: value->type = MPK_TYPE_EXT; value->len = 4; headerBytes = 2; break;
+      case 0xD7: value->type = MPK_TYPE_EXT; value->len = 8; headerBytes = 2; break;
+      case 0xD8: value->type = MPK_TYPE_EXT; value->len = 16; headerBytes = 2; break;
+      case 0xD9: value->type = MPK_TYPE_STR; lenBytes = 1; break;
+      case 0xDA: value->type = MPK_TYPE_STR; lenBytes = 2; break;
+      case 0xDB: value->type = MPK_TYPE_STR; lenBytes = 4; break;
+      case 0xDC: value->type = MPK_TYPE_ARRAY; lenBytes = 2; break;
+      case 0xDD: value->type = MPK_TYPE_ARRAY; lenBytes = 4; break;
+      case 0xDE: value->type = MPK_TYPE_MAP; lenBytes = 2; break;
+      case 0xDF: value->type = MPK_TYPE_MAP; lenBytes = 4; break;
+      default:
+        return MPK_ERR_INVALID; // 0xC1, never used
+    }
+  }
+
+  // Variable-length header
+  if (lenBytes > 0)
+  {
+    headerBytes += lenBytes;
+    if (value->type == MPK_TYPE_EXT)
+      headerBytes++; // Ext type byte
+    if (available < headerBytes)
+    {
+      return MPK_ERR_TRUNCATED;
+    }
+    if ((value->type == MPK_TYPE_ARRAY) || (value->type == MPK_TYPE_MAP))
+    {
+      value->count = (uint32_t)mpkReadBE(p + 1, lenBytes);
+      *totalBytes = headerBytes;
+      return MPK_NO_ERROR;
+    }
+    value->len = (uint32_t)mpkReadBE(p + 1, lenBytes);
+  }
+  if (available < headerBytes)
+  {
+    return MPK_ERR_TRUNCATED;
+  }
+  if (value->len > available - headerBytes)
+  {
+    return MPK_ERR_TRUNCATED;
+  }
+
+  switch (value->type)
+  {
+    case MPK_TYPE_STR:
+    case MPK_TYPE_BIN:
+      value->data = p + headerBytes;
+      break;
+    case MPK_TYPE_EXT:
+      value->extType = (int8_t)p[headerBytes - 1];
+      value->data = p + headerBytes;
+      break;
+    case MPK_TYPE_UINT:
+      value->u = mpkReadBE(p + 1, (uint8_t)(headerBytes - 1));
+      break;
+    case MPK_TYPE_INT:
+    { // Sign-extend from the encoded width
+      uint8_t bits = (uint8_t)((headerBytes - 1) * 8);
+      uint64_t raw = mpkReadBE(p + 1, (uint8_t)(headerBytes - 1));
+      if ((bits < 64) && (raw & ((uint64_t)1 << (bits - 1))))
+        raw |= ~(uint64_t)0 << bits;
+      value->i = (int64_t)raw;
+      if (value->i >= 0)
+        value->type = MPK_TYPE_UINT; // int * carrying a non-negative value
+    }
+    break;
+    case MPK_TYPE_FLOAT32:
+    {
+      uint32_t raw = (uint32_t)mpkReadBE(p + 1, 4);
+      memcpy((void*)&(value->f32), (void*)&raw, 4);
+    }
+    break;
+    case MPK_TYPE_FLOAT64:
+    {
+      uint64_t raw = mpkReadBE(p + 1, 8);
+      memcpy((void*)&(value->f64), (void*)&raw, 8);
+    }
+    break;
+    default:
+      break;
+  }
+
+  *totalBytes = headerBytes + value->len;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReaderInit(mpkReader* reader, const uint8_t* buffer, const uint32_t len)
+{
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (buffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+
+  reader->msgBuffer = buffer;
+  reader->msgLen = len;
+  reader->currentPosition = 0;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReaderPeekType(const mpkReader* reader, uint8_t* type)
+{
+  mpkValue value;
+  uint32_t totalBytes = 0;
+  int iErr = 0;
+
+  if (type == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkDecode(reader, &value, &totalBytes);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *type = value.type;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadValue(mpkReader* reader, mpkValue* value)
+{
+  uint32_t totalBytes = 0;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkDecode(reader, value, &totalBytes);
+  if (iErr)
+  {
+    return iErr;
+  }
+  reader->currentPosition += totalBytes;
+
+  return MPK_NO_ERROR;
+}
+
+
+// Reads the next value only if it has type "type"
+static int mpkReadTyped(mpkReader* reader, mpkValue* value, const uint8_t type)
+{
+  uint32_t totalBytes = 0;
+  int iErr = 0;
+
+  iErr = mpkDecode(reader, value, &totalBytes);
+  if (iErr)
+  {
+    return iErr;
+  }
+  if (value->type != type)
+  {
+    return MPK_ERR_TYPE_MISMATCH;
+  }
+  reader->currentPosition += totalBytes;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadNil(mpkReader* reader)
+{
+  mpkValue value;
+
+  return mpkReadTyped(reader, &value, MPK_TYPE_NIL);
+}
+
+
+int msgpackReadBoolean(mpkReader* reader, bool* value)
+{
+  mpkValue v;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkReadTyped(reader, &v, MPK_TYPE_BOOL);
+  if (!iErr)
+    *value = v.boolean;
+
+  return iErr;
+}
+
+
+int msgpackReadUInt(mpkReader* reader, uint64_t* value)
+{
+  mpkValue v;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkReadTyped(reader, &v, MPK_TYPE_UINT);
+  if (!iErr)
+    *value = v.u;
+
+  return iErr;
+}
+
+
+int msgpackReadInt(mpkReader* reader, int64_t* value)
+{
+  mpkValue v;
+  uint32_t totalBytes = 0;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkDecode(reader, &v, &totalBytes);
+  if (iErr)
+  {
+    return iErr;
+  }
+  if ( (v.type != MPK_TYPE_INT) && ((v.type != MPK_TYPE_UINT) || (v.u > (uint64_t)INT64_MAX)) )
+  {
+    return MPK_ERR_TYPE_MISMATCH;
+  }
+  *value = v.i;
+  reader->currentPosition += totalBytes;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadString(mpkReader* reader, const char** string, uint32_t* len)
+{
+  mpkValue v;
+  int iErr = 0;
+
+  if ((string == NULL) || (len == NULL))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkReadTyped(reader, &v, MPK_TYPE_STR);
+  if (!iErr)
+  {
+    *string = (const char*)v.data;
+    *len = v.len;
+  }
+
+  return iErr;
+}
+
+
+int msgpackReadByteArray(mpkReader* reader, const uint8_t** data, uint32_t* len)
+{
+  mpkValue v;
+  int iErr = 0;
+
+  if ((data == NULL) || (len == NULL))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkReadTyped(reader, &v, MPK_TYPE_BIN);
+  if (!iErr)
+  {
+    *data = v.data;
+    *len = v.len;
+  }
+
+  return iErr;
+}
+
+
+int msgpackReadMapHeader(mpkReader* reader, uint32_t* pairs)
+{
+  mpkValue v;
+  int iErr = 0;
+
+  if (pairs == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkReadTyped(reader, &v, MPK_TYPE_MAP);
+  if (!iErr)
+    *pairs = v.count;
+
+  return iErr;
+}
+
+
+int msgpackReadArrayHeader(mpkReader* reader, uint32_t* elements)
+{
+  mpkValue v;
+  int iErr = 0;
+
+  if (elements == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = mpkReadTyped(reader, &v, MPK_TYPE_ARRAY);
+  if (!iErr)
+    *elements = v.count;
+
+  return iErr;
+}
+
+
+int msgpackSkipValue(mpkReader* reader)
+{
+  // Payload-free or fixed-size encodings: total bytes straight from the type byte, 0 = needs decoding
+  static const uint8_t fixedBytes[32] = 
+  { // 0xC0 .. 0xDF
+    1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 5, 9, 2, 3, 5, 9,
+    2, 3, 5, 9, 3, 4, 6, 10, 18, 0, 0, 0, 0, 0, 0, 0
+  };
+  mpkValue value;
+  uint32_t position = 0;
+  uint32_t totalBytes = 0;
+  uint64_t pending = 1; // Values still to be skipped: containers add their children
+  int iErr = 0;
+
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (reader->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+
+  position = reader->currentPosition;
+  while (pending > 0)
+  {
+    uint8_t specifier = 0;
+
+    if (position >= reader->msgLen)
+    {
+      return MPK_ERR_TRUNCATED;
+    }
+    specifier = reader->msgBuffer[position];
+
+    // Fast path: fixints, fixstr and fixed-size scalars
+    totalBytes = 0;
+    if ((specifier <= 0x7F) || (specifier >= 0xE0))
+      totalBytes = 1;
+    else if ((specifier & 0xE0) == 0xA0)
+      totalBytes = 1 + (specifier & 0x1F);
+    else if (specifier >= 0xC0)
+      totalBytes = fixedBytes[specifier - 0xC0];
+
+    if (totalBytes == 0)
+    { // Containers and length-prefixed payloads
+      mpkReader at = *reader;
+      at.currentPosition = position;
+      iErr = mpkDecode(&at, &value, &totalBytes);
+      if (iErr)
+      {
+        return iErr;
+      }
+      if (value.type == MPK_TYPE_ARRAY)
+        pending += value.count;
+      else if (value.type == MPK_TYPE_MAP)
+        pending += 2 * (uint64_t)value.count;
+    }
+    if (totalBytes > reader->msgLen - position)
+    {
+      return MPK_ERR_TRUNCATED;
+    }
+    position += totalBytes;
+    pending--;
+
+    // Each element takes at least one byte: a count beyond the buffer cannot be satisfied
+    if (pending > reader->msgLen - position)
+    {
+      return MPK_ERR_TRUNCATED;
+    }
+  }
+  reader->currentPosition = position;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReaderFindKey(mpkReader* reader, const uint32_t pairs, const char* key)
+{
+  const char* mapKey = NULL;
+  uint32_t keyLen = 0;
+  uint32_t mapKeyLen = 0;
+  uint32_t start = 0;
+  int iErr = 0;
+
+  if ((reader == NULL) || (key == NULL))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+
+  start = reader->currentPosition;
+  keyLen = strlen(key);
+  for (uint32_t i = 0; i < pairs; i++)
+  {
+    iErr = msgpackReadString(reader, &mapKey, &mapKeyLen);
+    if (iErr == MPK_ERR_TYPE_MISMATCH)
+      iErr = msgpackSkipValue(reader); // Non-string key
+    else if ( (!iErr) && (mapKeyLen == keyLen) && (memcmp(mapKey, key, keyLen) == 0) )
+      return MPK_NO_ERROR;
+    if (!iErr)
+      iErr = msgpackSkipValue(reader);
+    if (iErr)
+    {
+      reader->currentPosition = start;
+      return iErr;
+    }
+  }
+
+  return MPK_ERR_NOT_FOUND;
+}
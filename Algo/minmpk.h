@@ -1,10 +1,7 @@
 // minmpk.h
-// header for minimal messagepack builder
+// header for minimal messagepack builder and reader
 // v20231012-2
 
-// TODO:
-//  Add more types
-
 // By Fernando Carello for GT50
 // Released under MIT license:
 
@@ -102,6 +99,12 @@ int msgpackAddShortByteArray(msgPack mPack, const uint8_t* inputArray, const uin
 // Returns error code (0 = OK)
 int msgpackAddByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t inputBytes);
 
+// Writes a canonical bin 8 / bin 16 header for "inputBytes" bytes and skips the payload area,
+// returning a pointer to it in "payload" so the caller can fill (or transform) it in place
+// Max 65535 bytes
+// Returns error code (0 = OK)
+int msgpackReserveByteArray(msgPack mPack, const uint16_t inputBytes, uint8_t** payload);
+
 // Returns error code (0 = OK)
 int msgpackAddBoolean(msgPack mPack, const bool value);
 
@@ -109,6 +112,192 @@ int msgpackAddBoolean(msgPack mPack, const bool value);
 // Returns error code (0 = OK)
 int msgpackAddShortArray(msgPack mPack, const uint8_t elements);
 
+// Canonical encodings: each function picks the smallest format able to hold the value or length,
+// as required by Algorand's canonical msgpack (a transaction is signed over its canonical encoding)
+
+// Returns error code (0 = OK)
+int msgpackAddNil(msgPack mPack);
+
+// Positive fixint, uint 8, uint 16, uint 32 or uint 64
+// Returns error code (0 = OK)
+int msgpackAddUInt(msgPack mPack, const uint64_t value);
+
+// Non-negative values as msgpackAddUInt(); negative ones as negative fixint, int 8, int 16, int 32 or int 64
+// Returns error code (0 = OK)
+int msgpackAddInt(msgPack mPack, const int64_t value);
+
+// Always "int 64"
+// Returns error code (0 = OK)
+int msgpackAddInt64(msgPack mPack, const int64_t value);
+
+// "float 64"
+// Returns error code (0 = OK)
+int msgpackAddDouble(msgPack mPack, const double value);
+
+// "len" bytes (no trailing NULL needed) as fixstr, str 8, str 16 or str 32
+// Returns error code (0 = OK)
+int msgpackAddString(msgPack mPack, const char* string, const uint32_t len);
+
+// Bin 8, bin 16 or bin 32
+// Returns error code (0 = OK)
+int msgpackAddBinary(msgPack mPack, const uint8_t* inputArray, const uint32_t inputBytes);
+
+// Fixmap, map 16 or map 32 header; "fields" key/value pairs have to follow
+// Returns error code (0 = OK)
+int msgpackAddMap(msgPack mPack, const uint32_t fields);
+
+// Fixarray, array 16 or array 32 header; "elements" values have to follow
+// Returns error code (0 = OK)
+int msgpackAddArray(msgPack mPack, const uint32_t elements);
+
+// Fixext 1/2/4/8/16 or ext 8, ext 16, ext 32
+// Returns error code (0 = OK)
+int msgpackAddExt(msgPack mPack, const int8_t extType, const uint8_t* data, const uint32_t dataBytes);
+
+
+// Segmented output
+// A chain of fixed-size segments, allocated on demand, holding a message larger than any single buffer
+// (e.g. the concatenated signed transactions of a group). Segments are not contiguous: the transport
+// sends them in order (see msgpackChainGetIoVec) instead of flattening them into one buffer.
+// Messages may be appended (copied, spanning segments) or built in place inside a segment through a window
+
+#define MPK_ERR_NO_MEMORY 9
+
+typedef struct mpkSegment
+{
+  struct mpkSegment* next;
+  uint8_t* data;         // segmentBytes, allocated together with the segment
+  uint32_t len;          // Bytes used
+} mpkSegment;
+
+typedef struct mpkChain
+{
+  mpkSegment* head;
+  mpkSegment* tail;      // Segment being written; segments after it are spare ones, kept by msgpackChainReset()
+  uint32_t segmentBytes;
+  uint32_t totalLen;
+  uint16_t segmentCount; // Allocated
+  uint16_t maxSegments;
+} mpkChain;
+
+typedef struct mpkIoVec
+{
+  const uint8_t* base;
+  uint32_t len;
+} mpkIoVec;
+
+// Chain struct passed by caller; no segment is allocated until the first write
+// Returns error code (0 = OK)
+int msgpackChainInit(mpkChain* chain, const uint32_t segmentBytes, const uint16_t maxSegments);
+
+// Frees all segments
+// Returns error code (0 = OK)
+int msgpackChainFree(mpkChain* chain);
+
+// Empties the chain, keeping its segments for reuse
+// Returns error code (0 = OK)
+int msgpackChainReset(mpkChain* chain);
+
+// Copies "len" bytes at the end of the chain, filling the last segment and then new ones
+// Returns error code (0 = OK)
+int msgpackChainAppend(mpkChain* chain, const uint8_t* data, const uint32_t len);
+
+// Points caller-owned "window" to at least "maxBytes" (<= segmentBytes) of free space at the end of the chain,
+// moving to a new segment if the last one has less, so a message can be built and signed in place with the
+// msgpackAdd*() functions. Its final length (window->currentMsgLen, from the start of the window) is
+// committed by msgpackChainCloseMsgPack(); nothing else may be written to the chain in between
+// Returns error code (0 = OK)
+int msgpackChainOpenMsgPack(mpkChain* chain, const uint32_t maxBytes, mpkStruct* window);
+
+// Returns error code (0 = OK)
+int msgpackChainCloseMsgPack(mpkChain* chain, const mpkStruct* window);
+
+uint32_t msgpackChainGetLen(const mpkChain* chain);
+
+// Fills "iov" with the non-empty segments, in order
+// Returns error code (0 = OK), MPK_ERR_BUFFER_TOO_SHORT if more than "maxIov" are needed
+int msgpackChainGetIoVec(const mpkChain* chain, mpkIoVec* iov, const uint16_t maxIov, uint16_t* iovCount);
+
+
+// Reader
+// Cursor over a complete MessagePack held by the caller: nothing is copied or allocated,
+// str / bin / ext values are returned as slices pointing into the buffer.
+// Every read checks bounds; on error the cursor does not move
+
+// Reader error codes
+#define MPK_ERR_TRUNCATED 5
+#define MPK_ERR_TYPE_MISMATCH 6
+#define MPK_ERR_INVALID 7        // Reserved type byte 0xC1
+#define MPK_ERR_NOT_FOUND 8
+
+// Value types
+#define MPK_TYPE_NIL 0
+#define MPK_TYPE_BOOL 1
+#define MPK_TYPE_UINT 2          // Non-negative integer, any encoding (positive fixint, uint *, int * >= 0)
+#define MPK_TYPE_INT 3           // Negative integer
+#define MPK_TYPE_FLOAT32 4
+#define MPK_TYPE_FLOAT64 5
+#define MPK_TYPE_STR 6
+#define MPK_TYPE_BIN 7
+#define MPK_TYPE_ARRAY 8
+#define MPK_TYPE_MAP 9
+#define MPK_TYPE_EXT 10
+
+typedef struct mpkReader
+{
+  const uint8_t* msgBuffer;
+  uint32_t msgLen;
+  uint32_t currentPosition;
+} mpkReader;
+
+typedef struct mpkValue
+{
+  uint8_t type;          // MPK_TYPE_*
+  int8_t extType;        // MPK_TYPE_EXT only
+  uint32_t offset;       // Position of the value's type byte
+  union
+  {
+    bool boolean;
+    uint64_t u;          // MPK_TYPE_UINT
+    int64_t i;           // MPK_TYPE_INT (and MPK_TYPE_UINT values up to INT64_MAX)
+    float f32;
+    double f64;
+    uint32_t count;      // Array elements or map pairs; they follow the header
+  };
+  const uint8_t* data;   // Str / bin / ext payload, inside the buffer (str is *not* NULL terminated)
+  uint32_t len;          // Payload bytes
+} mpkValue;
+
+// Returns error code (0 = OK)
+int msgpackReaderInit(mpkReader* reader, const uint8_t* buffer, const uint32_t len);
+
+// Type of the next value (MPK_TYPE_*), without moving
+// Returns error code (0 = OK)
+int msgpackReaderPeekType(const mpkReader* reader, uint8_t* type);
+
+// Reads the next value; for arrays and maps only the header is read, the cursor moves to the first element
+// Returns error code (0 = OK)
+int msgpackReadValue(mpkReader* reader, mpkValue* value);
+
+// Typed reads: MPK_ERR_TYPE_MISMATCH if the next value has another type
+// Returns error code (0 = OK)
+int msgpackReadNil(mpkReader* reader);
+int msgpackReadBoolean(mpkReader* reader, bool* value);
+int msgpackReadUInt(mpkReader* reader, uint64_t* value);
+int msgpackReadInt(mpkReader* reader, int64_t* value);   // Any integer within int64_t range
+int msgpackReadString(mpkReader* reader, const char** string, uint32_t* len);
+int msgpackReadByteArray(mpkReader* reader, const uint8_t** data, uint32_t* len);
+int msgpackReadMapHeader(mpkReader* reader, uint32_t* pairs);
+int msgpackReadArrayHeader(mpkReader* reader, uint32_t* elements);
+
+// Skips the next value, nested arrays and maps included, without decoding scalars
+// Returns error code (0 = OK)
+int msgpackSkipValue(mpkReader* reader);
+
+// Cursor on the first key of a map with "pairs" entries: moves it to the value of string key "key"
+// Returns error code (0 = OK), MPK_ERR_NOT_FOUND (cursor after the map) if missing
+int msgpackReaderFindKey(mpkReader* reader, const uint32_t pairs, const char* key);
+
 
 
 #endif
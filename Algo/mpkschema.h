@@ -0,0 +1,193 @@
+// mpkschema.h
+// compile-time MessagePack map schemas on top of minmpk (C++11)
+// v20261018-1
+
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License governing permissions and limitations under the License.
+ * */
+
+// A schema lists the fields of a map as types, each one naming its key and value encoder:
+//
+//   MPK_FIELD(TxFee, "fee", mpkschema::UInt);
+//   MPK_FIELD(TxFirstValid, "fv", mpkschema::UInt);
+//   typedef mpkschema::Map<TxFee, TxFirstValid> Schema;
+//   iErr = Schema::encode(mPack, fee, firstValid);   // one argument per field, type checked
+//
+// Keys have to be unique and in canonical order (bytewise ascending, as in Algorand's canonical msgpack):
+// anything else fails to build. As in the canonical encoding, fields holding a zero / empty value are
+// omitted, and the map size is counted from the values: it can't get out of sync with the fields written.
+// Encoders are expanded at compile time, keys are written as fixstr with a constant length; nothing is
+// compared or sorted at run time.
+//
+// A value encoder is any type providing:
+//   typedef ... Value;
+//   static bool present(const Value& v);         // false = field omitted
+//   static int write(msgPack mPack, const Value& v);  // Returns error code (0 = OK)
+// so a field may hold a nested Map (see AlgoIoT asset parameters) or an array
+
+#ifndef __MPKSCHEMA_H
+#define __MPKSCHEMA_H
+
+#include <stdint.h>
+#include <string.h>
+#include "minmpk.h"
+
+// Declares field "NAME" with key "KEY" (string literal, max 31 chars) and value encoder "ENCODER"
+#define MPK_FIELD(NAME, KEY, ENCODER) \
+  struct NAME : ENCODER { static constexpr const char* key() { return KEY; } }
+
+namespace mpkschema
+{
+
+// Compile-time key helpers (C++11 constexpr: single return statement)
+constexpr uint32_t keyLength(const char* key)
+{
+  return (*key == '\0') ? 0 : 1 + keyLength(key + 1);
+}
+
+// Bytewise "a < b"; equal keys are not less, so duplicates are caught too
+constexpr bool keyLess(const char* a, const char* b)
+{
+  return (*a != *b) ? ((uint8_t)*a < (uint8_t)*b) : ((*a != '\0') && keyLess(a + 1, b + 1));
+}
+
+template <uint32_t N> struct Constant { static const uint32_t value = N; };
+
+
+// Value encoders
+
+// Positive fixint, uint 8, uint 16, uint 32 or uint 64
+struct UInt
+{
+  typedef uint64_t Value;
+  static bool present(const Value& v) { return v != 0; }
+  static int write(msgPack mPack, const Value& v) { return msgpackAddUInt(mPack, v); }
+};
+
+struct Bool
+{
+  typedef bool Value;
+  static bool present(const Value& v) { return v; }
+  static int write(msgPack mPack, const Value& v) { return msgpackAddBoolean(mPack, v); }
+};
+
+// NULL terminated string
+struct Str
+{
+  typedef const char* Value;
+  static bool present(const Value& v) { return (v != NULL) && (v[0] != '\0'); }
+  static int write(msgPack mPack, const Value& v) { return msgpackAddString(mPack, v, strlen(v)); }
+};
+
+// Fixed-size byte array (address, hash); all zeros counts as empty
+template <uint32_t N>
+struct FixedBin
+{
+  typedef const uint8_t* Value;
+  static bool present(const Value& v)
+  {
+    if (v == NULL)
+      return false;
+    for (uint32_t i = 0; i < N; i++)
+    {
+      if (v[i] != 0)
+        return true;
+    }
+    return false;
+  }
+  static int write(msgPack mPack, const Value& v) { return msgpackAddBinary(mPack, v, N); }
+};
+
+// Variable-size byte array
+typedef struct
+{
+  const uint8_t* data;
+  uint32_t len;
+} Bytes;
+
+struct Bin
+{
+  typedef Bytes Value;
+  static bool present(const Value& v) { return (v.data != NULL) && (v.len > 0); }
+  static int write(msgPack mPack, const Value& v) { return msgpackAddBinary(mPack, v.data, v.len); }
+};
+
+
+// Schema internals: one specialization per remaining field, expanded at compile time
+
+template <class... F> struct IsSorted;
+template <> struct IsSorted<> { static const bool value = true; };
+template <class F> struct IsSorted<F> { static const bool value = true; };
+template <class F, class G, class... R> struct IsSorted<F, G, R...>
+{
+  static const bool value = keyLess(F::key(), G::key()) && IsSorted<G, R...>::value;
+};
+
+template <class... F> struct Fields;
+template <> struct Fields<>
+{
+  static uint32_t count() { return 0; }
+  static int write(msgPack) { return MPK_NO_ERROR; }
+};
+template <class F, class... R> struct Fields<F, R...>
+{
+  static_assert((keyLength(F::key()) > 0) && (keyLength(F::key()) <= 31), "mpkschema: keys must be 1 to 31 chars (fixstr)");
+
+  static uint32_t count(const typename F::Value& v, const typename R::Value&... rest)
+  {
+    return (F::present(v) ? 1 : 0) + Fields<R...>::count(rest...);
+  }
+
+  static int write(msgPack mPack, const typename F::Value& v, const typename R::Value&... rest)
+  {
+    if (F::present(v))
+    {
+      int iErr = msgpackAddString(mPack, F::key(), Constant<keyLength(F::key())>::value);
+      if (iErr)
+        return iErr;
+      iErr = F::write(mPack, v);
+      if (iErr)
+        return iErr;
+    }
+    return Fields<R...>::write(mPack, rest...);
+  }
+};
+
+
+// Map with fields "F", in canonical key order
+template <class... F>
+struct Map
+{
+  static_assert(IsSorted<F...>::value, "mpkschema: map keys must be unique and in canonical (ascending) order");
+
+  static const uint32_t MAX_FIELDS = sizeof...(F);
+
+  // Fields actually written for these values
+  static uint32_t count(const typename F::Value&... values)
+  {
+    return Fields<F...>::count(values...);
+  }
+
+  // Map header, then each non-empty field
+  // Returns error code (0 = OK)
+  static int encode(msgPack mPack, const typename F::Value&... values)
+  {
+    int iErr = msgpackAddMap(mPack, Fields<F...>::count(values...));
+    if (iErr)
+      return iErr;
+    return Fields<F...>::write(mPack, values...);
+  }
+};
+
+} // namespace mpkschema
+
+#endif
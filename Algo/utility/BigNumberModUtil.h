@@ -0,0 +1,361 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_BIGNUMBERMODUTIL_H
+#define CRYPTO_BIGNUMBERMODUTIL_H
+
+// Definitions of the BigNumberUtil templates for arithmetic modulo a
+// fixed odd modulus, included by the modules that instantiate them.
+//
+// The Modulus argument is a traits class that describes the modulus:
+//
+//     struct Modulus {
+//         // Number of limbs in the modulus, N.
+//         static const size_t count = ...;
+//         // -(modulus^-1) mod 2^LIMB_BITS, for Montgomery reduction.
+//         static const limb_t inverse = ...;
+//         // The modulus, N limbs in program memory.
+//         static const limb_t *modulus();
+//         // R^2 mod modulus where R = 2^(N * LIMB_BITS), N limbs in
+//         // program memory.
+//         static const limb_t *r2();
+//     };
+//
+// The sizes are compile-time constants so all temporaries are on the
+// stack and the compiler is free to unroll the inner loops.
+
+#include "../BigNumberUtil.h"
+#include "../Crypto.h"
+#include "LimbUtil.h"
+#include <string.h>
+
+// Size of the window used by powMont() to raise a value to a power.
+// The default is 4 bits except on AVR where the 2^w - 1 precomputed
+// powers would take too much of the stack.
+#if !defined(BIGNUMBER_POW_WINDOW)
+#if defined(__AVR__)
+#define BIGNUMBER_POW_WINDOW 1
+#else
+#define BIGNUMBER_POW_WINDOW 4
+#endif
+#endif
+#if BIGNUMBER_POW_WINDOW < 1 || BIGNUMBER_POW_WINDOW > 6
+#error "BIGNUMBER_POW_WINDOW must be between 1 and 6"
+#endif
+
+/**
+ * \brief Multiplies two values in Montgomery form.
+ *
+ * \param result The result x * y / R modulo the modulus, which must be
+ * Modulus::count limbs in size and can be the same array as \a x or \a y.
+ * \param x The first value to multiply, Modulus::count limbs in size.
+ * \param y The second value to multiply, Modulus::count limbs in size.
+ *
+ * The result is fully reduced if x * y is less than R times the modulus,
+ * which is the case when both \a x and \a y are less than the modulus.
+ *
+ * \sa squareMont(), reduceMont()
+ */
+template <typename Modulus>
+void BigNumberUtil::mulMont(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    limb_t temp[2 * Modulus::count];
+    dlimb_t carry;
+    size_t i, j;
+
+    // Multiply the lowest limb of y by x.
+    carry = 0;
+    for (i = 0; i < Modulus::count; ++i) {
+        carry += ((dlimb_t)(x[i])) * y[0];
+        temp[i] = (limb_t)carry;
+        carry >>= LIMB_BITS;
+    }
+    temp[Modulus::count] = (limb_t)carry;
+
+    // Multiply and add the remaining limbs of y by x.
+    for (i = 1; i < Modulus::count; ++i) {
+        carry = 0;
+        for (j = 0; j < Modulus::count; ++j) {
+            carry += ((dlimb_t)(x[j])) * y[i];
+            carry += temp[i + j];
+            temp[i + j] = (limb_t)carry;
+            carry >>= LIMB_BITS;
+        }
+        temp[i + Modulus::count] = (limb_t)carry;
+    }
+
+    reduceMont<Modulus>(result, temp);
+    clean(temp);
+}
+
+/**
+ * \brief Squares a value in Montgomery form.
+ *
+ * \param result The result x * x / R modulo the modulus, which must be
+ * Modulus::count limbs in size and can be the same array as \a x.
+ * \param x The value to square, Modulus::count limbs in size.
+ *
+ * Each cross product x[i] * x[j] is computed once and then doubled,
+ * which saves almost half of the limb multiplications of mulMont().
+ *
+ * \sa mulMont()
+ */
+template <typename Modulus>
+void BigNumberUtil::squareMont(limb_t *result, const limb_t *x)
+{
+    limb_t temp[2 * Modulus::count];
+    dlimb_t carry;
+    size_t i, j;
+
+    // Sum the cross products x[i] * x[j] for i < j.
+    memset(temp, 0, sizeof(temp));
+    for (i = 0; i < (Modulus::count - 1); ++i) {
+        carry = 0;
+        for (j = i + 1; j < Modulus::count; ++j) {
+            carry += ((dlimb_t)(x[i])) * x[j];
+            carry += temp[i + j];
+            temp[i + j] = (limb_t)carry;
+            carry >>= LIMB_BITS;
+        }
+        temp[i + Modulus::count] = (limb_t)carry;
+    }
+
+    // Double the cross products and add the squares x[i] * x[i].
+    limb_t high = 0;
+    carry = 0;
+    for (i = 0; i < Modulus::count; ++i) {
+        dlimb_t square = ((dlimb_t)(x[i])) * x[i];
+        limb_t word = temp[2 * i];
+        carry += (limb_t)square;
+        carry += (limb_t)((word << 1) | high);
+        high = word >> (LIMB_BITS - 1);
+        temp[2 * i] = (limb_t)carry;
+        carry >>= LIMB_BITS;
+        word = temp[2 * i + 1];
+        carry += (limb_t)(square >> LIMB_BITS);
+        carry += (limb_t)((word << 1) | high);
+        high = word >> (LIMB_BITS - 1);
+        temp[2 * i + 1] = (limb_t)carry;
+        carry >>= LIMB_BITS;
+    }
+
+    reduceMont<Modulus>(result, temp);
+    clean(temp);
+}
+
+/**
+ * \brief Performs Montgomery reduction of a double-length value.
+ *
+ * \param result The result x / R modulo the modulus, which must be
+ * Modulus::count limbs in size.  This can be the same array as \a x.
+ * \param x The value to reduce, which must be 2 * Modulus::count limbs
+ * in size.  It is modified by this function.
+ *
+ * The result is less than R for any \a x, and is fully reduced if \a x
+ * is less than R times the modulus.
+ *
+ * The execution time depends only upon the size of the modulus.
+ *
+ * \sa reduceMod()
+ */
+template <typename Modulus>
+void BigNumberUtil::reduceMont(limb_t *result, limb_t *x)
+{
+    const limb_t *m = Modulus::modulus();
+    limb_t overflow = 0;
+    dlimb_t carry;
+    size_t i, j;
+
+    // Add multiples of the modulus to clear the low limbs one by one.
+    for (i = 0; i < Modulus::count; ++i) {
+        limb_t u = (limb_t)(x[i] * Modulus::inverse);
+        carry = 0;
+        for (j = 0; j < Modulus::count; ++j) {
+            carry += ((dlimb_t)u) * pgm_read_limb(&(m[j]));
+            carry += x[i + j];
+            x[i + j] = (limb_t)carry;
+            carry >>= LIMB_BITS;
+        }
+        carry += x[i + Modulus::count];
+        carry += overflow;
+        x[i + Modulus::count] = (limb_t)carry;
+        overflow = (limb_t)(carry >> LIMB_BITS);
+    }
+
+    // The high half plus the overflow bit is less than twice the modulus.
+    // Subtract the modulus and keep the difference unless it went negative.
+    limb_t borrow = 0;
+    for (i = 0; i < Modulus::count; ++i) {
+        carry = ((dlimb_t)(x[i + Modulus::count])) -
+                pgm_read_limb(&(m[i])) - borrow;
+        result[i] = (limb_t)carry;
+        borrow = ((limb_t)(carry >> LIMB_BITS)) & 0x01;
+    }
+    limb_t mask = ((limb_t)0) - (borrow & (overflow ^ 0x01));
+    for (i = 0; i < Modulus::count; ++i) {
+        result[i] = (result[i] & ~mask) |
+                    (x[i + Modulus::count] & mask);
+    }
+}
+
+/**
+ * \brief Raises a value in Montgomery form to a power.
+ *
+ * \param result The result x^exponent in Montgomery form, which must be
+ * Modulus::count limbs in size and can be the same array as \a x.
+ * \param x The value to raise, Modulus::count limbs in size and less
+ * than the modulus.
+ * \param exponent The exponent, which must be non-zero.
+ * \param bits The number of bits in \a exponent.
+ *
+ * The exponent is processed from the highest bit down, BIGNUMBER_POW_WINDOW
+ * bits at a time.  The execution time depends on the exponent but not
+ * on \a x, so the exponent must not be secret.
+ *
+ * \sa recipMod()
+ */
+template <typename Modulus>
+void BigNumberUtil::powMont(limb_t *result, const limb_t *x,
+                            const limb_t *exponent, size_t bits)
+{
+    limb_t table[(1 << BIGNUMBER_POW_WINDOW) - 1][Modulus::count];
+    uint8_t index;
+
+    // Precompute x^1 to x^(2^w - 1).
+    memcpy(table[0], x, sizeof(table[0]));
+    for (index = 1; index < ((1 << BIGNUMBER_POW_WINDOW) - 1); ++index)
+        mulMont<Modulus>(table[index], table[index - 1], x);
+
+    // Square once for each bit and multiply in the power for each
+    // window, starting with the top window which may be partial.
+    uint8_t take = bits % BIGNUMBER_POW_WINDOW;
+    if (!take)
+        take = BIGNUMBER_POW_WINDOW;
+    bool started = false;
+    while (bits > 0) {
+        uint8_t digit = 0;
+        for (index = 0; index < take; ++index) {
+            --bits;
+            digit = (digit << 1) |
+                ((exponent[bits / LIMB_BITS] >> (bits % LIMB_BITS)) & 0x01);
+            if (started)
+                squareMont<Modulus>(result, result);
+        }
+        if (digit && started) {
+            mulMont<Modulus>(result, result, table[digit - 1]);
+        } else if (digit) {
+            memcpy(result, table[digit - 1], sizeof(table[0]));
+            started = true;
+        }
+        take = BIGNUMBER_POW_WINDOW;
+    }
+
+    clean(table);
+}
+
+/**
+ * \brief Reduces a double-length value modulo the modulus.
+ *
+ * \param result The result, which must be Modulus::count limbs in size.
+ * This can be the same array as \a x.
+ * \param x The value to reduce, which must be 2 * Modulus::count limbs
+ * in size.  It is modified by this function.
+ *
+ * Any value of \a x is allowed.  The execution time depends only upon
+ * the size of the modulus.
+ *
+ * \sa mulMod()
+ */
+template <typename Modulus>
+void BigNumberUtil::reduceMod(limb_t *result, limb_t *x)
+{
+    // (x / R) * R^2 / R = x.
+    limb_t r2[Modulus::count];
+    memcpy_P(r2, Modulus::r2(), sizeof(r2));
+    reduceMont<Modulus>(result, x);
+    mulMont<Modulus>(result, result, r2);
+}
+
+/**
+ * \brief Multiplies two values modulo the modulus.
+ *
+ * \param result The result, which must be Modulus::count limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value to multiply, Modulus::count limbs in size
+ * and less than the modulus.
+ * \param y The second value to multiply, Modulus::count limbs in size
+ * and less than the modulus.
+ *
+ * \sa reduceMod()
+ */
+template <typename Modulus>
+void BigNumberUtil::mulMod(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    // ((x * y) / R) * R^2 / R = x * y.
+    limb_t r2[Modulus::count];
+    memcpy_P(r2, Modulus::r2(), sizeof(r2));
+    mulMont<Modulus>(result, x, y);
+    mulMont<Modulus>(result, result, r2);
+}
+
+/**
+ * \brief Computes the reciprocal of a value modulo a prime modulus.
+ *
+ * \param result The result, which must be Modulus::count limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to compute the reciprocal for, Modulus::count limbs
+ * in size and less than the modulus.
+ *
+ * The reciprocal is computed as x^(modulus - 2) using Fermat's little
+ * theorem, so the modulus must be prime.  The execution time does not
+ * depend upon \a x.  If \a x is zero, then the result is zero.
+ */
+template <typename Modulus>
+void BigNumberUtil::recipMod(limb_t *result, const limb_t *x)
+{
+    limb_t exponent[Modulus::count];
+    limb_t temp[2 * Modulus::count];
+    const limb_t *m = Modulus::modulus();
+    limb_t borrow = 2;
+    dlimb_t carry;
+    size_t i;
+
+    // Compute the exponent modulus - 2.
+    for (i = 0; i < Modulus::count; ++i) {
+        carry = ((dlimb_t)pgm_read_limb(&(m[i]))) - borrow;
+        exponent[i] = (limb_t)carry;
+        borrow = ((limb_t)(carry >> LIMB_BITS)) & 0x01;
+    }
+
+    // Convert x into Montgomery form, raise it to the power, and then
+    // convert back by reducing the result as a double-length value.
+    memcpy_P(temp, Modulus::r2(), sizeof(limb_t) * Modulus::count);
+    mulMont<Modulus>(temp, x, temp);
+    powMont<Modulus>(temp, temp, exponent, Modulus::count * LIMB_BITS);
+    memset(temp + Modulus::count, 0, sizeof(limb_t) * Modulus::count);
+    reduceMont<Modulus>(result, temp);
+
+    clean(exponent);
+    clean(temp);
+}
+
+#endif
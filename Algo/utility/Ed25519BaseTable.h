@@ -0,0 +1,3023 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef CRYPTO_ED25519BASETABLE_H
+#define CRYPTO_ED25519BASETABLE_H
+
+// Precomputed multiples of the Ed25519 base point B, included by
+// Ed25519.cpp only.  Every point is in affine form as
+// (y + x, y - x, 2 * d * x * y) with each value fully reduced modulo p.
+//
+// baseTable is used by Ed25519::mul(): row i holds 1 * 16^k * B to
+// 8 * 16^k * B for k = i * ED25519_BASE_TABLE_SPACING.  Rows for the other
+// values of k are left out of the build.
+//
+// baseOddTable holds the odd multiples 1 * B to 63 * B for the width-7
+// NAF in Ed25519::mulDouble().
+//
+// Generated by extras/host/Ed25519BaseTableGen.cpp from the curve
+// parameters in RFC 8032; do not edit by hand.
+
+static limb_t const baseTable[64 / ED25519_BASE_TABLE_SPACING][8][3 * NUM_LIMBS_256BIT] PROGMEM = {
+#if (0 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^0 * B
+            LIMB_PAIR(0xF58C3B85, 0x2FBC93C6), LIMB_PAIR(0xFB8C0E19, 0xCF932DC6), LIMB_PAIR(0x643D42C2, 0x270B4898), LIMB_PAIR(0x33D4BA65, 0x07CF9D3A),
+            LIMB_PAIR(0xD740913E, 0x9D103905), LIMB_PAIR(0xD140BEB3, 0xFD399F05), LIMB_PAIR(0x688F8A09, 0xA5C18434), LIMB_PAIR(0x98F81267, 0x44FD2F92),
+            LIMB_PAIR(0x877AAA68, 0xABC91205), LIMB_PAIR(0xCCAAC49E, 0x26D9E823), LIMB_PAIR(0xDD43598C, 0x5A1B7DCB), LIMB_PAIR(0x9F0C65A8, 0x6F117B68)
+        },
+        {   // 2 * 16^0 * B
+            LIMB_PAIR(0x933C71D7, 0x9224E7FC), LIMB_PAIR(0x7A0FF5B5, 0x9F469D96), LIMB_PAIR(0xE1D60702, 0x5AA69A65), LIMB_PAIR(0xA87D2E2E, 0x590C063F),
+            LIMB_PAIR(0x42B4D5A8, 0x8A99A560), LIMB_PAIR(0x4E60ACF6, 0x8F2B810C), LIMB_PAIR(0xB16E37AA, 0xE09E236B), LIMB_PAIR(0x69C92555, 0x6BB595A6),
+            LIMB_PAIR(0xA59B7A5F, 0x43FAA8B3), LIMB_PAIR(0x5D9ACF78, 0x36C16BDD), LIMB_PAIR(0x0B3D6A31, 0x500FA084), LIMB_PAIR(0x3EA50B73, 0x701AF5B1)
+        },
+        {   // 3 * 16^0 * B
+            LIMB_PAIR(0x4CEE9730, 0xAF25B0A8), LIMB_PAIR(0xE8864B8A, 0x025A8430), LIMB_PAIR(0x9F016732, 0xC11B5002), LIMB_PAIR(0x9A80F8F4, 0x7A164E1B),
+            LIMB_PAIR(0xA4FCD265, 0x56611FE8), LIMB_PAIR(0xE5C1BA7D, 0x3BD353FD), LIMB_PAIR(0x214BD6BD, 0x8131F31A), LIMB_PAIR(0x555BDA62, 0x2AB91587),
+            LIMB_PAIR(0x0DD0D889, 0x14AE933F), LIMB_PAIR(0x1C35DA62, 0x58942322), LIMB_PAIR(0x8CF2DB4C, 0xD170E545), LIMB_PAIR(0x12B9B4C6, 0x5A2826AF)
+        },
+        {   // 4 * 16^0 * B
+            LIMB_PAIR(0x8EFC099F, 0x287351B9), LIMB_PAIR(0x7DFD2538, 0x6765C6F4), LIMB_PAIR(0xFB0A9265, 0xCA348D3D), LIMB_PAIR(0x21E58727, 0x680E9103),
+            LIMB_PAIR(0x056818BF, 0x95FE050A), LIMB_PAIR(0x5660FAA9, 0x327E8971), LIMB_PAIR(0x06A05073, 0xC3E8E3CD), LIMB_PAIR(0x7445A49A, 0x27933F4C),
+            LIMB_PAIR(0xC476FF09, 0x5A13FBE9), LIMB_PAIR(0x7B5CC172, 0x6E9E3945), LIMB_PAIR(0x102B4494, 0x5DDBDCF9), LIMB_PAIR(0x63553E2B, 0x7F9D0CBF)
+        },
+        {   // 5 * 16^0 * B
+            LIMB_PAIR(0x08A5BB33, 0xA212BC44), LIMB_PAIR(0xC75EED02, 0x8D5048C3), LIMB_PAIR(0x5ABFEC44, 0xDD1BEB0C), LIMB_PAIR(0x46E206EB, 0x2945CCF1),
+            LIMB_PAIR(0xA447D6BA, 0x7F9182C3), LIMB_PAIR(0x4B2729B7, 0xD50014D1), LIMB_PAIR(0xB864A087, 0xE33CF11C), LIMB_PAIR(0xEB1B55F3, 0x154A7E73),
+            LIMB_PAIR(0x812A8285, 0xBCBBDBF1), LIMB_PAIR(0xD0BDD1FC, 0x270E0807), LIMB_PAIR(0x1BBDA72D, 0xB41B670B), LIMB_PAIR(0x6B3BB69A, 0x43AABE69)
+        },
+        {   // 6 * 16^0 * B
+            LIMB_PAIR(0x77157131, 0x3A0CEEEB), LIMB_PAIR(0x00C8AF88, 0x9B271589), LIMB_PAIR(0xDA59A736, 0x8065B668), LIMB_PAIR(0xA2CC38BD, 0x51E57BB6),
+            LIMB_PAIR(0x7B7D8CA4, 0x499806B6), LIMB_PAIR(0x27D22739, 0x575BE284), LIMB_PAIR(0x204553B9, 0xBB085CE7), LIMB_PAIR(0xAE417884, 0x38B64C41),
+            LIMB_PAIR(0x02EA4B71, 0x85AC3267), LIMB_PAIR(0x41A1BB01, 0xBE70E003), LIMB_PAIR(0x083BC144, 0x53E4A24B), LIMB_PAIR(0x9F0D61E3, 0x10B8E91A)
+        },
+        {   // 7 * 16^0 * B
+            LIMB_PAIR(0x944EA3BF, 0x6B1A5CD0), LIMB_PAIR(0xB39DC0D2, 0x7470353A), LIMB_PAIR(0x28542E49, 0x71B25282), LIMB_PAIR(0x283C927E, 0x461BEA69),
+            LIMB_PAIR(0xAA3221B1, 0xBA6F2C9A), LIMB_PAIR(0x3BBA23A7, 0x6CA02153), LIMB_PAIR(0x92192C3A, 0x9DEA764F), LIMB_PAIR(0x2E5317E0, 0x1D6EDD5D),
+            LIMB_PAIR(0x01B8B3A2, 0xF1836DC8), LIMB_PAIR(0x053EA49A, 0xB3035F47), LIMB_PAIR(0x5877ADF3, 0x529C41BA), LIMB_PAIR(0x6A0F90A7, 0x7A9FBB1C)
+        },
+        {   // 8 * 16^0 * B
+            LIMB_PAIR(0x04DD3E8F, 0x59B75966), LIMB_PAIR(0xE288702C, 0x6CB30377), LIMB_PAIR(0x5ED9C323, 0xB1339C66), LIMB_PAIR(0x61BCE52F, 0x0915E760),
+            LIMB_PAIR(0xF39234D9, 0xE2A75DED), LIMB_PAIR(0xE1B558F9, 0x963D7680), LIMB_PAIR(0x6E3C23FB, 0x2C2741AC), LIMB_PAIR(0x320E01C3, 0x3A9024A1),
+            LIMB_PAIR(0xC9A2911A, 0xE7C1F5D9), LIMB_PAIR(0x8BCCA7D7, 0xB8A37178), LIMB_PAIR(0x0EB62A32, 0x63641219), LIMB_PAIR(0x2ECC4E95, 0x26907C5C)
+        }
+    },
+#endif
+#if (1 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^1 * B
+            LIMB_PAIR(0x2D9021F6, 0x322D04A5), LIMB_PAIR(0x75C6BF9C, 0xB9C19F33), LIMB_PAIR(0x42D20B09, 0x587A3A43), LIMB_PAIR(0xAA64FE61, 0x143B1CF8),
+            LIMB_PAIR(0x553E2DF3, 0x7EC851CA), LIMB_PAIR(0xA64878B3, 0xA71284CB), LIMB_PAIR(0x3288D1E7, 0xE6B5E419), LIMB_PAIR(0x5A9A8883, 0x4CF210EC),
+            LIMB_PAIR(0x968ACAAB, 0x9F867C7D), LIMB_PAIR(0x27092729, 0x5F54258E), LIMB_PAIR(0xEA180975, 0xD0A7D34B), LIMB_PAIR(0x374126E1, 0x21B546A3)
+        },
+        {   // 2 * 16^1 * B
+            LIMB_PAIR(0xD185218F, 0x490A7A45), LIMB_PAIR(0x46049335, 0x9A153778), LIMB_PAIR(0xCC31E1F6, 0x0060EA09), LIMB_PAIR(0xF86EE965, 0x7E041577),
+            LIMB_PAIR(0xA2888343, 0xA94FF858), LIMB_PAIR(0x5313ED3C, 0xCE0ED456), LIMB_PAIR(0xB5BF34FA, 0xF55C3DCF), LIMB_PAIR(0xC9EAB371, 0x0A653CA5),
+            LIMB_PAIR(0xCE5B67F3, 0x66B2A496), LIMB_PAIR(0xBD569796, 0xFF5492D8), LIMB_PAIR(0x4A592CD0, 0x503CEC29), LIMB_PAIR(0x0813ACB2, 0x56694365)
+        },
+        {   // 3 * 16^1 * B
+            LIMB_PAIR(0x1DABB69D, 0x5672F9EB), LIMB_PAIR(0xAFE853FC, 0xBA70B535), LIMB_PAIR(0x2796D66D, 0x47AC0F75), LIMB_PAIR(0x94117275, 0x32A53517),
+            LIMB_PAIR(0x26620798, 0xB818DB0C), LIMB_PAIR(0x606E354A, 0x5D5C31D9), LIMB_PAIR(0x00A8CDC7, 0x0982FA4F), LIMB_PAIR(0x4653E2D4, 0x17E12BCD),
+            LIMB_PAIR(0xDF648437, 0xD3A644A6), LIMB_PAIR(0x880FBFDD, 0x703B6559), LIMB_PAIR(0xAD3A1AA5, 0xCB852540), LIMB_PAIR(0x8E4C6468, 0x0900B3F7)
+        },
+        {   // 4 * 16^1 * B
+            LIMB_PAIR(0xC816AD31, 0xED280FBE), LIMB_PAIR(0xD8E6EFE3, 0x52D9595B), LIMB_PAIR(0xF6C623F5, 0x0FE71772), LIMB_PAIR(0x051E293C, 0x4314030B),
+            LIMB_PAIR(0x679D651B, 0x0A851B9F), LIMB_PAIR(0x033342F2, 0xE108CB61), LIMB_PAIR(0xE88B30A3, 0xD601F57F), LIMB_PAIR(0xED2DD714, 0x371F3ACA),
+            LIMB_PAIR(0xFBF0BCAD, 0xD560005E), LIMB_PAIR(0xD1870C5E, 0x8EB70F2E), LIMB_PAIR(0xD084E6A0, 0x201F9033), LIMB_PAIR(0xCE7B6670, 0x4C3A5AE1)
+        },
+        {   // 5 * 16^1 * B
+            LIMB_PAIR(0xC93DA0DD, 0xBAF875E4), LIMB_PAIR(0x71B9294D, 0xB93282A7), LIMB_PAIR(0xF4C6C460, 0x80D63FB7), LIMB_PAIR(0xEA66C181, 0x6DE9C73D),
+            LIMB_PAIR(0xDCB8FA95, 0x4138A434), LIMB_PAIR(0x6C96840B, 0x870CF67D), LIMB_PAIR(0x297BE82C, 0xDE388574), LIMB_PAIR(0x7262A55A, 0x7C814DB2),
+            LIMB_PAIR(0xA04DF8F2, 0x478904D5), LIMB_PAIR(0xB10142D3, 0xFAFBAE4A), LIMB_PAIR(0x555D0998, 0xF6C8AC63), LIMB_PAIR(0x2F90B104, 0x5AAC4A41)
+        },
+        {   // 6 * 16^1 * B
+            LIMB_PAIR(0xBD7F5134, 0x603A0D0A), LIMB_PAIR(0xE1D3AE46, 0x8089C932), LIMB_PAIR(0x8798BD63, 0xDF259139), LIMB_PAIR(0x74BA0235, 0x1C145CD2),
+            LIMB_PAIR(0x3AC92908, 0xC64F326B), LIMB_PAIR(0xE663E1E0, 0x5551B282), LIMB_PAIR(0x4A1A4B83, 0x476B35F5), LIMB_PAIR(0x189F68C2, 0x1B9DA3FE),
+            LIMB_PAIR(0x75F3D743, 0x32E83864), LIMB_PAIR(0x6AE5D9EF, 0x365B8BAF), LIMB_PAIR(0x385B681E, 0x825238B6), LIMB_PAIR(0x167D65E1, 0x234929C1)
+        },
+        {   // 7 * 16^1 * B
+            LIMB_PAIR(0x1D099FCF, 0x48145CC2), LIMB_PAIR(0xCC28D7E5, 0x4535C192), LIMB_PAIR(0x48247E01, 0x80E7C1E5), LIMB_PAIR(0x3B2973EE, 0x4A5F2874),
+            LIMB_PAIR(0xA077ADE8, 0x984DECAB), LIMB_PAIR(0x19EB389D, 0x383F77AD), LIMB_PAIR(0x2954D794, 0xC7EC6B7E), LIMB_PAIR(0xEB7C3A7A, 0x59C77B3A),
+            LIMB_PAIR(0x225CCF62, 0xD3ADD725), LIMB_PAIR(0xB2152C5D, 0x911A3381), LIMB_PAIR(0x5B08F87D, 0xD8B39FAD), LIMB_PAIR(0x4799FE3B, 0x6F05606B)
+        },
+        {   // 8 * 16^1 * B
+            LIMB_PAIR(0xF91B6483, 0x5B433149), LIMB_PAIR(0x5A2CBF62, 0xADB5DC65), LIMB_PAIR(0x632827B3, 0x87FA8412), LIMB_PAIR(0xAB49F8D8, 0x60895E91),
+            LIMB_PAIR(0x177BA962, 0x9FFE9E92), LIMB_PAIR(0x0DE5CAE1, 0x98AEE71D), LIMB_PAIR(0x2D831044, 0x3FF4AE94), LIMB_PAIR(0x58533AC8, 0x714DE12E),
+            LIMB_PAIR(0x0CF86C18, 0xE9ECF2ED), LIMB_PAIR(0x0735DFD4, 0xB46D0612), LIMB_PAIR(0x04B96BE7, 0xBC9DA098), LIMB_PAIR(0xD96DC26B, 0x73E2E62F)
+        }
+    },
+#endif
+#if (2 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^2 * B
+            LIMB_PAIR(0x632F9C1D, 0x2ECCDD0E), LIMB_PAIR(0x76893115, 0x51D0B696), LIMB_PAIR(0xA8637A58, 0x52DFB76B), LIMB_PAIR(0xA00EEF39, 0x6DD37D49),
+            LIMB_PAIR(0x49AA515E, 0xED5B6354), LIMB_PAIR(0x0BC6823A, 0xA865C49F), LIMB_PAIR(0x5B42D1C4, 0x850C1FE9), LIMB_PAIR(0x03D315B9, 0x30D76D6F),
+            LIMB_PAIR(0x2106E4C7, 0x6C444417), LIMB_PAIR(0x928D7F69, 0xFB53D680), LIMB_PAIR(0x694D3F26, 0xB4739EA4), LIMB_PAIR(0x2E864BB0, 0x10C69711)
+        },
+        {   // 2 * 16^2 * B
+            LIMB_PAIR(0x8358C805, 0x0CA62AA0), LIMB_PAIR(0x7A204247, 0x6A3D4AE3), LIMB_PAIR(0x3B11EDDC, 0x7464D3A6), LIMB_PAIR(0x550806EF, 0x03BF9BAF),
+            LIMB_PAIR(0x7DBE5FDE, 0x6493C427), LIMB_PAIR(0x19AD7EA2, 0x265D4FAD), LIMB_PAIR(0x46304590, 0x0E00DFC8), LIMB_PAIR(0xED66FE09, 0x25E61CAB),
+            LIMB_PAIR(0xCC586604, 0x3F13E128), LIMB_PAIR(0xB459747E, 0x6F5873EC), LIMB_PAIR(0xCC1268F5, 0xA0B63DED), LIMB_PAIR(0x4586E22C, 0x566D7863)
+        },
+        {   // 3 * 16^2 * B
+            LIMB_PAIR(0xC65A2FD0, 0xA1054285), LIMB_PAIR(0xF31667C3, 0x6C64112A), LIMB_PAIR(0x731AEE58, 0x680AE240), LIMB_PAIR(0x4793B22A, 0x14FBA5F3),
+            LIMB_PAIR(0x9CC10834, 0x1637A49F), LIMB_PAIR(0xA89BC451, 0xBC8E56D5), LIMB_PAIR(0x7F7FD2DB, 0x1CB5EC0F), LIMB_PAIR(0x5ECC35D9, 0x33975BCA),
+            LIMB_PAIR(0x6985F7D4, 0x3CD74616), LIMB_PAIR(0xC9C80057, 0x593E5E84), LIMB_PAIR(0x7B61131E, 0x2FC3F2B6), LIMB_PAIR(0x83FC526C, 0x14829CEA)
+        },
+        {   // 4 * 16^2 * B
+            LIMB_PAIR(0x4E71ECB8, 0x21E70B2F), LIMB_PAIR(0x40A477E3, 0xE656DDB9), LIMB_PAIR(0xCE1D4F80, 0xBF6556CE), LIMB_PAIR(0x535D7B7E, 0x05FC3BC4),
+            LIMB_PAIR(0x97DD95C2, 0xFF437B84), LIMB_PAIR(0xAA4EB5A7, 0x6C744E30), LIMB_PAIR(0x3C85E88B, 0x9E0C5D61), LIMB_PAIR(0x5F758173, 0x2FD9C71E),
+            LIMB_PAIR(0x52AFDEDD, 0x24B8B3AE), LIMB_PAIR(0xED3B30CF, 0x3495638C), LIMB_PAIR(0xA9BE8195, 0x33A4BC83), LIMB_PAIR(0x5C651F04, 0x37376747)
+        },
+        {   // 5 * 16^2 * B
+            LIMB_PAIR(0x14246590, 0x634095CB), LIMB_PAIR(0x16C15535, 0xEF121440), LIMB_PAIR(0x8910BC60, 0x9E38140C), LIMB_PAIR(0x30907C8C, 0x6BF59057),
+            LIMB_PAIR(0x40D1ADD9, 0x2FBA99FD), LIMB_PAIR(0x96F4D027, 0xB307166F), LIMB_PAIR(0x15F03BAE, 0x4363F052), LIMB_PAIR(0x3B18F999, 0x1FBEA56C),
+            LIMB_PAIR(0xE1415B8A, 0x0FA778F1), LIMB_PAIR(0xBAC3A77E, 0x06409FF7), LIMB_PAIR(0x9AA29A50, 0x6F52D7B8), LIMB_PAIR(0x7A635A56, 0x02521CF6)
+        },
+        {   // 6 * 16^2 * B
+            LIMB_PAIR(0x772F5EE4, 0xB1146720), LIMB_PAIR(0x96079ACE, 0xE8F894B1), LIMB_PAIR(0x00AC824A, 0x4AF8224D), LIMB_PAIR(0xF7CD6CC4, 0x001753D9),
+            LIMB_PAIR(0x0A9D5294, 0x513FEE0B), LIMB_PAIR(0x0FDF5A66, 0x8F98E75C), LIMB_PAIR(0xBFE107CE, 0xD4618688), LIMB_PAIR(0x71382CED, 0x3FA00A7E),
+            LIMB_PAIR(0x963DDB34, 0x3C69232D), LIMB_PAIR(0xB4973858, 0x1DDE87DA), LIMB_PAIR(0xA091F285, 0xAAD7D1F9), LIMB_PAIR(0xA048EDB6, 0x12B5FE2F)
+        },
+        {   // 7 * 16^2 * B
+            LIMB_PAIR(0xAD6F1E92, 0xDF2B7C26), LIMB_PAIR(0x504B8913, 0x4B66D323), LIMB_PAIR(0x751C8BC3, 0x8C409DC0), LIMB_PAIR(0x0796C7B8, 0x6F7E93C2),
+            LIMB_PAIR(0x96FCE34D, 0x71F0FBC4), LIMB_PAIR(0xADF35BED, 0x73B9826B), LIMB_PAIR(0xFF28C561, 0xD2047261), LIMB_PAIR(0x6FB1206F, 0x749B76F9),
+            LIMB_PAIR(0xAEA6AE05, 0x1F5AF604), LIMB_PAIR(0xBEE49C99, 0xC12351F1), LIMB_PAIR(0xEEFF6B66, 0x61A808B5), LIMB_PAIR(0x01E02151, 0x0FCEC10F)
+        },
+        {   // 8 * 16^2 * B
+            LIMB_PAIR(0xC4244E45, 0x3DF2D29D), LIMB_PAIR(0x93D8DE0A, 0x2B020E74), LIMB_PAIR(0x820C214D, 0x6CC8067E), LIMB_PAIR(0x6FEAB90A, 0x41377916),
+            LIMB_PAIR(0x49FE1E44, 0x644D58A6), LIMB_PAIR(0x31AD777E, 0x21FCAEA2), LIMB_PAIR(0x887FD0D2, 0x02441C5A), LIMB_PAIR(0x83C511F3, 0x4901AA71),
+            LIMB_PAIR(0x8C1AF8F0, 0x08B1B754), LIMB_PAIR(0x246299B4, 0xCE0F7A7C), LIMB_PAIR(0x1E06D939, 0xF760B0F9), LIMB_PAIR(0x726D1213, 0x41BB887B)
+        }
+    },
+#endif
+#if (3 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^3 * B
+            LIMB_PAIR(0xAA39F7D2, 0x97D980E0), LIMB_PAIR(0x52C6B51C, 0x35D03842), LIMB_PAIR(0x07CD55AA, 0x7D43F493), LIMB_PAIR(0xB78AC362, 0x56BD36CF),
+            LIMB_PAIR(0x567C49D8, 0x9267806C), LIMB_PAIR(0xCA791E6A, 0x066D04CC), LIMB_PAIR(0xE3CC394B, 0xA69F5645), LIMB_PAIR(0xA0788CD2, 0x5C95B686),
+            LIMB_PAIR(0x0D14A954, 0x2AC519C1), LIMB_PAIR(0x94B5FA90, 0xEAF474B4), LIMB_PAIR(0xA9F87A5A, 0xE6AF8382), LIMB_PAIR(0x879BE094, 0x0DEA6DB1)
+        },
+        {   // 2 * 16^3 * B
+            LIMB_PAIR(0xD6A8797A, 0x15BAEB74), LIMB_PAIR(0xFAC41732, 0x7EF55CF1), LIMB_PAIR(0x3C8B05C5, 0x29001F5A), LIMB_PAIR(0x52EACCFB, 0x0AD7CC87),
+            LIMB_PAIR(0x7344E5AB, 0xAA66BF54), LIMB_PAIR(0x8F1B4309, 0xDA125888), LIMB_PAIR(0xFD564B2F, 0x5E87D2B3), LIMB_PAIR(0x5483B1DD, 0x5B2C7888),
+            LIMB_PAIR(0x793408CF, 0x52151362), LIMB_PAIR(0x19963D94, 0xEB0F1703), LIMB_PAIR(0x883D9466, 0xA833B2FA), LIMB_PAIR(0x75003C78, 0x093A7FA7)
+        },
+        {   // 3 * 16^3 * B
+            LIMB_PAIR(0x60A91286, 0xB8E96044), LIMB_PAIR(0x7778D3DE, 0x7F3FD804), LIMB_PAIR(0xBF8A5E2D, 0x67D01E31), LIMB_PAIR(0xC27B653E, 0x7B038A06),
+            LIMB_PAIR(0x3A16D7BE, 0xE5107DE6), LIMB_PAIR(0x9AF332CF, 0xA377FFDC), LIMB_PAIR(0x440B677F, 0x70D5BF18), LIMB_PAIR(0xA4A31403, 0x6A252B19),
+            LIMB_PAIR(0xD36990F3, 0x9ED919D5), LIMB_PAIR(0xDB4EB9F2, 0x5213AEBB), LIMB_PAIR(0x4CB99135, 0xC708EA05), LIMB_PAIR(0x72260E56, 0x58DED57F)
+        },
+        {   // 4 * 16^3 * B
+            LIMB_PAIR(0x5B0FD48B, 0xDA6D5326), LIMB_PAIR(0x93BFA988, 0x89608231), LIMB_PAIR(0x61D57E28, 0xD78AC932), LIMB_PAIR(0x3A5C8143, 0x79F2942D),
+            LIMB_PAIR(0xE9413D77, 0x78E79DAD), LIMB_PAIR(0x9729E67D, 0xF257F9D5), LIMB_PAIR(0xE37AA7E6, 0x59DB910E), LIMB_PAIR(0xBB9E039C, 0x6AA11B5B),
+            LIMB_PAIR(0xB6C88DE9, 0x97DA2F25), LIMB_PAIR(0xACF20169, 0x251BA7EA), LIMB_PAIR(0xEF4EB4E4, 0x09B44F87), LIMB_PAIR(0xBC6A7DA5, 0x7D90AB1B)
+        },
+        {   // 5 * 16^3 * B
+            LIMB_PAIR(0x96B3C397, 0x1A07A3F4), LIMB_PAIR(0x8F4E2532, 0x11CEAA18), LIMB_PAIR(0xA7751BF0, 0x7D9498D5), LIMB_PAIR(0x508DD8A0, 0x19ED161F),
+            LIMB_PAIR(0xA7016BFE, 0x9ACCA683), LIMB_PAIR(0xF2C50B6D, 0x90505F4D), LIMB_PAIR(0xCCE435AA, 0x6B610D5F), LIMB_PAIR(0x6198FF96, 0x19A10D44),
+            LIMB_PAIR(0x87DCE6CA, 0x560A2CD6), LIMB_PAIR(0x8664CF4D, 0x7F3568C4), LIMB_PAIR(0x22803A38, 0x8741E952), LIMB_PAIR(0x595653FC, 0x483BDAB1)
+        },
+        {   // 6 * 16^3 * B
+            LIMB_PAIR(0xB4DA80F6, 0xD6CF4D0A), LIMB_PAIR(0xF8307FE0, 0x82483E45), LIMB_PAIR(0xAE6F9DA4, 0x05005269), LIMB_PAIR(0x9CF7877A, 0x1C705290),
+            LIMB_PAIR(0x8734FA49, 0xFA780F14), LIMB_PAIR(0x360534E0, 0x106F0B70), LIMB_PAIR(0xE3E307BD, 0x2210776F), LIMB_PAIR(0xDDE6A0FE, 0x3286C109),
+            LIMB_PAIR(0x874E98D4, 0x32EE7DE2), LIMB_PAIR(0xB97E0C60, 0x14C362E9), LIMB_PAIR(0x6A60A38A, 0x5781DCDE), LIMB_PAIR(0xAA7AA840, 0x217DD5EA)
+        },
+        {   // 7 * 16^3 * B
+            LIMB_PAIR(0xBE8C0EC8, 0x8BDF1FB9), LIMB_PAIR(0xE30A0282, 0x00BAE7F8), LIMB_PAIR(0xAD6C4F6C, 0x4963991D), LIMB_PAIR(0x5DF6F60A, 0x07058A6E),
+            LIMB_PAIR(0x248E1EB0, 0x9DB7C4D0), LIMB_PAIR(0x4D74BF52, 0xE07697E1), LIMB_PAIR(0x3C562354, 0x1E6A9B17), LIMB_PAIR(0x795A4965, 0x7FA7C21F),
+            LIMB_PAIR(0xDB31F67F, 0xE9EB02C4), LIMB_PAIR(0x10BCFB2B, 0xED25FD89), LIMB_PAIR(0x5C5CDDB4, 0x46C8131F), LIMB_PAIR(0xA0CB9BCE, 0x33B21C13)
+        },
+        {   // 8 * 16^3 * B
+            LIMB_PAIR(0x5EE38C5B, 0x9AAFB9B0), LIMB_PAIR(0x071A13C7, 0xBF9D2D4E), LIMB_PAIR(0xE933290A, 0x8EEE6E6D), LIMB_PAIR(0xAE109717, 0x1C3BAB17),
+            LIMB_PAIR(0x087D8E31, 0x360692F8), LIMB_PAIR(0xD27163F7, 0xF4DCC637), LIMB_PAIR(0x65EA5963, 0x25A4E620), LIMB_PAIR(0x5AC160D9, 0x659BF72E),
+            LIMB_PAIR(0xC7CAB7B0, 0x1C9AB216), LIMB_PAIR(0x07BBC3CC, 0x7D65D374), LIMB_PAIR(0x504A58D5, 0x52744750), LIMB_PAIR(0x131A2990, 0x09F2606B)
+        }
+    },
+#endif
+#if (4 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^4 * B
+            LIMB_PAIR(0x7C6691AE, 0x7E234C59), LIMB_PAIR(0x0A85B4C8, 0x64889D3D), LIMB_PAIR(0x354AFAE7, 0xDAE2C90C), LIMB_PAIR(0x0C6A9E1D, 0x0A871E07),
+            LIMB_PAIR(0x744346BE, 0x40E87D44), LIMB_PAIR(0x15B52B25, 0x1D48DAD4), LIMB_PAIR(0xA13B603E, 0x7C3A8A18), LIMB_PAIR(0x2FCDBDF7, 0x4EB728C1),
+            LIMB_PAIR(0x4BBC8989, 0x3301B599), LIMB_PAIR(0x5BDD4260, 0x736BAE3A), LIMB_PAIR(0x19D59E3C, 0x0D61ADE2), LIMB_PAIR(0x2685D464, 0x3EE7300F)
+        },
+        {   // 2 * 16^4 * B
+            LIMB_PAIR(0x841E7518, 0x43FA7947), LIMB_PAIR(0x639C46D7, 0xE5C6FA59), LIMB_PAIR(0xE3052B74, 0xA1065E1D), LIMB_PAIR(0xCFB89030, 0x7D47C6A2),
+            LIMB_PAIR(0x9E7DD6B7, 0xF5D255E4), LIMB_PAIR(0x610B1EAC, 0x8016115C), LIMB_PAIR(0x92E187CA, 0x3C99975D), LIMB_PAIR(0x979125C2, 0x13815762),
+            LIMB_PAIR(0x8EF0D6E0, 0x3FDAD014), LIMB_PAIR(0x91546F3C, 0x9D3E749A), LIMB_PAIR(0x26BB8157, 0x71EC6210), LIMB_PAIR(0x34C9EC80, 0x148CF58D)
+        },
+        {   // 3 * 16^4 * B
+            LIMB_PAIR(0x9AE4756D, 0xE2572F7D), LIMB_PAIR(0x88F3487F, 0x56C345BB), LIMB_PAIR(0x6960A88D, 0x9FD10B6D), LIMB_PAIR(0x4EAEA1B9, 0x278FEBAD),
+            LIMB_PAIR(0x7934F027, 0x46A492F6), LIMB_PAIR(0xF6840AA9, 0x469984BE), LIMB_PAIR(0x89611854, 0x5CA1BC2A), LIMB_PAIR(0xBD5DBBD4, 0x3FF2FA1E),
+            LIMB_PAIR(0x8C933966, 0xB1AA681F), LIMB_PAIR(0x20290C98, 0x8C21949C), LIMB_PAIR(0x219D3C52, 0x39115291), LIMB_PAIR(0xFE9C677B, 0x4104DD02)
+        },
+        {   // 4 * 16^4 * B
+            LIMB_PAIR(0xDB096AB8, 0x81214E06), LIMB_PAIR(0x0CE44F35, 0x21A8B6C9), LIMB_PAIR(0x409E2AF5, 0x6524C12A), LIMB_PAIR(0x8EFCA481, 0x0165B5A4),
+            LIMB_PAIR(0x1124422A, 0x72B2BF5E), LIMB_PAIR(0x98A33AB5, 0xA1FA0C33), LIMB_PAIR(0xFA52B666, 0x94CB6101), LIMB_PAIR(0xAFAF53D5, 0x2C863B00),
+            LIMB_PAIR(0xA0846A76, 0xF190A474), LIMB_PAIR(0xCD2F7CC0, 0x12EFF984), LIMB_PAIR(0x58AA2B8F, 0x695E2906), LIMB_PAIR(0xBFFEC8B8, 0x591B67D9)
+        },
+        {   // 5 * 16^4 * B
+            LIMB_PAIR(0x9F18B55D, 0x99B9B371), LIMB_PAIR(0xA18C641E, 0xE465E5FA), LIMB_PAIR(0xC29F05ED, 0x61081136), LIMB_PAIR(0x7030128B, 0x489B4F86),
+            LIMB_PAIR(0x80B49BFA, 0x312F0D1C), LIMB_PAIR(0xABF3EC8A, 0x5979515E), LIMB_PAIR(0x9EF01C88, 0x727033C0), LIMB_PAIR(0xCA8F7BCB, 0x3DE02EC7),
+            LIMB_PAIR(0x3AEB92EF, 0xD232102D), LIMB_PAIR(0x6116A861, 0xE16253B4), LIMB_PAIR(0x190BAA24, 0x3D7EABE7), LIMB_PAIR(0x496CBEBF, 0x49F5FBBA)
+        },
+        {   // 6 * 16^4 * B
+            LIMB_PAIR(0x1E9C572E, 0x155D628C), LIMB_PAIR(0xC5884741, 0x8A4D86AC), LIMB_PAIR(0x515763EB, 0x91A352F6), LIMB_PAIR(0x8867515B, 0x06A1A6C2),
+            LIMB_PAIR(0x8A5BCFD4, 0x30949A10), LIMB_PAIR(0xBC6473EB, 0xDC40DD70), LIMB_PAIR(0x307C0D1C, 0x92C294C1), LIMB_PAIR(0xCBFA6E74, 0x5604A86D),
+            LIMB_PAIR(0x7C1764B6, 0x7288D1D4), LIMB_PAIR(0xE0418B51, 0x72541140), LIMB_PAIR(0x18ACF6D1, 0x9F031A60), LIMB_PAIR(0xFE2742C6, 0x20989E89)
+        },
+        {   // 7 * 16^4 * B
+            LIMB_PAIR(0x85EAEC2E, 0x1674278B), LIMB_PAIR(0x7ACB2BDF, 0x5621DC07), LIMB_PAIR(0x61CBF45A, 0x640A4C16), LIMB_PAIR(0xF70595D3, 0x730B9950),
+            LIMB_PAIR(0x3A2DCC7F, 0x499777FD), LIMB_PAIR(0xA54FD892, 0x32857C2C), LIMB_PAIR(0xD207E3A0, 0xA279D864), LIMB_PAIR(0x0CA67E29, 0x0403ED1D),
+            LIMB_PAIR(0x874EC552, 0xC94B2D35), LIMB_PAIR(0x98246F8D, 0xC5E6C8CF), LIMB_PAIR(0x16C035CE, 0xF7CB46FA), LIMB_PAIR(0x08303DCC, 0x5BD74543)
+        },
+        {   // 8 * 16^4 * B
+            LIMB_PAIR(0x15E7792A, 0x85C49321), LIMB_PAIR(0xBDCDDDC9, 0xC64C89A2), LIMB_PAIR(0xADA3D762, 0x9D1E3DA8), LIMB_PAIR(0x3067F82C, 0x5BB7DB12),
+            LIMB_PAIR(0x28B24CC2, 0x7F9AD195), LIMB_PAIR(0x6335C181, 0x7F6B5465), LIMB_PAIR(0x4FC07236, 0x66B8B66E), LIMB_PAIR(0x7380AD83, 0x133A7800),
+            LIMB_PAIR(0xC6CA62BE, 0x0961F467), LIMB_PAIR(0x211952EE, 0x04EC21D6), LIMB_PAIR(0x9BD54770, 0x18236077), LIMB_PAIR(0x58F0E0D2, 0x740DCA6D)
+        }
+    },
+#endif
+#if (5 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^5 * B
+            LIMB_PAIR(0xED261AE5, 0x3906C72A), LIMB_PAIR(0x88E100F7, 0x9AB68FD9), LIMB_PAIR(0xF3360197, 0xF5E9059A), LIMB_PAIR(0xBF2B6D47, 0x0E53DC78),
+            LIMB_PAIR(0xD3F0AF0B, 0x50B70BF5), LIMB_PAIR(0xE32E71F7, 0x4FEAF48A), LIMB_PAIR(0xA55BBD34, 0x60E84ED3), LIMB_PAIR(0x3F50D1ED, 0x00ED489B),
+            LIMB_PAIR(0x7971877A, 0xB90829BF), LIMB_PAIR(0x6D17E631, 0x5E444463), LIMB_PAIR(0x18276893, 0x4D05C52E), LIMB_PAIR(0x5A4A4AF5, 0x27632D9A)
+        },
+        {   // 2 * 16^5 * B
+            LIMB_PAIR(0x87EAFFDB, 0xA98285D1), LIMB_PAIR(0xD8D0A864, 0xA5B4FBBB), LIMB_PAIR(0x022663F7, 0xB658F27F), LIMB_PAIR(0xD99CE282, 0x3BBC2B22),
+            LIMB_PAIR(0x54B260CE, 0xD11FF051), LIMB_PAIR(0x72F95270, 0xD86DC38E), LIMB_PAIR(0x267CC138, 0x601FCD0D), LIMB_PAIR(0x29E90CCD, 0x2B679164),
+            LIMB_PAIR(0x583C0A58, 0xB917C952), LIMB_PAIR(0x0FE4C6F3, 0x653FF9B8), LIMB_PAIR(0xBCDF3C0C, 0x9B0DA7D7), LIMB_PAIR(0xAB54D60E, 0x43A0EEB6)
+        },
+        {   // 3 * 16^5 * B
+            LIMB_PAIR(0x57875FE8, 0x3AC63223), LIMB_PAIR(0xF5FBCB8F, 0xD9D4F4EC), LIMB_PAIR(0x382BB620, 0x8DEE8493), LIMB_PAIR(0x4C799FDC, 0x50C5EAA1),
+            LIMB_PAIR(0x6D4A5487, 0x396966A4), LIMB_PAIR(0xAC2BB3BA, 0xF811A18A), LIMB_PAIR(0x5628B26B, 0x66E4685B), LIMB_PAIR(0x9D929B92, 0x70A47702),
+            LIMB_PAIR(0xD6F2FB3C, 0xDD0EDC8B), LIMB_PAIR(0x9CC7B7A0, 0x54C63AA7), LIMB_PAIR(0x2C8D9F1A, 0xAE0B032B), LIMB_PAIR(0x602967FB, 0x6F9CE107)
+        },
+        {   // 4 * 16^5 * B
+            LIMB_PAIR(0x3520E0B5, 0x13969306), LIMB_PAIR(0x88EA03FE, 0x437FCF7C), LIMB_PAIR(0xD3C959BC, 0xF7D4C40B), LIMB_PAIR(0xF893DED9, 0x699154D1),
+            LIMB_PAIR(0xCDE1C22A, 0xAD1054B1), LIMB_PAIR(0x48EB32DF, 0xC4A8E902), LIMB_PAIR(0xACCDC0EA, 0x5F3E7B33), LIMB_PAIR(0xFC79963E, 0x72364713),
+            LIMB_PAIR(0xB4B27526, 0x315D5C75), LIMB_PAIR(0x0236DAA5, 0xCCCB842D), LIMB_PAIR(0x345FEE8E, 0x22F0C8A3), LIMB_PAIR(0x7D39DBED, 0x73975A61)
+        },
+        {   // 5 * 16^5 * B
+            LIMB_PAIR(0xF4433E46, 0x6F37F392), LIMB_PAIR(0x1F566B18, 0x0E19B9A1), LIMB_PAIR(0x1FD1D662, 0x220FB78A), LIMB_PAIR(0xA381C94D, 0x362A4258),
+            LIMB_PAIR(0x6375DA10, 0xE4024DF9), LIMB_PAIR(0x1830C870, 0x78D3251A), LIMB_PAIR(0x658CD91C, 0x902B1948), LIMB_PAIR(0x29B7438A, 0x7E18B10B),
+            LIMB_PAIR(0x2B6BEB2F, 0x9071D913), LIMB_PAIR(0x28418247, 0x0F26E9AD), LIMB_PAIR(0xBDEC925D, 0xEAB91EC9), LIMB_PAIR(0xF48AF2DE, 0x4BE65BC8)
+        },
+        {   // 6 * 16^5 * B
+            LIMB_PAIR(0x57C26234, 0x1D50FBA2), LIMB_PAIR(0xDEB0678B, 0x7BD4823A), LIMB_PAIR(0xA6538AF5, 0xC2B0DC6E), LIMB_PAIR(0x351DA73E, 0x5665EEC6),
+            LIMB_PAIR(0xA36E7028, 0x78487FEB), LIMB_PAIR(0x1DD8CE34, 0x5F3F1300), LIMB_PAIR(0x4B30C489, 0x934FB12D), LIMB_PAIR(0x397F0A2B, 0x056C244D),
+            LIMB_PAIR(0x43BFB210, 0xDB3EE009), LIMB_PAIR(0x20800AC2, 0x49720187), LIMB_PAIR(0x73BD8667, 0x26AB5D61), LIMB_PAIR(0xAB204938, 0x20B209C2)
+        },
+        {   // 7 * 16^5 * B
+            LIMB_PAIR(0x16BD3289, 0x1FCCA945), LIMB_PAIR(0x41420428, 0x448D65AA), LIMB_PAIR(0x16A55D62, 0x59C3B7B2), LIMB_PAIR(0x4E612CD8, 0x49992CC6),
+            LIMB_PAIR(0xC07FB34B, 0x549E342A), LIMB_PAIR(0x21373D93, 0x02D82208), LIMB_PAIR(0xACD1F567, 0xBC262D70), LIMB_PAIR(0xFBCAC784, 0x7A92C9FD),
+            LIMB_PAIR(0x70F801DE, 0x65BD1BEA), LIMB_PAIR(0xFE49E28A, 0x1BEFB7C0), LIMB_PAIR(0xB1B2AE4A, 0xA86306CD), LIMB_PAIR(0x265C2A09, 0x3B7AC0CD)
+        },
+        {   // 8 * 16^5 * B
+            LIMB_PAIR(0x22ED39A7, 0xF0D54E4F), LIMB_PAIR(0x5608150A, 0xA2AAE91E), LIMB_PAIR(0xEDDAE875, 0xF421B2E9), LIMB_PAIR(0x6B7DE992, 0x31BC531D),
+            LIMB_PAIR(0x8C01BCEC, 0x822BEE43), LIMB_PAIR(0xC0FBC73B, 0x530CB525), LIMB_PAIR(0xC1953FE9, 0x48519034), LIMB_PAIR(0xE09A0F5B, 0x265CC261),
+            LIMB_PAIR(0xA980F971, 0xDF3D134D), LIMB_PAIR(0x221A22A7, 0x7A4FB8D1), LIMB_PAIR(0x35AAD6D8, 0x3DF7D420), LIMB_PAIR(0x6A1A125E, 0x2A14EDCC)
+        }
+    },
+#endif
+#if (6 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^6 * B
+            LIMB_PAIR(0x0478433C, 0x231A8C57), LIMB_PAIR(0xC281439D, 0xB7B5270E), LIMB_PAIR(0xE3D9079F, 0xDBAA99EA), LIMB_PAIR(0x6C2B03D9, 0x2C03F525),
+            LIMB_PAIR(0x52CFCE4E, 0xDF48EE07), LIMB_PAIR(0x06EC08B7, 0xC3FFFAF3), LIMB_PAIR(0xB95459C4, 0x05710B2A), LIMB_PAIR(0x963EA38D, 0x161D25FA),
+            LIMB_PAIR(0x7B53A47D, 0x790F1875), LIMB_PAIR(0xCF0C5879, 0x307B0130), LIMB_PAIR(0x257EF7F9, 0x31903D77), LIMB_PAIR(0xBD96BBAF, 0x699468BD)
+        },
+        {   // 2 * 16^6 * B
+            LIMB_PAIR(0x6AA91948, 0xD8DD3DE6), LIMB_PAIR(0x2FC0D2CC, 0x485064C2), LIMB_PAIR(0x34FDEA2F, 0x9B482466), LIMB_PAIR(0x6C4A2E3A, 0x293E1C4E),
+            LIMB_PAIR(0xF4DAFECF, 0xBD1F2F46), LIMB_PAIR(0xA47FD6F7, 0x7CEF0114), LIMB_PAIR(0x4A47B37F, 0xD31FFDDA), LIMB_PAIR(0x73905785, 0x525219A4),
+            LIMB_PAIR(0x925112E1, 0x376E134B), LIMB_PAIR(0xDCA15DA0, 0x703778B5), LIMB_PAIR(0x461C3111, 0xB04589AF), LIMB_PAIR(0x7F032823, 0x5B605C44)
+        },
+        {   // 3 * 16^6 * B
+            LIMB_PAIR(0xF0E7F04C, 0x3BE9FEC6), LIMB_PAIR(0x75E34962, 0x866A579E), LIMB_PAIR(0x1E1DE61A, 0x5542EF16), LIMB_PAIR(0xCC5ABDD5, 0x2F12FEF4),
+            LIMB_PAIR(0x20C47C89, 0xB9658059), LIMB_PAIR(0x923B8FCC, 0xE7F0100C), LIMB_PAIR(0x02E2EF77, 0x00012565), LIMB_PAIR(0xA8AEB3EE, 0x24A76DCE),
+            LIMB_PAIR(0xDFC0C740, 0x0A4522B2), LIMB_PAIR(0x40C9A407, 0x10D06E7F), LIMB_PAIR(0x78CFF668, 0xC6CF1441), LIMB_PAIR(0x18A43790, 0x5E607B25)
+        },
+        {   // 4 * 16^6 * B
+            LIMB_PAIR(0xA596CF14, 0xA02C431C), LIMB_PAIR(0xAED3E400, 0xE3C42D40), LIMB_PAIR(0x2E0F26DB, 0xD2452680), LIMB_PAIR(0x9E457068, 0x201F3313),
+            LIMB_PAIR(0x6CDF1818, 0x58B31D8F), LIMB_PAIR(0xC36258A2, 0x35CFA74F), LIMB_PAIR(0x66E61D6E, 0xE1B3FF4F), LIMB_PAIR(0x6CCDD5F7, 0x5067ACAB),
+            LIMB_PAIR(0x08039D51, 0xFD527F6B), LIMB_PAIR(0x017C0006, 0x18B14964), LIMB_PAIR(0x2E25A4A8, 0xD5220EB0), LIMB_PAIR(0x62460375, 0x397CBA88)
+        },
+        {   // 5 * 16^6 * B
+            LIMB_PAIR(0xC81379E7, 0x7815C3FB), LIMB_PAIR(0xDDE12AF1, 0xA6619420), LIMB_PAIR(0x85A8FDD5, 0xFFA9C0F8), LIMB_PAIR(0xC1E1C252, 0x771B4022),
+            LIMB_PAIR(0xF05959B2, 0x30C13093), LIMB_PAIR(0xE9A97976, 0xE23AA18D), LIMB_PAIR(0x721D5E26, 0x222FD491), LIMB_PAIR(0x766E6C3A, 0x2339D320),
+            LIMB_PAIR(0x513A2FA7, 0xD87DD986), LIMB_PAIR(0xF9D4CF08, 0xF5AC9B71), LIMB_PAIR(0x1EA283B3, 0xD06BC31B), LIMB_PAIR(0x19971A76, 0x331A1892)
+        },
+        {   // 6 * 16^6 * B
+            LIMB_PAIR(0x9D7572AF, 0x26512F3A), LIMB_PAIR(0x68074A9E, 0x5BCBE288), LIMB_PAIR(0x1180F7C4, 0x84EDC1C1), LIMB_PAIR(0xF649A67B, 0x1AC9619F),
+            LIMB_PAIR(0xFB4F80C6, 0xF5166F45), LIMB_PAIR(0x61C775CF, 0x9C36C7DE), LIMB_PAIR(0x9041D91C, 0xE3D4E81B), LIMB_PAIR(0x83BDFE21, 0x31167C6B),
+            LIMB_PAIR(0x524B1068, 0xF22B3842), LIMB_PAIR(0xEE9CE987, 0x5068343B), LIMB_PAIR(0x4A6250C8, 0xFC9D7184), LIMB_PAIR(0x1F08B111, 0x61243634)
+        },
+        {   // 7 * 16^6 * B
+            LIMB_PAIR(0x1A2D2638, 0x8B6349E3), LIMB_PAIR(0x9BD3FD35, 0x9DDFB700), LIMB_PAIR(0xA3A06BA4, 0x7F8BF1B8), LIMB_PAIR(0x78D90445, 0x1522AA31),
+            LIMB_PAIR(0x874E898D, 0xD99D41DB), LIMB_PAIR(0x6C07DC20, 0x09FEA5F1), LIMB_PAIR(0xD00F9BBC, 0x793D2C67), LIMB_PAIR(0x9E5EFF40, 0x46EBE230),
+            LIMB_PAIR(0x69614938, 0x2C382F53), LIMB_PAIR(0xB72D6D10, 0xDAFE409A), LIMB_PAIR(0xB646F227, 0xE8C83391), LIMB_PAIR(0x0524306C, 0x45FE70F5)
+        },
+        {   // 8 * 16^6 * B
+            LIMB_PAIR(0xC8951491, 0x62F24920), LIMB_PAIR(0x3F630CA2, 0x05F007C8), LIMB_PAIR(0xF5C9D4B8, 0x6FBB45D2), LIMB_PAIR(0xB57A2245, 0x16619F6D),
+            LIMB_PAIR(0x960C0B8C, 0xDA4875A6), LIMB_PAIR(0xEF0E2F20, 0x5B68D076), LIMB_PAIR(0x3D0B8FD4, 0x07FB51CF), LIMB_PAIR(0xA0E392D4, 0x428D1623),
+            LIMB_PAIR(0x01A308FD, 0x084F4A44), LIMB_PAIR(0x76A5CAAC, 0xA82219C3), LIMB_PAIR(0x43D1BC7D, 0xDEB8DE46), LIMB_PAIR(0x60BD38C6, 0x1D81592D)
+        }
+    },
+#endif
+#if (7 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^7 * B
+            LIMB_PAIR(0x2F89C8A1, 0x3A4A369A), LIMB_PAIR(0x7C8DE80D, 0x63137A1D), LIMB_PAIR(0x78EDA015, 0xBCAC008A), LIMB_PAIR(0xB483B03F, 0x2CB8B3A5),
+            LIMB_PAIR(0xEC2A4C38, 0xD833D7BE), LIMB_PAIR(0x0ACC20ED, 0x2C916283), LIMB_PAIR(0x92DF7581, 0xE93A47AA), LIMB_PAIR(0x333C4A81, 0x702D67A3),
+            LIMB_PAIR(0xCB1B90A1, 0x36E417CB), LIMB_PAIR(0x7F11794E, 0x33B3DDAA), LIMB_PAIR(0x885BC607, 0x3F510808), LIMB_PAIR(0xE6A8020D, 0x24141DC0)
+        },
+        {   // 2 * 16^7 * B
+            LIMB_PAIR(0xBD83157D, 0x91925DCC), LIMB_PAIR(0x22CC8094, 0x3CA12053), LIMB_PAIR(0x3F90D6E4, 0x28E57F18), LIMB_PAIR(0xDE2E767B, 0x1A4714CE),
+            LIMB_PAIR(0x3FEFEE9D, 0x59F73C77), LIMB_PAIR(0xC1CF989D, 0xB3F1EF89), LIMB_PAIR(0xE02E545F, 0xE35DFB42), LIMB_PAIR(0x47A1B47C, 0x5766120B),
+            LIMB_PAIR(0xB8B6B7FF, 0xDB20BA0F), LIMB_PAIR(0x77511FA1, 0xB732C3B6), LIMB_PAIR(0x99F02D89, 0xA92B51C0), LIMB_PAIR(0x489CA5F1, 0x4F3875AD)
+        },
+        {   // 3 * 16^7 * B
+            LIMB_PAIR(0xEE73EEC0, 0x79ED13F6), LIMB_PAIR(0x69110BB1, 0xA5C6526D), LIMB_PAIR(0x8603860C, 0xE48928C3), LIMB_PAIR(0xFD7059F5, 0x722A1446),
+            LIMB_PAIR(0x4932AB22, 0xC7FC762F), LIMB_PAIR(0x2F4C3C1B, 0x7AC0EDF7), LIMB_PAIR(0x9AA895E8, 0x5F6B55AA), LIMB_PAIR(0xAD0A0081, 0x3680274D),
+            LIMB_PAIR(0xA8CF8819, 0xD0959FE9), LIMB_PAIR(0x8475A99C, 0xD0A99550), LIMB_PAIR(0x20B09CC5, 0x6EAC1733), LIMB_PAIR(0x331B1095, 0x628ECF04)
+        },
+        {   // 4 * 16^7 * B
+            LIMB_PAIR(0x5C74CCF1, 0x9B41ACF8), LIMB_PAIR(0x08265251, 0xB6733181), LIMB_PAIR(0x11ADB147, 0x99C92AED), LIMB_PAIR(0x34ECB40F, 0x7A47D70D),
+            LIMB_PAIR(0xA9D0DDBC, 0x98BCB118), LIMB_PAIR(0x08B4802B, 0xEE449E34), LIMB_PAIR(0xB8A6B104, 0x87089226), LIMB_PAIR(0x45C7915D, 0x685F349A),
+            LIMB_PAIR(0xCC43A4F5, 0x60A0C4CB), LIMB_PAIR(0x3677BEA9, 0x775C66CA), LIMB_PAIR(0x2FF8F5ED, 0xA17AA175), LIMB_PAIR(0x0E01FDC0, 0x11DED902)
+        },
+        {   // 5 * 16^7 * B
+            LIMB_PAIR(0x3BEA93B7, 0x471F95B0), LIMB_PAIR(0x3313ABD3, 0x0552D7D4), LIMB_PAIR(0xE17E3F7B, 0xBD9370E2), LIMB_PAIR(0xB20E5BEC, 0x7B120F1D),
+            LIMB_PAIR(0xCAEFE704, 0x890E7809), LIMB_PAIR(0xE30E8C6C, 0x8728296D), LIMB_PAIR(0x92AEB1C9, 0x4C5CD2A3), LIMB_PAIR(0x5771531F, 0x194263D1),
+            LIMB_PAIR(0x86502D7A, 0x17D2FB3D), LIMB_PAIR(0x50A69352, 0xB564D844), LIMB_PAIR(0xA60ED75D, 0x7DA962C8), LIMB_PAIR(0x318736AA, 0x00D0F85B)
+        },
+        {   // 6 * 16^7 * B
+            LIMB_PAIR(0xFD7621C1, 0xA6753C1E), LIMB_PAIR(0x445671F5, 0x69C0B4A7), LIMB_PAIR(0x05B23C11, 0x971F5274), LIMB_PAIR(0x51A8C7CD, 0x387BC748),
+            LIMB_PAIR(0x777C84FD, 0x978B142E), LIMB_PAIR(0x05A8C062, 0xF4026447), LIMB_PAIR(0xE7E612C7, 0xA67AD51B), LIMB_PAIR(0x98DD6A33, 0x2F7B4596),
+            LIMB_PAIR(0x4A52A9A8, 0x81894B4D), LIMB_PAIR(0xF6B8832F, 0xADD93E12), LIMB_PAIR(0xB61BD638, 0x184D8548), LIMB_PAIR(0xD6C9F6CD, 0x3F1C62DB)
+        },
+        {   // 7 * 16^7 * B
+            LIMB_PAIR(0x148F693D, 0x3FAD3E40), LIMB_PAIR(0x94EB9A72, 0x052656E1), LIMB_PAIR(0x184F4E2F, 0x2F4DCBFD), LIMB_PAIR(0xC482E18B, 0x406F8DB1),
+            LIMB_PAIR(0x91910C1F, 0x2E8F1F00), LIMB_PAIR(0xBFF2E12C, 0xA4DF4FE0), LIMB_PAIR(0xEE927438, 0x60C6560A), LIMB_PAIR(0xACEFC8FA, 0x6338283F),
+            LIMB_PAIR(0x7F191EE4, 0x9E630D2C), LIMB_PAIR(0xBC3FF670, 0x4FBF8301), LIMB_PAIR(0x7AFB73C4, 0x787D8E4E), LIMB_PAIR(0xE8F58FA5, 0x50D83D5B)
+        },
+        {   // 8 * 16^7 * B
+            LIMB_PAIR(0xB4D3B66D, 0xC0ACCF90), LIMB_PAIR(0x61732E60, 0xA7059DE5), LIMB_PAIR(0x70C6B0BA, 0x033D1F78), LIMB_PAIR(0x26D946E4, 0x584161CD),
+            LIMB_PAIR(0xC11A1897, 0x85683916), LIMB_PAIR(0xE506D008, 0x2D69A4EF), LIMB_PAIR(0xF664BD01, 0x39AF1378), LIMB_PAIR(0x361517C6, 0x65942131),
+            LIMB_PAIR(0x72D27CA2, 0xBBF2B1A0), LIMB_PAIR(0xFBDEC704, 0xBF393C59), LIMB_PAIR(0xE262B81E, 0xE98DBBCE), LIMB_PAIR(0x3029B589, 0x02EEBD0B)
+        }
+    },
+#endif
+#if (8 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^8 * B
+            LIMB_PAIR(0x7B85C5E8, 0x8765B69F), LIMB_PAIR(0xD168BAB2, 0x6FF0678B), LIMB_PAIR(0x1D330F9B, 0x3A70E77C), LIMB_PAIR(0xB0AF8E7C, 0x3A5F6D51),
+            LIMB_PAIR(0xA60DAC5F, 0x61368756), LIMB_PAIR(0xEBABDC57, 0x17E02F6A), LIMB_PAIR(0x4CCE0F7D, 0x7F193F2D), LIMB_PAIR(0x89ECDCF0, 0x20234A77),
+            LIMB_PAIR(0x7178B252, 0x76D20DB6), LIMB_PAIR(0xD51ED160, 0x071C34F9), LIMB_PAIR(0xB3E41170, 0xF62A4A20), LIMB_PAIR(0x3CFFE366, 0x7CD68235)
+        },
+        {   // 2 * 16^8 * B
+            LIMB_PAIR(0x68ACF4F3, 0xA665CD60), LIMB_PAIR(0x3CD7E3D3, 0x42D92D18), LIMB_PAIR(0x336025D9, 0x5759389D), LIMB_PAIR(0x2B2CD8FF, 0x3EF0253B),
+            LIMB_PAIR(0xD887FAB6, 0x0BE1A45B), LIMB_PAIR(0xBA403B6E, 0x2A846A32), LIMB_PAIR(0xE96E6000, 0xD9921012), LIMB_PAIR(0x3BDC0943, 0x2838C886),
+            LIMB_PAIR(0x4A465030, 0xD16BB0CF), LIMB_PAIR(0x15C577AB, 0xFA496B41), LIMB_PAIR(0xF4AB419D, 0x82CFAE8A), LIMB_PAIR(0x06A82812, 0x21DCB8A6)
+        },
+        {   // 3 * 16^8 * B
+            LIMB_PAIR(0xBE7731BA, 0x9A8D00FA), LIMB_PAIR(0x629E1889, 0x8203607E), LIMB_PAIR(0x43F3D97F, 0xB2CC0237), LIMB_PAIR(0x6C6F678B, 0x5D840DBF),
+            LIMB_PAIR(0x8C9D9FC8, 0x5C600446), LIMB_PAIR(0xD42AA3CB, 0x2540096E), LIMB_PAIR(0x12EE2F9C, 0x125B4D4C), LIMB_PAIR(0x94A31DAB, 0x0BC3D081),
+            LIMB_PAIR(0x309FE18B, 0x706E380D), LIMB_PAIR(0xB9E165C7, 0x6EB02DA6), LIMB_PAIR(0x7DAE20AB, 0x57BBBA99), LIMB_PAIR(0x2AC196DD, 0x3A427623)
+        },
+        {   // 4 * 16^8 * B
+            LIMB_PAIR(0xDB447ECB, 0x3BF8C172), LIMB_PAIR(0xC6282DBD, 0x5FCFC41F), LIMB_PAIR(0x75AA15FE, 0x80ACFFC0), LIMB_PAIR(0x24E1A9F9, 0x0770C9E8),
+            LIMB_PAIR(0x8A7084FA, 0x4B42432C), LIMB_PAIR(0xDFB9E545, 0x898A19E3), LIMB_PAIR(0x9C58E45D, 0xBE9F0021), LIMB_PAIR(0xA16DEBD1, 0x1FF177CE),
+            LIMB_PAIR(0x45B5B5FD, 0xCF61D99A), LIMB_PAIR(0x1B3A7924, 0x860984E9), LIMB_PAIR(0x303E3E89, 0xE7300919), LIMB_PAIR(0x41500B1E, 0x39F264FD)
+        },
+        {   // 5 * 16^8 * B
+            LIMB_PAIR(0xFE097BE1, 0xD19B4AAB), LIMB_PAIR(0xDFE01929, 0xA46DFCE1), LIMB_PAIR(0x2CA6F1FF, 0xC3C90894), LIMB_PAIR(0x2C35F14E, 0x65C62127),
+            LIMB_PAIR(0xDBE7E29C, 0xA7AD3417), LIMB_PAIR(0x2B9C139C, 0xBD94376A), LIMB_PAIR(0x93597BA9, 0xA0E91B8E), LIMB_PAIR(0x68889840, 0x1712D734),
+            LIMB_PAIR(0xCE3193DD, 0xE72B89F8), LIMB_PAIR(0xA125C0BB, 0x4D103356), LIMB_PAIR(0x2E1CFE83, 0x0419A93D), LIMB_PAIR(0xB19CE272, 0x22F9800A)
+        },
+        {   // 6 * 16^8 * B
+            LIMB_PAIR(0x9A6EFDAC, 0x42029FDD), LIMB_PAIR(0x34A54941, 0xB912CEBE), LIMB_PAIR(0x87BDF37B, 0x640F64B9), LIMB_PAIR(0x8598CAB4, 0x4171A4D3),
+            LIMB_PAIR(0x3E9EF8CB, 0x605A368A), LIMB_PAIR(0xA5504715, 0xE3E9C022), LIMB_PAIR(0x5F24248F, 0x553D48B0), LIMB_PAIR(0x647626E5, 0x13F416CD),
+            LIMB_PAIR(0x99C94C8C, 0xFA2758AA), LIMB_PAIR(0xB000B807, 0x23006F6F), LIMB_PAIR(0xADDA5392, 0xFBD291DD), LIMB_PAIR(0x574BD1AB, 0x508214FA)
+        },
+        {   // 7 * 16^8 * B
+            LIMB_PAIR(0x53D003D6, 0x461A15BB), LIMB_PAIR(0xBCF3C965, 0xB2102888), LIMB_PAIR(0x6C683A5A, 0x27C57675), LIMB_PAIR(0xC86CB447, 0x3A7758A4),
+            LIMB_PAIR(0x3ED6FE4B, 0xC2026915), LIMB_PAIR(0x511D77C4, 0xA65A6739), LIMB_PAIR(0x2C14AF94, 0xCBDE2646), LIMB_PAIR(0x6FABA74B, 0x22F960EC),
+            LIMB_PAIR(0x93AE5076, 0x548111F6), LIMB_PAIR(0x1DFD54A6, 0x1DAE21DF), LIMB_PAIR(0xF3115E65, 0x12248C90), LIMB_PAIR(0x8DE7F494, 0x5D9FD15F)
+        },
+        {   // 8 * 16^8 * B
+            LIMB_PAIR(0xEED7521E, 0x3F244D2A), LIMB_PAIR(0x432E9615, 0x8E3A9028), LIMB_PAIR(0x2E9C16D4, 0xE164BA77), LIMB_PAIR(0x47EB98D8, 0x3BC187FA),
+            LIMB_PAIR(0x6D63727F, 0x031408D3), LIMB_PAIR(0xD7C7B533, 0x6A379AEF), LIMB_PAIR(0xCCAEE24B, 0xA9E18FC5), LIMB_PAIR(0x4F8FBED3, 0x332F3591),
+            LIMB_PAIR(0xEA86C20C, 0x6D470115), LIMB_PAIR(0x6C46D125, 0x998AB7CB), LIMB_PAIR(0x3A660188, 0xD77832B5), LIMB_PAIR(0x906FBA03, 0x450D81CE)
+        }
+    },
+#endif
+#if (9 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^9 * B
+            LIMB_PAIR(0xB2CAE0B5, 0x23264D66), LIMB_PAIR(0xEBCA6576, 0x7DBAED33), LIMB_PAIR(0xF0D24AC8, 0x030EBED6), LIMB_PAIR(0xF7635510, 0x2A887F78),
+            LIMB_PAIR(0xD8453902, 0xF8AE4D2A), LIMB_PAIR(0xE8DB2D1D, 0x7018058E), LIMB_PAIR(0xC7D2C11E, 0xAAB3995F), LIMB_PAIR(0x24CCCA79, 0x53B16D23),
+            LIMB_PAIR(0x5C012D4F, 0x2A23B9E7), LIMB_PAIR(0xCAE1F2EA, 0x0C974651), LIMB_PAIR(0x675D70CA, 0x2FB63273), LIMB_PAIR(0x864403F5, 0x0BA7250B)
+        },
+        {   // 2 * 16^9 * B
+            LIMB_PAIR(0x86F86D9C, 0xDD635893), LIMB_PAIR(0xE13A85A4, 0x61699176), LIMB_PAIR(0x4EAA7D57, 0x2E511195), LIMB_PAIR(0xFB60BDFB, 0x32C21B57),
+            LIMB_PAIR(0x029C6421, 0xBB0D18FD), LIMB_PAIR(0x89298F02, 0xBC2D1421), LIMB_PAIR(0x8B250E96, 0x8347F8E6), LIMB_PAIR(0x032D71C9, 0x7B9F2FE8),
+            LIMB_PAIR(0x319E0780, 0xD87823CD), LIMB_PAIR(0x897775C5, 0xEFC4CFC1), LIMB_PAIR(0x9A0AB3F7, 0x4854FB12), LIMB_PAIR(0x7238C371, 0x12C49D41)
+        },
+        {   // 3 * 16^9 * B
+            LIMB_PAIR(0x83799542, 0x09B3A017), LIMB_PAIR(0xAAD5EE3F, 0x626DD08F), LIMB_PAIR(0xEB70149F, 0xBA00BCEE), LIMB_PAIR(0xA0A444C9, 0x1421B246),
+            LIMB_PAIR(0xFFE83769, 0x0950B533), LIMB_PAIR(0x8E1D6BD1, 0x21861C1D), LIMB_PAIR(0x1302E510, 0xF022D838), LIMB_PAIR(0x6391CAB4, 0x2509200C),
+            LIMB_PAIR(0x8C24A7C7, 0x4AA43A8E), LIMB_PAIR(0xD8F05EF5, 0x04C1F540), LIMB_PAIR(0x0B3EB9DC, 0xADBA5E0C), LIMB_PAIR(0x48A49CE3, 0x2AB55044)
+        },
+        {   // 4 * 16^9 * B
+            LIMB_PAIR(0x1C5D3AFA, 0xDC07AC63), LIMB_PAIR(0xF9DF8C6C, 0x58615171), LIMB_PAIR(0x9D73E2B0, 0x72A079D8), LIMB_PAIR(0xB4EAE15D, 0x7301F4CE),
+            LIMB_PAIR(0x6F0F5DEC, 0x2ED22726), LIMB_PAIR(0x5ED50824, 0x9824EE41), LIMB_PAIR(0x9468D415, 0x807BEC7C), LIMB_PAIR(0xB521E23F, 0x7093BAE1),
+            LIMB_PAIR(0xD6722C41, 0x6409E759), LIMB_PAIR(0x72BF729B, 0xA674E1CF), LIMB_PAIR(0x3C21E569, 0xBC0A24EB), LIMB_PAIR(0x4EBACB23, 0x390167D2)
+        },
+        {   // 5 * 16^9 * B
+            LIMB_PAIR(0xA2F2120B, 0xD7BB054B), LIMB_PAIR(0xB10589B7, 0xE2B9CEAE), LIMB_PAIR(0xF3C0EDBE, 0x3FE8BAC8), LIMB_PAIR(0x7112CB69, 0x4CBD4076),
+            LIMB_PAIR(0xBA353F1C, 0x27F58E3B), LIMB_PAIR(0xBF6A4361, 0x4C47764D), LIMB_PAIR(0x6E562650, 0xAFBBC4E5), LIMB_PAIR(0xAAE1A45D, 0x07DB2EE6),
+            LIMB_PAIR(0x29C58176, 0x0B603CC0), LIMB_PAIR(0x5CB15D61, 0x5988E382), LIMB_PAIR(0xDCF0AD8D, 0x2BB61413), LIMB_PAIR(0x74183287, 0x7B8EEC6C)
+        },
+        {   // 6 * 16^9 * B
+            LIMB_PAIR(0xFC386B73, 0x32FEE570), LIMB_PAIR(0xDA3A8CC7, 0xDA8B0141), LIMB_PAIR(0xC8968359, 0x975FFD0A), LIMB_PAIR(0xB132A855, 0x6EE809A1),
+            LIMB_PAIR(0x2CD27CB0, 0xE4CA4078), LIMB_PAIR(0xFBE967BD, 0xDAF9C323), LIMB_PAIR(0x8AD41E9E, 0xB29BD34A), LIMB_PAIR(0x626EDE4D, 0x72810497),
+            LIMB_PAIR(0xFCFD863A, 0x9444BB31), LIMB_PAIR(0x3E4E48C5, 0x2FE3690A), LIMB_PAIR(0xD088FA25, 0xDC29C867), LIMB_PAIR(0xD173292E, 0x13BD1E38)
+        },
+        {   // 7 * 16^9 * B
+            LIMB_PAIR(0x1DFAC521, 0x223FB5CF), LIMB_PAIR(0x6F554450, 0x325C2531), LIMB_PAIR(0x659177AC, 0x030B98D7), LIMB_PAIR(0x4F88A4BD, 0x1ED018B6),
+            LIMB_PAIR(0x696149B5, 0xD32B4CD8), LIMB_PAIR(0x81D8AAB7, 0xE55937D7), LIMB_PAIR(0xAE122B94, 0x0BCB2127), LIMB_PAIR(0xB14099B0, 0x41E86FCF),
+            LIMB_PAIR(0xB802A6B0, 0x3630DFA1), LIMB_PAIR(0x42AD3BD5, 0x880F8747), LIMB_PAIR(0xEEC5A4D4, 0x0AF90D6C), LIMB_PAIR(0x37CDC5D9, 0x746A247A)
+        },
+        {   // 8 * 16^9 * B
+            LIMB_PAIR(0x78D941ED, 0x6ECCD852), LIMB_PAIR(0xD22F7843, 0x2254AE83), LIMB_PAIR(0x7BBFCDB7, 0xC522D02E), LIMB_PAIR(0xBFF0E4E2, 0x681E3351),
+            LIMB_PAIR(0x2B7B9AF6, 0xD531B8BD), LIMB_PAIR(0x37FC5B51, 0x50050935), LIMB_PAIR(0xC593546D, 0x232FCF25), LIMB_PAIR(0x2BB40F49, 0x20A36514),
+            LIMB_PAIR(0x83034F45, 0x8B64B59D), LIMB_PAIR(0x1FA20EFB, 0x2F8B71F2), LIMB_PAIR(0xBA6550E4, 0x69249495), LIMB_PAIR(0x45D5472B, 0x539EF98E)
+        }
+    },
+#endif
+#if (10 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^10 * B
+            LIMB_PAIR(0x1CAE743F, 0xD074D896), LIMB_PAIR(0xEE1C63ED, 0xF86D18F5), LIMB_PAIR(0xE7F4ED29, 0x97BDC55B), LIMB_PAIR(0x663AB108, 0x4CBAD279),
+            LIMB_PAIR(0xA6205275, 0x6E7BB6A1), LIMB_PAIR(0x413C8E83, 0xAA4F21D7), LIMB_PAIR(0xE88F5CB2, 0x6F56D155), LIMB_PAIR(0xA6345BE1, 0x2DE25D4B),
+            LIMB_PAIR(0xA0D71FCD, 0x80D19024), LIMB_PAIR(0xFB288AF8, 0xC525C20A), LIMB_PAIR(0x5F3A6419, 0xB1A3974B), LIMB_PAIR(0xE2007233, 0x7D7FBCEF)
+        },
+        {   // 2 * 16^10 * B
+            LIMB_PAIR(0xF3C29094, 0xCD7C5DC5), LIMB_PAIR(0x2A9105AB, 0xC781A29A), LIMB_PAIR(0x421C3058, 0x80C61D36), LIMB_PAIR(0xDCD8D4D7, 0x4F9CD196),
+            LIMB_PAIR(0x266B2801, 0xFAEF1E6A), LIMB_PAIR(0xD5739F16, 0x866C68C4), LIMB_PAIR(0x1B03762C, 0xF68A2FBC), LIMB_PAIR(0x87B75A8D, 0x5975435E),
+            LIMB_PAIR(0x6A7B3768, 0x199297D8), LIMB_PAIR(0x1AD17A63, 0xD0D05824), LIMB_PAIR(0x5C1C0C17, 0xBA029CAD), LIMB_PAIR(0x387A0307, 0x7CCDD084)
+        },
+        {   // 3 * 16^10 * B
+            LIMB_PAIR(0x6760CC93, 0x9B0C8418), LIMB_PAIR(0x1AB32A99, 0xCDAE007A), LIMB_PAIR(0x620BDA18, 0xA88DEC86), LIMB_PAIR(0x8190CA44, 0x3593CA84),
+            LIMB_PAIR(0x6D260417, 0xDCA6422C), LIMB_PAIR(0x948240BD, 0xAE153D50), LIMB_PAIR(0xFB68C677, 0xA9C0C1B4), LIMB_PAIR(0x61D0CF53, 0x428BD0ED),
+            LIMB_PAIR(0x5E849AA7, 0x9213189A), LIMB_PAIR(0x65D8FACD, 0xD4D8C335), LIMB_PAIR(0x53FDBBD1, 0x8C52545B), LIMB_PAIR(0xDA2D63E6, 0x27398308)
+        },
+        {   // 4 * 16^10 * B
+            LIMB_PAIR(0x0A702453, 0xB9A10E4C), LIMB_PAIR(0xD57D1BDE, 0x0FA25866), LIMB_PAIR(0xCD27DAF7, 0xFFB9D9B5), LIMB_PAIR(0x492C33FD, 0x572C2945),
+            LIMB_PAIR(0x435ED413, 0x42C38D28), LIMB_PAIR(0x3278CCC9, 0xBD50F360), LIMB_PAIR(0x79DA03EF, 0xBB07AB1A), LIMB_PAIR(0xBE8C3355, 0x269597AE),
+            LIMB_PAIR(0xD6CD30BE, 0xC77FC745), LIMB_PAIR(0xE3BAAEFB, 0xE4DFE8D3), LIMB_PAIR(0xAA5DDA0C, 0xA22C8830), LIMB_PAIR(0xC05BCA80, 0x7F985498)
+        },
+        {   // 5 * 16^10 * B
+            LIMB_PAIR(0x0FBF6363, 0xD3561552), LIMB_PAIR(0xCF4DFBA6, 0x08045A45), LIMB_PAIR(0x873FA0C2, 0xEEC24FBC), LIMB_PAIR(0xD69B12E7, 0x30F2653C),
+            LIMB_PAIR(0x9F0BE117, 0x3849CE88), LIMB_PAIR(0x7B54A288, 0x8005AD1B), LIMB_PAIR(0x23FC921C, 0x3DA3C39F), LIMB_PAIR(0x0A31F304, 0x76C2EC47),
+            LIMB_PAIR(0xAAC10C85, 0x8A08C938), LIMB_PAIR(0xDB276BCB, 0x46179B60), LIMB_PAIR(0x0E6FAC70, 0xA920C01E), LIMB_PAIR(0x596473DA, 0x2F1273F1)
+        },
+        {   // 6 * 16^10 * B
+            LIMB_PAIR(0x55A70BC0, 0x30488BD7), LIMB_PAIR(0xF1D442E7, 0x06D6B5A4), LIMB_PAIR(0xBC596162, 0xEAD1A69E), LIMB_PAIR(0xEDC5F784, 0x38AC1997),
+            LIMB_PAIR(0x8AE01E11, 0x4739FC7C), LIMB_PAIR(0x4A6AAB9F, 0xFD527490), LIMB_PAIR(0x87728F2E, 0x41D98A82), LIMB_PAIR(0xD85B69F2, 0x5D9E572A),
+            LIMB_PAIR(0xA751B13B, 0x0666B517), LIMB_PAIR(0x7E9B858C, 0x747D0686), LIMB_PAIR(0x454DDE49, 0xACACC011), LIMB_PAIR(0xBFE9E69C, 0x22DFCD9C)
+        },
+        {   // 7 * 16^10 * B
+            LIMB_PAIR(0x103BE0A1, 0x56EC59B4), LIMB_PAIR(0xD259F969, 0x2EE3BAEC), LIMB_PAIR(0x13F5CD32, 0x797CB294), LIMB_PAIR(0x24CDE472, 0x0FE98778),
+            LIMB_PAIR(0xC30D0CD9, 0x8DDBD2E0), LIMB_PAIR(0xACBB4333, 0xAD8E665F), LIMB_PAIR(0x322A961F, 0x8F6B258C), LIMB_PAIR(0x5448C1C7, 0x6B2916C0),
+            LIMB_PAIR(0x0ABA913B, 0x7EDB34D1), LIMB_PAIR(0x2E6DAC0E, 0x4EA3CD82), LIMB_PAIR(0x6578F815, 0x66083DFF), LIMB_PAIR(0x7FF00A17, 0x4C303F30)
+        },
+        {   // 8 * 16^10 * B
+            LIMB_PAIR(0x0DD94500, 0x29FC0358), LIMB_PAIR(0x6FBBEC93, 0xECD27AA4), LIMB_PAIR(0xC2E2A7F8, 0x130A155F), LIMB_PAIR(0xB706A1D5, 0x416B151A),
+            LIMB_PAIR(0x17B28C85, 0xD30A3BD6), LIMB_PAIR(0x39773BEA, 0xC5D377B7), LIMB_PAIR(0x1E6A5CBF, 0xC6C6E78C), LIMB_PAIR(0x8B2AB7C4, 0x0D61B8F7),
+            LIMB_PAIR(0xE9C136B0, 0x56A8D7EF), LIMB_PAIR(0x58E44B20, 0xBD07E5CD), LIMB_PAIR(0x1B57E0AB, 0xAFE62FDA), LIMB_PAIR(0x4277E8D2, 0x191A2AF7)
+        }
+    },
+#endif
+#if (11 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^11 * B
+            LIMB_PAIR(0x2FE09A14, 0x09D4B60B), LIMB_PAIR(0xDBB1747E, 0xC384F0AF), LIMB_PAIR(0x78B5FD6E, 0x58E2EA89), LIMB_PAIR(0xB5E09B0A, 0x519EF577),
+            LIMB_PAIR(0xAB6F4985, 0xD550095B), LIMB_PAIR(0x4FBFAF1A, 0x04F4CD5B), LIMB_PAIR(0x2A0C7540, 0x9D8E2ED1), LIMB_PAIR(0xB2212286, 0x2BC24E04),
+            LIMB_PAIR(0x1124CCA9, 0x1863D7D9), LIMB_PAIR(0xB88A708E, 0x7AC08145), LIMB_PAIR(0x857031F5, 0x2BCD7309), LIMB_PAIR(0x8AB8FAE5, 0x62337A6E)
+        },
+        {   // 2 * 16^11 * B
+            LIMB_PAIR(0x1B3A1273, 0xD1AB324E), LIMB_PAIR(0x81055340, 0x18947CF1), LIMB_PAIR(0xA98C196E, 0x3B5D9567), LIMB_PAIR(0x802E1E68, 0x7FA00425),
+            LIMB_PAIR(0x06FFCA16, 0x4BCEF17F), LIMB_PAIR(0x692AE16A, 0xDE06E1DB), LIMB_PAIR(0x614F42B0, 0x0753702D), LIMB_PAIR(0x5B9212D0, 0x5F6041B4),
+            LIMB_PAIR(0x028C2705, 0x7D531574), LIMB_PAIR(0xDB0D75FE, 0x80317D69), LIMB_PAIR(0xEF8C8DDD, 0x30FFACE8), LIMB_PAIR(0xB6C3E998, 0x7E9DE97B)
+        },
+        {   // 3 * 16^11 * B
+            LIMB_PAIR(0xA24D40DD, 0xF004BE62), LIMB_PAIR(0x0452D41F, 0xBA065991), LIMB_PAIR(0x62A44234, 0x81C45EE1), LIMB_PAIR(0xA22266EF, 0x4CB829D8),
+            LIMB_PAIR(0x9E6585A3, 0x1558967B), LIMB_PAIR(0x98E98B92, 0x97C99CE0), LIMB_PAIR(0x6EB3ADAD, 0x10AF149B), LIMB_PAIR(0xF4D38CFA, 0x42181FE8),
+            LIMB_PAIR(0x07B86681, 0x1DBCAA84), LIMB_PAIR(0x8B26753B, 0x081F001E), LIMB_PAIR(0x84048E81, 0x3CD7CE6A), LIMB_PAIR(0x3F25F22C, 0x78AF1163)
+        },
+        {   // 4 * 16^11 * B
+            LIMB_PAIR(0x7D65318C, 0x3241C00E), LIMB_PAIR(0xD0E86DE7, 0xE6BEE5DC), LIMB_PAIR(0xFBC08C26, 0x118B2DC2), LIMB_PAIR(0xFC603DC3, 0x680D04A7),
+            LIMB_PAIR(0x0B50BABC, 0x8416EBD4), LIMB_PAIR(0x28208BEE, 0x15087226), LIMB_PAIR(0xB9C1C36D, 0xA3148FAF), LIMB_PAIR(0xD32D7D5D, 0x0D07DAAC),
+            LIMB_PAIR(0x695AA3EB, 0xF9C2414A), LIMB_PAIR(0x05A68F21, 0xDAA42C4C), LIMB_PAIR(0x7F93963E, 0x7C6C2398), LIMB_PAIR(0x0C3954E3, 0x210E8CD3)
+        },
+        {   // 5 * 16^11 * B
+            LIMB_PAIR(0x37FE6C26, 0x2B50F161), LIMB_PAIR(0x56E404D8, 0xE102BCD8), LIMB_PAIR(0x4C561F6B, 0x12B0F141), LIMB_PAIR(0xD028EC91, 0x51B17BC8),
+            LIMB_PAIR(0x10A71C06, 0xAC4201F2), LIMB_PAIR(0xF3BFB021, 0x6A65E0AE), LIMB_PAIR(0x393632F7, 0xBC42C35C), LIMB_PAIR(0x865F0742, 0x56EA8DB1),
+            LIMB_PAIR(0xCF535119, 0xFFF5FB4B), LIMB_PAIR(0xDF1108A0, 0xF4989D79), LIMB_PAIR(0x9A3BA325, 0xBDFCEA65), LIMB_PAIR(0x74D1A6F2, 0x18A11F11)
+        },
+        {   // 6 * 16^11 * B
+            LIMB_PAIR(0xD27A5F2C, 0xFBD63CDA), LIMB_PAIR(0x8AA106D7, 0xF00FC4BC), LIMB_PAIR(0x8E64A430, 0x53FB5C1A), LIMB_PAIR(0x0C1A2E85, 0x04EAABE5),
+            LIMB_PAIR(0x3F6BBA29, 0x407375AB), LIMB_PAIR(0x991E482E, 0x9EC3B6D8), LIMB_PAIR(0xE55F92E9, 0x99C80E82), LIMB_PAIR(0xFB0C0AE1, 0x307C13B6),
+            LIMB_PAIR(0xCB8AB5E7, 0x24751021), LIMB_PAIR(0x5C5010EB, 0xFC234449), LIMB_PAIR(0x4E5610A1, 0x5F1E717B), LIMB_PAIR(0xC2710CD5, 0x44DA5F18)
+        },
+        {   // 7 * 16^11 * B
+            LIMB_PAIR(0x89D8EACC, 0x9156FE6B), LIMB_PAIR(0xE23126A1, 0xE6B79451), LIMB_PAIR(0x3944EB4E, 0xBD7463D9), LIMB_PAIR(0x767203AE, 0x726373F6),
+            LIMB_PAIR(0xF1B82EB5, 0x033CC55F), LIMB_PAIR(0x411CAE52, 0xB15AE36D), LIMB_PAIR(0x8FFBACD3, 0xBA40B619), LIMB_PAIR(0x532E861F, 0x768EDCE1),
+            LIMB_PAIR(0xEB7EF68A, 0xE305CA72), LIMB_PAIR(0x70EADB23, 0x662CF31F), LIMB_PAIR(0xB4C45B68, 0x18F026FD), LIMB_PAIR(0xB5D2ECBD, 0x513B5384)
+        },
+        {   // 8 * 16^11 * B
+            LIMB_PAIR(0x8AF34CEB, 0x5E270287), LIMB_PAIR(0xB946D6AE, 0x900B0409), LIMB_PAIR(0xDABD8512, 0x6512EBF7), LIMB_PAIR(0x88258F81, 0x61D9B769),
+            LIMB_PAIR(0xC729989E, 0x46D46280), LIMB_PAIR(0x5368A5DD, 0x4B93FBD0), LIMB_PAIR(0xD1765A89, 0x63DF3F81), LIMB_PAIR(0xB9A0A223, 0x34CEBD64),
+            LIMB_PAIR(0x49B7D94B, 0xA6C5A713), LIMB_PAIR(0x23EB9446, 0xA3F3D158), LIMB_PAIR(0x77484834, 0x0416FBD2), LIMB_PAIR(0x2C70812F, 0x69D45E6F)
+        }
+    },
+#endif
+#if (12 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^12 * B
+            LIMB_PAIR(0x4F460EFB, 0x9FE62B43), LIMB_PAIR(0xA63607D6, 0xDED303D4), LIMB_PAIR(0xB7A0DA24, 0xF052210E), LIMB_PAIR(0x00545B93, 0x237E7DBE),
+            LIMB_PAIR(0xC53C1431, 0xCE16F74B), LIMB_PAIR(0x2072EDDE, 0x2B9725CE), LIMB_PAIR(0xB5B23EE7, 0xB8B9C36F), LIMB_PAIR(0x0B5CC908, 0x7E2E0E45),
+            LIMB_PAIR(0x6701B430, 0x013575ED), LIMB_PAIR(0x9F0BFD10, 0x231094E6), LIMB_PAIR(0x83E47F22, 0x75320F15), LIMB_PAIR(0xB11155E3, 0x71AFA699)
+        },
+        {   // 2 * 16^12 * B
+            LIMB_PAIR(0x473B50D6, 0xEA423C1C), LIMB_PAIR(0x3B38EF10, 0x51E87A1F), LIMB_PAIR(0xB2C9BE95, 0x9B84BF5F), LIMB_PAIR(0x78F89A1C, 0x00731FBC),
+            LIMB_PAIR(0x3953B61D, 0x65CE6F9B), LIMB_PAIR(0xAFA141E6, 0xC65839EA), LIMB_PAIR(0xA9F759FE, 0x0F435FFD), LIMB_PAIR(0xC2B1C28E, 0x021142E9),
+            LIMB_PAIR(0x48F81880, 0xE430C718), LIMB_PAIR(0x5ECEC119, 0xBF960C22), LIMB_PAIR(0x6BBA15E3, 0xB6DAE083), LIMB_PAIR(0x47E15808, 0x4C4D6F33)
+        },
+        {   // 3 * 16^12 * B
+            LIMB_PAIR(0x988F1970, 0x2F0CDDFC), LIMB_PAIR(0xB0B9F51B, 0x6B916227), LIMB_PAIR(0x779176BE, 0x6EC7B6C4), LIMB_PAIR(0xA88F9FA8, 0x38BF9500),
+            LIMB_PAIR(0xC17D1FC9, 0x18F7ECCF), LIMB_PAIR(0x51403C14, 0x6C75F5A6), LIMB_PAIR(0xF7EE0CDF, 0xDBDE712B), LIMB_PAIR(0xA7E47A22, 0x193FDDAA),
+            LIMB_PAIR(0x37E8876F, 0x1FD2C93C), LIMB_PAIR(0x18D1462C, 0xA2F61E5A), LIMB_PAIR(0x39241276, 0x5080F582), LIMB_PAIR(0xBF0D4969, 0x6A6FB99E)
+        },
+        {   // 4 * 16^12 * B
+            LIMB_PAIR(0xB6E423C6, 0xEEB122B5), LIMB_PAIR(0xF286FF8E, 0x939D7010), LIMB_PAIR(0x1DCF5D8C, 0x90A92A83), LIMB_PAIR(0x42C5EB10, 0x136FDA9F),
+            LIMB_PAIR(0x560855EB, 0x6A46C1BB), LIMB_PAIR(0xF893F09D, 0x2416BB38), LIMB_PAIR(0x8F71ACC1, 0xD71D1137), LIMB_PAIR(0xA31896EA, 0x75F76914),
+            LIMB_PAIR(0xA305BDD1, 0xF94CDFB1), LIMB_PAIR(0x9FF82C08, 0x0F364B9D), LIMB_PAIR(0xC3BB588A, 0x2A87D8A5), LIMB_PAIR(0x0BE8DCBA, 0x02218351)
+        },
+        {   // 5 * 16^12 * B
+            LIMB_PAIR(0x43307A7F, 0x9D5A7101), LIMB_PAIR(0xC47DA45F, 0xB063DE9E), LIMB_PAIR(0xBE927AD3, 0x22BBFE52), LIMB_PAIR(0xFD40426C, 0x1387C441),
+            LIMB_PAIR(0x5EAD2D14, 0x4AF76638), LIMB_PAIR(0xCA7C5830, 0xA08ED880), LIMB_PAIR(0x10211E3D, 0x0D13A6E6), LIMB_PAIR(0x7B806C03, 0x6A071CE1),
+            LIMB_PAIR(0x87978AF8, 0xB5D3C3D1), LIMB_PAIR(0x7F0E4413, 0x722B5A3D), LIMB_PAIR(0xBB477CA0, 0x0D7B4848), LIMB_PAIR(0xAF1EDC92, 0x3171B26A)
+        },
+        {   // 6 * 16^12 * B
+            LIMB_PAIR(0xB28A47D1, 0xA60DB7D8), LIMB_PAIR(0x1770A4F1, 0xA6BF14D6), LIMB_PAIR(0x53DDBD58, 0xD4A1F893), LIMB_PAIR(0x344243E9, 0x6C514A63),
+            LIMB_PAIR(0x97564CA8, 0xA92F3190), LIMB_PAIR(0x2275E119, 0xFF7BB84C), LIMB_PAIR(0xA4875150, 0x4F55FE37), LIMB_PAIR(0x3CF0835A, 0x221FD487),
+            LIMB_PAIR(0x3A156341, 0x2322204F), LIMB_PAIR(0xBA0A032D, 0xFB73E0E9), LIMB_PAIR(0x410F030E, 0xFCE0DD4C), LIMB_PAIR(0xFB924AAA, 0x48DAA596)
+        },
+        {   // 7 * 16^12 * B
+            LIMB_PAIR(0xC84C9793, 0x14F61D5D), LIMB_PAIR(0xEF418206, 0x9941F9E3), LIMB_PAIR(0x346277AC, 0xCDF5B88F), LIMB_PAIR(0x0E8A79A9, 0x58C837FA),
+            LIMB_PAIR(0x5CA59CC7, 0x6ECA8E66), LIMB_PAIR(0x2E38ACA0, 0xA847254B), LIMB_PAIR(0xD21E17CE, 0x31AFC708), LIMB_PAIR(0xCAD84AF7, 0x676DD6FC),
+            LIMB_PAIR(0x96FC9058, 0x0CF96885), LIMB_PAIR(0x7B56A01B, 0x1DDCBBF3), LIMB_PAIR(0x4935D66A, 0xDCC2E77D), LIMB_PAIR(0xC6A57F0A, 0x1C4F73F2)
+        },
+        {   // 8 * 16^12 * B
+            LIMB_PAIR(0xFC7C3484, 0xB36E706E), LIMB_PAIR(0xC3C1CF61, 0x73DFC9B4), LIMB_PAIR(0x781CC7E5, 0xEB1D79C9), LIMB_PAIR(0x7DAF675C, 0x70459ADB),
+            LIMB_PAIR(0x305FA0BB, 0x0E7A4FBD), LIMB_PAIR(0x54C663AD, 0x829D4CE0), LIMB_PAIR(0x2FE33848, 0xF421C383), LIMB_PAIR(0x1BF64C42, 0x795AC80D),
+            LIMB_PAIR(0x91B42BB3, 0x1B91DB49), LIMB_PAIR(0x4B02DCCA, 0x57269623), LIMB_PAIR(0x1F8C78DC, 0x9FDF9EE5), LIMB_PAIR(0x8CE21FD3, 0x5FE16284)
+        }
+    },
+#endif
+#if (13 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^13 * B
+            LIMB_PAIR(0x95115389, 0x315C29C7), LIMB_PAIR(0x862F74CE, 0xD7E0E507), LIMB_PAIR(0x85927432, 0x0C4A7621), LIMB_PAIR(0x4A25A1E4, 0x72DE6C98),
+            LIMB_PAIR(0x4D077C41, 0xE2790AAE), LIMB_PAIR(0xDB7469A3, 0x8B938270), LIMB_PAIR(0x8ABD16A2, 0x6EB632DC), LIMB_PAIR(0xAA064B72, 0x720814EC),
+            LIMB_PAIR(0xBF6AA310, 0xAE9AB553), LIMB_PAIR(0x806D6E1B, 0x050A50A9), LIMB_PAIR(0xADFF5139, 0x92BB7403), LIMB_PAIR(0x45BE618B, 0x0394D276)
+        },
+        {   // 2 * 16^13 * B
+            LIMB_PAIR(0xB23545A4, 0xF5396425), LIMB_PAIR(0x98FBB296, 0x15A7A27E), LIMB_PAIR(0x636FDD86, 0xAB6C52BC), LIMB_PAIR(0x419334EE, 0x79D995A8),
+            LIMB_PAIR(0x857EEDF4, 0x4D572251), LIMB_PAIR(0xE19E93C5, 0xE3724EDD), LIMB_PAIR(0x0B797035, 0x8A71420E), LIMB_PAIR(0x87ABE743, 0x3B3C8336),
+            LIMB_PAIR(0x1195DD75, 0xCD8A8EA6), LIMB_PAIR(0x1DD9A82F, 0xA504D8A8), LIMB_PAIR(0xA35879B6, 0x540DCA81), LIMB_PAIR(0x79C86A8A, 0x60DD16A3)
+        },
+        {   // 3 * 16^13 * B
+            LIMB_PAIR(0x153E47B8, 0x3501D6F8), LIMB_PAIR(0x14A2F60C, 0xB7A96754), LIMB_PAIR(0x455D9523, 0x112EE8B6), LIMB_PAIR(0x8112EA8A, 0x4E62A3C1),
+            LIMB_PAIR(0x7381E559, 0x35A2C848), LIMB_PAIR(0xD78082CB, 0x596FFEA6), LIMB_PAIR(0xDBA7B653, 0xCB9771EB), LIMB_PAIR(0x9B4DA685, 0x5A08B501),
+            LIMB_PAIR(0x516AB786, 0xC8D4AC04), LIMB_PAIR(0x5295B23D, 0x595AF321), LIMB_PAIR(0xDB0230C1, 0xD6EDD234), LIMB_PAIR(0x825B41CC, 0x0929EFE8)
+        },
+        {   // 4 * 16^13 * B
+            LIMB_PAIR(0xAD56651D, 0x8B3172B7), LIMB_PAIR(0x3FABD717, 0x01581B7A), LIMB_PAIR(0x424DF6E4, 0x2DC94DF6), LIMB_PAIR(0x2C29284F, 0x30376E5D),
+            LIMB_PAIR(0xCBD0F2D3, 0x5F0601D1), LIMB_PAIR(0x6132BB7F, 0x736E412F), LIMB_PAIR(0x238DDE87, 0x83604432), LIMB_PAIR(0xF5C0753C, 0x1E3A5272),
+            LIMB_PAIR(0x8159A59C, 0xD2918DA7), LIMB_PAIR(0x3F0713F3, 0x6BDC1CD9), LIMB_PAIR(0x4ACD6590, 0x565F7A93), LIMB_PAIR(0x4CB4C128, 0x53DAACEC)
+        },
+        {   // 5 * 16^13 * B
+            LIMB_PAIR(0x852CFDB0, 0x99852BC3), LIMB_PAIR(0x59D6ED0B, 0x2CC12E95), LIMB_PAIR(0x9B5AC27B, 0x70F9E2BF), LIMB_PAIR(0x7959AE99, 0x4F3B8C11),
+            LIMB_PAIR(0x9CC8A7D6, 0x4CA73BD7), LIMB_PAIR(0x47E9A9B2, 0x4D4A738F), LIMB_PAIR(0x42F5FE00, 0xF4CBF129), LIMB_PAIR(0xBDBF0752, 0x01A13FF9),
+            LIMB_PAIR(0x2FF26412, 0x55B6C9C8), LIMB_PAIR(0x1FB667A8, 0x1AC4A8C9), LIMB_PAIR(0xEB778BF2, 0xD527BFCF), LIMB_PAIR(0x7012A3BE, 0x303337DA)
+        },
+        {   // 6 * 16^13 * B
+            LIMB_PAIR(0xFAD2FDD1, 0x976D3CCB), LIMB_PAIR(0x37A640A8, 0xCB888397), LIMB_PAIR(0x6734CB25, 0x2FF00C1D), LIMB_PAIR(0x789C2D2B, 0x269FF4DC),
+            LIMB_PAIR(0x8C1C9D7C, 0x95542222), LIMB_PAIR(0x1A9B340F, 0x01FAC137), LIMB_PAIR(0x925B48D7, 0x7E8D9177), LIMB_PAIR(0x61B3E31B, 0x53F8AD56),
+            LIMB_PAIR(0xC08D678D, 0x0C003FBD), LIMB_PAIR(0x7EAD2B17, 0x4D982FA3), LIMB_PAIR(0xB2E582F1, 0xC07E6BCD), LIMB_PAIR(0xDF412A44, 0x296C7291)
+        },
+        {   // 7 * 16^13 * B
+            LIMB_PAIR(0xDAB8B59E, 0xDFB23205), LIMB_PAIR(0xC8092250, 0x465AEAA0), LIMB_PAIR(0x9A725D18, 0xD133C118), LIMB_PAIR(0x61F117D1, 0x23273702),
+            LIMB_PAIR(0x33DAF397, 0x7903DE2B), LIMB_PAIR(0xC9A624B3, 0xD0FF0619), LIMB_PAIR(0x555B3E18, 0x8A1D252B), LIMB_PAIR(0x52E0B7C0, 0x2B6D581C),
+            LIMB_PAIR(0x623E7986, 0x3D0543D3), LIMB_PAIR(0xC278A354, 0x679414C2), LIMB_PAIR(0x726196F6, 0xAE43F0CC), LIMB_PAIR(0x8245EABA, 0x7836C41F)
+        },
+        {   // 8 * 16^13 * B
+            LIMB_PAIR(0x8011937C, 0xCA651E84), LIMB_PAIR(0x6EF41A28, 0xC6B0C46E), LIMB_PAIR(0x5F3F8D52, 0xB7021BA7), LIMB_PAIR(0xEAD7B9FD, 0x119DFF99),
+            LIMB_PAIR(0x49E95A81, 0xE7A254DB), LIMB_PAIR(0x08B0AD73, 0x5192D5D0), LIMB_PAIR(0xD00AFC07, 0x4D20E5B1), LIMB_PAIR(0x2CF25F38, 0x5D55F801),
+            LIMB_PAIR(0xF4B31D4D, 0x43EADFCB), LIMB_PAIR(0x11148892, 0xC6503F74), LIMB_PAIR(0x060D3B17, 0xFEEE68C5), LIMB_PAIR(0xDD4A0AC8, 0x329293B3)
+        }
+    },
+#endif
+#if (14 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^14 * B
+            LIMB_PAIR(0x5D7CB208, 0x2879852D), LIMB_PAIR(0x687DF2E7, 0xB8DEDD70), LIMB_PAIR(0x21687891, 0xDC0BFFAB), LIMB_PAIR(0x677DAA35, 0x2B44C043),
+            LIMB_PAIR(0xE194961A, 0x4E59214F), LIMB_PAIR(0x0D71CD4F, 0x49BE7DC7), LIMB_PAIR(0x3B50F22D, 0x9300CFD2), LIMB_PAIR(0xFC917232, 0x4789D446),
+            LIMB_PAIR(0x074EB78E, 0x1A1C87AB), LIMB_PAIR(0x99DAF467, 0xFAC6D18E), LIMB_PAIR(0x484F9067, 0x3EACBBCD), LIMB_PAIR(0x2BB9A4E4, 0x60C52EEF)
+        },
+        {   // 2 * 16^14 * B
+            LIMB_PAIR(0x7CAE6D11, 0x702BC5C2), LIMB_PAIR(0x54A48CAB, 0x44C7699B), LIMB_PAIR(0xBA492EB2, 0xEFBC4056), LIMB_PAIR(0xD9B6676D, 0x70D77248),
+            LIMB_PAIR(0x3BFD8BF1, 0x0B5D89BC), LIMB_PAIR(0xC9F3551A, 0xB06B9237), LIMB_PAIR(0xD53028F5, 0x0E4C16B0), LIMB_PAIR(0x2CCFCAAB, 0x10BC9C31),
+            LIMB_PAIR(0x3EC2A05B, 0xAA8AE84B), LIMB_PAIR(0xED1781E0, 0x98699EF4), LIMB_PAIR(0x708E85D1, 0x794513E4), LIMB_PAIR(0xA976F413, 0x63755BD3)
+        },
+        {   // 3 * 16^14 * B
+            LIMB_PAIR(0x97F1ACB7, 0x3DC71018), LIMB_PAIR(0xC165BBD8, 0x5DDA7D5E), LIMB_PAIR(0x0FA1020F, 0x508E5B9C), LIMB_PAIR(0x37C52A56, 0x27637517),
+            LIMB_PAIR(0x2AD10853, 0xB55FA03E), LIMB_PAIR(0x9EE63569, 0x356F7590), LIMB_PAIR(0xBE69B890, 0x9FF9F1FD), LIMB_PAIR(0x8BC16F84, 0x0D8CC1C4),
+            LIMB_PAIR(0x6EB419A9, 0x029402D3), LIMB_PAIR(0x77B460A5, 0xF0B44E7E), LIMB_PAIR(0xD43C4956, 0xCFA86230), LIMB_PAIR(0x7AD166E7, 0x70C2DD8A)
+        },
+        {   // 4 * 16^14 * B
+            LIMB_PAIR(0xB8ED7E13, 0x91D4967D), LIMB_PAIR(0xD776817A, 0x74252F0A), LIMB_PAIR(0x0D852564, 0xE40982E0), LIMB_PAIR(0x16A53CE5, 0x32B86138),
+            LIMB_PAIR(0x9F6FEC0E, 0x65619450), LIMB_PAIR(0x46C6518D, 0xEE2E7EA9), LIMB_PAIR(0x67E09B5C, 0x9733C1F3), LIMB_PAIR(0x63948495, 0x2E0FAC63),
+            LIMB_PAIR(0xE448CD64, 0x79E7F7BE), LIMB_PAIR(0x087886D0, 0x6AC83A67), LIMB_PAIR(0xA0E4DB2E, 0xF89FD4D9), LIMB_PAIR(0x735A4F41, 0x4179215C)
+        },
+        {   // 5 * 16^14 * B
+            LIMB_PAIR(0x286BCD34, 0xE4AE33B9), LIMB_PAIR(0x559DD6DC, 0xB7EF7EB6), LIMB_PAIR(0xB3D38E1F, 0x278B141F), LIMB_PAIR(0x2241C286, 0x31FA8566),
+            LIMB_PAIR(0xD7DCED2A, 0x8C7094E7), LIMB_PAIR(0x47D39C70, 0x97FB8AC3), LIMB_PAIR(0xA906D902, 0xE13BE033), LIMB_PAIR(0x0CD99D76, 0x700344A3),
+            LIMB_PAIR(0x2E3622F4, 0xAF826C42), LIMB_PAIR(0x9833502D, 0xC1202987), LIMB_PAIR(0x2B389123, 0x9BC1B7E1), LIMB_PAIR(0xA9952489, 0x24BB2312)
+        },
+        {   // 6 * 16^14 * B
+            LIMB_PAIR(0xF5F85C6B, 0x41F80C2A), LIMB_PAIR(0x04FA6794, 0x687284C3), LIMB_PAIR(0xA3BA1BAD, 0x8945DF99), LIMB_PAIR(0xFFEB5D16, 0x0D1D2AF9),
+            LIMB_PAIR(0x32DE67C3, 0xB1A8ED17), LIMB_PAIR(0x461B4948, 0x3CB49418), LIMB_PAIR(0x76CFBCD2, 0x8EBD4343), LIMB_PAIR(0x1E188008, 0x0FEE3E87),
+            LIMB_PAIR(0x32621EDF, 0xA9DA8AA1), LIMB_PAIR(0x59226579, 0x30B822A1), LIMB_PAIR(0xA79AC193, 0x4004197B), LIMB_PAIR(0x18531D76, 0x16ACD797)
+        },
+        {   // 7 * 16^14 * B
+            LIMB_PAIR(0x7887B6AD, 0xC959C6C5), LIMB_PAIR(0x5F90FEBA, 0x94E19EAD), LIMB_PAIR(0xA342F504, 0x16E24E62), LIMB_PAIR(0x18161700, 0x164ED34B),
+            LIMB_PAIR(0x2D9B1D3D, 0x72DF72AF), LIMB_PAIR(0xA432245A, 0x63462A36), LIMB_PAIR(0x16B39637, 0x3ECEA079), LIMB_PAIR(0xB9302309, 0x123E0EF6),
+            LIMB_PAIR(0x192FE69A, 0x487ED94C), LIMB_PAIR(0x3A911513, 0x61AE2CEA), LIMB_PAIR(0xB9A4DE27, 0x877BF6D3), LIMB_PAIR(0x1073F3EB, 0x78DA0FC6)
+        },
+        {   // 8 * 16^14 * B
+            LIMB_PAIR(0x680C3A94, 0xA29F80F1), LIMB_PAIR(0x1AE9E7E6, 0x71F77E15), LIMB_PAIR(0x48017973, 0x1100F158), LIMB_PAIR(0x16B38DDD, 0x054AA4B3),
+            LIMB_PAIR(0xE52BC66A, 0x5BF15D28), LIMB_PAIR(0x70F01A8E, 0x2C47E318), LIMB_PAIR(0x06C28BDD, 0x2419AFBC), LIMB_PAIR(0x256B173A, 0x2D25DEEB),
+            LIMB_PAIR(0x19267CB8, 0xDFC8468D), LIMB_PAIR(0x66E54DAF, 0x0B28789C), LIMB_PAIR(0x666EEC17, 0x2AEB1D2A), LIMB_PAIR(0xAB7DA760, 0x134610A6)
+        }
+    },
+#endif
+#if (15 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^15 * B
+            LIMB_PAIR(0xDC028C3C, 0xD91430E0), LIMB_PAIR(0x5217C771, 0x0EB955A8), LIMB_PAIR(0x2C99A1FA, 0x4B09E1ED), LIMB_PAIR(0xBD6A743C, 0x42881AF2),
+            LIMB_PAIR(0x7C59B23F, 0xCAF55EC2), LIMB_PAIR(0x154D04F2, 0x99AEED3E), LIMB_PAIR(0xE14141F4, 0x68441D72), LIMB_PAIR(0x3932A0A2, 0x14034513),
+            LIMB_PAIR(0xAB5CAD3D, 0x7BFEC69A), LIMB_PAIR(0x4CB2CFAD, 0xC23E8CD3), LIMB_PAIR(0xFB37D6A2, 0x685DD14B), LIMB_PAIR(0x15677A18, 0x0AD6D644)
+        },
+        {   // 2 * 16^15 * B
+            LIMB_PAIR(0x47927E9F, 0x79148928), LIMB_PAIR(0x370AA877, 0x33DAD6EF), LIMB_PAIR(0x11122703, 0x1F8F24FA), LIMB_PAIR(0x2ADF9592, 0x5265AC2F),
+            LIMB_PAIR(0x417BECB5, 0x781A439E), LIMB_PAIR(0xD10E0266, 0x4AC5938C), LIMB_PAIR(0x0692AC24, 0x5DA38511), LIMB_PAIR(0xADE31233, 0x11B065A2),
+            LIMB_PAIR(0x9AFCB346, 0x405FDD30), LIMB_PAIR(0x28E63F54, 0xD9723D44), LIMB_PAIR(0x5F65AAAE, 0x94C01DF0), LIMB_PAIR(0xE14C0809, 0x43E4DC3A)
+        },
+        {   // 3 * 16^15 * B
+            LIMB_PAIR(0xADC2C6A3, 0xEA6F7AC3), LIMB_PAIR(0xE9717C94, 0xD0E928F6), LIMB_PAIR(0xD645EAF5, 0xE2D379EA), LIMB_PAIR(0xC51FFBBE, 0x46DD8785),
+            LIMB_PAIR(0xA938A517, 0xBC12C7F1), LIMB_PAIR(0x3180B2E1, 0x473028AB), LIMB_PAIR(0xFBCD254A, 0x3F78571E), LIMB_PAIR(0x6FF6F90F, 0x74E53442),
+            LIMB_PAIR(0x375C8898, 0x709801BE), LIMB_PAIR(0xE3FD8348, 0x4B06DAB5), LIMB_PAIR(0x27230714, 0x75880CED), LIMB_PAIR(0xDD2F4C42, 0x2B09468F)
+        },
+        {   // 4 * 16^15 * B
+            LIMB_PAIR(0x82FFA02A, 0x5B979465), LIMB_PAIR(0xFEA8F549, 0xDA096A51), LIMB_PAIR(0x5F77AF9B, 0xA0635137), LIMB_PAIR(0x201D1E76, 0x1BCFDE61),
+            LIMB_PAIR(0xB701CB96, 0x97C749EE), LIMB_PAIR(0xB6A369C3, 0x83F438D4), LIMB_PAIR(0x9A402CD9, 0x62962B8B), LIMB_PAIR(0x9888DF7B, 0x6976C750),
+            LIMB_PAIR(0x246A59A2, 0x4A4A5490), LIMB_PAIR(0xE87FDD90, 0xD63EBDDE), LIMB_PAIR(0x0D2371FA, 0xD9437C67), LIMB_PAIR(0xD30F8ED6, 0x69E87308)
+        },
+        {   // 5 * 16^15 * B
+            LIMB_PAIR(0x8BC80303, 0x0F80BF02), LIMB_PAIR(0x7A18CEFB, 0x6AAE16B3), LIMB_PAIR(0xD72CD6A3, 0xDD47EA47), LIMB_PAIR(0xF4ED39AA, 0x61943588),
+            LIMB_PAIR(0x5656BEB0, 0x435A8BB1), LIMB_PAIR(0x4F4D5BCA, 0xF8FAC9BA), LIMB_PAIR(0x1548C075, 0xB9B278C4), LIMB_PAIR(0xE892B622, 0x3EB0EF76),
+            LIMB_PAIR(0x91039F85, 0xD26E5C3E), LIMB_PAIR(0xF6F33AA9, 0xC0E9E77D), LIMB_PAIR(0x70066A93, 0xE8968C55), LIMB_PAIR(0x1FAAADDD, 0x3C34D188)
+        },
+        {   // 6 * 16^15 * B
+            LIMB_PAIR(0x2FFFE0D9, 0xBD5B0B8F), LIMB_PAIR(0x3ED24FB9, 0x6AA25410), LIMB_PAIR(0xB26821C4, 0x2AC7D7BC), LIMB_PAIR(0x60DCA36A, 0x605B394B),
+            LIMB_PAIR(0xA09F9EC0, 0x3F9D2B5E), LIMB_PAIR(0xB623A890, 0x1DAB3B6F), LIMB_PAIR(0x72D926C4, 0xA09BA3EA), LIMB_PAIR(0x3FD8B36D, 0x37419351),
+            LIMB_PAIR(0x5A9D1ED2, 0xB4E856E4), LIMB_PAIR(0x6C97A9A2, 0xEFE84876), LIMB_PAIR(0x1E5EEE7D, 0xB104CF64), LIMB_PAIR(0x88A71C8F, 0x2F50B81C)
+        },
+        {   // 7 * 16^15 * B
+            LIMB_PAIR(0xA7DA522A, 0x2B552CA0), LIMB_PAIR(0x449B0250, 0x3230B336), LIMB_PAIR(0xA4B99FB9, 0xF2C4C5BC), LIMB_PAIR(0x58074A22, 0x7B2C6749),
+            LIMB_PAIR(0xFC6811BB, 0x31723C61), LIMB_PAIR(0x6211800F, 0x9CB45048), LIMB_PAIR(0x47995753, 0x768933D3), LIMB_PAIR(0x02752FCD, 0x3491A535),
+            LIMB_PAIR(0x3ED28CDF, 0xD5516588), LIMB_PAIR(0xD362DE39, 0x12D84FD2), LIMB_PAIR(0xE3378E4F, 0x0A874AD3), LIMB_PAIR(0x7C763E74, 0x000D2B1F)
+        },
+        {   // 8 * 16^15 * B
+            LIMB_PAIR(0x3E94A8AB, 0x9624778C), LIMB_PAIR(0xE9A78BEC, 0x0AD6F3CE), LIMB_PAIR(0x0D743C4F, 0x948AC781), LIMB_PAIR(0xAAECFCCC, 0x76627935),
+            LIMB_PAIR(0xD06D4A67, 0x3D420811), LIMB_PAIR(0x90E0FFE3, 0xBEFC0485), LIMB_PAIR(0xBD487BDE, 0xF870C6B7), LIMB_PAIR(0x319AFA28, 0x6E2A7316),
+            LIMB_PAIR(0xD6D59A9F, 0x56A8AC24), LIMB_PAIR(0x3096F006, 0xC8DB753E), LIMB_PAIR(0x8F4C5299, 0x477F41E6), LIMB_PAIR(0xF6C86114, 0x588D851C)
+        }
+    },
+#endif
+#if (16 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^16 * B
+            LIMB_PAIR(0x77D1F515, 0xCD2A65E7), LIMB_PAIR(0x8FAA60F1, 0x54899187), LIMB_PAIR(0xDABC06E5, 0xB1B73BBC), LIMB_PAIR(0xA97CC9FB, 0x654878CB),
+            LIMB_PAIR(0x8DF6B0FE, 0x51138EC7), LIMB_PAIR(0xE575F51B, 0x5397DA89), LIMB_PAIR(0x717AF1B9, 0x09207A1D), LIMB_PAIR(0x2B20D650, 0x2102FDBA),
+            LIMB_PAIR(0x055CE6A1, 0x969EE405), LIMB_PAIR(0x1251AD29, 0x36BCA768), LIMB_PAIR(0xAA7DA415, 0x3A1AF517), LIMB_PAIR(0x29ECB2BA, 0x0AD725DB)
+        },
+        {   // 2 * 16^16 * B
+            LIMB_PAIR(0x9B056F85, 0xFEC7BC0C), LIMB_PAIR(0xE7F5FFD7, 0x537D5268), LIMB_PAIR(0x4312AEFA, 0x77AFC662), LIMB_PAIR(0x02399FD9, 0x4F675F53),
+            LIMB_PAIR(0x834E2457, 0xDC4267B1), LIMB_PAIR(0x70CE1BC5, 0xB67544B5), LIMB_PAIR(0xF7D15ED7, 0x1AF07A0B), LIMB_PAIR(0x71A03650, 0x4AEFCFFB),
+            LIMB_PAIR(0x0415171E, 0xC32D3636), LIMB_PAIR(0x8998483B, 0xCD2BEF11), LIMB_PAIR(0xD0945110, 0x870A6EAD), LIMB_PAIR(0xA2A86561, 0x0BCCBB72)
+        },
+        {   // 3 * 16^16 * B
+            LIMB_PAIR(0x50FE1296, 0x186D5E4C), LIMB_PAIR(0xFEE89F7E, 0xE0397B82), LIMB_PAIR(0x507031B0, 0x3BC7F6C5), LIMB_PAIR(0x108F37C2, 0x6678FD69),
+            LIMB_PAIR(0xEAB1A9C8, 0x185E962F), LIMB_PAIR(0x65147DCD, 0x86E7E635), LIMB_PAIR(0xBB5B6DF2, 0xB092E031), LIMB_PAIR(0x59D6B73E, 0x4024F0AB),
+            LIMB_PAIR(0x636863C2, 0x1586FA31), LIMB_PAIR(0x572D33F2, 0x07F68C48), LIMB_PAIR(0x789EAEFC, 0x4F73CC9F), LIMB_PAIR(0x8EAD4701, 0x2D42E210)
+        },
+        {   // 4 * 16^16 * B
+            LIMB_PAIR(0x0F537593, 0x21717B0D), LIMB_PAIR(0x131E064C, 0x914E690B), LIMB_PAIR(0x752AE09F, 0x1BB687AE), LIMB_PAIR(0x9B423C6E, 0x420BF3A7),
+            LIMB_PAIR(0x94DFD29B, 0x97F51315), LIMB_PAIR(0x313F4C6A, 0x6155985D), LIMB_PAIR(0x08455010, 0xEBA13F07), LIMB_PAIR(0xB8D2D322, 0x676B2608),
+            LIMB_PAIR(0x1C5B2B47, 0x8138BA65), LIMB_PAIR(0x311B1B80, 0x8671B6EC), LIMB_PAIR(0xBC3135B0, 0x7BFF0CB1), LIMB_PAIR(0x9C0CF1E0, 0x745D2FFA)
+        },
+        {   // 5 * 16^16 * B
+            LIMB_PAIR(0x21D34E6A, 0x6036DF57), LIMB_PAIR(0x997BB3D0, 0xB1DB8827), LIMB_PAIR(0xC8756AFA, 0xD3C209C3), LIMB_PAIR(0x4C1DC839, 0x06E15BE5),
+            LIMB_PAIR(0x2BC9C8BD, 0xBF525A1E), LIMB_PAIR(0x26479D81, 0xEA5B2608), LIMB_PAIR(0xDF0155DB, 0xD511C70E), LIMB_PAIR(0x960CF5D0, 0x1AE23CEB),
+            LIMB_PAIR(0x1932994A, 0x5B725D87), LIMB_PAIR(0xCEB1DAB0, 0x32351CB5), LIMB_PAIR(0xDAB7CA05, 0x7DC41549), LIMB_PAIR(0x278EC1F7, 0x58DED861)
+        },
+        {   // 6 * 16^16 * B
+            LIMB_PAIR(0xB6C2C9A8, 0x2DFB5BA8), LIMB_PAIR(0xF52C598C, 0x48EEEF8E), LIMB_PAIR(0xF12D1573, 0x33809107), LIMB_PAIR(0x531D5BD8, 0x08BA696B),
+            LIMB_PAIR(0xF266C55C, 0xD8173793), LIMB_PAIR(0xCC454E49, 0xC8C976C5), LIMB_PAIR(0xBC26C3A8, 0x5CE382F8), LIMB_PAIR(0x5485F6F9, 0x2FF39DE8),
+            LIMB_PAIR(0xC3EFC57A, 0x77ED3EEE), LIMB_PAIR(0xD4FF4811, 0x04E05517), LIMB_PAIR(0xF1A671CB, 0xEA3D7A3F), LIMB_PAIR(0x947CFE54, 0x120633B4)
+        },
+        {   // 7 * 16^16 * B
+            LIMB_PAIR(0x4912100A, 0x82BD3147), LIMB_PAIR(0x7E6FBE06, 0xDE237B6D), LIMB_PAIR(0x11EA79C6, 0xE11E7619), LIMB_PAIR(0xCB393BDE, 0x07433BE3),
+            LIMB_PAIR(0x91610042, 0x0B949878), LIMB_PAIR(0xECEBFAE8, 0x4EE7B13C), LIMB_PAIR(0x94F0A4C0, 0x70BE7395), LIMB_PAIR(0xB4D59185, 0x35D30A99),
+            LIMB_PAIR(0x5CE997F4, 0xFF7944C0), LIMB_PAIR(0xB05C51A3, 0x575D3DE4), LIMB_PAIR(0x5A76847C, 0x583381FD), LIMB_PAIR(0x7AF6DA9F, 0x2D873EDE)
+        },
+        {   // 8 * 16^16 * B
+            LIMB_PAIR(0x4E5DF981, 0xAA6202E1), LIMB_PAIR(0x5015E1F5, 0xA20D5917), LIMB_PAIR(0xBAE21D6C, 0x18A275D3), LIMB_PAIR(0x01600253, 0x0543618A),
+            LIMB_PAIR(0x43373409, 0x157A3164), LIMB_PAIR(0xF4AA81D9, 0xFAB8B7EE), LIMB_PAIR(0xF5A64806, 0xB093FEE6), LIMB_PAIR(0x707FA7B6, 0x2E773654),
+            LIMB_PAIR(0x974C23C1, 0x0DEABDF4), LIMB_PAIR(0x9DCE4693, 0xAA6F0A25), LIMB_PAIR(0xA29ABA2C, 0x04202CB8), LIMB_PAIR(0x2D07960D, 0x4B144336)
+        }
+    },
+#endif
+#if (17 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^17 * B
+            LIMB_PAIR(0x57C5715E, 0x299B1C3F), LIMB_PAIR(0x6B686D90, 0x96CB929E), LIMB_PAIR(0x47235AB3, 0x30048064), LIMB_PAIR(0xA44D9FE1, 0x2C435C24),
+            LIMB_PAIR(0x53242CEC, 0x47B837F7), LIMB_PAIR(0xC04212F2, 0x256DC48C), LIMB_PAIR(0xE1D928C5, 0xE222FBFB), LIMB_PAIR(0xAD8A2C07, 0x48EA295B),
+            LIMB_PAIR(0x80F8833F, 0x0607C97C), LIMB_PAIR(0xCA25EC5B, 0x0E851578), LIMB_PAIR(0x161EBB6F, 0x54F7450B), LIMB_PAIR(0xA0DEF80E, 0x7BCB4792)
+        },
+        {   // 2 * 16^17 * B
+            LIMB_PAIR(0x045224C2, 0x1CECD0A0), LIMB_PAIR(0x69E53952, 0x757F1B1B), LIMB_PAIR(0x5289F681, 0x775B7A92), LIMB_PAIR(0x16736148, 0x1B6CC620),
+            LIMB_PAIR(0x2BC73659, 0x8487E3D0), LIMB_PAIR(0x059979DF, 0x4BAF8445), LIMB_PAIR(0xDCAD6FBF, 0xD17C975A), LIMB_PAIR(0xDEFC96B6, 0x57369F0B),
+            LIMB_PAIR(0x75638698, 0xF1A99901), LIMB_PAIR(0xEEAA60D3, 0x353DD1BE), LIMB_PAIR(0x4C9BA488, 0x84947133), LIMB_PAIR(0x43ADE311, 0x63FA6E68)
+        },
+        {   // 3 * 16^17 * B
+            LIMB_PAIR(0xD24B5EB7, 0x2195BECD), LIMB_PAIR(0xC0CD44F9, 0x5E41F18C), LIMB_PAIR(0x41CA9EDE, 0xDF280744), LIMB_PAIR(0xF35B7D67, 0x07073B98),
+            LIMB_PAIR(0x6597C168, 0xD15C2053), LIMB_PAIR(0x98D28789, 0x9F737400), LIMB_PAIR(0x3257BA1F, 0x18AEE7F1), LIMB_PAIR(0x07346F14, 0x3418BFDA),
+            LIMB_PAIR(0x4CE530D4, 0xD03C676C), LIMB_PAIR(0x3B5DF9F4, 0x0B64C047), LIMB_PAIR(0x19B3A31E, 0x065CEF8B), LIMB_PAIR(0x533102C9, 0x3084D661)
+        },
+        {   // 4 * 16^17 * B
+            LIMB_PAIR(0x760321FD, 0x9A6CE876), LIMB_PAIR(0x9EB63AD8, 0x7FE2B510), LIMB_PAIR(0x8AC80592, 0x00E7D4AE), LIMB_PAIR(0xBB6F723A, 0x73D86B7A),
+            LIMB_PAIR(0xBF8469AD, 0xE1F6B79E), LIMB_PAIR(0xE2663135, 0x15801004), LIMB_PAIR(0xAF74181B, 0x9A498330), LIMB_PAIR(0x049B673C, 0x3BA2504F),
+            LIMB_PAIR(0x6DBA5AB6, 0x0B52B560), LIMB_PAIR(0xBBB1EDAB, 0xA9134F0F), LIMB_PAIR(0x9B04A635, 0x30A9520D), LIMB_PAIR(0x7973E5DB, 0x6813B8F3)
+        },
+        {   // 5 * 16^17 * B
+            LIMB_PAIR(0xF3157E29, 0xF194CA56), LIMB_PAIR(0x5EF528A5, 0x136D3570), LIMB_PAIR(0x8B0599BC, 0xDD4CEF77), LIMB_PAIR(0x24F833ED, 0x7D5472AF),
+            LIMB_PAIR(0x334127C1, 0x9854B054), LIMB_PAIR(0x82FBFF25, 0x105D0478), LIMB_PAIR(0x44186F4F, 0xDB49F7F9), LIMB_PAIR(0xBED0B900, 0x1768E838),
+            LIMB_PAIR(0xAF33DA47, 0xD0EF874D), LIMB_PAIR(0xB6E339F9, 0x00D3BE5D), LIMB_PAIR(0x9C9CEECE, 0x3F2A8A2F), LIMB_PAIR(0x2352435A, 0x5D1AEB79)
+        },
+        {   // 6 * 16^17 * B
+            LIMB_PAIR(0xB61BA775, 0x12C7BFAE), LIMB_PAIR(0xE263BFFD, 0xB84E621F), LIMB_PAIR(0x5C840DCF, 0x0B47A5C3), LIMB_PAIR(0xCCAF8634, 0x7E83BE0B),
+            LIMB_PAIR(0x19CD63CA, 0xF59E6BB3), LIMB_PAIR(0x21D06839, 0x670C1592), LIMB_PAIR(0x2150CAB6, 0xB06D565B), LIMB_PAIR(0x104F12A3, 0x20FB199D),
+            LIMB_PAIR(0x6D99C120, 0x61943DEE), LIMB_PAIR(0x460B9FE0, 0x86101F2E), LIMB_PAIR(0x8EE8598D, 0x6BB2F151), LIMB_PAIR(0xFCC475CC, 0x76B76289)
+        },
+        {   // 7 * 16^17 * B
+            LIMB_PAIR(0x522EC0B3, 0x4245F1A1), LIMB_PAIR(0x2A75656D, 0x558785B2), LIMB_PAIR(0x48A1B3C0, 0x1D485A25), LIMB_PAIR(0xD58FE09F, 0x60959ECC),
+            LIMB_PAIR(0x756286FA, 0x791B4CC1), LIMB_PAIR(0xD74A157C, 0xDBCED317), LIMB_PAIR(0xEA72BDE6, 0x7E732421), LIMB_PAIR(0x1131C8E9, 0x01FE1849),
+            LIMB_PAIR(0xA8ED7A09, 0x3EBFEB7B), LIMB_PAIR(0xE502789C, 0x49FDC2BB), LIMB_PAIR(0x3C119428, 0x44EBCE5D), LIMB_PAIR(0xBE947F4A, 0x35E1EB55)
+        },
+        {   // 8 * 16^17 * B
+            LIMB_PAIR(0x726CCC74, 0x14FD6DFA), LIMB_PAIR(0x2F53B965, 0x3B084CFE), LIMB_PAIR(0x52A2C8B4, 0xF33AE4F5), LIMB_PAIR(0x0D40166A, 0x59AAB07A),
+            LIMB_PAIR(0xC5738DD3, 0xDBDAE701), LIMB_PAIR(0xB26F1BEE, 0xF9C6F635), LIMB_PAIR(0x42F15EF4, 0x61E96A80), LIMB_PAIR(0xAF60A4D8, 0x3AA1D11F),
+            LIMB_PAIR(0x925EAC25, 0x77BCEC4C), LIMB_PAIR(0x60137738, 0x18487184), LIMB_PAIR(0xFEA9F451, 0x5B374337), LIMB_PAIR(0xC8E6AA46, 0x1865E78E)
+        }
+    },
+#endif
+#if (18 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^18 * B
+            LIMB_PAIR(0x1C529CCB, 0x967C54E9), LIMB_PAIR(0x64C635FB, 0x30F62692), LIMB_PAIR(0x78121965, 0x2747AFF4), LIMB_PAIR(0xEAF66F5C, 0x17038418),
+            LIMB_PAIR(0xB66E1F7A, 0xCCC4B7C7), LIMB_PAIR(0xF50C2F7E, 0x44157E25), LIMB_PAIR(0x713EAF1C, 0x3EF06DFC), LIMB_PAIR(0x52DA63F7, 0x582F4467),
+            LIMB_PAIR(0x20324CE4, 0xC6317BD3), LIMB_PAIR(0xA4488BC4, 0xA81042E8), LIMB_PAIR(0x4E5A1364, 0xB21EF18B), LIMB_PAIR(0xCDA28DC9, 0x0C2A1C4B)
+        },
+        {   // 2 * 16^18 * B
+            LIMB_PAIR(0x69BD6945, 0xEDC48148), LIMB_PAIR(0xBE1C8D22, 0x0D6D907D), LIMB_PAIR(0xD55CC5AB, 0xC63BD212), LIMB_PAIR(0xA314DC83, 0x5A6A9B30),
+            LIMB_PAIR(0x6F1F0447, 0xD24DC7D0), LIMB_PAIR(0xDB87C059, 0xB2269E3E), LIMB_PAIR(0xFBB2D28F, 0xD15B0272), LIMB_PAIR(0xC6F64877, 0x7C558BD1),
+            LIMB_PAIR(0xD396463D, 0xD0EC1524), LIMB_PAIR(0xC35A24F0, 0x12BB628A), LIMB_PAIR(0x1CBC5FA4, 0xA50C3A79), LIMB_PAIR(0x0AFBAFC3, 0x0404A5CA)
+        },
+        {   // 3 * 16^18 * B
+            LIMB_PAIR(0x2A416FD1, 0x62BC9E1B), LIMB_PAIR(0xE350598B, 0xB5C6F728), LIMB_PAIR(0x3D5D6967, 0x04343FD8), LIMB_PAIR(0xE7F8EE98, 0x39527516),
+            LIMB_PAIR(0x0AA743D6, 0x8C1F4007), LIMB_PAIR(0x5B265EE8, 0xCCBAD0CB), LIMB_PAIR(0x668FD2DE, 0x574B046B), LIMB_PAIR(0xCADD9633, 0x46395BFD),
+            LIMB_PAIR(0x1A5D9A9C, 0x117FDB2D), LIMB_PAIR(0xD1005C2A, 0x9C7745BC), LIMB_PAIR(0x54D56FEA, 0xEFD4BEF1), LIMB_PAIR(0xE822D016, 0x76579A29)
+        },
+        {   // 4 * 16^18 * B
+            LIMB_PAIR(0x52B434F2, 0x333CB513), LIMB_PAIR(0x93DE80E1, 0xD8322849), LIMB_PAIR(0x750D35CE, 0xB5512887), LIMB_PAIR(0x2A2777C1, 0x02C514BB),
+            LIMB_PAIR(0x49C02A17, 0x45B68E7E), LIMB_PAIR(0xBCA9A37F, 0x23CD51A2), LIMB_PAIR(0xEC224C1B, 0x3ED65F11), LIMB_PAIR(0x9E05BDB1, 0x43A384DC),
+            LIMB_PAIR(0x8BF1B645, 0x684BD5DA), LIMB_PAIR(0xF6B54B53, 0xFB8BD37E), LIMB_PAIR(0xA9B0D253, 0x313916D7), LIMB_PAIR(0x61548059, 0x11609209)
+        },
+        {   // 5 * 16^18 * B
+            LIMB_PAIR(0x369B4DCD, 0x7A385616), LIMB_PAIR(0x655C3563, 0x75C02CA7), LIMB_PAIR(0xD4F18021, 0x7DC21BF9), LIMB_PAIR(0x91E6E042, 0x2F637D74),
+            LIMB_PAIR(0x29DACFAA, 0xB44D1669), LIMB_PAIR(0x8413598F, 0xDA529F4C), LIMB_PAIR(0x453D5559, 0xE9EF63CA), LIMB_PAIR(0xC5698E0B, 0x351E125B),
+            LIMB_PAIR(0x1AF67BBE, 0xD4B49B46), LIMB_PAIR(0xC8AB8961, 0xD603037A), LIMB_PAIR(0xF9A699FB, 0x71DEE19F), LIMB_PAIR(0xE7CE2A9A, 0x7F182D06)
+        },
+        {   // 6 * 16^18 * B
+            LIMB_PAIR(0x8E217522, 0x09454B72), LIMB_PAIR(0xD484B8D8, 0xAA58E8F4), LIMB_PAIR(0x7F46903C, 0xD358254D), LIMB_PAIR(0x241C5217, 0x44ACC043),
+            LIMB_PAIR(0xAB0168EC, 0x7A7C8E64), LIMB_PAIR(0x15EDC543, 0xCB5A4A55), LIMB_PAIR(0x47CD0EDA, 0x095519D3), LIMB_PAIR(0x343E93B0, 0x67D4AC8C),
+            LIMB_PAIR(0x4F7A5777, 0x1C7D6BBB), LIMB_PAIR(0x918313E1, 0x8B35FED4), LIMB_PAIR(0xC96B4684, 0x4ADCA1C6), LIMB_PAIR(0x12AD71BD, 0x556D1C83)
+        },
+        {   // 7 * 16^18 * B
+            LIMB_PAIR(0xB11BE821, 0x81F06756), LIMB_PAIR(0x10A3F3DD, 0x0FAFF823), LIMB_PAIR(0x6A99465D, 0xF8B2D055), LIMB_PAIR(0xCC8C7F05, 0x097ABE38),
+            LIMB_PAIR(0x0C8D3982, 0x17EF40E3), LIMB_PAIR(0x15A3FA34, 0x31F7073E), LIMB_PAIR(0x0773646E, 0x4F21F3CB), LIMB_PAIR(0x1D824EFF, 0x746C6C6D),
+            LIMB_PAIR(0x7EA52DA4, 0x0C49C987), LIMB_PAIR(0x9BDC1D43, 0x4C436955), LIMB_PAIR(0xF7CCEBD2, 0x022C3809), LIMB_PAIR(0x4BEE84BD, 0x577E14A3)
+        },
+        {   // 8 * 16^18 * B
+            LIMB_PAIR(0xBD4DD72B, 0x94FECEBE), LIMB_PAIR(0x060F2211, 0xF46A4FDA), LIMB_PAIR(0xC0C8D1FF, 0x124A5977), LIMB_PAIR(0xFB009295, 0x705304B8),
+            LIMB_PAIR(0x61A73B0A, 0xF0E268AC), LIMB_PAIR(0x3791A5F5, 0xF2FAFA10), LIMB_PAIR(0x6B6D00E9, 0xC1E13E82), LIMB_PAIR(0x6FD78F42, 0x60FA7EE9),
+            LIMB_PAIR(0x4D296EC6, 0xB63D1D35), LIMB_PAIR(0x5FAD31D8, 0xF3C3053E), LIMB_PAIR(0xB4BD42EC, 0x670B958C), LIMB_PAIR(0xA16353FD, 0x21398E0C)
+        }
+    },
+#endif
+#if (19 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^19 * B
+            LIMB_PAIR(0x861B7E9A, 0x86C5FC16), LIMB_PAIR(0x6A27C451, 0xF6A33047), LIMB_PAIR(0xA1E93597, 0x01667267), LIMB_PAIR(0x6082DFEB, 0x05FFB9CD),
+            LIMB_PAIR(0x8DA7D2EF, 0x216AB2CA), LIMB_PAIR(0x99F42827, 0x366AD9DD), LIMB_PAIR(0x4FDD3C75, 0xAE64B900), LIMB_PAIR(0x53909E62, 0x403A395B),
+            LIMB_PAIR(0xF53F6139, 0xA617FA9F), LIMB_PAIR(0x13E66CB6, 0x60F2B5E5), LIMB_PAIR(0xB3448AA4, 0xD7A8BEEF), LIMB_PAIR(0x6F5EA192, 0x7A293285)
+        },
+        {   // 2 * 16^19 * B
+            LIMB_PAIR(0x79639302, 0xB89C4448), LIMB_PAIR(0x50C67F2C, 0x4AE4F193), LIMB_PAIR(0xC81AF9C6, 0xF0B35DA8), LIMB_PAIR(0x46871017, 0x39D00035),
+            LIMB_PAIR(0xB02DE888, 0x0B39D761), LIMB_PAIR(0xD2414E1F, 0x5F550E7E), LIMB_PAIR(0x22E1A940, 0xA6BFA458), LIMB_PAIR(0xFD447B99, 0x050A2F7D),
+            LIMB_PAIR(0xA650DB77, 0x437C3B33), LIMB_PAIR(0xBAC52BB2, 0x6BAFE81D), LIMB_PAIR(0x2DB7D318, 0xFE99402D), LIMB_PAIR(0x372BA6CE, 0x2B5B7EEC)
+        },
+        {   // 3 * 16^19 * B
+            LIMB_PAIR(0x613AC8F4, 0xA694404D), LIMB_PAIR(0xFA97E72C, 0x500C3C2B), LIMB_PAIR(0x1FCEC210, 0x874104D2), LIMB_PAIR(0x8604A8EE, 0x1B205FB3),
+            LIMB_PAIR(0x83F50EEF, 0xB3BC4BBD), LIMB_PAIR(0x8C927866, 0x508F0C99), LIMB_PAIR(0xC8B7E66E, 0x43E76587), LIMB_PAIR(0xA47F98D9, 0x0F7655A3),
+            LIMB_PAIR(0xD24B133C, 0x55ECAD37), LIMB_PAIR(0x6038C90B, 0x441E147D), LIMB_PAIR(0xD62C6FEE, 0x656683A1), LIMB_PAIR(0x87E0ECAE, 0x0157D5DC)
+        },
+        {   // 4 * 16^19 * B
+            LIMB_PAIR(0xD71EB524, 0x95265514), LIMB_PAIR(0x5DF14593, 0xE603D881), LIMB_PAIR(0x0D4DE6B7, 0x147CDF41), LIMB_PAIR(0x0437C850, 0x5293B173),
+            LIMB_PAIR(0x0354C13D, 0xF2A7AF51), LIMB_PAIR(0xAA372B60, 0xD7A0B145), LIMB_PAIR(0x05A3D470, 0x2869B96A), LIMB_PAIR(0x82460173, 0x6528E42D),
+            LIMB_PAIR(0x4BCCF226, 0x23D0E081), LIMB_PAIR(0x8196FB93, 0x92C745CD), LIMB_PAIR(0x59541E5B, 0x8B61796C), LIMB_PAIR(0xC021F978, 0x40A44DF0)
+        },
+        {   // 5 * 16^19 * B
+            LIMB_PAIR(0x4BC5D095, 0x86C96E51), LIMB_PAIR(0xFCA6804A, 0xF20D4098), LIMB_PAIR(0xC826EA5D, 0x27363D89), LIMB_PAIR(0x5719CACF, 0x39CA3656),
+            LIMB_PAIR(0x4F20EA6A, 0xDAA86989), LIMB_PAIR(0x4C620618, 0xEA14A3D1), LIMB_PAIR(0x090BF8BE, 0x6001FCCB), LIMB_PAIR(0x947E9CF0, 0x35F4E822),
+            LIMB_PAIR(0x6F87B75C, 0x97506F2F), LIMB_PAIR(0x034AE070, 0xC624AEA0), LIMB_PAIR(0xAAD34DD6, 0x1EC856E3), LIMB_PAIR(0xE440E58F, 0x055B0BE0)
+        },
+        {   // 6 * 16^19 * B
+            LIMB_PAIR(0x6EA33DA2, 0x4D12A04B), LIMB_PAIR(0xE36126DD, 0x57CF4C15), LIMB_PAIR(0xEE44D967, 0x90EC9675), LIMB_PAIR(0x2A985AAC, 0x64CA348D),
+            LIMB_PAIR(0x89735D12, 0x6469A17D), LIMB_PAIR(0xE662B9F1, 0xDB6F27D5), LIMB_PAIR(0x6A395681, 0x9FCBA328), LIMB_PAIR(0xD269AF25, 0x363B8004),
+            LIMB_PAIR(0xE4C4912D, 0x99588E19), LIMB_PAIR(0x1CA5CE6B, 0xEFCC3B4E), LIMB_PAIR(0xFA5B98D5, 0x4522EA60), LIMB_PAIR(0x1DE4A819, 0x7064BBAB)
+        },
+        {   // 7 * 16^19 * B
+            LIMB_PAIR(0x42542129, 0xA290C061), LIMB_PAIR(0xBE8D5B90, 0xF2E2C2AE), LIMB_PAIR(0x76ABFE1B, 0xCF2458DB), LIMB_PAIR(0x83D626BF, 0x02157ADE),
+            LIMB_PAIR(0x5A770641, 0xB919E151), LIMB_PAIR(0x4E7F8039, 0xA9A2E2C7), LIMB_PAIR(0x3DF23109, 0x7527250B), LIMB_PAIR(0xAC27B78B, 0x756A7330),
+            LIMB_PAIR(0x1B9A038B, 0x3E46972A), LIMB_PAIR(0x7EE03FB4, 0x2E4EE66A), LIMB_PAIR(0x6EDBB4CA, 0x81A24877), LIMB_PAIR(0x8ECD0563, 0x1A944EE8)
+        },
+        {   // 8 * 16^19 * B
+            LIMB_PAIR(0x182362D6, 0xBB40A859), LIMB_PAIR(0x8A4D1ABB, 0xB99F5577), LIMB_PAIR(0x758559F6, 0x8D18B427), LIMB_PAIR(0x4D26235A, 0x26C20FE7),
+            LIMB_PAIR(0x51039372, 0xD5A91D11), LIMB_PAIR(0x99CA26DE, 0x2ED377B7), LIMB_PAIR(0xFD366B6B, 0xA17202AC), LIMB_PAIR(0xD6901995, 0x0730291B),
+            LIMB_PAIR(0xE9CC22F5, 0x648D1D9F), LIMB_PAIR(0x28DD577C, 0x66BC5619), LIMB_PAIR(0x652439D1, 0x47D3ED21), LIMB_PAIR(0xEDAF8B49, 0x49D271AC)
+        }
+    },
+#endif
+#if (20 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^20 * B
+            LIMB_PAIR(0xB4B75601, 0x2798AAF9), LIMB_PAIR(0x5C8DAD72, 0x5EAC7213), LIMB_PAIR(0x61B7A023, 0xD2CEAA61), LIMB_PAIR(0xE98F7D4E, 0x1BBFB284),
+            LIMB_PAIR(0x382B33F3, 0x89F5058A), LIMB_PAIR(0xAD48C0B4, 0x5AE2BA0B), LIMB_PAIR(0xA53DB36E, 0x8F93B503), LIMB_PAIR(0x95A232E6, 0x5AA3ED9D),
+            LIMB_PAIR(0xC7D96561, 0x656777E9), LIMB_PAIR(0x72C78036, 0xCB2B1254), LIMB_PAIR(0xD9506EEE, 0x65053299), LIMB_PAIR(0x5E8957CC, 0x4A07E14E)
+        },
+        {   // 2 * 16^20 * B
+            LIMB_PAIR(0xC477A49B, 0x240B58CD), LIMB_PAIR(0x6447F017, 0xFD38DADE), LIMB_PAIR(0xA7C86AAD, 0x19928D32), LIMB_PAIR(0x84AFA081, 0x50AF7AED),
+            LIMB_PAIR(0x980DF999, 0x4EE412CB), LIMB_PAIR(0x3C6EC771, 0xA315D76F), LIMB_PAIR(0x925C77FD, 0xBBA5EDDE), LIMB_PAIR(0x1D313402, 0x3F0BAC39),
+            LIMB_PAIR(0x15F65BE5, 0x6E4FDE01), LIMB_PAIR(0x216109B2, 0x29982621), LIMB_PAIR(0x0BADD6D9, 0x78020581), LIMB_PAIR(0xBAEBD006, 0x1921A316)
+        },
+        {   // 3 * 16^20 * B
+            LIMB_PAIR(0xD9F3C18B, 0xD75AAD9A), LIMB_PAIR(0x60B1C19C, 0x566A0EEF), LIMB_PAIR(0x255C0ED9, 0x3E9A0BAC), LIMB_PAIR(0xA062C7F5, 0x7B049DEC),
+            LIMB_PAIR(0xDFB870FC, 0x89422F7E), LIMB_PAIR(0x4F76B3BD, 0x2C296BEB), LIMB_PAIR(0x36C24DF7, 0x0738F1D4), LIMB_PAIR(0xE273AEB0, 0x6458DF41),
+            LIMB_PAIR(0x35444483, 0xDCCBE37A), LIMB_PAIR(0x0FEDBE93, 0x75887933), LIMB_PAIR(0x12C5DD87, 0x786004C3), LIMB_PAIR(0xC2950E64, 0x6093DCCB)
+        },
+        {   // 4 * 16^20 * B
+            LIMB_PAIR(0x6084034B, 0x6BDEEEBE), LIMB_PAIR(0x780FB854, 0x3199C2B6), LIMB_PAIR(0xB62D0695, 0x973376AB), LIMB_PAIR(0x8B647D90, 0x6E3180C9),
+            LIMB_PAIR(0x85E0706D, 0x1FF39A85), LIMB_PAIR(0xB3E73933, 0x36D0A5D8), LIMB_PAIR(0x718F453B, 0x43B9F2E1), LIMB_PAIR(0x4827A97C, 0x57D1EA08),
+            LIMB_PAIR(0xA128B071, 0xEE7AB6E7), LIMB_PAIR(0x93A88BAA, 0xA4C1596D), LIMB_PAIR(0xB2216130, 0xF7B4DE82), LIMB_PAIR(0xDD97BD18, 0x363E999D)
+        },
+        {   // 5 * 16^20 * B
+            LIMB_PAIR(0xE24BAEC6, 0x2F1848DC), LIMB_PAIR(0xBABCAF60, 0x769B7255), LIMB_PAIR(0x3CEFE931, 0x90CB3C6E), LIMB_PAIR(0xC6F9B355, 0x231F979B),
+            LIMB_PAIR(0x35EE1FC4, 0x96A843C1), LIMB_PAIR(0x08E4C8CF, 0x976EB355), LIMB_PAIR(0xB58CD330, 0xB42F6801), LIMB_PAIR(0x693A052B, 0x48EE9B78),
+            LIMB_PAIR(0xCC2AF3C6, 0x5C31DE4B), LIMB_PAIR(0xFE208D1F, 0xB04BB030), LIMB_PAIR(0xC14FB466, 0xB78D7009), LIMB_PAIR(0x08792413, 0x079BFA9B)
+        },
+        {   // 6 * 16^20 * B
+            LIMB_PAIR(0xA2D54245, 0xF3C9ED80), LIMB_PAIR(0x77F63952, 0x0AA08B78), LIMB_PAIR(0xD1085475, 0xD76DAC63), LIMB_PAIR(0x9470636B, 0x1EF4FB15),
+            LIMB_PAIR(0xDA300DF4, 0xE3903A51), LIMB_PAIR(0x3DA95AB0, 0x84396423), LIMB_PAIR(0x0B356480, 0xED3CF12D), LIMB_PAIR(0x84817194, 0x038C77F6),
+            LIMB_PAIR(0x5B167BEC, 0x854E5EE6), LIMB_PAIR(0x96D0CDC2, 0x59590A42), LIMB_PAIR(0x98102199, 0x72B2DF34), LIMB_PAIR(0x4A0BFF56, 0x575EE92A)
+        },
+        {   // 7 * 16^20 * B
+            LIMB_PAIR(0x0AA4D801, 0x5D46BC45), LIMB_PAIR(0xA533B9D8, 0xC3AF1227), LIMB_PAIR(0x2B8906C2, 0x389E3B26), LIMB_PAIR(0x382F581B, 0x200A1E7E),
+            LIMB_PAIR(0x8A182FCF, 0xD4C08090), LIMB_PAIR(0x99489DBD, 0x30E170C2), LIMB_PAIR(0x52F733DE, 0x05BABD57), LIMB_PAIR(0x2CD3FD00, 0x43D4E711),
+            LIMB_PAIR(0xEAF93AC5, 0x518DB967), LIMB_PAIR(0x056652C0, 0x71BC989B), LIMB_PAIR(0x567197F5, 0xFE2B85D9), LIMB_PAIR(0x651E4E38, 0x050ECA52)
+        },
+        {   // 8 * 16^20 * B
+            LIMB_PAIR(0x60E668EA, 0x97AC3976), LIMB_PAIR(0x153AB497, 0x9B19BBFE), LIMB_PAIR(0x34ECA79F, 0x4CB179B5), LIMB_PAIR(0xA131AE57, 0x6151C09F),
+            LIMB_PAIR(0x453F0C9C, 0xC3431ADE), LIMB_PAIR(0xFF703B9B, 0xE9F5045E), LIMB_PAIR(0xED847B3D, 0xFCD97AC9), LIMB_PAIR(0x1C58F4C6, 0x4B0EE6C2),
+            LIMB_PAIR(0xFDF05D96, 0x3AF55C0D), LIMB_PAIR(0x2AB4EE7A, 0xDD262EE0), LIMB_PAIR(0x12171709, 0x11B2BB87), LIMB_PAIR(0x800F030B, 0x1FEF24FA)
+        }
+    },
+#endif
+#if (21 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^21 * B
+            LIMB_PAIR(0x90166220, 0xFF91A66A), LIMB_PAIR(0x5BF1E009, 0xF22552AE), LIMB_PAIR(0x7F90DF7C, 0x7DFF85D8), LIMB_PAIR(0x0C736FB9, 0x4F620FFE),
+            LIMB_PAIR(0x6B6C6609, 0xB496123A), LIMB_PAIR(0x80AB5938, 0xA750FE85), LIMB_PAIR(0xB7C27A5F, 0xF471BF39), LIMB_PAIR(0x77AC193C, 0x507903CE),
+            LIMB_PAIR(0xDFDE3E34, 0x62F90D65), LIMB_PAIR(0xB9FA5FAD, 0xCF28C592), LIMB_PAIR(0xC6164510, 0x99C86EF9), LIMB_PAIR(0x4A256C84, 0x25D44804)
+        },
+        {   // 2 * 16^21 * B
+            LIMB_PAIR(0xC9022B55, 0x2C7C4415), LIMB_PAIR(0x812EB1FE, 0x56A0D241), LIMB_PAIR(0xD7B65E0D, 0xF02EA1C9), LIMB_PAIR(0xD5323B26, 0x4180512F),
+            LIMB_PAIR(0xC7E9B16F, 0xBD68230E), LIMB_PAIR(0xC1C5795D, 0x0EB1B9C1), LIMB_PAIR(0x95B6B1FF, 0x7943C8C4), LIMB_PAIR(0x0BBACF5E, 0x2F9FAF62),
+            LIMB_PAIR(0x8A48A5DB, 0xA4FF3E69), LIMB_PAIR(0xBD95403B, 0xBA6A3806), LIMB_PAIR(0x47D5B65D, 0x9F7CE1AF), LIMB_PAIR(0x5939D2FB, 0x15E087E5)
+        },
+        {   // 3 * 16^21 * B
+            LIMB_PAIR(0xFB963F38, 0x8894186E), LIMB_PAIR(0xDC639BD5, 0x48A00E80), LIMB_PAIR(0xE96C1C99, 0xA4E8092B), LIMB_PAIR(0xCA573661, 0x5A097D54),
+            LIMB_PAIR(0x745C1496, 0x12207543), LIMB_PAIR(0xDA38610C, 0xDAFF3CFD), LIMB_PAIR(0x2C71C34F, 0xE4E79727), LIMB_PAIR(0x34BDEDE9, 0x39C07B19),
+            LIMB_PAIR(0x17C9E755, 0x2D45892B), LIMB_PAIR(0x89308DF8, 0xD033FD72), LIMB_PAIR(0x525B8BD9, 0x6C2FE9D9), LIMB_PAIR(0xC11CC079, 0x2EDBECF1)
+        },
+        {   // 4 * 16^21 * B
+            LIMB_PAIR(0xD087A25F, 0xEE0F0FDD), LIMB_PAIR(0x5C3E34EE, 0x9C753155), LIMB_PAIR(0x8FAB3AB5, 0x660C572E), LIMB_PAIR(0x544CD3B2, 0x0854FC44),
+            LIMB_PAIR(0xC715A0D2, 0x1616A4E3), LIMB_PAIR(0xF8341D4D, 0x53623CB0), LIMB_PAIR(0xC7E899CB, 0x96EF5329), LIMB_PAIR(0xA668BAA6, 0x3D4E8DBB),
+            LIMB_PAIR(0x55EDAD19, 0x61EBA0C5), LIMB_PAIR(0xF0A83DE6, 0x24B533FE), LIMB_PAIR(0x83BAA5F8, 0x3B770428), LIMB_PAIR(0x98A47E8D, 0x678F82B8)
+        },
+        {   // 5 * 16^21 * B
+            LIMB_PAIR(0x57775696, 0x1E09D940), LIMB_PAIR(0x3CD951DB, 0xEED1265C), LIMB_PAIR(0x20BCE16F, 0xFA9DAC2B), LIMB_PAIR(0xE8D089F4, 0x0F7F76E0),
+            LIMB_PAIR(0xD6900C54, 0xB1491D0B), LIMB_PAIR(0x9D132636, 0x3539722C), LIMB_PAIR(0x0B362BC9, 0x4DB92892), LIMB_PAIR(0xA68B69DF, 0x4D7CD1FE),
+            LIMB_PAIR(0xD485B00C, 0x36D9EBC5), LIMB_PAIR(0xE4ADB365, 0xA2596492), LIMB_PAIR(0xC2119CCD, 0xC1659480), LIMB_PAIR(0x186E0D5F, 0x45306349)
+        },
+        {   // 6 * 16^21 * B
+            LIMB_PAIR(0x2B072491, 0x96A414EC), LIMB_PAIR(0x27A7B65B, 0x1BB22181), LIMB_PAIR(0x6E8A4AF0, 0x6D284959), LIMB_PAIR(0xCD27765F, 0x65F3B08C),
+            LIMB_PAIR(0xA6CDFF1D, 0x94DDD0C1), LIMB_PAIR(0xE84213AE, 0x55F6F115), LIMB_PAIR(0x992FCF6A, 0x6C935F85), LIMB_PAIR(0x4A37F16F, 0x067EE0F5),
+            LIMB_PAIR(0x199801F7, 0xECB29FFF), LIMB_PAIR(0xA2A0F72F, 0x9D361D1F), LIMB_PAIR(0x75FD2F49, 0x25F11D23), LIMB_PAIR(0x0FE10FE2, 0x124CEFE8)
+        },
+        {   // 7 * 16^21 * B
+            LIMB_PAIR(0x31B16489, 0x1518E85B), LIMB_PAIR(0xDB710BFB, 0x8FAADCB7), LIMB_PAIR(0xA14AE239, 0x39B0BDF4), LIMB_PAIR(0x503D20C1, 0x05F4CBEA),
+            LIMB_PAIR(0xD18DF255, 0x4C126CF9), LIMB_PAIR(0x147A63B6, 0xC1D471E9), LIMB_PAIR(0xF3C93B5F, 0x2C6D3C73), LIMB_PAIR(0xE3FF86A2, 0x6BE3A6A2),
+            LIMB_PAIR(0xC04145BC, 0xCE040E9E), LIMB_PAIR(0x08F6834C, 0xC71FF4E2), LIMB_PAIR(0xAB8847A3, 0xBD546E8D), LIMB_PAIR(0xA4D2ABA5, 0x64666AA0)
+        },
+        {   // 8 * 16^21 * B
+            LIMB_PAIR(0x3337E94C, 0xB0C53BF7), LIMB_PAIR(0x11E14F15, 0x7CB5697E), LIMB_PAIR(0x1930C750, 0x4B84ABAC), LIMB_PAIR(0xE0640468, 0x28DD4ABF),
+            LIMB_PAIR(0x7C06D912, 0x6841435A), LIMB_PAIR(0xBB3F830B, 0xCA123C21), LIMB_PAIR(0xB1CBE278, 0xD4B37B27), LIMB_PAIR(0xC76F5046, 0x1D753B84),
+            LIMB_PAIR(0x44CB9F44, 0x7DC0B64C), LIMB_PAIR(0xE3925DBF, 0x18A3E1AC), LIMB_PAIR(0x2D0457C4, 0x7A303486), LIMB_PAIR(0x8A0C892E, 0x4C498BF7)
+        }
+    },
+#endif
+#if (22 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^22 * B
+            LIMB_PAIR(0x30976B86, 0x22D2AFF5), LIMB_PAIR(0xC2D24604, 0x8D90B806), LIMB_PAIR(0x4DE5BAE5, 0xDCA1896C), LIMB_PAIR(0xC8340C17, 0x28005FE6),
+            LIMB_PAIR(0x1AA73196, 0x37D653FB), LIMB_PAIR(0x3FD76418, 0x0F949530), LIMB_PAIR(0xFB3A17B2, 0xAD200B09), LIMB_PAIR(0x2FC8613E, 0x544D4929),
+            LIMB_PAIR(0x34528688, 0x6AEFBA9F), LIMB_PAIR(0x25107DA1, 0x5C1BFF94), LIMB_PAIR(0x66D94B36, 0xF75BBBCD), LIMB_PAIR(0x0F316DFA, 0x72E47293)
+        },
+        {   // 2 * 16^22 * B
+            LIMB_PAIR(0xD32A7627, 0x07F3F635), LIMB_PAIR(0x5F6566F0, 0x7AAA4D86), LIMB_PAIR(0x28D04450, 0x3C85E797), LIMB_PAIR(0x0FE06438, 0x1FEE7F00),
+            LIMB_PAIR(0x9781084F, 0x2695208C), LIMB_PAIR(0x23450EE1, 0xB1502A0B), LIMB_PAIR(0x03EFDE02, 0xFD9DAEA6), LIMB_PAIR(0x2733A34C, 0x5A9D2E8C),
+            LIMB_PAIR(0x03DBF7E5, 0x765305DA), LIMB_PAIR(0x1434CDBD, 0xA4DAF249), LIMB_PAIR(0xD24A88EC, 0x7B4AD5CD), LIMB_PAIR(0xEE040543, 0x00F94051)
+        },
+        {   // 3 * 16^22 * B
+            LIMB_PAIR(0x07AF9753, 0xD7EF93BB), LIMB_PAIR(0x3DB766A7, 0x583ED0CF), LIMB_PAIR(0x6E0B1EC5, 0xCE6998BF), LIMB_PAIR(0x5DD40452, 0x47B7FFD2),
+            LIMB_PAIR(0xC3D330B2, 0x8D356B23), LIMB_PAIR(0xB0471B06, 0xF21C8B9B), LIMB_PAIR(0x6E42B83C, 0xB36C316C), LIMB_PAIR(0x8BEAB10D, 0x07D79C7E),
+            LIMB_PAIR(0xBC08DD12, 0x87FBFB9C), LIMB_PAIR(0xE1EEC29B, 0x8A066B3A), LIMB_PAIR(0xDB1FC1BF, 0x0D57242B), LIMB_PAIR(0x5EA64BB6, 0x1C3520A3)
+        },
+        {   // 4 * 16^22 * B
+            LIMB_PAIR(0x216BC059, 0xCDA86F40), LIMB_PAIR(0x12BCD87E, 0x1FBB231D), LIMB_PAIR(0x17C70990, 0xB4956A9E), LIMB_PAIR(0x66D12E55, 0x38750C3B),
+            LIMB_PAIR(0xBCCBA34A, 0x80D253A6), LIMB_PAIR(0x3838219B, 0x3E61C3A1), LIMB_PAIR(0x9882E396, 0x90C3B601), LIMB_PAIR(0x5D0EE66F, 0x1C3D0577),
+            LIMB_PAIR(0x9422E51A, 0x692EF140), LIMB_PAIR(0x2B5DF671, 0xCBC0C73C), LIMB_PAIR(0x744CE029, 0x21014FE7), LIMB_PAIR(0xD330487C, 0x0621E2C7)
+        },
+        {   // 5 * 16^22 * B
+            LIMB_PAIR(0xB0DBF0F3, 0xB7AE1796), LIMB_PAIR(0xE17CE196, 0x54DFAFB9), LIMB_PAIR(0xE9AAA3B4, 0x25923071), LIMB_PAIR(0xA1002E9D, 0x5D8E589C),
+            LIMB_PAIR(0x8259838D, 0xAF9860CC), LIMB_PAIR(0xC69F9ADC, 0x90EA48C1), LIMB_PAIR(0x65581E30, 0x65264837), LIMB_PAIR(0x7BD3A5BC, 0x0007D609),
+            LIMB_PAIR(0x0842A94B, 0xC0BF1D95), LIMB_PAIR(0x588F2E3E, 0xB2D3C363), LIMB_PAIR(0xBB51E2EF, 0x0A961438), LIMB_PAIR(0x3C1CBF86, 0x1583D778)
+        },
+        {   // 6 * 16^22 * B
+            LIMB_PAIR(0xCC9D28C7, 0x90034704), LIMB_PAIR(0xF72CC58F, 0x1D1B679E), LIMB_PAIR(0xBE5B8726, 0x16E12B5F), LIMB_PAIR(0x83C5580A, 0x4958064E),
+            LIMB_PAIR(0x5DA27AE1, 0xECEEA2EF), LIMB_PAIR(0x55670174, 0x597C3A14), LIMB_PAIR(0x6609167A, 0xC9A62A12), LIMB_PAIR(0x81ED8F70, 0x252A5F2E),
+            LIMB_PAIR(0x5066E80D, 0x0D289426), LIMB_PAIR(0x307C8C6B, 0xFCC3F785), LIMB_PAIR(0x0C1112FD, 0x1B53DA78), LIMB_PAIR(0xD843B388, 0x079C170B)
+        },
+        {   // 7 * 16^22 * B
+            LIMB_PAIR(0xC0D5D056, 0xCDD6CD50), LIMB_PAIR(0xBB03573B, 0x9AF7686D), LIMB_PAIR(0xF3C3EF48, 0x3CA6723F), LIMB_PAIR(0x317B8ACC, 0x6768C0D7),
+            LIMB_PAIR(0x64FA6FFF, 0x0506ECE4), LIMB_PAIR(0x6205E523, 0xBEE3431E), LIMB_PAIR(0x51B8EA42, 0x35794224), LIMB_PAIR(0x4AC9FB00, 0x6DEC05E3),
+            LIMB_PAIR(0xF155C1B3, 0x94B625E5), LIMB_PAIR(0x997B7B91, 0x417BF3A7), LIMB_PAIR(0x6D6B2600, 0xC22CBDDC), LIMB_PAIR(0xDDCD52F4, 0x51445E14)
+        },
+        {   // 8 * 16^22 * B
+            LIMB_PAIR(0x2BBEA455, 0x893147AB), LIMB_PAIR(0x92079129, 0x8C53A24F), LIMB_PAIR(0xBE30F7A7, 0x4B49F948), LIMB_PAIR(0x6E4FD43D, 0x12E99008),
+            LIMB_PAIR(0x3B144951, 0x57502B4B), LIMB_PAIR(0x444BBCB3, 0x8E67FF6B), LIMB_PAIR(0x166385DB, 0xB8BD6927), LIMB_PAIR(0xE39295C8, 0x13186F31),
+            LIMB_PAIR(0x7FDFBB2E, 0xF10C96B3), LIMB_PAIR(0x121CEAF9, 0x9F9A935E), LIMB_PAIR(0x3A5B983F, 0xDF1136C4), LIMB_PAIR(0x5D3E99AF, 0x77B2E3F0)
+        }
+    },
+#endif
+#if (23 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^23 * B
+            LIMB_PAIR(0xCC5CD29B, 0x9532F48F), LIMB_PAIR(0xA3CE3671, 0x2BA851BE), LIMB_PAIR(0x51122941, 0x32DACAA0), LIMB_PAIR(0x350004F2, 0x478D99D9),
+            LIMB_PAIR(0x9CF12657, 0xFD0D7587), LIMB_PAIR(0xE53A0E29, 0xE82FEF94), LIMB_PAIR(0x5BBB4BE7, 0xCC34A7F0), LIMB_PAIR(0xA50C38A2, 0x0B251172),
+            LIMB_PAIR(0x90BB02C0, 0x1D5AD948), LIMB_PAIR(0x0EC25115, 0x50E208B1), LIMB_PAIR(0x4EF21702, 0xA26A2289), LIMB_PAIR(0x3B524805, 0x4DC92334)
+        },
+        {   // 2 * 16^23 * B
+            LIMB_PAIR(0xF36C4975, 0x3AD3E3EB), LIMB_PAIR(0x37862125, 0xD75D25A5), LIMB_PAIR(0xA025A516, 0xE873943D), LIMB_PAIR(0xC411C847, 0x6BBC7CB4),
+            LIMB_PAIR(0x0F8086B6, 0xE3828C40), LIMB_PAIR(0x979F0DC8, 0x3F77E6F7), LIMB_PAIR(0x4DF42CB4, 0x7EF6DE30), LIMB_PAIR(0xB6ABD784, 0x5265797C),
+            LIMB_PAIR(0xD4A50D56, 0x3C6F9CD1), LIMB_PAIR(0xC6FEAB7E, 0xB6244077), LIMB_PAIR(0x3580972E, 0x6FF9BF48), LIMB_PAIR(0xB332ACFB, 0x00375883)
+        },
+        {   // 3 * 16^23 * B
+            LIMB_PAIR(0x6C75C99C, 0xC98BEC85), LIMB_PAIR(0x00E33CF4, 0xE44184C0), LIMB_PAIR(0xBA907634, 0x0A676B9B), LIMB_PAIR(0x71F379D7, 0x669E2CB5),
+            LIMB_PAIR(0x28CB0940, 0x0001B2CD), LIMB_PAIR(0x6F1C24C9, 0x63FB51A0), LIMB_PAIR(0xDCD5CA31, 0xB5AD8691), LIMB_PAIR(0x8C450660, 0x67238DBD),
+            LIMB_PAIR(0xA49BD308, 0xCB116B73), LIMB_PAIR(0x2392729E, 0x025AAD6B), LIMB_PAIR(0x3F55D9B1, 0xB4793EFA), LIMB_PAIR(0x40678BB9, 0x72A10561)
+        },
+        {   // 4 * 16^23 * B
+            LIMB_PAIR(0xE2E505B6, 0x0D8D2909), LIMB_PAIR(0xC0291230, 0x98CA78AB), LIMB_PAIR(0xA9B12327, 0x77EF5569), LIMB_PAIR(0x81439B47, 0x7C77897B),
+            LIMB_PAIR(0x1CC9249D, 0xA2B6812B), LIMB_PAIR(0x21211F58, 0x62866EEE), LIMB_PAIR(0x5DF10ECE, 0x2CB5C5B8), LIMB_PAIR(0xE263AE00, 0x03A6B259),
+            LIMB_PAIR(0xDE331CB5, 0xF1C1B5E2), LIMB_PAIR(0x15FCA420, 0x5A9F5D8E), LIMB_PAIR(0x7BD932B1, 0x9FA438F1), LIMB_PAIR(0x1C6146E7, 0x2A381BF0)
+        },
+        {   // 5 * 16^23 * B
+            LIMB_PAIR(0xB534166F, 0xF7C0BE32), LIMB_PAIR(0x19CF70D4, 0x27E6CA64), LIMB_PAIR(0xA957A759, 0x934DF7D7), LIMB_PAIR(0xABDEC2AA, 0x5701461D),
+            LIMB_PAIR(0xCFC811C1, 0xAC9B9879), LIMB_PAIR(0x3756E567, 0x8B7D2981), LIMB_PAIR(0x7C70EDFC, 0x50DA4E60), LIMB_PAIR(0x884400B6, 0x5DBCA62F),
+            LIMB_PAIR(0x2C915C25, 0x2C674740), LIMB_PAIR(0x0B0D340A, 0x1BDCD1A8), LIMB_PAIR(0x07B43F5F, 0x5E5601BD), LIMB_PAIR(0x5539A242, 0x2555B4E0)
+        },
+        {   // 6 * 16^23 * B
+            LIMB_PAIR(0x87E463D4, 0x78409B1D), LIMB_PAIR(0xCDFB639D, 0xAD4DA95A), LIMB_PAIR(0x55259B9C, 0xEC287737), LIMB_PAIR(0xC31230AB, 0x69C806E9),
+            LIMB_PAIR(0x66DDD216, 0x6FC09F52), LIMB_PAIR(0xC8E37048, 0xDCE560A7), LIMB_PAIR(0xA2DF62FD, 0xEC65939D), LIMB_PAIR(0xE52ED192, 0x7A869AE7),
+            LIMB_PAIR(0x14BB3F22, 0x7B48F574), LIMB_PAIR(0xAEDCCC88, 0x68C7CEE4), LIMB_PAIR(0x79ED80BE, 0xED2F9361), LIMB_PAIR(0x5F77BC4B, 0x25D70B88)
+        },
+        {   // 7 * 16^23 * B
+            LIMB_PAIR(0xBB1AE4D4, 0x98459D29), LIMB_PAIR(0x39F954EC, 0x56B9C4C7), LIMB_PAIR(0xC29B4B3E, 0x832743F6), LIMB_PAIR(0x98B6878A, 0x21EA8E27),
+            LIMB_PAIR(0x762BF4DE, 0x4151C3D9), LIMB_PAIR(0x2745D82B, 0x083F435F), LIMB_PAIR(0x0D23DDD5, 0x29775A2E), LIMB_PAIR(0x69A5DB24, 0x138E3A62),
+            LIMB_PAIR(0x6A5A7B9C, 0x87BEF4B4), LIMB_PAIR(0x5FC1D062, 0xD2299D1B), LIMB_PAIR(0xDD321648, 0x82409818), LIMB_PAIR(0xE5A2E03D, 0x5C5ABEB1)
+        },
+        {   // 8 * 16^23 * B
+            LIMB_PAIR(0x1306A233, 0x02CDE6DE), LIMB_PAIR(0x116F8EC7, 0x7B5A52A2), LIMB_PAIR(0xC1163B5B, 0xE1C681F4), LIMB_PAIR(0x60D32643, 0x241D3506),
+            LIMB_PAIR(0xB73C2DDB, 0x14722AF4), LIMB_PAIR(0x5A05060D, 0xBC470C5F), LIMB_PAIR(0x2581B02E, 0x00943EAC), LIMB_PAIR(0x1F499C8F, 0x0E434B3B),
+            LIMB_PAIR(0x0EBC52C7, 0x6BE4404D), LIMB_PAIR(0xB1A791F5, 0xAE46233B), LIMB_PAIR(0xD25DB42B, 0x2AEC170E), LIMB_PAIR(0x6645D694, 0x1D8DFD96)
+        }
+    },
+#endif
+#if (24 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^24 * B
+            LIMB_PAIR(0x12DDB0A4, 0xD598639C), LIMB_PAIR(0xC024866B, 0xA5D19F30), LIMB_PAIR(0x58FCE460, 0xD17C2F03), LIMB_PAIR(0x2E095E8A, 0x07A19515),
+            LIMB_PAIR(0x9C2EC4DE, 0x296FA9C5), LIMB_PAIR(0x4F84F3CB, 0xBC8B61BF), LIMB_PAIR(0x17A8F908, 0x1C7706D9), LIMB_PAIR(0x7AD3255D, 0x63B795FC),
+            LIMB_PAIR(0x389E5FC8, 0xA8368F02), LIMB_PAIR(0xCF8DE43B, 0x90433B02), LIMB_PAIR(0xC5412643, 0xAFA1FD5D), LIMB_PAIR(0x032F0137, 0x3E8FE83D)
+        },
+        {   // 2 * 16^24 * B
+            LIMB_PAIR(0xE8EFD13C, 0x08704C8D), LIMB_PAIR(0x33E03731, 0xDFC51A8E), LIMB_PAIR(0x1260CDE3, 0xA59D5DA5), LIMB_PAIR(0xA6258C86, 0x22D60899),
+            LIMB_PAIR(0x0570A294, 0x2F8B15B9), LIMB_PAIR(0x67084549, 0x94F24270), LIMB_PAIR(0x61BBFD84, 0xDE1C5AE1), LIMB_PAIR(0x7FAC4007, 0x75BA3B79),
+            LIMB_PAIR(0x70CDD196, 0x6239DBC0), LIMB_PAIR(0x6C7D8A9A, 0x60FE8A8B), LIMB_PAIR(0xEB401260, 0xB38847BC), LIMB_PAIR(0x87779E5E, 0x0904D07B)
+        },
+        {   // 3 * 16^24 * B
+            LIMB_PAIR(0x48F940B9, 0xF4322D66), LIMB_PAIR(0xBD2D0C39, 0x06952F0C), LIMB_PAIR(0xA081F931, 0x167697AD), LIMB_PAIR(0xBAF72A6C, 0x6240AACE),
+            LIMB_PAIR(0xDDBA919C, 0xB4CE1FD4), LIMB_PAIR(0xC74C8DAA, 0xCF31DB3E), LIMB_PAIR(0xAD86CC51, 0x2C63CC63), LIMB_PAIR(0xBC1DDE07, 0x43E2143F),
+            LIMB_PAIR(0x5BA295A0, 0xF834749C), LIMB_PAIR(0xCA37D25A, 0xD6947C5B), LIMB_PAIR(0xE7C9316A, 0x66F13BA7), LIMB_PAIR(0x8DB40CAC, 0x56BDAF23)
+        },
+        {   // 4 * 16^24 * B
+            LIMB_PAIR(0xC19D3BB2, 0x1310D36C), LIMB_PAIR(0x622386B9, 0x062A6BB7), LIMB_PAIR(0xD7A14F5C, 0x7C9B8591), LIMB_PAIR(0x7E1E5754, 0x03AA3150),
+            LIMB_PAIR(0xF53533EB, 0x362AB9E3), LIMB_PAIR(0x6EB93D40, 0x338568D5), LIMB_PAIR(0x1D5A5572, 0x9E0E1452), LIMB_PAIR(0x83741318, 0x1D24A86D),
+            LIMB_PAIR(0xFFD4CE1F, 0xF4EC7648), LIMB_PAIR(0x54AC8C1C, 0xE045EAF0), LIMB_PAIR(0x1D09357C, 0x88D22582), LIMB_PAIR(0x9AEB4859, 0x43B261DC)
+        },
+        {   // 5 * 16^24 * B
+            LIMB_PAIR(0x6C951364, 0x19513D8B), LIMB_PAIR(0x000BF47B, 0x94FE7126), LIMB_PAIR(0xD54F9567, 0x028D10DD), LIMB_PAIR(0x42940964, 0x02B4D5E2),
+            LIMB_PAIR(0x88BB79BB, 0xE55B1E19), LIMB_PAIR(0xC17A359D, 0xA09ED07D), LIMB_PAIR(0x603DEA33, 0xB02C2EE2), LIMB_PAIR(0x5B276BC2, 0x326055CF),
+            LIMB_PAIR(0x28D18DF2, 0xB4A155CB), LIMB_PAIR(0x186CE508, 0xEACC4646), LIMB_PAIR(0x6C824389, 0xC49CF493), LIMB_PAIR(0xAE5D3410, 0x27A6C809)
+        },
+        {   // 6 * 16^24 * B
+            LIMB_PAIR(0xC43D6954, 0xCD2C270A), LIMB_PAIR(0x6A66CAB2, 0xDD4A3E57), LIMB_PAIR(0x69D7036C, 0x79FA5924), LIMB_PAIR(0x3D8C2599, 0x22150360),
+            LIMB_PAIR(0x1F0DB188, 0x8BA6EBCD), LIMB_PAIR(0x675A5BE8, 0x37D3D73A), LIMB_PAIR(0x15F5585A, 0xF22EDFA3), LIMB_PAIR(0xFF60A17E, 0x2CB67174),
+            LIMB_PAIR(0x390BE1D0, 0x59EECDF9), LIMB_PAIR(0x728CE3F1, 0xA9422044), LIMB_PAIR(0x7A94F0F4, 0x82891C66), LIMB_PAIR(0x3890F436, 0x7B1DF4B7)
+        },
+        {   // 7 * 16^24 * B
+            LIMB_PAIR(0x07F8F58C, 0x5F2E2218), LIMB_PAIR(0xD49409D4, 0xE3555C9F), LIMB_PAIR(0x1FB6A630, 0xB2AAA88D), LIMB_PAIR(0xD352E03D, 0x68698245),
+            LIMB_PAIR(0xB3B2A224, 0xE492F2E0), LIMB_PAIR(0x2B551160, 0x7C6C9E06), LIMB_PAIR(0x0D7F7B0E, 0x15EB8FE2), LIMB_PAIR(0x58FC5992, 0x61FCEF26),
+            LIMB_PAIR(0x2A18187A, 0xDBB15D85), LIMB_PAIR(0x86DDACD7, 0xF3E4AAD3), LIMB_PAIR(0x0FF6C482, 0x44BAE281), LIMB_PAIR(0x3DAF01CF, 0x46CF4C47)
+        },
+        {   // 8 * 16^24 * B
+            LIMB_PAIR(0xF1498140, 0x213C6EA7), LIMB_PAIR(0x392B4854, 0x7C1E7EF8), LIMB_PAIR(0x5629CEBA, 0x2488C38C), LIMB_PAIR(0x0D8CC5BB, 0x1065AAE5),
+            LIMB_PAIR(0x9EC4E5F9, 0x426525ED), LIMB_PAIR(0x16903303, 0x0E5EDA01), LIMB_PAIR(0xCBE5CADC, 0x72B1A7F2), LIMB_PAIR(0x14EB5F40, 0x29387BCD),
+            LIMB_PAIR(0xDF200D57, 0x1C2C4525), LIMB_PAIR(0xBFCA674A, 0x5C3B2DD6), LIMB_PAIR(0xE1834030, 0x0A07E7B1), LIMB_PAIR(0x4F1CE716, 0x69A198E6)
+        }
+    },
+#endif
+#if (25 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^25 * B
+            LIMB_PAIR(0x9E2D4734, 0x7B26E56B), LIMB_PAIR(0x81C61675, 0xC4C7132B), LIMB_PAIR(0xEC9CDE7F, 0xEF5C9525), LIMB_PAIR(0xE71743AD, 0x39C80B16),
+            LIMB_PAIR(0xEFA9D697, 0x7AFCD613), LIMB_PAIR(0x1C067959, 0x0CC45AA4), LIMB_PAIR(0xC1FADA96, 0xA56FE104), LIMB_PAIR(0x72E40365, 0x3A73B704),
+            LIMB_PAIR(0x1B826C68, 0x0F196E0D), LIMB_PAIR(0x4960E3DB, 0xF71FF0E2), LIMB_PAIR(0x23B7436C, 0x61131670), LIMB_PAIR(0x77DA7282, 0x0CF0EA58)
+        },
+        {   // 2 * 16^25 * B
+            LIMB_PAIR(0x3BA6945A, 0xE332CED4), LIMB_PAIR(0xE881C05D, 0xDE0B1361), LIMB_PAIR(0x5E67ED3B, 0x1AD40F09), LIMB_PAIR(0xB8C63D5D, 0x5DA8ACDA),
+            LIMB_PAIR(0xDDD4CCBD, 0x196C80A4), LIMB_PAIR(0x95F2DD9D, 0x22E6F55D), LIMB_PAIR(0x40D6C71B, 0xC75E33C7), LIMB_PAIR(0xCB3C042F, 0x7BB51279),
+            LIMB_PAIR(0x3A70159F, 0xC4B6664A), LIMB_PAIR(0x0A904E14, 0x76194F0F), LIMB_PAIR(0xA4096C13, 0xA5614C39), LIMB_PAIR(0x979FECED, 0x6CD0FF50)
+        },
+        {   // 3 * 16^25 * B
+            LIMB_PAIR(0xB04BA18E, 0x7FECFABD), LIMB_PAIR(0x3BDDBCF7, 0xD0FC7BFC), LIMB_PAIR(0x057A131C, 0xA41D486E), LIMB_PAIR(0xF2223A61, 0x641A4391),
+            LIMB_PAIR(0x8F4428AC, 0xC0E067E7), LIMB_PAIR(0xA61135E3, 0x14835AB0), LIMB_PAIR(0x38062935, 0xF21D14F3), LIMB_PAIR(0xDF04849C, 0x6390A4C8),
+            LIMB_PAIR(0xA606A8DB, 0xC5C6B95A), LIMB_PAIR(0xB06825F1, 0x914B7F9E), LIMB_PAIR(0x44FC9EFF, 0x2A731F6B), LIMB_PAIR(0x62705CFC, 0x30DDF385)
+        },
+        {   // 4 * 16^25 * B
+            LIMB_PAIR(0x68BCD52C, 0x33BEF2BD), LIMB_PAIR(0x69482EF2, 0xC649DBB0), LIMB_PAIR(0x41CB1AEE, 0xB5B6EE0C), LIMB_PAIR(0x0212A7E5, 0x5C294D27),
+            LIMB_PAIR(0xD1BFF7F9, 0x4E3DCBDA), LIMB_PAIR(0x20645717, 0xC9118E82), LIMB_PAIR(0x0F189D56, 0xBACCCEBC), LIMB_PAIR(0xD4467668, 0x1B4822E9),
+            LIMB_PAIR(0x25563781, 0xAB360A7F), LIMB_PAIR(0x480F7958, 0x2512228A), LIMB_PAIR(0x6114B4E3, 0xC75D0527), LIMB_PAIR(0xD976FE2A, 0x222D9625)
+        },
+        {   // 5 * 16^25 * B
+            LIMB_PAIR(0x0A344F85, 0x0F94BE7E), LIMB_PAIR(0x87F22C38, 0xEB2FAA8C), LIMB_PAIR(0x4EE16F0F, 0x9CE1E75E), LIMB_PAIR(0x18A08DEA, 0x43E64E54),
+            LIMB_PAIR(0xB372ACE1, 0x1C717F85), LIMB_PAIR(0x4638BF18, 0x81930E69), LIMB_PAIR(0x6BC08B58, 0x239CAD05), LIMB_PAIR(0x87F8FFF4, 0x0B34271C),
+            LIMB_PAIR(0x1A35CE63, 0x8155E252), LIMB_PAIR(0xF912028E, 0xBE100D4D), LIMB_PAIR(0xA57DDCEC, 0xBFF80BF8), LIMB_PAIR(0x6D6BC6E4, 0x57342DC9)
+        },
+        {   // 6 * 16^25 * B
+            LIMB_PAIR(0x1E707BF6, 0xF3C3BCB7), LIMB_PAIR(0x7291A762, 0x351D9B8C), LIMB_PAIR(0xDAD69A33, 0x00502E6E), LIMB_PAIR(0x1EC8807F, 0x522F521F),
+            LIMB_PAIR(0xC8CE5998, 0xEFEEF065), LIMB_PAIR(0xB5CBEAA2, 0xBF029510), LIMB_PAIR(0x20B7C458, 0x8C64A106), LIMB_PAIR(0x31C24855, 0x35134FB2),
+            LIMB_PAIR(0xF9A3902B, 0x272C1F46), LIMB_PAIR(0x99657BCC, 0xC91BA3B7), LIMB_PAIR(0x4F8A1C0E, 0xAE614B30), LIMB_PAIR(0x0B99017B, 0x7AFCAAD7)
+        },
+        {   // 7 * 16^25 * B
+            LIMB_PAIR(0xEF842B6B, 0xA88141EC), LIMB_PAIR(0x97ABE6C5, 0x55E7B147), LIMB_PAIR(0x03784FFE, 0x8C748F97), LIMB_PAIR(0xAFCD00B7, 0x5B50A1F7),
+            LIMB_PAIR(0xA4B8BE41, 0xC25DED54), LIMB_PAIR(0x1BB0E2DD, 0x902D13E1), LIMB_PAIR(0xCDE82AB2, 0x41F43233), LIMB_PAIR(0xC3AAE7CB, 0x1085FAA5),
+            LIMB_PAIR(0xF1361315, 0x9B840F66), LIMB_PAIR(0x701003E9, 0x18462242), LIMB_PAIR(0xE4A25080, 0x65ED45FA), LIMB_PAIR(0x3FDA7320, 0x0A286239)
+        },
+        {   // 8 * 16^25 * B
+            LIMB_PAIR(0x6ECB9D17, 0x960E737B), LIMB_PAIR(0xD67CEAE1, 0xFAF24948), LIMB_PAIR(0xD55E1B89, 0x37E7A9B4), LIMB_PAIR(0xB46C59EB, 0x5CB7173C),
+            LIMB_PAIR(0x347CBC9D, 0x46AB13C8), LIMB_PAIR(0x99C12383, 0x3849E8D4), LIMB_PAIR(0x87D64AC9, 0x4CEA3140), LIMB_PAIR(0xB1A29EE7, 0x1F354134),
+            LIMB_PAIR(0x82B7ABF0, 0x4A89E68B), LIMB_PAIR(0x9BA6B7B9, 0xF41CD927), LIMB_PAIR(0xE18D876F, 0x16E6C210), LIMB_PAIR(0x7F1B09C6, 0x7CACDB0F)
+        }
+    },
+#endif
+#if (26 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^26 * B
+            LIMB_PAIR(0xDCC5CAED, 0xE1014434), LIMB_PAIR(0x3C84FB33, 0x47ED5D96), LIMB_PAIR(0xED86A0E7, 0x70019576), LIMB_PAIR(0xD267F9E4, 0x25B2697B),
+            LIMB_PAIR(0xD91A78BC, 0x9062B2E0), LIMB_PAIR(0xC8509667, 0x47C9889C), LIMB_PAIR(0x405070B8, 0x9DF54A66), LIMB_PAIR(0x2493A1BF, 0x7369E6A9),
+            LIMB_PAIR(0x13986864, 0x9D673FFB), LIMB_PAIR(0x415DC7B8, 0x3CA5FBD9), LIMB_PAIR(0xDF273B5E, 0xE04ECC3B), LIMB_PAIR(0xB54E4CD2, 0x1420683D)
+        },
+        {   // 2 * 16^26 * B
+            LIMB_PAIR(0xC1CC5AD0, 0x34EEBB6F), LIMB_PAIR(0x9646AC8B, 0x6A1B0CE9), LIMB_PAIR(0xA66BDE53, 0xD3B0DA49), LIMB_PAIR(0x61D081C1, 0x31E83B41),
+            LIMB_PAIR(0x249DD197, 0xB478BD1E), LIMB_PAIR(0x5E58C102, 0x620C3500), LIMB_PAIR(0xCCBAAC5C, 0xFB02D32F), LIMB_PAIR(0xF508A72D, 0x60B63BEB),
+            LIMB_PAIR(0x9E062B4F, 0x97E8C712), LIMB_PAIR(0x29320AD8, 0x49E48F4F), LIMB_PAIR(0x6F18683F, 0x5BECE14B), LIMB_PAIR(0x2D550317, 0x55CF1EB6)
+        },
+        {   // 3 * 16^26 * B
+            LIMB_PAIR(0x7DF58C52, 0x3076B5E3), LIMB_PAIR(0xE799CC36, 0xD73AB9DD), LIMB_PAIR(0x4913EE20, 0xBD831CE3), LIMB_PAIR(0x62BA0133, 0x1A56FBAA),
+            LIMB_PAIR(0x65C23D58, 0x58791010), LIMB_PAIR(0x5094819C, 0x8B9D086D), LIMB_PAIR(0x12C55FA7, 0xE2402FA9), LIMB_PAIR(0x570891D4, 0x669A6564),
+            LIMB_PAIR(0x5C9DC9EC, 0x943E6B50), LIMB_PAIR(0xA77C371A, 0x302557BB), LIMB_PAIR(0x41347651, 0x9873AE56), LIMB_PAIR(0x99C58A5C, 0x13C48367)
+        },
+        {   // 4 * 16^26 * B
+            LIMB_PAIR(0x5D8BD080, 0xC4DCFB6A), LIMB_PAIR(0x571A4842, 0xDEEBC4EC), LIMB_PAIR(0xB8E55365, 0xD4B2E883), LIMB_PAIR(0xC8E5B827, 0x50BDC87D),
+            LIMB_PAIR(0x5AB3E1B9, 0x423A5D46), LIMB_PAIR(0xC7F13F61, 0xFC13C187), LIMB_PAIR(0xECB5B9B6, 0x19F83664), LIMB_PAIR(0xA637B607, 0x66F80C93),
+            LIMB_PAIR(0x6EDFE111, 0x606D3783), LIMB_PAIR(0xF011ABD9, 0x32353E15), LIMB_PAIR(0x25B73B96, 0x64B03AC3), LIMB_PAIR(0x725FD5AE, 0x1DD56444)
+        },
+        {   // 5 * 16^26 * B
+            LIMB_PAIR(0x08BAC89A, 0xC297E600), LIMB_PAIR(0xEAE1C3E0, 0x7D4CEA11), LIMB_PAIR(0x9FE7977C, 0xF3E38BE1), LIMB_PAIR(0x63A305CD, 0x3A3A450F),
+            LIMB_PAIR(0x3362127D, 0x8FA47FF8), LIMB_PAIR(0x71CD7C15, 0xBC9F6AC4), LIMB_PAIR(0x49220C8B, 0x6E714543), LIMB_PAIR(0x219F732E, 0x0E645912),
+            LIMB_PAIR(0xD8394627, 0x078F2F31), LIMB_PAIR(0xDE94A510, 0x389D3183), LIMB_PAIR(0x17996F80, 0xD1E36C6D), LIMB_PAIR(0x93A9A87B, 0x318C8D93)
+        },
+        {   // 6 * 16^26 * B
+            LIMB_PAIR(0xAB1DD398, 0x5D669E29), LIMB_PAIR(0x342D9E3B, 0xFC921658), LIMB_PAIR(0xF35973CD, 0x55851DFD), LIMB_PAIR(0x25950AF6, 0x509A41C3),
+            LIMB_PAIR(0x2AFFFE19, 0xF2745D03), LIMB_PAIR(0x7F24DB66, 0x0C9F3C49), LIMB_PAIR(0xBA8598EF, 0xBC98D3E3), LIMB_PAIR(0x9A1D5314, 0x224C7C67),
+            LIMB_PAIR(0xA6F925E9, 0xBDC06EDC), LIMB_PAIR(0x641B1F33, 0x793EF3F4), LIMB_PAIR(0x9D833E89, 0x82EC1280), LIMB_PAIR(0x28A11389, 0x05BFF023)
+        },
+        {   // 7 * 16^26 * B
+            LIMB_PAIR(0x0DC512E4, 0x6881A0DD), LIMB_PAIR(0x44A5FAFE, 0x4FE70DC8), LIMB_PAIR(0x8F4A5240, 0x1F748E6B), LIMB_PAIR(0xEE01A3EA, 0x576277CD),
+            LIMB_PAIR(0x23CAE00B, 0x36321370), LIMB_PAIR(0xD1ACCF59, 0x544ACF0A), LIMB_PAIR(0xD21A1C88, 0x96741049), LIMB_PAIR(0xFA2A44A7, 0x780B8CC3),
+            LIMB_PAIR(0x234F305F, 0x1EF38ABC), LIMB_PAIR(0x1405DE08, 0x9A577FBD), LIMB_PAIR(0x34E62A0D, 0x5E82A514), LIMB_PAIR(0x6271B7A1, 0x5FF41872)
+        },
+        {   // 8 * 16^26 * B
+            LIMB_PAIR(0x13B69540, 0xE5DB47E8), LIMB_PAIR(0x432610E1, 0xF35D2A3B), LIMB_PAIR(0x38781276, 0xAC1F26E9), LIMB_PAIR(0xA0A0CB69, 0x29D4DB8C),
+            LIMB_PAIR(0x1789DB9D, 0x398E080C), LIMB_PAIR(0xF3E778F5, 0xA7602025), LIMB_PAIR(0x06BD035D, 0xFA98894C), LIMB_PAIR(0x25A966BE, 0x106A03DC),
+            LIMB_PAIR(0x333353D0, 0xD9AD0AAF), LIMB_PAIR(0xACD309E5, 0x38669DA5), LIMB_PAIR(0xC888F7F0, 0x3C57658A), LIMB_PAIR(0x052CBEFA, 0x4AB38A51)
+        }
+    },
+#endif
+#if (27 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^27 * B
+            LIMB_PAIR(0x809DE054, 0xF68FE2E8), LIMB_PAIR(0x9C82BAD1, 0xE3BC096A), LIMB_PAIR(0x0AADBF45, 0x076353D4), LIMB_PAIR(0xDEA1959E, 0x7B9B1FB5),
+            LIMB_PAIR(0x4324C0E9, 0xDFDACBEE), LIMB_PAIR(0x3F955BB7, 0x05444288), LIMB_PAIR(0xEA31609F, 0xDEF7AAA8), LIMB_PAIR(0x42287CFF, 0x68AEE706),
+            LIMB_PAIR(0x7471CC0C, 0xF01CC8F1), LIMB_PAIR(0x579082BB, 0x95242E37), LIMB_PAIR(0xD3E46B5F, 0x27776093), LIMB_PAIR(0x28BD85FB, 0x2D13D55A)
+        },
+        {   // 2 * 16^27 * B
+            LIMB_PAIR(0x7AEE7A52, 0xBF019CCE), LIMB_PAIR(0xE454EAD3, 0xA8DED2B6), LIMB_PAIR(0x87A8BB19, 0x3C619F0B), LIMB_PAIR(0x560916D8, 0x3619B5D7),
+            LIMB_PAIR(0x5B35B8DA, 0xFAC5D206), LIMB_PAIR(0x85624BB7, 0xA8DA8A9A), LIMB_PAIR(0x3D21CD0F, 0xCCD2CA91), LIMB_PAIR(0x8BF90D58, 0x6B8341EE),
+            LIMB_PAIR(0x0282C4B2, 0x3579F26B), LIMB_PAIR(0x4FAFEFAE, 0x64D592F2), LIMB_PAIR(0x28C8C7C0, 0xB7CDED7B), LIMB_PAIR(0x7173A8D7, 0x6A927B6B)
+        },
+        {   // 3 * 16^27 * B
+            LIMB_PAIR(0x3ECE88EB, 0x8D704086), LIMB_PAIR(0x80EEC08C, 0xF0E307A9), LIMB_PAIR(0x0D788FDA, 0xAC225061), LIMB_PAIR(0x3A0D478D, 0x056D92A4),
+            LIMB_PAIR(0x986E4656, 0x1F6DB24F), LIMB_PAIR(0xD1E9105B, 0x1021C02E), LIMB_PAIR(0x2CC0A375, 0xF8FF3FFF), LIMB_PAIR(0xC6C82592, 0x1D2A6BF8),
+            LIMB_PAIR(0xFC3DA5A1, 0x1B05A196), LIMB_PAIR(0x43B59ED0, 0x77D7A8C2), LIMB_PAIR(0x97D17918, 0x06DA3D62), LIMB_PAIR(0xF12353F7, 0x66FBB494)
+        },
+        {   // 4 * 16^27 * B
+            LIMB_PAIR(0xF12309D6, 0xD6D70996), LIMB_PAIR(0xE9C3D539, 0xDBFB2385), LIMB_PAIR(0xF7552411, 0x46D602B0), LIMB_PAIR(0x57843E0C, 0x270A0B05),
+            LIMB_PAIR(0xD85C0FB8, 0x751A50B9), LIMB_PAIR(0x8BCF097B, 0xD1AFDC25), LIMB_PAIR(0x8309A969, 0x2F16A6A3), LIMB_PAIR(0xE5B00659, 0x14DDFF9E),
+            LIMB_PAIR(0xA7862BCC, 0x61FF0640), LIMB_PAIR(0x5F11ABFE, 0x81CAC09A), LIMB_PAIR(0x55D12ABB, 0x90478304), LIMB_PAIR(0x945AE873, 0x19A4BDE1)
+        },
+        {   // 5 * 16^27 * B
+            LIMB_PAIR(0xC076C49F, 0x40C709DE), LIMB_PAIR(0x7F3E53F6, 0x657BFAF2), LIMB_PAIR(0xECA042C4, 0x40662331), LIMB_PAIR(0x7EB4DF04, 0x14B37548),
+            LIMB_PAIR(0x20A6200A, 0x9B9F26F5), LIMB_PAIR(0xCF13EAF8, 0x64804443), LIMB_PAIR(0x8631EDD3, 0x8A63673F), LIMB_PAIR(0x1ED39DC1, 0x72BBBCE1),
+            LIMB_PAIR(0xAB66DC47, 0xAE853C94), LIMB_PAIR(0xDF762D6E, 0xEB62343E), LIMB_PAIR(0x6FB2F7D1, 0xF08E0E18), LIMB_PAIR(0x700AB37A, 0x4F0B1C02)
+        },
+        {   // 6 * 16^27 * B
+            LIMB_PAIR(0xC1B2E23F, 0x79FD21CC), LIMB_PAIR(0x453DF52A, 0x4AE7C281), LIMB_PAIR(0xD151486B, 0xC8172EC9), LIMB_PAIR(0x3E0A7534, 0x68ABE944),
+            LIMB_PAIR(0xD81951FA, 0xE1706787), LIMB_PAIR(0xB290C77B, 0xA10A2C8E), LIMB_PAIR(0x3ED66773, 0xE7382FA0), LIMB_PAIR(0x0BCC4B54, 0x0A4D8471),
+            LIMB_PAIR(0x07831DCB, 0xDA12C6C4), LIMB_PAIR(0x4D5C510D, 0x0DA230D7), LIMB_PAIR(0x6BD404E1, 0x4AB1531E), LIMB_PAIR(0xBCF440EF, 0x4106B166)
+        },
+        {   // 7 * 16^27 * B
+            LIMB_PAIR(0x39E4ECF2, 0xA485CCD5), LIMB_PAIR(0x0555BAB5, 0x5AA3F3AD), LIMB_PAIR(0x937DF82D, 0x145E3439), LIMB_PAIR(0x1214283F, 0x1238B51E),
+            LIMB_PAIR(0x1CD23668, 0x02E57A42), LIMB_PAIR(0x0EAEF6FD, 0x4AD9FB5D), LIMB_PAIR(0xB1244480, 0x954E6727), LIMB_PAIR(0x2699F331, 0x7F792F9D),
+            LIMB_PAIR(0x5FD4D924, 0x0B886B92), LIMB_PAIR(0x3626A80D, 0x60906F7A), LIMB_PAIR(0xB98ABD12, 0xECD367B4), LIMB_PAIR(0xDEF344CF, 0x2876BEB1)
+        },
+        {   // 8 * 16^27 * B
+            LIMB_PAIR(0x3A8A85F8, 0xD594B333), LIMB_PAIR(0xE78D7D58, 0x4EA37689), LIMB_PAIR(0x5E8E351F, 0x73BF9F45), LIMB_PAIR(0xBC41EBB4, 0x5507D7D2),
+            LIMB_PAIR(0x63144691, 0xDC84E935), LIMB_PAIR(0xD61F23F4, 0x632FE8A0), LIMB_PAIR(0x12A9A8D5, 0x4CAA8006), LIMB_PAIR(0x0E9918D3, 0x48F9DBFA),
+            LIMB_PAIR(0x299572FC, 0x1CEB2903), LIMB_PAIR(0x9502D0EE, 0x7C8CCAA2), LIMB_PAIR(0x11CCE67B, 0x91BFA434), LIMB_PAIR(0x64A831E7, 0x57844819)
+        }
+    },
+#endif
+#if (28 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^28 * B
+            LIMB_PAIR(0x5FDDC09C, 0xD6CFD1EF), LIMB_PAIR(0xF7575DCE, 0xE82B3EFD), LIMB_PAIR(0x201634C2, 0x25D56B5D), LIMB_PAIR(0x04ED2B9B, 0x3041C6BB),
+            LIMB_PAIR(0x6768D593, 0xDA7C2B25), LIMB_PAIR(0x4422CA13, 0x98C1C057), LIMB_PAIR(0xCA0ACE1D, 0xF1A80BD5), LIMB_PAIR(0xC088A690, 0x29CDD1AD),
+            LIMB_PAIR(0xD956E148, 0x0FF2F2F9), LIMB_PAIR(0x9F356B2E, 0xADE79775), LIMB_PAIR(0x5F6C025C, 0x1A4698BB), LIMB_PAIR(0x14049A7B, 0x104BBD68)
+        },
+        {   // 2 * 16^28 * B
+            LIMB_PAIR(0xD67FF163, 0xA95D9A5F), LIMB_PAIR(0x4CC75681, 0xE92BE69D), LIMB_PAIR(0xDE20F257, 0xB7F8024C), LIMB_PAIR(0xFB072DF5, 0x204F2A20),
+            LIMB_PAIR(0x68F1ED67, 0x51F0FD31), LIMB_PAIR(0xD86F3BC2, 0x2C811DCD), LIMB_PAIR(0x04D2F2DE, 0x44DC5C43), LIMB_PAIR(0x092A7149, 0x5BE8CC57),
+            LIMB_PAIR(0x30EBB079, 0xC8143B3D), LIMB_PAIR(0xBD652E30, 0x7589155A), LIMB_PAIR(0x8F6D5C31, 0x653C3C31), LIMB_PAIR(0xC279161F, 0x2570FB17)
+        },
+        {   // 3 * 16^28 * B
+            LIMB_PAIR(0x0BB8245A, 0x192EA955), LIMB_PAIR(0x8F9050D1, 0xC8E6FBA8), LIMB_PAIR(0x88A4C935, 0x7986EA2D), LIMB_PAIR(0xDE018668, 0x241C5F91),
+            LIMB_PAIR(0x2CB61575, 0x3EFA367F), LIMB_PAIR(0x1CD6026C, 0xF5F96F76), LIMB_PAIR(0x65B52562, 0xE8C7142A), LIMB_PAIR(0x53030ACD, 0x3DCB65EA),
+            LIMB_PAIR(0x40DE6CAA, 0x28D81729), LIMB_PAIR(0x22D9733A, 0x8FBF2CF0), LIMB_PAIR(0x235B01D1, 0x16D7FCDD), LIMB_PAIR(0x5FCDF0E5, 0x08420EDD)
+        },
+        {   // 4 * 16^28 * B
+            LIMB_PAIR(0x04F410CE, 0x0358C34E), LIMB_PAIR(0x276E0685, 0xB6135B5A), LIMB_PAIR(0xEBB91521, 0x5D9670C7), LIMB_PAIR(0x21DB889C, 0x04D654F3),
+            LIMB_PAIR(0x8362FA4A, 0xCDFF20AB), LIMB_PAIR(0xE21A3E6E, 0x57E118D4), LIMB_PAIR(0xFC39E62B, 0xE3179617), LIMB_PAIR(0xBC1769FD, 0x0D9A53EF),
+            LIMB_PAIR(0xDDBDB5D5, 0x5E7DC116), LIMB_PAIR(0x8DA5DD2D, 0x2954DEB6), LIMB_PAIR(0x3334A292, 0x1CB60817), LIMB_PAIR(0x18991AD7, 0x4A7A4F26)
+        },
+        {   // 5 * 16^28 * B
+            LIMB_PAIR(0xAF372A4B, 0x24C3B291), LIMB_PAIR(0x718147F2, 0x93DA8270), LIMB_PAIR(0x86899EF2, 0xDD848564), LIMB_PAIR(0x23E0EE33, 0x4A963142),
+            LIMB_PAIR(0x5FB15F95, 0xF4A71802), LIMB_PAIR(0x6B5C1B8F, 0x3DF65F34), LIMB_PAIR(0x00E01112, 0xCDFCF085), LIMB_PAIR(0xDDD31848, 0x11B50C4C),
+            LIMB_PAIR(0x08A4FFD6, 0xA6E82744), LIMB_PAIR(0x9C1576D9, 0x738E177E), LIMB_PAIR(0x3D02B3F2, 0x773348B6), LIMB_PAIR(0xCE6BCC51, 0x4F4BCE4D)
+        },
+        {   // 6 * 16^28 * B
+            LIMB_PAIR(0xC49D0B6F, 0x30E2616E), LIMB_PAIR(0xCAEC2317, 0xE456718F), LIMB_PAIR(0xF26B4FA6, 0x48EB409B), LIMB_PAIR(0x61595F37, 0x3042CEE5),
+            LIMB_PAIR(0xE2242584, 0xA71FCE5A), LIMB_PAIR(0x92F58A9E, 0x26EA7256), LIMB_PAIR(0x1CEA3CF4, 0xD21A09D7), LIMB_PAIR(0xB71C01E6, 0x73FCDD14),
+            LIMB_PAIR(0x449BAC41, 0x427E7079), LIMB_PAIR(0xBCE2310A, 0x855AE36D), LIMB_PAIR(0x5F841A7C, 0x4CAE7621), LIMB_PAIR(0x9A9CE1D6, 0x389E740C)
+        },
+        {   // 7 * 16^28 * B
+            LIMB_PAIR(0x570EAC28, 0xC9BD78F6), LIMB_PAIR(0x27919CE1, 0xE55B0B32), LIMB_PAIR(0xA19B91ED, 0x65FC3EAB), LIMB_PAIR(0xD6263690, 0x25C425E5),
+            LIMB_PAIR(0x34DCB9CE, 0x64FCB3AE), LIMB_PAIR(0xE348D0AD, 0x97500323), LIMB_PAIR(0x62C6381B, 0x45B3F07D), LIMB_PAIR(0x465A6788, 0x61545379),
+            LIMB_PAIR(0xF1D7DE6E, 0x3F3E06A6), LIMB_PAIR(0x8E062308, 0x3EF97627), LIMB_PAIR(0x4E8A6C77, 0x8C14F626), LIMB_PAIR(0x15484759, 0x6539A089)
+        },
+        {   // 8 * 16^28 * B
+            LIMB_PAIR(0x14BB4A19, 0xDDC4DBD4), LIMB_PAIR(0x98424F8E, 0x19B2BC3C), LIMB_PAIR(0x36CA7169, 0x48A89FD7), LIMB_PAIR(0xF019BD90, 0x0F65320E),
+            LIMB_PAIR(0xC3D2F773, 0xE9D21F74), LIMB_PAIR(0x25C46845, 0xC1505441), LIMB_PAIR(0xF9B99E33, 0x624E5CE8), LIMB_PAIR(0xC5CD186C, 0x11C5E4AA),
+            LIMB_PAIR(0xCAFDE0C6, 0xD486D1B1), LIMB_PAIR(0x163B5181, 0x4F3FE6E3), LIMB_PAIR(0xFAF2939A, 0x59A8AF0D), LIMB_PAIR(0xEC33072A, 0x4CABC7BD)
+        }
+    },
+#endif
+#if (29 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^29 * B
+            LIMB_PAIR(0x1A54A044, 0xF7C0A19C), LIMB_PAIR(0x77BD9FBB, 0x4A1C5E24), LIMB_PAIR(0x5AF22972, 0xA6E3CA11), LIMB_PAIR(0x3F2E9E0D, 0x1819BB95),
+            LIMB_PAIR(0x532F7428, 0x16FAA8FB), LIMB_PAIR(0x46A4E272, 0xDBD42EA0), LIMB_PAIR(0x8B9EA480, 0x5337653B), LIMB_PAIR(0x23973F03, 0x40659472),
+            LIMB_PAIR(0x5E042E84, 0x498FBB79), LIMB_PAIR(0x7698B714, 0x7D0DD89A), LIMB_PAIR(0x27FE6295, 0x8BFB0BA4), LIMB_PAIR(0x21200524, 0x36BA82E7)
+        },
+        {   // 2 * 16^29 * B
+            LIMB_PAIR(0x57274ED5, 0xC8D69D0A), LIMB_PAIR(0x60804B17, 0x45BA8032), LIMB_PAIR(0x2255DFAC, 0xDF3CDA10), LIMB_PAIR(0x2709B339, 0x77D22123),
+            LIMB_PAIR(0x4245EC41, 0xD60ECBB7), LIMB_PAIR(0x34348716, 0xFD9BE89E), LIMB_PAIR(0xE42284DE, 0xC9240AFE), LIMB_PAIR(0xD0531DB4, 0x4472F648),
+            LIMB_PAIR(0x64AD94D8, 0x498A6D70), LIMB_PAIR(0x9AF62263, 0xA5B5C8FD), LIMB_PAIR(0x45C141F4, 0x8CA8ED05), LIMB_PAIR(0x662D358C, 0x2C63BEC3)
+        },
+        {   // 3 * 16^29 * B
+            LIMB_PAIR(0x8586F8BF, 0x9A518B3A), LIMB_PAIR(0xCBB196F0, 0x9EE71AF6), LIMB_PAIR(0xA2385CF2, 0xAA0625E6), LIMB_PAIR(0xDDD7C8D1, 0x1DEB2176),
+            LIMB_PAIR(0xEA787955, 0x7FE60D8B), LIMB_PAIR(0xB5F401B7, 0xB9DC117E), LIMB_PAIR(0x19355CCE, 0x91C7C09A), LIMB_PAIR(0x9442BEDF, 0x22692EF5),
+            LIMB_PAIR(0x2066CF6C, 0x8563D19A), LIMB_PAIR(0x4DCC7CD7, 0x401BFD8C), LIMB_PAIR(0xCD0D8F62, 0xD976A6BE), LIMB_PAIR(0xA278B05E, 0x67CFD773)
+        },
+        {   // 4 * 16^29 * B
+            LIMB_PAIR(0x5A4E586A, 0x2D5FA985), LIMB_PAIR(0x49BEAB7E, 0x65F8F7A4), LIMB_PAIR(0xF21D33D3, 0xAA074DDD), LIMB_PAIR(0x1BCB9DEE, 0x185CBA72),
+            LIMB_PAIR(0xEF3EE475, 0x8DEC31FA), LIMB_PAIR(0x9E22FD92, 0x99DBFF8A), LIMB_PAIR(0x4E26CAB1, 0x512D1159), LIMB_PAIR(0xEC4310B9, 0x0CDE561E),
+            LIMB_PAIR(0xF4E3CB41, 0x93869DA3), LIMB_PAIR(0x40F7977E, 0xBF0392F5), LIMB_PAIR(0xD0463B83, 0x026204FC), LIMB_PAIR(0x9EEC6EED, 0x3EC91A76)
+        },
+        {   // 5 * 16^29 * B
+            LIMB_PAIR(0xB0A3402F, 0x0FAD2FB7), LIMB_PAIR(0xFB69F4A8, 0x46615ECB), LIMB_PAIR(0xC5F8EAA6, 0xF745BCC8), LIMB_PAIR(0x4A94E896, 0x7A5FA879),
+            LIMB_PAIR(0xF78166AD, 0x1E9DF75B), LIMB_PAIR(0xEB0CD7AF, 0x4DFDA838), LIMB_PAIR(0xC1EAF988, 0xBA002ED8), LIMB_PAIR(0x11F33CFC, 0x13FEDB3E),
+            LIMB_PAIR(0x13CD67A1, 0x52958FAA), LIMB_PAIR(0x8BDBB517, 0x965EE081), LIMB_PAIR(0x2E8845B3, 0x16E58DAA), LIMB_PAIR(0x5499DA8F, 0x357D397D)
+        },
+        {   // 6 * 16^29 * B
+            LIMB_PAIR(0x194BFBF8, 0x481DACB4), LIMB_PAIR(0xBAE58299, 0x4D77E3F1), LIMB_PAIR(0x7D1372A0, 0x1EF4612E), LIMB_PAIR(0x70FF69E1, 0x3A8D867E),
+            LIMB_PAIR(0xB0BACE6C, 0x1EBFA05F), LIMB_PAIR(0x1CAF9A1E, 0xC934620C), LIMB_PAIR(0x1D82B61A, 0xCC771CC4), LIMB_PAIR(0xA5F74FEC, 0x2D94A16A),
+            LIMB_PAIR(0x55AFF958, 0x6F58CD5D), LIMB_PAIR(0x75567721, 0xBA3EAA5C), LIMB_PAIR(0x9165227D, 0x75C12399), LIMB_PAIR(0xC2F2B35E, 0x69BE1343)
+        },
+        {   // 7 * 16^29 * B
+            LIMB_PAIR(0x684B8DE3, 0x82BBBDAC), LIMB_PAIR(0x3FCA0718, 0xA2F4C7D0), LIMB_PAIR(0xE096AAA8, 0x337F92FB), LIMB_PAIR(0x63587376, 0x200D4D8C),
+            LIMB_PAIR(0xE197C92A, 0x0E091D5E), LIMB_PAIR(0x2945119F, 0x4F51019F), LIMB_PAIR(0xF034E99C, 0x143679B9), LIMB_PAIR(0x4D24C696, 0x7D88112E),
+            LIMB_PAIR(0x4893B32B, 0x208AED4B), LIMB_PAIR(0xBE59B964, 0x3EFBF23E), LIMB_PAIR(0xDBA5E507, 0xD762DEB0), LIMB_PAIR(0x81BD9D94, 0x69607BD6)
+        },
+        {   // 8 * 16^29 * B
+            LIMB_PAIR(0x9323A902, 0x3B7F3BD4), LIMB_PAIR(0x6B2C6E53, 0x7C21B556), LIMB_PAIR(0x3A7852A7, 0xE5BA8FF5), LIMB_PAIR(0x838ECE00, 0x28BC77A5),
+            LIMB_PAIR(0x68DE1CE1, 0xF6BE0210), LIMB_PAIR(0x0EDCBC1F, 0xE8D518E7), LIMB_PAIR(0x1B5505A5, 0xE3EFFDD0), LIMB_PAIR(0xD3EC3FD0, 0x35F63353),
+            LIMB_PAIR(0xE25D8036, 0x63BA78A8), LIMB_PAIR(0x94333490, 0x63651E00), LIMB_PAIR(0x288CE532, 0x48D82F20), LIMB_PAIR(0x36B57524, 0x3A31ABFA)
+        }
+    },
+#endif
+#if (30 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^30 * B
+            LIMB_PAIR(0x3F78D289, 0xC08F788F), LIMB_PAIR(0xA1404D9F, 0xFE30A72C), LIMB_PAIR(0xCF65CC9D, 0xF2778BFC), LIMB_PAIR(0x5ACB2021, 0x7EE49816),
+            LIMB_PAIR(0x089C0A2E, 0x239E9624), LIMB_PAIR(0x3AFE4738, 0xC748C4C0), LIMB_PAIR(0x764FA12A, 0x17DBED2A), LIMB_PAIR(0x321C8582, 0x639B93F0),
+            LIMB_PAIR(0x9111A1C3, 0x7BD508E3), LIMB_PAIR(0x80907489, 0x2B2B90D4), LIMB_PAIR(0xAE72FD19, 0xE7D2AEC2), LIMB_PAIR(0x85B602A6, 0x0EDF493C)
+        },
+        {   // 2 * 16^30 * B
+            LIMB_PAIR(0x84764113, 0x6767C4D2), LIMB_PAIR(0xF7F5F835, 0xA090403F), LIMB_PAIR(0xCAE6BEDE, 0x1C8FCFFA), LIMB_PAIR(0xD1DFA369, 0x04C00C54),
+            LIMB_PAIR(0x599B5A68, 0xAECC8158), LIMB_PAIR(0xEBADE20E, 0xEA574F0F), LIMB_PAIR(0x22B67F07, 0x4FE41D74), LIMB_PAIR(0x019D4FB4, 0x403B92E3),
+            LIMB_PAIR(0x8B465CF8, 0x4DC22F81), LIMB_PAIR(0x1480EFF8, 0x71A0F35A), LIMB_PAIR(0x04C7D657, 0xAEE8BFAD), LIMB_PAIR(0xB26176F4, 0x355BB12A)
+        },
+        {   // 3 * 16^30 * B
+            LIMB_PAIR(0x5A8C7318, 0xA301DAC7), LIMB_PAIR(0xB3CEAA11, 0xED90039D), LIMB_PAIR(0x3BAE3F2D, 0x6F077CBF), LIMB_PAIR(0xE052AD8E, 0x7518EAF8),
+            LIMB_PAIR(0x7493BBF4, 0xA71E64CC), LIMB_PAIR(0xECA3B0C3, 0xE5BD84D9), LIMB_PAIR(0xFA05E785, 0x0A6BC50C), LIMB_PAIR(0x182EC312, 0x0F9B8132),
+            LIMB_PAIR(0x1B7F6C32, 0xA48859C4), LIMB_PAIR(0xF4383298, 0x0F2D60BC), LIMB_PAIR(0xC9B1D1D9, 0x1815A929), LIMB_PAIR(0xBB1755C4, 0x47C3871B)
+        },
+        {   // 4 * 16^30 * B
+            LIMB_PAIR(0xC85066B0, 0xFBE65D50), LIMB_PAIR(0xB3A299B0, 0x62ECC4B0), LIMB_PAIR(0x441AE8E0, 0xE53754EA), LIMB_PAIR(0xE8D48D5F, 0x08FEA02C),
+            LIMB_PAIR(0x71EC4F48, 0x51445397), LIMB_PAIR(0xC98C5D6E, 0xF805B17D), LIMB_PAIR(0x47C3C66B, 0xF762C11A), LIMB_PAIR(0x764699DC, 0x00B89B85),
+            LIMB_PAIR(0x68DEEAD0, 0x824DDD76), LIMB_PAIR(0x4B685D23, 0xC8644520), LIMB_PAIR(0x5D89D665, 0xB514CFCD), LIMB_PAIR(0x4F75D537, 0x473829A7)
+        },
+        {   // 5 * 16^30 * B
+            LIMB_PAIR(0xAD3902C9, 0x23D9533A), LIMB_PAIR(0xEF03588F, 0x64C2DDCE), LIMB_PAIR(0xCFE12FB4, 0x15257390), LIMB_PAIR(0x44E4D390, 0x6C668B4D),
+            LIMB_PAIR(0x4679C418, 0x82D2DA75), LIMB_PAIR(0xB2618DF0, 0xE63BD7D8), LIMB_PAIR(0xAC47EB0A, 0x355EEF24), LIMB_PAIR(0x4833C6B4, 0x2078684C),
+            LIMB_PAIR(0x7A78820C, 0x3B48CF21), LIMB_PAIR(0x81273E97, 0xF76A0AB2), LIMB_PAIR(0x8C8EED7B, 0xA96C65A7), LIMB_PAIR(0x4F8A433F, 0x7411A605)
+        },
+        {   // 6 * 16^30 * B
+            LIMB_PAIR(0x18B175B4, 0x579AE53D), LIMB_PAIR(0xF392A102, 0x68713159), LIMB_PAIR(0x1EEF35F5, 0x8455ECBA), LIMB_PAIR(0x458C398F, 0x1EC9A872),
+            LIMB_PAIR(0xB99DC86D, 0x4D659D32), LIMB_PAIR(0x603AF115, 0x044CDC75), LIMB_PAIR(0xDCC2E488, 0xB34C712C), LIMB_PAIR(0xFB8134FF, 0x7C136574),
+            LIMB_PAIR(0x00A2509B, 0xB8E6A4D4), LIMB_PAIR(0x0BC882B4, 0x9B81D702), LIMB_PAIR(0xF1957561, 0x57E7CC9B), LIMB_PAIR(0xC7CD6460, 0x3ADD88A5)
+        },
+        {   // 7 * 16^30 * B
+            LIMB_PAIR(0x59393046, 0x85C298D4), LIMB_PAIR(0x5FF659EC, 0x8F7E3598), LIMB_PAIR(0xF2F66E3A, 0x1D2CA22A), LIMB_PAIR(0xA406A720, 0x61BA1131),
+            LIMB_PAIR(0xB635DCF2, 0xAB895770), LIMB_PAIR(0xF66C1FBC, 0x02DFEF6C), LIMB_PAIR(0xBEB6D187, 0x85530268), LIMB_PAIR(0xCC879E74, 0x249929FC),
+            LIMB_PAIR(0x16959029, 0xA3D0A0F1), LIMB_PAIR(0xBA7EBD89, 0x023B6B6C), LIMB_PAIR(0x26783307, 0x7BF15A3E), LIMB_PAIR(0xBBD8ECE7, 0x5620310C)
+        },
+        {   // 8 * 16^30 * B
+            LIMB_PAIR(0x77E285D6, 0x6646B5F4), LIMB_PAIR(0x6C8F6193, 0x40E8FF67), LIMB_PAIR(0xABB594DD, 0xA6EC7311), LIMB_PAIR(0x658CEC4D, 0x7EC846F3),
+            LIMB_PAIR(0x4934D643, 0x52899343), LIMB_PAIR(0xA51222F5, 0xB9DBF806), LIMB_PAIR(0xC3F41C22, 0x8F6D878F), LIMB_PAIR(0x4D9D9730, 0x37676A2A),
+            LIMB_PAIR(0x1DA22EC7, 0x9B5E8F3F), LIMB_PAIR(0x6C01CD13, 0x130F1D77), LIMB_PAIR(0xA2989FB8, 0x214C8FCF), LIMB_PAIR(0x399B9DD5, 0x6DAAF723)
+        }
+    },
+#endif
+#if (31 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^31 * B
+            LIMB_PAIR(0x2CD13070, 0x81AEBBDD), LIMB_PAIR(0xF85A0E9E, 0x962E4325), LIMB_PAIR(0xCADFFECB, 0xDE9391AA), LIMB_PAIR(0x52C230E6, 0x53177FDA),
+            LIMB_PAIR(0x10628564, 0x591E4A56), LIMB_PAIR(0xA8B4DF34, 0x2A4BB87C), LIMB_PAIR(0xE7A38E43, 0xDE2A2572), LIMB_PAIR(0xFEE5046E, 0x3CBDABD9),
+            LIMB_PAIR(0x50B9DE79, 0xA7BC9706), LIMB_PAIR(0xC301B59B, 0x3D12A7FB), LIMB_PAIR(0xD36AE38C, 0x02652E68), LIMB_PAIR(0x5A6199DC, 0x79D73983)
+        },
+        {   // 2 * 16^31 * B
+            LIMB_PAIR(0x0D591737, 0x21C9D992), LIMB_PAIR(0xE9B46CD6, 0x9BEA41D2), LIMB_PAIR(0x0D89BFCA, 0xE20E8420), LIMB_PAIR(0x6EAE5FF8, 0x79D99F94),
+            LIMB_PAIR(0x4131C1BD, 0xD9354DF6), LIMB_PAIR(0x86EC5822, 0x758094A1), LIMB_PAIR(0xE459F3C2, 0x4464EE12), LIMB_PAIR(0xCB133282, 0x6C11FCE4),
+            LIMB_PAIR(0x68673205, 0xF17B4835), LIMB_PAIR(0x3CAAD96C, 0x387DEAE8), LIMB_PAIR(0x56FFE386, 0x61B471FD), LIMB_PAIR(0xB745A599, 0x31741195)
+        },
+        {   // 3 * 16^31 * B
+            LIMB_PAIR(0x3B02A047, 0x17F8BA68), LIMB_PAIR(0xFEEFB6C8, 0x50212096), LIMB_PAIR(0x1556CBE2, 0x70139BE2), LIMB_PAIR(0x1D98915B, 0x203E44A1),
+            LIMB_PAIR(0xB77A360B, 0xE8D10190), LIMB_PAIR(0x9995E702, 0x99B98320), LIMB_PAIR(0xFA0247AA, 0xBD4FDFF8), LIMB_PAIR(0xE0D36A87, 0x2772E344),
+            LIMB_PAIR(0x37B9E39F, 0xD6863EBA), LIMB_PAIR(0x723B5A23, 0x105BC169), LIMB_PAIR(0xA65C0762, 0x104F6459), LIMB_PAIR(0x5B4D38D4, 0x56795129)
+        },
+        {   // 4 * 16^31 * B
+            LIMB_PAIR(0x0D4B497F, 0x07242EB3), LIMB_PAIR(0xB9BCCC87, 0x1EF96306), LIMB_PAIR(0xD8116F45, 0x37950934), LIMB_PAIR(0x01405B04, 0x05468D62),
+            LIMB_PAIR(0x13037524, 0x535FD606), LIMB_PAIR(0xB0FBC26A, 0xE210ADF6), LIMB_PAIR(0x23E990AE, 0xAC8D0A9B), LIMB_PAIR(0xD72FDBF9, 0x47204D08),
+            LIMB_PAIR(0xF93267DE, 0x00F565A9), LIMB_PAIR(0xC0D58E8A, 0xCECFD78D), LIMB_PAIR(0xF318E28E, 0xA215E2DC), LIMB_PAIR(0x9B633352, 0x4599EE91)
+        },
+        {   // 5 * 16^31 * B
+            LIMB_PAIR(0x861AE579, 0xAC746D6B), LIMB_PAIR(0xF6AEA9DC, 0x31AB0650), LIMB_PAIR(0x40256D4C, 0x241D6611), LIMB_PAIR(0x3D21A5DE, 0x2F485E85),
+            LIMB_PAIR(0x70E0E76B, 0xD3C220CA), LIMB_PAIR(0xEA9F3094, 0xB12BEA58), LIMB_PAIR(0xC3271282, 0x294DDEC8), LIMB_PAIR(0xA1D1D028, 0x0C3539E1),
+            LIMB_PAIR(0x9C0833F3, 0x32974483), LIMB_PAIR(0xD2ABC484, 0x6FE6257F), LIMB_PAIR(0x4B358817, 0x5327D181), LIMB_PAIR(0x893FE9BC, 0x65712585)
+        },
+        {   // 6 * 16^31 * B
+            LIMB_PAIR(0xD708EE3F, 0x81C29F1B), LIMB_PAIR(0xAE6407D0, 0xDDCB5A05), LIMB_PAIR(0xD2A3EBA7, 0x97AEC1D7), LIMB_PAIR(0x91D50831, 0x1590521A),
+            LIMB_PAIR(0x32A61161, 0x9C102FB7), LIMB_PAIR(0x34D520A8, 0xE48E10DD), LIMB_PAIR(0x6F9A9176, 0x365C6354), LIMB_PAIR(0x046F6006, 0x32F6FE4C),
+            LIMB_PAIR(0xC7910ACC, 0x40A3A11E), LIMB_PAIR(0xF16D27AE, 0x9013DFF8), LIMB_PAIR(0xABB195D4, 0x1A9720D8), LIMB_PAIR(0x2EA98463, 0x1BB9FE45)
+        },
+        {   // 7 * 16^31 * B
+            LIMB_PAIR(0xCC36747C, 0xCF5E6C95), LIMB_PAIR(0x6B0BC30D, 0x29420153), LIMB_PAIR(0xEE797AF0, 0x453AC67C), LIMB_PAIR(0x2A8BB3C9, 0x5EAE6AB3),
+            LIMB_PAIR(0xB3D54F9E, 0xE9D1D950), LIMB_PAIR(0xE00D33C1, 0x2D5F9CBE), LIMB_PAIR(0xA04FC6AC, 0x51C2C656), LIMB_PAIR(0x3C1CBCC9, 0x65C091EE),
+            LIMB_PAIR(0x14F118EA, 0x70836611), LIMB_PAIR(0x94349CAD, 0x2B37B87B), LIMB_PAIR(0xB4E99F40, 0x7273F51C), LIMB_PAIR(0x23D75698, 0x78A2A958)
+        },
+        {   // 8 * 16^31 * B
+            LIMB_PAIR(0x5EF83207, 0xB4F23C42), LIMB_PAIR(0xC9A934B5, 0xABF894D3), LIMB_PAIR(0x39FD87F7, 0xD0708C13), LIMB_PAIR(0x17166130, 0x18767891),
+            LIMB_PAIR(0x5C8C2ACE, 0xA2B072E9), LIMB_PAIR(0x651E9C4B, 0x69CFFC96), LIMB_PAIR(0x42E7B42B, 0x44328EF8), LIMB_PAIR(0x22AADEB3, 0x5DD996C1),
+            LIMB_PAIR(0x670C507C, 0x925B5EF0), LIMB_PAIR(0xB93C33BF, 0x819BC842), LIMB_PAIR(0x70DD003F, 0x10792E9A), LIMB_PAIR(0x6E28DC74, 0x59AD4B7A)
+        }
+    },
+#endif
+#if (32 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^32 * B
+            LIMB_PAIR(0xACAD8EA2, 0x583B04BF), LIMB_PAIR(0x148BE884, 0x29B743E8), LIMB_PAIR(0x0810C5DB, 0x2B1E583B), LIMB_PAIR(0x8EB3BBAA, 0x2B5449E5),
+            LIMB_PAIR(0xEB3DBE47, 0x5F3A7562), LIMB_PAIR(0x8EBDA0B8, 0xF7EA3854), LIMB_PAIR(0x45747299, 0x00C3E531), LIMB_PAIR(0x1627D551, 0x1304E9E7),
+            LIMB_PAIR(0x6ADC9CFE, 0x789814D2), LIMB_PAIR(0x8B48DD0B, 0x3C1BAB3F), LIMB_PAIR(0xF979C60A, 0xDA0FE1FF), LIMB_PAIR(0x7C2DD693, 0x4468DE2D)
+        },
+        {   // 2 * 16^32 * B
+            LIMB_PAIR(0xF86307CE, 0x4B9AD8C6), LIMB_PAIR(0x435D0C28, 0x21113531), LIMB_PAIR(0x657A772C, 0xD4A866C5), LIMB_PAIR(0x63247352, 0x5DA6427E),
+            LIMB_PAIR(0x9419469E, 0x51BB355E), LIMB_PAIR(0x23DDC754, 0x33E6DC4C), LIMB_PAIR(0x447F9962, 0x93A5B6D6), LIMB_PAIR(0xFB44BD63, 0x6CCE7C6F),
+            LIMB_PAIR(0xDEAC22CA, 0x1A94C688), LIMB_PAIR(0xBBAE1FF8, 0xB9066EF7), LIMB_PAIR(0x8D59580F, 0x88AD8C38), LIMB_PAIR(0xE79F2CA8, 0x58F29ABF)
+        },
+        {   // 3 * 16^32 * B
+            LIMB_PAIR(0x710ECDF6, 0x4B5A64BF), LIMB_PAIR(0x462C293C, 0xB14CE538), LIMB_PAIR(0xD50B3AB9, 0x3643D056), LIMB_PAIR(0x185B4870, 0x6AF93724),
+            LIMB_PAIR(0x8DE73E68, 0xE90ECFAB), LIMB_PAIR(0x377E76A5, 0x54036F9F), LIMB_PAIR(0xBE015982, 0xF0495B0B), LIMB_PAIR(0xA7F41E36, 0x577629C4),
+            LIMB_PAIR(0x09C6A888, 0x32200245), LIMB_PAIR(0x4B558973, 0xD2E03613), LIMB_PAIR(0x3C33289F, 0x83E23623), LIMB_PAIR(0x0CAEC18F, 0x701F25BB)
+        },
+        {   // 4 * 16^32 * B
+            LIMB_PAIR(0x7CBEC113, 0x9D18F6D9), LIMB_PAIR(0x74BFDBE4, 0x844A06E6), LIMB_PAIR(0xAC4E60D6, 0x20F5B522), LIMB_PAIR(0x50955E51, 0x720A5BC0),
+            LIMB_PAIR(0xE4616CED, 0xC3A8B0F8), LIMB_PAIR(0x9E25A87D, 0xF700660E), LIMB_PAIR(0xF4BCA59C, 0x61E3061F), LIMB_PAIR(0xBDC40BE9, 0x2E0C92BF),
+            LIMB_PAIR(0x9B805A35, 0x0C3F0943), LIMB_PAIR(0x6242ABFC, 0xE84E8B37), LIMB_PAIR(0x5C229346, 0x691417F3), LIMB_PAIR(0x144EF0EC, 0x0E9B9CBB)
+        },
+        {   // 5 * 16^32 * B
+            LIMB_PAIR(0x5DB1BEEE, 0x8DEE9BD5), LIMB_PAIR(0x0A723FB9, 0xC9C3AB37), LIMB_PAIR(0x1C68D791, 0x44A8F1BF), LIMB_PAIR(0x1CFD3CDE, 0x366D4419),
+            LIMB_PAIR(0xFB5720AD, 0xFBBAD48F), LIMB_PAIR(0xDBF90D0E, 0xEE81916B), LIMB_PAIR(0x635543BF, 0xD4813152), LIMB_PAIR(0x3F337BD8, 0x221104EB),
+            LIMB_PAIR(0xF2BC8C14, 0x9E3C1743), LIMB_PAIR(0xB5856C3B, 0x2EDA26FC), LIMB_PAIR(0x68A7FB97, 0xCCB82F0E), LIMB_PAIR(0xBC593244, 0x4167A4E6)
+        },
+        {   // 6 * 16^32 * B
+            LIMB_PAIR(0xF8CE8FEE, 0xC2BE2665), LIMB_PAIR(0xE880D62C, 0xE967FF14), LIMB_PAIR(0x2F364EEE, 0xF12E6E7E), LIMB_PAIR(0xCB7ED2F6, 0x34B33370),
+            LIMB_PAIR(0x76F62700, 0x643B9D28), LIMB_PAIR(0x0E7668EB, 0x5D1D9D40), LIMB_PAIR(0x21FC0684, 0x1B4B4303), LIMB_PAIR(0x2255246A, 0x7938BB7E),
+            LIMB_PAIR(0x8681D6CC, 0xCDC591EE), LIMB_PAIR(0xED85A753, 0xCE02109C), LIMB_PAIR(0x58808883, 0xED7485C1), LIMB_PAIR(0x2DFE65E4, 0x1176FC6E)
+        },
+        {   // 7 * 16^32 * B
+            LIMB_PAIR(0x49770EB8, 0xDB90E289), LIMB_PAIR(0xACF440A3, 0x98FBCC2A), LIMB_PAIR(0xDED7879B, 0x21354FFE), LIMB_PAIR(0xF26906B6, 0x1F6A3E54),
+            LIMB_PAIR(0x5B9C619B, 0xB4AF6CD0), LIMB_PAIR(0xB2A58480, 0x2DDFC9F4), LIMB_PAIR(0xEBE94DC4, 0x3D4FA502), LIMB_PAIR(0x677D5F34, 0x08FC3A4C),
+            LIMB_PAIR(0xD30734EA, 0x60A4C199), LIMB_PAIR(0x31165CD6, 0x40C085B6), LIMB_PAIR(0xF7598295, 0xE2333E23), LIMB_PAIR(0x16B900D1, 0x4F2FAD01)
+        },
+        {   // 8 * 16^32 * B
+            LIMB_PAIR(0xB73BB638, 0x962CD91D), LIMB_PAIR(0xFC129C08, 0xE60577AA), LIMB_PAIR(0xF3B61689, 0x6F619B39), LIMB_PAIR(0x2944EE81, 0x3451995F),
+            LIMB_PAIR(0x94AE4E54, 0x44BEB241), LIMB_PAIR(0x1857EF6C, 0x5F541C51), LIMB_PAIR(0x368D0498, 0xA61E6B2D), LIMB_PAIR(0x972EF7AB, 0x445484A4),
+            LIMB_PAIR(0x9FEA7D7C, 0x9152FCD0), LIMB_PAIR(0xB0935CF6, 0x4A816C94), LIMB_PAIR(0x47285C40, 0x258E9AAA), LIMB_PAIR(0x042893B7, 0x10B89CA6)
+        }
+    },
+#endif
+#if (33 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^33 * B
+            LIMB_PAIR(0x79D34AA0, 0xD67CDED6), LIMB_PAIR(0xCC4DB39F, 0xCC0B9EC0), LIMB_PAIR(0xE35D190F, 0xA535A456), LIMB_PAIR(0xF61F6FEF, 0x2E05D9EA),
+            LIMB_PAIR(0x3B646025, 0x9B2A426E), LIMB_PAIR(0x385CE4CF, 0x32127190), LIMB_PAIR(0xDD6DEA45, 0xA25CFFC2), LIMB_PAIR(0xBEA8DE75, 0x06409010),
+            LIMB_PAIR(0xD61BEB59, 0xC447901A), LIMB_PAIR(0xE5DC880A, 0x661F19BC), LIMB_PAIR(0xB7CA6827, 0x24685482), LIMB_PAIR(0xEFE07F26, 0x293C778C)
+        },
+        {   // 2 * 16^33 * B
+            LIMB_PAIR(0xA11FF200, 0x16C795D6), LIMB_PAIR(0xB15815C9, 0xCB70D0E2), LIMB_PAIR(0x9B5395B5, 0x89F29320), LIMB_PAIR(0x31E47B4F, 0x50B8C2D0),
+            LIMB_PAIR(0x07069096, 0x86809E70), LIMB_PAIR(0xE4E50189, 0xAAD75B15), LIMB_PAIR(0xA21A0147, 0x07F35715), LIMB_PAIR(0x12815D5E, 0x0487F3F1),
+            LIMB_PAIR(0x068A4962, 0x48350C08), LIMB_PAIR(0x51092C9A, 0x6FFDD053), LIMB_PAIR(0xAF6FC8DD, 0x17AF4F4A), LIMB_PAIR(0x3CDBA58B, 0x4B0553B5)
+        },
+        {   // 3 * 16^33 * B
+            LIMB_PAIR(0x27C152D4, 0xBF05211B), LIMB_PAIR(0xBD1AF639, 0x5EC26849), LIMB_PAIR(0x8E6FAB98, 0x5E0B2CAA), LIMB_PAIR(0x50BD0840, 0x054C8BDD),
+            LIMB_PAIR(0x1B32FF79, 0x9C65FCBE), LIMB_PAIR(0x03B50F9B, 0xEB75EA9F), LIMB_PAIR(0x6C07E606, 0xFCED2A6C), LIMB_PAIR(0x51717908, 0x35106CD5),
+            LIMB_PAIR(0x1DCF073D, 0x38A0B12F), LIMB_PAIR(0xB7F6A276, 0x4B60A8A3), LIMB_PAIR(0xD3404F9A, 0xFED5AC25), LIMB_PAIR(0x5505C229, 0x72E82D5E)
+        },
+        {   // 4 * 16^33 * B
+            LIMB_PAIR(0x69771D02, 0x00D9CDFD), LIMB_PAIR(0x6CFBF17E, 0x410276CD), LIMB_PAIR(0x1CB12EC7, 0x4C45306C), LIMB_PAIR(0x27500861, 0x2857BF16),
+            LIMB_PAIR(0xF0D844C8, 0x6B0B697F), LIMB_PAIR(0xD979CB49, 0xBB12F85C), LIMB_PAIR(0xC1DA0F1F, 0xD2A541C6), LIMB_PAIR(0x58CE7211, 0x7B7C2429),
+            LIMB_PAIR(0x0101689E, 0x9F21903F), LIMB_PAIR(0xBF861005, 0xD779DFD3), LIMB_PAIR(0x3DEB0F1B, 0xA122EE5F), LIMB_PAIR(0x485A00D4, 0x510DF84B)
+        },
+        {   // 5 * 16^33 * B
+            LIMB_PAIR(0xC70AC15E, 0x24B3C887), LIMB_PAIR(0xFB81B732, 0xB0F3A557), LIMB_PAIR(0xE578CC1B, 0x9B2CDE2F), LIMB_PAIR(0x03B54F8E, 0x4CF7ED07),
+            LIMB_PAIR(0x9277A1FA, 0xA54133BB), LIMB_PAIR(0x63991237, 0x74EC3B62), LIMB_PAIR(0x35D2F15A, 0x1A3C54DC), LIMB_PAIR(0xE482BA3A, 0x2D347144),
+            LIMB_PAIR(0x98FBEE0F, 0x6BD47C65), LIMB_PAIR(0xAB55BE2D, 0x9E4733E2), LIMB_PAIR(0x127610C5, 0x1093F624), LIMB_PAIR(0xD0A1EAA4, 0x4E05E26A)
+        },
+        {   // 6 * 16^33 * B
+            LIMB_PAIR(0xE18FE6C0, 0x1833C773), LIMB_PAIR(0xD3C87265, 0xE3C4711A), LIMB_PAIR(0x0116B283, 0x3BFD3C4F), LIMB_PAIR(0xB4CD4DB8, 0x1955875E),
+            LIMB_PAIR(0x4B531F20, 0xDA9B6B62), LIMB_PAIR(0x77509ABB, 0x429A760E), LIMB_PAIR(0xE823CB80, 0xDBE9F522), LIMB_PAIR(0x880C8F82, 0x618F1856),
+            LIMB_PAIR(0x0E399799, 0x6DA6DE8F), LIMB_PAIR(0x40FDA178, 0x7AD61AA4), LIMB_PAIR(0x5E3563DD, 0xB32CD810), LIMB_PAIR(0x2AE340AE, 0x15F6BEAE)
+        },
+        {   // 7 * 16^33 * B
+            LIMB_PAIR(0x9245E215, 0xBA9A0F7B), LIMB_PAIR(0xD98C0DBB, 0xF368612D), LIMB_PAIR(0xF220B020, 0x2E84E4CB), LIMB_PAIR(0x62D90EDA, 0x6BA92FE9),
+            LIMB_PAIR(0x31EC3A62, 0x862BCB0C), LIMB_PAIR(0x1138F3C2, 0x810E2B45), LIMB_PAIR(0x39DAC2A4, 0x788EC4B8), LIMB_PAIR(0xAE2A9281, 0x28F76867),
+            LIMB_PAIR(0x5884E2AA, 0x3E4DF965), LIMB_PAIR(0xDBD465A5, 0xBD62FBDB), LIMB_PAIR(0x0DE9E524, 0xD7596CAA), LIMB_PAIR(0xB2B1B3D7, 0x6E8042CC)
+        },
+        {   // 8 * 16^33 * B
+            LIMB_PAIR(0x16521F7E, 0x15306536), LIMB_PAIR(0x96203DBA, 0x660D06B8), LIMB_PAIR(0x545F0879, 0x2D3989BC), LIMB_PAIR(0x78EBD7B0, 0x4B5303AF),
+            LIMB_PAIR(0xCE28CA6E, 0xF10D3C29), LIMB_PAIR(0xFCB6093D, 0xBAD34540), LIMB_PAIR(0xA2EA2D3F, 0xE7426ED7), LIMB_PAIR(0x4FF298B9, 0x08AF9D4E),
+            LIMB_PAIR(0xBEBCBDE8, 0x72F8A6C3), LIMB_PAIR(0xDC3A8E89, 0x4F0FCA4A), LIMB_PAIR(0xC7BFDF7A, 0x6FA9D4E8), LIMB_PAIR(0x9B624EB7, 0x0DCF2D67)
+        }
+    },
+#endif
+#if (34 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^34 * B
+            LIMB_PAIR(0x5A45F06E, 0x753941BE), LIMB_PAIR(0x6D9C5F65, 0xD07CAEED), LIMB_PAIR(0x72FF51B6, 0x11776B9C), LIMB_PAIR(0xEF0D4DA9, 0x17D2D1D9),
+            LIMB_PAIR(0x9718289C, 0x3D594749), LIMB_PAIR(0x24533F26, 0x12EBF8C5), LIMB_PAIR(0x14C3EF15, 0x0262BFCB), LIMB_PAIR(0x77B7518E, 0x20B878D5),
+            LIMB_PAIR(0x073F3E6A, 0x27F2AF18), LIMB_PAIR(0xD7521069, 0xFD3FE519), LIMB_PAIR(0x3CA60022, 0x22E3B72C), LIMB_PAIR(0xCC65C6A7, 0x72214F63)
+        },
+        {   // 2 * 16^34 * B
+            LIMB_PAIR(0xF43B29C9, 0x1D9DB7B9), LIMB_PAIR(0x4F518F75, 0xD605824A), LIMB_PAIR(0x312F9DC4, 0xF2C072BD), LIMB_PAIR(0x5A1545B0, 0x1F24AC85),
+            LIMB_PAIR(0x5307A693, 0xB4E37F40), LIMB_PAIR(0x2F336795, 0xABA714D7), LIMB_PAIR(0x73761099, 0xD6FBD0A7), LIMB_PAIR(0x8171CBC9, 0x5FDF48C5),
+            LIMB_PAIR(0x8E9505AA, 0x24D60832), LIMB_PAIR(0x0C1420EE, 0x4748C1D1), LIMB_PAIR(0x06FB25A2, 0xC7FFE45C), LIMB_PAIR(0x2AE395E6, 0x00BA739E)
+        },
+        {   // 3 * 16^34 * B
+            LIMB_PAIR(0xEA88BB26, 0xAE4426F5), LIMB_PAIR(0x84973BFB, 0x360679D9), LIMB_PAIR(0x26694E50, 0x5C9F030C), LIMB_PAIR(0xD518D226, 0x72297DE7),
+            LIMB_PAIR(0x5C8790D6, 0x592E98DE), LIMB_PAIR(0x45C2A2DF, 0xE5BFB7D3), LIMB_PAIR(0xF9B49922, 0x115A3B60), LIMB_PAIR(0x67AD78F3, 0x03283A3E),
+            LIMB_PAIR(0xBE0CB939, 0x48241DC7), LIMB_PAIR(0x8B633080, 0x32F19B4D), LIMB_PAIR(0x02289308, 0xD3DFC90D), LIMB_PAIR(0x46271945, 0x05E12968)
+        },
+        {   // 4 * 16^34 * B
+            LIMB_PAIR(0x242C4550, 0xADBFBBC8), LIMB_PAIR(0xD03081D9, 0xBCC80CEC), LIMB_PAIR(0xF5C8DF92, 0x843566A6), LIMB_PAIR(0x8258CE4C, 0x78CF25D3),
+            LIMB_PAIR(0x2D9C495A, 0xBA82EEB3), LIMB_PAIR(0xF12BB97C, 0xCEEFC8FC), LIMB_PAIR(0x93B5D1E0, 0xB02DABAE), LIMB_PAIR(0x13698D9B, 0x39C00C9C),
+            LIMB_PAIR(0x31489D68, 0x15AE6B8E), LIMB_PAIR(0x9C2BF087, 0xAA851CAB), LIMB_PAIR(0xF04EFA05, 0xC9A75A97), LIMB_PAIR(0x6B3FF832, 0x006B5207)
+        },
+        {   // 5 * 16^34 * B
+            LIMB_PAIR(0xB9CE082D, 0xF5CB7E16), LIMB_PAIR(0x417ABC29, 0x3407F14C), LIMB_PAIR(0x2BF4A7AB, 0xD4B36BCE), LIMB_PAIR(0x1A9F75CE, 0x7DE2E956),
+            LIMB_PAIR(0x9D95781C, 0x29E0CFE1), LIMB_PAIR(0x966310E2, 0xB681DF18), LIMB_PAIR(0x70516B39, 0x57DF39D3), LIMB_PAIR(0x3BC76122, 0x4D57E344),
+            LIMB_PAIR(0xB6A55ECB, 0xDE70D4F4), LIMB_PAIR(0x5D85DB99, 0x4801527F), LIMB_PAIR(0xD3EE9A81, 0xDBC9C440), LIMB_PAIR(0x1A6029ED, 0x6B2A90AF)
+        },
+        {   // 6 * 16^34 * B
+            LIMB_PAIR(0x5BB2D80A, 0x77EBF324), LIMB_PAIR(0x2FB9079B, 0xD8301B47), LIMB_PAIR(0x4CEE7333, 0xC647E6F2), LIMB_PAIR(0x276C2109, 0x465812C8),
+            LIMB_PAIR(0x9AE61E97, 0x6923F4FC), LIMB_PAIR(0xE03F5FD1, 0x5735281D), LIMB_PAIR(0xE6EDD12D, 0xA764AE43), LIMB_PAIR(0xD12D3E4A, 0x5FD8F4E9),
+            LIMB_PAIR(0x2A1062D9, 0x4D43BEB2), LIMB_PAIR(0x3831DC16, 0x7065FB75), LIMB_PAIR(0xDE2968D7, 0x180D4A7B), LIMB_PAIR(0x1CB16790, 0x05B32C2B)
+        },
+        {   // 7 * 16^34 * B
+            LIMB_PAIR(0x7AD58195, 0xF7FCA42C), LIMB_PAIR(0x4333F3CC, 0x3214286E), LIMB_PAIR(0x340B979D, 0xB6C29D0D), LIMB_PAIR(0x567307E1, 0x31771A48),
+            LIMB_PAIR(0xD24DA8FD, 0xC8C05ECC), LIMB_PAIR(0x05DFEF83, 0xA1CF1AAC), LIMB_PAIR(0x7DF9CD61, 0xDBBEEFF2), LIMB_PAIR(0x7B471E99, 0x3B5556A3),
+            LIMB_PAIR(0xE14DD482, 0x32B0C524), LIMB_PAIR(0x1A2BA4B6, 0xEDB35154), LIMB_PAIR(0x282B5AF3, 0xA3D16048), LIMB_PAIR(0x7A7336EB, 0x4FC079D2)
+        },
+        {   // 8 * 16^34 * B
+            LIMB_PAIR(0x0C86C50D, 0xDC348B44), LIMB_PAIR(0xCC94E651, 0x1337CBC9), LIMB_PAIR(0x643E3CB9, 0x6422F74D), LIMB_PAIR(0xBAE3CD08, 0x241170C2),
+            LIMB_PAIR(0x89BF2F7F, 0x51C938B0), LIMB_PAIR(0x02DFE9A7, 0x2497BD65), LIMB_PAIR(0x7880E453, 0xFFFFC09C), LIMB_PAIR(0xCAF98E92, 0x124567CE),
+            LIMB_PAIR(0x0AC473B4, 0x3FF9AB86), LIMB_PAIR(0x0113E435, 0xF0911DEE), LIMB_PAIR(0xEBC6C4AF, 0x4AE75060), LIMB_PAIR(0x6C87000D, 0x3F861296)
+        }
+    },
+#endif
+#if (35 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^35 * B
+            LIMB_PAIR(0x638C7BF3, 0x529FDFFE), LIMB_PAIR(0x388B4995, 0xDF2B9E60), LIMB_PAIR(0x1BAD0249, 0xE027B34F), LIMB_PAIR(0xB9FA74ED, 0x7BC92FC9),
+            LIMB_PAIR(0xF7957BE4, 0x0C9C5303), LIMB_PAIR(0xE085C145, 0xA3C31A20), LIMB_PAIR(0xD0850050, 0xB0721D71), LIMB_PAIR(0xAB0BF2DA, 0x0ABA390E),
+            LIMB_PAIR(0x801AD9F9, 0x9F97EF2E), LIMB_PAIR(0x79AFDA3A, 0x83697D54), LIMB_PAIR(0xBD596B50, 0xE906B3FF), LIMB_PAIR(0xDD3FB8E0, 0x02672B37)
+        },
+        {   // 2 * 16^35 * B
+            LIMB_PAIR(0x398CA7F5, 0xEE9BA729), LIMB_PAIR(0x7A4849DB, 0xEB9CA625), LIMB_PAIR(0x7EC544E1, 0x29EB29CE), LIMB_PAIR(0xF736E2C8, 0x232CA21E),
+            LIMB_PAIR(0x260885E4, 0x48B2CA8B), LIMB_PAIR(0x82B34C1C, 0xA4286BEC), LIMB_PAIR(0x17F58F74, 0x937E1A26), LIMB_PAIR(0xAB2CA2A5, 0x741D1FCB),
+            LIMB_PAIR(0x253FCB17, 0xBF61423D), LIMB_PAIR(0xFA39EB14, 0x08803CEA), LIMB_PAIR(0x9851C7AF, 0xF18602DF), LIMB_PAIR(0x49E3414B, 0x0400F3A0)
+        },
+        {   // 3 * 16^35 * B
+            LIMB_PAIR(0xA06E7B06, 0x2EFBA412), LIMB_PAIR(0x2C8D2560, 0x14678545), LIMB_PAIR(0xD67A91C7, 0xDF9713EB), LIMB_PAIR(0x157EADF3, 0x32830AC7),
+            LIMB_PAIR(0xBA61C55B, 0xABCE0476), LIMB_PAIR(0xC4D39716, 0x36A3D6D7), LIMB_PAIR(0xE8D82D09, 0x6EB259D5), LIMB_PAIR(0x84D756FB, 0x0C9176E9),
+            LIMB_PAIR(0xB73769E8, 0x0E782A7A), LIMB_PAIR(0x75B18E2C, 0x04A05D78), LIMB_PAIR(0xEBCCEAE1, 0x29525226), LIMB_PAIR(0x83EBA820, 0x0D794F83)
+        },
+        {   // 4 * 16^35 * B
+            LIMB_PAIR(0xA7A2E1AC, 0x7BE44CE7), LIMB_PAIR(0xFAD1B8B7, 0x411FD93E), LIMB_PAIR(0x0D5F7C9B, 0x1734A1D7), LIMB_PAIR(0x3127DB16, 0x0D659223),
+            LIMB_PAIR(0x9E1516F4, 0xFF35F5CB), LIMB_PAIR(0x648AAE45, 0xEE805BCF), LIMB_PAIR(0xB93A9EF3, 0xF0D73C2B), LIMB_PAIR(0x2092A6C2, 0x097B0BF2),
+            LIMB_PAIR(0x21A9D733, 0xC48BAB15), LIMB_PAIR(0xD61ABB25, 0xA6C2EAEA), LIMB_PAIR(0xC6CB4305, 0x625C6C1C), LIMB_PAIR(0x93EB3A67, 0x7FC90FEA)
+        },
+        {   // 5 * 16^35 * B
+            LIMB_PAIR(0x9C7CB23D, 0xC527DEB5), LIMB_PAIR(0x5328404E, 0x95539169), LIMB_PAIR(0x7CCF2C7A, 0xD6439281), LIMB_PAIR(0xF7D8FA11, 0x6CE97DAB),
+            LIMB_PAIR(0x1F5C5926, 0x0408F1FE), LIMB_PAIR(0x3B258BF4, 0x1A8F2F5E), LIMB_PAIR(0xFDC71669, 0x40A951A2), LIMB_PAIR(0xC98B577E, 0x6598EE93),
+            LIMB_PAIR(0x0EF7C48F, 0x25B5A8E5), LIMB_PAIR(0x6F2CE532, 0xEB603411), LIMB_PAIR(0xE53DE537, 0xC5E75173), LIMB_PAIR(0x8C12BB03, 0x73119FA0)
+        },
+        {   // 6 * 16^35 * B
+            LIMB_PAIR(0x21F4774D, 0x7845B94D), LIMB_PAIR(0x7897B727, 0xBF62F16C), LIMB_PAIR(0x3C56522B, 0x671857C0), LIMB_PAIR(0x95621212, 0x3CD6A852),
+            LIMB_PAIR(0x53F1A4CB, 0xED301294), LIMB_PAIR(0xC8F53787, 0xBCE621C9), LIMB_PAIR(0x38BEE7B9, 0xFACB2B13), LIMB_PAIR(0x9EA8428C, 0x3025798A),
+            LIMB_PAIR(0x3AECA999, 0x3FECDE92), LIMB_PAIR(0x62E8C12F, 0xBDAA5B00), LIMB_PAIR(0x96988ADE, 0x67B99DFC), LIMB_PAIR(0x52661036, 0x3F52C028)
+        },
+        {   // 7 * 16^35 * B
+            LIMB_PAIR(0xEEC416C6, 0x9258BF99), LIMB_PAIR(0xA9D2F671, 0xAC8A5017), LIMB_PAIR(0x16DEA4AB, 0x629549AB), LIMB_PAIR(0x99091569, 0x05D0E85C),
+            LIMB_PAIR(0x2A1351C6, 0xFFEAA48E), LIMB_PAIR(0xFA7F53D7, 0x28624754), LIMB_PAIR(0x7582DDF1, 0x0B5BA9E5), LIMB_PAIR(0xA696AC59, 0x60C0104B),
+            LIMB_PAIR(0xDE9CBE97, 0x051DE020), LIMB_PAIR(0xB50BCF74, 0xFA07FC56), LIMB_PAIR(0x0F11DF65, 0x378CEC9F), LIMB_PAIR(0xAB96DE4D, 0x36853C69)
+        },
+        {   // 8 * 16^35 * B
+            LIMB_PAIR(0xFAC5E7BE, 0x4433C0B0), LIMB_PAIR(0x4C08DCBE, 0x724BAE85), LIMB_PAIR(0x46978F9B, 0xF1F24CC4), LIMB_PAIR(0x62825FC8, 0x4A0AFF6D),
+            LIMB_PAIR(0x78F39B2D, 0x36D9B8DE), LIMB_PAIR(0xA847B9EC, 0x7F42ED71), LIMB_PAIR(0x79BD3FDE, 0x241CD1D6), LIMB_PAIR(0x92FBCE6B, 0x6A704FEC),
+            LIMB_PAIR(0x61095301, 0xE917FB9E), LIMB_PAIR(0x02A092F8, 0xC102DF94), LIMB_PAIR(0xFA66190B, 0xBF09E2F5), LIMB_PAIR(0xE0DCFE37, 0x681109BE)
+        }
+    },
+#endif
+#if (36 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^36 * B
+            LIMB_PAIR(0x36048D13, 0x9C18FCFA), LIMB_PAIR(0x73899DDD, 0x29159DB3), LIMB_PAIR(0x9F92D0AA, 0xDC9F350B), LIMB_PAIR(0x878A19D4, 0x26F57EEE),
+            LIMB_PAIR(0x782A0DDE, 0x559A0CC9), LIMB_PAIR(0xEA718385, 0x551DCDB2), LIMB_PAIR(0x31EF238C, 0x7F62865B), LIMB_PAIR(0x7973613D, 0x504AA776),
+            LIMB_PAIR(0x5687EFB1, 0x0CAB2CD5), LIMB_PAIR(0x247AF17B, 0x5180D162), LIMB_PAIR(0x4F5A2467, 0x85C15A34), LIMB_PAIR(0x9DBA3069, 0x4041943D)
+        },
+        {   // 2 * 16^36 * B
+            LIMB_PAIR(0xA26CAADD, 0x4B217743), LIMB_PAIR(0x648AB7CE, 0x47A6B424), LIMB_PAIR(0x03FBC9E3, 0xCB1D4F7A), LIMB_PAIR(0x9800D019, 0x12D93142),
+            LIMB_PAIR(0x43EBCC96, 0xC3C0EEBA), LIMB_PAIR(0x26EA9CAF, 0x8D749C9C), LIMB_PAIR(0x1C77CCC6, 0xD9FA95EE), LIMB_PAIR(0x7684340F, 0x1420A1D9),
+            LIMB_PAIR(0xD337594F, 0x00C67799), LIMB_PAIR(0xB23AA47B, 0x5E3C5140), LIMB_PAIR(0xE35FF395, 0x44182854), LIMB_PAIR(0x4359A012, 0x1B4F9231)
+        },
+        {   // 3 * 16^36 * B
+            LIMB_PAIR(0xA49866B1, 0x33CF3030), LIMB_PAIR(0x215F4859, 0x251F73D2), LIMB_PAIR(0x51DEF4F6, 0xAB82AA40), LIMB_PAIR(0x6F9A23F6, 0x5FF191D5),
+            LIMB_PAIR(0x89150951, 0x3E5C109D), LIMB_PAIR(0x2DE9696A, 0x39CEFA91), LIMB_PAIR(0x975F3020, 0x20EAE43F), LIMB_PAIR(0x7F132DAE, 0x239B572A),
+            LIMB_PAIR(0xAC2D9068, 0x819ED433), LIMB_PAIR(0x5FC98523, 0x2883AB79), LIMB_PAIR(0x5593EB3D, 0xEF457280), LIMB_PAIR(0x758F36CB, 0x020C526A)
+        },
+        {   // 4 * 16^36 * B
+            LIMB_PAIR(0xF042CC89, 0xE931EF59), LIMB_PAIR(0x8E124BB6, 0x2C589C9D), LIMB_PAIR(0xAEC75997, 0xADC8E18A), LIMB_PAIR(0x5602C50C, 0x452CFE0A),
+            LIMB_PAIR(0x9ED8DBBC, 0x779834F8), LIMB_PAIR(0xDC7CA46C, 0xC8F2AAF9), LIMB_PAIR(0xA3E1B074, 0xA9524CDC), LIMB_PAIR(0x15313877, 0x02AACC46),
+            LIMB_PAIR(0x647877DF, 0x86A0F7A0), LIMB_PAIR(0x0E607C9F, 0xBBC46427), LIMB_PAIR(0xF1FB11C9, 0xAB17EA25), LIMB_PAIR(0x304B877B, 0x4CFB7D7B)
+        },
+        {   // 5 * 16^36 * B
+            LIMB_PAIR(0x9789EF12, 0xE28699C2), LIMB_PAIR(0xDF57190D, 0x2B6ECD71), LIMB_PAIR(0xECC970D0, 0xC343C857), LIMB_PAIR(0x434D3AC5, 0x5B1D4CBC),
+            LIMB_PAIR(0xB89B75FE, 0x72B43D6C), LIMB_PAIR(0x9C6ADC80, 0x54C694D9), LIMB_PAIR(0x3EE34C9F, 0xB8C3AA37), LIMB_PAIR(0x39075364, 0x14B4622B),
+            LIMB_PAIR(0xCC0A9F26, 0xB6FB2615), LIMB_PAIR(0xB88DCCE5, 0x3A4F0E2B), LIMB_PAIR(0x3369A705, 0x1301498B), LIMB_PAIR(0x58592DD1, 0x2F98F712)
+        },
+        {   // 6 * 16^36 * B
+            LIMB_PAIR(0x4F54A701, 0x2E12AE44), LIMB_PAIR(0xA9CBD7DE, 0xFCFE3EF0), LIMB_PAIR(0x75835DE0, 0xCEBF890D), LIMB_PAIR(0xE7614554, 0x1D8062E9),
+            LIMB_PAIR(0xB50F9E56, 0x0C94A74C), LIMB_PAIR(0x8E8E1320, 0x5B1FF4A9), LIMB_PAIR(0x82300F67, 0x9A2ACC21), LIMB_PAIR(0xD806AAF9, 0x3A6AE249),
+            LIMB_PAIR(0xA9907C5A, 0x657ADA85), LIMB_PAIR(0x91B90F62, 0x1A0EA8B5), LIMB_PAIR(0xDF34B4E9, 0x8D0E1DFB), LIMB_PAIR(0xAEF25FF3, 0x298B8CE8)
+        },
+        {   // 7 * 16^36 * B
+            LIMB_PAIR(0x0A2165DE, 0x837A72EA), LIMB_PAIR(0x0BCF79F6, 0x3FAB07B4), LIMB_PAIR(0x7738AE70, 0x521636C7), LIMB_PAIR(0x03A7D7DC, 0x6BA62718),
+            LIMB_PAIR(0xEFF70CB2, 0x2A927953), LIMB_PAIR(0x79157076, 0x4B89C92A), LIMB_PAIR(0x30A7CF6A, 0x9418457A), LIMB_PAIR(0x4D5CE485, 0x34B8A840),
+            LIMB_PAIR(0x83693335, 0xC26EECB5), LIMB_PAIR(0x63B5FEFD, 0xD5A813DF), LIMB_PAIR(0xA4B22573, 0xA293AA9A), LIMB_PAIR(0x465E1C6A, 0x71D62BDD)
+        },
+        {   // 8 * 16^36 * B
+            LIMB_PAIR(0xB1F75EF5, 0xCD2DB5DA), LIMB_PAIR(0x16B065F5, 0xD77F95CF), LIMB_PAIR(0x3F49F085, 0x14571FEA), LIMB_PAIR(0x262B2B3D, 0x1C333621),
+            LIMB_PAIR(0xD378DF80, 0x6533CC28), LIMB_PAIR(0x0A0FA4B4, 0xF6DB4379), LIMB_PAIR(0xF701DA5A, 0xE3645FF9), LIMB_PAIR(0xF3172BA4, 0x74D5F317),
+            LIMB_PAIR(0x67D9CA81, 0xA86FE554), LIMB_PAIR(0x2B298C37, 0x398B7C75), LIMB_PAIR(0xE3AC623B, 0xDA6D0892), LIMB_PAIR(0x47E9D98C, 0x4AEBCC45)
+        }
+    },
+#endif
+#if (37 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^37 * B
+            LIMB_PAIR(0xA059A445, 0x0DE9B204), LIMB_PAIR(0x4B17AD0F, 0xE15CB4AA), LIMB_PAIR(0x1F79C557, 0xE1BBEC52), LIMB_PAIR(0xD071081B, 0x2633F1B9),
+            LIMB_PAIR(0x05D21A77, 0x53175A72), LIMB_PAIR(0xD3B934D4, 0xB0C04422), LIMB_PAIR(0xDD5DEADC, 0xADD9F24B), LIMB_PAIR(0x9F10FF8C, 0x074F46E6),
+            LIMB_PAIR(0x018B9910, 0xC1FB4177), LIMB_PAIR(0x6C0FE140, 0xA6EA20DC), LIMB_PAIR(0x4354C6FF, 0xD661F3E7), LIMB_PAIR(0xF1A3407A, 0x5ECB72E6)
+        },
+        {   // 2 * 16^37 * B
+            LIMB_PAIR(0xE8E86997, 0xFEEAE106), LIMB_PAIR(0x98D09383, 0x9863337F), LIMB_PAIR(0xAA06EBEF, 0x9470480E), LIMB_PAIR(0xD4C5C2D0, 0x038B6898),
+            LIMB_PAIR(0x2259FB4E, 0xA515A31B), LIMB_PAIR(0x2BCAC52F, 0x0960F397), LIMB_PAIR(0x8D3454CB, 0xEDB52FEC), LIMB_PAIR(0xC476C019, 0x382E2720),
+            LIMB_PAIR(0x8ACE50A6, 0xF391C51D), LIMB_PAIR(0xAE2D2948, 0x3142D0B9), LIMB_PAIR(0x7F24CA80, 0xDB4D5A1A), LIMB_PAIR(0x59250EA8, 0x21AEBA8B)
+        },
+        {   // 3 * 16^37 * B
+            LIMB_PAIR(0xF0087F23, 0x53853600), LIMB_PAIR(0xDA7D5784, 0x4C461879), LIMB_PAIR(0xB41F6860, 0x6AF303DE), LIMB_PAIR(0xC27C18ED, 0x0A3C16C5),
+            LIMB_PAIR(0xCF405530, 0x24F13B34), LIMB_PAIR(0x43088AF7, 0x3C44EA4A), LIMB_PAIR(0x0006A482, 0x5DD5C517), LIMB_PAIR(0x890B086D, 0x118EB8F8),
+            LIMB_PAIR(0xCC947F3D, 0x17E49C17), LIMB_PAIR(0xAAC1D27B, 0xCCC6EDA6), LIMB_PAIR(0xB0F08E56, 0xDF6092CE), LIMB_PAIR(0x2C67C36B, 0x4909B3E2)
+        },
+        {   // 4 * 16^37 * B
+            LIMB_PAIR(0x706FF64E, 0x59A16676), LIMB_PAIR(0x0D86A53D, 0x10B953DD), LIMB_PAIR(0xCE5C0B96, 0x5848E1E6), LIMB_PAIR(0x12780C68, 0x2D8B78E7),
+            LIMB_PAIR(0x63FE2E89, 0x9C9C85EA), LIMB_PAIR(0x0E9412EC, 0xBE1BAF91), LIMB_PAIR(0x86FBFE7B, 0x8F7BAA8A), LIMB_PAIR(0xEF968B6C, 0x0FB17F9F),
+            LIMB_PAIR(0xAFC3902B, 0x79D5C62E), LIMB_PAIR(0x89E80728, 0x773A2152), LIMB_PAIR(0xE10120B9, 0xC38AE640), LIMB_PAIR(0x7B2B1A6D, 0x09AE2371)
+        },
+        {   // 5 * 16^37 * B
+            LIMB_PAIR(0xAD32B1D0, 0x10AB8FA1), LIMB_PAIR(0xE2778B24, 0xE9ACED1B), LIMB_PAIR(0x373DE90F, 0xA8856BC0), LIMB_PAIR(0xDDA53996, 0x66F35DDD),
+            LIMB_PAIR(0x4E4D083C, 0xBB6A192A), LIMB_PAIR(0x0029E192, 0x34ACE063), LIMB_PAIR(0xAAFABAEB, 0x98245A59), LIMB_PAIR(0xDA97FAAC, 0x6D9C8A9A),
+            LIMB_PAIR(0x24997323, 0xD27D9AFB), LIMB_PAIR(0xF6F01D2E, 0x1BB7E07E), LIMB_PAIR(0xF52ECC7F, 0x2BA7472D), LIMB_PAIR(0x646F9DC8, 0x03019B4F)
+        },
+        {   // 6 * 16^37 * B
+            LIMB_PAIR(0xE6B3DC6B, 0xAF09B214), LIMB_PAIR(0xAD7D2F65, 0x3F7573B5), LIMB_PAIR(0x100A23B0, 0xD019D988), LIMB_PAIR(0x8B5C35F7, 0x392B63A5),
+            LIMB_PAIR(0x565345CD, 0x04A186B5), LIMB_PAIR(0xBCC4116A, 0xEEE76610), LIMB_PAIR(0x78FB2A45, 0x689C73B4), LIMB_PAIR(0x65697512, 0x387DCBFF),
+            LIMB_PAIR(0x9C07C205, 0x4093ADDC), LIMB_PAIR(0xF532C37E, 0xC565BE15), LIMB_PAIR(0x1583402A, 0x63DBECFD), LIMB_PAIR(0xEF2E032E, 0x61722B4A)
+        },
+        {   // 7 * 16^37 * B
+            LIMB_PAIR(0x81CB0E3C, 0xD6B07A55), LIMB_PAIR(0xD9444969, 0x290FF006), LIMB_PAIR(0x16DCDA1F, 0x08680B6A), LIMB_PAIR(0x5A06DE59, 0x5568D2B7),
+            LIMB_PAIR(0xECBD47AF, 0x0012AAFE), LIMB_PAIR(0x1CD46309, 0x55A266FB), LIMB_PAIR(0x0967C72C, 0xF203EB68), LIMB_PAIR(0xCA3C1429, 0x39633944),
+            LIMB_PAIR(0x1B37CFE1, 0x8D0CB88C), LIMB_PAIR(0x053818F3, 0x05B6A5A3), LIMB_PAIR(0xB787D959, 0xF2E9BC04), LIMB_PAIR(0x9ADD7F64, 0x6BEBA124)
+        },
+        {   // 8 * 16^37 * B
+            LIMB_PAIR(0x43F5A53B, 0x5C3CECB9), LIMB_PAIR(0x06C08DF2, 0x9CC9A61D), LIMB_PAIR(0x85895447, 0xCFBA639A), LIMB_PAIR(0x0DF09FD5, 0x5A845AE8),
+            LIMB_PAIR(0xA5B1B143, 0x1D06005C), LIMB_PAIR(0x7FD1CDA2, 0x6D4C6BB8), LIMB_PAIR(0x53FCFFE7, 0x6EF59676), LIMB_PAIR(0xC1CE1EA5, 0x097C29E8),
+            LIMB_PAIR(0x5DEB94CA, 0x4CE97DBE), LIMB_PAIR(0x8C709C48, 0x38D0A438), LIMB_PAIR(0xA169D097, 0xC43ECED4), LIMB_PAIR(0xF7E587C3, 0x0A1249FF)
+        }
+    },
+#endif
+#if (38 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^38 * B
+            LIMB_PAIR(0x7354B610, 0x0B408D9E), LIMB_PAIR(0x5BA85B6E, 0x806B3253), LIMB_PAIR(0x4A58A207, 0xDBE63A03), LIMB_PAIR(0xC9A1DF2C, 0x173BD9DD),
+            LIMB_PAIR(0x276D01C9, 0x12F0071B), LIMB_PAIR(0x86C48C70, 0xE7B8BAC5), LIMB_PAIR(0x71D6FBA9, 0x5308129B), LIMB_PAIR(0x5A3DB792, 0x5D88FBF9),
+            LIMB_PAIR(0xFE5872DF, 0x2B500F1E), LIMB_PAIR(0xD43918C1, 0x58D6582E), LIMB_PAIR(0xC9673AE0, 0xE6ED278E), LIMB_PAIR(0xB19EA319, 0x06E1CD13)
+        },
+        {   // 2 * 16^38 * B
+            LIMB_PAIR(0x9E5B0353, 0x472BAF62), LIMB_PAIR(0x278D0447, 0x3BAA0B90), LIMB_PAIR(0x9643BF27, 0x0C785F46), LIMB_PAIR(0x8D837B13, 0x7F3A6A1A),
+            LIMB_PAIR(0x6F166F23, 0x40D0AD51), LIMB_PAIR(0x1FAB6ABE, 0x118E3293), LIMB_PAIR(0xA04D088E, 0x3FE35E14), LIMB_PAIR(0x26E16266, 0x30806035),
+            LIMB_PAIR(0x5D3D800B, 0xF7E64439), LIMB_PAIR(0xC901EDF6, 0x95A8D555), LIMB_PAIR(0x592C6339, 0x68CD7830), LIMB_PAIR(0x2E51307E, 0x30D0FDED)
+        },
+        {   // 3 * 16^38 * B
+            LIMB_PAIR(0x68B84750, 0x9CB4971E), LIMB_PAIR(0x6664BBCF, 0xA0957229), LIMB_PAIR(0x72FA412B, 0x5C8DE726), LIMB_PAIR(0x51C589D9, 0x46150843),
+            LIMB_PAIR(0xF21233B3, 0xE0594D1A), LIMB_PAIR(0xF0CC4D9C, 0x1BDBE78E), LIMB_PAIR(0x8F499A77, 0x6965187F), LIMB_PAIR(0x2C099868, 0x0A921420),
+            LIMB_PAIR(0xAEB9A02E, 0xBC9019C0), LIMB_PAIR(0x16034CAE, 0x55C7110D), LIMB_PAIR(0x659932EC, 0x0E6DF501), LIMB_PAIR(0x95CA5DFE, 0x3BCA0D28)
+        },
+        {   // 4 * 16^38 * B
+            LIMB_PAIR(0x9ECC01BF, 0x9C688EB6), LIMB_PAIR(0xA644896F, 0xF0BC83AD), LIMB_PAIR(0x5F7A9FE2, 0xCA2D955F), LIMB_PAIR(0x8DF28241, 0x4EA8B403),
+            LIMB_PAIR(0x3C5D62A4, 0x40F031BC), LIMB_PAIR(0xCFF07A60, 0x19FC8B3E), LIMB_PAIR(0x130FB545, 0x98183DA2), LIMB_PAIR(0xAE8F13CD, 0x5631DEDD),
+            LIMB_PAIR(0xF1CAD202, 0x2AED460A), LIMB_PAIR(0xA48CEE83, 0x46305305), LIMB_PAIR(0x49F11A5F, 0x91217745), LIMB_PAIR(0x542CA463, 0x24CE0930)
+        },
+        {   // 5 * 16^38 * B
+            LIMB_PAIR(0xFDF30B85, 0x3FCFA155), LIMB_PAIR(0x36372EA4, 0xD2F7168E), LIMB_PAIR(0x6492F844, 0xB2E064DE), LIMB_PAIR(0x324F4280, 0x549928A7),
+            LIMB_PAIR(0xFD06C106, 0x1FE890F5), LIMB_PAIR(0x5D8810F2, 0xB5C46835), LIMB_PAIR(0x6E8CAF3E, 0x827808FE), LIMB_PAIR(0x8A06D74B, 0x41D4E3C2),
+            LIMB_PAIR(0x63EE1A2E, 0xF26E32A7), LIMB_PAIR(0xD25FFDEA, 0xAE91E4B7), LIMB_PAIR(0xD17F4D69, 0xBC3BD33B), LIMB_PAIR(0xC0DCFF6A, 0x491B66DE)
+        },
+        {   // 6 * 16^38 * B
+            LIMB_PAIR(0xD0DA64A1, 0x75F04A8E), LIMB_PAIR(0x67E2284B, 0xED222CAF), LIMB_PAIR(0x1F7B7BA4, 0x8234A379), LIMB_PAIR(0xB7018B67, 0x4CF6B8B0),
+            LIMB_PAIR(0xC7EA32A7, 0x98F5B13D), LIMB_PAIR(0x7E16DB98, 0xE3D5F8CC), LIMB_PAIR(0xCBF8D947, 0xAC0ABF52), LIMB_PAIR(0xC85EE4AC, 0x08F338D0),
+            LIMB_PAIR(0x991A73BD, 0xC383A821), LIMB_PAIR(0xDF320C7A, 0xAB27BC01), LIMB_PAIR(0x84777063, 0xC13D331B), LIMB_PAIR(0xEB078A99, 0x530D4A82)
+        },
+        {   // 7 * 16^38 * B
+            LIMB_PAIR(0x6C9ABF9E, 0x6D697345), LIMB_PAIR(0x4900A880, 0x257FB2FC), LIMB_PAIR(0xC8CFB850, 0x2BACF412), LIMB_PAIR(0x0CBFBD5B, 0x0DB3E7E0),
+            LIMB_PAIR(0xE1F94825, 0x004C3630), LIMB_PAIR(0x8CAB535A, 0x7E2D7826), LIMB_PAIR(0xCC84FF8B, 0xC7482323), LIMB_PAIR(0x101770B9, 0x65EA753F),
+            LIMB_PAIR(0xE2096363, 0x3D66FC3E), LIMB_PAIR(0x61B5CB6B, 0x81D62C7F), LIMB_PAIR(0x13443B1A, 0x0FBE0442), LIMB_PAIR(0x21E1A1DB, 0x02A4EC19)
+        },
+        {   // 8 * 16^38 * B
+            LIMB_PAIR(0xF1CF795F, 0xF5C86162), LIMB_PAIR(0x26EE57F2, 0x118C8619), LIMB_PAIR(0x1C063578, 0x17212485), LIMB_PAIR(0xEC067FCF, 0x36D12B5D),
+            LIMB_PAIR(0x3B24B8A2, 0x5CE6259A), LIMB_PAIR(0x45AFA0B8, 0xB8577ACC), LIMB_PAIR(0x8BA07037, 0xCCCBE6E8), LIMB_PAIR(0x127809BF, 0x3D143C51),
+            LIMB_PAIR(0x79154557, 0x126D2791), LIMB_PAIR(0xFC783A0A, 0xD5E48F5C), LIMB_PAIR(0xDF179BAC, 0x36BDB6E8), LIMB_PAIR(0x5BA82859, 0x2EF51788)
+        }
+    },
+#endif
+#if (39 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^39 * B
+            LIMB_PAIR(0x7C6DA1E9, 0x1EA43683), LIMB_PAIR(0x1FB9BDBE, 0xF9C189AF), LIMB_PAIR(0xCE5DD155, 0x303001FC), LIMB_PAIR(0xBC57BE52, 0x28A7C99E),
+            LIMB_PAIR(0xD11E0D4A, 0x88BD438C), LIMB_PAIR(0x43CCF308, 0x30CB610D), LIMB_PAIR(0x91937BCC, 0xE09A0E37), LIMB_PAIR(0x25B1720C, 0x4559135B),
+            LIMB_PAIR(0xE8D19E9D, 0xB8FD9399), LIMB_PAIR(0x962423FF, 0x908191CB), LIMB_PAIR(0x47C742A3, 0xB2B948D7), LIMB_PAIR(0xD7FB44C4, 0x37F33226)
+        },
+        {   // 2 * 16^39 * B
+            LIMB_PAIR(0xC821B11D, 0x33912553), LIMB_PAIR(0x41E301DF, 0x66ED42C2), LIMB_PAIR(0x104222FD, 0x066FCC11), LIMB_PAIR(0xC192168F, 0x307A3B41),
+            LIMB_PAIR(0xB55F6E08, 0x0DAE8767), LIMB_PAIR(0x5B203A02, 0x4A43B3B3), LIMB_PAIR(0x80AF8C79, 0xE3725A6E), LIMB_PAIR(0x705FA7A3, 0x0F7A7FD1),
+            LIMB_PAIR(0x6EB55CE0, 0x8EEB5D07), LIMB_PAIR(0xAA0D925A, 0x2FC536BF), LIMB_PAIR(0xDCB6C6E8, 0xBE81830F), LIMB_PAIR(0x827BAF52, 0x556C7045)
+        },
+        {   // 3 * 16^39 * B
+            LIMB_PAIR(0x2BF44406, 0xB94B9002), LIMB_PAIR(0xFF90B534, 0xABD4237E), LIMB_PAIR(0xFAF86D3A, 0x7600A960), LIMB_PAIR(0xC2322EE3, 0x2F45ABDA),
+            LIMB_PAIR(0x02E9D8B7, 0x8E2B5173), LIMB_PAIR(0x248714E8, 0xE3E52269), LIMB_PAIR(0x4CA960B5, 0xBD4FBD77), LIMB_PAIR(0xC5ECADA9, 0x6F4B4199),
+            LIMB_PAIR(0xC8EF8A6A, 0x61AF4912), LIMB_PAIR(0x43FB6E5E, 0xE58FA4FE), LIMB_PAIR(0x6FD427CF, 0xB5AFCC5D), LIMB_PAIR(0x1E1E11EB, 0x6A539328)
+        },
+        {   // 4 * 16^39 * B
+            LIMB_PAIR(0x149443CF, 0x0FFF04FE), LIMB_PAIR(0x865CDDD7, 0x53CAC6D9), LIMB_PAIR(0x531ED1B7, 0x31385B03), LIMB_PAIR(0xACD1039D, 0x5846A27C),
+            LIMB_PAIR(0xA5D1EE89, 0xF3DA5139), LIMB_PAIR(0xFF936988, 0x8145457C), LIMB_PAIR(0x00E188C4, 0x3F622FED), LIMB_PAIR(0xDB8B5A3D, 0x0F513815),
+            LIMB_PAIR(0x1EB08717, 0x4FF5CDAC), LIMB_PAIR(0x90F2E9BC, 0x67E8B295), LIMB_PAIR(0x237AFA99, 0x44093B5E), LIMB_PAIR(0x8708B8B2, 0x0D414BED)
+        },
+        {   // 5 * 16^39 * B
+            LIMB_PAIR(0x294AC9E8, 0x81886A92), LIMB_PAIR(0xD55547BE, 0x23162B45), LIMB_PAIR(0x03715983, 0x94CFBC44), LIMB_PAIR(0x134BC401, 0x50EB8FDB),
+            LIMB_PAIR(0xFD0E75F6, 0xCFB68265), LIMB_PAIR(0xBB90E707, 0xE45B3E28), LIMB_PAIR(0x9FF92C7A, 0x7242A8DE), LIMB_PAIR(0x933202DD, 0x685B3201),
+            LIMB_PAIR(0xD6B330CD, 0xC0B73EC6), LIMB_PAIR(0x132FAFF1, 0x84E44807), LIMB_PAIR(0xC4A5DEE1, 0x732B7352), LIMB_PAIR(0xAA7CD2D2, 0x5D7C7CF1)
+        },
+        {   // 6 * 16^39 * B
+            LIMB_PAIR(0x9B73A562, 0x33D1013E), LIMB_PAIR(0x48EC26E1, 0x925CEF57), LIMB_PAIR(0xDD468058, 0xA7FCE614), LIMB_PAIR(0x1E9AA438, 0x78B0FAD4),
+            LIMB_PAIR(0x7A4AAFA2, 0xAF3B46BF), LIMB_PAIR(0x4D40D411, 0xB78705EC), LIMB_PAIR(0xCA7C15E3, 0x114F0C6A), LIMB_PAIR(0xA9489D4D, 0x3F364FAA),
+            LIMB_PAIR(0xED05B488, 0xBF56A431), LIMB_PAIR(0x9C495C7E, 0xA533E66C), LIMB_PAIR(0x87F3651A, 0xE8652BAF), LIMB_PAIR(0x59D66C33, 0x02418000)
+        },
+        {   // 7 * 16^39 * B
+            LIMB_PAIR(0xCF38EA01, 0x28350C7D), LIMB_PAIR(0xB2917AB6, 0x7C6CDBC0), LIMB_PAIR(0x857082F7, 0xACE7CFBE), LIMB_PAIR(0xA2D9A1E0, 0x4D2845AB),
+            LIMB_PAIR(0xA37A5BE4, 0xCEB077FE), LIMB_PAIR(0xE5A5EEB7, 0xDB642F02), LIMB_PAIR(0x471270B8, 0xC2E6D0C5), LIMB_PAIR(0x38E4529C, 0x4771B655),
+            LIMB_PAIR(0x447070DE, 0xBB537FE0), LIMB_PAIR(0x6DD557DF, 0xCBA74443), LIMB_PAIR(0x3600DBCB, 0xD3B5A347), LIMB_PAIR(0xF9FFD7F8, 0x4AEABBE6)
+        },
+        {   // 8 * 16^39 * B
+            LIMB_PAIR(0xC4A9C8F2, 0x6A2134BC), LIMB_PAIR(0x8ACE2E37, 0xFBF8FD1C), LIMB_PAIR(0x9911A0BA, 0x000AE304), LIMB_PAIR(0x6BC89B9E, 0x046E3A61),
+            LIMB_PAIR(0x40D8F78C, 0x4630119E), LIMB_PAIR(0x3C710E11, 0xA01A9BC5), LIMB_PAIR(0x8910DD79, 0x486D2B25), LIMB_PAIR(0xDB0324E5, 0x1E6C47B3),
+            LIMB_PAIR(0xF03906BE, 0x14E65442), LIMB_PAIR(0xE362BE2A, 0x4A019D54), LIMB_PAIR(0x8DC230C7, 0x68CCDFEC), LIMB_PAIR(0xAF6B861C, 0x7CFB7E3F)
+        }
+    },
+#endif
+#if (40 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^40 * B
+            LIMB_PAIR(0x305B2F51, 0x96EEBFFB), LIMB_PAIR(0x889596B8, 0xD3F938AD), LIMB_PAIR(0x46D5DD25, 0xF0F52DC7), LIMB_PAIR(0xBB3A0095, 0x57968290),
+            LIMB_PAIR(0x8C58AEDC, 0x4637974E), LIMB_PAIR(0xABF041A4, 0xB9EF22FB), LIMB_PAIR(0xE980718A, 0xE185D956), LIMB_PAIR(0xB143A8A6, 0x2F1B78FA),
+            LIMB_PAIR(0x0A20E101, 0xF71AB843), LIMB_PAIR(0x24F0EC47, 0xF393658D), LIMB_PAIR(0x6EE2EED1, 0xCF7509A8), LIMB_PAIR(0xDC2AA3E1, 0x7DC43E35)
+        },
+        {   // 2 * 16^40 * B
+            LIMB_PAIR(0x273E9718, 0x5A782A5C), LIMB_PAIR(0x5E4EFD94, 0x3576C699), LIMB_PAIR(0x1F237D3E, 0x0F2ED805), LIMB_PAIR(0x82D50A99, 0x044FB81D),
+            LIMB_PAIR(0x887DD9C3, 0x85966665), LIMB_PAIR(0x4BB05355, 0xC90F9B31), LIMB_PAIR(0xEF2079B1, 0xC6E08DF8), LIMB_PAIR(0x758CC12F, 0x7EF72016),
+            LIMB_PAIR(0xA907E3D9, 0xC1DF18C5), LIMB_PAIR(0xCE4C6359, 0x57B3371D), LIMB_PAIR(0xB201BB49, 0xCA704534), LIMB_PAIR(0x9C30DD2E, 0x7F79823F)
+        },
+        {   // 3 * 16^40 * B
+            LIMB_PAIR(0x68F587BA, 0x6A9C1FF0), LIMB_PAIR(0x0050C8DE, 0x0827894E), LIMB_PAIR(0x7DED5BE7, 0x3CBF9955), LIMB_PAIR(0x1C06D6F0, 0x64A9B043),
+            LIMB_PAIR(0xA3B513E8, 0x8334D239), LIMB_PAIR(0xB91FA8D8, 0xC13670D4), LIMB_PAIR(0xF590BD33, 0x12B54136), LIMB_PAIR(0xD784D9B4, 0x0A4E0373),
+            LIMB_PAIR(0x5B7D2919, 0x2EB3D6A1), LIMB_PAIR(0xD53A8235, 0xB0B4F6A0), LIMB_PAIR(0x89A45D47, 0x7156CE43), LIMB_PAIR(0xCE18346C, 0x071A7D0A)
+        },
+        {   // 4 * 16^40 * B
+            LIMB_PAIR(0x20E14431, 0xCC0C3552), LIMB_PAIR(0x09B15141, 0x0D659507), LIMB_PAIR(0x209D5F36, 0x9AF5621B), LIMB_PAIR(0x617755D3, 0x7C69BCF7),
+            LIMB_PAIR(0xC887BA0B, 0xD3072DAA), LIMB_PAIR(0xBFA562EE, 0x01262905), LIMB_PAIR(0xC0EF768B, 0xCF543002), LIMB_PAIR(0x46EA7E9C, 0x2C3BCC71),
+            LIMB_PAIR(0x04E8295F, 0x07F0D7EB), LIMB_PAIR(0x2F50F37D, 0x10DB1825), LIMB_PAIR(0x171798D7, 0xE951A9A3), LIMB_PAIR(0x22ACA51D, 0x6F5A9A73)
+        },
+        {   // 5 * 16^40 * B
+            LIMB_PAIR(0xA3D944BE, 0xE729D4EB), LIMB_PAIR(0x8078AF9E, 0x8D9E0940), LIMB_PAIR(0x47869C03, 0x4525567A), LIMB_PAIR(0xEE8D3B24, 0x02AB9680),
+            LIMB_PAIR(0x2F41C6C5, 0x8BA1000C), LIMB_PAIR(0x0CFEFB9B, 0xC49F79C1), LIMB_PAIR(0x3CC51C9F, 0x4EFA4770), LIMB_PAIR(0xE147AFCA, 0x494E21A2),
+            LIMB_PAIR(0xDDE50D9A, 0xEFA48A85), LIMB_PAIR(0x0FB9A249, 0x219A224E), LIMB_PAIR(0xD91EF6D9, 0xFA091F1D), LIMB_PAIR(0xEA46BB34, 0x6B5D76CB)
+        },
+        {   // 6 * 16^40 * B
+            LIMB_PAIR(0x1E782522, 0xE0F94117), LIMB_PAIR(0x036936D3, 0xF1E6AE74), LIMB_PAIR(0xD0FCC746, 0x408B3EA2), LIMB_PAIR(0x03DD313E, 0x16FB869C),
+            LIMB_PAIR(0xEC0CD994, 0x8857556C), LIMB_PAIR(0x5CD01DBA, 0x6472DC6F), LIMB_PAIR(0x8F42B477, 0xAF016914), LIMB_PAIR(0x85277354, 0x0AE333F6),
+            LIMB_PAIR(0x33B60962, 0x288E1997), LIMB_PAIR(0xD8ABE133, 0x24FC72B4), LIMB_PAIR(0x0991D03E, 0x4811F7ED), LIMB_PAIR(0x8F70D075, 0x3F81E38B)
+        },
+        {   // 7 * 16^40 * B
+            LIMB_PAIR(0x5F17C824, 0x0ADB7F35), LIMB_PAIR(0xD74299A4, 0x74B923C3), LIMB_PAIR(0xCBF8EAF7, 0xD57C3E8B), LIMB_PAIR(0x4CDEDC3D, 0x0AD3E2D3),
+            LIMB_PAIR(0x7ED9AFFE, 0x7F910FCC), LIMB_PAIR(0x2465874B, 0x545CB8A1), LIMB_PAIR(0x4B0C4704, 0xA8397ED2), LIMB_PAIR(0x04F50993, 0x50510FC1),
+            LIMB_PAIR(0x336E249D, 0x6F0C0FC5), LIMB_PAIR(0xC331CFD9, 0x745EDE19), LIMB_PAIR(0x09EEFE1C, 0xF2D6FD00), LIMB_PAIR(0xF0FA1EBE, 0x127C158B)
+        },
+        {   // 8 * 16^40 * B
+            LIMB_PAIR(0xAE51B974, 0xDEA28FC4), LIMB_PAIR(0x744DFE96, 0x1D9973D3), LIMB_PAIR(0x873848A8, 0x6240680B), LIMB_PAIR(0xD167DF95, 0x4ED82479),
+            LIMB_PAIR(0x2E9879A2, 0xF6197C42), LIMB_PAIR(0x52CA3647, 0xA44ADDD4), LIMB_PAIR(0x4B4EACCB, 0x9B413FC1), LIMB_PAIR(0x07EF4F68, 0x354EF87D),
+            LIMB_PAIR(0x60C5D975, 0xFEE3B522), LIMB_PAIR(0xEB41B0B8, 0x50352EFC), LIMB_PAIR(0xA9F6653C, 0x8808AC30), LIMB_PAIR(0x0539236D, 0x302D92D2)
+        }
+    },
+#endif
+#if (41 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^41 * B
+            LIMB_PAIR(0x0DF53C30, 0x957B8B8B), LIMB_PAIR(0x8E60F098, 0x2A1C770A), LIMB_PAIR(0x345796DE, 0xBBC7A670), LIMB_PAIR(0x90C99BC9, 0x22A48F9A),
+            LIMB_PAIR(0xCB3EFB7C, 0x4C59023F), LIMB_PAIR(0xC63C2A94, 0x6C2FCB99), LIMB_PAIR(0xC3C7E084, 0xBA4190E2), LIMB_PAIR(0xA51874D9, 0x0E545DAE),
+            LIMB_PAIR(0x8D3FAC58, 0x6B7DC0DC), LIMB_PAIR(0xE6E42BFD, 0x5497CD6C), LIMB_PAIR(0xF400D305, 0x542F7D1B), LIMB_PAIR(0x048D9136, 0x4159F47F)
+        },
+        {   // 2 * 16^41 * B
+            LIMB_PAIR(0xBBD24839, 0x748515A8), LIMB_PAIR(0xAFB02B55, 0x77128347), LIMB_PAIR(0x49A2A17F, 0x50BA2AC6), LIMB_PAIR(0x3AD730F1, 0x06052551),
+            LIMB_PAIR(0x39E31E32, 0x20AD6608), LIMB_PAIR(0x8405BE50, 0xF81E1BD5), LIMB_PAIR(0xF4DABC69, 0xF8064056), LIMB_PAIR(0xCE71B975, 0x14D23DD4),
+            LIMB_PAIR(0x8AA27F82, 0xF2398E09), LIMB_PAIR(0x89A1B024, 0x6D7982BB), LIMB_PAIR(0x214DD24C, 0xFA694084), LIMB_PAIR(0xA32301C3, 0x71AB966F)
+        },
+        {   // 3 * 16^41 * B
+            LIMB_PAIR(0x02809955, 0xB1088A07), LIMB_PAIR(0x0B43C391, 0x43B273EA), LIMB_PAIR(0xFE0686ED, 0xCA9B67AE), LIMB_PAIR(0x8335F4ED, 0x605EECBF),
+            LIMB_PAIR(0x4DED02FC, 0x2DCBD8E3), LIMB_PAIR(0x596F22AA, 0x1151F3EC), LIMB_PAIR(0x4E0328DA, 0xBCA25543), LIMB_PAIR(0x92411B22, 0x35768FBE),
+            LIMB_PAIR(0x6C340431, 0x83200A65), LIMB_PAIR(0x8EE59C2F, 0x9FCD7167), LIMB_PAIR(0x71300F8A, 0x75D4613F), LIMB_PAIR(0x60F542F9, 0x7A912FAF)
+        },
+        {   // 4 * 16^41 * B
+            LIMB_PAIR(0xFA2D5597, 0x253F4F8D), LIMB_PAIR(0x5477130C, 0x25E49C40), LIMB_PAIR(0x996B1102, 0x00C052E5), LIMB_PAIR(0x33BB6C4A, 0x33CB966E),
+            LIMB_PAIR(0x5EDC1A43, 0xB204585E), LIMB_PAIR(0x5897C73C, 0x9F0E16EE), LIMB_PAIR(0x4E70483C, 0x5B82C0AE), LIMB_PAIR(0x2BDDF9BE, 0x624A170E),
+            LIMB_PAIR(0x7F116909, 0x59702804), LIMB_PAIR(0x1E564467, 0x828AC41C), LIMB_PAIR(0xE6217387, 0x70417DBD), LIMB_PAIR(0xFBAC4384, 0x721627AE)
+        },
+        {   // 5 * 16^41 * B
+            LIMB_PAIR(0x410B2F22, 0xFD3097BC), LIMB_PAIR(0xB5CFA844, 0xF1A05DA7), LIMB_PAIR(0xEF57CA74, 0x61289A1D), LIMB_PAIR(0xBB821902, 0x245EA199),
+            LIMB_PAIR(0x8736ADD5, 0x97D03BC3), LIMB_PAIR(0xC532B130, 0x2F1422AF), LIMB_PAIR(0x7101BBC4, 0x3AA68A05), LIMB_PAIR(0xE74F9FA7, 0x4C946CF7),
+            LIMB_PAIR(0x78D477F8, 0xAEDCA669), LIMB_PAIR(0x29117FE1, 0x1898BA3C), LIMB_PAIR(0x720CBD58, 0xCF73F983), LIMB_PAIR(0xB8B56351, 0x67DA12E6)
+        },
+        {   // 6 * 16^41 * B
+            LIMB_PAIR(0x8EC8308C, 0x2B7EF3D3), LIMB_PAIR(0x71EB94AB, 0x828FD7EC), LIMB_PAIR(0xC5062ABD, 0x807C3B36), LIMB_PAIR(0x31A94141, 0x0CB64CB8),
+            LIMB_PAIR(0xB4BD6E07, 0x7067E187), LIMB_PAIR(0xC7D1FE74, 0x6E8F0203), LIMB_PAIR(0x38C85A30, 0x93C6AA2F), LIMB_PAIR(0x3D75A78A, 0x76297D1F),
+            LIMB_PAIR(0x534C6378, 0x3030FC33), LIMB_PAIR(0xE541E861, 0xB9635C5C), LIMB_PAIR(0xD9B2C728, 0x15D9A9BE), LIMB_PAIR(0xF3775DCB, 0x49233EA3)
+        },
+        {   // 7 * 16^41 * B
+            LIMB_PAIR(0x1C9F249B, 0x7B3985FE), LIMB_PAIR(0xA1233293, 0x4FD6B2D5), LIMB_PAIR(0x1ADF4D62, 0xCEB34594), LIMB_PAIR(0x542DE50C, 0x6987FF6F),
+            LIMB_PAIR(0x8DBFFC3A, 0x629398FA), LIMB_PAIR(0xD54DB455, 0xE12FE52D), LIMB_PAIR(0xDAF25295, 0xF3BE11DF), LIMB_PAIR(0xCE5E7B51, 0x628B140D),
+            LIMB_PAIR(0x8F83753C, 0x47E24142), LIMB_PAIR(0x866AF997, 0x6317BEBC), LIMB_PAIR(0x3D1A9829, 0xDABB5B43), LIMB_PAIR(0x5287FB2D, 0x074D8D24)
+        },
+        {   // 8 * 16^41 * B
+            LIMB_PAIR(0xC0E31488, 0x481875C6), LIMB_PAIR(0xE22034B4, 0x219429B2), LIMB_PAIR(0x31283B65, 0x7223C98A), LIMB_PAIR(0x342277F9, 0x3420D60B),
+            LIMB_PAIR(0x440BFC31, 0x8337D9CD), LIMB_PAIR(0xAF318FD7, 0x729D2CA1), LIMB_PAIR(0x772C2070, 0xA040A4A4), LIMB_PAIR(0x3A7349BE, 0x46002EF0),
+            LIMB_PAIR(0xAFFE65F7, 0xFAA23ADE), LIMB_PAIR(0x5BE0764C, 0x78261ED4), LIMB_PAIR(0x2F164403, 0x441C0A1E), LIMB_PAIR(0x7A87D395, 0x5AEA8E56)
+        }
+    },
+#endif
+#if (42 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^42 * B
+            LIMB_PAIR(0xE4E0F177, 0x2DBC6FB6), LIMB_PAIR(0xA4BD6A93, 0x04E1BF29), LIMB_PAIR(0x787AF6E8, 0x5E1966D4), LIMB_PAIR(0xB426D060, 0x0EDC5F5E),
+            LIMB_PAIR(0xBCA4283D, 0x7813C1A2), LIMB_PAIR(0xA1863DD9, 0xED62F091), LIMB_PAIR(0xC268FA86, 0xAEC7BCB8), LIMB_PAIR(0x6F1CAE4C, 0x10E5D3B7),
+            LIMB_PAIR(0x53DA8E67, 0x5453BFD6), LIMB_PAIR(0x24A9F641, 0xE9DC1EEC), LIMB_PAIR(0x03578A23, 0xBF87263B), LIMB_PAIR(0x361CBA72, 0x45B46C51)
+        },
+        {   // 2 * 16^42 * B
+            LIMB_PAIR(0x8A7FE3E4, 0xCE9D4DDD), LIMB_PAIR(0x76620E30, 0xAB136456), LIMB_PAIR(0xB30E9958, 0x4B594F7B), LIMB_PAIR(0x321229DF, 0x5C1C0AEF),
+            LIMB_PAIR(0x314F7FA1, 0xA9402ABF), LIMB_PAIR(0x8E8CF450, 0xE257F1DC), LIMB_PAIR(0x23A8BE84, 0x1DBBD54B), LIMB_PAIR(0x6DCB713B, 0x2177BFA3),
+            LIMB_PAIR(0xFA79DB8F, 0x37081BBC), LIMB_PAIR(0xC25F59B3, 0x6048811E), LIMB_PAIR(0x9C832487, 0x087A7665), LIMB_PAIR(0x7D8AB5BB, 0x4AE61938)
+        },
+        {   // 3 * 16^42 * B
+            LIMB_PAIR(0x985BFB83, 0x61117E44), LIMB_PAIR(0x71963136, 0xFCE0462A), LIMB_PAIR(0xD425904B, 0x83AC3448), LIMB_PAIR(0x5BA43D64, 0x75685ABE),
+            LIMB_PAIR(0x5344A32E, 0x8DDBF6AA), LIMB_PAIR(0xB41B4078, 0x7D88EAB4), LIMB_PAIR(0x4A130D60, 0x5EB0EB97), LIMB_PAIR(0x17BF3E03, 0x1A00D91B),
+            LIMB_PAIR(0xEB61F2B2, 0x6E960933), LIMB_PAIR(0xC9FF4952, 0x543D0FA8), LIMB_PAIR(0x7AF66569, 0xDF727510), LIMB_PAIR(0x23B0E6AA, 0x135529B6)
+        },
+        {   // 4 * 16^42 * B
+            LIMB_PAIR(0xE22E83FE, 0xF5C716BC), LIMB_PAIR(0xE80985C1, 0xB42BEB19), LIMB_PAIR(0x14254AAE, 0xEC9DA637), LIMB_PAIR(0x1590A613, 0x5972EA05),
+            LIMB_PAIR(0xADD1D518, 0x18F0DBD7), LIMB_PAIR(0xCFC11F11, 0x979F7888), LIMB_PAIR(0x7114759B, 0x8732E1F0), LIMB_PAIR(0x65CA3A01, 0x79B5B81A),
+            LIMB_PAIR(0xDC8F7811, 0x0FD4AC20), LIMB_PAIR(0xAC4D4FA8, 0x9A9AD294), LIMB_PAIR(0xB3360434, 0xC01B2D64), LIMB_PAIR(0x905F3BDB, 0x4F7E9C95)
+        },
+        {   // 5 * 16^42 * B
+            LIMB_PAIR(0x355299FE, 0x71C8443D), LIMB_PAIR(0xDBEBEAD7, 0x8BCD3B1C), LIMB_PAIR(0xF1A49466, 0x8092499E), LIMB_PAIR(0xA144ADC8, 0x1942EEC4),
+            LIMB_PAIR(0x5781302E, 0x62674BBC), LIMB_PAIR(0x89ADDC0F, 0xD8520F39), LIMB_PAIR(0x53FBD9C6, 0x8C2999AE), LIMB_PAIR(0x2E638E4C, 0x31993AD9),
+            LIMB_PAIR(0xAE234992, 0x7DAC5319), LIMB_PAIR(0x0CEA3E92, 0x2C1B3D91), LIMB_PAIR(0x253C1122, 0x553CE494), LIMB_PAIR(0x4EF9CA75, 0x2A0A6531)
+        },
+        {   // 6 * 16^42 * B
+            LIMB_PAIR(0x3C1C793A, 0xCF361ACD), LIMB_PAIR(0x5A35BC3B, 0x2F9EBCAC), LIMB_PAIR(0xA8CDA6AB, 0x60E860E9), LIMB_PAIR(0x6DEA1A13, 0x055DC39B),
+            LIMB_PAIR(0xF7F927C2, 0x2DB7937F), LIMB_PAIR(0x17D0A635, 0xDB741F06), LIMB_PAIR(0x1155AF76, 0x5982F3A2), LIMB_PAIR(0x647C2DED, 0x4CF6E218),
+            LIMB_PAIR(0xC28D5BB6, 0xB119227C), LIMB_PAIR(0x774DFFAB, 0x07E24EBC), LIMB_PAIR(0xE4A32C89, 0xA83C78CE), LIMB_PAIR(0x10AA24B6, 0x121A3077)
+        },
+        {   // 7 * 16^42 * B
+            LIMB_PAIR(0xC77483C9, 0xD659713E), LIMB_PAIR(0xB82B96AF, 0x88BFE077), LIMB_PAIR(0x1097BCD3, 0x289E2823), LIMB_PAIR(0x6CED3A9B, 0x527BB94A),
+            LIMB_PAIR(0x9F034A97, 0xE4DB5D5E), LIMB_PAIR(0x3034BC2D, 0xE153FC09), LIMB_PAIR(0x9551D3B1, 0x46054691), LIMB_PAIR(0x7A40E52D, 0x333FC76C),
+            LIMB_PAIR(0x995B482E, 0x563D992A), LIMB_PAIR(0x6E383801, 0x3405D07C), LIMB_PAIR(0x2F64D8E5, 0x485035DE), LIMB_PAIR(0x20A7A9F7, 0x6B89069B)
+        },
+        {   // 8 * 16^42 * B
+            LIMB_PAIR(0xB5C7DB77, 0x4082FA8C), LIMB_PAIR(0xC734C155, 0x068686F8), LIMB_PAIR(0xF6E7A57E, 0x29E6C8D9), LIMB_PAIR(0xA7639BCF, 0x0473D308),
+            LIMB_PAIR(0x6270220D, 0x812AA041), LIMB_PAIR(0xF9245B4E, 0x995A89FA), LIMB_PAIR(0x5072EF05, 0xFFADC4CE), LIMB_PAIR(0xAA73EB73, 0x23BC2103),
+            LIMB_PAIR(0x03589E05, 0xCAEE7926), LIMB_PAIR(0x46DCC492, 0x2B4B4212), LIMB_PAIR(0xE601A94F, 0x02A1EF74), LIMB_PAIR(0xDE04341A, 0x102F73BF)
+        }
+    },
+#endif
+#if (43 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^43 * B
+            LIMB_PAIR(0x93A36247, 0x358ECBA2), LIMB_PAIR(0xB268FD65, 0xAF8F9862), LIMB_PAIR(0x68A01C89, 0x412F7E99), LIMB_PAIR(0xCD754524, 0x5786F312),
+            LIMB_PAIR(0x7EC20D3E, 0xB5A2D50C), LIMB_PAIR(0xA0C97263, 0xC64BDD6E), LIMB_PAIR(0xC1FF734D, 0x56E89052), LIMB_PAIR(0x2B2FFABA, 0x4929C6F7),
+            LIMB_PAIR(0xCA14032C, 0x337788FF), LIMB_PAIR(0x447F1EE3, 0xF3921028), LIMB_PAIR(0x231BCCAD, 0x8B14071F), LIMB_PAIR(0xF2344783, 0x4C817B4B)
+        },
+        {   // 2 * 16^43 * B
+            LIMB_PAIR(0xA40B4484, 0x413BA057), LIMB_PAIR(0x4F5F6A43, 0xBA4C2E1A), LIMB_PAIR(0xAEE1D61C, 0x614BA0A5), LIMB_PAIR(0x8B05DC53, 0x78A1531A),
+            LIMB_PAIR(0x2871B96E, 0x0FF85385), LIMB_PAIR(0x60C3F1BB, 0xE13E9FAB), LIMB_PAIR(0x25344402, 0xEEFD5953), LIMB_PAIR(0x75B7744B, 0x0A37C370),
+            LIMB_PAIR(0x3AD0562B, 0x6CBDF170), LIMB_PAIR(0xC92521A3, 0x8ECF4830), LIMB_PAIR(0xFD8424E7, 0xDAEBD303), LIMB_PAIR(0x2E5EC56F, 0x72AD82A4)
+        },
+        {   // 3 * 16^43 * B
+            LIMB_PAIR(0x67024BC3, 0xC3689391), LIMB_PAIR(0x49502FDA, 0x8E69D16D), LIMB_PAIR(0xE45F4B29, 0xFCF2EC3C), LIMB_PAIR(0xA3B4CBC4, 0x065F669E),
+            LIMB_PAIR(0xBAFB65F6, 0x3F9E8E35), LIMB_PAIR(0xF27293A1, 0x39D69EC8), LIMB_PAIR(0x8CF6A3D0, 0x6CB8CD95), LIMB_PAIR(0x73ADAE6D, 0x17347781),
+            LIMB_PAIR(0x5532DB4D, 0x8A00AEC7), LIMB_PAIR(0x43E31BB1, 0xB869A4E4), LIMB_PAIR(0xD3A7F515, 0x4A0F8552), LIMB_PAIR(0x303D7C08, 0x19ADEB7C)
+        },
+        {   // 4 * 16^43 * B
+            LIMB_PAIR(0x43C31794, 0x9D05BA7D), LIMB_PAIR(0x93322526, 0x2470C8FF), LIMB_PAIR(0x16197438, 0x8323DEC8), LIMB_PAIR(0x81569B53, 0x28527098),
+            LIMB_PAIR(0x53EAD9A3, 0xC720CB61), LIMB_PAIR(0x512B636E, 0x55B2C97F), LIMB_PAIR(0xD40290B1, 0xB1E35B5F), LIMB_PAIR(0x3B530EE2, 0x2FD9CCF1),
+            LIMB_PAIR(0x47F796B8, 0x07BD475B), LIMB_PAIR(0x542C8F54, 0xD2C7B013), LIMB_PAIR(0x3B24F87E, 0x2DBD23F4), LIMB_PAIR(0x7B0901D6, 0x6551AFD7)
+        },
+        {   // 5 * 16^43 * B
+            LIMB_PAIR(0xA1D5C9AC, 0x68A24CE3), LIMB_PAIR(0x10FF6461, 0xBB77A33D), LIMB_PAIR(0x25D3166E, 0x0F86CE44), LIMB_PAIR(0x50B9623B, 0x56507C09),
+            LIMB_PAIR(0x54AAC27F, 0x4546BAAF), LIMB_PAIR(0xB2A45A28, 0xF6F66FEC), LIMB_PAIR(0x562BCFE8, 0x582D1B5B), LIMB_PAIR(0x920F785F, 0x44B123F3),
+            LIMB_PAIR(0xD1713E63, 0x1206F0B7), LIMB_PAIR(0x15BAFC74, 0x353FE3D9), LIMB_PAIR(0x0AD9D94D, 0x194CEB97), LIMB_PAIR(0xF9D03AD3, 0x62FADD7C)
+        },
+        {   // 6 * 16^43 * B
+            LIMB_PAIR(0xE7CE4594, 0x3CD7BC61), LIMB_PAIR(0xB7DD267E, 0xCD6B35A9), LIMB_PAIR(0x4366EF27, 0xA080ABC8), LIMB_PAIR(0x59C79711, 0x6EC7C46F),
+            LIMB_PAIR(0x5598A074, 0xC6B5967B), LIMB_PAIR(0x8E493E25, 0x5EFE91CE), LIMB_PAIR(0x49280888, 0xD4B72C45), LIMB_PAIR(0xA26740C2, 0x20EF1149),
+            LIMB_PAIR(0x6F09A8A2, 0x2F07AD63), LIMB_PAIR(0x24205E7D, 0x8697E6CE), LIMB_PAIR(0xEE35A139, 0xC0AEFC05), LIMB_PAIR(0xB5F9D897, 0x15E80958)
+        },
+        {   // 7 * 16^43 * B
+            LIMB_PAIR(0x5BB061C4, 0x4DD1ED35), LIMB_PAIR(0x941C0700, 0x42DC0CEF), LIMB_PAIR(0xFD86340E, 0x61305DC1), LIMB_PAIR(0x0E55A443, 0x56B2CC93),
+            LIMB_PAIR(0x0C3E235B, 0x25A5EF7D), LIMB_PAIR(0xBE134EE7, 0x6C39C17F), LIMB_PAIR(0x2DC5C327, 0xC774E134), LIMB_PAIR(0x92021F39, 0x021354B8),
+            LIMB_PAIR(0xA6BFC5A2, 0x1DF79DA6), LIMB_PAIR(0x9FDE4369, 0x02F3A274), LIMB_PAIR(0xCDA390A7, 0xB323D9F2), LIMB_PAIR(0x8774D363, 0x7BE0847B)
+        },
+        {   // 8 * 16^43 * B
+            LIMB_PAIR(0x5307FA11, 0x1466F5AF), LIMB_PAIR(0xED6C0AF2, 0x817FCC7D), LIMB_PAIR(0xC3A4A3FB, 0x0A6DE44E), LIMB_PAIR(0xBC927D0B, 0x74071475),
+            LIMB_PAIR(0x8B3F55C3, 0x8C99CC5A), LIMB_PAIR(0x3FDED2A0, 0x0611D725), LIMB_PAIR(0x36B70A36, 0xED2995FF), LIMB_PAIR(0xD78A2619, 0x1F699A54),
+            LIMB_PAIR(0x73E7EA8A, 0xE77292F3), LIMB_PAIR(0xCB045A31, 0x296537D2), LIMB_PAIR(0xD3274FDE, 0x1BD0653E), LIMB_PAIR(0x76BD2966, 0x2F9A2C44)
+        }
+    },
+#endif
+#if (44 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^44 * B
+            LIMB_PAIR(0xB5511C9A, 0xA2B4DAE0), LIMB_PAIR(0x2BFFFF06, 0x7AC86029), LIMB_PAIR(0xF5504234, 0x981F375D), LIMB_PAIR(0xDA4EA12D, 0x3F6BD725),
+            LIMB_PAIR(0x7F5745C6, 0xEB18B9AB), LIMB_PAIR(0x5787C690, 0x023A8AEE), LIMB_PAIR(0x2DF7AFA9, 0xB72712DA), LIMB_PAIR(0xEA5C013D, 0x36597D25),
+            LIMB_PAIR(0x106058AC, 0x734D8D7B), LIMB_PAIR(0x6FC6905F, 0xD940579E), LIMB_PAIR(0x9202932D, 0x6466F8F9), LIMB_PAIR(0xDA60D6D0, 0x7B7ECC19)
+        },
+        {   // 2 * 16^44 * B
+            LIMB_PAIR(0xA77CFA9B, 0x6DAE4A51), LIMB_PAIR(0xE7A38650, 0x82263654), LIMB_PAIR(0x8F2D82DB, 0x09BBFFCD), LIMB_PAIR(0x1BF5CABA, 0x03BEDC66),
+            LIMB_PAIR(0x695C690D, 0x78C2373C), LIMB_PAIR(0x0642906E, 0xDD252E66), LIMB_PAIR(0x4AE12BD2, 0x951D4444), LIMB_PAIR(0x01743956, 0x4235AD76),
+            LIMB_PAIR(0x078975F5, 0x6258CB0D), LIMB_PAIR(0x9189F298, 0x49294254), LIMB_PAIR(0xE2E36EE4, 0xA0CAB423), LIMB_PAIR(0xCDF066A1, 0x0E7CE2B0)
+        },
+        {   // 3 * 16^44 * B
+            LIMB_PAIR(0xD94B70F9, 0xFEA6FEDF), LIMB_PAIR(0xC1FCBA2D, 0xF130C051), LIMB_PAIR(0x7F2FAB89, 0x4882D47E), LIMB_PAIR(0x8AECEEB5, 0x61525613),
+            LIMB_PAIR(0xC48C85A3, 0xC494643A), LIMB_PAIR(0x3C6139AD, 0xFD361DF4), LIMB_PAIR(0x3AE94D48, 0x09DB17DD), LIMB_PAIR(0x8FB4674A, 0x666E0A5D),
+            LIMB_PAIR(0x4870CB0D, 0x2ABBF64E), LIMB_PAIR(0xAA458B6B, 0xCD65BCF0), LIMB_PAIR(0x75E8985D, 0x9ABE4EBA), LIMB_PAIR(0xD514DEE4, 0x7F0BC810)
+        },
+        {   // 4 * 16^44 * B
+            LIMB_PAIR(0x737213A0, 0x83AC9DAD), LIMB_PAIR(0x2EF72E98, 0x9FF6F8BA), LIMB_PAIR(0x43EC6957, 0x311E2EDD), LIMB_PAIR(0xDEC5AB75, 0x1D3A907D),
+            LIMB_PAIR(0x26F4136F, 0xB9006BA4), LIMB_PAIR(0x57E03035, 0x8D67369E), LIMB_PAIR(0x4F463C28, 0xCBC8DFD9), LIMB_PAIR(0xF8EEDBF5, 0x0D1F8DBC),
+            LIMB_PAIR(0x3ED081DC, 0xBA169331), LIMB_PAIR(0x851B3480, 0x29329FAD), LIMB_PAIR(0x030321CB, 0x0128013C), LIMB_PAIR(0xA31BFDE3, 0x00011B44)
+        },
+        {   // 5 * 16^44 * B
+            LIMB_PAIR(0x6A0AA75C, 0x16561F69), LIMB_PAIR(0x5852BD6A, 0xC1BF725C), LIMB_PAIR(0x9A7966AD, 0x11A8DD7F), LIMB_PAIR(0xD2851026, 0x63D988A2),
+            LIMB_PAIR(0x3FC66C0C, 0x3FDFA06C), LIMB_PAIR(0x4DD60DD2, 0x5D40E38E), LIMB_PAIR(0x268E4D71, 0x7AE38B38), LIMB_PAIR(0x6E8357E1, 0x3AC48D91),
+            LIMB_PAIR(0xAFBD232E, 0x00120753), LIMB_PAIR(0xFDD8F683, 0xE92BCEB8), LIMB_PAIR(0x84E72B91, 0xF81669B3), LIMB_PAIR(0x2368A066, 0x33FAD52B)
+        },
+        {   // 6 * 16^44 * B
+            LIMB_PAIR(0xC422CFE8, 0x8D2CC8D0), LIMB_PAIR(0x05A13ACB, 0x072B4F7B), LIMB_PAIR(0xECF6A56F, 0xA3FEB6E6), LIMB_PAIR(0xB90A71E2, 0x3CC355CC),
+            LIMB_PAIR(0xC5E41E16, 0x540649C6), LIMB_PAIR(0x333F7735, 0x0AF86430), LIMB_PAIR(0xF305E746, 0xB2ACFCD2), LIMB_PAIR(0xA256DCA7, 0x16C0F429),
+            LIMB_PAIR(0x903E9131, 0xE9B69443), LIMB_PAIR(0x7A5637CE, 0xB8A494CB), LIMB_PAIR(0xBABA9244, 0xC87CD1A4), LIMB_PAIR(0x6BAE7568, 0x631EAF42)
+        },
+        {   // 7 * 16^44 * B
+            LIMB_PAIR(0xA3700DE8, 0x47D975B9), LIMB_PAIR(0xE2F80552, 0x7280C5FB), LIMB_PAIR(0x32E45DE1, 0x53658F27), LIMB_PAIR(0x665F80B5, 0x431F2C7F),
+            LIMB_PAIR(0xDA66FE9F, 0xB3E90410), LIMB_PAIR(0x6C16E5A6, 0x85DD4B52), LIMB_PAIR(0x1EF9BF83, 0xBC3D9761), LIMB_PAIR(0x1EA919B5, 0x5599648B),
+            LIMB_PAIR(0x858F7B19, 0xD6026344), LIMB_PAIR(0xA1EA514A, 0x14AB352F), LIMB_PAIR(0x2090A9D7, 0x8900441A), LIMB_PAIR(0x91253B26, 0x7B04715F)
+        },
+        {   // 8 * 16^44 * B
+            LIMB_PAIR(0xC4E6BAC6, 0xB376C280), LIMB_PAIR(0x6D1D9B0B, 0x970ED3DD), LIMB_PAIR(0x450BF944, 0xB09A9558), LIMB_PAIR(0x57CDE223, 0x48D0ACFA),
+            LIMB_PAIR(0xACF6AE43, 0x83EDBD28), LIMB_PAIR(0x7D5C7AB4, 0x86357C8B), LIMB_PAIR(0xB7EB2C44, 0xC0404769), LIMB_PAIR(0xC2F6583F, 0x59B37BF5),
+            LIMB_PAIR(0x7DABE671, 0xB60F26E4), LIMB_PAIR(0x622F3A37, 0xF1D1A197), LIMB_PAIR(0xE9960394, 0x4208CE7E), LIMB_PAIR(0x336D3BDB, 0x16234191)
+        }
+    },
+#endif
+#if (45 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^45 * B
+            LIMB_PAIR(0x3D578BBE, 0x852DD1FD), LIMB_PAIR(0xC3286108, 0x2B65CE72), LIMB_PAIR(0xEACE2273, 0x658C07F4), LIMB_PAIR(0xEC38AB40, 0x0933F804),
+            LIMB_PAIR(0x33A63AEF, 0xF19AEAC7), LIMB_PAIR(0x4442454E, 0x2C7FBA5D), LIMB_PAIR(0x4795E441, 0x5DA87AA0), LIMB_PAIR(0xA4E0B0F5, 0x413051E1),
+            LIMB_PAIR(0x8D496476, 0xA7AB6979), LIMB_PAIR(0xFCB5ABC8, 0x8121AADE), LIMB_PAIR(0x7B539472, 0xA5DC12EF), LIMB_PAIR(0x5E45351A, 0x07FD4706)
+        },
+        {   // 2 * 16^45 * B
+            LIMB_PAIR(0x9AE8E7C3, 0x30421155), LIMB_PAIR(0x944882A5, 0xF281B229), LIMB_PAIR(0x378250E4, 0x8A13AC2E), LIMB_PAIR(0x54BA48F4, 0x014AFA09),
+            LIMB_PAIR(0x258D2BCD, 0xC8583C3D), LIMB_PAIR(0xAF60B73F, 0x17029A4D), LIMB_PAIR(0x416A3781, 0xFA0FC9D6), LIMB_PAIR(0x38B3FB23, 0x1C1E5FBA),
+            LIMB_PAIR(0x1BB3666C, 0xCB319700), LIMB_PAIR(0x4BFFECB9, 0x33006052), LIMB_PAIR(0x1A88233C, 0x29371199), LIMB_PAIR(0x3D4ED364, 0x29188436)
+        },
+        {   // 3 * 16^45 * B
+            LIMB_PAIR(0xBC1AB6EB, 0xFB9D37C3), LIMB_PAIR(0x4D57A240, 0x02BE1453), LIMB_PAIR(0xF8A5E1F6, 0xF4D73415), LIMB_PAIR(0x0CCC8188, 0x5964F430),
+            LIMB_PAIR(0xDC4BABFA, 0x033C6805), LIMB_PAIR(0x5596ECC1, 0x2C15BF5E), LIMB_PAIR(0xB59B1D3B, 0x1BC70624), LIMB_PAIR(0xA19F0EC5, 0x3EDE9850),
+            LIMB_PAIR(0x2D096800, 0xE44A2315), LIMB_PAIR(0x70866996, 0x5C08C559), LIMB_PAIR(0x46AFFB6E, 0xDF2DB60A), LIMB_PAIR(0xF856FD89, 0x579155C1)
+        },
+        {   // 4 * 16^45 * B
+            LIMB_PAIR(0x0817E7A6, 0xB5F16B63), LIMB_PAIR(0x3C351026, 0x808C6923), LIMB_PAIR(0x54CEF201, 0x324A983B), LIMB_PAIR(0x4A485345, 0x53C09208),
+            LIMB_PAIR(0x12E0C9EF, 0x96324EDD), LIMB_PAIR(0xF2420297, 0x468B878D), LIMB_PAIR(0xA4F573BE, 0x199A3776), LIMB_PAIR(0x8E91E92A, 0x1E7FBCF1),
+            LIMB_PAIR(0xF1CBAFBF, 0xD2D41481), LIMB_PAIR(0x716174E5, 0x231D2DB6), LIMB_PAIR(0xE2A55C98, 0x0B7D7656), LIMB_PAIR(0x2AA495F6, 0x3E955CD8)
+        },
+        {   // 5 * 16^45 * B
+            LIMB_PAIR(0x61BB3A3F, 0xAB39F3EF), LIMB_PAIR(0x2EB9193E, 0x8EB40065), LIMB_PAIR(0x38C11F74, 0xB5DE6ECC), LIMB_PAIR(0x26F3C49F, 0x654D7E96),
+            LIMB_PAIR(0x3ED15433, 0xE48F535E), LIMB_PAIR(0x0D7270A3, 0xD075692A), LIMB_PAIR(0xAADE6387, 0x40FBD21D), LIMB_PAIR(0xCF4495F5, 0x14264887),
+            LIMB_PAIR(0x5C7D2CEB, 0xE564CFDD), LIMB_PAIR(0xD737CCB9, 0x82EEAFDE), LIMB_PAIR(0xD1F9B0AB, 0x6107DB62), LIMB_PAIR(0xB4358DBB, 0x0B6BAAC3)
+        },
+        {   // 6 * 16^45 * B
+            LIMB_PAIR(0x3700A93B, 0x204ABAD6), LIMB_PAIR(0xDA779373, 0xBE0023D3), LIMB_PAIR(0x633AB709, 0xD85F0346), LIMB_PAIR(0x90820412, 0x00496DC4),
+            LIMB_PAIR(0x8622FE98, 0x7AE62BCB), LIMB_PAIR(0xCEB891AF, 0x47762256), LIMB_PAIR(0xF2E406B4, 0x1A5A92BC), LIMB_PAIR(0x84E41501, 0x7D294017),
+            LIMB_PAIR(0xC27E6360, 0x1C74B88D), LIMB_PAIR(0x8D14850C, 0x07485426), LIMB_PAIR(0x3E0DCB30, 0xA145FB7B), LIMB_PAIR(0x43803B23, 0x10843F1B)
+        },
+        {   // 7 * 16^45 * B
+            LIMB_PAIR(0xE324689B, 0xD56F672D), LIMB_PAIR(0xB394A981, 0xD1DA8AED), LIMB_PAIR(0x9168CFED, 0xDD7B58FE), LIMB_PAIR(0x4D56C1E8, 0x7CE246CD),
+            LIMB_PAIR(0x376276DD, 0xC5F90455), LIMB_PAIR(0xD7645CD9, 0xCE59158D), LIMB_PAIR(0x1D366B39, 0x92F65D51), LIMB_PAIR(0x526996C4, 0x11574B6E),
+            LIMB_PAIR(0x7F80BE53, 0xB8F4308E), LIMB_PAIR(0x34A9D397, 0x5F3CB8CB), LIMB_PAIR(0x33CC2B2C, 0x18A961BD), LIMB_PAIR(0x3A9AF671, 0x710045FB)
+        },
+        {   // 8 * 16^45 * B
+            LIMB_PAIR(0x059D699E, 0xA03FC862), LIMB_PAIR(0x9A619E69, 0x2370CFA1), LIMB_PAIR(0x2F823DEB, 0xC4FE3B12), LIMB_PAIR(0xA7F0844E, 0x1D1B056F),
+            LIMB_PAIR(0x101B95EB, 0x73F93D36), LIMB_PAIR(0x4F6F4486, 0xFAEF3379), LIMB_PAIR(0x8F15E562, 0x5651735F), LIMB_PAIR(0x58B40DA1, 0x7FA3F190),
+            LIMB_PAIR(0xE56BF61F, 0x1BC64631), LIMB_PAIR(0x6E5382A3, 0xD379AB10), LIMB_PAIR(0x0540168D, 0x4D58C57E), LIMB_PAIR(0x8442D8E4, 0x56625662)
+        }
+    },
+#endif
+#if (46 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^46 * B
+            LIMB_PAIR(0x1FF38640, 0xDD499CD6), LIMB_PAIR(0x063625A0, 0x29CD9BC3), LIMB_PAIR(0x3DD73DC3, 0x51E2D802), LIMB_PAIR(0x203B9231, 0x4A25707A),
+            LIMB_PAIR(0xF6267FF6, 0xB9E499DE), LIMB_PAIR(0x742C0843, 0x7772CA7B), LIMB_PAIR(0xE9A4F2B1, 0x23A0153F), LIMB_PAIR(0xD5D05006, 0x2CDFDFEC),
+            LIMB_PAIR(0x53F6ED6A, 0x2AB7668A), LIMB_PAIR(0x1DD170A1, 0x30424258), LIMB_PAIR(0x3AE20161, 0x4000144C), LIMB_PAIR(0x248E49FC, 0x5721896D)
+        },
+        {   // 2 * 16^46 * B
+            LIMB_PAIR(0xA1D0DA4E, 0x285D5091), LIMB_PAIR(0xB5FE3E08, 0x4BAA6FA7), LIMB_PAIR(0xE19393B3, 0x63E5177C), LIMB_PAIR(0xC4B030FD, 0x03C935AF),
+            LIMB_PAIR(0xFD181BAE, 0x0B6E5517), LIMB_PAIR(0x2BB963B4, 0x9022629F), LIMB_PAIR(0x32064625, 0x5509BCE9), LIMB_PAIR(0xF63C13DA, 0x578EDD74),
+            LIMB_PAIR(0x492B0C3D, 0x997276C6), LIMB_PAIR(0xDFE205FC, 0x47CCC2C4), LIMB_PAIR(0xDD623A3C, 0xDCD29B84), LIMB_PAIR(0x0288C7A2, 0x3EC2AB59)
+        },
+        {   // 3 * 16^46 * B
+            LIMB_PAIR(0xAE32D1CB, 0xA7213A09), LIMB_PAIR(0x40F5C2D5, 0x0F2B87DF), LIMB_PAIR(0xE81EAB29, 0x0BAEA4C6), LIMB_PAIR(0x6ADBAC5E, 0x0E1BF66C),
+            LIMB_PAIR(0xE4D87BB9, 0xA1A0D27B), LIMB_PAIR(0x61391AED, 0xA98B4DEB), LIMB_PAIR(0x73CB9B83, 0x99A0DDD0), LIMB_PAIR(0x200FCACE, 0x2DD5C25A),
+            LIMB_PAIR(0x792C887E, 0xE2ABD5E9), LIMB_PAIR(0xCB926D5D, 0x1A020018), LIMB_PAIR(0xBAAE5F1E, 0xBFBA69CD), LIMB_PAIR(0x5AE88F5F, 0x730548B3)
+        },
+        {   // 4 * 16^46 * B
+            LIMB_PAIR(0xA1D6E334, 0x805B094B), LIMB_PAIR(0x09353F19, 0xBF3EF177), LIMB_PAIR(0x0622702B, 0x423F06CB), LIMB_PAIR(0xD87845DD, 0x585A2277),
+            LIMB_PAIR(0xCBA8B8EE, 0xC43551A3), LIMB_PAIR(0xB2115F16, 0x65A26F1D), LIMB_PAIR(0xAB8C3850, 0x760F4F52), LIMB_PAIR(0x411DB8CA, 0x3043443B),
+            LIMB_PAIR(0x33D48962, 0xA18A5F82), LIMB_PAIR(0xEC78257F, 0x6698C4B5), LIMB_PAIR(0x373E41FF, 0xA78E6FA5), LIMB_PAIR(0x50EF981F, 0x76562789)
+        },
+        {   // 5 * 16^46 * B
+            LIMB_PAIR(0xEA86CF9D, 0xE17073A3), LIMB_PAIR(0x07155FDC, 0x3A8CFBB7), LIMB_PAIR(0x31838A8E, 0x4853E7FC), LIMB_PAIR(0xB613F616, 0x28BBF484),
+            LIMB_PAIR(0xD51FC8C0, 0x38C3CF59), LIMB_PAIR(0x0506B6F2, 0x9BEDD2FD), LIMB_PAIR(0xAB570E8F, 0x26BF109F), LIMB_PAIR(0xC1B846A6, 0x3F4160A8),
+            LIMB_PAIR(0x6F136C7C, 0xF2612F5C), LIMB_PAIR(0xF6DD11BE, 0xAFEAD107), LIMB_PAIR(0x13DE6F33, 0x527E9AD2), LIMB_PAIR(0x8188F75D, 0x1E79CB35)
+        },
+        {   // 6 * 16^46 * B
+            LIMB_PAIR(0xF5E08181, 0x77E953D8), LIMB_PAIR(0x299DDED9, 0x84A50C44), LIMB_PAIR(0x864525E5, 0xDC6C2D0C), LIMB_PAIR(0x39D1F2F4, 0x478AB52D),
+            LIMB_PAIR(0xEEF7E3F1, 0x013436C3), LIMB_PAIR(0xFE9E10F8, 0x828B6A7F), LIMB_PAIR(0xBCF9DEFC, 0x7FF908E5), LIMB_PAIR(0x3A3B3831, 0x65D7951B),
+            LIMB_PAIR(0x9252D159, 0x66A6A4D3), LIMB_PAIR(0x871AC807, 0xE5DDE1BC), LIMB_PAIR(0xA6C1C96F, 0xB82C6B40), LIMB_PAIR(0x1A212214, 0x16D87A41)
+        },
+        {   // 7 * 16^46 * B
+            LIMB_PAIR(0xD54E0583, 0xFBA4D5E2), LIMB_PAIR(0x2EBD99FA, 0xE21FAFD7), LIMB_PAIR(0x6EE9778F, 0x497AC273), LIMB_PAIR(0x7A5A6DDE, 0x1F990B57),
+            LIMB_PAIR(0x42066215, 0xB3BD7E5A), LIMB_PAIR(0x0C5A24C1, 0x879BE3CD), LIMB_PAIR(0xD6F994B7, 0x57C05DB1), LIMB_PAIR(0x65F38CA6, 0x28F87C81),
+            LIMB_PAIR(0x1BE8F7D6, 0xA3344EAD), LIMB_PAIR(0xACEA798F, 0x7D1E50EB), LIMB_PAIR(0x520DE052, 0x77C6569E), LIMB_PAIR(0x534D6D3E, 0x45882FE1)
+        },
+        {   // 8 * 16^46 * B
+            LIMB_PAIR(0x943C6FE4, 0xD8AC9929), LIMB_PAIR(0xA38392A2, 0xB5F9F161), LIMB_PAIR(0xBEC89AF3, 0x2699DB13), LIMB_PAIR(0xE405F074, 0x7DCF843C),
+            LIMB_PAIR(0x757983D6, 0x6669345D), LIMB_PAIR(0x17AA11A6, 0x62B6ED11), LIMB_PAIR(0x985E128F, 0x7DDD1857), LIMB_PAIR(0xF626F6DD, 0x688FE5B8),
+            LIMB_PAIR(0x4A4732C0, 0x6C90D648), LIMB_PAIR(0xCA563299, 0xD52143FD), LIMB_PAIR(0x915DC6E1, 0xB3BE28C3), LIMB_PAIR(0x7327191B, 0x6739687E)
+        }
+    },
+#endif
+#if (47 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^47 * B
+            LIMB_PAIR(0xC9CB971F, 0x8CE5AAD0), LIMB_PAIR(0x9FD54A29, 0x1156AAA9), LIMB_PAIR(0x15AF9B78, 0x41F72470), LIMB_PAIR(0x420F49AA, 0x1FE8CCA8),
+            LIMB_PAIR(0x200814CF, 0x9F65C5EA), LIMB_PAIR(0x69A31740, 0x840536E1), LIMB_PAIR(0x25C8B4AD, 0x8B0ED139), LIMB_PAIR(0xE936361D, 0x0080DBAF),
+            LIMB_PAIR(0x3C0CC82A, 0x72A1848F), LIMB_PAIR(0x877C9E54, 0x38C560C2), LIMB_PAIR(0xCE554140, 0x5004E228), LIMB_PAIR(0x03429D71, 0x042418A1)
+        },
+        {   // 2 * 16^47 * B
+            LIMB_PAIR(0x20816247, 0x58E84C6F), LIMB_PAIR(0xE36FD793, 0x8DB2B2B6), LIMB_PAIR(0x1D484D85, 0x97718256), LIMB_PAIR(0x8632ABD7, 0x0822024F),
+            LIMB_PAIR(0xABF3FF5F, 0x899DEA51), LIMB_PAIR(0x2FC2D8BA, 0x9B93A867), LIMB_PAIR(0xBE6EBD5C, 0x2C38CB97), LIMB_PAIR(0x97263B5D, 0x114D5784),
+            LIMB_PAIR(0x6B1BECA3, 0xB301BB7C), LIMB_PAIR(0xC6EB1375, 0x55393F6D), LIMB_PAIR(0x97B6E4EB, 0x910D2810), LIMB_PAIR(0x9D479EA3, 0x1AD4548D)
+        },
+        {   // 3 * 16^47 * B
+            LIMB_PAIR(0x0FE9FED3, 0xA06FE66D), LIMB_PAIR(0x1C587909, 0xA8733A40), LIMB_PAIR(0x0DF98953, 0x30D14D80), LIMB_PAIR(0xC7B30258, 0x41CE5876),
+            LIMB_PAIR(0x389A48FD, 0xCD5A7DA0), LIMB_PAIR(0x9A78371E, 0xB38FA4AA), LIMB_PAIR(0x2CDB8E6C, 0xC6D9761B), LIMB_PAIR(0xC97E1443, 0x35CF51DB),
+            LIMB_PAIR(0xD670C022, 0x59AC3BC5), LIMB_PAIR(0x9B119406, 0xEAE67C10), LIMB_PAIR(0xB3782FDA, 0x9798BDF0), LIMB_PAIR(0xFD074092, 0x651E3201)
+        },
+        {   // 4 * 16^47 * B
+            LIMB_PAIR(0x1EFCAE9E, 0xA57BA4A0), LIMB_PAIR(0xDC308A94, 0x769F4BEE), LIMB_PAIR(0x3603CB2E, 0xD1F10EEB), LIMB_PAIR(0x7E441278, 0x4099CE5E),
+            LIMB_PAIR(0xEF30C5CF, 0xD63D8483), LIMB_PAIR(0x2361CC0C, 0x4CD4B496), LIMB_PAIR(0xA48426AC, 0xEE90E500), LIMB_PAIR(0x18C14EEB, 0x0AF51D7D),
+            LIMB_PAIR(0x8A5121E9, 0x1AC98E4F), LIMB_PAIR(0xDBFA2FE0, 0x7DAE9544), LIMB_PAIR(0xD6430DF9, 0x8320AA0D), LIMB_PAIR(0x2C4A2FB5, 0x66728265)
+        },
+        {   // 5 * 16^47 * B
+            LIMB_PAIR(0x2946DB23, 0xADA8B6E0), LIMB_PAIR(0x7B253AB7, 0x1C0CE51A), LIMB_PAIR(0x66DD485B, 0x8448C85A), LIMB_PAIR(0xD0675ADF, 0x7F1FC025),
+            LIMB_PAIR(0xD86BC9AB, 0x874621F4), LIMB_PAIR(0x56FE6FEA, 0xB54C7BBE), LIMB_PAIR(0x7FADC22C, 0x077A2425), LIMB_PAIR(0x19B90D39, 0x1AB53BE4),
+            LIMB_PAIR(0x319EA6AA, 0xD8EE1B18), LIMB_PAIR(0x3A21F0DA, 0x004D8808), LIMB_PAIR(0x883A4F4B, 0x3BD6AA1D), LIMB_PAIR(0xDFD9FD14, 0x4DB9A3A6)
+        },
+        {   // 6 * 16^47 * B
+            LIMB_PAIR(0xCBB77C68, 0xD95B00BB), LIMB_PAIR(0x91F17849, 0xDDBC846A), LIMB_PAIR(0xBE28D9B3, 0x7CF700AE), LIMB_PAIR(0x85D31F3E, 0x5CE1285C),
+            LIMB_PAIR(0xB99C0755, 0x8CE7B23B), LIMB_PAIR(0xC4F50F7A, 0x35C5D6ED), LIMB_PAIR(0xED9B50C3, 0x7E1E2ED2), LIMB_PAIR(0xE8934DA1, 0x36305F16),
+            LIMB_PAIR(0x98B0BDE8, 0x31B6972D), LIMB_PAIR(0xACA6DE5B, 0x7D920706), LIMB_PAIR(0x908A659F, 0xE67310F8), LIMB_PAIR(0xEFDF0235, 0x50FAC2A6)
+        },
+        {   // 7 * 16^47 * B
+            LIMB_PAIR(0xF6F449BC, 0x295B1C86), LIMB_PAIR(0x1F0AB4DD, 0x51B2E84A), LIMB_PAIR(0xAA8E551D, 0xC001CB30), LIMB_PAIR(0x44F43662, 0x6A28D359),
+            LIMB_PAIR(0x5B880F5A, 0xF3D3A9F3), LIMB_PAIR(0xDB03E7C2, 0xEDEC050C), LIMB_PAIR(0xF9F0B1A2, 0xA896981F), LIMB_PAIR(0xAC5E34A4, 0x49A4AE2B),
+            LIMB_PAIR(0x04A740E0, 0x28BB12EE), LIMB_PAIR(0x9BCE8174, 0x14313BBD), LIMB_PAIR(0xE8C10C40, 0x72F5B5E4), LIMB_PAIR(0x36ADCD5B, 0x7CBFB199)
+        },
+        {   // 8 * 16^47 * B
+            LIMB_PAIR(0xCC36E6E0, 0x8E793A7A), LIMB_PAIR(0x7D586EED, 0xF9FAB7A3), LIMB_PAIR(0xBAE1F4E4, 0x3A4F9692), LIMB_PAIR(0xFF5F447E, 0x1C14B03E),
+            LIMB_PAIR(0x6B89792D, 0xA311DDC2), LIMB_PAIR(0xDA512664, 0x1B30B4C6), LIMB_PAIR(0xCF150859, 0x0CA77B4C), LIMB_PAIR(0x1B009408, 0x1DE443DF),
+            LIMB_PAIR(0x14A85291, 0x19647BD1), LIMB_PAIR(0x1034D3AF, 0x57B76CB2), LIMB_PAIR(0x0F9D6DFA, 0x6329DB44), LIMB_PAIR(0x6A571493, 0x5EF43E58)
+        }
+    },
+#endif
+#if (48 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^48 * B
+            LIMB_PAIR(0xC80C1AC0, 0xA66DCC9D), LIMB_PAIR(0x1B38A436, 0x97A05CF4), LIMB_PAIR(0x95DBD7C6, 0xA7EBF3BE), LIMB_PAIR(0x8D7E7DAB, 0x7DA0B8F6),
+            LIMB_PAIR(0x385675A6, 0xEF782014), LIMB_PAIR(0xAAFDA9E8, 0xA2649F30), LIMB_PAIR(0x5CDFA8CB, 0x4CD1EB50), LIMB_PAIR(0x1D4DC0B3, 0x46115ABA),
+            LIMB_PAIR(0xC3B5DA76, 0xD40F1953), LIMB_PAIR(0x21119E9B, 0x1DAC6F73), LIMB_PAIR(0xFEB25960, 0x03CC6021), LIMB_PAIR(0x83674B4B, 0x5A5F887E)
+        },
+        {   // 2 * 16^48 * B
+            LIMB_PAIR(0xA0A643B9, 0x9E9628D3), LIMB_PAIR(0xE6C32064, 0xB5C3CB00), LIMB_PAIR(0x7C2DEC32, 0x9B530289), LIMB_PAIR(0xD5D1C70C, 0x43E37AE2),
+            LIMB_PAIR(0x70A13D11, 0x8F6301CF), LIMB_PAIR(0x350DD0C4, 0xCFCEB815), LIMB_PAIR(0xA4BCA47E, 0xF70297D4), LIMB_PAIR(0xE44D1434, 0x3669B656),
+            LIMB_PAIR(0xEDA6E133, 0x387E3F06), LIMB_PAIR(0x99A13AC0, 0x67301D51), LIMB_PAIR(0x36263811, 0xBD5AD8F8), LIMB_PAIR(0x4FD5E9BE, 0x6A21E6CD)
+        },
+        {   // 3 * 16^48 * B
+            LIMB_PAIR(0x6699B2E3, 0xEF412912), LIMB_PAIR(0x708D1301, 0x71D30847), LIMB_PAIR(0x1182B0BD, 0x325432D0), LIMB_PAIR(0x001E8B36, 0x45371B07),
+            LIMB_PAIR(0x3046E65F, 0xF1C6170A), LIMB_PAIR(0x00D23524, 0x58712A2A), LIMB_PAIR(0x8C82B755, 0x69DBBD3C), LIMB_PAIR(0xA195FF57, 0x586BF9F1),
+            LIMB_PAIR(0x5EF8790B, 0xA6DB088D), LIMB_PAIR(0x610937E5, 0x5278F0DC), LIMB_PAIR(0x61A16EB8, 0xAC0349D2), LIMB_PAIR(0x90E52179, 0x0EAFB037)
+        },
+        {   // 4 * 16^48 * B
+            LIMB_PAIR(0x0F75AE1D, 0x5140805E), LIMB_PAIR(0x2662CC30, 0xEC02FBE3), LIMB_PAIR(0xEA92396D, 0x2CEBDF1E), LIMB_PAIR(0xC5435BB3, 0x44AE3344),
+            LIMB_PAIR(0x3748042F, 0x960555C1), LIMB_PAIR(0x820BAA11, 0x219A41E6), LIMB_PAIR(0x73486D0C, 0x1C81F738), LIMB_PAIR(0x5A02C661, 0x309ACC67),
+            LIMB_PAIR(0xBBA543EE, 0x9CF289B9), LIMB_PAIR(0x5AC97142, 0xF3760E9D), LIMB_PAIR(0x4F9360AA, 0x1D82E5C6), LIMB_PAIR(0x7F94678F, 0x62D5221B)
+        },
+        {   // 5 * 16^48 * B
+            LIMB_PAIR(0x3AF77A3C, 0x7585D426), LIMB_PAIR(0xFEE9144D, 0xDFAE7B11), LIMB_PAIR(0x59F7193D, 0xA5067080), LIMB_PAIR(0x83922037, 0x14F29A53),
+            LIMB_PAIR(0x18D0936D, 0x524C299C), LIMB_PAIR(0x8A0C1A0C, 0xC86BB56C), LIMB_PAIR(0xDB4A8631, 0xA375052E), LIMB_PAIR(0xBC754562, 0x5C0EFDE4),
+            LIMB_PAIR(0x25B2D7F5, 0xDF717EDC), LIMB_PAIR(0x99B53040, 0x21F970DB), LIMB_PAIR(0xC3ED4C62, 0xDA9234B7), LIMB_PAIR(0x7BEE093E, 0x5E72365C)
+        },
+        {   // 6 * 16^48 * B
+            LIMB_PAIR(0x2F08B33E, 0x7D933906), LIMB_PAIR(0xDF9F32BE, 0x5B9659E5), LIMB_PAIR(0x1F9EBDFD, 0xACFF3DAD), LIMB_PAIR(0xCB7349B7, 0x70B20555),
+            LIMB_PAIR(0x4571217F, 0x575BFC07), LIMB_PAIR(0x0694D95B, 0x3779675D), LIMB_PAIR(0xF4191E33, 0x9A0A37BB), LIMB_PAIR(0x47B4EABC, 0x77F1104C),
+            LIMB_PAIR(0x55112C4C, 0xBE5113C5), LIMB_PAIR(0x9A881FCD, 0x6688423A), LIMB_PAIR(0x5E503B47, 0x44667785), LIMB_PAIR(0x4A06404A, 0x0E34398F)
+        },
+        {   // 7 * 16^48 * B
+            LIMB_PAIR(0x3E4B1928, 0x18930B09), LIMB_PAIR(0x73F3F640, 0x7DE3E10E), LIMB_PAIR(0x73395D6F, 0xF43217DA), LIMB_PAIR(0xCA379C3E, 0x6F8ADED6),
+            LIMB_PAIR(0x3ECEBDE8, 0xB67D22D9), LIMB_PAIR(0x27822F07, 0x09B3E841), LIMB_PAIR(0xB05B6D8D, 0x743FA61F), LIMB_PAIR(0x8A362372, 0x5E540536),
+            LIMB_PAIR(0xFDB7B29A, 0xE340123D), LIMB_PAIR(0xA21AB291, 0x487B97E1), LIMB_PAIR(0xFDE6949E, 0xF9967D02), LIMB_PAIR(0xC8D3DE97, 0x780DE72E)
+        },
+        {   // 8 * 16^48 * B
+            LIMB_PAIR(0x00F42772, 0x671FEAF3), LIMB_PAIR(0x2A8C41AA, 0x8F72EB2A), LIMB_PAIR(0x97373292, 0x29A17FD7), LIMB_PAIR(0x32B587A6, 0x1DEFC6AD),
+            LIMB_PAIR(0x089AE7BC, 0x0AE28545), LIMB_PAIR(0x1C7F4D06, 0x388DDECF), LIMB_PAIR(0x0A4811B8, 0x38AC1551), LIMB_PAIR(0x71928CE4, 0x0EB28BF6),
+            LIMB_PAIR(0xEF5195A7, 0xAF5BBE1A), LIMB_PAIR(0x917B15ED, 0x148C1277), LIMB_PAIR(0x7AE5DA2E, 0x2991F7FB), LIMB_PAIR(0xF8DD2867, 0x467D201B)
+        }
+    },
+#endif
+#if (49 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^49 * B
+            LIMB_PAIR(0x296BC318, 0x745F9D56), LIMB_PAIR(0xD8152E65, 0x993580D4), LIMB_PAIR(0x5839E9CE, 0xB0E5B13F), LIMB_PAIR(0xD43921C0, 0x51FC2B28),
+            LIMB_PAIR(0xF7BD2E6B, 0x7906EE72), LIMB_PAIR(0x109ABF4E, 0x05D270D6), LIMB_PAIR(0xB941A8A4, 0x8D5CFE45), LIMB_PAIR(0x1C974287, 0x44C21867),
+            LIMB_PAIR(0x95E2A98C, 0x1B8FD117), LIMB_PAIR(0x2B6B6291, 0x1C4E5EE1), LIMB_PAIR(0x7424B572, 0x5B30E710), LIMB_PAIR(0x4C4F4AC6, 0x6E6B9DE8)
+        },
+        {   // 2 * 16^49 * B
+            LIMB_PAIR(0xF80CB088, 0x6B7C5F10), LIMB_PAIR(0x56E42151, 0x736B54DC), LIMB_PAIR(0xC6EF99C4, 0xC2B620A5), LIMB_PAIR(0xC3A06F42, 0x5F4C802C),
+            LIMB_PAIR(0x4B1DE151, 0xDFF25FCE), LIMB_PAIR(0xE11C4025, 0xD841C0C7), LIMB_PAIR(0x54749C87, 0x2554B3C8), LIMB_PAIR(0x908E0DF9, 0x2D292459),
+            LIMB_PAIR(0x7D0752DA, 0x9B65C8F1), LIMB_PAIR(0xC77EE800, 0x881CE338), LIMB_PAIR(0x5B62F9E3, 0xC3B514F0), LIMB_PAIR(0xBEC10D48, 0x66ED5DD5)
+        },
+        {   // 3 * 16^49 * B
+            LIMB_PAIR(0xCBCA047D, 0xF0ADF3C9), LIMB_PAIR(0xF4552F6B, 0x81C3B2CB), LIMB_PAIR(0x44735F93, 0xCFDA112D), LIMB_PAIR(0x7E20048C, 0x1F23A0C7),
+            LIMB_PAIR(0x0BB2089D, 0x7D38A1C2), LIMB_PAIR(0x96CCD412, 0x808334E1), LIMB_PAIR(0x6C97D313, 0xC4A70B8C), LIMB_PAIR(0x03007F20, 0x2EACF8BC),
+            LIMB_PAIR(0xE5BC1570, 0xF235467B), LIMB_PAIR(0x0DBAB38C, 0x03D2D902), LIMB_PAIR(0xFCF9E09E, 0x27529AA2), LIMB_PAIR(0x9D34BC50, 0x0840BEF2)
+        },
+        {   // 4 * 16^49 * B
+            LIMB_PAIR(0x7F37E4EB, 0xCD54E06B), LIMB_PAIR(0xF5E96CCA, 0x8CC15F87), LIMB_PAIR(0xD3597DCE, 0xB8248BB0), LIMB_PAIR(0x6074400C, 0x246AFFA0),
+            LIMB_PAIR(0xDC10B287, 0x796DFB35), LIMB_PAIR(0x5C7FF29D, 0x27176BCD), LIMB_PAIR(0xC7B24905, 0x7F3D43E8), LIMB_PAIR(0x91C54276, 0x0304F5A1),
+            LIMB_PAIR(0xFBE45321, 0x37D88E68), LIMB_PAIR(0xC0D75032, 0x86097548), LIMB_PAIR(0x894A0D35, 0x4E9B13EF), LIMB_PAIR(0x5753D325, 0x25A83CAC)
+        },
+        {   // 5 * 16^49 * B
+            LIMB_PAIR(0x3952B6E2, 0x9F0F6629), LIMB_PAIR(0x0934267B, 0x33DB5E0E), LIMB_PAIR(0xD609FEDC, 0xFF45252B), LIMB_PAIR(0xC506E0C9, 0x06BE10F5),
+            LIMB_PAIR(0xEED8165E, 0x10222F48), LIMB_PAIR(0x4B8BCF3A, 0x623FC123), LIMB_PAIR(0xC221E8F0, 0x1E145C09), LIMB_PAIR(0xCA782630, 0x7CCFA59F),
+            LIMB_PAIR(0xB62A345F, 0x1A9615A9), LIMB_PAIR(0x4A52FECC, 0x22050C56), LIMB_PAIR(0x28BC0DFE, 0xA7A27885), LIMB_PAIR(0x1A1EE71D, 0x5E82770A)
+        },
+        {   // 6 * 16^49 * B
+            LIMB_PAIR(0x42339C74, 0xE802E80A), LIMB_PAIR(0xA7FFFAE5, 0x34175166), LIMB_PAIR(0x1C408CAE, 0x34865D1F), LIMB_PAIR(0x605BC5EE, 0x2CCA982C),
+            LIMB_PAIR(0xAD896A5C, 0x35425183), LIMB_PAIR(0xE78D52F6, 0xE8673AFB), LIMB_PAIR(0x92A35F64, 0x2C66F25F), LIMB_PAIR(0x3B86B102, 0x09D04F3B),
+            LIMB_PAIR(0x197DBE6E, 0xFD2D5D35), LIMB_PAIR(0x8BE4FFA3, 0x207C2EEA), LIMB_PAIR(0x325AE918, 0x2613D8DB), LIMB_PAIR(0x27741D3E, 0x7A325D17)
+        },
+        {   // 7 * 16^49 * B
+            LIMB_PAIR(0x7E2A076A, 0xECD27D01), LIMB_PAIR(0x1636495E, 0xD788689F), LIMB_PAIR(0x919233E5, 0x52A61AF0), LIMB_PAIR(0x7BB1AE64, 0x2A479DF1),
+            LIMB_PAIR(0xD16DFDE2, 0xD036B9BB), LIMB_PAIR(0xC497A829, 0xA2055757), LIMB_PAIR(0xA7F12667, 0x8E6CC966), LIMB_PAIR(0x1239C180, 0x4D3B1A79),
+            LIMB_PAIR(0x33DB2710, 0x9E5EEE8E), LIMB_PAIR(0xD6C43CA5, 0x189854DE), LIMB_PAIR(0x92718138, 0xA41C22C5), LIMB_PAIR(0xA43A5E9B, 0x27AD5538)
+        },
+        {   // 8 * 16^49 * B
+            LIMB_PAIR(0x8E47077C, 0xCB5A7D63), LIMB_PAIR(0x20A1C059, 0x8DB75361), LIMB_PAIR(0x8BEDFDCC, 0x549E1E4D), LIMB_PAIR(0x503B179D, 0x080153B7),
+            LIMB_PAIR(0x15350D61, 0x2746DD4B), LIMB_PAIR(0xEE9521B7, 0xD03FCBC8), LIMB_PAIR(0x138672CA, 0xE86E365A), LIMB_PAIR(0x7E7D89E2, 0x510E987F),
+            LIMB_PAIR(0x0A3ED3E3, 0xDDA69D93), LIMB_PAIR(0xCD60A722, 0x3D386EF1), LIMB_PAIR(0xBDAA4EE6, 0xC817AD58), LIMB_PAIR(0x4FE7372A, 0x23BE8D55)
+        }
+    },
+#endif
+#if (50 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^50 * B
+            LIMB_PAIR(0x567AE7A9, 0xBC1EF4BD), LIMB_PAIR(0xD64498BD, 0x3F624CB2), LIMB_PAIR(0x2C1F4EC8, 0xE41064D2), LIMB_PAIR(0xBA384001, 0x2EF9C5A5),
+            LIMB_PAIR(0x74EF4FAD, 0x95FE919A), LIMB_PAIR(0xF6A308A2, 0x3A827BEC), LIMB_PAIR(0x09A47B01, 0x964E01D3), LIMB_PAIR(0x5BA3C797, 0x71C43C4F),
+            LIMB_PAIR(0xFA9E74CD, 0xB6FD6DF6), LIMB_PAIR(0xE4AF267A, 0xF18278BC), LIMB_PAIR(0xF1EF990E, 0x8255B3D0), LIMB_PAIR(0x90C5F293, 0x5A758CA3)
+        },
+        {   // 2 * 16^50 * B
+            LIMB_PAIR(0x1D61DC94, 0x8CE0918B), LIMB_PAIR(0x9A813066, 0x8DED3646), LIMB_PAIR(0xAFE8AAD3, 0xD4E6A829), LIMB_PAIR(0xF639D43F, 0x0A738027),
+            LIMB_PAIR(0xD9462495, 0xA2B72710), LIMB_PAIR(0xD57D5003, 0x3AA8C6D2), LIMB_PAIR(0xA0B487CA, 0xE3D400BF), LIMB_PAIR(0xB3EB72EC, 0x2DBAE244),
+            LIMB_PAIR(0x57FFE1CC, 0x980F4A2F), LIMB_PAIR(0xE1839843, 0x00670D0D), LIMB_PAIR(0x49FB15FD, 0x105C3F4A), LIMB_PAIR(0x5126A69C, 0x2698CA63)
+        },
+        {   // 3 * 16^50 * B
+            LIMB_PAIR(0x5E3DD90E, 0x2E3D702F), LIMB_PAIR(0xE4D25386, 0x9E3F0918), LIMB_PAIR(0x024DA96A, 0x5E773EF6), LIMB_PAIR(0x4AFA3332, 0x3C004B0C),
+            LIMB_PAIR(0x32B0BA78, 0xE7653188), LIMB_PAIR(0x925CFF8B, 0x381831F7), LIMB_PAIR(0xA0291FCC, 0x08A81B91), LIMB_PAIR(0x49CAEB07, 0x1FB43DCC),
+            LIMB_PAIR(0x06F4B82B, 0x9AA946AC), LIMB_PAIR(0xA806C4F3, 0x1CA284A5), LIMB_PAIR(0xC6CD4787, 0x3ED3265F), LIMB_PAIR(0xCD1FD217, 0x6B43FD01)
+        },
+        {   // 4 * 16^50 * B
+            LIMB_PAIR(0x3E760EF3, 0xB5C74258), LIMB_PAIR(0xEE0AB990, 0x75DC52B9), LIMB_PAIR(0x072B923F, 0xBF1427C2), LIMB_PAIR(0x6FF0D9F0, 0x73420B2D),
+            LIMB_PAIR(0x4697C544, 0xC7A75D4B), LIMB_PAIR(0xDF0FFFBF, 0x15FDF848), LIMB_PAIR(0xAA46785A, 0x2868B9EB), LIMB_PAIR(0x5B52F714, 0x5A68D710),
+            LIMB_PAIR(0x9E851E06, 0xAF2CF6CB), LIMB_PAIR(0xC62238C4, 0x8F593913), LIMB_PAIR(0x99FBF373, 0xDA8AB896), LIMB_PAIR(0xEA34BC9E, 0x3DB5632F)
+        },
+        {   // 5 * 16^50 * B
+            LIMB_PAIR(0x829825D5, 0x2E4990B1), LIMB_PAIR(0x3E9A8991, 0xEDEAEB87), LIMB_PAIR(0x4C704AF8, 0xEEF03D39), LIMB_PAIR(0x95DF2B0E, 0x59197EA4),
+            LIMB_PAIR(0xF75DD9D8, 0xF46EEE2B), LIMB_PAIR(0x396759A5, 0x0D17B1F6), LIMB_PAIR(0x499E7273, 0x1BF2D131), LIMB_PAIR(0x49D75F13, 0x04321ADF),
+            LIMB_PAIR(0xE4E55AAE, 0x04E16019), LIMB_PAIR(0x7E2F92E9, 0xE77B437A), LIMB_PAIR(0x6F159AA4, 0xC7CE2DC1), LIMB_PAIR(0xF4D70CC0, 0x45EAFDC1)
+        },
+        {   // 6 * 16^50 * B
+            LIMB_PAIR(0xCFCCB1ED, 0xB60E4624), LIMB_PAIR(0xBD5C0395, 0x59DBC292), LIMB_PAIR(0xDC0481C9, 0x31A09D1D), LIMB_PAIR(0x5D56D940, 0x3F73CEEA),
+            LIMB_PAIR(0x8045D72B, 0x69840185), LIMB_PAIR(0xCF2F0651, 0x4C22FAA2), LIMB_PAIR(0x6B222DC6, 0x941A3665), LIMB_PAIR(0x0362DADE, 0x5A5EEBC8),
+            LIMB_PAIR(0x0A4E8DC6, 0xB7A7BFD1), LIMB_PAIR(0x44C9B339, 0xBE57007E), LIMB_PAIR(0x1557AEFA, 0x60C1207F), LIMB_PAIR(0x266218DB, 0x26058891)
+        },
+        {   // 7 * 16^50 * B
+            LIMB_PAIR(0xC676E542, 0x4C818E3C), LIMB_PAIR(0x03CECCAD, 0x5E422C93), LIMB_PAIR(0xB4129F08, 0xEC07CCCA), LIMB_PAIR(0xB24443B8, 0x0DEDFA10),
+            LIMB_PAIR(0x8360FF04, 0x59F704A6), LIMB_PAIR(0x7661E6F4, 0xC3D93FDE), LIMB_PAIR(0x12873551, 0x831B2A73), LIMB_PAIR(0x4E615D57, 0x54AD0C2E),
+            LIMB_PAIR(0xB82B522A, 0xEE3B67D5), LIMB_PAIR(0x9FA5C1EB, 0x36F16346), LIMB_PAIR(0x6EC19FD3, 0xA5B4D2F2), LIMB_PAIR(0xA77A9408, 0x62ECB2BA)
+        },
+        {   // 8 * 16^50 * B
+            LIMB_PAIR(0xAFB62874, 0x92072836), LIMB_PAIR(0x79E104A5, 0x5FCD5E85), LIMB_PAIR(0xC630A14A, 0x5AAD01AD), LIMB_PAIR(0x75663F98, 0x61913D50),
+            LIMB_PAIR(0x61152B3D, 0xE5ED7952), LIMB_PAIR(0x0EDDD7D1, 0x4962357D), LIMB_PAIR(0xB96B4C71, 0x7482C8D0), LIMB_PAIR(0xA966D8BE, 0x2E59F919),
+            LIMB_PAIR(0x1A3231DA, 0x0DC62D36), LIMB_PAIR(0x94200270, 0xFA475832), LIMB_PAIR(0x3F9594CE, 0x02D80151), LIMB_PAIR(0x31C05D5C, 0x3DDBC2A1)
+        }
+    },
+#endif
+#if (51 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^51 * B
+            LIMB_PAIR(0x004A35D1, 0xFB735AC2), LIMB_PAIR(0x3A6607C3, 0x31DE0F43), LIMB_PAIR(0xC528D599, 0x7B8591BF), LIMB_PAIR(0xF5BB050C, 0x55BE9A25),
+            LIMB_PAIR(0x4FFB81EF, 0x3F50A50A), LIMB_PAIR(0x3BF420BF, 0xB1E03509), LIMB_PAIR(0xC6AA2CD0, 0x9BAA8E1C), LIMB_PAIR(0xFA237A40, 0x32239861),
+            LIMB_PAIR(0x33DB3DBF, 0x0D005ACD), LIMB_PAIR(0x80AC35E2, 0x0111B37C), LIMB_PAIR(0x6F88EBEB, 0x4892D66C), LIMB_PAIR(0x6508FBCD, 0x770EADB1)
+        },
+        {   // 2 * 16^51 * B
+            LIMB_PAIR(0xA05071B9, 0xF1D3B681), LIMB_PAIR(0x3592FF3A, 0x2207659A), LIMB_PAIR(0x7881E40E, 0x5F016929), LIMB_PAIR(0x86BA374E, 0x16BEDD0E),
+            LIMB_PAIR(0x5E4E89DD, 0x8451F9E0), LIMB_PAIR(0xBC793937, 0xC06302FF), LIMB_PAIR(0x56A6495C, 0x5D227495), LIMB_PAIR(0xA05603FB, 0x09A6755C),
+            LIMB_PAIR(0x2C2737B5, 0x5ECCCC4F), LIMB_PAIR(0x2DCCB703, 0x43B79E0C), LIMB_PAIR(0x4EC43DF3, 0x33E008BC), LIMB_PAIR(0xF07566C0, 0x06C1B840)
+        },
+        {   // 3 * 16^51 * B
+            LIMB_PAIR(0x9B02805C, 0x69EE9E7F), LIMB_PAIR(0x547D1640, 0xCBFF828A), LIMB_PAIR(0xB2430968, 0x3D93A869), LIMB_PAIR(0x3FE26972, 0x46B7B8CD),
+            LIMB_PAIR(0xA388F877, 0x7688A5C6), LIMB_PAIR(0xDEB2B6AC, 0x02A96C14), LIMB_PAIR(0x1B8C2AF8, 0x64C9F343), LIMB_PAIR(0x54A1EED6, 0x36284355),
+            LIMB_PAIR(0xFE7EEBE0, 0xE9812086), LIMB_PAIR(0x2F515437, 0x4CBA6BE7), LIMB_PAIR(0x516EFAE9, 0x1D04168B), LIMB_PAIR(0x43982CB9, 0x5EA13910)
+        },
+        {   // 4 * 16^51 * B
+            LIMB_PAIR(0xD5D3B002, 0x6F2B3BE4), LIMB_PAIR(0x6A09C880, 0xAFEC33D9), LIMB_PAIR(0xA8BCC4CC, 0x035F73A4), LIMB_PAIR(0x4662198B, 0x22C5B928),
+            LIMB_PAIR(0xF4702EE1, 0x49125C9C), LIMB_PAIR(0x8B25B32D, 0x4520B71F), LIMB_PAIR(0x501FEF7E, 0x33193026), LIMB_PAIR(0xC8D2EB2B, 0x656D8997),
+            LIMB_PAIR(0x433D8939, 0xCB58C8FE), LIMB_PAIR(0x6A8D7E50, 0x89A0CB2E), LIMB_PAIR(0x09FBBE5A, 0x79CA9553), LIMB_PAIR(0xCD7FC106, 0x0C626616)
+        },
+        {   // 5 * 16^51 * B
+            LIMB_PAIR(0xFBF454B1, 0x8FDFC379), LIMB_PAIR(0xF1A4B771, 0x45A5A970), LIMB_PAIR(0xBAD35915, 0xAC921EF7), LIMB_PAIR(0xA81C2192, 0x42D088DC),
+            LIMB_PAIR(0x4879B61F, 0x1FFEB80A), LIMB_PAIR(0x4ADA21ED, 0x6396726E), LIMB_PAIR(0x368025BA, 0x33C7B093), LIMB_PAIR(0xF3C31788, 0x471AA0C6),
+            LIMB_PAIR(0xA0165199, 0x8FDA0F37), LIMB_PAIR(0xC8A0E343, 0x0ADADB77), LIMB_PAIR(0xC875E820, 0x20FBFDFC), LIMB_PAIR(0x0C2206E7, 0x1CF2BEA8)
+        },
+        {   // 6 * 16^51 * B
+            LIMB_PAIR(0x02C0412F, 0x982D6E1A), LIMB_PAIR(0xDB58E8FE, 0x90FA4C83), LIMB_PAIR(0xDCB18BC0, 0x01C2F5BC), LIMB_PAIR(0x216ABC66, 0x686E0C90),
+            LIMB_PAIR(0xB36202AC, 0xC2DDF1DE), LIMB_PAIR(0xD2E27AA5, 0x92A5FE09), LIMB_PAIR(0xFC09F1D3, 0x7D1648F6), LIMB_PAIR(0x13BC4959, 0x74C2CC05),
+            LIMB_PAIR(0xA54395A7, 0x1FADBADB), LIMB_PAIR(0xAE0DA66A, 0xB41A02A0), LIMB_PAIR(0xBBA37C07, 0xBF19F598), LIMB_PAIR(0xDE48430D, 0x6A12B8AC)
+        },
+        {   // 7 * 16^51 * B
+            LIMB_PAIR(0x1AAEEB5F, 0x793BDD80), LIMB_PAIR(0xC1518871, 0x00A2A0AA), LIMB_PAIR(0x1F2136B4, 0xE8A373A3), LIMB_PAIR(0xFC91EF19, 0x48AAB888),
+            LIMB_PAIR(0x39D495D9, 0xF8DAEA1F), LIMB_PAIR(0x525F1DFC, 0x592C190E), LIMB_PAIR(0xC9991D1B, 0xDB8CBD04), LIMB_PAIR(0xD88F0CB7, 0x11F7FDA3),
+            LIMB_PAIR(0x5830F40E, 0x041F7E92), LIMB_PAIR(0x79661C06, 0x002D6CA9), LIMB_PAIR(0x2B046A2E, 0x86DC9FF9), LIMB_PAIR(0x8B0493D1, 0x76036092)
+        },
+        {   // 8 * 16^51 * B
+            LIMB_PAIR(0x695A0B05, 0xB43108E5), LIMB_PAIR(0xAD37A38B, 0x6CB00EE8), LIMB_PAIR(0xA3537381, 0x5EDAD6EE), LIMB_PAIR(0xB6DC3224, 0x3F2602D4),
+            LIMB_PAIR(0x120CF9C6, 0x21BB41C6), LIMB_PAIR(0xDECDA59B, 0xEAB2AA12), LIMB_PAIR(0x0AA48B34, 0xC1A72D02), LIMB_PAIR(0xE87D3B68, 0x215D4D27),
+            LIMB_PAIR(0x5BCAF19C, 0xC8B247B6), LIMB_PAIR(0xB1B2C652, 0x49779DC3), LIMB_PAIR(0xD5ECE2E2, 0x89A180BB), LIMB_PAIR(0xCEC8E039, 0x13F098A3)
+        }
+    },
+#endif
+#if (52 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^52 * B
+            LIMB_PAIR(0x2796BB14, 0xF3AA57A2), LIMB_PAIR(0x9B07DA21, 0x883ABAB7), LIMB_PAIR(0x31A0391C, 0xE54BE218), LIMB_PAIR(0xD83205F9, 0x5EE7FB38),
+            LIMB_PAIR(0xCE5EC54B, 0x9ADC0FF9), LIMB_PAIR(0x8C2F130D, 0x039C2A6B), LIMB_PAIR(0xF0F89515, 0x028007C7), LIMB_PAIR(0xAC04B36B, 0x78968314),
+            LIMB_PAIR(0x41446A8E, 0x538DFDCB), LIMB_PAIR(0x434937F9, 0xA5ACFDA9), LIMB_PAIR(0x263C8C78, 0x46AF908D), LIMB_PAIR(0x9BCA0D09, 0x61D0633C)
+        },
+        {   // 2 * 16^52 * B
+            LIMB_PAIR(0xF8FC73DF, 0xADA328BC), LIMB_PAIR(0xA6F037FC, 0xEE84695D), LIMB_PAIR(0x38C2A909, 0x637FB4DB), LIMB_PAIR(0xF8067BDC, 0x5B23AC2D),
+            LIMB_PAIR(0xFFDB2566, 0x63744935), LIMB_PAIR(0x780B68BB, 0xC5BD6B89), LIMB_PAIR(0x553EEC03, 0x6F1B3280), LIMB_PAIR(0x47AED7F5, 0x6E965FD8),
+            LIMB_PAIR(0xEE80527B, 0x9AD2B953), LIMB_PAIR(0xFADE6D8D, 0xE88F19AA), LIMB_PAIR(0x150E82CF, 0x0E711704), LIMB_PAIR(0xDD95DEDC, 0x79B9BBB9)
+        },
+        {   // 3 * 16^52 * B
+            LIMB_PAIR(0x8E9F7374, 0xD1997DAE), LIMB_PAIR(0xCFBB0816, 0xA032A2F8), LIMB_PAIR(0x6D445F0A, 0xCD6CBA12), LIMB_PAIR(0x0ACCB834, 0x1BA81146),
+            LIMB_PAIR(0x6A3126C2, 0xEBB35540), LIMB_PAIR(0x68C8C393, 0xD26383A8), LIMB_PAIR(0xE5B97A82, 0x6C0C6429), LIMB_PAIR(0xC9FD2147, 0x5065F158),
+            LIMB_PAIR(0x0C429954, 0x708169FB), LIMB_PAIR(0xD76ECF67, 0xE14600AC), LIMB_PAIR(0x70E645BA, 0x2EAAB98A), LIMB_PAIR(0x58A4FAF2, 0x3981F39E)
+        },
+        {   // 4 * 16^52 * B
+            LIMB_PAIR(0x6DE66FDE, 0xC845DFA5), LIMB_PAIR(0x2C40483A, 0xE152A500), LIMB_PAIR(0xC7B4F632, 0xE9D2E163), LIMB_PAIR(0xDCBC1B65, 0x30F4452E),
+            LIMB_PAIR(0x59230A93, 0x18FB8A75), LIMB_PAIR(0x60E6F45D, 0x1D168F69), LIMB_PAIR(0x14A93CB5, 0x3A85A945), LIMB_PAIR(0x05ACD0FD, 0x38DC0837),
+            LIMB_PAIR(0xC5759740, 0x856D2782), LIMB_PAIR(0xF99CBECC, 0xFA134569), LIMB_PAIR(0xC0EA4E71, 0x8844FC73), LIMB_PAIR(0x593F2469, 0x632D9A1A)
+        },
+        {   // 5 * 16^52 * B
+            LIMB_PAIR(0xED0C84A7, 0xBF09FD11), LIMB_PAIR(0x0D9F693A, 0x63F07181), LIMB_PAIR(0x57CF8779, 0x21908C2D), LIMB_PAIR(0x8AF64BA2, 0x3A5A7DF2),
+            LIMB_PAIR(0xB807CBA6, 0xF6BB6B15), LIMB_PAIR(0xBC54F0D7, 0x1823C7DF), LIMB_PAIR(0x6E29670B, 0xBB1D9703), LIMB_PAIR(0x47ED4A57, 0x0B24F488),
+            LIMB_PAIR(0x511BEAC7, 0xDCDAD4BE), LIMB_PAIR(0xED26CCF2, 0xA4538075), LIMB_PAIR(0x005F9A65, 0xE19CFF9F), LIMB_PAIR(0x75481F63, 0x34FCF744)
+        },
+        {   // 6 * 16^52 * B
+            LIMB_PAIR(0x78CFAA98, 0xA5BB1DAB), LIMB_PAIR(0x190B72F2, 0x5CEDA267), LIMB_PAIR(0x0A92608E, 0x9309C911), LIMB_PAIR(0x2FB374B0, 0x0119A304),
+            LIMB_PAIR(0x789767CA, 0xC197E04C), LIMB_PAIR(0x38D9467D, 0xB8714DCB), LIMB_PAIR(0x83F95FA8, 0x55DE8882), LIMB_PAIR(0x4DFA63F7, 0x3D3BDC16),
+            LIMB_PAIR(0xE8C2177D, 0x67A2D89C), LIMB_PAIR(0x6895D0C1, 0x669DA5F6), LIMB_PAIR(0xB282A2B0, 0xF56598E5), LIMB_PAIR(0xEDE20A73, 0x56C088F1)
+        },
+        {   // 7 * 16^52 * B
+            LIMB_PAIR(0x24F38F02, 0x581B5FAC), LIMB_PAIR(0xBAE30CBD, 0xA90BE9FE), LIMB_PAIR(0x8ACF92F0, 0x9A216902), LIMB_PAIR(0x8359038F, 0x038B7EA4),
+            LIMB_PAIR(0x10A86E17, 0x336D3D11), LIMB_PAIR(0x0B75B2FA, 0xD7F38832), LIMB_PAIR(0x25072988, 0xF9153376), LIMB_PAIR(0x99108B87, 0x09674C6B),
+            LIMB_PAIR(0x99316FF8, 0x9F4EF821), LIMB_PAIR(0xEAA78D4F, 0x2F49D282), LIMB_PAIR(0x5AEF3174, 0x0971A5AB), LIMB_PAIR(0x5969EB65, 0x6E5E3102)
+        },
+        {   // 8 * 16^52 * B
+            LIMB_PAIR(0x63066222, 0x3304FB0E), LIMB_PAIR(0x87ACBA3F, 0xFB350689), LIMB_PAIR(0x8C1061A3, 0xBD192477), LIMB_PAIR(0xD1838620, 0x3058AD43),
+            LIMB_PAIR(0x87E593FB, 0xB16C62F5), LIMB_PAIR(0xCA5D3E71, 0x4999EDDE), LIMB_PAIR(0x14CC3E6D, 0xB491C1E0), LIMB_PAIR(0x89A8DBA8, 0x08F51147),
+            LIMB_PAIR(0xE57663D0, 0x323C0FFD), LIMB_PAIR(0xA22EA610, 0x05C3DF38), LIMB_PAIR(0xAC994F9A, 0xBDC78ABD), LIMB_PAIR(0xEFE3DC99, 0x26549FA4)
+        }
+    },
+#endif
+#if (53 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^53 * B
+            LIMB_PAIR(0xF75396B9, 0x04DBBC17), LIMB_PAIR(0xD2F86746, 0x69E6A2D7), LIMB_PAIR(0xF53EABC6, 0xC6409D99), LIMB_PAIR(0x332E25D2, 0x606175F6),
+            LIMB_PAIR(0x87CE8F89, 0x738B38D7), LIMB_PAIR(0x4179A88D, 0xB62658E2), LIMB_PAIR(0xF151316D, 0x30738C9C), LIMB_PAIR(0x727275C9, 0x49128C7F),
+            LIMB_PAIR(0xF540E7DD, 0x4021370E), LIMB_PAIR(0xA1F1D0A5, 0x0910D6F5), LIMB_PAIR(0x5B06B807, 0x4634AACD), LIMB_PAIR(0x6944F235, 0x6A39E635)
+        },
+        {   // 2 * 16^53 * B
+            LIMB_PAIR(0x74049E9D, 0x1DA19657), LIMB_PAIR(0x98FE352B, 0xFBCD6EA1), LIMB_PAIR(0xCC5236A6, 0xB1CBCD50), LIMB_PAIR(0x3F9846E2, 0x1F5EC83D),
+            LIMB_PAIR(0xDF90F3E7, 0x96CD5640), LIMB_PAIR(0xDBFA25EA, 0x6C3A760E), LIMB_PAIR(0x59E33CC4, 0x24F3EF09), LIMB_PAIR(0x530D2E58, 0x42889E7E),
+            LIMB_PAIR(0x328CCB75, 0x8EFB23C3), LIMB_PAIR(0xDD876EE9, 0xAF42A207), LIMB_PAIR(0x5DFAE796, 0x20FBDADC), LIMB_PAIR(0x06BF9F51, 0x241E246B)
+        },
+        {   // 3 * 16^53 * B
+            LIMB_PAIR(0x6280BBB8, 0x7EAAFC9A), LIMB_PAIR(0xF403D809, 0x22A70F12), LIMB_PAIR(0x1BFC8D20, 0x31CE40BB), LIMB_PAIR(0xE8BD53EE, 0x2BC65635),
+            LIMB_PAIR(0xAD6E98F6, 0x29E68E57), LIMB_PAIR(0x0B462065, 0x4C9260C8), LIMB_PAIR(0xA51EBB4B, 0x3F00862E), LIMB_PAIR(0xB38D9097, 0x5BC2C77F),
+            LIMB_PAIR(0xA96BAD93, 0xE8D5DC9F), LIMB_PAIR(0xDE1947DC, 0xE58FB17D), LIMB_PAIR(0x65185FA3, 0x681532EA), LIMB_PAIR(0x034A7830, 0x1FDD6C3B)
+        },
+        {   // 4 * 16^53 * B
+            LIMB_PAIR(0x2DD8F7A9, 0x9C13A6A5), LIMB_PAIR(0x3EFDCABF, 0x2DBB1F8C), LIMB_PAIR(0x5E08F7B5, 0x961E3240), LIMB_PAIR(0xBBE6C9E5, 0x48C8A121),
+            LIMB_PAIR(0x55DC18FE, 0x0A64E28C), LIMB_PAIR(0x3399EBDD, 0xE3DF9E99), LIMB_PAIR(0x70E2E652, 0x79AC4323), LIMB_PAIR(0x3AE4CC0E, 0x35FF7FC3),
+            LIMB_PAIR(0x59646445, 0xFC415A7C), LIMB_PAIR(0xC128B615, 0xD224B2D7), LIMB_PAIR(0x05FBB912, 0x6035C9C9), LIMB_PAIR(0x74429FAB, 0x42D7A912)
+        },
+        {   // 5 * 16^53 * B
+            LIMB_PAIR(0x933DA5BC, 0xA9A48947), LIMB_PAIR(0xC2E979EC, 0x4A58920E), LIMB_PAIR(0x13E5AC4C, 0x96D88000), LIMB_PAIR(0x4B48B147, 0x453692D7),
+            LIMB_PAIR(0xEAF72ED3, 0x4E6213E3), LIMB_PAIR(0x43ACD4E7, 0x6794981A), LIMB_PAIR(0x6EB508CB, 0xFF547CDE), LIMB_PAIR(0x10FCB532, 0x6FED19DD),
+            LIMB_PAIR(0xA8559C6F, 0xDD775D99), LIMB_PAIR(0xDF003E24, 0xF42A2140), LIMB_PAIR(0xDA928A66, 0x5223E229), LIMB_PAIR(0x6D38F22C, 0x063F46BA)
+        },
+        {   // 6 * 16^53 * B
+            LIMB_PAIR(0x37346921, 0x39843CB7), LIMB_PAIR(0x38C89447, 0xA747FB07), LIMB_PAIR(0xA245307E, 0xCB8D8031), LIMB_PAIR(0x6D82F068, 0x67810F8E),
+            LIMB_PAIR(0x5F536694, 0xD2D24289), LIMB_PAIR(0x42939B2C, 0xCA33A2C5), LIMB_PAIR(0xC7DDB95C, 0x986FADA6), LIMB_PAIR(0x2F712D5D, 0x5A152C04),
+            LIMB_PAIR(0xD2287DB4, 0x3EEB8FBC), LIMB_PAIR(0x01A03E93, 0x72C7D3A3), LIMB_PAIR(0xBD98265A, 0x5473E88C), LIMB_PAIR(0x5921B403, 0x7324AA51)
+        },
+        {   // 7 * 16^53 * B
+            LIMB_PAIR(0xE82354CB, 0xAD23F6DA), LIMB_PAIR(0xB6571A6D, 0x6962502A), LIMB_PAIR(0xE38E37D1, 0x9B651636), LIMB_PAIR(0xD1A3312F, 0x5CAC5005),
+            LIMB_PAIR(0x6C3CBE8E, 0x857942F4), LIMB_PAIR(0x4730C046, 0xA1D364B1), LIMB_PAIR(0xD23C41BF, 0x1C8ED914), LIMB_PAIR(0xEEF6D5D2, 0x0838E161),
+            LIMB_PAIR(0xE9E39904, 0x8CC154CC), LIMB_PAIR(0x84DE6846, 0x5B3A040B), LIMB_PAIR(0xB1BE5D6E, 0xC4D8A61C), LIMB_PAIR(0xD8861F02, 0x40FB897B)
+        },
+        {   // 8 * 16^53 * B
+            LIMB_PAIR(0x5AB10761, 0xE57ED847), LIMB_PAIR(0x6FD13746, 0x71435E20), LIMB_PAIR(0xCD025632, 0x342F824E), LIMB_PAIR(0xA8791E7B, 0x4B16281E),
+            LIMB_PAIR(0x62DE37A1, 0x84C5AA90), LIMB_PAIR(0x0D1D96E1, 0x421DA500), LIMB_PAIR(0x6A9242D9, 0x78828630), LIMB_PAIR(0x690D10DA, 0x3C5E464A),
+            LIMB_PAIR(0x0B813381, 0xD1C101D5), LIMB_PAIR(0x76EE6828, 0xDEE60F11), LIMB_PAIR(0x383F6409, 0x0CB68893), LIMB_PAIR(0xF6FF484A, 0x6183C565)
+        }
+    },
+#endif
+#if (54 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^54 * B
+            LIMB_PAIR(0xAF3F666E, 0xDB468549), LIMB_PAIR(0xF14A0EA5, 0xD77FCF04), LIMB_PAIR(0xA4BA0C47, 0x3DF23FF7), LIMB_PAIR(0x32CE3C85, 0x3A10DFE1),
+            LIMB_PAIR(0x1E6BF9D6, 0x741D5A46), LIMB_PAIR(0x7777A581, 0x2305B3FC), LIMB_PAIR(0x6474D3D9, 0xD45574A2), LIMB_PAIR(0x6401E0FF, 0x1926E1DC),
+            LIMB_PAIR(0xEA17CEA0, 0xE07F4E8A), LIMB_PAIR(0x3A1FC1FD, 0x2FD51546), LIMB_PAIR(0x31F2C0F1, 0x175322FD), LIMB_PAIR(0x861E5D15, 0x1FA1D01D)
+        },
+        {   // 2 * 16^54 * B
+            LIMB_PAIR(0xD1DF94AB, 0x38DCAC00), LIMB_PAIR(0xD1080DE9, 0x2E712BDD), LIMB_PAIR(0xFDD5E262, 0x7F13E93E), LIMB_PAIR(0xEE9A01E5, 0x73FCED18),
+            LIMB_PAIR(0x7D599832, 0xCC805594), LIMB_PAIR(0x37F15520, 0x1E4656DA), LIMB_PAIR(0x4E059320, 0x99F6F774), LIMB_PAIR(0x6A75CF33, 0x773563BC),
+            LIMB_PAIR(0x63139CB3, 0x06B1E908), LIMB_PAIR(0xC5A03ECD, 0xA493DA67), LIMB_PAIR(0xAD638932, 0x8D77CEC8), LIMB_PAIR(0x1B864F44, 0x1F426B70)
+        },
+        {   // 3 * 16^54 * B
+            LIMB_PAIR(0x91A12552, 0xF17E35C8), LIMB_PAIR(0x575E9C76, 0xB76B8153), LIMB_PAIR(0x0D9B723E, 0xFA83406F), LIMB_PAIR(0x3FA7E438, 0x0B76BB1B),
+            LIMB_PAIR(0x41911C01, 0xEFC9264C), LIMB_PAIR(0x17A22C25, 0xF1A3B7B8), LIMB_PAIR(0xF30F1447, 0x5875DA6B), LIMB_PAIR(0x1D31B090, 0x4E1AF527),
+            LIMB_PAIR(0x7F92939B, 0x08B8C1F9), LIMB_PAIR(0xD444AB6E, 0xBE6771CB), LIMB_PAIR(0x99BB8017, 0x22E56463), LIMB_PAIR(0xB772A955, 0x7B6DD61E)
+        },
+        {   // 4 * 16^54 * B
+            LIMB_PAIR(0xAB01D2C7, 0x5730ABF9), LIMB_PAIR(0x40143B18, 0x16FB76DC), LIMB_PAIR(0xA0CBB281, 0x866CBE65), LIMB_PAIR(0x9BFF6AFE, 0x53FA9B65),
+            LIMB_PAIR(0x50F33D92, 0xB7ADC1E8), LIMB_PAIR(0x608CD5CF, 0x7998FA4F), LIMB_PAIR(0x8DFC5BDB, 0xAD962DBD), LIMB_PAIR(0xAF1D2F4F, 0x703E9BCE),
+            LIMB_PAIR(0x94885455, 0x6C14C8E9), LIMB_PAIR(0x65AED4E5, 0x843A5D66), LIMB_PAIR(0xBCD65AF1, 0x181BB73E), LIMB_PAIR(0xC4C61F50, 0x398D93E5)
+        },
+        {   // 5 * 16^54 * B
+            LIMB_PAIR(0xD2E7E3F2, 0xC3877C60), LIMB_PAIR(0x30828BB1, 0x3B34AAA0), LIMB_PAIR(0x739EF138, 0x283E26E7), LIMB_PAIR(0x02C30577, 0x699C9C90),
+            LIMB_PAIR(0x33E248F3, 0x1C4BD167), LIMB_PAIR(0x15BF0A5F, 0xBD9E1287), LIMB_PAIR(0xA10B0376, 0xD43F8CF0), LIMB_PAIR(0xDF191B13, 0x53B09B5D),
+            LIMB_PAIR(0x5946F1CC, 0xF306A723), LIMB_PAIR(0xCCE5D97D, 0x921718B5), LIMB_PAIR(0x81B4E975, 0x28CDD247), LIMB_PAIR(0x6FCDD907, 0x51CAF30C)
+        },
+        {   // 6 * 16^54 * B
+            LIMB_PAIR(0x18AC54C7, 0x737AF99A), LIMB_PAIR(0xC51CB30F, 0x903378DC), LIMB_PAIR(0x4CE10CC7, 0x2B89BC33), LIMB_PAIR(0x89F8E99A, 0x12AE29C1),
+            LIMB_PAIR(0x7674E00A, 0xA60BA742), LIMB_PAIR(0xA17A7BF3, 0x630E8570), LIMB_PAIR(0xCF3324CC, 0x3758563D), LIMB_PAIR(0x2383FDAA, 0x5504AA29),
+            LIMB_PAIR(0x1F0D01CF, 0xA99EC0CB), LIMB_PAIR(0x3A34F7AE, 0x0DD1EFCC), LIMB_PAIR(0xD09C4E22, 0x55CA7521), LIMB_PAIR(0x58EBA5EA, 0x5FD14FE9)
+        },
+        {   // 7 * 16^54 * B
+            LIMB_PAIR(0xBF93CB8E, 0x3C42FE5E), LIMB_PAIR(0x36D4565F, 0xBEDFA851), LIMB_PAIR(0x884220E8, 0xE0F0859E), LIMB_PAIR(0x0725D128, 0x7DD73F96),
+            LIMB_PAIR(0x2845AB2C, 0xB5DC2DDF), LIMB_PAIR(0x0A7FE993, 0x069491B1), LIMB_PAIR(0x4002E346, 0x4DAAF3D6), LIMB_PAIR(0x586474D1, 0x093FF26E),
+            LIMB_PAIR(0x68059829, 0xB10D24FE), LIMB_PAIR(0xDBAF23E5, 0x75730672), LIMB_PAIR(0xB457AC29, 0x1367253A), LIMB_PAIR(0x86B470A4, 0x2F59BCBC)
+        },
+        {   // 8 * 16^54 * B
+            LIMB_PAIR(0xB691C301, 0x7041D560), LIMB_PAIR(0xADD7E71E, 0x85201B3F), LIMB_PAIR(0x11335585, 0x16C2E163), LIMB_PAIR(0x010828B1, 0x2AA55E3D),
+            LIMB_PAIR(0x9917135F, 0x83847D42), LIMB_PAIR(0x567D03D7, 0xAD1B911F), LIMB_PAIR(0xBE77AAD1, 0x7E7748D9), LIMB_PAIR(0x2E51AF4A, 0x5458B42E),
+            LIMB_PAIR(0x0C07444F, 0xED5192E6), LIMB_PAIR(0x74421D10, 0x42C54E2D), LIMB_PAIR(0xFDB5C864, 0x352B4C82), LIMB_PAIR(0x8A768664, 0x13E9004A)
+        }
+    },
+#endif
+#if (55 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^55 * B
+            LIMB_PAIR(0x806B467C, 0x1E6284C5), LIMB_PAIR(0xE75D607B, 0xC5F6997B), LIMB_PAIR(0xB378D262, 0x8B67D958), LIMB_PAIR(0x81CD8B70, 0x3D88D66A),
+            LIMB_PAIR(0x6C032BFF, 0xCBB5B555), LIMB_PAIR(0x29297A3A, 0xDF7191B7), LIMB_PAIR(0xADED81BB, 0xC1FF7326), LIMB_PAIR(0x68BE03F5, 0x71ADE8BB),
+            LIMB_PAIR(0x204ED789, 0x8B767A93), LIMB_PAIR(0x9FA0AE2A, 0x762FCACB), LIMB_PAIR(0x6DCE4887, 0x771FEBCC), LIMB_PAIR(0x8FF05FB3, 0x34306215)
+        },
+        {   // 2 * 16^55 * B
+            LIMB_PAIR(0x2A7B31B4, 0xFCE21907), LIMB_PAIR(0xAA578016, 0x4D7ADC75), LIMB_PAIR(0x87479324, 0x0EC276A6), LIMB_PAIR(0x1FDA4BEB, 0x6D6D9D5D),
+            LIMB_PAIR(0xE1F5BF49, 0xE05DA1A7), LIMB_PAIR(0xD4736092, 0x26457D6D), LIMB_PAIR(0x73CC32F6, 0x77DCB077), LIMB_PAIR(0x9CDD5FCD, 0x0A5D9496),
+            LIMB_PAIR(0xE9B08183, 0x22B1A58A), LIMB_PAIR(0xC15C388B, 0xFD95D071), LIMB_PAIR(0x850A0517, 0xA9812376), LIMB_PAIR(0xBB7F335E, 0x33384CBA)
+        },
+        {   // 3 * 16^55 * B
+            LIMB_PAIR(0x26218B8D, 0x33BC627A), LIMB_PAIR(0xC7A80C61, 0xEA80B21F), LIMB_PAIR(0x173E9EE6, 0x9458B12B), LIMB_PAIR(0x0E2F3059, 0x076247BE),
+            LIMB_PAIR(0x0CA2C7B5, 0x3C6FA268), LIMB_PAIR(0x6FB64FDA, 0x1B508204), LIMB_PAIR(0x5431D6DE, 0xEB53349C), LIMB_PAIR(0x6B879C89, 0x5278B38F),
+            LIMB_PAIR(0x1416375A, 0x52E105F6), LIMB_PAIR(0x85ABEBA4, 0xEC97AF36), LIMB_PAIR(0x23A67C36, 0x26E6B506), LIMB_PAIR(0xF3D4FB01, 0x5CF0E856)
+        },
+        {   // 4 * 16^55 * B
+            LIMB_PAIR(0x3DB342A8, 0xBEAECE31), LIMB_PAIR(0x842DB7EE, 0xCBA3635B), LIMB_PAIR(0x817F13EF, 0xE88C6620), LIMB_PAIR(0x4E76D5C6, 0x1B9438AA),
+            LIMB_PAIR(0x1AE8CAB4, 0xF6C96873), LIMB_PAIR(0xCB4F92C5, 0x5E20741E), LIMB_PAIR(0x8CCDBC3E, 0x2DA53BE5), LIMB_PAIR(0x69970DF7, 0x2DDDFEA2),
+            LIMB_PAIR(0x166F031A, 0x8A50777E), LIMB_PAIR(0x0FB7A328, 0x067B39F1), LIMB_PAIR(0x010FBD76, 0x1925C9A6), LIMB_PAIR(0xCC740905, 0x6DF9B575)
+        },
+        {   // 5 * 16^55 * B
+            LIMB_PAIR(0x48CADE41, 0xECDFC35B), LIMB_PAIR(0xB2328270, 0x6A88471F), LIMB_PAIR(0x40A01B6A, 0x740A4A24), LIMB_PAIR(0x003B5F29, 0x471E5796),
+            LIMB_PAIR(0x27F6BDCF, 0x42C11929), LIMB_PAIR(0x403D61CA, 0x8F91917A), LIMB_PAIR(0x8B9E1F61, 0xDC1C5A66), LIMB_PAIR(0x04EC0F8D, 0x15960478),
+            LIMB_PAIR(0xACED37AC, 0xDA96BBB3), LIMB_PAIR(0xE9208CEA, 0x7A2423B5), LIMB_PAIR(0x38AEBAE2, 0x24CC5C30), LIMB_PAIR(0xDC5DAE2F, 0x50C356AF)
+        },
+        {   // 6 * 16^55 * B
+            LIMB_PAIR(0x1B31B964, 0xCFED9CDF), LIMB_PAIR(0x8CA51AF3, 0xF486A985), LIMB_PAIR(0xEA8C1F84, 0x14897265), LIMB_PAIR(0x932ACC00, 0x784A53DD),
+            LIMB_PAIR(0x41C30318, 0x09DCBF43), LIMB_PAIR(0x83181DCE, 0xEEBA0611), LIMB_PAIR(0xDC1E29A1, 0xC179C0CE), LIMB_PAIR(0x073F35B0, 0x1DBF7B89),
+            LIMB_PAIR(0x14FC4920, 0x2D99F9DF), LIMB_PAIR(0xC4499FE5, 0x76CCB60C), LIMB_PAIR(0xE5CF0003, 0xA4132CBB), LIMB_PAIR(0x54F000EA, 0x3F93D823)
+        },
+        {   // 7 * 16^55 * B
+            LIMB_PAIR(0x79E14978, 0xEAAC12D1), LIMB_PAIR(0xBBEBFF5E, 0xFF923FF3), LIMB_PAIR(0x0663CE27, 0x4AF663E4), LIMB_PAIR(0x11A5F5FF, 0x0FD381A8),
+            LIMB_PAIR(0x9E04CE85, 0x8183E768), LIMB_PAIR(0x04465341, 0x678FB71E), LIMB_PAIR(0x6688EDAC, 0xAD92058F), LIMB_PAIR(0x532B099A, 0x5DA350D3),
+            LIMB_PAIR(0xA436DF54, 0xF256ACEC), LIMB_PAIR(0xAE69D6E8, 0x108B6168), LIMB_PAIR(0x6B5D036C, 0x20D986CB), LIMB_PAIR(0xFEE2AF50, 0x655957B9)
+        },
+        {   // 8 * 16^55 * B
+            LIMB_PAIR(0xD002D0AC, 0xBDC1409B), LIMB_PAIR(0xB5CCD9A6, 0x66660245), LIMB_PAIR(0xFADE85EC, 0x82317DC4), LIMB_PAIR(0x6AD7DF0D, 0x02FE934B),
+            LIMB_PAIR(0xA902030F, 0xAEA8B07F), LIMB_PAIR(0xF463D143, 0xF88C766A), LIMB_PAIR(0x3C787A60, 0x15B08366), LIMB_PAIR(0x8267A4A8, 0x08EAB114),
+            LIMB_PAIR(0xCFB7EA74, 0xEF5CF100), LIMB_PAIR(0xA1CB42AC, 0x22897633), LIMB_PAIR(0xCEF285E2, 0xD4CE0C54), LIMB_PAIR(0x8A146A55, 0x30408C04)
+        }
+    },
+#endif
+#if (56 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^56 * B
+            LIMB_PAIR(0x193B877F, 0xBB2E00C9), LIMB_PAIR(0xE0DC506B, 0xECE3A890), LIMB_PAIR(0x36DE649F, 0xECF3B7C0), LIMB_PAIR(0x98DE9E1A, 0x5F460408),
+            LIMB_PAIR(0x832FCEDB, 0x739D8845), LIMB_PAIR(0xAE6BF863, 0xFA38D6C9), LIMB_PAIR(0xB74FFEF7, 0x32BC0DCA), LIMB_PAIR(0x14BCE45E, 0x73937E88),
+            LIMB_PAIR(0x297BF48D, 0xB9037116), LIMB_PAIR(0xD4F06834, 0xA9D13B22), LIMB_PAIR(0x4696BDC6, 0xE1971557), LIMB_PAIR(0x91D5E835, 0x2CF8A4E8)
+        },
+        {   // 2 * 16^56 * B
+            LIMB_PAIR(0x17D06BA2, 0x2CB5487E), LIMB_PAIR(0x3950196B, 0x24D2381C), LIMB_PAIR(0x85978A30, 0xD7659C81), LIMB_PAIR(0x91D6A4F6, 0x7A6F7F28),
+            LIMB_PAIR(0x07110F67, 0x6D93FD87), LIMB_PAIR(0x7C38B549, 0xDD4C09D3), LIMB_PAIR(0xC2736A86, 0x7CB16A4C), LIMB_PAIR(0x58252A09, 0x2049BD6E),
+            LIMB_PAIR(0x6A9AEF49, 0x7D09FD8D), LIMB_PAIR(0x5B3DB90B, 0xF0EE60BE), LIMB_PAIR(0x519EBFD4, 0x4C21B52C), LIMB_PAIR(0xC545941D, 0x6011AADF)
+        },
+        {   // 3 * 16^56 * B
+            LIMB_PAIR(0x02CBF890, 0x63DED0C8), LIMB_PAIR(0x0DFF6AAA, 0xFBD098CA), LIMB_PAIR(0xB9B6ED99, 0x624D0AFD), LIMB_PAIR(0x79340B1E, 0x69CE18B7),
+            LIMB_PAIR(0xCF95F83C, 0x5F67926D), LIMB_PAIR(0x71289071, 0x7C7E8561), LIMB_PAIR(0x998F7A5B, 0xD6A1E7F3), LIMB_PAIR(0x0B62F9E0, 0x6FC5CC1B),
+            LIMB_PAIR(0xB29879CB, 0xD1EF5528), LIMB_PAIR(0xD47E9092, 0xDD1AAE3C), LIMB_PAIR(0x189F2352, 0x127E0442), LIMB_PAIR(0xE57101F1, 0x15596B3A)
+        },
+        {   // 4 * 16^56 * B
+            LIMB_PAIR(0x7E5124CA, 0x09FF3116), LIMB_PAIR(0xD9C745DF, 0x0BE4158B), LIMB_PAIR(0x7EF556E5, 0x292B7D22), LIMB_PAIR(0xAFB6D138, 0x3AA4E241),
+            LIMB_PAIR(0x3F9179A2, 0x462739D2), LIMB_PAIR(0x97D6DDCF, 0xFF831231), LIMB_PAIR(0x53F2148A, 0x1307DEB5), LIMB_PAIR(0x7B5F4DDA, 0x0D223768),
+            LIMB_PAIR(0x2A3305F5, 0x2CC138BF), LIMB_PAIR(0xA2E926C3, 0x48583F8F), LIMB_PAIR(0x5549D2EB, 0x083AB1A2), LIMB_PAIR(0x4687A36C, 0x32FCAA6E)
+        },
+        {   // 5 * 16^56 * B
+            LIMB_PAIR(0x2787CCDF, 0x3207A473), LIMB_PAIR(0xF213E3F8, 0x17E31908), LIMB_PAIR(0xF60D964E, 0xD5B2ECD7), LIMB_PAIR(0xC2600BE9, 0x746F6336),
+            LIMB_PAIR(0xC57D9AF5, 0x7BC56E8D), LIMB_PAIR(0x9DF0BDF2, 0x3E0BD2ED), LIMB_PAIR(0x22EFE4A3, 0xAAC014DE), LIMB_PAIR(0xFEBD6A5C, 0x4627E9CE),
+            LIMB_PAIR(0xAB6C971C, 0x3F4AF345), LIMB_PAIR(0x9943731F, 0xE288EB72), LIMB_PAIR(0x0344186D, 0x33596A8A), LIMB_PAIR(0x7ED66293, 0x7B491700)
+        },
+        {   // 6 * 16^56 * B
+            LIMB_PAIR(0xDD53A2DD, 0x54341B28), LIMB_PAIR(0xDF42FC3F, 0xAA17905B), LIMB_PAIR(0x4DD2F8F4, 0x0FF592D9), LIMB_PAIR(0xE08CD37D, 0x1D03620F),
+            LIMB_PAIR(0xAB84B064, 0x2D85FB5C), LIMB_PAIR(0x89F3BC14, 0x497810D2), LIMB_PAIR(0x7B15CE0C, 0x476ADC44), LIMB_PAIR(0xF844FD7B, 0x122BA376),
+            LIMB_PAIR(0xA2B4E554, 0xC20232CD), LIMB_PAIR(0x115D187F, 0x9ED0FD42), LIMB_PAIR(0x7DD479D9, 0x2EABB4BE), LIMB_PAIR(0x2B68EC4C, 0x02C70BF5)
+        },
+        {   // 7 * 16^56 * B
+            LIMB_PAIR(0x458D72E1, 0xACE532BF), LIMB_PAIR(0x7CB73CB5, 0x5BE768E0), LIMB_PAIR(0xEE8BBDE7, 0x56CF7D94), LIMB_PAIR(0xFEB43A03, 0x6B0697E3),
+            LIMB_PAIR(0x5D0B2FBB, 0xA287EC4B), LIMB_PAIR(0x074882CA, 0x415C5790), LIMB_PAIR(0xC1D0815C, 0xE044A61E), LIMB_PAIR(0x409EF5E0, 0x26334F0A),
+            LIMB_PAIR(0xDF62A3C0, 0xB6C8F04A), LIMB_PAIR(0x076DA45D, 0x3EF000EF), LIMB_PAIR(0x49F0D2A9, 0x9C9CB958), LIMB_PAIR(0x441B2FAE, 0x1CC37F43)
+        },
+        {   // 8 * 16^56 * B
+            LIMB_PAIR(0xC9CEAEB9, 0xD76656F1), LIMB_PAIR(0x18E5656A, 0x1C5B15F8), LIMB_PAIR(0x844C2334, 0x26E72832), LIMB_PAIR(0x2F196838, 0x3A346F77),
+            LIMB_PAIR(0x5CC7324F, 0x508F565A), LIMB_PAIR(0xE506A922, 0xD061C4C0), LIMB_PAIR(0x5C45AC19, 0xFB18ABDB), LIMB_PAIR(0x0380314A, 0x6C6809C1),
+            LIMB_PAIR(0xE2DA6AC8, 0xD2D55112), LIMB_PAIR(0xB1E851ED, 0xE9BD0331), LIMB_PAIR(0x8EC67262, 0x960746DD), LIMB_PAIR(0x6EF7C5D0, 0x05911B9F)
+        }
+    },
+#endif
+#if (57 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^57 * B
+            LIMB_PAIR(0xC5FE9F94, 0x01C18980), LIMB_PAIR(0x716FD5C8, 0xCD656769), LIMB_PAIR(0xD195A086, 0x816045C3), LIMB_PAIR(0x66CC7982, 0x6E2B7F32),
+            LIMB_PAIR(0xB637FF2D, 0xE9DCD756), LIMB_PAIR(0xC987F0C4, 0xEC4C348F), LIMB_PAIR(0xF3FBC7B7, 0xCED59285), LIMB_PAIR(0x93E1EA87, 0x33053547),
+            LIMB_PAIR(0xF7C3568F, 0xCC802468), LIMB_PAIR(0x19974CB3, 0x9DE9BA82), LIMB_PAIR(0xB5B81360, 0xABB7229C), LIMB_PAIR(0x6FBEBA62, 0x44E2017A)
+        },
+        {   // 2 * 16^57 * B
+            LIMB_PAIR(0xB6CA6ECD, 0x87F82CF3), LIMB_PAIR(0x18F4A0C2, 0x580F893E), LIMB_PAIR(0x2604E557, 0x05893007), LIMB_PAIR(0x56D19C1D, 0x6CAB6AC2),
+            LIMB_PAIR(0x54DAB774, 0xC4C2A743), LIMB_PAIR(0x4EAF031A, 0x8E5D4C3C), LIMB_PAIR(0x42838F17, 0xB76C23D2), LIMB_PAIR(0x68DCE4EA, 0x749A098F),
+            LIMB_PAIR(0x2CC1DE60, 0xDCDFE0A0), LIMB_PAIR(0x51C5575B, 0x032665FF), LIMB_PAIR(0x073ABEEB, 0x2C0C32F1), LIMB_PAIR(0xCD7B8606, 0x6A882014)
+        },
+        {   // 3 * 16^57 * B
+            LIMB_PAIR(0xAF4FEB6E, 0xD111D17C), LIMB_PAIR(0xB33AA4A3, 0x050BBA42), LIMB_PAIR(0xEEB46C30, 0x17514C3C), LIMB_PAIR(0x1BC27D75, 0x54BEDB8B),
+            LIMB_PAIR(0xA4747FB5, 0xA52A92FE), LIMB_PAIR(0x1FA5AB89, 0xDC12A449), LIMB_PAIR(0xB847A4CE, 0xD82DA94B), LIMB_PAIR(0x9512CC4E, 0x4D77EDCE),
+            LIMB_PAIR(0x77E2189C, 0x77C8E145), LIMB_PAIR(0xFF99C445, 0xA3E46F6A), LIMB_PAIR(0x6D335343, 0x3144DFC8), LIMB_PAIR(0x7C4216A9, 0x3A96559E)
+        },
+        {   // 4 * 16^57 * B
+            LIMB_PAIR(0x80BAAA52, 0x44938968), LIMB_PAIR(0xF285940E, 0x4C98AFC4), LIMB_PAIR(0xA45448B6, 0xEF4AA79B), LIMB_PAIR(0xA57AAE7F, 0x5278C510),
+            LIMB_PAIR(0xF42AD2EE, 0x12550D37), LIMB_PAIR(0x98A1FBF5, 0x8B78E004), LIMB_PAIR(0x33894CB2, 0x5D530782), LIMB_PAIR(0x3E498D0C, 0x02C84E4E),
+            LIMB_PAIR(0x294C0B94, 0xA54DD074), LIMB_PAIR(0xDF18FFB6, 0xF55D46B8), LIMB_PAIR(0x8DAE8366, 0xF06FECC5), LIMB_PAIR(0x8190D165, 0x58865766)
+        },
+        {   // 5 * 16^57 * B
+            LIMB_PAIR(0x3DE25CC3, 0xBF5834F0), LIMB_PAIR(0xD6815496, 0xB887C8AE), LIMB_PAIR(0x9481E892, 0x5105221A), LIMB_PAIR(0xF7723F93, 0x6760ED19),
+            LIMB_PAIR(0x1AEF7117, 0xD4771231), LIMB_PAIR(0x229E92C7, 0x50343101), LIMB_PAIR(0x9D159B97, 0x7A95E184), LIMB_PAIR(0x8B5D29C9, 0x2449959B),
+            LIMB_PAIR(0xAC35E160, 0x669BA3B7), LIMB_PAIR(0xBA842056, 0x2ECCF73F), LIMB_PAIR(0xC0804F07, 0x1AEC1F17), LIMB_PAIR(0x1856F4E7, 0x0D96BC03)
+        },
+        {   // 6 * 16^57 * B
+            LIMB_PAIR(0xCC7505E1, 0xB1D534B0), LIMB_PAIR(0x16C35288, 0x32CD0034), LIMB_PAIR(0x0762C29D, 0xCB36A580), LIMB_PAIR(0x237A0BF8, 0x5BFE69B9),
+            LIMB_PAIR(0x75C52D82, 0x3318BE77), LIMB_PAIR(0x54D0AAB9, 0x4CB764B5), LIMB_PAIR(0xCC773D91, 0xABCF3D27), LIMB_PAIR(0x8123288A, 0x3BF4D184),
+            LIMB_PAIR(0x78A151AB, 0x183EAB7E), LIMB_PAIR(0x99093763, 0xBBE990C9), LIMB_PAIR(0x4AC7E335, 0xFF717D6E), LIMB_PAIR(0x25F39F88, 0x4C5CDDB3)
+        },
+        {   // 7 * 16^57 * B
+            LIMB_PAIR(0xE7A9F902, 0x57750967), LIMB_PAIR(0x4F5B467E, 0x2C37FDFC), LIMB_PAIR(0x3177BA46, 0xB261663A), LIMB_PAIR(0xDC2D532B, 0x3A375E78),
+            LIMB_PAIR(0x6190A6EB, 0xC0F6B74D), LIMB_PAIR(0x2DB8F4E4, 0x20EA81A4), LIMB_PAIR(0x97315760, 0xA8BD6F7D), LIMB_PAIR(0x62AC7C21, 0x33B1D602),
+            LIMB_PAIR(0x2D4DDDEA, 0x8141E72F), LIMB_PAIR(0x62C607C8, 0xE6EAFE98), LIMB_PAIR(0x573CAFD0, 0x23C28458), LIMB_PAIR(0x4FF97346, 0x46B9476F)
+        },
+        {   // 8 * 16^57 * B
+            LIMB_PAIR(0x0D58359F, 0x1215505C), LIMB_PAIR(0xFC28C46B, 0x2A2013C7), LIMB_PAIR(0x89EA664E, 0x24A0A1AF), LIMB_PAIR(0xA1130E1F, 0x4400B638),
+            LIMB_PAIR(0x4F901E5C, 0x0C1FFEA4), LIMB_PAIR(0x2184B782, 0x2B0B6FB7), LIMB_PAIR(0x0114DB88, 0xE587FF91), LIMB_PAIR(0x4785A142, 0x37130F36),
+            LIMB_PAIR(0x96ED19C3, 0x3A01B764), LIMB_PAIR(0xED327230, 0x31E00AB0), LIMB_PAIR(0x83CA15B1, 0x520A8857), LIMB_PAIR(0x5ACCBEC7, 0x06AAB987)
+        }
+    },
+#endif
+#if (58 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^58 * B
+            LIMB_PAIR(0x512EEAEF, 0x5349ACF3), LIMB_PAIR(0x1CC1CB49, 0x20C141D3), LIMB_PAIR(0xA99A688D, 0x24180C07), LIMB_PAIR(0xC64B2D17, 0x555EF9D1),
+            LIMB_PAIR(0xF5DF0EBB, 0xC1339983), LIMB_PAIR(0x512C4CAC, 0xC0F3758F), LIMB_PAIR(0x0BB398E1, 0x2CF1130A), LIMB_PAIR(0xAA270C62, 0x6B3CECF9),
+            LIMB_PAIR(0x3B73BD08, 0x36A770BA), LIMB_PAIR(0xA3AFBF0C, 0x624AEF08), LIMB_PAIR(0xB40946F2, 0x5737FF98), LIMB_PAIR(0x3381749D, 0x675F4DE1)
+        },
+        {   // 2 * 16^58 * B
+            LIMB_PAIR(0x3BDAB31D, 0xA12FF6D9), LIMB_PAIR(0x9D652DFE, 0x0725D80F), LIMB_PAIR(0x9ABE9487, 0x019C4FF3), LIMB_PAIR(0x82CD3C43, 0x60F450B8),
+            LIMB_PAIR(0x6B1782FC, 0x0E2C5203), LIMB_PAIR(0x6CAD83B4, 0x64816C81), LIMB_PAIR(0x6964073E, 0xD0DCBDD9), LIMB_PAIR(0x0164C520, 0x13D99DF7),
+            LIMB_PAIR(0x21E5C0CA, 0x014B5EC3), LIMB_PAIR(0xD719BFA2, 0x4FCB69C9), LIMB_PAIR(0x750023A0, 0x4E5F1C18), LIMB_PAIR(0x55EDAC80, 0x1C06DE9E)
+        },
+        {   // 3 * 16^58 * B
+            LIMB_PAIR(0xFF6D69AA, 0xFFD52B40), LIMB_PAIR(0xDC4049BB, 0x34530B18), LIMB_PAIR(0xA34D9897, 0x5E4A5C2F), LIMB_PAIR(0x7D32BA2D, 0x78096F8E),
+            LIMB_PAIR(0xA33EC4E2, 0x990F7AD6), LIMB_PAIR(0xBE2EE08E, 0x6608F938), LIMB_PAIR(0x63284515, 0x9CA143C5), LIMB_PAIR(0xEC2DB60D, 0x4CF38A1F),
+            LIMB_PAIR(0x0DFA5CE7, 0xA0AAAA65), LIMB_PAIR(0x48B5478C, 0xF9C49E2A), LIMB_PAIR(0x7003725B, 0x4F09CC7D), LIMB_PAIR(0x26091ABE, 0x373CAD3A)
+        },
+        {   // 4 * 16^58 * B
+            LIMB_PAIR(0x89DDBBAD, 0xF1BEA8FB), LIMB_PAIR(0x61AEAECB, 0x3BCB2CBC), LIMB_PAIR(0x1F9B8D9D, 0x8F58A7BB), LIMB_PAIR(0x5112A686, 0x21547EDA),
+            LIMB_PAIR(0x82C9F57C, 0xB294634D), LIMB_PAIR(0x24934536, 0x1FCBFDE1), LIMB_PAIR(0x418CDB5A, 0x9E9C4DB3), LIMB_PAIR(0x454419FC, 0x0040F3D9),
+            LIMB_PAIR(0xFD5986D3, 0xDEFDE939), LIMB_PAIR(0x510A380C, 0xF4272C89), LIMB_PAIR(0xBB3119B9, 0xB72BA407), LIMB_PAIR(0x4A254DF4, 0x63550A33)
+        },
+        {   // 5 * 16^58 * B
+            LIMB_PAIR(0x72547B49, 0x9BBA5845), LIMB_PAIR(0xE2C408E0, 0xF305C6FA), LIMB_PAIR(0xC734F18D, 0x60E8FA69), LIMB_PAIR(0xAA7D767A, 0x39A92BAF),
+            LIMB_PAIR(0xB569CF37, 0x6507D6ED), LIMB_PAIR(0x0CA52EE1, 0x178429B0), LIMB_PAIR(0xEB6BD65D, 0xEA7C0090), LIMB_PAIR(0xDAF78F51, 0x3EEA62C7),
+            LIMB_PAIR(0xE693274E, 0x9D24C713), LIMB_PAIR(0x68DBD375, 0x5F638577), LIMB_PAIR(0xEB8AB39A, 0x70525560), LIMB_PAIR(0x65C9C4CD, 0x68436A06)
+        },
+        {   // 6 * 16^58 * B
+            LIMB_PAIR(0xE820107C, 0x1E56D317), LIMB_PAIR(0x840AE965, 0xC5266844), LIMB_PAIR(0x320FFC7A, 0xC1E0A1C6), LIMB_PAIR(0x91611472, 0x5373669C),
+            LIMB_PAIR(0x202F3F27, 0xBC0235E8), LIMB_PAIR(0x64F975B0, 0xC75C00E2), LIMB_PAIR(0xA38C2416, 0x91A4E9D5), LIMB_PAIR(0x8AB789F9, 0x17B6E7F6),
+            LIMB_PAIR(0x9A0E5257, 0x5D2814AB), LIMB_PAIR(0xC9CAB3FC, 0x908F2084), LIMB_PAIR(0x5B2D1ECA, 0xAFCAF588), LIMB_PAIR(0x78F87D11, 0x1CB4B5A6)
+        },
+        {   // 7 * 16^58 * B
+            LIMB_PAIR(0xA2A007E7, 0x6B74AA62), LIMB_PAIR(0xF071C7B1, 0xF311E0B0), LIMB_PAIR(0x000BE223, 0x5707E438), LIMB_PAIR(0x82EF6EAC, 0x2DC0FD2D),
+            LIMB_PAIR(0x394AFC6C, 0xB664C06B), LIMB_PAIR(0x98DA5FB1, 0x0C88DE24), LIMB_PAIR(0x4BCAD834, 0x4F8D0316), LIMB_PAIR(0xDE7434A2, 0x330BCA78),
+            LIMB_PAIR(0x1119744E, 0x982EFF84), LIMB_PAIR(0x2B074724, 0xF9695E96), LIMB_PAIR(0xBFC953FB, 0xC58AC14F), LIMB_PAIR(0x369F1CF5, 0x3C31BE1B)
+        },
+        {   // 8 * 16^58 * B
+            LIMB_PAIR(0xF9CB4272, 0xC168BC93), LIMB_PAIR(0xC7CEDB98, 0xAEB8711F), LIMB_PAIR(0x34AC8D7A, 0x7F0E52AA), LIMB_PAIR(0x7E7D55BB, 0x41CEC109),
+            LIMB_PAIR(0x08948AEE, 0xB0F4864D), LIMB_PAIR(0x91BA1C6F, 0x07DC19EE), LIMB_PAIR(0xA6ACA158, 0x7975CDAE), LIMB_PAIR(0x4262D4BB, 0x330B6113),
+            LIMB_PAIR(0xA26D808A, 0xF79619D7), LIMB_PAIR(0x1D9E156D, 0xBB1FD49E), LIMB_PAIR(0xDBA1DF27, 0x73D7C36C), LIMB_PAIR(0x1F28777D, 0x26B44CD9)
+        }
+    },
+#endif
+#if (59 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^59 * B
+            LIMB_PAIR(0xB0285F37, 0xAF44842D), LIMB_PAIR(0x47EFC8DF, 0x87531890), LIMB_PAIR(0xF820979A, 0x9574E091), LIMB_PAIR(0x69615579, 0x0E378D60),
+            LIMB_PAIR(0x393AA6D8, 0x300A9035), LIMB_PAIR(0xA12BB1CD, 0x2B501131), LIMB_PAIR(0xF093C222, 0x7B1FF677), LIMB_PAIR(0xCAB82BAD, 0x4309C1F8),
+            LIMB_PAIR(0x83075A55, 0xD9FA9171), LIMB_PAIR(0x6B009FDC, 0x4BDB5AD2), LIMB_PAIR(0xD63DEF0E, 0x7829AD2C), LIMB_PAIR(0x75FD3877, 0x078FC549)
+        },
+        {   // 2 * 16^59 * B
+            LIMB_PAIR(0xB833A98A, 0xE2004B5B), LIMB_PAIR(0x2D4C3330, 0x44775DEC), LIMB_PAIR(0x7EACE913, 0x3AA24406), LIMB_PAIR(0xD58E00A9, 0x272630E3),
+            LIMB_PAIR(0x28878F2D, 0x87DFBD14), LIMB_PAIR(0x1E9421A1, 0x134636DD), LIMB_PAIR(0x257341A3, 0x4F17C951), LIMB_PAIR(0xAD296CB8, 0x5DF98D4B),
+            LIMB_PAIR(0xECC90B54, 0xF3678FD0), LIMB_PAIR(0x12043599, 0xF001459B), LIMB_PAIR(0x3758B89B, 0x26725FBC), LIMB_PAIR(0x73A719AE, 0x4325E4AA)
+        },
+        {   // 3 * 16^59 * B
+            LIMB_PAIR(0xCF69F59D, 0xED24629A), LIMB_PAIR(0xDD5ABBF4, 0x2A4A1CCE), LIMB_PAIR(0x56B2D67B, 0x3535CA1F), LIMB_PAIR(0x43B1B42D, 0x5D8C68D0),
+            LIMB_PAIR(0x433C3493, 0x657DC6EF), LIMB_PAIR(0x80DBF8C3, 0x65375E9F), LIMB_PAIR(0x5B372DAE, 0x47FD2D46), LIMB_PAIR(0x796E7947, 0x4966AB79),
+            LIMB_PAIR(0xE3B42B0A, 0xEE332D4D), LIMB_PAIR(0x16A4601C, 0xD84E5A2B), LIMB_PAIR(0x078BA3E4, 0x78243877), LIMB_PAIR(0x184EE437, 0x77ED1EB4)
+        },
+        {   // 4 * 16^59 * B
+            LIMB_PAIR(0x9E92ED1A, 0x185D43F8), LIMB_PAIR(0xFE4719C6, 0xB04A1EEA), LIMB_PAIR(0xA6F03F4F, 0x499FBE88), LIMB_PAIR(0x3C859BDD, 0x5D8B0D2F),
+            LIMB_PAIR(0x201839A0, 0xBFD4E13F), LIMB_PAIR(0x3E3DF161, 0xAEEFFFE2), LIMB_PAIR(0x6B5D1FE3, 0xB65B04F0), LIMB_PAIR(0x2B62FBC0, 0x52E085FB),
+            LIMB_PAIR(0xA54CF2BA, 0x124079EA), LIMB_PAIR(0x001B26E7, 0xD72465EB), LIMB_PAIR(0xC97AF7FD, 0x6843BCFD), LIMB_PAIR(0x55EACD02, 0x0524B42B)
+        },
+        {   // 5 * 16^59 * B
+            LIMB_PAIR(0x9B829EAC, 0xBC18DCAD), LIMB_PAIR(0xB5F579D0, 0x23AE7D28), LIMB_PAIR(0x69384233, 0xC346122A), LIMB_PAIR(0xE7D4AC89, 0x1A6110B2),
+            LIMB_PAIR(0xE45447B0, 0xFD0D5DBE), LIMB_PAIR(0x092005EE, 0x6CEC351A), LIMB_PAIR(0x567579CB, 0x99A47844), LIMB_PAIR(0x16E7FA45, 0x59D242A2),
+            LIMB_PAIR(0xE66997AC, 0x4F833F6A), LIMB_PAIR(0x361839A4, 0x6849762A), LIMB_PAIR(0x970AB525, 0x6985DEC1), LIMB_PAIR(0xDCB1F546, 0x53045E89)
+        },
+        {   // 6 * 16^59 * B
+            LIMB_PAIR(0x8D45FE12, 0x84DA3CDE), LIMB_PAIR(0xE444E2D2, 0xBD42C218), LIMB_PAIR(0x1F7E3598, 0xA8519678), LIMB_PAIR(0x5616E2B2, 0x7642C93F),
+            LIMB_PAIR(0xD75353DB, 0xCB8BB346), LIMB_PAIR(0xAE511E22, 0xFCFCB24B), LIMB_PAIR(0xD50AE6EF, 0xCBA48D40), LIMB_PAIR(0xF4F7CB5D, 0x26E3BAE5),
+            LIMB_PAIR(0x4595F8E4, 0x2323DAA7), LIMB_PAIR(0x857ABEB4, 0xDE688C8B), LIMB_PAIR(0x1C59326E, 0x3FC48E96), LIMB_PAIR(0x15C9B8BA, 0x0B2E73CA)
+        },
+        {   // 7 * 16^59 * B
+            LIMB_PAIR(0x79C03A55, 0x0E3FBFAF), LIMB_PAIR(0x4CBB5ACF, 0x3077AF05), LIMB_PAIR(0xDB3DE39F, 0xD5C55245), LIMB_PAIR(0x476A4AF7, 0x015E68C1),
+            LIMB_PAIR(0xC17F5026, 0xD6BB4428), LIMB_PAIR(0xFB5A9CA7, 0x9EB27223), LIMB_PAIR(0x1919C644, 0xE37BA503), LIMB_PAIR(0xB59A6602, 0x21CE380D),
+            LIMB_PAIR(0x20066A38, 0xC1D52852), LIMB_PAIR(0x3570AEF3, 0x95603E52), LIMB_PAIR(0x226B8A4D, 0x832659A7), LIMB_PAIR(0x1F8EEDC9, 0x5DD68909)
+        },
+        {   // 8 * 16^59 * B
+            LIMB_PAIR(0xA5313084, 0x1D022591), LIMB_PAIR(0xD6270872, 0xCA2D4AAE), LIMB_PAIR(0x2F0BFD20, 0x86A12B85), LIMB_PAIR(0xAD7DA748, 0x56E6C439),
+            LIMB_PAIR(0xBFD3C856, 0xCBAC84DE), LIMB_PAIR(0xB35FF244, 0x1624C348), LIMB_PAIR(0x5D9CAD07, 0xB7F88DCA), LIMB_PAIR(0xA2C2EBE8, 0x3B0E574D),
+            LIMB_PAIR(0x42BDBAE6, 0xC704FF49), LIMB_PAIR(0xB2DE1F79, 0x5E21ADE2), LIMB_PAIR(0x5652FAD8, 0xE95DB3F3), LIMB_PAIR(0x8F08EBC1, 0x0822B537)
+        }
+    },
+#endif
+#if (60 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^60 * B
+            LIMB_PAIR(0x62730383, 0xE1B7F293), LIMB_PAIR(0xEBCA8A2C, 0x4B5279FF), LIMB_PAIR(0xBFD41314, 0xDAFC778A), LIMB_PAIR(0x9C72610F, 0x7DEB1014),
+            LIMB_PAIR(0x8F387475, 0x51F04847), LIMB_PAIR(0x9CBECB3C, 0xB25DBCF4), LIMB_PAIR(0xD99F2055, 0x9AAB1244), LIMB_PAIR(0x1C10A5D6, 0x2C709E6C),
+            LIMB_PAIR(0x8766EE7A, 0xCB62AF6A), LIMB_PAIR(0x5553CD0E, 0x66CBEC04), LIMB_PAIR(0x0F0BE4B5, 0x58800138), LIMB_PAIR(0xF62CE2EA, 0x08E68E9F)
+        },
+        {   // 2 * 16^60 * B
+            LIMB_PAIR(0x0AB8F2F9, 0x2F2D09D5), LIMB_PAIR(0xC55923DF, 0xACB9218D), LIMB_PAIR(0x73766CB9, 0x4A8F3426), LIMB_PAIR(0x38F719F5, 0x4CB13BD7),
+            LIMB_PAIR(0x4BC130AD, 0x34AD500A), LIMB_PAIR(0x3D0BD49C, 0x8D38DB49), LIMB_PAIR(0x500A89BE, 0xA25C3D98), LIMB_PAIR(0xEEBA3B09, 0x2F1F3F87),
+            LIMB_PAIR(0xE515B64A, 0xF7848C75), LIMB_PAIR(0xDB4A9038, 0xA59501BA), LIMB_PAIR(0x3F751B50, 0xC20D313F), LIMB_PAIR(0xC0AE2EE8, 0x19A1E353)
+        },
+        {   // 3 * 16^60 * B
+            LIMB_PAIR(0xD596BDBD, 0xB42172CD), LIMB_PAIR(0x98EEFC40, 0x93E04543), LIMB_PAIR(0xB44109B5, 0x9FB15347), LIMB_PAIR(0x0266AE34, 0x736BD399),
+            LIMB_PAIR(0xBAFA05C3, 0x7D1C7560), LIMB_PAIR(0xC6E55E61, 0xB3E1A0A0), LIMB_PAIR(0xC0D66473, 0xE3529718), LIMB_PAIR(0xC20C3486, 0x41546B11),
+            LIMB_PAIR(0x9334B3B4, 0x85532D50), LIMB_PAIR(0x60816573, 0x46FD114B), LIMB_PAIR(0x425C8375, 0xCC5F5F30), LIMB_PAIR(0xB87FAB5C, 0x412295A2)
+        },
+        {   // 4 * 16^60 * B
+            LIMB_PAIR(0xE293EAC6, 0x2E655261), LIMB_PAIR(0x2133ACDB, 0x845A9203), LIMB_PAIR(0x7900996B, 0x460975CB), LIMB_PAIR(0x195ADD80, 0x0760BB8D),
+            LIMB_PAIR(0xF57ED6E9, 0x19C99B88), LIMB_PAIR(0x6DF8C825, 0x5393CB26), LIMB_PAIR(0xB30AD273, 0x5CEE3213), LIMB_PAIR(0xB52D2E34, 0x14E153EB),
+            LIMB_PAIR(0xCDE6818A, 0x413E1A17), LIMB_PAIR(0xED69A084, 0x57156DA9), LIMB_PAIR(0x46CACCB1, 0x2CBF268F), LIMB_PAIR(0xC33AC5F2, 0x6B34BE9B)
+        },
+        {   // 5 * 16^60 * B
+            LIMB_PAIR(0x6571F2D3, 0x11FC6965), LIMB_PAIR(0x530E737A, 0xC6C9E845), LIMB_PAIR(0xD4FE5035, 0xE33AE7A2), LIMB_PAIR(0x2E6DD30B, 0x01B9C7B6),
+            LIMB_PAIR(0x3A78C0B2, 0xF3DF2F64), LIMB_PAIR(0xF22E027C, 0x4C3E971E), LIMB_PAIR(0x49C1B5A3, 0xEC7D1C5E), LIMB_PAIR(0x0922DD2D, 0x2012C18F),
+            LIMB_PAIR(0x5AC89D29, 0x880B55E5), LIMB_PAIR(0x45A0A763, 0x1483241F), LIMB_PAIR(0xC2E76C1F, 0x3D36EFDF), LIMB_PAIR(0x4E4BADE8, 0x08AF5B78)
+        },
+        {   // 6 * 16^60 * B
+            LIMB_PAIR(0x89CC2C4B, 0xE27314D2), LIMB_PAIR(0xA287178D, 0x4BE4BD11), LIMB_PAIR(0xFA3364CE, 0x18D528D6), LIMB_PAIR(0xAFD9826E, 0x6423C1D5),
+            LIMB_PAIR(0x881F2533, 0x283499DC), LIMB_PAIR(0x779323B6, 0x9D0525DA), LIMB_PAIR(0x673441F4, 0x897ADDFB), LIMB_PAIR(0x163A168D, 0x32B79D71),
+            LIMB_PAIR(0xEDFCB36A, 0xCC85F8D9), LIMB_PAIR(0x3746E5F9, 0x22BCC28F), LIMB_PAIR(0xF9E5D3CD, 0xE49DE338), LIMB_PAIR(0xC13E2DCC, 0x480A5EFB)
+        },
+        {   // 7 * 16^60 * B
+            LIMB_PAIR(0x42CE221F, 0xB6614CE4), LIMB_PAIR(0x4C053928, 0x6E199DCC), LIMB_PAIR(0xDC1CBE03, 0x663FB4A4), LIMB_PAIR(0x691C8E06, 0x24B31D47),
+            LIMB_PAIR(0x01622071, 0x0B51E70B), LIMB_PAIR(0x8B1DAFC5, 0x06B505CF), LIMB_PAIR(0xEF5AABCD, 0x2C6BB061), LIMB_PAIR(0x0CB7BF31, 0x47AA2760),
+            LIMB_PAIR(0xC015F8C3, 0x2A541EED), LIMB_PAIR(0x7C693F7C, 0x11A4FE7E), LIMB_PAIR(0x4EA278D6, 0xF0AF6613), LIMB_PAIR(0x14DDA094, 0x545B585D)
+        },
+        {   // 8 * 16^60 * B
+            LIMB_PAIR(0xE3B321E1, 0x6204E4D0), LIMB_PAIR(0x28FF1E95, 0x3BAA637A), LIMB_PAIR(0x5B99BD9E, 0x0B0CCFFD), LIMB_PAIR(0x64C8D071, 0x4D22DC3E),
+            LIMB_PAIR(0xA0D43A0F, 0x67BF275E), LIMB_PAIR(0x089BEEBE, 0xADE68E34), LIMB_PAIR(0xD479E72E, 0x4289134C), LIMB_PAIR(0x32BA5454, 0x0F62F9C3),
+            LIMB_PAIR(0xD63B5F39, 0xFCB46589), LIMB_PAIR(0x57CBCF61, 0x5CAE6A3F), LIMB_PAIR(0x953AFA05, 0xFEBAC2D2), LIMB_PAIR(0x36371436, 0x1C0FA01A)
+        }
+    },
+#endif
+#if (61 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^61 * B
+            LIMB_PAIR(0x54C53FAE, 0xC11EE5E8), LIMB_PAIR(0x2B4F3FF4, 0x6A0B06C1), LIMB_PAIR(0xE0B67A72, 0x33540F80), LIMB_PAIR(0xCD07E3EF, 0x15F18FC3),
+            LIMB_PAIR(0xBC7CD692, 0xE7547449), LIMB_PAIR(0xE6F73DDF, 0x0F9ABEAA), LIMB_PAIR(0x00837E29, 0x4AF01CA7), LIMB_PAIR(0x3F1BC183, 0x63AB1B5D),
+            LIMB_PAIR(0xB028F48C, 0x32750763), LIMB_PAIR(0x556A065F, 0x06020740), LIMB_PAIR(0xC3495B58, 0xD53BD812), LIMB_PAIR(0x865F508D, 0x08706C9B)
+        },
+        {   // 2 * 16^61 * B
+            LIMB_PAIR(0x38B41246, 0xCC991B41), LIMB_PAIR(0x6F9AC26B, 0x243B9C52), LIMB_PAIR(0xB7CBABBD, 0xB9EF494D), LIMB_PAIR(0xD082ED00, 0x5FBA433D),
+            LIMB_PAIR(0x3D343DFF, 0xF37CA2AB), LIMB_PAIR(0x80ABC617, 0x1A8C6A2D), LIMB_PAIR(0xD4CCFFCA, 0x8E49E035), LIMB_PAIR(0xBAA1D1B9, 0x48B46BEE),
+            LIMB_PAIR(0xC9941AD0, 0x9C49E355), LIMB_PAIR(0x74498F84, 0xB9734ADE), LIMB_PAIR(0x66663E5C, 0x41C3FED0), LIMB_PAIR(0xE8E710B3, 0x0ECFEDF8)
+        },
+        {   // 3 * 16^61 * B
+            LIMB_PAIR(0xE9403762, 0x744F7463), LIMB_PAIR(0x8DFCC9C9, 0xF79A8DEE), LIMB_PAIR(0x55E4CDE3, 0x163A6496), LIMB_PAIR(0xB284F435, 0x3B61788D),
+            LIMB_PAIR(0x9CD470D9, 0x76430F9F), LIMB_PAIR(0xA42F6008, 0xB62ACC9B), LIMB_PAIR(0x59ADAD5E, 0x1898297C), LIMB_PAIR(0xB78C5080, 0x7789DD2D),
+            LIMB_PAIR(0x0D6EF6B2, 0xB2222819), LIMB_PAIR(0x46CE4BFA, 0xA94A66B2), LIMB_PAIR(0x4F0B6CC7, 0x46C1A77A), LIMB_PAIR(0xEB7338CF, 0x4236CCFF)
+        },
+        {   // 4 * 16^61 * B
+            LIMB_PAIR(0xDA777DF6, 0x3BD82DBF), LIMB_PAIR(0x0B98369E, 0x71B177CC), LIMB_PAIR(0x850C3699, 0x1D0E8463), LIMB_PAIR(0x48E2D1F1, 0x5A71945B),
+            LIMB_PAIR(0x0D55E274, 0x8497404D), LIMB_PAIR(0xC4AD2B53, 0x6C6663D9), LIMB_PAIR(0xADA95734, 0xEC2FB0D9), LIMB_PAIR(0xCDB8F73C, 0x2617E120),
+            LIMB_PAIR(0x405B4B42, 0x6F203DD5), LIMB_PAIR(0x10B24509, 0x327EC604), LIMB_PAIR(0xAC2A8846, 0x9C347230), LIMB_PAIR(0x11FFEB6A, 0x77DE29FC)
+        },
+        {   // 5 * 16^61 * B
+            LIMB_PAIR(0xECCED2CA, 0x835E138F), LIMB_PAIR(0xEA963B9A, 0x8C9EAF13), LIMB_PAIR(0xB2160EA6, 0xC95FBFC0), LIMB_PAIR(0xAD877892, 0x575E66F3),
+            LIMB_PAIR(0x83B778A8, 0xB0AC57C9), LIMB_PAIR(0xD7FE912C, 0x53CDCCA9), LIMB_PAIR(0xFF1F59DC, 0x61C2B854), LIMB_PAIR(0xF0DE7DAC, 0x3A1A2CF0),
+            LIMB_PAIR(0xC88FCB3A, 0x99803A27), LIMB_PAIR(0x275EC0B0, 0x345A6789), LIMB_PAIR(0xFF6C2BE5, 0x459789D0), LIMB_PAIR(0x1E70A8B2, 0x62F88265)
+        },
+        {   // 6 * 16^61 * B
+            LIMB_PAIR(0x698A19E0, 0x6D822986), LIMB_PAIR(0x74D78A71, 0xDC9821E1), LIMB_PAIR(0xF6CB1F47, 0x41A85F31), LIMB_PAIR(0xBCDA9C51, 0x352721C2),
+            LIMB_PAIR(0x59FF1BE4, 0x085AE2C7), LIMB_PAIR(0x3B0E40B7, 0x149145C9), LIMB_PAIR(0x7FF27379, 0xC467E7FA), LIMB_PAIR(0xD5C73A95, 0x4EEECF0A),
+            LIMB_PAIR(0x213FC985, 0x48329952), LIMB_PAIR(0x368A1746, 0x1087CF0D), LIMB_PAIR(0x66C15AA5, 0x8E5261B1), LIMB_PAIR(0x2ED24C21, 0x2D5B2D84)
+        },
+        {   // 7 * 16^61 * B
+            LIMB_PAIR(0x196AC533, 0x5EB7D13D), LIMB_PAIR(0xDB80BE2B, 0x377234EC), LIMB_PAIR(0x7CF5AE24, 0xE144CFFC), LIMB_PAIR(0xC441ACEC, 0x5226BCF9),
+            LIMB_PAIR(0xEBD3DED1, 0x02CFEBD9), LIMB_PAIR(0x39021974, 0xD45B2177), LIMB_PAIR(0xFE30A1B7, 0x7576F813), LIMB_PAIR(0xA34EF6C2, 0x5691B6F9),
+            LIMB_PAIR(0x23E5B547, 0x79EE6C72), LIMB_PAIR(0x8330D679, 0x6F5F5076), LIMB_PAIR(0x6D8ADCE9, 0xED73E1E9), LIMB_PAIR(0x1D8CCC03, 0x27C3DA1E)
+        },
+        {   // 8 * 16^61 * B
+            LIMB_PAIR(0x630EF9F6, 0x28302E71), LIMB_PAIR(0x2B64CEE0, 0xC2D4A203), LIMB_PAIR(0x4B6292BE, 0x09082030), LIMB_PAIR(0xA82ADF18, 0x5FCA747A),
+            LIMB_PAIR(0x3FE24C74, 0x7EB9EFB2), LIMB_PAIR(0x1651BE01, 0x3E50F49F), LIMB_PAIR(0x21858DEA, 0x3EA732DC), LIMB_PAIR(0x5BB810F9, 0x17377BD7),
+            LIMB_PAIR(0x5C258EA5, 0x232A03C3), LIMB_PAIR(0x6BCB0CF1, 0x86F23A2C), LIMB_PAIR(0x2E442166, 0x3DAD8D0D), LIMB_PAIR(0xAB76862B, 0x04A8933C)
+        }
+    },
+#endif
+#if (62 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^62 * B
+            LIMB_PAIR(0x8C936A50, 0x69082B0E), LIMB_PAIR(0xC1DAC5B6, 0xF9C9A035), LIMB_PAIR(0xC4DFB634, 0x6FB73E54), LIMB_PAIR(0x1D2BC140, 0x4005419B),
+            LIMB_PAIR(0x22943DFF, 0xD2C604B6), LIMB_PAIR(0x44CFB3A0, 0xBC8CBECE), LIMB_PAIR(0x97808678, 0x5D254FF3), LIMB_PAIR(0x3B1CA6BF, 0x0FA3614F),
+            LIMB_PAIR(0xB9BE82F0, 0xA003FEBD), LIMB_PAIR(0x3A44AC90, 0x2089C1AF), LIMB_PAIR(0x1954FA8E, 0xF8499F91), LIMB_PAIR(0xEF40AB42, 0x1FBA218A)
+        },
+        {   // 2 * 16^62 * B
+            LIMB_PAIR(0x3E7B0194, 0x4F3E5704), LIMB_PAIR(0x08DAAF7F, 0xA81D3EEE), LIMB_PAIR(0x99DCDEF1, 0xC839C6AB), LIMB_PAIR(0xFF7761D5, 0x6C535D13),
+            LIMB_PAIR(0xFAC8F53E, 0xAB549448), LIMB_PAIR(0x7BA63741, 0x81F6E89A), LIMB_PAIR(0x6C2B5E01, 0x74FD6C7D), LIMB_PAIR(0xA8C86E42, 0x392E3ACA),
+            LIMB_PAIR(0x3E8A35AF, 0x4CBD34E9), LIMB_PAIR(0x5887E816, 0x2E078144), LIMB_PAIR(0xF29AB0AB, 0x19319C76), LIMB_PAIR(0xD50AC13B, 0x25E17FE4)
+        },
+        {   // 3 * 16^62 * B
+            LIMB_PAIR(0x76F121A7, 0x915F7FF5), LIMB_PAIR(0x2FCD87E3, 0xC34A3227), LIMB_PAIR(0x4D1BE526, 0xCCBA2FDE), LIMB_PAIR(0x8969899B, 0x6BBA828F),
+            LIMB_PAIR(0x1E04F676, 0x0A289BD7), LIMB_PAIR(0xD6420F95, 0x208E1C52), LIMB_PAIR(0x34691FAB, 0x5186D8B0), LIMB_PAIR(0x2A9FB351, 0x25575144),
+            LIMB_PAIR(0x90FE3901, 0xE2D1BC66), LIMB_PAIR(0xA0997AD5, 0x4CB54A18), LIMB_PAIR(0xAF8460D4, 0x971D6914), LIMB_PAIR(0x7F6B7BE4, 0x559D504F)
+        },
+        {   // 4 * 16^62 * B
+            LIMB_PAIR(0xF6D266FD, 0x9C4891E7), LIMB_PAIR(0x0307781B, 0x0744A19B), LIMB_PAIR(0x6061E23B, 0x88388F1D), LIMB_PAIR(0x354BD50E, 0x123EA6A3),
+            LIMB_PAIR(0xB3EB54D5, 0xA7738378), LIMB_PAIR(0xA5553C7C, 0x1D69D366), LIMB_PAIR(0xF92800BA, 0x0A26CF62), LIMB_PAIR(0x807E3217, 0x01AB12D5),
+            LIMB_PAIR(0x41E32D96, 0x118D1890), LIMB_PAIR(0xD8315848, 0xB9EDE3C2), LIMB_PAIR(0xD83245D9, 0x1EAB4271), LIMB_PAIR(0xC918A154, 0x4A3961E2)
+        },
+        {   // 5 * 16^62 * B
+            LIMB_PAIR(0xF3233F1E, 0x0327D644), LIMB_PAIR(0x34FCF016, 0x499A260E), LIMB_PAIR(0xF2DAB979, 0x83B5A716), LIMB_PAIR(0x9BD4111F, 0x68ACEEAD),
+            LIMB_PAIR(0xF8E6BBA0, 0x71DC3BE0), LIMB_PAIR(0x7EFFE30A, 0xD6CEF834), LIMB_PAIR(0xE13A476A, 0xA992425F), LIMB_PAIR(0xFB1DB763, 0x2CD6BCE3),
+            LIMB_PAIR(0xF3D7C210, 0x38B4C90E), LIMB_PAIR(0xB7AD040C, 0x308E6E24), LIMB_PAIR(0xB7E73E23, 0x3860D9F1), LIMB_PAIR(0xB508F597, 0x595760D5)
+        },
+        {   // 6 * 16^62 * B
+            LIMB_PAIR(0xFD022790, 0x882ACBEB), LIMB_PAIR(0xC4115760, 0x89AF3305), LIMB_PAIR(0x7D3473F4, 0x65F492E3), LIMB_PAIR(0x54515A2B, 0x2CB2C5DF),
+            LIMB_PAIR(0x04AA6397, 0x6129BFE1), LIMB_PAIR(0xA4A7FCCB, 0x8F960008), LIMB_PAIR(0x7D909458, 0x3F8BC089), LIMB_PAIR(0xDCB291A9, 0x709FA43E),
+            LIMB_PAIR(0x63FD2ACA, 0xEB0A5D8C), LIMB_PAIR(0x2E694EFF, 0xD22BC166), LIMB_PAIR(0xF8CBB03A, 0x2723F36E), LIMB_PAIR(0xF0C8131F, 0x70F029EC)
+        },
+        {   // 7 * 16^62 * B
+            LIMB_PAIR(0x5E10B0B9, 0x2A6AAFAA), LIMB_PAIR(0xEF041AA9, 0x78F0A370), LIMB_PAIR(0xAA3AD61F, 0x773EFB77), LIMB_PAIR(0xA74BD9E1, 0x44ECA5A2),
+            LIMB_PAIR(0x2EED3E33, 0x461307B3), LIMB_PAIR(0xA45581E7, 0xAE042F33), LIMB_PAIR(0x195F0366, 0xC94449D3), LIMB_PAIR(0x6C314858, 0x0B7D5D8A),
+            LIMB_PAIR(0x7B95D543, 0x25D44832), LIMB_PAIR(0xA3340F1D, 0x70D38300), LIMB_PAIR(0x60E1C52B, 0xDE1C531C), LIMB_PAIR(0x2C7DE9E4, 0x27222451)
+        },
+        {   // 8 * 16^62 * B
+            LIMB_PAIR(0x42A975FC, 0xBF7BBB8A), LIMB_PAIR(0x96ADA358, 0x8C5C3977), LIMB_PAIR(0xCDEDAA48, 0xE27FC76F), LIMB_PAIR(0xF6BC20A6, 0x19735FD7),
+            LIMB_PAIR(0x49C5342E, 0x1ABC92AF), LIMB_PAIR(0xB2E6FAD0, 0xFFEED811), LIMB_PAIR(0xFCC84E29, 0xEFA28C8D), LIMB_PAIR(0xA44CC543, 0x11B5DF18),
+            LIMB_PAIR(0x42C84266, 0xE3AB90D0), LIMB_PAIR(0x7F19547E, 0xEB848E0F), LIMB_PAIR(0x65A497B9, 0x2503A1D0), LIMB_PAIR(0x91DF895F, 0x0FEF9111)
+        }
+    },
+#endif
+#if (63 % ED25519_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^63 * B
+            LIMB_PAIR(0x5B1C16B7, 0x6AB5DCB8), LIMB_PAIR(0x3C7B27A5, 0x94C0FCE8), LIMB_PAIR(0x735517BE, 0xA4B11C1A), LIMB_PAIR(0xBA0EAFAA, 0x499238D0),
+            LIMB_PAIR(0xAB1C6EB9, 0xB1507CA1), LIMB_PAIR(0x16B687B3, 0xBD448F3E), LIMB_PAIR(0x2C7A91AB, 0x3455FB7F), LIMB_PAIR(0x2F2ADEC1, 0x7579229E),
+            LIMB_PAIR(0x7ABA8B57, 0xECF46E52), LIMB_PAIR(0x8BD1647B, 0x15A08C47), LIMB_PAIR(0x5F706FEF, 0x7AF1C6A6), LIMB_PAIR(0xF03A30D5, 0x6345FA78)
+        },
+        {   // 2 * 16^63 * B
+            LIMB_PAIR(0xBDD8F0A4, 0x93D3CBE9), LIMB_PAIR(0xFD177302, 0xDB152C1B), LIMB_PAIR(0x7F17A875, 0x7DBDDC6D), LIMB_PAIR(0x8F426EFE, 0x3E1A71CC),
+            LIMB_PAIR(0x1015E7A1, 0xDF02F95F), LIMB_PAIR(0xA9B40263, 0x790EC41D), LIMB_PAIR(0x33EA1107, 0x4D3A0EA1), LIMB_PAIR(0xE33AF8C9, 0x54F70BE7),
+            LIMB_PAIR(0x90BABD62, 0xC83CA3E3), LIMB_PAIR(0x0291C833, 0x80EDE367), LIMB_PAIR(0xD37900C4, 0xC88038CC), LIMB_PAIR(0x1EC31FA1, 0x2C5FC023)
+        },
+        {   // 3 * 16^63 * B
+            LIMB_PAIR(0x02456E65, 0xC422E4D1), LIMB_PAIR(0xCAD47B91, 0x87414AC1), LIMB_PAIR(0xA2B6FFDD, 0x1592E2BB), LIMB_PAIR(0xF5C2100F, 0x75D9D2BF),
+            LIMB_PAIR(0x17038B4F, 0xFEBA9117), LIMB_PAIR(0xC9DEEF81, 0xE5123721), LIMB_PAIR(0x5D0D8834, 0x1C97E4E7), LIMB_PAIR(0x23DC3BC6, 0x68AFAE7A),
+            LIMB_PAIR(0x3626E81C, 0x5BD9B476), LIMB_PAIR(0xBCA02EDD, 0x89966936), LIMB_PAIR(0x61F077B3, 0x0A41193D), LIMB_PAIR(0x00CE5471, 0x3097A242)
+        },
+        {   // 4 * 16^63 * B
+            LIMB_PAIR(0x6695C486, 0xA162E724), LIMB_PAIR(0x35A89607, 0x131D6334), LIMB_PAIR(0xA0D12A37, 0x30521561), LIMB_PAIR(0xA6AFB363, 0x56704BAD),
+            LIMB_PAIR(0xC7F8B84C, 0x57427734), LIMB_PAIR(0x01B270E9, 0xF141A13E), LIMB_PAIR(0xB4E564A6, 0x02D1ADFE), LIMB_PAIR(0xCE83BD48, 0x4BB23D92),
+            LIMB_PAIR(0x52F912B9, 0xAF6C4AA7), LIMB_PAIR(0xD86770C8, 0x5E665F6C), LIMB_PAIR(0xA3C8CD58, 0x4C35AC83), LIMB_PAIR(0x10A58A7E, 0x2B7A29C0)
+        },
+        {   // 5 * 16^63 * B
+            LIMB_PAIR(0xBF00086E, 0x33810A23), LIMB_PAIR(0xE736FF7C, 0xAFCE925E), LIMB_PAIR(0xE24922D4, 0x3D60E670), LIMB_PAIR(0x4F96061B, 0x11CE9E71),
+            LIMB_PAIR(0xD0C1CEC3, 0xC4007F77), LIMB_PAIR(0xBAC492F8, 0x8D1020B6), LIMB_PAIR(0x7E69DAAF, 0x32EC29D5), LIMB_PAIR(0x9D95FCE0, 0x59940875),
+            LIMB_PAIR(0xD815BAC1, 0x219EF713), LIMB_PAIR(0x485BE25C, 0xF141465D), LIMB_PAIR(0x4E513C51, 0x6D5447CC), LIMB_PAIR(0x5EF44393, 0x174926BE)
+        },
+        {   // 6 * 16^63 * B
+            LIMB_PAIR(0x93EA022E, 0x3EF5D415), LIMB_PAIR(0x0ED0EED6, 0x5CBCC1A2), LIMB_PAIR(0x07382C8C, 0x8FD24ECF), LIMB_PAIR(0x06D8E1AD, 0x6FA42EAD),
+            LIMB_PAIR(0xFC5BD5BB, 0xB5DEB2F9), LIMB_PAIR(0xE1D810E1, 0x92DAA72A), LIMB_PAIR(0xB72A1C59, 0xAFC4CFDC), LIMB_PAIR(0x3FC22A24, 0x497D7881),
+            LIMB_PAIR(0x1F73371F, 0xE276824A), LIMB_PAIR(0x4F5B6736, 0x7F7CF01C), LIMB_PAIR(0x04FA46E7, 0x7E201FE3), LIMB_PAIR(0x57808C96, 0x785A36A3)
+        },
+        {   // 7 * 16^63 * B
+            LIMB_PAIR(0x5D517BC3, 0x07044298), LIMB_PAIR(0xAE653678, 0x6ACD56C7), LIMB_PAIR(0x985A7763, 0x00A27983), LIMB_PAIR(0xE512662B, 0x5167EFFA),
+            LIMB_PAIR(0x63014D2B, 0x825FBDFD), LIMB_PAIR(0x6CA7578B, 0xC852369C), LIMB_PAIR(0x5C0B5DF0, 0x5B2FCD28), LIMB_PAIR(0x58048C8F, 0x12AB214C),
+            LIMB_PAIR(0x0F53C4B6, 0xBD4EA9E1), LIMB_PAIR(0x8AC91A14, 0x1673DC5F), LIMB_PAIR(0x2ACC1ABA, 0xA8F81A4E), LIMB_PAIR(0x24332A25, 0x33A92A79)
+        },
+        {   // 8 * 16^63 * B
+            LIMB_PAIR(0x218F2ADA, 0x7BA95BA0), LIMB_PAIR(0x330FB9CA, 0xCFF42287), LIMB_PAIR(0x56C6D907, 0xDADA496D), LIMB_PAIR(0xF4BEEE54, 0x5380C296),
+            LIMB_PAIR(0x27996C02, 0x9DD1F499), LIMB_PAIR(0xE04D1752, 0x0CB3B058), LIMB_PAIR(0x7FD02C3E, 0x1F7E8896), LIMB_PAIR(0xCB8B3EB1, 0x2F964268),
+            LIMB_PAIR(0x66898D0A, 0x9D4F2704), LIMB_PAIR(0x0AFF3F7A, 0x3D098799), LIMB_PAIR(0x67DABA45, 0xD09EF362), LIMB_PAIR(0x7B1C669C, 0x7761455E)
+        }
+    },
+#endif
+};
+
+static limb_t const baseOddTable[32][3 * NUM_LIMBS_256BIT] PROGMEM = {
+    {   // 1 * B
+        LIMB_PAIR(0xF58C3B85, 0x2FBC93C6), LIMB_PAIR(0xFB8C0E19, 0xCF932DC6), LIMB_PAIR(0x643D42C2, 0x270B4898), LIMB_PAIR(0x33D4BA65, 0x07CF9D3A),
+        LIMB_PAIR(0xD740913E, 0x9D103905), LIMB_PAIR(0xD140BEB3, 0xFD399F05), LIMB_PAIR(0x688F8A09, 0xA5C18434), LIMB_PAIR(0x98F81267, 0x44FD2F92),
+        LIMB_PAIR(0x877AAA68, 0xABC91205), LIMB_PAIR(0xCCAAC49E, 0x26D9E823), LIMB_PAIR(0xDD43598C, 0x5A1B7DCB), LIMB_PAIR(0x9F0C65A8, 0x6F117B68)
+    },
+    {   // 3 * B
+        LIMB_PAIR(0x4CEE9730, 0xAF25B0A8), LIMB_PAIR(0xE8864B8A, 0x025A8430), LIMB_PAIR(0x9F016732, 0xC11B5002), LIMB_PAIR(0x9A80F8F4, 0x7A164E1B),
+        LIMB_PAIR(0xA4FCD265, 0x56611FE8), LIMB_PAIR(0xE5C1BA7D, 0x3BD353FD), LIMB_PAIR(0x214BD6BD, 0x8131F31A), LIMB_PAIR(0x555BDA62, 0x2AB91587),
+        LIMB_PAIR(0x0DD0D889, 0x14AE933F), LIMB_PAIR(0x1C35DA62, 0x58942322), LIMB_PAIR(0x8CF2DB4C, 0xD170E545), LIMB_PAIR(0x12B9B4C6, 0x5A2826AF)
+    },
+    {   // 5 * B
+        LIMB_PAIR(0x08A5BB33, 0xA212BC44), LIMB_PAIR(0xC75EED02, 0x8D5048C3), LIMB_PAIR(0x5ABFEC44, 0xDD1BEB0C), LIMB_PAIR(0x46E206EB, 0x2945CCF1),
+        LIMB_PAIR(0xA447D6BA, 0x7F9182C3), LIMB_PAIR(0x4B2729B7, 0xD50014D1), LIMB_PAIR(0xB864A087, 0xE33CF11C), LIMB_PAIR(0xEB1B55F3, 0x154A7E73),
+        LIMB_PAIR(0x812A8285, 0xBCBBDBF1), LIMB_PAIR(0xD0BDD1FC, 0x270E0807), LIMB_PAIR(0x1BBDA72D, 0xB41B670B), LIMB_PAIR(0x6B3BB69A, 0x43AABE69)
+    },
+    {   // 7 * B
+        LIMB_PAIR(0x944EA3BF, 0x6B1A5CD0), LIMB_PAIR(0xB39DC0D2, 0x7470353A), LIMB_PAIR(0x28542E49, 0x71B25282), LIMB_PAIR(0x283C927E, 0x461BEA69),
+        LIMB_PAIR(0xAA3221B1, 0xBA6F2C9A), LIMB_PAIR(0x3BBA23A7, 0x6CA02153), LIMB_PAIR(0x92192C3A, 0x9DEA764F), LIMB_PAIR(0x2E5317E0, 0x1D6EDD5D),
+        LIMB_PAIR(0x01B8B3A2, 0xF1836DC8), LIMB_PAIR(0x053EA49A, 0xB3035F47), LIMB_PAIR(0x5877ADF3, 0x529C41BA), LIMB_PAIR(0x6A0F90A7, 0x7A9FBB1C)
+    },
+    {   // 9 * B
+        LIMB_PAIR(0xA6A8632F, 0x9B2E678A), LIMB_PAIR(0x51BC46C5, 0xA6509E6F), LIMB_PAIR(0xC686F5B5, 0xCEB233C9), LIMB_PAIR(0x8ADD7F59, 0x34B9ED33),
+        LIMB_PAIR(0x039D8064, 0xF36E217E), LIMB_PAIR(0xF520419B, 0x98A081B6), LIMB_PAIR(0xE75EB044, 0x96CBC608), LIMB_PAIR(0xFADC9C8F, 0x49C05A51),
+        LIMB_PAIR(0x9045AF1B, 0x06B4E8BF), LIMB_PAIR(0xA719D22F, 0xE2FF83E8), LIMB_PAIR(0x93D4CF16, 0xAAF6FC29), LIMB_PAIR(0x1B008B06, 0x73C17202)
+    },
+    {   // 11 * B
+        LIMB_PAIR(0x8A802ADE, 0x2FBF0084), LIMB_PAIR(0x02302E27, 0xE5D9FECF), LIMB_PAIR(0x17703406, 0x113E8471), LIMB_PAIR(0x546D8FAF, 0x4275AAE2),
+        LIMB_PAIR(0x49864348, 0x315F5B02), LIMB_PAIR(0x77088381, 0x3ED6B369), LIMB_PAIR(0x6A8DEB95, 0xA3A07555), LIMB_PAIR(0x29D5C77F, 0x18AB5980),
+        LIMB_PAIR(0xFD6089E9, 0xD82B2CC5), LIMB_PAIR(0x3282E4A4, 0x031EB4A1), LIMB_PAIR(0xB51A8622, 0x44311199), LIMB_PAIR(0xB53DF948, 0x3DC65522)
+    },
+    {   // 13 * B
+        LIMB_PAIR(0xA2007F6D, 0xBF70C222), LIMB_PAIR(0xB5BCDEDB, 0xBF84B39A), LIMB_PAIR(0xFB07BA07, 0x537A0E12), LIMB_PAIR(0xC346F241, 0x234FD7EE),
+        LIMB_PAIR(0x327FBF93, 0x506F013B), LIMB_PAIR(0x9B776F6B, 0xAEFCEBC9), LIMB_PAIR(0xAAAD5968, 0x9D12B232), LIMB_PAIR(0x176024A7, 0x0267882D),
+        LIMB_PAIR(0x732EA378, 0x5360A119), LIMB_PAIR(0xDF8DD471, 0x2437E6B1), LIMB_PAIR(0x91A7E533, 0xA2EF37F8), LIMB_PAIR(0xAA097863, 0x497BA6FD)
+    },
+    {   // 15 * B
+        LIMB_PAIR(0x13CFEAA0, 0x24CECC03), LIMB_PAIR(0x189C246D, 0x8648C28D), LIMB_PAIR(0xC1F2D4D0, 0x2DBDBDFA), LIMB_PAIR(0xF12DE72B, 0x61E22917),
+        LIMB_PAIR(0x468CCF0B, 0x040BCD86), LIMB_PAIR(0x2A9910D6, 0xD3829BA4), LIMB_PAIR(0x07B25192, 0x75083008), LIMB_PAIR(0x18D05EBF, 0x43B5CD42),
+        LIMB_PAIR(0x9BD0B516, 0x5D9A762F), LIMB_PAIR(0x373FDEEE, 0xEB38AF4E), LIMB_PAIR(0x93D64270, 0x032E5A7D), LIMB_PAIR(0x0AE4D842, 0x511D6121)
+    },
+    {   // 17 * B
+        LIMB_PAIR(0x950E9D81, 0x92C676EF), LIMB_PAIR(0xC0D7044F, 0xA54620CD), LIMB_PAIR(0x6F8F1248, 0xAA9B3664), LIMB_PAIR(0xDDB855E3, 0x6D325924),
+        LIMB_PAIR(0x4420DE87, 0x08138648), LIMB_PAIR(0xB592EDB4, 0x8A1CF016), LIMB_PAIR(0x29942D25, 0x39FA4E27), LIMB_PAIR(0xE2482810, 0x71A7FE6F),
+        LIMB_PAIR(0xA5C8C854, 0x6C7182B8), LIMB_PAIR(0xFE5F2A03, 0x33FD1479), LIMB_PAIR(0x83778D0C, 0x72CF5918), LIMB_PAIR(0x559EEAA9, 0x4746C4B6)
+    },
+    {   // 19 * B
+        LIMB_PAIR(0x6DC69A2B, 0xD3777B3C), LIMB_PAIR(0x6F89F617, 0xDEFAB227), LIMB_PAIR(0xB53A16B5, 0x45651CF7), LIMB_PAIR(0x34FE9FB7, 0x5C9A51DE),
+        LIMB_PAIR(0x64741147, 0x348546C8), LIMB_PAIR(0x0EFCC849, 0x7D35AEDD), LIMB_PAIR(0x0672A332, 0xFF939A76), LIMB_PAIR(0x7DB5E6D6, 0x21966349),
+        LIMB_PAIR(0x79F10E67, 0xF510F1CF), LIMB_PAIR(0xE658515B, 0xFFDDDAA1), LIMB_PAIR(0x10142277, 0x09C3A717), LIMB_PAIR(0x608223BB, 0x4804503C)
+    },
+    {   // 21 * B
+        LIMB_PAIR(0x2CA37FC7, 0xC4249ED0), LIMB_PAIR(0xA615ACAB, 0xA059A0E3), LIMB_PAIR(0xC96E0E23, 0x88A96ED7), LIMB_PAIR(0x1650696D, 0x553398A5),
+        LIMB_PAIR(0x3A36D175, 0x3B6821D2), LIMB_PAIR(0xE99B9E32, 0xBBB40AA7), LIMB_PAIR(0x20838A47, 0x5D9E5CE4), LIMB_PAIR(0x58DE4C5E, 0x771E0988),
+        LIMB_PAIR(0x78451EDF, 0x9A12F5D2), LIMB_PAIR(0x85899CCB, 0x3ADA5D79), LIMB_PAIR(0x9FA59508, 0x477F4A2D), LIMB_PAIR(0x8FF5A611, 0x5A5ED1D6)
+    },
+    {   // 23 * B
+        LIMB_PAIR(0xFE150E83, 0x1195122A), LIMB_PAIR(0x7E4B35D8, 0xCF209A25), LIMB_PAIR(0x1E711E20, 0x7387F829), LIMB_PAIR(0xD8BF92F0, 0x44ACB897),
+        LIMB_PAIR(0x58527359, 0xBAE5E0C5), LIMB_PAIR(0xCADB9D7E, 0x392E5C19), LIMB_PAIR(0xDA1CABE9, 0x28653C1E), LIMB_PAIR(0x5FEFDC44, 0x019B6013),
+        LIMB_PAIR(0x5E134B83, 0x1E606814), LIMB_PAIR(0x24304C16, 0xC4F5E64F), LIMB_PAIR(0xFC1A3ED7, 0x506E88A8), LIMB_PAIR(0xE6AD2F92, 0x150C49FD)
+    },
+    {   // 25 * B
+        LIMB_PAIR(0x09471138, 0x8E7BF295), LIMB_PAIR(0x4F75A651, 0x5D6FEF39), LIMB_PAIR(0x25A708AD, 0x10AF79C4), LIMB_PAIR(0x5BB99922, 0x6B2B5A07),
+        LIMB_PAIR(0x9CDCA868, 0xB849863C), LIMB_PAIR(0xB8714AD0, 0xC83F44DB), LIMB_PAIR(0x0C36168D, 0xFE3EE356), LIMB_PAIR(0x1E05FBC1, 0x78A6D779),
+        LIMB_PAIR(0x47A0B976, 0x58BF704B), LIMB_PAIR(0x741748D5, 0xA601B355), LIMB_PAIR(0xD542F590, 0xAA2B1FB1), LIMB_PAIR(0x4AD55D00, 0x725C7FFC)
+    },
+    {   // 27 * B
+        LIMB_PAIR(0xD1CF99B2, 0xE4426715), LIMB_PAIR(0x02A20D34, 0x7352D511), LIMB_PAIR(0x8B12109F, 0x23D1157B), LIMB_PAIR(0x7CB1F3A3, 0x794CC927),
+        LIMB_PAIR(0x1CD098C0, 0x91802BF7), LIMB_PAIR(0xED5E6366, 0xFE416CA4), LIMB_PAIR(0x4902994C, 0xDF585D71), LIMB_PAIR(0xF855FAE7, 0x4CD54625),
+        LIMB_PAIR(0xC2AC5053, 0x4AF6C426), LIMB_PAIR(0x32F67258, 0xBC9AEDAD), LIMB_PAIR(0x0A311021, 0x2AD032F1), LIMB_PAIR(0x6FCC8E85, 0x7008357B)
+    },
+    {   // 29 * B
+        LIMB_PAIR(0x38773F01, 0x0B886727), LIMB_PAIR(0x95FBCCFB, 0xB8CCC8FA), LIMB_PAIR(0xB9AD29B6, 0x8D2DD5A3), LIMB_PAIR(0x51AD0F6A, 0x06EF7E98),
+        LIMB_PAIR(0x82584A34, 0xD01B9FBB), LIMB_PAIR(0xD2B4792B, 0x47AB6463), LIMB_PAIR(0x48536202, 0xB631639C), LIMB_PAIR(0x69D6D428, 0x13A92A36),
+        LIMB_PAIR(0xC0577DE5, 0xCA93771C), LIMB_PAIR(0x5035DC5C, 0x7540E41E), LIMB_PAIR(0xD802E071, 0x24680F01), LIMB_PAIR(0x8A2AF86A, 0x3C296DDF)
+    },
+    {   // 31 * B
+        LIMB_PAIR(0xD914A713, 0xAEAD15F9), LIMB_PAIR(0x8C8FF912, 0xA92F7BF9), LIMB_PAIR(0x9F53D730, 0xAFF82317), LIMB_PAIR(0x490C77BA, 0x7A99D393),
+        LIMB_PAIR(0xBB1F2541, 0xFCEB4D2E), LIMB_PAIR(0x40ADB91F, 0xB89510C7), LIMB_PAIR(0xD0A1AD05, 0xFC71A37D), LIMB_PAIR(0x0747717B, 0x0A892C70),
+        LIMB_PAIR(0x36BDA3E8, 0x8F52ED24), LIMB_PAIR(0x57E80794, 0x77A8C841), LIMB_PAIR(0x262F9CE0, 0xA5A96563), LIMB_PAIR(0x8302F7D2, 0x286762D2)
+    },
+    {   // 33 * B
+        LIMB_PAIR(0x3CE35B25, 0x4E783609), LIMB_PAIR(0xB26BAA97, 0x82E1181D), LIMB_PAIR(0xCBC7B83F, 0x0CC192D3), LIMB_PAIR(0x6A9D9D3A, 0x32F1DA04),
+        LIMB_PAIR(0xCE2EF5BD, 0x7C558E2B), LIMB_PAIR(0x6747BC63, 0xE4986CB4), LIMB_PAIR(0x3BBB89B8, 0x154A179F), LIMB_PAIR(0xD6F1767A, 0x7686F2A3),
+        LIMB_PAIR(0x6D597C6A, 0xAA8D12A6), LIMB_PAIR(0x04D3852B, 0x8F119303), LIMB_PAIR(0xC209B022, 0x3F91DC73), LIMB_PAIR(0xA9AD28A6, 0x561305F8)
+    },
+    {   // 35 * B
+        LIMB_PAIR(0xEC92AED1, 0x100C978D), LIMB_PAIR(0x4D6D73E5, 0xCA43D543), LIMB_PAIR(0xD847BA48, 0x83131B22), LIMB_PAIR(0xE35D4D2C, 0x00AAEC53),
+        LIMB_PAIR(0xE7B0C0D5, 0x6722CC28), LIMB_PAIR(0xDB075C53, 0x709DE9BB), LIMB_PAIR(0xD7010A61, 0xCAF68DA7), LIMB_PAIR(0x2C57CC6C, 0x030A1AEF),
+        LIMB_PAIR(0x003AD2AA, 0x7BB1F773), LIMB_PAIR(0x2B216608, 0x0B3F2980), LIMB_PAIR(0x520ED23E, 0x7821DC86), LIMB_PAIR(0x24065480, 0x20BE9C1C)
+    },
+    {   // 37 * B
+        LIMB_PAIR(0x249673A6, 0xE15387D8), LIMB_PAIR(0xF546E493, 0x5943BC2D), LIMB_PAIR(0xC36F63B5, 0x1C7F9A81), LIMB_PAIR(0x1F0AC1DE, 0x750AB336),
+        LIMB_PAIR(0xE2025E60, 0x20E0E44A), LIMB_PAIR(0xCBDCB938, 0xB03B3B2F), LIMB_PAIR(0xF95A0D1C, 0x105D639C), LIMB_PAIR(0x5067E311, 0x69764C54),
+        LIMB_PAIR(0xA2F81037, 0x1E8A3283), LIMB_PAIR(0xBD7FCBF1, 0x6F2EDA23), LIMB_PAIR(0xAC2E2563, 0xB72FD15B), LIMB_PAIR(0xB7075040, 0x54F96B3F)
+    },
+    {   // 39 * B
+        LIMB_PAIR(0x29669279, 0x0FADF204), LIMB_PAIR(0x7D7D724A, 0x3ADDA204), LIMB_PAIR(0x8C5760F1, 0x6F3D9482), LIMB_PAIR(0x2BB7539E, 0x3D7FE9C5),
+        LIMB_PAIR(0x16B11ECD, 0x177DAFC6), LIMB_PAIR(0xFA576479, 0x89764B9C), LIMB_PAIR(0xE6ECE785, 0xB7A8A110), LIMB_PAIR(0xBE85DBF0, 0x78E6839F),
+        LIMB_PAIR(0x37B8856B, 0x70332DF7), LIMB_PAIR(0x041A178A, 0x75D05D43), LIMB_PAIR(0xA0E59E22, 0x320FF74A), LIMB_PAIR(0x50088242, 0x70F268F3)
+    },
+    {   // 41 * B
+        LIMB_PAIR(0xB1805F47, 0x66864583), LIMB_PAIR(0x60DD7C19, 0xF535C5D1), LIMB_PAIR(0x1E4CB006, 0xE9874EB7), LIMB_PAIR(0xFAD889D9, 0x7C0D345C),
+        LIMB_PAIR(0x70DCF355, 0x23241120), LIMB_PAIR(0xE7FCE117, 0x380CC97E), LIMB_PAIR(0x3552B698, 0xB31DDEED), LIMB_PAIR(0x39B8C4B9, 0x404E56C0),
+        LIMB_PAIR(0x8C78338A, 0x591F1F4B), LIMB_PAIR(0x67E0B5E1, 0xA0366AB1), LIMB_PAIR(0xB45F3D44, 0x5CBC4152), LIMB_PAIR(0x2AAEC777, 0x20D75476)
+    },
+    {   // 43 * B
+        LIMB_PAIR(0xC73BB758, 0x5E8FC36F), LIMB_PAIR(0x363CBB9A, 0xACE543A5), LIMB_PAIR(0x903BC922, 0xA9934A7D), LIMB_PAIR(0xF3CEEC62, 0x2B8F1E46),
+        LIMB_PAIR(0x35B9F543, 0x9D74FEB1), LIMB_PAIR(0xDE8C956C, 0x84B37DF1), LIMB_PAIR(0x57138BA9, 0xE9322B07), LIMB_PAIR(0x790B4CE1, 0x38B8ADA8),
+        LIMB_PAIR(0xDF51F95D, 0xB5C04A9C), LIMB_PAIR(0xCB1FDEAC, 0x2B3952AE), LIMB_PAIR(0x328B66DA, 0x1D106D8B), LIMB_PAIR(0xCEBA1953, 0x049AEB32)
+    },
+    {   // 45 * B
+        LIMB_PAIR(0x75FC7931, 0xAA507D0B), LIMB_PAIR(0x7A6725D3, 0x0FEF924B), LIMB_PAIR(0x396B3930, 0x1D82542B), LIMB_PAIR(0x30F674FC, 0x795EE175),
+        LIMB_PAIR(0x63DCFE7E, 0xD7767D3C), LIMB_PAIR(0x97856E40, 0x209C5948), LIMB_PAIR(0xE14F7C13, 0xB6676861), LIMB_PAIR(0xC8D625FC, 0x51C665E0),
+        LIMB_PAIR(0x52ECBD81, 0x254A5B0A), LIMB_PAIR(0xE034AFE7, 0x5D411F6E), LIMB_PAIR(0xCAEE4A31, 0xE6A24D0D), LIMB_PAIR(0x9DC54477, 0x6CD19BF4)
+    },
+    {   // 47 * B
+        LIMB_PAIR(0x65AFC386, 0x1FFE6121), LIMB_PAIR(0xB8D51B10, 0x082A2A88), LIMB_PAIR(0x20990BAA, 0x76F6627E), LIMB_PAIR(0x429E43E7, 0x5E01B3A7),
+        LIMB_PAIR(0x52179CA3, 0x7E876190), LIMB_PAIR(0x0B2C9F85, 0x571D0A06), LIMB_PAIR(0x8499711E, 0x80A2BAA8), LIMB_PAIR(0x40B2E638, 0x7520F3DB),
+        LIMB_PAIR(0xD39357A1, 0x3DB50BE3), LIMB_PAIR(0x599E94A5, 0x967B6CDD), LIMB_PAIR(0xDF311E6E, 0x1A309A64), LIMB_PAIR(0xCEF3C986, 0x71092C9C)
+    },
+    {   // 49 * B
+        LIMB_PAIR(0x74051DCF, 0x856BD8AC), LIMB_PAIR(0x55B7AA1E, 0x03F6A408), LIMB_PAIR(0xC9743CEB, 0x3A4AE7CB), LIMB_PAIR(0x7137ABDE, 0x4173A5BB),
+        LIMB_PAIR(0x0364918C, 0x53D8523F), LIMB_PAIR(0x3FAB6B1C, 0xA2B404F4), LIMB_PAIR(0x6681E5A4, 0x080B4A9E), LIMB_PAIR(0xD0257BA7, 0x0EA15B03),
+        LIMB_PAIR(0xF0F9218A, 0x17C56E31), LIMB_PAIR(0x1AFC4708, 0x5A696E2B), LIMB_PAIR(0xF4B2F176, 0xF7931668), LIMB_PAIR(0x4A4E3A67, 0x5FC56561)
+    },
+    {   // 51 * B
+        LIMB_PAIR(0x7790988E, 0x4892E1E6), LIMB_PAIR(0x1C5CD722, 0x01D5950F), LIMB_PAIR(0xE5923EED, 0xE3B0819A), LIMB_PAIR(0x9D46651B, 0x3214C740),
+        LIMB_PAIR(0xC46D7AE5, 0x136E570D), LIMB_PAIR(0x54F8DC8F, 0x0FD0AACC), LIMB_PAIR(0x310DAD86, 0x59549F03), LIMB_PAIR(0x4C454AA1, 0x62711C41),
+        LIMB_PAIR(0x06651770, 0x13298274), LIMB_PAIR(0x8A279436, 0x3BA4A066), LIMB_PAIR(0x185D223C, 0xD9B6B8EC), LIMB_PAIR(0x3ECB833C, 0x5BEA9407)
+    },
+    {   // 53 * B
+        LIMB_PAIR(0xF343D2F8, 0xB470CE63), LIMB_PAIR(0x0543E8F1, 0x0067BA8F), LIMB_PAIR(0xA2117B6F, 0x35DA51A1), LIMB_PAIR(0x44F1BD2F, 0x4AD07859),
+        LIMB_PAIR(0x12C89BE4, 0x641DBF09), LIMB_PAIR(0x7D6E579C, 0xACF38B31), LIMB_PAIR(0xF697B065, 0xABFE9E02), LIMB_PAIR(0x48F61EEC, 0x3AACD5C1),
+        LIMB_PAIR(0xC3318301, 0x858E3B34), LIMB_PAIR(0x07316826, 0xDC99C047), LIMB_PAIR(0xD39DA88C, 0x34085B2E), LIMB_PAIR(0xD902853D, 0x3AFF0CB1)
+    },
+    {   // 55 * B
+        LIMB_PAIR(0xF4C53505, 0x9226430B), LIMB_PAIR(0x261F2283, 0x68E49C13), LIMB_PAIR(0x8FD327C6, 0x09EF3378), LIMB_PAIR(0x2BD99E7F, 0x2CCF9F73),
+        LIMB_PAIR(0x3A20405E, 0x87C5C7EB), LIMB_PAIR(0xEDAD56C9, 0x8EE311EF), LIMB_PAIR(0xAD29D5F9, 0x29252E48), LIMB_PAIR(0xF4CD251D, 0x110E7E86),
+        LIMB_PAIR(0xD603F5E4, 0x57C0D89E), LIMB_PAIR(0xF0B0200C, 0x12888628), LIMB_PAIR(0xA02E3BB7, 0x53172709), LIMB_PAIR(0xB9693A37, 0x05C557E0)
+    },
+    {   // 57 * B
+        LIMB_PAIR(0x89C20EB0, 0xF776BBB0), LIMB_PAIR(0xFA0FD85C, 0x61F85BF6), LIMB_PAIR(0x634421FB, 0xB6B93F4E), LIMB_PAIR(0x41861205, 0x289FEF08),
+        LIMB_PAIR(0x1FC97E6F, 0xD8F9CE31), LIMB_PAIR(0x11F9FDAE, 0x7A3F2630), LIMB_PAIR(0x8BED25DD, 0xE15B7EA0), LIMB_PAIR(0x8FE9875A, 0x6E154C17),
+        LIMB_PAIR(0xFED69ABF, 0xCF616336), LIMB_PAIR(0x8335C94F, 0x9B16E4E7), LIMB_PAIR(0x753A7FE7, 0x13789765), LIMB_PAIR(0xA95CA319, 0x6AFBF642)
+    },
+    {   // 59 * B
+        LIMB_PAIR(0xF913A8CC, 0x5DE55070), LIMB_PAIR(0x2B0CF561, 0x7D1D167B), LIMB_PAIR(0x90EAD489, 0xDA2956B6), LIMB_PAIR(0xDB801ED9, 0x12C093CE),
+        LIMB_PAIR(0x62F5D2C1, 0x7DA8DE0C), LIMB_PAIR(0xB00E7B9A, 0x98FC3DA4), LIMB_PAIR(0x0DAD70E0, 0x7DEB6ADA), LIMB_PAIR(0xB95038C4, 0x0DB4B851),
+        LIMB_PAIR(0x08B8190F, 0xFC147F93), LIMB_PAIR(0xA11AE310, 0x06969DA0), LIMB_PAIR(0xDAC7D7FD, 0xCEE75572), LIMB_PAIR(0xC6635CE6, 0x33AA8799)
+    },
+    {   // 61 * B
+        LIMB_PAIR(0xFC156CB1, 0x8348F588), LIMB_PAIR(0x1A0A6D27, 0x6DA2BA9B), LIMB_PAIR(0x87CA5AB6, 0xE2262D5C), LIMB_PAIR(0xC8D589A6, 0x212CD0C1),
+        LIMB_PAIR(0xBD085CF2, 0xAF0FF51E), LIMB_PAIR(0x67D33F1F, 0x78F51A89), LIMB_PAIR(0x5060033C, 0x6EC2BFE1), LIMB_PAIR(0xE8E21A86, 0x233C6F29),
+        LIMB_PAIR(0x7F18C781, 0xD2F4D510), LIMB_PAIR(0x527E9D28, 0x122ECDF2), LIMB_PAIR(0x3D3D3341, 0xA70A862A), LIMB_PAIR(0x11914CE3, 0x1DB77789)
+    },
+    {   // 63 * B
+        LIMB_PAIR(0xDD701AB6, 0xB3394769), LIMB_PAIR(0x19CF8DA5, 0xE2B8DED4), LIMB_PAIR(0xFD2AC852, 0x15DF4161), LIMB_PAIR(0x017D24BE, 0x7AE2CA8A),
+        LIMB_PAIR(0x7C6BC26F, 0xDDF35239), LIMB_PAIR(0x53D50113, 0x7A97E2CC), LIMB_PAIR(0xBF79A330, 0x7C74F43A), LIMB_PAIR(0x26E2ADFC, 0x31AD97AD),
+        LIMB_PAIR(0x0920B962, 0xB7E817ED), LIMB_PAIR(0x3F19DA9D, 0x1E8518CC), LIMB_PAIR(0x25560A64, 0xE491C14F), LIMB_PAIR(0xA6622C83, 0x1ED1FC53)
+    }
+};
+
+#endif
@@ -0,0 +1,7050 @@
+/*
+ * Copyright (C) 2015 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef CRYPTO_P521BASETABLE_H
+#define CRYPTO_P521BASETABLE_H
+
+// Precomputed multiples of the P-521 generator G, included by P521.cpp
+// only.  Every point is in affine form as (x, y), with each value fully
+// reduced modulo p.
+//
+// Row i holds 1 * 16^k * G to 8 * 16^k * G for k = i * P521_BASE_TABLE_SPACING.
+// Rows for the other values of k are left out of the build.
+//
+// P521_baseOddTable holds the odd multiples 1 * G to 63 * G for the width-7
+// NAF in P521::evaluateDouble().
+//
+// Generated by extras/host/P521BaseTableGen.cpp from the curve parameters
+// in NIST FIPS 186-4; do not edit by hand.
+
+static limb_t const P521_baseTable[P521_BASE_ROWS][8][2 * NUM_LIMBS_521BIT] PROGMEM = {
+#if (0 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^0 * G
+            LIMB_PAIR(0xC2E5BD66, 0xF97E7E31), LIMB_PAIR(0x856A429B, 0x3348B3C1), LIMB_PAIR(0xA2FFA8DE, 0xFE1DC127), LIMB_PAIR(0xEFE75928, 0xA14B5E77),
+            LIMB_PAIR(0x6B4D3DBA, 0xF828AF60), LIMB_PAIR(0x053FB521, 0x9C648139), LIMB_PAIR(0x2395B442, 0x9E3ECB66), LIMB_PAIR(0x0404E9CD, 0x858E06B7), LIMB_PARTIAL(0x0C6),
+            LIMB_PAIR(0x9FD16650, 0x88BE9476), LIMB_PAIR(0xA272C240, 0x353C7086), LIMB_PAIR(0x3FAD0761, 0xC550B901), LIMB_PAIR(0x5EF42640, 0x97EE7299),
+            LIMB_PAIR(0x273E662C, 0x17AFBD17), LIMB_PAIR(0x579B4468, 0x98F54449), LIMB_PAIR(0x2C7D1BD9, 0x5C8A5FB4), LIMB_PAIR(0x9A3BC004, 0x39296A78), LIMB_PARTIAL(0x118)
+        },
+        {   // 2 * 16^0 * G
+            LIMB_PAIR(0xBA6D783D, 0xF43E3933), LIMB_PAIR(0xD60FD967, 0xCF2FA364), LIMB_PAIR(0x35C5AF41, 0xAA104A3A), LIMB_PAIR(0x6EF55507, 0xB3B204DA),
+            LIMB_PAIR(0xD769BE97, 0x2C6E5505), LIMB_PAIR(0x1CCC0635, 0x7403279B), LIMB_PAIR(0x48C28274, 0x2FCB2881), LIMB_PAIR(0x277E7E68, 0x3C219024), LIMB_PARTIAL(0x043),
+            LIMB_PAIR(0x61F41B02, 0x1BE356D6), LIMB_PAIR(0xEDC0F4F7, 0xEAFCBE95), LIMB_PAIR(0x9A3248F4, 0x93937FA9), LIMB_PAIR(0x9F251F6B, 0xB3E377DE),
+            LIMB_PAIR(0x06C42DBB, 0xAB21A299), LIMB_PAIR(0x4DA97740, 0xC6B5107C), LIMB_PAIR(0xEED3F0B5, 0xA7F3ECEE), LIMB_PAIR(0x6DB26700, 0xBB8CC7F8), LIMB_PARTIAL(0x0F4)
+        },
+        {   // 3 * 16^0 * G
+            LIMB_PAIR(0xDE37AD7D, 0xA5919D2E), LIMB_PAIR(0x2C32EA05, 0xAEB49086), LIMB_PAIR(0xB59FE21B, 0x1DA6BD16), LIMB_PAIR(0x3A483205, 0xAD3F164A),
+            LIMB_PAIR(0x2D7A8DD1, 0xE5AD7A11), LIMB_PAIR(0x123D9AB9, 0xB52A6E5B), LIMB_PAIR(0xB5959479, 0xD91D6A64), LIMB_PAIR(0xDE29195D, 0x3D352443), LIMB_PARTIAL(0x1A7),
+            LIMB_PAIR(0xEE86C0E5, 0x5F588CA1), LIMB_PAIR(0x93A59042, 0xF105C9BC), LIMB_PAIR(0xDEC3C70C, 0x2D5ACED1), LIMB_PAIR(0x8DC575B0, 0x2E2DD4CF),
+            LIMB_PAIR(0xA355CEEC, 0xD2F8AB1F), LIMB_PAIR(0x2A9D0317, 0xF1557FA8), LIMB_PAIR(0xCAB814F2, 0x979F86C6), LIMB_PAIR(0xFA62DDD9, 0x9B03B97D), LIMB_PARTIAL(0x13E)
+        },
+        {   // 4 * 16^0 * G
+            LIMB_PAIR(0x871902F3, 0xFBC87412), LIMB_PAIR(0x08E5A5E2, 0xA1D5025B), LIMB_PAIR(0x078AF066, 0xE8B88E9F), LIMB_PAIR(0xFE3D0750, 0x8659E24A),
+            LIMB_PAIR(0x41D3CEAC, 0x06C5D555), LIMB_PAIR(0x5FF39AFC, 0xC61C891C), LIMB_PAIR(0x7C9070CD, 0x54B48348), LIMB_PAIR(0x2AC204C3, 0xB5DF64AE), LIMB_PARTIAL(0x035),
+            LIMB_PAIR(0x346E4D0D, 0xE21F47FC), LIMB_PAIR(0x4699D1D9, 0xBB7FAEF0), LIMB_PAIR(0xA95B85EE, 0x5224F750), LIMB_PAIR(0x4BA38540, 0x79F283E5),
+            LIMB_PAIR(0xF19907F2, 0x5AE63FE2), LIMB_PAIR(0xE6E32E1B, 0x5521AEF6), LIMB_PAIR(0xB0B4ABB6, 0x73E0178E), LIMB_PAIR(0x1279D2B6, 0x096F8426), LIMB_PARTIAL(0x082)
+        },
+        {   // 5 * 16^0 * G
+            LIMB_PAIR(0xEC8F3078, 0xD5AB5096), LIMB_PAIR(0xD8931738, 0x29D7E1E6), LIMB_PAIR(0x137E79A3, 0x7112FEAF), LIMB_PAIR(0x5E301423, 0x383C0C6D),
+            LIMB_PAIR(0xF177ACE4, 0xCF03DAB8), LIMB_PAIR(0xB53F0D24, 0x7A596EFD), LIMB_PAIR(0xC04EB0BF, 0x3DBC3391), LIMB_PAIR(0x27A432C7, 0x2BF3C529), LIMB_PARTIAL(0x065),
+            LIMB_PAIR(0xDEB090CB, 0x173CC3E8), LIMB_PAIR(0x7354F7F8, 0xD1F00725), LIMB_PAIR(0x1CF5FF79, 0x31154021), LIMB_PAIR(0x072CF374, 0xBB6897C9),
+            LIMB_PAIR(0xA0347087, 0xEDD817C9), LIMB_PAIR(0x872E0051, 0x1CD8FE8E), LIMB_PAIR(0x4A811291, 0x8A2B7311), LIMB_PAIR(0x6601D6EC, 0xE6EF1BDD), LIMB_PARTIAL(0x15B)
+        },
+        {   // 6 * 16^0 * G
+            LIMB_PAIR(0xF79206B9, 0x23731BED), LIMB_PAIR(0x57F380AE, 0x2F66E956), LIMB_PAIR(0x9531BE8C, 0xE0727A23), LIMB_PAIR(0x153F7394, 0x5FBCCA16),
+            LIMB_PAIR(0xE4AB0152, 0x981506AD), LIMB_PAIR(0x7FD71CF3, 0x623D3097), LIMB_PAIR(0x4480D195, 0x2EFF34F9), LIMB_PAIR(0xB5921953, 0x4569D6CD), LIMB_PARTIAL(0x1EE),
+            LIMB_PAIR(0x58D44F17, 0x1EACCD78), LIMB_PAIR(0x5CA0DADE, 0x3DC7B8B5), LIMB_PAIR(0xE274F220, 0xF96C984D), LIMB_PAIR(0x56648C9D, 0xCAB72D0E),
+            LIMB_PAIR(0x201A8A96, 0x7240A926), LIMB_PAIR(0xDA5A808E, 0x2AABBB73), LIMB_PAIR(0x46E3B111, 0xE2DD2705), LIMB_PAIR(0xC64F586A, 0x0255AD0C), LIMB_PARTIAL(0x1DE)
+        },
+        {   // 7 * 16^0 * G
+            LIMB_PAIR(0x2816ECD4, 0x01CEAD88), LIMB_PAIR(0xFDC2619A, 0x6F953F50), LIMB_PAIR(0xDCE3BBC4, 0xC9A6DF30), LIMB_PAIR(0xBFC698D8, 0x8C308D0A),
+            LIMB_PAIR(0xF7114C5D, 0xF018D2C2), LIMB_PAIR(0xF5483228, 0x5F22E0E8), LIMB_PAIR(0x0B073A0C, 0xEEB65FDA), LIMB_PAIR(0x5B7F6346, 0xD5D1D99D), LIMB_PARTIAL(0x056),
+            LIMB_PAIR(0x0525251B, 0x5C6B8BC9), LIMB_PAIR(0x5DDEFC7B, 0x9E76712A), LIMB_PAIR(0x91CE1A5F, 0x9523A345), LIMB_PAIR(0xCDEC9E2B, 0x6BD0F293),
+            LIMB_PAIR(0x26CBDE55, 0x71DBD98A), LIMB_PAIR(0x2824F0DD, 0xB5C582D0), LIMB_PAIR(0x39D68478, 0xD1D8317A), LIMB_PAIR(0xAAA2A110, 0x2D1B7D9B), LIMB_PARTIAL(0x03D)
+        },
+        {   // 8 * 16^0 * G
+            LIMB_PAIR(0xAA78CE68, 0x86F9EA54), LIMB_PAIR(0xA6F40405, 0xB56289B5), LIMB_PAIR(0xC8D79E1A, 0x8B598C1B), LIMB_PAIR(0x579F49F0, 0x5BFEA5B8),
+            LIMB_PAIR(0xF826298F, 0x8B8A3B05), LIMB_PAIR(0x9B003E0A, 0xD4E29D8A), LIMB_PAIR(0xB010E25B, 0xA8348396), LIMB_PAIR(0x301F7262, 0x22C40FB6), LIMB_PARTIAL(0x008),
+            LIMB_PAIR(0x1F17801C, 0x8AD642F1), LIMB_PAIR(0x09471353, 0x9F3BA940), LIMB_PAIR(0x65C57869, 0xF0BA0DF0), LIMB_PAIR(0x5911B4BF, 0x89E9C0AA),
+            LIMB_PAIR(0x0677A8F1, 0x5083DE61), LIMB_PAIR(0xE2C0715B, 0x44F8EDE9), LIMB_PAIR(0x78853B9A, 0x48FDAB6E), LIMB_PAIR(0x42FC4820, 0x31911D55), LIMB_PARTIAL(0x163)
+        }
+    },
+#endif
+#if (1 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^1 * G
+            LIMB_PAIR(0x81A8402F, 0x3A6C508F), LIMB_PAIR(0x07DCDC53, 0x0DBF5C80), LIMB_PAIR(0x985630DF, 0xE5965DA7), LIMB_PAIR(0x61CA00A0, 0x943FF188),
+            LIMB_PAIR(0x0B188A52, 0xD632F8D2), LIMB_PAIR(0x92FD3F3D, 0x2A87F661), LIMB_PAIR(0xAC743B0B, 0xDA97DA26), LIMB_PAIR(0x9C8AD05D, 0x7D10D8A8), LIMB_PARTIAL(0x1D1),
+            LIMB_PAIR(0x9BC73ABE, 0x52E272F8), LIMB_PAIR(0x8D186333, 0x9E3004D2), LIMB_PAIR(0x9D998852, 0x0B3075AC), LIMB_PAIR(0x8DB547AA, 0xC182E139),
+            LIMB_PAIR(0x4B6B82C1, 0xC7CA30C9), LIMB_PAIR(0xB800D50E, 0x1335E4C3), LIMB_PAIR(0x3D3E6972, 0xC714B18D), LIMB_PAIR(0x2D77001F, 0x37343C58), LIMB_PARTIAL(0x07A)
+        },
+        {   // 2 * 16^1 * G
+            LIMB_PAIR(0x76E56A9E, 0x47915AB8), LIMB_PAIR(0xD6C5C782, 0x9CF7475C), LIMB_PAIR(0xBA5D1F94, 0x67D69BD6), LIMB_PAIR(0xC73596EC, 0xEA04A35D),
+            LIMB_PAIR(0xB9E5EBD6, 0xDBA7ECEF), LIMB_PAIR(0x4E068038, 0x3E3E1665), LIMB_PAIR(0x4BA15B34, 0x43707AF9), LIMB_PAIR(0x0A3A4694, 0xBA3596D2), LIMB_PARTIAL(0x166),
+            LIMB_PAIR(0x14A156AA, 0x95CA9A99), LIMB_PAIR(0xAB961636, 0xCD98C965), LIMB_PAIR(0xEA0F36DF, 0xB74DE1C7), LIMB_PAIR(0x18CDD6B9, 0xE204CDB8),
+            LIMB_PAIR(0x5C2DD77D, 0xC1DF01C6), LIMB_PAIR(0x5FF01967, 0xFF7BD8BF), LIMB_PAIR(0xF3E08268, 0x1635E75F), LIMB_PAIR(0x940AB811, 0x7B0FF4D1), LIMB_PARTIAL(0x047)
+        },
+        {   // 3 * 16^1 * G
+            LIMB_PAIR(0x2AD879AD, 0x87027D61), LIMB_PAIR(0x214AEA2C, 0x641752BD), LIMB_PAIR(0x0FF08EE6, 0xDEDC21B1), LIMB_PAIR(0x3F6FBFAC, 0x2DA0980F),
+            LIMB_PAIR(0x803E72F4, 0x4B3CC8A5), LIMB_PAIR(0x72102C33, 0xAE7D6D66), LIMB_PAIR(0xEC62C8CC, 0x8158E5CA), LIMB_PAIR(0x557462AC, 0x35DE3B21), LIMB_PARTIAL(0x1FB),
+            LIMB_PAIR(0xD256D46B, 0xB1958193), LIMB_PAIR(0x4841CAE7, 0x596F2480), LIMB_PAIR(0xFB0E3C28, 0xB7C142E0), LIMB_PAIR(0xA1D97E37, 0xE6214D64),
+            LIMB_PAIR(0x6CC2E1BA, 0x871294F6), LIMB_PAIR(0x4D09E2CC, 0x76F27FC9), LIMB_PAIR(0x4BB3F5C1, 0xA855B9EC), LIMB_PAIR(0x87992DED, 0x34A5AC15), LIMB_PARTIAL(0x18D)
+        },
+        {   // 4 * 16^1 * G
+            LIMB_PAIR(0xE320F742, 0xB53DC38C), LIMB_PAIR(0x9A04FD41, 0xF5AAB802), LIMB_PAIR(0x03E7001D, 0xA7C02C16), LIMB_PAIR(0xEFDA3773, 0x1BEBD3C5),
+            LIMB_PAIR(0xF8872D27, 0xB614B9CC), LIMB_PAIR(0x1860BBAC, 0x7EBDBBA8), LIMB_PAIR(0x92FEC2A6, 0x4F3D7C03), LIMB_PAIR(0x1112ECD1, 0x9AA17DCE), LIMB_PARTIAL(0x1AB),
+            LIMB_PAIR(0xA5F8DF5B, 0x5AF17058), LIMB_PAIR(0xA0653DD4, 0xC1C1A5DB), LIMB_PAIR(0xAF958043, 0xF4A7B9E3), LIMB_PAIR(0x508D4B10, 0xAC165BA1),
+            LIMB_PAIR(0x9E87AB8B, 0x0C63BA36), LIMB_PAIR(0x2FB1DC1D, 0x9BB1CC8B), LIMB_PAIR(0x57B9586D, 0xAA10217C), LIMB_PAIR(0x8E920573, 0x8D70EB84), LIMB_PARTIAL(0x074)
+        },
+        {   // 5 * 16^1 * G
+            LIMB_PAIR(0x437E2BC8, 0xE19A15BD), LIMB_PAIR(0x4007851E, 0x7FC53AE2), LIMB_PAIR(0x93597630, 0xE8C0B16E), LIMB_PAIR(0xB83FC6BF, 0xCDF7D2A0),
+            LIMB_PAIR(0xAF8B0DE1, 0x31293A9D), LIMB_PAIR(0x2DB6458A, 0x54ECED79), LIMB_PAIR(0xD3F4D699, 0x47749B5D), LIMB_PAIR(0xF68D676E, 0xC57327BE), LIMB_PARTIAL(0x0BF),
+            LIMB_PAIR(0xE7A2B137, 0x7D44E666), LIMB_PAIR(0xB737AF35, 0x88F136D2), LIMB_PAIR(0xA49882E8, 0xCD66D0FE), LIMB_PAIR(0xFDB747C6, 0x1D9971D0),
+            LIMB_PAIR(0xB293A9E3, 0x8AFF486A), LIMB_PAIR(0x6A44B0AB, 0x23D4E763), LIMB_PAIR(0x81AC01C2, 0x2444864E), LIMB_PAIR(0x8C059532, 0x876EC073), LIMB_PARTIAL(0x152)
+        },
+        {   // 6 * 16^1 * G
+            LIMB_PAIR(0x8A0CDCAE, 0x36330198), LIMB_PAIR(0xEDE0567F, 0xAEC73C0B), LIMB_PAIR(0x9E703ECE, 0x06EEB9D0), LIMB_PAIR(0xE691A29C, 0xE186A6BD),
+            LIMB_PAIR(0x8BFEFE8E, 0x6A18AE70), LIMB_PAIR(0x7AA06CBF, 0x2D462FDB), LIMB_PAIR(0x5D2C26B6, 0x514395C1), LIMB_PAIR(0xC4D6397B, 0x2A9DE556), LIMB_PARTIAL(0x073),
+            LIMB_PAIR(0x933C845D, 0x4BB9959C), LIMB_PAIR(0xBF3469BD, 0x8EDF1BF0), LIMB_PAIR(0x133FFD1F, 0xC5EC420F), LIMB_PAIR(0x7296E01E, 0x14415F7B),
+            LIMB_PAIR(0x33D9EAC9, 0xD86A7FFD), LIMB_PAIR(0x8424A686, 0x959253AA), LIMB_PAIR(0xAA7FFA7F, 0x82666FC7), LIMB_PAIR(0xAF012552, 0x6BE2B1B7), LIMB_PARTIAL(0x1ED)
+        },
+        {   // 7 * 16^1 * G
+            LIMB_PAIR(0xAF1479F7, 0x2B05A8D8), LIMB_PAIR(0xBA3231E4, 0x65B390E9), LIMB_PAIR(0x3041C9DC, 0xD388A223), LIMB_PAIR(0x19B3DC8E, 0xA5B816F1),
+            LIMB_PAIR(0x3B9C4734, 0xEDD4115A), LIMB_PAIR(0xA39C61F7, 0x2C8DFCD8), LIMB_PAIR(0x8D0116E7, 0x551DB00F), LIMB_PAIR(0x0D028C25, 0x9CE6F088), LIMB_PARTIAL(0x131),
+            LIMB_PAIR(0xBA67433B, 0x77E037B1), LIMB_PAIR(0xD9EEC2D6, 0x63FA7EDA), LIMB_PAIR(0x7541D914, 0x9AFA419E), LIMB_PAIR(0xF5C81E67, 0x18F69214),
+            LIMB_PAIR(0x30E731FB, 0x4875FA4A), LIMB_PAIR(0x705AA418, 0x933EC3A9), LIMB_PAIR(0x1178C743, 0x05F26F5E), LIMB_PAIR(0x259B440E, 0xD5F38E18), LIMB_PARTIAL(0x013)
+        },
+        {   // 8 * 16^1 * G
+            LIMB_PAIR(0x736FA9E0, 0x76B026E5), LIMB_PAIR(0xE23413B5, 0x2E27E720), LIMB_PAIR(0x6A5F814F, 0x51DF7081), LIMB_PAIR(0x76271D7D, 0x4E494968),
+            LIMB_PAIR(0x5CE07D97, 0xD3124AF7), LIMB_PAIR(0xC2D6DD2C, 0x3C9698BB), LIMB_PAIR(0x53023FA8, 0x631C0701), LIMB_PAIR(0x7E381F83, 0xD41259F2), LIMB_PARTIAL(0x17C),
+            LIMB_PAIR(0xC9DFB131, 0xBC309412), LIMB_PAIR(0x3472A8E4, 0x0E343409), LIMB_PAIR(0x64ACE613, 0x4E69C324), LIMB_PAIR(0xDC99AC8C, 0xA49FF4B0),
+            LIMB_PAIR(0xB1AF9CA9, 0x1B4FABC3), LIMB_PAIR(0xE7DF7966, 0xDCE01ED3), LIMB_PAIR(0xFBC7A682, 0x5330FFDE), LIMB_PAIR(0xA8283DCE, 0x6E5DF506), LIMB_PARTIAL(0x06F)
+        }
+    },
+#endif
+#if (2 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^2 * G
+            LIMB_PAIR(0x69BE00AC, 0xB38E8B90), LIMB_PAIR(0x95E50B81, 0xE46B33CB), LIMB_PAIR(0x1F5D4723, 0x9C9152C4), LIMB_PAIR(0x8C2A465A, 0x7B8F4F6E),
+            LIMB_PAIR(0xF269CB33, 0xB85FA9E8), LIMB_PAIR(0xCB5B47A9, 0x03C7389E), LIMB_PAIR(0x0F312E99, 0x458AFC78), LIMB_PAIR(0xB5AC20C9, 0xF40A0F02), LIMB_PARTIAL(0x1D5),
+            LIMB_PAIR(0x486BDE7F, 0x8FAC1245), LIMB_PAIR(0x4D4A7784, 0x1430CD50), LIMB_PAIR(0xBD29A67B, 0x58D2B99D), LIMB_PAIR(0x38E3BCEB, 0x965CF657),
+            LIMB_PAIR(0x57354F17, 0x062DC3AA), LIMB_PAIR(0xE5B45635, 0x40ED2A81), LIMB_PAIR(0x103B69C5, 0x981BBA93), LIMB_PAIR(0x413C42FC, 0x3503AA73), LIMB_PARTIAL(0x08E)
+        },
+        {   // 2 * 16^2 * G
+            LIMB_PAIR(0x9BD47F93, 0xA48E3C3A), LIMB_PAIR(0x636C0850, 0x4E1485E3), LIMB_PAIR(0xF0EA4F3C, 0xD8264F7F), LIMB_PAIR(0x044463C8, 0x0B9047FC),
+            LIMB_PAIR(0x8360FDF8, 0xB03311C9), LIMB_PAIR(0xD0DB7F48, 0x007C068D), LIMB_PAIR(0xD429AF87, 0x5E82C7E7), LIMB_PAIR(0x6D64D318, 0x5A81286A), LIMB_PARTIAL(0x00E),
+            LIMB_PAIR(0xEF97408E, 0xE1D75C7E), LIMB_PAIR(0x58A5E905, 0x7C54B93F), LIMB_PAIR(0x08C607D5, 0x0D8EEE9A), LIMB_PAIR(0xE2DEC0B5, 0x2AEAC3B0),
+            LIMB_PAIR(0x9FC99E2C, 0x96DB5CED), LIMB_PAIR(0x0A51C0AC, 0x27764DE2), LIMB_PAIR(0x1B15AD22, 0x7999170F), LIMB_PAIR(0xCED85F26, 0xDCFC7192), LIMB_PARTIAL(0x137)
+        },
+        {   // 3 * 16^2 * G
+            LIMB_PAIR(0xF62A4087, 0x49EB72C3), LIMB_PAIR(0x5B00B2BF, 0xEC873432), LIMB_PAIR(0x643C12A4, 0xBB040159), LIMB_PAIR(0xEAC95679, 0x2EF972F4),
+            LIMB_PAIR(0x2BBEA697, 0xC7E358BD), LIMB_PAIR(0xDB23F1B4, 0x924A6105), LIMB_PAIR(0xBDD61FE2, 0xD587C6BE), LIMB_PAIR(0xAAFC22CE, 0xF348D2F7), LIMB_PARTIAL(0x058),
+            LIMB_PAIR(0x930F49AA, 0x7BF1DEEC), LIMB_PAIR(0x3CEC939A, 0xFD3224C4), LIMB_PAIR(0x6D94E0BF, 0xAC7ECED3), LIMB_PAIR(0xB2C7B10F, 0x5EF5A81C),
+            LIMB_PAIR(0xF85C84D4, 0xA6E9C773), LIMB_PAIR(0x2F547B59, 0xE139B7AB), LIMB_PAIR(0x1FD522DB, 0x436BFFD6), LIMB_PAIR(0x0B189B69, 0x32EE281E), LIMB_PARTIAL(0x073)
+        },
+        {   // 4 * 16^2 * G
+            LIMB_PAIR(0x2986DAF8, 0x8A4D6B67), LIMB_PAIR(0x3F0247B1, 0xFF67C35D), LIMB_PAIR(0x0F48C2D6, 0x3E45F2E5), LIMB_PAIR(0x3663525B, 0xBA941FA4),
+            LIMB_PAIR(0x97FBDB12, 0xFE5A47AF), LIMB_PAIR(0x20AE9103, 0x617A16B8), LIMB_PAIR(0xC57A09D0, 0xFD6EEE9F), LIMB_PAIR(0xAD5FAD3B, 0x4BFFFDBE), LIMB_PARTIAL(0x18C),
+            LIMB_PAIR(0xE8839B07, 0x7C2CD6FC), LIMB_PAIR(0x23601344, 0xEE10CAB9), LIMB_PAIR(0x5F0B8F0B, 0xCEED1824), LIMB_PAIR(0x68064245, 0x6EA30ADB),
+            LIMB_PAIR(0xBF29705F, 0x66306DAD), LIMB_PAIR(0xBE7DB901, 0x4F9D0131), LIMB_PAIR(0x531D35DD, 0x1D972C0A), LIMB_PAIR(0x08EDCC09, 0x0FF3DA3C), LIMB_PARTIAL(0x0C9)
+        },
+        {   // 5 * 16^2 * G
+            LIMB_PAIR(0x1C6CAC89, 0xB491062B), LIMB_PAIR(0x9ADECC2E, 0xF20C5835), LIMB_PAIR(0x6F1D7401, 0x488D7B91), LIMB_PAIR(0x94761E60, 0xFF98B90E),
+            LIMB_PAIR(0x857557A9, 0xE63993CA), LIMB_PAIR(0xACDEADFC, 0xC4FF9951), LIMB_PAIR(0xFD8DCCAD, 0xED5A53C7), LIMB_PAIR(0xF101C24A, 0x42E02C14), LIMB_PARTIAL(0x12B),
+            LIMB_PAIR(0xBD3FE0EF, 0xBB9FE6F6), LIMB_PAIR(0xC1393D0B, 0x72F26FFC), LIMB_PAIR(0x6C25ED19, 0x2E831B19), LIMB_PAIR(0xEBCC6B99, 0xDB50A0D7),
+            LIMB_PAIR(0x245C479C, 0x202AC3C8), LIMB_PAIR(0x436117A0, 0x97B284D7), LIMB_PAIR(0xFD694E11, 0x13BD5E82), LIMB_PAIR(0x022193A6, 0x452B5A94), LIMB_PARTIAL(0x1C8)
+        },
+        {   // 6 * 16^2 * G
+            LIMB_PAIR(0x84367FEC, 0x65C7757B), LIMB_PAIR(0x6AA22FB7, 0x7FF69A4B), LIMB_PAIR(0x59B0A103, 0x197F4C36), LIMB_PAIR(0x12350397, 0x897241B7),
+            LIMB_PAIR(0x33BF2644, 0xEFB60DD0), LIMB_PAIR(0x944AF798, 0x3ED30A65), LIMB_PAIR(0x5BD2D770, 0xD67A5CBD), LIMB_PAIR(0xF3CAA508, 0xE9D97EA6), LIMB_PARTIAL(0x06E),
+            LIMB_PAIR(0x62FC83A9, 0x94633F86), LIMB_PAIR(0x29A5137E, 0x6D68A347), LIMB_PAIR(0x7BF9924D, 0x88F2B477), LIMB_PAIR(0x00B533FB, 0x7BD70FCC),
+            LIMB_PAIR(0xB7B8167F, 0x4DD3B695), LIMB_PAIR(0xD0162981, 0x85DFCA1C), LIMB_PAIR(0x43E5022C, 0x2F96A81F), LIMB_PAIR(0x14872DDF, 0x2596B2EF), LIMB_PARTIAL(0x131)
+        },
+        {   // 7 * 16^2 * G
+            LIMB_PAIR(0xD131F694, 0xD59595D1), LIMB_PAIR(0x2A7FDC21, 0xCE8A8375), LIMB_PAIR(0x75869627, 0x9E62E8B1), LIMB_PAIR(0x6E01B014, 0x336D7845),
+            LIMB_PAIR(0x6EA5A8ED, 0xB53ACB36), LIMB_PAIR(0x7DD8AC89, 0x4451F2E5), LIMB_PAIR(0x2BC29533, 0x4C8CF19C), LIMB_PAIR(0x7C10E63F, 0xFBC29EF4), LIMB_PARTIAL(0x17C),
+            LIMB_PAIR(0x7A9357FA, 0x9BC2EC34), LIMB_PAIR(0x3B8A04AF, 0xDE489A13), LIMB_PAIR(0x230520B7, 0xB3521CDA), LIMB_PAIR(0xAF6DEB0D, 0xD7699690),
+            LIMB_PAIR(0x14655A0F, 0xACE1AF3A), LIMB_PAIR(0xCD89B94B, 0xF628697F), LIMB_PAIR(0x3C079AB6, 0x40A71EA3), LIMB_PAIR(0xFD251809, 0xE7B89297), LIMB_PARTIAL(0x1DB)
+        },
+        {   // 8 * 16^2 * G
+            LIMB_PAIR(0x4043C91D, 0xD0080452), LIMB_PAIR(0x01D9A152, 0xE3362D2A), LIMB_PAIR(0x404673DA, 0x3D143282), LIMB_PAIR(0xA881D770, 0x1D1C9B70),
+            LIMB_PAIR(0xD4A785A8, 0x4254627E), LIMB_PAIR(0x2D8B8D09, 0xF801104F), LIMB_PAIR(0xC6CECA92, 0x306F6F22), LIMB_PAIR(0x130418EA, 0xF0529D16), LIMB_PARTIAL(0x11B),
+            LIMB_PAIR(0x6D8F9FA8, 0xFA1E73FD), LIMB_PAIR(0xEAA0860B, 0xB402CACC), LIMB_PAIR(0xAE11AE49, 0xCB08D922), LIMB_PAIR(0x76387F9B, 0x79908F8F),
+            LIMB_PAIR(0xB8B14819, 0x126B0EBA), LIMB_PAIR(0x3BB333A0, 0x156A5EA6), LIMB_PAIR(0xFE7F302F, 0x0BA63111), LIMB_PAIR(0x4CD4F889, 0x225EE26A), LIMB_PARTIAL(0x1D0)
+        }
+    },
+#endif
+#if (3 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^3 * G
+            LIMB_PAIR(0xE4FFAC9B, 0xE070A145), LIMB_PAIR(0xAA280FFF, 0xF8295455), LIMB_PAIR(0x7010805F, 0xA2D6CF89), LIMB_PAIR(0x3220FF7C, 0x04E13089),
+            LIMB_PAIR(0xAD11681E, 0x5935E6E2), LIMB_PAIR(0xB9CEF2BC, 0xD91EFB7B), LIMB_PAIR(0x14BB8C4D, 0x3C260B99), LIMB_PAIR(0x3A265599, 0x24BF88D5), LIMB_PARTIAL(0x0F0),
+            LIMB_PAIR(0xCC9C279A, 0x1FF2439C), LIMB_PAIR(0x90BAB4CF, 0xDFCD0B6E), LIMB_PAIR(0xC3ACBFDA, 0xFA08A7BA), LIMB_PAIR(0xCDB22A56, 0xC91B8F40),
+            LIMB_PAIR(0x672BE103, 0x9624AC18), LIMB_PAIR(0xA7CB0F83, 0x1E59BAC0), LIMB_PAIR(0xED5F94C6, 0xAE0AA78E), LIMB_PAIR(0xB43029E1, 0x9655B8C3), LIMB_PARTIAL(0x052)
+        },
+        {   // 2 * 16^3 * G
+            LIMB_PAIR(0x81A7B4C3, 0x2172A8AA), LIMB_PAIR(0xABF93BBD, 0x97CA8DFD), LIMB_PAIR(0xF37D1211, 0x2525D8CA), LIMB_PAIR(0x917E5726, 0x16442A63),
+            LIMB_PAIR(0xE12467BC, 0xC67B9EC8), LIMB_PAIR(0x3C5227E1, 0x53240D52), LIMB_PAIR(0x7101B132, 0x6F604926), LIMB_PAIR(0xDE1A0F56, 0x70DA1AC7), LIMB_PARTIAL(0x086),
+            LIMB_PAIR(0x53E7DCDD, 0x8D0C56BE), LIMB_PAIR(0xEABC48DE, 0xCA55C626), LIMB_PAIR(0x585CA3C4, 0xD4CBC52A), LIMB_PAIR(0x77288D74, 0xA36F2402),
+            LIMB_PAIR(0xF7FF687F, 0x42922EBC), LIMB_PAIR(0x5EFBB12D, 0x482022CD), LIMB_PAIR(0x7A1ABED1, 0xE539F2AA), LIMB_PAIR(0x37C7469F, 0x561C2070), LIMB_PARTIAL(0x0C7)
+        },
+        {   // 3 * 16^3 * G
+            LIMB_PAIR(0x98AAFDD1, 0x662D7D3C), LIMB_PAIR(0x21107B4C, 0x4C72AB8A), LIMB_PAIR(0xC2DDDBF7, 0x74CD96B0), LIMB_PAIR(0x20376ABD, 0x27BA0E3F),
+            LIMB_PAIR(0x867E8CFB, 0xA41A23C9), LIMB_PAIR(0x45117BAE, 0x36E50538), LIMB_PAIR(0xE45A9E79, 0xF399D347), LIMB_PAIR(0x9E482DF2, 0x97CB9778), LIMB_PARTIAL(0x0E7),
+            LIMB_PAIR(0x015672D3, 0x5672082F), LIMB_PAIR(0x2FF3D33E, 0x11445C3C), LIMB_PAIR(0x0504B408, 0x296735E2), LIMB_PAIR(0xEFB627D0, 0xF8E18280),
+            LIMB_PAIR(0xDD1A08E2, 0x85FB2222), LIMB_PAIR(0xAF77422C, 0x4EC184A2), LIMB_PAIR(0x7AA7FA0E, 0x2D0C1A44), LIMB_PAIR(0x232261EB, 0x7E99ACD0), LIMB_PARTIAL(0x1E4)
+        },
+        {   // 4 * 16^3 * G
+            LIMB_PAIR(0x3A46CAEF, 0x6DB672C6), LIMB_PAIR(0x8BD02589, 0x999560BF), LIMB_PAIR(0x1D900FA3, 0x53E34387), LIMB_PAIR(0x53D2590E, 0x33C80C2C),
+            LIMB_PAIR(0x9801A393, 0x3B11EAD6), LIMB_PAIR(0x591E52F0, 0xC6701879), LIMB_PAIR(0x60428399, 0xC1C1982D), LIMB_PAIR(0x1932418F, 0x77D74797), LIMB_PARTIAL(0x177),
+            LIMB_PAIR(0x5B4FA0EC, 0xA4F615A0), LIMB_PAIR(0x059EB5C5, 0xB5AFE599), LIMB_PAIR(0x1142B875, 0x1260BA58), LIMB_PAIR(0xF4F69AE0, 0x3CC654AB),
+            LIMB_PAIR(0xAB6D27BD, 0x0422AC16), LIMB_PAIR(0xCAE65C55, 0x119F316A), LIMB_PAIR(0xE15B6C6F, 0x3EC0A913), LIMB_PAIR(0x0AE71C5A, 0x1603620E), LIMB_PARTIAL(0x08D)
+        },
+        {   // 5 * 16^3 * G
+            LIMB_PAIR(0xC7904DCC, 0xF6AC59C2), LIMB_PAIR(0x30E7A7C0, 0xF34A6438), LIMB_PAIR(0xBBEF0274, 0x4D7D7ECB), LIMB_PAIR(0x87E2E8A3, 0x13E02957),
+            LIMB_PAIR(0x2A250A6F, 0x0B985540), LIMB_PAIR(0xBCF9DC53, 0x26A87784), LIMB_PAIR(0xBA65EC34, 0x34AF454B), LIMB_PAIR(0x721F360C, 0x8CD8460C), LIMB_PARTIAL(0x01F),
+            LIMB_PAIR(0xFC08A52A, 0x1A082A89), LIMB_PAIR(0x365F3B53, 0xB8823064), LIMB_PAIR(0x89580CDE, 0xB1A9A671), LIMB_PAIR(0x7E949F3D, 0x5D46AEF8),
+            LIMB_PAIR(0xD2E6F058, 0x194EEBDD), LIMB_PAIR(0x7462EC31, 0xF047FDF4), LIMB_PAIR(0x541D8A7E, 0xDD84132D), LIMB_PAIR(0xF113644F, 0xD39482B8), LIMB_PARTIAL(0x0DC)
+        },
+        {   // 6 * 16^3 * G
+            LIMB_PAIR(0x506F1FE1, 0x7019C040), LIMB_PAIR(0xC4BEFA38, 0x778F80BC), LIMB_PAIR(0xFB8F9D92, 0x6DC34B4C), LIMB_PAIR(0x2B59A187, 0xB4067755),
+            LIMB_PAIR(0x7478D103, 0x33C1624D), LIMB_PAIR(0x01EE3CD2, 0x956D0B72), LIMB_PAIR(0x9F6D3A97, 0x0B39D9E7), LIMB_PAIR(0xDAF21B3F, 0xD218496E), LIMB_PARTIAL(0x12A),
+            LIMB_PAIR(0x295F5C04, 0xF86D7E3E), LIMB_PAIR(0xA191CE1A, 0x2D528A03), LIMB_PAIR(0x263F9BA7, 0x5BC2A444), LIMB_PAIR(0xD9386B2E, 0x2938B354),
+            LIMB_PAIR(0x7E64A3C2, 0xC9CE878A), LIMB_PAIR(0x2E30D794, 0xEC2F0E54), LIMB_PAIR(0x75CA4503, 0x565A6BFD), LIMB_PAIR(0x1B393130, 0xC1F1FE24), LIMB_PARTIAL(0x0C0)
+        },
+        {   // 7 * 16^3 * G
+            LIMB_PAIR(0xD28EA0E9, 0x0F666997), LIMB_PAIR(0x7243DF5F, 0x0B94AAA0), LIMB_PAIR(0xC3462336, 0x23328026), LIMB_PAIR(0xE78749F5, 0x17B1E2B1),
+            LIMB_PAIR(0x0F956995, 0x785D0AAB), LIMB_PAIR(0x66006613, 0xD5693FA2), LIMB_PAIR(0x48D1E0AB, 0xE86B26BF), LIMB_PAIR(0x7AF1BCCB, 0xAB68CEFD), LIMB_PARTIAL(0x0AE),
+            LIMB_PAIR(0x8046E012, 0x5468DF6D), LIMB_PAIR(0xAB17D13B, 0xC0D6DD8C), LIMB_PAIR(0xFD0D9B38, 0x84DE5691), LIMB_PAIR(0x5FB3B96A, 0xE897F4E0),
+            LIMB_PAIR(0xE6E4AE24, 0x23D39D56), LIMB_PAIR(0x7DE8ED15, 0x9EBA39B1), LIMB_PAIR(0xA6C3D45A, 0xF6BF29AB), LIMB_PAIR(0x8DE19508, 0x1E7B58B2), LIMB_PARTIAL(0x169)
+        },
+        {   // 8 * 16^3 * G
+            LIMB_PAIR(0x4538E761, 0x7D5F8E47), LIMB_PAIR(0x4C878738, 0x37C78872), LIMB_PAIR(0x816427F0, 0xE69F4711), LIMB_PAIR(0x7315C7D8, 0x4DA6F467),
+            LIMB_PAIR(0x0E84D136, 0xF4665C46), LIMB_PAIR(0x6A9D82D0, 0x6B6C9C50), LIMB_PAIR(0x1A96FCD2, 0xAB5D9FEC), LIMB_PAIR(0xF7974F3A, 0x9ED96C86), LIMB_PARTIAL(0x11A),
+            LIMB_PAIR(0x9A66D7AC, 0xBECFF717), LIMB_PAIR(0x8F4F08B6, 0x67D08B6D), LIMB_PAIR(0xC02E60AC, 0x0F7CE5BE), LIMB_PAIR(0x294AED52, 0xCAE69A50),
+            LIMB_PAIR(0x10970DFC, 0xB1E2278E), LIMB_PAIR(0x75B3E40E, 0x618459AF), LIMB_PAIR(0xED5E54A0, 0xE395787D), LIMB_PAIR(0xE862C8FF, 0xCD8A442B), LIMB_PARTIAL(0x01C)
+        }
+    },
+#endif
+#if (4 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^4 * G
+            LIMB_PAIR(0xCAA4BEC3, 0xA3480D58), LIMB_PAIR(0x5989E4A0, 0x38948993), LIMB_PAIR(0x6F7BA4CA, 0x3F4D7B6C), LIMB_PAIR(0xD39CB2AE, 0xE2913A55),
+            LIMB_PAIR(0xD7BE6499, 0x615043EA), LIMB_PAIR(0xF504FEC3, 0x9D4C41CB), LIMB_PAIR(0x8D44893B, 0x4F93DA96), LIMB_PAIR(0x9A7928E0, 0x33A7ACDC), LIMB_PARTIAL(0x013),
+            LIMB_PAIR(0x48219A09, 0xC865844F), LIMB_PAIR(0x37426BDC, 0xA6D0B179), LIMB_PAIR(0x284AE0E6, 0x7386A0A6), LIMB_PAIR(0xC2DC16FC, 0xDDD6CBA0),
+            LIMB_PAIR(0x2940D262, 0x77D2934D), LIMB_PAIR(0x741B88AB, 0x3AF6ED35), LIMB_PAIR(0xA6DAE43F, 0x96F43A65), LIMB_PAIR(0x1414083B, 0xC7143535), LIMB_PARTIAL(0x057)
+        },
+        {   // 2 * 16^4 * G
+            LIMB_PAIR(0x24891F36, 0x394D5106), LIMB_PAIR(0x825FA293, 0xB4265C4F), LIMB_PAIR(0xF6ECBD5E, 0x65A54B87), LIMB_PAIR(0x2A351A03, 0x6A2F900F),
+            LIMB_PAIR(0x8D1DAD9C, 0xFB26D52F), LIMB_PAIR(0xBA2C39CC, 0xBD651F19), LIMB_PAIR(0xBB30ED5A, 0x2D5894F2), LIMB_PAIR(0x94732EC9, 0x4CC3F057), LIMB_PARTIAL(0x0C3),
+            LIMB_PAIR(0x9BFEC4FF, 0x8C03CCDC), LIMB_PAIR(0xD52329C8, 0x4CE76352), LIMB_PAIR(0x3995D109, 0x0A92CDF0), LIMB_PAIR(0x7518BA0C, 0x44D28A5D),
+            LIMB_PAIR(0xCE16A6A6, 0xBD74ECEF), LIMB_PAIR(0x123CB82F, 0xCAB52531), LIMB_PAIR(0xF34E1C5F, 0x72065B99), LIMB_PAIR(0x03A9A916, 0x4949379F), LIMB_PARTIAL(0x164)
+        },
+        {   // 3 * 16^4 * G
+            LIMB_PAIR(0x0D67EE97, 0xD49BEA9D), LIMB_PAIR(0xF8CE59AA, 0x3B54996F), LIMB_PAIR(0xF5862792, 0x609F5808), LIMB_PAIR(0xBF16A7B1, 0x8FFF6EE3),
+            LIMB_PAIR(0x9EF889A0, 0x2D515A91), LIMB_PAIR(0xCC6A85C3, 0x9FDAD17E), LIMB_PAIR(0x54D161D4, 0xA93C168B), LIMB_PAIR(0xD42907B7, 0x269CBD3F), LIMB_PARTIAL(0x077),
+            LIMB_PAIR(0xCC9BC5AE, 0xEFBDC466), LIMB_PAIR(0x9F2D0ABD, 0x56216332), LIMB_PAIR(0x78B7F191, 0x567A46BC), LIMB_PAIR(0x55CB85EB, 0xFE6F5FFE),
+            LIMB_PAIR(0x1FA1E9B7, 0xB6A1BD3A), LIMB_PAIR(0xB23AA4A1, 0x92A1F94D), LIMB_PAIR(0x85B417C5, 0x8706DF4E), LIMB_PAIR(0x72C38E1D, 0x80F8E279), LIMB_PARTIAL(0x1F5)
+        },
+        {   // 4 * 16^4 * G
+            LIMB_PAIR(0x76229445, 0xB3EE6763), LIMB_PAIR(0xFED827FE, 0xF39BDB10), LIMB_PAIR(0x5ABBF64C, 0xBBD91777), LIMB_PAIR(0x29A83FA6, 0x260EE1D5),
+            LIMB_PAIR(0xE14C0321, 0xA0FB51A9), LIMB_PAIR(0x85203855, 0xE285DA42), LIMB_PAIR(0x55550C91, 0x5C8AB2D2), LIMB_PAIR(0x5E3E844A, 0x88A94F05), LIMB_PARTIAL(0x06C),
+            LIMB_PAIR(0x885E1B36, 0xE2C20AF1), LIMB_PAIR(0x5132EB84, 0x93632BFB), LIMB_PAIR(0xEEC26E58, 0x8EC0A26A), LIMB_PAIR(0xC1A0B075, 0xA189AA9B),
+            LIMB_PAIR(0xFF4A93F9, 0x3786BE8F), LIMB_PAIR(0xE4302FC2, 0xAF4ACE63), LIMB_PAIR(0x5856207E, 0xC19AE28D), LIMB_PAIR(0x5425099B, 0xCD791D4E), LIMB_PARTIAL(0x13C)
+        },
+        {   // 5 * 16^4 * G
+            LIMB_PAIR(0xA45742D3, 0x782A46B3), LIMB_PAIR(0x9AE4F831, 0x7FB395DC), LIMB_PAIR(0x06715575, 0xAA0A2499), LIMB_PAIR(0x987995C6, 0x336DD153),
+            LIMB_PAIR(0x70D00FCB, 0x5678C82A), LIMB_PAIR(0x33B45F8B, 0xDC87A872), LIMB_PAIR(0x3498DFA5, 0xD5B26900), LIMB_PAIR(0x410F7C71, 0xA8EF2E81), LIMB_PARTIAL(0x0EC),
+            LIMB_PAIR(0x69A89D17, 0x00E42EF0), LIMB_PAIR(0x1DE60EE9, 0xDFD638D2), LIMB_PAIR(0x8E2A3B24, 0x5E3E68A9), LIMB_PAIR(0xD7A07F7C, 0x19D1CC8A),
+            LIMB_PAIR(0x4D2C9B89, 0xD84E1809), LIMB_PAIR(0xFD778F5F, 0x7674BFD1), LIMB_PAIR(0x1E2B3490, 0x962735A6), LIMB_PAIR(0xF535952D, 0x9AD592A5), LIMB_PARTIAL(0x031)
+        },
+        {   // 6 * 16^4 * G
+            LIMB_PAIR(0xAF63A6FF, 0x80D754CB), LIMB_PAIR(0x14970F91, 0xA4F718C1), LIMB_PAIR(0xB184B25C, 0x33767545), LIMB_PAIR(0x26115598, 0xCB615B61),
+            LIMB_PAIR(0xB0EC3A99, 0xDDC1E848), LIMB_PAIR(0x7A9EE0F4, 0x238885AE), LIMB_PAIR(0x70CFF1AF, 0x4F434C1A), LIMB_PAIR(0x04F92877, 0xA5D8F628), LIMB_PARTIAL(0x103),
+            LIMB_PAIR(0xF5E7B21C, 0x889A468C), LIMB_PAIR(0x4F73F4C1, 0x42C6B128), LIMB_PAIR(0xEA99C1C9, 0xC825355F), LIMB_PAIR(0xB8502CAB, 0xDFABD44E),
+            LIMB_PAIR(0x078FF997, 0x2C19C4F8), LIMB_PAIR(0xF948436E, 0x766BE192), LIMB_PAIR(0xD3DCDF09, 0xC086DDD4), LIMB_PAIR(0x1D8FD86B, 0xF28F946C), LIMB_PARTIAL(0x1FF)
+        },
+        {   // 7 * 16^4 * G
+            LIMB_PAIR(0xAE4622FA, 0x9DDC754C), LIMB_PAIR(0x05C5947F, 0xAC04C429), LIMB_PAIR(0x2DBFB6A4, 0x0B53D6DB), LIMB_PAIR(0x883C6D42, 0x1FB16F7B),
+            LIMB_PAIR(0xE5DBAB18, 0xE38B1745), LIMB_PAIR(0x0087B164, 0xA320F80A), LIMB_PAIR(0x32CD4694, 0x4A5C274F), LIMB_PAIR(0x0855DC1F, 0xE32650C1), LIMB_PARTIAL(0x0CE),
+            LIMB_PAIR(0x5997C5B5, 0xF1C1A8C5), LIMB_PAIR(0x2E051A16, 0x3A20FF07), LIMB_PAIR(0x36A4BC59, 0xBAACCCE2), LIMB_PAIR(0x2C407BFD, 0x72AE4A19),
+            LIMB_PAIR(0xC128C710, 0x0ADA1E57), LIMB_PAIR(0xB2D91FF3, 0xF4CE04DB), LIMB_PAIR(0x31FD0538, 0x8616DA87), LIMB_PAIR(0x245B59F8, 0x5C19B57F), LIMB_PARTIAL(0x10B)
+        },
+        {   // 8 * 16^4 * G
+            LIMB_PAIR(0x84357B3F, 0x44EDF8BE), LIMB_PAIR(0x588059D0, 0xE5DF9129), LIMB_PAIR(0xAB7D5B23, 0x83E65CFA), LIMB_PAIR(0x2121A504, 0x79C2E198),
+            LIMB_PAIR(0xEB3BE7D1, 0xE6A19633), LIMB_PAIR(0x86B85BC4, 0xD9F88695), LIMB_PAIR(0x79F2187C, 0x78508FA2), LIMB_PAIR(0x12254F09, 0xA2EB8FC0), LIMB_PARTIAL(0x0AE),
+            LIMB_PAIR(0x2797D3FA, 0xB1A6704E), LIMB_PAIR(0x2C78669F, 0x95B4C268), LIMB_PAIR(0x2997C68D, 0x5294A8E4), LIMB_PAIR(0x4085BAD5, 0x7246B061),
+            LIMB_PAIR(0x4159E5EF, 0x7CA017C2), LIMB_PAIR(0x87D1A013, 0xB8FE1A61), LIMB_PAIR(0x44BC4EA3, 0xDBA0DCDE), LIMB_PAIR(0xA8CE296F, 0x1FDD53C6), LIMB_PARTIAL(0x0FE)
+        }
+    },
+#endif
+#if (5 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^5 * G
+            LIMB_PAIR(0xA2302041, 0x4F0E025F), LIMB_PAIR(0x48D262B5, 0x4D50D989), LIMB_PAIR(0xD622C7D4, 0x01720A0A), LIMB_PAIR(0x58D1C97C, 0xE3B5A941),
+            LIMB_PAIR(0x38AED2A5, 0xFBC5B183), LIMB_PAIR(0x823B5D8D, 0x27F02177), LIMB_PAIR(0x775F38C5, 0xADF74074), LIMB_PAIR(0x4F1A6EA0, 0x95BF91F4), LIMB_PARTIAL(0x104),
+            LIMB_PAIR(0x8E2D6AB2, 0xF9CD8299), LIMB_PAIR(0x6C27631D, 0xA75B296B), LIMB_PAIR(0x1E00BAC9, 0x07700049), LIMB_PAIR(0xEBD66975, 0xDC99E546),
+            LIMB_PAIR(0x75E54993, 0x44FA5282), LIMB_PAIR(0xD50E44D1, 0x25FBCA4B), LIMB_PAIR(0x81057B1A, 0x46631393), LIMB_PAIR(0xBDCDF45A, 0xC22EFF26), LIMB_PARTIAL(0x1CF)
+        },
+        {   // 2 * 16^5 * G
+            LIMB_PAIR(0x7F6B9B0B, 0x3519394E), LIMB_PAIR(0x01AED422, 0x76E8C235), LIMB_PAIR(0x64BF111A, 0xCB70FE5C), LIMB_PAIR(0x5B3C7EEE, 0xC6C02591),
+            LIMB_PAIR(0xF9ED8925, 0xB53B8858), LIMB_PAIR(0xBB66CD7E, 0x51503AFA), LIMB_PAIR(0xA6B3F2C4, 0xA2479B22), LIMB_PAIR(0x8EEEE4E4, 0xFBCB06C4), LIMB_PARTIAL(0x1C6),
+            LIMB_PAIR(0x198BB516, 0x29F2FF47), LIMB_PAIR(0x77671DDC, 0x1895FB68), LIMB_PAIR(0x1E2B80EE, 0x10A1E754), LIMB_PAIR(0xA7732627, 0xB19EFC72),
+            LIMB_PAIR(0x1E0EF24C, 0x88F9176E), LIMB_PAIR(0x1FA7183A, 0x22EF41AF), LIMB_PAIR(0x47D7C8D0, 0x994EA31C), LIMB_PAIR(0xE9793AE0, 0xE838B3F2), LIMB_PARTIAL(0x1B1)
+        },
+        {   // 3 * 16^5 * G
+            LIMB_PAIR(0x3FB4E975, 0x9289B69D), LIMB_PAIR(0x90ABE866, 0x402EA680), LIMB_PAIR(0xBE261ECA, 0x5308DA63), LIMB_PAIR(0x3973AE33, 0xCA3572CC),
+            LIMB_PAIR(0x98532B78, 0x856CA780), LIMB_PAIR(0x587F6B23, 0xCBF66636), LIMB_PAIR(0x1723A436, 0x676C4992), LIMB_PAIR(0x74F83F24, 0x9F9149EA), LIMB_PARTIAL(0x03E),
+            LIMB_PAIR(0xB398B5F9, 0xBA145D0D), LIMB_PAIR(0x5D91F299, 0x36FA701C), LIMB_PAIR(0x880CEA61, 0x4447EDE5), LIMB_PAIR(0xC69C641A, 0x7C901B83),
+            LIMB_PAIR(0xC9EC5747, 0xA4F6E566), LIMB_PAIR(0x2AEA7BD8, 0xC73E0C6B), LIMB_PAIR(0x507B21EC, 0xDA186A9C), LIMB_PAIR(0x7AE3AACF, 0x0420187E), LIMB_PARTIAL(0x1AB)
+        },
+        {   // 4 * 16^5 * G
+            LIMB_PAIR(0x67D26EAC, 0x39F73A56), LIMB_PAIR(0x938FA0E2, 0xE15B72B9), LIMB_PAIR(0x554F85DB, 0x16E09F8B), LIMB_PAIR(0x02A16CC2, 0x0E6D1CEE),
+            LIMB_PAIR(0x5E548E22, 0xCD989DF3), LIMB_PAIR(0x3CACDA0D, 0x9BA195FC), LIMB_PAIR(0x4CE28D02, 0xCFECC6F9), LIMB_PAIR(0xC91FA6D8, 0x8B8F51E0), LIMB_PARTIAL(0x19F),
+            LIMB_PAIR(0xC1A33BD9, 0x79F455B2), LIMB_PAIR(0xFE83B781, 0x76514D33), LIMB_PAIR(0xF2EF9526, 0x3F5EC772), LIMB_PAIR(0x6EA54F2A, 0x2D1E4794),
+            LIMB_PAIR(0xC1E2D62A, 0x472FB203), LIMB_PAIR(0xEABF2C9D, 0x6E94A20B), LIMB_PAIR(0x781A8076, 0x11DA7502), LIMB_PAIR(0x91BA87C8, 0x12CCF29A), LIMB_PARTIAL(0x0DD)
+        },
+        {   // 5 * 16^5 * G
+            LIMB_PAIR(0x8461A126, 0x0C44CB07), LIMB_PAIR(0x1E3D5EC2, 0x833ECF39), LIMB_PAIR(0xD30ED220, 0xCFB75A58), LIMB_PAIR(0x0F06DD1A, 0x78309A88),
+            LIMB_PAIR(0xFA5F0298, 0x46EA7133), LIMB_PAIR(0x4BFDF4A5, 0x4E43C6F0), LIMB_PAIR(0xE0EB0A8B, 0x7047ABFF), LIMB_PAIR(0xE1893149, 0x1B142957), LIMB_PARTIAL(0x1D6),
+            LIMB_PAIR(0x47F7C92D, 0xECA09AD4), LIMB_PAIR(0x3D86A0BE, 0xB5F84D6D), LIMB_PAIR(0x51FCD6A8, 0xDA40E7F6), LIMB_PAIR(0x2BE41D0F, 0x28A08F5F),
+            LIMB_PAIR(0x4F9A374C, 0x98A7F09A), LIMB_PAIR(0xBB0CBB89, 0xD2D6FF46), LIMB_PAIR(0xF6E2353D, 0x15DFBD60), LIMB_PAIR(0x9611D886, 0xDBAF53B4), LIMB_PARTIAL(0x18D)
+        },
+        {   // 6 * 16^5 * G
+            LIMB_PAIR(0xB711958E, 0xC9518F3F), LIMB_PAIR(0x0BC5DFB8, 0x74D3A13F), LIMB_PAIR(0x62025AFE, 0x7DA464AC), LIMB_PAIR(0x9A3E2FA5, 0xBFB139FA),
+            LIMB_PAIR(0x9A8D7C09, 0xB30511CC), LIMB_PAIR(0x17E41FAA, 0x4D3A313F), LIMB_PAIR(0x3A10C83E, 0x7C53FF82), LIMB_PAIR(0xABF3F866, 0x2E85A451), LIMB_PARTIAL(0x0D5),
+            LIMB_PAIR(0xDF1D2939, 0xE2844777), LIMB_PAIR(0x21FDAEB8, 0xC3A4CCFE), LIMB_PAIR(0x8C8F6176, 0x47B7E613), LIMB_PAIR(0x1B6571D0, 0x038B43EB),
+            LIMB_PAIR(0xE3F47C8C, 0x9F380474), LIMB_PAIR(0xB97BAC68, 0x623E3416), LIMB_PAIR(0xBED4CAEF, 0x625B6BF1), LIMB_PAIR(0x1664FCDD, 0x6AC6E0C8), LIMB_PARTIAL(0x11F)
+        },
+        {   // 7 * 16^5 * G
+            LIMB_PAIR(0x99868C1B, 0xD73BFF38), LIMB_PAIR(0x3C0780C8, 0xC4DE3067), LIMB_PAIR(0xB94ED8F5, 0x42E25EC9), LIMB_PAIR(0x0080C257, 0x2A1CBE59),
+            LIMB_PAIR(0x7E1F5C2D, 0xA2AD3D6B), LIMB_PAIR(0xB0B16C27, 0x6B750C30), LIMB_PAIR(0x016248B6, 0x26E80CD1), LIMB_PAIR(0x0A9B3479, 0x3A7CB193), LIMB_PARTIAL(0x0E5),
+            LIMB_PAIR(0xF06089DC, 0x248C212D), LIMB_PAIR(0x22EDFC21, 0xF64C29CD), LIMB_PAIR(0x94F10EB9, 0xAA2D5064), LIMB_PAIR(0x5B200F04, 0xCBAD39F7),
+            LIMB_PAIR(0xE2E4F780, 0xC43F0E7A), LIMB_PAIR(0x9038A60C, 0x30ADE30B), LIMB_PAIR(0x828E35C4, 0xB05C9C75), LIMB_PAIR(0x91A8FCD0, 0x71138725), LIMB_PARTIAL(0x17C)
+        },
+        {   // 8 * 16^5 * G
+            LIMB_PAIR(0xD2249935, 0xE7BBF4A8), LIMB_PAIR(0xADB64049, 0xBAA56999), LIMB_PAIR(0x45F8DF55, 0x5E0ECAE9), LIMB_PAIR(0x64E2A249, 0x20B22A2F),
+            LIMB_PAIR(0x1420D76A, 0x48010223), LIMB_PAIR(0xFB45ACFC, 0x24BD8F9F), LIMB_PAIR(0x67673F8D, 0x66E9C511), LIMB_PAIR(0x1F02406F, 0x719EDA3C), LIMB_PARTIAL(0x138),
+            LIMB_PAIR(0xD07C2FDF, 0x56F88274), LIMB_PAIR(0x54C1DB4E, 0x2B82612A), LIMB_PAIR(0x96C3B009, 0x0D4AE938), LIMB_PAIR(0x5897ED7E, 0xF97A730E),
+            LIMB_PAIR(0x396F9C18, 0x3E3505C0), LIMB_PAIR(0xDAEA8F31, 0x20D682E4), LIMB_PAIR(0xE85BD289, 0x05FE6EA4), LIMB_PAIR(0x14613E5C, 0x6E05507B), LIMB_PARTIAL(0x164)
+        }
+    },
+#endif
+#if (6 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^6 * G
+            LIMB_PAIR(0x46D39A88, 0xB5F53851), LIMB_PAIR(0x9CC76DEB, 0x58A99A0F), LIMB_PAIR(0xF3825B82, 0xCFDD909E), LIMB_PAIR(0xF4694014, 0x8F49DBDC),
+            LIMB_PAIR(0x9CFEC7B7, 0xEFD505FE), LIMB_PAIR(0x56925281, 0x66A7F2A1), LIMB_PAIR(0x2A604FB8, 0x6F478D9B), LIMB_PAIR(0x60F7C436, 0xCBC72E9E), LIMB_PARTIAL(0x021),
+            LIMB_PAIR(0xD9C31E98, 0x5BF75682), LIMB_PAIR(0xC8BCE143, 0x74D5CD73), LIMB_PAIR(0xC700E94A, 0x778BD5F1), LIMB_PAIR(0x3A66B233, 0xB01480C7),
+            LIMB_PAIR(0x688DF0CC, 0xC667F078), LIMB_PAIR(0x16BBCF57, 0x780C73E4), LIMB_PAIR(0x485890E0, 0xB77F5BA9), LIMB_PAIR(0xB9DDACB3, 0xD62ADDF5), LIMB_PARTIAL(0x17D)
+        },
+        {   // 2 * 16^6 * G
+            LIMB_PAIR(0xD4820FA0, 0x173AB94C), LIMB_PAIR(0x44F0E094, 0x6AC5AE13), LIMB_PAIR(0x64FC4C70, 0xF67C3F71), LIMB_PAIR(0x2AD78517, 0x2648A59A),
+            LIMB_PAIR(0x9505580C, 0xA7B34493), LIMB_PAIR(0x5A741D25, 0x8CAB6B44), LIMB_PAIR(0x63355FA6, 0xFE41BD45), LIMB_PAIR(0xD1091A6D, 0xD2731F41), LIMB_PARTIAL(0x096),
+            LIMB_PAIR(0x86E4F90D, 0x2550A622), LIMB_PAIR(0x80070B03, 0x65FA978B), LIMB_PAIR(0xE3B526A5, 0xF3AC57B5), LIMB_PAIR(0xF84FA4BC, 0x8E9207BC),
+            LIMB_PAIR(0xF88E6047, 0x675A8E31), LIMB_PAIR(0x9050DDAD, 0xF648CC7C), LIMB_PAIR(0xBC5B7DC3, 0x1FD62DBC), LIMB_PAIR(0x96F0AEAB, 0xCC0960D6), LIMB_PARTIAL(0x1DA)
+        },
+        {   // 3 * 16^6 * G
+            LIMB_PAIR(0x767335CF, 0xF7BA638D), LIMB_PAIR(0x733C2346, 0xB6FB9463), LIMB_PAIR(0xED81C85F, 0xA0E475A1), LIMB_PAIR(0xCB58E955, 0x5D2FC9F1),
+            LIMB_PAIR(0x75A1DFD5, 0x941FBDC6), LIMB_PAIR(0x0F14F1C2, 0x732D6CEA), LIMB_PAIR(0x21367160, 0x4C13E559), LIMB_PAIR(0xEF0E8D39, 0x5BA5A950), LIMB_PARTIAL(0x07D),
+            LIMB_PAIR(0xBBEB43F6, 0x355DBBB2), LIMB_PAIR(0xB3505972, 0x0ADAF151), LIMB_PAIR(0x82F0D0BA, 0x01976A04), LIMB_PAIR(0xFD4BE88B, 0x080824B6),
+            LIMB_PAIR(0xF4424F37, 0x8392B272), LIMB_PAIR(0x72F6EFD8, 0xDC69D678), LIMB_PAIR(0xA06B0CA3, 0x0A4B8BA4), LIMB_PAIR(0xAD3FD7C9, 0xB731404C), LIMB_PARTIAL(0x119)
+        },
+        {   // 4 * 16^6 * G
+            LIMB_PAIR(0x3F0741E6, 0xDDD7A073), LIMB_PAIR(0xA4689D58, 0x6D74B1E2), LIMB_PAIR(0x6798BA3C, 0x6F603764), LIMB_PAIR(0xB996B179, 0xDC038772),
+            LIMB_PAIR(0xE1668E1C, 0x6E7E797A), LIMB_PAIR(0x3E285251, 0x551F4A8E), LIMB_PAIR(0xE67FD032, 0x705484E5), LIMB_PAIR(0xEBCCEEA3, 0xA65FDFCD), LIMB_PARTIAL(0x0EA),
+            LIMB_PAIR(0xACFC4123, 0x33A1C053), LIMB_PAIR(0xBBE1FD24, 0x25030E6A), LIMB_PAIR(0x00D3D90C, 0xD9D6AF71), LIMB_PAIR(0xADE7D232, 0x063F818B),
+            LIMB_PAIR(0x521CE597, 0x99630AC3), LIMB_PAIR(0xB9EA28ED, 0xBB594D0E), LIMB_PAIR(0x3A1FB8EE, 0x3F61ACBD), LIMB_PAIR(0x88CAADE2, 0x7E00686F), LIMB_PARTIAL(0x1A8)
+        },
+        {   // 5 * 16^6 * G
+            LIMB_PAIR(0xC9B816E5, 0x1730B2A5), LIMB_PAIR(0x5531EE33, 0xF2C2A1BB), LIMB_PAIR(0x659E0B2F, 0x1DA21329), LIMB_PAIR(0xC88BCE0C, 0xBEC25192),
+            LIMB_PAIR(0xAC6F52AB, 0xDDD4B9E6), LIMB_PAIR(0x9E4B9F7D, 0xF15BD68F), LIMB_PAIR(0x7D249B4F, 0xEA9E12E6), LIMB_PAIR(0x451ABAB2, 0x56A65055), LIMB_PARTIAL(0x15D),
+            LIMB_PAIR(0xC4B6910E, 0xC4D7DC72), LIMB_PAIR(0x2DDFF22E, 0x5FD33592), LIMB_PAIR(0xB8287AF6, 0x43E429E2), LIMB_PAIR(0xA1585685, 0x258A4647),
+            LIMB_PAIR(0x3B62CE95, 0x31F72F41), LIMB_PAIR(0x57933B4F, 0xF63172FA), LIMB_PAIR(0x0C5CB4D8, 0x54749D3A), LIMB_PAIR(0x8CC931C6, 0x514DA5D2), LIMB_PARTIAL(0x1DE)
+        },
+        {   // 6 * 16^6 * G
+            LIMB_PAIR(0xCB4A809E, 0x0FEBEF06), LIMB_PAIR(0x261B4FAC, 0xA8AF434C), LIMB_PAIR(0x59D1E70B, 0xE3B71850), LIMB_PAIR(0x5D1C24F4, 0xB62F01E4),
+            LIMB_PAIR(0xB303A2CE, 0x8ABE4E3D), LIMB_PAIR(0x36E2C2A8, 0x91A5A10F), LIMB_PAIR(0x7E472BA9, 0x710BD5CA), LIMB_PAIR(0x77A05FF7, 0x14A31AA6), LIMB_PARTIAL(0x1BC),
+            LIMB_PAIR(0x453E07BA, 0xBADEC183), LIMB_PAIR(0x1E3087A2, 0x54C92EC4), LIMB_PAIR(0x4A6E06A3, 0xB87B0B72), LIMB_PAIR(0xB5507E77, 0xE26C6162),
+            LIMB_PAIR(0x75FAEDAA, 0xEB64A071), LIMB_PAIR(0x4988A08D, 0xDE1C7546), LIMB_PAIR(0x1FF0A98F, 0xE99B3485), LIMB_PAIR(0x053F0E60, 0x29A660C2), LIMB_PARTIAL(0x13A)
+        },
+        {   // 7 * 16^6 * G
+            LIMB_PAIR(0x16EBA181, 0xD495B0EC), LIMB_PAIR(0x76F4FB91, 0x834A505A), LIMB_PAIR(0xDB3B0C92, 0xD1950CF8), LIMB_PAIR(0xBF6BD68F, 0x5108E0CD),
+            LIMB_PAIR(0x9F777AC3, 0xD8492E45), LIMB_PAIR(0x184F5A9B, 0x2CAA1A4E), LIMB_PAIR(0xCE860F91, 0xFBB91EA5), LIMB_PAIR(0x597025F9, 0x05957C32), LIMB_PARTIAL(0x097),
+            LIMB_PAIR(0xB07D29FF, 0x1774A862), LIMB_PAIR(0xCBCC928E, 0xCB4EDA89), LIMB_PAIR(0x02AD819B, 0xA19276A1), LIMB_PAIR(0xF5AF5B3E, 0x3D0CACF6),
+            LIMB_PAIR(0x3BDBC653, 0x8DCEC31F), LIMB_PAIR(0x2F1ADE3E, 0xAAD43709), LIMB_PAIR(0x574E10B1, 0x544E97C3), LIMB_PAIR(0xC62C4DEB, 0xD4364902), LIMB_PARTIAL(0x077)
+        },
+        {   // 8 * 16^6 * G
+            LIMB_PAIR(0xDBBC43B6, 0x87DAA931), LIMB_PAIR(0xD1895005, 0x882A2421), LIMB_PAIR(0x7AAE1124, 0x6013F2BA), LIMB_PAIR(0xBAD34DF3, 0x01D2A8F0),
+            LIMB_PAIR(0x2F0B3D59, 0xDB1B7F43), LIMB_PAIR(0x2A95AC2C, 0x59039F35), LIMB_PAIR(0xA6C0A8B9, 0x555077AA), LIMB_PAIR(0x62685A03, 0x543B69A8), LIMB_PARTIAL(0x0E0),
+            LIMB_PAIR(0xEC48D2AF, 0xBB104059), LIMB_PAIR(0x930FA171, 0x691C1F18), LIMB_PAIR(0x37D9FD85, 0x8C434C76), LIMB_PAIR(0x068741AB, 0xD1E56D52),
+            LIMB_PAIR(0x130E01EC, 0x1117A9FC), LIMB_PAIR(0x1F510538, 0x126D517B), LIMB_PAIR(0xF290A27E, 0x25CE40CE), LIMB_PAIR(0xE90E675D, 0x0D0B0D8A), LIMB_PARTIAL(0x028)
+        }
+    },
+#endif
+#if (7 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^7 * G
+            LIMB_PAIR(0x3CA98249, 0x93D61C07), LIMB_PAIR(0x907AA44A, 0x04C4F43D), LIMB_PAIR(0x51D5B1D6, 0xEE3D2C31), LIMB_PAIR(0xF859DF2A, 0xE74D6892),
+            LIMB_PAIR(0x922F8FA9, 0x16AB4838), LIMB_PAIR(0x757B0010, 0xB0B6F7D1), LIMB_PAIR(0xA918F320, 0x7CA940D8), LIMB_PAIR(0x97B8C9B5, 0x45E9325B), LIMB_PARTIAL(0x1E1),
+            LIMB_PAIR(0x37316056, 0xDB18D7BF), LIMB_PAIR(0x8FC0EB89, 0xC3453204), LIMB_PAIR(0x060E2DB1, 0x3929DB79), LIMB_PAIR(0xB1E67403, 0x2CCBF668),
+            LIMB_PAIR(0x9B05F538, 0xC7CE019A), LIMB_PAIR(0x4DCA0FFE, 0x9377F446), LIMB_PAIR(0x8A570683, 0x42947EB6), LIMB_PAIR(0xE0A1BF92, 0x6EB25E34), LIMB_PARTIAL(0x09A)
+        },
+        {   // 2 * 16^7 * G
+            LIMB_PAIR(0xF6130E66, 0x8B60DC2D), LIMB_PAIR(0x7B6448FB, 0x8ED41BE4), LIMB_PAIR(0x5EA7DEC5, 0x0862C67E), LIMB_PAIR(0x72E431ED, 0x97CD5282),
+            LIMB_PAIR(0x0BFF84C7, 0x944A76DA), LIMB_PAIR(0xA2075162, 0xC168A8FD), LIMB_PAIR(0x13AD271D, 0x21AF8DE7), LIMB_PAIR(0x437E9E66, 0x27EBCD24), LIMB_PARTIAL(0x044),
+            LIMB_PAIR(0x4C7B3DC7, 0x399007D7), LIMB_PAIR(0xBAFA8850, 0x5128A9FE), LIMB_PAIR(0x4DB4A4B4, 0xB7E7CFF4), LIMB_PAIR(0x3410D116, 0x92357117),
+            LIMB_PAIR(0xB450EFED, 0x47320EAC), LIMB_PAIR(0xF8042421, 0x47AD42E6), LIMB_PAIR(0x63B6AA24, 0xE4EF55C2), LIMB_PAIR(0x3F882833, 0x7A97987C), LIMB_PARTIAL(0x0B9)
+        },
+        {   // 3 * 16^7 * G
+            LIMB_PAIR(0x022667CD, 0xC76E5F4D), LIMB_PAIR(0x3E07FB1F, 0x2C78870A), LIMB_PAIR(0xD1C68926, 0x9E001396), LIMB_PAIR(0xED2A502E, 0x707A9C2E),
+            LIMB_PAIR(0xE68933FB, 0xAA9A37F8), LIMB_PAIR(0x4E4C8F98, 0x1AE458AC), LIMB_PAIR(0xA71656EE, 0x8047ED5D), LIMB_PAIR(0xA9DF9D4B, 0x06826324), LIMB_PARTIAL(0x0AD),
+            LIMB_PAIR(0x19C176EF, 0x2C4CBD93), LIMB_PAIR(0x8092BE6E, 0x8DAC6442), LIMB_PAIR(0x7A074BFF, 0x0C349EE8), LIMB_PAIR(0x0129E1A0, 0xEC35B47C),
+            LIMB_PAIR(0x35253255, 0x4096E012), LIMB_PAIR(0x06B23B09, 0xB3E6E7FD), LIMB_PAIR(0x16FD165C, 0x8B36EAC3), LIMB_PAIR(0x94AD125C, 0xB7D5F972), LIMB_PARTIAL(0x154)
+        },
+        {   // 4 * 16^7 * G
+            LIMB_PAIR(0x43416440, 0x58241D2F), LIMB_PAIR(0xF36BB0CC, 0xAD00DACC), LIMB_PAIR(0xE1B517A4, 0xEF105AAD), LIMB_PAIR(0x418524A2, 0xA88FB367),
+            LIMB_PAIR(0xD69F903F, 0x960EFC2B), LIMB_PAIR(0xBB316FA8, 0x58B761E2), LIMB_PAIR(0x43593289, 0x634A724E), LIMB_PAIR(0x78B2C871, 0xA341DD21), LIMB_PARTIAL(0x178),
+            LIMB_PAIR(0x3261324C, 0x29DE72F8), LIMB_PAIR(0x0EE348C0, 0x53767DBC), LIMB_PAIR(0x2EBC04F2, 0x7F5A005B), LIMB_PAIR(0x0F7B3B9A, 0x8C6987A7),
+            LIMB_PAIR(0x7E48F271, 0x0F387E9D), LIMB_PAIR(0x5B456A10, 0x64413458), LIMB_PAIR(0xD0A2A3C5, 0x015A5DA5), LIMB_PAIR(0x708BE977, 0xB236CC58), LIMB_PARTIAL(0x057)
+        },
+        {   // 5 * 16^7 * G
+            LIMB_PAIR(0x2BB30EBF, 0x13C41363), LIMB_PAIR(0x84A62B56, 0x1C51E2FB), LIMB_PAIR(0x883CB2CA, 0x0FFAEFE0), LIMB_PAIR(0x1997F036, 0x23A65115),
+            LIMB_PAIR(0x9C64E7E3, 0xF030712C), LIMB_PAIR(0x457AAF0D, 0x06320295), LIMB_PAIR(0xB2498539, 0x945BD82F), LIMB_PAIR(0x623A481D, 0x2995DF47), LIMB_PARTIAL(0x161),
+            LIMB_PAIR(0xFEB7F8B3, 0xF962F403), LIMB_PAIR(0x872DFF16, 0x244D8A3A), LIMB_PAIR(0x89F6DDCD, 0x59FDAABC), LIMB_PAIR(0x7DB8ACBF, 0x41661BC8),
+            LIMB_PAIR(0xC256C87F, 0x1B641D50), LIMB_PAIR(0x27CCDB57, 0xD7F8AADB), LIMB_PAIR(0x31F353C8, 0x4DAF6137), LIMB_PAIR(0x2A2A6F9E, 0x33D40188), LIMB_PARTIAL(0x125)
+        },
+        {   // 6 * 16^7 * G
+            LIMB_PAIR(0x6EED0F95, 0xBD406228), LIMB_PAIR(0x7C6C1C3F, 0x8693A9D9), LIMB_PAIR(0xC066DCC8, 0x0392E931), LIMB_PAIR(0xCC819D2E, 0x2E1EEDC6),
+            LIMB_PAIR(0x069E2217, 0xC7A315D6), LIMB_PAIR(0x08E6F72D, 0xA7495B18), LIMB_PAIR(0x7051FF13, 0x364F3811), LIMB_PAIR(0xBB59D612, 0xEEEB3CC4), LIMB_PARTIAL(0x0AC),
+            LIMB_PAIR(0x78616D6C, 0xFD9E0C10), LIMB_PAIR(0xA8D4AF09, 0x585DE5AD), LIMB_PAIR(0xC3143504, 0xD08D9021), LIMB_PAIR(0x7F67FFA2, 0xB38FE655),
+            LIMB_PAIR(0xD0FCB4D0, 0x5682040C), LIMB_PAIR(0xE6329179, 0xD56C8348), LIMB_PAIR(0x2621C84B, 0x76229A73), LIMB_PAIR(0xDE4CC81D, 0x0C98CB02), LIMB_PARTIAL(0x00A)
+        },
+        {   // 7 * 16^7 * G
+            LIMB_PAIR(0xA8F70EB0, 0xBFB85A9B), LIMB_PAIR(0xE59B107C, 0x9FA45D83), LIMB_PAIR(0xCFF39E25, 0x90207916), LIMB_PAIR(0x61816661, 0xDF20520F),
+            LIMB_PAIR(0x4D88EDDF, 0x250A81B6), LIMB_PAIR(0xD4C88E4F, 0x3583BCE4), LIMB_PAIR(0x6121DEEC, 0xFCAFBA31), LIMB_PAIR(0x45FF2C20, 0x40E71EA7), LIMB_PARTIAL(0x1D6),
+            LIMB_PAIR(0x50452ED6, 0xF91F2045), LIMB_PAIR(0x00FCA85D, 0x4C7BE74A), LIMB_PAIR(0x0FCC66DA, 0x6AC750DC), LIMB_PAIR(0x7BB3A7CD, 0x829CCEF8),
+            LIMB_PAIR(0x97039A3F, 0xF232419E), LIMB_PAIR(0xB5F00AD5, 0x1647039D), LIMB_PAIR(0xDD7F9785, 0xC72EBF12), LIMB_PAIR(0xC675E619, 0x42BBFD03), LIMB_PARTIAL(0x119)
+        },
+        {   // 8 * 16^7 * G
+            LIMB_PAIR(0xED0D691F, 0xB2308971), LIMB_PAIR(0x8CEF282F, 0x31C3C54E), LIMB_PAIR(0x97A5ED69, 0x5CC3D26A), LIMB_PAIR(0x43DA55BE, 0xB611A35D),
+            LIMB_PAIR(0x8FE11B61, 0x97492FE6), LIMB_PAIR(0xE26F0805, 0xC10A18F0), LIMB_PAIR(0xEA78E6BB, 0xB6E0F2A2), LIMB_PAIR(0x71C3F3DA, 0x2570F42E), LIMB_PARTIAL(0x043),
+            LIMB_PAIR(0xD0630DA9, 0x30048B23), LIMB_PAIR(0x0F635BA8, 0x3756D05E), LIMB_PAIR(0x8CE0E80B, 0x1E6E383A), LIMB_PAIR(0xC723D456, 0xCBE43361),
+            LIMB_PAIR(0x5CD18501, 0xB1F089E4), LIMB_PAIR(0x6FF2C160, 0x53132CF3), LIMB_PAIR(0x4A0406D9, 0xC759B7A2), LIMB_PAIR(0x6DC5143E, 0x17917E06), LIMB_PARTIAL(0x141)
+        }
+    },
+#endif
+#if (8 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^8 * G
+            LIMB_PAIR(0x008C7A44, 0xABF17FEB), LIMB_PAIR(0x7B12DEF4, 0xADE7917A), LIMB_PAIR(0x3786B033, 0xBFBA65B8), LIMB_PAIR(0xF0D9F9F1, 0x8EF4AF44),
+            LIMB_PAIR(0xAB136CAE, 0x8F47615C), LIMB_PAIR(0xBCBD5D3E, 0xE42F100D), LIMB_PAIR(0xF05F9B27, 0x8F3DC658), LIMB_PAIR(0xD6F2DBB2, 0xD95A6B2D), LIMB_PARTIAL(0x08E),
+            LIMB_PAIR(0x46BBC412, 0x23BB06A5), LIMB_PAIR(0xD0135EB6, 0x15718699), LIMB_PAIR(0xB4ED9E10, 0x8F1639C4), LIMB_PAIR(0xD7F644A0, 0x767FEE42),
+            LIMB_PAIR(0xFE8EC420, 0x668267B0), LIMB_PAIR(0x64E90133, 0xEC4F5482), LIMB_PAIR(0x536D132B, 0x679E614E), LIMB_PAIR(0x174DF6C5, 0x0D72FBAF), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 2 * 16^8 * G
+            LIMB_PAIR(0x2DE9B28F, 0xD256B607), LIMB_PAIR(0xCBEFE110, 0x286FC763), LIMB_PAIR(0x138783FB, 0x736FF52A), LIMB_PAIR(0x4EBCD973, 0x6F6D822B),
+            LIMB_PAIR(0x85ECA174, 0x78C5A0B6), LIMB_PAIR(0x79EA21B7, 0xBFCC5AB6), LIMB_PAIR(0x4937E0DA, 0x9CCB278D), LIMB_PAIR(0x2D009304, 0x9F50F442), LIMB_PARTIAL(0x049),
+            LIMB_PAIR(0x29F8A798, 0x566947D7), LIMB_PAIR(0x81CC1ED4, 0x9793A905), LIMB_PAIR(0x851115D4, 0x73DA631E), LIMB_PAIR(0xFC7DA6F5, 0xA0B5C181),
+            LIMB_PAIR(0x9F5A7634, 0xA70593D2), LIMB_PAIR(0x1E6250A8, 0xC9F71DF4), LIMB_PAIR(0x7A97CD35, 0x2DFD1089), LIMB_PAIR(0xD4E0074A, 0xC3CDAC7E), LIMB_PARTIAL(0x1FD)
+        },
+        {   // 3 * 16^8 * G
+            LIMB_PAIR(0x7694F566, 0x8FD8DC49), LIMB_PAIR(0x1FA6E13C, 0xB2AB052D), LIMB_PAIR(0x9AABC7CF, 0x7E4A708E), LIMB_PAIR(0x6B81F0F0, 0x68A9C33A),
+            LIMB_PAIR(0xF1F7CB07, 0x96E4988A), LIMB_PAIR(0xEA264C22, 0xDCA8D731), LIMB_PAIR(0x21B3372F, 0x245371E3), LIMB_PAIR(0x308D2300, 0x02216476), LIMB_PARTIAL(0x17A),
+            LIMB_PAIR(0x33696CFD, 0xEBF54116), LIMB_PAIR(0x419623A9, 0xA10C5784), LIMB_PAIR(0x38FA84D5, 0x4C6A119C), LIMB_PAIR(0x6D4E5BAF, 0x5C8EEE64),
+            LIMB_PAIR(0x9B4959D5, 0x7F99D26D), LIMB_PAIR(0x174F417C, 0x58708101), LIMB_PAIR(0x8294B72E, 0x48CAB8F3), LIMB_PAIR(0xD9710F9B, 0x828AAA19), LIMB_PARTIAL(0x192)
+        },
+        {   // 4 * 16^8 * G
+            LIMB_PAIR(0x02F799D8, 0xAED480E0), LIMB_PAIR(0xD635C04C, 0x021A2F24), LIMB_PAIR(0x004D0ABD, 0xE49A60D8), LIMB_PAIR(0x4D8873BD, 0x58AB8FB0),
+            LIMB_PAIR(0x1ECD98F1, 0xF36A43C8), LIMB_PAIR(0xCD2F93F7, 0x555F15C4), LIMB_PAIR(0x4EB95E03, 0x295D868D), LIMB_PAIR(0xB50553A1, 0x1AA8E425), LIMB_PARTIAL(0x1DE),
+            LIMB_PAIR(0x78FCBF33, 0x2EFCE598), LIMB_PAIR(0xF4E93711, 0xC499E9FD), LIMB_PAIR(0x0C6E6FAD, 0x0F5220AD), LIMB_PAIR(0x9FC9DA8C, 0xED0D0A9B),
+            LIMB_PAIR(0xF7813802, 0x84235958), LIMB_PAIR(0x62729B3D, 0xED21398E), LIMB_PAIR(0x3C9BB158, 0xDF6C25AB), LIMB_PAIR(0xEDD78E48, 0x87D306D9), LIMB_PARTIAL(0x085)
+        },
+        {   // 5 * 16^8 * G
+            LIMB_PAIR(0x7845697D, 0xC661D6FB), LIMB_PAIR(0xAA69C353, 0x324380E1), LIMB_PAIR(0x6961D564, 0x521E96D8), LIMB_PAIR(0xAF58E367, 0xB9D070FF),
+            LIMB_PAIR(0x5AC3B5A2, 0xABD851DF), LIMB_PAIR(0x530BAAEF, 0xEBC0BEF2), LIMB_PAIR(0x358627A2, 0x054BF32B), LIMB_PAIR(0xA205B0CB, 0x0AB65C3A), LIMB_PARTIAL(0x157),
+            LIMB_PAIR(0xA74CEC0E, 0x586C331E), LIMB_PAIR(0x2ECC3900, 0x2808851D), LIMB_PAIR(0x8003E820, 0x0A695392), LIMB_PAIR(0x81FC784E, 0xA667A7B0),
+            LIMB_PAIR(0xF33BBD74, 0x64EDDA2D), LIMB_PAIR(0x29FF01CA, 0x13EE0437), LIMB_PAIR(0x4EC28C03, 0x9192138C), LIMB_PAIR(0xD4E0F79C, 0x3DE5FC2B), LIMB_PARTIAL(0x096)
+        },
+        {   // 6 * 16^8 * G
+            LIMB_PAIR(0x22E41E28, 0x8EBA86B8), LIMB_PAIR(0x9D7A7103, 0xC26F7CAF), LIMB_PAIR(0xE462090E, 0x5D0F792F), LIMB_PAIR(0xD18BB44B, 0xA5F8C81E),
+            LIMB_PAIR(0x3E291040, 0x2E4E6E57), LIMB_PAIR(0x0A9F9660, 0xE347369D), LIMB_PAIR(0x3A680D61, 0x63BED10D), LIMB_PAIR(0xB03CCA7B, 0x8590210E), LIMB_PARTIAL(0x063),
+            LIMB_PAIR(0x5322914B, 0xF8D8536F), LIMB_PAIR(0xC179FC5C, 0x26E2D5AC), LIMB_PAIR(0xCC606124, 0xC7181A3F), LIMB_PAIR(0x474896C7, 0x7770DA72),
+            LIMB_PAIR(0xB25FB526, 0x2AAC427C), LIMB_PAIR(0x6C1F1086, 0xB3FCF016), LIMB_PAIR(0xB67643B9, 0x14F06DD7), LIMB_PAIR(0x9E8C2F78, 0x5BF94287), LIMB_PARTIAL(0x110)
+        },
+        {   // 7 * 16^8 * G
+            LIMB_PAIR(0x95051804, 0xA09523FF), LIMB_PAIR(0xC6EF7FBA, 0xC4B33367), LIMB_PAIR(0x292CD05C, 0x388C5AA3), LIMB_PAIR(0xDD93715E, 0xAE1B2CCE),
+            LIMB_PAIR(0x70D39632, 0xED7F02BE), LIMB_PAIR(0xD5169F74, 0xA9DB568E), LIMB_PAIR(0xAEB2F9CC, 0x6EB4424E), LIMB_PAIR(0x78FC446A, 0x358F1F27), LIMB_PARTIAL(0x0D7),
+            LIMB_PAIR(0x67694CA1, 0x3A4E0F64), LIMB_PAIR(0x2B1F54EE, 0xF50A6D56), LIMB_PAIR(0x9BEF1F78, 0xCA01350C), LIMB_PAIR(0xC6237D11, 0x778A4C6B),
+            LIMB_PAIR(0xA79F4C15, 0x270ED37A), LIMB_PAIR(0xC6D4ACDF, 0x4E38060B), LIMB_PAIR(0x1CEB1CCC, 0x5D39BA1C), LIMB_PAIR(0xE6D621C2, 0x94AB7FBA), LIMB_PARTIAL(0x1A4)
+        },
+        {   // 8 * 16^8 * G
+            LIMB_PAIR(0xAA9A08AB, 0xA0BEDE1B), LIMB_PAIR(0x1FC48289, 0xA3236453), LIMB_PAIR(0x8C4E95C5, 0x27F83D5A), LIMB_PAIR(0xA98B2122, 0xD4E05998),
+            LIMB_PAIR(0x7D51821B, 0xE4118AEC), LIMB_PAIR(0x883CE4E9, 0x18AE6C6A), LIMB_PAIR(0x0D65E4AF, 0x686D2A6E), LIMB_PAIR(0x68D87702, 0xCE00C727), LIMB_PARTIAL(0x04B),
+            LIMB_PAIR(0x4C0B4B11, 0x8C8C0C98), LIMB_PAIR(0x977E63AA, 0x09C31A00), LIMB_PAIR(0x42100B94, 0x1999F206), LIMB_PAIR(0xC4F0CF33, 0x7314DF12),
+            LIMB_PAIR(0x5F5DA290, 0x0BB59F1A), LIMB_PAIR(0x03D4FD95, 0xF08E85BC), LIMB_PAIR(0xD6FB0524, 0xCB0B361F), LIMB_PAIR(0xF35D713F, 0x9192A173), LIMB_PARTIAL(0x0B6)
+        }
+    },
+#endif
+#if (9 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^9 * G
+            LIMB_PAIR(0xC11B2A0B, 0xD23357CB), LIMB_PAIR(0xB179A631, 0x70DE0D3F), LIMB_PAIR(0x122B12B6, 0xB57A0FAD), LIMB_PAIR(0x78489416, 0x3203600F),
+            LIMB_PAIR(0xD26D2267, 0x99FE0B86), LIMB_PAIR(0x3B9DEED0, 0x36F3262F), LIMB_PAIR(0x24A32DCD, 0xB6E61160), LIMB_PAIR(0xAA745047, 0xEABD7C06), LIMB_PARTIAL(0x09C),
+            LIMB_PAIR(0xCDC4CFF1, 0x3F277E18), LIMB_PAIR(0x6EB7045F, 0xCAD81ADA), LIMB_PAIR(0xBB804212, 0x3F82D6DA), LIMB_PAIR(0x03B6A618, 0x7ECA8375),
+            LIMB_PAIR(0x95F2970D, 0xDA887969), LIMB_PAIR(0xEB3A7834, 0x21FC350F), LIMB_PAIR(0x55F9AC1C, 0xFC332B6E), LIMB_PAIR(0x18D4111A, 0x0D85B434), LIMB_PARTIAL(0x03A)
+        },
+        {   // 2 * 16^9 * G
+            LIMB_PAIR(0xCCEC2C14, 0x9B7B7DA8), LIMB_PAIR(0xCF4FCF1B, 0x1EBD382D), LIMB_PAIR(0xF1C3F836, 0x72A07D22), LIMB_PAIR(0x52992679, 0xEF166DE4),
+            LIMB_PAIR(0x088555CD, 0x5ADD8684), LIMB_PAIR(0xC2F8FFF6, 0x61FBB803), LIMB_PAIR(0xE52770FA, 0x7DA8E738), LIMB_PAIR(0xF9F2506D, 0x36A94145), LIMB_PARTIAL(0x16E),
+            LIMB_PAIR(0x9E6F7092, 0x50AF6F09), LIMB_PAIR(0xBD540556, 0x541ACAC8), LIMB_PAIR(0x616159C2, 0xF927547A), LIMB_PAIR(0x7C7DFE4C, 0x4D2A8461),
+            LIMB_PAIR(0x754FDADF, 0xB603C320), LIMB_PAIR(0x35C19059, 0x0ADA9862), LIMB_PAIR(0xBE17A78A, 0xAA95304E), LIMB_PAIR(0x41244129, 0x50F8BAFF), LIMB_PARTIAL(0x1D6)
+        },
+        {   // 3 * 16^9 * G
+            LIMB_PAIR(0xC0C3E8AA, 0xA8187A5F), LIMB_PAIR(0x6DBAE123, 0x89107B45), LIMB_PAIR(0x57EE86F9, 0x023BB57A), LIMB_PAIR(0xD0A5E4B0, 0x7B574F5D),
+            LIMB_PAIR(0xE8C79CE3, 0xF832B673), LIMB_PAIR(0x6771037A, 0xC10BFDF6), LIMB_PAIR(0xFAD2B5DB, 0xF448E37E), LIMB_PAIR(0xEF6701F1, 0x198293CA), LIMB_PARTIAL(0x070),
+            LIMB_PAIR(0xDEB4DB92, 0xEE3E2714), LIMB_PAIR(0x3E2A9E0F, 0x5AF53D65), LIMB_PAIR(0x0FA38E48, 0x8FE35F6E), LIMB_PAIR(0x5DD085E7, 0xE512D689),
+            LIMB_PAIR(0xEAD33215, 0x8B6AAC03), LIMB_PAIR(0x6DDA0F8B, 0x44CF0C3C), LIMB_PAIR(0xA861F599, 0x1D642848), LIMB_PAIR(0x2D02DD4F, 0xAAE60D55), LIMB_PARTIAL(0x1BB)
+        },
+        {   // 4 * 16^9 * G
+            LIMB_PAIR(0x5DC62EFB, 0x6A7316DD), LIMB_PAIR(0x824CF4DC, 0x377777EB), LIMB_PAIR(0x7255C5A0, 0xE349E945), LIMB_PAIR(0xBF497E75, 0x64111CB9),
+            LIMB_PAIR(0x14B1EAAA, 0x1D91DCC7), LIMB_PAIR(0xCBCF5454, 0x87EA1779), LIMB_PAIR(0x42C890F3, 0x070F848D), LIMB_PAIR(0x81E4BC6F, 0xAAAF9A38), LIMB_PARTIAL(0x0BA),
+            LIMB_PAIR(0x853096CE, 0xFD521F1D), LIMB_PAIR(0x3C8F7AC5, 0xA44CCA3F), LIMB_PAIR(0x3F30CFCE, 0xD960927B), LIMB_PAIR(0xC5999722, 0x0D30FEB7),
+            LIMB_PAIR(0x2ADC3822, 0x5B0D38E2), LIMB_PAIR(0x2AED7AF7, 0xA00F4A02), LIMB_PAIR(0x6ED4DD28, 0x1BC83E71), LIMB_PAIR(0x38615D83, 0xBA2213A2), LIMB_PARTIAL(0x1A7)
+        },
+        {   // 5 * 16^9 * G
+            LIMB_PAIR(0x453A46D0, 0x4A7912F4), LIMB_PAIR(0x1C7CF115, 0x1D2E7623), LIMB_PAIR(0x8F29C610, 0x2208DE2B), LIMB_PAIR(0x81E502B5, 0x809DAA61),
+            LIMB_PAIR(0x6BD724B5, 0xA8F149FC), LIMB_PAIR(0x31CE0E18, 0x38AF43FC), LIMB_PAIR(0xE8139CFB, 0xA2FDBA97), LIMB_PAIR(0x9EB155F9, 0x665271BD), LIMB_PARTIAL(0x1F1),
+            LIMB_PAIR(0x8D28EA7A, 0x8B86FC46), LIMB_PAIR(0x51D8FA58, 0x8CF2558A), LIMB_PAIR(0xD7BA83E6, 0x2C97C546), LIMB_PAIR(0xACF26595, 0xDE7CF223),
+            LIMB_PAIR(0x4CE7407F, 0x7802038E), LIMB_PAIR(0xAC6B1DE1, 0x95574CA7), LIMB_PAIR(0xF0E9C573, 0x98631057), LIMB_PAIR(0x55E8BD77, 0x43FA05D1), LIMB_PARTIAL(0x0A1)
+        },
+        {   // 6 * 16^9 * G
+            LIMB_PAIR(0x1AFB08A9, 0x6F332629), LIMB_PAIR(0x908C995C, 0x9F159DB2), LIMB_PAIR(0x5E8DFD58, 0xA36F91BB), LIMB_PAIR(0x736CE4D1, 0xA8EE1CD8),
+            LIMB_PAIR(0xCF58AE21, 0x45832AB2), LIMB_PAIR(0x316E9061, 0x08EE6A41), LIMB_PAIR(0x1A2FFC32, 0x0E39DB0B), LIMB_PAIR(0x380323CA, 0xEA9414E1), LIMB_PARTIAL(0x042),
+            LIMB_PAIR(0xFC832689, 0xFF010E54), LIMB_PAIR(0xC59214EC, 0xEE1F4824), LIMB_PAIR(0x62B52F22, 0x8AC0DC4A), LIMB_PAIR(0xDBA63497, 0xCCA082D2),
+            LIMB_PAIR(0x826E8CD4, 0x03B4DAFD), LIMB_PAIR(0x0F8AC57A, 0xBC3C5958), LIMB_PAIR(0x89525CB3, 0xFA533297), LIMB_PAIR(0x47CE0D1E, 0xC00ED595), LIMB_PARTIAL(0x0D3)
+        },
+        {   // 7 * 16^9 * G
+            LIMB_PAIR(0xBC78973A, 0x50C0AE1B), LIMB_PAIR(0x5AFC5571, 0xDA11769B), LIMB_PAIR(0x3989FC6E, 0x72DCA0E1), LIMB_PAIR(0x1F23BE5A, 0x270E2D67),
+            LIMB_PAIR(0x8BB2AEF0, 0x0C9D34D4), LIMB_PAIR(0x48EF02F4, 0x37F07FDB), LIMB_PAIR(0xE0C549EF, 0xFF1C0206), LIMB_PAIR(0x6FD94255, 0x9A62C16A), LIMB_PARTIAL(0x05C),
+            LIMB_PAIR(0x785A3C92, 0x368D1944), LIMB_PAIR(0xF92D17B7, 0xBAB00EF3), LIMB_PAIR(0xE6B2113A, 0xE8F15F69), LIMB_PAIR(0xF6B46F5C, 0xD58342FF),
+            LIMB_PAIR(0xADA12ADE, 0xA0EDF615), LIMB_PAIR(0xE7B4926B, 0x12D90798), LIMB_PAIR(0x671BBA9D, 0x284CA9E1), LIMB_PAIR(0x8ED23F9B, 0x15DEF43A), LIMB_PARTIAL(0x1D2)
+        },
+        {   // 8 * 16^9 * G
+            LIMB_PAIR(0x2F415999, 0xD714194E), LIMB_PAIR(0x5128D8D9, 0xA4B29D68), LIMB_PAIR(0x3324CA57, 0xD1046CB8), LIMB_PAIR(0x04828300, 0xE5E6A475),
+            LIMB_PAIR(0x694C18E9, 0x9C5C4F6C), LIMB_PAIR(0xD01E5707, 0x84D00DE8), LIMB_PAIR(0xBC2B3E66, 0x8ED94290), LIMB_PAIR(0xEC6A6E31, 0xAFE23A51), LIMB_PARTIAL(0x141),
+            LIMB_PAIR(0x976E9C3E, 0x2B996FAE), LIMB_PAIR(0xBE1288DF, 0xBA0CC494), LIMB_PAIR(0xDE8AAB8E, 0xCEB07FA6), LIMB_PAIR(0x985651AD, 0x7F460647),
+            LIMB_PAIR(0x189376F0, 0xEE200258), LIMB_PAIR(0xF9A7AC9E, 0x21F13320), LIMB_PAIR(0x8F3CD359, 0x66A57BC5), LIMB_PAIR(0x75ED8259, 0x7B138327), LIMB_PARTIAL(0x18F)
+        }
+    },
+#endif
+#if (10 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^10 * G
+            LIMB_PAIR(0xE93EF527, 0x1683448D), LIMB_PAIR(0x0E5B6F98, 0x158FD922), LIMB_PAIR(0xE23F2FA6, 0xCD0BCEA6), LIMB_PAIR(0x15982D3B, 0x455D35DE),
+            LIMB_PAIR(0xBDA98D71, 0x2FC788D7), LIMB_PAIR(0xF139B889, 0x65D44C08), LIMB_PAIR(0x4105FD65, 0x219749FD), LIMB_PAIR(0xE02F1FD1, 0xA9FF816A), LIMB_PARTIAL(0x0F0),
+            LIMB_PAIR(0xE55948CD, 0xA2A53148), LIMB_PAIR(0x0CC0A0B5, 0x2D952F50), LIMB_PAIR(0x61839836, 0x26F77E71), LIMB_PAIR(0xAD87BB45, 0xA8BF589A),
+            LIMB_PAIR(0x6A9296E4, 0xAF21E0FC), LIMB_PAIR(0x7D394E96, 0x91788120), LIMB_PAIR(0x68622361, 0x47F3D389), LIMB_PAIR(0x090A8CB2, 0xF17141DA), LIMB_PARTIAL(0x1B6)
+        },
+        {   // 2 * 16^10 * G
+            LIMB_PAIR(0x21A91383, 0xA6149AC8), LIMB_PAIR(0x63176A50, 0xFAE0515C), LIMB_PAIR(0x696E3E7E, 0x436D0D6A), LIMB_PAIR(0xB32B2E16, 0x3D44EA3E),
+            LIMB_PAIR(0x66F3BBE0, 0x142644CC), LIMB_PAIR(0x82322B00, 0x697D5CEF), LIMB_PAIR(0x4C388EDB, 0x384543C6), LIMB_PAIR(0xD395D1D1, 0x4AFEDCFF), LIMB_PARTIAL(0x02D),
+            LIMB_PAIR(0x84CEC5F9, 0xA7B35FAC), LIMB_PAIR(0x5D827E5C, 0x003DAAA6), LIMB_PAIR(0xDFC8263D, 0xC7C5F3D3), LIMB_PAIR(0xD98790D2, 0x8DCA1315),
+            LIMB_PAIR(0xF00346BE, 0xB1F54568), LIMB_PAIR(0xDE680D87, 0x3E6F6876), LIMB_PAIR(0x6AF2E269, 0xDE73E95B), LIMB_PAIR(0x7E8FAE93, 0xA5969EC7), LIMB_PARTIAL(0x185)
+        },
+        {   // 3 * 16^10 * G
+            LIMB_PAIR(0xE7BD87F3, 0x0F28D8B4), LIMB_PAIR(0x1FF661B1, 0xCC50621C), LIMB_PAIR(0x24D26BCF, 0xE9907708), LIMB_PAIR(0x14FBEBC0, 0x6085222B),
+            LIMB_PAIR(0xD55B4431, 0x41EE5411), LIMB_PAIR(0xA0A871F4, 0x51895481), LIMB_PAIR(0x0BCD5935, 0xAB250908), LIMB_PAIR(0x9617256E, 0xB3AC49B2), LIMB_PARTIAL(0x172),
+            LIMB_PAIR(0x406F50F3, 0x5659B7E3), LIMB_PAIR(0x0FC52027, 0x7A7B0D31), LIMB_PAIR(0x9FFACB31, 0x00752BFD), LIMB_PAIR(0xB0727679, 0x98A0E45F),
+            LIMB_PAIR(0x36D3387C, 0x789CE025), LIMB_PAIR(0xE59BACBC, 0xE49B41F4), LIMB_PAIR(0x199774CB, 0x4AD05ED8), LIMB_PAIR(0x36B12EA6, 0xC9B1D3A4), LIMB_PARTIAL(0x004)
+        },
+        {   // 4 * 16^10 * G
+            LIMB_PAIR(0xBC0FFEE5, 0x747E8DDD), LIMB_PAIR(0xFB9178A5, 0xA50F058A), LIMB_PAIR(0xB2D52777, 0x14F41C93), LIMB_PAIR(0xAECAC13C, 0xF7C95492),
+            LIMB_PAIR(0xB7F715D3, 0x9698BEF3), LIMB_PAIR(0xF132C199, 0xBD7FABC2), LIMB_PAIR(0x6E9B47A4, 0xBEC85613), LIMB_PAIR(0x62F85CAD, 0x08C7486E), LIMB_PARTIAL(0x036),
+            LIMB_PAIR(0xB39C9BA2, 0x3A44D74E), LIMB_PAIR(0xE89DE157, 0x22B4C6AE), LIMB_PAIR(0xB93DC56E, 0xFE4985BB), LIMB_PAIR(0xDD1201AE, 0x85D435BF),
+            LIMB_PAIR(0xAA68D442, 0xA01E7F53), LIMB_PAIR(0x9D9AFCDA, 0x2A4FCF50), LIMB_PAIR(0x6B95D6F4, 0xCC4C5B5C), LIMB_PAIR(0x8C390221, 0x5E8AFA0E), LIMB_PARTIAL(0x1C1)
+        },
+        {   // 5 * 16^10 * G
+            LIMB_PAIR(0xC32D4D9A, 0x0B942D7A), LIMB_PAIR(0xED8597BB, 0xB08FD2DE), LIMB_PAIR(0x4B081B9F, 0x40036754), LIMB_PAIR(0x9C4FD91D, 0x317C4888),
+            LIMB_PAIR(0x18A7BB51, 0xC872FB14), LIMB_PAIR(0xBF314B67, 0xD530C7F4), LIMB_PAIR(0x1C32E6C9, 0x58D77F7D), LIMB_PAIR(0x0F977B24, 0xE626BA9F), LIMB_PARTIAL(0x115),
+            LIMB_PAIR(0xE6B4320C, 0x0AD192A8), LIMB_PAIR(0xE3ACB532, 0x699204E6), LIMB_PAIR(0x17B5E0A5, 0x992CD0C0), LIMB_PAIR(0x2E533D85, 0xB58CD08D),
+            LIMB_PAIR(0x92939F75, 0x4E5EF9D6), LIMB_PAIR(0x42994066, 0x13F7C3DB), LIMB_PAIR(0x24E12473, 0x2E2993B3), LIMB_PAIR(0x8DE5501E, 0xDF6D4213), LIMB_PARTIAL(0x192)
+        },
+        {   // 6 * 16^10 * G
+            LIMB_PAIR(0xB380DC01, 0x737D7C73), LIMB_PAIR(0xF16384D3, 0xC2D548F0), LIMB_PAIR(0xA8B806A1, 0xEFF66340), LIMB_PAIR(0xAF49AC09, 0x67B886BA),
+            LIMB_PAIR(0x32EF8BA4, 0xCA94B2C5), LIMB_PAIR(0xE8FCA70F, 0x94AEF954), LIMB_PAIR(0xD300D019, 0x448E6900), LIMB_PAIR(0x8D58FE75, 0x7EB74B4B), LIMB_PARTIAL(0x16A),
+            LIMB_PAIR(0xB08731E8, 0xBC7D410F), LIMB_PAIR(0xC7B75AB6, 0x37BE53F1), LIMB_PAIR(0xCF276F85, 0x95A94590), LIMB_PAIR(0xFC1BA916, 0x9F3A4A66),
+            LIMB_PAIR(0xB1D4E469, 0x057C0390), LIMB_PAIR(0x14CED765, 0x218F7FD2), LIMB_PAIR(0x60DEA0EB, 0xA0A788FA), LIMB_PAIR(0xF0722A2A, 0x3DCBFC5D), LIMB_PARTIAL(0x1BB)
+        },
+        {   // 7 * 16^10 * G
+            LIMB_PAIR(0x1CCE4FF4, 0x3F8ADF41), LIMB_PAIR(0x0B65EEC1, 0x9C347CC5), LIMB_PAIR(0x900F860F, 0x83BEDBD2), LIMB_PAIR(0x462FB193, 0x172F2C33),
+            LIMB_PAIR(0x5466F3AE, 0x1DFBBC0A), LIMB_PAIR(0xFA41670E, 0xE80DB754), LIMB_PAIR(0xDC887B1E, 0x37D5FD76), LIMB_PAIR(0x3346AAA2, 0x6D0AEE5C), LIMB_PARTIAL(0x0C4),
+            LIMB_PAIR(0xA3C933AC, 0x2B44493A), LIMB_PAIR(0xB953B133, 0x22C5B2C2), LIMB_PAIR(0x12F58FB3, 0x06800157), LIMB_PAIR(0xE6BD2AA2, 0x1953B249),
+            LIMB_PAIR(0x77CFBF6E, 0x236A4D0A), LIMB_PAIR(0xB91915FE, 0x7714CC71), LIMB_PAIR(0x63F6028C, 0xBCE80866), LIMB_PAIR(0x7589CF6A, 0x0B2418D3), LIMB_PARTIAL(0x0BA)
+        },
+        {   // 8 * 16^10 * G
+            LIMB_PAIR(0x799E30A1, 0xAA498BBA), LIMB_PAIR(0x562EEDE4, 0x7E193DB1), LIMB_PAIR(0xF4A94BC1, 0x4DC49402), LIMB_PAIR(0xC4D7D024, 0xCB63D972),
+            LIMB_PAIR(0xF6778B61, 0x98D59716), LIMB_PAIR(0xB40261E4, 0xE6C0A829), LIMB_PAIR(0x65E3B28C, 0x5F1738FB), LIMB_PAIR(0x16A75CE7, 0x3C4E80D2), LIMB_PARTIAL(0x035),
+            LIMB_PAIR(0x733DED62, 0x376D19EF), LIMB_PAIR(0x0A93203D, 0x9400E36E), LIMB_PAIR(0xF98BA94B, 0x013EF7CA), LIMB_PAIR(0x35756AAA, 0xB7556CA0),
+            LIMB_PAIR(0x2F643611, 0xC6B8B05A), LIMB_PAIR(0x438F759B, 0x23891B32), LIMB_PAIR(0x27F69733, 0xECC9927E), LIMB_PAIR(0x969AE58D, 0x2EBE0180), LIMB_PARTIAL(0x069)
+        }
+    },
+#endif
+#if (11 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^11 * G
+            LIMB_PAIR(0xB6813F72, 0x6F7F2FE8), LIMB_PAIR(0x940210F0, 0x95F979FE), LIMB_PAIR(0x1A409657, 0x42CBD8D7), LIMB_PAIR(0x474C141B, 0x2E2D2F08),
+            LIMB_PAIR(0x52A6A362, 0x63E5EFF0), LIMB_PAIR(0xB1C5A27D, 0xCD24503E), LIMB_PAIR(0xDB08B256, 0x30335D77), LIMB_PAIR(0x9724BEBF, 0x827057CF), LIMB_PARTIAL(0x003),
+            LIMB_PAIR(0xDC5FEEF6, 0x6B372CA7), LIMB_PAIR(0xD06696B6, 0x7557C331), LIMB_PAIR(0x4A42090F, 0x4B10D90B), LIMB_PAIR(0x6F10352B, 0x2C93E984),
+            LIMB_PAIR(0x2B8DED01, 0x72AC24FF), LIMB_PAIR(0xD8C833A6, 0xFA53F5DA), LIMB_PAIR(0x7C9354CA, 0xC166ED4B), LIMB_PAIR(0x9E3B4CF5, 0x81DF59A0), LIMB_PARTIAL(0x1FA)
+        },
+        {   // 2 * 16^11 * G
+            LIMB_PAIR(0xE43C6A8B, 0x8CE9E114), LIMB_PAIR(0x804168B8, 0x4EE9F8B0), LIMB_PAIR(0x5FA74509, 0xF5FFFD5B), LIMB_PAIR(0xDC20088E, 0x4589D84C),
+            LIMB_PAIR(0xD8CCA5AD, 0x00CDB864), LIMB_PAIR(0x74CB7285, 0xFAB8EE16), LIMB_PAIR(0xAB702098, 0xD5E46FC6), LIMB_PAIR(0x9CDB1896, 0xCAEB2EF7), LIMB_PARTIAL(0x1EC),
+            LIMB_PAIR(0x26B04438, 0xF5886BBC), LIMB_PAIR(0xD9567198, 0x61613D0E), LIMB_PAIR(0xCA99B91E, 0x749EB5D8), LIMB_PAIR(0x53B41996, 0x5861944D),
+            LIMB_PAIR(0x54DF4765, 0xDC22071C), LIMB_PAIR(0xB8414AEF, 0x1F6288A8), LIMB_PAIR(0x7FF1C5EA, 0x6B34DB2F), LIMB_PAIR(0xFF5262B0, 0x5EDF2873), LIMB_PARTIAL(0x02E)
+        },
+        {   // 3 * 16^11 * G
+            LIMB_PAIR(0xCC6DCE31, 0xCB9E50B3), LIMB_PAIR(0x60399388, 0x0B656FDA), LIMB_PAIR(0x600D4B62, 0xD3104FA3), LIMB_PAIR(0xB660E0EA, 0x7CFC68AC),
+            LIMB_PAIR(0xDD9F415F, 0xD8C2218A), LIMB_PAIR(0x26C649D9, 0xB3E0D7C6), LIMB_PAIR(0x4D09F7FC, 0x37E6279F), LIMB_PAIR(0x136AD787, 0xE9EF720E), LIMB_PARTIAL(0x0E3),
+            LIMB_PAIR(0xD03870D7, 0x0BADA672), LIMB_PAIR(0x815592E0, 0x553EF23F), LIMB_PAIR(0xB8DD5471, 0xC1132AD8), LIMB_PAIR(0xB80B521A, 0xD8666E9F),
+            LIMB_PAIR(0x2C62908B, 0x38F49D54), LIMB_PAIR(0xC9F15B3C, 0x3095F1BE), LIMB_PAIR(0xFE8866D7, 0x5AA771BA), LIMB_PAIR(0x8590B3CF, 0x0FA253A2), LIMB_PARTIAL(0x015)
+        },
+        {   // 4 * 16^11 * G
+            LIMB_PAIR(0xF1A37365, 0x49D0E9BB), LIMB_PAIR(0x523FFAFE, 0x650F8E4E), LIMB_PAIR(0x517B3AAC, 0x37B691A0), LIMB_PAIR(0x1824CBA0, 0x73372E76),
+            LIMB_PAIR(0x063372E3, 0x0C0A1AC3), LIMB_PAIR(0x41AA63ED, 0x23874708), LIMB_PAIR(0xAF840388, 0x1D70995D), LIMB_PAIR(0x491B2E8D, 0xEA733E27), LIMB_PARTIAL(0x122),
+            LIMB_PAIR(0x573B43ED, 0xEB6E7C3B), LIMB_PAIR(0x08F87584, 0xA645F293), LIMB_PAIR(0xAF100AA9, 0x19A56FE0), LIMB_PAIR(0xB1D5FDBA, 0xB767CE92),
+            LIMB_PAIR(0x0C349030, 0xDBF9B1B2), LIMB_PAIR(0x586E1AB8, 0x42F0CDF3), LIMB_PAIR(0x99631140, 0x65876BEA), LIMB_PAIR(0x268AF542, 0xBF016FD8), LIMB_PARTIAL(0x1AC)
+        },
+        {   // 5 * 16^11 * G
+            LIMB_PAIR(0x47525F3B, 0x31338097), LIMB_PAIR(0xC6CDF694, 0x49551E31), LIMB_PAIR(0x5B9451F1, 0xDFBE8362), LIMB_PAIR(0xEE491931, 0xFED9C23B),
+            LIMB_PAIR(0x324D645C, 0x5270A02F), LIMB_PAIR(0x4175D154, 0xE323781F), LIMB_PAIR(0xFF475990, 0x31511E52), LIMB_PAIR(0x69B0445E, 0x0B60CDA3), LIMB_PARTIAL(0x082),
+            LIMB_PAIR(0x92FA5405, 0x822E4180), LIMB_PAIR(0x6B4D67B8, 0xE78F939B), LIMB_PAIR(0x265E1B54, 0x6F09C296), LIMB_PAIR(0xB6BAA0BA, 0xF6EF60DD),
+            LIMB_PAIR(0x8BE593BA, 0x1D83F296), LIMB_PAIR(0x7E71D499, 0x777E0632), LIMB_PAIR(0x2E0DED5E, 0x5DB33416), LIMB_PAIR(0x357E1BE4, 0x6800DC32), LIMB_PARTIAL(0x077)
+        },
+        {   // 6 * 16^11 * G
+            LIMB_PAIR(0x804ED5E3, 0x7992DA26), LIMB_PAIR(0x5FCC6497, 0xAC4677B0), LIMB_PAIR(0x208EBD95, 0xB1A09585), LIMB_PAIR(0x199D3419, 0x1C0CFAE7),
+            LIMB_PAIR(0x0715A11D, 0x7C862F54), LIMB_PAIR(0x9CAB55B0, 0xD23E934F), LIMB_PAIR(0xD4310FAB, 0xFD5D250A), LIMB_PAIR(0xAEF426BD, 0x0976782C), LIMB_PARTIAL(0x05E),
+            LIMB_PAIR(0x2A7D5B37, 0xF78B0A7A), LIMB_PAIR(0xFEDF69DE, 0xF31C5594), LIMB_PAIR(0x57F76616, 0xB2B9E3F1), LIMB_PAIR(0x3040CCA6, 0xE9CFA2F2),
+            LIMB_PAIR(0x5A72502E, 0x8A91BF0C), LIMB_PAIR(0x3C810D16, 0x71F8A5B6), LIMB_PAIR(0x2A7666DC, 0xC9701CE4), LIMB_PAIR(0x216A59C5, 0x2DA80D6C), LIMB_PARTIAL(0x1E8)
+        },
+        {   // 7 * 16^11 * G
+            LIMB_PAIR(0xAAD63226, 0x46FBCF70), LIMB_PAIR(0xF2C43F64, 0xC023EB8A), LIMB_PAIR(0xA3F42111, 0xAB1B684C), LIMB_PAIR(0xD12CEA22, 0xC6262621),
+            LIMB_PAIR(0xAD523F98, 0xA2539D86), LIMB_PAIR(0xB45F0B6F, 0x76B98970), LIMB_PAIR(0xD788809C, 0xF9874DF8), LIMB_PAIR(0xAB358B89, 0xB24620C7), LIMB_PARTIAL(0x0C1),
+            LIMB_PAIR(0x92E3B976, 0xDD50316F), LIMB_PAIR(0xECDF1DC5, 0xB6A2FED9), LIMB_PAIR(0x7F40B693, 0x746BB5D6), LIMB_PAIR(0x0572240E, 0xB76CE9E4),
+            LIMB_PAIR(0x084F25BA, 0x5C65A823), LIMB_PAIR(0xB9890EC6, 0x51BA6ED9), LIMB_PAIR(0xCAD192D9, 0x3930DEA2), LIMB_PAIR(0x16DD9BFC, 0x2C781504), LIMB_PARTIAL(0x126)
+        },
+        {   // 8 * 16^11 * G
+            LIMB_PAIR(0x6EA5E7EA, 0x2631B3C3), LIMB_PAIR(0xC566C837, 0x0576E1ED), LIMB_PAIR(0xAC9C1EB8, 0x1E50E071), LIMB_PAIR(0xA8482D3B, 0x5E74360E),
+            LIMB_PAIR(0x18CEAB4C, 0x2E037E77), LIMB_PAIR(0xC8424FAB, 0xF7D17456), LIMB_PAIR(0x82FE1841, 0x202EFBF5), LIMB_PAIR(0x8CCA4C68, 0x410F708C), LIMB_PARTIAL(0x165),
+            LIMB_PAIR(0xD00EA056, 0x659DECE0), LIMB_PAIR(0x3D1301CA, 0x495170F4), LIMB_PAIR(0xCF2C6E53, 0x749E3276), LIMB_PAIR(0x87B6F996, 0xC0F5D000),
+            LIMB_PAIR(0xDFD50725, 0x46B7C068), LIMB_PAIR(0x67EF401B, 0x83E9D3DE), LIMB_PAIR(0x3D4EF196, 0xEC1CEE4E), LIMB_PAIR(0xBEF2DD76, 0x31583197), LIMB_PARTIAL(0x023)
+        }
+    },
+#endif
+#if (12 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^12 * G
+            LIMB_PAIR(0x1C3BE7EF, 0x62B63169), LIMB_PAIR(0x8074207D, 0xDAB254BF), LIMB_PAIR(0x235A4C77, 0xF6F1466B), LIMB_PAIR(0xD3B01424, 0x66F8F60F),
+            LIMB_PAIR(0x3BAE9F80, 0x9DA54069), LIMB_PAIR(0x500F8A6C, 0x1A840763), LIMB_PAIR(0xB25994B1, 0x542E2DD9), LIMB_PAIR(0x183B3CEE, 0x996307E5), LIMB_PARTIAL(0x06E),
+            LIMB_PAIR(0xA4B301ED, 0x45E2AE85), LIMB_PAIR(0xE1FB6112, 0x0640D46D), LIMB_PAIR(0x83FC8F4B, 0x7F102D19), LIMB_PAIR(0x4F30038E, 0x6EEECE3A),
+            LIMB_PAIR(0x912F39C3, 0x74D062F5), LIMB_PAIR(0x16906C7B, 0xA802A553), LIMB_PAIR(0xE6D6E8C1, 0xA8D8C58F), LIMB_PAIR(0xA57B4387, 0x77CFD9BC), LIMB_PARTIAL(0x1F0)
+        },
+        {   // 2 * 16^12 * G
+            LIMB_PAIR(0x4268E7AC, 0x3B61C320), LIMB_PAIR(0x6DD3709F, 0xF9FEF197), LIMB_PAIR(0x51F7146D, 0xABD3A2D5), LIMB_PAIR(0xF40188F9, 0x4C03D266),
+            LIMB_PAIR(0x088BAE58, 0x56E27DFD), LIMB_PAIR(0x03FA2B77, 0x5BA4660D), LIMB_PAIR(0xA39FF216, 0x56889642), LIMB_PAIR(0xCA849201, 0xC11B9FEA), LIMB_PARTIAL(0x07E),
+            LIMB_PAIR(0x1DBCA40D, 0x357C7797), LIMB_PAIR(0x6D3C6441, 0x23C449C2), LIMB_PAIR(0x26CA2D6E, 0x6AD3B6A6), LIMB_PAIR(0xB2CA4AA6, 0x32CADCB3),
+            LIMB_PAIR(0xAD004AA8, 0xDDDC43E5), LIMB_PAIR(0x37600864, 0x7994E3AB), LIMB_PAIR(0x76E4580E, 0xF09F2639), LIMB_PAIR(0xA270CD54, 0x6A2032A0), LIMB_PARTIAL(0x17A)
+        },
+        {   // 3 * 16^12 * G
+            LIMB_PAIR(0x8EAC672F, 0x2FA8A511), LIMB_PAIR(0x18B28A2F, 0xB58FE9A2), LIMB_PAIR(0x69CB28AE, 0x0DB617AD), LIMB_PAIR(0xADCC6220, 0xAC90B7D8),
+            LIMB_PAIR(0x852A7529, 0x3113C468), LIMB_PAIR(0xDF7CF5CB, 0xAAC72C21), LIMB_PAIR(0xE341E2CD, 0x3C1DAFAB), LIMB_PAIR(0x68E9CBF2, 0x8AECF2A3), LIMB_PARTIAL(0x149),
+            LIMB_PAIR(0xC3ACFC2F, 0x1461A475), LIMB_PAIR(0x0CF6C4E7, 0x53EE5E37), LIMB_PAIR(0xD20FCD4A, 0xBC89CD30), LIMB_PAIR(0x3CB0B266, 0xABF7AB38),
+            LIMB_PAIR(0xCF12EEC3, 0x6030727C), LIMB_PAIR(0x90F159A3, 0x9B3E7CB7), LIMB_PAIR(0xB364C651, 0x60DDDE88), LIMB_PAIR(0x0FDE7B06, 0xA575474E), LIMB_PARTIAL(0x0B2)
+        },
+        {   // 4 * 16^12 * G
+            LIMB_PAIR(0x569614A3, 0x598766CE), LIMB_PAIR(0xD485CC29, 0xFC1534F1), LIMB_PAIR(0x4F099A45, 0x1F5E87CE), LIMB_PAIR(0x387D4D84, 0x93E6071F),
+            LIMB_PAIR(0xA130F8BC, 0xA3F72298), LIMB_PAIR(0xEDD37225, 0x51372018), LIMB_PAIR(0xB856F72D, 0x165340E9), LIMB_PAIR(0x9011BC47, 0x4D64EC74), LIMB_PARTIAL(0x04C),
+            LIMB_PAIR(0x5B62D194, 0x975D2C0D), LIMB_PAIR(0x1BBD10BD, 0x845D25CB), LIMB_PAIR(0x42EE849A, 0x1326F9D7), LIMB_PAIR(0xA333154C, 0x61F90228),
+            LIMB_PAIR(0x7500F71E, 0x4993F33D), LIMB_PAIR(0x1B6DCF4E, 0x3824DC40), LIMB_PAIR(0xB65B8ECA, 0x1C71E193), LIMB_PAIR(0xDCA1396B, 0xA8DDC0C7), LIMB_PARTIAL(0x1A3)
+        },
+        {   // 5 * 16^12 * G
+            LIMB_PAIR(0x9D906490, 0x0DD159BF), LIMB_PAIR(0x9CF878DE, 0xF3167E2C), LIMB_PAIR(0x9FE4E683, 0xB2BCE411), LIMB_PAIR(0xE82D628A, 0x1F7EDC9A),
+            LIMB_PAIR(0xCD23E4DF, 0xCF4A33AD), LIMB_PAIR(0x21CBFAF7, 0xC0A49058), LIMB_PAIR(0x635E858E, 0x192FB797), LIMB_PAIR(0x325E6C47, 0x68DAD953), LIMB_PARTIAL(0x0B7),
+            LIMB_PAIR(0x14E26CC9, 0x662DF578), LIMB_PAIR(0xC83FC419, 0x601A649F), LIMB_PAIR(0xC80CFB85, 0x1AFE2549), LIMB_PAIR(0x0B949F46, 0xEF38EB32),
+            LIMB_PAIR(0x7B42E487, 0x5FDF3664), LIMB_PAIR(0xD509DF41, 0x7073C6AF), LIMB_PAIR(0x066A0911, 0x7CB9E459), LIMB_PAIR(0x946811E0, 0xE397A29C), LIMB_PARTIAL(0x08E)
+        },
+        {   // 6 * 16^12 * G
+            LIMB_PAIR(0xA9C350AF, 0x35A51EEB), LIMB_PAIR(0x6097710D, 0x22821A63), LIMB_PAIR(0x5F6EE6E1, 0xF5A5C2C9), LIMB_PAIR(0x69599BA9, 0x8F9F2012),
+            LIMB_PAIR(0x12918EA9, 0xED36867F), LIMB_PAIR(0x0EA832E9, 0xF1A5450D), LIMB_PAIR(0x1E15E027, 0x58C5A731), LIMB_PAIR(0x00416B3D, 0x5A6460D6), LIMB_PARTIAL(0x198),
+            LIMB_PAIR(0xCF8C23F6, 0xA0AFB24F), LIMB_PAIR(0x2D40BCA9, 0xDD6966EB), LIMB_PAIR(0xBF132AB2, 0x7C8D20AA), LIMB_PAIR(0x7D32B64D, 0xC24EFB7D),
+            LIMB_PAIR(0x0C9547F5, 0x26D79338), LIMB_PAIR(0x1FB47F5A, 0x7E7D6225), LIMB_PAIR(0x9A488725, 0xF1F5880D), LIMB_PAIR(0x38749037, 0x8EC9740D), LIMB_PARTIAL(0x030)
+        },
+        {   // 7 * 16^12 * G
+            LIMB_PAIR(0xB7C2CF3B, 0x40BC7A65), LIMB_PAIR(0x23C30518, 0x5043C6C7), LIMB_PAIR(0x44DE8A14, 0xE7F93C65), LIMB_PAIR(0x89ED4019, 0x5F8B4F4E),
+            LIMB_PAIR(0x96F258D4, 0x52D6E1F5), LIMB_PAIR(0xBF255616, 0x23749D1D), LIMB_PAIR(0xAA7F5F1E, 0xE03FEB69), LIMB_PAIR(0x0C563D0F, 0xDB07A6A9), LIMB_PARTIAL(0x163),
+            LIMB_PAIR(0x9DF56623, 0xD4029081), LIMB_PAIR(0xC125A069, 0x18B71B89), LIMB_PAIR(0xB7C6D7DD, 0xC4F119F0), LIMB_PAIR(0xE05C3E73, 0xE6588CF4),
+            LIMB_PAIR(0x876F22F1, 0x0CBC6A79), LIMB_PAIR(0xE6EEAEDC, 0xBF99DE26), LIMB_PAIR(0x1B6ABA38, 0x9AA4741C), LIMB_PAIR(0xCE3A2DD3, 0xF7CC38A4), LIMB_PARTIAL(0x19B)
+        },
+        {   // 8 * 16^12 * G
+            LIMB_PAIR(0x4CA94CE3, 0x7BAD211D), LIMB_PAIR(0xD66CC144, 0x7B7BED87), LIMB_PAIR(0xBB5EE0CE, 0x7EBA714B), LIMB_PAIR(0xF5EB8337, 0xC26E3A3C),
+            LIMB_PAIR(0x3DFEC21F, 0xE5C61798), LIMB_PAIR(0x117BA62A, 0x9C679E26), LIMB_PAIR(0x1B6E1641, 0x6D67DB8C), LIMB_PAIR(0xE31C06D5, 0x1C2E077E), LIMB_PARTIAL(0x1A2),
+            LIMB_PAIR(0xCDC2D75C, 0xC0D71279), LIMB_PAIR(0x09371B29, 0x0B15B147), LIMB_PAIR(0xDC2CEB6C, 0xBA1F3359), LIMB_PAIR(0xBE25DAD5, 0x9A701873),
+            LIMB_PAIR(0xC8BFE287, 0x03C466B8), LIMB_PAIR(0x41EC3009, 0x9697F329), LIMB_PAIR(0xB4A54990, 0x4E21E900), LIMB_PAIR(0xA99D3093, 0xEE1B53C8), LIMB_PARTIAL(0x0D5)
+        }
+    },
+#endif
+#if (13 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^13 * G
+            LIMB_PAIR(0x5C346588, 0xBB59F267), LIMB_PAIR(0x76F373A1, 0xAC37B368), LIMB_PAIR(0xA4C6D860, 0x4826E015), LIMB_PAIR(0x61BDF224, 0x4EF341B0),
+            LIMB_PAIR(0xBECAC30B, 0x70B01FB4), LIMB_PAIR(0xF0BB0C51, 0x5F518CFC), LIMB_PAIR(0x9D163117, 0xBBEC7A91), LIMB_PAIR(0xDE2DA58E, 0x8A65BEE8), LIMB_PARTIAL(0x0BA),
+            LIMB_PAIR(0x566098B5, 0x965CAF8E), LIMB_PAIR(0xAFBD8436, 0xE8BA0E81), LIMB_PAIR(0x7299FBC1, 0x77F4E27D), LIMB_PAIR(0x367E2155, 0xF5169F5C),
+            LIMB_PAIR(0x01A49A6F, 0xC88FA561), LIMB_PAIR(0x557B66DE, 0x8A6A0228), LIMB_PAIR(0x8E1BEE40, 0xC867F1FA), LIMB_PAIR(0x6DE8FCED, 0xBF4B5F80), LIMB_PARTIAL(0x042)
+        },
+        {   // 2 * 16^13 * G
+            LIMB_PAIR(0x676A875A, 0xB19A5828), LIMB_PAIR(0xC83A4911, 0x40729F28), LIMB_PAIR(0xC6DCE05B, 0x511949B1), LIMB_PAIR(0x3FCF0490, 0x25914C8C),
+            LIMB_PAIR(0x0C6C2742, 0xC49490DE), LIMB_PAIR(0xDF6CD770, 0x3B21FEEF), LIMB_PAIR(0xDD1A82A2, 0x012D2802), LIMB_PAIR(0x6453439D, 0x72F5A0B7), LIMB_PARTIAL(0x020),
+            LIMB_PAIR(0x9B58E26D, 0x3E85D07D), LIMB_PAIR(0x1C50AF24, 0x56527BDD), LIMB_PAIR(0x7DF377D0, 0x564B5658), LIMB_PAIR(0x65E97A30, 0xF5B03358),
+            LIMB_PAIR(0x6B31BC52, 0x2B22D6E9), LIMB_PAIR(0xCCCD4BBA, 0x8AD449AB), LIMB_PAIR(0xF7C162A2, 0x84B8B888), LIMB_PAIR(0x4D56F29B, 0x3B647F0E), LIMB_PARTIAL(0x1FB)
+        },
+        {   // 3 * 16^13 * G
+            LIMB_PAIR(0x628233ED, 0x59FA6794), LIMB_PAIR(0x25A1287D, 0x1C30A04A), LIMB_PAIR(0xBF3FAD38, 0x8DD4FDCA), LIMB_PAIR(0x0D0B6F87, 0x522AAD84),
+            LIMB_PAIR(0xD160F8CC, 0x12A66E90), LIMB_PAIR(0xE673AF6B, 0x714213F3), LIMB_PAIR(0xAD0AB724, 0xD5E6FEEB), LIMB_PAIR(0x6A892358, 0x0DDF08F1), LIMB_PARTIAL(0x01F),
+            LIMB_PAIR(0xC077FEDD, 0xAA50ABCE), LIMB_PAIR(0xE7610FEE, 0x36E6411E), LIMB_PAIR(0xEB815B83, 0xBEA885D1), LIMB_PAIR(0x5D57A6AB, 0x9710ED6D),
+            LIMB_PAIR(0x85645674, 0x794E6F1B), LIMB_PAIR(0xF124CBF1, 0x7608184D), LIMB_PAIR(0xCC8BE47B, 0x356377F6), LIMB_PAIR(0x4B3E7161, 0x56CBD260), LIMB_PARTIAL(0x0D7)
+        },
+        {   // 4 * 16^13 * G
+            LIMB_PAIR(0x4CFC2928, 0x0B91D524), LIMB_PAIR(0xF9855767, 0xAADA5377), LIMB_PAIR(0x652CAD7F, 0x43014E69), LIMB_PAIR(0xEE500EBE, 0x8680000D),
+            LIMB_PAIR(0x62086EDB, 0x95EEA804), LIMB_PAIR(0x5CE7CD0A, 0xEA648437), LIMB_PAIR(0x51A5BB78, 0xEE14680D), LIMB_PAIR(0x9167AE22, 0x28363F30), LIMB_PARTIAL(0x047),
+            LIMB_PAIR(0x19692E28, 0x5335DBD7), LIMB_PAIR(0xC6495AD7, 0x30C79590), LIMB_PAIR(0x62C85189, 0xB9F87B14), LIMB_PAIR(0xC5B0545C, 0x5B87C196),
+            LIMB_PAIR(0xBE7FB4F3, 0xBBDFEF3C), LIMB_PAIR(0xF3216D95, 0x2B531D69), LIMB_PAIR(0x61C8215C, 0xE7298F73), LIMB_PAIR(0xD96015DB, 0x9652E358), LIMB_PARTIAL(0x11D)
+        },
+        {   // 5 * 16^13 * G
+            LIMB_PAIR(0x910FDA3A, 0xF42C064A), LIMB_PAIR(0xCEA6AA25, 0xFBAFA50F), LIMB_PAIR(0x0DE9BBBC, 0xAFE5F558), LIMB_PAIR(0x0E89FB39, 0x24E9D4AE),
+            LIMB_PAIR(0x25C76201, 0x5B719739), LIMB_PAIR(0x5475AEEA, 0xA87EA529), LIMB_PAIR(0x3C4BE889, 0x1E5495E0), LIMB_PAIR(0x995AD46F, 0x7866138B), LIMB_PARTIAL(0x087),
+            LIMB_PAIR(0x46AFB538, 0x5F9F803E), LIMB_PAIR(0xCA875A75, 0xF8C0F078), LIMB_PAIR(0x89B71552, 0x63F1050A), LIMB_PAIR(0x8D43BB0D, 0x0858BAAB),
+            LIMB_PAIR(0xFE38CF7D, 0x8DC61935), LIMB_PAIR(0x20F815EA, 0x50FBDAE2), LIMB_PAIR(0x2E070889, 0x6C6A84E5), LIMB_PAIR(0x73FB1857, 0xA524045E), LIMB_PARTIAL(0x01C)
+        },
+        {   // 6 * 16^13 * G
+            LIMB_PAIR(0xB597EC4B, 0x0F9052C7), LIMB_PAIR(0xAD573AB6, 0xC6F41C80), LIMB_PAIR(0xE3A60425, 0x347A20E1), LIMB_PAIR(0xC852CBB5, 0x8B466CEF),
+            LIMB_PAIR(0xDC78E008, 0xF38734D5), LIMB_PAIR(0xD1AD9A04, 0xF347CD72), LIMB_PAIR(0x30EEC82B, 0xB82D096F), LIMB_PAIR(0xCA4F7AB3, 0xE43CC8E9), LIMB_PARTIAL(0x01B),
+            LIMB_PAIR(0xF659615A, 0x78D630CA), LIMB_PAIR(0xB1617E24, 0xD686695E), LIMB_PAIR(0xD5983CF9, 0xBE1C2194), LIMB_PAIR(0x8329CAAE, 0x4522D8F7),
+            LIMB_PAIR(0x101FB01A, 0x672FEE6B), LIMB_PAIR(0x50D301AB, 0x1B1F4C09), LIMB_PAIR(0x5E431E1F, 0x7DD87DAC), LIMB_PAIR(0xEA0100DB, 0xBF07EE0C), LIMB_PARTIAL(0x172)
+        },
+        {   // 7 * 16^13 * G
+            LIMB_PAIR(0xBD667641, 0x32966F76), LIMB_PAIR(0xF0D579A6, 0x7DE72BE5), LIMB_PAIR(0x81276712, 0x0A6FFAFB), LIMB_PAIR(0x5E91A169, 0x0C76A213),
+            LIMB_PAIR(0x5F953CED, 0xEB960ED8), LIMB_PAIR(0x0BE111CD, 0xAA5F7F8F), LIMB_PAIR(0x911F59FA, 0x2CD0B477), LIMB_PAIR(0xE5220A86, 0x059A70C6), LIMB_PARTIAL(0x0DB),
+            LIMB_PAIR(0xA61C4277, 0x16F99E8B), LIMB_PAIR(0x56710251, 0x011745B6), LIMB_PAIR(0xF1EF7FF2, 0x13CB7D19), LIMB_PAIR(0x14F0C0E0, 0x2162EDB4),
+            LIMB_PAIR(0x67467A1C, 0xB0A459E8), LIMB_PAIR(0x248E6FC9, 0x2CEE2121), LIMB_PAIR(0x98142385, 0x2BA236EB), LIMB_PAIR(0x1E63FA6E, 0xBD7465C9), LIMB_PARTIAL(0x0DA)
+        },
+        {   // 8 * 16^13 * G
+            LIMB_PAIR(0xA38BE841, 0xDEED672D), LIMB_PAIR(0x62FEBDD5, 0xD62D42D7), LIMB_PAIR(0x2D4AF6FF, 0x002AA47E), LIMB_PAIR(0x5BE24D99, 0xDADCDA95),
+            LIMB_PAIR(0x6727939B, 0x91EC05C4), LIMB_PAIR(0x1B7966D0, 0xE7535C59), LIMB_PAIR(0x23C47893, 0x83D7F5F0), LIMB_PAIR(0x2C4E6181, 0x470BCA4E), LIMB_PARTIAL(0x10E),
+            LIMB_PAIR(0x8440535E, 0xFE45F969), LIMB_PAIR(0x49ADAB54, 0x240E6B2C), LIMB_PAIR(0xDB726B76, 0x61089282), LIMB_PAIR(0xFA643350, 0xCFF3E30B),
+            LIMB_PAIR(0xA7C01F88, 0x3AAFB169), LIMB_PAIR(0xE0A5514D, 0x51923C30), LIMB_PAIR(0x3CCC700A, 0xC077936F), LIMB_PAIR(0x586F4854, 0x23375769), LIMB_PARTIAL(0x06E)
+        }
+    },
+#endif
+#if (14 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^14 * G
+            LIMB_PAIR(0x5A714194, 0x9AA53B47), LIMB_PAIR(0x6957D5EB, 0x01163DD8), LIMB_PAIR(0x908F5929, 0x5BD2C24F), LIMB_PAIR(0xDBE42B0F, 0x87F519F4),
+            LIMB_PAIR(0xFB6B5AD4, 0xFF767379), LIMB_PAIR(0x9A193F28, 0x4D0F8BBA), LIMB_PAIR(0xEE549D79, 0xF3C42BD0), LIMB_PAIR(0x825244FA, 0xBF851D3F), LIMB_PARTIAL(0x09B),
+            LIMB_PAIR(0x9F78B57F, 0x825FFB60), LIMB_PAIR(0xE0F74B73, 0xD1913668), LIMB_PAIR(0x5468F89D, 0xF42A5B03), LIMB_PAIR(0xAACAE46C, 0xA2347499),
+            LIMB_PAIR(0xC85272E8, 0xC771E34C), LIMB_PAIR(0xD427D3A1, 0x295684C1), LIMB_PAIR(0x433451DC, 0xED749903), LIMB_PAIR(0x0CBABBD4, 0xB872072C), LIMB_PARTIAL(0x049)
+        },
+        {   // 2 * 16^14 * G
+            LIMB_PAIR(0x8435735F, 0xF98DB50E), LIMB_PAIR(0x60BD7B77, 0xEB51C346), LIMB_PAIR(0x996EF096, 0x200ADF1E), LIMB_PAIR(0x57B8D488, 0xECAC256B),
+            LIMB_PAIR(0x7E65EA9F, 0x889639B0), LIMB_PAIR(0x13A4A243, 0x4F763F73), LIMB_PAIR(0x2957DB01, 0x401C22A4), LIMB_PAIR(0x68EB751E, 0x86CFF8BC), LIMB_PARTIAL(0x1C7),
+            LIMB_PAIR(0xE47805E9, 0x1C0549EB), LIMB_PAIR(0xB223B355, 0x57716280), LIMB_PAIR(0xDB5C068B, 0x69A29CF4), LIMB_PAIR(0x432AF690, 0x63FB8A8C),
+            LIMB_PAIR(0x7F36EBD6, 0xDCBB94F9), LIMB_PAIR(0x08609C4D, 0x693983DD), LIMB_PAIR(0xD458FA6E, 0x69875F98), LIMB_PAIR(0x1FFF90B4, 0x149758E8), LIMB_PARTIAL(0x1EE)
+        },
+        {   // 3 * 16^14 * G
+            LIMB_PAIR(0x10A0D011, 0x84527363), LIMB_PAIR(0x0BBADDD0, 0x299E1CB3), LIMB_PAIR(0x5294C956, 0xF5F3079B), LIMB_PAIR(0x4F0A3584, 0x9EDD5FA2),
+            LIMB_PAIR(0x641F1FE4, 0x764BB175), LIMB_PAIR(0x93B38DB4, 0x0217A94A), LIMB_PAIR(0xE31E6FDB, 0x61C992B7), LIMB_PAIR(0x764CABEC, 0xEB231629), LIMB_PARTIAL(0x13B),
+            LIMB_PAIR(0xD2E8C15C, 0xBD3B12A4), LIMB_PAIR(0x8ACCC1F1, 0x8EEF9B5D), LIMB_PAIR(0x52747252, 0xB931FBC7), LIMB_PAIR(0xF9817BEF, 0x8A7B86C7),
+            LIMB_PAIR(0x584E1181, 0xB52330BA), LIMB_PAIR(0x25A0A0AB, 0x9BC4926D), LIMB_PAIR(0x89A625D7, 0x002FEB9B), LIMB_PAIR(0xDB41831A, 0x653946B5), LIMB_PARTIAL(0x061)
+        },
+        {   // 4 * 16^14 * G
+            LIMB_PAIR(0xEFD91D43, 0xF1EFE65B), LIMB_PAIR(0xAA3323E3, 0xDD872FB0), LIMB_PAIR(0x01E9DD62, 0xCB7C3579), LIMB_PAIR(0xCD97EBD7, 0x04677143),
+            LIMB_PAIR(0x806E055F, 0x906ECEB8), LIMB_PAIR(0x2FD96082, 0x334B997F), LIMB_PAIR(0xCAAAD051, 0x41A732B0), LIMB_PAIR(0x5BC0500E, 0xE1B97E12), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0xA1BEE510, 0xFC4E9BAA), LIMB_PAIR(0x7D63C5F0, 0x2B887E32), LIMB_PAIR(0xEE6CAD4E, 0xCFB9C52E), LIMB_PAIR(0xB0B8DD96, 0x596BB714),
+            LIMB_PAIR(0x65F9A215, 0x2DB254C6), LIMB_PAIR(0xD799749E, 0x000359BD), LIMB_PAIR(0x6D91B457, 0xC4ECAF12), LIMB_PAIR(0xBE4F02F6, 0x8153709E), LIMB_PARTIAL(0x0C4)
+        },
+        {   // 5 * 16^14 * G
+            LIMB_PAIR(0x09D9E2F2, 0x2218489B), LIMB_PAIR(0x7F4FE3C0, 0x56376992), LIMB_PAIR(0x1ED2B98E, 0x61E36521), LIMB_PAIR(0x178D242E, 0x166D671A),
+            LIMB_PAIR(0x7E8D39B6, 0xB65381C9), LIMB_PAIR(0x82851B43, 0xAEFE583A), LIMB_PAIR(0xA24A7AF4, 0x6CAA4459), LIMB_PAIR(0x5640D447, 0xB421380F), LIMB_PARTIAL(0x0B5),
+            LIMB_PAIR(0x11D91549, 0x706A4130), LIMB_PAIR(0xE3064F4A, 0x4214BE92), LIMB_PAIR(0xB7649258, 0xA7C3B7B8), LIMB_PAIR(0x71C05DDE, 0xA782E2FC),
+            LIMB_PAIR(0x83D30793, 0x0FA90EF6), LIMB_PAIR(0x15DBD474, 0x1C77425B), LIMB_PAIR(0xFC0B16D8, 0x917CDB42), LIMB_PAIR(0xC7BFA045, 0x7EF5FAF8), LIMB_PARTIAL(0x0E9)
+        },
+        {   // 6 * 16^14 * G
+            LIMB_PAIR(0xA60059EB, 0x5B408946), LIMB_PAIR(0xA1E69F42, 0x0D707CC2), LIMB_PAIR(0xCDDD4401, 0x9BE262D3), LIMB_PAIR(0x01C14145, 0x0C2D64BD),
+            LIMB_PAIR(0x27C198A5, 0xCF8B305A), LIMB_PAIR(0x05C03494, 0xADCCC32E), LIMB_PAIR(0x6C1DE307, 0x22E5F02B), LIMB_PAIR(0x48F43EDF, 0x2AE62BAC), LIMB_PARTIAL(0x01C),
+            LIMB_PAIR(0x598A8EF6, 0xB02341CD), LIMB_PAIR(0x8456480A, 0x0E604174), LIMB_PAIR(0x32132353, 0x159E5919), LIMB_PAIR(0x8B3A8A62, 0xE03D4F2C),
+            LIMB_PAIR(0xF861D8F0, 0xD1190722), LIMB_PAIR(0xA37C89A2, 0x59D3D3B6), LIMB_PAIR(0xA2987768, 0x07FB0E16), LIMB_PAIR(0x1DA91A16, 0x5DD98E19), LIMB_PARTIAL(0x0AD)
+        },
+        {   // 7 * 16^14 * G
+            LIMB_PAIR(0x07AE5402, 0x09238DE9), LIMB_PAIR(0x444B8B61, 0x14FCE2B1), LIMB_PAIR(0xBD0D2EAD, 0x37EE7AFF), LIMB_PAIR(0x97804504, 0xECBC75DE),
+            LIMB_PAIR(0x3B5E5FD8, 0x343A5D1A), LIMB_PAIR(0xA90DCF6B, 0xBF806EE5), LIMB_PAIR(0xB2BF2A3D, 0xD07F1054), LIMB_PAIR(0xED9FFFE2, 0x6F590326), LIMB_PARTIAL(0x1FB),
+            LIMB_PAIR(0xE6198AAB, 0x9C42832D), LIMB_PAIR(0x475EC98D, 0x3EACD0ED), LIMB_PAIR(0x937FFE67, 0x715B6AA8), LIMB_PAIR(0x891BFFC8, 0x4B35D1E7),
+            LIMB_PAIR(0xB36A8835, 0xFAD8AF9C), LIMB_PAIR(0x7B8F6F81, 0xA3A21D6F), LIMB_PAIR(0x771C3B1C, 0x4FAAF12E), LIMB_PAIR(0x04FAD4C8, 0x4E053133), LIMB_PARTIAL(0x1F1)
+        },
+        {   // 8 * 16^14 * G
+            LIMB_PAIR(0xE541183A, 0x7EECDFE4), LIMB_PAIR(0x5AA8B868, 0x7B0DD228), LIMB_PAIR(0x1DE22F71, 0x8D38CD0C), LIMB_PAIR(0xBD2638C1, 0xA9CA796D),
+            LIMB_PAIR(0x49E5EA36, 0x18193732), LIMB_PAIR(0x29212B0F, 0x4FC54617), LIMB_PAIR(0x2DEBE3F7, 0x4F3874D2), LIMB_PAIR(0xCD4B02FB, 0x46499322), LIMB_PARTIAL(0x015),
+            LIMB_PAIR(0xA3BC23C0, 0x7977CDAA), LIMB_PAIR(0x8BA98676, 0x954AA6D8), LIMB_PAIR(0x93C7BF98, 0x6B8471C7), LIMB_PAIR(0x43C70437, 0xF8025A0B),
+            LIMB_PAIR(0xB1A8C71B, 0x0ACA0D09), LIMB_PAIR(0x6FC48277, 0x9FB1D00B), LIMB_PAIR(0xE312939B, 0x50BCCC4E), LIMB_PAIR(0x65E5DF83, 0x5AEAF556), LIMB_PARTIAL(0x1AB)
+        }
+    },
+#endif
+#if (15 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^15 * G
+            LIMB_PAIR(0x414D9815, 0xBF2097B9), LIMB_PAIR(0xCDA66DFC, 0xFA0673B3), LIMB_PAIR(0x193B17B0, 0x8C775677), LIMB_PAIR(0xC5387E9A, 0x07C8DBF6),
+            LIMB_PAIR(0x4C5DA984, 0x141DE69D), LIMB_PAIR(0x06A8B133, 0xF0650AC8), LIMB_PAIR(0xD2B258C4, 0xADD766EE), LIMB_PAIR(0x96303678, 0xA6F42763), LIMB_PARTIAL(0x1DA),
+            LIMB_PAIR(0x39C8824B, 0xCDBF1DAA), LIMB_PAIR(0x5638CB0C, 0xF8F2CD8C), LIMB_PAIR(0xB6D33286, 0xD966C8E9), LIMB_PAIR(0xC1331E1F, 0xE4B63EF8),
+            LIMB_PAIR(0xFB5F843E, 0xAC72D8E3), LIMB_PAIR(0x8FF6B4B6, 0x110D0D4A), LIMB_PAIR(0xACD5CF3B, 0x0067FE1E), LIMB_PAIR(0x21C1E826, 0x5EAAE5B3), LIMB_PARTIAL(0x068)
+        },
+        {   // 2 * 16^15 * G
+            LIMB_PAIR(0x2C863225, 0x9917E8CC), LIMB_PAIR(0xDFF7A5FC, 0xE627D938), LIMB_PAIR(0xD3C9FA85, 0x62017450), LIMB_PAIR(0xCE2573F1, 0x30453775),
+            LIMB_PAIR(0x43E3B41C, 0xCAAA02C3), LIMB_PAIR(0x5901E5FF, 0xF541C006), LIMB_PAIR(0xE163AA77, 0x78EC0E91), LIMB_PAIR(0xF446BF70, 0x1CFD0693), LIMB_PARTIAL(0x09B),
+            LIMB_PAIR(0x78063F41, 0x82AEB716), LIMB_PAIR(0x861C6782, 0xC442F8A7), LIMB_PAIR(0xF28B51F4, 0xCCFBC9F3), LIMB_PAIR(0x27335516, 0x92A5F711),
+            LIMB_PAIR(0x23578EF8, 0xDB6DC76E), LIMB_PAIR(0xCFC25F57, 0x365972B3), LIMB_PAIR(0xAFD7FCB4, 0x0DC48630), LIMB_PAIR(0x87EA6884, 0xCCD4F3DE), LIMB_PARTIAL(0x1B4)
+        },
+        {   // 3 * 16^15 * G
+            LIMB_PAIR(0x26E22B52, 0xC1D7001B), LIMB_PAIR(0x2825905D, 0xB4B20896), LIMB_PAIR(0xE739E7BE, 0xA064FDCD), LIMB_PAIR(0xF2D62D9A, 0x83BFA334),
+            LIMB_PAIR(0x2758B810, 0xA2BAF389), LIMB_PAIR(0xEBD64633, 0x3A88F2E4), LIMB_PAIR(0x76DFD697, 0xD621BE34), LIMB_PAIR(0x9F4A85C3, 0x7168C077), LIMB_PARTIAL(0x17E),
+            LIMB_PAIR(0x20F8F0EA, 0x5B8F06F5), LIMB_PAIR(0xCFACFC46, 0x95E44505), LIMB_PAIR(0x787844B5, 0xE20192BD), LIMB_PAIR(0x4A04ADC2, 0x316468C4),
+            LIMB_PAIR(0xD6774463, 0x30D71497), LIMB_PAIR(0x5A606A2D, 0x7C826A92), LIMB_PAIR(0x81BA512E, 0x22ABADF9), LIMB_PAIR(0xCE26365C, 0xEB15B45F), LIMB_PARTIAL(0x146)
+        },
+        {   // 4 * 16^15 * G
+            LIMB_PAIR(0xA3B42A3E, 0x72F88BD2), LIMB_PAIR(0xC8287E7A, 0x7CCA9272), LIMB_PAIR(0xAAD93849, 0x527C4A5C), LIMB_PAIR(0xDA6615C2, 0xFB481C75),
+            LIMB_PAIR(0x042B3497, 0x27CE59BF), LIMB_PAIR(0x9EF62E76, 0x70B3FEA2), LIMB_PAIR(0x0D097F4B, 0x025ECFC4), LIMB_PAIR(0x607F9D21, 0x5EF137DA), LIMB_PARTIAL(0x053),
+            LIMB_PAIR(0x16741F79, 0x32950476), LIMB_PAIR(0xA4E120E4, 0xEAAC9E23), LIMB_PAIR(0x76F4FE2F, 0xE15F3337), LIMB_PAIR(0x8028F30F, 0xAC402F2D),
+            LIMB_PAIR(0x99C4B4D3, 0x87A6B88B), LIMB_PAIR(0xB0866E18, 0xFEDD124C), LIMB_PAIR(0x4AA80397, 0x07C5D433), LIMB_PAIR(0x0961D56A, 0xAFDFA683), LIMB_PARTIAL(0x0A6)
+        },
+        {   // 5 * 16^15 * G
+            LIMB_PAIR(0x99BCA15D, 0xFBE699BD), LIMB_PAIR(0xBA48093F, 0x0D1C3672), LIMB_PAIR(0xAB23124A, 0xF73D4880), LIMB_PAIR(0x835A7F27, 0xC1752BA2),
+            LIMB_PAIR(0x5EEDE054, 0x94B30388), LIMB_PAIR(0xD7F00082, 0x188F6B28), LIMB_PAIR(0x86A04627, 0x2828FC70), LIMB_PAIR(0x44BE79E6, 0xAF12D735), LIMB_PARTIAL(0x12A),
+            LIMB_PAIR(0xD7B22FC7, 0xCD758E79), LIMB_PAIR(0xA66F1012, 0x3187D186), LIMB_PAIR(0xDCDDBC4E, 0x46D5D067), LIMB_PAIR(0xB711FA20, 0xF2F7629E),
+            LIMB_PAIR(0xBCED7A88, 0x66252C90), LIMB_PAIR(0x32982565, 0xA22574D0), LIMB_PAIR(0x6EBB83C8, 0xE8001619), LIMB_PAIR(0x78FBB10A, 0x731A6B86), LIMB_PARTIAL(0x02F)
+        },
+        {   // 6 * 16^15 * G
+            LIMB_PAIR(0xF4CB671E, 0xE622C1EE), LIMB_PAIR(0x4F2C446E, 0x0D5CCBBC), LIMB_PAIR(0xD7A668DE, 0x67162B0F), LIMB_PAIR(0x3A58F44B, 0xB8D73E54),
+            LIMB_PAIR(0xD0E7294A, 0x9E5E6962), LIMB_PAIR(0x4F8CD419, 0xE7BCEA9E), LIMB_PAIR(0x0CD909D9, 0x41E95553), LIMB_PAIR(0x2F369B49, 0x4C57BA89), LIMB_PARTIAL(0x0DF),
+            LIMB_PAIR(0xD5DFE006, 0x2822437F), LIMB_PAIR(0x16B877FD, 0xFDA5F550), LIMB_PAIR(0x4B6D4987, 0xBFBE8E31), LIMB_PAIR(0xE00F8C47, 0x0F23A45D),
+            LIMB_PAIR(0x8C38D7B6, 0xF329399D), LIMB_PAIR(0x51B398DA, 0x07CD2DC6), LIMB_PAIR(0x2942A61A, 0x66CE2154), LIMB_PAIR(0xAE1A8BFB, 0x762E37FF), LIMB_PARTIAL(0x19B)
+        },
+        {   // 7 * 16^15 * G
+            LIMB_PAIR(0xC4C926E6, 0xE93FF2EF), LIMB_PAIR(0x3DC958D5, 0x417AE211), LIMB_PAIR(0x770DAC2E, 0xA58BBE5E), LIMB_PAIR(0x8CD4F091, 0x1C0F5F79),
+            LIMB_PAIR(0x46153DAF, 0xF4F9D63E), LIMB_PAIR(0xEC37EA0E, 0xF33CE1A5), LIMB_PAIR(0xEE187FF7, 0xCBE10924), LIMB_PAIR(0xF34290F5, 0x3E986A34), LIMB_PARTIAL(0x1B7),
+            LIMB_PAIR(0x1E9E074D, 0x597B1F32), LIMB_PAIR(0x6EE84E95, 0xE88F6C8A), LIMB_PAIR(0x6B90E61D, 0x5CCC3EAB), LIMB_PAIR(0xCCB5CBC0, 0xE27E2023),
+            LIMB_PAIR(0x2FA7DB33, 0x79E991FC), LIMB_PAIR(0xD66BBA72, 0x4EE221B7), LIMB_PAIR(0x4FA39A46, 0x90059ACB), LIMB_PAIR(0x6587F688, 0x1311930A), LIMB_PARTIAL(0x1B9)
+        },
+        {   // 8 * 16^15 * G
+            LIMB_PAIR(0x0AF43BD4, 0x1F70B298), LIMB_PAIR(0xD13901F9, 0x9351C3C2), LIMB_PAIR(0x845EA55B, 0xF702C613), LIMB_PAIR(0x2C193388, 0x892BE015),
+            LIMB_PAIR(0x1E6ADB21, 0x485C4014), LIMB_PAIR(0x9296F310, 0xF394D50E), LIMB_PAIR(0xB9AB0F6F, 0xDA5872DF), LIMB_PAIR(0xF5D389AE, 0xA10BD887), LIMB_PARTIAL(0x1C6),
+            LIMB_PAIR(0xC8F44C3C, 0xE268935D), LIMB_PAIR(0xFA72991B, 0xAA7E595B), LIMB_PAIR(0x9BF7D8CE, 0x78C2A8E3), LIMB_PAIR(0x3B655948, 0x0CAADDE1),
+            LIMB_PAIR(0xC080228C, 0xD9444BE5), LIMB_PAIR(0xF651B425, 0x4990733B), LIMB_PAIR(0x02578B0F, 0x75130851), LIMB_PAIR(0xC5635719, 0x5C375BB3), LIMB_PARTIAL(0x0D6)
+        }
+    },
+#endif
+#if (16 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^16 * G
+            LIMB_PAIR(0x689DBE3C, 0x94A182E2), LIMB_PAIR(0x02610256, 0x2D8EE166), LIMB_PAIR(0xE6294291, 0x4D0CB259), LIMB_PAIR(0x0A7FCF2D, 0x244DB120),
+            LIMB_PAIR(0x8F58F3AF, 0xB50D34B0), LIMB_PAIR(0x13275075, 0x2AD4B9EC), LIMB_PAIR(0xC96BFCFA, 0xA19BECCF), LIMB_PAIR(0x86F5BAF0, 0x1A5509DA), LIMB_PARTIAL(0x185),
+            LIMB_PAIR(0x5AC043E6, 0xEFE1469C), LIMB_PAIR(0x7D273130, 0xC86B7721), LIMB_PAIR(0x2606809A, 0x2324AF0C), LIMB_PAIR(0x21800FCB, 0x33A3324E),
+            LIMB_PAIR(0xA6B0D999, 0x8A38F30F), LIMB_PAIR(0xD038B182, 0x12DB51D0), LIMB_PAIR(0xB3490FF5, 0x53CA86CC), LIMB_PAIR(0x7A935163, 0x2ECD7ECF), LIMB_PARTIAL(0x16F)
+        },
+        {   // 2 * 16^16 * G
+            LIMB_PAIR(0x4B374FF4, 0xF192B016), LIMB_PAIR(0x125FD529, 0x3AADED48), LIMB_PAIR(0x5DFA717D, 0x57484AC4), LIMB_PAIR(0xA4B4E41E, 0x815B6549),
+            LIMB_PAIR(0x3153D4AF, 0xE230EA49), LIMB_PAIR(0x77769A23, 0xBD883B12), LIMB_PAIR(0xAD605E32, 0xAE58965E), LIMB_PAIR(0x77179455, 0x4CC9CFCF), LIMB_PARTIAL(0x0A5),
+            LIMB_PAIR(0x3F30741F, 0x5CFE2EA4), LIMB_PAIR(0x2565E3D7, 0x79C512A5), LIMB_PAIR(0xAEA005BD, 0x9A4075AD), LIMB_PAIR(0x7FCA076D, 0x6B259327),
+            LIMB_PAIR(0x166A3678, 0x1EA80148), LIMB_PAIR(0xD75FDA30, 0x25075D36), LIMB_PAIR(0xAD53E052, 0xD9F2BBA9), LIMB_PAIR(0x182AC606, 0x04FC6ADC), LIMB_PARTIAL(0x090)
+        },
+        {   // 3 * 16^16 * G
+            LIMB_PAIR(0xAA283027, 0xBB3CB4DA), LIMB_PAIR(0x4637A686, 0xB3284A11), LIMB_PAIR(0x8D4D1678, 0x2F675F37), LIMB_PAIR(0x6BCE4A50, 0x4D2B46FE),
+            LIMB_PAIR(0x583AD60D, 0x65E0D06D), LIMB_PAIR(0x525EA4B7, 0xA897D633), LIMB_PAIR(0x42BB371C, 0xE2AA9FCC), LIMB_PAIR(0xDD500E47, 0x8F91D296), LIMB_PARTIAL(0x1BE),
+            LIMB_PAIR(0xAF7965F1, 0xC43C6CFF), LIMB_PAIR(0xA63638DF, 0x116C957C), LIMB_PAIR(0xE5A3F8A7, 0x80C1361B), LIMB_PAIR(0xCC9582D3, 0xA1F87ABE),
+            LIMB_PAIR(0x2BEF1FF9, 0xD47BC010), LIMB_PAIR(0xF3FE712A, 0xDB660935), LIMB_PAIR(0xCC584A15, 0x8CC56DCF), LIMB_PAIR(0xA035F2EF, 0x27984274), LIMB_PARTIAL(0x19C)
+        },
+        {   // 4 * 16^16 * G
+            LIMB_PAIR(0x0F0CCB51, 0x80398667), LIMB_PAIR(0x3654974A, 0xB87E1D01), LIMB_PAIR(0xB2B29ED9, 0x7F58CF21), LIMB_PAIR(0xA3ADD337, 0x06C0E9AA),
+            LIMB_PAIR(0xE9D08FFB, 0xF13B35D0), LIMB_PAIR(0x96761627, 0xDD8BF44C), LIMB_PAIR(0x758A3EF4, 0xA4A18C14), LIMB_PAIR(0xA0043ADB, 0x96A576DD), LIMB_PARTIAL(0x13E),
+            LIMB_PAIR(0x632D95A3, 0x2BDE24F8), LIMB_PAIR(0x4C524829, 0x79F15EF1), LIMB_PAIR(0x9BDABA19, 0xAADD863E), LIMB_PAIR(0xA962B707, 0xDDE053F4),
+            LIMB_PAIR(0x14258D98, 0xC598A2DE), LIMB_PAIR(0x061C235C, 0x9FA5A19D), LIMB_PAIR(0xE8FFD32C, 0x0ED46510), LIMB_PAIR(0xEF78CEAC, 0x2AEA9DD1), LIMB_PARTIAL(0x185)
+        },
+        {   // 5 * 16^16 * G
+            LIMB_PAIR(0xB329F7D3, 0x2BB9D8B5), LIMB_PAIR(0x569EBA9B, 0x7E561B23), LIMB_PAIR(0x09B7BCA0, 0x65FDAE93), LIMB_PAIR(0xEF327916, 0xF4206737),
+            LIMB_PAIR(0x8F7B2113, 0x2963CD69), LIMB_PAIR(0x9CC9532F, 0x3B22A38A), LIMB_PAIR(0xB31DEF2F, 0x455C3790), LIMB_PAIR(0x931E5346, 0x9A6CCCD5), LIMB_PARTIAL(0x0E6),
+            LIMB_PAIR(0x981C49A8, 0xE9860742), LIMB_PAIR(0xDAC58CFB, 0xC6BBFFEF), LIMB_PAIR(0x7DCBBFA6, 0xF28CA98C), LIMB_PAIR(0x3E512F79, 0x6A53C5D4),
+            LIMB_PAIR(0xFEE0577D, 0x072D38F9), LIMB_PAIR(0x0B2260D2, 0x75FC677E), LIMB_PAIR(0x8E97C4B8, 0xE1CE6A18), LIMB_PAIR(0x3D3B1E4A, 0x48308DFF), LIMB_PARTIAL(0x109)
+        },
+        {   // 6 * 16^16 * G
+            LIMB_PAIR(0xD19F496E, 0xD389B38C), LIMB_PAIR(0xDC520FB4, 0x9868052F), LIMB_PAIR(0xBF6E877E, 0x698B397E), LIMB_PAIR(0x15D39A80, 0x7896E7AC),
+            LIMB_PAIR(0x057CE533, 0x3EECC9B5), LIMB_PAIR(0x001509B4, 0x00F6CFC7), LIMB_PAIR(0xE01E25F6, 0x8C2C3D6E), LIMB_PAIR(0x0DD1056A, 0xF64A3E27), LIMB_PARTIAL(0x0F4),
+            LIMB_PAIR(0xBA1BDE97, 0x192245F8), LIMB_PAIR(0x41E87ACC, 0xB68AA037), LIMB_PAIR(0x49D24C74, 0x849CB6E4), LIMB_PAIR(0x2569DE67, 0x93C36F75),
+            LIMB_PAIR(0x30AD91A4, 0x93542A56), LIMB_PAIR(0xCD021165, 0xA802F2BF), LIMB_PAIR(0xCECD5CDC, 0xF3EB185F), LIMB_PAIR(0xAE520746, 0x42EF43D9), LIMB_PARTIAL(0x185)
+        },
+        {   // 7 * 16^16 * G
+            LIMB_PAIR(0x70A75215, 0xCC39400A), LIMB_PAIR(0x7EBE4792, 0xD237B407), LIMB_PAIR(0xD20C2507, 0xB2CF5C3B), LIMB_PAIR(0xDAA4C46D, 0xE7B00E11),
+            LIMB_PAIR(0x38CEC7A9, 0xA576029D), LIMB_PAIR(0xB05E1375, 0x699005E7), LIMB_PAIR(0xF1B051BC, 0xB88D5837), LIMB_PAIR(0x44630F00, 0x054F8ABB), LIMB_PARTIAL(0x060),
+            LIMB_PAIR(0xDA2BB0C3, 0xE53A8D17), LIMB_PAIR(0xAE7BDB56, 0xCFDD266C), LIMB_PAIR(0xDB11C9B9, 0xD9551CEB), LIMB_PAIR(0x1FC5B3D0, 0x1A11AC22),
+            LIMB_PAIR(0xE161A118, 0x63056E13), LIMB_PAIR(0xF76B5E73, 0xDFD99567), LIMB_PAIR(0x836F2217, 0x7F5F7283), LIMB_PAIR(0xAC0C57E8, 0x8323F67F), LIMB_PARTIAL(0x01A)
+        },
+        {   // 8 * 16^16 * G
+            LIMB_PAIR(0xEB5A169A, 0x2838CDBF), LIMB_PAIR(0xE1505D76, 0x25C826C4), LIMB_PAIR(0xC512FAF2, 0x2D5B0FF8), LIMB_PAIR(0x1E5CD6D6, 0xCF831E69),
+            LIMB_PAIR(0xAF5EDA1F, 0x4540775C), LIMB_PAIR(0x5AD5605E, 0x4F4514DA), LIMB_PAIR(0x2F87CFDF, 0x8472B1AE), LIMB_PAIR(0x9E338CE6, 0x07C8CBCC), LIMB_PARTIAL(0x14D),
+            LIMB_PAIR(0xD9243216, 0x096AB718), LIMB_PAIR(0xE37CFF51, 0xE966635F), LIMB_PAIR(0x0586EBBC, 0xCED8FB11), LIMB_PAIR(0x86ABE6F4, 0x3216D6AF),
+            LIMB_PAIR(0x1B77F4E2, 0x37392A30), LIMB_PAIR(0xB8EF62B3, 0xECC903AF), LIMB_PAIR(0xFD74231E, 0x0453DC44), LIMB_PAIR(0x57895508, 0x3CB3927B), LIMB_PARTIAL(0x13C)
+        }
+    },
+#endif
+#if (17 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^17 * G
+            LIMB_PAIR(0xE96A67E2, 0xD8720C8A), LIMB_PAIR(0xD54E0F6A, 0xA646ECED), LIMB_PAIR(0xCBD31552, 0x3936CE2D), LIMB_PAIR(0xB35268C2, 0x6D44C225),
+            LIMB_PAIR(0x6168F13D, 0x56DC0D08), LIMB_PAIR(0xFB2C207F, 0x2B9BBCA1), LIMB_PAIR(0xA136C5A4, 0xB4F0DA3A), LIMB_PAIR(0xF8216F89, 0xED2CF79B), LIMB_PARTIAL(0x141),
+            LIMB_PAIR(0x7EC6BCEA, 0x1EB0707D), LIMB_PAIR(0xEBE7EED0, 0x341B0F22), LIMB_PAIR(0x37333B3E, 0x99C3C50C), LIMB_PAIR(0xDE463E09, 0xDCD5FAEB),
+            LIMB_PAIR(0xE481CDD0, 0xE688ED5E), LIMB_PAIR(0x0FEAD808, 0x6FC12BD1), LIMB_PAIR(0x29746A50, 0x7B8A4983), LIMB_PAIR(0x829E8D3C, 0x2BE1B92F), LIMB_PARTIAL(0x0A8)
+        },
+        {   // 2 * 16^17 * G
+            LIMB_PAIR(0x3D0E9678, 0x27B472FA), LIMB_PAIR(0xF18EAB4A, 0xCEF22B18), LIMB_PAIR(0x5FDE2724, 0xC49E75CC), LIMB_PAIR(0x39F3C3D3, 0xD9EC427A),
+            LIMB_PAIR(0x07A9F9B2, 0x240963EA), LIMB_PAIR(0xFC73761C, 0x2B0301E0), LIMB_PAIR(0x80D8C0E3, 0xF734C2F4), LIMB_PAIR(0x9948DA76, 0xB9F52A60), LIMB_PARTIAL(0x1C9),
+            LIMB_PAIR(0xFE70AF9B, 0x6EF525E6), LIMB_PAIR(0xC936D7DA, 0x4FAF1315), LIMB_PAIR(0xA1C67010, 0xFED0CB7A), LIMB_PAIR(0x650FC5BD, 0xB1C8CDFB),
+            LIMB_PAIR(0x8AC141CE, 0x643E7741), LIMB_PAIR(0x3144C8A8, 0x8ECFFB68), LIMB_PAIR(0x544DEBA8, 0xF6FF17F5), LIMB_PAIR(0x721A6D98, 0xEA30D6B2), LIMB_PARTIAL(0x0D0)
+        },
+        {   // 3 * 16^17 * G
+            LIMB_PAIR(0x8AA3C1AE, 0xF306AD27), LIMB_PAIR(0xFE1271E7, 0x5C833C94), LIMB_PAIR(0x11A9B053, 0x5E33DC6B), LIMB_PAIR(0x9CC1B1C8, 0xB28AC1CA),
+            LIMB_PAIR(0x92D6A8C9, 0x25BB6417), LIMB_PAIR(0xF9EC9859, 0x2FC86297), LIMB_PAIR(0xA31FD92A, 0x752B6170), LIMB_PAIR(0xCBB524EE, 0x3E1F16BA), LIMB_PARTIAL(0x008),
+            LIMB_PAIR(0x70A320C1, 0x85AE18CA), LIMB_PAIR(0x6E589BA3, 0xCD6BFBA0), LIMB_PAIR(0x7FB13310, 0x576F222B), LIMB_PAIR(0x24C19D99, 0xDDC3F6D1),
+            LIMB_PAIR(0x06F1E0A1, 0x697073F9), LIMB_PAIR(0xBDC674E2, 0x18C54CEF), LIMB_PAIR(0x7264D610, 0xCC042535), LIMB_PAIR(0x94275C0F, 0x66D7986C), LIMB_PARTIAL(0x105)
+        },
+        {   // 4 * 16^17 * G
+            LIMB_PAIR(0x9A2936B0, 0x47639502), LIMB_PAIR(0x918B33D5, 0x48A88079), LIMB_PAIR(0x1B067A87, 0x453BC793), LIMB_PAIR(0x63E55FB7, 0x5FE40ADC),
+            LIMB_PAIR(0x3D2B9756, 0x615677F0), LIMB_PAIR(0x833E336A, 0xDC376C92), LIMB_PAIR(0xB0B6C914, 0xF7743DA0), LIMB_PAIR(0x3EFFE23B, 0x780BC5A9), LIMB_PARTIAL(0x037),
+            LIMB_PAIR(0x4A1A9456, 0xE9C33380), LIMB_PAIR(0xEB2EB173, 0xDA9C55A8), LIMB_PAIR(0x5ED17864, 0x02275786), LIMB_PAIR(0x16039D4F, 0x491F2508),
+            LIMB_PAIR(0x0EC8959A, 0xB1AC3D7B), LIMB_PAIR(0x465A7151, 0x4D3855D3), LIMB_PAIR(0x18E0D6B1, 0x7285C2D4), LIMB_PAIR(0x33EAC3E9, 0xD1A5AF18), LIMB_PARTIAL(0x11C)
+        },
+        {   // 5 * 16^17 * G
+            LIMB_PAIR(0x170F4332, 0xDF54380D), LIMB_PAIR(0x468B3892, 0x71073E65), LIMB_PAIR(0x3D2D8723, 0x299D8E42), LIMB_PAIR(0xB142FE92, 0x2EAC2ED8),
+            LIMB_PAIR(0x320BF387, 0xCF54C688), LIMB_PAIR(0x2C6EFF70, 0x450CB1D4), LIMB_PAIR(0x84AF19C5, 0x8E7BAD2E), LIMB_PAIR(0x2239A281, 0x9F881DA5), LIMB_PARTIAL(0x0BF),
+            LIMB_PAIR(0xFA1EC6D4, 0x86063C1E), LIMB_PAIR(0x4CFC2168, 0x42B40DFD), LIMB_PAIR(0x6DDEAE23, 0x0AD0C42A), LIMB_PAIR(0xA753EE2F, 0xA267039F),
+            LIMB_PAIR(0xC10D2E84, 0x39517320), LIMB_PAIR(0xA4375C0F, 0x97219410), LIMB_PAIR(0xA5DED43A, 0x495A7346), LIMB_PAIR(0x8529EB5A, 0xBDEAC166), LIMB_PARTIAL(0x1D3)
+        },
+        {   // 6 * 16^17 * G
+            LIMB_PAIR(0x38D280D3, 0xFF526729), LIMB_PAIR(0xE54BDAA4, 0xB2FAB9A3), LIMB_PAIR(0x1C56AAE7, 0x256A00F3), LIMB_PAIR(0x833CD551, 0x588831E2),
+            LIMB_PAIR(0xC44FE251, 0xC4F7E5A3), LIMB_PAIR(0x287E9914, 0x46807784), LIMB_PAIR(0x5CDDF33B, 0xFE8C2879), LIMB_PAIR(0x9F2CF304, 0x4A28E8C3), LIMB_PARTIAL(0x10B),
+            LIMB_PAIR(0xCB19D3BD, 0x4307199D), LIMB_PAIR(0xBE158926, 0x4BE628C3), LIMB_PAIR(0xCEBD6924, 0x01A7D640), LIMB_PAIR(0xDBF40E60, 0x8BAF3CCB),
+            LIMB_PAIR(0x1574F982, 0x0A0F6332), LIMB_PAIR(0xC6A746ED, 0x9F747922), LIMB_PAIR(0x0A9481B2, 0x13C36A19), LIMB_PAIR(0x4D7965C2, 0x2E9249A2), LIMB_PARTIAL(0x0A3)
+        },
+        {   // 7 * 16^17 * G
+            LIMB_PAIR(0xA87A6B1E, 0x309A2B2A), LIMB_PAIR(0x5C7B14AC, 0x872CB5DE), LIMB_PAIR(0x2B0CD791, 0x014EE918), LIMB_PAIR(0x9BBE4382, 0x368CA834),
+            LIMB_PAIR(0xD4E89AC5, 0x618B9693), LIMB_PAIR(0x52D7163F, 0xC37A4F47), LIMB_PAIR(0xB54FD0A0, 0x78673C50), LIMB_PAIR(0x7042C7D0, 0x98DDC7DA), LIMB_PARTIAL(0x030),
+            LIMB_PAIR(0x7C37AB34, 0x70882A78), LIMB_PAIR(0xE779B5F2, 0x4D92B068), LIMB_PAIR(0x5EB13B45, 0xD6340623), LIMB_PAIR(0x1A7675E1, 0x3EA17559),
+            LIMB_PAIR(0x51B35F48, 0xA77A590E), LIMB_PAIR(0x969C2DD2, 0x5A6FFF84), LIMB_PAIR(0x7CDA8AE1, 0xDF5551BC), LIMB_PAIR(0x9C9558AF, 0xAB1A48E9), LIMB_PARTIAL(0x040)
+        },
+        {   // 8 * 16^17 * G
+            LIMB_PAIR(0x331DD8A7, 0x80877BFE), LIMB_PAIR(0xDD15F09D, 0xB708DE53), LIMB_PAIR(0x2AE5D424, 0x19F93DA0), LIMB_PAIR(0x50064A50, 0xE7E4CA97),
+            LIMB_PAIR(0xC76F7C7E, 0x95FF7EAF), LIMB_PAIR(0x6E0344D7, 0x5A6E49F0), LIMB_PAIR(0xA4144A34, 0x1F016633), LIMB_PAIR(0x6FE7D882, 0xFF32C2A1), LIMB_PARTIAL(0x031),
+            LIMB_PAIR(0x6DF27677, 0xC8C7B182), LIMB_PAIR(0x1751AD84, 0x33049C00), LIMB_PAIR(0x109F091B, 0x7685641C), LIMB_PAIR(0xFDE67F9F, 0x0E2BEF03),
+            LIMB_PAIR(0xDA20F027, 0xFB7BA091), LIMB_PAIR(0x0D2E4994, 0xCD720085), LIMB_PAIR(0xBC584078, 0xF565899F), LIMB_PAIR(0x46520913, 0x465F7039), LIMB_PARTIAL(0x058)
+        }
+    },
+#endif
+#if (18 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^18 * G
+            LIMB_PAIR(0x5C6F42B0, 0x519A595A), LIMB_PAIR(0xA675ACB4, 0xE39552A9), LIMB_PAIR(0x609641A9, 0xC993A489), LIMB_PAIR(0xCB9D6301, 0x1427EB18),
+            LIMB_PAIR(0xFE02D86E, 0xEB102DD9), LIMB_PAIR(0xA4C15DDC, 0x86DFC2D5), LIMB_PAIR(0xB76F6B2B, 0x0DBFD177), LIMB_PAIR(0xB285289A, 0xEC31EA91), LIMB_PARTIAL(0x0E2),
+            LIMB_PAIR(0xB85445EB, 0x46ED4B2A), LIMB_PAIR(0xC8124AF3, 0xD272162C), LIMB_PAIR(0x675589F1, 0x1B7E446D), LIMB_PAIR(0x9E56E455, 0x605B2806),
+            LIMB_PAIR(0xBD0D72EF, 0x39F9B1AB), LIMB_PAIR(0x793F00E5, 0x52D79F51), LIMB_PAIR(0x7978077C, 0x28D3E23B), LIMB_PAIR(0x4866C9D8, 0x9759E0E6), LIMB_PARTIAL(0x10C)
+        },
+        {   // 2 * 16^18 * G
+            LIMB_PAIR(0xF98C20BE, 0xBB292BF5), LIMB_PAIR(0x80E7F858, 0x3A3411A6), LIMB_PAIR(0x884A2064, 0x4EE85C60), LIMB_PAIR(0xD1FFB068, 0x8BF2F700),
+            LIMB_PAIR(0xF5514A5D, 0x28A61B4F), LIMB_PAIR(0x021CA558, 0xEF4280BA), LIMB_PAIR(0xBEAE03E4, 0xAA64507D), LIMB_PAIR(0xD601D59B, 0x8BF2AA0F), LIMB_PARTIAL(0x123),
+            LIMB_PAIR(0xEE308BF1, 0x61CA18A2), LIMB_PAIR(0x55FDDD4F, 0x9E9DCCCD), LIMB_PAIR(0xAA4B0103, 0x858DD91F), LIMB_PAIR(0x54338E37, 0x21A4A046),
+            LIMB_PAIR(0x80D564CF, 0x88237DA9), LIMB_PAIR(0xA0DC17B8, 0xFA544159), LIMB_PAIR(0xE684E7C1, 0xF6E71432), LIMB_PAIR(0x6BCB8393, 0x9B2EC5CB), LIMB_PARTIAL(0x1D5)
+        },
+        {   // 3 * 16^18 * G
+            LIMB_PAIR(0xA31B8BB9, 0x23C4D719), LIMB_PAIR(0x740F7882, 0x048ABCAC), LIMB_PAIR(0x5EE72269, 0xBD895A1C), LIMB_PAIR(0x9077DB96, 0x95595E42),
+            LIMB_PAIR(0x49088381, 0xD01E2D4B), LIMB_PAIR(0xF7E50193, 0x48570B7F), LIMB_PAIR(0xE6F4ED20, 0xA8830D23), LIMB_PAIR(0x9A45DDB2, 0xBC8AAE5B), LIMB_PARTIAL(0x0DB),
+            LIMB_PAIR(0x970F294E, 0x527E8FF8), LIMB_PAIR(0x26C1D870, 0xD3F0CF50), LIMB_PAIR(0x69AEFA63, 0x255E637C), LIMB_PAIR(0x5BF085B7, 0xF332ED10),
+            LIMB_PAIR(0x9520D99A, 0x6A0BBBA6), LIMB_PAIR(0x3BBF6757, 0x46F6172C), LIMB_PAIR(0x77664D47, 0x5F0B4E9F), LIMB_PAIR(0x1E6BA9EF, 0x5B8C50A1), LIMB_PARTIAL(0x19B)
+        },
+        {   // 4 * 16^18 * G
+            LIMB_PAIR(0xA3EA1A16, 0xEE02879B), LIMB_PAIR(0x39F3A110, 0x8E2314E4), LIMB_PAIR(0x0671F5A4, 0x931DCAB5), LIMB_PAIR(0xFE8A9DF4, 0xB3010E67),
+            LIMB_PAIR(0x0F52A951, 0x5DF54E42), LIMB_PAIR(0x530C0C9D, 0x0B5EB472), LIMB_PAIR(0x18A07787, 0xFC19D87C), LIMB_PAIR(0xF0F2B9F8, 0x60ED2C6F), LIMB_PARTIAL(0x1B4),
+            LIMB_PAIR(0x2C3D7F45, 0x6BED0B7E), LIMB_PAIR(0x10FD3891, 0xD6903D76), LIMB_PAIR(0xF30F92B1, 0xCB4A9876), LIMB_PAIR(0x25C03D48, 0x328688DD),
+            LIMB_PAIR(0xCDB11750, 0x8F51283C), LIMB_PAIR(0xB8D8E361, 0x195F5A81), LIMB_PAIR(0xFEB346D2, 0x4CF3580A), LIMB_PAIR(0x25C261E0, 0x044CFA94), LIMB_PARTIAL(0x1DB)
+        },
+        {   // 5 * 16^18 * G
+            LIMB_PAIR(0xBE2D233D, 0x4143662D), LIMB_PAIR(0x37B9C343, 0xDAA51EA9), LIMB_PAIR(0xE39801A0, 0xE4543A36), LIMB_PAIR(0xC1319E2E, 0x8F043E35),
+            LIMB_PAIR(0x504B47B3, 0x7A0F8DF8), LIMB_PAIR(0xD4D60DAB, 0x0C081EF2), LIMB_PAIR(0x99486CD4, 0x710081A8), LIMB_PAIR(0xA36E4207, 0xD2E4EC67), LIMB_PARTIAL(0x116),
+            LIMB_PAIR(0x07D56E26, 0x55C7A9FE), LIMB_PAIR(0x037F6067, 0xE01C071F), LIMB_PAIR(0x496B19BA, 0x6C4B2BAD), LIMB_PAIR(0xBFF6490D, 0xE511CB4E),
+            LIMB_PAIR(0x85868504, 0x0E086C93), LIMB_PAIR(0x2DB3B875, 0xAC978ACA), LIMB_PAIR(0x28A8E768, 0xC24E564E), LIMB_PAIR(0x3B1F3412, 0xDBA8099B), LIMB_PARTIAL(0x0E2)
+        },
+        {   // 6 * 16^18 * G
+            LIMB_PAIR(0x1C46E0A4, 0x06845F76), LIMB_PAIR(0xBF614354, 0x304F1A22), LIMB_PAIR(0x999719C7, 0xF1EF1477), LIMB_PAIR(0x4A2082F1, 0x077CB0A9),
+            LIMB_PAIR(0xC5CE4148, 0x88D79BC1), LIMB_PAIR(0xBEC656FF, 0xC0DA1DBE), LIMB_PAIR(0x71DDAE3A, 0x5B78DAEA), LIMB_PAIR(0xEA9A43F2, 0x6216BA84), LIMB_PARTIAL(0x1AB),
+            LIMB_PAIR(0xBEA49092, 0xDEAD308E), LIMB_PAIR(0x5F4F2D7A, 0x857AA6BD), LIMB_PAIR(0xDF4F49DC, 0xA80D0EEE), LIMB_PAIR(0x612B71F0, 0x81F3FBD4),
+            LIMB_PAIR(0x009CB72A, 0x8FEB7E2E), LIMB_PAIR(0x8880B33A, 0x149DF069), LIMB_PAIR(0xC70E9EF9, 0x49E5030A), LIMB_PAIR(0xE32D7D93, 0x7FDF363D), LIMB_PARTIAL(0x18C)
+        },
+        {   // 7 * 16^18 * G
+            LIMB_PAIR(0x430AEE87, 0xDC8418B0), LIMB_PAIR(0xFE56A51A, 0xBD5F89C0), LIMB_PAIR(0xC631BEA3, 0x10DB29C4), LIMB_PAIR(0x0C973806, 0xA03FBCBC),
+            LIMB_PAIR(0x0AB83B29, 0xACE383AB), LIMB_PAIR(0x5AEC5994, 0x19F1D9BA), LIMB_PAIR(0x45CB06A0, 0xF36D16C2), LIMB_PAIR(0xE427EA44, 0xA80A5EF4), LIMB_PARTIAL(0x104),
+            LIMB_PAIR(0x67C4BD41, 0x8C77115E), LIMB_PAIR(0x2EDCE105, 0xBC0D9D75), LIMB_PAIR(0xE1A157DE, 0xB4D58D35), LIMB_PAIR(0xE85AB91F, 0x0564C86B),
+            LIMB_PAIR(0x3CC536FF, 0xD0BDF26D), LIMB_PAIR(0x237657CE, 0x4B36E529), LIMB_PAIR(0x5C27949B, 0xD108D7F7), LIMB_PAIR(0xAD81E019, 0xCA0DC963), LIMB_PARTIAL(0x0D5)
+        },
+        {   // 8 * 16^18 * G
+            LIMB_PAIR(0xC6467674, 0xA8AECE33), LIMB_PAIR(0x1843299A, 0x89FF0D8F), LIMB_PAIR(0x3CA3A78E, 0x59ADBAF1), LIMB_PAIR(0xB9A4A75F, 0x196374F4),
+            LIMB_PAIR(0x6AC10A73, 0x789F7231), LIMB_PAIR(0x379C704E, 0x448193FE), LIMB_PAIR(0x4FDF5217, 0x65C6E579), LIMB_PAIR(0x57174E77, 0xE6565A0B), LIMB_PARTIAL(0x001),
+            LIMB_PAIR(0x5B7A3AAC, 0x509A5BE9), LIMB_PAIR(0x5B281D20, 0x5EC7DFD3), LIMB_PAIR(0xFF94FFC7, 0xFD549CC3), LIMB_PAIR(0x0CD3BD2D, 0xF29FE974),
+            LIMB_PAIR(0x708E35B7, 0xD8A4F3AF), LIMB_PAIR(0xB52EDCD2, 0x45222E3B), LIMB_PAIR(0xCD710014, 0x896B102A), LIMB_PAIR(0xE63EBF74, 0x452CD4F4), LIMB_PARTIAL(0x0E8)
+        }
+    },
+#endif
+#if (19 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^19 * G
+            LIMB_PAIR(0xBDF87653, 0xC6999604), LIMB_PAIR(0xB3F0B8C1, 0x5383B379), LIMB_PAIR(0x0BF0435C, 0x98C6AC3D), LIMB_PAIR(0x433C527B, 0x2B04984E),
+            LIMB_PAIR(0x02073E7F, 0x5308793C), LIMB_PAIR(0xE1EF3FA7, 0x4897091D), LIMB_PAIR(0xBB6B4777, 0x4FEA6F39), LIMB_PAIR(0x472023E1, 0x5AD4C5CC), LIMB_PARTIAL(0x0E2),
+            LIMB_PAIR(0xE6CD3BA8, 0x0DB5541A), LIMB_PAIR(0x8C0BAC0E, 0x5504D521), LIMB_PAIR(0xCFAC5E4C, 0x32F61C5C), LIMB_PAIR(0x8538BD21, 0xB8E644B5),
+            LIMB_PAIR(0x51FC9949, 0x8517C72E), LIMB_PAIR(0xAD6F4E8D, 0x8D47A70C), LIMB_PAIR(0x17AB479E, 0xB158E063), LIMB_PAIR(0x74F01418, 0x8C565F7B), LIMB_PARTIAL(0x02F)
+        },
+        {   // 2 * 16^19 * G
+            LIMB_PAIR(0x3AD158A6, 0x4DC47D47), LIMB_PAIR(0x15320816, 0xAAF743F3), LIMB_PAIR(0xE6C5537C, 0x4ECB999D), LIMB_PAIR(0xE63C7840, 0x4DAF6B4E),
+            LIMB_PAIR(0x02BC574E, 0x4BF5F19B), LIMB_PAIR(0xAF39B238, 0xF65D174C), LIMB_PAIR(0xD91F67B5, 0x0093F58B), LIMB_PAIR(0x46D5E8C9, 0x8AD3A5B3), LIMB_PARTIAL(0x1C3),
+            LIMB_PAIR(0x22171340, 0xBB99652C), LIMB_PAIR(0x3F1193A3, 0x4DA02AAA), LIMB_PAIR(0x1776161E, 0x7A73A737), LIMB_PAIR(0xA5FF856B, 0x831DEF3A),
+            LIMB_PAIR(0xDA00DC5B, 0x5F6A4F56), LIMB_PAIR(0x9EC3A028, 0x2A23F500), LIMB_PAIR(0x7CB32472, 0xCE2FD53B), LIMB_PAIR(0x1BB02B47, 0x89451481), LIMB_PARTIAL(0x12D)
+        },
+        {   // 3 * 16^19 * G
+            LIMB_PAIR(0xD62D841E, 0x06642448), LIMB_PAIR(0x4634C737, 0xF9E2A13B), LIMB_PAIR(0x2B4C7A52, 0x45475093), LIMB_PAIR(0x0A8A6321, 0x9515EC4C),
+            LIMB_PAIR(0xBF231A45, 0xA6309219), LIMB_PAIR(0xDA96C8C4, 0x53BCCB4B), LIMB_PAIR(0x9FD870F9, 0x66B59FF4), LIMB_PAIR(0xCCC216E5, 0xAB77154C), LIMB_PARTIAL(0x0A7),
+            LIMB_PAIR(0x3C6C8DF2, 0xDE749644), LIMB_PAIR(0x7F075E4A, 0x11521F6D), LIMB_PAIR(0x7AC5E188, 0xFFE294F5), LIMB_PAIR(0xD39BFB5D, 0x839C1880),
+            LIMB_PAIR(0x0492A75C, 0xFA397453), LIMB_PAIR(0x0556FD68, 0x68816F47), LIMB_PAIR(0xFEC8B33D, 0x2916C12A), LIMB_PAIR(0x3B2E9498, 0x4E6C8F5E), LIMB_PARTIAL(0x1B5)
+        },
+        {   // 4 * 16^19 * G
+            LIMB_PAIR(0xDBFED7CC, 0xC75E1CF3), LIMB_PAIR(0x092E1835, 0x2AF884EE), LIMB_PAIR(0x5472BF17, 0x1E303D71), LIMB_PAIR(0xE7AD90BE, 0xB1EA537B),
+            LIMB_PAIR(0xC4D8B1CF, 0x7FA6A69C), LIMB_PAIR(0x1B57F5B0, 0x5B5318EE), LIMB_PAIR(0x7CCBAFCB, 0x60E61758), LIMB_PAIR(0x9C4ACEC8, 0x5832172A), LIMB_PARTIAL(0x168),
+            LIMB_PAIR(0x9F2F8613, 0x36BAE29B), LIMB_PAIR(0xD464A557, 0x9181194A), LIMB_PAIR(0x52FF8F2C, 0xF74C13FE), LIMB_PAIR(0x0860D712, 0x88D40DFF),
+            LIMB_PAIR(0x6C86E898, 0x405A03BB), LIMB_PAIR(0xDC243178, 0x61F01F2F), LIMB_PAIR(0x91B667F3, 0xEA9771E0), LIMB_PAIR(0xB26BD16B, 0x1DB5CFF3), LIMB_PARTIAL(0x141)
+        },
+        {   // 5 * 16^19 * G
+            LIMB_PAIR(0x8800EFD3, 0xC13056A3), LIMB_PAIR(0x9AACBB7F, 0xE543970F), LIMB_PAIR(0xB2A97BA6, 0xFEF69B99), LIMB_PAIR(0x966DED77, 0x6F8A3A52),
+            LIMB_PAIR(0xC1F0F304, 0x2807AC99), LIMB_PAIR(0x3ADC784C, 0x3C1CC0AD), LIMB_PAIR(0x4C449F6F, 0x7BA76BD7), LIMB_PAIR(0x3469AF86, 0x6FF3EEE0), LIMB_PARTIAL(0x014),
+            LIMB_PAIR(0x27B59D55, 0x1777DCBF), LIMB_PAIR(0x44C1542C, 0xE96E4515), LIMB_PAIR(0x6A04BB53, 0xFA3CCF63), LIMB_PAIR(0x61140902, 0x004F2F02),
+            LIMB_PAIR(0xFA5E01FC, 0x19841095), LIMB_PAIR(0x9ED1CCD0, 0x6FD9982A), LIMB_PAIR(0x8D61E3A9, 0x2EC23099), LIMB_PAIR(0xE85FC571, 0x52B56A73), LIMB_PARTIAL(0x1C1)
+        },
+        {   // 6 * 16^19 * G
+            LIMB_PAIR(0x98D9DF56, 0x2366B92A), LIMB_PAIR(0x44EFACE5, 0xA626F80C), LIMB_PAIR(0x9040C6EA, 0xAE61B15E), LIMB_PAIR(0x18D1D16E, 0x1A44A0E2),
+            LIMB_PAIR(0xC7CF836D, 0xC6F45F75), LIMB_PAIR(0xC87C35FE, 0xE0057ED6), LIMB_PAIR(0xB88D323D, 0x568B05B9), LIMB_PAIR(0x9A12DC71, 0xFBFCAE7A), LIMB_PARTIAL(0x1FE),
+            LIMB_PAIR(0x3DCC4D25, 0xEC63AD13), LIMB_PAIR(0xA54F349A, 0xC75D539B), LIMB_PAIR(0xC5EA1E5D, 0xEDDD4102), LIMB_PAIR(0xA867F628, 0x9028EB89),
+            LIMB_PAIR(0x42846E4F, 0x2D3B3FD0), LIMB_PAIR(0x8ED269B9, 0x23190EAD), LIMB_PAIR(0x67D610DB, 0xA55122EA), LIMB_PAIR(0x637C60AD, 0x83603CDD), LIMB_PARTIAL(0x0FA)
+        },
+        {   // 7 * 16^19 * G
+            LIMB_PAIR(0xF4EC58A1, 0x4DEED00D), LIMB_PAIR(0x1795EDE4, 0x9FED60EE), LIMB_PAIR(0x341A7C8F, 0x01DF19D8), LIMB_PAIR(0x0E549D6F, 0x9BF0E893),
+            LIMB_PAIR(0x4A0B9086, 0x5312C705), LIMB_PAIR(0xAD529BF8, 0x6FE5A8D6), LIMB_PAIR(0x438F4B80, 0x31FF282E), LIMB_PAIR(0xD54CB3DF, 0x37A525BE), LIMB_PARTIAL(0x1BC),
+            LIMB_PAIR(0x3C80219C, 0xE21E9445), LIMB_PAIR(0x7C04756E, 0xF016D163), LIMB_PAIR(0x6E7F689E, 0xBB8C226E), LIMB_PAIR(0x25205289, 0x4135716C),
+            LIMB_PAIR(0x9762AFD7, 0xA37C007A), LIMB_PAIR(0xAEE61EA5, 0x3097FEEA), LIMB_PAIR(0xA0D84EBA, 0xD51692F2), LIMB_PAIR(0x1CB8AF57, 0x724D4A24), LIMB_PARTIAL(0x000)
+        },
+        {   // 8 * 16^19 * G
+            LIMB_PAIR(0x4787129C, 0x73F3A17D), LIMB_PAIR(0xE8C8B154, 0x6CA94151), LIMB_PAIR(0x60011616, 0xAE7257F0), LIMB_PAIR(0xD4459499, 0x5D72F548),
+            LIMB_PAIR(0xC3AF5F62, 0x11739701), LIMB_PAIR(0x9915B9B1, 0xDC2F39EE), LIMB_PAIR(0x6A3A0976, 0x1D6448E7), LIMB_PAIR(0x9216A12D, 0x1263EB6A), LIMB_PARTIAL(0x001),
+            LIMB_PAIR(0xD3C200A3, 0xBC6E933B), LIMB_PAIR(0xBB9A9FF5, 0xE4EE3DD9), LIMB_PAIR(0x53B7BFF8, 0x3772C8F5), LIMB_PAIR(0x482AD6BC, 0xBB6A11B8),
+            LIMB_PAIR(0xCF1DD575, 0x59BBE81B), LIMB_PAIR(0x891128DF, 0x2C9AD563), LIMB_PAIR(0x90470495, 0x4B190E93), LIMB_PAIR(0xD58762DE, 0xB40F60C5), LIMB_PARTIAL(0x1E5)
+        }
+    },
+#endif
+#if (20 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^20 * G
+            LIMB_PAIR(0x81128A65, 0x620AFF9A), LIMB_PAIR(0xD6A9D2C1, 0xA463FFE7), LIMB_PAIR(0xDD4810EF, 0x2206277A), LIMB_PAIR(0xDD0687CA, 0x413EDD73),
+            LIMB_PAIR(0x249CEF0A, 0xF4B12EC9), LIMB_PAIR(0xC4B165CF, 0x14DD6665), LIMB_PAIR(0xC5C070C3, 0x0CF86A23), LIMB_PAIR(0x84755F2C, 0x42354FE9), LIMB_PARTIAL(0x131),
+            LIMB_PAIR(0x2E9C881E, 0x6F4741DF), LIMB_PAIR(0x43F26343, 0x2656911D), LIMB_PAIR(0x1C82E8E5, 0xEBAE8AE4), LIMB_PAIR(0xF3900776, 0xCEB1CA37),
+            LIMB_PAIR(0x16721332, 0x07F2F8FE), LIMB_PAIR(0xAAD4911B, 0x59265673), LIMB_PAIR(0xFC3BDA3F, 0xE8799EAB), LIMB_PAIR(0xFD073355, 0x55805723), LIMB_PARTIAL(0x088)
+        },
+        {   // 2 * 16^20 * G
+            LIMB_PAIR(0x7CE70EDF, 0x2B14935A), LIMB_PAIR(0xE3C6F5A6, 0x1D88D30E), LIMB_PAIR(0x207E5973, 0xAA6220DE), LIMB_PAIR(0x64B5E637, 0x692B3FF0),
+            LIMB_PAIR(0xFF0EB748, 0x04C9DDC8), LIMB_PAIR(0x44978142, 0x9E5EC39E), LIMB_PAIR(0xFA674339, 0x9CC06266), LIMB_PAIR(0xDD3E430D, 0xE0D13DCD), LIMB_PARTIAL(0x1ED),
+            LIMB_PAIR(0xF38BD4CE, 0x74604722), LIMB_PAIR(0x49DA70F3, 0x473E4D35), LIMB_PAIR(0x07D72EFC, 0x12288755), LIMB_PAIR(0x0A7521DE, 0xDF89A505),
+            LIMB_PAIR(0x4C1A6866, 0x67417656), LIMB_PAIR(0x3F7A0EAD, 0xE2C33023), LIMB_PAIR(0xA7474DC1, 0x5E100468), LIMB_PAIR(0xDCC02D45, 0xA47CA1A5), LIMB_PARTIAL(0x01B)
+        },
+        {   // 3 * 16^20 * G
+            LIMB_PAIR(0xD7C3E500, 0x79B40005), LIMB_PAIR(0xA7CBE47D, 0x99957461), LIMB_PAIR(0x53A81EEB, 0x1DBA911D), LIMB_PAIR(0x54CAC621, 0x50049C2A),
+            LIMB_PAIR(0x5C8458C0, 0xC3052CE6), LIMB_PAIR(0x5CD9822E, 0xD4E4CC28), LIMB_PAIR(0x9C89113B, 0xA64BD2BA), LIMB_PAIR(0x24A9A360, 0x616F47F3), LIMB_PARTIAL(0x000),
+            LIMB_PAIR(0x36BB95E6, 0xB309B385), LIMB_PAIR(0xEEB3AF75, 0xF7808DA5), LIMB_PAIR(0xFFEF855A, 0xC9EB3A68), LIMB_PAIR(0xDA981F49, 0x0D7C5382),
+            LIMB_PAIR(0x5A29FE14, 0x2176630E), LIMB_PAIR(0x4B6DD847, 0x7C59C56F), LIMB_PAIR(0x15C998CD, 0x363FC081), LIMB_PAIR(0x1C0E00D7, 0x28B9018E), LIMB_PARTIAL(0x09C)
+        },
+        {   // 4 * 16^20 * G
+            LIMB_PAIR(0x2C51AB39, 0xC9D22D53), LIMB_PAIR(0x2F02748E, 0x0BB42C88), LIMB_PAIR(0x47E18934, 0x576C89C8), LIMB_PAIR(0xB9513257, 0xF34CDC49),
+            LIMB_PAIR(0x9ED107A2, 0xAF97DF12), LIMB_PAIR(0xEEAD8F82, 0x860263DA), LIMB_PAIR(0xFE11C289, 0x6147D39B), LIMB_PAIR(0xF41158F1, 0x3B94B3EB), LIMB_PARTIAL(0x113),
+            LIMB_PAIR(0xF747D887, 0xC4C84D7C), LIMB_PAIR(0xF71F1726, 0x9A54F1A2), LIMB_PAIR(0xDAF5817F, 0xB4A79290), LIMB_PAIR(0x7893855D, 0x33DD5DF8),
+            LIMB_PAIR(0xF6953979, 0x567A1293), LIMB_PAIR(0x0EAC5025, 0xF0C76BB6), LIMB_PAIR(0xBB498D81, 0x863FC87A), LIMB_PAIR(0xE9B3C11D, 0xF5D4E58E), LIMB_PARTIAL(0x16A)
+        },
+        {   // 5 * 16^20 * G
+            LIMB_PAIR(0x96F52213, 0xF02EBE95), LIMB_PAIR(0x62F9F1E9, 0x2ABA2DFC), LIMB_PAIR(0x934EF9F0, 0x7BBDDE57), LIMB_PAIR(0xA417AF58, 0xD5C7882E),
+            LIMB_PAIR(0xDCDF7815, 0x55CDFE89), LIMB_PAIR(0x8470A435, 0xF79051B1), LIMB_PAIR(0x7E8593E8, 0x364DA0AA), LIMB_PAIR(0x975A5F81, 0x02C3D160), LIMB_PARTIAL(0x034),
+            LIMB_PAIR(0xCCD37734, 0x59493183), LIMB_PAIR(0xE645E991, 0x085A8CD2), LIMB_PAIR(0x8C4B4A86, 0x2D54D266), LIMB_PAIR(0x7B4079BE, 0x96CF84CF),
+            LIMB_PAIR(0xBA683F56, 0x4ABADE40), LIMB_PAIR(0xB5457B07, 0xFB29C00B), LIMB_PAIR(0x92AE7F9B, 0x6ED5FD35), LIMB_PAIR(0xB5A9D039, 0xB1F1A25F), LIMB_PARTIAL(0x0CA)
+        },
+        {   // 6 * 16^20 * G
+            LIMB_PAIR(0x0C7723E0, 0x6503932F), LIMB_PAIR(0xA8934788, 0xD185AF25), LIMB_PAIR(0x792232F4, 0x5BC1660C), LIMB_PAIR(0xC2CCD476, 0xCFB04AAB),
+            LIMB_PAIR(0x16844FE7, 0x59E84FEE), LIMB_PAIR(0x09C31AD5, 0x736C2CD8), LIMB_PAIR(0x99058585, 0xDF442154), LIMB_PAIR(0xC3F2B46E, 0xF3B79464), LIMB_PARTIAL(0x1D3),
+            LIMB_PAIR(0x089E2E4F, 0x282464C7), LIMB_PAIR(0x17D8EEE1, 0xBE9D0BFA), LIMB_PAIR(0xFCF3E876, 0x7934AED1), LIMB_PAIR(0xD4E606B9, 0x76465104),
+            LIMB_PAIR(0xFA4412CB, 0xF114EFB4), LIMB_PAIR(0xF1FC8480, 0x8F9F32D2), LIMB_PAIR(0x5C340A29, 0x2879C785), LIMB_PAIR(0xD570BCEF, 0x3D28E8A7), LIMB_PARTIAL(0x178)
+        },
+        {   // 7 * 16^20 * G
+            LIMB_PAIR(0xD326FFB6, 0x8ACD524B), LIMB_PAIR(0x9E731029, 0x4A1091A3), LIMB_PAIR(0x600D299A, 0xB056D998), LIMB_PAIR(0xB78EBF7F, 0xFB695C26),
+            LIMB_PAIR(0x73CC7F48, 0x2B83E30C), LIMB_PAIR(0x4BCB6645, 0xF2364E61), LIMB_PAIR(0x837638C3, 0x6A707650), LIMB_PAIR(0x21528A26, 0x6D1652BF), LIMB_PARTIAL(0x034),
+            LIMB_PAIR(0x6D2B8FC3, 0x353DC81F), LIMB_PAIR(0x8627A2E4, 0xFD300391), LIMB_PAIR(0x1179264C, 0x5F7C2565), LIMB_PAIR(0xAF46D535, 0x69856301),
+            LIMB_PAIR(0x16F35CBC, 0xDFCD6CBD), LIMB_PAIR(0x4FE07645, 0x5D2268FB), LIMB_PAIR(0x29CAC6AA, 0x2CA719DD), LIMB_PAIR(0x8CBE9556, 0x9F8FCB72), LIMB_PARTIAL(0x17C)
+        },
+        {   // 8 * 16^20 * G
+            LIMB_PAIR(0xEEA8D666, 0x20084293), LIMB_PAIR(0x12780DED, 0x01AFA6AE), LIMB_PAIR(0x5B79D11C, 0xDBCE851A), LIMB_PAIR(0x09B895B3, 0x280A43A0),
+            LIMB_PAIR(0x77C59C03, 0x95C92E1A), LIMB_PAIR(0x6B9EC1B8, 0xD9960637), LIMB_PAIR(0x7BEACE14, 0x08C0BB00), LIMB_PAIR(0xEB76C9BE, 0xD0BA7943), LIMB_PARTIAL(0x1B6),
+            LIMB_PAIR(0x15A51540, 0xA14D2A3F), LIMB_PAIR(0x7211BA73, 0xFD25FFCB), LIMB_PAIR(0xCBEEDFAC, 0x020EFE82), LIMB_PAIR(0xAA5301E5, 0xDC5B6591),
+            LIMB_PAIR(0xE1708393, 0x25D3413F), LIMB_PAIR(0xB0A1E5CF, 0x9A3FFF34), LIMB_PAIR(0xD310F9AE, 0x1892F1B7), LIMB_PAIR(0x9DF3548D, 0x3EC31F62), LIMB_PARTIAL(0x17C)
+        }
+    },
+#endif
+#if (21 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^21 * G
+            LIMB_PAIR(0x5338E99E, 0x541BDD79), LIMB_PAIR(0x2656702D, 0x2753B15C), LIMB_PAIR(0xA7F6AF6E, 0x360263F1), LIMB_PAIR(0x02ADC827, 0x42C97787),
+            LIMB_PAIR(0x27ABFF88, 0xB4B4A665), LIMB_PAIR(0x4A9A1CE9, 0x1F9DFE51), LIMB_PAIR(0x48CEB12E, 0xF1FA56AC), LIMB_PAIR(0x6D0B967D, 0xF0E55A36), LIMB_PARTIAL(0x116),
+            LIMB_PAIR(0x49642F41, 0x7ED35BC3), LIMB_PAIR(0x22EE3354, 0x69C8BC46), LIMB_PAIR(0x1911836F, 0x52846623), LIMB_PAIR(0xBF4B87E2, 0xDB193BAF),
+            LIMB_PAIR(0x4209F1E3, 0x427FF5F4), LIMB_PAIR(0xDAE27044, 0x4152FD13), LIMB_PAIR(0xA1F0AE7D, 0x3B73F059), LIMB_PAIR(0x6F1503E1, 0x621ACE50), LIMB_PARTIAL(0x196)
+        },
+        {   // 2 * 16^21 * G
+            LIMB_PAIR(0xECC914FA, 0xCEB3D6D8), LIMB_PAIR(0x326DF942, 0xAADDD75D), LIMB_PAIR(0x391B67B2, 0x8475EE47), LIMB_PAIR(0xE0591E3F, 0xAD4CC87B),
+            LIMB_PAIR(0x9129C3B2, 0x1AA4C9FD), LIMB_PAIR(0x525F0054, 0x52172155), LIMB_PAIR(0xAEADE029, 0xA32FFF27), LIMB_PAIR(0x217C0EA7, 0x550AC763), LIMB_PARTIAL(0x1DF),
+            LIMB_PAIR(0xDF12E80D, 0x3D4BBC04), LIMB_PAIR(0x8D5AD5BA, 0x82D0B17E), LIMB_PAIR(0x1E38BA38, 0x7B059D1E), LIMB_PAIR(0x0F9C9AD6, 0xB22B3BEB),
+            LIMB_PAIR(0x25833548, 0x75948E77), LIMB_PAIR(0xB7D8216D, 0x15E78DB4), LIMB_PAIR(0xC1697CC0, 0x3C573681), LIMB_PAIR(0x37F9ED90, 0x02DFD8B5), LIMB_PARTIAL(0x172)
+        },
+        {   // 3 * 16^21 * G
+            LIMB_PAIR(0x83625A05, 0x72C5CF1E), LIMB_PAIR(0xD0B73C77, 0xB04221EF), LIMB_PAIR(0xDCD8527B, 0x52DE6BDD), LIMB_PAIR(0xD491416E, 0x73E03488),
+            LIMB_PAIR(0x30E7B551, 0xCFEFB1B1), LIMB_PAIR(0x813A17FA, 0x872C5B20), LIMB_PAIR(0x685A3923, 0x75F43FB9), LIMB_PAIR(0x6960BCD8, 0xF057CAE6), LIMB_PARTIAL(0x119),
+            LIMB_PAIR(0x54BECB7E, 0x84E8D679), LIMB_PAIR(0x3AFDB96C, 0x47D5E5DA), LIMB_PAIR(0x04476ED9, 0xF0B5D59B), LIMB_PAIR(0x4C2984A8, 0xB2D7DAEE),
+            LIMB_PAIR(0x986271E7, 0x07FC2E0E), LIMB_PAIR(0xB3300786, 0xA9895F88), LIMB_PAIR(0x53A88830, 0x8F8FCD5A), LIMB_PAIR(0x452D1A5E, 0xE9446200), LIMB_PARTIAL(0x181)
+        },
+        {   // 4 * 16^21 * G
+            LIMB_PAIR(0xA9E110FA, 0xEB05B269), LIMB_PAIR(0x5694769F, 0x3DC96E49), LIMB_PAIR(0x90129A2A, 0x22D5DCB1), LIMB_PAIR(0xDDCAB3BE, 0x15B02839),
+            LIMB_PAIR(0x9819A2D9, 0x2784EFED), LIMB_PAIR(0x83BA587A, 0xC19A373A), LIMB_PAIR(0x31AC78EB, 0x0ECFE7E6), LIMB_PAIR(0xB6580D76, 0x6B7D9A50), LIMB_PARTIAL(0x09F),
+            LIMB_PAIR(0x22E1F23E, 0x20CF011E), LIMB_PAIR(0x71DEC689, 0x2BCD70C6), LIMB_PAIR(0xB968B2E9, 0xA4956ECD), LIMB_PAIR(0x8C68507E, 0xEE6224FD),
+            LIMB_PAIR(0x6E7C15FA, 0x2AEB7D0C), LIMB_PAIR(0x5E1C74A9, 0xF857D1A5), LIMB_PAIR(0x298D033B, 0x4F5EB8C6), LIMB_PAIR(0xDA7EF5FF, 0xFCDA7BDA), LIMB_PARTIAL(0x0FC)
+        },
+        {   // 5 * 16^21 * G
+            LIMB_PAIR(0x5CE20879, 0xF2172430), LIMB_PAIR(0x02995C9B, 0xD48233B6), LIMB_PAIR(0xD39D6149, 0x5DA336E0), LIMB_PAIR(0x1A37DF28, 0xC516D013),
+            LIMB_PAIR(0x2B3FE1C0, 0xA7098D96), LIMB_PAIR(0x6A3099B8, 0x65CEE9A9), LIMB_PAIR(0x320323A0, 0xD1DF9D2E), LIMB_PAIR(0xCFAD65D8, 0xB1C49334), LIMB_PARTIAL(0x024),
+            LIMB_PAIR(0x902DD9F8, 0x3BBC258E), LIMB_PAIR(0x0E9CE909, 0x13861A7C), LIMB_PAIR(0x0F7C4AB6, 0x0F0497F5), LIMB_PAIR(0xDDC4A4CA, 0xEF96A255),
+            LIMB_PAIR(0x14A185DD, 0x4655FD64), LIMB_PAIR(0x91345882, 0xA9839154), LIMB_PAIR(0x6695B74A, 0x96C03926), LIMB_PAIR(0x481DA372, 0xD88DB243), LIMB_PARTIAL(0x0D0)
+        },
+        {   // 6 * 16^21 * G
+            LIMB_PAIR(0x68E52960, 0xABE2205B), LIMB_PAIR(0xA062A50E, 0x773AFDDF), LIMB_PAIR(0xF1CF4A46, 0x8C58EA01), LIMB_PAIR(0xC76BB8D3, 0x3E88E23D),
+            LIMB_PAIR(0xC501E0AA, 0xBB3B294B), LIMB_PAIR(0x0859B18F, 0x42CFD622), LIMB_PAIR(0x16286E18, 0x8C6DC95F), LIMB_PAIR(0x0ECF00FE, 0xD4BA253E), LIMB_PARTIAL(0x071),
+            LIMB_PAIR(0xEB3340EE, 0xC3970825), LIMB_PAIR(0xB3AD699E, 0x4F981608), LIMB_PAIR(0xC80BC4DE, 0xFFB5EA24), LIMB_PAIR(0x604DBB78, 0xB774F894),
+            LIMB_PAIR(0x1C947619, 0xA164C4CB), LIMB_PAIR(0xCF2B764B, 0x92BD21E5), LIMB_PAIR(0xECCA13DD, 0x4B38A590), LIMB_PAIR(0x05CB48A4, 0x1A47520A), LIMB_PARTIAL(0x166)
+        },
+        {   // 7 * 16^21 * G
+            LIMB_PAIR(0x05E31F06, 0x85E007A1), LIMB_PAIR(0xFDCAFFD8, 0x8B43C7DE), LIMB_PAIR(0x7E4AB187, 0x53D13F27), LIMB_PAIR(0x4D4E71E1, 0xF7D22A39),
+            LIMB_PAIR(0x8D0A8B1D, 0xF1DAECF8), LIMB_PAIR(0x90C409CD, 0xE51E2F3A), LIMB_PAIR(0x46D43496, 0xB84B6E0B), LIMB_PAIR(0xF5E87710, 0xB70B148E), LIMB_PARTIAL(0x17D),
+            LIMB_PAIR(0xE45E1097, 0xFDCD92B7), LIMB_PAIR(0x95DA5EF1, 0x6C5FA062), LIMB_PAIR(0x7BAC30EE, 0xD2FA00BB), LIMB_PAIR(0xF49D2088, 0xAADA82E4),
+            LIMB_PAIR(0x56827BA3, 0xF8C4FC0F), LIMB_PAIR(0x207C79AC, 0x04EF216B), LIMB_PAIR(0x38449D34, 0x3A3A6851), LIMB_PAIR(0x91900CE7, 0xF0AD4B51), LIMB_PARTIAL(0x1AA)
+        },
+        {   // 8 * 16^21 * G
+            LIMB_PAIR(0xF3D7286A, 0xB4C52F11), LIMB_PAIR(0xBBF67A41, 0xEC47CB5C), LIMB_PAIR(0xAAFB10A4, 0x89D3382E), LIMB_PAIR(0x06222B90, 0x4AFD8768),
+            LIMB_PAIR(0xFEB5416D, 0xFA16B295), LIMB_PAIR(0x5D095B7C, 0x0946F9D4), LIMB_PAIR(0xFF975E3D, 0x18526B28), LIMB_PAIR(0xB2F1C609, 0x259CEC2F), LIMB_PARTIAL(0x104),
+            LIMB_PAIR(0x62E36127, 0x545642A0), LIMB_PAIR(0x1C38E6F5, 0xC3E4C6F7), LIMB_PAIR(0x1BF9D6C4, 0x1D0E02C4), LIMB_PAIR(0x483BA43D, 0x8A7A6FB6),
+            LIMB_PAIR(0xCF390B9C, 0x7104AEE9), LIMB_PAIR(0x2578E2FB, 0x4ACDCCDF), LIMB_PAIR(0x73B3FEB4, 0xC17AF6DF), LIMB_PAIR(0x7977FA95, 0x2FB789D7), LIMB_PARTIAL(0x1D6)
+        }
+    },
+#endif
+#if (22 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^22 * G
+            LIMB_PAIR(0x7B602085, 0xF762EAF7), LIMB_PAIR(0x2D470147, 0x3B6E6233), LIMB_PAIR(0xD3CCA3E7, 0xE1028D76), LIMB_PAIR(0xCCF39BE7, 0xF3616DD8),
+            LIMB_PAIR(0x08E8F10C, 0xA35C4CC1), LIMB_PAIR(0x7CB4B321, 0xC413DB10), LIMB_PAIR(0xC3249F4B, 0xEAB81774), LIMB_PAIR(0xBE83BC78, 0x3E7BDEA7), LIMB_PARTIAL(0x134),
+            LIMB_PAIR(0x9D38D508, 0x86999F15), LIMB_PAIR(0xFB204D42, 0x0C9A990A), LIMB_PAIR(0xCB616F5B, 0x27C4421D), LIMB_PAIR(0x46AE31EC, 0x2CB6590D),
+            LIMB_PAIR(0x309ACF22, 0x1A33F6AB), LIMB_PAIR(0x80320210, 0x13D99E2A), LIMB_PAIR(0x341D1667, 0xA13731B3), LIMB_PAIR(0x4BFCC116, 0x7E0BAEBA), LIMB_PARTIAL(0x1F0)
+        },
+        {   // 2 * 16^22 * G
+            LIMB_PAIR(0xDA1EF419, 0xB6675F53), LIMB_PAIR(0xAD0B5824, 0xDEA5203B), LIMB_PAIR(0xCFFF1EA2, 0xF882DC2F), LIMB_PAIR(0x08EB5B24, 0x8EF992E4),
+            LIMB_PAIR(0xC3D2321F, 0xD80E2ECF), LIMB_PAIR(0xA5F96675, 0x4CA7BECC), LIMB_PAIR(0x1E1A9196, 0xE2CE41B0), LIMB_PAIR(0x9890D917, 0x9B3D8131), LIMB_PARTIAL(0x094),
+            LIMB_PAIR(0x87C9C810, 0x85C66EFE), LIMB_PAIR(0xF644E538, 0x66FC21BD), LIMB_PAIR(0xE4835D87, 0x2B90CDB5), LIMB_PAIR(0x0F91258F, 0x9A60F214),
+            LIMB_PAIR(0x84BEBF7E, 0xB60EB764), LIMB_PAIR(0x96B0614B, 0xEBE2C36F), LIMB_PAIR(0x92A11210, 0x95ACC927), LIMB_PAIR(0xF35CCB23, 0x31101643), LIMB_PARTIAL(0x101)
+        },
+        {   // 3 * 16^22 * G
+            LIMB_PAIR(0xD78FD6F6, 0x8F345BC8), LIMB_PAIR(0xBC603416, 0x35446BE7), LIMB_PAIR(0x92954E8F, 0x22A05FC3), LIMB_PAIR(0xDE517CA3, 0xCD51695B),
+            LIMB_PAIR(0xC30B42E4, 0xD452C3C1), LIMB_PAIR(0x385847BB, 0x71F0BE42), LIMB_PAIR(0xFA66294B, 0x3E5604DA), LIMB_PAIR(0x91EFA7AB, 0xA32470C7), LIMB_PARTIAL(0x0F7),
+            LIMB_PAIR(0x247C00DC, 0xBE46E43F), LIMB_PAIR(0x4FA716E2, 0xA464EE49), LIMB_PAIR(0x81328C41, 0xF16522FA), LIMB_PAIR(0x187556CC, 0x495048B6),
+            LIMB_PAIR(0xC1682E5F, 0x71224071), LIMB_PAIR(0xB9F18963, 0x5E33DEDF), LIMB_PAIR(0x99A767D5, 0xFCE493C9), LIMB_PAIR(0x6FFA81F2, 0xC7F53C56), LIMB_PARTIAL(0x0CA)
+        },
+        {   // 4 * 16^22 * G
+            LIMB_PAIR(0xDED2EB86, 0xBF73B24C), LIMB_PAIR(0x3EA89845, 0x102900B3), LIMB_PAIR(0x3857CDB6, 0x1D88C507), LIMB_PAIR(0x9BE255D7, 0xA939A76B),
+            LIMB_PAIR(0x2FF653B3, 0x28D51752), LIMB_PAIR(0x7642DF2C, 0x6D817046), LIMB_PAIR(0x57E353B2, 0x148B45E1), LIMB_PAIR(0xB34F0F19, 0xD565F776), LIMB_PARTIAL(0x1E5),
+            LIMB_PAIR(0xC4B5DE1E, 0xCA5185A2), LIMB_PAIR(0xEADF8E0A, 0x527ACEBF), LIMB_PAIR(0x86479736, 0x652B994B), LIMB_PAIR(0xD2F97A05, 0xE252209A),
+            LIMB_PAIR(0xD6960578, 0xC9B07FC9), LIMB_PAIR(0xD264F983, 0x479BA949), LIMB_PAIR(0xE8D9B938, 0xC80D32B5), LIMB_PAIR(0x0A6A7F28, 0x59280D58), LIMB_PARTIAL(0x177)
+        },
+        {   // 5 * 16^22 * G
+            LIMB_PAIR(0xB7CF116D, 0x6FAA299A), LIMB_PAIR(0x04FA5EAB, 0x29A0B9E7), LIMB_PAIR(0x0147F1EB, 0x7301A289), LIMB_PAIR(0xD6B2D599, 0x5A3C9E3E),
+            LIMB_PAIR(0x2D003F89, 0x63CFBA60), LIMB_PAIR(0x6A13199E, 0x720B2F88), LIMB_PAIR(0x8D785CC3, 0x57C483C7), LIMB_PAIR(0x8DAB1162, 0x90E8785A), LIMB_PARTIAL(0x147),
+            LIMB_PAIR(0x026BF788, 0x2C15DE82), LIMB_PAIR(0x45C46443, 0xF542838F), LIMB_PAIR(0x7FA94A27, 0xF8DEAD3C), LIMB_PAIR(0xE287406A, 0x9587D5BF),
+            LIMB_PAIR(0x8DEC97FE, 0xB3EC2E82), LIMB_PAIR(0xF34AA0D8, 0x08BC1827), LIMB_PAIR(0xBDAF6B7D, 0x8E43DDF0), LIMB_PAIR(0x6CFA1BD6, 0x38B99520), LIMB_PARTIAL(0x02E)
+        },
+        {   // 6 * 16^22 * G
+            LIMB_PAIR(0x5AA41145, 0xA822EC34), LIMB_PAIR(0x6DFEBD76, 0xD775FC0B), LIMB_PAIR(0x36B1A137, 0x9D837CED), LIMB_PAIR(0x3B0753D9, 0x672679C8),
+            LIMB_PAIR(0xC3434729, 0xBFC45C63), LIMB_PAIR(0x61C2138B, 0xCDB87028), LIMB_PAIR(0xB86DBFF8, 0xAD0A9384), LIMB_PAIR(0x8B6D5275, 0x7F78A352), LIMB_PARTIAL(0x1A3),
+            LIMB_PAIR(0x90EBEAB0, 0x427697D6), LIMB_PAIR(0x8E6FEC1E, 0x162FC46E), LIMB_PAIR(0xB667222A, 0x99C7E05F), LIMB_PAIR(0x42FFFAA3, 0x1E924322),
+            LIMB_PAIR(0x89F15152, 0x9D79975B), LIMB_PAIR(0x3DDE48F3, 0x4384CBB1), LIMB_PAIR(0x6E28AF03, 0x34FB12A7), LIMB_PAIR(0x853C9AF2, 0x756865FD), LIMB_PARTIAL(0x04D)
+        },
+        {   // 7 * 16^22 * G
+            LIMB_PAIR(0x8FF76030, 0x9965FF97), LIMB_PAIR(0x09623254, 0x3803BE92), LIMB_PAIR(0xE736FEAE, 0xF9006BED), LIMB_PAIR(0x81EE80E2, 0xEBE94E4B),
+            LIMB_PAIR(0xF084F95E, 0x866AEB63), LIMB_PAIR(0xAF245249, 0x0B44F9DF), LIMB_PAIR(0x87F238CE, 0x9AD6AD29), LIMB_PAIR(0xFBBE2900, 0xF4E2E01A), LIMB_PARTIAL(0x1A8),
+            LIMB_PAIR(0x656E4935, 0xC22A67A3), LIMB_PAIR(0x2D8C32A4, 0xF9AA8ED5), LIMB_PAIR(0xF3F515B6, 0x98BE32D0), LIMB_PAIR(0xAE72CC29, 0xB8714B6A),
+            LIMB_PAIR(0x0BBD1D01, 0x1B687423), LIMB_PAIR(0x61121BC7, 0x55674913), LIMB_PAIR(0x9FC2DCD5, 0x156020CD), LIMB_PAIR(0x8FD34058, 0xA230E1D8), LIMB_PARTIAL(0x159)
+        },
+        {   // 8 * 16^22 * G
+            LIMB_PAIR(0xB286BAC2, 0x2DB7055D), LIMB_PAIR(0xFE2D537A, 0x0FCE34C5), LIMB_PAIR(0xB95E9476, 0x8ADDCEA5), LIMB_PAIR(0x1A7C7FF2, 0xF1BACBD4),
+            LIMB_PAIR(0x203FDE3A, 0x28B7F0C9), LIMB_PAIR(0x3E844A62, 0xDFA6CF79), LIMB_PAIR(0x9627DC6C, 0x0107E903), LIMB_PAIR(0x413FCC52, 0x053F2778), LIMB_PARTIAL(0x11D),
+            LIMB_PAIR(0xD10F90A4, 0xF67E718B), LIMB_PAIR(0x0BC29398, 0x7DBCF1E0), LIMB_PAIR(0x9130E9C3, 0xFD5E65D1), LIMB_PAIR(0x9C518E5B, 0x6149B396),
+            LIMB_PAIR(0x918E2279, 0xFB574BB4), LIMB_PAIR(0xC513415E, 0x6C67563F), LIMB_PAIR(0xBA1B801A, 0x60B90D7A), LIMB_PAIR(0xAF900381, 0x2239B9DF), LIMB_PARTIAL(0x0C8)
+        }
+    },
+#endif
+#if (23 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^23 * G
+            LIMB_PAIR(0xA2ABB00E, 0x2D2F9E08), LIMB_PAIR(0x17648C6A, 0x4C8C679D), LIMB_PAIR(0xB8520197, 0x52E2E9BA), LIMB_PAIR(0xE0898E48, 0x7470A3CF),
+            LIMB_PAIR(0x90617E18, 0xBFEB2A91), LIMB_PAIR(0xF44DE1A6, 0x247EA702), LIMB_PAIR(0x7B1604FB, 0x7BAF95B2), LIMB_PAIR(0x020C5856, 0xE9E81B78), LIMB_PARTIAL(0x159),
+            LIMB_PAIR(0xDA533799, 0xDEB81330), LIMB_PAIR(0x3996B5BE, 0xDC4DE9F1), LIMB_PAIR(0xD33F04B5, 0x6A8B7630), LIMB_PAIR(0x2BCCAD83, 0xA4554ACB),
+            LIMB_PAIR(0x2A7F5D61, 0x7974BD47), LIMB_PAIR(0xB01696D5, 0xC481A752), LIMB_PAIR(0x8CA48DA9, 0x6DFBEFDE), LIMB_PAIR(0xE7DB0C27, 0x2FDA492F), LIMB_PARTIAL(0x053)
+        },
+        {   // 2 * 16^23 * G
+            LIMB_PAIR(0xCD046713, 0xA2DADBB4), LIMB_PAIR(0x81AFA390, 0x63EAC83E), LIMB_PAIR(0x422BC0BF, 0x0D85B1AB), LIMB_PAIR(0xD5895AF2, 0x9DFC0092),
+            LIMB_PAIR(0x87EE0EDE, 0x125B2E6C), LIMB_PAIR(0x9EB070D9, 0x96298882), LIMB_PAIR(0x5B0785C6, 0x1A1178F8), LIMB_PAIR(0xD4486F80, 0x9335C96B), LIMB_PARTIAL(0x029),
+            LIMB_PAIR(0x3C5CB794, 0xE747E443), LIMB_PAIR(0x044FD597, 0x50803223), LIMB_PAIR(0x2FC59DE3, 0x4BF3BCC0), LIMB_PAIR(0x44245AB1, 0xD9F4DC32),
+            LIMB_PAIR(0xD2DD61E3, 0xBEDF6330), LIMB_PAIR(0x04D7C5A7, 0xDF8110A9), LIMB_PAIR(0xBD400D1F, 0x852F2205), LIMB_PAIR(0x9C6E9CEF, 0x4595AFAF), LIMB_PARTIAL(0x111)
+        },
+        {   // 3 * 16^23 * G
+            LIMB_PAIR(0xE435A290, 0x1F6FAD01), LIMB_PAIR(0xA1797BBC, 0x2233FB1C), LIMB_PAIR(0xADEC0E98, 0xE5C86B07), LIMB_PAIR(0x2C38F3F3, 0xA6C3E3B3),
+            LIMB_PAIR(0xBE4D76EC, 0x148C7CC4), LIMB_PAIR(0x8F91B601, 0x9A269E56), LIMB_PAIR(0x1872EF0F, 0xDD4FDE65), LIMB_PAIR(0x8AA5366D, 0xAC81696C), LIMB_PARTIAL(0x123),
+            LIMB_PAIR(0xC06DF67A, 0xDD10F5BF), LIMB_PAIR(0xB5E3D640, 0xE02F88CF), LIMB_PAIR(0xB63366E5, 0x67533DEF), LIMB_PAIR(0xD4F7515A, 0xB81B500D),
+            LIMB_PAIR(0x7AC6FDEA, 0x25804829), LIMB_PAIR(0x0C92E736, 0x05E776B3), LIMB_PAIR(0xFDDA7BA5, 0xD366E4AB), LIMB_PAIR(0x38A7D99C, 0x1C88E253), LIMB_PARTIAL(0x199)
+        },
+        {   // 4 * 16^23 * G
+            LIMB_PAIR(0x03D3477B, 0x9B40A31F), LIMB_PAIR(0x400294FE, 0x57E0E72E), LIMB_PAIR(0xE3E8AF40, 0xE8AA7D3F), LIMB_PAIR(0x8DD4D7C0, 0x6A3D5474),
+            LIMB_PAIR(0x65E1BAC8, 0x564564FC), LIMB_PAIR(0x108C5FA4, 0xF8584769), LIMB_PAIR(0xDBBBB595, 0xEB211EAC), LIMB_PAIR(0x24A6B7F6, 0xE06B04DC), LIMB_PARTIAL(0x197),
+            LIMB_PAIR(0x29BFB3D1, 0xC7689FFD), LIMB_PAIR(0x72378C9E, 0x7AEE57F3), LIMB_PAIR(0x6EFE861B, 0x007255D9), LIMB_PAIR(0x6CFBBFAB, 0xB8D3F65F),
+            LIMB_PAIR(0xB6D3923B, 0x44629A5F), LIMB_PAIR(0x97373F3D, 0x49E47CEA), LIMB_PAIR(0xE5D385CC, 0xCCEFC3E7), LIMB_PAIR(0x8461478D, 0xCCCAD6E6), LIMB_PARTIAL(0x061)
+        },
+        {   // 5 * 16^23 * G
+            LIMB_PAIR(0x3699E35F, 0x8980DF2D), LIMB_PAIR(0x7FEE846F, 0x9116DDBE), LIMB_PAIR(0xFA3D46B8, 0xE8E6E54E), LIMB_PAIR(0xB65BC109, 0xB6C3996E),
+            LIMB_PAIR(0xEFFAEE6C, 0xE549C8EA), LIMB_PAIR(0x31410DEB, 0x9553BB7B), LIMB_PAIR(0xA660056E, 0x3900D1CC), LIMB_PAIR(0x15F7DBF7, 0xEA4C30EF), LIMB_PARTIAL(0x18D),
+            LIMB_PAIR(0x1B976FC5, 0x0BF375E1), LIMB_PAIR(0x17E1CBE9, 0xBFA9C680), LIMB_PAIR(0xA7478FF3, 0xD9C860A1), LIMB_PAIR(0x69E4E8E5, 0x34125622),
+            LIMB_PAIR(0xE1FF1512, 0x0E98341C), LIMB_PAIR(0x76EB4630, 0xD320C6FE), LIMB_PAIR(0x1EA3E4A9, 0xA06CEC28), LIMB_PAIR(0x8EF84307, 0xBB00B6A0), LIMB_PARTIAL(0x0DE)
+        },
+        {   // 6 * 16^23 * G
+            LIMB_PAIR(0x0F5BFA4B, 0x47542796), LIMB_PAIR(0x7949B183, 0x30D431DC), LIMB_PAIR(0x6F450425, 0xF8988F28), LIMB_PAIR(0xD3778A2C, 0xD6F6E60D),
+            LIMB_PAIR(0x64D83E77, 0x08719F93), LIMB_PAIR(0xCB7840CC, 0xC77516D1), LIMB_PAIR(0x77B2CCB6, 0xAFBCD880), LIMB_PAIR(0xBFACC373, 0x7037603D), LIMB_PARTIAL(0x08E),
+            LIMB_PAIR(0x6E42CE5B, 0x7D1F7279), LIMB_PAIR(0x535C241F, 0xC9C7AA48), LIMB_PAIR(0x4FA7BC3E, 0x117DC133), LIMB_PAIR(0x83AC9251, 0x85E9129B),
+            LIMB_PAIR(0xDE78FBB3, 0xB0237B53), LIMB_PAIR(0xAB35C8EE, 0xE95C6512), LIMB_PAIR(0x1F97669B, 0x8BA19C45), LIMB_PAIR(0x7AAB8881, 0x9B9F0C8A), LIMB_PARTIAL(0x127)
+        },
+        {   // 7 * 16^23 * G
+            LIMB_PAIR(0x246BC98D, 0xC184AF99), LIMB_PAIR(0xE0904D25, 0xAE516351), LIMB_PAIR(0xA4FA486A, 0xDA6CC6C8), LIMB_PAIR(0x33DD0F0A, 0xFC9EF8FE),
+            LIMB_PAIR(0xAFD708FB, 0x8981F399), LIMB_PAIR(0x2A22F104, 0x65530203), LIMB_PAIR(0x890718A9, 0x5A8D2895), LIMB_PAIR(0x8C71713A, 0x7F48DDF8), LIMB_PARTIAL(0x1F0),
+            LIMB_PAIR(0x69A4FBFF, 0x2E16FAC7), LIMB_PAIR(0xC3ABF535, 0x1EF4FF56), LIMB_PAIR(0x3AEE6084, 0x8F332C08), LIMB_PAIR(0x2B2EF3E8, 0x312A0198),
+            LIMB_PAIR(0x5BA34302, 0xB5303668), LIMB_PAIR(0x0F62A886, 0x72871619), LIMB_PAIR(0xFCB4C8BF, 0x9F6FF887), LIMB_PAIR(0xC3743566, 0xA86874A9), LIMB_PARTIAL(0x180)
+        },
+        {   // 8 * 16^23 * G
+            LIMB_PAIR(0x7FE18629, 0xC8BE45A2), LIMB_PAIR(0xAF2DD971, 0xA5C577AA), LIMB_PAIR(0x61570E7B, 0x6E3A67F0), LIMB_PAIR(0x46C8F13D, 0x2CFC1629),
+            LIMB_PAIR(0xA2754906, 0x6A05848C), LIMB_PAIR(0xD0DA74F2, 0xFD319607), LIMB_PAIR(0x65B65761, 0x0941D89D), LIMB_PAIR(0x5821AE08, 0xE3D2C400), LIMB_PARTIAL(0x1D0),
+            LIMB_PAIR(0xA334B91E, 0x3664AE19), LIMB_PAIR(0x6768D183, 0x21285E38), LIMB_PAIR(0x99758724, 0x09145453), LIMB_PAIR(0xFF52FA6C, 0xD3DEBFA9),
+            LIMB_PAIR(0xD614CE9E, 0xA1D9CB9A), LIMB_PAIR(0x452E7305, 0x9C371626), LIMB_PAIR(0x29277A97, 0xCB2D7E92), LIMB_PAIR(0x2F307A9A, 0x13171AD8), LIMB_PARTIAL(0x10E)
+        }
+    },
+#endif
+#if (24 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^24 * G
+            LIMB_PAIR(0x2FEDA8AC, 0x336B0622), LIMB_PAIR(0x0C0B391C, 0x4658AE22), LIMB_PAIR(0x1F2119D0, 0xE12F058F), LIMB_PAIR(0x495525A1, 0xA1F96C94),
+            LIMB_PAIR(0xCD7D9F17, 0x32EFC7AE), LIMB_PAIR(0xBEA7A5EB, 0x34E4FE2A), LIMB_PAIR(0x7135C5F5, 0x0EFD2492), LIMB_PAIR(0xB83241FF, 0xD7A04EB2), LIMB_PARTIAL(0x036),
+            LIMB_PAIR(0x9CA40933, 0xF11B8E76), LIMB_PAIR(0xD06857C8, 0x1951CD54), LIMB_PAIR(0x29F13914, 0x0E9124F6), LIMB_PAIR(0x3D67D0CD, 0xE6EBBBE3),
+            LIMB_PAIR(0xBF16F9C2, 0x5483A2BC), LIMB_PAIR(0x255EA8CA, 0xD4E4EA52), LIMB_PAIR(0x734EEF50, 0xEE0DB0B5), LIMB_PAIR(0x16207775, 0x54434B51), LIMB_PARTIAL(0x017)
+        },
+        {   // 2 * 16^24 * G
+            LIMB_PAIR(0xA597628A, 0xE67AD2A7), LIMB_PAIR(0x47DEB6B6, 0x424DFE89), LIMB_PAIR(0x0ECACA8E, 0x42669BDC), LIMB_PAIR(0xD86F6549, 0xAE7A2F64),
+            LIMB_PAIR(0x652A2E24, 0x3858F56B), LIMB_PAIR(0x50291825, 0x8E5611A6), LIMB_PAIR(0x20FEB545, 0x21C20611), LIMB_PAIR(0xCD63163A, 0x4E550A9E), LIMB_PARTIAL(0x05F),
+            LIMB_PAIR(0xB3B110BC, 0x4FABBB26), LIMB_PAIR(0x036DE290, 0xEBE74805), LIMB_PAIR(0x33789748, 0xDE88D2D6), LIMB_PAIR(0xDBF7865D, 0x56A1B7B8),
+            LIMB_PAIR(0xE8707CF0, 0x0646D53D), LIMB_PAIR(0x64108A0B, 0xCFB67FAE), LIMB_PAIR(0xA32160EE, 0x04F1401B), LIMB_PAIR(0x5F462A78, 0x5998552D), LIMB_PARTIAL(0x056)
+        },
+        {   // 3 * 16^24 * G
+            LIMB_PAIR(0x7B1A7381, 0x44D1DCB6), LIMB_PAIR(0x541488C5, 0x88AF97D4), LIMB_PAIR(0xE065E612, 0x6D9DFF01), LIMB_PAIR(0x20E73756, 0x61FBE70F),
+            LIMB_PAIR(0x41379C43, 0x493B9080), LIMB_PAIR(0x8391C070, 0x7D969BE1), LIMB_PAIR(0x8A3B0242, 0x04BC1AE1), LIMB_PAIR(0x946C7856, 0x417D5158), LIMB_PARTIAL(0x0EA),
+            LIMB_PAIR(0x17F7E492, 0x45F996F3), LIMB_PAIR(0x0704EFEC, 0xB2904E51), LIMB_PAIR(0x7CB6CF84, 0x0F89BAB9), LIMB_PAIR(0x98E07858, 0x32A4D458),
+            LIMB_PAIR(0xA1BE9838, 0x7202EFB9), LIMB_PAIR(0x4E8743DA, 0x98A4E8AF), LIMB_PAIR(0x657D4C74, 0x605CF158), LIMB_PAIR(0x7E0EBA38, 0xCCB12E26), LIMB_PARTIAL(0x0EE)
+        },
+        {   // 4 * 16^24 * G
+            LIMB_PAIR(0x083E8647, 0x80E86D53), LIMB_PAIR(0xE6BF14C4, 0x4C143F8D), LIMB_PAIR(0xD250DDF8, 0x98965BEB), LIMB_PAIR(0x97F5F7CE, 0x66AD16A0),
+            LIMB_PAIR(0x91CA08F9, 0xF3B79E6A), LIMB_PAIR(0x5555AE35, 0xC8478BB2), LIMB_PAIR(0x3048210B, 0xA3B1085A), LIMB_PAIR(0xC2E9F129, 0x400E0A3F), LIMB_PARTIAL(0x1F1),
+            LIMB_PAIR(0xEF069132, 0x73DD8AAB), LIMB_PAIR(0x66348212, 0x4AA4C725), LIMB_PAIR(0x36F78446, 0x44B84C94), LIMB_PAIR(0x68C9B6CB, 0xF835DA50),
+            LIMB_PAIR(0xA3536E11, 0x66B8E1D9), LIMB_PAIR(0x4F4541D4, 0x29FFBB21), LIMB_PAIR(0xA43E5D3E, 0xCDB5BAFF), LIMB_PAIR(0xD75F692A, 0xCA8FCA6D), LIMB_PARTIAL(0x1D6)
+        },
+        {   // 5 * 16^24 * G
+            LIMB_PAIR(0x97FAABFF, 0x3875C2C9), LIMB_PAIR(0x0A8A8A3E, 0x7D2E0B15), LIMB_PAIR(0xE5C00FA1, 0x1E9892E4), LIMB_PAIR(0x8271DA55, 0xFDAE6C4A),
+            LIMB_PAIR(0xD0C98F92, 0xBEA2C42B), LIMB_PAIR(0x49F83707, 0x229FB76C), LIMB_PAIR(0x062755E8, 0xFE084798), LIMB_PAIR(0xDBD4F518, 0x5D5D514D), LIMB_PARTIAL(0x1E9),
+            LIMB_PAIR(0xE9EB3349, 0x7037FC7C), LIMB_PAIR(0xA3F25B16, 0x80D2AC4B), LIMB_PAIR(0x4B46B33C, 0x37BEBC0D), LIMB_PAIR(0xF5ECE30D, 0x90DEC4B5),
+            LIMB_PAIR(0x98259B5D, 0xA3AE4977), LIMB_PAIR(0xEA2D121B, 0xC60C07B4), LIMB_PAIR(0x36D24A42, 0x2B431681), LIMB_PAIR(0xDB64A83E, 0xDAAF2349), LIMB_PARTIAL(0x1B5)
+        },
+        {   // 6 * 16^24 * G
+            LIMB_PAIR(0xACB36FAB, 0xE54530F5), LIMB_PAIR(0xFE671BC5, 0xD60DE27E), LIMB_PAIR(0x36AB4B55, 0x1D09E4DB), LIMB_PAIR(0x8DF1734C, 0x20AC6261),
+            LIMB_PAIR(0x2FAB1D3A, 0x83CEC1A0), LIMB_PAIR(0x4172E7F4, 0xE959E73C), LIMB_PAIR(0x1D55FB65, 0x38D56B08), LIMB_PAIR(0x584A03D9, 0x1398CB97), LIMB_PARTIAL(0x187),
+            LIMB_PAIR(0x81712E45, 0xA2153162), LIMB_PAIR(0x13244B84, 0x2F77CC7C), LIMB_PAIR(0x5E636322, 0xE28F7A31), LIMB_PAIR(0x76B88D74, 0xEA81C6D1),
+            LIMB_PAIR(0xA66229E1, 0x35D59E53), LIMB_PAIR(0x2B114039, 0x5A1CCFCB), LIMB_PAIR(0xDE1C4BD6, 0x6371A053), LIMB_PAIR(0xC0AB1C97, 0x526E9698), LIMB_PARTIAL(0x1D1)
+        },
+        {   // 7 * 16^24 * G
+            LIMB_PAIR(0x47C3D608, 0x19911D13), LIMB_PAIR(0x258CE1C1, 0x267573DA), LIMB_PAIR(0x5D563B12, 0xB378183F), LIMB_PAIR(0x84A1EC2B, 0x2A09AC78),
+            LIMB_PAIR(0x991D1F10, 0x5AC59A10), LIMB_PAIR(0xEDB7CA7D, 0x9F58D55E), LIMB_PAIR(0x7E3B9893, 0xFD41710B), LIMB_PAIR(0x2D7F8E00, 0x4572D510), LIMB_PARTIAL(0x15E),
+            LIMB_PAIR(0x706B8E8E, 0xD25F4424), LIMB_PAIR(0x75653D00, 0xF38550CF), LIMB_PAIR(0xD9940106, 0xCB55F785), LIMB_PAIR(0xB52EF320, 0xC0BA5C65),
+            LIMB_PAIR(0x3777F7B4, 0x86450684), LIMB_PAIR(0x85C22A24, 0x24D73B7B), LIMB_PAIR(0xF53B1338, 0xC7F1AC86), LIMB_PAIR(0x454E8CF9, 0x8D4BF141), LIMB_PARTIAL(0x11C)
+        },
+        {   // 8 * 16^24 * G
+            LIMB_PAIR(0x4D9B67C0, 0xBDA14ABF), LIMB_PAIR(0xBF9AC0B2, 0x54478DFA), LIMB_PAIR(0xCA457B40, 0x08943AED), LIMB_PAIR(0xF18006C3, 0xD82F3D75),
+            LIMB_PAIR(0x48F5E818, 0x434D99A1), LIMB_PAIR(0xC5422AD5, 0x600C40E3), LIMB_PAIR(0x4361F89D, 0x8A629459), LIMB_PAIR(0x9C176983, 0x25FD287B), LIMB_PARTIAL(0x003),
+            LIMB_PAIR(0x9D02479B, 0x5465DEB6), LIMB_PAIR(0xACF06848, 0x61FD5B4F), LIMB_PAIR(0x47787599, 0xBDA65F85), LIMB_PAIR(0x23280FCC, 0x1689CDCE),
+            LIMB_PAIR(0x62E25557, 0xB2EFD35D), LIMB_PAIR(0x9C9F12B4, 0x19FD6073), LIMB_PAIR(0x3A87DAE1, 0xAF9A3943), LIMB_PAIR(0xC5A84A92, 0x20DD9C0A), LIMB_PARTIAL(0x101)
+        }
+    },
+#endif
+#if (25 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^25 * G
+            LIMB_PAIR(0xC7734385, 0x067F879F), LIMB_PAIR(0xB4A51794, 0x787C7F18), LIMB_PAIR(0x72D9AF69, 0xA269C446), LIMB_PAIR(0x87D71897, 0xA4498E73),
+            LIMB_PAIR(0xA91814AC, 0x28E3D84A), LIMB_PAIR(0xF62FEDE0, 0x8CAF2F61), LIMB_PAIR(0x5DC202BF, 0xAD36DA31), LIMB_PAIR(0xA4689189, 0xFED8BC0F), LIMB_PARTIAL(0x068),
+            LIMB_PAIR(0x96AA1400, 0x84A08542), LIMB_PAIR(0xCD72B4A4, 0x871885F1), LIMB_PAIR(0xE9D3027E, 0x00954202), LIMB_PAIR(0x5C86A302, 0x19B35069),
+            LIMB_PAIR(0x6CFC52A2, 0xBE420B63), LIMB_PAIR(0x87175B19, 0x8B752282), LIMB_PAIR(0x9A22611D, 0xD1811B8C), LIMB_PAIR(0x3E468601, 0xF9C23D80), LIMB_PARTIAL(0x1D2)
+        },
+        {   // 2 * 16^25 * G
+            LIMB_PAIR(0xE6A0BF64, 0xC52699B9), LIMB_PAIR(0x0D0E9732, 0x3D1F9B86), LIMB_PAIR(0xE0882130, 0xA14CA004), LIMB_PAIR(0x3D669257, 0xA6950849),
+            LIMB_PAIR(0xD76816D4, 0x65C264D6), LIMB_PAIR(0xBA522818, 0x594A5D7C), LIMB_PAIR(0x32AD6596, 0x8E44A205), LIMB_PAIR(0x093718EF, 0x74445203), LIMB_PARTIAL(0x189),
+            LIMB_PAIR(0x28885DFC, 0x63B108C6), LIMB_PAIR(0xC31CF288, 0x7DDD44CC), LIMB_PAIR(0xB5267F9A, 0x82B2CAD4), LIMB_PAIR(0x449E0CC8, 0x5B8A5F7B),
+            LIMB_PAIR(0xE8BBB4A4, 0x24A85F05), LIMB_PAIR(0xA0EB93A8, 0x694CDC1C), LIMB_PAIR(0x55741FFE, 0x58943B34), LIMB_PAIR(0x377AD2A2, 0x381DF171), LIMB_PARTIAL(0x0AD)
+        },
+        {   // 3 * 16^25 * G
+            LIMB_PAIR(0xE402D747, 0x13996F30), LIMB_PAIR(0xEBC31A51, 0x2524A83B), LIMB_PAIR(0x95D7EBC0, 0xA41699B7), LIMB_PAIR(0xAD867499, 0x602112C7),
+            LIMB_PAIR(0xD43B5A3E, 0xBF81B788), LIMB_PAIR(0x1C736CEA, 0xF3CD2858), LIMB_PAIR(0x0FF424DD, 0x01A6DF58), LIMB_PAIR(0x95500BAA, 0x6E527DAA), LIMB_PARTIAL(0x171),
+            LIMB_PAIR(0xD1B77FF2, 0x1D966ECB), LIMB_PAIR(0x23985BD7, 0x2980D1C9), LIMB_PAIR(0x35732BA6, 0x20A275A6), LIMB_PAIR(0x430369D0, 0xA1B81F99),
+            LIMB_PAIR(0x3C0A4D36, 0x6052B018), LIMB_PAIR(0x8A790B12, 0xB4FA4D6C), LIMB_PAIR(0x353165BC, 0xF4EE3079), LIMB_PAIR(0x7ED670DE, 0x79EF4679), LIMB_PARTIAL(0x02D)
+        },
+        {   // 4 * 16^25 * G
+            LIMB_PAIR(0x783099AF, 0x84B4E6F6), LIMB_PAIR(0x4DC772B8, 0xA94CA229), LIMB_PAIR(0x5EA29D0B, 0xCB768AA6), LIMB_PAIR(0x0FCB316C, 0xD4736117),
+            LIMB_PAIR(0x9775774C, 0xC411B7B7), LIMB_PAIR(0x96AC3F48, 0x410C974C), LIMB_PAIR(0xAD24A12A, 0x1663C40A), LIMB_PAIR(0xA2A503BD, 0x87F1508D), LIMB_PARTIAL(0x161),
+            LIMB_PAIR(0xD518BBBA, 0xECD265CE), LIMB_PAIR(0xDCC67981, 0x8D77018D), LIMB_PAIR(0x3ED1A18A, 0x1E9C1922), LIMB_PAIR(0x27440D05, 0x5484ED84),
+            LIMB_PAIR(0x42D659D6, 0xD3196409), LIMB_PAIR(0x81354397, 0x82CE3A71), LIMB_PAIR(0xE7D7DD79, 0xD097534D), LIMB_PAIR(0x084658F4, 0xDA9D11CF), LIMB_PARTIAL(0x06E)
+        },
+        {   // 5 * 16^25 * G
+            LIMB_PAIR(0x62C16459, 0x9886A229), LIMB_PAIR(0xE5AA41C7, 0x0E0236AF), LIMB_PAIR(0x61FEF10E, 0x468D4C3A), LIMB_PAIR(0x3DB4D163, 0x8C3171AD),
+            LIMB_PAIR(0x1022BF50, 0xEA418080), LIMB_PAIR(0xDD95500D, 0x29C61BFD), LIMB_PAIR(0xFC1086D4, 0x79073998), LIMB_PAIR(0xD880BED1, 0x18E62735), LIMB_PARTIAL(0x08D),
+            LIMB_PAIR(0xBAB5ED67, 0x3772A3A6), LIMB_PAIR(0xC4A82BE5, 0x59AEAA70), LIMB_PAIR(0x3FA10EAA, 0xDEFD1569), LIMB_PAIR(0x3D7A410F, 0x60CF6BBD),
+            LIMB_PAIR(0x061382ED, 0x9C3CE822), LIMB_PAIR(0x48A0B43D, 0x4B45AF64), LIMB_PAIR(0x752C5323, 0x4C7B5A07), LIMB_PAIR(0xCFD710F2, 0x638F2663), LIMB_PARTIAL(0x0B9)
+        },
+        {   // 6 * 16^25 * G
+            LIMB_PAIR(0x510BE54E, 0xB6D0EEB7), LIMB_PAIR(0x060B7322, 0xED352173), LIMB_PAIR(0x83364EA6, 0x0F581A21), LIMB_PAIR(0xF59EC71B, 0x78EF831E),
+            LIMB_PAIR(0xA055E4B0, 0x09A472C9), LIMB_PAIR(0x7D2404DC, 0x0A529BCB), LIMB_PAIR(0xB461331F, 0x45F10074), LIMB_PAIR(0x69A5A576, 0xF80627F3), LIMB_PARTIAL(0x06D),
+            LIMB_PAIR(0x7362082A, 0x12CF73E3), LIMB_PAIR(0x1D6278A0, 0x7CB89BC9), LIMB_PAIR(0xB9F399D8, 0x2B0C5312), LIMB_PAIR(0x21E7EF6C, 0x4403D4FB),
+            LIMB_PAIR(0x9B453F15, 0x34DD1181), LIMB_PAIR(0x1AE02A19, 0xA38C5E98), LIMB_PAIR(0xDCE1792F, 0xA1ED1AAD), LIMB_PAIR(0xA4D71C9F, 0xAB8261DB), LIMB_PARTIAL(0x036)
+        },
+        {   // 7 * 16^25 * G
+            LIMB_PAIR(0x599A7682, 0xC9EED4F2), LIMB_PAIR(0xA4F4F82A, 0xF1ADE4E4), LIMB_PAIR(0x6AB6D04E, 0x7479DC8B), LIMB_PAIR(0x271E42CF, 0x2DA874DC),
+            LIMB_PAIR(0x9265E2BB, 0xC700CA71), LIMB_PAIR(0x255FDCC6, 0xAF88BA91), LIMB_PAIR(0x5705E0DD, 0xF68C2970), LIMB_PAIR(0x229FDC50, 0x6EE1135B), LIMB_PARTIAL(0x0FB),
+            LIMB_PAIR(0xA1A31961, 0xF4BD32A2), LIMB_PAIR(0xC4785C20, 0x4E67ECCF), LIMB_PAIR(0x17F740E3, 0x8C0CD85D), LIMB_PAIR(0xD8C21194, 0xF6930E3A),
+            LIMB_PAIR(0x76B4C919, 0x2C9D9C73), LIMB_PAIR(0xE69EA290, 0xD32DE819), LIMB_PAIR(0x3724A066, 0xC1028DD3), LIMB_PAIR(0x7538D3AD, 0xFD3F06EE), LIMB_PARTIAL(0x054)
+        },
+        {   // 8 * 16^25 * G
+            LIMB_PAIR(0xD827A280, 0xAD3570F4), LIMB_PAIR(0xB2F60F8B, 0xDB625D88), LIMB_PAIR(0xAE94D18C, 0x81BD93B7), LIMB_PAIR(0xF3AE3394, 0xC2FFFE8A),
+            LIMB_PAIR(0x2E4A72B4, 0x06B0EC26), LIMB_PAIR(0xC7728DC7, 0xF1285A13), LIMB_PAIR(0xA4190A48, 0xD97DEE85), LIMB_PAIR(0xD4B0F305, 0x945E4869), LIMB_PARTIAL(0x023),
+            LIMB_PAIR(0x5C577ABE, 0x44587F93), LIMB_PAIR(0x4DDD2F17, 0x256B5642), LIMB_PAIR(0x0EAB2BC4, 0x36E73DFF), LIMB_PAIR(0xCE0F4471, 0x6B2B5F3A),
+            LIMB_PAIR(0xA25BAE4C, 0xCE1F2F0F), LIMB_PAIR(0x29866124, 0xCF100760), LIMB_PAIR(0x5EA0D400, 0x0EC9B4D2), LIMB_PAIR(0x0ADECE0C, 0x621B6858), LIMB_PARTIAL(0x162)
+        }
+    },
+#endif
+#if (26 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^26 * G
+            LIMB_PAIR(0xBECFF63C, 0x5D3F00EC), LIMB_PAIR(0x671A2835, 0x280FC963), LIMB_PAIR(0x849AD2F5, 0x27CF9990), LIMB_PAIR(0xB27C7F2D, 0xA1CFA523),
+            LIMB_PAIR(0xB8278B74, 0x9D9A6870), LIMB_PAIR(0x9EE793B2, 0xD6176CDF), LIMB_PAIR(0xB31E9501, 0x9A98521A), LIMB_PAIR(0x7436E438, 0x4422E43E), LIMB_PARTIAL(0x0D9),
+            LIMB_PAIR(0xDAA8DC76, 0xDA4F7464), LIMB_PAIR(0x919E1298, 0xA5B83150), LIMB_PAIR(0x81C82C13, 0x00D3948D), LIMB_PAIR(0x63724CDE, 0x95DEF324),
+            LIMB_PAIR(0x7D5A1038, 0x9B57597B), LIMB_PAIR(0x57432B3A, 0x42D9D64E), LIMB_PAIR(0x936E411C, 0x9807D998), LIMB_PAIR(0xF1E57507, 0xE68EEFAC), LIMB_PARTIAL(0x03E)
+        },
+        {   // 2 * 16^26 * G
+            LIMB_PAIR(0x876B33AC, 0x45D90CF8), LIMB_PAIR(0x3ED58F0B, 0xE53E1A99), LIMB_PAIR(0x49D916B3, 0xD5D181F5), LIMB_PAIR(0x2EC09BE2, 0x1B1EF040),
+            LIMB_PAIR(0xB2113B57, 0xE5787176), LIMB_PAIR(0x8073044E, 0x11D02E70), LIMB_PAIR(0xA2AE38DD, 0x9D1C19E7), LIMB_PAIR(0x3634F6FA, 0x2662D494), LIMB_PARTIAL(0x130),
+            LIMB_PAIR(0x6BD6208E, 0x454C8A73), LIMB_PAIR(0xAE37911A, 0xD2447CEF), LIMB_PAIR(0x69B8C5AE, 0x56AC592E), LIMB_PAIR(0x9B615BFC, 0xE7F56483),
+            LIMB_PAIR(0xBBE7FE62, 0xFAC066E1), LIMB_PAIR(0xB7777B32, 0xB2AC3EE1), LIMB_PAIR(0x15114ADA, 0x55F86533), LIMB_PAIR(0x46497CC9, 0x15CBA83E), LIMB_PARTIAL(0x1EF)
+        },
+        {   // 3 * 16^26 * G
+            LIMB_PAIR(0x12ABD32E, 0x7D6D77C4), LIMB_PAIR(0x5A1DC2C8, 0x8B58DF9D), LIMB_PAIR(0x5F9C5B6F, 0x5DF66178), LIMB_PAIR(0xFF715A3A, 0x3F78CCF5),
+            LIMB_PAIR(0x307A7DFB, 0x2376DF67), LIMB_PAIR(0x5068A701, 0x5B5BDEE1), LIMB_PAIR(0x0709FA2E, 0x21F46061), LIMB_PAIR(0x9FC7E647, 0x4C280360), LIMB_PARTIAL(0x117),
+            LIMB_PAIR(0xE7755B08, 0x55195E04), LIMB_PAIR(0xD50F18E2, 0xD9B69A94), LIMB_PAIR(0xA04C2B7D, 0xD1B750B5), LIMB_PAIR(0xCA6F61D0, 0xC9A076B8),
+            LIMB_PAIR(0xDA1FB312, 0x65979F16), LIMB_PAIR(0xD953EE94, 0xBB7D6D42), LIMB_PAIR(0xAA5FF718, 0x1AD05E58), LIMB_PAIR(0x0317E1E4, 0xAB94F480), LIMB_PARTIAL(0x08A)
+        },
+        {   // 4 * 16^26 * G
+            LIMB_PAIR(0x981FD289, 0xC06A64CE), LIMB_PAIR(0xD11FCD02, 0xB8DC2603), LIMB_PAIR(0x770D2EB2, 0xEA27A922), LIMB_PAIR(0xDA8F19ED, 0x83C64076),
+            LIMB_PAIR(0x0AE6A311, 0x9F6D1B65), LIMB_PAIR(0x73FA8721, 0x977277BF), LIMB_PAIR(0xCC0292D8, 0x7115EF98), LIMB_PAIR(0xD2E0C67E, 0x93237AE7), LIMB_PARTIAL(0x069),
+            LIMB_PAIR(0x5C151734, 0x83481B59), LIMB_PAIR(0x0AC1576E, 0xBA00BD74), LIMB_PAIR(0xF178D4F2, 0x48F33272), LIMB_PAIR(0x16492D95, 0xE09FDE38),
+            LIMB_PAIR(0xB9DFCE3F, 0x876124DB), LIMB_PAIR(0x03FE728F, 0x27E7B1E5), LIMB_PAIR(0x04F98F99, 0x79347E46), LIMB_PAIR(0x48DCF0EE, 0x63EC8C5D), LIMB_PARTIAL(0x149)
+        },
+        {   // 5 * 16^26 * G
+            LIMB_PAIR(0x5E85EED0, 0x83623F4A), LIMB_PAIR(0x701D91FC, 0xFF73A65E), LIMB_PAIR(0x49127780, 0x3E93F7EF), LIMB_PAIR(0x8E0A688A, 0x10047A36),
+            LIMB_PAIR(0xA7BD1727, 0x96F38840), LIMB_PAIR(0x13809A85, 0x2F6759F2), LIMB_PAIR(0xD94AFECF, 0x6A04F887), LIMB_PAIR(0x95F9E69A, 0x8332179C), LIMB_PARTIAL(0x071),
+            LIMB_PAIR(0x0660084F, 0x5D3F3C22), LIMB_PAIR(0x2E0FB966, 0x3F769F32), LIMB_PAIR(0x7DF64348, 0x3AAB2F1B), LIMB_PAIR(0x4DA76AC9, 0x9C9AF67F),
+            LIMB_PAIR(0xD1BDC740, 0xE82432D2), LIMB_PAIR(0x38C13136, 0xCA8186AC), LIMB_PAIR(0x39238A7D, 0x45DC1B6F), LIMB_PAIR(0xFFD73047, 0x020D45D8), LIMB_PARTIAL(0x018)
+        },
+        {   // 6 * 16^26 * G
+            LIMB_PAIR(0xB23B9243, 0x82A80D88), LIMB_PAIR(0xD91555EF, 0x1A102766), LIMB_PAIR(0xF069FA76, 0xDF3CEC50), LIMB_PAIR(0x4319CA89, 0xF6C12529),
+            LIMB_PAIR(0x0330EEA5, 0x9A11B37A), LIMB_PAIR(0x02C12564, 0xA5A659A9), LIMB_PAIR(0x1612FA73, 0x3E01E431), LIMB_PAIR(0xE35674B7, 0x85580747), LIMB_PARTIAL(0x1DA),
+            LIMB_PAIR(0xB5A20999, 0xFA500E83), LIMB_PAIR(0xCC336EC6, 0xB539909D), LIMB_PAIR(0x7AE2AC1E, 0x76AA969E), LIMB_PAIR(0xE0A9712F, 0x2144206C),
+            LIMB_PAIR(0x3EC387D1, 0x095FEC7E), LIMB_PAIR(0x52C7840F, 0x59887972), LIMB_PAIR(0x262F5F93, 0xB61A7C61), LIMB_PAIR(0xA76B83B5, 0x75BC25E7), LIMB_PARTIAL(0x16A)
+        },
+        {   // 7 * 16^26 * G
+            LIMB_PAIR(0x84DCF978, 0x28C57F17), LIMB_PAIR(0x17A3887C, 0x5D15960E), LIMB_PAIR(0x82E3034C, 0x6A673E76), LIMB_PAIR(0x8DDE388D, 0x5829936C),
+            LIMB_PAIR(0x73E99034, 0x8ABBCAED), LIMB_PAIR(0x42ABD2EC, 0x3EFC69F3), LIMB_PAIR(0x79F77443, 0xA9F24062), LIMB_PAIR(0x25B3F63F, 0xAF1EBE54), LIMB_PARTIAL(0x137),
+            LIMB_PAIR(0x8F9732DB, 0xE87D4B59), LIMB_PAIR(0xB6CA6427, 0x72D8BED7), LIMB_PAIR(0x07459F38, 0x660EB785), LIMB_PAIR(0xFEA2EEFF, 0xF568DF52),
+            LIMB_PAIR(0x01B83CB3, 0x21B019AC), LIMB_PAIR(0xD4AF53A9, 0x222EB174), LIMB_PAIR(0x932EB702, 0xB04E0CB1), LIMB_PAIR(0x764CF455, 0xC45125DA), LIMB_PARTIAL(0x0F3)
+        },
+        {   // 8 * 16^26 * G
+            LIMB_PAIR(0x2CCBB0DA, 0x327D6409), LIMB_PAIR(0xDC39DA33, 0xC5750F6A), LIMB_PAIR(0x7383F8F4, 0x8B9EEBBF), LIMB_PAIR(0x256C4EDF, 0x9EBB5A8E),
+            LIMB_PAIR(0xA917A2AA, 0x7513F7C0), LIMB_PAIR(0xC4824BD9, 0x31EB5A3D), LIMB_PAIR(0x2ED4A7F4, 0x2D6A4CFC), LIMB_PAIR(0xE0C9C30F, 0x9EE354AA), LIMB_PARTIAL(0x179),
+            LIMB_PAIR(0xCBF2D15B, 0x20EB09C9), LIMB_PAIR(0x2547C112, 0x4574D31C), LIMB_PAIR(0xD38E79AD, 0x76543E3D), LIMB_PAIR(0x4EDC05C4, 0x1D35B887),
+            LIMB_PAIR(0xAEA4DE85, 0x3AC58DC7), LIMB_PAIR(0xAF5715E1, 0x9AA6FA0A), LIMB_PAIR(0xB163A66F, 0x8869704E), LIMB_PAIR(0xD14001CA, 0xC685EA7A), LIMB_PARTIAL(0x083)
+        }
+    },
+#endif
+#if (27 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^27 * G
+            LIMB_PAIR(0x2A7F01FC, 0xBEE09423), LIMB_PAIR(0x998AF9A2, 0x75176A16), LIMB_PAIR(0xFBE89A7A, 0x13273068), LIMB_PAIR(0x13C42B6A, 0x3E74AA6F),
+            LIMB_PAIR(0x579C61B0, 0x7DA022BE), LIMB_PAIR(0xFF23E10A, 0xAA759216), LIMB_PAIR(0xFD852641, 0xCF7F7D1A), LIMB_PAIR(0x1090B6C7, 0x0E9AAF1C), LIMB_PARTIAL(0x0DB),
+            LIMB_PAIR(0x6D9EBCAD, 0x483B1F8C), LIMB_PAIR(0x987B2C42, 0x25F3AADC), LIMB_PAIR(0xF70950D0, 0x83A7BD03), LIMB_PAIR(0x14F250EE, 0x67AEFD6A),
+            LIMB_PAIR(0x90070D75, 0x6E90C4F9), LIMB_PAIR(0x035FDD1E, 0xB9D65432), LIMB_PAIR(0x2AB23F7E, 0x190281BB), LIMB_PAIR(0xB69015DA, 0x36008CB1), LIMB_PARTIAL(0x137)
+        },
+        {   // 2 * 16^27 * G
+            LIMB_PAIR(0x63B7A2CC, 0x80D935B1), LIMB_PAIR(0xD6DC2ACD, 0x3315375E), LIMB_PAIR(0x8B895A51, 0x400BB794), LIMB_PAIR(0xB28F625A, 0x35962FF9),
+            LIMB_PAIR(0xEF66BEC1, 0xD75E5CD7), LIMB_PAIR(0x5157464B, 0x3BEA4171), LIMB_PAIR(0x605C7EB3, 0xF372E7C8), LIMB_PAIR(0xE3301A57, 0x3741FBF0), LIMB_PARTIAL(0x0BF),
+            LIMB_PAIR(0xD0C6184B, 0xA5388110), LIMB_PAIR(0xF89ED74A, 0xCAF6355E), LIMB_PAIR(0xFA93C1EA, 0x4E170981), LIMB_PAIR(0x0DD9B47F, 0xEA60089B),
+            LIMB_PAIR(0x3B9CDA73, 0xA27EFD8B), LIMB_PAIR(0x5EE68672, 0x5852497B), LIMB_PAIR(0x45BAC304, 0x60F0DD9C), LIMB_PAIR(0x3048CD59, 0xF444A8F0), LIMB_PARTIAL(0x0BA)
+        },
+        {   // 3 * 16^27 * G
+            LIMB_PAIR(0x657D30AF, 0xCACF976D), LIMB_PAIR(0xE599602E, 0x8D99F439), LIMB_PAIR(0x42C60609, 0x89B7BA51), LIMB_PAIR(0x27695726, 0xBE1FD861),
+            LIMB_PAIR(0xCF48052E, 0xD1FE4929), LIMB_PAIR(0x75A3938A, 0x785C9947), LIMB_PAIR(0x62F5496F, 0x89C0D825), LIMB_PAIR(0x24237D10, 0xCF585A3F), LIMB_PARTIAL(0x0EA),
+            LIMB_PAIR(0xF48C877E, 0x3D2D602D), LIMB_PAIR(0xF094B87E, 0x56732DBC), LIMB_PAIR(0x4C825B63, 0x5603DD5C), LIMB_PAIR(0x49D45408, 0x41A74548),
+            LIMB_PAIR(0xDDFC690B, 0x573734F5), LIMB_PAIR(0x2C2993AA, 0x5FA01641), LIMB_PAIR(0xAADFE3CD, 0x1BD91FCA), LIMB_PAIR(0xBE83C452, 0x3CD67D47), LIMB_PARTIAL(0x1D2)
+        },
+        {   // 4 * 16^27 * G
+            LIMB_PAIR(0x1F8670AB, 0xD15EA6B4), LIMB_PAIR(0x199B1007, 0x1957A0F1), LIMB_PAIR(0xE3EFADC2, 0x113AFF43), LIMB_PAIR(0x0FDC6ABF, 0x07C60609),
+            LIMB_PAIR(0x0BB0014B, 0x93E7BA31), LIMB_PAIR(0x5D34945F, 0x0F6B7E13), LIMB_PAIR(0xA9F86051, 0x2303A74A), LIMB_PAIR(0x312CF1B2, 0x6C9FC83A), LIMB_PARTIAL(0x17B),
+            LIMB_PAIR(0xE501AAA7, 0x5588CCA5), LIMB_PAIR(0x6E7AC7BF, 0xEF0D3BC1), LIMB_PAIR(0x47339A1A, 0xBFFCD551), LIMB_PAIR(0xC36EAF74, 0xF83B4CB8),
+            LIMB_PAIR(0x9ED93D5F, 0xA4E70EE3), LIMB_PAIR(0x5C249069, 0x0972AC41), LIMB_PAIR(0xCA09BDE3, 0x2E9968FE), LIMB_PAIR(0x8C5AEC39, 0x1B5B3729), LIMB_PARTIAL(0x0C5)
+        },
+        {   // 5 * 16^27 * G
+            LIMB_PAIR(0x093EDCB7, 0x8FF38AA4), LIMB_PAIR(0xE8F5564F, 0xC3C6B459), LIMB_PAIR(0xB8935FFC, 0x613E5157), LIMB_PAIR(0xE10E448E, 0x1EBA7A2A),
+            LIMB_PAIR(0xFC31845B, 0xCF8D70C9), LIMB_PAIR(0x77F5A42D, 0xE1E4D5BB), LIMB_PAIR(0xDD07816D, 0xE61BC59E), LIMB_PAIR(0xE85FABBE, 0xA0928CB3), LIMB_PARTIAL(0x0C4),
+            LIMB_PAIR(0xACC0393D, 0x12E7717E), LIMB_PAIR(0x540BE4CB, 0xCA036B26), LIMB_PAIR(0x36DCF32F, 0x4F59050E), LIMB_PAIR(0x234B425D, 0xDD2E7FF9),
+            LIMB_PAIR(0x36B8D833, 0xBD178951), LIMB_PAIR(0xF989D479, 0x132D27FE), LIMB_PAIR(0xBA09EF6D, 0xC2049EA7), LIMB_PAIR(0xC83A3B7C, 0xB526A9B5), LIMB_PARTIAL(0x157)
+        },
+        {   // 6 * 16^27 * G
+            LIMB_PAIR(0x09EB3233, 0x68A3040E), LIMB_PAIR(0x06FA4864, 0x0A444345), LIMB_PAIR(0x83AF8AF8, 0x579EDEFF), LIMB_PAIR(0x09F49BAF, 0xD6193587),
+            LIMB_PAIR(0x33F9EE19, 0x4597975C), LIMB_PAIR(0xCB85CB9A, 0x5318A888), LIMB_PAIR(0x423FF919, 0x6366031F), LIMB_PAIR(0xF3EF6E44, 0x32FA03EE), LIMB_PARTIAL(0x072),
+            LIMB_PAIR(0x8FE0BDC4, 0xADC2B71B), LIMB_PAIR(0x245354C6, 0xA4B86022), LIMB_PAIR(0xED7A1CA8, 0xBD96981B), LIMB_PAIR(0x8D27B9F8, 0xAAF0BF08),
+            LIMB_PAIR(0x55EF3926, 0xCB56E8F2), LIMB_PAIR(0xF868426E, 0xEE69EE6A), LIMB_PAIR(0x114F6B0C, 0x04146106), LIMB_PAIR(0x0B8D34DB, 0x5BD94000), LIMB_PARTIAL(0x154)
+        },
+        {   // 7 * 16^27 * G
+            LIMB_PAIR(0x38540B67, 0xFE88213A), LIMB_PAIR(0xA30B9044, 0x16613CAD), LIMB_PAIR(0x7861D61F, 0xB06DCE42), LIMB_PAIR(0xE2B9CBE1, 0xFB5C9FFD),
+            LIMB_PAIR(0xA5AE6125, 0xAE4AF79B), LIMB_PAIR(0x3FF351AE, 0x56E69B5A), LIMB_PAIR(0x31DF9832, 0x68DE3B3F), LIMB_PAIR(0xFA3FC1CB, 0x8D2C2960), LIMB_PARTIAL(0x0CE),
+            LIMB_PAIR(0x9FD40F91, 0x979C3DD4), LIMB_PAIR(0xB5640389, 0xCA979B58), LIMB_PAIR(0x836EA10C, 0x855DD28E), LIMB_PAIR(0x17F1CC25, 0xBF40EE0E),
+            LIMB_PAIR(0x5FD556CC, 0xE02BBB2F), LIMB_PAIR(0x05F32F3D, 0x6AADB110), LIMB_PAIR(0x9366213D, 0x26BF5C11), LIMB_PAIR(0x9A1CA27A, 0xC15F02C4), LIMB_PARTIAL(0x1B0)
+        },
+        {   // 8 * 16^27 * G
+            LIMB_PAIR(0xE2ADFECB, 0x671757A6), LIMB_PAIR(0x2BA58FF0, 0x22EB6B42), LIMB_PAIR(0x4E6E393A, 0x845AD552), LIMB_PAIR(0x60FB46A7, 0x3DC6F7CB),
+            LIMB_PAIR(0x0A84396F, 0x9240526B), LIMB_PAIR(0x56152715, 0x13C8F57C), LIMB_PAIR(0x6C45E7A9, 0xAB02366C), LIMB_PAIR(0xAD159399, 0x6D4F07BE), LIMB_PARTIAL(0x06E),
+            LIMB_PAIR(0x07F6E883, 0xF69FDD7F), LIMB_PAIR(0x3F45AAA4, 0x946B2EFB), LIMB_PAIR(0x56806EDA, 0xC3390FF1), LIMB_PAIR(0x21D28BC8, 0x22764FAB),
+            LIMB_PAIR(0x0C20EB57, 0x363B41D1), LIMB_PAIR(0xF6E0FE71, 0x7D693BB1), LIMB_PAIR(0x2816DFC1, 0x5BA2E46A), LIMB_PAIR(0xB0F7EE72, 0x53C3D41A), LIMB_PARTIAL(0x12D)
+        }
+    },
+#endif
+#if (28 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^28 * G
+            LIMB_PAIR(0xC6884CE1, 0xC2D7EAA1), LIMB_PAIR(0x9FAF6322, 0xD7B35C4F), LIMB_PAIR(0x337EA884, 0x8D1A1D85), LIMB_PAIR(0x0F946EBE, 0xBCC6A809),
+            LIMB_PAIR(0x754FB8D2, 0x45EAB172), LIMB_PAIR(0x91DBD926, 0x1E0B251E), LIMB_PAIR(0xFDCE8503, 0x4B61112A), LIMB_PAIR(0x15FA4759, 0x80737C49), LIMB_PARTIAL(0x00A),
+            LIMB_PAIR(0x40260E22, 0x1973C88B), LIMB_PAIR(0xE48DCA69, 0x83078CB7), LIMB_PAIR(0xB199E3EB, 0x4815D67F), LIMB_PAIR(0x7B4DE5D3, 0xF57BDE1F),
+            LIMB_PAIR(0xE139DC10, 0x88A1EBB5), LIMB_PAIR(0x6689DD21, 0x7C20E7C6), LIMB_PAIR(0x80884875, 0x40CBA346), LIMB_PAIR(0x39171E05, 0x5C821402), LIMB_PARTIAL(0x062)
+        },
+        {   // 2 * 16^28 * G
+            LIMB_PAIR(0x4E187FFF, 0x922F12DD), LIMB_PAIR(0x2FAA9F8A, 0x5EDC9B96), LIMB_PAIR(0xC854C83D, 0xB7C218F8), LIMB_PAIR(0x65052D62, 0x3DFCBF32),
+            LIMB_PAIR(0x053D38C2, 0xBD809261), LIMB_PAIR(0x31D0C279, 0xF871B4BE), LIMB_PAIR(0xF30B4A34, 0x6DB21156), LIMB_PAIR(0x8DB71E6A, 0xB5060514), LIMB_PARTIAL(0x0D9),
+            LIMB_PAIR(0x6BEDC91D, 0xA08CE4A8), LIMB_PAIR(0xA0BAE827, 0xDF89CAC0), LIMB_PAIR(0xAA3F520F, 0xC035A514), LIMB_PAIR(0xDA672398, 0xD5E9631F),
+            LIMB_PAIR(0x7150A93D, 0x8A5C3486), LIMB_PAIR(0x0D1A66E5, 0xE176D6C3), LIMB_PAIR(0x74A2379C, 0x1AEBD738), LIMB_PAIR(0x279C3EB9, 0x42D11FE6), LIMB_PARTIAL(0x139)
+        },
+        {   // 3 * 16^28 * G
+            LIMB_PAIR(0xCB4C6645, 0xF2937EDE), LIMB_PAIR(0x1B68F3AE, 0x1E8DDA6D), LIMB_PAIR(0x5C45EAE7, 0x25A8CBCA), LIMB_PAIR(0xB1A328E4, 0x6F07C48E),
+            LIMB_PAIR(0xEF4B3917, 0x473A67AC), LIMB_PAIR(0x208C0836, 0x5E4EEAC1), LIMB_PAIR(0xEC92F538, 0xCA67351B), LIMB_PAIR(0x177CF537, 0x34A8F9F8), LIMB_PARTIAL(0x15A),
+            LIMB_PAIR(0xB9A3216B, 0x7D7F6D7A), LIMB_PAIR(0x0ED36D7F, 0xA4AD0BAB), LIMB_PAIR(0xD4B646CD, 0xD58507F3), LIMB_PAIR(0xA2950840, 0xBD275213),
+            LIMB_PAIR(0x76C25F08, 0x00F031C0), LIMB_PAIR(0x3F46258D, 0x300E0A0C), LIMB_PAIR(0xA03DFBD7, 0x6CE16CD6), LIMB_PAIR(0x40C879F4, 0x35E0211D), LIMB_PARTIAL(0x001)
+        },
+        {   // 4 * 16^28 * G
+            LIMB_PAIR(0x62383E65, 0xA0333497), LIMB_PAIR(0x681092C0, 0x4F94F82B), LIMB_PAIR(0x78A19CA7, 0x583B4503), LIMB_PAIR(0x50E7EA14, 0x81C69ED0),
+            LIMB_PAIR(0x2042E0A5, 0xBDE43E88), LIMB_PAIR(0x6A9F7938, 0x752A9D3E), LIMB_PAIR(0xAF321417, 0x865464D9), LIMB_PAIR(0xB5794804, 0x5BCC326F), LIMB_PARTIAL(0x00A),
+            LIMB_PAIR(0xB958F657, 0x7714AFCA), LIMB_PAIR(0x6E725914, 0x3B927DB4), LIMB_PAIR(0x7FD9A9D8, 0x9EF1925C), LIMB_PAIR(0xBE7E139E, 0xED13FDFD),
+            LIMB_PAIR(0x6E80A43F, 0x5B57AA06), LIMB_PAIR(0x810F9412, 0xC9C221BE), LIMB_PAIR(0x04EC7D73, 0xE6536F3A), LIMB_PAIR(0xDB4D13E7, 0x77765DB5), LIMB_PARTIAL(0x19B)
+        },
+        {   // 5 * 16^28 * G
+            LIMB_PAIR(0x84924113, 0x21FE770F), LIMB_PAIR(0x0AB300CB, 0x2C5D0612), LIMB_PAIR(0xED6C7197, 0xE1699E81), LIMB_PAIR(0xF5948795, 0xDEC38F45),
+            LIMB_PAIR(0x3A48DA6C, 0x79DB54B8), LIMB_PAIR(0xB3F3AF61, 0x95F9D633), LIMB_PAIR(0xA772F809, 0x3E4E733D), LIMB_PAIR(0x605E477F, 0x48DBE53A), LIMB_PARTIAL(0x142),
+            LIMB_PAIR(0x86F2714F, 0x5AB3454E), LIMB_PAIR(0x939B3218, 0x87D83DE7), LIMB_PAIR(0x96D16FF0, 0xB980FBC0), LIMB_PAIR(0xDD96A283, 0xBA3CFAAD),
+            LIMB_PAIR(0x16C3B69F, 0xED413244), LIMB_PAIR(0x968C773E, 0x57968830), LIMB_PAIR(0xED4D4DFA, 0xF315B38C), LIMB_PAIR(0xA24CFB0F, 0xA013ACC5), LIMB_PARTIAL(0x0CA)
+        },
+        {   // 6 * 16^28 * G
+            LIMB_PAIR(0x24E3C650, 0xD064803E), LIMB_PAIR(0x3B9AEC0E, 0xA9010930), LIMB_PAIR(0x19F6F56C, 0x407B3932), LIMB_PAIR(0xD143BE9B, 0x045D7E95),
+            LIMB_PAIR(0x47A9533B, 0x2933B6BE), LIMB_PAIR(0x2BC7F731, 0x01B01EC6), LIMB_PAIR(0x043E4C5D, 0x723ABD9A), LIMB_PAIR(0x25C4E8AF, 0xCD8A1BFD), LIMB_PARTIAL(0x095),
+            LIMB_PAIR(0x6D8A2F90, 0xD719EDED), LIMB_PAIR(0x8B5C2378, 0x08B7C6AF), LIMB_PAIR(0xC01DF5DF, 0x027C6CB7), LIMB_PAIR(0x155CBCE9, 0x1C020CE0),
+            LIMB_PAIR(0x3DEB94D9, 0xC3AEED93), LIMB_PAIR(0xA6F7FEE3, 0x2CAE43C7), LIMB_PAIR(0x7512EF37, 0x54637A4A), LIMB_PAIR(0x81582BD4, 0x3B643660), LIMB_PARTIAL(0x1E8)
+        },
+        {   // 7 * 16^28 * G
+            LIMB_PAIR(0x7E59DDE8, 0xC6D7698F), LIMB_PAIR(0x08AAB860, 0xB1AB83AC), LIMB_PAIR(0xC7FCAC6B, 0xE1972059), LIMB_PAIR(0x656119BD, 0xDE4446AE),
+            LIMB_PAIR(0xF9F8D976, 0x8DFBBEDE), LIMB_PAIR(0x009BE348, 0xE3B8E6D2), LIMB_PAIR(0x974CB79F, 0xA8EAD6EE), LIMB_PAIR(0xB7A415BF, 0x4A566503), LIMB_PARTIAL(0x002),
+            LIMB_PAIR(0x24C0D839, 0xD661701B), LIMB_PAIR(0x11C338CB, 0x6A3200D1), LIMB_PAIR(0x37F3769B, 0x5016BA32), LIMB_PAIR(0xA00F1D08, 0xF4396987),
+            LIMB_PAIR(0x2ADD49AE, 0x16ABF906), LIMB_PAIR(0x04F3DBD4, 0x17DC53E8), LIMB_PAIR(0x54A44690, 0x9EE15F53), LIMB_PAIR(0xA27E4C96, 0xAAA77F7E), LIMB_PARTIAL(0x0BF)
+        },
+        {   // 8 * 16^28 * G
+            LIMB_PAIR(0xDEF62F7A, 0x86DD8F04), LIMB_PAIR(0xCC9E5065, 0x42CD01B9), LIMB_PAIR(0x43275C45, 0xD50B8556), LIMB_PAIR(0x9814155E, 0x404E04A5),
+            LIMB_PAIR(0x266B665E, 0xF7E62F98), LIMB_PAIR(0x86EEDC55, 0xD68E806E), LIMB_PAIR(0x4332001B, 0xB23E4BF3), LIMB_PAIR(0x366D78C2, 0xE0B405B2), LIMB_PARTIAL(0x150),
+            LIMB_PAIR(0xD49D6C3B, 0x6E4C1160), LIMB_PAIR(0x7CE72D17, 0x10C20964), LIMB_PAIR(0x5475D05D, 0x0C0BA532), LIMB_PAIR(0x1523A4F9, 0x77D8DC83),
+            LIMB_PAIR(0x5693CDC6, 0xB053A8BE), LIMB_PAIR(0xE947E953, 0x5E0897A3), LIMB_PAIR(0x7899D5D6, 0xDE13F451), LIMB_PAIR(0xCA78C763, 0xBAFCA001), LIMB_PARTIAL(0x013)
+        }
+    },
+#endif
+#if (29 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^29 * G
+            LIMB_PAIR(0x3DCA9409, 0x8002B6D6), LIMB_PAIR(0x163B8124, 0xD31714C1), LIMB_PAIR(0x720A124A, 0xCA655B42), LIMB_PAIR(0x9596636B, 0x88388DBE),
+            LIMB_PAIR(0xC0B7DC61, 0xA321822D), LIMB_PAIR(0x5824E60F, 0xCDD952C8), LIMB_PAIR(0x6CB4916A, 0x79FF4436), LIMB_PAIR(0x5F88DAB8, 0xA115847E), LIMB_PARTIAL(0x009),
+            LIMB_PAIR(0x0AED0C43, 0x1EAF3D40), LIMB_PAIR(0xEA2A20A4, 0x7A7196F7), LIMB_PAIR(0x97781948, 0x43123414), LIMB_PAIR(0xE88D93FC, 0x856126D0),
+            LIMB_PAIR(0xD5710224, 0x96DAC31F), LIMB_PAIR(0x243E6395, 0xC23548F5), LIMB_PAIR(0x9613A79E, 0xF351DF8B), LIMB_PAIR(0x626FB1FD, 0x0DAE5D50), LIMB_PARTIAL(0x0E2)
+        },
+        {   // 2 * 16^29 * G
+            LIMB_PAIR(0xC0326CDA, 0x0FD02A81), LIMB_PAIR(0x0E5CF6E9, 0xB52279AC), LIMB_PAIR(0x682AD865, 0xD0E8F1CF), LIMB_PAIR(0x2E847BE3, 0x01EB9964),
+            LIMB_PAIR(0x689BAA91, 0x30468F94), LIMB_PAIR(0xB4584D20, 0xA466FA2B), LIMB_PAIR(0x327C510F, 0x99847F1B), LIMB_PAIR(0x26E6F2C0, 0x206BD41D), LIMB_PARTIAL(0x10B),
+            LIMB_PAIR(0xBA3011F2, 0x8A04FD93), LIMB_PAIR(0xAF6C7E86, 0x14C757B9), LIMB_PAIR(0x79ECBE33, 0x49871007), LIMB_PAIR(0x6185A74F, 0xEDF33E22),
+            LIMB_PAIR(0xD4A03368, 0x35AD7383), LIMB_PAIR(0xCE6EFD32, 0xEB5A269E), LIMB_PAIR(0x208FBF53, 0xC83C5FB3), LIMB_PAIR(0x702BB900, 0x35030BB2), LIMB_PARTIAL(0x1DE)
+        },
+        {   // 3 * 16^29 * G
+            LIMB_PAIR(0x4AE20507, 0xA59D74FD), LIMB_PAIR(0xA86A468C, 0x46D0ADBA), LIMB_PAIR(0x0DF04371, 0xC004C36B), LIMB_PAIR(0xC6138633, 0xA0F3CAD9),
+            LIMB_PAIR(0xEEB5863D, 0xFE2133C1), LIMB_PAIR(0x84041AA3, 0x0EF5DC48), LIMB_PAIR(0x1707F418, 0xBC3F0E49), LIMB_PAIR(0xDD7CDF90, 0x3677E9EB), LIMB_PARTIAL(0x178),
+            LIMB_PAIR(0x3A62115F, 0x45465662), LIMB_PAIR(0x8192FA59, 0x4985E0A0), LIMB_PAIR(0x2AE07A9F, 0xABD64EEC), LIMB_PAIR(0x9182D301, 0xE0E94A6D),
+            LIMB_PAIR(0xB543C76B, 0x5230272B), LIMB_PAIR(0x5B5B137B, 0xB7A9F6CE), LIMB_PAIR(0x3E7B2872, 0x45903DEC), LIMB_PAIR(0x44296989, 0xADE61117), LIMB_PARTIAL(0x01C)
+        },
+        {   // 4 * 16^29 * G
+            LIMB_PAIR(0x3ECC9997, 0x809DC9EC), LIMB_PAIR(0x8CF9605C, 0x005BCAB5), LIMB_PAIR(0xAA1B4ED6, 0xFC78790E), LIMB_PAIR(0x687F88A6, 0x6D80A56D),
+            LIMB_PAIR(0xAB9C0398, 0xB7640965), LIMB_PAIR(0xFEDA1C18, 0x61FBD11C), LIMB_PAIR(0x831177F2, 0xDF0FB213), LIMB_PAIR(0x11A2D00A, 0x39E15BFE), LIMB_PARTIAL(0x049),
+            LIMB_PAIR(0xC407557A, 0x05D1B9CE), LIMB_PAIR(0xFFE62203, 0x0FA7F405), LIMB_PAIR(0x7EFA3C26, 0x0267252D), LIMB_PAIR(0xA59468E2, 0x445C8ADD),
+            LIMB_PAIR(0xCD1DDA49, 0x205A0236), LIMB_PAIR(0x9F2BCBC8, 0x3A2196F3), LIMB_PAIR(0xCD2760D0, 0x9C1158D8), LIMB_PAIR(0xE806ABF2, 0x1AD9A2F4), LIMB_PARTIAL(0x044)
+        },
+        {   // 5 * 16^29 * G
+            LIMB_PAIR(0x6AF9B798, 0xF59B124B), LIMB_PAIR(0x63CD2C15, 0xBD11629A), LIMB_PAIR(0xD983900E, 0x0A7AB101), LIMB_PAIR(0x2672749B, 0x5A2F69C4),
+            LIMB_PAIR(0x056680B8, 0xED86B43A), LIMB_PAIR(0x9D645453, 0x7F28BEFE), LIMB_PAIR(0x36CAE0EC, 0xB3D22D32), LIMB_PAIR(0xE9411471, 0xC90AE504), LIMB_PARTIAL(0x0C8),
+            LIMB_PAIR(0x6E0FA123, 0x799B139B), LIMB_PAIR(0x06C5C4F6, 0x35BD8785), LIMB_PAIR(0xE151A5C6, 0xA68161B2), LIMB_PAIR(0xE3FE9E5C, 0xDA895823),
+            LIMB_PAIR(0x7A71156E, 0x19BBDC85), LIMB_PAIR(0xCBCE30A5, 0x60ABEA42), LIMB_PAIR(0x847094F9, 0x395D0F51), LIMB_PAIR(0xD2DC77B0, 0x98AA3EBD), LIMB_PARTIAL(0x078)
+        },
+        {   // 6 * 16^29 * G
+            LIMB_PAIR(0x2EB24D1D, 0x05B67DF6), LIMB_PAIR(0xA67A4839, 0x25B4A127), LIMB_PAIR(0x2BD78D72, 0x4FAAAF76), LIMB_PAIR(0x2652099D, 0x2B8184A6),
+            LIMB_PAIR(0x5179CA55, 0x06671A2E), LIMB_PAIR(0x268EE9AE, 0xEC46447D), LIMB_PAIR(0x7B542F3F, 0x4A4CFD49), LIMB_PAIR(0x16D380B4, 0xBCA419FB), LIMB_PARTIAL(0x183),
+            LIMB_PAIR(0x9E43A49B, 0x181D8093), LIMB_PAIR(0xCF8E6143, 0xB3A7222A), LIMB_PAIR(0xF187C1E6, 0x7EFD951E), LIMB_PAIR(0x354C9D43, 0xA5A9B13F),
+            LIMB_PAIR(0x5FFADA84, 0xEEF45CB6), LIMB_PAIR(0xAA32FA79, 0x1E3FBCE1), LIMB_PAIR(0x5808DC84, 0x557FAD89), LIMB_PAIR(0xFDDF05F7, 0xC6FD2432), LIMB_PARTIAL(0x0CF)
+        },
+        {   // 7 * 16^29 * G
+            LIMB_PAIR(0xF2C1A41E, 0x05A0C8F0), LIMB_PAIR(0x47B45835, 0x3FA3563C), LIMB_PAIR(0x5F941BE6, 0x7D5464C6), LIMB_PAIR(0xEA901ACF, 0xC8BA4C91),
+            LIMB_PAIR(0x2C5F3773, 0x69AAC776), LIMB_PAIR(0xC04113A8, 0x1DDE0221), LIMB_PAIR(0xE105A742, 0xE6BA3AC8), LIMB_PAIR(0xCA196F6E, 0x60CEFE06), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0x3A53B281, 0x69A777CC), LIMB_PAIR(0xFAB69CD1, 0x1BE97838), LIMB_PAIR(0xC254B5AF, 0x6605957A), LIMB_PAIR(0x304E8FB0, 0x22816501),
+            LIMB_PAIR(0x9EC4F2A2, 0xCE4234EA), LIMB_PAIR(0x86C21C2D, 0xBD92A83A), LIMB_PAIR(0x33CCCBE1, 0x953E1E73), LIMB_PAIR(0xBB3DCD75, 0x6E25C079), LIMB_PARTIAL(0x165)
+        },
+        {   // 8 * 16^29 * G
+            LIMB_PAIR(0x10C355DC, 0x97F22A41), LIMB_PAIR(0xBF8056BA, 0x550F2515), LIMB_PAIR(0x7EF07316, 0x253C72A3), LIMB_PAIR(0x85B059A3, 0x0F1F8CD5),
+            LIMB_PAIR(0xA7E4D4A3, 0x8D432E48), LIMB_PAIR(0x7B2C78CF, 0xCDF3981D), LIMB_PAIR(0xDFD71053, 0x15D98F56), LIMB_PAIR(0x949930D5, 0xC95ECB64), LIMB_PARTIAL(0x195),
+            LIMB_PAIR(0x4B7D613E, 0xD5E23BCD), LIMB_PAIR(0xF66ECEBE, 0x8603F848), LIMB_PAIR(0x27A24540, 0xE2CFAEF1), LIMB_PAIR(0x2E9E7EAE, 0xD35BBA9B),
+            LIMB_PAIR(0x7F8C1BD4, 0xB7F17D30), LIMB_PAIR(0xE0AB51A6, 0x901506C4), LIMB_PAIR(0x90755F2B, 0x3E0D62A3), LIMB_PAIR(0x3C553544, 0x8DB637DD), LIMB_PARTIAL(0x0C1)
+        }
+    },
+#endif
+#if (30 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^30 * G
+            LIMB_PAIR(0xE09D583B, 0x9EBD0A79), LIMB_PAIR(0x3F312038, 0x8890CEB3), LIMB_PAIR(0xFE1C7D97, 0x254FF069), LIMB_PAIR(0x3825DCB4, 0xCD82A50A),
+            LIMB_PAIR(0x4C37CDE0, 0x065BF2F9), LIMB_PAIR(0xA7B458E7, 0x59B7C4E2), LIMB_PAIR(0x7D105C29, 0xACE6716E), LIMB_PAIR(0x9F26170E, 0x84D99934), LIMB_PARTIAL(0x107),
+            LIMB_PAIR(0xFAADA7A3, 0xDCA7480B), LIMB_PAIR(0x0D4FB693, 0x203303D3), LIMB_PAIR(0xB9EF7822, 0x0EC1C4D2), LIMB_PAIR(0x594552EA, 0x2B97216D),
+            LIMB_PAIR(0xB59C5490, 0xB93E533E), LIMB_PAIR(0x0D6C3787, 0x50D31AD6), LIMB_PAIR(0x5CB84476, 0x0F1014D6), LIMB_PAIR(0x02B816AD, 0x0523796C), LIMB_PARTIAL(0x1FA)
+        },
+        {   // 2 * 16^30 * G
+            LIMB_PAIR(0x5B9BBE35, 0x18653555), LIMB_PAIR(0xE3D2342C, 0xE67D27E0), LIMB_PAIR(0x9775EEEF, 0x06C2F1F3), LIMB_PAIR(0xE778D2DD, 0x1D98DAE9),
+            LIMB_PAIR(0x3D8C8E86, 0xD04AE269), LIMB_PAIR(0xD8C7FF3C, 0xC49C1B77), LIMB_PAIR(0xDFF1687E, 0x33C474C9), LIMB_PAIR(0x7350001A, 0x4B039756), LIMB_PARTIAL(0x1D5),
+            LIMB_PAIR(0xFE70659C, 0x3A01B07D), LIMB_PAIR(0xEC01B5D1, 0xE8BB7A25), LIMB_PAIR(0x713A5BF0, 0x42F9B07D), LIMB_PAIR(0x370D1490, 0x9C1F15CF),
+            LIMB_PAIR(0x895C898B, 0xD2804385), LIMB_PAIR(0x0194561F, 0x72905D53), LIMB_PAIR(0x828CE8B5, 0xF467F9E0), LIMB_PAIR(0x53E3859F, 0x54D2132D), LIMB_PARTIAL(0x183)
+        },
+        {   // 3 * 16^30 * G
+            LIMB_PAIR(0x603F4F62, 0x7E4FC745), LIMB_PAIR(0x2F0EB97D, 0x300E7434), LIMB_PAIR(0x11BE4195, 0x0E64A634), LIMB_PAIR(0x52B038E7, 0x6C160B9D),
+            LIMB_PAIR(0xA62D7FB8, 0x4D130D75), LIMB_PAIR(0x23B6BF71, 0x83B6412B), LIMB_PAIR(0x19D0A2D2, 0xE92B5B07), LIMB_PAIR(0xFE79AA1B, 0xF547F666), LIMB_PARTIAL(0x1DB),
+            LIMB_PAIR(0xA1364F6B, 0x609495E1), LIMB_PAIR(0x9DE725E5, 0xC196A1C6), LIMB_PAIR(0x051A1989, 0x24E0C338), LIMB_PAIR(0x7132B77C, 0x5B24ECC1),
+            LIMB_PAIR(0x7D5F2440, 0xC3888953), LIMB_PAIR(0xDDFFD474, 0x847186D0), LIMB_PAIR(0x643C84F9, 0x0EA28F9C), LIMB_PAIR(0x4CDFCC12, 0xAC9296CA), LIMB_PARTIAL(0x151)
+        },
+        {   // 4 * 16^30 * G
+            LIMB_PAIR(0x6B33442D, 0x62E30F14), LIMB_PAIR(0x42123A0A, 0xDE4D2E10), LIMB_PAIR(0xA59B4649, 0xA1E5E2DD), LIMB_PAIR(0xDFA5D292, 0x2B6AA7D5),
+            LIMB_PAIR(0x00C25B90, 0x83F0033E), LIMB_PAIR(0x1D598A8F, 0x2E614326), LIMB_PAIR(0xDF8943FA, 0xA5AA5A26), LIMB_PAIR(0xD4FB7104, 0x7459318A), LIMB_PARTIAL(0x1A7),
+            LIMB_PAIR(0xD67084D6, 0x53ED625B), LIMB_PAIR(0x0D232F5D, 0x47A2D595), LIMB_PAIR(0xF8863270, 0x593A7030), LIMB_PAIR(0x993051E2, 0x3E87B5AB),
+            LIMB_PAIR(0xCA5387C6, 0x02E51486), LIMB_PAIR(0xA818DE0F, 0x7612F0C7), LIMB_PAIR(0xB42F317F, 0x32D26729), LIMB_PAIR(0xB9A3C2F4, 0x48A9B12F), LIMB_PARTIAL(0x1DD)
+        },
+        {   // 5 * 16^30 * G
+            LIMB_PAIR(0xCC0AE72B, 0x60B11099), LIMB_PAIR(0xD3588531, 0x51CF7973), LIMB_PAIR(0x1F018F3E, 0x62AEA2EE), LIMB_PAIR(0x28E42557, 0xCEAEC7A0),
+            LIMB_PAIR(0x52DF0599, 0x695F7CCE), LIMB_PAIR(0x2A1B3F00, 0xF2282545), LIMB_PAIR(0x6394DE22, 0x8C2DF32E), LIMB_PAIR(0x2DB1770F, 0x18CE083E), LIMB_PARTIAL(0x088),
+            LIMB_PAIR(0x4BA02F8F, 0x7989F8BF), LIMB_PAIR(0xB69BD72B, 0x22FC813F), LIMB_PAIR(0x0A383C73, 0xF4EEFA60), LIMB_PAIR(0x6DBF9F7D, 0xD7AA3E7E),
+            LIMB_PAIR(0xD2D50A4D, 0x98113DB2), LIMB_PAIR(0x4D81782D, 0x47E078B1), LIMB_PAIR(0x27DF6ACE, 0xEF4CEA63), LIMB_PAIR(0x577EEFC9, 0xF720012F), LIMB_PARTIAL(0x1C9)
+        },
+        {   // 6 * 16^30 * G
+            LIMB_PAIR(0xE1A83401, 0x45FF6CFF), LIMB_PAIR(0x54A79E2A, 0x7B9B4EED), LIMB_PAIR(0x933BB48A, 0x979B1475), LIMB_PAIR(0x634D7EC6, 0x135E2594),
+            LIMB_PAIR(0xD5DCCBBE, 0xC08BA7B4), LIMB_PAIR(0xC3826372, 0x78FCE165), LIMB_PAIR(0x31102CDE, 0xB1F172E4), LIMB_PAIR(0x3EBA4396, 0xB6FD8F34), LIMB_PARTIAL(0x00B),
+            LIMB_PAIR(0xB4F622A3, 0xF7D351A9), LIMB_PAIR(0x52AF1195, 0x80215FC7), LIMB_PAIR(0x0E0E3C73, 0x967F5F19), LIMB_PAIR(0x9F80960B, 0x4E05F75F),
+            LIMB_PAIR(0x8EEB6E11, 0x76C30E85), LIMB_PAIR(0x56A7ACB6, 0x9F270D15), LIMB_PAIR(0x64FFF770, 0x9236E117), LIMB_PAIR(0xE474EA10, 0x80C87737), LIMB_PARTIAL(0x1CF)
+        },
+        {   // 7 * 16^30 * G
+            LIMB_PAIR(0x03D54C5E, 0xD3C4E96B), LIMB_PAIR(0x65450BA4, 0x962EF31F), LIMB_PAIR(0x4DD512C0, 0x4A75AEB6), LIMB_PAIR(0x233D2675, 0x4C4D23AA),
+            LIMB_PAIR(0x0055293F, 0x42CFC07C), LIMB_PAIR(0x242A0317, 0xBBFF60C5), LIMB_PAIR(0x5C4F2C32, 0x3F27D5C9), LIMB_PAIR(0x746505B8, 0xCA352C57), LIMB_PARTIAL(0x080),
+            LIMB_PAIR(0x92A1EF30, 0x5751EECA), LIMB_PAIR(0x1F9EEE84, 0xB83A993E), LIMB_PAIR(0x2E0AC56F, 0x5EEC2ED7), LIMB_PAIR(0xCC0D1E16, 0x95AD825B),
+            LIMB_PAIR(0x8AF2A112, 0xD3AA7BA6), LIMB_PAIR(0xC7EF1FCA, 0x3035C3F8), LIMB_PAIR(0x5216A429, 0x5B5BF3E5), LIMB_PAIR(0x0FCB5720, 0xDF187DDD), LIMB_PARTIAL(0x025)
+        },
+        {   // 8 * 16^30 * G
+            LIMB_PAIR(0xB310BEA8, 0xA549238E), LIMB_PAIR(0x99BB8AB7, 0xB542445A), LIMB_PAIR(0x8C208B86, 0xA930BD6A), LIMB_PAIR(0x168AF442, 0x1B97C831),
+            LIMB_PAIR(0xA291BFFE, 0x18D4FC46), LIMB_PAIR(0xA6B461AE, 0x1D202D44), LIMB_PAIR(0xC57C66FB, 0x433DD2D7), LIMB_PAIR(0x2A79F133, 0xF21B5D1D), LIMB_PARTIAL(0x01B),
+            LIMB_PAIR(0x2EE37543, 0x99343AA3), LIMB_PAIR(0x7EFF1BD4, 0x904B8DCD), LIMB_PAIR(0x9711AB88, 0x4E1B01FA), LIMB_PAIR(0x3AF62C90, 0xF8111AC3),
+            LIMB_PAIR(0x58910F9A, 0x59CCFEA1), LIMB_PAIR(0x58E5F398, 0xF4D713A3), LIMB_PAIR(0xB9C12355, 0x6CBBD15F), LIMB_PAIR(0xC3F59372, 0x6181D1C0), LIMB_PARTIAL(0x170)
+        }
+    },
+#endif
+#if (31 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^31 * G
+            LIMB_PAIR(0xA6A08EDB, 0x0BC2FC66), LIMB_PAIR(0x81D46942, 0x4F83DBE4), LIMB_PAIR(0x4E44B819, 0xDD379BC1), LIMB_PAIR(0xB5785CC1, 0x6F409F1A),
+            LIMB_PAIR(0x40232DA3, 0x3FAC6DDA), LIMB_PAIR(0x11B9BC84, 0x83B4BFDC), LIMB_PAIR(0xC91E3874, 0x4563149A), LIMB_PAIR(0xF562966F, 0x210062C6), LIMB_PARTIAL(0x126),
+            LIMB_PAIR(0x9548D9C4, 0x6A00191E), LIMB_PAIR(0xD9716285, 0x800F66BC), LIMB_PAIR(0x15DD9859, 0x3A8C05A3), LIMB_PAIR(0xAC571627, 0xAF6DCDF5),
+            LIMB_PAIR(0x006A2A90, 0xEAE07417), LIMB_PAIR(0xFCB7C955, 0x11B368FB), LIMB_PAIR(0xC4ABE2B7, 0x5E47618F), LIMB_PAIR(0x5AB9DD68, 0x328F44C8), LIMB_PARTIAL(0x15D)
+        },
+        {   // 2 * 16^31 * G
+            LIMB_PAIR(0x8451AD30, 0x7AC007AD), LIMB_PAIR(0x0905B6A7, 0xADB09D59), LIMB_PAIR(0x3ED8D9DB, 0x96B38233), LIMB_PAIR(0x144AAAAA, 0x7BA1AB90),
+            LIMB_PAIR(0x4ABAE176, 0x2D31FB34), LIMB_PAIR(0xD1D9CB6C, 0xC0471119), LIMB_PAIR(0x21C9FE02, 0xE56B6812), LIMB_PAIR(0xEFBD1643, 0xFD040D70), LIMB_PARTIAL(0x09E),
+            LIMB_PAIR(0x2975AF75, 0x91C517C0), LIMB_PAIR(0x834DE3AD, 0x7A77C8F2), LIMB_PAIR(0xC6E95530, 0x7DFD1527), LIMB_PAIR(0x0EA03560, 0x982A2EEF),
+            LIMB_PAIR(0xC7E0205D, 0xC340FE70), LIMB_PAIR(0x735BC119, 0x302CA446), LIMB_PAIR(0x5C271F62, 0xCC107228), LIMB_PAIR(0xC486FBDA, 0x9BA4E55B), LIMB_PARTIAL(0x06F)
+        },
+        {   // 3 * 16^31 * G
+            LIMB_PAIR(0x6C2569C9, 0x1EA6A1B6), LIMB_PAIR(0x0B8D26FA, 0x0B13D316), LIMB_PAIR(0x723A1780, 0x68C05F76), LIMB_PAIR(0x4877E102, 0x5131968D),
+            LIMB_PAIR(0xB306C24E, 0x6E187E84), LIMB_PAIR(0x2633A205, 0xC8193255), LIMB_PAIR(0x55B73112, 0x9B4C373E), LIMB_PAIR(0xD25ED330, 0x14255743), LIMB_PARTIAL(0x0F9),
+            LIMB_PAIR(0x1AAA611D, 0x2B48DB01), LIMB_PAIR(0x1D2BF0A9, 0x4D70FE3D), LIMB_PAIR(0x43546512, 0x81659E91), LIMB_PAIR(0x68A7CDEF, 0xF846864F),
+            LIMB_PAIR(0x988A5592, 0x4F7836B0), LIMB_PAIR(0x943B6365, 0x8E2DF580), LIMB_PAIR(0x585BF2D4, 0xD93315F8), LIMB_PAIR(0x8FB166BE, 0x6D04F86B), LIMB_PARTIAL(0x049)
+        },
+        {   // 4 * 16^31 * G
+            LIMB_PAIR(0xA5E6776F, 0x6A00D57D), LIMB_PAIR(0xDBD9BD8F, 0x8A138DA8), LIMB_PAIR(0xD5FDDAA1, 0xA059ED07), LIMB_PAIR(0x1A42E212, 0x4F6122D9),
+            LIMB_PAIR(0x09D704DF, 0xE72E39C5), LIMB_PAIR(0xF15340DD, 0x025696A8), LIMB_PAIR(0xB760BAFD, 0xE75FA17D), LIMB_PAIR(0x017F537B, 0x1B7950B1), LIMB_PARTIAL(0x109),
+            LIMB_PAIR(0x3F72EC2F, 0x1E1AF3BD), LIMB_PAIR(0x8DF112A2, 0x0B95F25A), LIMB_PAIR(0xC4B96EA1, 0x6F3E98AE), LIMB_PAIR(0xF3DDF2C6, 0x5B890EEC),
+            LIMB_PAIR(0xD1B40C40, 0xB4E902C3), LIMB_PAIR(0x78E129B2, 0x331CEF26), LIMB_PAIR(0xA4F572DE, 0xDF376CFC), LIMB_PAIR(0xAD414479, 0x9299466A), LIMB_PARTIAL(0x103)
+        },
+        {   // 5 * 16^31 * G
+            LIMB_PAIR(0xBD779498, 0x561F1FC0), LIMB_PAIR(0xDA32023B, 0xE893E206), LIMB_PAIR(0x325E13F2, 0x09B1D8C0), LIMB_PAIR(0x2349FD6F, 0xA3CB2AAB),
+            LIMB_PAIR(0x4CC4096A, 0xA9118E96), LIMB_PAIR(0x4B1919A9, 0xF38D1FDF), LIMB_PAIR(0x2A987A53, 0x97F159F9), LIMB_PAIR(0x8C44C5E0, 0x312FBD5E), LIMB_PARTIAL(0x095),
+            LIMB_PAIR(0xE5DCAB70, 0xAB2BD7D1), LIMB_PAIR(0x4FDDCD69, 0xF40AF5E2), LIMB_PAIR(0xEB621752, 0x1CD24613), LIMB_PAIR(0x0A878ED0, 0x88FA2A35),
+            LIMB_PAIR(0x7196530F, 0xA32EB798), LIMB_PAIR(0x8006FCFD, 0xE65D4AD6), LIMB_PAIR(0xD212B2A6, 0x21F3AECC), LIMB_PAIR(0x1ADC0F2E, 0x727667E4), LIMB_PARTIAL(0x179)
+        },
+        {   // 6 * 16^31 * G
+            LIMB_PAIR(0x6962FCB0, 0xB6EE4B5B), LIMB_PAIR(0x6AA973CD, 0x10815244), LIMB_PAIR(0x481AD453, 0x30FA7D1D), LIMB_PAIR(0x1E331373, 0xA886B211),
+            LIMB_PAIR(0x89CCF318, 0x0EE24931), LIMB_PAIR(0x2AAAE84D, 0x68EAF3A9), LIMB_PAIR(0xA632235D, 0xAD7B1884), LIMB_PAIR(0xD4184BDB, 0xD558610E), LIMB_PARTIAL(0x1FB),
+            LIMB_PAIR(0x08A5DE2F, 0xA0DDA2AF), LIMB_PAIR(0xD8FCC9E6, 0x18A6164D), LIMB_PAIR(0x3B27FA80, 0x82979615), LIMB_PAIR(0x8500C885, 0x888661DD),
+            LIMB_PAIR(0xB12957B7, 0x096F4643), LIMB_PAIR(0x5099442F, 0x5FCCE706), LIMB_PAIR(0x557E597A, 0x7462977B), LIMB_PAIR(0x42F41666, 0xAF8E13BA), LIMB_PARTIAL(0x168)
+        },
+        {   // 7 * 16^31 * G
+            LIMB_PAIR(0xE1B0FC29, 0x89E56BAD), LIMB_PAIR(0x88FEEEAF, 0xA0A84C44), LIMB_PAIR(0xBE076BC9, 0x3AADF31A), LIMB_PAIR(0xD6D07B9F, 0x8DAAE2E8),
+            LIMB_PAIR(0x481832E3, 0x9EC902C9), LIMB_PAIR(0xEEBA640A, 0xFD27F0D4), LIMB_PAIR(0x7799BF38, 0x6E18C2D9), LIMB_PAIR(0x34D572B6, 0x32D3303F), LIMB_PARTIAL(0x17B),
+            LIMB_PAIR(0x9D4EBC77, 0x53C93CD1), LIMB_PAIR(0x0648BB52, 0x26F25E8D), LIMB_PAIR(0xE62DC715, 0x01B7C33C), LIMB_PAIR(0xDEC92CBC, 0x38B3F6C3),
+            LIMB_PAIR(0xDF7561BD, 0x79298A06), LIMB_PAIR(0x8591EB32, 0x3677B3C9), LIMB_PAIR(0x8EDA9409, 0x85AA47AF), LIMB_PAIR(0x64D8F03B, 0x8BE6F810), LIMB_PARTIAL(0x0B4)
+        },
+        {   // 8 * 16^31 * G
+            LIMB_PAIR(0xD5A6EAC2, 0x36252C7B), LIMB_PAIR(0xCAE5DC4C, 0xE218A649), LIMB_PAIR(0xB249829E, 0x690F3B49), LIMB_PAIR(0x6E5A7464, 0x4858D657),
+            LIMB_PAIR(0x33AE77E0, 0x6E4B2CA6), LIMB_PAIR(0x871586AD, 0x28CFD8BA), LIMB_PAIR(0xD63D4D38, 0xAADAABC9), LIMB_PAIR(0x8ACDD480, 0x2EA000E9), LIMB_PARTIAL(0x043),
+            LIMB_PAIR(0xAA905E22, 0xBB0525EE), LIMB_PAIR(0xA045363F, 0xD6AD676E), LIMB_PAIR(0xADBB3A6D, 0xA0ABE10E), LIMB_PAIR(0x49793FAC, 0xBF7D435A),
+            LIMB_PAIR(0xC4DD6260, 0xD96B7452), LIMB_PAIR(0x0AA813F9, 0x4E64C993), LIMB_PAIR(0x001A15EC, 0xAC364502), LIMB_PAIR(0x1AF6493A, 0xC33EFEF7), LIMB_PARTIAL(0x0EE)
+        }
+    },
+#endif
+#if (32 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^32 * G
+            LIMB_PAIR(0x6A3CF15F, 0x9AECAE2D), LIMB_PAIR(0x9C959376, 0xD9D0B49A), LIMB_PAIR(0x57CC7E25, 0x4AAD9454), LIMB_PAIR(0x3876FE58, 0x68361832),
+            LIMB_PAIR(0x2BD9DC24, 0xCCC6F2D8), LIMB_PAIR(0x605BAFBE, 0x3970525C), LIMB_PAIR(0xA2C5499D, 0xF17524ED), LIMB_PAIR(0xB0C7BF4F, 0xE30B69D5), LIMB_PARTIAL(0x05F),
+            LIMB_PAIR(0xB5D073B0, 0xA71532AD), LIMB_PAIR(0xB4FB97B3, 0x37159FB3), LIMB_PAIR(0x7A1FFF6D, 0x15B655B2), LIMB_PAIR(0x9E08A89C, 0x55AC89EE),
+            LIMB_PAIR(0xBC027776, 0x13CFAB6B), LIMB_PAIR(0x9DECE9A9, 0xA57A7F28), LIMB_PAIR(0xC03A1D45, 0x65A3D815), LIMB_PAIR(0x95515DBA, 0xE5CD61EA), LIMB_PARTIAL(0x100)
+        },
+        {   // 2 * 16^32 * G
+            LIMB_PAIR(0xD44E9B1C, 0x64107659), LIMB_PAIR(0x599694F3, 0xDFE2B3ED), LIMB_PAIR(0x55939FEF, 0x348B1634), LIMB_PAIR(0x0B2F8B7A, 0xEB5FB186),
+            LIMB_PAIR(0x5A1469B5, 0x19D2BECF), LIMB_PAIR(0x6BEA8F5A, 0x24C67FF9), LIMB_PAIR(0x5924FDE9, 0x1A4037A8), LIMB_PAIR(0xFE0231AE, 0xDD0E9ACE), LIMB_PARTIAL(0x0F0),
+            LIMB_PAIR(0x37CEE8E6, 0x5B3F06A2), LIMB_PAIR(0x7E4A80A6, 0x3CCC49C6), LIMB_PAIR(0x05B38A1C, 0xE8729CC4), LIMB_PAIR(0x1F4373F1, 0xA5132339),
+            LIMB_PAIR(0xB3A773F0, 0x1DAC8246), LIMB_PAIR(0x0193D5B1, 0x9824B498), LIMB_PAIR(0xC4DB540A, 0xB63E677A), LIMB_PAIR(0x5F10A7C1, 0x9C74537F), LIMB_PARTIAL(0x094)
+        },
+        {   // 3 * 16^32 * G
+            LIMB_PAIR(0x4CE9ABD3, 0x21CBB2C7), LIMB_PAIR(0x45073C39, 0x7F157A48), LIMB_PAIR(0x0DE2380E, 0xBC887F72), LIMB_PAIR(0x6F96A397, 0x295BAD1C),
+            LIMB_PAIR(0x8FF6DAFF, 0x9BB39BE4), LIMB_PAIR(0xD80498E3, 0x65B52767), LIMB_PAIR(0x02B936A0, 0x1B075294), LIMB_PAIR(0xB90EC0FC, 0x04C89F2F), LIMB_PARTIAL(0x0B4),
+            LIMB_PAIR(0xF3BF4B3D, 0x47F62CE6), LIMB_PAIR(0x0E3E0BD4, 0xF7992125), LIMB_PAIR(0xA14A6183, 0xE1555BF8), LIMB_PAIR(0x67F3936C, 0x8169E025),
+            LIMB_PAIR(0x846CE4B0, 0x62DAE8AE), LIMB_PAIR(0xFE0B0558, 0xCEE40B04), LIMB_PAIR(0x8FE270E1, 0x520C3E20), LIMB_PAIR(0xC44DE629, 0xA1F2420E), LIMB_PARTIAL(0x150)
+        },
+        {   // 4 * 16^32 * G
+            LIMB_PAIR(0xBC875BAE, 0xC773FAAC), LIMB_PAIR(0x08DC8719, 0x5AD3CC94), LIMB_PAIR(0x6FD3DBDE, 0x23A9CF66), LIMB_PAIR(0xA4C8D8FE, 0xF9C47B69),
+            LIMB_PAIR(0xFC6D9E13, 0xAEFDCD39), LIMB_PAIR(0x2EF2FFF0, 0x3647F3A9), LIMB_PAIR(0x1F53EE3C, 0x7FBF9D74), LIMB_PAIR(0x85E5A502, 0x9199963D), LIMB_PARTIAL(0x0EF),
+            LIMB_PAIR(0x3AD5B178, 0x19117374), LIMB_PAIR(0xF086FDF5, 0xA5892671), LIMB_PAIR(0xAEABB8B1, 0xA828F5BE), LIMB_PAIR(0x62711D4B, 0xA9C1A33E),
+            LIMB_PAIR(0x01E1DE48, 0xF8A2E9B1), LIMB_PAIR(0x568801DA, 0xE5EB2DE9), LIMB_PAIR(0x5F2F8052, 0x3E0B7A84), LIMB_PAIR(0xDDB76FFA, 0x074D3C36), LIMB_PARTIAL(0x160)
+        },
+        {   // 5 * 16^32 * G
+            LIMB_PAIR(0x4D0A48D1, 0x3CA5AE61), LIMB_PAIR(0x7F021444, 0x39648CEC), LIMB_PAIR(0x1E90C6DD, 0x3C92B252), LIMB_PAIR(0x94A49837, 0x776994BC),
+            LIMB_PAIR(0x7DDBF5B2, 0x53E54C20), LIMB_PAIR(0xD4576141, 0xFAF593C7), LIMB_PAIR(0x26CC7AB2, 0x17E000C2), LIMB_PAIR(0x0BF5318A, 0x9484DE38), LIMB_PARTIAL(0x1C9),
+            LIMB_PAIR(0x97546078, 0x7AA1D4D3), LIMB_PAIR(0xF1E5FD32, 0x06B60EE9), LIMB_PAIR(0x8447917D, 0xCE10BDF0), LIMB_PAIR(0x0E3DE8AB, 0x40FD8D61),
+            LIMB_PAIR(0x34E29CC4, 0xA3C917AF), LIMB_PAIR(0x2C27DE76, 0xA7BB1B54), LIMB_PAIR(0x31E6C453, 0x69929799), LIMB_PAIR(0x2F185B22, 0xC668FBE4), LIMB_PARTIAL(0x142)
+        },
+        {   // 6 * 16^32 * G
+            LIMB_PAIR(0xAF0603F0, 0x953B8CA7), LIMB_PAIR(0x7E21E713, 0x4B5ECED7), LIMB_PAIR(0x2864DCA9, 0x427652E1), LIMB_PAIR(0x16CBFBB1, 0x547F5FB5),
+            LIMB_PAIR(0xF75F17F1, 0x6AD85C7E), LIMB_PAIR(0x8222107E, 0x469AF794), LIMB_PAIR(0x9BEF1085, 0x20D4C8E7), LIMB_PAIR(0x152552E6, 0x867D4D0B), LIMB_PARTIAL(0x142),
+            LIMB_PAIR(0xF3F26574, 0xBB5FFB0C), LIMB_PAIR(0x15CD38C0, 0x047C1BC0), LIMB_PAIR(0x76F8E575, 0x76C5DBF1), LIMB_PAIR(0x20D33C17, 0xF7EB7B0E),
+            LIMB_PAIR(0x6D879E9E, 0x1E9CC21E), LIMB_PAIR(0x40CA3223, 0xEB2EDC83), LIMB_PAIR(0x290D165F, 0xB0AA90A8), LIMB_PAIR(0x23C1EF71, 0x7C17D3B2), LIMB_PARTIAL(0x055)
+        },
+        {   // 7 * 16^32 * G
+            LIMB_PAIR(0xC1E4A87C, 0x80FD3DD3), LIMB_PAIR(0xE63E847B, 0xF2230946), LIMB_PAIR(0x477178B7, 0x9D51E3A3), LIMB_PAIR(0x60B2E4DE, 0x06B089A4),
+            LIMB_PAIR(0x53CCD5F0, 0xF98E4CDC), LIMB_PAIR(0xE9E18AEC, 0xFABA504A), LIMB_PAIR(0x34DBA1CA, 0x22B799BE), LIMB_PAIR(0xA4C9CA6E, 0x75409D50), LIMB_PARTIAL(0x0F9),
+            LIMB_PAIR(0x617902E1, 0xEC619962), LIMB_PAIR(0x4C58C299, 0xED26BE73), LIMB_PAIR(0x6D1C30E8, 0x083E94E4), LIMB_PAIR(0x8BE269BD, 0x2C8F7115),
+            LIMB_PAIR(0xE0FED762, 0xF7C13EA9), LIMB_PAIR(0xB517E55B, 0xB6C9BEA0), LIMB_PAIR(0xAEB4BEC0, 0x7D656933), LIMB_PAIR(0xCA01BF37, 0xF386FED9), LIMB_PARTIAL(0x07D)
+        },
+        {   // 8 * 16^32 * G
+            LIMB_PAIR(0x66FD07CA, 0x1036EB9B), LIMB_PAIR(0x6B7FB490, 0x6CA52CC1), LIMB_PAIR(0xD3E0C270, 0x512E973E), LIMB_PAIR(0x73D92D11, 0x889980BF),
+            LIMB_PAIR(0xA4005EEA, 0x38B4CFE4), LIMB_PAIR(0x8CEB4313, 0xB6F992CC), LIMB_PAIR(0x6DAF7C23, 0xD0AC2F8D), LIMB_PAIR(0xE32A93CB, 0x1CCFBF17), LIMB_PARTIAL(0x0C2),
+            LIMB_PAIR(0x2F508CCA, 0x7BD9D6F1), LIMB_PAIR(0x595A72AF, 0xE82D7171), LIMB_PAIR(0x97512873, 0x25D02976), LIMB_PAIR(0x8CF39FBC, 0xEFC1DE8B),
+            LIMB_PAIR(0x9A1237F4, 0x25E6B77F), LIMB_PAIR(0xD4D98B5D, 0x9F3B73E7), LIMB_PAIR(0xECCB07FE, 0xE1FDA62B), LIMB_PAIR(0x625350CF, 0xDB813B03), LIMB_PARTIAL(0x014)
+        }
+    },
+#endif
+#if (33 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^33 * G
+            LIMB_PAIR(0xDF9314E0, 0x904F2D4B), LIMB_PAIR(0xE7A00AAC, 0xDAAE850D), LIMB_PAIR(0x582EFB03, 0x79231083), LIMB_PAIR(0xEC7FE6D2, 0x80F1C283),
+            LIMB_PAIR(0x199D74A8, 0x2D5B3996), LIMB_PAIR(0x395007E7, 0x5F120B9B), LIMB_PAIR(0x4773F03E, 0x30D23773), LIMB_PAIR(0x3B78B686, 0xF4C19273), LIMB_PARTIAL(0x121),
+            LIMB_PAIR(0xFA8B51F0, 0xF103FF6D), LIMB_PAIR(0x40E2BDF0, 0xAE7AFB51), LIMB_PAIR(0x83254171, 0x1130380E), LIMB_PAIR(0xCDA10D95, 0xE83501B8),
+            LIMB_PAIR(0x4F3A8C01, 0x1057771E), LIMB_PAIR(0xAC807069, 0x8F52196A), LIMB_PAIR(0xA5623821, 0x3609B0AA), LIMB_PAIR(0x94A0A7F1, 0x8C257906), LIMB_PARTIAL(0x1DB)
+        },
+        {   // 2 * 16^33 * G
+            LIMB_PAIR(0xCB0284F6, 0xE2445C75), LIMB_PAIR(0xF0D3B65C, 0x7266ED21), LIMB_PAIR(0x9C0CD13A, 0xA6F7FB63), LIMB_PAIR(0x37FEE05A, 0x68D77E35),
+            LIMB_PAIR(0xDD708C8E, 0x1D21EA95), LIMB_PAIR(0x93BA8D14, 0xC75F44E7), LIMB_PAIR(0x90E34CA9, 0x8BB1876D), LIMB_PAIR(0xB70E8CB2, 0x7A3621E4), LIMB_PARTIAL(0x0B8),
+            LIMB_PAIR(0xE1D0F420, 0x0FB7C958), LIMB_PAIR(0xFADB2239, 0x34B8BCF2), LIMB_PAIR(0x6A67F72C, 0x1800038B), LIMB_PAIR(0xC19F70A9, 0xA8E3236A),
+            LIMB_PAIR(0xB908C753, 0xA73DD94C), LIMB_PAIR(0xA6FA426F, 0xD7569D95), LIMB_PAIR(0x0A295AE2, 0x5AB784F6), LIMB_PAIR(0x583F0F13, 0xDC2BD296), LIMB_PARTIAL(0x039)
+        },
+        {   // 3 * 16^33 * G
+            LIMB_PAIR(0x96CECD8D, 0x361DF1A4), LIMB_PAIR(0x120E0DA6, 0x46A52D2B), LIMB_PAIR(0x18A399C7, 0xDAEC3192), LIMB_PAIR(0xFE750171, 0xE7D7E2F9),
+            LIMB_PAIR(0xE7638892, 0x2538D1A8), LIMB_PAIR(0x0A4BC874, 0x6D93E213), LIMB_PAIR(0xE8063EA0, 0xABD52586), LIMB_PAIR(0xCC23A672, 0x160DA4EF), LIMB_PARTIAL(0x16F),
+            LIMB_PAIR(0xBBE499E8, 0x3FB480C9), LIMB_PAIR(0xB6A4AD3C, 0x458ABCE1), LIMB_PAIR(0x280A60BD, 0x852F59F1), LIMB_PAIR(0x9EB3ABE2, 0xDD52DC06),
+            LIMB_PAIR(0x11066348, 0x88C45485), LIMB_PAIR(0x55A268FB, 0x0EE83420), LIMB_PAIR(0x114A29C0, 0x71D8F9FD), LIMB_PAIR(0x8DC08C3B, 0x70C5338E), LIMB_PARTIAL(0x1BC)
+        },
+        {   // 4 * 16^33 * G
+            LIMB_PAIR(0x58603A1E, 0x46243996), LIMB_PAIR(0x6310788D, 0xF6BF5449), LIMB_PAIR(0x4C799CC9, 0x17812086), LIMB_PAIR(0x3F9C7982, 0x20A0D4E6),
+            LIMB_PAIR(0x930D81CA, 0x13340A26), LIMB_PAIR(0x61520FA5, 0xB2486754), LIMB_PAIR(0xE3E2CBB0, 0x0E9480CC), LIMB_PAIR(0xC61DD54A, 0x11F633C1), LIMB_PARTIAL(0x08E),
+            LIMB_PAIR(0x07EF7A73, 0x34510E9E), LIMB_PAIR(0x0E00A9DB, 0x242EA695), LIMB_PAIR(0x0EAD5B7A, 0x1A146EA2), LIMB_PAIR(0xF54A3534, 0x52C0A70B),
+            LIMB_PAIR(0xB8113E6A, 0x4B85DBBE), LIMB_PAIR(0x1446FC2B, 0x62DF7426), LIMB_PAIR(0xE9FE597A, 0x3A79C26E), LIMB_PAIR(0xA7AFDC59, 0x6327CECD), LIMB_PARTIAL(0x0C7)
+        },
+        {   // 5 * 16^33 * G
+            LIMB_PAIR(0x2184BB7D, 0xCE0CAFC1), LIMB_PAIR(0x8C843303, 0x15335849), LIMB_PAIR(0xE6F4B4BA, 0x18EC18BB), LIMB_PAIR(0xF08A6FF9, 0x9A34A7C6),
+            LIMB_PAIR(0xBFC0DEA8, 0x7FFE87BB), LIMB_PAIR(0x689307B2, 0x77019C95), LIMB_PAIR(0x8122B505, 0x80678743), LIMB_PAIR(0x034C8D8E, 0xF71A3CCA), LIMB_PARTIAL(0x076),
+            LIMB_PAIR(0x26774BBC, 0x07426E57), LIMB_PAIR(0xC9A22D42, 0x046829D4), LIMB_PAIR(0x6DBE5A7B, 0xF437F066), LIMB_PAIR(0x4068C336, 0xD582CABA),
+            LIMB_PAIR(0xA43F362D, 0x9135DDBA), LIMB_PAIR(0x1B30E4B2, 0x68C6CDB3), LIMB_PAIR(0xC21D15D2, 0x42B97D48), LIMB_PAIR(0x845DFAF6, 0xD7571F38), LIMB_PARTIAL(0x012)
+        },
+        {   // 6 * 16^33 * G
+            LIMB_PAIR(0x1C403388, 0x8BF9E079), LIMB_PAIR(0x046F9ECA, 0x219A3154), LIMB_PAIR(0xCEC86E4A, 0x3A8EE73B), LIMB_PAIR(0x281F2E27, 0x0A31124E),
+            LIMB_PAIR(0x16BC3255, 0x6A6FB937), LIMB_PAIR(0x8AE63821, 0x0706364A), LIMB_PAIR(0x323D4B3A, 0xCCE86C65), LIMB_PAIR(0xFD6CFBD4, 0x0C238449), LIMB_PARTIAL(0x174),
+            LIMB_PAIR(0x7FAA8A49, 0x031202DE), LIMB_PAIR(0x579D75FB, 0x97B770B2), LIMB_PAIR(0xA5E0D986, 0x5CF4413E), LIMB_PAIR(0xCC936D96, 0xE93B56FD),
+            LIMB_PAIR(0xB1C5576A, 0xE4EC80D2), LIMB_PAIR(0xDA093BF5, 0xBF8972A2), LIMB_PAIR(0xBCBEFD15, 0x0C5A98BD), LIMB_PAIR(0x0E6F9D2E, 0xA19B3E63), LIMB_PARTIAL(0x131)
+        },
+        {   // 7 * 16^33 * G
+            LIMB_PAIR(0xF52BBD0E, 0x5255A6B2), LIMB_PAIR(0x3A427AA5, 0x25BC9A30), LIMB_PAIR(0xC05B4E39, 0x0672CF27), LIMB_PAIR(0xE1C1BA70, 0x0EC3E665),
+            LIMB_PAIR(0x076E1D79, 0x4EB83C1B), LIMB_PAIR(0xEE0A4FEB, 0xC639E919), LIMB_PAIR(0x9D705FC7, 0xE208FED5), LIMB_PAIR(0x672534AD, 0x84877C1A), LIMB_PARTIAL(0x1F6),
+            LIMB_PAIR(0x22D3E4CF, 0x7618E18F), LIMB_PAIR(0x8B6B1A53, 0x6A6747A6), LIMB_PAIR(0xAD83B5D8, 0x2766D2CC), LIMB_PAIR(0xBE7C22B2, 0x304194B0),
+            LIMB_PAIR(0x0C76BAF3, 0x3AC468E7), LIMB_PAIR(0x72A552A9, 0xAF0247C5), LIMB_PAIR(0x23E444F3, 0xB19FA902), LIMB_PAIR(0xFCEFCD95, 0xC854C7AD), LIMB_PARTIAL(0x0B9)
+        },
+        {   // 8 * 16^33 * G
+            LIMB_PAIR(0x8201C48B, 0x0F73C85A), LIMB_PAIR(0x4C9CAEE3, 0xEF502F8A), LIMB_PAIR(0x41D84048, 0x8DF76996), LIMB_PAIR(0xBA0F3B82, 0x93F8A34B),
+            LIMB_PAIR(0xD6A81ED8, 0x0FBA696C), LIMB_PAIR(0x96622944, 0x0BE6C831), LIMB_PAIR(0x085495F9, 0x0DE9A8F2), LIMB_PAIR(0x580B2551, 0x12D843E6), LIMB_PARTIAL(0x10E),
+            LIMB_PAIR(0xE51DE678, 0x507820FB), LIMB_PAIR(0x17831A13, 0xE404CD93), LIMB_PAIR(0x721196C2, 0x4818C9D1), LIMB_PAIR(0xCDDA697F, 0xEFA01A64),
+            LIMB_PAIR(0xBAB8B58B, 0xDCCD32F0), LIMB_PAIR(0xB4A19BDA, 0x51AC6E1F), LIMB_PAIR(0x4E25340A, 0xD402693F), LIMB_PAIR(0xAFBBEC44, 0xD6567590), LIMB_PARTIAL(0x18A)
+        }
+    },
+#endif
+#if (34 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^34 * G
+            LIMB_PAIR(0x6E4A010A, 0x714C9D4D), LIMB_PAIR(0x98BBDD05, 0x9E8621EB), LIMB_PAIR(0xEFC60F48, 0xF3F33305), LIMB_PAIR(0x0706C352, 0x4E392A4C),
+            LIMB_PAIR(0x94DCFC6C, 0x5D0F7B3A), LIMB_PAIR(0x2434D058, 0x28C34306), LIMB_PAIR(0x41885900, 0xDBA377BB), LIMB_PAIR(0xAD73DF88, 0x0ED4082D), LIMB_PARTIAL(0x12A),
+            LIMB_PAIR(0xFCDADFEB, 0xC0899758), LIMB_PAIR(0x54319374, 0x1638C314), LIMB_PAIR(0xC8AE469C, 0x1831028E), LIMB_PAIR(0x3A0E36A7, 0x41093FFE),
+            LIMB_PAIR(0x2860701A, 0x75C6667B), LIMB_PAIR(0x64DE0A06, 0x38C843A2), LIMB_PAIR(0x949389D1, 0xC6E2C8A0), LIMB_PAIR(0x3A1CC818, 0x754F22B7), LIMB_PARTIAL(0x1FE)
+        },
+        {   // 2 * 16^34 * G
+            LIMB_PAIR(0x4A0C0913, 0x58821C97), LIMB_PAIR(0x307795F2, 0xB7707006), LIMB_PAIR(0xEA20C664, 0x44F5F5BC), LIMB_PAIR(0x9C5EC494, 0xC23F5AC3),
+            LIMB_PAIR(0x80AFFD1A, 0xE83E4FC3), LIMB_PAIR(0x50102AC6, 0x7E92884D), LIMB_PAIR(0xA3C31198, 0x632405B8), LIMB_PAIR(0x453CC03F, 0x1995F831), LIMB_PARTIAL(0x09F),
+            LIMB_PAIR(0x21E50847, 0x80190717), LIMB_PAIR(0x91F3EFD5, 0x794B63D9), LIMB_PAIR(0xA95C778C, 0xE9D69357), LIMB_PAIR(0xD04A14C3, 0xBD298EB0),
+            LIMB_PAIR(0x4C5CB3BC, 0x40A10515), LIMB_PAIR(0xF9C2FA5C, 0x296FD944), LIMB_PAIR(0xEFB9A49B, 0xFEE5FE79), LIMB_PAIR(0x5BA9DB09, 0x12E8D7B3), LIMB_PARTIAL(0x1D7)
+        },
+        {   // 3 * 16^34 * G
+            LIMB_PAIR(0x79D6593D, 0x17110392), LIMB_PAIR(0xD6D1E388, 0x7D88866E), LIMB_PAIR(0xC9A20E92, 0x27E0AA5F), LIMB_PAIR(0xB781BC4C, 0xC82EF455),
+            LIMB_PAIR(0xA1E9A984, 0x36888AD0), LIMB_PAIR(0x962EB333, 0xA51D1804), LIMB_PAIR(0x6589216A, 0x3964BF4A), LIMB_PAIR(0x7529C9FD, 0x88904FFA), LIMB_PARTIAL(0x16B),
+            LIMB_PAIR(0xE59081D4, 0x9E0ACA53), LIMB_PAIR(0x09C4315C, 0x8B9066C0), LIMB_PAIR(0x44DAFB2E, 0x51D18E8B), LIMB_PAIR(0x3C757835, 0xA86CD85C),
+            LIMB_PAIR(0xED8B25E4, 0x7534CBA2), LIMB_PAIR(0xE59C5EBB, 0xE1DB4AEB), LIMB_PAIR(0x72024396, 0x77AF93DE), LIMB_PAIR(0x77F5A9BE, 0x0779F6AF), LIMB_PARTIAL(0x090)
+        },
+        {   // 4 * 16^34 * G
+            LIMB_PAIR(0xE0B8B7C6, 0x0D200089), LIMB_PAIR(0xE0C3A66C, 0xFA7C2A74), LIMB_PAIR(0x46E3E5CF, 0x47465DB0), LIMB_PAIR(0x8537BB62, 0x2BD1DD81),
+            LIMB_PAIR(0x7165A234, 0x748D7012), LIMB_PAIR(0x5C718337, 0x4D373745), LIMB_PAIR(0x189CE8CD, 0x40C0F48E), LIMB_PAIR(0xA2F751CF, 0xD018CE08), LIMB_PARTIAL(0x14B),
+            LIMB_PAIR(0x7AC22C09, 0x5513201A), LIMB_PAIR(0xA1CD3533, 0xF559E050), LIMB_PAIR(0xBD4031D0, 0x6E1EBA1E), LIMB_PAIR(0x532B1D53, 0xBFD8A1CC),
+            LIMB_PAIR(0x5A15B193, 0x3FDEE4CF), LIMB_PAIR(0x789BB143, 0x226693F7), LIMB_PAIR(0xDEE75E9D, 0xA0D4DC89), LIMB_PAIR(0xF09A0C6C, 0x438D3544), LIMB_PARTIAL(0x189)
+        },
+        {   // 5 * 16^34 * G
+            LIMB_PAIR(0x640E6A08, 0xF9573F8D), LIMB_PAIR(0x1138E3E6, 0xAE4874B3), LIMB_PAIR(0xDA7C7652, 0x9DE063DC), LIMB_PAIR(0x5C5E679A, 0x3F4F2590),
+            LIMB_PAIR(0x6355457C, 0xBF26D528), LIMB_PAIR(0x2FBDC5AB, 0x071B6EB1), LIMB_PAIR(0xB8344ED2, 0x66F75278), LIMB_PAIR(0x52898292, 0xFCAE83AC), LIMB_PARTIAL(0x14C),
+            LIMB_PAIR(0xC652CBB5, 0x13B69D24), LIMB_PAIR(0x120253A9, 0x072F96E6), LIMB_PAIR(0x64985F28, 0xE8F88C75), LIMB_PAIR(0x089A1E10, 0xC7EAFD4F),
+            LIMB_PAIR(0x9562B680, 0x6D4D0FBC), LIMB_PAIR(0xB91B73BF, 0x6E4E5AF7), LIMB_PAIR(0x07278B89, 0x253F58CE), LIMB_PAIR(0xE8A56798, 0x1DF25657), LIMB_PARTIAL(0x1FC)
+        },
+        {   // 6 * 16^34 * G
+            LIMB_PAIR(0xC353A269, 0x6DF6776B), LIMB_PAIR(0xDACE9809, 0x0D232F2D), LIMB_PAIR(0x03D5D78B, 0x7649E044), LIMB_PAIR(0xFC283D82, 0x59710087),
+            LIMB_PAIR(0xE2EE05AB, 0x86D65EEE), LIMB_PAIR(0x27851D69, 0x3D1FC3F2), LIMB_PAIR(0x1781977B, 0x3B86ED77), LIMB_PAIR(0x1AC0290E, 0x4D4A61BE), LIMB_PARTIAL(0x161),
+            LIMB_PAIR(0xC5400967, 0x2DEAC320), LIMB_PAIR(0x7381541B, 0x02694909), LIMB_PAIR(0x9CD429A7, 0xD373BA70), LIMB_PAIR(0x928B72C5, 0x547F0E86),
+            LIMB_PAIR(0x223AB61A, 0xB1C2F84C), LIMB_PAIR(0x1115F60A, 0x06C03994), LIMB_PAIR(0x82136CFD, 0x6E5B0CBE), LIMB_PAIR(0x489D7DE6, 0x08E4A467), LIMB_PARTIAL(0x0C6)
+        },
+        {   // 7 * 16^34 * G
+            LIMB_PAIR(0x700CD193, 0x06FEC2DF), LIMB_PAIR(0x002863A6, 0xF077AFEE), LIMB_PAIR(0x6CF0C0C2, 0xB60894FD), LIMB_PAIR(0xF8B7C551, 0xC7D01CD0),
+            LIMB_PAIR(0xC33C337A, 0x7ADB74E4), LIMB_PAIR(0xA8867AF3, 0xB4B5767E), LIMB_PAIR(0x2F3D57A7, 0xBDB10AA6), LIMB_PAIR(0xB1FF9D7D, 0x80D5AC5E), LIMB_PARTIAL(0x116),
+            LIMB_PAIR(0x91867318, 0x0E0DF41C), LIMB_PAIR(0x1912BED5, 0xE3CBB1AE), LIMB_PAIR(0xC15465BD, 0x006DCEE9), LIMB_PAIR(0x352746C5, 0xF4768566),
+            LIMB_PAIR(0x767E554D, 0x567E2BCF), LIMB_PAIR(0xCFC14923, 0xA4EDDFAC), LIMB_PAIR(0x5E096C3A, 0x5C661C2E), LIMB_PAIR(0x8123FB58, 0x5B13488D), LIMB_PARTIAL(0x045)
+        },
+        {   // 8 * 16^34 * G
+            LIMB_PAIR(0xA084D91A, 0xAE917A54), LIMB_PAIR(0x8A3AE45F, 0x4A1095A8), LIMB_PAIR(0xA30EE909, 0xB7A358FA), LIMB_PAIR(0x5AEE3272, 0x807ACA83),
+            LIMB_PAIR(0x681D54BB, 0x58D144A9), LIMB_PAIR(0x3352C5E8, 0x36569B8D), LIMB_PAIR(0xE5D9BA90, 0x75B7E2F1), LIMB_PAIR(0x08068BB3, 0x348C70DA), LIMB_PARTIAL(0x1D8),
+            LIMB_PAIR(0x309376D1, 0xC2BCA2F5), LIMB_PAIR(0x457D23D0, 0x87CA2CB0), LIMB_PAIR(0xACF94FC7, 0x7DCCF53D), LIMB_PAIR(0x71E898BD, 0x0646DEA8),
+            LIMB_PAIR(0xC8BD817E, 0x8A053DF3), LIMB_PAIR(0x5A002253, 0xA9E9C682), LIMB_PAIR(0x75A16C9F, 0xB23C7813), LIMB_PAIR(0x3F81C2BE, 0x2500D5A1), LIMB_PARTIAL(0x043)
+        }
+    },
+#endif
+#if (35 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^35 * G
+            LIMB_PAIR(0xD19906D0, 0x7FACF165), LIMB_PAIR(0xAD92D455, 0xD8E059AF), LIMB_PAIR(0x6EBEC576, 0x7356696F), LIMB_PAIR(0x1D6D311D, 0x67044E55),
+            LIMB_PAIR(0x3A2E50CF, 0xE2BC81DC), LIMB_PAIR(0xC00EA37F, 0x860036DE), LIMB_PAIR(0xFF32D69D, 0x71DFBE61), LIMB_PAIR(0xF502BAFF, 0x298B766B), LIMB_PARTIAL(0x19F),
+            LIMB_PAIR(0x01BB03F8, 0x5E5E1239), LIMB_PAIR(0x5304BA94, 0xD36C3583), LIMB_PAIR(0xB49F6A95, 0x5025F960), LIMB_PAIR(0x75E5B6E3, 0x72DD554F),
+            LIMB_PAIR(0x869C9D17, 0x85BFB398), LIMB_PAIR(0x9CACE4A7, 0xD71CF71F), LIMB_PAIR(0x7291DD9D, 0x0F6FD3AD), LIMB_PAIR(0xD1B5758F, 0x5DA8A689), LIMB_PARTIAL(0x18B)
+        },
+        {   // 2 * 16^35 * G
+            LIMB_PAIR(0xDB567888, 0xABDF1B02), LIMB_PAIR(0x5A14BD4A, 0xF47D5CD1), LIMB_PAIR(0xB56EC127, 0xA3483F68), LIMB_PAIR(0x4E65795A, 0xF0942229),
+            LIMB_PAIR(0x2DE6AE78, 0x225B339B), LIMB_PAIR(0x11792AFD, 0xFBFE7EF0), LIMB_PAIR(0x4548C2A8, 0xF27B31A0), LIMB_PAIR(0xDFBD3BA7, 0xB4821EA3), LIMB_PARTIAL(0x159),
+            LIMB_PAIR(0xA1C887B9, 0xBA06333C), LIMB_PAIR(0x6B243E38, 0xFC6EEF56), LIMB_PAIR(0x596EC79C, 0x345900C3), LIMB_PAIR(0x43E33D8D, 0x243B17AB),
+            LIMB_PAIR(0xA9370DA9, 0xFFA7E30D), LIMB_PAIR(0x0F09347D, 0x3DC587A5), LIMB_PAIR(0x3343A72D, 0x0FD1B246), LIMB_PAIR(0x8372FCF3, 0xE4ACEFB4), LIMB_PARTIAL(0x1D5)
+        },
+        {   // 3 * 16^35 * G
+            LIMB_PAIR(0xAF8C8CCD, 0x99D91691), LIMB_PAIR(0x33764C92, 0x2BE26486), LIMB_PAIR(0x2477AA78, 0xB6E68149), LIMB_PAIR(0xC52D4964, 0x90430FC6),
+            LIMB_PAIR(0x4E1647A5, 0x4CED96C5), LIMB_PAIR(0xC1489674, 0x5B52A279), LIMB_PAIR(0xC26EC42B, 0xAB7F4127), LIMB_PAIR(0xF1097B9B, 0xCD5528FC), LIMB_PARTIAL(0x19A),
+            LIMB_PAIR(0x3A47E5C2, 0x7785ADD6), LIMB_PAIR(0x635CB4AC, 0x9C82FAE9), LIMB_PAIR(0xCED83245, 0xADCB0DE0), LIMB_PAIR(0xCCB91B16, 0xA42230C8),
+            LIMB_PAIR(0x3A3E11A7, 0x6AF43E95), LIMB_PAIR(0xA3145D6B, 0x36288135), LIMB_PAIR(0xE2DED224, 0xB74A3E63), LIMB_PAIR(0x48AAB5A7, 0x15DF0D29), LIMB_PARTIAL(0x1BC)
+        },
+        {   // 4 * 16^35 * G
+            LIMB_PAIR(0xE3E97A29, 0x25455C2A), LIMB_PAIR(0xD3028514, 0xD497AB4F), LIMB_PAIR(0x914AE0C9, 0xEADB13EA), LIMB_PAIR(0x33E0BD85, 0xF9F6A275),
+            LIMB_PAIR(0x53851649, 0x1103BD60), LIMB_PAIR(0xD66C948D, 0x445B182D), LIMB_PAIR(0xEDBECEA9, 0xF74F853B), LIMB_PAIR(0x0D27351C, 0x643DB053), LIMB_PARTIAL(0x082),
+            LIMB_PAIR(0x0FD56CDA, 0xE5CCD117), LIMB_PAIR(0x71495DF1, 0x421562C3), LIMB_PAIR(0xB2D1A036, 0x865B3F9A), LIMB_PAIR(0xD3E4F471, 0xE0407F28),
+            LIMB_PAIR(0xCB7E4C42, 0xA64F74FC), LIMB_PAIR(0x1D1E7BBE, 0xE87E464D), LIMB_PAIR(0xABAD4A1A, 0xCDB9E777), LIMB_PAIR(0xE76DEED0, 0x6E1021D7), LIMB_PARTIAL(0x161)
+        },
+        {   // 5 * 16^35 * G
+            LIMB_PAIR(0xB7F279FC, 0x089FBB85), LIMB_PAIR(0x547A1EFA, 0xB3562A0B), LIMB_PAIR(0x98080868, 0x40A3FA3C), LIMB_PAIR(0x94597F7D, 0x90CE47DD),
+            LIMB_PAIR(0x0C6F4B4B, 0xB3BB2085), LIMB_PAIR(0x5953AB03, 0x8C24EDA7), LIMB_PAIR(0x4EEE13EC, 0xB8B110F0), LIMB_PAIR(0x1BDB3CBF, 0x3ACE7B90), LIMB_PARTIAL(0x1D7),
+            LIMB_PAIR(0x335C7820, 0x33B6B36F), LIMB_PAIR(0x6B2B5992, 0x43EFEEBC), LIMB_PAIR(0x36DED655, 0x3B56649D), LIMB_PAIR(0xA9DD98A3, 0x15419020),
+            LIMB_PAIR(0x63F405AE, 0x08D081B5), LIMB_PAIR(0x2C588C8A, 0x5B1F59D0), LIMB_PAIR(0xFF822E70, 0x745C687E), LIMB_PAIR(0x69EF398C, 0x7AB7B9F1), LIMB_PARTIAL(0x17F)
+        },
+        {   // 6 * 16^35 * G
+            LIMB_PAIR(0x840E5C81, 0x568E60BC), LIMB_PAIR(0x01788F64, 0x12B35CD3), LIMB_PAIR(0x123E9018, 0x70422FA0), LIMB_PAIR(0xD9CDBE2E, 0x6CEABFCE),
+            LIMB_PAIR(0x7626E2DF, 0x67032A10), LIMB_PAIR(0xD250EF1C, 0x0888CA79), LIMB_PAIR(0xD5BA46AF, 0xCA1FA245), LIMB_PAIR(0x2F6BE510, 0x590F2997), LIMB_PARTIAL(0x1D1),
+            LIMB_PAIR(0xF2A02370, 0xBD6DD880), LIMB_PAIR(0x20D42C5E, 0x3AE5F4AC), LIMB_PAIR(0x6C08E487, 0xD2B300F4), LIMB_PAIR(0x896BDB34, 0x662BE2EF),
+            LIMB_PAIR(0x07011F7A, 0xE7632D9B), LIMB_PAIR(0xE7E83B8E, 0x9481B843), LIMB_PAIR(0xA30C0FB9, 0xEB7E2084), LIMB_PAIR(0xA71241B2, 0x53E59ADF), LIMB_PARTIAL(0x0CB)
+        },
+        {   // 7 * 16^35 * G
+            LIMB_PAIR(0xC2911AEC, 0x49D93794), LIMB_PAIR(0xA810C993, 0x586554F1), LIMB_PAIR(0xF2322411, 0x867B77A3), LIMB_PAIR(0xC2E4CBC5, 0x6083B099),
+            LIMB_PAIR(0x7CBD094D, 0x0445ED8E), LIMB_PAIR(0xE0FEAA26, 0x417BA195), LIMB_PAIR(0xC178ED78, 0x432B645F), LIMB_PAIR(0xC9948690, 0x429282DF), LIMB_PARTIAL(0x10F),
+            LIMB_PAIR(0xADDC286F, 0x3045657B), LIMB_PAIR(0x863FA4C0, 0x10F36372), LIMB_PAIR(0xDCA96FE2, 0xAB804FD7), LIMB_PAIR(0x18C34D71, 0x6B0A12A6),
+            LIMB_PAIR(0x2A7C0EA4, 0xBAE3DC77), LIMB_PAIR(0xABC48F80, 0x241E63A0), LIMB_PAIR(0xEF1843F8, 0x34EFEAA3), LIMB_PAIR(0x8498816E, 0x321D171A), LIMB_PARTIAL(0x1C1)
+        },
+        {   // 8 * 16^35 * G
+            LIMB_PAIR(0xB9B07FB9, 0x26E479F9), LIMB_PAIR(0xC03B5ADE, 0xF8E49CDF), LIMB_PAIR(0xD525E891, 0xA0D66A21), LIMB_PAIR(0x9A62E3D2, 0x8A062D75),
+            LIMB_PAIR(0x38704C65, 0x4B025CB7), LIMB_PAIR(0xD440836A, 0x2B7A6B60), LIMB_PAIR(0xA3CA3AC1, 0x3E55FE53), LIMB_PAIR(0xF1031F19, 0x59577407), LIMB_PARTIAL(0x128),
+            LIMB_PAIR(0x2B4EDFEB, 0xA5BB1EB0), LIMB_PAIR(0x4DCFD68C, 0xAEE5A217), LIMB_PAIR(0xA19F4F45, 0x582146CF), LIMB_PAIR(0x69F7C258, 0x44811522),
+            LIMB_PAIR(0x7F9333C2, 0x72D7CE9A), LIMB_PAIR(0xB1DAE530, 0xE6C88FE2), LIMB_PAIR(0x88B50DE2, 0x1367CE5C), LIMB_PAIR(0x7150206B, 0x10367DAC), LIMB_PARTIAL(0x1A1)
+        }
+    },
+#endif
+#if (36 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^36 * G
+            LIMB_PAIR(0xC4D6AB08, 0x69CAD3CC), LIMB_PAIR(0x3B8990B8, 0x3ADB5777), LIMB_PAIR(0x8D958801, 0xD0CAD8CE), LIMB_PAIR(0x6D728F9E, 0xCB572E66),
+            LIMB_PAIR(0xCD5131FC, 0xE3D9E7C4), LIMB_PAIR(0x6145DC06, 0xAFCEB6B0), LIMB_PAIR(0xE213043A, 0x12ECD392), LIMB_PAIR(0x3A64C87C, 0xBD599294), LIMB_PARTIAL(0x00B),
+            LIMB_PAIR(0xF6EA9CF1, 0x8623BDBB), LIMB_PAIR(0x547AA650, 0x3AAD9495), LIMB_PAIR(0xBEB27159, 0xD3D853FC), LIMB_PAIR(0x30B40833, 0x3D25A648),
+            LIMB_PAIR(0xDEC51BD1, 0x12D188E8), LIMB_PAIR(0xB348C3FA, 0x836330D2), LIMB_PAIR(0x73C2EA59, 0x9DF50CFE), LIMB_PAIR(0x61DED0B8, 0xB5DFFB20), LIMB_PARTIAL(0x18A)
+        },
+        {   // 2 * 16^36 * G
+            LIMB_PAIR(0x0C62942A, 0xE843D035), LIMB_PAIR(0xD8920CD4, 0xEB792FC5), LIMB_PAIR(0x90BE6FD2, 0x3FA4154E), LIMB_PAIR(0xCE2557AB, 0x002631CB),
+            LIMB_PAIR(0x226742B6, 0xB37B952A), LIMB_PAIR(0xFEAFDC24, 0xA7658C0A), LIMB_PAIR(0xB5A09597, 0x62A7DE67), LIMB_PAIR(0x9BB3CFDE, 0x25074F6A), LIMB_PARTIAL(0x15E),
+            LIMB_PAIR(0xD03CF65D, 0xE6DB0F49), LIMB_PAIR(0x0347DFF1, 0x1187C8B4), LIMB_PAIR(0x6E4CE605, 0xDEA41116), LIMB_PAIR(0x22313708, 0xAC0CA353),
+            LIMB_PAIR(0xB6A5CADE, 0x395DDEE3), LIMB_PAIR(0xC6D80C86, 0xF31ABCB1), LIMB_PAIR(0xA07F0747, 0x013371B1), LIMB_PAIR(0x8F55B804, 0xF5423189), LIMB_PARTIAL(0x14D)
+        },
+        {   // 3 * 16^36 * G
+            LIMB_PAIR(0x18A82CCD, 0x6B8F8304), LIMB_PAIR(0x1B132B2C, 0xC3C56001), LIMB_PAIR(0x8DED65A4, 0xAFB9250D), LIMB_PAIR(0x945B6410, 0x921B4635),
+            LIMB_PAIR(0x9F168610, 0x100306BD), LIMB_PAIR(0x66EDAB88, 0xDAE04ED3), LIMB_PAIR(0xD86B2664, 0x4EDAB84E), LIMB_PAIR(0xC815C6B2, 0xDEDAA28C), LIMB_PARTIAL(0x142),
+            LIMB_PAIR(0x7B7161C2, 0xDB8265F1), LIMB_PAIR(0x8F11558C, 0xF022683F), LIMB_PAIR(0xCF5FE6EF, 0xB8859F1F), LIMB_PAIR(0xAD90BE7E, 0x7419ABD8),
+            LIMB_PAIR(0x24AA372C, 0x8289C33F), LIMB_PAIR(0x7C9D3BE5, 0x3871CB40), LIMB_PAIR(0xB3034315, 0x55402906), LIMB_PAIR(0xA7E70821, 0xAE557332), LIMB_PARTIAL(0x014)
+        },
+        {   // 4 * 16^36 * G
+            LIMB_PAIR(0x40817AA5, 0x42458CFC), LIMB_PAIR(0x560CC12B, 0x96F15F13), LIMB_PAIR(0x4400B1E3, 0xF96EA203), LIMB_PAIR(0x6EBC6B8E, 0x266C2A62),
+            LIMB_PAIR(0x2B374CBC, 0x98EBD5D4), LIMB_PAIR(0x97F946A4, 0x15C1F4FD), LIMB_PAIR(0x33A07357, 0x759238AE), LIMB_PAIR(0x2E3338C4, 0x6DE75CFE), LIMB_PARTIAL(0x0AC),
+            LIMB_PAIR(0xA1D6BAD6, 0xF73DFD08), LIMB_PAIR(0x72566188, 0x32228F5F), LIMB_PAIR(0x0497DD53, 0xEA587FED), LIMB_PAIR(0x2C1673C2, 0xAD4C4A56),
+            LIMB_PAIR(0xADE968FF, 0x8C8DCEC4), LIMB_PAIR(0xDEF7FEAE, 0x77BF520E), LIMB_PAIR(0x7E6A19CB, 0x856BB798), LIMB_PAIR(0xB7FB508C, 0xC289274D), LIMB_PARTIAL(0x050)
+        },
+        {   // 5 * 16^36 * G
+            LIMB_PAIR(0xCA0544A7, 0xBAA18E98), LIMB_PAIR(0xED60926D, 0x1FA840A3), LIMB_PAIR(0xF583BF44, 0xC901285B), LIMB_PAIR(0x2F2744DD, 0x1E658554),
+            LIMB_PAIR(0x033574B7, 0x7D1F3FAB), LIMB_PAIR(0x5D34D187, 0x29BF8B27), LIMB_PAIR(0x013F2B8A, 0x02018A3B), LIMB_PAIR(0x7D0B0654, 0x7C0D108F), LIMB_PARTIAL(0x1D6),
+            LIMB_PAIR(0xDBB51651, 0x56E335F2), LIMB_PAIR(0x0CA2BFD0, 0xB0FAA53C), LIMB_PAIR(0xA9CF1059, 0x519B0979), LIMB_PAIR(0x82E7A7E9, 0x5073CBC9),
+            LIMB_PAIR(0x9C56804B, 0x59D59D16), LIMB_PAIR(0x6F1FDA98, 0x8AA44138), LIMB_PAIR(0x71430784, 0xB59516A7), LIMB_PAIR(0x5EE4C065, 0x7E4742E7), LIMB_PARTIAL(0x013)
+        },
+        {   // 6 * 16^36 * G
+            LIMB_PAIR(0xE32413F4, 0xFCB62E6E), LIMB_PAIR(0x91774519, 0x50F16401), LIMB_PAIR(0x40A47E38, 0x0663934C), LIMB_PAIR(0x0875802E, 0xB076A14B),
+            LIMB_PAIR(0x0226B719, 0x8E263A07), LIMB_PAIR(0x876EBD60, 0x56A9874C), LIMB_PAIR(0xDE28C9A5, 0xDA1C858B), LIMB_PAIR(0x5D0FE6C5, 0x5D2DFC54), LIMB_PARTIAL(0x087),
+            LIMB_PAIR(0xF0C26523, 0x0B8814F1), LIMB_PAIR(0xBEFC1AF0, 0x50C49512), LIMB_PAIR(0xC96A9945, 0xF350E279), LIMB_PAIR(0x19BC1CCA, 0x4DC59836),
+            LIMB_PAIR(0xEFBE83AC, 0xA3278CC6), LIMB_PAIR(0xC8A9BC08, 0x7946939A), LIMB_PAIR(0x13B63E38, 0x8F614292), LIMB_PAIR(0x853B2360, 0x83EEB455), LIMB_PARTIAL(0x0EC)
+        },
+        {   // 7 * 16^36 * G
+            LIMB_PAIR(0x8D439A2A, 0x956E5BAB), LIMB_PAIR(0x45CDAA3E, 0x70731E9D), LIMB_PAIR(0x57720254, 0x3E13BF09), LIMB_PAIR(0x97E84B98, 0x87759C0C),
+            LIMB_PAIR(0x5D558933, 0x73E76343), LIMB_PAIR(0x1C8E0B0D, 0x63981174), LIMB_PAIR(0x4D59454F, 0xBCFCB1C0), LIMB_PAIR(0xC266E0C9, 0x230D81F0), LIMB_PARTIAL(0x185),
+            LIMB_PAIR(0xBD01132F, 0x21F9D779), LIMB_PAIR(0xB24D193A, 0xF2FEC285), LIMB_PAIR(0x23E6C8D7, 0x248513EC), LIMB_PAIR(0x50EF338C, 0xCA611EBF),
+            LIMB_PAIR(0x21E42C9E, 0x8276397C), LIMB_PAIR(0x9F6E2FED, 0x0A88DB63), LIMB_PAIR(0x42F1FA0E, 0x54547994), LIMB_PAIR(0xC6CA6F09, 0x3DA19301), LIMB_PARTIAL(0x1DC)
+        },
+        {   // 8 * 16^36 * G
+            LIMB_PAIR(0xDE6BAFE8, 0x2491A894), LIMB_PAIR(0xEE9EB4C2, 0x8AA13AC5), LIMB_PAIR(0x31B2D1FE, 0x1623B9DF), LIMB_PAIR(0x1A5B21EF, 0x1FB69CA8),
+            LIMB_PAIR(0x290D231C, 0x722F1BE3), LIMB_PAIR(0xB93891F0, 0x8D2A56EE), LIMB_PAIR(0x48A2DC2A, 0xB534845B), LIMB_PAIR(0x3E2A9160, 0xE4FADAFC), LIMB_PARTIAL(0x0CA),
+            LIMB_PAIR(0x810034B4, 0x7F9D50B8), LIMB_PAIR(0xE8703F93, 0xFEBDA319), LIMB_PAIR(0x44CAA3D9, 0xECAE1008), LIMB_PAIR(0xBB5E0DC6, 0x21767275),
+            LIMB_PAIR(0xAC64FB7E, 0x529817CD), LIMB_PAIR(0x31B97B4F, 0x984CB5BD), LIMB_PAIR(0x8BA3A593, 0x33000D28), LIMB_PAIR(0x9003A472, 0x950B9C14), LIMB_PARTIAL(0x039)
+        }
+    },
+#endif
+#if (37 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^37 * G
+            LIMB_PAIR(0xA1DA3C44, 0x5E94C2A2), LIMB_PAIR(0x6C05A3E2, 0x90D95091), LIMB_PAIR(0x74871EB1, 0xB29B791E), LIMB_PAIR(0x50C2D855, 0xE82A41FA),
+            LIMB_PAIR(0x1E689F42, 0xD2D24DF9), LIMB_PAIR(0x0CF6ED2F, 0xE9E93545), LIMB_PAIR(0xC6ED3E7E, 0x5FC9D992), LIMB_PAIR(0x3606713D, 0xB4EB7DF0), LIMB_PARTIAL(0x04D),
+            LIMB_PAIR(0x2099171A, 0x248FD9D7), LIMB_PAIR(0x1D16D66C, 0x908D539E), LIMB_PAIR(0x171BFD3B, 0xAB47B9EB), LIMB_PAIR(0xECDD8E37, 0x70E5DE8C),
+            LIMB_PAIR(0x51EED557, 0xEDD44AE0), LIMB_PAIR(0xAD95AEB2, 0x4983C6FA), LIMB_PAIR(0xCDC8214F, 0xDEDBFEA1), LIMB_PAIR(0x131549B3, 0xC6AE2030), LIMB_PARTIAL(0x0C9)
+        },
+        {   // 2 * 16^37 * G
+            LIMB_PAIR(0x24DB06FC, 0xFF251707), LIMB_PAIR(0x849EA0B1, 0x4421108C), LIMB_PAIR(0xCA8162A1, 0x3073C4CA), LIMB_PAIR(0xE42AF7AD, 0x6D768642),
+            LIMB_PAIR(0xA6BC7790, 0x031EBA68), LIMB_PAIR(0xD8D64E3F, 0x9A8154C3), LIMB_PAIR(0x297AAFE9, 0x7060550E), LIMB_PAIR(0x641391FB, 0x8681A2C6), LIMB_PARTIAL(0x0FC),
+            LIMB_PAIR(0xE0675E14, 0xE9E76B16), LIMB_PAIR(0x740F9BB7, 0x3C4E3C42), LIMB_PAIR(0x2869A3AE, 0xD3E75FF5), LIMB_PAIR(0xA47C7580, 0x99A891AB),
+            LIMB_PAIR(0x0B321989, 0x42B47BCF), LIMB_PAIR(0x0A6DD3BA, 0x2D1212A0), LIMB_PAIR(0xB43E9086, 0x25B1C5C8), LIMB_PAIR(0xE8D1A73F, 0x8BC954E8), LIMB_PARTIAL(0x1AC)
+        },
+        {   // 3 * 16^37 * G
+            LIMB_PAIR(0x2F134A93, 0x5C9DA142), LIMB_PAIR(0x65DD482A, 0x898C25BA), LIMB_PAIR(0xF6EF3E64, 0xA8CE92FE), LIMB_PAIR(0x5DA54ECB, 0xE462FAEC),
+            LIMB_PAIR(0xB81E3EC3, 0xDFF68F3F), LIMB_PAIR(0x4B8EF144, 0x5278EB6C), LIMB_PAIR(0x0DC84F3C, 0xF98A36D5), LIMB_PAIR(0xA94EF000, 0x8EDD6EDB), LIMB_PARTIAL(0x191),
+            LIMB_PAIR(0xCE8F5403, 0x738606C4), LIMB_PAIR(0x1A20B349, 0x102F1B3A), LIMB_PAIR(0x28F73251, 0xE7F1BF33), LIMB_PAIR(0x1DCCBBDC, 0x0136F3EB),
+            LIMB_PAIR(0x3DF6D9A6, 0x5B2B7763), LIMB_PAIR(0xC9EE09FB, 0x02B03DC6), LIMB_PAIR(0xEA421742, 0xFF600116), LIMB_PAIR(0x40D3C3EB, 0x432728E8), LIMB_PARTIAL(0x034)
+        },
+        {   // 4 * 16^37 * G
+            LIMB_PAIR(0x24374DEC, 0x4BC6F286), LIMB_PAIR(0xDDBF9446, 0x9DED182E), LIMB_PAIR(0x0C3C51E1, 0xF58DDB47), LIMB_PAIR(0xFCFF08C2, 0xA6BD194E),
+            LIMB_PAIR(0x3E931AAE, 0xDC47A3A6), LIMB_PAIR(0xDAF165E6, 0x7F1020A8), LIMB_PAIR(0x8FAABC58, 0xD439739F), LIMB_PAIR(0x5951222A, 0x6EFC35AB), LIMB_PARTIAL(0x187),
+            LIMB_PAIR(0x9498152E, 0xF15EE712), LIMB_PAIR(0xACBF1F82, 0x9E85AFC9), LIMB_PAIR(0x397280BA, 0x7B5853EE), LIMB_PAIR(0x6B8D13EE, 0x0283243A),
+            LIMB_PAIR(0x96CDE865, 0x64ABBDC7), LIMB_PAIR(0x3DFF94EA, 0x0284A75F), LIMB_PAIR(0x9C7B3D53, 0xC476E3A6), LIMB_PAIR(0xD1884045, 0x9DAFE302), LIMB_PARTIAL(0x133)
+        },
+        {   // 5 * 16^37 * G
+            LIMB_PAIR(0x8D4FEC63, 0x1D7B9B77), LIMB_PAIR(0x690C571A, 0x47EB33FB), LIMB_PAIR(0x05A01CE5, 0x3D2BB2DE), LIMB_PAIR(0x78C47FFF, 0x16CDE99B),
+            LIMB_PAIR(0x699656B3, 0x0359242C), LIMB_PAIR(0xBDD416B9, 0xDE0C7D81), LIMB_PAIR(0xB6144F4E, 0x60863068), LIMB_PAIR(0x7583C05A, 0xDFA66D19), LIMB_PARTIAL(0x142),
+            LIMB_PAIR(0x8CCAD1D1, 0x892F8B4E), LIMB_PAIR(0xCCEAAC0F, 0x085CF7F6), LIMB_PAIR(0x5DF33B07, 0xA0760842), LIMB_PAIR(0xA8747EC7, 0xD4737BC3),
+            LIMB_PAIR(0x28F4CADD, 0x7F8147A1), LIMB_PAIR(0x8480DE3C, 0x49D9DB4C), LIMB_PAIR(0x872DEA19, 0x5BAA01D5), LIMB_PAIR(0xE84044C3, 0x2A8726B1), LIMB_PARTIAL(0x126)
+        },
+        {   // 6 * 16^37 * G
+            LIMB_PAIR(0x407386D7, 0x19A54EB6), LIMB_PAIR(0x01C2186E, 0xDF16BAF6), LIMB_PAIR(0x9BD9A894, 0xFAD573E8), LIMB_PAIR(0xCCBEAC47, 0x343BBB0B),
+            LIMB_PAIR(0x4F7F5443, 0x44FEBE5E), LIMB_PAIR(0xC3AD9175, 0x87C81269), LIMB_PAIR(0x47319EB7, 0xDD794114), LIMB_PAIR(0x38F26DCE, 0x33023749), LIMB_PARTIAL(0x1EB),
+            LIMB_PAIR(0x1F1401DF, 0xF94F891C), LIMB_PAIR(0x1450357F, 0x2AE0E96A), LIMB_PAIR(0x85202255, 0x179A5227), LIMB_PAIR(0x397D8D98, 0x10518E7F),
+            LIMB_PAIR(0x828575B0, 0xFA56E665), LIMB_PAIR(0xFAEBB982, 0x7622B705), LIMB_PAIR(0xE3B3B8AC, 0x63F9067A), LIMB_PAIR(0x6FDF48DD, 0xB30F7BEC), LIMB_PARTIAL(0x0DC)
+        },
+        {   // 7 * 16^37 * G
+            LIMB_PAIR(0x2DBFF4F0, 0xE5B551EA), LIMB_PAIR(0x8ED22F87, 0x43819556), LIMB_PAIR(0xD42F4897, 0x1A42769C), LIMB_PAIR(0xA1A6EE3A, 0xE5A6F518),
+            LIMB_PAIR(0x3AB29B90, 0x9B53A9E6), LIMB_PAIR(0xC2FBF1E6, 0x6189A415), LIMB_PAIR(0x2599D956, 0x6EE4570E), LIMB_PAIR(0xDD1F4BCB, 0xEBC865B6), LIMB_PARTIAL(0x0A4),
+            LIMB_PAIR(0x843E4791, 0x66ABACD8), LIMB_PAIR(0x7A8CDC84, 0x3BB5C48E), LIMB_PAIR(0x7B5A2F8C, 0x3F4E2D19), LIMB_PAIR(0xCAFFDA4F, 0xBB945D44),
+            LIMB_PAIR(0xB7BFB4D5, 0xD09A8F34), LIMB_PAIR(0x3501D709, 0x1308F3D8), LIMB_PAIR(0x352B9435, 0x0BFB71E4), LIMB_PAIR(0x403E594C, 0x92C77D2A), LIMB_PARTIAL(0x19B)
+        },
+        {   // 8 * 16^37 * G
+            LIMB_PAIR(0x8B327354, 0x9E4AB8C5), LIMB_PAIR(0x73F5D13A, 0x89377C3C), LIMB_PAIR(0x6E55DEE9, 0x1F93CC12), LIMB_PAIR(0xE490C030, 0x7B4255BC),
+            LIMB_PAIR(0x047EA02C, 0x5451BDF5), LIMB_PAIR(0xB461D14E, 0xC01D952C), LIMB_PAIR(0xB9E21078, 0x172D0F20), LIMB_PAIR(0xA1295F3F, 0x694587A5), LIMB_PARTIAL(0x02F),
+            LIMB_PAIR(0x0219FA4D, 0xD5407627), LIMB_PAIR(0xA3BB7F30, 0xBC0B846F), LIMB_PAIR(0x2BA06BDD, 0x5C17104E), LIMB_PAIR(0xDF3CE36F, 0x2490F12B),
+            LIMB_PAIR(0x08468C10, 0x0FE2E1CA), LIMB_PAIR(0xA9E2C73F, 0x8126C060), LIMB_PAIR(0x5CCE9DD7, 0x7685E59C), LIMB_PAIR(0x9E8CA8B2, 0x5F5F64DA), LIMB_PARTIAL(0x0BF)
+        }
+    },
+#endif
+#if (38 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^38 * G
+            LIMB_PAIR(0x3FDD638D, 0x16BC3341), LIMB_PAIR(0x8C518C30, 0x8C37C58A), LIMB_PAIR(0x79DF75D1, 0x9DDDB8EE), LIMB_PAIR(0xC91A620A, 0x0BC82320),
+            LIMB_PAIR(0x9126A200, 0x6E924A6C), LIMB_PAIR(0xD20C8C89, 0x744594A9), LIMB_PAIR(0x4CC73CAE, 0x0E9B59AC), LIMB_PAIR(0x0B276B4C, 0xCE872F0A), LIMB_PARTIAL(0x08B),
+            LIMB_PAIR(0x2C35933C, 0x651F7422), LIMB_PAIR(0xE025609E, 0x95238355), LIMB_PAIR(0x6C14D96E, 0xE7891B5B), LIMB_PAIR(0x0304D219, 0x89C0FA37),
+            LIMB_PAIR(0x61B597EF, 0xDF7DA33D), LIMB_PAIR(0x4120905C, 0x43DF0357), LIMB_PAIR(0x718DF73D, 0xACF01355), LIMB_PAIR(0x631ADA96, 0x7CA32D0E), LIMB_PARTIAL(0x0B8)
+        },
+        {   // 2 * 16^38 * G
+            LIMB_PAIR(0xD6AE5716, 0x5249E953), LIMB_PAIR(0x1027F3CB, 0xBBF778CA), LIMB_PAIR(0x01020499, 0x0A535C1F), LIMB_PAIR(0x7B847CEA, 0x80F4CF1B),
+            LIMB_PAIR(0x66D8DBF8, 0x3CB8C87B), LIMB_PAIR(0xDD3562A9, 0xA8D7B35B), LIMB_PAIR(0x5BA3F0AB, 0x0305B159), LIMB_PAIR(0x7775DBED, 0x9D5EE3BA), LIMB_PARTIAL(0x1B7),
+            LIMB_PAIR(0x4E5050CD, 0xBE209649), LIMB_PAIR(0x6790EFCE, 0x176602A1), LIMB_PAIR(0x0B21F5C7, 0x6AA6BA5F), LIMB_PAIR(0xF8C4116F, 0x6A1D5DF0),
+            LIMB_PAIR(0x746ABBC3, 0x1A188A83), LIMB_PAIR(0xFD2C047E, 0x2B2D3317), LIMB_PAIR(0xB9E5D5B8, 0x18067E79), LIMB_PAIR(0xC4BE8357, 0xED9BBBCF), LIMB_PARTIAL(0x18B)
+        },
+        {   // 3 * 16^38 * G
+            LIMB_PAIR(0x6CE8B232, 0x0B3B410E), LIMB_PAIR(0x018A42B1, 0xE7B399A0), LIMB_PAIR(0x1B75FA86, 0xDC46BCAC), LIMB_PAIR(0x60747DFD, 0xD301F31A),
+            LIMB_PAIR(0xC1055A3F, 0x489E0254), LIMB_PAIR(0xFDA87D6A, 0x0CE91CAC), LIMB_PAIR(0xDBB94D06, 0xA63C714F), LIMB_PAIR(0xEDDF2A9C, 0xEFA0D5D8), LIMB_PARTIAL(0x06F),
+            LIMB_PAIR(0x2B2AC620, 0x63BF1E9D), LIMB_PAIR(0x6D8C0AF5, 0x319ADF79), LIMB_PAIR(0x2A562804, 0xF6F61274), LIMB_PAIR(0x64CE1442, 0x49933936),
+            LIMB_PAIR(0xA19FACF2, 0x5E16710A), LIMB_PAIR(0x72DF19F3, 0xAAF7FDB4), LIMB_PAIR(0x6A2A864E, 0x941B3E02), LIMB_PAIR(0xDE1319EE, 0x06D197B9), LIMB_PARTIAL(0x004)
+        },
+        {   // 4 * 16^38 * G
+            LIMB_PAIR(0xF0AB06D5, 0xF6A2BF97), LIMB_PAIR(0x11F2C6A5, 0x9F8DA4F0), LIMB_PAIR(0xCB8B966E, 0x776A1EB0), LIMB_PAIR(0xA1903DD7, 0xE74B7349),
+            LIMB_PAIR(0xDAE05C8F, 0x6978C653), LIMB_PAIR(0xE1F5B52F, 0x77D364C9), LIMB_PAIR(0xBC7779EE, 0xF3E29BCC), LIMB_PAIR(0x641BA885, 0x4CD77A80), LIMB_PARTIAL(0x136),
+            LIMB_PAIR(0x9CB2168E, 0xC79B648F), LIMB_PAIR(0xD06DBBE6, 0x1B52D0B7), LIMB_PAIR(0xA65C96D5, 0x7B7302BF), LIMB_PAIR(0xDC838093, 0x1EEA500E),
+            LIMB_PAIR(0xFB69971B, 0x83AA1612), LIMB_PAIR(0x528E16FF, 0x6398CFF0), LIMB_PAIR(0x6D95DEEB, 0xA64963A5), LIMB_PAIR(0x3D7DA7AA, 0x36F35905), LIMB_PARTIAL(0x0A7)
+        },
+        {   // 5 * 16^38 * G
+            LIMB_PAIR(0x2DEE1954, 0x7F45CD24), LIMB_PAIR(0x3F810988, 0x8E6C1D43), LIMB_PAIR(0xB7E3F9A8, 0x97DE2E4A), LIMB_PAIR(0x258D1168, 0x283CA85D),
+            LIMB_PAIR(0x60AD0F79, 0xDB928C55), LIMB_PAIR(0xABDA4F60, 0x70A11E94), LIMB_PAIR(0x0D890F28, 0x2D9B7EB2), LIMB_PAIR(0xF7B67EB4, 0x52C221BB), LIMB_PARTIAL(0x0BB),
+            LIMB_PAIR(0xEAC0E2AD, 0xEBA58C5E), LIMB_PAIR(0x70F18409, 0xB3D7DD58), LIMB_PAIR(0xA334E1C3, 0x31B1BA68), LIMB_PAIR(0xB366CB9C, 0x7A94F4D4),
+            LIMB_PAIR(0xF4CC492A, 0xB557081A), LIMB_PAIR(0x1DF87DBF, 0xEA62FD3F), LIMB_PAIR(0xD465A045, 0x7C2241BA), LIMB_PAIR(0x6EEE5453, 0x68C23CCD), LIMB_PARTIAL(0x043)
+        },
+        {   // 6 * 16^38 * G
+            LIMB_PAIR(0x094FC6F9, 0xF5D6E8ED), LIMB_PAIR(0xAC9C0656, 0x6E2F20DF), LIMB_PAIR(0x46250F60, 0xDB2D54F6), LIMB_PAIR(0xBAA2648B, 0x965B2D13),
+            LIMB_PAIR(0xB32319B7, 0x8B3D9D63), LIMB_PAIR(0xDD1B7D68, 0x444D8A7C), LIMB_PAIR(0x79B086B8, 0x11623270), LIMB_PAIR(0xE4944251, 0xFF7B8F1D), LIMB_PARTIAL(0x0F6),
+            LIMB_PAIR(0x1BB66AAA, 0x0133F7D0), LIMB_PAIR(0x0BFEF41A, 0x3BC785C7), LIMB_PAIR(0xF042B096, 0xAC9A8F7B), LIMB_PAIR(0x2F8BE6D9, 0x58DA5E1B),
+            LIMB_PAIR(0x2633EC9A, 0xD624DE0C), LIMB_PAIR(0x231C9D35, 0x32316A1E), LIMB_PAIR(0xBA1FACD4, 0xC048FFF3), LIMB_PAIR(0x2F919376, 0x8115F3A6), LIMB_PARTIAL(0x040)
+        },
+        {   // 7 * 16^38 * G
+            LIMB_PAIR(0xC809B1A6, 0x3114B122), LIMB_PAIR(0x26A3FCA8, 0x2E3D6E91), LIMB_PAIR(0xF06451F8, 0x0EA11E2B), LIMB_PAIR(0xFEC8821C, 0x5A17B862),
+            LIMB_PAIR(0x036190B6, 0xA6EAEAA3), LIMB_PAIR(0x46B98135, 0x116F7899), LIMB_PAIR(0x7BD89C8D, 0xC31D8219), LIMB_PAIR(0x3BDD85ED, 0x14A9A6D0), LIMB_PARTIAL(0x019),
+            LIMB_PAIR(0xAE211B82, 0xFD626A66), LIMB_PAIR(0x672F6D82, 0x1DAA78DB), LIMB_PAIR(0x871A7E83, 0xA1ADEA20), LIMB_PAIR(0x545F434F, 0xB12C7FD1),
+            LIMB_PAIR(0x5EE1A1EA, 0x7EC53DAA), LIMB_PAIR(0x0FBBCC16, 0x999DCE13), LIMB_PAIR(0x72B4E576, 0xC2D16B27), LIMB_PAIR(0x10D55CC9, 0x47FDC427), LIMB_PARTIAL(0x02E)
+        },
+        {   // 8 * 16^38 * G
+            LIMB_PAIR(0x3C48ADED, 0x708003F8), LIMB_PAIR(0x2497CE05, 0x936A8A38), LIMB_PAIR(0xAFECE34D, 0x66F8E450), LIMB_PAIR(0x513E1C0E, 0x6CC3A161),
+            LIMB_PAIR(0x044610FA, 0xE2FB655E), LIMB_PAIR(0x62E764C3, 0x8AF6A3B3), LIMB_PAIR(0x8CA809A0, 0x839A61F1), LIMB_PAIR(0xC330DDDF, 0xD43F2D1E), LIMB_PARTIAL(0x07F),
+            LIMB_PAIR(0x7ACEE1FF, 0xF4FB698B), LIMB_PAIR(0xCB302BF8, 0x5D19501B), LIMB_PAIR(0x76AC0468, 0x393C9F08), LIMB_PAIR(0xFD22441C, 0x16F8B677),
+            LIMB_PAIR(0xC504D916, 0x85662743), LIMB_PAIR(0x9C8CB9C8, 0xDF3D3311), LIMB_PAIR(0x42F9CBE5, 0x1FEB20EE), LIMB_PAIR(0x5CAD0542, 0xECD3EECE), LIMB_PARTIAL(0x1EB)
+        }
+    },
+#endif
+#if (39 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^39 * G
+            LIMB_PAIR(0x9F004528, 0x8756B00A), LIMB_PAIR(0xE9C2B2E2, 0x20374136), LIMB_PAIR(0xCCA54915, 0x9E6C6A22), LIMB_PAIR(0xF6629736, 0xC5DC6015),
+            LIMB_PAIR(0xC4510C8B, 0x5EF3EFA8), LIMB_PAIR(0xDCC2CE9A, 0x1FE7836C), LIMB_PAIR(0x0B55A453, 0xAC80124A), LIMB_PAIR(0xDBB7A64F, 0xE430CD86), LIMB_PARTIAL(0x104),
+            LIMB_PAIR(0xA385741D, 0x939B5896), LIMB_PAIR(0x3A6C90E9, 0xA80C7D7E), LIMB_PAIR(0xE4C02621, 0x8DF754D6), LIMB_PAIR(0x72958D91, 0xCCC73FF1),
+            LIMB_PAIR(0xE911D8D9, 0xA80CD923), LIMB_PAIR(0x8C0171E8, 0xEE0DCA49), LIMB_PAIR(0xFECADDE6, 0x850D8439), LIMB_PAIR(0x4F714086, 0x37550FC2), LIMB_PARTIAL(0x0C8)
+        },
+        {   // 2 * 16^39 * G
+            LIMB_PAIR(0xEC088BB0, 0x8323B86F), LIMB_PAIR(0xE169BF94, 0x18EEB2D3), LIMB_PAIR(0x55450A6B, 0x9EABC225), LIMB_PAIR(0xE35C62E5, 0xFD49E8FE),
+            LIMB_PAIR(0x6A5D661F, 0x1A8255F8), LIMB_PAIR(0xFF87B2B7, 0xB7EE978F), LIMB_PAIR(0x39975957, 0x6D59A247), LIMB_PAIR(0x13E61BA9, 0x8A12C7F5), LIMB_PARTIAL(0x1DF),
+            LIMB_PAIR(0xB30EA34D, 0x61A3F3A2), LIMB_PAIR(0x4BE16D8D, 0x21FA8992), LIMB_PAIR(0xD8613751, 0xBA41FC20), LIMB_PAIR(0xCCE7E39D, 0x10B11B88),
+            LIMB_PAIR(0xF79EDE48, 0x82A797D7), LIMB_PAIR(0x5FDAA76A, 0x9559DB4A), LIMB_PAIR(0x577E7EF6, 0x445442CE), LIMB_PAIR(0x6751A909, 0x358C9BE0), LIMB_PARTIAL(0x01C)
+        },
+        {   // 3 * 16^39 * G
+            LIMB_PAIR(0x7D5E235D, 0xA22790AE), LIMB_PAIR(0x4A9A5780, 0x6EC954BE), LIMB_PAIR(0xE38FFA50, 0x26AEEDDC), LIMB_PAIR(0xEB3FEEE0, 0xBEB75310),
+            LIMB_PAIR(0x40A31067, 0x44CBB508), LIMB_PAIR(0x380E0BAA, 0x4A0FF701), LIMB_PAIR(0x20CFE922, 0xB23528C8), LIMB_PAIR(0x8FDF6C51, 0xCFF1AC94), LIMB_PARTIAL(0x158),
+            LIMB_PAIR(0x01D7F58B, 0x80ACB800), LIMB_PAIR(0xAF2D7B4D, 0x2181A99D), LIMB_PAIR(0x146506D9, 0x30FF9020), LIMB_PAIR(0x7967A5DC, 0xF091D305),
+            LIMB_PAIR(0x1CD6C51A, 0xB37C1052), LIMB_PAIR(0x6B0DB694, 0x401010B5), LIMB_PAIR(0x60FC5F73, 0x1B1BC5E9), LIMB_PAIR(0xAB3AAC42, 0x8AB0CF8E), LIMB_PARTIAL(0x19B)
+        },
+        {   // 4 * 16^39 * G
+            LIMB_PAIR(0x9CAFE97E, 0x686698E8), LIMB_PAIR(0xB6891510, 0x3F2A465D), LIMB_PAIR(0xC9AAD498, 0xA99BCD91), LIMB_PAIR(0xA47C770B, 0x0C7AE217),
+            LIMB_PAIR(0x6A5E6F06, 0x95067A8B), LIMB_PAIR(0x25A11429, 0x0B55DA40), LIMB_PAIR(0x997CABFF, 0x5372B805), LIMB_PAIR(0x963D233F, 0x1E8BF414), LIMB_PARTIAL(0x02B),
+            LIMB_PAIR(0xAB613409, 0x1343EBE6), LIMB_PAIR(0xAC96CD26, 0x7AAB5A01), LIMB_PAIR(0x112C0B65, 0x243758AF), LIMB_PAIR(0xB236CAD6, 0xD276E441),
+            LIMB_PAIR(0x557111DA, 0x88A7D43F), LIMB_PAIR(0xA0F46068, 0xC6DACE8B), LIMB_PAIR(0xCF4A5CEB, 0x866C31EF), LIMB_PAIR(0x9554F30C, 0x6DD991B8), LIMB_PARTIAL(0x066)
+        },
+        {   // 5 * 16^39 * G
+            LIMB_PAIR(0x5B923896, 0xB7C90BF8), LIMB_PAIR(0xD3F08076, 0x42F96BAF), LIMB_PAIR(0x0BD90A84, 0xDDBD3B0B), LIMB_PAIR(0xE00A7E7B, 0x8ADBBB43),
+            LIMB_PAIR(0xB2059C91, 0xD3205108), LIMB_PAIR(0x6223FD65, 0xCCB379B7), LIMB_PAIR(0xA6F8571E, 0x2C1EB7E2), LIMB_PAIR(0xD80EBB13, 0x13F3BC56), LIMB_PARTIAL(0x092),
+            LIMB_PAIR(0x8D30DF11, 0x5E23BC73), LIMB_PAIR(0x4AABDCD3, 0xAAB73A1F), LIMB_PAIR(0x3E764E18, 0x4CD66082), LIMB_PAIR(0x1D0C98C4, 0x94232816),
+            LIMB_PAIR(0x5B5048F0, 0xD8B64C22), LIMB_PAIR(0xD2A17F6F, 0xAF741F8A), LIMB_PAIR(0xCDB03F14, 0xC1540070), LIMB_PAIR(0xA2476EE5, 0xA16E5E67), LIMB_PARTIAL(0x0A7)
+        },
+        {   // 6 * 16^39 * G
+            LIMB_PAIR(0xFE1D1B82, 0xECE31ECF), LIMB_PAIR(0x29036CFD, 0x368C5AC0), LIMB_PAIR(0xA13FF567, 0x217420AF), LIMB_PAIR(0x77776B5B, 0x1B29E5F0),
+            LIMB_PAIR(0x98F42D23, 0xDD1A5DDA), LIMB_PAIR(0xB6C34257, 0xBA05233B), LIMB_PAIR(0x2D56E9B5, 0xAEA7D3BD), LIMB_PAIR(0x84E7205C, 0x3D5777E7), LIMB_PARTIAL(0x1C4),
+            LIMB_PAIR(0xE7C6EB47, 0xF4DD56B5), LIMB_PAIR(0x4A1B9D04, 0xC479B9D6), LIMB_PAIR(0x8117A210, 0xFA1D38A4), LIMB_PAIR(0xDFB5A934, 0xDC603246),
+            LIMB_PAIR(0xDA0675EC, 0x9E8156AB), LIMB_PAIR(0x0EF78EAB, 0x6937CCCE), LIMB_PAIR(0xD2E5CC67, 0x72DD487A), LIMB_PAIR(0xD372A668, 0xB735F780), LIMB_PARTIAL(0x049)
+        },
+        {   // 7 * 16^39 * G
+            LIMB_PAIR(0x29FFFDEE, 0xC3B2ADB7), LIMB_PAIR(0x51FB8606, 0x154F4D79), LIMB_PAIR(0x9D7F4B0C, 0x56E497FE), LIMB_PAIR(0x0DF7FD94, 0xE5E69FAA),
+            LIMB_PAIR(0x114FA3CA, 0x1891FE5D), LIMB_PAIR(0x045C3286, 0x4162F0E9), LIMB_PAIR(0x780253D6, 0x98DE02C4), LIMB_PAIR(0x7947B60F, 0x70308002), LIMB_PARTIAL(0x19C),
+            LIMB_PAIR(0xA9510BD2, 0xE77F7B12), LIMB_PAIR(0x2D32A857, 0xC663FBE7), LIMB_PAIR(0xB9274D4F, 0x6538A301), LIMB_PAIR(0xBB01302D, 0xB2C191D0),
+            LIMB_PAIR(0x6366BBF5, 0x567474F2), LIMB_PAIR(0xAE1E52E9, 0x8446925C), LIMB_PAIR(0x209B55E8, 0x3EE00EA9), LIMB_PAIR(0x2419E4BC, 0x3D76982D), LIMB_PARTIAL(0x091)
+        },
+        {   // 8 * 16^39 * G
+            LIMB_PAIR(0x025189D4, 0x08136CBF), LIMB_PAIR(0xC1B25A05, 0xA1C389CB), LIMB_PAIR(0x6E9ED11D, 0xBECDADE7), LIMB_PAIR(0xA7F3F38A, 0x6557006B),
+            LIMB_PAIR(0xBC852DBD, 0x96D6C877), LIMB_PAIR(0xC53EFD4F, 0x3A0AFE4B), LIMB_PAIR(0xFEBE4737, 0xC7F58410), LIMB_PAIR(0x84E35E2F, 0x86DEBA3B), LIMB_PARTIAL(0x15B),
+            LIMB_PAIR(0x4DFA7DA8, 0x96256DB2), LIMB_PAIR(0x3DCCF202, 0x37973557), LIMB_PAIR(0x8FCC1274, 0x2E0B263E), LIMB_PAIR(0x9EE7B82E, 0x14870FE8),
+            LIMB_PAIR(0x425CA276, 0xCB8F9BA5), LIMB_PAIR(0x7D876E79, 0x683C748E), LIMB_PAIR(0xDE2F2CFE, 0x48E990D5), LIMB_PAIR(0x48547013, 0x2ECC8F1F), LIMB_PARTIAL(0x18F)
+        }
+    },
+#endif
+#if (40 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^40 * G
+            LIMB_PAIR(0x378CAB85, 0x11446EFE), LIMB_PAIR(0xBC48BF6D, 0x4C3C68CF), LIMB_PAIR(0x64C19BAF, 0x5E514661), LIMB_PAIR(0xD5CBB135, 0xC0F00735),
+            LIMB_PAIR(0xA693B1A9, 0x5D4844A7), LIMB_PAIR(0x9579FDAF, 0x517A4871), LIMB_PAIR(0x532C1E6E, 0x5EAD064B), LIMB_PAIR(0x4135ECB1, 0x60207C2D), LIMB_PARTIAL(0x172),
+            LIMB_PAIR(0x843DC902, 0x4B033A37), LIMB_PAIR(0xC27A9863, 0xB2D3664C), LIMB_PAIR(0x18280E54, 0xF4EBDC35), LIMB_PAIR(0xAE02B757, 0xAC7789A6),
+            LIMB_PAIR(0x10DD96F8, 0x50084BA4), LIMB_PAIR(0x1F5F6349, 0xCC345937), LIMB_PAIR(0xFDEE6F84, 0x5F65ACA8), LIMB_PAIR(0x02D841CF, 0x4AAC5F59), LIMB_PARTIAL(0x1B9)
+        },
+        {   // 2 * 16^40 * G
+            LIMB_PAIR(0x532856CA, 0x7C44096F), LIMB_PAIR(0x4D701F46, 0xF054AC94), LIMB_PAIR(0x8DE81577, 0x1BF992E7), LIMB_PAIR(0xA90A4D2E, 0x871D2DF2),
+            LIMB_PAIR(0x775CABE3, 0x963357A5), LIMB_PAIR(0xBAE3AC5D, 0x2E92D83D), LIMB_PAIR(0x415BE4DB, 0xC39E645C), LIMB_PAIR(0x9781B22F, 0xBCCA60E2), LIMB_PARTIAL(0x1C9),
+            LIMB_PAIR(0xFC5374ED, 0x638CF76C), LIMB_PAIR(0x24278420, 0xFFBFBC7A), LIMB_PAIR(0xE7668BC6, 0xDE577D69), LIMB_PAIR(0xBAB7B568, 0x88444FDE),
+            LIMB_PAIR(0x59D220A6, 0x4CB8237B), LIMB_PAIR(0x25B582EB, 0x02186C1C), LIMB_PAIR(0x9B639F32, 0xE4A04CB1), LIMB_PAIR(0x4590E20D, 0xD12B0E64), LIMB_PARTIAL(0x0AB)
+        },
+        {   // 3 * 16^40 * G
+            LIMB_PAIR(0x638C39DC, 0xFEBD71BD), LIMB_PAIR(0x016E39F1, 0x599852C1), LIMB_PAIR(0x96EB6AF6, 0x678D5442), LIMB_PAIR(0x1EA773FF, 0x4A1CE1D0),
+            LIMB_PAIR(0x62AD7D21, 0x23FA5FFD), LIMB_PAIR(0x8C41D004, 0x845CAB52), LIMB_PAIR(0xBB683C2A, 0x60A4CA10), LIMB_PAIR(0x586ABA40, 0x62092692), LIMB_PARTIAL(0x110),
+            LIMB_PAIR(0x08262627, 0xDD30D6A1), LIMB_PAIR(0xAAB1312E, 0x410CD76D), LIMB_PAIR(0x87EF2A6D, 0xD7816548), LIMB_PAIR(0x740171C0, 0x9CA850C7),
+            LIMB_PAIR(0xF4E746E6, 0x6881C9BA), LIMB_PAIR(0xDF470442, 0x20B5F165), LIMB_PAIR(0xA625D961, 0x09F109D2), LIMB_PAIR(0xC1D1DF61, 0x64CF9864), LIMB_PARTIAL(0x078)
+        },
+        {   // 4 * 16^40 * G
+            LIMB_PAIR(0xBB55F47E, 0xDD0F09B1), LIMB_PAIR(0xBE55C9D6, 0xFACBDEF0), LIMB_PAIR(0xBB62C5EE, 0x8B8B1A9C), LIMB_PAIR(0xEB8F0BBD, 0x617FF446),
+            LIMB_PAIR(0x5C1EFE94, 0x24176F92), LIMB_PAIR(0x962F4019, 0xF27AE452), LIMB_PAIR(0x220FC04D, 0x3B812A15), LIMB_PAIR(0xCC92239D, 0xB17B1B9B), LIMB_PARTIAL(0x05C),
+            LIMB_PAIR(0x8A465257, 0x9200F2E4), LIMB_PAIR(0xFBB69960, 0xC8CA2A1C), LIMB_PAIR(0x5A8FF2AA, 0x5410EF87), LIMB_PAIR(0xE11B6896, 0x87BC97B0),
+            LIMB_PAIR(0x52263F49, 0x1D3A4969), LIMB_PAIR(0xCCA15D27, 0x2ED88B0B), LIMB_PAIR(0x765C9300, 0x90AB34C1), LIMB_PAIR(0xD2630404, 0x719D9BC7), LIMB_PARTIAL(0x010)
+        },
+        {   // 5 * 16^40 * G
+            LIMB_PAIR(0x7C4C1251, 0x22AF165C), LIMB_PAIR(0xB49D08A6, 0x0638EF62), LIMB_PAIR(0x18ED98CC, 0x80DFF986), LIMB_PAIR(0xA541C5E5, 0x8E3B7186),
+            LIMB_PAIR(0xD0F729D4, 0x3C309734), LIMB_PAIR(0x2F30C85C, 0xC3439363), LIMB_PAIR(0x3B099E11, 0xD90474FA), LIMB_PAIR(0x06C8C546, 0xDC726A4A), LIMB_PARTIAL(0x13B),
+            LIMB_PAIR(0x1A531C8F, 0x06792436), LIMB_PAIR(0x3C2633CF, 0xCB5C860E), LIMB_PAIR(0xDCDE99CB, 0xFEF97B7E), LIMB_PAIR(0xE4C02691, 0x085E6288),
+            LIMB_PAIR(0x353255D8, 0x08C3E30C), LIMB_PAIR(0xBF01A904, 0xE50A641C), LIMB_PAIR(0x108D6EB6, 0xBE2980B1), LIMB_PAIR(0xED2BDE9D, 0xD5547FB7), LIMB_PARTIAL(0x0DD)
+        },
+        {   // 6 * 16^40 * G
+            LIMB_PAIR(0x8D9E9C1E, 0x6366CC83), LIMB_PAIR(0x7CF6EA2B, 0x6DA8B24C), LIMB_PAIR(0x34A0C6DD, 0xCF34AC08), LIMB_PAIR(0xE3A1BEA6, 0x957954DD),
+            LIMB_PAIR(0xF4060336, 0x2EA0EF68), LIMB_PAIR(0xA84FDF5D, 0xE61893A5), LIMB_PAIR(0x7BF522C5, 0x03CACAB4), LIMB_PAIR(0x0DBF1790, 0x823249DD), LIMB_PARTIAL(0x145),
+            LIMB_PAIR(0xAB3E90D0, 0x2EA0344D), LIMB_PAIR(0x2BCCCC9C, 0x5C70CC71), LIMB_PAIR(0x0063E840, 0x5EEC2755), LIMB_PAIR(0xBE50D3A5, 0x3983CB1B),
+            LIMB_PAIR(0x7B09FF44, 0x462B3DC2), LIMB_PAIR(0xDD6B34BB, 0xF779391E), LIMB_PAIR(0xBBF36F70, 0x6C00D9B8), LIMB_PAIR(0xF82EE371, 0x9E0EB0D1), LIMB_PARTIAL(0x080)
+        },
+        {   // 7 * 16^40 * G
+            LIMB_PAIR(0xF443807C, 0x7881C53C), LIMB_PAIR(0x861089DC, 0x95060F3C), LIMB_PAIR(0x0B096123, 0x0B406684), LIMB_PAIR(0x86A8D5F6, 0xBAFDECBB),
+            LIMB_PAIR(0x5C89A0A2, 0x2F5961BF), LIMB_PAIR(0x6AC1191D, 0x3034175A), LIMB_PAIR(0x4F1CBA38, 0x7521B10B), LIMB_PAIR(0xA7CF95B1, 0x96EE1BA8), LIMB_PARTIAL(0x1AA),
+            LIMB_PAIR(0x13DFF296, 0x51B2B27B), LIMB_PAIR(0x10683230, 0xA3597D71), LIMB_PAIR(0xF1026F39, 0x82C4A1CE), LIMB_PAIR(0x363F89B3, 0x9ACDB7EA),
+            LIMB_PAIR(0x30BAD05E, 0x14E0797F), LIMB_PAIR(0xC9F5C1CF, 0x4BCB9331), LIMB_PAIR(0xC248CD02, 0x2DA2F33F), LIMB_PAIR(0xCE32B8E1, 0xE9409B9F), LIMB_PARTIAL(0x072)
+        },
+        {   // 8 * 16^40 * G
+            LIMB_PAIR(0xD15E752D, 0x41B4D05B), LIMB_PAIR(0x46E78FAF, 0xCE20B1F8), LIMB_PAIR(0x08D808B5, 0xB529CC01), LIMB_PAIR(0x2210CF60, 0xD934F10F),
+            LIMB_PAIR(0xE41ECA93, 0x9F2E7E1B), LIMB_PAIR(0x4D82D15D, 0xC09DA7A9), LIMB_PAIR(0xA1ED7860, 0x45A84216), LIMB_PAIR(0xE6BE684E, 0x9F6FA43D), LIMB_PARTIAL(0x109),
+            LIMB_PAIR(0xECF53A79, 0x592BD464), LIMB_PAIR(0x349754ED, 0x9DAC1BB8), LIMB_PAIR(0x84339A7D, 0x79BBE622), LIMB_PAIR(0xF9F4FA5A, 0x29C3D4AA),
+            LIMB_PAIR(0x16DC4698, 0x4788CDA8), LIMB_PAIR(0x5C3060EF, 0xF94EA449), LIMB_PAIR(0xCB3C2B37, 0xC5F4191D), LIMB_PAIR(0xFF69861A, 0xEB720D23), LIMB_PARTIAL(0x026)
+        }
+    },
+#endif
+#if (41 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^41 * G
+            LIMB_PAIR(0x42DF612F, 0x7B9409BB), LIMB_PAIR(0x1BC66A3F, 0x32F47DD2), LIMB_PAIR(0x23F375FE, 0x213F80E0), LIMB_PAIR(0x06AA6C21, 0xAA71C57F),
+            LIMB_PAIR(0x84298947, 0x5BF7B3A7), LIMB_PAIR(0x5B608FA3, 0x001C2C96), LIMB_PAIR(0x173C7F4F, 0x417619C6), LIMB_PAIR(0xD4A20677, 0xBCFF66AC), LIMB_PARTIAL(0x0B3),
+            LIMB_PAIR(0x0603BC79, 0x81B9B564), LIMB_PAIR(0xF875E591, 0x8F39155E), LIMB_PAIR(0xDFD32C0D, 0xF6A508FD), LIMB_PAIR(0x6B0DAC71, 0x7EACE6F9),
+            LIMB_PAIR(0x9E4C1EB3, 0xE40163D8), LIMB_PAIR(0xFF10FA6D, 0x265226C5), LIMB_PAIR(0xDA76D272, 0x1E1AF5CB), LIMB_PAIR(0xA10DC788, 0x954BC056), LIMB_PARTIAL(0x12C)
+        },
+        {   // 2 * 16^41 * G
+            LIMB_PAIR(0x47F7153B, 0xDBA8E405), LIMB_PAIR(0x67DBFEBF, 0x73071FD9), LIMB_PAIR(0x4441A2FF, 0x35881EEC), LIMB_PAIR(0x5B31B917, 0x50623C47),
+            LIMB_PAIR(0xC2BAD8B3, 0x8F09DBF6), LIMB_PAIR(0x90BB890D, 0xBF1F09CD), LIMB_PAIR(0x7F034FDC, 0xAB770CD7), LIMB_PAIR(0x6B7D98B1, 0x45B95923), LIMB_PARTIAL(0x029),
+            LIMB_PAIR(0xF599C343, 0xD2EF1E00), LIMB_PAIR(0x7024D641, 0x1289BDB1), LIMB_PAIR(0xF4E36687, 0xED8E7886), LIMB_PAIR(0x3696269C, 0x4AD57B34),
+            LIMB_PAIR(0x70BF3629, 0x69BD1B6E), LIMB_PAIR(0x2BAB0453, 0x680F0862), LIMB_PAIR(0x68E4B123, 0x1865F02A), LIMB_PAIR(0xE8D8AB75, 0x7BC5DBF3), LIMB_PARTIAL(0x150)
+        },
+        {   // 3 * 16^41 * G
+            LIMB_PAIR(0x7471A905, 0x02E206C3), LIMB_PAIR(0x34D0C122, 0xB6CE0139), LIMB_PAIR(0xCA1EC8AD, 0xCDA8A158), LIMB_PAIR(0x6EB26374, 0x17BA844B),
+            LIMB_PAIR(0x2AE7179C, 0xF8DCA5A6), LIMB_PAIR(0x807AE8F2, 0xDAB1DA42), LIMB_PAIR(0x4083D6A7, 0xDCC18AC9), LIMB_PAIR(0xDF65F291, 0x1464E68E), LIMB_PARTIAL(0x038),
+            LIMB_PAIR(0xD22A48C2, 0x6599FD7B), LIMB_PAIR(0x477ABE8A, 0xFD36F482), LIMB_PAIR(0x30756F73, 0x403663C9), LIMB_PAIR(0x805B2E09, 0x1B38F348),
+            LIMB_PAIR(0xC142D148, 0x213FEB71), LIMB_PAIR(0x8855D42F, 0x9878091A), LIMB_PAIR(0x2821AF05, 0x31742196), LIMB_PAIR(0x80457E5B, 0x90234735), LIMB_PARTIAL(0x053)
+        },
+        {   // 4 * 16^41 * G
+            LIMB_PAIR(0x09ED0733, 0x4F6BA84D), LIMB_PAIR(0x4BF2273A, 0xDB3908D1), LIMB_PAIR(0x3A074347, 0x33BCFF3F), LIMB_PAIR(0x22E849CD, 0xBAFC83C6),
+            LIMB_PAIR(0xEED3B0DB, 0xFB13992C), LIMB_PAIR(0x3C016BED, 0xD24DD41D), LIMB_PAIR(0xF6C72694, 0x0D15167A), LIMB_PAIR(0x162238B6, 0xE06346BE), LIMB_PARTIAL(0x050),
+            LIMB_PAIR(0x55D96852, 0x28FEA534), LIMB_PAIR(0x3F0CEF9E, 0x46AEE84A), LIMB_PAIR(0x775A77A5, 0xB8AF77E1), LIMB_PAIR(0xB66F217D, 0x63E3B7FC),
+            LIMB_PAIR(0x96E84554, 0x763CEB67), LIMB_PAIR(0xD79B3203, 0x39B7EC8E), LIMB_PAIR(0x4F17B166, 0x62E24B18), LIMB_PAIR(0x905054DF, 0x873EA1AA), LIMB_PARTIAL(0x1F4)
+        },
+        {   // 5 * 16^41 * G
+            LIMB_PAIR(0x5FD30BBD, 0xE410D8F7), LIMB_PAIR(0x031CFF85, 0x966E71D6), LIMB_PAIR(0xA6F4B6A7, 0xFE51C6C9), LIMB_PAIR(0xD5681412, 0x6AA83CA8),
+            LIMB_PAIR(0x57A5D801, 0x28A61D2E), LIMB_PAIR(0x52BC0413, 0xB699F6CB), LIMB_PAIR(0x443BB821, 0x1729F8D0), LIMB_PAIR(0x04452A00, 0x6E22F512), LIMB_PARTIAL(0x076),
+            LIMB_PAIR(0x0CC2608E, 0x7B51FFAC), LIMB_PAIR(0x495E770A, 0x370F9A54), LIMB_PAIR(0xF574B07C, 0xE32A66E2), LIMB_PAIR(0x7C808C30, 0xC3EAD5C5),
+            LIMB_PAIR(0x20D3D51A, 0xF04BDEBD), LIMB_PAIR(0x04FFD31C, 0x82B07F28), LIMB_PAIR(0xB6DF8FB3, 0xD2D81AE3), LIMB_PAIR(0x002EA4E2, 0x3978BB58), LIMB_PARTIAL(0x1AB)
+        },
+        {   // 6 * 16^41 * G
+            LIMB_PAIR(0x91F7DA33, 0x35A5767A), LIMB_PAIR(0x7BA4DFED, 0xB7313693), LIMB_PAIR(0x7F7E4D30, 0x3843D6C3), LIMB_PAIR(0xE2595A8A, 0x6F461C6B),
+            LIMB_PAIR(0x14105BE4, 0xA34766D0), LIMB_PAIR(0xD7C9924E, 0x62D28311), LIMB_PAIR(0x0F51F78E, 0x7BFD2811), LIMB_PAIR(0x4B760751, 0x9CD30FB2), LIMB_PARTIAL(0x1C4),
+            LIMB_PAIR(0x3391726A, 0x739B01BC), LIMB_PAIR(0x5FDE4FD5, 0x82721AEF), LIMB_PAIR(0xEA71F1F2, 0xF3EC542D), LIMB_PAIR(0x58345718, 0x520FDD34),
+            LIMB_PAIR(0x54BB2D09, 0xEF2A3D6F), LIMB_PAIR(0xFAEB5530, 0xF75FC3FC), LIMB_PAIR(0xF73076B3, 0x6FB68582), LIMB_PAIR(0x20E57568, 0x27D38356), LIMB_PARTIAL(0x1BE)
+        },
+        {   // 7 * 16^41 * G
+            LIMB_PAIR(0x18DB2823, 0xF85C1B6A), LIMB_PAIR(0x2203EEA7, 0xDA36FA1C), LIMB_PAIR(0xCDAC541B, 0x81F96771), LIMB_PAIR(0x605C943D, 0x52E33F39),
+            LIMB_PAIR(0x37C23121, 0xADF4C066), LIMB_PAIR(0x8AD2C86C, 0xE9E5AA4B), LIMB_PAIR(0x0354AD23, 0x3D4A6163), LIMB_PAIR(0xAE152C75, 0x44B4D8EB), LIMB_PARTIAL(0x0FD),
+            LIMB_PAIR(0xAB2D2652, 0xD5D3D35D), LIMB_PAIR(0x382B2FB7, 0x55B6F8ED), LIMB_PAIR(0xA7E69B83, 0x3A1EEE79), LIMB_PAIR(0xB5C6DA08, 0x98F430AA),
+            LIMB_PAIR(0x56CCE57B, 0xF4AF6CD9), LIMB_PAIR(0x7AF2EA27, 0xD67E787B), LIMB_PAIR(0xD8841E4F, 0xC276F0A7), LIMB_PAIR(0xC0478C59, 0x2E23F60F), LIMB_PARTIAL(0x026)
+        },
+        {   // 8 * 16^41 * G
+            LIMB_PAIR(0xCAD6B074, 0x0DB2B099), LIMB_PAIR(0x2A6EFC26, 0x4749379C), LIMB_PAIR(0xAB64D63C, 0x31862F75), LIMB_PAIR(0x1623E85B, 0xA465075D),
+            LIMB_PAIR(0x00E7E1B8, 0x5F03BBEA), LIMB_PAIR(0xA2C133CF, 0x24EF8956), LIMB_PAIR(0x52533CA3, 0x6F9FBAD4), LIMB_PAIR(0xABF81B19, 0xDFB15DF3), LIMB_PARTIAL(0x15F),
+            LIMB_PAIR(0x2796855A, 0x0616FD24), LIMB_PAIR(0x9CBC946E, 0x4A9A066C), LIMB_PAIR(0x347283F1, 0xAA0FD8EE), LIMB_PAIR(0xF15AA16F, 0x63BDE9AD),
+            LIMB_PAIR(0x9277E9BB, 0xBDD5677A), LIMB_PAIR(0xD045538C, 0x5EC032E2), LIMB_PAIR(0xBA8C76FC, 0x5F4EBA3A), LIMB_PAIR(0x088E500C, 0xA17D2872), LIMB_PARTIAL(0x0A6)
+        }
+    },
+#endif
+#if (42 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^42 * G
+            LIMB_PAIR(0xD4CD8948, 0xD8FAA3BC), LIMB_PAIR(0x9D2888D8, 0xDDC43783), LIMB_PAIR(0x581ABBA5, 0x1E951BD5), LIMB_PAIR(0x2947D11F, 0xA52DFAB2),
+            LIMB_PAIR(0x728A40EA, 0x8FBB0ED8), LIMB_PAIR(0x31D769CC, 0xD4F4D06F), LIMB_PAIR(0xFAC908D2, 0xD93B1D93), LIMB_PAIR(0xF5A3B0CD, 0x8852B438), LIMB_PARTIAL(0x0BB),
+            LIMB_PAIR(0xC8C88DE9, 0x84EA0E03), LIMB_PAIR(0x63CDB21F, 0x621A8088), LIMB_PAIR(0xCD6EC216, 0x332C292E), LIMB_PAIR(0xC4CD0DCA, 0xFD01EE09),
+            LIMB_PAIR(0xFDFCE95C, 0x5354EC9E), LIMB_PAIR(0xA6B8DB30, 0x05C307B2), LIMB_PAIR(0xB44784AE, 0xF7B254EA), LIMB_PAIR(0x7E61408A, 0xD3848125), LIMB_PARTIAL(0x128)
+        },
+        {   // 2 * 16^42 * G
+            LIMB_PAIR(0x2F1993F7, 0xF9B815FE), LIMB_PAIR(0x3ECCE0E2, 0xE1F5199A), LIMB_PAIR(0xAB10A910, 0x8898D789), LIMB_PAIR(0x4E863533, 0x49863DAC),
+            LIMB_PAIR(0x5E465BAF, 0xB5F118AA), LIMB_PAIR(0x0281E10B, 0x10D03128), LIMB_PAIR(0x5042343B, 0xC9836135), LIMB_PAIR(0xBC68242D, 0xC2140930), LIMB_PARTIAL(0x073),
+            LIMB_PAIR(0xE84F3896, 0xF1417466), LIMB_PAIR(0x23DB4590, 0xD4167F13), LIMB_PAIR(0xC7699F09, 0xE5347265), LIMB_PAIR(0xBE6204BC, 0xE4458198),
+            LIMB_PAIR(0x68D8B7A8, 0x93752968), LIMB_PAIR(0x2A065D8B, 0x49757C53), LIMB_PAIR(0xB6927E83, 0xDC0856FB), LIMB_PAIR(0x56449CF6, 0xB1679B0C), LIMB_PARTIAL(0x1B2)
+        },
+        {   // 3 * 16^42 * G
+            LIMB_PAIR(0xF6B5E497, 0x1A80E022), LIMB_PAIR(0x8D73860A, 0x210B6F4B), LIMB_PAIR(0x7B7F92C4, 0x16F2E7BD), LIMB_PAIR(0xD068DE98, 0xDED9E969),
+            LIMB_PAIR(0x546ACE60, 0x68105E12), LIMB_PAIR(0xEFB6F66F, 0x56A0C5B0), LIMB_PAIR(0x85D590D0, 0xF0D5FDB9), LIMB_PAIR(0xB69D5821, 0xF15E274F), LIMB_PARTIAL(0x0BB),
+            LIMB_PAIR(0xDE543268, 0xD8D0621D), LIMB_PAIR(0x04B71011, 0x9E0AB44C), LIMB_PAIR(0xDB9FE3CC, 0x25C135CB), LIMB_PAIR(0x024B4CE3, 0xF0A9044B),
+            LIMB_PAIR(0x49D2589A, 0xECFB54FA), LIMB_PAIR(0x8BCA2C50, 0xF5749538), LIMB_PAIR(0xF8F8E5F6, 0xD76BF119), LIMB_PAIR(0x292A452E, 0xBD946E2C), LIMB_PARTIAL(0x0B2)
+        },
+        {   // 4 * 16^42 * G
+            LIMB_PAIR(0x28EB6FFD, 0x1D43440F), LIMB_PAIR(0x1FAA5C82, 0xA97797D4), LIMB_PAIR(0x5C895EEF, 0x14A96042), LIMB_PAIR(0xD4FA3E4C, 0xD35E5D8C),
+            LIMB_PAIR(0x277B5084, 0x9E68F293), LIMB_PAIR(0x2BC6B1A0, 0xBF5B8A16), LIMB_PAIR(0xCF49A617, 0xA1D47A38), LIMB_PAIR(0x62FD2244, 0x703E609E), LIMB_PARTIAL(0x048),
+            LIMB_PAIR(0xC6AF3C4F, 0x5909FBF6), LIMB_PAIR(0x7C1975AB, 0x1428B835), LIMB_PAIR(0x10400297, 0x30F8A308), LIMB_PAIR(0x5B5750BB, 0xD753559F),
+            LIMB_PAIR(0xF99FABB3, 0xBC5235EB), LIMB_PAIR(0xCAA35305, 0x588AAF0B), LIMB_PAIR(0x579DC86E, 0x13085ABC), LIMB_PAIR(0xFEA9393B, 0x793F9EFA), LIMB_PARTIAL(0x00F)
+        },
+        {   // 5 * 16^42 * G
+            LIMB_PAIR(0x8256720C, 0xD1E60E5F), LIMB_PAIR(0x7C49FA90, 0x171027F5), LIMB_PAIR(0xF6549F3C, 0xF64E8839), LIMB_PAIR(0x69B799B0, 0xFFA14904),
+            LIMB_PAIR(0x34553FDC, 0xADD4E8FB), LIMB_PAIR(0x741A95BA, 0x7CF91923), LIMB_PAIR(0x93A1BA5A, 0xC9FA2FE9), LIMB_PAIR(0x0980ACC1, 0x5D9E3402), LIMB_PARTIAL(0x020),
+            LIMB_PAIR(0x98D2C9FF, 0x2A5CB99C), LIMB_PAIR(0x6C3294E9, 0x448896BF), LIMB_PAIR(0x81E067A4, 0xF76232CB), LIMB_PAIR(0x3757184D, 0xBDA3583A),
+            LIMB_PAIR(0x2E0C61AA, 0xFA41813B), LIMB_PAIR(0xC106499D, 0x6BA2AEB6), LIMB_PAIR(0xA19E4B30, 0x93782286), LIMB_PAIR(0x86E8C59A, 0x13E2306F), LIMB_PARTIAL(0x0A4)
+        },
+        {   // 6 * 16^42 * G
+            LIMB_PAIR(0x0E37EDBF, 0x6F8275E5), LIMB_PAIR(0xDB3E6343, 0x64AD3B76), LIMB_PAIR(0x6A5161EB, 0x2EEF1503), LIMB_PAIR(0xCF10D729, 0x2C60875E),
+            LIMB_PAIR(0x9424CE59, 0xD477F32A), LIMB_PAIR(0xDDD91BE6, 0xFBD5AB3F), LIMB_PAIR(0xAC18456B, 0xBE1F16DF), LIMB_PAIR(0x8DAC1A4C, 0x88E75537), LIMB_PARTIAL(0x0D1),
+            LIMB_PAIR(0x3C10F2F8, 0x4F8E076E), LIMB_PAIR(0x7A6BC509, 0x04F48BA5), LIMB_PAIR(0x420B54D1, 0x8B825C99), LIMB_PAIR(0xD7412044, 0x35FB71DD),
+            LIMB_PAIR(0x771B6D9E, 0x1D954ED2), LIMB_PAIR(0x473E8A03, 0x24EAD049), LIMB_PAIR(0x28BA193A, 0x513FF05D), LIMB_PAIR(0x7A8ABF0C, 0x42D94D2C), LIMB_PARTIAL(0x143)
+        },
+        {   // 7 * 16^42 * G
+            LIMB_PAIR(0x3792D0E1, 0x5169A5BA), LIMB_PAIR(0x866A52B1, 0xA94F38AE), LIMB_PAIR(0x60F5270D, 0x52123A08), LIMB_PAIR(0xA5B51694, 0x3753C8F7),
+            LIMB_PAIR(0x4C0DC22B, 0xC28F1BD1), LIMB_PAIR(0xE55184F5, 0x39279193), LIMB_PAIR(0x528C4498, 0xB9FE5BDA), LIMB_PAIR(0xBCE7DE75, 0x1A04E978), LIMB_PARTIAL(0x1C9),
+            LIMB_PAIR(0xED890690, 0x95B584D1), LIMB_PAIR(0x65D82F4A, 0xD02B7FC9), LIMB_PAIR(0x3F0B031A, 0xA630A8DC), LIMB_PAIR(0x5BE69E84, 0x79759D95),
+            LIMB_PAIR(0x45539242, 0x8CDB211F), LIMB_PAIR(0x1032DAD8, 0x523FBD10), LIMB_PAIR(0x5B003E94, 0x40C47F4D), LIMB_PAIR(0x20D6FD97, 0x02DE5519), LIMB_PARTIAL(0x144)
+        },
+        {   // 8 * 16^42 * G
+            LIMB_PAIR(0xCE9C07A2, 0xF63486B5), LIMB_PAIR(0xB9B5E762, 0x109221F7), LIMB_PAIR(0x9210D1CA, 0x0450B6C7), LIMB_PAIR(0xCC780322, 0x8A9B11B1),
+            LIMB_PAIR(0xA30BFDAA, 0xF33C4701), LIMB_PAIR(0xC33BFCA1, 0x1A7D75F3), LIMB_PAIR(0x1C13AF9D, 0x4EE930E5), LIMB_PAIR(0xCE402AA2, 0x3CE4223B), LIMB_PARTIAL(0x1EC),
+            LIMB_PAIR(0x11FDD6EE, 0x2FFBFAE3), LIMB_PAIR(0x03C1EDEB, 0xCA5F04D0), LIMB_PAIR(0x5D3A2E52, 0xBD80684A), LIMB_PAIR(0x54193AB1, 0x98D1A18D),
+            LIMB_PAIR(0xF366FC87, 0xC549CECE), LIMB_PAIR(0xA13EAD38, 0xB194E11A), LIMB_PAIR(0x1882660A, 0x6ACAF7B2), LIMB_PAIR(0xD2CAD2AD, 0x686C0C7B), LIMB_PARTIAL(0x1FF)
+        }
+    },
+#endif
+#if (43 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^43 * G
+            LIMB_PAIR(0x3E206F1D, 0x327EEC48), LIMB_PAIR(0xFD9E0124, 0x20BAE09C), LIMB_PAIR(0x12FE91F1, 0x90E15A50), LIMB_PAIR(0x359590D6, 0x0DD6DE71),
+            LIMB_PAIR(0x7346265F, 0xB47FF787), LIMB_PAIR(0xD72B31FC, 0xF68C7538), LIMB_PAIR(0x853E2029, 0x1210AA5E), LIMB_PAIR(0xF09C0C81, 0x22955A4D), LIMB_PARTIAL(0x040),
+            LIMB_PAIR(0x7335F4A6, 0xE194DBA0), LIMB_PAIR(0x4BDE2F58, 0x9D6532FB), LIMB_PAIR(0x9016930A, 0xFAC563C5), LIMB_PAIR(0xAF9E2095, 0x626EAEEF),
+            LIMB_PAIR(0xB7D9FDE1, 0x7AF29B71), LIMB_PAIR(0x36360BBF, 0x809B7FE4), LIMB_PAIR(0xE3CD1C8E, 0x57B5E52D), LIMB_PAIR(0x37B01251, 0x52B90409), LIMB_PARTIAL(0x032)
+        },
+        {   // 2 * 16^43 * G
+            LIMB_PAIR(0x6037FF54, 0x7EFF6EB5), LIMB_PAIR(0x963E7CB1, 0x78CFC774), LIMB_PAIR(0x6B3956A1, 0x48D139D1), LIMB_PAIR(0x619F159D, 0x3265461A),
+            LIMB_PAIR(0xA3B1DB5E, 0x80DCB967), LIMB_PAIR(0xF293C925, 0xDB164BF4), LIMB_PAIR(0x83B65B62, 0xB0A372DE), LIMB_PAIR(0x44760C21, 0xDA262FD3), LIMB_PARTIAL(0x058),
+            LIMB_PAIR(0xA6DFC562, 0xA8F9432D), LIMB_PAIR(0xDC54C213, 0x0C7B74EC), LIMB_PAIR(0xDF24C7E3, 0x56B4B751), LIMB_PAIR(0xB42C77D2, 0x5B32314B),
+            LIMB_PAIR(0x19053195, 0xCF2312A4), LIMB_PAIR(0x4F2C75EB, 0x60BF2214), LIMB_PAIR(0x71877095, 0x02078841), LIMB_PAIR(0xA44F75FA, 0x8ACD999D), LIMB_PARTIAL(0x152)
+        },
+        {   // 3 * 16^43 * G
+            LIMB_PAIR(0x6DA23955, 0xFBDD71D7), LIMB_PAIR(0x4E9DCA11, 0x58AED61E), LIMB_PAIR(0xC41906AC, 0xC8F75DDC), LIMB_PAIR(0x8AE30A21, 0x37020B11),
+            LIMB_PAIR(0x3FE85C4F, 0xF9129523), LIMB_PAIR(0xBE4B3724, 0x201400FD), LIMB_PAIR(0x3A2D4446, 0x9739962D), LIMB_PAIR(0xA0F4B655, 0x917E35CD), LIMB_PARTIAL(0x18F),
+            LIMB_PAIR(0xAE9E0FFD, 0x99496B29), LIMB_PAIR(0x6DC1CB95, 0x98A9369F), LIMB_PAIR(0xCF116E11, 0x5DB5CA11), LIMB_PAIR(0x08FB818C, 0x3DF10D85),
+            LIMB_PAIR(0x91DDCD37, 0xDDC80CC9), LIMB_PAIR(0x496AF53B, 0x8E8647DA), LIMB_PAIR(0x573A894A, 0xE244C394), LIMB_PAIR(0x41B4DE2D, 0x056A45E7), LIMB_PARTIAL(0x1A1)
+        },
+        {   // 4 * 16^43 * G
+            LIMB_PAIR(0x40B0A066, 0x0CFA67A6), LIMB_PAIR(0x8057A710, 0xE97C179E), LIMB_PAIR(0x27CCE600, 0xB69D2852), LIMB_PAIR(0x419687D1, 0xF7DDE8C5),
+            LIMB_PAIR(0x5D5B039E, 0xDBCB1518), LIMB_PAIR(0xD99ABBE0, 0x3E47772F), LIMB_PAIR(0xB2A9C6A0, 0x71C9C23A), LIMB_PAIR(0x94496951, 0x5AF10B9B), LIMB_PARTIAL(0x152),
+            LIMB_PAIR(0x2C91F83A, 0x0F96137F), LIMB_PAIR(0x49F15B33, 0x1F743FA4), LIMB_PAIR(0xCCB4C1B1, 0xD43B3EC0), LIMB_PAIR(0xCFEEA9B0, 0x895A3BE3),
+            LIMB_PAIR(0x9EEFEE4D, 0x27C3B495), LIMB_PAIR(0x12E344EE, 0xF1B42127), LIMB_PAIR(0xFF929C1E, 0x023AFA76), LIMB_PAIR(0x86D07325, 0x30780976), LIMB_PARTIAL(0x166)
+        },
+        {   // 5 * 16^43 * G
+            LIMB_PAIR(0x17D2C887, 0x1EF0C5B0), LIMB_PAIR(0x8F4493FA, 0xA593F011), LIMB_PAIR(0x63D4A941, 0xCAA027ED), LIMB_PAIR(0x055891B3, 0x56EDD1A0),
+            LIMB_PAIR(0x5AE7958F, 0x2597E88C), LIMB_PAIR(0xB9B6B189, 0x3CB83F5E), LIMB_PAIR(0x94645703, 0x8A80C84B), LIMB_PAIR(0x4537080E, 0x31B75296), LIMB_PARTIAL(0x127),
+            LIMB_PAIR(0xDC5510D8, 0x4A72FA41), LIMB_PAIR(0x56098683, 0x0974F66B), LIMB_PAIR(0x3EF53A52, 0xCEC5E8FF), LIMB_PAIR(0x6B7DB395, 0xFA5D5DDD),
+            LIMB_PAIR(0x2085C160, 0xBEE1560F), LIMB_PAIR(0x673DAC7C, 0x51C86C14), LIMB_PAIR(0x8F72CB17, 0x0A932E8B), LIMB_PAIR(0x2D25A31B, 0xCE685250), LIMB_PARTIAL(0x17D)
+        },
+        {   // 6 * 16^43 * G
+            LIMB_PAIR(0x319E0473, 0x391FEC22), LIMB_PAIR(0x36CB975A, 0x132AE721), LIMB_PAIR(0x9B4103FC, 0x8E19553F), LIMB_PAIR(0xB6D2519F, 0x7F8620C5),
+            LIMB_PAIR(0x55939065, 0xFDD0B5E9), LIMB_PAIR(0xA3A9CA34, 0xBF94F747), LIMB_PAIR(0x6C7BA280, 0x2FD846E0), LIMB_PAIR(0xDFF222E1, 0x078E04DC), LIMB_PARTIAL(0x0D0),
+            LIMB_PAIR(0x368BB5DA, 0x3DDE6C64), LIMB_PAIR(0x0610B78E, 0x6B541065), LIMB_PAIR(0x23150BEB, 0x1E585E30), LIMB_PAIR(0x5920AAEB, 0xC4692E42),
+            LIMB_PAIR(0xC029F242, 0xA2DD9BFD), LIMB_PAIR(0x155B6F21, 0xA51A8149), LIMB_PAIR(0x103C25E8, 0x95450D43), LIMB_PAIR(0xDD889055, 0x1E3B7D3C), LIMB_PARTIAL(0x197)
+        },
+        {   // 7 * 16^43 * G
+            LIMB_PAIR(0x1BD83A5C, 0x859D6C56), LIMB_PAIR(0x28DBA1F4, 0x239053EE), LIMB_PAIR(0x4A37DDF2, 0x999651C0), LIMB_PAIR(0xD207328F, 0xA0A6C58B),
+            LIMB_PAIR(0xDAAA8A32, 0xDCECFDE0), LIMB_PAIR(0xB45DCD62, 0xAF7D07B9), LIMB_PAIR(0x646E6CA5, 0x22D90DA5), LIMB_PAIR(0x89796B5E, 0xEFADE502), LIMB_PARTIAL(0x142),
+            LIMB_PAIR(0x2C783BDF, 0xAFA5AF77), LIMB_PAIR(0x0C12453C, 0xC24F65BD), LIMB_PAIR(0x06EBFA19, 0x1B84276E), LIMB_PAIR(0x05A96B12, 0x3B11B679),
+            LIMB_PAIR(0x13D7B934, 0x12F6B076), LIMB_PAIR(0x626F6201, 0x27DFB98D), LIMB_PAIR(0x9E534BF8, 0x0B942F47), LIMB_PAIR(0x27A320EC, 0xAE1D2D91), LIMB_PARTIAL(0x14D)
+        },
+        {   // 8 * 16^43 * G
+            LIMB_PAIR(0x658B96B8, 0x48A2FC84), LIMB_PAIR(0x465EBF34, 0x039AF24C), LIMB_PAIR(0x4F404EB3, 0xA7A9B014), LIMB_PAIR(0x763AB5C4, 0x80176EF0),
+            LIMB_PAIR(0x6B5617AD, 0xD4984B13), LIMB_PAIR(0x9195EE81, 0xA6A39ED8), LIMB_PAIR(0x05C2EFF8, 0x1CE29749), LIMB_PAIR(0x1281FA56, 0x78AEFF6C), LIMB_PARTIAL(0x199),
+            LIMB_PAIR(0x10374F0A, 0x40CF4623), LIMB_PAIR(0x958219F6, 0x89212E99), LIMB_PAIR(0x27B97CBA, 0xE7599B20), LIMB_PAIR(0x9E551710, 0x1AE1CB65),
+            LIMB_PAIR(0x502E6670, 0x62881658), LIMB_PAIR(0x76E23A8C, 0x8F78CCF8), LIMB_PAIR(0x732CC46E, 0x78E165AD), LIMB_PAIR(0xF7670684, 0xD6B5AB1C), LIMB_PARTIAL(0x14A)
+        }
+    },
+#endif
+#if (44 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^44 * G
+            LIMB_PAIR(0xDA44FF51, 0xB342D85D), LIMB_PAIR(0xD08596FF, 0x54BA0522), LIMB_PAIR(0xB0AC99C2, 0x3DA8E8CE), LIMB_PAIR(0x91F37DCB, 0xCEBE6A96),
+            LIMB_PAIR(0xC24D7D1C, 0x8EBAD3D9), LIMB_PAIR(0xC75945EF, 0xF11A4319), LIMB_PAIR(0xED1AC001, 0xD4DFE534), LIMB_PAIR(0x1A521E4D, 0x745E2772), LIMB_PARTIAL(0x0C4),
+            LIMB_PAIR(0xDF65E0BB, 0x745E5B41), LIMB_PAIR(0x3B84ED58, 0xF8887B53), LIMB_PAIR(0x9C0684EA, 0x1A54BC47), LIMB_PAIR(0xCE9C7672, 0xFD4F1D36),
+            LIMB_PAIR(0xCE5730FC, 0x490BC265), LIMB_PAIR(0x8430ADB9, 0x2FA1AD6D), LIMB_PAIR(0xB7DB19B4, 0x0F117BDC), LIMB_PAIR(0x9C246E44, 0xBD339A78), LIMB_PARTIAL(0x05B)
+        },
+        {   // 2 * 16^44 * G
+            LIMB_PAIR(0xE19A881C, 0x5F8FD91A), LIMB_PAIR(0x8CF8A2C3, 0x355105B0), LIMB_PAIR(0x2810E499, 0x442B9778), LIMB_PAIR(0xDA7972C5, 0x930D835A),
+            LIMB_PAIR(0x555EF4D8, 0xD2266522), LIMB_PAIR(0x64E05B06, 0x943D9ADB), LIMB_PAIR(0x42FC02FA, 0x480BD27F), LIMB_PAIR(0x699E5B7E, 0x9265B289), LIMB_PARTIAL(0x08D),
+            LIMB_PAIR(0x55C7CD14, 0xB60DF9C8), LIMB_PAIR(0x270E2672, 0x62131E73), LIMB_PAIR(0x672942B7, 0xE6983794), LIMB_PAIR(0x817DB72E, 0xBF8C55D1),
+            LIMB_PAIR(0x08A5963D, 0xC3785F36), LIMB_PAIR(0x8F39218C, 0x4A664609), LIMB_PAIR(0x1B5B49CC, 0x95C86854), LIMB_PAIR(0x178DF85C, 0x045A0243), LIMB_PARTIAL(0x019)
+        },
+        {   // 3 * 16^44 * G
+            LIMB_PAIR(0xB666FF60, 0xCCC1BB64), LIMB_PAIR(0xBA04B5C3, 0xE786F358), LIMB_PAIR(0x384C0AD4, 0xBCD5E56D), LIMB_PAIR(0xD0372BBD, 0x5D22436F),
+            LIMB_PAIR(0xA061A543, 0xFEEA9ED9), LIMB_PAIR(0xFA3D34BE, 0x6F81F168), LIMB_PAIR(0x4BA47193, 0xF52059D2), LIMB_PAIR(0x4ADA65AD, 0x5FF05589), LIMB_PARTIAL(0x06F),
+            LIMB_PAIR(0x6D4CABF2, 0x346ADED5), LIMB_PAIR(0x4F1A8EE1, 0x65E4B11F), LIMB_PAIR(0x07EBA73A, 0x1521718B), LIMB_PAIR(0xD16D7D56, 0x8A2F32BA),
+            LIMB_PAIR(0xD3ACBB17, 0x01D49595), LIMB_PAIR(0xD3F62095, 0x67625FAA), LIMB_PAIR(0x613B6059, 0x7C3CBECF), LIMB_PAIR(0x6118C496, 0x3908F650), LIMB_PARTIAL(0x16B)
+        },
+        {   // 4 * 16^44 * G
+            LIMB_PAIR(0xCAB2443D, 0x06494428), LIMB_PAIR(0x6AFD7840, 0xC52AD2D8), LIMB_PAIR(0xFCE7B5F7, 0x8EF6E0A6), LIMB_PAIR(0xA82AE7E3, 0x6151D2B3),
+            LIMB_PAIR(0x14E3B825, 0x08ABB38A), LIMB_PAIR(0x366CADA3, 0x9782E6F9), LIMB_PAIR(0x5076C2FF, 0x9F0127B2), LIMB_PAIR(0x2D812ED5, 0x2F29B728), LIMB_PARTIAL(0x04F),
+            LIMB_PAIR(0x04E049F5, 0x7142E7E0), LIMB_PAIR(0xD7F99E76, 0x9338A870), LIMB_PAIR(0x72A90177, 0xF7E4837B), LIMB_PAIR(0x11AACD17, 0xA7BFF799),
+            LIMB_PAIR(0xD1D10B06, 0x5442D6F2), LIMB_PAIR(0x5ECC3F54, 0x986E7BC4), LIMB_PAIR(0x31286FE1, 0x02CF3818), LIMB_PAIR(0xCD383EAC, 0x5CDC56D1), LIMB_PARTIAL(0x02D)
+        },
+        {   // 5 * 16^44 * G
+            LIMB_PAIR(0xC80291F9, 0x7303EC69), LIMB_PAIR(0x0C9FF7F4, 0x0F2C6439), LIMB_PAIR(0xF3ADA285, 0x96C08EA0), LIMB_PAIR(0xDEAE887C, 0x3CB50F3D),
+            LIMB_PAIR(0xFEFE26DC, 0xABA571FA), LIMB_PAIR(0x6C6F1071, 0x4E4DBA33), LIMB_PAIR(0xF02BDA38, 0xF5796982), LIMB_PAIR(0x40485DE2, 0xA59C60B1), LIMB_PARTIAL(0x0A1),
+            LIMB_PAIR(0xCAB044F7, 0x28D7C281), LIMB_PAIR(0x515D247A, 0xA5EB04FE), LIMB_PAIR(0xBA014B10, 0x5B42D919), LIMB_PAIR(0xDE221CC1, 0xB150B4FB),
+            LIMB_PAIR(0x22A5A502, 0xB5CB8C3A), LIMB_PAIR(0xCC37E34A, 0x62C0DA97), LIMB_PAIR(0x9E827814, 0x4B9BFB1F), LIMB_PAIR(0xC97679AC, 0x96666256), LIMB_PARTIAL(0x0E6)
+        },
+        {   // 6 * 16^44 * G
+            LIMB_PAIR(0x8B894AC8, 0x415FAB9A), LIMB_PAIR(0x64822449, 0xB189914D), LIMB_PAIR(0x0F4B9444, 0x0ABFDBF5), LIMB_PAIR(0xEB96CF1F, 0xA333E872),
+            LIMB_PAIR(0xB8C5318A, 0x91D3473D), LIMB_PAIR(0x24D09CB4, 0xBB5740E6), LIMB_PAIR(0x5B5D73EA, 0xEBE6EF7F), LIMB_PAIR(0x09F67393, 0xBE333388), LIMB_PARTIAL(0x0FC),
+            LIMB_PAIR(0x1FFA22B4, 0x9970D38E), LIMB_PAIR(0x003E55F9, 0x00D1FB74), LIMB_PAIR(0x820F7BFD, 0x0D1EF824), LIMB_PAIR(0x73FC040D, 0x43521251),
+            LIMB_PAIR(0xE51B5870, 0x295F8A66), LIMB_PAIR(0x3DBFE159, 0xCEACB67D), LIMB_PAIR(0xA218D2FE, 0x0EE77417), LIMB_PAIR(0xF3B7D44A, 0x25A0E0A9), LIMB_PARTIAL(0x0F8)
+        },
+        {   // 7 * 16^44 * G
+            LIMB_PAIR(0x83EF0448, 0xC1F76984), LIMB_PAIR(0xFB276974, 0xC4D18389), LIMB_PAIR(0xE52836C2, 0xFEF2C810), LIMB_PAIR(0xC09E4020, 0x3687104B),
+            LIMB_PAIR(0x0CC4BF06, 0xEC3248EF), LIMB_PAIR(0xC401078B, 0x38DAA51B), LIMB_PAIR(0x57BC72F2, 0x84BD9F61), LIMB_PAIR(0x003676EB, 0x68B23E45), LIMB_PARTIAL(0x09D),
+            LIMB_PAIR(0xD78B9D6B, 0x22526E98), LIMB_PAIR(0xC4F28366, 0xC4CCDC71), LIMB_PAIR(0x1C646B9D, 0x7DD12D94), LIMB_PAIR(0x931BD51B, 0x0CC00136),
+            LIMB_PAIR(0x512EC8A6, 0xFEBF1E1E), LIMB_PAIR(0xBDC888B1, 0x6BC281F6), LIMB_PAIR(0xF6AB354F, 0x0BC271F3), LIMB_PAIR(0x30C4E559, 0x27D1EE76), LIMB_PARTIAL(0x038)
+        },
+        {   // 8 * 16^44 * G
+            LIMB_PAIR(0x4ACCCF77, 0x12427D32), LIMB_PAIR(0xFB77F869, 0x3194664F), LIMB_PAIR(0x61A58E24, 0x07E01CAC), LIMB_PAIR(0x91BF22B5, 0xC506637B),
+            LIMB_PAIR(0xDD2D701A, 0xCE7D0251), LIMB_PAIR(0xBEFC0D7F, 0xF9A662D4), LIMB_PAIR(0x2C6C9454, 0xA54117BA), LIMB_PAIR(0x6978E919, 0x31864E41), LIMB_PARTIAL(0x07C),
+            LIMB_PAIR(0x9D971044, 0xBBE41902), LIMB_PAIR(0xF8F24116, 0x68742001), LIMB_PAIR(0x3E4A40EC, 0x6D006593), LIMB_PAIR(0x82771429, 0x9FC1B8E2),
+            LIMB_PAIR(0x2E7968CA, 0x59B2F934), LIMB_PAIR(0x470DD353, 0x4817F90B), LIMB_PAIR(0x7E2C1429, 0x3D32E10F), LIMB_PAIR(0x00206509, 0x43E9474E), LIMB_PARTIAL(0x076)
+        }
+    },
+#endif
+#if (45 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^45 * G
+            LIMB_PAIR(0x851368EE, 0xC03C182D), LIMB_PAIR(0x57C919F2, 0xBB94A33D), LIMB_PAIR(0xE333ACE3, 0x9CF0C767), LIMB_PAIR(0xD974DE7F, 0x037C7D47),
+            LIMB_PAIR(0x8B18FA5C, 0xE96E02CF), LIMB_PAIR(0x26CF35F7, 0x6F1A3E91), LIMB_PAIR(0x33486C59, 0x47AFFDC0), LIMB_PAIR(0xEC8C2A2B, 0x2C370BFE), LIMB_PARTIAL(0x0E1),
+            LIMB_PAIR(0x18A3F84B, 0xDCE5DE2C), LIMB_PAIR(0x2AD42CA2, 0xC4BB672E), LIMB_PAIR(0xDD0731B2, 0xB6581D7E), LIMB_PAIR(0x2809AC7E, 0xB6CA46CA),
+            LIMB_PAIR(0x189B0FF8, 0xDE8EDBA2), LIMB_PAIR(0x1FF4631D, 0xA72EE3E8), LIMB_PAIR(0xF1004BCB, 0xF44A8FC6), LIMB_PAIR(0xC8878531, 0x103DD1B9), LIMB_PARTIAL(0x1CA)
+        },
+        {   // 2 * 16^45 * G
+            LIMB_PAIR(0x0A0EB364, 0xCB35DF1C), LIMB_PAIR(0x6EFAA084, 0x6D047960), LIMB_PAIR(0x3735CE56, 0x2AE2D283), LIMB_PAIR(0xDF82FDFF, 0xE0B9D7E8),
+            LIMB_PAIR(0x39CF5AB2, 0xFF7A316C), LIMB_PAIR(0x26B6C05F, 0x23254F4E), LIMB_PAIR(0xE5C125FD, 0x4751CB2D), LIMB_PAIR(0x894E9A61, 0xFA059629), LIMB_PARTIAL(0x148),
+            LIMB_PAIR(0x49112ECC, 0xE64CA47B), LIMB_PAIR(0xF5FD0DD6, 0xF4F9F08C), LIMB_PAIR(0x74BDC4B6, 0xAD1C8C72), LIMB_PAIR(0xBBA001E4, 0x34660962),
+            LIMB_PAIR(0x7E2AD36F, 0x346D7A40), LIMB_PAIR(0xD27181B2, 0x68C8B34B), LIMB_PAIR(0x3B424E34, 0x8AEB7EA4), LIMB_PAIR(0xD4498D11, 0x257AB659), LIMB_PARTIAL(0x1F2)
+        },
+        {   // 3 * 16^45 * G
+            LIMB_PAIR(0xDE024391, 0x98A781D5), LIMB_PAIR(0xAE6A8131, 0xA4E752B1), LIMB_PAIR(0x88919924, 0x8AD7E980), LIMB_PAIR(0x57C8DEE7, 0x5700178A),
+            LIMB_PAIR(0x28FA8EA8, 0x531AD672), LIMB_PAIR(0x96B9FC60, 0x625C0889), LIMB_PAIR(0xA848FF64, 0x9B13BB3D), LIMB_PAIR(0xC12E0A98, 0xA9AD8CEF), LIMB_PARTIAL(0x118),
+            LIMB_PAIR(0x9E9AB68C, 0x0D4B05DA), LIMB_PAIR(0x94C26124, 0x318DBB73), LIMB_PAIR(0xDF5F527C, 0x1F377147), LIMB_PAIR(0xAF077B4D, 0x14A59165),
+            LIMB_PAIR(0xBB4AC96E, 0xC8EE5181), LIMB_PAIR(0x8F13CFB7, 0x4C90381B), LIMB_PAIR(0x233547D1, 0xE84349C8), LIMB_PAIR(0x58F7DA4F, 0x75AA5EA4), LIMB_PARTIAL(0x03B)
+        },
+        {   // 4 * 16^45 * G
+            LIMB_PAIR(0xBB5BE7E6, 0xAD57280A), LIMB_PAIR(0x066E97A7, 0xF102FF10), LIMB_PAIR(0x61C86340, 0x5308CB8E), LIMB_PAIR(0xD02E15C2, 0x11B53155),
+            LIMB_PAIR(0xEF223374, 0x50ED7916), LIMB_PAIR(0x1EE821E2, 0x8C48F837), LIMB_PAIR(0x7931B97C, 0x0B3010CF), LIMB_PAIR(0x2062EC30, 0xB84CD014), LIMB_PARTIAL(0x007),
+            LIMB_PAIR(0x24B6E1EB, 0x05A7A5A0), LIMB_PAIR(0xB5A7402D, 0xF8364D18), LIMB_PAIR(0xF9EB3538, 0x2B9EC6C5), LIMB_PAIR(0x05915B41, 0xF363DAC9),
+            LIMB_PAIR(0xA7909CB6, 0x2A567784), LIMB_PAIR(0x22FA3BAD, 0x5B386EAD), LIMB_PAIR(0x1E873FBF, 0x646554B9), LIMB_PAIR(0xB88CA34C, 0x99F6AD72), LIMB_PARTIAL(0x077)
+        },
+        {   // 5 * 16^45 * G
+            LIMB_PAIR(0x19496A3E, 0x26779CC4), LIMB_PAIR(0xB93F9890, 0x1C474EEC), LIMB_PAIR(0xC70FCAE2, 0x8528F2F4), LIMB_PAIR(0xC43683B3, 0xC9DDBB4C),
+            LIMB_PAIR(0xF3B3593F, 0xE33EE677), LIMB_PAIR(0x714608BB, 0xA3AE1C99), LIMB_PAIR(0xAB92D89E, 0x8A15A48B), LIMB_PAIR(0xC4C8344B, 0x1549D787), LIMB_PARTIAL(0x0E8),
+            LIMB_PAIR(0xD4B88B67, 0xFA337896), LIMB_PAIR(0x0B45613E, 0xB092967F), LIMB_PAIR(0x1ED2840E, 0x99266FAA), LIMB_PAIR(0x8480FCAA, 0x97385E81),
+            LIMB_PAIR(0xBF834C19, 0xCFC9058B), LIMB_PAIR(0xA89D1623, 0xD4A622D5), LIMB_PAIR(0xA101CC1F, 0xAA93E9DB), LIMB_PAIR(0x3DA3113F, 0x619A1E81), LIMB_PARTIAL(0x0B3)
+        },
+        {   // 6 * 16^45 * G
+            LIMB_PAIR(0x5CAB16FC, 0xD788D656), LIMB_PAIR(0x04629E7C, 0xDD54608E), LIMB_PAIR(0xE4DF5CAD, 0x4894360C), LIMB_PAIR(0xCDE428B9, 0x51B4F25D),
+            LIMB_PAIR(0x39F2D01D, 0x3CFC9905), LIMB_PAIR(0x7964F228, 0x664D9AE4), LIMB_PAIR(0x8A298C8B, 0x1D1263B5), LIMB_PAIR(0x76767ABD, 0xA717BD73), LIMB_PARTIAL(0x1F8),
+            LIMB_PAIR(0x69CE9CC3, 0xC8928094), LIMB_PAIR(0xA9530906, 0xCB8AD7C3), LIMB_PAIR(0xBE8A003E, 0x5DCE307C), LIMB_PAIR(0xEC971C0C, 0x73DEEB54),
+            LIMB_PAIR(0x25DAC8D4, 0xBDE8A120), LIMB_PAIR(0x06FE1D7B, 0x4F0D4E85), LIMB_PAIR(0x356B11F5, 0x9599E1F1), LIMB_PAIR(0x23F1AE8E, 0xB4218AF5), LIMB_PARTIAL(0x197)
+        },
+        {   // 7 * 16^45 * G
+            LIMB_PAIR(0xD076683D, 0xA676BEE0), LIMB_PAIR(0x21D6BEBD, 0x4F0C0843), LIMB_PAIR(0xDC7657E6, 0x53C8011E), LIMB_PAIR(0x234C59B6, 0x5E0E0192),
+            LIMB_PAIR(0x1EA313A8, 0xFFEBC6D1), LIMB_PAIR(0xBCB84AFD, 0xA8CCEF85), LIMB_PAIR(0x138327C5, 0xC8F930C3), LIMB_PAIR(0xB83994BB, 0x6A9EB749), LIMB_PARTIAL(0x1CC),
+            LIMB_PAIR(0xBB99594F, 0xAAB00795), LIMB_PAIR(0xF1BE2F9E, 0x5F27CE0E), LIMB_PAIR(0x524F18BF, 0xF76A4760), LIMB_PAIR(0xA8D81CF9, 0xDE00974E),
+            LIMB_PAIR(0x5A0A5A67, 0x2AE521AA), LIMB_PAIR(0x46986D91, 0xAABF5EA9), LIMB_PAIR(0xC3713B98, 0x26D97947), LIMB_PAIR(0x32AB0EEE, 0x6B040E0F), LIMB_PARTIAL(0x177)
+        },
+        {   // 8 * 16^45 * G
+            LIMB_PAIR(0xFC3D5A8E, 0x8F37E861), LIMB_PAIR(0x901CE1A2, 0xD09D8E74), LIMB_PAIR(0x92F81574, 0x212E32A9), LIMB_PAIR(0x0D96A933, 0x38AC8BA6),
+            LIMB_PAIR(0xB84C99D4, 0x3D990B98), LIMB_PAIR(0xDF58647B, 0xB97F4E73), LIMB_PAIR(0x7641888C, 0x95AE93CC), LIMB_PAIR(0xA0969DD3, 0xD7BDB083), LIMB_PARTIAL(0x182),
+            LIMB_PAIR(0x17830426, 0x6531530C), LIMB_PAIR(0x8A57B683, 0x9DB488F4), LIMB_PAIR(0x0D87ECA3, 0x9452CA0F), LIMB_PAIR(0x8B4BE2A7, 0x19B198F0),
+            LIMB_PAIR(0x2775F0FC, 0x17939AB2), LIMB_PAIR(0x25BC5C0C, 0x7F662A06), LIMB_PAIR(0x428884F3, 0xDF04CBEF), LIMB_PAIR(0x9F9FF142, 0xA4D20220), LIMB_PARTIAL(0x090)
+        }
+    },
+#endif
+#if (46 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^46 * G
+            LIMB_PAIR(0x31FF6E80, 0x4585D3AA), LIMB_PAIR(0xC19AE65B, 0x8521AC35), LIMB_PAIR(0xF9F78334, 0x983E0C6A), LIMB_PAIR(0x435DB0F0, 0xC4131279),
+            LIMB_PAIR(0x51BDB67F, 0x0F2D350B), LIMB_PAIR(0xD65D265F, 0x1FEA5391), LIMB_PAIR(0x798E80AA, 0x7F0B55F7), LIMB_PAIR(0xD549EAA9, 0xF322493A), LIMB_PARTIAL(0x0CE),
+            LIMB_PAIR(0xFE9E5DAB, 0xDF7B80AA), LIMB_PAIR(0x1861E785, 0x5585F93A), LIMB_PAIR(0xBBB5764C, 0xB70FA9AB), LIMB_PAIR(0x3A39EF40, 0x23CE8AED),
+            LIMB_PAIR(0x14920FF9, 0xA719329A), LIMB_PAIR(0x4A00E5B9, 0xA7451112), LIMB_PAIR(0xFF5C3588, 0x48B0001B), LIMB_PAIR(0x0E0551CE, 0x8DCB5FE1), LIMB_PARTIAL(0x0F1)
+        },
+        {   // 2 * 16^46 * G
+            LIMB_PAIR(0x797EE80D, 0xDAA72EBC), LIMB_PAIR(0x13BDE073, 0x5EE6DE5E), LIMB_PAIR(0xA69B5019, 0x8F21FD78), LIMB_PAIR(0x89191DF9, 0x5A8FCE8C),
+            LIMB_PAIR(0x725F4F61, 0xCE39466D), LIMB_PAIR(0xD258C98E, 0xE1015721), LIMB_PAIR(0xBFB1ACC6, 0x22A2F6A5), LIMB_PAIR(0x97265EAE, 0x5DFEF1DA), LIMB_PARTIAL(0x164),
+            LIMB_PAIR(0x82470CAD, 0x46978048), LIMB_PAIR(0x92E3DAEE, 0x5A62DE6C), LIMB_PAIR(0x9163A136, 0x95CBC019), LIMB_PAIR(0xF0AD7FBE, 0xD1F51A60),
+            LIMB_PAIR(0xF2380828, 0xD300B7C6), LIMB_PAIR(0xB1246DF8, 0x3FCE67F4), LIMB_PAIR(0x466EC418, 0x6AEC1313), LIMB_PAIR(0x6063CE6F, 0x95FFD285), LIMB_PARTIAL(0x080)
+        },
+        {   // 3 * 16^46 * G
+            LIMB_PAIR(0x2EB6D453, 0xD3107DC4), LIMB_PAIR(0xA3F6B312, 0x3897A60B), LIMB_PAIR(0xA26EBD5E, 0x5D8AE4B9), LIMB_PAIR(0x445F3EA9, 0xF83E1EFA),
+            LIMB_PAIR(0xE9C5AE62, 0xCDF3F2D6), LIMB_PAIR(0xFE4A7F11, 0x43624A7F), LIMB_PAIR(0x6634235D, 0x9169460F), LIMB_PAIR(0x2F75464E, 0x642B8B11), LIMB_PARTIAL(0x186),
+            LIMB_PAIR(0xC84496A4, 0x7924B1CD), LIMB_PAIR(0x5F8F5F30, 0x0A5EB42C), LIMB_PAIR(0x492CD04A, 0x14068D49), LIMB_PAIR(0xF2A5F227, 0xE0824856),
+            LIMB_PAIR(0xAD328ED4, 0x6E146CDE), LIMB_PAIR(0x9118FABD, 0xC63A68C1), LIMB_PAIR(0x7E56624B, 0xA295B412), LIMB_PAIR(0x87055125, 0xC1D31ED1), LIMB_PARTIAL(0x01E)
+        },
+        {   // 4 * 16^46 * G
+            LIMB_PAIR(0x6910D714, 0x241872E3), LIMB_PAIR(0xCF96F106, 0xDFCD9DB5), LIMB_PAIR(0xCB3A51E7, 0xD32E27FA), LIMB_PAIR(0xC4A051C2, 0xA55ECAEA),
+            LIMB_PAIR(0xF8944204, 0xFC54759A), LIMB_PAIR(0xF938B503, 0x569D9EFD), LIMB_PAIR(0xC54BF05F, 0x8882AB15), LIMB_PAIR(0x0CAB8124, 0x9A8869ED), LIMB_PARTIAL(0x007),
+            LIMB_PAIR(0x361CE52A, 0x1F5995BF), LIMB_PAIR(0xB51EE176, 0xDA53A556), LIMB_PAIR(0xCB664A03, 0x735BFCD6), LIMB_PAIR(0x38486DE8, 0x4D8E405D),
+            LIMB_PAIR(0xA807C481, 0xEECA6379), LIMB_PAIR(0x4D456D2E, 0x9A24AC8A), LIMB_PAIR(0x3B85AB21, 0x159B9F4C), LIMB_PAIR(0xF256C82E, 0x77524D58), LIMB_PARTIAL(0x125)
+        },
+        {   // 5 * 16^46 * G
+            LIMB_PAIR(0x6E0604E7, 0xD83376B0), LIMB_PAIR(0xB9BDABCD, 0xF3DA2540), LIMB_PAIR(0xB0069B9C, 0x8A64129A), LIMB_PAIR(0x4ED21F8A, 0xF98D8A69),
+            LIMB_PAIR(0x17C1FDD1, 0xCD7950FB), LIMB_PAIR(0xA1B303F3, 0x988AC822), LIMB_PAIR(0x44468A4A, 0x2D6DC224), LIMB_PAIR(0x23F65549, 0xED780EB1), LIMB_PARTIAL(0x0C2),
+            LIMB_PAIR(0x7C4F29CB, 0x38E4F1E1), LIMB_PAIR(0x63776AF6, 0x030F5636), LIMB_PAIR(0x8032B066, 0xEA357F37), LIMB_PAIR(0x2141EBBA, 0xBC96AFA1),
+            LIMB_PAIR(0x7CACBE45, 0xE1396E9F), LIMB_PAIR(0xC62172A2, 0xDC5E9F07), LIMB_PAIR(0xA26039A1, 0x00CA038F), LIMB_PAIR(0x96C93FA4, 0x23796EDF), LIMB_PARTIAL(0x14B)
+        },
+        {   // 6 * 16^46 * G
+            LIMB_PAIR(0x1BCF9917, 0x20F7C6EE), LIMB_PAIR(0x8CBC7D2A, 0x1C7D940F), LIMB_PAIR(0xD592DEF0, 0xC2A1139E), LIMB_PAIR(0x936C827A, 0x0B6B644A),
+            LIMB_PAIR(0xABB4F3EB, 0x1B16BF59), LIMB_PAIR(0x16B8B498, 0x1693FE79), LIMB_PAIR(0xADBF552E, 0x4B81CF5B), LIMB_PAIR(0x7E0CB980, 0x620EF3BE), LIMB_PARTIAL(0x1A3),
+            LIMB_PAIR(0x2F6F9A16, 0x6106878F), LIMB_PAIR(0x6CF02778, 0x15C2303E), LIMB_PAIR(0x7F7E7E27, 0x18C605CF), LIMB_PAIR(0x98A8DE3F, 0x6BD45DC7),
+            LIMB_PAIR(0x95869DDE, 0x58741720), LIMB_PAIR(0x2DE20D0A, 0x621D8A4B), LIMB_PAIR(0xDCA67562, 0x7632703C), LIMB_PAIR(0x36957EEC, 0x9374D055), LIMB_PARTIAL(0x0F1)
+        },
+        {   // 7 * 16^46 * G
+            LIMB_PAIR(0x3A12BE03, 0x2D0E0E8C), LIMB_PAIR(0x75AAA59D, 0xA4FEBEBA), LIMB_PAIR(0x7E8056D8, 0xE5AC02D6), LIMB_PAIR(0xBACD030C, 0xF3788C67),
+            LIMB_PAIR(0x21FDA504, 0x4018AE39), LIMB_PAIR(0xF16AA240, 0x690259DC), LIMB_PAIR(0x91AD5D2F, 0xF51723B2), LIMB_PAIR(0x1F0AA525, 0x9CF89322), LIMB_PARTIAL(0x166),
+            LIMB_PAIR(0x09388E2C, 0x0F4B0C2A), LIMB_PAIR(0xF40B8763, 0xB8308CEF), LIMB_PAIR(0x61A66221, 0x24624580), LIMB_PAIR(0x165AAA95, 0xB67A79E8),
+            LIMB_PAIR(0x08789BC2, 0x94BC0B47), LIMB_PAIR(0x08114D2C, 0x8B234C87), LIMB_PAIR(0xBEC8D5EF, 0x1EE26556), LIMB_PAIR(0xF315D134, 0x22E3055D), LIMB_PARTIAL(0x118)
+        },
+        {   // 8 * 16^46 * G
+            LIMB_PAIR(0xBD385E53, 0xF43E7556), LIMB_PAIR(0x875C0190, 0xBF8F9681), LIMB_PAIR(0x555BD31F, 0xE3D90DEE), LIMB_PAIR(0x6EDFE5EC, 0x3BAF6554),
+            LIMB_PAIR(0x960E906D, 0x3D6DF218), LIMB_PAIR(0x873D0635, 0x7B6635CB), LIMB_PAIR(0xDED25371, 0x98A44993), LIMB_PAIR(0xAD8E24B4, 0x918B7555), LIMB_PARTIAL(0x0D7),
+            LIMB_PAIR(0x6553287B, 0xB776F914), LIMB_PAIR(0x6FA9FA1D, 0x7075A0A3), LIMB_PAIR(0x11D5513D, 0x7BC1D77C), LIMB_PAIR(0x7993F668, 0x789A1986),
+            LIMB_PAIR(0x612A7F5A, 0x6162A249), LIMB_PAIR(0x4EE7F938, 0x04348EB0), LIMB_PAIR(0x56583274, 0xF7102CEB), LIMB_PAIR(0xE356E7BB, 0xAE423442), LIMB_PARTIAL(0x002)
+        }
+    },
+#endif
+#if (47 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^47 * G
+            LIMB_PAIR(0xCFD387AD, 0xDBEEB421), LIMB_PAIR(0x5BB4D523, 0xD208FE08), LIMB_PAIR(0xED24EDF7, 0xFF2282DB), LIMB_PAIR(0xC806B492, 0x30556FF9),
+            LIMB_PAIR(0xD5B5BF57, 0xE7716C3C), LIMB_PAIR(0x153FB3B2, 0x847E3A43), LIMB_PAIR(0x391809C5, 0xE9A8FB3C), LIMB_PAIR(0x92596244, 0x52B4A729), LIMB_PARTIAL(0x1C0),
+            LIMB_PAIR(0x59D9AE12, 0xE49B344E), LIMB_PAIR(0xC925B6DA, 0x5A5E32A1), LIMB_PAIR(0xF054A1C6, 0xE81D38D1), LIMB_PAIR(0xF15FB6D7, 0x4AE4FE0C),
+            LIMB_PAIR(0x5CF03296, 0x6EF46DCD), LIMB_PAIR(0x12DA300D, 0xBF46B976), LIMB_PAIR(0x35FA7FDD, 0xFB373FE8), LIMB_PAIR(0x62BCAF82, 0x0F78E5EE), LIMB_PARTIAL(0x03B)
+        },
+        {   // 2 * 16^47 * G
+            LIMB_PAIR(0x7A56433E, 0x9F303424), LIMB_PAIR(0x60307947, 0xBBFA0FD9), LIMB_PAIR(0x31DB3E3D, 0x21C78CD3), LIMB_PAIR(0x0A2A5F1F, 0xA837641C),
+            LIMB_PAIR(0x56B8BDF5, 0x28338EFB), LIMB_PAIR(0xF0600D27, 0xC0B66594), LIMB_PAIR(0x5CB9A3BC, 0xC0739931), LIMB_PAIR(0x5267267A, 0x95EAC171), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0x897F04B2, 0xE9EE22D1), LIMB_PAIR(0x4CDE7DFB, 0xB6002A03), LIMB_PAIR(0x3C3B494C, 0xCBB7BE48), LIMB_PAIR(0x670F740C, 0xBE6C1A98),
+            LIMB_PAIR(0x1FC603E2, 0x9E9D0B91), LIMB_PAIR(0x351C0915, 0x532AF80C), LIMB_PAIR(0x79802339, 0x0BBF9EA3), LIMB_PAIR(0xDD33D50B, 0x96C16ECA), LIMB_PARTIAL(0x02B)
+        },
+        {   // 3 * 16^47 * G
+            LIMB_PAIR(0xEC95BFBB, 0x7E8AE915), LIMB_PAIR(0x8CC39CC3, 0x7B4BCC89), LIMB_PAIR(0x3F466A65, 0xD7A389BF), LIMB_PAIR(0xE8BA8813, 0x7620F5E1),
+            LIMB_PAIR(0x9100972C, 0xEA27DE5B), LIMB_PAIR(0xD8D87E7A, 0xD6CF9430), LIMB_PAIR(0xB4FDAE7E, 0x78B6E5F8), LIMB_PAIR(0x9A216A4B, 0x921A7E32), LIMB_PARTIAL(0x10A),
+            LIMB_PAIR(0xEC6C2D84, 0xBDB7E79B), LIMB_PAIR(0xDB16F282, 0xE77C3945), LIMB_PAIR(0x411BE2D3, 0x6ECD2885), LIMB_PAIR(0xB4D40D53, 0xCB034559),
+            LIMB_PAIR(0xC6CAEF37, 0x9B27A5B5), LIMB_PAIR(0x30EC1026, 0xA4B12DD5), LIMB_PAIR(0xB3663660, 0xD7FC0E2C), LIMB_PAIR(0x2E1B00F1, 0xE83E4D0C), LIMB_PARTIAL(0x023)
+        },
+        {   // 4 * 16^47 * G
+            LIMB_PAIR(0xDCA5C86F, 0xD7BA67B2), LIMB_PAIR(0xE4C65E75, 0xA2AD0453), LIMB_PAIR(0xE190BC9F, 0x77CF1258), LIMB_PAIR(0x2C69BC9E, 0xB3F63014),
+            LIMB_PAIR(0x1689858F, 0xD962EAC7), LIMB_PAIR(0x69336A7C, 0xC1B865C6), LIMB_PAIR(0x9B5A5216, 0x3F97565D), LIMB_PAIR(0x1A73A39E, 0x93EA967C), LIMB_PARTIAL(0x083),
+            LIMB_PAIR(0x6EA73EBA, 0xA8E4AF6B), LIMB_PAIR(0xBE248173, 0x3FF8E52D), LIMB_PAIR(0x3F3D34AC, 0x28A4E2BD), LIMB_PAIR(0x1BE61ADB, 0x5D52213E),
+            LIMB_PAIR(0x02968A4B, 0x8EBAA43D), LIMB_PAIR(0x6FADCE98, 0x735958E0), LIMB_PAIR(0xC15F7644, 0x2F143CD6), LIMB_PAIR(0xA7FBFC74, 0x533BEC76), LIMB_PARTIAL(0x061)
+        },
+        {   // 5 * 16^47 * G
+            LIMB_PAIR(0xB02DE9BD, 0x921CDDF9), LIMB_PAIR(0x54CB70BD, 0x5284E403), LIMB_PAIR(0x485DE511, 0x47CB75FE), LIMB_PAIR(0xE754A4F5, 0x844BB7F2),
+            LIMB_PAIR(0x01C4C5C5, 0xD8E646FB), LIMB_PAIR(0x9A4D1688, 0x2F105590), LIMB_PAIR(0x00AD301A, 0x38C08F8E), LIMB_PAIR(0x49211208, 0xEB1EAB17), LIMB_PARTIAL(0x017),
+            LIMB_PAIR(0x055725CB, 0xEF36CB1B), LIMB_PAIR(0xEA940F24, 0xDCCE426C), LIMB_PAIR(0x665F5CB9, 0x29921FCD), LIMB_PAIR(0x666D7A07, 0x04BF0DA8),
+            LIMB_PAIR(0xAFD71003, 0x43F45CFA), LIMB_PAIR(0x29E78F9A, 0x03EEC445), LIMB_PAIR(0xE17694B7, 0xE2A5F7EE), LIMB_PAIR(0x4B7CB8F2, 0xCD841ABA), LIMB_PARTIAL(0x1D6)
+        },
+        {   // 6 * 16^47 * G
+            LIMB_PAIR(0x814311EF, 0xFBD6E794), LIMB_PAIR(0x26CC272F, 0x1751996B), LIMB_PAIR(0xA4D9FFA3, 0xE6A2E157), LIMB_PAIR(0x9A7D88F4, 0x10FC9352),
+            LIMB_PAIR(0x395D7365, 0x02545D80), LIMB_PAIR(0xDC6C4D32, 0x56B7EE84), LIMB_PAIR(0xA455538A, 0xC3DEA31E), LIMB_PAIR(0xB82CD5F3, 0x582E311B), LIMB_PARTIAL(0x151),
+            LIMB_PAIR(0xB3BEC16D, 0x1EADF021), LIMB_PAIR(0x9CE73860, 0x3406D410), LIMB_PAIR(0xEADB4C7A, 0x6785BE85), LIMB_PAIR(0xE1E59A9E, 0x68ADFDC3),
+            LIMB_PAIR(0xAB13F561, 0x131EAD3C), LIMB_PAIR(0x25936137, 0x0B2C0C49), LIMB_PAIR(0x0F35B6F1, 0x6C318EBC), LIMB_PAIR(0xF819E825, 0x0ABE8C27), LIMB_PARTIAL(0x15D)
+        },
+        {   // 7 * 16^47 * G
+            LIMB_PAIR(0x8EF092B9, 0x3345300A), LIMB_PAIR(0x33A01AB2, 0x3824081F), LIMB_PAIR(0xEA5B5A09, 0xE685D205), LIMB_PAIR(0xF455D169, 0x44B7A967),
+            LIMB_PAIR(0x7442AED8, 0x2C9E9155), LIMB_PAIR(0x75A96917, 0x64DBF3A6), LIMB_PAIR(0x449F53AB, 0x49FAEC7B), LIMB_PAIR(0xCBFE4F33, 0x35BA7EBA), LIMB_PARTIAL(0x198),
+            LIMB_PAIR(0x19FC3126, 0x811C4BDD), LIMB_PAIR(0x6C46CC5C, 0xFCDA0AEC), LIMB_PAIR(0xD486C15A, 0xB51C467D), LIMB_PAIR(0x4BD4174C, 0x704C3755),
+            LIMB_PAIR(0xBBC329A6, 0xFB5EA371), LIMB_PAIR(0x55447586, 0x31486007), LIMB_PAIR(0x56AA7225, 0x5482E551), LIMB_PAIR(0x8F51EA5A, 0x94295989), LIMB_PARTIAL(0x05D)
+        },
+        {   // 8 * 16^47 * G
+            LIMB_PAIR(0x19FEC274, 0x44B3F239), LIMB_PAIR(0xE3A66ECC, 0x1DC89875), LIMB_PAIR(0x85EAB4F3, 0xE36EC609), LIMB_PAIR(0x840458E2, 0x3713BCD6),
+            LIMB_PAIR(0x2BB88A8A, 0xCCEA99D3), LIMB_PAIR(0xFD21E802, 0xEBD3D4BA), LIMB_PAIR(0x6FFC588B, 0x03437C28), LIMB_PAIR(0x413B06BF, 0x3A21EFBA), LIMB_PARTIAL(0x1D8),
+            LIMB_PAIR(0x16355E69, 0xD9AFA45C), LIMB_PAIR(0x2502ACC5, 0xE9B28F5B), LIMB_PAIR(0x1711DA7D, 0xEF1999B9), LIMB_PAIR(0x4EAA0320, 0x4657EFA1),
+            LIMB_PAIR(0xBADBE83D, 0x0729DAC2), LIMB_PAIR(0xB9CFBC6E, 0x45B0ACD9), LIMB_PAIR(0xBB296D4B, 0xA014EAB6), LIMB_PAIR(0x63B0D362, 0x29F6BEF3), LIMB_PARTIAL(0x101)
+        }
+    },
+#endif
+#if (48 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^48 * G
+            LIMB_PAIR(0x6DEBBCF6, 0xFDF7681D), LIMB_PAIR(0x600EA3C3, 0xE21AEF25), LIMB_PAIR(0xBB30B75B, 0x181FB048), LIMB_PAIR(0x8D8B7B4F, 0xF9D8C43D),
+            LIMB_PAIR(0xCA68EC32, 0x3D3BC6DE), LIMB_PAIR(0xAF1641EB, 0x6D469252), LIMB_PAIR(0x10252291, 0x1BE3C9BA), LIMB_PAIR(0x8FA4C10B, 0xB57F2C32), LIMB_PARTIAL(0x155),
+            LIMB_PAIR(0x9EA96C94, 0x599E10E5), LIMB_PAIR(0x40593CE0, 0x4426DEB7), LIMB_PAIR(0x2D48D29F, 0x948D9286), LIMB_PAIR(0xC03F5CC5, 0xD3AD8E54),
+            LIMB_PAIR(0x219CD0D4, 0x53FE15E4), LIMB_PAIR(0x0C8FC479, 0x03B91421), LIMB_PAIR(0xE5AA96E6, 0xA023C978), LIMB_PAIR(0xEDB69F81, 0xDEE00502), LIMB_PARTIAL(0x0B7)
+        },
+        {   // 2 * 16^48 * G
+            LIMB_PAIR(0x200AD609, 0x28904911), LIMB_PAIR(0x3505C98B, 0x6FB2B663), LIMB_PAIR(0x17AD4ABA, 0x1BF6E6B5), LIMB_PAIR(0xDBD8E9B0, 0x6D0E654F),
+            LIMB_PAIR(0xF588FBB6, 0x8DB772C1), LIMB_PAIR(0xA292489E, 0x5C2B736F), LIMB_PAIR(0xB902A7C9, 0xEAC6E04A), LIMB_PAIR(0xB2DBAFAD, 0x249C84E7), LIMB_PARTIAL(0x10B),
+            LIMB_PAIR(0x29DE2306, 0x2CBC0390), LIMB_PAIR(0xBFC36A57, 0xAC01D1A5), LIMB_PAIR(0xBACD8B95, 0x89F1A059), LIMB_PAIR(0x3E92C99A, 0x2E1E095A),
+            LIMB_PAIR(0x07B4E976, 0xF172BAD6), LIMB_PAIR(0x35885013, 0xDCE0B2E4), LIMB_PAIR(0x7FA11B87, 0x9A0C5556), LIMB_PAIR(0x7EAB7AD3, 0x1DF0DFD6), LIMB_PARTIAL(0x08C)
+        },
+        {   // 3 * 16^48 * G
+            LIMB_PAIR(0x6A7E545F, 0x3555F75C), LIMB_PAIR(0x7A15BD6C, 0x1EA37A8E), LIMB_PAIR(0x66F5C712, 0x188207A3), LIMB_PAIR(0x4926901E, 0x0FC45BD9),
+            LIMB_PAIR(0xD34B1E01, 0xC55D2D8C), LIMB_PAIR(0xD84F7268, 0xFC75E1AF), LIMB_PAIR(0xBEC74EE3, 0xDED24E68), LIMB_PAIR(0xB82806BA, 0x0F611682), LIMB_PARTIAL(0x0E2),
+            LIMB_PAIR(0xF1943440, 0x5454065A), LIMB_PAIR(0xD01B257E, 0x88291BFF), LIMB_PAIR(0xC6AE2502, 0x6EACA283), LIMB_PAIR(0x8A74CBE8, 0x88F29CE0),
+            LIMB_PAIR(0xADCE5E80, 0x6DDB3AE9), LIMB_PAIR(0xBD911187, 0x93DF4593), LIMB_PAIR(0xA6B62E07, 0x16BDC203), LIMB_PAIR(0xE8EAAC95, 0x3A0AD818), LIMB_PARTIAL(0x11F)
+        },
+        {   // 4 * 16^48 * G
+            LIMB_PAIR(0xCD7BBB6A, 0x1206EA28), LIMB_PAIR(0xC63062FA, 0xEFF556D0), LIMB_PAIR(0xDEB86A3A, 0x8AD321FA), LIMB_PAIR(0xF78FCDC3, 0x9EA9FBDA),
+            LIMB_PAIR(0x0E8C80A8, 0x3EF406CB), LIMB_PAIR(0x0F593D36, 0xC168B597), LIMB_PAIR(0xC352A3A0, 0xD6456267), LIMB_PAIR(0x32C5A9A8, 0x303BD083), LIMB_PARTIAL(0x102),
+            LIMB_PAIR(0xE680D0F9, 0xBF911F73), LIMB_PAIR(0xBC1A1B47, 0xB12FCCA8), LIMB_PAIR(0xEF8024F6, 0xB8264577), LIMB_PAIR(0xF66AE119, 0x9D17B8B7),
+            LIMB_PAIR(0x75B33227, 0xB135DFC2), LIMB_PAIR(0x96E667C2, 0x4CBF0D6D), LIMB_PAIR(0xBA373B24, 0xFFF742BE), LIMB_PAIR(0x776CBD3B, 0x218E787E), LIMB_PARTIAL(0x0CC)
+        },
+        {   // 5 * 16^48 * G
+            LIMB_PAIR(0xEFB91DE7, 0x1F8215F9), LIMB_PAIR(0x8A2F74D9, 0xF3ADD5D0), LIMB_PAIR(0xA520D556, 0x56433008), LIMB_PAIR(0x8628AC75, 0xB6DF83C5),
+            LIMB_PAIR(0x7390EEA0, 0xF3C38EA2), LIMB_PAIR(0x6078A673, 0xB1AADF0F), LIMB_PAIR(0x27B6B8FB, 0xA9E08328), LIMB_PAIR(0xF3B7CE53, 0x22E64291), LIMB_PARTIAL(0x17F),
+            LIMB_PAIR(0x6E69500A, 0xB3E7AE4C), LIMB_PAIR(0xC441E02C, 0x740B9752), LIMB_PAIR(0xF503D4A0, 0x3D04D6DC), LIMB_PAIR(0x862F3496, 0x22490A59),
+            LIMB_PAIR(0xB2472177, 0x0F4A62AA), LIMB_PAIR(0x79720C85, 0x668475B9), LIMB_PAIR(0xED9B4FD9, 0xF6EBEB0B), LIMB_PAIR(0x914E8BF4, 0x8A5A6926), LIMB_PARTIAL(0x0F2)
+        },
+        {   // 6 * 16^48 * G
+            LIMB_PAIR(0xE97EA880, 0x4231DA59), LIMB_PAIR(0x45262614, 0x5D4C0487), LIMB_PAIR(0x36AEEAEE, 0x37186437), LIMB_PAIR(0xBBAA66CB, 0x17229D1D),
+            LIMB_PAIR(0xA5D41097, 0x342DAF59), LIMB_PAIR(0x5080F051, 0x5FC2CC01), LIMB_PAIR(0x0E6527BE, 0x657C05A2), LIMB_PAIR(0x949E36EC, 0x3E61C315), LIMB_PARTIAL(0x008),
+            LIMB_PAIR(0xD8A5319F, 0x961BDC35), LIMB_PAIR(0x74708CD1, 0x5B8F4DB8), LIMB_PAIR(0x4726604C, 0x901D2856), LIMB_PAIR(0xCCC10400, 0xE35AD211),
+            LIMB_PAIR(0x94004A0F, 0x5A9B1205), LIMB_PAIR(0x5C8EAABD, 0xDBF493BF), LIMB_PAIR(0xBAFF6FD2, 0x6CCC828B), LIMB_PAIR(0x77E9A126, 0x83003F10), LIMB_PARTIAL(0x0B9)
+        },
+        {   // 7 * 16^48 * G
+            LIMB_PAIR(0x4C2A4CEF, 0x3D91EA60), LIMB_PAIR(0x3DE838AD, 0x8DE8F69C), LIMB_PAIR(0x538C37D7, 0x9A725723), LIMB_PAIR(0x7948B4EC, 0x3923FA07),
+            LIMB_PAIR(0xD23E67F0, 0xD1A25D23), LIMB_PAIR(0x396FBC50, 0xA2D7B9D7), LIMB_PAIR(0x1D36F98C, 0x8F8504E4), LIMB_PAIR(0x59191798, 0xAA9E5851), LIMB_PARTIAL(0x147),
+            LIMB_PAIR(0xE3DB7296, 0x8EDBF0C2), LIMB_PAIR(0x81FC8F30, 0x677A2996), LIMB_PAIR(0xB727E6AA, 0x05E27B8D), LIMB_PAIR(0x03113B4E, 0x4F5A9A69),
+            LIMB_PAIR(0x3ED42117, 0x9D4724E8), LIMB_PAIR(0x72FCB859, 0x06C0B8A5), LIMB_PAIR(0xAD040B87, 0xECDCF4D8), LIMB_PAIR(0x8CDA9EB0, 0xE6BB9A0E), LIMB_PARTIAL(0x1D4)
+        },
+        {   // 8 * 16^48 * G
+            LIMB_PAIR(0x1236BEC1, 0x6287BBCA), LIMB_PAIR(0x608E6B5C, 0xC16EABD8), LIMB_PAIR(0x15FCD3C6, 0x253193EF), LIMB_PAIR(0xDA5FE623, 0xD4EE71C7),
+            LIMB_PAIR(0xAC806CB8, 0x62531449), LIMB_PAIR(0x90D7E00D, 0x9152CF16), LIMB_PAIR(0xD20A1668, 0xA1E05703), LIMB_PAIR(0xBBF588DA, 0x6480D486), LIMB_PARTIAL(0x14F),
+            LIMB_PAIR(0xFE2753E3, 0x37F70AB3), LIMB_PAIR(0x023EBDF8, 0x562F4A46), LIMB_PAIR(0x89CAF63A, 0x97358D7D), LIMB_PAIR(0xAB4B1DFB, 0x387422A7),
+            LIMB_PAIR(0x2C8C3421, 0x80D65496), LIMB_PAIR(0xDB8E13CD, 0x7D338B4B), LIMB_PAIR(0xAC590192, 0xA535529D), LIMB_PAIR(0xA6760430, 0x39A28761), LIMB_PARTIAL(0x0C7)
+        }
+    },
+#endif
+#if (49 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^49 * G
+            LIMB_PAIR(0x8F1EF579, 0x1E226A93), LIMB_PAIR(0x138FEDD2, 0x8AEEBEC9), LIMB_PAIR(0x1CA4C4E2, 0xA7E39D7D), LIMB_PAIR(0x49724F86, 0x5E53F86D),
+            LIMB_PAIR(0xEB759DB4, 0x9815987D), LIMB_PAIR(0x0E9CD47A, 0x538C9F70), LIMB_PAIR(0x1A7FAC87, 0xFFFC98C7), LIMB_PAIR(0x7CE980E1, 0x3195776E), LIMB_PARTIAL(0x19F),
+            LIMB_PAIR(0xE33CDCBD, 0xCCAB7B37), LIMB_PAIR(0x855619D0, 0x561D18F2), LIMB_PAIR(0x818F21D0, 0x56AA5963), LIMB_PAIR(0x571C3C5E, 0x1413193B),
+            LIMB_PAIR(0xFD748C72, 0x9B30214C), LIMB_PAIR(0x8EADF936, 0xEF0BD8D4), LIMB_PAIR(0xD1964B92, 0xEB6D831F), LIMB_PAIR(0x9BC42BEB, 0x4B37D5E0), LIMB_PARTIAL(0x1EF)
+        },
+        {   // 2 * 16^49 * G
+            LIMB_PAIR(0x979551EE, 0xB854567B), LIMB_PAIR(0x3F3F499D, 0xF97B8CAB), LIMB_PAIR(0x603FE8E0, 0x3E343ACA), LIMB_PAIR(0x813ABD6B, 0x2C4167F8),
+            LIMB_PAIR(0xA74BFD77, 0x6B23EED8), LIMB_PAIR(0xD47DD491, 0xF88B1CEC), LIMB_PAIR(0x26B2FD87, 0x9E613C32), LIMB_PAIR(0xFE54BD69, 0xC1B1AC19), LIMB_PARTIAL(0x0AF),
+            LIMB_PAIR(0x43B4DF17, 0x12BCAFBB), LIMB_PAIR(0x7266CD9B, 0xBD082924), LIMB_PAIR(0x5A197805, 0x9D1E0EB3), LIMB_PAIR(0x76CAE6CB, 0xF44AC912),
+            LIMB_PAIR(0x30D68179, 0x7D4E90E6), LIMB_PAIR(0x2AD9609F, 0x5407A9A0), LIMB_PAIR(0x921ECCA2, 0x02CBCE1C), LIMB_PAIR(0xA246D665, 0x058AB973), LIMB_PARTIAL(0x0C9)
+        },
+        {   // 3 * 16^49 * G
+            LIMB_PAIR(0x9A73EBA3, 0xF31853C9), LIMB_PAIR(0x0E6E4613, 0x3FD88955), LIMB_PAIR(0x32A3D4AC, 0x0F685BB9), LIMB_PAIR(0x8CCA35FA, 0xAEAB0CD8),
+            LIMB_PAIR(0xEF18D468, 0x8F65C0F7), LIMB_PAIR(0x09F0F948, 0xBD45DD25), LIMB_PAIR(0x6BA83339, 0xFC2EA6E4), LIMB_PAIR(0xAE6934CE, 0xF6F79E60), LIMB_PARTIAL(0x158),
+            LIMB_PAIR(0xE60D9028, 0x3D279791), LIMB_PAIR(0xF0C3CF4F, 0xC2CA4234), LIMB_PAIR(0x85AC780A, 0xF21EC8F0), LIMB_PAIR(0xE6FDB32B, 0xC2D9B19E),
+            LIMB_PAIR(0x0827C781, 0x9E2811FE), LIMB_PAIR(0x49E61BDB, 0x42E15387), LIMB_PAIR(0x414D6887, 0x936B8E23), LIMB_PAIR(0xD7EDC198, 0x7FE54043), LIMB_PARTIAL(0x08A)
+        },
+        {   // 4 * 16^49 * G
+            LIMB_PAIR(0x4BEE80D7, 0x61B51BB0), LIMB_PAIR(0x7692DE69, 0x0E1F6A1F), LIMB_PAIR(0xA0EBC3BD, 0x8379E46C), LIMB_PAIR(0x930644F0, 0x1C0BFFA7),
+            LIMB_PAIR(0x390DB077, 0x97C67B87), LIMB_PAIR(0xFADA1CE9, 0x095C33E1), LIMB_PAIR(0xAC54B512, 0x3C500ADD), LIMB_PAIR(0xD3118656, 0xC231D360), LIMB_PARTIAL(0x0B0),
+            LIMB_PAIR(0x39BCAB2F, 0x06289298), LIMB_PAIR(0x64DD220A, 0xC0C06780), LIMB_PAIR(0x763DC2A0, 0x062F6084), LIMB_PAIR(0x1938C3E3, 0x88E9DA73),
+            LIMB_PAIR(0x52E46EB9, 0x69BE8F2D), LIMB_PAIR(0x6A5DE0FD, 0xE55C8D2D), LIMB_PAIR(0xDB2C0E26, 0xF3A3FD63), LIMB_PAIR(0x1E4BFF57, 0x899C6D9F), LIMB_PARTIAL(0x14A)
+        },
+        {   // 5 * 16^49 * G
+            LIMB_PAIR(0x886B7B20, 0xEF850C0A), LIMB_PAIR(0xBB9943C6, 0x8F635025), LIMB_PAIR(0x73EA21AE, 0xB81D4C7D), LIMB_PAIR(0x99D3A6EE, 0xCB8F069F),
+            LIMB_PAIR(0xFA33EEB0, 0x6CF775A6), LIMB_PAIR(0x8F96805D, 0x4E222F77), LIMB_PAIR(0xA6141EA6, 0x143517AA), LIMB_PAIR(0x167210C0, 0xE38A3C64), LIMB_PARTIAL(0x116),
+            LIMB_PAIR(0x1FC78DBB, 0x0FB62F62), LIMB_PAIR(0x6CAB326B, 0x2C641023), LIMB_PAIR(0xF1549E38, 0xA72EA35A), LIMB_PAIR(0x830F25CE, 0x537F6EA3),
+            LIMB_PAIR(0x33EEFB84, 0x9E079CAE), LIMB_PAIR(0xB87DDBF0, 0x38C173BA), LIMB_PAIR(0x7184AF77, 0x1B437389), LIMB_PAIR(0xB1868BCC, 0xF978084C), LIMB_PARTIAL(0x0AE)
+        },
+        {   // 6 * 16^49 * G
+            LIMB_PAIR(0xD454E1CD, 0x37456B07), LIMB_PAIR(0xE651CA99, 0xCA872026), LIMB_PAIR(0x6A03D9A8, 0x66D07572), LIMB_PAIR(0x1D31CBAE, 0xE6E9BA23),
+            LIMB_PAIR(0xA80F7B13, 0x2B720E01), LIMB_PAIR(0x615F6CA5, 0xB6D7F827), LIMB_PAIR(0x9012B0AF, 0xF88F8CD6), LIMB_PAIR(0x7A8E112B, 0x5024D5DE), LIMB_PARTIAL(0x19F),
+            LIMB_PAIR(0xA8749354, 0x24EA6D08), LIMB_PAIR(0x290612B8, 0x1143855E), LIMB_PAIR(0xE2EDB77E, 0x64CFB996), LIMB_PAIR(0x77A5F775, 0xADDFBF4F),
+            LIMB_PAIR(0xDD64FD57, 0xDD57F915), LIMB_PAIR(0x055A07D0, 0x89CE3192), LIMB_PAIR(0x3CD0549C, 0x9323E3E1), LIMB_PAIR(0xD89FC00C, 0x7CC109CD), LIMB_PARTIAL(0x0DF)
+        },
+        {   // 7 * 16^49 * G
+            LIMB_PAIR(0xF4222533, 0x09DAC9ED), LIMB_PAIR(0xFD65CF38, 0x241333A9), LIMB_PAIR(0xAF69F2F4, 0xAA15ECBA), LIMB_PAIR(0xE6AFA6E0, 0x680CC1A0),
+            LIMB_PAIR(0x5F6F8C82, 0x581099C9), LIMB_PAIR(0x4DCAE40B, 0x32F94810), LIMB_PAIR(0x4FF8175C, 0x0FAD007D), LIMB_PAIR(0x5450471E, 0x5DFD3638), LIMB_PARTIAL(0x0BB),
+            LIMB_PAIR(0x9BEDAD5E, 0x57A1BD6B), LIMB_PAIR(0x77139166, 0xB187EDE7), LIMB_PAIR(0xD66AB437, 0x66AB56BB), LIMB_PAIR(0x0875CC7B, 0x8D67305E),
+            LIMB_PAIR(0x2130FBAB, 0xD1221E1D), LIMB_PAIR(0x0A435B57, 0xED448270), LIMB_PAIR(0xF4089497, 0xEA5DA47B), LIMB_PAIR(0xE8BFB1F6, 0x280B2CD4), LIMB_PARTIAL(0x115)
+        },
+        {   // 8 * 16^49 * G
+            LIMB_PAIR(0xEDB74CB1, 0x8F33504D), LIMB_PAIR(0x9D2A2437, 0x1EDD5D96), LIMB_PAIR(0xBECED5E0, 0xB4A43AAD), LIMB_PAIR(0xA6679DCE, 0x94FAEE53),
+            LIMB_PAIR(0xF6D1589D, 0xDA5CA04F), LIMB_PAIR(0x35D8BE40, 0x4E554949), LIMB_PAIR(0xD5311F54, 0x3DF8D236), LIMB_PAIR(0x4988FE68, 0x46F9C2D2), LIMB_PARTIAL(0x1F7),
+            LIMB_PAIR(0xFB2327CD, 0x4D0D9475), LIMB_PAIR(0xF0B8FAF0, 0x552291CE), LIMB_PAIR(0x661E3C78, 0x3E3F4A98), LIMB_PAIR(0xBDA95549, 0x2C452F05),
+            LIMB_PAIR(0x8BB411BD, 0x53276D70), LIMB_PAIR(0x539322F3, 0xFDE0440E), LIMB_PAIR(0x20961BF1, 0x02D8D55B), LIMB_PAIR(0x18739DCC, 0x3C1E1055), LIMB_PARTIAL(0x17C)
+        }
+    },
+#endif
+#if (50 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^50 * G
+            LIMB_PAIR(0x7468E327, 0xFD026128), LIMB_PAIR(0xEE755906, 0x789E8DC4), LIMB_PAIR(0x80218C94, 0xEA0453E4), LIMB_PAIR(0x088D7C56, 0xE263FE27),
+            LIMB_PAIR(0x30277200, 0x9219CEE6), LIMB_PAIR(0x8CE5AD85, 0x293401D2), LIMB_PAIR(0xB960EBBA, 0x627036D3), LIMB_PAIR(0xF92DA0EA, 0x8BE032FE), LIMB_PARTIAL(0x030),
+            LIMB_PAIR(0x9DAF8D6D, 0x7AB52E73), LIMB_PAIR(0x3F789F6C, 0xD6D75D4C), LIMB_PAIR(0xBFC9A31E, 0xC3B7560E), LIMB_PAIR(0xD7DB7AD5, 0x87B7F183),
+            LIMB_PAIR(0x9C213425, 0x0F60A2DB), LIMB_PAIR(0x52C58981, 0xC2E67C94), LIMB_PAIR(0x1B6D0B43, 0x001CF3E8), LIMB_PAIR(0x78235B3F, 0x31EFA39B), LIMB_PARTIAL(0x0CE)
+        },
+        {   // 2 * 16^50 * G
+            LIMB_PAIR(0xBCB97CCC, 0x04E8DC9F), LIMB_PAIR(0x88086FBA, 0x4652847E), LIMB_PAIR(0x65411266, 0xE5EC0719), LIMB_PAIR(0x69E1C843, 0xAF72B4A1),
+            LIMB_PAIR(0x8161E951, 0x48E75C31), LIMB_PAIR(0x8A39806B, 0xAB645792), LIMB_PAIR(0xA2A97512, 0x3FA10B38), LIMB_PAIR(0xFC3A693A, 0xBA9E2EE7), LIMB_PARTIAL(0x0FF),
+            LIMB_PAIR(0x3B70D15F, 0x3B96E7C3), LIMB_PAIR(0x4AE9E52C, 0x87C3F3DD), LIMB_PAIR(0x64ECC9F1, 0xA256E7E8), LIMB_PAIR(0x07C90736, 0x541D8B6D),
+            LIMB_PAIR(0x6C2B4160, 0x2367141F), LIMB_PAIR(0xCAB770F3, 0xE32AA363), LIMB_PAIR(0x61282E7E, 0x51E2C832), LIMB_PAIR(0xF3FA7817, 0x194B06A2), LIMB_PARTIAL(0x1C1)
+        },
+        {   // 3 * 16^50 * G
+            LIMB_PAIR(0xD2A1F241, 0x22D8C3C4), LIMB_PAIR(0x8ED2C14B, 0xCB605515), LIMB_PAIR(0x2939F855, 0xBD634A2E), LIMB_PAIR(0x1E9519B4, 0x30B2B6B9),
+            LIMB_PAIR(0x08A31D22, 0x19911C00), LIMB_PAIR(0x979CD33C, 0x60B0713B), LIMB_PAIR(0xB94F9B61, 0xF41A8ABD), LIMB_PAIR(0xEF72CF1E, 0x3F2D8C91), LIMB_PARTIAL(0x1B4),
+            LIMB_PAIR(0xD78B56EE, 0xF0ACF9B3), LIMB_PAIR(0xE915A265, 0x12112D24), LIMB_PAIR(0xC1D7025F, 0xA18C93AD), LIMB_PAIR(0x2E652107, 0x279A4DB8),
+            LIMB_PAIR(0x2BFFB5DA, 0xBCA73AD0), LIMB_PAIR(0xE2D168EE, 0x2CDFEEE4), LIMB_PAIR(0x5A4ACA12, 0x6D83A77F), LIMB_PAIR(0x1D22E8F4, 0xC203514B), LIMB_PARTIAL(0x0F8)
+        },
+        {   // 4 * 16^50 * G
+            LIMB_PAIR(0xC4E24C8D, 0xAD8F0FE4), LIMB_PAIR(0xD1EAA52D, 0x81CF16FD), LIMB_PAIR(0xD68864CA, 0x710A08A7), LIMB_PAIR(0x7539DE5F, 0x8E736C0E),
+            LIMB_PAIR(0x7F67341C, 0xCA658337), LIMB_PAIR(0x900B74B6, 0x63892B7D), LIMB_PAIR(0x6E9BE886, 0x5D1D91DB), LIMB_PAIR(0x9633A600, 0xA4DA9564), LIMB_PARTIAL(0x19B),
+            LIMB_PAIR(0x5C319D97, 0xCDAE7A97), LIMB_PAIR(0xD0316874, 0x873B4F53), LIMB_PAIR(0x5C213AB4, 0x7AC18684), LIMB_PAIR(0xAE9109C5, 0x4F0B5AE2),
+            LIMB_PAIR(0x7A661690, 0x1934B7ED), LIMB_PAIR(0x0707B518, 0x0F98ACD9), LIMB_PAIR(0x34017E00, 0x12F07C55), LIMB_PAIR(0x6CE4AD49, 0xE9B121A1), LIMB_PARTIAL(0x15E)
+        },
+        {   // 5 * 16^50 * G
+            LIMB_PAIR(0x43F7453A, 0xD5B0D5A4), LIMB_PAIR(0xBB43D3A8, 0xF96B7FFB), LIMB_PAIR(0xD0C86229, 0xB61C49F2), LIMB_PAIR(0x8D18B4C1, 0xB37D3160),
+            LIMB_PAIR(0x2379514C, 0x7A18F0B9), LIMB_PAIR(0x0E440995, 0x8A7BF63C), LIMB_PAIR(0xD77C09B2, 0xDEEF9EA1), LIMB_PAIR(0x364ED115, 0x3901E8B3), LIMB_PARTIAL(0x12A),
+            LIMB_PAIR(0xE5A32971, 0x66888CF0), LIMB_PAIR(0x7A9C3886, 0xA1E4C1BB), LIMB_PAIR(0x64822F55, 0x19F73884), LIMB_PAIR(0xD925D4FB, 0x7C31E97A),
+            LIMB_PAIR(0xED044B10, 0x131BAAD0), LIMB_PAIR(0x589074E5, 0x2477A6B3), LIMB_PAIR(0xD8E1044B, 0xBC5CAFFF), LIMB_PAIR(0xB14C4291, 0xB8D26D09), LIMB_PARTIAL(0x0D8)
+        },
+        {   // 6 * 16^50 * G
+            LIMB_PAIR(0x467A85EC, 0x8694060F), LIMB_PAIR(0x9145489A, 0x998DE112), LIMB_PAIR(0x1F21B607, 0xEEB25D77), LIMB_PAIR(0x5E92D2DF, 0xFE55D2D3),
+            LIMB_PAIR(0xFF94790F, 0xE829F9D8), LIMB_PAIR(0x9D8DEAD0, 0x4AA821AD), LIMB_PAIR(0x35D38D66, 0x39304735), LIMB_PAIR(0x4E27D52C, 0x1FDE1E5B), LIMB_PARTIAL(0x134),
+            LIMB_PAIR(0x5A046E85, 0xD513588E), LIMB_PAIR(0x794B4D0D, 0xAAA559AC), LIMB_PAIR(0x2C2868D9, 0x649571CC), LIMB_PAIR(0x0FA20E5F, 0x1A6CEFB8),
+            LIMB_PAIR(0x067EF910, 0x4B9181A3), LIMB_PAIR(0x8A0C6BA4, 0xF095CE2F), LIMB_PAIR(0xF1443257, 0x078CF183), LIMB_PAIR(0x3A64FE5D, 0xEFE47DF9), LIMB_PARTIAL(0x012)
+        },
+        {   // 7 * 16^50 * G
+            LIMB_PAIR(0xEC5BA37E, 0x007BFFC0), LIMB_PAIR(0x154F22FC, 0x8A9B51AC), LIMB_PAIR(0x25F8E4C5, 0xD54FDBF5), LIMB_PAIR(0xDB848843, 0x90DD4FFE),
+            LIMB_PAIR(0xF05ABCC5, 0x428E6E53), LIMB_PAIR(0xB8DBE8D0, 0x37801AA6), LIMB_PAIR(0x97B4D76D, 0x9C4C0292), LIMB_PAIR(0xF8F667E6, 0xA5970346), LIMB_PARTIAL(0x1FA),
+            LIMB_PAIR(0xB42D2421, 0xBB69FA25), LIMB_PAIR(0x28B20798, 0xF2AB0C5F), LIMB_PAIR(0x02996989, 0x1EDF762A), LIMB_PAIR(0x01C8F5EE, 0xD2CFC47B),
+            LIMB_PAIR(0x6913E414, 0x427D7D5B), LIMB_PAIR(0x12920CCB, 0x12B1CD40), LIMB_PAIR(0x5F552D45, 0x04443F3F), LIMB_PAIR(0x6EB463B5, 0xB3B0D58F), LIMB_PARTIAL(0x05B)
+        },
+        {   // 8 * 16^50 * G
+            LIMB_PAIR(0xE588A775, 0xF4D3BCB3), LIMB_PAIR(0x365983C7, 0x63161619), LIMB_PAIR(0x66782F6C, 0xBA7334AD), LIMB_PAIR(0x8783D25A, 0x1F14DEDB),
+            LIMB_PAIR(0x50C67FE1, 0xFF6FE73C), LIMB_PAIR(0xF79A86A3, 0x711DDFE3), LIMB_PAIR(0x027D18EE, 0x7CBD7F3A), LIMB_PAIR(0xC4ECD52A, 0x7F63D331), LIMB_PARTIAL(0x0D7),
+            LIMB_PAIR(0xCB49037B, 0xF463A32B), LIMB_PAIR(0xE7C35C02, 0x66E4CE3D), LIMB_PAIR(0x116E0D6B, 0x1D175313), LIMB_PAIR(0x2D307EE9, 0x3BCFA672),
+            LIMB_PAIR(0x7C79261D, 0xC6F9BCDC), LIMB_PAIR(0x994649CF, 0x79BB33DC), LIMB_PAIR(0x6D4EE55C, 0xB491B05F), LIMB_PAIR(0x1E6846BF, 0x4BD0668E), LIMB_PARTIAL(0x0FF)
+        }
+    },
+#endif
+#if (51 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^51 * G
+            LIMB_PAIR(0xBDEC6EFB, 0xE7BFC99F), LIMB_PAIR(0x67326C7B, 0x2BD3D26B), LIMB_PAIR(0x594C614E, 0x23F041FF), LIMB_PAIR(0xEC9B4420, 0x5A778C67),
+            LIMB_PAIR(0x30EAA444, 0x75B5618B), LIMB_PAIR(0xAE6D50A4, 0xF8E2BB92), LIMB_PAIR(0x1FDEB6F0, 0x7278C60B), LIMB_PAIR(0x97C654CC, 0x5B8471DD), LIMB_PARTIAL(0x139),
+            LIMB_PAIR(0x3E959CA8, 0x115A8112), LIMB_PAIR(0x8BED7EEE, 0x13DC4AA3), LIMB_PAIR(0xEF94C5FD, 0x02340F86), LIMB_PAIR(0x99A5D5CC, 0x519293A4),
+            LIMB_PAIR(0x294349A0, 0x09573381), LIMB_PAIR(0xDA33B39F, 0xDEFE063F), LIMB_PAIR(0xA382A806, 0x6A18640A), LIMB_PAIR(0xD227A86F, 0xB3E25FDB), LIMB_PARTIAL(0x0D3)
+        },
+        {   // 2 * 16^51 * G
+            LIMB_PAIR(0xD3A4D912, 0xE3169760), LIMB_PAIR(0x7BA3A1A6, 0x5568005C), LIMB_PAIR(0xD7E7B5D5, 0xB469884D), LIMB_PAIR(0x8CECEC62, 0x6BE70C09),
+            LIMB_PAIR(0xC5D6363D, 0x6300A32F), LIMB_PAIR(0x4DB63578, 0xC2FD66E4), LIMB_PAIR(0x35AE7BEB, 0xA131EA21), LIMB_PAIR(0xD31A6F2F, 0xA82FD7FB), LIMB_PARTIAL(0x0DA),
+            LIMB_PAIR(0x00DEB4B3, 0x1280D691), LIMB_PAIR(0xA4EA0ABE, 0x72865157), LIMB_PAIR(0x8934A09B, 0xC8788167), LIMB_PAIR(0xA70DD871, 0x5733CC11),
+            LIMB_PAIR(0x0FFC8EB0, 0x139E8876), LIMB_PAIR(0x0D958521, 0x8E9436E3), LIMB_PAIR(0xB3059F58, 0x06D1A845), LIMB_PAIR(0xA81354F6, 0x3C220AB3), LIMB_PARTIAL(0x00B)
+        },
+        {   // 3 * 16^51 * G
+            LIMB_PAIR(0xAC49D960, 0x1499FF98), LIMB_PAIR(0x3940FF6F, 0x98F7925A), LIMB_PAIR(0x743F2CCD, 0xF6C696DD), LIMB_PAIR(0xEF310A73, 0xE7C6C272),
+            LIMB_PAIR(0x91AD1858, 0x4029492D), LIMB_PAIR(0x483037CC, 0xA2E65AF9), LIMB_PAIR(0xD3453348, 0x080C3FD0), LIMB_PAIR(0x068380C0, 0x4A1F9803), LIMB_PARTIAL(0x1BC),
+            LIMB_PAIR(0xD9DC2514, 0xA39427DD), LIMB_PAIR(0xB2A91D48, 0xE0F733EC), LIMB_PAIR(0x29219E28, 0x0144D74F), LIMB_PAIR(0xE3FC6C5F, 0x25DDCC92),
+            LIMB_PAIR(0x91F871E5, 0xB90E3713), LIMB_PAIR(0x81A245CA, 0x3F763ADB), LIMB_PAIR(0x2F3E2323, 0x1FC6A149), LIMB_PAIR(0xB41F0B93, 0x92CC2090), LIMB_PARTIAL(0x0A7)
+        },
+        {   // 4 * 16^51 * G
+            LIMB_PAIR(0xB0596774, 0x293385ED), LIMB_PAIR(0xDC09FB31, 0xCDF619F0), LIMB_PAIR(0x90F76D96, 0xC4AF9E6A), LIMB_PAIR(0xCC8596FC, 0x54B471B7),
+            LIMB_PAIR(0x65BB2EF9, 0x18FFEE02), LIMB_PAIR(0xCF9D919E, 0x4942B53F), LIMB_PAIR(0xE553F316, 0xD6F9D2A9), LIMB_PAIR(0x6A58EAA5, 0xD83946CC), LIMB_PARTIAL(0x1B2),
+            LIMB_PAIR(0xDF8AA88F, 0xA1D2DAEC), LIMB_PAIR(0x0CAED19D, 0x62CD7B32), LIMB_PAIR(0x35B5B292, 0x7C08BC57), LIMB_PAIR(0x54118651, 0xE1A60A44),
+            LIMB_PAIR(0xAA8E4F5C, 0xB1D83A9E), LIMB_PAIR(0xA30E7AC3, 0xC47B05FD), LIMB_PAIR(0x388DAA83, 0x9167E33E), LIMB_PAIR(0xB9685DE6, 0x27A10BE2), LIMB_PARTIAL(0x0BB)
+        },
+        {   // 5 * 16^51 * G
+            LIMB_PAIR(0x1FE5F835, 0xF5FE39ED), LIMB_PAIR(0x164E9741, 0xE17A6FB3), LIMB_PAIR(0x0F1180E9, 0xEB9A084A), LIMB_PAIR(0xA1174F31, 0x95F55D56),
+            LIMB_PAIR(0x03850AC7, 0xC33FA3D1), LIMB_PAIR(0x6E0DDD06, 0x15A29BAC), LIMB_PAIR(0x36F2F29E, 0xB80A0B78), LIMB_PAIR(0x67CDE67A, 0xE5D8DDF4), LIMB_PARTIAL(0x133),
+            LIMB_PAIR(0xC5EE0DD4, 0x1767C74C), LIMB_PAIR(0xD7E4BDDB, 0x1D61299B), LIMB_PAIR(0xFA74FB11, 0xF4D89A2F), LIMB_PAIR(0x0037FB90, 0xE8A63C4A),
+            LIMB_PAIR(0x7800EC4A, 0x30FCDB04), LIMB_PAIR(0xD490DF3B, 0x49A1E298), LIMB_PAIR(0xDA5ACAE7, 0x3D3510A2), LIMB_PAIR(0x78CE9832, 0x2D4184AA), LIMB_PARTIAL(0x024)
+        },
+        {   // 6 * 16^51 * G
+            LIMB_PAIR(0x1D17B705, 0x7AF8EE91), LIMB_PAIR(0x21098F55, 0x8E4E5974), LIMB_PAIR(0xD5CECACF, 0x0542A394), LIMB_PAIR(0x5094F357, 0x4D8EB839),
+            LIMB_PAIR(0x62D5A150, 0x8C86900C), LIMB_PAIR(0xAFE653E7, 0x7AD4081B), LIMB_PAIR(0x677A5BBC, 0x387C8A7E), LIMB_PAIR(0xBE7886D1, 0x088120B9), LIMB_PARTIAL(0x156),
+            LIMB_PAIR(0x6C398918, 0x98652370), LIMB_PAIR(0x4F6C44C4, 0x7C9C4971), LIMB_PAIR(0x20A8FA98, 0x443ABE78), LIMB_PAIR(0x137F926F, 0xF42A7FF4),
+            LIMB_PAIR(0xF464B480, 0xFF4C7AA9), LIMB_PAIR(0x277D4EB8, 0xF88B491A), LIMB_PAIR(0xC3CAB7F6, 0x170A625F), LIMB_PAIR(0xCDCAB435, 0xF9BBA62B), LIMB_PARTIAL(0x186)
+        },
+        {   // 7 * 16^51 * G
+            LIMB_PAIR(0x0741634E, 0xDA963DC9), LIMB_PAIR(0x6A62E31D, 0xC2B6B3CC), LIMB_PAIR(0x926A9817, 0x726FFDB0), LIMB_PAIR(0xA7A05347, 0x2BC8A0C6),
+            LIMB_PAIR(0xDAD1F7A5, 0xB440BEF6), LIMB_PAIR(0x666EBFB7, 0x96AE7CB3), LIMB_PAIR(0x6955BBA1, 0xF3B41EA3), LIMB_PAIR(0xB1869190, 0x2ED577FF), LIMB_PARTIAL(0x025),
+            LIMB_PAIR(0xB188B5E5, 0xCD5DC527), LIMB_PAIR(0xCE6E943E, 0xA3FA5778), LIMB_PAIR(0x22DAF81F, 0x463B9AA8), LIMB_PAIR(0xDFB44926, 0x2A0544EF),
+            LIMB_PAIR(0xC5F56C83, 0x7C78F0E5), LIMB_PAIR(0x87A0CACF, 0x83A5552B), LIMB_PAIR(0xF491AFFE, 0x8A5A5CDB), LIMB_PAIR(0x1B8398D3, 0x419BA884), LIMB_PARTIAL(0x0BF)
+        },
+        {   // 8 * 16^51 * G
+            LIMB_PAIR(0x23E6C204, 0x4AC7CF5E), LIMB_PAIR(0x8DEB8019, 0x7B4459A4), LIMB_PAIR(0xEBE4E27B, 0x2FFD2583), LIMB_PAIR(0x05E6AE2A, 0xAB15FEB7),
+            LIMB_PAIR(0xC902355C, 0x270A5D8F), LIMB_PAIR(0xFAF419FD, 0x8D3DF414), LIMB_PAIR(0x34AE3D01, 0x191B90B5), LIMB_PAIR(0xBB5ABD9E, 0x497282C4), LIMB_PARTIAL(0x11B),
+            LIMB_PAIR(0x8C7267F4, 0xD2232AE0), LIMB_PAIR(0x17B6532F, 0xE1FEC69B), LIMB_PAIR(0xB1A2D82C, 0x1C6A586E), LIMB_PAIR(0x29128558, 0xEB843186),
+            LIMB_PAIR(0x3A80EFD7, 0xBF24D2F1), LIMB_PAIR(0xB22228D1, 0x93763DDB), LIMB_PAIR(0x3CB37B92, 0xF9DA0039), LIMB_PAIR(0x86CD2952, 0x780D8BA9), LIMB_PARTIAL(0x18A)
+        }
+    },
+#endif
+#if (52 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^52 * G
+            LIMB_PAIR(0xC4C762BC, 0x0FC6C549), LIMB_PAIR(0x4E5EB96F, 0xC43915E3), LIMB_PAIR(0xD1BB0B5B, 0xAD88EE68), LIMB_PAIR(0x3F1F26A3, 0x484A9FAD),
+            LIMB_PAIR(0x2BC15E9D, 0x0D93055C), LIMB_PAIR(0x06D26BB7, 0xA745ABBB), LIMB_PAIR(0x464F0731, 0xF60ED3B8), LIMB_PAIR(0xEA9058BF, 0x963D8D94), LIMB_PARTIAL(0x039),
+            LIMB_PAIR(0x7B67B298, 0x4608AC08), LIMB_PAIR(0xC85CF812, 0x3BAF2AE6), LIMB_PAIR(0x0D25BEDF, 0xB30AEC55), LIMB_PAIR(0x7CE48459, 0x58149350),
+            LIMB_PAIR(0xD3C41E2D, 0xFCB39F45), LIMB_PAIR(0x126E11A7, 0x48D241A0), LIMB_PAIR(0x909A1621, 0x7B425421), LIMB_PAIR(0xE746BF4B, 0x9BB349DD), LIMB_PARTIAL(0x0AB)
+        },
+        {   // 2 * 16^52 * G
+            LIMB_PAIR(0xA52D1421, 0x8F45148D), LIMB_PAIR(0x09DAF522, 0xE89923FD), LIMB_PAIR(0xC8F15492, 0x112CA311), LIMB_PAIR(0x469E61FB, 0x91B33CCB),
+            LIMB_PAIR(0xFB2AB91B, 0x040DE443), LIMB_PAIR(0x4F9B32E8, 0xB9D124FD), LIMB_PAIR(0xF07573BD, 0x84DA47A9), LIMB_PAIR(0xAACDD14F, 0x93B7EE6B), LIMB_PARTIAL(0x064),
+            LIMB_PAIR(0x4BE64122, 0xB3AF161F), LIMB_PAIR(0x149C5475, 0x5946D2EC), LIMB_PAIR(0x256A1ECB, 0xDC04FCD0), LIMB_PAIR(0x327E7A8D, 0x4FC571B7),
+            LIMB_PAIR(0x9580EDCB, 0x5206EA55), LIMB_PAIR(0xF20A94C0, 0x7F41A742), LIMB_PAIR(0xF7FE1FBB, 0x1BFDDFF0), LIMB_PAIR(0xE2F1FDDC, 0x3860B232), LIMB_PARTIAL(0x1CA)
+        },
+        {   // 3 * 16^52 * G
+            LIMB_PAIR(0x10392DB1, 0x9DE5C6D8), LIMB_PAIR(0x7912DAE2, 0xF58B3C58), LIMB_PAIR(0xC559FD2E, 0xA367F217), LIMB_PAIR(0x466A352B, 0x78F2AABB),
+            LIMB_PAIR(0xE8271660, 0xFF58D1A3), LIMB_PAIR(0x8BD06035, 0x0D06FA5B), LIMB_PAIR(0xFEA2895A, 0x026934B2), LIMB_PAIR(0xB7E1A1FF, 0x99899ABC), LIMB_PARTIAL(0x187),
+            LIMB_PAIR(0x55BB32EC, 0xFD0BCBB3), LIMB_PAIR(0x7F5D72D8, 0xAC96A04D), LIMB_PAIR(0xD939D606, 0x0D5626E3), LIMB_PAIR(0x04504A8B, 0x145BBEF6),
+            LIMB_PAIR(0xE4132C27, 0x4D946B4E), LIMB_PAIR(0x3EC1CFEB, 0x4E7887FB), LIMB_PAIR(0xE1D6E0E6, 0xEDEBCC5B), LIMB_PAIR(0x2BF4379C, 0xEB42BD23), LIMB_PARTIAL(0x0FA)
+        },
+        {   // 4 * 16^52 * G
+            LIMB_PAIR(0x155C337B, 0x7EAEFE12), LIMB_PAIR(0xC7186596, 0x357F27CE), LIMB_PAIR(0x654DBBEB, 0x90C26C69), LIMB_PAIR(0xA1B63A6A, 0x6BCCA278),
+            LIMB_PAIR(0x8EDD9123, 0x776B7A92), LIMB_PAIR(0x6C6DA5E9, 0xB2BEF507), LIMB_PAIR(0x0E3C747B, 0x805ED3AA), LIMB_PAIR(0x659DF2EF, 0x298EF458), LIMB_PARTIAL(0x098),
+            LIMB_PAIR(0x35A79F8D, 0xE3DD8939), LIMB_PAIR(0xA1972C6B, 0x672B109C), LIMB_PAIR(0x07953A4D, 0xAD41CBAE), LIMB_PAIR(0xD206DE77, 0xDE07527F),
+            LIMB_PAIR(0xB61D9811, 0x1F55A4C0), LIMB_PAIR(0x7A75360E, 0x929D56D5), LIMB_PAIR(0x5032EFE6, 0x9F2BECFF), LIMB_PAIR(0x60F0622C, 0x0DE654C7), LIMB_PARTIAL(0x018)
+        },
+        {   // 5 * 16^52 * G
+            LIMB_PAIR(0x632B1ECF, 0x971B8F03), LIMB_PAIR(0xE4B06088, 0x4052AE98), LIMB_PAIR(0x5AEE5313, 0x323C3E29), LIMB_PAIR(0x635E62C0, 0x7574C5DE),
+            LIMB_PAIR(0xF0595C76, 0x2F53804C), LIMB_PAIR(0xBF3BC3AF, 0x2ECD2BC5), LIMB_PAIR(0xFABA7271, 0x5C7EFEC0), LIMB_PAIR(0x867C13BC, 0xDB04A6EE), LIMB_PARTIAL(0x155),
+            LIMB_PAIR(0xCE3FF1E4, 0xD971CB39), LIMB_PAIR(0x7F56172F, 0x15D128CB), LIMB_PAIR(0x4B6EE708, 0xA1DF4ABB), LIMB_PAIR(0x3C9EBBEA, 0x06A4BC6C),
+            LIMB_PAIR(0xB3FA98D4, 0x766544EB), LIMB_PAIR(0xA2C44D89, 0x78399E61), LIMB_PAIR(0xA25D711D, 0xA6EF214C), LIMB_PAIR(0xDB54091B, 0x643648C3), LIMB_PARTIAL(0x0BD)
+        },
+        {   // 6 * 16^52 * G
+            LIMB_PAIR(0x7E90D114, 0x5836D62A), LIMB_PAIR(0x95A519C6, 0x661E32F3), LIMB_PAIR(0x69BACBAE, 0x9C1082C8), LIMB_PAIR(0xF10CBFAD, 0x5A4BBB58),
+            LIMB_PAIR(0x7C1BE909, 0x04EE0B06), LIMB_PAIR(0x8EA7768A, 0xC726F052), LIMB_PAIR(0x5B1B777E, 0xD82148C7), LIMB_PAIR(0x82E33686, 0x0B9F20BF), LIMB_PARTIAL(0x172),
+            LIMB_PAIR(0xCBE4B02C, 0x2CB030B0), LIMB_PAIR(0x8382C749, 0xBAEFED9F), LIMB_PAIR(0x1DAFDDA6, 0x8DF9D1D0), LIMB_PAIR(0xFE045A44, 0x9F4B2CC1),
+            LIMB_PAIR(0x9CEFB90C, 0xDC102609), LIMB_PAIR(0x9027BB0B, 0x577098DF), LIMB_PAIR(0xB6260AFF, 0xA13DEC95), LIMB_PAIR(0x5011ACD4, 0xD45A8C13), LIMB_PARTIAL(0x16D)
+        },
+        {   // 7 * 16^52 * G
+            LIMB_PAIR(0x0F694063, 0x4DC3246F), LIMB_PAIR(0xAEBD3125, 0xED3DD53C), LIMB_PAIR(0x0E985D76, 0x9B3BE97F), LIMB_PAIR(0x9A5EC60C, 0x37EB09EA),
+            LIMB_PAIR(0xF0C7D07C, 0x14FD9893), LIMB_PAIR(0x7FC04709, 0xE085E642), LIMB_PAIR(0x80FC7AA4, 0xD56DB4A7), LIMB_PAIR(0x4398A2C4, 0x16ECF07A), LIMB_PARTIAL(0x0BA),
+            LIMB_PAIR(0xF48054E8, 0x672219F5), LIMB_PAIR(0xC56E157F, 0x116743EE), LIMB_PAIR(0xFD5885C4, 0xE9B616AC), LIMB_PAIR(0x1BBE92E4, 0xA9DBC3E3),
+            LIMB_PAIR(0x1FB4DD56, 0x0E3BC901), LIMB_PAIR(0x590246F5, 0x51D3A59D), LIMB_PAIR(0xFDBADCE8, 0x6B003576), LIMB_PAIR(0x09A1973F, 0xE8DDFD6B), LIMB_PARTIAL(0x1E0)
+        },
+        {   // 8 * 16^52 * G
+            LIMB_PAIR(0xEA8DC4AE, 0x50E39FD1), LIMB_PAIR(0x5FD16C88, 0xC68D8B0F), LIMB_PAIR(0x0CED75AB, 0xC95F46E9), LIMB_PAIR(0x7375E952, 0x845EE394),
+            LIMB_PAIR(0x3C14B1C2, 0x5865161D), LIMB_PAIR(0x399431AC, 0xE29AE3A6), LIMB_PAIR(0xF0FECA0E, 0x02D1C6EA), LIMB_PAIR(0x24F35B02, 0x76059DAD), LIMB_PARTIAL(0x081),
+            LIMB_PAIR(0x3AC6A96E, 0x29FEFCA1), LIMB_PAIR(0x5D01C1D8, 0x260A7F7D), LIMB_PAIR(0x3EF9812F, 0x63FA3603), LIMB_PAIR(0xF9404B6D, 0xAB1A91C9),
+            LIMB_PAIR(0xA9406E88, 0x32555CFD), LIMB_PAIR(0x5B63890D, 0x666EAE1C), LIMB_PAIR(0xFE9605E0, 0x22EC92AA), LIMB_PAIR(0x3235E860, 0xDE2A8510), LIMB_PARTIAL(0x0C3)
+        }
+    },
+#endif
+#if (53 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^53 * G
+            LIMB_PAIR(0xD90119AE, 0x2BAD7686), LIMB_PAIR(0x464B230C, 0x8DCD64F0), LIMB_PAIR(0xDAD19CB1, 0x1D1EEB94), LIMB_PAIR(0x86F0EB48, 0x3B470389),
+            LIMB_PAIR(0x2C50F380, 0x42ABB37D), LIMB_PAIR(0xA7A99EB1, 0xFABBCEBB), LIMB_PAIR(0x33FB0B08, 0xFEED69DD), LIMB_PAIR(0x31DC2B1E, 0x8DE8B50E), LIMB_PARTIAL(0x057),
+            LIMB_PAIR(0x054ED7A9, 0xE10DC8A6), LIMB_PAIR(0xCF39BEC8, 0x7094FC36), LIMB_PAIR(0x25848527, 0x487789A8), LIMB_PAIR(0x39974124, 0x8786EAA3),
+            LIMB_PAIR(0xA6E3E5AB, 0x47A0D6B0), LIMB_PAIR(0xE981E517, 0x54ED0B21), LIMB_PAIR(0xE768123B, 0x85CF17EA), LIMB_PAIR(0x636E78C6, 0xD9A933B0), LIMB_PARTIAL(0x127)
+        },
+        {   // 2 * 16^53 * G
+            LIMB_PAIR(0xCF34553B, 0xD388E288), LIMB_PAIR(0xC6D36700, 0xD09B7877), LIMB_PAIR(0x9504C41B, 0xC3E51B05), LIMB_PAIR(0xD0EF31AB, 0x0BBD1313),
+            LIMB_PAIR(0x0A3E2144, 0x45575908), LIMB_PAIR(0xD4B738B8, 0x774BF584), LIMB_PAIR(0xE9D97733, 0x3F4D85BA), LIMB_PAIR(0xF0E4A66B, 0xDFEA7F28), LIMB_PARTIAL(0x172),
+            LIMB_PAIR(0x8118AE5C, 0xA6B68455), LIMB_PAIR(0x8E41C0E2, 0x7A387B8B), LIMB_PAIR(0xF2B2CD4F, 0x96193C31), LIMB_PAIR(0x4C5C7414, 0x54D8C893),
+            LIMB_PAIR(0x0AB2B85F, 0x397BA89F), LIMB_PAIR(0x73EEBEA5, 0x2AB9E8F7), LIMB_PAIR(0xE8D4C927, 0xF4B5ECA1), LIMB_PAIR(0x42AC45BD, 0x026A0B08), LIMB_PARTIAL(0x0AB)
+        },
+        {   // 3 * 16^53 * G
+            LIMB_PAIR(0xDF234E4E, 0x4B736D32), LIMB_PAIR(0xD14BED77, 0x66237D17), LIMB_PAIR(0x4DDE4942, 0x552BAA3E), LIMB_PAIR(0x23756FFC, 0x947169DC),
+            LIMB_PAIR(0x6749EED0, 0xE595F264), LIMB_PAIR(0xE3C8EC5F, 0x2ED82E6E), LIMB_PAIR(0x495B60A0, 0xD52DD4BC), LIMB_PAIR(0x40553CFC, 0xCCD7A2B3), LIMB_PARTIAL(0x1B7),
+            LIMB_PAIR(0x889FBDA2, 0x9DE7E73E), LIMB_PAIR(0xC02A698B, 0xEB68C0D9), LIMB_PAIR(0x1510C24B, 0xC433363B), LIMB_PAIR(0xE2AF686F, 0x329F6B4E),
+            LIMB_PAIR(0x3CD6CBD5, 0x3BF95CB3), LIMB_PAIR(0x39E49B52, 0x2C9924B3), LIMB_PAIR(0x3E1AE491, 0x3A4322BB), LIMB_PAIR(0x504F582E, 0x3EFB3B85), LIMB_PARTIAL(0x150)
+        },
+        {   // 4 * 16^53 * G
+            LIMB_PAIR(0x36B984A3, 0xA01F0A19), LIMB_PAIR(0x2AE5AD96, 0x46AD9173), LIMB_PAIR(0xDF12A570, 0xBD7C413D), LIMB_PAIR(0xFBE510AE, 0x24A748C0),
+            LIMB_PAIR(0x434D6671, 0x27FF3748), LIMB_PAIR(0xE1D69BAA, 0x96AD6F33), LIMB_PAIR(0x7DAF1390, 0x4B89A84A), LIMB_PAIR(0x82E527CD, 0x2E255777), LIMB_PARTIAL(0x129),
+            LIMB_PAIR(0x615C0331, 0x78B130D2), LIMB_PAIR(0xFA3CEF15, 0xF5A9B025), LIMB_PAIR(0xFEA12B29, 0x67B99DE5), LIMB_PAIR(0x1F56CACE, 0x5F5B07E2),
+            LIMB_PAIR(0xAEB8B26D, 0x2AF1EE2F), LIMB_PAIR(0x346279B3, 0x04E82314), LIMB_PAIR(0x9AE70E2C, 0x0F1D8817), LIMB_PAIR(0x4C3EA88C, 0x85F03C61), LIMB_PARTIAL(0x1FC)
+        },
+        {   // 5 * 16^53 * G
+            LIMB_PAIR(0x7BADAA12, 0x63C83543), LIMB_PAIR(0x93D1298F, 0x2929FBF9), LIMB_PAIR(0xA6D3C271, 0x22D8A8E5), LIMB_PAIR(0x6CC70FEA, 0x4361A096),
+            LIMB_PAIR(0x0B060761, 0x4C169892), LIMB_PAIR(0x7B83B19A, 0x43B3A57B), LIMB_PAIR(0x5D1E0382, 0x8E4E16ED), LIMB_PAIR(0x01FB83B1, 0x1C4596C1), LIMB_PARTIAL(0x0D2),
+            LIMB_PAIR(0x2D0878BB, 0x571E0F7A), LIMB_PAIR(0x3BA6448B, 0x28EFBF80), LIMB_PAIR(0x3F53EC10, 0xC49EADD5), LIMB_PAIR(0x9B6B85B6, 0x5F67C579),
+            LIMB_PAIR(0x0F279676, 0x999676ED), LIMB_PAIR(0x129E0870, 0x62BA191B), LIMB_PAIR(0x21475E41, 0x5F0823B6), LIMB_PAIR(0xF2C8B56B, 0x8BC381AD), LIMB_PARTIAL(0x164)
+        },
+        {   // 6 * 16^53 * G
+            LIMB_PAIR(0x52E9A506, 0x86B14B14), LIMB_PAIR(0xECD178C9, 0x06F9F838), LIMB_PAIR(0x3599039B, 0x3D605EE5), LIMB_PAIR(0x2E3DF8F7, 0xDD3AD5A2),
+            LIMB_PAIR(0xFDD6867F, 0xBD51AF94), LIMB_PAIR(0xD45CF3DA, 0x707034F3), LIMB_PAIR(0x3F70A45C, 0x54EDCF4A), LIMB_PAIR(0x2979902C, 0x7B616439), LIMB_PARTIAL(0x1AE),
+            LIMB_PAIR(0x28389BCD, 0x7D63EE27), LIMB_PAIR(0xB8EBA714, 0x8B39BB03), LIMB_PAIR(0xA6E99D38, 0xFE5A3AAA), LIMB_PAIR(0x14A97BAF, 0xAF6074AC),
+            LIMB_PAIR(0xAFF2ED81, 0xA15AC327), LIMB_PAIR(0xFE4FD2EF, 0xBA728133), LIMB_PAIR(0xE93DB974, 0x9DB04DDA), LIMB_PAIR(0x3A858D00, 0xD50F2629), LIMB_PARTIAL(0x119)
+        },
+        {   // 7 * 16^53 * G
+            LIMB_PAIR(0xE34E4C6A, 0xEA0D44C4), LIMB_PAIR(0xE8B02105, 0x6F50243D), LIMB_PAIR(0x796C212C, 0xEDE2B16C), LIMB_PAIR(0x42A087C6, 0x3F7169F2),
+            LIMB_PAIR(0xA4762CDC, 0x33FA8470), LIMB_PAIR(0x13FFC120, 0x05F65DB6), LIMB_PAIR(0x4FB1C4F7, 0x9BF29F3F), LIMB_PAIR(0x45433134, 0xEF4CA473), LIMB_PARTIAL(0x0F8),
+            LIMB_PAIR(0x331968BC, 0xE59DA628), LIMB_PAIR(0x6946B696, 0x3FBF6BC4), LIMB_PAIR(0xF82EF2AF, 0xEC6AB1D7), LIMB_PAIR(0x260BB4A9, 0xD0423E4F),
+            LIMB_PAIR(0x1D44CBF6, 0x956FEF51), LIMB_PAIR(0x8E5195C9, 0x26F86122), LIMB_PAIR(0x5DACA40A, 0xBE8B410C), LIMB_PAIR(0x9D08BDAD, 0x3FAC01F2), LIMB_PARTIAL(0x104)
+        },
+        {   // 8 * 16^53 * G
+            LIMB_PAIR(0x8F358002, 0xBFECF64A), LIMB_PAIR(0x9179B6F0, 0xA9FA4A5E), LIMB_PAIR(0x5B44CF88, 0x8C1ECBEC), LIMB_PAIR(0xEB342A9C, 0xF443C158),
+            LIMB_PAIR(0xADA473CD, 0x0EEE17B6), LIMB_PAIR(0x3AF99DF4, 0x4EB51B72), LIMB_PAIR(0xE0FE8DFC, 0xA524E6D1), LIMB_PAIR(0xFE2A4F42, 0xEDC72C8E), LIMB_PARTIAL(0x073),
+            LIMB_PAIR(0xE0CD65AF, 0x34EB386D), LIMB_PAIR(0xCC80C3B0, 0x387C3874), LIMB_PAIR(0x51883B25, 0x75AC76B7), LIMB_PAIR(0x6B514806, 0x0F6CCBFB),
+            LIMB_PAIR(0x867909E7, 0xE85C5856), LIMB_PAIR(0x5A9B263C, 0x61A5BC9E), LIMB_PAIR(0xC6228360, 0x08B8491A), LIMB_PAIR(0x2850DBC7, 0x6835D359), LIMB_PARTIAL(0x05A)
+        }
+    },
+#endif
+#if (54 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^54 * G
+            LIMB_PAIR(0xF6D20ECA, 0xEC9A8956), LIMB_PAIR(0x684E0169, 0xEDA0A24D), LIMB_PAIR(0xE583C40A, 0xA55AE258), LIMB_PAIR(0x455D3CE1, 0xBE8C6286),
+            LIMB_PAIR(0x2096AE62, 0x05BF6313), LIMB_PAIR(0x20B48BDE, 0xF68E0249), LIMB_PAIR(0x4D99CD14, 0x1B6595BC), LIMB_PAIR(0x774958BE, 0x0E740830), LIMB_PARTIAL(0x030),
+            LIMB_PAIR(0x9FD73274, 0x3241B0DF), LIMB_PAIR(0x8FE5A5DD, 0x7B653239), LIMB_PAIR(0x38412A8D, 0x2D4DD56E), LIMB_PAIR(0xCC58A62A, 0xE2925F33),
+            LIMB_PAIR(0xF5CEE12B, 0xB859EA32), LIMB_PAIR(0x7C25D1D2, 0x5AF7C402), LIMB_PAIR(0x6F196E55, 0xE172CEC1), LIMB_PAIR(0xDE00641C, 0x34815491), LIMB_PARTIAL(0x10B)
+        },
+        {   // 2 * 16^54 * G
+            LIMB_PAIR(0xFA226AEA, 0x0869ED35), LIMB_PAIR(0x645F4485, 0xCBC7BD56), LIMB_PAIR(0x3E6C3D97, 0x611101B1), LIMB_PAIR(0xF7A56F83, 0xA1550183),
+            LIMB_PAIR(0x80A6FCD4, 0xBE209B3C), LIMB_PAIR(0xEA3BEAFF, 0x0E2C9DA9), LIMB_PAIR(0x14D9F7CE, 0x0FC7A16F), LIMB_PAIR(0x7A1E6DB1, 0xEB8A5E14), LIMB_PARTIAL(0x047),
+            LIMB_PAIR(0x3B0FB32C, 0x55A78C25), LIMB_PAIR(0xA430D4C9, 0x449A7852), LIMB_PAIR(0x412509F0, 0x1383A88A), LIMB_PAIR(0x329AF78D, 0xE895D858),
+            LIMB_PAIR(0xF8D65A07, 0x14AFC01C), LIMB_PAIR(0x193D67E3, 0x89303BC5), LIMB_PAIR(0x16FBCDF5, 0x42B20C97), LIMB_PAIR(0x0EE012AA, 0x79FE6966), LIMB_PARTIAL(0x0D9)
+        },
+        {   // 3 * 16^54 * G
+            LIMB_PAIR(0x4E7E98F2, 0x80CA977C), LIMB_PAIR(0xCD7A9AE3, 0x0A0BD3D8), LIMB_PAIR(0x8EE369BA, 0x122C33DA), LIMB_PAIR(0xDFE25A99, 0x340A8462),
+            LIMB_PAIR(0xCBDBC904, 0x79FF5C18), LIMB_PAIR(0xF1818B44, 0x0BC05B6C), LIMB_PAIR(0x77E9157E, 0xFE9F3C65), LIMB_PAIR(0xA1064D23, 0xCA1717C7), LIMB_PARTIAL(0x051),
+            LIMB_PAIR(0x6A365B28, 0xCE8ECCB8), LIMB_PAIR(0x73819001, 0x6208E872), LIMB_PAIR(0x015365FC, 0xC774AB6F), LIMB_PAIR(0x9F9D80BC, 0x22339223),
+            LIMB_PAIR(0x52E59382, 0x1C008664), LIMB_PAIR(0xEB747619, 0x28D7846B), LIMB_PAIR(0x56F1B541, 0x44AFB844), LIMB_PAIR(0xCE7504C4, 0x161BD257), LIMB_PARTIAL(0x13B)
+        },
+        {   // 4 * 16^54 * G
+            LIMB_PAIR(0x507CE79E, 0x7480912F), LIMB_PAIR(0x3A1EA21F, 0xF2251DA2), LIMB_PAIR(0xFBC957F9, 0xB925AADB), LIMB_PAIR(0xF4548E12, 0x79A66979),
+            LIMB_PAIR(0x6DE9A9FE, 0x9200714B), LIMB_PAIR(0xEE62D344, 0x779792BB), LIMB_PAIR(0x57501CCC, 0xEED3D083), LIMB_PAIR(0x0EF8C948, 0x51ECEC8B), LIMB_PARTIAL(0x14C),
+            LIMB_PAIR(0x05271E42, 0x734A634B), LIMB_PAIR(0x643CDB88, 0x70E28C86), LIMB_PAIR(0x0C24A7EE, 0x849FC7DD), LIMB_PAIR(0xB20506A4, 0xCEC60426),
+            LIMB_PAIR(0x35655C14, 0x6EE05FCE), LIMB_PAIR(0xC072D950, 0x79CA2BE8), LIMB_PAIR(0x105C09EF, 0x6C473203), LIMB_PAIR(0x3DBF27B2, 0xD9698B13), LIMB_PARTIAL(0x010)
+        },
+        {   // 5 * 16^54 * G
+            LIMB_PAIR(0x6E98D8D9, 0x8A810058), LIMB_PAIR(0xD4B641C6, 0xF61EB17A), LIMB_PAIR(0x48D88066, 0xAF5FF280), LIMB_PAIR(0x525A6863, 0xB74D5092),
+            LIMB_PAIR(0x90D44C03, 0x41F2166E), LIMB_PAIR(0xAC397C83, 0x40CFB825), LIMB_PAIR(0x67F050F0, 0x873F9A60), LIMB_PAIR(0x3B290DD7, 0x5F7A12A3), LIMB_PARTIAL(0x170),
+            LIMB_PAIR(0x4CE77C04, 0xC4E73DE8), LIMB_PAIR(0xD20DA7E5, 0xD9EDE081), LIMB_PAIR(0x61C3E3B1, 0x049A706F), LIMB_PAIR(0x1180CAB8, 0x2F9EB2CE),
+            LIMB_PAIR(0xF1041068, 0x04128D8A), LIMB_PAIR(0x8542062E, 0x0D480B12), LIMB_PAIR(0x2EA578E1, 0x1ACB604F), LIMB_PAIR(0xA2A8E97B, 0x636A4F2D), LIMB_PARTIAL(0x1A0)
+        },
+        {   // 6 * 16^54 * G
+            LIMB_PAIR(0x3A7DE86E, 0x15079B9D), LIMB_PAIR(0x354FAF62, 0x97E07C04), LIMB_PAIR(0x4280E300, 0x045F48F3), LIMB_PAIR(0xBD9EA013, 0x9A5FD235),
+            LIMB_PAIR(0x8760C3D8, 0x3F75A31F), LIMB_PAIR(0xD05D488F, 0x18AEC5FF), LIMB_PAIR(0x617DAF6E, 0xCCFB484B), LIMB_PAIR(0xBFFAB914, 0xF33084DE), LIMB_PARTIAL(0x15E),
+            LIMB_PAIR(0xDD5BC9B0, 0x1C034F37), LIMB_PAIR(0x882C69A5, 0x8E2BEDAF), LIMB_PAIR(0xA61AFC24, 0x6789F307), LIMB_PAIR(0xC57B651C, 0x8540D05D),
+            LIMB_PAIR(0x19F83EA8, 0x72149143), LIMB_PAIR(0x962C6ED0, 0x57AF134D), LIMB_PAIR(0xD98B1089, 0xCD059751), LIMB_PAIR(0x42E7077A, 0x08AD5D1D), LIMB_PARTIAL(0x0DB)
+        },
+        {   // 7 * 16^54 * G
+            LIMB_PAIR(0x0D46AD1F, 0x4AA44435), LIMB_PAIR(0x66460711, 0x3E30D952), LIMB_PAIR(0x859419F8, 0x49A9ABF1), LIMB_PAIR(0x54D20A3E, 0x75804950),
+            LIMB_PAIR(0xEC3E54EA, 0x1FC9C16C), LIMB_PAIR(0x407F5314, 0xA40B0D69), LIMB_PAIR(0x0C5ABFA3, 0x97329397), LIMB_PAIR(0xCE6D2457, 0xA5128890), LIMB_PARTIAL(0x10D),
+            LIMB_PAIR(0x32452B45, 0xD6BF1962), LIMB_PAIR(0x6DE3A847, 0x9FD7A448), LIMB_PAIR(0x5ED5C47E, 0x3E4CDF08), LIMB_PAIR(0x2364C81E, 0x29A69301),
+            LIMB_PAIR(0xAC3E4BDD, 0x942DE3E8), LIMB_PAIR(0x6076A4DE, 0xDAFFF8DC), LIMB_PAIR(0x77829D01, 0x2AF83211), LIMB_PAIR(0x1F3358DF, 0x5D3D4369), LIMB_PARTIAL(0x015)
+        },
+        {   // 8 * 16^54 * G
+            LIMB_PAIR(0x64D8C387, 0x163CD524), LIMB_PAIR(0xCB029390, 0x0CFE9416), LIMB_PAIR(0x9E9EC846, 0xCE6B5DAB), LIMB_PAIR(0xE9BA4592, 0x96A78639),
+            LIMB_PAIR(0x8F174287, 0xA78E4296), LIMB_PAIR(0x37763D66, 0xE5D09A76), LIMB_PAIR(0xB54F368D, 0x9F47ACF6), LIMB_PAIR(0x6A0FA894, 0x8E63481B), LIMB_PARTIAL(0x026),
+            LIMB_PAIR(0x05C8BAB5, 0xE1663CA8), LIMB_PAIR(0xCA0AF033, 0x99BF02AA), LIMB_PAIR(0xAA1D7C42, 0xFB1C0C7F), LIMB_PAIR(0x11BDCC7D, 0x05AC75B0),
+            LIMB_PAIR(0x99D86019, 0xBFA1DC73), LIMB_PAIR(0x937CFA73, 0x8F11D0A4), LIMB_PAIR(0xD24E356D, 0xF4795BD7), LIMB_PAIR(0x78B4E4FF, 0x7C1F3DC4), LIMB_PARTIAL(0x14C)
+        }
+    },
+#endif
+#if (55 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^55 * G
+            LIMB_PAIR(0x24ACB1FA, 0x36CDC3E6), LIMB_PAIR(0x6C6D43AD, 0xF593D32D), LIMB_PAIR(0x373C8E18, 0x766C2FCD), LIMB_PAIR(0x3D12B7F3, 0x0A151836),
+            LIMB_PAIR(0xB4234A24, 0x924427F4), LIMB_PAIR(0x2335FF44, 0xAAB87785), LIMB_PAIR(0x7C362011, 0x9E581189), LIMB_PAIR(0x5EE724DB, 0xD86F8FBA), LIMB_PARTIAL(0x184),
+            LIMB_PAIR(0xC9558569, 0x25F04ED9), LIMB_PAIR(0xEF9562C5, 0x0A315324), LIMB_PAIR(0x9CCEFB92, 0x65A02A28), LIMB_PAIR(0x88115608, 0xB2429DD4),
+            LIMB_PAIR(0x641D646B, 0xC1714C93), LIMB_PAIR(0x48BB144A, 0xBA4D3691), LIMB_PAIR(0x9EFA3A6F, 0x48EC2D9D), LIMB_PAIR(0xF1A93AE3, 0x5FF6A4FB), LIMB_PARTIAL(0x1ED)
+        },
+        {   // 2 * 16^55 * G
+            LIMB_PAIR(0xB584AF4E, 0x8661728E), LIMB_PAIR(0x3A25E264, 0x954BB875), LIMB_PAIR(0x15BE119D, 0xC8398609), LIMB_PAIR(0x989FB866, 0x06A54D7F),
+            LIMB_PAIR(0xE0375BC8, 0x27B590ED), LIMB_PAIR(0xAFBF60DD, 0xC394A6B7), LIMB_PAIR(0x3A892981, 0x32CB7164), LIMB_PAIR(0xCAE4336A, 0x61B46241), LIMB_PARTIAL(0x0D3),
+            LIMB_PAIR(0x970AF48D, 0xA2E80EED), LIMB_PAIR(0x20F95E36, 0x087C2E63), LIMB_PAIR(0xEE080071, 0x82956A6E), LIMB_PAIR(0xF9FC2967, 0x933A2568),
+            LIMB_PAIR(0x1B5430B1, 0xAA2B21A3), LIMB_PAIR(0xB6502FA8, 0xB1EFDF09), LIMB_PAIR(0x0A897789, 0x56B2B8B5), LIMB_PAIR(0x663DC2EA, 0x3A6F9FDA), LIMB_PARTIAL(0x1E4)
+        },
+        {   // 3 * 16^55 * G
+            LIMB_PAIR(0x2C825D50, 0x8B2F31A0), LIMB_PAIR(0x0B3DD67A, 0x5FA4A38E), LIMB_PAIR(0xDD220E0F, 0xCC07EAFE), LIMB_PAIR(0x53666CD5, 0x3A8496F8),
+            LIMB_PAIR(0x116DA23E, 0xF1E8B23E), LIMB_PAIR(0x1631080D, 0xF48DE9F4), LIMB_PAIR(0x4139C8DB, 0xCC327445), LIMB_PAIR(0x1DBE7C3D, 0x3270CE0A), LIMB_PARTIAL(0x1C6),
+            LIMB_PAIR(0x5054F6B3, 0x21089578), LIMB_PAIR(0xD94BF609, 0x8295EC2D), LIMB_PAIR(0x854941F4, 0x1922BDBA), LIMB_PAIR(0x357020E9, 0xA95EB4DE),
+            LIMB_PAIR(0xDF0D7747, 0xD15FE663), LIMB_PAIR(0xFF86B9CE, 0x89CA6DB1), LIMB_PAIR(0x4F1A6D6D, 0xC3BBAADC), LIMB_PAIR(0x8A0C471E, 0xDEAB3F65), LIMB_PARTIAL(0x1BC)
+        },
+        {   // 4 * 16^55 * G
+            LIMB_PAIR(0xD759F021, 0x1874803F), LIMB_PAIR(0xF7CCDC14, 0xE16E4F43), LIMB_PAIR(0x6CA96E4A, 0x33B15C68), LIMB_PAIR(0xC0C8F6A5, 0x16647507),
+            LIMB_PAIR(0x0DDC1A2B, 0x0A69A27B), LIMB_PAIR(0x8C4496EB, 0xEFA1D7D2), LIMB_PAIR(0x47064396, 0x8BD873D3), LIMB_PAIR(0x53DD5370, 0x13B07FA6), LIMB_PARTIAL(0x008),
+            LIMB_PAIR(0xDBF8A088, 0x97373827), LIMB_PAIR(0xDCD37018, 0x0F48A5DF), LIMB_PAIR(0x172E6D9C, 0xF3BC5022), LIMB_PAIR(0x0867BC4E, 0x96A0D702),
+            LIMB_PAIR(0xD1A46E33, 0x26130628), LIMB_PAIR(0x8C2BDDA5, 0xBA6C1F6A), LIMB_PAIR(0x4E5E6112, 0x273F3F4D), LIMB_PAIR(0xCF810455, 0xC9F3341E), LIMB_PARTIAL(0x084)
+        },
+        {   // 5 * 16^55 * G
+            LIMB_PAIR(0x8F3756C2, 0x67745082), LIMB_PAIR(0x0A7BFCC9, 0xABF1E75D), LIMB_PAIR(0xB8BAD3AF, 0x047931DB), LIMB_PAIR(0x5E392278, 0xA380C985),
+            LIMB_PAIR(0x0237D6BC, 0x5195E47D), LIMB_PAIR(0xFEE7427C, 0x8C7EF452), LIMB_PAIR(0x585B6365, 0x4F078DD2), LIMB_PAIR(0x1E10D24E, 0x4E82EB4B), LIMB_PARTIAL(0x0D8),
+            LIMB_PAIR(0x610B349B, 0xDA54DC52), LIMB_PAIR(0x904633F2, 0x96746E43), LIMB_PAIR(0x2C50AA46, 0xD2A58F33), LIMB_PAIR(0x987F9FC3, 0xFFEA4D06),
+            LIMB_PAIR(0xCC521553, 0x5505265A), LIMB_PAIR(0xC316DF83, 0xAF2B7DA0), LIMB_PAIR(0xEA362ECB, 0xA74F09B1), LIMB_PAIR(0xA2E1F4F5, 0xCF9F0AC3), LIMB_PARTIAL(0x078)
+        },
+        {   // 6 * 16^55 * G
+            LIMB_PAIR(0x075676DF, 0xCE7AE0B6), LIMB_PAIR(0x29BE05BE, 0x24DAA3AA), LIMB_PAIR(0x7B2F292F, 0x795B32D1), LIMB_PAIR(0x77AE64FE, 0xF71DBF4F),
+            LIMB_PAIR(0xDCCA4F00, 0xE5F8B83B), LIMB_PAIR(0x71E2E120, 0x111A06DB), LIMB_PAIR(0xA861E714, 0x6E7937F5), LIMB_PAIR(0x17BF3BE6, 0x7B14D158), LIMB_PARTIAL(0x0E6),
+            LIMB_PAIR(0x9D04DAAC, 0xA8748D31), LIMB_PAIR(0x9325722B, 0x28E3FDAC), LIMB_PAIR(0x9E26FC1C, 0x4384AC25), LIMB_PAIR(0x20F8D023, 0xCBCE8C33),
+            LIMB_PAIR(0x9FED4B2F, 0xA21E8ABB), LIMB_PAIR(0xA075F969, 0x5F1D2DFC), LIMB_PAIR(0x5E8E705B, 0x43D3C57F), LIMB_PAIR(0xDEB0BCA3, 0xCAC9948F), LIMB_PARTIAL(0x0A4)
+        },
+        {   // 7 * 16^55 * G
+            LIMB_PAIR(0x3BB93EAF, 0x17100A61), LIMB_PAIR(0xD80AC200, 0x7CCB5BF3), LIMB_PAIR(0xEAB320C3, 0x585D17B6), LIMB_PAIR(0xE7258F8D, 0x8D53EFF1),
+            LIMB_PAIR(0x3F21F78A, 0x9D671EE1), LIMB_PAIR(0x3DC4AD54, 0x76E7AB70), LIMB_PAIR(0x19B3FFC7, 0x9EF22724), LIMB_PAIR(0xAFD5A3CA, 0x67B54B1F), LIMB_PARTIAL(0x122),
+            LIMB_PAIR(0x33A86EDF, 0x629DFAFB), LIMB_PAIR(0x7E4AE084, 0x237E33D9), LIMB_PAIR(0x4CA49A1A, 0xE1D10234), LIMB_PAIR(0xB6E2E180, 0x768D5901),
+            LIMB_PAIR(0xD2EC4AD3, 0xFEBBD9DA), LIMB_PAIR(0xA9E332DC, 0x90AB63EB), LIMB_PAIR(0x8DA3786B, 0x5E2636C7), LIMB_PAIR(0xD3F6FF9F, 0xCBABB3FA), LIMB_PARTIAL(0x190)
+        },
+        {   // 8 * 16^55 * G
+            LIMB_PAIR(0x12A09898, 0xCF8E03C5), LIMB_PAIR(0x38287AF8, 0x20901184), LIMB_PAIR(0x371620A2, 0x8FD47E85), LIMB_PAIR(0x7F16350A, 0x5A2B2EC8),
+            LIMB_PAIR(0x608C7488, 0x45841B1C), LIMB_PAIR(0x01739426, 0x627C632E), LIMB_PAIR(0x8F8E8224, 0x3CB05AA7), LIMB_PAIR(0x9B643A85, 0xBE277FD7), LIMB_PARTIAL(0x1FE),
+            LIMB_PAIR(0x1538CB4D, 0x950843E6), LIMB_PAIR(0x4F7AE0E6, 0xE8838399), LIMB_PAIR(0xD2E1D225, 0x6B90AC85), LIMB_PAIR(0x1E5361B4, 0x78C21132),
+            LIMB_PAIR(0x34B950FF, 0xCE09F240), LIMB_PAIR(0x74B71400, 0x38840169), LIMB_PAIR(0x65E2BBAF, 0x58AE40A6), LIMB_PAIR(0xC823B954, 0x5D370978), LIMB_PARTIAL(0x17C)
+        }
+    },
+#endif
+#if (56 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^56 * G
+            LIMB_PAIR(0x1733B3C3, 0x7DDF4705), LIMB_PAIR(0xF4A25D85, 0x7C7878A3), LIMB_PAIR(0x29AD09A6, 0x4D86F57C), LIMB_PAIR(0xB26D5C69, 0xA97D4AB6),
+            LIMB_PAIR(0x04B07913, 0x71CC9250), LIMB_PAIR(0xB4C0B7B2, 0x08A84131), LIMB_PAIR(0x5119F83E, 0x388FC8AA), LIMB_PAIR(0x6BFDA0CB, 0x23A3BD0B), LIMB_PARTIAL(0x07E),
+            LIMB_PAIR(0x8E549373, 0xDFC7C844), LIMB_PAIR(0xB52AD215, 0x439DC785), LIMB_PAIR(0xFB9DE6DC, 0x9E157E18), LIMB_PAIR(0x8793D562, 0x9283C331),
+            LIMB_PAIR(0x33DDC16C, 0x79F9EC90), LIMB_PAIR(0xCEFF5086, 0xED0DBB7F), LIMB_PAIR(0x8765145E, 0xFA466807), LIMB_PAIR(0xA3B387B7, 0xBA9411A9), LIMB_PARTIAL(0x176)
+        },
+        {   // 2 * 16^56 * G
+            LIMB_PAIR(0x10E10587, 0x319885D1), LIMB_PAIR(0x609853A4, 0x2DA8979A), LIMB_PAIR(0x89B08EF5, 0xFE907FE3), LIMB_PAIR(0x1A97D9DC, 0xA3A338A6),
+            LIMB_PAIR(0xD7E3FB92, 0xA5AD1A9A), LIMB_PAIR(0x7A0136E3, 0x77A3BFC0), LIMB_PAIR(0xAA6ED29A, 0x99634588), LIMB_PAIR(0xEF4787B6, 0x41F148BE), LIMB_PARTIAL(0x0DC),
+            LIMB_PAIR(0xEBF698BD, 0xB8671195), LIMB_PAIR(0xE2974EE2, 0x323B6965), LIMB_PAIR(0x84C20702, 0x1411C670), LIMB_PAIR(0xBA4BC1ED, 0x840B396E),
+            LIMB_PAIR(0xEECFF9A6, 0xD857A525), LIMB_PAIR(0xD2D6829B, 0x0AFAD4F4), LIMB_PAIR(0xBF6CE02C, 0x84EF6315), LIMB_PAIR(0xCCC6B333, 0xC38FE857), LIMB_PARTIAL(0x01B)
+        },
+        {   // 3 * 16^56 * G
+            LIMB_PAIR(0x6F07EEF9, 0x2D9BA7E3), LIMB_PAIR(0xEB692362, 0x46EF4CE6), LIMB_PAIR(0x2FA2CDC9, 0xA869EE26), LIMB_PAIR(0x642A2378, 0x5B7D3A81),
+            LIMB_PAIR(0xD4D6BCD4, 0xC024410A), LIMB_PAIR(0x21CEAFEF, 0x88CC0F71), LIMB_PAIR(0xE04AF152, 0xEEE011EB), LIMB_PAIR(0x7829107F, 0x9CF87D1D), LIMB_PARTIAL(0x02E),
+            LIMB_PAIR(0xE07147B1, 0x49260571), LIMB_PAIR(0x0CA0C303, 0x63258346), LIMB_PAIR(0x6602E056, 0xF1CDA5AE), LIMB_PAIR(0x81A45861, 0x418B6186),
+            LIMB_PAIR(0xD1921FA5, 0xCBF17FCD), LIMB_PAIR(0xE07A08F1, 0x355E5D1A), LIMB_PAIR(0xA26B6B2F, 0x3F4F5BB0), LIMB_PAIR(0xADE69B50, 0x898CA884), LIMB_PARTIAL(0x08F)
+        },
+        {   // 4 * 16^56 * G
+            LIMB_PAIR(0x1C417FAD, 0x1A00FC11), LIMB_PAIR(0x3FBA7366, 0x8816DD0B), LIMB_PAIR(0x32C0E5A9, 0xB3A54992), LIMB_PAIR(0x9EC0FA14, 0xB6A63478),
+            LIMB_PAIR(0xA8D8615E, 0x880B10B8), LIMB_PAIR(0x3ABBE5FB, 0xE3635BB8), LIMB_PAIR(0x4DE9BE52, 0x62A209F6), LIMB_PAIR(0x82B76CF9, 0xAC41CCE1), LIMB_PARTIAL(0x1C5),
+            LIMB_PAIR(0x7DD1E73F, 0x287C7BC7), LIMB_PAIR(0x1F8C7D2C, 0x072BB2AC), LIMB_PAIR(0x3AF5565C, 0x399011FB), LIMB_PAIR(0x5E2A7E13, 0x787B9484),
+            LIMB_PAIR(0x5761AE9C, 0x5858C3DF), LIMB_PAIR(0x6D2875DA, 0xF0F831AE), LIMB_PAIR(0xAE9C82F1, 0xD5F5BF2D), LIMB_PAIR(0xB247A36E, 0x191B45FB), LIMB_PARTIAL(0x1DD)
+        },
+        {   // 5 * 16^56 * G
+            LIMB_PAIR(0xFE772021, 0x1D2D4AB0), LIMB_PAIR(0x041053D5, 0xD6E75054), LIMB_PAIR(0x5705D868, 0xDB480D2E), LIMB_PAIR(0x6AA63E89, 0xF68A09F7),
+            LIMB_PAIR(0x379A4D0C, 0x0BCF4C31), LIMB_PAIR(0xB681873C, 0xCBC0C737), LIMB_PAIR(0xB886D407, 0xDB6931A6), LIMB_PAIR(0xF84E033D, 0x0FBAA44B), LIMB_PARTIAL(0x056),
+            LIMB_PAIR(0x4F90A0FC, 0x5339B4F3), LIMB_PAIR(0x8EBC0B28, 0x2743F681), LIMB_PAIR(0xF7DB2715, 0x37567E5B), LIMB_PAIR(0xA5B1053A, 0xF339C91A),
+            LIMB_PAIR(0x8125EBFB, 0xDE65F718), LIMB_PAIR(0x6BF4ED15, 0x32F7C06D), LIMB_PAIR(0x40353DCF, 0x8071D1AA), LIMB_PAIR(0x3C994068, 0xB8FDDDD9), LIMB_PARTIAL(0x198)
+        },
+        {   // 6 * 16^56 * G
+            LIMB_PAIR(0xB6965640, 0x1C081356), LIMB_PAIR(0x90C7A0F0, 0x7A01B389), LIMB_PAIR(0x874007EE, 0xF72FDBA4), LIMB_PAIR(0xDCDDEFA2, 0x6BD85D94),
+            LIMB_PAIR(0x48DB2FA6, 0x80FBDE7E), LIMB_PAIR(0x4A319DAD, 0x60B2BE1C), LIMB_PAIR(0xEE51FB71, 0x996217FB), LIMB_PAIR(0xE0EDB983, 0x85F1B13B), LIMB_PARTIAL(0x12B),
+            LIMB_PAIR(0xECFB1D0D, 0xDF53AA14), LIMB_PAIR(0x760A217C, 0xDD77FC37), LIMB_PAIR(0x99B56FBD, 0x659BF31E), LIMB_PAIR(0xACA3E106, 0xD0F042EB),
+            LIMB_PAIR(0x1F907EA8, 0x50C215BA), LIMB_PAIR(0xA4EF5F48, 0xC6BB892C), LIMB_PAIR(0xFEB86870, 0xC3BEB73B), LIMB_PAIR(0x4123F812, 0x04B740BD), LIMB_PARTIAL(0x07C)
+        },
+        {   // 7 * 16^56 * G
+            LIMB_PAIR(0x6016E8F8, 0xD50C9FCF), LIMB_PAIR(0xB8C12F9A, 0x27F12C32), LIMB_PAIR(0x08E0E13C, 0x2E13FD2B), LIMB_PAIR(0x89E659EF, 0xE48A1BCE),
+            LIMB_PAIR(0xF62A49D6, 0x1BBE7F01), LIMB_PAIR(0xD417E497, 0x87E0CA4F), LIMB_PAIR(0x364EE9CF, 0x1CF55A48), LIMB_PAIR(0xF66635A7, 0xF4FBC7EA), LIMB_PARTIAL(0x1A6),
+            LIMB_PAIR(0x3EB12A0B, 0xBE3E5511), LIMB_PAIR(0x462EBDCD, 0xAFFCAD4B), LIMB_PAIR(0xE8F4D182, 0xF6F097AC), LIMB_PAIR(0x404A92FE, 0xDB1FE0F2),
+            LIMB_PAIR(0x4FC084EB, 0x9E2A5159), LIMB_PAIR(0x7AF882B2, 0x6ACD3A8E), LIMB_PAIR(0x9602FC6B, 0x17654A57), LIMB_PAIR(0x71DE39CF, 0x1307D122), LIMB_PARTIAL(0x0DE)
+        },
+        {   // 8 * 16^56 * G
+            LIMB_PAIR(0x2540E5C8, 0x470BFDD4), LIMB_PAIR(0x057592EC, 0xC2C849A1), LIMB_PAIR(0x2F886637, 0xD8F4B30D), LIMB_PAIR(0x25BA43E0, 0xCE56D150),
+            LIMB_PAIR(0xF200D2FB, 0xCACA4A05), LIMB_PAIR(0x95D80545, 0x38FDFB35), LIMB_PAIR(0x22418951, 0xE274649F), LIMB_PAIR(0xCB7437BE, 0x155BADB2), LIMB_PARTIAL(0x0A4),
+            LIMB_PAIR(0xC828A666, 0x09195792), LIMB_PAIR(0x53F59336, 0x3CEAF453), LIMB_PAIR(0x43850A1D, 0x3982E196), LIMB_PAIR(0xF2D2AFBD, 0x02F8077D),
+            LIMB_PAIR(0x6A6946FA, 0x83197E1E), LIMB_PAIR(0xC4FFAD53, 0xF158B0B4), LIMB_PAIR(0x853B51DA, 0x12559573), LIMB_PAIR(0x8D35C9DE, 0x8838409E), LIMB_PARTIAL(0x19C)
+        }
+    },
+#endif
+#if (57 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^57 * G
+            LIMB_PAIR(0x4175E7E0, 0xBCE0F107), LIMB_PAIR(0x1965464D, 0x51AC63D7), LIMB_PAIR(0x52AAA9EB, 0x429F6B9F), LIMB_PAIR(0x2A1846D7, 0x6ED3C53B),
+            LIMB_PAIR(0x6DCDA98A, 0xFA87D587), LIMB_PAIR(0xC72D6D0A, 0x9858C801), LIMB_PAIR(0x67681451, 0x94A5BCF3), LIMB_PAIR(0xD3DE0285, 0xB7C46ECD), LIMB_PARTIAL(0x183),
+            LIMB_PAIR(0xD2DFD89C, 0xFD301B76), LIMB_PAIR(0x0F38E6C1, 0xAC9C2B0D), LIMB_PAIR(0x2DA8E6D4, 0xCF9D3ACF), LIMB_PAIR(0xEB9024C5, 0x99DB13DC),
+            LIMB_PAIR(0x9EE659A9, 0x4EBFC5BA), LIMB_PAIR(0x9B2FA547, 0xBDED8094), LIMB_PAIR(0xC08D98C5, 0xFCF035F9), LIMB_PAIR(0x56B8B217, 0xB50DD136), LIMB_PARTIAL(0x14D)
+        },
+        {   // 2 * 16^57 * G
+            LIMB_PAIR(0x1B9ED16A, 0xA198D04B), LIMB_PAIR(0x51340438, 0x22445362), LIMB_PAIR(0x251DECA8, 0x77078E91), LIMB_PAIR(0xBE67E98E, 0x1D7B7BE1),
+            LIMB_PAIR(0x2CC726D4, 0x106648BE), LIMB_PAIR(0xF5877E13, 0x79DD8D7B), LIMB_PAIR(0x37993843, 0x42BBD30E), LIMB_PAIR(0xCA7796C9, 0xE768F54D), LIMB_PARTIAL(0x078),
+            LIMB_PAIR(0x1ACDF2FD, 0x91C5E19D), LIMB_PAIR(0xE93C20D4, 0x0A2EFF89), LIMB_PAIR(0xCE41AC1A, 0x6A84E609), LIMB_PAIR(0xDF08373C, 0x186AB6E8),
+            LIMB_PAIR(0xF6F9ABC1, 0x44C2AEF6), LIMB_PAIR(0xDD735102, 0x9C7070B0), LIMB_PAIR(0x07643871, 0x0E58B518), LIMB_PAIR(0x0B15D805, 0xBC9F2E80), LIMB_PARTIAL(0x1EC)
+        },
+        {   // 3 * 16^57 * G
+            LIMB_PAIR(0x6987A9BC, 0xE83DFBFB), LIMB_PAIR(0xE03B29B7, 0x311372DF), LIMB_PAIR(0xF4176BDC, 0x1B88AD50), LIMB_PAIR(0x37733CF5, 0x5771946F),
+            LIMB_PAIR(0xD5C0CD18, 0x4A020165), LIMB_PAIR(0xC7603086, 0xB8E35A40), LIMB_PAIR(0xDB55F57E, 0x3D06B8D0), LIMB_PAIR(0xB17B440A, 0x9CDB00CA), LIMB_PARTIAL(0x0FB),
+            LIMB_PAIR(0x34BD8619, 0x840EC341), LIMB_PAIR(0x00AB86C3, 0x40B0C107), LIMB_PAIR(0x85C69C9F, 0xF4782058), LIMB_PAIR(0x10D63734, 0x22E8D92E),
+            LIMB_PAIR(0x20A53CDF, 0x5B8E6374), LIMB_PAIR(0xFEC8A052, 0xE80C3D14), LIMB_PAIR(0xEDE62895, 0xB9C0834E), LIMB_PAIR(0xDE2EF959, 0xB2AE0EB3), LIMB_PARTIAL(0x1AA)
+        },
+        {   // 4 * 16^57 * G
+            LIMB_PAIR(0x18D0A514, 0x4B67FB41), LIMB_PAIR(0x32AE28F3, 0x0A9FDB8E), LIMB_PAIR(0xC238EBB0, 0x786B00F8), LIMB_PAIR(0x1CBB7EA0, 0xF73D53D1),
+            LIMB_PAIR(0x988A4366, 0xE3928456), LIMB_PAIR(0x1D62FCEB, 0xA108E52A), LIMB_PAIR(0x1D9484F2, 0xB923F247), LIMB_PAIR(0xAF781F08, 0x9C8DFC0C), LIMB_PARTIAL(0x12D),
+            LIMB_PAIR(0x15C72D41, 0x6485C32F), LIMB_PAIR(0x1A01F229, 0xF7EF7E58), LIMB_PAIR(0x89C87F68, 0x2DCA15D2), LIMB_PAIR(0xD86C6968, 0x91A22920),
+            LIMB_PAIR(0xFE0747CF, 0x6015A068), LIMB_PAIR(0xD744A2CB, 0x429C4D4D), LIMB_PAIR(0x43D3B8A7, 0xD707E9EA), LIMB_PAIR(0x040ED223, 0xA03AA304), LIMB_PARTIAL(0x107)
+        },
+        {   // 5 * 16^57 * G
+            LIMB_PAIR(0x718BE467, 0x0691B415), LIMB_PAIR(0x5722BF66, 0xBBFF7149), LIMB_PAIR(0x88474C74, 0xB5446094), LIMB_PAIR(0xBE02C6E2, 0x30609081),
+            LIMB_PAIR(0x5052D780, 0x746F7000), LIMB_PAIR(0xEE805F64, 0xCBF590A9), LIMB_PAIR(0xDD7BD5E7, 0x9A7B080C), LIMB_PAIR(0xDD80A8C7, 0x56B717BD), LIMB_PARTIAL(0x0EE),
+            LIMB_PAIR(0xAC340691, 0x64274157), LIMB_PAIR(0x804BE8D1, 0x9B309A8F), LIMB_PAIR(0x121AE0F1, 0xCE5420F1), LIMB_PAIR(0x5EC8A509, 0xADF456A8),
+            LIMB_PAIR(0xC02EA242, 0x5E76792A), LIMB_PAIR(0xE58AF730, 0x8388B323), LIMB_PAIR(0x3136780B, 0x72DB99B7), LIMB_PAIR(0x14E39CDD, 0x1A3E9205), LIMB_PARTIAL(0x125)
+        },
+        {   // 6 * 16^57 * G
+            LIMB_PAIR(0x571D6BFB, 0x2D803479), LIMB_PAIR(0x5D939FEF, 0x7BB434EA), LIMB_PAIR(0xA7F03A6F, 0xE8DBEBB2), LIMB_PAIR(0xFAA1C258, 0xF871AA25),
+            LIMB_PAIR(0x127B3064, 0x009C479C), LIMB_PAIR(0xD66A8BE4, 0x2EC9495B), LIMB_PAIR(0x1599C1B6, 0x7D41DDC1), LIMB_PAIR(0x618812FA, 0x1DB2468F), LIMB_PARTIAL(0x103),
+            LIMB_PAIR(0x7EFC6A9A, 0xD31446B4), LIMB_PAIR(0xA8F41DDD, 0xC35B7886), LIMB_PAIR(0x106280BD, 0xD8087EDE), LIMB_PAIR(0x4ECCD522, 0x9089563B),
+            LIMB_PAIR(0xF6E94E3C, 0x8C0E5198), LIMB_PAIR(0x4A8969FB, 0x955B0E32), LIMB_PAIR(0x3A83BD9A, 0xBA578607), LIMB_PAIR(0x8BC92EC0, 0x22B3437D), LIMB_PARTIAL(0x15F)
+        },
+        {   // 7 * 16^57 * G
+            LIMB_PAIR(0xED446A1B, 0xDD0E59A1), LIMB_PAIR(0x5307EF75, 0xA92EB882), LIMB_PAIR(0xE13EF1A0, 0xA85D2C29), LIMB_PAIR(0xFD55AF75, 0xE558C1AC),
+            LIMB_PAIR(0x3E133B0B, 0x60C45ACE), LIMB_PAIR(0x0F7DA3D0, 0x4F08A43E), LIMB_PAIR(0x028495DD, 0x0298BE5D), LIMB_PAIR(0x58FEEB24, 0x894E253B), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0xA37DDD3C, 0xFA9524D3), LIMB_PAIR(0x9DE4FBD7, 0x8158B85C), LIMB_PAIR(0x0D22ADF8, 0x0D5E4EE6), LIMB_PAIR(0x71FF6639, 0x9547F861),
+            LIMB_PAIR(0xA01712BE, 0x457FB0DE), LIMB_PAIR(0x997116D1, 0xECDF193B), LIMB_PAIR(0x76F06573, 0xF74312BC), LIMB_PAIR(0xE990A692, 0x74FEED35), LIMB_PARTIAL(0x186)
+        },
+        {   // 8 * 16^57 * G
+            LIMB_PAIR(0x41B1CB9E, 0xA9338E3D), LIMB_PAIR(0xC409BE61, 0xE9173C96), LIMB_PAIR(0xBA7EA91E, 0x2B8EA989), LIMB_PAIR(0x870EDD75, 0x5AD99388),
+            LIMB_PAIR(0xC2112DAF, 0x9D3C5A11), LIMB_PAIR(0x851694A8, 0x5A7C3D52), LIMB_PAIR(0xFCE31234, 0x8ECC1D6D), LIMB_PAIR(0x790D720B, 0x2ACA74EF), LIMB_PARTIAL(0x02C),
+            LIMB_PAIR(0x20DF1F66, 0x66DC50EE), LIMB_PAIR(0x3B05EA85, 0xE8785C5B), LIMB_PAIR(0x569D94C6, 0x0E28D55E), LIMB_PAIR(0x1A119F91, 0xACD3C165),
+            LIMB_PAIR(0x7226E29D, 0x51910B8E), LIMB_PAIR(0xDC3EADB4, 0x849B5229), LIMB_PAIR(0xA88F3B08, 0xC8C44E85), LIMB_PAIR(0x5E42BC66, 0x99050494), LIMB_PARTIAL(0x19B)
+        }
+    },
+#endif
+#if (58 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^58 * G
+            LIMB_PAIR(0x578B7A3F, 0x27068F87), LIMB_PAIR(0x423A5346, 0x506446F1), LIMB_PAIR(0x58DAC5E4, 0xE9D9C75B), LIMB_PAIR(0x61B8F695, 0x8EBC86E5),
+            LIMB_PAIR(0x611C51E3, 0x272AC14E), LIMB_PAIR(0x4E24FB32, 0x67863A1D), LIMB_PAIR(0x02E5B539, 0x270D4FDC), LIMB_PAIR(0xA4186D8D, 0x96D7B7A9), LIMB_PARTIAL(0x0F4),
+            LIMB_PAIR(0x26627252, 0x1A60EF05), LIMB_PAIR(0x9BDC0F5F, 0x31682A83), LIMB_PAIR(0xA112BE82, 0x52A055AD), LIMB_PAIR(0x4ECF7367, 0x9C3A8848),
+            LIMB_PAIR(0x49E70680, 0x52350872), LIMB_PAIR(0xB881B9CF, 0x61B6B478), LIMB_PAIR(0x887D3C1E, 0xBEC16C5A), LIMB_PAIR(0xD598A671, 0x8A8B2B82), LIMB_PARTIAL(0x0EF)
+        },
+        {   // 2 * 16^58 * G
+            LIMB_PAIR(0x4CB7B72B, 0x3DAC1EB4), LIMB_PAIR(0xE0C7DEEE, 0xB027BCE2), LIMB_PAIR(0xE994001B, 0x69032DB2), LIMB_PAIR(0x4D22B49A, 0xDE2C253A),
+            LIMB_PAIR(0xBF66A47B, 0x957977F9), LIMB_PAIR(0x21AD303D, 0xC118EAE5), LIMB_PAIR(0x18BA4889, 0x40C78CB8), LIMB_PAIR(0xE69238CB, 0x09901C2C), LIMB_PARTIAL(0x162),
+            LIMB_PAIR(0x08BC1CEA, 0x8099814B), LIMB_PAIR(0x38139921, 0x3E74578A), LIMB_PAIR(0xD9D15FE2, 0x899412A6), LIMB_PAIR(0x29446072, 0x973A21AC),
+            LIMB_PAIR(0xEE7401CB, 0xE6C4CE99), LIMB_PAIR(0x6A4C5223, 0x03A86C73), LIMB_PAIR(0x6F3E93CD, 0x6976124E), LIMB_PAIR(0x34DD40EC, 0x074326DF), LIMB_PARTIAL(0x065)
+        },
+        {   // 3 * 16^58 * G
+            LIMB_PAIR(0xCEDC41C5, 0x943DBC45), LIMB_PAIR(0x075FBCDD, 0xA3889CFC), LIMB_PAIR(0xBEE1AC11, 0xAB0A889D), LIMB_PAIR(0xD8721711, 0x9A5319B1),
+            LIMB_PAIR(0x87ECEA8E, 0xC4228D89), LIMB_PAIR(0xE8221D39, 0x55CFCE64), LIMB_PAIR(0x39E3E962, 0xD3E9699D), LIMB_PAIR(0x0549F4CF, 0x8ED1DD02), LIMB_PARTIAL(0x0BA),
+            LIMB_PAIR(0xFB5FEC20, 0x1729967D), LIMB_PAIR(0x7A6208F5, 0x16246AB3), LIMB_PAIR(0x5F5AF897, 0x10904E4B), LIMB_PAIR(0x273B4049, 0x68C575BB),
+            LIMB_PAIR(0x97335687, 0x973F128B), LIMB_PAIR(0xD6CB8CD4, 0xB696381E), LIMB_PAIR(0xD2FBA17B, 0x3EF2EC73), LIMB_PAIR(0x5233AEB4, 0xE4C62FDE), LIMB_PARTIAL(0x0BB)
+        },
+        {   // 4 * 16^58 * G
+            LIMB_PAIR(0xDD308AE0, 0xB685F627), LIMB_PAIR(0x5A08F7CA, 0x78D327CB), LIMB_PAIR(0xEE74108B, 0x83E55DD1), LIMB_PAIR(0x8D01FFDC, 0x90640835),
+            LIMB_PAIR(0x1625F9A7, 0x6D7694E8), LIMB_PAIR(0xD782C8BC, 0x48B92A43), LIMB_PAIR(0xBF98EE6B, 0x61F7B571), LIMB_PAIR(0xE511DF25, 0x02B2A743), LIMB_PARTIAL(0x03B),
+            LIMB_PAIR(0x3AEA9B6B, 0x020B0905), LIMB_PAIR(0x989114D9, 0xC648D06D), LIMB_PAIR(0xEC1E3D92, 0xD7861A73), LIMB_PAIR(0x0A0581E5, 0x2C0EB072),
+            LIMB_PAIR(0x3FDD93BD, 0x5BE8C4DA), LIMB_PAIR(0x897946C7, 0xD45049F2), LIMB_PAIR(0x6EBB7FBD, 0x0FA12B38), LIMB_PAIR(0x3ACA1751, 0x7B539178), LIMB_PARTIAL(0x001)
+        },
+        {   // 5 * 16^58 * G
+            LIMB_PAIR(0x1631F481, 0xF61F5690), LIMB_PAIR(0x60057252, 0x31CD4A44), LIMB_PAIR(0x7F3683ED, 0x11C6764A), LIMB_PAIR(0x855ABD6D, 0x813E617D),
+            LIMB_PAIR(0x74BFFC99, 0x07DD6C66), LIMB_PAIR(0x3D28A486, 0x4EFF7790), LIMB_PAIR(0x1236CC16, 0xDA809B5A), LIMB_PAIR(0xE1B1FA07, 0xF3A0A984), LIMB_PARTIAL(0x015),
+            LIMB_PAIR(0xFDBAA820, 0xC1557C02), LIMB_PAIR(0x490ACE41, 0x22F1B155), LIMB_PAIR(0xBB30FE96, 0xAADDE80B), LIMB_PAIR(0x8005FCBC, 0x3ECB3B1E),
+            LIMB_PAIR(0x68A1DB30, 0xBFEF06D9), LIMB_PAIR(0xA6B85ED3, 0xA8E0A6A1), LIMB_PAIR(0x2B82AE83, 0xA602E5B5), LIMB_PAIR(0xFA699305, 0x567EABD6), LIMB_PARTIAL(0x177)
+        },
+        {   // 6 * 16^58 * G
+            LIMB_PAIR(0xEAE13CFB, 0x9D86D84F), LIMB_PAIR(0x994991DF, 0x6D235A5F), LIMB_PAIR(0x352CBF4A, 0x0B5B3E99), LIMB_PAIR(0xA087EE0E, 0x9512101A),
+            LIMB_PAIR(0x900FD50D, 0x2AB9FEC1), LIMB_PAIR(0xC8FD91F5, 0x48129FE5), LIMB_PAIR(0x08C5117B, 0x69ED1F4D), LIMB_PAIR(0xE7007BAF, 0x533E83C6), LIMB_PARTIAL(0x1E1),
+            LIMB_PAIR(0x2F0FAC2D, 0x10A0C08D), LIMB_PAIR(0xF3E1DAA4, 0x35A77D2A), LIMB_PAIR(0x5F5E78A5, 0x447A8E90), LIMB_PAIR(0xD3ACDE30, 0x0F5835B0),
+            LIMB_PAIR(0x61B9AAD8, 0x5486F6B9), LIMB_PAIR(0xECBFD6B2, 0x9BE0A9B8), LIMB_PAIR(0x09452928, 0x95A5BD04), LIMB_PAIR(0xEA830996, 0x4FC3182D), LIMB_PARTIAL(0x125)
+        },
+        {   // 7 * 16^58 * G
+            LIMB_PAIR(0x8BFF6D2C, 0x9E71F0BB), LIMB_PAIR(0x67B26058, 0xF35C6C13), LIMB_PAIR(0x9FB2CD17, 0xB8791D9E), LIMB_PAIR(0x655344B7, 0x834F77FB),
+            LIMB_PAIR(0x88C6106B, 0xF6727494), LIMB_PAIR(0x83BF0B92, 0x1D51D49A), LIMB_PAIR(0xB2598CC2, 0x2888CA81), LIMB_PAIR(0x8377DCF4, 0x454C0025), LIMB_PARTIAL(0x00F),
+            LIMB_PAIR(0xE9046DC1, 0x622AB6EB), LIMB_PAIR(0x40D5F30E, 0x3594E53E), LIMB_PAIR(0x632372BE, 0xAF4FD362), LIMB_PAIR(0xAA276034, 0x08601954),
+            LIMB_PAIR(0xA10A69EF, 0xA2369D15), LIMB_PAIR(0x25BF301B, 0x9C9FFCF5), LIMB_PAIR(0xDBAF10E3, 0x7CD516D5), LIMB_PAIR(0xF35E5F7C, 0xC24AACC1), LIMB_PARTIAL(0x1F9)
+        },
+        {   // 8 * 16^58 * G
+            LIMB_PAIR(0x82A8845F, 0xB5B80C0E), LIMB_PAIR(0x42FA43CB, 0x6FDD0A0F), LIMB_PAIR(0x803CF184, 0xEBFA4307), LIMB_PAIR(0x4935A211, 0x1DD85B5B),
+            LIMB_PAIR(0x6BEECB33, 0x2438607C), LIMB_PAIR(0x40EA88B4, 0xFBBB723E), LIMB_PAIR(0xE84DB1EB, 0xAF5258A6), LIMB_PAIR(0xB7AD5E3B, 0x2C2B8CD9), LIMB_PARTIAL(0x13E),
+            LIMB_PAIR(0x0A092935, 0x313CE445), LIMB_PAIR(0x8D0EFDA6, 0x9FC84CEC), LIMB_PAIR(0x197593C0, 0x004929DC), LIMB_PAIR(0xFBEF27F1, 0xEBD50BB3),
+            LIMB_PAIR(0x38C08B52, 0x9E71F619), LIMB_PAIR(0x71196231, 0x590EF005), LIMB_PAIR(0xAFC73D42, 0xAE3C0D2E), LIMB_PAIR(0x4DA4A91C, 0x768BD962), LIMB_PARTIAL(0x10C)
+        }
+    },
+#endif
+#if (59 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^59 * G
+            LIMB_PAIR(0xFCFEFDB2, 0xE1F0C1AE), LIMB_PAIR(0x44930C59, 0xB5BC33D3), LIMB_PAIR(0x64D2C6E0, 0x253D5F49), LIMB_PAIR(0xE316BA1F, 0x25EFDDED),
+            LIMB_PAIR(0xE30C3A34, 0xEB3AB21F), LIMB_PAIR(0xCFA52A9D, 0x797A1AD6), LIMB_PAIR(0xA81BA831, 0x6A3CA2E0), LIMB_PAIR(0xE112DD07, 0x27BB664C), LIMB_PARTIAL(0x07E),
+            LIMB_PAIR(0x1961AA16, 0x91FA1E12), LIMB_PAIR(0x67DD7513, 0x381B2D71), LIMB_PAIR(0x44DB8A51, 0xBAE86351), LIMB_PAIR(0xBC31C1CD, 0x4CC1915F),
+            LIMB_PAIR(0x8EC6E9E1, 0xF79F4059), LIMB_PAIR(0xA8929A72, 0xB142B6EC), LIMB_PAIR(0x8ED71FB2, 0x4629C648), LIMB_PAIR(0xBD52FAA7, 0x9F79BCCF), LIMB_PARTIAL(0x029)
+        },
+        {   // 2 * 16^59 * G
+            LIMB_PAIR(0xE35AB524, 0x5A6DB3A8), LIMB_PAIR(0x5117B9CD, 0x2E695431), LIMB_PAIR(0x17217CB3, 0xD81F6F64), LIMB_PAIR(0x910F3354, 0xB4296467),
+            LIMB_PAIR(0x5A83E39D, 0x7249DCFB), LIMB_PAIR(0x8C87A277, 0x7B6DF96F), LIMB_PAIR(0xCFB09D4C, 0xBC8CCD9F), LIMB_PAIR(0x5F67508D, 0xB644E4E3), LIMB_PARTIAL(0x174),
+            LIMB_PAIR(0x246BE9D7, 0x1A228C95), LIMB_PAIR(0x669D44F0, 0xD9B7805B), LIMB_PAIR(0xF5A7D167, 0x7C240E63), LIMB_PAIR(0x6BD7F19B, 0x863012F5),
+            LIMB_PAIR(0x3A9321BE, 0x1CF3D77E), LIMB_PAIR(0x782B061F, 0x407DCFD2), LIMB_PAIR(0x881439F7, 0xDBCCC9DF), LIMB_PAIR(0x116D1BEE, 0x4A3A07A3), LIMB_PARTIAL(0x198)
+        },
+        {   // 3 * 16^59 * G
+            LIMB_PAIR(0x24F3E2FE, 0x381C9254), LIMB_PAIR(0xDEE535E2, 0x71E5478E), LIMB_PAIR(0x6E673D25, 0x191946A8), LIMB_PAIR(0xF2D629C0, 0x79802C83),
+            LIMB_PAIR(0x3BBCAE3B, 0x46EABC89), LIMB_PAIR(0x1BE23CBF, 0xB8C8D414), LIMB_PAIR(0x62EE0E85, 0x21A38CBA), LIMB_PAIR(0x3AEDEA6C, 0xFBAD1629), LIMB_PARTIAL(0x099),
+            LIMB_PAIR(0x3FD062ED, 0xEEA93393), LIMB_PAIR(0xDDE340C3, 0x8434C033), LIMB_PAIR(0xCFBD71A9, 0x5FBAFD98), LIMB_PAIR(0x6F9C6632, 0x4A1DE5D8),
+            LIMB_PAIR(0xDB268826, 0x975FF1ED), LIMB_PAIR(0x3D2EEF58, 0xCFAB8B1A), LIMB_PAIR(0x0680FE1A, 0x6A50E2E3), LIMB_PAIR(0x0E0F3FA3, 0xE02154F1), LIMB_PARTIAL(0x196)
+        },
+        {   // 4 * 16^59 * G
+            LIMB_PAIR(0xE870201B, 0x9AB5FE51), LIMB_PAIR(0x428DCC9D, 0x181BE214), LIMB_PAIR(0x335AB6FC, 0xEA30361A), LIMB_PAIR(0x3AF87ECE, 0x8F43702A),
+            LIMB_PAIR(0x47DF3E87, 0xA46B8671), LIMB_PAIR(0xBB02E25B, 0x4B2FDC3F), LIMB_PAIR(0x68E4D43E, 0x72E3BC8E), LIMB_PAIR(0x2CF96610, 0x854AE724), LIMB_PARTIAL(0x075),
+            LIMB_PAIR(0xFEB21BF5, 0x56ECF90B), LIMB_PAIR(0xE555D52A, 0x75D38316), LIMB_PAIR(0x84CBCF08, 0xFAEA8400), LIMB_PAIR(0xB5126460, 0xBD4A0672),
+            LIMB_PAIR(0xEE751F85, 0x33C3DD8F), LIMB_PAIR(0xD8FD6A67, 0x4D658970), LIMB_PAIR(0x439F0C52, 0x49E1041A), LIMB_PAIR(0xBD63268F, 0x0480366F), LIMB_PARTIAL(0x101)
+        },
+        {   // 5 * 16^59 * G
+            LIMB_PAIR(0x8F0FC596, 0x0D359834), LIMB_PAIR(0xB20E73D4, 0x3A7EF54A), LIMB_PAIR(0x37CE7F53, 0xD99446C0), LIMB_PAIR(0x07CDCF9E, 0xC198A755),
+            LIMB_PAIR(0x41622E72, 0xC170D6B2), LIMB_PAIR(0x593B7C41, 0x7DF33F4F), LIMB_PAIR(0xD176DED6, 0x58D8ADE8), LIMB_PAIR(0xA5EC80C1, 0xECE1335C), LIMB_PARTIAL(0x13D),
+            LIMB_PAIR(0xBB0543B8, 0x1F125D6F), LIMB_PAIR(0x5F084A01, 0xB97E6E28), LIMB_PAIR(0x496482E0, 0x0907A203), LIMB_PAIR(0xB2A38099, 0x0EB9FA4E),
+            LIMB_PAIR(0xB5C8B504, 0xB3E5054F), LIMB_PAIR(0x931D0353, 0x7E5204C7), LIMB_PAIR(0x86636261, 0xEAB5BBDF), LIMB_PAIR(0xBAD92B8B, 0xB0627E5F), LIMB_PARTIAL(0x189)
+        },
+        {   // 6 * 16^59 * G
+            LIMB_PAIR(0x68C39A09, 0x7A11C13F), LIMB_PAIR(0x944A3655, 0xDD0708F7), LIMB_PAIR(0xB315B1F4, 0x2A7E09EB), LIMB_PAIR(0x7B9810FD, 0x3ED8AF94),
+            LIMB_PAIR(0x38B325FB, 0x91E2F2CF), LIMB_PAIR(0x9F279BF5, 0x52C45993), LIMB_PAIR(0x1A34641C, 0x78CA140A), LIMB_PAIR(0x090B00E0, 0x6870DB8F), LIMB_PARTIAL(0x0B2),
+            LIMB_PAIR(0x42C16B82, 0xE52430C1), LIMB_PAIR(0x347E84DA, 0x3223A77D), LIMB_PAIR(0x9F0E8E62, 0xF3D6350C), LIMB_PAIR(0xFEBD6F14, 0x7103BDC5),
+            LIMB_PAIR(0x0620F6CD, 0x09F90FDF), LIMB_PAIR(0x7332F50F, 0x29CBDDA2), LIMB_PAIR(0x01D09FB1, 0x5E832F35), LIMB_PAIR(0xF7075434, 0x39634E5F), LIMB_PARTIAL(0x062)
+        },
+        {   // 7 * 16^59 * G
+            LIMB_PAIR(0xE25F8B1C, 0xC0F92A02), LIMB_PAIR(0xC619DA00, 0x60474421), LIMB_PAIR(0x68CBCCEF, 0x14638CA7), LIMB_PAIR(0x15E8CEC4, 0xD4C5CB62),
+            LIMB_PAIR(0xA1194B51, 0xBBB32091), LIMB_PAIR(0x5F0EF063, 0xD1133ACB), LIMB_PAIR(0x53EB56B7, 0xA7141056), LIMB_PAIR(0x4F250643, 0xC1D582F5), LIMB_PARTIAL(0x0C5),
+            LIMB_PAIR(0x9789ABAA, 0x6F5F7174), LIMB_PAIR(0xDE5C9651, 0x29045949), LIMB_PAIR(0x3683EF86, 0x5B34A35D), LIMB_PAIR(0x664F4510, 0xD84501E5),
+            LIMB_PAIR(0xD2CB563C, 0x3A32D2F9), LIMB_PAIR(0x11B5C949, 0x68DB2EAE), LIMB_PAIR(0xE22EBDD4, 0x5A5F799F), LIMB_PAIR(0x8E01D2AE, 0xD08DE31B), LIMB_PARTIAL(0x1AE)
+        },
+        {   // 8 * 16^59 * G
+            LIMB_PAIR(0xE1756B7A, 0xCC24E895), LIMB_PAIR(0x3C09615B, 0x3874A79A), LIMB_PAIR(0x9014FFC4, 0x30E2489D), LIMB_PAIR(0xE9070C97, 0xEDFA2851),
+            LIMB_PAIR(0x63017E47, 0x69113AC7), LIMB_PAIR(0xEE9161C5, 0x2DBD4D59), LIMB_PAIR(0x40C20E53, 0xBD93ABE7), LIMB_PAIR(0x91CCC0F9, 0x2EB660E4), LIMB_PARTIAL(0x1F5),
+            LIMB_PAIR(0x719C9F85, 0x1363F45A), LIMB_PAIR(0xA43CD38E, 0x32DFB30E), LIMB_PAIR(0x0B75D1EB, 0x35933E9A), LIMB_PAIR(0x75AEBC26, 0xAF1FC787),
+            LIMB_PAIR(0xA27240C4, 0xB444F393), LIMB_PAIR(0xF7592075, 0xDB46C96D), LIMB_PAIR(0x52510AD2, 0x59C26AD8), LIMB_PAIR(0x029BB7A0, 0x163890BF), LIMB_PARTIAL(0x0A6)
+        }
+    },
+#endif
+#if (60 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^60 * G
+            LIMB_PAIR(0x21DD6E7A, 0x0F8341FE), LIMB_PAIR(0xEA93E5C1, 0x5C106F8E), LIMB_PAIR(0xAD0114BC, 0x8E2AD8E9), LIMB_PAIR(0xF059D291, 0x277EF823),
+            LIMB_PAIR(0xDC50FD78, 0xED4A28E5), LIMB_PAIR(0x89CDF20D, 0xA0719651), LIMB_PAIR(0x1FDE162C, 0xE393B264), LIMB_PAIR(0x30A5B16D, 0xD383B86D), LIMB_PARTIAL(0x041),
+            LIMB_PAIR(0xAD6DBEAF, 0x04B8115B), LIMB_PAIR(0xA996519B, 0x7D7F0BB9), LIMB_PAIR(0x9C397C91, 0xAB54D4C8), LIMB_PAIR(0x77A6A3E3, 0x1750B97D),
+            LIMB_PAIR(0x14554321, 0x1637909B), LIMB_PAIR(0x7A5AEEA3, 0x7311DA68), LIMB_PAIR(0x52130453, 0x1F91A0FD), LIMB_PAIR(0x86753F28, 0x4338B3D6), LIMB_PARTIAL(0x14C)
+        },
+        {   // 2 * 16^60 * G
+            LIMB_PAIR(0x4CF92B1F, 0x99A1DAA9), LIMB_PAIR(0xCF013530, 0xB08A7BDE), LIMB_PAIR(0x1576E51B, 0xCBE6C7BC), LIMB_PAIR(0xE6C13E9F, 0x9F88C296),
+            LIMB_PAIR(0x6370791C, 0x13FDC955), LIMB_PAIR(0xA42B1973, 0xADEFAC0D), LIMB_PAIR(0x12CB2FFC, 0xE69418A4), LIMB_PAIR(0x62EAE4E0, 0xAF05CE97), LIMB_PARTIAL(0x05B),
+            LIMB_PAIR(0x65E89A12, 0xADB36E65), LIMB_PAIR(0x53131BD7, 0xDE7FEE58), LIMB_PAIR(0xABFFA9C1, 0x7335C5CB), LIMB_PAIR(0x92947061, 0xABF94BC3),
+            LIMB_PAIR(0x6109BC5B, 0x11D2E02B), LIMB_PAIR(0x8A097CDA, 0xFC1FC1D2), LIMB_PAIR(0xF3D5DB21, 0x4512FBB6), LIMB_PAIR(0x336A3D5F, 0xD40E8637), LIMB_PARTIAL(0x13B)
+        },
+        {   // 3 * 16^60 * G
+            LIMB_PAIR(0xE411C88B, 0x3671D520), LIMB_PAIR(0xAF747CAA, 0xE56D2622), LIMB_PAIR(0x3F298A36, 0x8C2D939F), LIMB_PAIR(0x38B36307, 0xD09F955E),
+            LIMB_PAIR(0xACFE3A5F, 0x7AEF92FD), LIMB_PAIR(0x3C3413E3, 0xAA1B543A), LIMB_PAIR(0x85E8EEA2, 0xA68BCF75), LIMB_PAIR(0x57271AB1, 0x1C33B909), LIMB_PARTIAL(0x175),
+            LIMB_PAIR(0x0993374B, 0xE829B548), LIMB_PAIR(0x3758FA53, 0x93ACE6B4), LIMB_PAIR(0xFB48D303, 0x378932AD), LIMB_PAIR(0x7B9ACA58, 0xA0BE54CD),
+            LIMB_PAIR(0x07D56BFC, 0x6F020D2F), LIMB_PAIR(0x332D5724, 0x661CC6DF), LIMB_PAIR(0x4702E14E, 0xE1C67B4C), LIMB_PAIR(0xFE0CE1F4, 0x6D7E1534), LIMB_PARTIAL(0x165)
+        },
+        {   // 4 * 16^60 * G
+            LIMB_PAIR(0xB7C097FD, 0x70EAE5E2), LIMB_PAIR(0xBECC7C65, 0x690C65C6), LIMB_PAIR(0xBEB8A529, 0xF684CE2C), LIMB_PAIR(0x772826C5, 0xFB5BD6FA),
+            LIMB_PAIR(0x3B0D8680, 0x12025C31), LIMB_PAIR(0xCBEF00AD, 0x8F20FAC7), LIMB_PAIR(0x6FC66AC3, 0xB810BF45), LIMB_PAIR(0xC7878181, 0xA960E1B3), LIMB_PARTIAL(0x1A1),
+            LIMB_PAIR(0xF6103B53, 0x85A5E619), LIMB_PAIR(0xFC14A4B5, 0xCC4CF223), LIMB_PAIR(0x977A8C64, 0x68985B1F), LIMB_PAIR(0xFE82447C, 0x410EAF63),
+            LIMB_PAIR(0x0453D341, 0xE2038149), LIMB_PAIR(0x719258DE, 0xE1D008AD), LIMB_PAIR(0x3410D895, 0x26C1B177), LIMB_PAIR(0x45BAE984, 0x93CAD3DA), LIMB_PARTIAL(0x12F)
+        },
+        {   // 5 * 16^60 * G
+            LIMB_PAIR(0x9DE748B4, 0xB83FDB66), LIMB_PAIR(0x0C41F158, 0xC46F8100), LIMB_PAIR(0xB8F8F374, 0xADE8932F), LIMB_PAIR(0xC7AB11FE, 0x5728E8AA),
+            LIMB_PAIR(0x601535D1, 0xA3BE4365), LIMB_PAIR(0x50C52B71, 0xF366F0D4), LIMB_PAIR(0x84DB7699, 0x6E008600), LIMB_PAIR(0x32BD9061, 0x39C5934C), LIMB_PARTIAL(0x003),
+            LIMB_PAIR(0x9C964A3F, 0x4C5F3AB4), LIMB_PAIR(0x69A70BA7, 0x30EE02C3), LIMB_PAIR(0x1699B55B, 0xE4F4E772), LIMB_PAIR(0xF2104682, 0x957EFD09),
+            LIMB_PAIR(0x298947D8, 0x7BE1BDB0), LIMB_PAIR(0xA6CE37DA, 0x128BE588), LIMB_PAIR(0x5110D219, 0x10F0ABBB), LIMB_PAIR(0x6C433528, 0xFE63DE4B), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 6 * 16^60 * G
+            LIMB_PAIR(0xBCBCF019, 0xEE8B94E0), LIMB_PAIR(0x952A5A75, 0xA3965127), LIMB_PAIR(0xBD99B8E6, 0x5D306FFD), LIMB_PAIR(0xF7F77F82, 0x9726ACFC),
+            LIMB_PAIR(0x333E69A2, 0x52A8C48F), LIMB_PAIR(0xE5310F8C, 0x2561B47E), LIMB_PAIR(0xDDBA50AD, 0x5C707992), LIMB_PAIR(0xD49F9302, 0xCA39FEC1), LIMB_PARTIAL(0x197),
+            LIMB_PAIR(0x3330C1DE, 0x773374E0), LIMB_PAIR(0x12186692, 0x3C186E5A), LIMB_PAIR(0x2A07FE4F, 0x7C50D77C), LIMB_PAIR(0xEC8CB87F, 0xB0387D01),
+            LIMB_PAIR(0x24AF7E0D, 0x891A7415), LIMB_PAIR(0x5DCE5454, 0xACD3FC80), LIMB_PAIR(0x257238D4, 0x2A92F9CB), LIMB_PAIR(0x4415B2A6, 0x25075CBC), LIMB_PARTIAL(0x06F)
+        },
+        {   // 7 * 16^60 * G
+            LIMB_PAIR(0x30AE5727, 0x64F0AE66), LIMB_PAIR(0xCCFE2F46, 0xEB7FEE1C), LIMB_PAIR(0xC17226F5, 0xCB52D65C), LIMB_PAIR(0x4BDE2FF6, 0x11BFDD3C),
+            LIMB_PAIR(0x22F56523, 0x14593DBA), LIMB_PAIR(0xE5A07B06, 0x7549C2A8), LIMB_PAIR(0xA259420C, 0x27E857B0), LIMB_PAIR(0xD795BF2B, 0x5F2702CF), LIMB_PARTIAL(0x0CE),
+            LIMB_PAIR(0x99EF6F42, 0x50247B77), LIMB_PAIR(0xA9496281, 0xC5D4D501), LIMB_PAIR(0x848EE90A, 0xC2898FD0), LIMB_PAIR(0x3B105EA7, 0x5916DF47),
+            LIMB_PAIR(0xA3FC2A93, 0xC963D568), LIMB_PAIR(0xA71E69FF, 0x4F5DBD88), LIMB_PAIR(0xED98520A, 0xB1DFB820), LIMB_PAIR(0x5BBB0779, 0xF91D6E9E), LIMB_PARTIAL(0x10E)
+        },
+        {   // 8 * 16^60 * G
+            LIMB_PAIR(0xDB3002CE, 0x6BCE4008), LIMB_PAIR(0x03FE67EF, 0xE109980C), LIMB_PAIR(0x1CD61540, 0x35F07720), LIMB_PAIR(0x723C0EF2, 0xB0ADFBA4),
+            LIMB_PAIR(0x60CA9A5B, 0x811B1008), LIMB_PAIR(0xC0D112C6, 0xEDD17F04), LIMB_PAIR(0x49688782, 0x8CC7CC5F), LIMB_PAIR(0xD5F89C31, 0x716F36BB), LIMB_PARTIAL(0x031),
+            LIMB_PAIR(0x1D19D891, 0x700CB92A), LIMB_PAIR(0x2DAA7A23, 0xB9991826), LIMB_PAIR(0xD9AD0C74, 0x834CD1FD), LIMB_PAIR(0x82C919DA, 0xD74EE376),
+            LIMB_PAIR(0x97696DEE, 0x65693534), LIMB_PAIR(0x12E9AB53, 0xE2615C6E), LIMB_PAIR(0x090BBDF3, 0x4BE93A40), LIMB_PAIR(0x63437098, 0xB8110696), LIMB_PARTIAL(0x162)
+        }
+    },
+#endif
+#if (61 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^61 * G
+            LIMB_PAIR(0x2D3D7641, 0xDD916628), LIMB_PAIR(0x39C02CEE, 0x99029E9B), LIMB_PAIR(0xB6DE7881, 0xCE03FAC9), LIMB_PAIR(0x4F66EBBC, 0xC2CD0F78),
+            LIMB_PAIR(0x64C83E37, 0xE3919483), LIMB_PAIR(0xFD7BB155, 0xFC853CB8), LIMB_PAIR(0x432314CC, 0xA5A99B24), LIMB_PAIR(0x133B2709, 0xEF0B7ED0), LIMB_PARTIAL(0x1D0),
+            LIMB_PAIR(0x54DE3ECB, 0xE4C4D8A0), LIMB_PAIR(0x5F8CB5CE, 0xE2F88AC2), LIMB_PAIR(0x68EB11A2, 0x17A4E60D), LIMB_PAIR(0x3B79619A, 0x6D0E05FB),
+            LIMB_PAIR(0xD5DA75EF, 0xA54874B7), LIMB_PAIR(0xC77F6AC1, 0x18C2B1B3), LIMB_PAIR(0x829736C3, 0x5A2A6FDD), LIMB_PAIR(0xCD44843B, 0x9CE62F22), LIMB_PARTIAL(0x059)
+        },
+        {   // 2 * 16^61 * G
+            LIMB_PAIR(0xAFD7C4F7, 0xC3E525D2), LIMB_PAIR(0xAE2B9475, 0xC11FD457), LIMB_PAIR(0x5D48EAD5, 0x6CF55E76), LIMB_PAIR(0x8F93EB95, 0xF9546FE4),
+            LIMB_PAIR(0x5E124BA8, 0x3E3712A7), LIMB_PAIR(0xCF7A3E81, 0xCB71CAAF), LIMB_PAIR(0x2F3D629D, 0x51206017), LIMB_PAIR(0xBAB1761C, 0xE226FE2D), LIMB_PARTIAL(0x079),
+            LIMB_PAIR(0xF963A03A, 0xBB618C7B), LIMB_PAIR(0xD55E0AB2, 0x2FD9211C), LIMB_PAIR(0x20DFE924, 0x25BE6C8A), LIMB_PAIR(0x135B7156, 0x40F5FF09),
+            LIMB_PAIR(0xF706B788, 0x7770BA4A), LIMB_PAIR(0xDC114357, 0x5A2146E0), LIMB_PAIR(0x54B6FAE3, 0x48F25EDA), LIMB_PAIR(0x19EAD5C4, 0x5ADC7AA5), LIMB_PARTIAL(0x1E3)
+        },
+        {   // 3 * 16^61 * G
+            LIMB_PAIR(0xD006477E, 0xE521DCE8), LIMB_PAIR(0xEA3F2B6D, 0xD566FC0B), LIMB_PAIR(0x18CCAD87, 0x472EA469), LIMB_PAIR(0x1FE4719C, 0xF15FE9D9),
+            LIMB_PAIR(0x8B7015F9, 0xD275B8CE), LIMB_PAIR(0x86894ED7, 0x3F04FCAD), LIMB_PAIR(0xC023A915, 0xC02D8386), LIMB_PAIR(0x5ABDA947, 0x6B29D94D), LIMB_PARTIAL(0x0A3),
+            LIMB_PAIR(0x96135659, 0x707122C4), LIMB_PAIR(0xEDA8C2D4, 0xAE00DC93), LIMB_PAIR(0x164EBA39, 0x0EA664C3), LIMB_PAIR(0xF36B5B72, 0x0DCB1880),
+            LIMB_PAIR(0x337E6DEB, 0x1EC8BC56), LIMB_PAIR(0x20DB8B04, 0x34237EED), LIMB_PAIR(0xED7BAF4A, 0x026FA069), LIMB_PAIR(0xEC16CFBB, 0x88B1EA03), LIMB_PARTIAL(0x05B)
+        },
+        {   // 4 * 16^61 * G
+            LIMB_PAIR(0x67355505, 0x21E292CB), LIMB_PAIR(0xE192A20D, 0x7CDF9C24), LIMB_PAIR(0xF6753EEC, 0x07228775), LIMB_PAIR(0x93217C7F, 0xCD83121B),
+            LIMB_PAIR(0xAD41CE70, 0xF6E99141), LIMB_PAIR(0x41A8EC10, 0x2214296A), LIMB_PAIR(0x0200DDB1, 0xCDF7237B), LIMB_PAIR(0xC7CA562D, 0xE2D943F5), LIMB_PARTIAL(0x056),
+            LIMB_PAIR(0x9627A12E, 0x9F743D7C), LIMB_PAIR(0x31099D8A, 0x33FF2E7E), LIMB_PAIR(0x2A07248A, 0x3C9E84D1), LIMB_PAIR(0x6136B3F7, 0x9CBC405A),
+            LIMB_PAIR(0x970BE1E5, 0xB131C000), LIMB_PAIR(0x84162E6B, 0xEA9C160B), LIMB_PAIR(0x5BA3F7A9, 0x1C54FE69), LIMB_PAIR(0xD51B962F, 0xD5A98FDC), LIMB_PARTIAL(0x15D)
+        },
+        {   // 5 * 16^61 * G
+            LIMB_PAIR(0x44EAC0B1, 0x1C676BBC), LIMB_PAIR(0x6FEA6C20, 0x95E84810), LIMB_PAIR(0xE182DE39, 0xF0AFB403), LIMB_PAIR(0xF6DAADB9, 0x180FD76B),
+            LIMB_PAIR(0xAC485527, 0x9F2D412D), LIMB_PAIR(0xB8565861, 0xCD59060A), LIMB_PAIR(0x4F05CABE, 0x99385875), LIMB_PAIR(0xB829E025, 0xB21C7C70), LIMB_PARTIAL(0x0D3),
+            LIMB_PAIR(0x554AD734, 0xE9B60D5D), LIMB_PAIR(0xA30D86A2, 0xE70BAE12), LIMB_PAIR(0x442CFEA6, 0x34113E1D), LIMB_PAIR(0xCF199E84, 0x586FB932),
+            LIMB_PAIR(0x74D28CC4, 0xC66AD7E6), LIMB_PAIR(0xFD5F8CDA, 0x2CCD27D2), LIMB_PAIR(0xC78032F6, 0x1F47FDCB), LIMB_PAIR(0x8D5B2254, 0x8D4B66F1), LIMB_PARTIAL(0x141)
+        },
+        {   // 6 * 16^61 * G
+            LIMB_PAIR(0x891D513F, 0xD01BFB1F), LIMB_PAIR(0x1375D0D4, 0xACF22E96), LIMB_PAIR(0xD43C24F1, 0x6F5C76F9), LIMB_PAIR(0x07A66E1E, 0xA220F507),
+            LIMB_PAIR(0xF227B93E, 0xA0B91C2A), LIMB_PAIR(0x8FC8F377, 0xEFE04986), LIMB_PAIR(0xFBF6C7CF, 0x58482184), LIMB_PAIR(0xCAB58946, 0xB224B543), LIMB_PARTIAL(0x094),
+            LIMB_PAIR(0x14855341, 0xE07E7D79), LIMB_PAIR(0x0A675863, 0x68881FB6), LIMB_PAIR(0xB9736E0F, 0x4083D236), LIMB_PAIR(0x02DAC8A4, 0xEC6CE431),
+            LIMB_PAIR(0x88891340, 0xB0477CF1), LIMB_PAIR(0x12CD1F4F, 0x67C0CC05), LIMB_PAIR(0x6F7B5340, 0xF3101C29), LIMB_PAIR(0x1E980837, 0x60F49D6D), LIMB_PARTIAL(0x116)
+        },
+        {   // 7 * 16^61 * G
+            LIMB_PAIR(0xDB4265E1, 0x8BE4DED5), LIMB_PAIR(0x2700418E, 0x9F65ABF2), LIMB_PAIR(0x55108266, 0x457AD4E2), LIMB_PAIR(0xA6138CCE, 0x43D48A67),
+            LIMB_PAIR(0x8AFCCDAB, 0xC6C6C647), LIMB_PAIR(0x64DE4D77, 0x87F5811D), LIMB_PAIR(0xF48F36BB, 0xA02EFC05), LIMB_PAIR(0xBC51E05C, 0x21F8EB11), LIMB_PARTIAL(0x17D),
+            LIMB_PAIR(0x215B4477, 0xE1EFE9AC), LIMB_PAIR(0x209CAACD, 0x44D6AE20), LIMB_PAIR(0x49E9661D, 0x2CEBFA64), LIMB_PAIR(0x5E169DFB, 0x5F1EA194),
+            LIMB_PAIR(0xF5DF63A3, 0xE6705A2E), LIMB_PAIR(0x2A22E3DE, 0x6339EA70), LIMB_PAIR(0x668F1234, 0xB56EF344), LIMB_PAIR(0x896E23B9, 0xAD598D6A), LIMB_PARTIAL(0x124)
+        },
+        {   // 8 * 16^61 * G
+            LIMB_PAIR(0x8FFA8932, 0x3CD54B98), LIMB_PAIR(0x47855C60, 0x73A8C099), LIMB_PAIR(0x3ECC6B44, 0x5272D16B), LIMB_PAIR(0xB4E83CE5, 0x7CF96927),
+            LIMB_PAIR(0xA3908EDE, 0x08AF41C8), LIMB_PAIR(0x73495D2B, 0x98DE920A), LIMB_PAIR(0xBE247419, 0x6DDC94E1), LIMB_PAIR(0x5E3E7C96, 0x0936E34F), LIMB_PARTIAL(0x0AC),
+            LIMB_PAIR(0x9D269D4B, 0xF3B1A1AA), LIMB_PAIR(0x1103E749, 0xB20AFF07), LIMB_PAIR(0x632098AE, 0x9A43C7A4), LIMB_PAIR(0xF450A9EE, 0x221C12CB),
+            LIMB_PAIR(0x7F773A12, 0xF04A8E7C), LIMB_PAIR(0xB2AD0EE7, 0x427A8CCC), LIMB_PAIR(0xC0B2A786, 0x93F7EE9D), LIMB_PAIR(0x89BBC18D, 0x6592BB00), LIMB_PARTIAL(0x0FD)
+        }
+    },
+#endif
+#if (62 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^62 * G
+            LIMB_PAIR(0xB6BF5EC4, 0x1EBC5309), LIMB_PAIR(0x3A92BA16, 0x29CA5BA7), LIMB_PAIR(0x70839C14, 0xBDB1BCE4), LIMB_PAIR(0xDE1F966C, 0x963FD369),
+            LIMB_PAIR(0x4FABA5B7, 0x208FDC75), LIMB_PAIR(0x678FC163, 0x2F1EA65A), LIMB_PAIR(0xA773BBC5, 0x792FA255), LIMB_PAIR(0xB22A653B, 0x752A08FA), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0x2E58F405, 0x096AFF66), LIMB_PAIR(0xD6658910, 0xEE92B17D), LIMB_PAIR(0xD33B5B5A, 0x65792CB3), LIMB_PAIR(0x5678F269, 0xFA503F21),
+            LIMB_PAIR(0xEFDFFC67, 0x4E2757C8), LIMB_PAIR(0x665347F5, 0xBE46A6F1), LIMB_PAIR(0x6D9773E7, 0xD049A158), LIMB_PAIR(0xB0A28AC5, 0x9555B002), LIMB_PARTIAL(0x145)
+        },
+        {   // 2 * 16^62 * G
+            LIMB_PAIR(0x160E37A4, 0xB09A3E8B), LIMB_PAIR(0x27DB36B6, 0x8ED9AC06), LIMB_PAIR(0x99CBFCBE, 0xECF1838A), LIMB_PAIR(0x28B4EE00, 0xB12C94DA),
+            LIMB_PAIR(0xC5F1FDC4, 0xD0841818), LIMB_PAIR(0xBEE0ADF4, 0xC43E50B2), LIMB_PAIR(0x122324C6, 0x19F3F05B), LIMB_PAIR(0x988338BB, 0x796BAC65), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0xB50F7626, 0xF211AF1A), LIMB_PAIR(0xCA2F6779, 0xDECF7989), LIMB_PAIR(0xE1ECBBA1, 0xCBBA6B74), LIMB_PAIR(0x5E5FB261, 0x73F60E83),
+            LIMB_PAIR(0x0629DD5D, 0x3EEBD689), LIMB_PAIR(0x05FBA7EE, 0x8906A06E), LIMB_PAIR(0x58152375, 0x7A23D83A), LIMB_PAIR(0xE9F1D23D, 0x0F4B9B2D), LIMB_PARTIAL(0x009)
+        },
+        {   // 3 * 16^62 * G
+            LIMB_PAIR(0x77B9ABA6, 0x353AE6FD), LIMB_PAIR(0x013F3158, 0xBAAB19AF), LIMB_PAIR(0x7B9B7AAA, 0x14D0564C), LIMB_PAIR(0x2D9FF473, 0xE591B96A),
+            LIMB_PAIR(0x73F46109, 0x327E3FB8), LIMB_PAIR(0x6BE11242, 0x61C0191E), LIMB_PAIR(0x6345CF6D, 0x9696F1BD), LIMB_PAIR(0x684C060B, 0x3DD87573), LIMB_PARTIAL(0x058),
+            LIMB_PAIR(0x285A6DDE, 0xDAB49BA0), LIMB_PAIR(0x075EA1C1, 0x7D66E2C3), LIMB_PAIR(0x2D8CE1F9, 0x72197350), LIMB_PAIR(0xAE730C53, 0x5E64C366),
+            LIMB_PAIR(0xD30475E5, 0x17154D6D), LIMB_PAIR(0x3341D88B, 0x14153F7A), LIMB_PAIR(0x6235304E, 0x711DFAB6), LIMB_PAIR(0xBD4533FC, 0x0E010897), LIMB_PARTIAL(0x177)
+        },
+        {   // 4 * 16^62 * G
+            LIMB_PAIR(0x9659F9E9, 0x75B62063), LIMB_PAIR(0xC4B6DC18, 0xA5568027), LIMB_PAIR(0x1F499E7B, 0x1C5DBFFF), LIMB_PAIR(0xFFA60EEB, 0x35B20FFD),
+            LIMB_PAIR(0x5E2237E6, 0x4368AC97), LIMB_PAIR(0x9ED425D7, 0x502C0E78), LIMB_PAIR(0xF5AEAA27, 0xF8877B29), LIMB_PAIR(0xCD2E9BCF, 0x137E015D), LIMB_PARTIAL(0x0FC),
+            LIMB_PAIR(0x3FFFEB71, 0x69BE3C6D), LIMB_PAIR(0xE33B4CA6, 0x5739D6C9), LIMB_PAIR(0x643A1EB8, 0x94672002), LIMB_PAIR(0x70FD238B, 0xD1359E05),
+            LIMB_PAIR(0x93916A8A, 0x3B7EF874), LIMB_PAIR(0xEFDAF809, 0x4EF08127), LIMB_PAIR(0x4143AB1A, 0xDE4174E7), LIMB_PAIR(0x42E7AEE4, 0x3BB964E0), LIMB_PARTIAL(0x151)
+        },
+        {   // 5 * 16^62 * G
+            LIMB_PAIR(0x2177C1C1, 0xAA4A212A), LIMB_PAIR(0x4C8A2A83, 0xF08F1F5D), LIMB_PAIR(0x0FE14C27, 0xEEB0A894), LIMB_PAIR(0x3F0C1F0B, 0x564A1C8F),
+            LIMB_PAIR(0x9297B55E, 0x6B73048C), LIMB_PAIR(0x7A810E5B, 0x3DDCE907), LIMB_PAIR(0x3DE8797F, 0xD8F99EFC), LIMB_PAIR(0x37379157, 0xD9B3FA2E), LIMB_PARTIAL(0x1B0),
+            LIMB_PAIR(0xFE9275E2, 0x65A7DC22), LIMB_PAIR(0x6960A690, 0xBE8B93FB), LIMB_PAIR(0x63F437EA, 0xC783DF88), LIMB_PAIR(0x5A22F1EF, 0x4FBCF146),
+            LIMB_PAIR(0xCFDCF231, 0xA1B86AB3), LIMB_PAIR(0x50CB90C7, 0x0B1309CF), LIMB_PAIR(0xFC3CCE3C, 0xA77F0BDE), LIMB_PAIR(0xC30AC697, 0x86DEFF3C), LIMB_PARTIAL(0x170)
+        },
+        {   // 6 * 16^62 * G
+            LIMB_PAIR(0x980C0F9B, 0x9584A837), LIMB_PAIR(0xF234FF0F, 0x4C2C21B4), LIMB_PAIR(0x1068EEE2, 0x584A1824), LIMB_PAIR(0xC5B71C77, 0xB3C08003),
+            LIMB_PAIR(0x2505132C, 0x98A59E37), LIMB_PAIR(0x24513321, 0xFEEB5367), LIMB_PAIR(0x2C9AFA82, 0x83F62352), LIMB_PAIR(0x23D28BBE, 0x5A470AAD), LIMB_PARTIAL(0x160),
+            LIMB_PAIR(0xCE4E21A9, 0x2AA901FD), LIMB_PAIR(0x6C14573A, 0xC0FB4570), LIMB_PAIR(0x21C1A7AF, 0xE0711B5E), LIMB_PAIR(0x2A47A293, 0xEE3BFBFA),
+            LIMB_PAIR(0xFF0DE285, 0x12830261), LIMB_PAIR(0x68D87D16, 0xD334F3EE), LIMB_PAIR(0x65C6B8BC, 0x3FB8D747), LIMB_PAIR(0xA12A5638, 0x1C40F1AB), LIMB_PARTIAL(0x070)
+        },
+        {   // 7 * 16^62 * G
+            LIMB_PAIR(0xB580E3A2, 0x1A4D19D6), LIMB_PAIR(0x20834FCC, 0xCEE647C2), LIMB_PAIR(0x2E9454E0, 0x94066A7C), LIMB_PAIR(0xB1B480E6, 0x220B4993),
+            LIMB_PAIR(0x30E72308, 0x0A89C3E3), LIMB_PAIR(0x6294E865, 0xF22F323E), LIMB_PAIR(0x645C364D, 0x27DAD374), LIMB_PAIR(0xB47A7A2C, 0x16B70ED4), LIMB_PARTIAL(0x0CD),
+            LIMB_PAIR(0xCC79E99A, 0x208A7F56), LIMB_PAIR(0x1991087E, 0xB844ED7D), LIMB_PAIR(0x7EE9FC8B, 0x6F19C1C0), LIMB_PAIR(0xB9208633, 0x12A4140B),
+            LIMB_PAIR(0x2C1A5947, 0x8F976B25), LIMB_PAIR(0xA1BFC7C3, 0x083544DD), LIMB_PAIR(0x206DF951, 0xD432604B), LIMB_PAIR(0x7ECA93B3, 0x0F3C03B5), LIMB_PARTIAL(0x115)
+        },
+        {   // 8 * 16^62 * G
+            LIMB_PAIR(0xBDDB33C7, 0xC3246FC8), LIMB_PAIR(0x81972F1F, 0x68DC29BB), LIMB_PAIR(0xEE7ED0FD, 0x7B5EDC9B), LIMB_PAIR(0xE158DEAF, 0xEE83430C),
+            LIMB_PAIR(0xDF7C5708, 0x8A924B48), LIMB_PAIR(0xF2C65A04, 0xB421A505), LIMB_PAIR(0x5C289F82, 0xB5DA215E), LIMB_PAIR(0xB9D02B8A, 0x752D5FF9), LIMB_PARTIAL(0x165),
+            LIMB_PAIR(0x0D9D7788, 0x55564B4A), LIMB_PAIR(0x6CAB3607, 0x70C74491), LIMB_PAIR(0x90091526, 0xF53BC986), LIMB_PAIR(0x9ABC41A6, 0x1E88044D),
+            LIMB_PAIR(0x2BB6D384, 0x38E9D3DD), LIMB_PAIR(0x84BC3DFE, 0x4177105E), LIMB_PAIR(0x674DF1B0, 0x2B95A432), LIMB_PAIR(0xEB1DE0DF, 0x38196726), LIMB_PARTIAL(0x137)
+        }
+    },
+#endif
+#if (63 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^63 * G
+            LIMB_PAIR(0xDBBD171F, 0xA6D6B095), LIMB_PAIR(0x44F06181, 0xF0D3B957), LIMB_PAIR(0x78FAB381, 0x46B97865), LIMB_PAIR(0xAE356E29, 0x7DA97845),
+            LIMB_PAIR(0xD01B3C09, 0x4A0C3E00), LIMB_PAIR(0xE106D5BE, 0xAED18677), LIMB_PAIR(0x1AFFDB67, 0xD7309C76), LIMB_PAIR(0x25F2B8C2, 0x97158754), LIMB_PARTIAL(0x193),
+            LIMB_PAIR(0x24785079, 0x65D3657B), LIMB_PAIR(0x5E064334, 0xB1D2B5F7), LIMB_PAIR(0x2B7B61E1, 0x0736BFDA), LIMB_PAIR(0x284E4FA6, 0xB39C4DB1),
+            LIMB_PAIR(0xBD934998, 0x66CEDF43), LIMB_PAIR(0x324D2DE1, 0x8F9F6243), LIMB_PAIR(0x4C193171, 0x92F2524E), LIMB_PAIR(0x964A8383, 0x75705ACD), LIMB_PARTIAL(0x031)
+        },
+        {   // 2 * 16^63 * G
+            LIMB_PAIR(0xD0739036, 0xFCE13E03), LIMB_PAIR(0xA4161596, 0x0AF573F2), LIMB_PAIR(0x0BDEDD89, 0xF3DB4C75), LIMB_PAIR(0xE8EAE413, 0xB594CCA3),
+            LIMB_PAIR(0xE2E66F2D, 0xD9AD2EDC), LIMB_PAIR(0x66F7F599, 0xE99C0481), LIMB_PAIR(0x6886E453, 0xD141FF97), LIMB_PAIR(0x53E3221F, 0x087714A1), LIMB_PARTIAL(0x0BE),
+            LIMB_PAIR(0x5DAEBD46, 0x91EAB39E), LIMB_PAIR(0x94FB01F2, 0x3F9DDEA4), LIMB_PAIR(0x142AE67C, 0xFAAA200B), LIMB_PAIR(0xCA631C4B, 0x853DA6B0),
+            LIMB_PAIR(0xFB3F4229, 0x4C9CA396), LIMB_PAIR(0xE3690F95, 0xB00A8DE2), LIMB_PAIR(0xC2C7704A, 0xE8000000), LIMB_PAIR(0x93AD0DBC, 0x65C0AB73), LIMB_PARTIAL(0x1E0)
+        },
+        {   // 3 * 16^63 * G
+            LIMB_PAIR(0x0F810445, 0xEDEC6D35), LIMB_PAIR(0x5FE4215A, 0x2EE46844), LIMB_PAIR(0x969ACDE4, 0xDACE7F0E), LIMB_PAIR(0xC754DFF6, 0x3708F4F4),
+            LIMB_PAIR(0x6C0370AB, 0xA510303F), LIMB_PAIR(0xB4ADC2FE, 0x9D5CAC3A), LIMB_PAIR(0x395A765B, 0xF33D4A2B), LIMB_PAIR(0x1856E0C8, 0x437BFDCA), LIMB_PARTIAL(0x0C5),
+            LIMB_PAIR(0x0812A78C, 0x287DC7F7), LIMB_PAIR(0x05DC3FCD, 0x30CB0CD9), LIMB_PAIR(0x008EC68B, 0x80343B51), LIMB_PAIR(0xCC404F65, 0xBB3DA3A5),
+            LIMB_PAIR(0x93D9F303, 0xD5276AF5), LIMB_PAIR(0x7DAA5950, 0x85A875D4), LIMB_PAIR(0x078E6556, 0x5BAAE52F), LIMB_PAIR(0xE58A4E97, 0xDDD9E3EF), LIMB_PARTIAL(0x1C5)
+        },
+        {   // 4 * 16^63 * G
+            LIMB_PAIR(0x7252EBA7, 0xA3FF48A3), LIMB_PAIR(0x91359DAE, 0xFE771FD3), LIMB_PAIR(0xD05BE01F, 0x9DDA3A45), LIMB_PAIR(0xE97A9A89, 0x5CFA713D),
+            LIMB_PAIR(0x87CB6C64, 0x5FD23BD8), LIMB_PAIR(0x8D9AE4BB, 0xBE45C075), LIMB_PAIR(0x78E27270, 0x90F94384), LIMB_PAIR(0xF0DBDDD9, 0x3E1B0D18), LIMB_PARTIAL(0x018),
+            LIMB_PAIR(0xF2FB7FAC, 0x6E5283F7), LIMB_PAIR(0x3593D0E4, 0x232E9CD1), LIMB_PAIR(0xEE81F08C, 0x97418D9C), LIMB_PAIR(0x1F2E8DC0, 0x339540F5),
+            LIMB_PAIR(0x619B5EE8, 0xEAACB20B), LIMB_PAIR(0x4AE00660, 0xEFC8079A), LIMB_PAIR(0x765802B5, 0xA968FB1C), LIMB_PAIR(0xF20650FA, 0x60088783), LIMB_PARTIAL(0x145)
+        },
+        {   // 5 * 16^63 * G
+            LIMB_PAIR(0x2A7CBE50, 0x322EFE14), LIMB_PAIR(0xB2F85051, 0xAF425A7D), LIMB_PAIR(0x812B26A2, 0xCC7C9D91), LIMB_PAIR(0x68066E44, 0xD89FD049),
+            LIMB_PAIR(0xEC83B2F1, 0x79BA895F), LIMB_PAIR(0x10E90A64, 0x570C2DB4), LIMB_PAIR(0x89C59658, 0xE00F1AE8), LIMB_PAIR(0x78EDD742, 0xD94F065C), LIMB_PARTIAL(0x021),
+            LIMB_PAIR(0xC5B5B0BD, 0x3FA27BD8), LIMB_PAIR(0xA5121DE7, 0x432599D6), LIMB_PAIR(0x2E8294CF, 0x528925DA), LIMB_PAIR(0xCF0F9464, 0x28C15142),
+            LIMB_PAIR(0xA6FA7F3C, 0x38498320), LIMB_PAIR(0xBA93F4B8, 0x92CDE9B1), LIMB_PAIR(0x4BB98CAC, 0xEFE2455E), LIMB_PAIR(0xD1B0E59C, 0xE0CC0EF1), LIMB_PARTIAL(0x0D6)
+        },
+        {   // 6 * 16^63 * G
+            LIMB_PAIR(0x74A00EFD, 0xC538D350), LIMB_PAIR(0x97BC3AC7, 0x4776AD96), LIMB_PAIR(0x1867F889, 0x22041B53), LIMB_PAIR(0x19CBF055, 0x2AA35943),
+            LIMB_PAIR(0x0C38F064, 0xF00A49D0), LIMB_PAIR(0x7BD0991F, 0xCF40E617), LIMB_PAIR(0x0155FFAF, 0xA59DF69B), LIMB_PAIR(0xACE4AA07, 0x1F2D50FE), LIMB_PARTIAL(0x1E4),
+            LIMB_PAIR(0x5CCE1B0D, 0xF1A777EE), LIMB_PAIR(0x9C7AD9AA, 0xFB8A0AB0), LIMB_PAIR(0x58A6AFF6, 0xC0D3B780), LIMB_PAIR(0x370AF1D6, 0xA9F4B3A3),
+            LIMB_PAIR(0x3D39D147, 0x3A0731A5), LIMB_PAIR(0x32C93FA5, 0xF7AA9DF7), LIMB_PAIR(0x9C938C2D, 0xD9A0599F), LIMB_PAIR(0x01B0C0D0, 0x2702735D), LIMB_PARTIAL(0x152)
+        },
+        {   // 7 * 16^63 * G
+            LIMB_PAIR(0xA1D24F4B, 0x64F62DCB), LIMB_PAIR(0xF5776EF9, 0x134DA7C1), LIMB_PAIR(0x534BF835, 0xB6699E3F), LIMB_PAIR(0xEF275259, 0xC9B93539),
+            LIMB_PAIR(0x0F7CF548, 0xA9D68C87), LIMB_PAIR(0xFBD2D9A9, 0x4EE54FF7), LIMB_PAIR(0x465E7C2C, 0xCAF81404), LIMB_PAIR(0x048CAD5D, 0xA02FCE30), LIMB_PARTIAL(0x0D4),
+            LIMB_PAIR(0x6E76C091, 0x9CE2E24C), LIMB_PAIR(0x41EC4C75, 0x8353D7C9), LIMB_PAIR(0x43A019D0, 0xE7F5BFBB), LIMB_PAIR(0x508E92C9, 0x74CF2BBE),
+            LIMB_PAIR(0x8DFCBACA, 0x58F2E1B6), LIMB_PAIR(0x98BDC65D, 0xBE79DF8B), LIMB_PAIR(0xC699DB7E, 0xCEABFA1C), LIMB_PAIR(0x0E3F9421, 0xE237815E), LIMB_PARTIAL(0x093)
+        },
+        {   // 8 * 16^63 * G
+            LIMB_PAIR(0x36E4A40D, 0xCFE4F02E), LIMB_PAIR(0xF2B51E5E, 0x3AF87A7D), LIMB_PAIR(0x83FBF682, 0x3B6BAA26), LIMB_PAIR(0x063E5979, 0x9A7A9339),
+            LIMB_PAIR(0x41B680C9, 0x77214EBF), LIMB_PAIR(0x1AE59F71, 0x1FBDEE59), LIMB_PAIR(0xE1530C0A, 0x9A4DD12E), LIMB_PAIR(0x91FE54B0, 0xE1138396), LIMB_PARTIAL(0x0BA),
+            LIMB_PAIR(0xFC229914, 0xF84D66EB), LIMB_PAIR(0x452DA1C3, 0xFCC47954), LIMB_PAIR(0x6F9743C5, 0xE662B9C0), LIMB_PAIR(0x087D7194, 0xD0DB646D),
+            LIMB_PAIR(0x6E1BBF6F, 0x2ABC096B), LIMB_PAIR(0x331F3A96, 0x24272840), LIMB_PAIR(0xA6B9F40D, 0x0DA86EA2), LIMB_PAIR(0x7DCB4554, 0xEDB36331), LIMB_PARTIAL(0x0D5)
+        }
+    },
+#endif
+#if (64 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^64 * G
+            LIMB_PAIR(0xEAFFD713, 0xA87650D1), LIMB_PAIR(0xA797AD44, 0xEC781C97), LIMB_PAIR(0xB4BCAC17, 0x1E94ACCD), LIMB_PAIR(0xB3981CC9, 0x2284F96F),
+            LIMB_PAIR(0x091634EB, 0xB8B2EF57), LIMB_PAIR(0xCAD053D0, 0x4ACCF5E8), LIMB_PAIR(0x5D1EF480, 0x0ECA4F9B), LIMB_PAIR(0xD6E76957, 0x1598EF27), LIMB_PARTIAL(0x131),
+            LIMB_PAIR(0xB72D8840, 0x7CBC9061), LIMB_PAIR(0x86A5BA36, 0xE611924D), LIMB_PAIR(0xE066D292, 0xE02E9CA8), LIMB_PAIR(0xA68A0466, 0xDB092F52),
+            LIMB_PAIR(0x0C0B18F8, 0xF5D97F5D), LIMB_PAIR(0x5C99B95C, 0xB5E17146), LIMB_PAIR(0x9D3D6ACF, 0x1BAFBE74), LIMB_PAIR(0xF370BD5F, 0x606103FE), LIMB_PARTIAL(0x13B)
+        },
+        {   // 2 * 16^64 * G
+            LIMB_PAIR(0x46E69DAF, 0x272EC596), LIMB_PAIR(0x79B09A47, 0x348D7ACD), LIMB_PAIR(0xD806F931, 0x8731070B), LIMB_PAIR(0x011D80CA, 0xE1191599),
+            LIMB_PAIR(0x1B8CD947, 0xD001CED0), LIMB_PAIR(0x78A6654E, 0x31DD3C98), LIMB_PAIR(0xC6409599, 0xDE8DBD0C), LIMB_PAIR(0x691B6141, 0xB8939D44), LIMB_PARTIAL(0x17A),
+            LIMB_PAIR(0x9C45660B, 0x146FDD62), LIMB_PAIR(0xA6283D26, 0xEB9A13D3), LIMB_PAIR(0xC9E2A86B, 0xB99E7E66), LIMB_PAIR(0xE626A5EA, 0x926EE0AB),
+            LIMB_PAIR(0xE8A93DED, 0xF01EC218), LIMB_PAIR(0x040FB497, 0x8562B91A), LIMB_PAIR(0x6DDD2F63, 0x25FA595F), LIMB_PAIR(0xA2612413, 0x9389FFFC), LIMB_PARTIAL(0x0D2)
+        },
+        {   // 3 * 16^64 * G
+            LIMB_PAIR(0x6599420C, 0xC65023DB), LIMB_PAIR(0x2DE4F201, 0xD5F25993), LIMB_PAIR(0x325DB6DE, 0xDF04EB7F), LIMB_PAIR(0x088C5B7B, 0xBA7A4C67),
+            LIMB_PAIR(0x14FFF349, 0x42880303), LIMB_PAIR(0xCED29B1C, 0x5D8C5AC1), LIMB_PAIR(0xA9D0FF4F, 0xBA44893A), LIMB_PAIR(0xED3F3117, 0xC94974BA), LIMB_PARTIAL(0x10F),
+            LIMB_PAIR(0xFFE235F6, 0xD804DAFC), LIMB_PAIR(0x67C31EFD, 0x1701E38D), LIMB_PAIR(0x6B9307C1, 0xD6B49909), LIMB_PAIR(0x1FA96EBA, 0xF33C7496),
+            LIMB_PAIR(0x92099D0B, 0xFAB4F9F8), LIMB_PAIR(0x6D5334F5, 0x3CC5ED86), LIMB_PAIR(0xC94E6D74, 0x41745249), LIMB_PAIR(0xDD4B2B7C, 0x27EF9399), LIMB_PARTIAL(0x18F)
+        },
+        {   // 4 * 16^64 * G
+            LIMB_PAIR(0x47EDD0E3, 0xD1A48C68), LIMB_PAIR(0x253C6BB5, 0xFEFB60BE), LIMB_PAIR(0x5AB3E95D, 0x7265EBB7), LIMB_PAIR(0xF058192C, 0xC8D1B679),
+            LIMB_PAIR(0xFA21C3EB, 0xCDC478D6), LIMB_PAIR(0x10B2B221, 0xDF6360DC), LIMB_PAIR(0x1101D18E, 0x824B28A7), LIMB_PAIR(0xE04269D1, 0x4BC043F1), LIMB_PARTIAL(0x032),
+            LIMB_PAIR(0x5D49E112, 0xA342984E), LIMB_PAIR(0x4E80CD3B, 0x981AC554), LIMB_PAIR(0x2C45F14D, 0x489EDE32), LIMB_PAIR(0x0671C724, 0xB97B3BA5),
+            LIMB_PAIR(0xBAE2CD87, 0x3818C351), LIMB_PAIR(0x61521947, 0xF3719C92), LIMB_PAIR(0xA8252D72, 0xB9116ED9), LIMB_PAIR(0x9C406F54, 0x992761ED), LIMB_PARTIAL(0x141)
+        },
+        {   // 5 * 16^64 * G
+            LIMB_PAIR(0x1FFEBCA8, 0x9B27FAE4), LIMB_PAIR(0xC5C859D5, 0xE9F906D8), LIMB_PAIR(0x36E50ADE, 0xA3B727FF), LIMB_PAIR(0xD7685714, 0x95307CF6),
+            LIMB_PAIR(0xB12746CD, 0xDDC0DF1F), LIMB_PAIR(0x38D91211, 0x46128492), LIMB_PAIR(0x1D3EC9C2, 0x09CB00C7), LIMB_PAIR(0x556AEC93, 0x45BCC736), LIMB_PARTIAL(0x147),
+            LIMB_PAIR(0x3B06B817, 0x08CAAAF7), LIMB_PAIR(0x6F0EF309, 0x7664BB13), LIMB_PAIR(0xF9D1878D, 0x6AE38711), LIMB_PAIR(0xF8BE5C1F, 0x30BE2E46),
+            LIMB_PAIR(0x79E9064E, 0x6158AE6F), LIMB_PAIR(0x6FBEDEA7, 0x52E5CBE0), LIMB_PAIR(0x6DEF5C69, 0x0B8F64E7), LIMB_PAIR(0xD1F043ED, 0x6AEA5E7C), LIMB_PARTIAL(0x0B6)
+        },
+        {   // 6 * 16^64 * G
+            LIMB_PAIR(0xECC0A759, 0x8A651D57), LIMB_PAIR(0x0C397ADB, 0x3FB5FEA9), LIMB_PAIR(0xAB6247D5, 0x9F04790A), LIMB_PAIR(0xC823801D, 0xB1269A13),
+            LIMB_PAIR(0xD2F4034B, 0x19D61215), LIMB_PAIR(0xB579382E, 0x8814EB23), LIMB_PAIR(0xEEA3E4E7, 0x0C2023B1), LIMB_PAIR(0x2B5E1EA5, 0x5D6F0375), LIMB_PARTIAL(0x195),
+            LIMB_PAIR(0xBC9FBC6A, 0x26176EF3), LIMB_PAIR(0x636333E0, 0x88AF6C5D), LIMB_PAIR(0xBC520078, 0x90F1A752), LIMB_PAIR(0x53B93FE0, 0x9D7FDD83),
+            LIMB_PAIR(0xF4CA8BC0, 0x54FA1A12), LIMB_PAIR(0x78F683EB, 0xB899D0CE), LIMB_PAIR(0xF129CC78, 0xBA2E014C), LIMB_PAIR(0x3620B670, 0x268CC1D7), LIMB_PARTIAL(0x0AF)
+        },
+        {   // 7 * 16^64 * G
+            LIMB_PAIR(0x6939F7CC, 0x30FF765E), LIMB_PAIR(0xE29539FA, 0x6B45FE45), LIMB_PAIR(0x3DE8DEFF, 0x9BEE02F0), LIMB_PAIR(0x422BB010, 0x5CFB4D5B),
+            LIMB_PAIR(0x66C50B56, 0x864E6A6F), LIMB_PAIR(0x3CB97C42, 0x2B36BAEF), LIMB_PAIR(0xF6376684, 0x5A2FDF30), LIMB_PAIR(0xB8064230, 0x5FBF2F7A), LIMB_PARTIAL(0x11B),
+            LIMB_PAIR(0x208CCE19, 0x6394407D), LIMB_PAIR(0xF4A37C9E, 0x0FBE4793), LIMB_PAIR(0x602CFFDB, 0x635DC6AA), LIMB_PAIR(0xACE2DAF5, 0x914F6669),
+            LIMB_PAIR(0xF042C02D, 0xD66F7167), LIMB_PAIR(0xDC027BE7, 0xFE264CEF), LIMB_PAIR(0xF4742027, 0xA345D34A), LIMB_PAIR(0x06F4FDAF, 0x2E4E5757), LIMB_PARTIAL(0x05D)
+        },
+        {   // 8 * 16^64 * G
+            LIMB_PAIR(0xB9F59031, 0xDFBFA8C0), LIMB_PAIR(0xA5E17023, 0x683DF70B), LIMB_PAIR(0x42CE28B7, 0x07958FDC), LIMB_PAIR(0xC6D4DC78, 0xB8965B5B),
+            LIMB_PAIR(0x6E4B4290, 0x78441B9A), LIMB_PAIR(0xEA4B4AA1, 0x3909E659), LIMB_PAIR(0x29B6CD62, 0x9C8F59C6), LIMB_PAIR(0x19A026CC, 0xF400A019), LIMB_PARTIAL(0x0CF),
+            LIMB_PAIR(0xF77FA34F, 0x09844EDE), LIMB_PAIR(0x95B4ACFA, 0x9DA8CDC4), LIMB_PAIR(0x4D52835B, 0x5BB76207), LIMB_PAIR(0x9C0584E1, 0xC39505E2),
+            LIMB_PAIR(0x6C4F318E, 0x4C9A0F29), LIMB_PAIR(0x7D87F206, 0xDD1A8F41), LIMB_PAIR(0x95EC312C, 0x423805CD), LIMB_PAIR(0x9304343E, 0x21639F51), LIMB_PARTIAL(0x092)
+        }
+    },
+#endif
+#if (65 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^65 * G
+            LIMB_PAIR(0x9185544D, 0x6D9B0C3C), LIMB_PAIR(0x8DF2765F, 0xAD21890E), LIMB_PAIR(0xCBE030A2, 0x47836EE3), LIMB_PAIR(0xF7651AED, 0x606B9133),
+            LIMB_PAIR(0x71C00932, 0xB1A31586), LIMB_PAIR(0xCFE05F47, 0x9806A369), LIMB_PAIR(0xF57F3700, 0xC2EBC613), LIMB_PAIR(0xF065F07C, 0x1022D6D2), LIMB_PARTIAL(0x109),
+            LIMB_PAIR(0x514C45ED, 0xB292C583), LIMB_PAIR(0x947E68A1, 0x89AC5BF2), LIMB_PAIR(0xAF507C14, 0x633C4300), LIMB_PAIR(0x7DA4020A, 0x943D7BA5),
+            LIMB_PAIR(0xC0ED8274, 0xD1E90C7A), LIMB_PAIR(0xE59426E6, 0x9634868C), LIMB_PAIR(0xC26BC9DE, 0x24A6FFF2), LIMB_PAIR(0x152416CD, 0x1A012168), LIMB_PARTIAL(0x00C)
+        },
+        {   // 2 * 16^65 * G
+            LIMB_PAIR(0x9102B570, 0xC2453D60), LIMB_PAIR(0x142C3E23, 0x70840E5C), LIMB_PAIR(0xC30037D9, 0x7294B1F1), LIMB_PAIR(0x1DBF5AB6, 0xA2500F12),
+            LIMB_PAIR(0xC9C8EE6E, 0x03ECEB67), LIMB_PAIR(0x30820ABB, 0xA19C3193), LIMB_PAIR(0x7DA6B820, 0x7AAD59E8), LIMB_PAIR(0xC38D842F, 0xE97823F8), LIMB_PARTIAL(0x06D),
+            LIMB_PAIR(0xA7B6BB9E, 0xCE5BB75E), LIMB_PAIR(0x569C9EDD, 0x9090358D), LIMB_PAIR(0x9CD0C065, 0xA8B5EC36), LIMB_PAIR(0xF81C82B8, 0xB2B5AC1C),
+            LIMB_PAIR(0x3FFCEB86, 0x8FEB364C), LIMB_PAIR(0xDF4F9F7E, 0x355ED9EC), LIMB_PAIR(0x5CE12FF4, 0x6F2EFE42), LIMB_PAIR(0x0155070D, 0xB2316878), LIMB_PARTIAL(0x035)
+        },
+        {   // 3 * 16^65 * G
+            LIMB_PAIR(0x86660E96, 0xD8BE53EB), LIMB_PAIR(0x8BE7763D, 0x72C2673C), LIMB_PAIR(0xC6B55BF0, 0xA7C5462E), LIMB_PAIR(0x574A104B, 0x9DEF337B),
+            LIMB_PAIR(0x9E9A1386, 0xA8FE70AE), LIMB_PAIR(0xBD010CF1, 0x6070F210), LIMB_PAIR(0x94AE907B, 0x5D3EDA38), LIMB_PAIR(0x1BEA88CB, 0xA69D8679), LIMB_PARTIAL(0x000),
+            LIMB_PAIR(0x03C8DD6A, 0xD1DDE972), LIMB_PAIR(0xD8950C30, 0x562332D1), LIMB_PAIR(0x5EA340F7, 0x33BE213E), LIMB_PAIR(0xEB40E91E, 0xEBB49ED4),
+            LIMB_PAIR(0x70B2CA5A, 0xEFE4AAC2), LIMB_PAIR(0x900CEEB3, 0xF6AD3CC1), LIMB_PAIR(0x6CC704D6, 0x67E9A881), LIMB_PAIR(0x12FE8A0A, 0xDD3F2BAF), LIMB_PARTIAL(0x0BE)
+        },
+        {   // 4 * 16^65 * G
+            LIMB_PAIR(0x1BC0FA77, 0x5F56B5A4), LIMB_PAIR(0x64FD36F5, 0x6CDD6BB5), LIMB_PAIR(0x8A5B7C7F, 0xD0AC68B5), LIMB_PAIR(0x09919EF9, 0x4A92D9BF),
+            LIMB_PAIR(0x71C3C520, 0xC305E12B), LIMB_PAIR(0xDB699AEE, 0x554A9D1C), LIMB_PAIR(0x61F54643, 0x7FDE0077), LIMB_PAIR(0x479115CE, 0x99C13124), LIMB_PARTIAL(0x039),
+            LIMB_PAIR(0xC271AC2D, 0x25F890E1), LIMB_PAIR(0x94B370AC, 0x1353CCD3), LIMB_PAIR(0x744D4011, 0xC7B5ADF6), LIMB_PAIR(0xBE378127, 0x9CCD7687),
+            LIMB_PAIR(0x06C4E3CD, 0xA8489B5C), LIMB_PAIR(0x305505F9, 0x1945580A), LIMB_PAIR(0x4AB3B12B, 0x07190A20), LIMB_PAIR(0x1534EA4D, 0x0FF53EB1), LIMB_PARTIAL(0x159)
+        },
+        {   // 5 * 16^65 * G
+            LIMB_PAIR(0xB1167003, 0xE774EED9), LIMB_PAIR(0x932845B9, 0xECDE86E1), LIMB_PAIR(0x97A8A10D, 0x0381D178), LIMB_PAIR(0xAEB8BEF7, 0x995A4926),
+            LIMB_PAIR(0x2304BAE0, 0x3EE19C81), LIMB_PAIR(0xFE977E97, 0x541449E3), LIMB_PAIR(0xA517B358, 0xD7EF476B), LIMB_PAIR(0xE0D847CB, 0xE55330BC), LIMB_PARTIAL(0x012),
+            LIMB_PAIR(0xF06A91D6, 0x1620A1D6), LIMB_PAIR(0xAC578BFA, 0x714B3502), LIMB_PAIR(0x6BED112D, 0x2606EBDB), LIMB_PAIR(0x63F8E778, 0x8B7B2715),
+            LIMB_PAIR(0x651FD543, 0x31833913), LIMB_PAIR(0xDC9638FE, 0x14929F1A), LIMB_PAIR(0x3EE709D3, 0x2637EC81), LIMB_PAIR(0x05547EAA, 0x39FAF7E7), LIMB_PARTIAL(0x09C)
+        },
+        {   // 6 * 16^65 * G
+            LIMB_PAIR(0x6C6A364B, 0x785E09FF), LIMB_PAIR(0x53E3C393, 0xD00A50FE), LIMB_PAIR(0x0D36FB23, 0xAD964C6E), LIMB_PAIR(0xEBADA914, 0x353441FE),
+            LIMB_PAIR(0xA5BA72FB, 0x4E16727E), LIMB_PAIR(0x7BDC78A4, 0x5114C6E0), LIMB_PAIR(0xF38384CE, 0xCA3A8E27), LIMB_PAIR(0x77307092, 0xE48F64CC), LIMB_PARTIAL(0x089),
+            LIMB_PAIR(0x351AA439, 0xB3152778), LIMB_PAIR(0x6A2E6C8C, 0x0BBC970E), LIMB_PAIR(0x12CFDC8D, 0xAE03DE83), LIMB_PAIR(0x779C99E6, 0x1622D6DB),
+            LIMB_PAIR(0x59EF9E70, 0x82D6078B), LIMB_PAIR(0x7368486A, 0x3539FFD0), LIMB_PAIR(0x083F7B1A, 0xE61A3E2B), LIMB_PAIR(0x4B874DC2, 0xB214F0B7), LIMB_PARTIAL(0x155)
+        },
+        {   // 7 * 16^65 * G
+            LIMB_PAIR(0xD7ECB581, 0xE77C03EE), LIMB_PAIR(0xCEF15BEA, 0xB0B4DE18), LIMB_PAIR(0xFA1EA3FF, 0x318E5B24), LIMB_PAIR(0x710E95FD, 0xFD1D902E),
+            LIMB_PAIR(0x55CAFA30, 0x8DAEDA06), LIMB_PAIR(0x2BD11001, 0xCABA29BF), LIMB_PAIR(0xD88085BD, 0xAEC1861B), LIMB_PAIR(0xE591D19A, 0xFAA66562), LIMB_PARTIAL(0x1F6),
+            LIMB_PAIR(0xB68C7429, 0xEEE386F7), LIMB_PAIR(0x502C0797, 0x0A876AEC), LIMB_PAIR(0xC6806FA9, 0xCB587DF8), LIMB_PAIR(0xA84DE772, 0x4F7CB6DC),
+            LIMB_PAIR(0xF746CC93, 0x407A1F0F), LIMB_PAIR(0x6B953E5C, 0x7862E9BB), LIMB_PAIR(0x0A4C9357, 0x6C106CAA), LIMB_PAIR(0xC0096E5D, 0x04213043), LIMB_PARTIAL(0x1AB)
+        },
+        {   // 8 * 16^65 * G
+            LIMB_PAIR(0x4876BAB8, 0xC68052C9), LIMB_PAIR(0xF84C2E38, 0x81F704BA), LIMB_PAIR(0xF2CF9927, 0x28BB9436), LIMB_PAIR(0xD06C972C, 0xB89BBFA0),
+            LIMB_PAIR(0xB7A78E76, 0x00FE1DD8), LIMB_PAIR(0xF7F1E1AA, 0x3ADFB05A), LIMB_PAIR(0xB7278EEE, 0x45321E42), LIMB_PAIR(0xA528EBE4, 0x13D850E0), LIMB_PARTIAL(0x06F),
+            LIMB_PAIR(0x1934143A, 0x6B724C68), LIMB_PAIR(0xB657D809, 0x2F944AFD), LIMB_PAIR(0xABA2FA08, 0x38E501DF), LIMB_PAIR(0xBE66E568, 0x9285ECE1),
+            LIMB_PAIR(0xF9DF3327, 0x7AF221F7), LIMB_PAIR(0xDE74AEFC, 0x00B8A86F), LIMB_PAIR(0x9A992072, 0x19D67518), LIMB_PAIR(0xD9DDBBB6, 0x806D1C88), LIMB_PARTIAL(0x09B)
+        }
+    },
+#endif
+#if (66 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^66 * G
+            LIMB_PAIR(0x286492AD, 0xEE31E71A), LIMB_PAIR(0x65F86AC4, 0x08F3DE44), LIMB_PAIR(0xDA713CB4, 0xE89700D4), LIMB_PAIR(0xA86B7104, 0x7AD0F5E9),
+            LIMB_PAIR(0x2572C161, 0xD9A62E4F), LIMB_PAIR(0x25CC1C99, 0x77D223EF), LIMB_PAIR(0x3B962E0C, 0xEDFF6961), LIMB_PAIR(0x81D8B205, 0x818D28F3), LIMB_PARTIAL(0x08E),
+            LIMB_PAIR(0x8CDF1F60, 0x721231CF), LIMB_PAIR(0x6717760F, 0x8B640F2B), LIMB_PAIR(0xE045A403, 0xBE726F8C), LIMB_PAIR(0x0370689F, 0x422285DC),
+            LIMB_PAIR(0x72EA0DCB, 0x7196BF8F), LIMB_PAIR(0xC8086623, 0xA16F7855), LIMB_PAIR(0xC326FE48, 0xD4E19FC7), LIMB_PAIR(0x8F68BF44, 0xFDBC856E), LIMB_PARTIAL(0x13E)
+        },
+        {   // 2 * 16^66 * G
+            LIMB_PAIR(0xB79711E5, 0x225256FD), LIMB_PAIR(0xA6A843B7, 0xBDCF3433), LIMB_PAIR(0x414A71AB, 0xBD3D4548), LIMB_PAIR(0xE29E7606, 0x2E13FD39),
+            LIMB_PAIR(0xE07F29C4, 0x194B6E92), LIMB_PAIR(0xB68FD0D2, 0xD6F5E492), LIMB_PAIR(0x5DE0AE9B, 0x3AC64998), LIMB_PAIR(0x4E5BA961, 0x10E5AFE9), LIMB_PARTIAL(0x1F7),
+            LIMB_PAIR(0x8EC9CCFF, 0x27DF3C4B), LIMB_PAIR(0x2A7B0A2B, 0xDB291372), LIMB_PAIR(0xF045AFDE, 0x1CA89222), LIMB_PAIR(0x69C99247, 0xA666763C),
+            LIMB_PAIR(0x99033177, 0xD8D9F6B1), LIMB_PAIR(0x90ECA082, 0x10B696F6), LIMB_PAIR(0x0D180F50, 0x41991D66), LIMB_PAIR(0x82D6F6BC, 0x7CEE7F9B), LIMB_PARTIAL(0x1DF)
+        },
+        {   // 3 * 16^66 * G
+            LIMB_PAIR(0xB1773DFD, 0x615D6F52), LIMB_PAIR(0x4E0042A3, 0x10247D0B), LIMB_PAIR(0x6D50EEA4, 0xEBEA88D6), LIMB_PAIR(0x912C0AAA, 0x51FBDD41),
+            LIMB_PAIR(0x9B0497AA, 0x2B487636), LIMB_PAIR(0xAA18B8E6, 0x202D12DE), LIMB_PAIR(0xA19B76CC, 0x719A9526), LIMB_PAIR(0x6A37386C, 0xA91A4509), LIMB_PARTIAL(0x0BD),
+            LIMB_PAIR(0x967C2E8A, 0xBB846181), LIMB_PAIR(0x796FED3B, 0x1A547496), LIMB_PAIR(0x34C152FA, 0x3AE904FD), LIMB_PAIR(0x21C58DAC, 0x185C46F8),
+            LIMB_PAIR(0xC999F2A9, 0x2D8F1B5C), LIMB_PAIR(0x06C88BDD, 0x9C99663C), LIMB_PAIR(0x7DC27E48, 0x417038F1), LIMB_PAIR(0x0C025D84, 0xFFB6343B), LIMB_PARTIAL(0x0E6)
+        },
+        {   // 4 * 16^66 * G
+            LIMB_PAIR(0xB24565F3, 0x853233C2), LIMB_PAIR(0x5FBD38C5, 0x43478B91), LIMB_PAIR(0xD2A6992B, 0x962087FF), LIMB_PAIR(0x5EC71EC0, 0x403427F4),
+            LIMB_PAIR(0x9B151A4F, 0xC0727609), LIMB_PAIR(0xDFA1844C, 0xA8BB2DC4), LIMB_PAIR(0x101140E4, 0xA20D339E), LIMB_PAIR(0xA1C70E3B, 0x0DF52FBD), LIMB_PARTIAL(0x02E),
+            LIMB_PAIR(0x0447DE06, 0xDC412987), LIMB_PAIR(0x6CD90FA6, 0x080B5DD1), LIMB_PAIR(0xC4ECDDC5, 0xCB6A6BC7), LIMB_PAIR(0x970FE140, 0x9462FBDA),
+            LIMB_PAIR(0xA7581610, 0x4B0CDA7E), LIMB_PAIR(0xDCAB0C19, 0x6437AF41), LIMB_PAIR(0x4E100705, 0x3AB19E3F), LIMB_PAIR(0xADC5E7FE, 0xF8E93A95), LIMB_PARTIAL(0x1F7)
+        },
+        {   // 5 * 16^66 * G
+            LIMB_PAIR(0xD6057266, 0xC9E4ADA3), LIMB_PAIR(0xDCC7CEC8, 0xC6488350), LIMB_PAIR(0xBC4568E6, 0x2069C962), LIMB_PAIR(0x694DB690, 0x29DF0E10),
+            LIMB_PAIR(0x5177E692, 0xD6985BFF), LIMB_PAIR(0x08CD287F, 0x27983B3A), LIMB_PAIR(0x6345B7F1, 0x4D22350E), LIMB_PAIR(0x9D0C2BF4, 0x28341DE9), LIMB_PARTIAL(0x1D8),
+            LIMB_PAIR(0xF30E2472, 0x70F6A7CB), LIMB_PAIR(0x1C7EDB49, 0xABADEB7B), LIMB_PAIR(0x66CFBC6A, 0x8A985664), LIMB_PAIR(0x1C912BD7, 0x27B7657B),
+            LIMB_PAIR(0x2E9820A8, 0x91BBDE9D), LIMB_PAIR(0x1B43A2BE, 0xBD6CBBC1), LIMB_PAIR(0xD68FF203, 0xC9865101), LIMB_PAIR(0xE1A9E48B, 0xDB44C847), LIMB_PARTIAL(0x0BD)
+        },
+        {   // 6 * 16^66 * G
+            LIMB_PAIR(0x27936D20, 0x9FE25BDE), LIMB_PAIR(0xD5EC1DA6, 0x22BA274B), LIMB_PAIR(0x9DDA8A8C, 0xE090415A), LIMB_PAIR(0xC3615980, 0x89338C0E),
+            LIMB_PAIR(0xAA3C8BE1, 0x7A275EBB), LIMB_PAIR(0xF1CAA495, 0xD8136F52), LIMB_PAIR(0x3F023B63, 0x56FA754F), LIMB_PAIR(0xA3EB201B, 0xB24E8E69), LIMB_PARTIAL(0x16C),
+            LIMB_PAIR(0x7A76334E, 0xC95381D4), LIMB_PAIR(0xBEBDBE06, 0x3AD694D1), LIMB_PAIR(0x992792BC, 0xC5B98168), LIMB_PAIR(0x06450667, 0x1F8F7C0F),
+            LIMB_PAIR(0x972A25D5, 0xC26A086F), LIMB_PAIR(0xCB841FD3, 0xE0D18B92), LIMB_PAIR(0xA62ED510, 0xE14A82C5), LIMB_PAIR(0x07A009D0, 0x87992412), LIMB_PARTIAL(0x17C)
+        },
+        {   // 7 * 16^66 * G
+            LIMB_PAIR(0x3004860A, 0x8B24FFB5), LIMB_PAIR(0x54D544F4, 0xD400D906), LIMB_PAIR(0xEAF7C7FD, 0x6B33DE80), LIMB_PAIR(0x80B37417, 0x830FDFEE),
+            LIMB_PAIR(0xEC3016F3, 0xC465549D), LIMB_PAIR(0x731EAB5F, 0x5E944E56), LIMB_PAIR(0x98BBB88D, 0xBD4E24E3), LIMB_PAIR(0xEE3CC23A, 0x0EC84651), LIMB_PARTIAL(0x017),
+            LIMB_PAIR(0x41F46949, 0x1EC4CC3F), LIMB_PAIR(0xD1F65059, 0x689A004B), LIMB_PAIR(0x613B2A84, 0x198E7CEE), LIMB_PAIR(0xD6CABCE4, 0x35A07118),
+            LIMB_PAIR(0xF0BE8230, 0xBD2F4B6B), LIMB_PAIR(0x744E78BF, 0x6DD42C2E), LIMB_PAIR(0x024D8140, 0x8EF14CB4), LIMB_PAIR(0x3126010B, 0x60769521), LIMB_PARTIAL(0x016)
+        },
+        {   // 8 * 16^66 * G
+            LIMB_PAIR(0x48E075E3, 0x38EE58F0), LIMB_PAIR(0x18D38B67, 0xF285797E), LIMB_PAIR(0xA120348D, 0x02E97C63), LIMB_PAIR(0x17BFF13C, 0xC64DEFA7),
+            LIMB_PAIR(0x7F983D56, 0x0FD5B723), LIMB_PAIR(0x30D1770F, 0x70ACC4A8), LIMB_PAIR(0x49151740, 0x0F0EC2D7), LIMB_PAIR(0x2968C0DB, 0xE99F0A61), LIMB_PARTIAL(0x174),
+            LIMB_PAIR(0x67AA8AD3, 0x4A5D683A), LIMB_PAIR(0x56C69E37, 0xFA3A36CC), LIMB_PAIR(0xDF8A093B, 0xA392130E), LIMB_PAIR(0xC840B37C, 0xE80D7527),
+            LIMB_PAIR(0x6AB73B96, 0xA28EB492), LIMB_PAIR(0xC7D4304C, 0xEECE0912), LIMB_PAIR(0x30B9DD79, 0x0B900A11), LIMB_PAIR(0xA20C5D55, 0x43D757E3), LIMB_PARTIAL(0x18A)
+        }
+    },
+#endif
+#if (67 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^67 * G
+            LIMB_PAIR(0x85EDC827, 0x56F74E69), LIMB_PAIR(0x6A731640, 0xAFE2EF0A), LIMB_PAIR(0xD51647D7, 0x61F8BCFD), LIMB_PAIR(0x41E33FA7, 0xBEABBB8F),
+            LIMB_PAIR(0xEC83C547, 0x3E4C3AAE), LIMB_PAIR(0x2CC8DD97, 0x48A9D1E9), LIMB_PAIR(0xE57D3822, 0x7B4D53B5), LIMB_PAIR(0xA45C0584, 0x92387AC8), LIMB_PARTIAL(0x0D5),
+            LIMB_PAIR(0xFACDB1CB, 0x802ECE3D), LIMB_PAIR(0x9E537236, 0x9E4F5D20), LIMB_PAIR(0x386A5610, 0xD10ACC25), LIMB_PAIR(0x4C6C0247, 0x53F55D46),
+            LIMB_PAIR(0x8C419FA4, 0x390FE980), LIMB_PAIR(0xBED2BD92, 0x8B0A8AA6), LIMB_PAIR(0xF854424F, 0x90E7F479), LIMB_PAIR(0x9E7F4392, 0xD714BFB5), LIMB_PARTIAL(0x074)
+        },
+        {   // 2 * 16^67 * G
+            LIMB_PAIR(0xE7C8E1A2, 0x9ABF4318), LIMB_PAIR(0x5EF038D0, 0x89FD5C8D), LIMB_PAIR(0x755BE1D6, 0x20641C7C), LIMB_PAIR(0x38B2C08C, 0xFFF489FB),
+            LIMB_PAIR(0xB3B3A7B1, 0x792104E1), LIMB_PAIR(0xC507E7D7, 0xD8A69114), LIMB_PAIR(0xC1AC93F9, 0x4C07F5BA), LIMB_PAIR(0x315C3A89, 0x0A2E3D13), LIMB_PARTIAL(0x12C),
+            LIMB_PAIR(0xD523D79C, 0x016026BE), LIMB_PAIR(0x00EE5640, 0xD4E3D86F), LIMB_PAIR(0xA8E8F5CF, 0x07627A1C), LIMB_PAIR(0x533AFEDE, 0xC07C67F8),
+            LIMB_PAIR(0xD3BED1AC, 0x081A516D), LIMB_PAIR(0x86E8FF0C, 0xDDC6F440), LIMB_PAIR(0xC112D075, 0x4DF71BC8), LIMB_PAIR(0x7CC49D32, 0x2B8CC08F), LIMB_PARTIAL(0x1D0)
+        },
+        {   // 3 * 16^67 * G
+            LIMB_PAIR(0xEDFCBEDE, 0x74AF3F63), LIMB_PAIR(0x1356F827, 0x6B0830B1), LIMB_PAIR(0x02536F8A, 0x060DB15A), LIMB_PAIR(0xF7095358, 0x166F9099),
+            LIMB_PAIR(0xE03B9601, 0xD759EFB4), LIMB_PAIR(0x68484F67, 0x05A4E297), LIMB_PAIR(0xDC631A7A, 0x469B4832), LIMB_PAIR(0x0BB2B1B6, 0x7C540615), LIMB_PARTIAL(0x1B2),
+            LIMB_PAIR(0x12481C04, 0x590174E0), LIMB_PAIR(0xD7180A84, 0x8D4EF6C7), LIMB_PAIR(0x303674DD, 0xD134B543), LIMB_PAIR(0x00C378B0, 0x60DBF726),
+            LIMB_PAIR(0x93D8406C, 0xC60E026A), LIMB_PAIR(0x082C527C, 0x57AF4A82), LIMB_PAIR(0x349A607F, 0xE3D038FE), LIMB_PAIR(0x5A3582E5, 0xA7CB9B47), LIMB_PARTIAL(0x0C6)
+        },
+        {   // 4 * 16^67 * G
+            LIMB_PAIR(0xF1C86157, 0x69017ED5), LIMB_PAIR(0x3AABCCA4, 0x8AD717EB), LIMB_PAIR(0xE57AC297, 0xE14DD980), LIMB_PAIR(0x931E307B, 0xC2F0DA4B),
+            LIMB_PAIR(0x9080B37D, 0xDE7FD579), LIMB_PAIR(0x14134DE4, 0x45BF6F64), LIMB_PAIR(0xAC019CF3, 0x5CDE0727), LIMB_PAIR(0x863E739E, 0xB4E5C2E7), LIMB_PARTIAL(0x0E6),
+            LIMB_PAIR(0x28E15F36, 0x094E0856), LIMB_PAIR(0x46276090, 0xF92C44FB), LIMB_PAIR(0x21CB21CC, 0x92199985), LIMB_PAIR(0xDE53957D, 0xCEDCD4F2),
+            LIMB_PAIR(0xB6C417EB, 0x802C6F95), LIMB_PAIR(0x6075E71D, 0x0EA41A2B), LIMB_PAIR(0xB9EEC681, 0x194D6FB1), LIMB_PAIR(0x2E0320D8, 0x8E7CD41F), LIMB_PARTIAL(0x1CA)
+        },
+        {   // 5 * 16^67 * G
+            LIMB_PAIR(0x1FE423C0, 0x5466A990), LIMB_PAIR(0xA57E7875, 0x59F6A48B), LIMB_PAIR(0xCB7BD46A, 0x09A9F84A), LIMB_PAIR(0x69E02DF0, 0xB5AE0D94),
+            LIMB_PAIR(0xD9FEC11C, 0xAECC3392), LIMB_PAIR(0xA4BCD130, 0xC94DE920), LIMB_PAIR(0x82C78F1B, 0xFB5B36F8), LIMB_PAIR(0x2D4FC970, 0x32AD1CF2), LIMB_PARTIAL(0x1FB),
+            LIMB_PAIR(0xDF0A2534, 0x8CD894D5), LIMB_PAIR(0x9735FC04, 0xCB83665C), LIMB_PAIR(0x35169F6F, 0xCBD91576), LIMB_PAIR(0x2775C9D4, 0x2F3B64A7),
+            LIMB_PAIR(0xDD6410D3, 0x80C9608F), LIMB_PAIR(0xBCAD20D5, 0x6503BADC), LIMB_PAIR(0x1B2B1640, 0xBDB30857), LIMB_PAIR(0x78FBC82A, 0x92338C78), LIMB_PARTIAL(0x0D6)
+        },
+        {   // 6 * 16^67 * G
+            LIMB_PAIR(0xEE05CAE4, 0x3F99E9B3), LIMB_PAIR(0x7FA0E686, 0x32CC7110), LIMB_PAIR(0x1EF8A5C1, 0xFEFE300A), LIMB_PAIR(0x86846634, 0x232D446E),
+            LIMB_PAIR(0x1CE3E75D, 0x250F4E80), LIMB_PAIR(0x36BAE498, 0xCA3146F2), LIMB_PAIR(0x9339513F, 0x41B28B52), LIMB_PAIR(0x623CACB0, 0xF05D31B6), LIMB_PARTIAL(0x066),
+            LIMB_PAIR(0x682F53C8, 0x12B4C656), LIMB_PAIR(0xF72ED178, 0xC865FA0E), LIMB_PAIR(0x55F68DBB, 0x7D41FFBC), LIMB_PAIR(0xC0AC64AA, 0xE4AA53B7),
+            LIMB_PAIR(0xB7194380, 0x66E397BB), LIMB_PAIR(0x834331F9, 0xBA629DB6), LIMB_PAIR(0xEA0C0083, 0x6D14E879), LIMB_PAIR(0x039343FC, 0xDF2E7EB0), LIMB_PARTIAL(0x0D6)
+        },
+        {   // 7 * 16^67 * G
+            LIMB_PAIR(0xE8A300EC, 0x3EE61D53), LIMB_PAIR(0xE0CD8617, 0x65E529C7), LIMB_PAIR(0x077B303B, 0xB8C03CB0), LIMB_PAIR(0xD5C88DD2, 0x05EBA936),
+            LIMB_PAIR(0xD42BB4AF, 0xC1E54497), LIMB_PAIR(0xB0589057, 0xAB477AAF), LIMB_PAIR(0xE8F70A56, 0x55ACDDC8), LIMB_PAIR(0x4FC80182, 0x6579B78B), LIMB_PARTIAL(0x164),
+            LIMB_PAIR(0xBC97C72E, 0x535E7FF0), LIMB_PAIR(0x809DC093, 0x65E954C9), LIMB_PAIR(0xCD182EE3, 0x49EDC4B8), LIMB_PAIR(0x877D38AD, 0x804874F9),
+            LIMB_PAIR(0x6DF1638D, 0x20104AB1), LIMB_PAIR(0x748EE6F2, 0x78459A4B), LIMB_PAIR(0x3504AA35, 0xB895205D), LIMB_PAIR(0xF8089E32, 0xBF26AC8A), LIMB_PARTIAL(0x041)
+        },
+        {   // 8 * 16^67 * G
+            LIMB_PAIR(0x61E5AA9E, 0x3DFF8580), LIMB_PAIR(0x955100C9, 0xA33AEF70), LIMB_PAIR(0x56AB4275, 0x7A52DA39), LIMB_PAIR(0x102C4123, 0xEFE16518),
+            LIMB_PAIR(0x8D2E4D91, 0x8FAEB018), LIMB_PAIR(0x81719F70, 0x35162430), LIMB_PAIR(0xFA78398B, 0x4EF1FB91), LIMB_PAIR(0xC351721C, 0x95EB0D18), LIMB_PARTIAL(0x0DF),
+            LIMB_PAIR(0xE5F04C88, 0x90C4D877), LIMB_PAIR(0xBF176E9F, 0xE108471A), LIMB_PAIR(0x0EF8E8FB, 0x8EFD4275), LIMB_PAIR(0x3B26BA83, 0xADB1FC8E),
+            LIMB_PAIR(0x19BCB6AA, 0x35050FD3), LIMB_PAIR(0x1E9A804F, 0x00A7180D), LIMB_PAIR(0x60B511C8, 0x23AE97B6), LIMB_PAIR(0x403CEF81, 0x07D0BE62), LIMB_PARTIAL(0x1B3)
+        }
+    },
+#endif
+#if (68 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^68 * G
+            LIMB_PAIR(0xCECDF0DC, 0x0E13C1DD), LIMB_PAIR(0xEEB9AA6C, 0xACD530B6), LIMB_PAIR(0x0AF8D3A8, 0xBE3C0FC8), LIMB_PAIR(0xCE44AE8B, 0xEE67F380),
+            LIMB_PAIR(0x3854B528, 0x9ADC5636), LIMB_PAIR(0x130F4497, 0x527F7F90), LIMB_PAIR(0xE80C35CE, 0xEE085713), LIMB_PAIR(0x190FAE23, 0x29BC4B3E), LIMB_PARTIAL(0x064),
+            LIMB_PAIR(0xDBB3838A, 0x17EA6FB5), LIMB_PAIR(0xB425AF89, 0x192ECA92), LIMB_PAIR(0x85A94659, 0x5FD3BFCF), LIMB_PAIR(0xDAA4B4CC, 0x8D75B3F5),
+            LIMB_PAIR(0x9BEE144F, 0xBACC18B8), LIMB_PAIR(0xFF60EC49, 0x57591774), LIMB_PAIR(0x2363AC43, 0x319CBA95), LIMB_PAIR(0x472EE36C, 0x6C0D079E), LIMB_PARTIAL(0x0F0)
+        },
+        {   // 2 * 16^68 * G
+            LIMB_PAIR(0x7333EEA3, 0x28CD16CE), LIMB_PAIR(0x845655FC, 0x601AB611), LIMB_PAIR(0x57ED4BF8, 0xF18179D9), LIMB_PAIR(0x172167C2, 0xA704B004),
+            LIMB_PAIR(0x82E3FCF3, 0xE22EC703), LIMB_PAIR(0xE64C4745, 0x4CD9BD0D), LIMB_PAIR(0xEC9737E7, 0xD1EB58DF), LIMB_PAIR(0xE6658AAC, 0x540C29E8), LIMB_PARTIAL(0x124),
+            LIMB_PAIR(0x4B18BB58, 0x4F35D47D), LIMB_PAIR(0xD4BE21BC, 0x3EE2A66A), LIMB_PAIR(0x052B60FD, 0x9D3D69A1), LIMB_PAIR(0x8F07EB0D, 0x556347EF),
+            LIMB_PAIR(0x165AF89B, 0x66014006), LIMB_PAIR(0x31E62CC0, 0x808EB843), LIMB_PAIR(0x309553A1, 0xFD119574), LIMB_PAIR(0x7656234D, 0x4945B9CD), LIMB_PARTIAL(0x060)
+        },
+        {   // 3 * 16^68 * G
+            LIMB_PAIR(0xA5D3A5D9, 0x580EC898), LIMB_PAIR(0x9B2E3634, 0x0E28A410), LIMB_PAIR(0x01745208, 0x102192B6), LIMB_PAIR(0xF59C2C84, 0x4D825DC6),
+            LIMB_PAIR(0x7668CB0E, 0xD2B9B7F6), LIMB_PAIR(0x71E242ED, 0xF05D43BB), LIMB_PAIR(0x4CCA8CB4, 0x23F73DC2), LIMB_PAIR(0xC7CB313D, 0x7234064E), LIMB_PARTIAL(0x0E9),
+            LIMB_PAIR(0x3A3635BC, 0xF4B4B560), LIMB_PAIR(0xD9802D9B, 0xFEC87A30), LIMB_PAIR(0x3E418320, 0x9C4D252A), LIMB_PAIR(0x2EB17033, 0xC8C7B693),
+            LIMB_PAIR(0x2E742B43, 0xC0AA375C), LIMB_PAIR(0xC02C9434, 0xB69BD932), LIMB_PAIR(0xB6A13B4F, 0x9D910EB8), LIMB_PAIR(0xE6C4A9B3, 0x5B554917), LIMB_PARTIAL(0x030)
+        },
+        {   // 4 * 16^68 * G
+            LIMB_PAIR(0xB30C227F, 0x05BFABAD), LIMB_PAIR(0x9CA0D9F2, 0x163A0112), LIMB_PAIR(0x4A448FFA, 0x448F630B), LIMB_PAIR(0xF52D44F0, 0x7A304FDC),
+            LIMB_PAIR(0xF50356E7, 0x4CEB9902), LIMB_PAIR(0xC43B436B, 0xE7615AB1), LIMB_PAIR(0xD63F192D, 0x9FD56374), LIMB_PAIR(0x418BD616, 0x38470C8F), LIMB_PARTIAL(0x0D1),
+            LIMB_PAIR(0x9554D529, 0x4B42C145), LIMB_PAIR(0x2BFE7BC9, 0x5556CF8B), LIMB_PAIR(0x94EB909C, 0xE28B6F89), LIMB_PAIR(0x637DCAAB, 0xC00748EE),
+            LIMB_PAIR(0xFC076BF8, 0xF71E0FCF), LIMB_PAIR(0xB580D617, 0x57642F92), LIMB_PAIR(0x1D91F20C, 0x755FDF2E), LIMB_PAIR(0xDD5AB14E, 0x9C3C9C86), LIMB_PARTIAL(0x187)
+        },
+        {   // 5 * 16^68 * G
+            LIMB_PAIR(0xC9C4F27A, 0x36E215CD), LIMB_PAIR(0x651A2560, 0xC5D2E709), LIMB_PAIR(0xEF794A32, 0xD4A5BD4F), LIMB_PAIR(0xAA33F31C, 0xB1771BA6),
+            LIMB_PAIR(0x057DA3E5, 0xF4C791A4), LIMB_PAIR(0x90EC819A, 0x3547E13D), LIMB_PAIR(0xD10059E2, 0x2E6971EF), LIMB_PAIR(0x7804F13A, 0xF19C250C), LIMB_PARTIAL(0x048),
+            LIMB_PAIR(0x113453AA, 0x968A695D), LIMB_PAIR(0x0CC6EE85, 0xB904A5B5), LIMB_PAIR(0xABDC4582, 0x272F50FE), LIMB_PAIR(0x556B5A9F, 0x7B14D09C),
+            LIMB_PAIR(0xC7FE5D92, 0x2ED5EF74), LIMB_PAIR(0xFCD4A5C5, 0x3C32A9E1), LIMB_PAIR(0xDFFFF064, 0xAC5F1B7B), LIMB_PAIR(0x67BA52AE, 0xA28FA361), LIMB_PARTIAL(0x056)
+        },
+        {   // 6 * 16^68 * G
+            LIMB_PAIR(0x87950112, 0x8DFA4473), LIMB_PAIR(0xE8D5C1AA, 0xD032940A), LIMB_PAIR(0x3379771D, 0xEB909E67), LIMB_PAIR(0xA336A4F3, 0xE780D40D),
+            LIMB_PAIR(0xCE022106, 0x318E1A69), LIMB_PAIR(0x8702E3C8, 0x36B6B174), LIMB_PAIR(0xF8E60CED, 0x327E8DB4), LIMB_PAIR(0x8380C97E, 0x9C1A790B), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0xC6534A9A, 0x8EEC3CAA), LIMB_PAIR(0x56CFDCF4, 0x650FA0D5), LIMB_PAIR(0x58C3798C, 0xFE45E2CE), LIMB_PAIR(0xA60E6872, 0x320FAC25),
+            LIMB_PAIR(0xEF983104, 0xB399EC98), LIMB_PAIR(0xBE57C16E, 0x133C9F01), LIMB_PAIR(0x3B73B0A7, 0x9736E754), LIMB_PAIR(0xB48F9618, 0x12C0CE90), LIMB_PARTIAL(0x155)
+        },
+        {   // 7 * 16^68 * G
+            LIMB_PAIR(0x6F0C982D, 0x32187B6A), LIMB_PAIR(0x2106BDC5, 0x811425B3), LIMB_PAIR(0x878BF63A, 0xF2636CA0), LIMB_PAIR(0x3C1696BF, 0xA42B1436),
+            LIMB_PAIR(0x53EE54C8, 0x0BB71458), LIMB_PAIR(0x37C638B3, 0x2C43B3AC), LIMB_PAIR(0xF4464091, 0x9A404C2E), LIMB_PAIR(0x7509002E, 0x7CDB0CD2), LIMB_PARTIAL(0x1FE),
+            LIMB_PAIR(0xEA37A696, 0xD333DB10), LIMB_PAIR(0xD5914E15, 0xAC1F2FE8), LIMB_PAIR(0x522FCB80, 0x91744924), LIMB_PAIR(0x17E64A4B, 0x186A0551),
+            LIMB_PAIR(0x174E2689, 0x51DCD48B), LIMB_PAIR(0x0F429C85, 0x84AE67EC), LIMB_PAIR(0xBA520A90, 0xACD5C1C5), LIMB_PAIR(0x20138359, 0x30654522), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 8 * 16^68 * G
+            LIMB_PAIR(0xA7C8FC21, 0x2FF940BF), LIMB_PAIR(0xA6A86C6B, 0x9B3CBEEE), LIMB_PAIR(0x171573A2, 0x5CD96C7D), LIMB_PAIR(0x12CB3013, 0x49BB08E8),
+            LIMB_PAIR(0x34B92D91, 0xDDBA493E), LIMB_PAIR(0xEF35E196, 0xA56F49A5), LIMB_PAIR(0x2CDCA6C3, 0x7A454C1C), LIMB_PAIR(0x684D25FC, 0xB9C038AE), LIMB_PARTIAL(0x1B7),
+            LIMB_PAIR(0xAF46C7EE, 0x15ADC72D), LIMB_PAIR(0x5EAF9891, 0x21450DB2), LIMB_PAIR(0x53A32B0A, 0x115517E1), LIMB_PAIR(0xE26D8171, 0x5BD9D862),
+            LIMB_PAIR(0x3F8E37E8, 0x991737BF), LIMB_PAIR(0x531A836D, 0xCBB33580), LIMB_PAIR(0x3D976493, 0x96AFF021), LIMB_PAIR(0xCA69B662, 0x9BE26568), LIMB_PARTIAL(0x0BE)
+        }
+    },
+#endif
+#if (69 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^69 * G
+            LIMB_PAIR(0x07207165, 0x51DB2D9D), LIMB_PAIR(0xC3D4C59C, 0xC7D56A41), LIMB_PAIR(0x4E278B0E, 0xA47FADDA), LIMB_PAIR(0x04FFC588, 0x5C3964E2),
+            LIMB_PAIR(0x9719ECFD, 0x52BC9F38), LIMB_PAIR(0x35A04049, 0x2C9292C0), LIMB_PAIR(0xFAE7580E, 0x885FF9BA), LIMB_PAIR(0xD5CC866E, 0x2319A2DC), LIMB_PARTIAL(0x15C),
+            LIMB_PAIR(0x0AE9AF6E, 0x8B77DDB7), LIMB_PAIR(0xDD7FD36C, 0x0E21B050), LIMB_PAIR(0xDC8B9C19, 0x35D968EC), LIMB_PAIR(0xA624AD4F, 0x6F3F0785),
+            LIMB_PAIR(0x1D42C97E, 0x97778A68), LIMB_PAIR(0xA2A4342C, 0x86103BF0), LIMB_PAIR(0x3ABABC35, 0x0AEF36FD), LIMB_PAIR(0x2FE10364, 0x46C8FB21), LIMB_PARTIAL(0x1E1)
+        },
+        {   // 2 * 16^69 * G
+            LIMB_PAIR(0x462E6862, 0x2FE08A10), LIMB_PAIR(0x35CA4ECE, 0xA86DB08F), LIMB_PAIR(0x5960B9C7, 0x4AF069A0), LIMB_PAIR(0x4C7FBBE4, 0x9F008601),
+            LIMB_PAIR(0x59BCD54F, 0xFE91AAAB), LIMB_PAIR(0x67A1BC8A, 0xBB6CD664), LIMB_PAIR(0x54AB69BC, 0xF3B35903), LIMB_PAIR(0xFF914C06, 0x2D5B1227), LIMB_PARTIAL(0x0F9),
+            LIMB_PAIR(0xF7D5AC27, 0x22226588), LIMB_PAIR(0xD14893E4, 0x5BF4D921), LIMB_PAIR(0xC384F172, 0xA0A5C850), LIMB_PAIR(0x4351441C, 0xC5DEFF76),
+            LIMB_PAIR(0x539D45BA, 0x9CBA07B4), LIMB_PAIR(0x0A80AE0D, 0x32434562), LIMB_PAIR(0xBB44F664, 0x0E144257), LIMB_PAIR(0x63DA2750, 0x1C5C19C1), LIMB_PARTIAL(0x1A4)
+        },
+        {   // 3 * 16^69 * G
+            LIMB_PAIR(0xF1EBE533, 0x604B730E), LIMB_PAIR(0x0B4B9191, 0x336E362E), LIMB_PAIR(0xB711E872, 0x246E5C1A), LIMB_PAIR(0xF46E3F97, 0x652DC2C1),
+            LIMB_PAIR(0x1398E328, 0xC3492E15), LIMB_PAIR(0x475CD2BF, 0xD85F2669), LIMB_PAIR(0xA3C972BB, 0xB4B28424), LIMB_PAIR(0x49A9AC4E, 0xF3D57116), LIMB_PARTIAL(0x148),
+            LIMB_PAIR(0x25E365FE, 0x2A5E5F54), LIMB_PAIR(0x6ABD415A, 0x9202DDFF), LIMB_PAIR(0xCB24F45A, 0x314E872A), LIMB_PAIR(0xB7BCC7D1, 0xCED1DCD9),
+            LIMB_PAIR(0x0377CE8F, 0x0D39CF24), LIMB_PAIR(0xD1065414, 0x75EB96C9), LIMB_PAIR(0x9FE0EE9A, 0x984B4A45), LIMB_PAIR(0x04703AB1, 0x82376167), LIMB_PARTIAL(0x11F)
+        },
+        {   // 4 * 16^69 * G
+            LIMB_PAIR(0x73435EB6, 0x2347E383), LIMB_PAIR(0x58EA9F89, 0x75563E78), LIMB_PAIR(0xEFA62CB9, 0x20CCB854), LIMB_PAIR(0x1CC86C06, 0xDAC97AEC),
+            LIMB_PAIR(0xF432D1B4, 0xBE99C357), LIMB_PAIR(0x1C2E03F6, 0xCD89DA56), LIMB_PAIR(0xA789AF68, 0x7E424AFD), LIMB_PAIR(0x401F225D, 0xC386D1BF), LIMB_PARTIAL(0x09F),
+            LIMB_PAIR(0xA1A12CA1, 0x46F9BDBB), LIMB_PAIR(0xA6469919, 0x489BDF59), LIMB_PAIR(0x3974BF6E, 0x94AD85A7), LIMB_PAIR(0xC9FDE759, 0xA7FE1C85),
+            LIMB_PAIR(0x72B3C209, 0xA26931A0), LIMB_PAIR(0x3DB247CC, 0xBD5B5620), LIMB_PAIR(0x1085C481, 0x9ECB8A74), LIMB_PAIR(0xEA48E281, 0x9134BBD1), LIMB_PARTIAL(0x1DB)
+        },
+        {   // 5 * 16^69 * G
+            LIMB_PAIR(0x6BB2C3B8, 0xAD4F1881), LIMB_PAIR(0xD380CA18, 0xD45F9A0C), LIMB_PAIR(0xACA25641, 0xFB839DAF), LIMB_PAIR(0x7E519019, 0xB89884F2),
+            LIMB_PAIR(0x58CD6C25, 0xDE295E54), LIMB_PAIR(0x25A1E8CB, 0x1BC5070E), LIMB_PAIR(0x47C21E93, 0x66F16357), LIMB_PAIR(0xA4BDDFA8, 0x379E8F32), LIMB_PARTIAL(0x108),
+            LIMB_PAIR(0x87CC4A52, 0x9141EA4E), LIMB_PAIR(0x72CFF2EB, 0x285CBAF9), LIMB_PAIR(0xF492BE77, 0x27898F4D), LIMB_PAIR(0x223C8859, 0xD49D035F),
+            LIMB_PAIR(0x726065CB, 0x763866C2), LIMB_PAIR(0xB2EB9E8A, 0x0886E8D5), LIMB_PAIR(0x1F70BF7B, 0x7DEB06B3), LIMB_PAIR(0x889D3E33, 0x8CE6BCB7), LIMB_PARTIAL(0x060)
+        },
+        {   // 6 * 16^69 * G
+            LIMB_PAIR(0x78BB30F6, 0x0A65FEBA), LIMB_PAIR(0x50EABF36, 0x0235D91A), LIMB_PAIR(0xCD2D934D, 0x0B8EC4A4), LIMB_PAIR(0x8DFCCE34, 0xA122F10B),
+            LIMB_PAIR(0x9B2E6536, 0xC3C86B63), LIMB_PAIR(0x84962539, 0xB8002FAC), LIMB_PAIR(0xF6D36BA4, 0xA6893CFB), LIMB_PAIR(0xDCCB7F1F, 0x280E9D60), LIMB_PARTIAL(0x072),
+            LIMB_PAIR(0x279551B6, 0xCBB4609E), LIMB_PAIR(0x4B03A718, 0xC6E89388), LIMB_PAIR(0x744DC7E2, 0xDF62F063), LIMB_PAIR(0x4146EA10, 0x1799EA3E),
+            LIMB_PAIR(0x9ECD77CE, 0x73D8CEF2), LIMB_PAIR(0xB2229D1F, 0x2B87C10E), LIMB_PAIR(0xCABFDF74, 0xE9D08175), LIMB_PAIR(0x3F0D60C4, 0xED1D16A8), LIMB_PARTIAL(0x0EC)
+        },
+        {   // 7 * 16^69 * G
+            LIMB_PAIR(0x7514E752, 0xC466FD7B), LIMB_PAIR(0x8E1FD662, 0xC0C9A0AF), LIMB_PAIR(0x7F3083FC, 0xD4B0AE39), LIMB_PAIR(0x24CB5771, 0x9AF1C21F),
+            LIMB_PAIR(0x469DCD1E, 0x8C20329D), LIMB_PAIR(0x6579990D, 0xB115FDD2), LIMB_PAIR(0x3160B749, 0xCCD93D2A), LIMB_PAIR(0x96F8FE36, 0x4AA17BB9), LIMB_PARTIAL(0x04E),
+            LIMB_PAIR(0x4118EBF1, 0xEA95C80A), LIMB_PAIR(0xE78B533B, 0x267CE3A6), LIMB_PAIR(0x152EE4F3, 0x54167EB7), LIMB_PAIR(0xD6D5B4C9, 0xDA581B52),
+            LIMB_PAIR(0x4F9408C6, 0x285DDAA4), LIMB_PAIR(0x1FF6C988, 0xA1E4D6DC), LIMB_PAIR(0x7540A223, 0x9D146407), LIMB_PAIR(0xF46C92D9, 0x127967A3), LIMB_PARTIAL(0x0FF)
+        },
+        {   // 8 * 16^69 * G
+            LIMB_PAIR(0x2A22B97F, 0xCCA33DB4), LIMB_PAIR(0x1942F8F7, 0x808D2E98), LIMB_PAIR(0x37133C3C, 0xD972D1A7), LIMB_PAIR(0x5FF8D7AA, 0xFE4B5F5F),
+            LIMB_PAIR(0x9175512E, 0x8BD08C18), LIMB_PAIR(0xBB95CE67, 0x67BAD971), LIMB_PAIR(0x9CF69B1B, 0x885DE1D4), LIMB_PAIR(0x54BA8E61, 0x00D0EBBE), LIMB_PARTIAL(0x111),
+            LIMB_PAIR(0x6C90B677, 0x50AEEC38), LIMB_PAIR(0x3DF368C1, 0xC765C475), LIMB_PAIR(0x5D423382, 0x3865A739), LIMB_PAIR(0x7E55F0D3, 0x5F843ADF),
+            LIMB_PAIR(0xE6159793, 0xA8C20B65), LIMB_PAIR(0x05C2F2B9, 0xBC3D7A4F), LIMB_PAIR(0x7A052D8B, 0xB6663D29), LIMB_PAIR(0x65A7EA81, 0x50CDB83A), LIMB_PARTIAL(0x17B)
+        }
+    },
+#endif
+#if (70 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^70 * G
+            LIMB_PAIR(0x0AC4CB66, 0x4C740AE1), LIMB_PAIR(0x59C635FF, 0xC8A66D97), LIMB_PAIR(0x2569DAC8, 0x328B65AF), LIMB_PAIR(0x8838DBC9, 0xFDB6599B),
+            LIMB_PAIR(0x7FD83C9F, 0x702473F8), LIMB_PAIR(0x128683F6, 0x0D1F2AD8), LIMB_PAIR(0x5030B76B, 0x00AE5B50), LIMB_PAIR(0x6D15B5ED, 0xB1375D70), LIMB_PARTIAL(0x159),
+            LIMB_PAIR(0x1F1E1F7F, 0x7A772A90), LIMB_PAIR(0xC669AA61, 0xA790DCB7), LIMB_PAIR(0xC5E4F185, 0xDAD905AE), LIMB_PAIR(0x116AD6CE, 0x3BD91C29),
+            LIMB_PAIR(0xC329D8A7, 0xF87C96EA), LIMB_PAIR(0xB5B14581, 0x399C929C), LIMB_PAIR(0x3A8253C0, 0x6FD2983C), LIMB_PAIR(0xDA988B39, 0x616A8B61), LIMB_PARTIAL(0x181)
+        },
+        {   // 2 * 16^70 * G
+            LIMB_PAIR(0xAE0E245D, 0x0D6E6EED), LIMB_PAIR(0x26F68799, 0x5C37E80F), LIMB_PAIR(0x2AEEB588, 0x57562614), LIMB_PAIR(0xDE82ABC1, 0x9261CB14),
+            LIMB_PAIR(0xEBEEB914, 0xA4B446F5), LIMB_PAIR(0xFFB71DC9, 0xE8B749EF), LIMB_PAIR(0x1FCF5E8E, 0x3E138239), LIMB_PAIR(0x15C8CFB4, 0xCBDC4C53), LIMB_PARTIAL(0x185),
+            LIMB_PAIR(0xA80326B1, 0xE8ACD37D), LIMB_PAIR(0x6FFC9AE9, 0x4AA2D80F), LIMB_PAIR(0xDB069E01, 0x46DA631F), LIMB_PAIR(0xE7ABE06B, 0x1463768D),
+            LIMB_PAIR(0xC3BE779F, 0x932E528D), LIMB_PAIR(0x494FD10D, 0x756BC3DE), LIMB_PAIR(0x0B0C9870, 0x4A181A65), LIMB_PAIR(0xAE34B70B, 0x0CEAE429), LIMB_PARTIAL(0x0AE)
+        },
+        {   // 3 * 16^70 * G
+            LIMB_PAIR(0x524BC705, 0x3A070E58), LIMB_PAIR(0xFBD0358F, 0x86404F01), LIMB_PAIR(0x74567144, 0x88456D78), LIMB_PAIR(0x4CB2BF46, 0x91AABC49),
+            LIMB_PAIR(0xB1E29372, 0x829DF4FD), LIMB_PAIR(0x230CF9F5, 0xF177CE20), LIMB_PAIR(0x7A3D29CA, 0x404ECA03), LIMB_PAIR(0x231007DF, 0x6D9B609A), LIMB_PARTIAL(0x159),
+            LIMB_PAIR(0xB1BF4593, 0x7FF3369E), LIMB_PAIR(0x5E4049A7, 0x94FF624F), LIMB_PAIR(0x34194BC1, 0x5B7EF741), LIMB_PAIR(0x131B06F0, 0xF4BAC202),
+            LIMB_PAIR(0xB7549633, 0x70A46357), LIMB_PAIR(0x761AE1BB, 0x0B293380), LIMB_PAIR(0x974C1977, 0xB2D9C64D), LIMB_PAIR(0x00E7751A, 0xE27E23B4), LIMB_PARTIAL(0x1DC)
+        },
+        {   // 4 * 16^70 * G
+            LIMB_PAIR(0xFAADEF15, 0xE15EF16C), LIMB_PAIR(0xBABE010B, 0x0F2927A1), LIMB_PAIR(0xCEFDEDA3, 0x252539DB), LIMB_PAIR(0xA98613A8, 0x1E8FF8C4),
+            LIMB_PAIR(0xF76D425F, 0xEC7026D9), LIMB_PAIR(0xAC386095, 0x507C1214), LIMB_PAIR(0xC8024EE0, 0xFBA6C762), LIMB_PAIR(0x3F4DD18E, 0x1088460C), LIMB_PARTIAL(0x1B0),
+            LIMB_PAIR(0x202080CB, 0x6CCF1452), LIMB_PAIR(0xB645D8E0, 0x33B934D5), LIMB_PAIR(0xC0FD54B2, 0xEBD4D772), LIMB_PAIR(0x207E1DFE, 0x62A8045E),
+            LIMB_PAIR(0x601B9F43, 0x9E5D3B88), LIMB_PAIR(0x77E357FB, 0xC8F7E47D), LIMB_PAIR(0x8EC21437, 0x1C876477), LIMB_PAIR(0x069DD1C9, 0xC08C5A27), LIMB_PARTIAL(0x05C)
+        },
+        {   // 5 * 16^70 * G
+            LIMB_PAIR(0xAA505F62, 0x8B7BAD84), LIMB_PAIR(0xECBD5F9E, 0x8052B3CB), LIMB_PAIR(0xB3660A2B, 0x0E985E1A), LIMB_PAIR(0xA69BDFAA, 0xC17E62D3),
+            LIMB_PAIR(0x89B5E1E8, 0x9BB10331), LIMB_PAIR(0x6B55D39A, 0xC572485A), LIMB_PAIR(0xDF1F6747, 0xC322F39A), LIMB_PAIR(0xC81CB6FD, 0x88881E7F), LIMB_PARTIAL(0x0D9),
+            LIMB_PAIR(0x3310A660, 0x31D3F849), LIMB_PAIR(0xFDC9DB36, 0xDD188984), LIMB_PAIR(0x3C61B203, 0x89A0AF2C), LIMB_PAIR(0x8E454871, 0x508FAE9C),
+            LIMB_PAIR(0x69879C4F, 0x2EBD3D7A), LIMB_PAIR(0x83E6E3F8, 0x5AC4C93D), LIMB_PAIR(0xC59F4C51, 0x71744332), LIMB_PAIR(0xAD204B19, 0x0322F749), LIMB_PARTIAL(0x057)
+        },
+        {   // 6 * 16^70 * G
+            LIMB_PAIR(0x2DAC6A90, 0xD445E896), LIMB_PAIR(0x8A6D208C, 0x6904DD23), LIMB_PAIR(0x4E016973, 0x83ADFBBF), LIMB_PAIR(0xA384D374, 0x91630953),
+            LIMB_PAIR(0x35CAC47E, 0xCD5E3534), LIMB_PAIR(0x88BC5E3A, 0xCEC42D10), LIMB_PAIR(0x5141DE2D, 0x13D0E8AA), LIMB_PAIR(0xBE1D414A, 0x3BBD85D1), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0xB911AC9A, 0x2B200480), LIMB_PAIR(0x32BD4596, 0x0C681A43), LIMB_PAIR(0x68EDEB24, 0x68E27183), LIMB_PAIR(0x8950FF7B, 0xF8A34CE7),
+            LIMB_PAIR(0x3AFB03E3, 0xA58265B0), LIMB_PAIR(0x6BC58AD1, 0xD0D86660), LIMB_PAIR(0x3303C185, 0xF9542BBA), LIMB_PAIR(0xCC393E4B, 0x13AFE747), LIMB_PARTIAL(0x05B)
+        },
+        {   // 7 * 16^70 * G
+            LIMB_PAIR(0x55B6F895, 0x6871A6E1), LIMB_PAIR(0x9D7E2730, 0xB935913E), LIMB_PAIR(0xA9AC21A4, 0xFE1EEBB1), LIMB_PAIR(0x29C16938, 0xFDAB8794),
+            LIMB_PAIR(0xDEEB21B9, 0xEB9AFE9A), LIMB_PAIR(0x797F546D, 0x967A2FB2), LIMB_PAIR(0xB9CF34CB, 0x2FE2023B), LIMB_PAIR(0xE049697B, 0x9272977E), LIMB_PARTIAL(0x0CA),
+            LIMB_PAIR(0x50B4A316, 0x348928EF), LIMB_PAIR(0xE32C9A4F, 0x115E58EC), LIMB_PAIR(0xE3A235FF, 0x6D858BE4), LIMB_PAIR(0x72B943B7, 0x7464D704),
+            LIMB_PAIR(0xE862030B, 0x6E785131), LIMB_PAIR(0xB8A27819, 0x4060A8C7), LIMB_PAIR(0xD3E4F0D6, 0x831B7288), LIMB_PAIR(0xB36C3F8B, 0x81C21F75), LIMB_PARTIAL(0x004)
+        },
+        {   // 8 * 16^70 * G
+            LIMB_PAIR(0x80744C7B, 0x640C489C), LIMB_PAIR(0x09C3BD56, 0x76C2615A), LIMB_PAIR(0x4B2E41B9, 0x0A0A6454), LIMB_PAIR(0x3635ACDD, 0x1F67EA46),
+            LIMB_PAIR(0xF36DC54C, 0x7A93C39A), LIMB_PAIR(0x386CDCCC, 0x4EFD6C2F), LIMB_PAIR(0x8DD41A02, 0x789FFBCD), LIMB_PAIR(0x7068E710, 0xB718D818), LIMB_PARTIAL(0x002),
+            LIMB_PAIR(0x8E3ED0FC, 0x463B2B5D), LIMB_PAIR(0xC77BCB34, 0xEF348838), LIMB_PAIR(0x8E9BF495, 0xF3CD1BBD), LIMB_PAIR(0x2A4EC1FA, 0xC275C543),
+            LIMB_PAIR(0xCC394E16, 0xE606D611), LIMB_PAIR(0x1A56A93C, 0x45C1E7C6), LIMB_PAIR(0x1F6707B2, 0x828C42DB), LIMB_PAIR(0x43754051, 0x59FF2948), LIMB_PARTIAL(0x100)
+        }
+    },
+#endif
+#if (71 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^71 * G
+            LIMB_PAIR(0xDF5EE186, 0x3878C70A), LIMB_PAIR(0x6FFFEF9F, 0x62F4F54A), LIMB_PAIR(0x80400FA0, 0x0A7664C3), LIMB_PAIR(0xD0EA21B9, 0x99BE58C2),
+            LIMB_PAIR(0xE311AA6D, 0xFA70B9AD), LIMB_PAIR(0xABF43A4D, 0xAFADD452), LIMB_PAIR(0x0F7B5DE5, 0xE6291C61), LIMB_PAIR(0x78D61E62, 0x388A4215), LIMB_PARTIAL(0x024),
+            LIMB_PAIR(0xEE1BCDAF, 0xF188F980), LIMB_PAIR(0xC991F497, 0x9CCC1A6B), LIMB_PAIR(0x21EC6F5D, 0x6F733D12), LIMB_PAIR(0xDA9F5BDB, 0x59CE56B9),
+            LIMB_PAIR(0x40E88D50, 0xE03A9A1F), LIMB_PAIR(0xC0190A2A, 0xA5E60328), LIMB_PAIR(0x9FF9D482, 0x382BDBE6), LIMB_PAIR(0xBB792DE6, 0x26895085), LIMB_PARTIAL(0x013)
+        },
+        {   // 2 * 16^71 * G
+            LIMB_PAIR(0x5F8FA47E, 0xBA3A04F7), LIMB_PAIR(0x833DFB7C, 0xB9C44AA1), LIMB_PAIR(0xAF4EA679, 0xE4F3A4A6), LIMB_PAIR(0x8240AE75, 0x02B4BC28),
+            LIMB_PAIR(0x282412EC, 0x390076AE), LIMB_PAIR(0x06709592, 0x74E5BD64), LIMB_PAIR(0xDBAD0025, 0xB87B1A57), LIMB_PAIR(0x32123B04, 0x71E0C6F7), LIMB_PARTIAL(0x16C),
+            LIMB_PAIR(0xE4FFC2C8, 0x266B71D5), LIMB_PAIR(0xA73F6FDF, 0xB061CB88), LIMB_PAIR(0x75B93FF4, 0xBCA068CD), LIMB_PAIR(0x97712A14, 0x4552D43B),
+            LIMB_PAIR(0x5B941BA7, 0x1035134C), LIMB_PAIR(0xF31B6915, 0xC14623AB), LIMB_PAIR(0xAA972A0D, 0xDFDD91C4), LIMB_PAIR(0xE17B9AD3, 0x54E8E7E0), LIMB_PARTIAL(0x08D)
+        },
+        {   // 3 * 16^71 * G
+            LIMB_PAIR(0x22B7448B, 0x521CB4E3), LIMB_PAIR(0x4C726BEA, 0xB51BCA88), LIMB_PAIR(0x39C312EE, 0x9391BDEA), LIMB_PAIR(0x2C8B9A0A, 0xF9128EF7),
+            LIMB_PAIR(0xA8E51D04, 0x988F9F78), LIMB_PAIR(0x96C8257E, 0xDD44418F), LIMB_PAIR(0x2D7F2F00, 0x3688FB24), LIMB_PAIR(0x1B1FDD4C, 0x2F92E5FF), LIMB_PARTIAL(0x0E3),
+            LIMB_PAIR(0xE98C49F5, 0xBA865459), LIMB_PAIR(0x9DFE9DD3, 0x3545CF75), LIMB_PAIR(0xCE823A85, 0xEB3EF7FF), LIMB_PAIR(0x9B39A2A8, 0x39BC813A),
+            LIMB_PAIR(0x92A11C12, 0xB7534635), LIMB_PAIR(0x1EE6D123, 0xB16A5BD6), LIMB_PAIR(0x82FEF180, 0x3192E6DD), LIMB_PAIR(0x287687C4, 0xEBFB81B4), LIMB_PARTIAL(0x08F)
+        },
+        {   // 4 * 16^71 * G
+            LIMB_PAIR(0x8B404760, 0xA99E0FA8), LIMB_PAIR(0x28835BBA, 0x5F6B7EAA), LIMB_PAIR(0x811F0BCC, 0xEBE75466), LIMB_PAIR(0x9D0FFFA4, 0x3D69DA3E),
+            LIMB_PAIR(0x185F1AE0, 0xD815E361), LIMB_PAIR(0xB30FF597, 0x78623276), LIMB_PAIR(0xA8466DE1, 0x3518246E), LIMB_PAIR(0x516B0E43, 0x3C8E0D4A), LIMB_PARTIAL(0x03D),
+            LIMB_PAIR(0xD1614ABA, 0xF4BC4434), LIMB_PAIR(0xBFEDF3AB, 0x49D062B7), LIMB_PAIR(0x0FC7E5B4, 0x878C9329), LIMB_PAIR(0x8A92C516, 0x727EA919),
+            LIMB_PAIR(0x9AC43994, 0xD159DD26), LIMB_PAIR(0xC25A36A5, 0xCC04BC19), LIMB_PAIR(0x172789E1, 0xCC7FFB96), LIMB_PAIR(0x2F2EE22C, 0xC136B9C9), LIMB_PARTIAL(0x14B)
+        },
+        {   // 5 * 16^71 * G
+            LIMB_PAIR(0xDCEDC377, 0x7D858CBF), LIMB_PAIR(0xE1A5B46C, 0xC3F3875C), LIMB_PAIR(0x79AD10F4, 0x49C4664B), LIMB_PAIR(0x15564507, 0xCDB2138C),
+            LIMB_PAIR(0x9947BA35, 0x2EE0543B), LIMB_PAIR(0xAD4638AA, 0x785A7271), LIMB_PAIR(0x7C03E2CF, 0x7CCBAA92), LIMB_PAIR(0x558CEB2D, 0xFDC5E912), LIMB_PARTIAL(0x0D4),
+            LIMB_PAIR(0x5BE2E05C, 0x982BBE21), LIMB_PAIR(0x9EFC0A64, 0xCAD3F06C), LIMB_PAIR(0x6D27C70C, 0x076D93BE), LIMB_PAIR(0x90A905C6, 0x31267A26),
+            LIMB_PAIR(0xCC9842A5, 0x967AED2D), LIMB_PAIR(0xCA64408D, 0x838121E8), LIMB_PAIR(0xD073CD0D, 0x85CDED05), LIMB_PAIR(0x2C36FF15, 0xE29384CB), LIMB_PARTIAL(0x1E5)
+        },
+        {   // 6 * 16^71 * G
+            LIMB_PAIR(0x870BB0BB, 0x0AE257EA), LIMB_PAIR(0x69568F16, 0xD6A912F7), LIMB_PAIR(0x34765998, 0x4DED40B5), LIMB_PAIR(0xFDF1ECFF, 0x79AA4677),
+            LIMB_PAIR(0x0B5018EE, 0x398989EA), LIMB_PAIR(0xFD1830B9, 0xF5C66D47), LIMB_PAIR(0xB3C221E6, 0x81B8F4C4), LIMB_PAIR(0x8A4A9968, 0x589EDC21), LIMB_PARTIAL(0x19C),
+            LIMB_PAIR(0x6F26663C, 0x154B4096), LIMB_PAIR(0x1A620695, 0x01BE0277), LIMB_PAIR(0x392BB592, 0x04FDC393), LIMB_PAIR(0x2343FAA4, 0xB7C75D71),
+            LIMB_PAIR(0x0AE84496, 0x5085E76D), LIMB_PAIR(0x1766FAB7, 0x6C6EB5C0), LIMB_PAIR(0x4FE63E7E, 0xE8745027), LIMB_PAIR(0x87B18608, 0x262F1EC3), LIMB_PARTIAL(0x143)
+        },
+        {   // 7 * 16^71 * G
+            LIMB_PAIR(0x734512EF, 0xD1D23EFC), LIMB_PAIR(0xBAFA887A, 0x8885C332), LIMB_PAIR(0xB3E7242D, 0x98438804), LIMB_PAIR(0x2CF966ED, 0x0AC89EEB),
+            LIMB_PAIR(0x2179440E, 0x0EB25C77), LIMB_PAIR(0xC1DEC26A, 0xDD06CAD7), LIMB_PAIR(0x2FE5EE8A, 0x7081375F), LIMB_PAIR(0x16A968C8, 0x80EDEA99), LIMB_PARTIAL(0x11F),
+            LIMB_PAIR(0xA8A00726, 0x8DB61568), LIMB_PAIR(0xB22568ED, 0x493B2898), LIMB_PAIR(0xACB41A35, 0xAFCE0D3A), LIMB_PAIR(0xDDF0B39B, 0x148056FD),
+            LIMB_PAIR(0x16451772, 0x66507B68), LIMB_PAIR(0xBE584D0E, 0x89020BB9), LIMB_PAIR(0xB485A6FA, 0xA35E06C0), LIMB_PAIR(0x1B1701CB, 0x877E1787), LIMB_PARTIAL(0x168)
+        },
+        {   // 8 * 16^71 * G
+            LIMB_PAIR(0x7ED6EAD3, 0x758BE567), LIMB_PAIR(0x4EA30F41, 0x5AAB3798), LIMB_PAIR(0x724BDED8, 0x8A66701D), LIMB_PAIR(0x70544B4A, 0x3E1AD9A0),
+            LIMB_PAIR(0xEE940423, 0xD0286777), LIMB_PAIR(0x329A995E, 0x3335377B), LIMB_PAIR(0x4EEE58A7, 0x244D471A), LIMB_PAIR(0x67275E49, 0x32D4DFA0), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0xF91EEEF2, 0x7EF7DD10), LIMB_PAIR(0xBA0C7D57, 0x51C22E8B), LIMB_PAIR(0x85233341, 0x45C515D4), LIMB_PAIR(0xD353231A, 0xD9D7CEFC),
+            LIMB_PAIR(0xDA5BD561, 0xBEF9D961), LIMB_PAIR(0x5531A41D, 0xA5110C6F), LIMB_PAIR(0x4328F21C, 0x0F1F7A19), LIMB_PAIR(0x49EC18E6, 0x1AD6D24C), LIMB_PARTIAL(0x1A9)
+        }
+    },
+#endif
+#if (72 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^72 * G
+            LIMB_PAIR(0x6E640A8D, 0xBF2FFCB7), LIMB_PAIR(0xA0B5A07E, 0x63479501), LIMB_PAIR(0x5F36F2E7, 0x55BB3001), LIMB_PAIR(0x058A676A, 0x9890F999),
+            LIMB_PAIR(0x455C0D27, 0xD9EE341B), LIMB_PAIR(0x18E08FC8, 0x6C95780C), LIMB_PAIR(0x442A075D, 0xEB63A675), LIMB_PAIR(0xFB69DA00, 0xCE46A1A5), LIMB_PARTIAL(0x06B),
+            LIMB_PAIR(0xF3ED6253, 0x8C618934), LIMB_PAIR(0x6E9433B4, 0xE0034244), LIMB_PAIR(0x4260B2C5, 0x989B9921), LIMB_PAIR(0xD9DF4747, 0x11699804),
+            LIMB_PAIR(0x763A7F63, 0x125FE61F), LIMB_PAIR(0xC6EC395A, 0xA972786D), LIMB_PAIR(0xB7B7B8C6, 0x662F9FE7), LIMB_PAIR(0x5456556E, 0xFB644A61), LIMB_PARTIAL(0x08A)
+        },
+        {   // 2 * 16^72 * G
+            LIMB_PAIR(0xB0BB44D8, 0xED29C2FF), LIMB_PAIR(0xFA00DDAB, 0x0874C2A5), LIMB_PAIR(0x065A4A5E, 0x9398E8A2), LIMB_PAIR(0x91AAB917, 0xA6E19526),
+            LIMB_PAIR(0x667898DE, 0x20A816AC), LIMB_PAIR(0x4B94A66C, 0xDA4B9793), LIMB_PAIR(0xB00E36E2, 0x6FEE1473), LIMB_PAIR(0x93A46CE6, 0xCD9958D7), LIMB_PARTIAL(0x00F),
+            LIMB_PAIR(0xA362872F, 0xEAB9FA64), LIMB_PAIR(0x95457FB6, 0x87CC55B0), LIMB_PAIR(0x3C702019, 0xE3E3F13D), LIMB_PAIR(0xFF6208C0, 0xE025B3C8),
+            LIMB_PAIR(0xD8B8F87C, 0x8FCD5B2F), LIMB_PAIR(0x789BC9ED, 0xCF9DED31), LIMB_PAIR(0x18D40F49, 0x74742448), LIMB_PAIR(0x46C33140, 0xBF14E1F0), LIMB_PARTIAL(0x16D)
+        },
+        {   // 3 * 16^72 * G
+            LIMB_PAIR(0xA3A5A2A2, 0x0AA08334), LIMB_PAIR(0xDCFC5939, 0x7B1E2F91), LIMB_PAIR(0x673E221A, 0xE1C64158), LIMB_PAIR(0xCB3319D0, 0xA9CE2061),
+            LIMB_PAIR(0x977A9B41, 0xB359C34B), LIMB_PAIR(0xB7F9FC83, 0xC127AF82), LIMB_PAIR(0x81166C12, 0x18ADA734), LIMB_PAIR(0x092D64D4, 0x1C4C48FB), LIMB_PARTIAL(0x0EE),
+            LIMB_PAIR(0x4C5015C4, 0xFED1A8DA), LIMB_PAIR(0x526E1897, 0xEFD54478), LIMB_PAIR(0x75BBDC91, 0x0AC4F640), LIMB_PAIR(0x910661EC, 0xC0774CCE),
+            LIMB_PAIR(0xC30CCC07, 0x699BB035), LIMB_PAIR(0x80952CCF, 0x836B7B17), LIMB_PAIR(0x9788BDC1, 0x03B8BFEF), LIMB_PAIR(0xFD47A69D, 0xB24604C5), LIMB_PARTIAL(0x0D6)
+        },
+        {   // 4 * 16^72 * G
+            LIMB_PAIR(0x7E198AEC, 0x35E7AF92), LIMB_PAIR(0xAD58220E, 0x2937B845), LIMB_PAIR(0x625B0972, 0x9C8C65CC), LIMB_PAIR(0x1A9911C8, 0x91991D8A),
+            LIMB_PAIR(0x0A4EF588, 0xC9F134D9), LIMB_PAIR(0x0E01D57F, 0x1CBE5C25), LIMB_PAIR(0x85251D47, 0x4C31016E), LIMB_PAIR(0x52DC527C, 0xC5877776), LIMB_PARTIAL(0x18E),
+            LIMB_PAIR(0xD429C5F4, 0xA9232336), LIMB_PAIR(0xBFABB412, 0x60454705), LIMB_PAIR(0x794CC5C2, 0xF5F84846), LIMB_PAIR(0xBFC8532D, 0x1BD49EA0),
+            LIMB_PAIR(0x3042CD43, 0xD4B45B2C), LIMB_PAIR(0x374AB02B, 0x49590033), LIMB_PAIR(0xEE464C45, 0x78770266), LIMB_PAIR(0xDA262362, 0x0A33044E), LIMB_PARTIAL(0x144)
+        },
+        {   // 5 * 16^72 * G
+            LIMB_PAIR(0x720AEBB3, 0xC17C5414), LIMB_PAIR(0x7089E6BF, 0xEAA1A7B9), LIMB_PAIR(0x36DE9F22, 0x9EE50BA1), LIMB_PAIR(0x5B3BF8DD, 0x4BEB0068),
+            LIMB_PAIR(0x5B3F6992, 0x330E8C04), LIMB_PAIR(0x6E7A978C, 0xF477636D), LIMB_PAIR(0x9543861A, 0x5799678A), LIMB_PAIR(0x810077E6, 0xCEB7D074), LIMB_PARTIAL(0x019),
+            LIMB_PAIR(0xCAFEF71C, 0x0D20DB6D), LIMB_PAIR(0x35FA4E9F, 0xB1C02CBA), LIMB_PAIR(0x4630EE0E, 0xEB662868), LIMB_PAIR(0x88265202, 0xDA4BBE8C),
+            LIMB_PAIR(0xE1AA127C, 0x71B53DC3), LIMB_PAIR(0x0ABCAA62, 0xF4E2E52F), LIMB_PAIR(0xF8F6C926, 0xE4C4CC96), LIMB_PAIR(0x14AAF997, 0xF9CF5BA4), LIMB_PARTIAL(0x1E0)
+        },
+        {   // 6 * 16^72 * G
+            LIMB_PAIR(0x88098F73, 0xF946AB51), LIMB_PAIR(0xFFD8BC23, 0xE98C6E73), LIMB_PAIR(0x98758F69, 0x30D30A3C), LIMB_PAIR(0xBC8E359C, 0x302D5F8F),
+            LIMB_PAIR(0xFCD2F1FC, 0xADAA2FF6), LIMB_PAIR(0x4ADEC57A, 0x694DE81C), LIMB_PAIR(0x97698A60, 0x69735A5A), LIMB_PAIR(0x2D55531D, 0x15BBAE8C), LIMB_PARTIAL(0x164),
+            LIMB_PAIR(0x8C6B2D9B, 0x2398ABF0), LIMB_PAIR(0x9EC5EE96, 0x258BDC0E), LIMB_PAIR(0xA9BF887E, 0x80ACA75C), LIMB_PAIR(0xD1495AD2, 0x3E3ADC8C),
+            LIMB_PAIR(0x62D2F571, 0x1A30F948), LIMB_PAIR(0x989DDA10, 0xEBDBF063), LIMB_PAIR(0x74D3EFAE, 0x86BDDEDE), LIMB_PAIR(0xC749C868, 0xA42598AA), LIMB_PARTIAL(0x1F4)
+        },
+        {   // 7 * 16^72 * G
+            LIMB_PAIR(0xC936A7E5, 0x6AF0B935), LIMB_PAIR(0xD4A248AB, 0xDE94D724), LIMB_PAIR(0x594E53B7, 0x0491C733), LIMB_PAIR(0x1CCD7088, 0x238EF534),
+            LIMB_PAIR(0x4F5052C3, 0xAF0E791E), LIMB_PAIR(0x10C3411D, 0x70CBEA81), LIMB_PAIR(0x577D38BC, 0x6B7C8574), LIMB_PAIR(0x4EA6A924, 0x00E147AE), LIMB_PARTIAL(0x085),
+            LIMB_PAIR(0x497B793D, 0xCAB57E2A), LIMB_PAIR(0xEDF47059, 0x3F642966), LIMB_PAIR(0x2EB66B98, 0xA276326D), LIMB_PAIR(0xA76E1221, 0xEBA64255),
+            LIMB_PAIR(0xD23677B9, 0x698FD276), LIMB_PAIR(0x45A0625D, 0xCBB46374), LIMB_PAIR(0x50B672EB, 0x5D92DDDC), LIMB_PAIR(0x0839333C, 0xBEF8CCD0), LIMB_PARTIAL(0x091)
+        },
+        {   // 8 * 16^72 * G
+            LIMB_PAIR(0x96139042, 0x225420C3), LIMB_PAIR(0x5BCF13CB, 0x90A38D5C), LIMB_PAIR(0x99D999B0, 0xB99A43AE), LIMB_PAIR(0x50A20372, 0x5BBBE4D4),
+            LIMB_PAIR(0x45A7EDA6, 0xAA924202), LIMB_PAIR(0x8BB2A5B6, 0x49543E05), LIMB_PAIR(0x97D32F2D, 0xBD115564), LIMB_PAIR(0x5D680F19, 0xC57D1AF9), LIMB_PARTIAL(0x16F),
+            LIMB_PAIR(0x5FF37259, 0x93AF0511), LIMB_PAIR(0x9B9CC398, 0x89C88BEF), LIMB_PAIR(0xA91987B5, 0x85526FF5), LIMB_PAIR(0xDFBF9615, 0x8B7BB52A),
+            LIMB_PAIR(0x0839C531, 0x25767D03), LIMB_PAIR(0x1CD9033E, 0x6B15AA2E), LIMB_PAIR(0xDFAE7D95, 0x47490261), LIMB_PAIR(0xE7E1E8ED, 0x4EE02157), LIMB_PARTIAL(0x15D)
+        }
+    },
+#endif
+#if (73 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^73 * G
+            LIMB_PAIR(0x05487074, 0x5EC6427B), LIMB_PAIR(0x80C426AD, 0x0B59FA1F), LIMB_PAIR(0xC9946594, 0x0207D510), LIMB_PAIR(0xD38F83D0, 0xBA1FE985),
+            LIMB_PAIR(0xC96EB133, 0x113AEC98), LIMB_PAIR(0x82515193, 0x3424AD01), LIMB_PAIR(0xFB6F9B10, 0x3EB15AEF), LIMB_PAIR(0xF15D8BE1, 0xCCB719E8), LIMB_PARTIAL(0x13C),
+            LIMB_PAIR(0x4C67518D, 0x63F89883), LIMB_PAIR(0xF85EB1D9, 0xB5CA3508), LIMB_PAIR(0xAF652B25, 0x1EA1C74F), LIMB_PAIR(0xBDDEDC4D, 0x4FBC5476),
+            LIMB_PAIR(0xF4B33C74, 0x22DAA81A), LIMB_PAIR(0x3F36AE29, 0x9F7941A0), LIMB_PAIR(0xBCA5CA40, 0x90C2B8CE), LIMB_PAIR(0xB587B3D6, 0x53E736A1), LIMB_PARTIAL(0x1B3)
+        },
+        {   // 2 * 16^73 * G
+            LIMB_PAIR(0x9545BB61, 0x8645EFEB), LIMB_PAIR(0x207181BB, 0xF696AF86), LIMB_PAIR(0xA2B2D411, 0x94D3014C), LIMB_PAIR(0x65C54DB3, 0xB8F15156),
+            LIMB_PAIR(0x011DD592, 0x6574F1CB), LIMB_PAIR(0xF3247AB4, 0x7D9C69EB), LIMB_PAIR(0x5A391A77, 0x1708B24D), LIMB_PAIR(0x312E131F, 0xAAA19D08), LIMB_PARTIAL(0x167),
+            LIMB_PAIR(0xEBAEA62D, 0x1D3F4510), LIMB_PAIR(0x6C118B52, 0x2186C9C2), LIMB_PAIR(0xCAAADD5F, 0x81C0B0AF), LIMB_PAIR(0x665BB598, 0xA0256B3C),
+            LIMB_PAIR(0xECED1F38, 0xEC461656), LIMB_PAIR(0x65AA7914, 0x77BFE652), LIMB_PAIR(0x333F7AAE, 0xD2600229), LIMB_PAIR(0xE1F081DD, 0xD916FBBD), LIMB_PARTIAL(0x010)
+        },
+        {   // 3 * 16^73 * G
+            LIMB_PAIR(0x9088C2CE, 0x6DF7CCCE), LIMB_PAIR(0xB88F81B6, 0x6A8048BE), LIMB_PAIR(0xE5F7673F, 0xA4B4F0E3), LIMB_PAIR(0xBEC7C688, 0x26EB7B7D),
+            LIMB_PAIR(0x10BF71CE, 0xAA17B13E), LIMB_PAIR(0xB36DCC8F, 0x5D486038), LIMB_PAIR(0x0063F45E, 0x0256CCAF), LIMB_PAIR(0x069B36B0, 0x88D8FDA4), LIMB_PARTIAL(0x08D),
+            LIMB_PAIR(0xC42A3A8E, 0x2DD059FB), LIMB_PAIR(0xB211932C, 0xD8765FC9), LIMB_PAIR(0x4092EFA9, 0xBF35A409), LIMB_PAIR(0xD247EA27, 0xCCC83C7D),
+            LIMB_PAIR(0xB76BB256, 0x9B3BE42E), LIMB_PAIR(0x6B87921F, 0x8AE4A99B), LIMB_PAIR(0xBD1013F5, 0x3034C4FF), LIMB_PAIR(0xA3730B8D, 0x57F523B2), LIMB_PARTIAL(0x0C0)
+        },
+        {   // 4 * 16^73 * G
+            LIMB_PAIR(0x3F7CAE04, 0xB64361A9), LIMB_PAIR(0xAF64EFBC, 0x23CFCF76), LIMB_PAIR(0xD4965AE5, 0xB4539C3C), LIMB_PAIR(0x4DF1182D, 0xF16E3E88),
+            LIMB_PAIR(0xDD75FED1, 0x2BF7EED4), LIMB_PAIR(0xA215B733, 0x831A5956), LIMB_PAIR(0x9732D4DD, 0xC23E3F1A), LIMB_PAIR(0x04677879, 0x36449619), LIMB_PARTIAL(0x068),
+            LIMB_PAIR(0xE07AF31C, 0x14675E68), LIMB_PAIR(0xABCD16D6, 0x82C3D1BA), LIMB_PAIR(0x6FE13962, 0xAB1B388E), LIMB_PAIR(0x8016A6AE, 0x3490B521),
+            LIMB_PAIR(0x1CE7F93B, 0x13B584A1), LIMB_PAIR(0xA5CBEB76, 0x44265DA4), LIMB_PAIR(0x63DF9697, 0x17E47267), LIMB_PAIR(0xCF2B278B, 0x10144C87), LIMB_PARTIAL(0x013)
+        },
+        {   // 5 * 16^73 * G
+            LIMB_PAIR(0x4AC5EF8F, 0xC470F96F), LIMB_PAIR(0xF41A1D41, 0xB06F3C09), LIMB_PAIR(0x180BC759, 0x3D019BDC), LIMB_PAIR(0x69ACDA2B, 0x53FFAC70),
+            LIMB_PAIR(0xCEEF6C20, 0xB2A01E7D), LIMB_PAIR(0xB7C261AC, 0x144C2F6E), LIMB_PAIR(0x6EADBCED, 0x012B098C), LIMB_PAIR(0xB634A837, 0x85F2EA71), LIMB_PARTIAL(0x144),
+            LIMB_PAIR(0x6A8FA909, 0x6D50B0AF), LIMB_PAIR(0x944AE8C0, 0x052B772A), LIMB_PAIR(0xD783103C, 0x6306369B), LIMB_PAIR(0xE321A7A4, 0x4E11FAA2),
+            LIMB_PAIR(0x3024EE00, 0x1963D2AE), LIMB_PAIR(0x4BBF4D91, 0xEA8CF87C), LIMB_PAIR(0xF678AF53, 0x293B0207), LIMB_PAIR(0x5CA3A809, 0x5299C812), LIMB_PARTIAL(0x0BD)
+        },
+        {   // 6 * 16^73 * G
+            LIMB_PAIR(0x4F5B0421, 0x08FBCE3F), LIMB_PAIR(0xF59FD9E2, 0x4E4F3FAC), LIMB_PAIR(0xEBD8FD8A, 0x74557874), LIMB_PAIR(0xEFB2F20D, 0xD44B9CA9),
+            LIMB_PAIR(0x1BBF688C, 0xF43CFAAB), LIMB_PAIR(0xF799B23D, 0x2DB8774E), LIMB_PAIR(0xA80A04EF, 0xD1CA23EC), LIMB_PAIR(0xEFCE5F35, 0x3EB47AAE), LIMB_PARTIAL(0x08D),
+            LIMB_PAIR(0xE9370A9B, 0x165AC19E), LIMB_PAIR(0x2C654E43, 0x9C19C758), LIMB_PAIR(0xB4F9C43E, 0x4AC5195E), LIMB_PAIR(0xD714AA06, 0x6FB0991C),
+            LIMB_PAIR(0x7B348C2D, 0x6103B1CB), LIMB_PAIR(0x5FFB3AAE, 0xFEA4176F), LIMB_PAIR(0xB94EEB5F, 0xC53AE7F7), LIMB_PAIR(0x9E4D4A5C, 0xA933F30A), LIMB_PARTIAL(0x1FA)
+        },
+        {   // 7 * 16^73 * G
+            LIMB_PAIR(0x0D593359, 0x961AEDE7), LIMB_PAIR(0x46BE7455, 0x0EDBE79C), LIMB_PAIR(0x0C410034, 0x63E8ABDF), LIMB_PAIR(0x4F878C40, 0xDC91162C),
+            LIMB_PAIR(0xE7935F7A, 0xB31D78B7), LIMB_PAIR(0x2584A9D4, 0xE46FB88A), LIMB_PAIR(0x5770F79D, 0x596B4BDB), LIMB_PAIR(0x9BB969B9, 0xAE0A5FE8), LIMB_PARTIAL(0x03D),
+            LIMB_PAIR(0xEE19802B, 0xE8E840F9), LIMB_PAIR(0x4CD021FA, 0x33A36BD3), LIMB_PAIR(0xBAD376F9, 0x13472C59), LIMB_PAIR(0x304A8A88, 0x9C3A76A8),
+            LIMB_PAIR(0x594B5FC2, 0x1D17D867), LIMB_PAIR(0xBC95244D, 0x1460F538), LIMB_PAIR(0x7E5D2A0C, 0x3866C6EB), LIMB_PAIR(0x79F27451, 0xDC63BC62), LIMB_PARTIAL(0x039)
+        },
+        {   // 8 * 16^73 * G
+            LIMB_PAIR(0x8523AAB6, 0x4E75AEB0), LIMB_PAIR(0x58144CDD, 0xD32A9932), LIMB_PAIR(0x3C055E41, 0xE7A2EA2D), LIMB_PAIR(0x31C1949A, 0xC25DC24E),
+            LIMB_PAIR(0xA124DBC2, 0x719E3BDA), LIMB_PAIR(0x0C1B238C, 0x331BF182), LIMB_PAIR(0xFB86656B, 0x6FB91096), LIMB_PAIR(0xB484C49D, 0x6A12AE8D), LIMB_PARTIAL(0x1E0),
+            LIMB_PAIR(0xE97E59AF, 0x4E4B8553), LIMB_PAIR(0x8E98D66E, 0x6A2B1F0D), LIMB_PAIR(0xD49BC96B, 0x9001ACE6), LIMB_PAIR(0x3E8D2774, 0x70B21C8A),
+            LIMB_PAIR(0x473972A2, 0xBA4C7DA4), LIMB_PAIR(0x7B898ADE, 0xF159EA8B), LIMB_PAIR(0xCCEDA981, 0x7A0E87A0), LIMB_PAIR(0x2F280717, 0xB886AB7D), LIMB_PARTIAL(0x03A)
+        }
+    },
+#endif
+#if (74 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^74 * G
+            LIMB_PAIR(0x448996E2, 0xE0828A5B), LIMB_PAIR(0x516E440D, 0xDD3F4D9B), LIMB_PAIR(0xAB10E109, 0x223B4F87), LIMB_PAIR(0x4CE7241C, 0x766BDE38),
+            LIMB_PAIR(0xDCAF88A7, 0x0B1CC320), LIMB_PAIR(0xD75440D5, 0xB0470E7D), LIMB_PAIR(0xBA76B7E8, 0xE3894E41), LIMB_PAIR(0xA762BB9E, 0xA0341305), LIMB_PARTIAL(0x13F),
+            LIMB_PAIR(0x0EADF722, 0x4F5581D3), LIMB_PAIR(0x50D8999B, 0x6E4E31E0), LIMB_PAIR(0x02F03368, 0xC14BB148), LIMB_PAIR(0x26A263B5, 0x41F19643),
+            LIMB_PAIR(0x3B5F480E, 0xC0642E4C), LIMB_PAIR(0x63191881, 0x0A3280DF), LIMB_PAIR(0x78FA9069, 0x4EE1959A), LIMB_PAIR(0x557A8DC0, 0x7376078A), LIMB_PARTIAL(0x181)
+        },
+        {   // 2 * 16^74 * G
+            LIMB_PAIR(0xFCB68CA5, 0x5C6DCFE8), LIMB_PAIR(0x902E03CD, 0x499866E3), LIMB_PAIR(0xCFF1ADC7, 0x28638635), LIMB_PAIR(0x6538CF65, 0xD224BF5D),
+            LIMB_PAIR(0xD7C55F70, 0x59FAC5C2), LIMB_PAIR(0x99CDA00A, 0xC7104926), LIMB_PAIR(0x9AE92020, 0x043001C3), LIMB_PAIR(0xC325CC56, 0xBAF959DB), LIMB_PARTIAL(0x0C5),
+            LIMB_PAIR(0xE69664A7, 0x76AEC243), LIMB_PAIR(0x86D69554, 0x0885DBB3), LIMB_PAIR(0x3647325C, 0xE4A28883), LIMB_PAIR(0x6E8E47A4, 0xDB1ADC9A),
+            LIMB_PAIR(0xB14E1019, 0x3E2230DA), LIMB_PAIR(0xAC7DA236, 0x49A16A19), LIMB_PAIR(0x8DF54DAF, 0x12EAC3E9), LIMB_PAIR(0x7964AB39, 0x78D48EA7), LIMB_PARTIAL(0x08E)
+        },
+        {   // 3 * 16^74 * G
+            LIMB_PAIR(0x386C4E0C, 0xCB52BFA5), LIMB_PAIR(0x173C0506, 0x9AD631CE), LIMB_PAIR(0x1F481A10, 0x7779FD8D), LIMB_PAIR(0xADBF3B01, 0x0CE5155C),
+            LIMB_PAIR(0x4A66E714, 0x946C3D6C), LIMB_PAIR(0xFC39257A, 0x82363B8E), LIMB_PAIR(0x9F7DDFA7, 0x5BFF5F52), LIMB_PAIR(0xC959F74A, 0xF6019194), LIMB_PARTIAL(0x195),
+            LIMB_PAIR(0xD1A7E5E3, 0x97E049CC), LIMB_PAIR(0xBA5ABA47, 0x20B70812), LIMB_PAIR(0xEED6D2FE, 0xAA1AE913), LIMB_PAIR(0x668BB4B6, 0x3A742BCE),
+            LIMB_PAIR(0x64D51F79, 0x4527C1A5), LIMB_PAIR(0x9295BFAD, 0x70E8A3C8), LIMB_PAIR(0x1CC82FC0, 0xA3066303), LIMB_PAIR(0xFD3F6160, 0x2C7C0291), LIMB_PARTIAL(0x06B)
+        },
+        {   // 4 * 16^74 * G
+            LIMB_PAIR(0x4247E72E, 0xEB4B2327), LIMB_PAIR(0x175CC2DD, 0x6660A1E5), LIMB_PAIR(0xFA58CACF, 0xB6CB2DB4), LIMB_PAIR(0xF93C9B5C, 0x035B7AB3),
+            LIMB_PAIR(0xBBC94809, 0xD2582C31), LIMB_PAIR(0x4328D05F, 0xB80863E5), LIMB_PAIR(0x80B782B5, 0x61F99DD5), LIMB_PAIR(0x59E27DB6, 0xA17FB8FC), LIMB_PARTIAL(0x04D),
+            LIMB_PAIR(0xE6B71BDC, 0x4BDD2A99), LIMB_PAIR(0x210C0D88, 0x586B3CE9), LIMB_PAIR(0x9295119B, 0x590B0C45), LIMB_PAIR(0xA417F7DE, 0x1EE8B021),
+            LIMB_PAIR(0x4EFECB1A, 0xCE83AE39), LIMB_PAIR(0xEB3E3C84, 0x06298F05), LIMB_PAIR(0x95E6D8C8, 0x0E139052), LIMB_PAIR(0xBABC6BD8, 0x5E8A4031), LIMB_PARTIAL(0x11F)
+        },
+        {   // 5 * 16^74 * G
+            LIMB_PAIR(0xB1351AAB, 0xB9B6EBF9), LIMB_PAIR(0x49A08F81, 0x3199F6E3), LIMB_PAIR(0x5DF347A9, 0x3CFDB717), LIMB_PAIR(0xB15D1ECD, 0xAD627841),
+            LIMB_PAIR(0xD4918F31, 0x994AC9A2), LIMB_PAIR(0xA482E07E, 0x3F3B84A1), LIMB_PAIR(0xD01DF2A1, 0x82F47118), LIMB_PAIR(0x0612E165, 0x1CE7C253), LIMB_PARTIAL(0x117),
+            LIMB_PAIR(0xB1A67846, 0xA4D357D1), LIMB_PAIR(0xA5F6313B, 0x0ED36337), LIMB_PAIR(0x6224B03D, 0xF759ACC5), LIMB_PAIR(0x43833ACA, 0x9F79550A),
+            LIMB_PAIR(0x5B80BAB0, 0x71238A8D), LIMB_PAIR(0xF5A7E9D2, 0x2F5D78D1), LIMB_PAIR(0xAF79CF0C, 0x34844C10), LIMB_PAIR(0x878E03C7, 0x202250A1), LIMB_PARTIAL(0x1DE)
+        },
+        {   // 6 * 16^74 * G
+            LIMB_PAIR(0xA207739F, 0xAA91D38B), LIMB_PAIR(0x6CB4B052, 0x8C5E7AE3), LIMB_PAIR(0x26932370, 0xA7856481), LIMB_PAIR(0x810F6A28, 0xEC5F6683),
+            LIMB_PAIR(0xDD4A1A39, 0x56D9B66F), LIMB_PAIR(0xB4AE3605, 0x936D24F5), LIMB_PAIR(0x3CCEFA36, 0x5B89ADB5), LIMB_PAIR(0xC6A0096A, 0x7D893E3A), LIMB_PARTIAL(0x15E),
+            LIMB_PAIR(0x99DB465C, 0x98CECB6D), LIMB_PAIR(0x2C1113B7, 0x66DB3E13), LIMB_PAIR(0x881D1C5C, 0x9DFAFBCA), LIMB_PAIR(0x21503E69, 0x78D6B568),
+            LIMB_PAIR(0xF05AC1B1, 0xB0197722), LIMB_PAIR(0xC45E608D, 0x2523D52B), LIMB_PAIR(0xEEB9EF93, 0x8E77C13C), LIMB_PAIR(0x56A50594, 0xC5C6E0E7), LIMB_PARTIAL(0x10B)
+        },
+        {   // 7 * 16^74 * G
+            LIMB_PAIR(0xF50A3D85, 0xF7ED6FFD), LIMB_PAIR(0x25ECD014, 0x920B8075), LIMB_PAIR(0x4EBBD57E, 0x9074D5D1), LIMB_PAIR(0x8CE72DFE, 0x2C7656F0),
+            LIMB_PAIR(0x336DF7B8, 0xD17C1313), LIMB_PAIR(0x4A6A7112, 0x34259389), LIMB_PAIR(0x71D23283, 0xF9112C81), LIMB_PAIR(0xB19617B0, 0x80EE8F87), LIMB_PARTIAL(0x0DA),
+            LIMB_PAIR(0xE36790D1, 0xD411F8B2), LIMB_PAIR(0xC03B68A7, 0xE0352D7A), LIMB_PAIR(0x55DD2C1F, 0xE2B16D4E), LIMB_PAIR(0x3B874068, 0x3282A3DE),
+            LIMB_PAIR(0x1B3D4991, 0x26FBC96E), LIMB_PAIR(0x20D08473, 0x42F10B45), LIMB_PAIR(0xC84ED8E7, 0xF17DCE35), LIMB_PAIR(0x91F15069, 0x78DA06E7), LIMB_PARTIAL(0x1DA)
+        },
+        {   // 8 * 16^74 * G
+            LIMB_PAIR(0x5B6E48AE, 0x709AC157), LIMB_PAIR(0x95EB72EB, 0x7EF27B0F), LIMB_PAIR(0xD987E330, 0xB1BCA839), LIMB_PAIR(0x10B85D29, 0x16D0F9B1),
+            LIMB_PAIR(0xA5E559F2, 0x08D6D9B2), LIMB_PAIR(0x980B6DAA, 0xDCB7602D), LIMB_PAIR(0xF2F9B64C, 0xB38F08A5), LIMB_PAIR(0xE2CF92B2, 0xD9ADC282), LIMB_PARTIAL(0x164),
+            LIMB_PAIR(0x3137F926, 0xCC6A5191), LIMB_PAIR(0x88821C6C, 0x9E4CCF84), LIMB_PAIR(0x4C8BABE2, 0x0B399179), LIMB_PAIR(0x29C119F0, 0x4269EE39),
+            LIMB_PAIR(0x3509D23A, 0x1374F63A), LIMB_PAIR(0x86B73069, 0xB7563C43), LIMB_PAIR(0x077F8BBB, 0x2AD51F46), LIMB_PAIR(0xD8D3310C, 0xC383BF47), LIMB_PARTIAL(0x079)
+        }
+    },
+#endif
+#if (75 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^75 * G
+            LIMB_PAIR(0x817221D9, 0xCDB8A92C), LIMB_PAIR(0x780ED8A2, 0x7FF2643E), LIMB_PAIR(0x56FC9CAA, 0x5EFCCEDA), LIMB_PAIR(0xF823D2FC, 0x59B5AA12),
+            LIMB_PAIR(0x9DBFEB54, 0xFE97818B), LIMB_PAIR(0xA13DDE72, 0x2BECCEAF), LIMB_PAIR(0xE8692B1B, 0x5D5B53CE), LIMB_PAIR(0xCAE9DDC6, 0xF5E5AC69), LIMB_PARTIAL(0x00F),
+            LIMB_PAIR(0xC692D9CC, 0x6EE75741), LIMB_PAIR(0x62A91D4D, 0xD97EB6F2), LIMB_PAIR(0xE2924E75, 0x8858BA5D), LIMB_PAIR(0x517030B1, 0xB8E1B22A),
+            LIMB_PAIR(0x2AF83DFB, 0x651A6838), LIMB_PAIR(0x1C21BE14, 0xC1FB14D2), LIMB_PAIR(0xC9EBA60E, 0x87689D46), LIMB_PAIR(0x0DA1A29D, 0xE16CFC1A), LIMB_PARTIAL(0x107)
+        },
+        {   // 2 * 16^75 * G
+            LIMB_PAIR(0xE3C91B63, 0x4021A24D), LIMB_PAIR(0x0B896F6C, 0xF7CBD01A), LIMB_PAIR(0x145743C1, 0xB005E27E), LIMB_PAIR(0x3D2C0449, 0x170D3031),
+            LIMB_PAIR(0x715E87BC, 0xB2369781), LIMB_PAIR(0xD6E85650, 0x7EF5D8E0), LIMB_PAIR(0xB232C66D, 0x1A5FA6C7), LIMB_PAIR(0xDB20FFD8, 0xC0455CAE), LIMB_PARTIAL(0x01F),
+            LIMB_PAIR(0x05C7C488, 0x3ACF9BD3), LIMB_PAIR(0x294DF5B3, 0xBF769BB0), LIMB_PAIR(0x8FA692FD, 0x8D5F9095), LIMB_PAIR(0x77AEF48D, 0x9B20F4C7),
+            LIMB_PAIR(0x7987AD09, 0x31213431), LIMB_PAIR(0xD6A327E1, 0xC0B03AEA), LIMB_PAIR(0xE6F56BAD, 0x5BE9A205), LIMB_PAIR(0x6C7FF60D, 0x2DB39C5E), LIMB_PARTIAL(0x02C)
+        },
+        {   // 3 * 16^75 * G
+            LIMB_PAIR(0xB0A899D2, 0xC9A5E2D7), LIMB_PAIR(0xEC01AD8C, 0x225E0A7C), LIMB_PAIR(0x1B354803, 0x184D1C3D), LIMB_PAIR(0xB9B5BA7C, 0x28026887),
+            LIMB_PAIR(0x26DC425E, 0x59EB397F), LIMB_PAIR(0x55D8724A, 0x719DE971), LIMB_PAIR(0xACA58401, 0x9823C8FD), LIMB_PAIR(0x38A1558C, 0x5793D2C7), LIMB_PARTIAL(0x010),
+            LIMB_PAIR(0x2ED1274F, 0xD14908B2), LIMB_PAIR(0x8B51E15F, 0x087A1B8F), LIMB_PAIR(0x7D3336DE, 0x879FADC6), LIMB_PAIR(0x92D80167, 0x9F78BC54),
+            LIMB_PAIR(0xD21BCB96, 0xF5EBDDC4), LIMB_PAIR(0x5B68A23B, 0x7D24EE7A), LIMB_PAIR(0xFD9BA4E8, 0xCD432917), LIMB_PAIR(0xF829E95B, 0x38B9E8B7), LIMB_PARTIAL(0x102)
+        },
+        {   // 4 * 16^75 * G
+            LIMB_PAIR(0x1FBE4B1A, 0x06E67291), LIMB_PAIR(0x7328B43C, 0x2DF4C01C), LIMB_PAIR(0x7350889A, 0x811847EA), LIMB_PAIR(0xF19988A8, 0xEE53F7EF),
+            LIMB_PAIR(0x71578D7D, 0xCC3FC6D3), LIMB_PAIR(0x7B0F48EC, 0x20682A7B), LIMB_PAIR(0x1EC4CD51, 0x6979A4F2), LIMB_PAIR(0x845BC78F, 0x58272B7C), LIMB_PARTIAL(0x00E),
+            LIMB_PAIR(0x35E8EF48, 0xCEEC799C), LIMB_PAIR(0xF9EC8AE5, 0xA01333EF), LIMB_PAIR(0xF9262E87, 0x5B99B83E), LIMB_PAIR(0x0F427205, 0x37C4DF17),
+            LIMB_PAIR(0xF972DEA8, 0xB20CEF3F), LIMB_PAIR(0xC6C4C976, 0xB63AC380), LIMB_PAIR(0x90866381, 0x0B915C32), LIMB_PAIR(0x91EEDCAB, 0x8817B26A), LIMB_PARTIAL(0x01B)
+        },
+        {   // 5 * 16^75 * G
+            LIMB_PAIR(0xFF25C5D0, 0x489E62BF), LIMB_PAIR(0x9EB33D69, 0x347D0F51), LIMB_PAIR(0x45C99F94, 0xBE69C42F), LIMB_PAIR(0xE51E7E40, 0xD626C5C9),
+            LIMB_PAIR(0x4F840BD3, 0x9CC39095), LIMB_PAIR(0xECA2B6D5, 0xAA0B0DF4), LIMB_PAIR(0x075946FC, 0xD0E1F1D9), LIMB_PAIR(0x5706086B, 0x66CDDF30), LIMB_PARTIAL(0x162),
+            LIMB_PAIR(0x064FA85C, 0x9B2CAA63), LIMB_PAIR(0x20720800, 0xA3A5E2BB), LIMB_PAIR(0x5295B6F9, 0x2485913A), LIMB_PAIR(0xB769D794, 0xE5428476),
+            LIMB_PAIR(0x031D0495, 0xC6CDE727), LIMB_PAIR(0x6088822B, 0x4A7BCF34), LIMB_PAIR(0x307659AD, 0x649B0492), LIMB_PAIR(0x79E8F7FA, 0x80FB444F), LIMB_PARTIAL(0x008)
+        },
+        {   // 6 * 16^75 * G
+            LIMB_PAIR(0xA092069A, 0x7ACE3143), LIMB_PAIR(0x5E70D5CA, 0x0BC9CD59), LIMB_PAIR(0x60DAE8CC, 0x1C26DF98), LIMB_PAIR(0xB881888B, 0xF4358CEF),
+            LIMB_PAIR(0x6632AB56, 0xFEDDC976), LIMB_PAIR(0xB870DDA8, 0x08206F72), LIMB_PAIR(0xCC81F687, 0x46F76EA4), LIMB_PAIR(0xCA702001, 0x865B6CB3), LIMB_PARTIAL(0x07B),
+            LIMB_PAIR(0xB099AF17, 0xC064A2E3), LIMB_PAIR(0x1D625DCF, 0x88BEB237), LIMB_PAIR(0xF7B18AC9, 0x507BE25A), LIMB_PAIR(0x77F8ED84, 0x46C8C360),
+            LIMB_PAIR(0xADF90251, 0xB019195F), LIMB_PAIR(0x56C4EB40, 0x386ED5CE), LIMB_PAIR(0x870504A2, 0x46427F9C), LIMB_PAIR(0x36D0F019, 0x156E3C6F), LIMB_PARTIAL(0x033)
+        },
+        {   // 7 * 16^75 * G
+            LIMB_PAIR(0x2F39703C, 0x202AD82E), LIMB_PAIR(0x281B6010, 0x9A3F515E), LIMB_PAIR(0xE376BCC7, 0x2A67B042), LIMB_PAIR(0x98EF60E5, 0xCED04EA8),
+            LIMB_PAIR(0x875EADEC, 0x3DFC3602), LIMB_PAIR(0xEB3BE4B3, 0x99FFA8B4), LIMB_PAIR(0x2C56B275, 0x2643CAAB), LIMB_PAIR(0xB6EF478C, 0x3DBCD4F2), LIMB_PARTIAL(0x0B0),
+            LIMB_PAIR(0x9A85AACD, 0x9FAE7376), LIMB_PAIR(0xDE6EC1C1, 0x41DE8DCD), LIMB_PAIR(0x09F66E0C, 0x7C1F3CD0), LIMB_PAIR(0xD39B844A, 0xB918C9E9),
+            LIMB_PAIR(0xDECCB196, 0x1A11B5D8), LIMB_PAIR(0x2A606F50, 0x2B37CA08), LIMB_PAIR(0x42B68F99, 0x5550CA7A), LIMB_PAIR(0x371C9CF5, 0x29AA94D6), LIMB_PARTIAL(0x196)
+        },
+        {   // 8 * 16^75 * G
+            LIMB_PAIR(0x000535EA, 0x06E0332E), LIMB_PAIR(0x03BBBE55, 0x5C58E864), LIMB_PAIR(0x10B9B5A0, 0x4D9A6DB1), LIMB_PAIR(0x6A24DB5D, 0x7EF09CFC),
+            LIMB_PAIR(0x819D4D78, 0x61D105F4), LIMB_PAIR(0x82D474A2, 0xC5E243DD), LIMB_PAIR(0x886E0D59, 0x8742D427), LIMB_PAIR(0x079399E7, 0x08CC598E), LIMB_PARTIAL(0x0AF),
+            LIMB_PAIR(0xC8E53592, 0xB1AF75D1), LIMB_PAIR(0xCA9DBFDD, 0x74857A7F), LIMB_PAIR(0xD49CF79F, 0x2F7F11D8), LIMB_PAIR(0x7C4073D2, 0x82C78C0D),
+            LIMB_PAIR(0xAB4C74C0, 0xBE13602F), LIMB_PAIR(0xD0D37AD7, 0x4282184E), LIMB_PAIR(0x28289FE0, 0x719BB297), LIMB_PAIR(0xB09427E0, 0x08FE79E9), LIMB_PARTIAL(0x192)
+        }
+    },
+#endif
+#if (76 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^76 * G
+            LIMB_PAIR(0xEEC6E312, 0x163A9E62), LIMB_PAIR(0x459162D8, 0xD11432C1), LIMB_PAIR(0xA25D4934, 0xDDE7D941), LIMB_PAIR(0x8D868AAD, 0x9067028E),
+            LIMB_PAIR(0x5B6E3D21, 0xB71B1708), LIMB_PAIR(0xE95D3C7F, 0xAED73637), LIMB_PAIR(0x1DCE0D78, 0x51BCC93C), LIMB_PAIR(0x504A9D0B, 0x2F45D06A), LIMB_PARTIAL(0x0BE),
+            LIMB_PAIR(0x300B2478, 0xEC12EA4B), LIMB_PAIR(0xF2A48388, 0x91AC6EED), LIMB_PAIR(0x7A7631AD, 0xFBDC1BBA), LIMB_PAIR(0x79D5F4CE, 0x5B2669CB),
+            LIMB_PAIR(0x48C8F025, 0x219D64F9), LIMB_PAIR(0xAADB5873, 0xADCAAB29), LIMB_PAIR(0x671BD673, 0x3B07AF1C), LIMB_PAIR(0xB7F2D8F5, 0xE66E7C67), LIMB_PARTIAL(0x0C9)
+        },
+        {   // 2 * 16^76 * G
+            LIMB_PAIR(0x2BC15CA5, 0xF03E2684), LIMB_PAIR(0xBF196674, 0x0B130B09), LIMB_PAIR(0x56217F5F, 0x3C275387), LIMB_PAIR(0x349ACA89, 0xB26D17D4),
+            LIMB_PAIR(0x0269BF70, 0x3FAF1859), LIMB_PAIR(0xB288736A, 0x3CDEB74F), LIMB_PAIR(0x7E38EA96, 0xEBA8F600), LIMB_PAIR(0x51DA8C99, 0xD24052C8), LIMB_PARTIAL(0x15E),
+            LIMB_PAIR(0xB2F51CDB, 0xA5582BAC), LIMB_PAIR(0xD0A7F7C7, 0xA325B5CB), LIMB_PAIR(0x09931317, 0x065A27F0), LIMB_PAIR(0xCDDC78EC, 0x1ABD17B6),
+            LIMB_PAIR(0x37962CE7, 0xD8FD4269), LIMB_PAIR(0x002CF3C2, 0x5D8403C8), LIMB_PAIR(0xE3EB09A4, 0xE62F5305), LIMB_PAIR(0xEEAF6FB3, 0x1900F36C), LIMB_PARTIAL(0x10A)
+        },
+        {   // 3 * 16^76 * G
+            LIMB_PAIR(0x92701A9A, 0xD142BFA9), LIMB_PAIR(0x47539E92, 0x0B59D014), LIMB_PAIR(0x8724475B, 0x7CEFEC6E), LIMB_PAIR(0xBCFD641F, 0x5C77D10D),
+            LIMB_PAIR(0xDD42EB47, 0x4946DBAB), LIMB_PAIR(0x14F1C33B, 0x4AE66C3A), LIMB_PAIR(0x4C9F2C71, 0x05BA3E75), LIMB_PAIR(0x1FC0F7B7, 0xB618A507), LIMB_PARTIAL(0x065),
+            LIMB_PAIR(0x7C169A16, 0xDD94EE05), LIMB_PAIR(0x5A337E5E, 0xA29E2619), LIMB_PAIR(0x9AD816B6, 0x30E106EB), LIMB_PAIR(0x1A17810A, 0xB91E66F7),
+            LIMB_PAIR(0x5B672E86, 0x46ABF80D), LIMB_PAIR(0xF89626FF, 0x0F40F077), LIMB_PAIR(0x8B67B224, 0xA474DFBE), LIMB_PAIR(0x8053AA79, 0x9D3AF924), LIMB_PARTIAL(0x1FF)
+        },
+        {   // 4 * 16^76 * G
+            LIMB_PAIR(0xF79421D8, 0xCFDC285D), LIMB_PAIR(0x8674686E, 0x26328998), LIMB_PAIR(0x1ED73CD0, 0xF991086E), LIMB_PAIR(0xA36BD06D, 0x65046369),
+            LIMB_PAIR(0x72ADCD0A, 0x9712BB0B), LIMB_PAIR(0x5FAF9C7C, 0x9B2D422F), LIMB_PAIR(0x51491C47, 0x7E3989F8), LIMB_PAIR(0x09AEEAD9, 0x9FC24BF8), LIMB_PARTIAL(0x029),
+            LIMB_PAIR(0x0370ACB9, 0x8584EE84), LIMB_PAIR(0xEA40417D, 0xED56C569), LIMB_PAIR(0x57B4CB9A, 0x64435875), LIMB_PAIR(0x91D35C5F, 0x752C5FA6),
+            LIMB_PAIR(0xABD0EB6F, 0xBBCF8703), LIMB_PAIR(0xC233DB59, 0x0DD72D15), LIMB_PAIR(0x692BAAE3, 0xF2B7A1AB), LIMB_PAIR(0x7BAADFBE, 0x6EE63437), LIMB_PARTIAL(0x111)
+        },
+        {   // 5 * 16^76 * G
+            LIMB_PAIR(0x7938D98E, 0x97DEFE3D), LIMB_PAIR(0xFD0BEC69, 0xE2458FEA), LIMB_PAIR(0x8B42DDBB, 0x7DF8D2B5), LIMB_PAIR(0xFF39914C, 0xA82AAB40),
+            LIMB_PAIR(0xD30F07E6, 0x78549B01), LIMB_PAIR(0x1331557E, 0x253F8C46), LIMB_PAIR(0x19648CCE, 0x771750D9), LIMB_PAIR(0xD045BC36, 0x96AD6776), LIMB_PARTIAL(0x0F2),
+            LIMB_PAIR(0xE08B83F8, 0x4A2EE334), LIMB_PAIR(0x2E3086DE, 0x3E9C4CB7), LIMB_PAIR(0x9936BAB0, 0x913EAE4B), LIMB_PAIR(0xD23CD36A, 0x3CF83551),
+            LIMB_PAIR(0xDFD27D4A, 0x7C51D84A), LIMB_PAIR(0x4D006EDD, 0x2595A90F), LIMB_PAIR(0x61CC7BE7, 0xB2D5C684), LIMB_PAIR(0xA4B310F9, 0xBB02BD59), LIMB_PARTIAL(0x18A)
+        },
+        {   // 6 * 16^76 * G
+            LIMB_PAIR(0x8EFB0157, 0xCAA72706), LIMB_PAIR(0xF08F035C, 0x713A7F37), LIMB_PAIR(0xAA4FD5E2, 0xFF58C6A1), LIMB_PAIR(0x00A48205, 0x760B0660),
+            LIMB_PAIR(0x55F07CB4, 0x4A39E666), LIMB_PAIR(0x67558061, 0x0F6BEDAC), LIMB_PAIR(0x66A118FD, 0x9EAA88C2), LIMB_PAIR(0x97D29CA9, 0x8D9EA75C), LIMB_PARTIAL(0x190),
+            LIMB_PAIR(0xBC6094F3, 0x50A4BC7A), LIMB_PAIR(0x68F17D91, 0x105120CE), LIMB_PAIR(0x4E559F9A, 0x514FDECA), LIMB_PAIR(0xE8D688CA, 0x414F4C0E),
+            LIMB_PAIR(0x24DE5AC2, 0x1B915554), LIMB_PAIR(0x298823DB, 0x5D983C0E), LIMB_PAIR(0x43264448, 0xA5373212), LIMB_PAIR(0x86EEDE9B, 0x4BAF77E9), LIMB_PARTIAL(0x1CD)
+        },
+        {   // 7 * 16^76 * G
+            LIMB_PAIR(0x3110EF21, 0x47212CD8), LIMB_PAIR(0x7DAB31DA, 0x351356CA), LIMB_PAIR(0x777A302F, 0x5C31ADD7), LIMB_PAIR(0xDC66A1C6, 0x44844EB4),
+            LIMB_PAIR(0x28384807, 0x559F3FB4), LIMB_PAIR(0xFF78DEE6, 0x95DAB974), LIMB_PAIR(0xFB20857B, 0x2FE12E92), LIMB_PAIR(0xEF499BBA, 0x41436000), LIMB_PARTIAL(0x106),
+            LIMB_PAIR(0x9DF7B969, 0x5E0E5F36), LIMB_PAIR(0xDC819D59, 0x2C96F308), LIMB_PAIR(0x11CF4119, 0x3258DB74), LIMB_PAIR(0x76676D2F, 0x6246DA54),
+            LIMB_PAIR(0xCA079F54, 0x5BE278CF), LIMB_PAIR(0x6E36452F, 0x61AB6EB0), LIMB_PAIR(0x461FC9A3, 0xE7742741), LIMB_PAIR(0x6A926FE5, 0x252FB638), LIMB_PARTIAL(0x171)
+        },
+        {   // 8 * 16^76 * G
+            LIMB_PAIR(0x38693D3A, 0x70C5ACDC), LIMB_PAIR(0x38F054F9, 0x9EDEE682), LIMB_PAIR(0x2960CEEE, 0x16E053F2), LIMB_PAIR(0x28BFE7B1, 0x5926857C),
+            LIMB_PAIR(0x6145F8D1, 0xB9F7420E), LIMB_PAIR(0x9C0298EF, 0x9E0C42F5), LIMB_PAIR(0xDD7D9FC6, 0x50B7210E), LIMB_PAIR(0xD7BE096F, 0xF9E4BD53), LIMB_PARTIAL(0x078),
+            LIMB_PAIR(0xED19FC57, 0x428C2455), LIMB_PAIR(0x56AA75DB, 0x9E8F777D), LIMB_PAIR(0xA671D991, 0x4CAEBA30), LIMB_PAIR(0xEAE0F53E, 0x5F927D79),
+            LIMB_PAIR(0x9E4C2A5B, 0x00D6AD36), LIMB_PAIR(0xA2E12D0A, 0xC8811438), LIMB_PAIR(0xB2AEB4B1, 0xA36D664E), LIMB_PAIR(0x929A8748, 0x74E76676), LIMB_PARTIAL(0x191)
+        }
+    },
+#endif
+#if (77 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^77 * G
+            LIMB_PAIR(0x67DB4570, 0x358EB536), LIMB_PAIR(0x685FA5BA, 0xAED3F999), LIMB_PAIR(0xCB571FCA, 0x4593C950), LIMB_PAIR(0x0411DC5D, 0xDFF7278C),
+            LIMB_PAIR(0x3BFE7E51, 0xD62A4464), LIMB_PAIR(0x49F6F05A, 0x53B87CA2), LIMB_PAIR(0xF2C3D2DC, 0x72327899), LIMB_PAIR(0x9DF4DA5E, 0xBAA194AA), LIMB_PARTIAL(0x0C7),
+            LIMB_PAIR(0xB50A3E06, 0x3E73ACCF), LIMB_PAIR(0x0754F2FD, 0x0D8EBEE3), LIMB_PAIR(0x4B3F3FD1, 0x3CD0AE95), LIMB_PAIR(0xC08BB2DB, 0xC4A4EEE0),
+            LIMB_PAIR(0x19D71E5D, 0x79552963), LIMB_PAIR(0x872E35C9, 0xF91E1AB7), LIMB_PAIR(0xF6C102AF, 0xC85090F6), LIMB_PAIR(0x1E42A1BA, 0x8EDF8C5D), LIMB_PARTIAL(0x179)
+        },
+        {   // 2 * 16^77 * G
+            LIMB_PAIR(0xF33C5A4A, 0x56923E55), LIMB_PAIR(0x829A3C22, 0x1C5624EC), LIMB_PAIR(0x70000295, 0xED234E38), LIMB_PAIR(0xEDF3FF42, 0xA8467561),
+            LIMB_PAIR(0x9CEC9497, 0x717A939E), LIMB_PAIR(0x4E6BE199, 0xF80E2802), LIMB_PAIR(0x06FA7B8F, 0x5023BBEC), LIMB_PAIR(0xDD95C07B, 0x16E26A9D), LIMB_PARTIAL(0x0FD),
+            LIMB_PAIR(0x3C3485E4, 0x88091D67), LIMB_PAIR(0xD40B6B47, 0x0377260F), LIMB_PAIR(0x16F7B3AB, 0x6D9C6DF4), LIMB_PAIR(0xF71B1FDD, 0x65376516),
+            LIMB_PAIR(0x91956D40, 0x89CC11F9), LIMB_PAIR(0x807610B8, 0x58992A09), LIMB_PAIR(0xB2799C7E, 0xDEB47AA2), LIMB_PAIR(0x8A327765, 0x3EE5834C), LIMB_PARTIAL(0x12A)
+        },
+        {   // 3 * 16^77 * G
+            LIMB_PAIR(0x80905A7A, 0x421B840E), LIMB_PAIR(0x94B48CBC, 0x97C7F1D3), LIMB_PAIR(0x3B79F360, 0x421A2384), LIMB_PAIR(0xEAF59EF3, 0x1121A2D8),
+            LIMB_PAIR(0x59FB65D3, 0xDDBE9D99), LIMB_PAIR(0x71D9D306, 0x6AD2BE23), LIMB_PAIR(0x789AF534, 0x36FA0077), LIMB_PAIR(0x8013DC59, 0xB928A6E7), LIMB_PARTIAL(0x17B),
+            LIMB_PAIR(0xA38D78E5, 0xB4C26798), LIMB_PAIR(0x4CF38545, 0x8884DD39), LIMB_PAIR(0x12A2023B, 0xB74DD461), LIMB_PAIR(0x4133277D, 0x1B242F85),
+            LIMB_PAIR(0xD29D7071, 0x401D32F2), LIMB_PAIR(0x3D2E2A0C, 0xCD7C9AA4), LIMB_PAIR(0x06BA6AD8, 0x9DF2157E), LIMB_PAIR(0x80E2C3C5, 0x749BFC4C), LIMB_PARTIAL(0x18B)
+        },
+        {   // 4 * 16^77 * G
+            LIMB_PAIR(0xEFFB980A, 0xCCF8B57A), LIMB_PAIR(0xD0108B23, 0x82EA22F5), LIMB_PAIR(0x6C902061, 0xCAB6A69F), LIMB_PAIR(0x43663F25, 0x7A3D74D8),
+            LIMB_PAIR(0x0AD5DF2D, 0xB12CA29A), LIMB_PAIR(0x2F9FB277, 0x9D3EBBEB), LIMB_PAIR(0x89BC5273, 0x6F975E21), LIMB_PAIR(0x0929DECE, 0x75E8BF95), LIMB_PARTIAL(0x0A9),
+            LIMB_PAIR(0xE1AF64E4, 0x14493740), LIMB_PAIR(0x109961DF, 0x9CE3AE66), LIMB_PAIR(0xE31F4FFD, 0x36651BB7), LIMB_PAIR(0xFF1FCFE2, 0x18B7131C),
+            LIMB_PAIR(0x085A67B7, 0xDED3378B), LIMB_PAIR(0x6E283271, 0x28EFB289), LIMB_PAIR(0x73427AC3, 0xB66DEB9A), LIMB_PAIR(0xA9BAA451, 0x3C5FD6D2), LIMB_PARTIAL(0x1B3)
+        },
+        {   // 5 * 16^77 * G
+            LIMB_PAIR(0x62EFD94D, 0xEC1F6A57), LIMB_PAIR(0x7B95536C, 0x1D80B5E8), LIMB_PAIR(0xAF47E2B4, 0x01F8BA60), LIMB_PAIR(0xA3B0E6D0, 0x6E8AE542),
+            LIMB_PAIR(0xE45FEFB7, 0x5ECB52D9), LIMB_PAIR(0x327299A8, 0x2108032A), LIMB_PAIR(0x044ED33F, 0xC49FC5C5), LIMB_PAIR(0x52CD0833, 0xD1FD0837), LIMB_PARTIAL(0x0E1),
+            LIMB_PAIR(0xCDAD11AC, 0x3F6AE9B6), LIMB_PAIR(0x13BB828B, 0xAD3F0FA8), LIMB_PAIR(0x6FF056E1, 0x81262681), LIMB_PAIR(0xA73196CF, 0x2FD37492),
+            LIMB_PAIR(0xDF90D5F4, 0x172BEB76), LIMB_PAIR(0x66144036, 0x63F2C6E4), LIMB_PAIR(0x57F6D086, 0x3E1F4974), LIMB_PAIR(0xFB6EB366, 0x5E0D8E49), LIMB_PARTIAL(0x095)
+        },
+        {   // 6 * 16^77 * G
+            LIMB_PAIR(0x5E2D7653, 0x611F4A79), LIMB_PAIR(0xCEEBB0A9, 0x966E843C), LIMB_PAIR(0x06E8A15D, 0x2E358CF5), LIMB_PAIR(0x40A74FC7, 0x2CE41DC7),
+            LIMB_PAIR(0x5EB455B2, 0xA2FDEA4F), LIMB_PAIR(0x120FA4D4, 0xBBBD718F), LIMB_PAIR(0x030FFF11, 0x210BFF82), LIMB_PAIR(0xA68B00A0, 0x5A1B943A), LIMB_PARTIAL(0x02A),
+            LIMB_PAIR(0xFF037BE3, 0xEB814A67), LIMB_PAIR(0x69F52C59, 0x3B082204), LIMB_PAIR(0x74FF3224, 0x3F72143E), LIMB_PAIR(0x36F89AED, 0xE7E85CC4),
+            LIMB_PAIR(0xCAAF314B, 0x2AFCBE04), LIMB_PAIR(0xBF93FD35, 0xF8C8BB32), LIMB_PAIR(0xAC1DAE25, 0xE41F8328), LIMB_PAIR(0xBDEB2001, 0x5318C6D7), LIMB_PARTIAL(0x0F5)
+        },
+        {   // 7 * 16^77 * G
+            LIMB_PAIR(0x95989889, 0x630190BB), LIMB_PAIR(0x4E659DD2, 0xE041DA50), LIMB_PAIR(0x5DF8E753, 0x5D88D99B), LIMB_PAIR(0x5AC2E158, 0xDBAC2544),
+            LIMB_PAIR(0x699EDA49, 0x1FF6ECE7), LIMB_PAIR(0x1051BD60, 0x3D0860A2), LIMB_PAIR(0x40C3A989, 0xD4D86857), LIMB_PAIR(0x4002D915, 0x2BFCC26C), LIMB_PARTIAL(0x12A),
+            LIMB_PAIR(0x2F4ACC7F, 0x0C43772C), LIMB_PAIR(0xE3753D32, 0x54963F2F), LIMB_PAIR(0x65DC40E8, 0xC699BE87), LIMB_PAIR(0x81560A01, 0x6DBC95AD),
+            LIMB_PAIR(0x1DEDF025, 0xC805D741), LIMB_PAIR(0x77FA74C6, 0x46B049C1), LIMB_PAIR(0x288C1133, 0x7C0F62FB), LIMB_PAIR(0xE6F066BA, 0xA8A2E1F9), LIMB_PARTIAL(0x1FE)
+        },
+        {   // 8 * 16^77 * G
+            LIMB_PAIR(0x1B72E95C, 0xCE24D42C), LIMB_PAIR(0xEAB74B64, 0x7FA4289B), LIMB_PAIR(0x523FC1E5, 0x42BA739E), LIMB_PAIR(0x814C4FC8, 0x9293167B),
+            LIMB_PAIR(0x8623DB10, 0x4418FBFD), LIMB_PAIR(0x76A132B6, 0xB079853F), LIMB_PAIR(0xBF394947, 0xEC5BAD8A), LIMB_PAIR(0xE7B0A665, 0xC78E5748), LIMB_PARTIAL(0x169),
+            LIMB_PAIR(0xD7EBA9CE, 0x6038AD95), LIMB_PAIR(0x572F3671, 0x421ECDC9), LIMB_PAIR(0x60BC3CFC, 0xC6B7EFFC), LIMB_PAIR(0xA48FD001, 0x2C4B7B77),
+            LIMB_PAIR(0xD57795E8, 0x80280EC9), LIMB_PAIR(0x3A7F6D67, 0x350815C9), LIMB_PAIR(0x7DA13B86, 0xCE30BCDD), LIMB_PAIR(0x23C894D8, 0xE36DA7B1), LIMB_PARTIAL(0x0C9)
+        }
+    },
+#endif
+#if (78 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^78 * G
+            LIMB_PAIR(0x853572E7, 0x92401AB5), LIMB_PAIR(0xEDDEA020, 0x957D2CA6), LIMB_PAIR(0x3F9FBD6F, 0x7D54DD65), LIMB_PAIR(0x2E05D05D, 0xAD0C7D09),
+            LIMB_PAIR(0x04183B30, 0x6656FBAB), LIMB_PAIR(0x0B716D5B, 0x543B5017), LIMB_PAIR(0x9857D796, 0x2481449D), LIMB_PAIR(0xE3A39722, 0x86173B6D), LIMB_PARTIAL(0x05D),
+            LIMB_PAIR(0xE71E511D, 0x7130D0CA), LIMB_PAIR(0x35663592, 0x168EF9D9), LIMB_PAIR(0xADBF816F, 0x63A9936E), LIMB_PAIR(0xD4F7A44A, 0xAF63EE57),
+            LIMB_PAIR(0xCD0EA152, 0x59F21032), LIMB_PAIR(0xA881056F, 0x2F552046), LIMB_PAIR(0x21BA6BF5, 0x26EDA9A6), LIMB_PAIR(0xD0A0CAF9, 0xE75991C7), LIMB_PARTIAL(0x04C)
+        },
+        {   // 2 * 16^78 * G
+            LIMB_PAIR(0x5E3CED2B, 0xED90E62B), LIMB_PAIR(0x5A919213, 0x160214BB), LIMB_PAIR(0x8CB4FC2D, 0xDFB8AC07), LIMB_PAIR(0xEA384DB0, 0xEA5AA6E7),
+            LIMB_PAIR(0xF916FB11, 0xC9492ED2), LIMB_PAIR(0x1305BD78, 0xF40CECCE), LIMB_PAIR(0x3F28555E, 0xB98AF501), LIMB_PAIR(0x68417D62, 0x4E9F84B2), LIMB_PARTIAL(0x14E),
+            LIMB_PAIR(0xAC7DF2E2, 0xBE791FEA), LIMB_PAIR(0xE745BA60, 0x15C9429C), LIMB_PAIR(0x198A2D50, 0xB02C1705), LIMB_PAIR(0x9B6E6A44, 0x0A67CDCE),
+            LIMB_PAIR(0x5AD00221, 0x64050629), LIMB_PAIR(0x2B314076, 0x75620EA8), LIMB_PAIR(0x87B02AEC, 0x64C89EAD), LIMB_PAIR(0xA92113EC, 0x0E5FF515), LIMB_PARTIAL(0x1CA)
+        },
+        {   // 3 * 16^78 * G
+            LIMB_PAIR(0x01ECEA43, 0x52A60DA4), LIMB_PAIR(0x41BF6835, 0x00E1AB14), LIMB_PAIR(0xDD97B88A, 0x785545CA), LIMB_PAIR(0xD2F2894E, 0xE2BC1326),
+            LIMB_PAIR(0xE398BF19, 0x3C730457), LIMB_PAIR(0x1BDD3170, 0xA4C29753), LIMB_PAIR(0x92EC7E73, 0x7F01A084), LIMB_PAIR(0x24BB9D11, 0x54D483B8), LIMB_PARTIAL(0x05A),
+            LIMB_PAIR(0xBEEA4DD5, 0xEDC13DD6), LIMB_PAIR(0x125EC53A, 0xBCECC285), LIMB_PAIR(0x5BCD72CC, 0x8B7DE1BA), LIMB_PAIR(0xDDBBC9B6, 0x1853DBCC),
+            LIMB_PAIR(0x8F47FC1E, 0x799B97B2), LIMB_PAIR(0x176CCE73, 0xC01253B8), LIMB_PAIR(0x5430BF2E, 0xAB6C5FDD), LIMB_PAIR(0xCF5B31E6, 0xF9250653), LIMB_PARTIAL(0x042)
+        },
+        {   // 4 * 16^78 * G
+            LIMB_PAIR(0x13CC2875, 0xC0711572), LIMB_PAIR(0x6EC01830, 0x42258313), LIMB_PAIR(0x01E95528, 0x32CFEF41), LIMB_PAIR(0xAF8116B4, 0xA8741CA0),
+            LIMB_PAIR(0x58F1FA26, 0x3195F7F3), LIMB_PAIR(0x1144142B, 0xF2E96928), LIMB_PAIR(0x6B179BF4, 0x5A9C331F), LIMB_PAIR(0x36C6C42F, 0x45E363F2), LIMB_PARTIAL(0x057),
+            LIMB_PAIR(0x2C04C8AE, 0xBE2E55F1), LIMB_PAIR(0x3AF16430, 0xA522F7D5), LIMB_PAIR(0x2904630C, 0xEAE2B2C4), LIMB_PAIR(0x8E151736, 0x58F5C76E),
+            LIMB_PAIR(0x5AEE8E9E, 0xDFA21EA6), LIMB_PAIR(0x81717F92, 0x103B7AD6), LIMB_PAIR(0x9B4464EE, 0xA89E274A), LIMB_PAIR(0x2DAA3259, 0x316F580F), LIMB_PARTIAL(0x04E)
+        },
+        {   // 5 * 16^78 * G
+            LIMB_PAIR(0xADA6FDE2, 0x7BD03EFE), LIMB_PAIR(0x33D65185, 0xBBE77A69), LIMB_PAIR(0xDA2DB001, 0xA23A4C71), LIMB_PAIR(0x32A63515, 0x3ED58B43),
+            LIMB_PAIR(0x80DB0330, 0x3AE797B5), LIMB_PAIR(0xBBE686E0, 0x73B1113C), LIMB_PAIR(0x01CAC265, 0x08F4630F), LIMB_PAIR(0x2471F057, 0x2C06080D), LIMB_PARTIAL(0x084),
+            LIMB_PAIR(0xD72ECD49, 0x575BFD8C), LIMB_PAIR(0x056FF098, 0x67E84670), LIMB_PAIR(0x255B8EAC, 0x01FA38E5), LIMB_PAIR(0xE9233746, 0x0B7B82DC),
+            LIMB_PAIR(0xB8093F35, 0x057D4FD9), LIMB_PAIR(0x4FFA1D03, 0x9C755197), LIMB_PAIR(0x4B535517, 0xEFB21A91), LIMB_PAIR(0x0BC11412, 0xBED68EDE), LIMB_PARTIAL(0x0B8)
+        },
+        {   // 6 * 16^78 * G
+            LIMB_PAIR(0xD19537DF, 0xDE9D3C54), LIMB_PAIR(0xE0F7F823, 0xCDB1E152), LIMB_PAIR(0x15D22C6B, 0x86B981C0), LIMB_PAIR(0xF73DBB0E, 0xAD513642),
+            LIMB_PAIR(0x28A57165, 0xB98B75B4), LIMB_PAIR(0x5BC5362E, 0xE7F67AC0), LIMB_PAIR(0x7E87737A, 0xE6C84266), LIMB_PAIR(0x9500E486, 0x441CB5C7), LIMB_PARTIAL(0x1B9),
+            LIMB_PAIR(0xA90102C4, 0x0318E774), LIMB_PAIR(0xFCFA8DF4, 0xFF234D09), LIMB_PAIR(0x5CC3D689, 0x12EF1F67), LIMB_PAIR(0xF3D6891F, 0x1B8B92C6),
+            LIMB_PAIR(0xB11B3D7A, 0x77E4DDC0), LIMB_PAIR(0xAC47EEA1, 0x950AB55F), LIMB_PAIR(0x6DC155F6, 0x1C3D56A7), LIMB_PAIR(0x00B560D8, 0xF70100C4), LIMB_PARTIAL(0x0B0)
+        },
+        {   // 7 * 16^78 * G
+            LIMB_PAIR(0xD1C08EFE, 0xD4F24879), LIMB_PAIR(0x9ADA24B4, 0xA5E9BA05), LIMB_PAIR(0x084971F1, 0xD2CDF316), LIMB_PAIR(0xDDA81C06, 0x51B2C138),
+            LIMB_PAIR(0xD2115D16, 0x50DEA9BB), LIMB_PAIR(0x272B0ECC, 0xD472424C), LIMB_PAIR(0x3513E8EF, 0x4A7B5644), LIMB_PAIR(0x3277134C, 0x4A64F0FC), LIMB_PARTIAL(0x04A),
+            LIMB_PAIR(0x507427FA, 0x7AE9BAA3), LIMB_PAIR(0x96D38106, 0x1AEA2A49), LIMB_PAIR(0x95F53E5A, 0x0209A4E9), LIMB_PAIR(0x9F87AA0D, 0x2A6D84AD),
+            LIMB_PAIR(0x47769D56, 0xC00B858B), LIMB_PAIR(0xB64A452F, 0x42F17CD2), LIMB_PAIR(0xCE95AA06, 0x58A23140), LIMB_PAIR(0x418F5F55, 0xDB36A78A), LIMB_PARTIAL(0x01D)
+        },
+        {   // 8 * 16^78 * G
+            LIMB_PAIR(0xEC3D1383, 0xD1CE126E), LIMB_PAIR(0x4805B18E, 0x0C7F980A), LIMB_PAIR(0xFC1B1F4E, 0x65945086), LIMB_PAIR(0x092E0CA0, 0xAC1703AE),
+            LIMB_PAIR(0x8B5EE5C0, 0x834C77F9), LIMB_PAIR(0x6D19FBB5, 0x3E722F57), LIMB_PAIR(0xF6770BD1, 0xAE8A944A), LIMB_PAIR(0x2A7C7101, 0xE1D11050), LIMB_PARTIAL(0x0D7),
+            LIMB_PAIR(0xCA303000, 0x62029FD2), LIMB_PAIR(0xACB52ECD, 0x366C72C9), LIMB_PAIR(0xCC8DD8A2, 0xCF89C1AA), LIMB_PAIR(0x5D1B984D, 0x95C235BF),
+            LIMB_PAIR(0xD1A80D52, 0x3434D10D), LIMB_PAIR(0x77E95ADD, 0x094D0A8F), LIMB_PAIR(0xD1203660, 0x03890027), LIMB_PAIR(0x29791AB3, 0x32FAF273), LIMB_PARTIAL(0x075)
+        }
+    },
+#endif
+#if (79 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^79 * G
+            LIMB_PAIR(0xA03EFD8C, 0x18CADDDD), LIMB_PAIR(0xAEB3A762, 0x9D59BB52), LIMB_PAIR(0xD1FD3F91, 0x571D86BE), LIMB_PAIR(0xD2F26D6D, 0x81642AA1),
+            LIMB_PAIR(0x99877251, 0x7D1C3BC9), LIMB_PAIR(0xD7C2FD25, 0x0518EFF8), LIMB_PAIR(0x37B6C641, 0x6A54F170), LIMB_PAIR(0x0D33A426, 0x8FFEDFC0), LIMB_PARTIAL(0x0C8),
+            LIMB_PAIR(0xBB54847B, 0xACF67416), LIMB_PAIR(0xF2B54B28, 0xA293A8D7), LIMB_PAIR(0x1F7F6B47, 0x32F2B11A), LIMB_PAIR(0xC6D67A9D, 0xC11948BC),
+            LIMB_PAIR(0x47623783, 0xC8B86B1F), LIMB_PAIR(0x5C2362E6, 0x357326AA), LIMB_PAIR(0x6CF79126, 0xC298BE1B), LIMB_PAIR(0x84C5A79C, 0xF07B3EA7), LIMB_PARTIAL(0x06C)
+        },
+        {   // 2 * 16^79 * G
+            LIMB_PAIR(0x20210875, 0x43798977), LIMB_PAIR(0xD58004C6, 0x8E95AB32), LIMB_PAIR(0xC68A6AA7, 0x33058F96), LIMB_PAIR(0x914082E8, 0x2DB1FDB8),
+            LIMB_PAIR(0x93E12423, 0x7841A489), LIMB_PAIR(0x1F9D2FF5, 0x051A4E15), LIMB_PAIR(0x4DA88E65, 0x618EEAC5), LIMB_PAIR(0x512C1795, 0xC52113CD), LIMB_PARTIAL(0x1B5),
+            LIMB_PAIR(0xE93AF674, 0xB6DACE96), LIMB_PAIR(0xEDB5C3F6, 0x4EA1073B), LIMB_PAIR(0xA0B861D8, 0x4352509F), LIMB_PAIR(0x7ADB5CFB, 0x05451D6F),
+            LIMB_PAIR(0x9A3375D9, 0x194E3ACD), LIMB_PAIR(0x33658D41, 0x6258A5AB), LIMB_PAIR(0xF542A8D8, 0x2BC60CB7), LIMB_PAIR(0x74AFE0CF, 0x68E50E5A), LIMB_PARTIAL(0x187)
+        },
+        {   // 3 * 16^79 * G
+            LIMB_PAIR(0x5A0C9415, 0x5EBBD701), LIMB_PAIR(0x29572D13, 0x7BCEF0E2), LIMB_PAIR(0x3F5A169B, 0x539A7813), LIMB_PAIR(0xBAC0ABFA, 0x6F3A84A4),
+            LIMB_PAIR(0xEA1D0B7A, 0x822DA09B), LIMB_PAIR(0x05C00DBF, 0x9B2D6A6C), LIMB_PAIR(0xCD8C7E6E, 0x134FE65D), LIMB_PAIR(0x6301E4CA, 0xE4622A9F), LIMB_PARTIAL(0x1FF),
+            LIMB_PAIR(0x073963DD, 0x5FBEB1F8), LIMB_PAIR(0xE595AAD8, 0xCCA648B0), LIMB_PAIR(0x3D15C1D4, 0x5CC97E77), LIMB_PAIR(0x62989B5E, 0xF2D76970),
+            LIMB_PAIR(0x8AFE8351, 0xF321C0C7), LIMB_PAIR(0x93A60C7B, 0xBF361AA2), LIMB_PAIR(0x74C2503A, 0xD9938C11), LIMB_PAIR(0xE409747A, 0xB05DAAA5), LIMB_PARTIAL(0x008)
+        },
+        {   // 4 * 16^79 * G
+            LIMB_PAIR(0x9D2224B8, 0xC4387644), LIMB_PAIR(0x563094E8, 0x80C92AC5), LIMB_PAIR(0xF6D0542E, 0xEF919BDB), LIMB_PAIR(0x5C40A787, 0xC71A882D),
+            LIMB_PAIR(0x0880C1B1, 0xDB3851BE), LIMB_PAIR(0x287CAE73, 0x4F72FF0C), LIMB_PAIR(0x2BF3EFE6, 0x0A628F17), LIMB_PAIR(0x0150E4A7, 0x29DB6924), LIMB_PARTIAL(0x175),
+            LIMB_PAIR(0xCC367287, 0x7983F80A), LIMB_PAIR(0xC4633183, 0xFE2C8F3D), LIMB_PAIR(0xAE89F8C9, 0x41B0E222), LIMB_PAIR(0xEB58AC1E, 0x93FDD59B),
+            LIMB_PAIR(0x97538725, 0x5EE164C7), LIMB_PAIR(0x7591FB4E, 0xB8E3B75B), LIMB_PAIR(0x355A6A6C, 0xA2D0FA2E), LIMB_PAIR(0x0405F33A, 0x391A0554), LIMB_PARTIAL(0x0E6)
+        },
+        {   // 5 * 16^79 * G
+            LIMB_PAIR(0x0254D2D3, 0xFDE8D0ED), LIMB_PAIR(0xF24357A8, 0xDC6868C5), LIMB_PAIR(0x26106991, 0x1806776F), LIMB_PAIR(0x387D0F81, 0xA3A1446D),
+            LIMB_PAIR(0x19591FDC, 0xEB83F7B3), LIMB_PAIR(0x136E098C, 0x97678D46), LIMB_PAIR(0x42E7487F, 0x89292AD3), LIMB_PAIR(0xB3C12865, 0x53B24C0A), LIMB_PARTIAL(0x0B3),
+            LIMB_PAIR(0x7A74E056, 0x06FC68F3), LIMB_PAIR(0x9D0DD6D1, 0x10354BAE), LIMB_PAIR(0x67092C45, 0x713509D9), LIMB_PAIR(0x52C97523, 0x5DDD0FBA),
+            LIMB_PAIR(0x4616EAF9, 0x421E8160), LIMB_PAIR(0xA795B907, 0xACAF5CF0), LIMB_PAIR(0xBEB5A28C, 0x1CA067C8), LIMB_PAIR(0xB79CEA20, 0xE07CBBCD), LIMB_PARTIAL(0x179)
+        },
+        {   // 6 * 16^79 * G
+            LIMB_PAIR(0x456925A5, 0xCC511EFE), LIMB_PAIR(0xF0A1B7E2, 0x4290A6E5), LIMB_PAIR(0x8756548B, 0x1705DCCE), LIMB_PAIR(0xB509C290, 0x4C139046),
+            LIMB_PAIR(0x4CD17379, 0x9D0BB084), LIMB_PAIR(0xDE17E05E, 0x4643B4BA), LIMB_PAIR(0x5F7100F2, 0x12BE04C3), LIMB_PAIR(0x79197058, 0x3CE44594), LIMB_PARTIAL(0x191),
+            LIMB_PAIR(0xF32703CD, 0x065C3E87), LIMB_PAIR(0x11390895, 0x5AE023CC), LIMB_PAIR(0xC01552A3, 0xD2A40ECA), LIMB_PAIR(0x88EE5054, 0xFCD13822),
+            LIMB_PAIR(0x73498D40, 0xF61CA6F7), LIMB_PAIR(0x0DD5E19A, 0x2A4653BE), LIMB_PAIR(0xF88E9AF1, 0xA56016EE), LIMB_PAIR(0xA73E0E21, 0xBD5C973A), LIMB_PARTIAL(0x0F0)
+        },
+        {   // 7 * 16^79 * G
+            LIMB_PAIR(0x1DF30301, 0x72E34849), LIMB_PAIR(0xA7AE2709, 0x71BA20A6), LIMB_PAIR(0xEAC84515, 0x2AC2B9E7), LIMB_PAIR(0x684FDD3D, 0x7DB23E2C),
+            LIMB_PAIR(0xB1B07C3B, 0xB7FF18F9), LIMB_PAIR(0x22F64D40, 0x296F8054), LIMB_PAIR(0xACA26121, 0xE7E74E51), LIMB_PAIR(0xA4ABF51A, 0x2382BAEB), LIMB_PARTIAL(0x04F),
+            LIMB_PAIR(0xA03677F6, 0x076D34BB), LIMB_PAIR(0x6484F153, 0x42BCC9C7), LIMB_PAIR(0xD74DD1BB, 0x7B5FD617), LIMB_PAIR(0x797CF9D5, 0x1BA3E99C),
+            LIMB_PAIR(0x87403DC5, 0xA9078007), LIMB_PAIR(0xD6D1E062, 0x98278850), LIMB_PAIR(0x6CC37A89, 0x456314CA), LIMB_PAIR(0x0A6DAF4B, 0x3D3CFF1B), LIMB_PARTIAL(0x117)
+        },
+        {   // 8 * 16^79 * G
+            LIMB_PAIR(0x8CDFE07D, 0x088B099E), LIMB_PAIR(0xB905708E, 0x5A641CF1), LIMB_PAIR(0xA221B96A, 0xC281AF16), LIMB_PAIR(0xF622F5BF, 0x8BFA8DC0),
+            LIMB_PAIR(0x5ECB0216, 0x43287273), LIMB_PAIR(0x6DAB8B7B, 0x13EA7E4D), LIMB_PAIR(0x2212B506, 0xA478FB01), LIMB_PAIR(0xA0C1A955, 0xCB4BE166), LIMB_PARTIAL(0x1D3),
+            LIMB_PAIR(0xCF16C121, 0x38A2AA3D), LIMB_PAIR(0x7F8EED07, 0xCD70EA8A), LIMB_PAIR(0xE3A04C52, 0x54532CD7), LIMB_PAIR(0xBA78E53C, 0x8939F904),
+            LIMB_PAIR(0x8B563A91, 0xC0132C26), LIMB_PAIR(0xC093E75A, 0x6730A0FC), LIMB_PAIR(0x00FB49E3, 0x1E6D9616), LIMB_PAIR(0x28587059, 0x0AF2A79F), LIMB_PARTIAL(0x176)
+        }
+    },
+#endif
+#if (80 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^80 * G
+            LIMB_PAIR(0xAB9923D7, 0x5F47DDB9), LIMB_PAIR(0x8E3FAC52, 0x839865D4), LIMB_PAIR(0x647424B0, 0x0214E93F), LIMB_PAIR(0x31D65C6B, 0x266C909C),
+            LIMB_PAIR(0x51457FAC, 0x956DECA4), LIMB_PAIR(0xA85CE8A5, 0x8E8D240E), LIMB_PAIR(0xA4D9B281, 0x736652C4), LIMB_PAIR(0xB77A526D, 0x131A4191), LIMB_PARTIAL(0x08A),
+            LIMB_PAIR(0x32D8542E, 0xA8483195), LIMB_PAIR(0xC3F38387, 0x1F7A8E67), LIMB_PAIR(0xD6797F2E, 0x162AC248), LIMB_PAIR(0x0A6A1118, 0xD26469E1),
+            LIMB_PAIR(0xF203102D, 0xB33AFF1F), LIMB_PAIR(0xAADF0AE9, 0x63A52154), LIMB_PAIR(0x4BB313A7, 0xF0431DBB), LIMB_PAIR(0xCA9DA156, 0xF93C18FB), LIMB_PARTIAL(0x15C)
+        },
+        {   // 2 * 16^80 * G
+            LIMB_PAIR(0x9D53FF0E, 0x8A9E5665), LIMB_PAIR(0xC7CCBB62, 0xE4C4FCD2), LIMB_PAIR(0xB60B6FAB, 0x95A2B7A2), LIMB_PAIR(0x9242B4D1, 0xCF39FDE5),
+            LIMB_PAIR(0x5B49D9F2, 0x43983F30), LIMB_PAIR(0x220EC7BA, 0x4B5FECE7), LIMB_PAIR(0x221FB872, 0x10B1639C), LIMB_PAIR(0xF594795A, 0xF5955C1D), LIMB_PARTIAL(0x08C),
+            LIMB_PAIR(0xEB1EEA2C, 0x73DD1711), LIMB_PAIR(0x74F9E73C, 0xF027DAE2), LIMB_PAIR(0x89586CB5, 0x11C87D15), LIMB_PAIR(0x1380814F, 0x16BC03CF),
+            LIMB_PAIR(0x19693D82, 0xFBBBE67A), LIMB_PAIR(0x5B37AE4D, 0x9CA4B47E), LIMB_PAIR(0xDC7860A0, 0xAD59BEEE), LIMB_PAIR(0x599CA348, 0x46FF6DED), LIMB_PARTIAL(0x031)
+        },
+        {   // 3 * 16^80 * G
+            LIMB_PAIR(0xDB0B7846, 0xE5D80096), LIMB_PAIR(0x907BAE46, 0x1EC79296), LIMB_PAIR(0x362B9307, 0x6CB09D0D), LIMB_PAIR(0x2C89BA81, 0x76B5AC52),
+            LIMB_PAIR(0x7D83920B, 0x12D37CD2), LIMB_PAIR(0x8C031B82, 0x22A18F6B), LIMB_PAIR(0x93822770, 0x8C1BD009), LIMB_PAIR(0x7528177A, 0xF5F69926), LIMB_PARTIAL(0x1C1),
+            LIMB_PAIR(0xACB136B5, 0x1C08DB46), LIMB_PAIR(0x27D539F1, 0xD3BC1FE1), LIMB_PAIR(0x59AA9DDB, 0xD87F1073), LIMB_PAIR(0x7E8A3E33, 0xD8487FF9),
+            LIMB_PAIR(0x60581C89, 0x3FA1A3F1), LIMB_PAIR(0xA5980F30, 0xE0379485), LIMB_PAIR(0x6C7687E8, 0xE5D3C87E), LIMB_PAIR(0x5F6FF261, 0x6286E05D), LIMB_PARTIAL(0x155)
+        },
+        {   // 4 * 16^80 * G
+            LIMB_PAIR(0x8F87AE00, 0x47FE5151), LIMB_PAIR(0xB2D64637, 0xF49EBF83), LIMB_PAIR(0xA1E86582, 0x11ECA7B4), LIMB_PAIR(0xCBDE2995, 0x58BB53F9),
+            LIMB_PAIR(0x04AF7663, 0xA620BBA2), LIMB_PAIR(0x7221BC31, 0x2A01040D), LIMB_PAIR(0xA243AC9F, 0x1734531D), LIMB_PAIR(0x117D06E9, 0x1DCB67D6), LIMB_PARTIAL(0x1AC),
+            LIMB_PAIR(0x43275FFD, 0x5BB6699B), LIMB_PAIR(0x3BFEA061, 0x4B141BE7), LIMB_PAIR(0xDAE58347, 0x805D08B0), LIMB_PAIR(0x21EE35AF, 0xBBBBBAE3),
+            LIMB_PAIR(0xEF02B56D, 0xFA863BAF), LIMB_PAIR(0xB35E5127, 0x21460360), LIMB_PAIR(0xDACDD7B7, 0xB64A8AC4), LIMB_PAIR(0x92B58B6A, 0x51582B4F), LIMB_PARTIAL(0x172)
+        },
+        {   // 5 * 16^80 * G
+            LIMB_PAIR(0x2E769805, 0x1C30F6C0), LIMB_PAIR(0x741916E0, 0xF4BA830A), LIMB_PAIR(0x9A7F97D7, 0x6D44914E), LIMB_PAIR(0x2A5220CC, 0x873BE2FE),
+            LIMB_PAIR(0x77F0CD9A, 0x6C349086), LIMB_PAIR(0x5725527A, 0xA11F9DAA), LIMB_PAIR(0xBCBB7F2C, 0xF691B79B), LIMB_PAIR(0x316C9811, 0x0C9D568B), LIMB_PARTIAL(0x09C),
+            LIMB_PAIR(0x0F75AE83, 0xA0333545), LIMB_PAIR(0x507B1783, 0x904E5959), LIMB_PAIR(0xD4DBD664, 0x92110DBD), LIMB_PAIR(0x061CC502, 0x767CFDAB),
+            LIMB_PAIR(0xAA2A0300, 0x3771EA16), LIMB_PAIR(0x35C82065, 0x3D8CFDCC), LIMB_PAIR(0xBA413636, 0x1E0AFA55), LIMB_PAIR(0x1F73EF3B, 0x5C1D5F58), LIMB_PARTIAL(0x19B)
+        },
+        {   // 6 * 16^80 * G
+            LIMB_PAIR(0x39741A2B, 0x93D3BCE0), LIMB_PAIR(0x4061AB7C, 0xB01D4C3C), LIMB_PAIR(0x3EB73F51, 0x35414F12), LIMB_PAIR(0x3AB93C71, 0x11E8D450),
+            LIMB_PAIR(0x854D537E, 0x267B1285), LIMB_PAIR(0xCB8C4C60, 0xB01F7B95), LIMB_PAIR(0xDDADE44D, 0x88A4E72E), LIMB_PAIR(0xD3DCF9AE, 0x02B12BBA), LIMB_PARTIAL(0x049),
+            LIMB_PAIR(0x421E0A96, 0xE2AAAC37), LIMB_PAIR(0xDBC73078, 0x38E4380E), LIMB_PAIR(0xC671400A, 0x27D85636), LIMB_PAIR(0x31CC2FDB, 0x1A11C616),
+            LIMB_PAIR(0x8D500BC8, 0xB30DA04A), LIMB_PAIR(0x2A8D7E73, 0xFC6D9651), LIMB_PAIR(0x53481B0F, 0x94DB2D96), LIMB_PAIR(0x85807051, 0x44BBAF96), LIMB_PARTIAL(0x190)
+        },
+        {   // 7 * 16^80 * G
+            LIMB_PAIR(0x13714771, 0x964975D7), LIMB_PAIR(0x8639C0A0, 0xEFB11E27), LIMB_PAIR(0x6109122A, 0xA83B403A), LIMB_PAIR(0x3DB62A02, 0xC3120D86),
+            LIMB_PAIR(0x114181F7, 0x479F1597), LIMB_PAIR(0x4A902962, 0x2FD71BC1), LIMB_PAIR(0xA616219C, 0x6B5A2225), LIMB_PAIR(0x86E78CA8, 0x2AABC22D), LIMB_PARTIAL(0x022),
+            LIMB_PAIR(0x197ADCF4, 0x9037A233), LIMB_PAIR(0xDFEC0430, 0x9C676F3F), LIMB_PAIR(0x92AB3514, 0x42ABA69B), LIMB_PAIR(0x64CB5C48, 0xB1B7B693),
+            LIMB_PAIR(0x0066EA08, 0x866D10CC), LIMB_PAIR(0xEA7DBC33, 0x13C190A6), LIMB_PAIR(0x6D2D3558, 0x64EACE1D), LIMB_PAIR(0xCBB4A44B, 0xC2075B82), LIMB_PARTIAL(0x0F0)
+        },
+        {   // 8 * 16^80 * G
+            LIMB_PAIR(0x6305B1FA, 0x74F71C97), LIMB_PAIR(0xAAE6788B, 0x75C64449), LIMB_PAIR(0xFC132537, 0x072B8B0A), LIMB_PAIR(0x96FD8BC3, 0xD66862F4),
+            LIMB_PAIR(0x5FF59F77, 0x32CB2F3A), LIMB_PAIR(0x58FFE8E1, 0x9667801B), LIMB_PAIR(0x558302C6, 0x227B57A4), LIMB_PAIR(0x441664B4, 0x0C384F6E), LIMB_PARTIAL(0x130),
+            LIMB_PAIR(0xC16BC635, 0x0CFD7A96), LIMB_PAIR(0xD846D4C0, 0xE8F67AF8), LIMB_PAIR(0x3637D199, 0x7A398E33), LIMB_PAIR(0x11D7443B, 0x2648CDD1),
+            LIMB_PAIR(0x9843F169, 0xFE3BDC06), LIMB_PAIR(0xB42D2C33, 0x8192BFF3), LIMB_PAIR(0xFD2B8FC0, 0x7CADDFDC), LIMB_PAIR(0x1456B53B, 0x42D12861), LIMB_PARTIAL(0x1DB)
+        }
+    },
+#endif
+#if (81 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^81 * G
+            LIMB_PAIR(0x569DFCD1, 0x5637CEAB), LIMB_PAIR(0xB2C13802, 0x0D1CF091), LIMB_PAIR(0x731087B6, 0x09115A1F), LIMB_PAIR(0xBDB45B2B, 0xEDA479FE),
+            LIMB_PAIR(0x8E6E5507, 0xED883A7D), LIMB_PAIR(0x30BD8162, 0xBC9206BA), LIMB_PAIR(0xC6294B24, 0xFF2AF28E), LIMB_PAIR(0xC8947BC9, 0x2058521A), LIMB_PARTIAL(0x03C),
+            LIMB_PAIR(0x5A82FBAA, 0xFCFA87A5), LIMB_PAIR(0x1569F45B, 0x988A9A6C), LIMB_PAIR(0x5D3D6AA5, 0xE65849F6), LIMB_PAIR(0x05446B48, 0xA3D0879F),
+            LIMB_PAIR(0x76F480D1, 0x45571CCF), LIMB_PAIR(0x0EFD5F79, 0xACD9A323), LIMB_PAIR(0xAE956132, 0xF30E5EC4), LIMB_PAIR(0xEA93F245, 0x325306D0), LIMB_PARTIAL(0x0A7)
+        },
+        {   // 2 * 16^81 * G
+            LIMB_PAIR(0xFB6F765B, 0x5F7D9850), LIMB_PAIR(0xD0CCFCE0, 0xAFE6DBCA), LIMB_PAIR(0xD97D6F42, 0x9E66A5E9), LIMB_PAIR(0x377F7E90, 0x1B402928),
+            LIMB_PAIR(0xBFC71AAB, 0x44B0D87A), LIMB_PAIR(0x1DE366F6, 0x3CFFD515), LIMB_PAIR(0xB292C4F5, 0x845D7D74), LIMB_PAIR(0x3F88E818, 0xE0822EF9), LIMB_PARTIAL(0x017),
+            LIMB_PAIR(0x104D2069, 0xFFF7C1D7), LIMB_PAIR(0xEC0FDB18, 0xE53E122D), LIMB_PAIR(0x5646B614, 0xF07A4339), LIMB_PAIR(0xB47765F6, 0x3F2341D0),
+            LIMB_PAIR(0x2CB3DEF4, 0xFDE6DD5E), LIMB_PAIR(0x7A97D20C, 0x87D32478), LIMB_PAIR(0xBCB7B256, 0x27235476), LIMB_PAIR(0x9303C7D0, 0xB03F98DC), LIMB_PARTIAL(0x10B)
+        },
+        {   // 3 * 16^81 * G
+            LIMB_PAIR(0xAC5FAB15, 0xC1D74D05), LIMB_PAIR(0x9B102D52, 0x6EA132C4), LIMB_PAIR(0x0D890CD3, 0xD3ADA4CE), LIMB_PAIR(0x92823F62, 0xAB7248F0),
+            LIMB_PAIR(0x23871113, 0x246C3730), LIMB_PAIR(0x98424F07, 0xEBBCA0B9), LIMB_PAIR(0x2E62E741, 0x0061EB2C), LIMB_PAIR(0x5E90C5B4, 0xAC1B03D2), LIMB_PARTIAL(0x136),
+            LIMB_PAIR(0x7EEFAE68, 0x0748C14A), LIMB_PAIR(0x81F8A2CE, 0x82525B35), LIMB_PAIR(0x398363E1, 0x31A64097), LIMB_PAIR(0x57B6B33B, 0xCBF57E02),
+            LIMB_PAIR(0x807217E6, 0x523F0584), LIMB_PAIR(0x80B9700F, 0xD607EFE7), LIMB_PAIR(0x35596890, 0x79AFCC94), LIMB_PAIR(0x6985A97E, 0x140ED6F4), LIMB_PARTIAL(0x160)
+        },
+        {   // 4 * 16^81 * G
+            LIMB_PAIR(0x2E19E0B1, 0x116CA45B), LIMB_PAIR(0x730AC8C2, 0xA49D8F1B), LIMB_PAIR(0xEB7A1238, 0xDA037586), LIMB_PAIR(0xE834391B, 0xEAE3ABD5),
+            LIMB_PAIR(0x277EEB94, 0x8675C82A), LIMB_PAIR(0x34B19D06, 0x975AC106), LIMB_PAIR(0x6B83A163, 0x6AB169A9), LIMB_PAIR(0x967424FC, 0x3ED9A40A), LIMB_PARTIAL(0x13D),
+            LIMB_PAIR(0x2082D8BF, 0xA23D2B9B), LIMB_PAIR(0x9A7D0A3F, 0x853AE3F3), LIMB_PAIR(0x2879D8EE, 0x04C7CE96), LIMB_PAIR(0x29C66703, 0x17DA556D),
+            LIMB_PAIR(0x1FDE40F6, 0x1B3A760F), LIMB_PAIR(0x8C5B2120, 0xB9872645), LIMB_PAIR(0x260AFF65, 0x59B18FEE), LIMB_PAIR(0x5DF615DC, 0xF2A8908D), LIMB_PARTIAL(0x116)
+        },
+        {   // 5 * 16^81 * G
+            LIMB_PAIR(0x8EC70A8D, 0xAFC75C17), LIMB_PAIR(0x7B117380, 0x32686EBF), LIMB_PAIR(0x21E28C47, 0x16050CDA), LIMB_PAIR(0xE731B083, 0x70C05654),
+            LIMB_PAIR(0x71D1F6D2, 0xAFA2E575), LIMB_PAIR(0xC1982FD6, 0x0DF1A032), LIMB_PAIR(0x1E86F69B, 0xC0E7B146), LIMB_PAIR(0xDCE1864C, 0x0DF3C6BC), LIMB_PARTIAL(0x12A),
+            LIMB_PAIR(0x00B0D0B1, 0x46FA0FA6), LIMB_PAIR(0x1691A590, 0x1F0A42B2), LIMB_PAIR(0xAC8C1189, 0xF5A6E4E8), LIMB_PAIR(0x73A0AB49, 0xA2CC9879),
+            LIMB_PAIR(0xCF17F795, 0x721CA290), LIMB_PAIR(0xECF32B7B, 0x4026F9C3), LIMB_PAIR(0x19CD7057, 0xBABD20C0), LIMB_PAIR(0x5C30CBCC, 0x99378E8C), LIMB_PARTIAL(0x0D2)
+        },
+        {   // 6 * 16^81 * G
+            LIMB_PAIR(0xCCD6D98D, 0x2229E06C), LIMB_PAIR(0x2BBC14EE, 0xAD78008C), LIMB_PAIR(0xDA34A88C, 0x361FFA4F), LIMB_PAIR(0x6CF499FC, 0x6023FCF4),
+            LIMB_PAIR(0x2A50F74F, 0x72051F27), LIMB_PAIR(0xE9A59A2A, 0x56CC61C8), LIMB_PAIR(0xBF0392CF, 0x2DEFB0A1), LIMB_PAIR(0xD29013A8, 0xA5ED8B89), LIMB_PARTIAL(0x08D),
+            LIMB_PAIR(0xD3D7339A, 0x9D396C29), LIMB_PAIR(0xCA0262D1, 0x0D21B9DF), LIMB_PAIR(0xA000D10F, 0x164B69E0), LIMB_PAIR(0xE1147D4B, 0x2F7F7DFC),
+            LIMB_PAIR(0x78310E2D, 0x3CC29099), LIMB_PAIR(0x36AE5A21, 0xDCA71FAC), LIMB_PAIR(0xA0F4CFD4, 0xE0C8579A), LIMB_PAIR(0x04582119, 0xC05C5489), LIMB_PARTIAL(0x13F)
+        },
+        {   // 7 * 16^81 * G
+            LIMB_PAIR(0xB7DC0F64, 0x161B9770), LIMB_PAIR(0x84F67076, 0x42AD385A), LIMB_PAIR(0x710D4992, 0x6A94116C), LIMB_PAIR(0x3EC54457, 0xDDFA3003),
+            LIMB_PAIR(0x2D520342, 0xA17C61D1), LIMB_PAIR(0xF36C6F21, 0x7E673638), LIMB_PAIR(0xEAA1A95A, 0x7654E648), LIMB_PAIR(0x0DD8029D, 0xC4B4A3C4), LIMB_PARTIAL(0x1CD),
+            LIMB_PAIR(0x00C9033C, 0xD7485255), LIMB_PAIR(0x51ACD2CD, 0xCF0D9C35), LIMB_PAIR(0x596A8678, 0x02022DED), LIMB_PAIR(0xD90B82EC, 0x56FE8164),
+            LIMB_PAIR(0x863801C8, 0xE376A376), LIMB_PAIR(0xAD337694, 0x559B0F3F), LIMB_PAIR(0x06E23E58, 0x3C720B4F), LIMB_PAIR(0x91914C96, 0xE02DCD81), LIMB_PARTIAL(0x03A)
+        },
+        {   // 8 * 16^81 * G
+            LIMB_PAIR(0xE084EA4A, 0x699F72E9), LIMB_PAIR(0xDC721BCA, 0xD1C4BC45), LIMB_PAIR(0x995DB3E6, 0x7EB43D78), LIMB_PAIR(0x02088E1A, 0x76E84FAE),
+            LIMB_PAIR(0xE048084D, 0x1B061123), LIMB_PAIR(0x79ABE6FE, 0x7CAF0D32), LIMB_PAIR(0x53B13E9D, 0x93405837), LIMB_PAIR(0xCC58F64A, 0xA05D1313), LIMB_PARTIAL(0x13C),
+            LIMB_PAIR(0x5FA5B0AE, 0x81D54E67), LIMB_PAIR(0x086B46C4, 0xEE551C40), LIMB_PAIR(0x9B7DAA1B, 0xE7B98E20), LIMB_PAIR(0xB868C9D3, 0x8082803E),
+            LIMB_PAIR(0x36731930, 0x036502F2), LIMB_PAIR(0xF9A93C2B, 0x075455AE), LIMB_PAIR(0x52A61944, 0x080E7046), LIMB_PAIR(0x580494E0, 0x9F4BBCF0), LIMB_PARTIAL(0x154)
+        }
+    },
+#endif
+#if (82 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^82 * G
+            LIMB_PAIR(0xC000E4F4, 0x4D1BA365), LIMB_PAIR(0x7B2CAA8F, 0xCF34A1A8), LIMB_PAIR(0x783E3C39, 0x0E4A58D5), LIMB_PAIR(0x2C1FCBD9, 0x1AD4B5CE),
+            LIMB_PAIR(0xE8B9556C, 0x6B30BFB9), LIMB_PAIR(0x6301B3A4, 0x304AD236), LIMB_PAIR(0xC8D571F1, 0xDACF31B8), LIMB_PAIR(0xEC93E088, 0x25B7A0FD), LIMB_PARTIAL(0x12E),
+            LIMB_PAIR(0x3B6CC6DD, 0x2863BCBF), LIMB_PAIR(0xE9430F99, 0x70760671), LIMB_PAIR(0x7586CDDE, 0x46CCE87B), LIMB_PAIR(0x161A045F, 0xC1F58398),
+            LIMB_PAIR(0x291636AE, 0xA84CA0CF), LIMB_PAIR(0x26892BD1, 0x11242D27), LIMB_PAIR(0x8C971E9F, 0xB1D85DA7), LIMB_PAIR(0x61AA5039, 0xC66E0E1D), LIMB_PARTIAL(0x1B1)
+        },
+        {   // 2 * 16^82 * G
+            LIMB_PAIR(0x7C1A3915, 0xBD52D512), LIMB_PAIR(0x59D9DC08, 0x88B64D2E), LIMB_PAIR(0xA1DA166E, 0x142D5364), LIMB_PAIR(0xC8EF7E38, 0x138ED011),
+            LIMB_PAIR(0x4D6D06EA, 0x90E18990), LIMB_PAIR(0x147F3F6E, 0xB0081001), LIMB_PAIR(0x11A1EE9A, 0xA8E9F897), LIMB_PAIR(0xE28C7A31, 0xE7607F70), LIMB_PARTIAL(0x011),
+            LIMB_PAIR(0xDB957A5F, 0xA73DC4E4), LIMB_PAIR(0x2FA7966D, 0xB3C023C0), LIMB_PAIR(0x7AEFC5B1, 0x590CA087), LIMB_PAIR(0x2CA0D266, 0x63427F91),
+            LIMB_PAIR(0x4EEB8864, 0x7BC0F1EF), LIMB_PAIR(0x79239E3C, 0xEF9125D2), LIMB_PAIR(0xA90C09C1, 0x12E924A1), LIMB_PAIR(0xB3663A4E, 0x0FEC85E3), LIMB_PARTIAL(0x085)
+        },
+        {   // 3 * 16^82 * G
+            LIMB_PAIR(0x8A6AC4B8, 0x1E55BD59), LIMB_PAIR(0x7F9B3261, 0x4D2FF641), LIMB_PAIR(0xAE650E54, 0x7357BA73), LIMB_PAIR(0xA534EAF1, 0xFC787C61),
+            LIMB_PAIR(0x292ABBDA, 0xDBB8C786), LIMB_PAIR(0x19E5429C, 0x177FE5BC), LIMB_PAIR(0x5C9E9AD6, 0x8EBA99F0), LIMB_PAIR(0x8970847B, 0x28BC9369), LIMB_PARTIAL(0x1BF),
+            LIMB_PAIR(0x012A3B19, 0xEA2FE5C6), LIMB_PAIR(0x120A832E, 0xD1B5DD53), LIMB_PAIR(0x5511DB76, 0xB6D7981F), LIMB_PAIR(0x86DFDC2F, 0x32DAE3F9),
+            LIMB_PAIR(0xFD49509B, 0x647143B5), LIMB_PAIR(0xAE5DED18, 0xE975FF91), LIMB_PAIR(0x8D60F9F2, 0x1DE3C3CB), LIMB_PAIR(0xF5365428, 0x958C21AA), LIMB_PARTIAL(0x171)
+        },
+        {   // 4 * 16^82 * G
+            LIMB_PAIR(0xA1C88F3C, 0x6C6119F6), LIMB_PAIR(0x2EC6944A, 0x924E5FEC), LIMB_PAIR(0x5742FF2A, 0x4C8AAC60), LIMB_PAIR(0xDDB22C7C, 0x60ADDE1E),
+            LIMB_PAIR(0xFA5D25BB, 0x9728938C), LIMB_PAIR(0xEC117DE0, 0xFA5AC4F7), LIMB_PAIR(0x482929C1, 0x41F35AB7), LIMB_PAIR(0x0AFD95F5, 0xD1C4E8F9), LIMB_PARTIAL(0x180),
+            LIMB_PAIR(0xA7CD8358, 0x2FC4E73D), LIMB_PAIR(0xF2A1C920, 0x39361A57), LIMB_PAIR(0xAD94D288, 0xF6F2F130), LIMB_PAIR(0x2B6A78E2, 0xE37E2466),
+            LIMB_PAIR(0x79C262CD, 0x0BABFF8B), LIMB_PAIR(0x61B597B9, 0x6CAE01EF), LIMB_PAIR(0xA60D4E64, 0x9C1E33F0), LIMB_PAIR(0xDD01F845, 0x52A42280), LIMB_PARTIAL(0x00E)
+        },
+        {   // 5 * 16^82 * G
+            LIMB_PAIR(0x78A26AD1, 0x08068768), LIMB_PAIR(0x4A4E0A00, 0x01D14668), LIMB_PAIR(0xDF68A10B, 0xF47A3F33), LIMB_PAIR(0xCB9B660F, 0x26C714DE),
+            LIMB_PAIR(0xFEB94C62, 0x177C6DB6), LIMB_PAIR(0x88FD6FD9, 0x9D859DBC), LIMB_PAIR(0x45CDDA91, 0xFAF924FE), LIMB_PAIR(0xAB8F7635, 0x9ABC26E3), LIMB_PARTIAL(0x09B),
+            LIMB_PAIR(0x023D360D, 0x5B24D5D0), LIMB_PAIR(0x9F8FDC2A, 0x568BE974), LIMB_PAIR(0x0BD7C5B2, 0xCDA7AD21), LIMB_PAIR(0x8794C868, 0x13CC6F4E),
+            LIMB_PAIR(0xCC9C99D4, 0x39574E32), LIMB_PAIR(0x598DABC8, 0xCFBA662C), LIMB_PAIR(0xC19BE405, 0x13A18B8E), LIMB_PAIR(0x71F860FA, 0x7E68CD3F), LIMB_PARTIAL(0x104)
+        },
+        {   // 6 * 16^82 * G
+            LIMB_PAIR(0x8C730727, 0x9F19B3E1), LIMB_PAIR(0xD5E33B72, 0xA2231248), LIMB_PAIR(0x5BDE07E8, 0x0505B3DD), LIMB_PAIR(0xE8A2FC4F, 0xAA30E5AC),
+            LIMB_PAIR(0x2F964EAB, 0xB2D24A39), LIMB_PAIR(0x60CA41F1, 0x2D9D22A4), LIMB_PAIR(0xE0E8DD2D, 0xC7183625), LIMB_PAIR(0x2653D84C, 0x87F3AB03), LIMB_PARTIAL(0x0D8),
+            LIMB_PAIR(0xC7FB02D2, 0x52E505E3), LIMB_PAIR(0x7154E8B7, 0xED5FCC2C), LIMB_PAIR(0x8E8397AD, 0xC0DF346F), LIMB_PAIR(0xF542CE97, 0x1C9ABDE6),
+            LIMB_PAIR(0xE2A2205E, 0x158CD908), LIMB_PAIR(0xE60B9A18, 0xFBF550DF), LIMB_PAIR(0xBD817D90, 0x66A4AA43), LIMB_PAIR(0xC60DC534, 0xECA35B6C), LIMB_PARTIAL(0x1BE)
+        },
+        {   // 7 * 16^82 * G
+            LIMB_PAIR(0x72DCBDA3, 0x584410B6), LIMB_PAIR(0x29E3894E, 0x8BEA7142), LIMB_PAIR(0xAEA5190A, 0x1A155410), LIMB_PAIR(0x26192C76, 0xDCD905FD),
+            LIMB_PAIR(0x323F0EC1, 0xCD398643), LIMB_PAIR(0xF3645C09, 0x75ED17FA), LIMB_PAIR(0xC809CA20, 0xD7F031AB), LIMB_PAIR(0x45D35024, 0x50A51D93), LIMB_PARTIAL(0x07A),
+            LIMB_PAIR(0x5AE92EB2, 0xF5F7D19E), LIMB_PAIR(0xA68F24C0, 0x358CF7A0), LIMB_PAIR(0x6E6E1059, 0x48D8485E), LIMB_PAIR(0x650B703A, 0x42CEB50E),
+            LIMB_PAIR(0x81E19069, 0x4F717CCB), LIMB_PAIR(0x86CF55F1, 0x88EC063E), LIMB_PAIR(0xDD6FFBA5, 0x7928166B), LIMB_PAIR(0x1716E36F, 0x6315AE49), LIMB_PARTIAL(0x1BC)
+        },
+        {   // 8 * 16^82 * G
+            LIMB_PAIR(0x4C81DA95, 0x09BC5674), LIMB_PAIR(0xF23B526D, 0x9756C443), LIMB_PAIR(0xABBECE84, 0xAC041332), LIMB_PAIR(0x27696AA1, 0xD933AAA3),
+            LIMB_PAIR(0x3E4E9032, 0xFE78E91D), LIMB_PAIR(0xCD67FCFC, 0xE491EC63), LIMB_PAIR(0xE8FE9C4A, 0xB73746E7), LIMB_PAIR(0x199F1EAD, 0xD2CA6F6A), LIMB_PARTIAL(0x191),
+            LIMB_PAIR(0xAD125891, 0x86A7466A), LIMB_PAIR(0x42499FF4, 0x4817DD6E), LIMB_PAIR(0x7C6A0ADD, 0xF5478E3B), LIMB_PAIR(0x2A394366, 0xB92D8E5D),
+            LIMB_PAIR(0xBCDF955B, 0x5C5238E3), LIMB_PAIR(0x0489D6B1, 0xFA855FF1), LIMB_PAIR(0x134F7F2D, 0xBB15D2FD), LIMB_PAIR(0x44BD6838, 0xD5FAF137), LIMB_PARTIAL(0x0F0)
+        }
+    },
+#endif
+#if (83 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^83 * G
+            LIMB_PAIR(0xD34B138F, 0xBF0B5EA3), LIMB_PAIR(0x3AC7CAD4, 0xC4951381), LIMB_PAIR(0xCAB6A319, 0x82CA5536), LIMB_PAIR(0x88BB4EA8, 0xFF569136),
+            LIMB_PAIR(0x4761D3E9, 0xCEE2512A), LIMB_PAIR(0x55EF9647, 0x4695E521), LIMB_PAIR(0x9378F132, 0xBB83316B), LIMB_PAIR(0x8D43BB4C, 0x1D447F04), LIMB_PARTIAL(0x02B),
+            LIMB_PAIR(0xCE5889F5, 0x777AB201), LIMB_PAIR(0x4C6F0545, 0x635D968F), LIMB_PAIR(0x872777EA, 0xBB48A0CF), LIMB_PAIR(0xC616138F, 0x33F4DE62),
+            LIMB_PAIR(0xBC8D65CE, 0x93E74192), LIMB_PAIR(0x5EBAE1F0, 0x532CA9BD), LIMB_PAIR(0xFBABA8D0, 0xD783E104), LIMB_PAIR(0xBDF2D850, 0xB32AF569), LIMB_PARTIAL(0x1BA)
+        },
+        {   // 2 * 16^83 * G
+            LIMB_PAIR(0x48351408, 0xD552C9D2), LIMB_PAIR(0x0EF56558, 0xA6D83A48), LIMB_PAIR(0x313B47C2, 0xAD5E955A), LIMB_PAIR(0xF6DC03BE, 0xDF3CAFF7),
+            LIMB_PAIR(0x51CC488D, 0x3D62FF19), LIMB_PAIR(0x966A34F9, 0xDB49F397), LIMB_PAIR(0x0BF6A9E7, 0xE10E7213), LIMB_PAIR(0xBC5852D2, 0x560E329A), LIMB_PARTIAL(0x04B),
+            LIMB_PAIR(0xF3017C8C, 0xFDAD029A), LIMB_PAIR(0xB78D4D1A, 0x6CA51ACB), LIMB_PAIR(0x79D7D7D3, 0xF984FA86), LIMB_PAIR(0x911A4D3B, 0x75D9044B),
+            LIMB_PAIR(0xEF955E4E, 0xC5B20C87), LIMB_PAIR(0xF064FD0C, 0x413D6838), LIMB_PAIR(0xEC7FB5C9, 0x37A5EC08), LIMB_PAIR(0x74561D5B, 0x634CB97F), LIMB_PARTIAL(0x15B)
+        },
+        {   // 3 * 16^83 * G
+            LIMB_PAIR(0xE43B6C21, 0x9FA30F39), LIMB_PAIR(0xB9FC57BB, 0x4D3822AA), LIMB_PAIR(0x69A8A55E, 0x0230ADCF), LIMB_PAIR(0x6F87F988, 0xDC8AB279),
+            LIMB_PAIR(0xB2AF81FC, 0x2D642A82), LIMB_PAIR(0x30765913, 0xB9E63A77), LIMB_PAIR(0x25F2A77C, 0x57874006), LIMB_PAIR(0x5BFEE0F1, 0x0AA30A6F), LIMB_PARTIAL(0x03D),
+            LIMB_PAIR(0xFCE49DAA, 0x796F6508), LIMB_PAIR(0xBF907285, 0xB586299F), LIMB_PAIR(0x5838145B, 0x21CCFC55), LIMB_PAIR(0xE6D43B4D, 0x20A0F8C0),
+            LIMB_PAIR(0xE5E80FC6, 0x17170A2B), LIMB_PAIR(0x88FBA946, 0xBB8F8406), LIMB_PAIR(0x411FCBE7, 0x5C226B0E), LIMB_PAIR(0x2AE8E090, 0x35ACE6E0), LIMB_PARTIAL(0x0B0)
+        },
+        {   // 4 * 16^83 * G
+            LIMB_PAIR(0xE695916F, 0x446B17B0), LIMB_PAIR(0xF9BD8DA6, 0xB3B0DCEB), LIMB_PAIR(0x5FF86AAD, 0x6C76C3CE), LIMB_PAIR(0x0CDE74D8, 0x0785D5A2),
+            LIMB_PAIR(0x2BB7AE7A, 0x2CE9FAE1), LIMB_PAIR(0x5F32E59A, 0x87CD0568), LIMB_PAIR(0xE1598559, 0x8E229326), LIMB_PAIR(0x34EDFB01, 0xA0BAD54E), LIMB_PARTIAL(0x15D),
+            LIMB_PAIR(0x0E1290B4, 0xA54529C2), LIMB_PAIR(0xB795DBA1, 0xE7C719CA), LIMB_PAIR(0x109B4740, 0x68CAC3A5), LIMB_PAIR(0xA68E8E4A, 0xB032BD2B),
+            LIMB_PAIR(0x1658337D, 0xCE03D932), LIMB_PAIR(0xCC95D9DF, 0xB39D102E), LIMB_PAIR(0xBE248C98, 0x79838D96), LIMB_PAIR(0xD7DF0B44, 0x02562708), LIMB_PARTIAL(0x127)
+        },
+        {   // 5 * 16^83 * G
+            LIMB_PAIR(0x162DD91D, 0xA39D4AC8), LIMB_PAIR(0x22E67A01, 0x57047693), LIMB_PAIR(0x7C446028, 0xDFE57F99), LIMB_PAIR(0xD131A2C8, 0x0F49DF77),
+            LIMB_PAIR(0xF7F779BD, 0xC8F26682), LIMB_PAIR(0x18E884F1, 0x16966558), LIMB_PAIR(0xF390907B, 0xC5D9D516), LIMB_PAIR(0x617F5F5C, 0x23356E77), LIMB_PARTIAL(0x1ED),
+            LIMB_PAIR(0x679DEABA, 0x5E6830B9), LIMB_PAIR(0x9FD1A70E, 0x18BCC37F), LIMB_PAIR(0x72225892, 0xFA84E862), LIMB_PAIR(0xC610763C, 0x2E6CD938),
+            LIMB_PAIR(0x671378EA, 0xC179376A), LIMB_PAIR(0xF502EA1F, 0xE3B844B5), LIMB_PAIR(0x5FB4DC36, 0x74A390B7), LIMB_PAIR(0x0ED8D535, 0x51F01940), LIMB_PARTIAL(0x18F)
+        },
+        {   // 6 * 16^83 * G
+            LIMB_PAIR(0xCA91F6F4, 0xC9A88248), LIMB_PAIR(0xC7D5ACC8, 0xA368FD8A), LIMB_PAIR(0xCEA11E10, 0x33D9FD5C), LIMB_PAIR(0x816DE633, 0x0AF2F470),
+            LIMB_PAIR(0xAC186F1F, 0xE78E8101), LIMB_PAIR(0x5E3C4857, 0x0D97DE7D), LIMB_PAIR(0x07946BB1, 0x9346AF74), LIMB_PAIR(0xC7044EA9, 0x81C2BD5E), LIMB_PARTIAL(0x003),
+            LIMB_PAIR(0x696D947B, 0x04C2EDA3), LIMB_PAIR(0x01EFA843, 0xC3F988F3), LIMB_PAIR(0x92F22674, 0xE8395877), LIMB_PAIR(0xC83396C7, 0x376972A2),
+            LIMB_PAIR(0x44F2AD2F, 0xAA679A31), LIMB_PAIR(0x3112B6AF, 0x61A46EBC), LIMB_PAIR(0xC6B3224F, 0xBDA02CE0), LIMB_PAIR(0xDD4C7B77, 0xB42AABA7), LIMB_PARTIAL(0x060)
+        },
+        {   // 7 * 16^83 * G
+            LIMB_PAIR(0x3D70360C, 0x8879637B), LIMB_PAIR(0x72F41087, 0x053C278F), LIMB_PAIR(0xF07F009E, 0xCC895E1F), LIMB_PAIR(0x68DB6690, 0x4C9B8C64),
+            LIMB_PAIR(0x1B97DAC5, 0xB4547398), LIMB_PAIR(0xAF65FF38, 0x0399CAC8), LIMB_PAIR(0x1FD0A6C0, 0x295E0914), LIMB_PAIR(0x871BDEFA, 0xAB605FCD), LIMB_PARTIAL(0x0D0),
+            LIMB_PAIR(0x5AD63582, 0x3F2D4297), LIMB_PAIR(0xDC7D3A40, 0x28FDA2BB), LIMB_PAIR(0x65672D9E, 0x7F144367), LIMB_PAIR(0x2937E8C8, 0x9322AB08),
+            LIMB_PAIR(0xAF748929, 0xF351279F), LIMB_PAIR(0x149D6F5D, 0x63A624F5), LIMB_PAIR(0x989F5325, 0x3351F4FF), LIMB_PAIR(0xBC7DD8D9, 0x0456187B), LIMB_PARTIAL(0x1B1)
+        },
+        {   // 8 * 16^83 * G
+            LIMB_PAIR(0x4E185EE5, 0xFAB6FA73), LIMB_PAIR(0xF15957D4, 0xEC85B9ED), LIMB_PAIR(0x72BA04E7, 0xA978ADBD), LIMB_PAIR(0x7986FB14, 0xC7E3107E),
+            LIMB_PAIR(0xE37740B4, 0x0E97063D), LIMB_PAIR(0x25E29918, 0xF26F51C2), LIMB_PAIR(0x12E6F22F, 0x66B94453), LIMB_PAIR(0x68090E9A, 0x6617DEAE), LIMB_PARTIAL(0x0A3),
+            LIMB_PAIR(0xD2DAFD33, 0x86595B1D), LIMB_PAIR(0xF3C234FA, 0xCCA6CD7F), LIMB_PAIR(0xAAC709CC, 0xD24847ED), LIMB_PAIR(0xFC689536, 0xBE089DF8),
+            LIMB_PAIR(0x367BBBEE, 0x4FDCC1DC), LIMB_PAIR(0xA01BEF50, 0xC2592739), LIMB_PAIR(0xA53D6B64, 0xFF4D427A), LIMB_PAIR(0x47D9AF89, 0xD3DDC2BC), LIMB_PARTIAL(0x00D)
+        }
+    },
+#endif
+#if (84 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^84 * G
+            LIMB_PAIR(0xA79CB073, 0xADF5E06E), LIMB_PAIR(0x8BF180E6, 0xCB46ACA9), LIMB_PAIR(0x835F8E22, 0x5BF0D9EB), LIMB_PAIR(0x7713F3AD, 0xD692CD20),
+            LIMB_PAIR(0xF0D87F74, 0xA33E9D7F), LIMB_PAIR(0xF602A362, 0x9F2B6950), LIMB_PAIR(0xDFA4F77C, 0x27A4C70B), LIMB_PAIR(0x3C56080A, 0x99C699DD), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0x95338FA8, 0xDFB1B255), LIMB_PAIR(0xD59E754D, 0xABADBA3A), LIMB_PAIR(0x436E70FC, 0x2338452B), LIMB_PAIR(0xE07A21B6, 0x34CFB5B2),
+            LIMB_PAIR(0xF81EA5A2, 0x25DDB684), LIMB_PAIR(0xAA325FC8, 0x98F463C0), LIMB_PAIR(0x94AEB02E, 0x963BBC80), LIMB_PAIR(0x434AB9FA, 0xA98FE976), LIMB_PARTIAL(0x188)
+        },
+        {   // 2 * 16^84 * G
+            LIMB_PAIR(0x204A966E, 0x9A7FC933), LIMB_PAIR(0x0D9680EC, 0x7C1C5915), LIMB_PAIR(0x30415E73, 0x06436097), LIMB_PAIR(0x8EA44E8B, 0x574B0652),
+            LIMB_PAIR(0xF4B8FE58, 0xD35D1340), LIMB_PAIR(0xDAA40CA5, 0x81DDD1F4), LIMB_PAIR(0xAC09937B, 0x5C908486), LIMB_PAIR(0x14C180DE, 0x467DFFA6), LIMB_PARTIAL(0x034),
+            LIMB_PAIR(0x8000602E, 0xE6F97ACC), LIMB_PAIR(0x0F527147, 0x2650E957), LIMB_PAIR(0x7C3923E6, 0x3AF58DD9), LIMB_PAIR(0x69F5CAFD, 0x67F7102E),
+            LIMB_PAIR(0x0ECB60FC, 0xF80E76C0), LIMB_PAIR(0x197F6BDB, 0xD3441285), LIMB_PAIR(0x52050B0B, 0xDEED257A), LIMB_PAIR(0x0703C0EF, 0x8C28AFEA), LIMB_PARTIAL(0x052)
+        },
+        {   // 3 * 16^84 * G
+            LIMB_PAIR(0x56500523, 0x2EA6E184), LIMB_PAIR(0xF44D63FB, 0x566CCDD0), LIMB_PAIR(0xB01114CC, 0x8CC0208D), LIMB_PAIR(0x11E5DD4E, 0xDB7BF613),
+            LIMB_PAIR(0xFF83D7B1, 0x65E4263E), LIMB_PAIR(0xD6DA83E9, 0x12D2924C), LIMB_PAIR(0x78380401, 0x093BD190), LIMB_PAIR(0xFF97C4F9, 0xD2835BDB), LIMB_PARTIAL(0x13C),
+            LIMB_PAIR(0x1D8E9521, 0xD3AE4C90), LIMB_PAIR(0x42DC5BBB, 0xE2C92A4C), LIMB_PAIR(0x8C96057D, 0x478E934B), LIMB_PAIR(0xEC6155F7, 0x0E526187),
+            LIMB_PAIR(0x2BBE77D5, 0x3ACA950D), LIMB_PAIR(0x6E492364, 0xE7EDF96A), LIMB_PAIR(0x2FE76745, 0xFC039FD2), LIMB_PAIR(0x53928C27, 0x68DFCE96), LIMB_PARTIAL(0x0F3)
+        },
+        {   // 4 * 16^84 * G
+            LIMB_PAIR(0xE225FBD9, 0xAB482B76), LIMB_PAIR(0xD3C33A7D, 0xD561F4CD), LIMB_PAIR(0xCCB2F003, 0x18813777), LIMB_PAIR(0x24CEBCE8, 0xA1633775),
+            LIMB_PAIR(0x16ADB540, 0xDDBE587D), LIMB_PAIR(0x79E133CD, 0xBC0D225F), LIMB_PAIR(0x32A4C54A, 0x8FA3D300), LIMB_PAIR(0x243DC5E5, 0xDED1ECE4), LIMB_PARTIAL(0x024),
+            LIMB_PAIR(0xFFD4B7DD, 0x94CE92A3), LIMB_PAIR(0x5A8EFBD5, 0xEAC8E7A1), LIMB_PAIR(0xA9DC648A, 0x0C842C3F), LIMB_PAIR(0x0D286101, 0x19172F46),
+            LIMB_PAIR(0xBECA770A, 0xC8681E80), LIMB_PAIR(0xA8795D3B, 0xFAAA1AB4), LIMB_PAIR(0x63944868, 0xE8625D46), LIMB_PAIR(0x4F3254EB, 0xE13004F9), LIMB_PARTIAL(0x104)
+        },
+        {   // 5 * 16^84 * G
+            LIMB_PAIR(0xB7F3D4B1, 0xB0FECE2B), LIMB_PAIR(0x47B042FB, 0x8B6168AA), LIMB_PAIR(0x01658A57, 0x207D9B0F), LIMB_PAIR(0x5CF0BB71, 0x52DEEBF2),
+            LIMB_PAIR(0x2FC808A8, 0xC678DCC7), LIMB_PAIR(0x75A39999, 0x8BEA9D09), LIMB_PAIR(0x7042C5A7, 0xF26B5D2B), LIMB_PAIR(0xDBE12667, 0x58B1D1BB), LIMB_PARTIAL(0x120),
+            LIMB_PAIR(0xD821C3EA, 0x10CF0B69), LIMB_PAIR(0xC684E985, 0x045A9342), LIMB_PAIR(0x56BABDCB, 0x2245C17F), LIMB_PAIR(0xB40C5F7D, 0x7859852A),
+            LIMB_PAIR(0x35B36FE0, 0xCBC11CAF), LIMB_PAIR(0xDDC4ABE5, 0xCBCE03BA), LIMB_PAIR(0x9E11EE36, 0xFA479726), LIMB_PAIR(0x8B993B9A, 0xC70CF89A), LIMB_PARTIAL(0x13F)
+        },
+        {   // 6 * 16^84 * G
+            LIMB_PAIR(0x0D9EA003, 0x2E911BB3), LIMB_PAIR(0xDD7BBB56, 0x50503FD6), LIMB_PAIR(0xF43C710C, 0x23780725), LIMB_PAIR(0xD236028A, 0xF3854BC2),
+            LIMB_PAIR(0x85F08816, 0x0BB0CD70), LIMB_PAIR(0x78E34910, 0xAF2BA068), LIMB_PAIR(0x558B8BAB, 0xB0AB1008), LIMB_PAIR(0xE24955DB, 0xE0676170), LIMB_PARTIAL(0x049),
+            LIMB_PAIR(0x87B571F5, 0xE2B0161A), LIMB_PAIR(0x6209D9AD, 0x1676B334), LIMB_PAIR(0xE2F86308, 0x402122EC), LIMB_PAIR(0x87D6F082, 0xBD0E3644),
+            LIMB_PAIR(0x64747111, 0x587EF7C4), LIMB_PAIR(0x8F3386A7, 0xE8EDFEEC), LIMB_PAIR(0x3A489DB5, 0x2B70F933), LIMB_PAIR(0x442A278B, 0x819E1D7C), LIMB_PARTIAL(0x025)
+        },
+        {   // 7 * 16^84 * G
+            LIMB_PAIR(0x6EE24007, 0x731BE59D), LIMB_PAIR(0xB97EFD86, 0xE96884C4), LIMB_PAIR(0xCF73D698, 0x9E4A2BBE), LIMB_PAIR(0x2EF12084, 0x7820A2D7),
+            LIMB_PAIR(0xC5692055, 0x1EBBF048), LIMB_PAIR(0xC1B300F9, 0x707194DA), LIMB_PAIR(0xC0D5DC37, 0xF45FE3FE), LIMB_PAIR(0xDF061C3C, 0x20CB9BF6), LIMB_PARTIAL(0x000),
+            LIMB_PAIR(0x49841247, 0xEF76E093), LIMB_PAIR(0x5673EEE7, 0x7E963D5C), LIMB_PAIR(0xC5EAB79F, 0x135D2CA7), LIMB_PAIR(0xCEEB60E6, 0xF0D3AC04),
+            LIMB_PAIR(0x1D07B5F9, 0xDB33FC36), LIMB_PAIR(0xF1443AE5, 0x37EF4405), LIMB_PAIR(0x6EC33BD0, 0xE4716FAE), LIMB_PAIR(0x4FD6F657, 0x3A6E33A1), LIMB_PARTIAL(0x03F)
+        },
+        {   // 8 * 16^84 * G
+            LIMB_PAIR(0x04E188FF, 0x6F01C261), LIMB_PAIR(0xC7FF2E86, 0x0D9BF057), LIMB_PAIR(0xC8E36163, 0xF9CD2DD6), LIMB_PAIR(0xEC1562E8, 0xBFC6200B),
+            LIMB_PAIR(0x8AFB5102, 0x735836B4), LIMB_PAIR(0x035E1ED7, 0xB7A29E92), LIMB_PAIR(0x5F2E5924, 0xB16B14CA), LIMB_PAIR(0x28630D59, 0xA77550A6), LIMB_PARTIAL(0x032),
+            LIMB_PAIR(0x7418D27C, 0x7B4BC3EF), LIMB_PAIR(0x23B67ADB, 0xDF5C38B6), LIMB_PAIR(0xEA3713C8, 0x168D61E3), LIMB_PAIR(0x1ABD92F8, 0x806F9549),
+            LIMB_PAIR(0x98EB3239, 0xE806AB7B), LIMB_PAIR(0xF09B81CB, 0x47F49E50), LIMB_PAIR(0x06FD5BA3, 0x4324DA17), LIMB_PAIR(0x3193DD6B, 0xD54DC861), LIMB_PARTIAL(0x03C)
+        }
+    },
+#endif
+#if (85 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^85 * G
+            LIMB_PAIR(0x81FE2FBD, 0xD17BC059), LIMB_PAIR(0xCDFC711D, 0x8247A0C7), LIMB_PAIR(0x63CE74EE, 0x973EAB2F), LIMB_PAIR(0x4191B5F1, 0x270A6BDC),
+            LIMB_PAIR(0x637F5917, 0xE21AFB51), LIMB_PAIR(0x50326C7B, 0xA84E71C5), LIMB_PAIR(0xF30C35CF, 0x14CEF332), LIMB_PAIR(0xB7407D5E, 0xFF0E5F89), LIMB_PARTIAL(0x011),
+            LIMB_PAIR(0xF8B6B176, 0x7B23A55D), LIMB_PAIR(0xC679C536, 0xBC660C66), LIMB_PAIR(0x897FDE1A, 0xAD82144A), LIMB_PAIR(0x545BAF12, 0x5082037D),
+            LIMB_PAIR(0x4448059F, 0x4BF2B117), LIMB_PAIR(0xF1E8C52D, 0x59C25C1B), LIMB_PAIR(0x8E030E69, 0xC01A4B8D), LIMB_PAIR(0x229951C1, 0x45077803), LIMB_PARTIAL(0x184)
+        },
+        {   // 2 * 16^85 * G
+            LIMB_PAIR(0x11C50119, 0x6A55868F), LIMB_PAIR(0xC7912BBB, 0xB78ABB45), LIMB_PAIR(0xF2598660, 0x00EC6EDC), LIMB_PAIR(0x3B330DDD, 0x45B396BF),
+            LIMB_PAIR(0x430B461B, 0xF1E1B15D), LIMB_PAIR(0xE8C572AD, 0xD7D7AD1D), LIMB_PAIR(0x1EC38412, 0xC236B260), LIMB_PAIR(0x99889CF7, 0xB668A336), LIMB_PARTIAL(0x109),
+            LIMB_PAIR(0x0BF6EF3B, 0xE39AB64B), LIMB_PAIR(0xB87B2F04, 0x83496BAE), LIMB_PAIR(0xDD04F4B5, 0xC9A9009D), LIMB_PAIR(0x8FBED8DF, 0xCD813E02),
+            LIMB_PAIR(0xD49842FE, 0x8766407E), LIMB_PAIR(0xD72A0525, 0xED08303D), LIMB_PAIR(0xB47E882E, 0xED117DD7), LIMB_PAIR(0x44CE2E25, 0x62EC57F7), LIMB_PARTIAL(0x1A9)
+        },
+        {   // 3 * 16^85 * G
+            LIMB_PAIR(0x4B60E7D4, 0x8EE76FB8), LIMB_PAIR(0x66DF99E4, 0xCDCF2893), LIMB_PAIR(0x80648B08, 0xF0A80879), LIMB_PAIR(0xAE3ADE6D, 0x3C499205),
+            LIMB_PAIR(0x03D4984A, 0x73D8D035), LIMB_PAIR(0xE21A233C, 0x4FCD2C1C), LIMB_PAIR(0xBF51CA1C, 0x0B5C1E89), LIMB_PAIR(0x237792D1, 0x1B7A009F), LIMB_PARTIAL(0x116),
+            LIMB_PAIR(0x44961EF0, 0xD2DCA970), LIMB_PAIR(0xA97A7B6A, 0xD5A6FBCB), LIMB_PAIR(0x5A4F98C9, 0x5E6DA597), LIMB_PAIR(0xBCA536B6, 0x2421C548),
+            LIMB_PAIR(0x1F7EE8A4, 0x7A591AF1), LIMB_PAIR(0x8A8817C3, 0x32030881), LIMB_PAIR(0x2AF67257, 0xD98A2178), LIMB_PAIR(0x3828BBDD, 0x31FB8F95), LIMB_PARTIAL(0x1CB)
+        },
+        {   // 4 * 16^85 * G
+            LIMB_PAIR(0x485DA448, 0xEE2F0D5E), LIMB_PAIR(0xFF6F7AE7, 0x1ED09705), LIMB_PAIR(0x280081DD, 0x14EECC17), LIMB_PAIR(0x7230161C, 0xA120EE79),
+            LIMB_PAIR(0xFF269A0A, 0xCC768683), LIMB_PAIR(0x2A872FAF, 0xF63E5DFC), LIMB_PAIR(0xACC10CB2, 0xBB5B1AE6), LIMB_PAIR(0x07A71C22, 0xD1106507), LIMB_PARTIAL(0x07C),
+            LIMB_PAIR(0x5A78B340, 0xA1725689), LIMB_PAIR(0x8D805B2B, 0xC8802D2A), LIMB_PAIR(0xE62FAC2E, 0x4F1BD019), LIMB_PAIR(0x806B6762, 0xA1DD8419),
+            LIMB_PAIR(0xA9223942, 0xE6808F48), LIMB_PAIR(0xA6A1E281, 0x50A99D62), LIMB_PAIR(0x52FBACC9, 0xFA713448), LIMB_PAIR(0xB5D82A8B, 0x09E7A5FB), LIMB_PARTIAL(0x0C8)
+        },
+        {   // 5 * 16^85 * G
+            LIMB_PAIR(0xC8856636, 0x92E34BA8), LIMB_PAIR(0x72FBA792, 0x7C3FED1D), LIMB_PAIR(0xBE6A4B3C, 0x1B6165C5), LIMB_PAIR(0x6D28920B, 0x2D00EFC1),
+            LIMB_PAIR(0x4DD93E8D, 0xEC8ADC9D), LIMB_PAIR(0xAEF2D574, 0x3066D308), LIMB_PAIR(0xA82598EE, 0xC860DE4A), LIMB_PAIR(0x7AD8BD69, 0x1B50BD37), LIMB_PARTIAL(0x153),
+            LIMB_PAIR(0xB5B8679D, 0x69BD34AF), LIMB_PAIR(0xEAD5BD72, 0x1FC682A3), LIMB_PAIR(0x5653A45D, 0xE476BC93), LIMB_PAIR(0x7EA41F0A, 0xCCD683F5),
+            LIMB_PAIR(0xFCCEC23D, 0xC0A4A77F), LIMB_PAIR(0x405EAA14, 0x928D18A0), LIMB_PAIR(0xDA4A173C, 0xDD427FDE), LIMB_PAIR(0x3703452A, 0xA46FC818), LIMB_PARTIAL(0x1D2)
+        },
+        {   // 6 * 16^85 * G
+            LIMB_PAIR(0x646481C6, 0xA938BD6A), LIMB_PAIR(0x5A678A7B, 0x8D256C10), LIMB_PAIR(0x78BAD22F, 0x3AD2B425), LIMB_PAIR(0x8FFA66FD, 0x06E5AC05),
+            LIMB_PAIR(0xD2422F6F, 0x41DE530B), LIMB_PAIR(0x59D797DF, 0x9D1C319D), LIMB_PAIR(0xD1987D36, 0xCA1DC27A), LIMB_PAIR(0x491B67C7, 0x025FA8AD), LIMB_PARTIAL(0x037),
+            LIMB_PAIR(0x0C5EB0BF, 0xDB5D5536), LIMB_PAIR(0xDC76A207, 0x3F005107), LIMB_PAIR(0x4C0AA69E, 0x25A53DC9), LIMB_PAIR(0xBF1B5BA5, 0x37451BF2),
+            LIMB_PAIR(0xAF0BEAFF, 0x71A269F6), LIMB_PAIR(0xC2C5FCA9, 0xB050FE1F), LIMB_PAIR(0x8FE12057, 0x39C34244), LIMB_PAIR(0x78DBC6ED, 0x2FB034BD), LIMB_PARTIAL(0x060)
+        },
+        {   // 7 * 16^85 * G
+            LIMB_PAIR(0x683CE282, 0x69DD6EE8), LIMB_PAIR(0xD644B745, 0xE8446D3C), LIMB_PAIR(0x9049B9FE, 0x7738CFA7), LIMB_PAIR(0x8E449ABC, 0xC84EDBAA),
+            LIMB_PAIR(0x20BA8D8D, 0x003A5B98), LIMB_PAIR(0xB4967514, 0x4A490725), LIMB_PAIR(0xC5E72A76, 0x6A2E96CF), LIMB_PAIR(0x2445FD97, 0xF54E30CB), LIMB_PARTIAL(0x1B8),
+            LIMB_PAIR(0x5D00E246, 0xC5B7369C), LIMB_PAIR(0xED622D2A, 0x9CD08237), LIMB_PAIR(0xEDA55962, 0xA64AE48B), LIMB_PAIR(0xBE8B197F, 0x13583919),
+            LIMB_PAIR(0x129FA7C3, 0xADDC927F), LIMB_PAIR(0x397E156B, 0x54191F4B), LIMB_PAIR(0x8EDB1CCE, 0x6F0EA7B0), LIMB_PAIR(0x9ADDB3F7, 0x5C814220), LIMB_PARTIAL(0x023)
+        },
+        {   // 8 * 16^85 * G
+            LIMB_PAIR(0xC1C7CE9C, 0x56B1560A), LIMB_PAIR(0x5FEDC58C, 0x619FDDF4), LIMB_PAIR(0xB59AFA4B, 0xE8D35DC7), LIMB_PAIR(0xEDA188AD, 0x0C5F5AC8),
+            LIMB_PAIR(0x1A468155, 0x14D11E1B), LIMB_PAIR(0x1529288D, 0x9A5FD6C9), LIMB_PAIR(0xE9DA413A, 0xF8B121D3), LIMB_PAIR(0xE231527C, 0xCD307365), LIMB_PARTIAL(0x0E4),
+            LIMB_PAIR(0xF086EC25, 0xDA248CC0), LIMB_PAIR(0x306B0D1A, 0x800EA7D4), LIMB_PAIR(0x6B74D50A, 0xA5011AB8), LIMB_PAIR(0x749BEFE4, 0x68BAD0AF),
+            LIMB_PAIR(0x1BBBCE0F, 0xC1AD0609), LIMB_PAIR(0x2727C718, 0x363078EB), LIMB_PAIR(0x18C61D23, 0x2E2E4AEC), LIMB_PAIR(0xC84E4120, 0x41F8FD81), LIMB_PARTIAL(0x137)
+        }
+    },
+#endif
+#if (86 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^86 * G
+            LIMB_PAIR(0x796DE182, 0x9A579DEE), LIMB_PAIR(0xF6FD67C5, 0x6F780AA7), LIMB_PAIR(0x6C566337, 0x8E2E0D6D), LIMB_PAIR(0xE5314714, 0xD8D685B5),
+            LIMB_PAIR(0x8099F308, 0xBC0BCB3A), LIMB_PAIR(0x585CE610, 0x7127691F), LIMB_PAIR(0xFE15ED8A, 0xB1DD4F51), LIMB_PAIR(0x217BD3C7, 0xAB542E06), LIMB_PARTIAL(0x183),
+            LIMB_PAIR(0x5F29DBD2, 0x67E18983), LIMB_PAIR(0x74D67113, 0xF0092C9F), LIMB_PAIR(0x847DC935, 0x3FAA747C), LIMB_PAIR(0x7F5BE1B1, 0x798604F2),
+            LIMB_PAIR(0x8C76C26A, 0xF766DB9A), LIMB_PAIR(0x5C205CA3, 0xA38D86F0), LIMB_PAIR(0x8C6E65AD, 0xFEC09777), LIMB_PAIR(0x156B3B92, 0x1C2B356C), LIMB_PARTIAL(0x0D1)
+        },
+        {   // 2 * 16^86 * G
+            LIMB_PAIR(0x378740BF, 0x40E2E814), LIMB_PAIR(0xCBD2BD7B, 0x63A78984), LIMB_PAIR(0x8A8DAC87, 0x372E13DB), LIMB_PAIR(0xF60984C2, 0xAF09F900),
+            LIMB_PAIR(0x79DD89C2, 0x5FCB7A8E), LIMB_PAIR(0xFF667CB1, 0x29B8A792), LIMB_PAIR(0xADAA64F7, 0x9F8DB873), LIMB_PAIR(0x5DCC5522, 0xC52129F8), LIMB_PARTIAL(0x16C),
+            LIMB_PAIR(0x00C4F4CF, 0xA7C053BF), LIMB_PAIR(0x99F2B4CF, 0x236A5B23), LIMB_PAIR(0x7D8F5DFB, 0xAA4E794A), LIMB_PAIR(0x62AE7550, 0x42752A22),
+            LIMB_PAIR(0xB6AA180E, 0xBF731493), LIMB_PAIR(0x0C875FF4, 0x4CFEB68E), LIMB_PAIR(0xE0C5141F, 0x0C30DCD7), LIMB_PAIR(0x76DA59F2, 0x3DCF6203), LIMB_PARTIAL(0x12F)
+        },
+        {   // 3 * 16^86 * G
+            LIMB_PAIR(0x974D9B78, 0xDFB64F02), LIMB_PAIR(0x41CCE8D3, 0x31F9A91B), LIMB_PAIR(0x4999E143, 0x34DCB6E3), LIMB_PAIR(0x739197EE, 0x01D57CA3),
+            LIMB_PAIR(0x78B9F00A, 0xC0F2108C), LIMB_PAIR(0x4A735404, 0xADC6692C), LIMB_PAIR(0x3BCC3B72, 0x8358671E), LIMB_PAIR(0x6F09F3C5, 0x3FC1EA7D), LIMB_PARTIAL(0x0E7),
+            LIMB_PAIR(0xE86D270C, 0x9C983854), LIMB_PAIR(0xAE44B27E, 0x4D51AA04), LIMB_PAIR(0xD49C136C, 0xFF192DB6), LIMB_PAIR(0xE0F2963C, 0x8B4EB830),
+            LIMB_PAIR(0x894608A5, 0x839723CC), LIMB_PAIR(0xFD6315EC, 0x39DF449C), LIMB_PAIR(0xF69010DB, 0xA65F47EF), LIMB_PAIR(0x94F69BAC, 0xDF702036), LIMB_PARTIAL(0x17C)
+        },
+        {   // 4 * 16^86 * G
+            LIMB_PAIR(0x2A5A58FE, 0xB3EEE6FE), LIMB_PAIR(0x5F1BD90C, 0xE8FAC648), LIMB_PAIR(0x58FB2B1B, 0x8C761597), LIMB_PAIR(0x41103723, 0x58D5A7EC),
+            LIMB_PAIR(0xA9800518, 0x33335BB4), LIMB_PAIR(0x25ED26E0, 0xA2DED460), LIMB_PAIR(0x29E98932, 0xA8996E78), LIMB_PAIR(0xCDFB40D1, 0x819F8F8B), LIMB_PARTIAL(0x06F),
+            LIMB_PAIR(0xB98E803A, 0xB8B1D0ED), LIMB_PAIR(0x4620CEA3, 0x29FD3126), LIMB_PAIR(0x9EEBE49C, 0xEA10DCB4), LIMB_PAIR(0x9AD55911, 0x29B7B699),
+            LIMB_PAIR(0xF0CA87E5, 0xC77D33DB), LIMB_PAIR(0xFE915661, 0xB9A166EC), LIMB_PAIR(0xECCF8C45, 0xC2AD03B0), LIMB_PAIR(0x053AFFAC, 0x7B16346D), LIMB_PARTIAL(0x082)
+        },
+        {   // 5 * 16^86 * G
+            LIMB_PAIR(0x91BF9E59, 0x5E6DAEB4), LIMB_PAIR(0x28978A08, 0x9DC3D789), LIMB_PAIR(0x3CF5AB93, 0x8BA21379), LIMB_PAIR(0x9F7F32D8, 0x13E05A84),
+            LIMB_PAIR(0x24D864CD, 0xCA46A51D), LIMB_PAIR(0x58F27AB1, 0x49DA1D09), LIMB_PAIR(0x1DD5BB6B, 0x3D44AC19), LIMB_PAIR(0x960BA63F, 0x14EB042F), LIMB_PARTIAL(0x031),
+            LIMB_PAIR(0x857451B4, 0x8C9A73C4), LIMB_PAIR(0x29E1992E, 0x61A5F60D), LIMB_PAIR(0x1AFF692D, 0x6B6CD67B), LIMB_PAIR(0xB835AFC3, 0x3B702F11),
+            LIMB_PAIR(0xBFC9D3C0, 0x4270A9BA), LIMB_PAIR(0xCA0C7CC0, 0x68C63F32), LIMB_PAIR(0x6EA38E95, 0x841CF282), LIMB_PAIR(0x0D60D28A, 0x85C69BAF), LIMB_PARTIAL(0x1EE)
+        },
+        {   // 6 * 16^86 * G
+            LIMB_PAIR(0xD827CC1A, 0x085D3A3C), LIMB_PAIR(0xB0A2B341, 0x66ADE8B0), LIMB_PAIR(0xB68DFC88, 0x4B810C4C), LIMB_PAIR(0xE5230A76, 0x77FE410E),
+            LIMB_PAIR(0x389A3A1D, 0x8426DD8E), LIMB_PAIR(0x7D94BCF3, 0x2DDA407D), LIMB_PAIR(0x415E7675, 0x5C661465), LIMB_PAIR(0x273F2602, 0x442EDB73), LIMB_PARTIAL(0x16C),
+            LIMB_PAIR(0xB074ACFA, 0xE079D5BC), LIMB_PAIR(0xD08169CA, 0xA72D9C62), LIMB_PAIR(0xF8828607, 0xE1D49019), LIMB_PAIR(0x2E99DAD2, 0x6EC37363),
+            LIMB_PAIR(0xC8707B4C, 0x00F11E7B), LIMB_PAIR(0xFACE4DC8, 0x8B3275A0), LIMB_PAIR(0x60AD7B4A, 0xFD045D46), LIMB_PAIR(0x2D870BA7, 0xB59F6B35), LIMB_PARTIAL(0x05F)
+        },
+        {   // 7 * 16^86 * G
+            LIMB_PAIR(0xA3D933EC, 0x360E5A48), LIMB_PAIR(0xF7BBEA20, 0x0AB120BD), LIMB_PAIR(0xDB780CDC, 0x30B58F9A), LIMB_PAIR(0x95285853, 0x30736D95),
+            LIMB_PAIR(0x1B3839DE, 0xD52795FB), LIMB_PAIR(0xF74F223A, 0x61ABB62E), LIMB_PAIR(0x31F8EC5C, 0x7134F16B), LIMB_PAIR(0x9BECED0D, 0x71608945), LIMB_PARTIAL(0x0A1),
+            LIMB_PAIR(0x8D5E323D, 0xE346FC2D), LIMB_PAIR(0xAE6C4AA1, 0x56AA6EF5), LIMB_PAIR(0x130796EE, 0xDEA1E40D), LIMB_PAIR(0xD71960E8, 0x7685EFDC),
+            LIMB_PAIR(0x1040E1BB, 0x07E19BB5), LIMB_PAIR(0x4709427D, 0xB89E54E6), LIMB_PAIR(0xAB677CCF, 0xB09E9978), LIMB_PAIR(0xE4E79E41, 0xD155E8CA), LIMB_PARTIAL(0x17F)
+        },
+        {   // 8 * 16^86 * G
+            LIMB_PAIR(0x1F60C05E, 0xC08891EF), LIMB_PAIR(0x5915D764, 0xF9407F85), LIMB_PAIR(0x0C96F04E, 0xDE8E7A4F), LIMB_PAIR(0x2CC9D658, 0x6F2753D6),
+            LIMB_PAIR(0xDDD346F9, 0x59C566B1), LIMB_PAIR(0xE3197938, 0xF47B8329), LIMB_PAIR(0xEC0F1790, 0x279A225B), LIMB_PAIR(0x302C441D, 0xD2001390), LIMB_PARTIAL(0x01C),
+            LIMB_PAIR(0x20EA5E7F, 0x71F6E57C), LIMB_PAIR(0xC8ECCC18, 0x12786BA3), LIMB_PAIR(0x563ADB36, 0x31BFEEE7), LIMB_PAIR(0xC99E4DB1, 0x688BBE01),
+            LIMB_PAIR(0x58226D89, 0xC1A39C84), LIMB_PAIR(0xD0436B3D, 0x4A23DB6D), LIMB_PAIR(0xBCC4A5D0, 0x9009C835), LIMB_PAIR(0x4BC5E903, 0xB5765B5B), LIMB_PARTIAL(0x147)
+        }
+    },
+#endif
+#if (87 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^87 * G
+            LIMB_PAIR(0x35210DF1, 0x1E2DF236), LIMB_PAIR(0x9AACE566, 0x387B5C56), LIMB_PAIR(0xEE401323, 0xDD8152C9), LIMB_PAIR(0x9CAC0076, 0x56FE9EC9),
+            LIMB_PAIR(0xE1A9F782, 0x88ED7FC1), LIMB_PAIR(0x681F0428, 0x6551487D), LIMB_PAIR(0x97689006, 0xEAACC101), LIMB_PAIR(0x3B7E7FE6, 0x626BCAD1), LIMB_PARTIAL(0x15E),
+            LIMB_PAIR(0x7ACB23CA, 0xE1B3574A), LIMB_PAIR(0x3636A1C2, 0xADDA7C9E), LIMB_PAIR(0x9F3D947C, 0xFC998CF8), LIMB_PAIR(0x1BA0511B, 0x38EE4DF4),
+            LIMB_PAIR(0x03E4694B, 0x1F40CC14), LIMB_PAIR(0x800FB6D9, 0xCCECF4E0), LIMB_PAIR(0xE1665D06, 0x021F708A), LIMB_PAIR(0xC492D329, 0x2BCD7975), LIMB_PARTIAL(0x063)
+        },
+        {   // 2 * 16^87 * G
+            LIMB_PAIR(0xC6AC25BF, 0x2FB204FF), LIMB_PAIR(0x20B8FF3F, 0x04264D4A), LIMB_PAIR(0xA430A774, 0x95B64338), LIMB_PAIR(0x7DA8BBA5, 0x573A4B36),
+            LIMB_PAIR(0x5B83D767, 0x950AFFBB), LIMB_PAIR(0xB560C0F6, 0x9254695B), LIMB_PAIR(0xFF22DF77, 0xFCD8A4FB), LIMB_PAIR(0x2D6E43DC, 0x8625ED30), LIMB_PARTIAL(0x04A),
+            LIMB_PAIR(0x1CAC9547, 0xED8010F6), LIMB_PAIR(0x92C7BA4F, 0x0612E173), LIMB_PAIR(0x051D9478, 0xAF48AEED), LIMB_PAIR(0x69A78479, 0xF7067A10),
+            LIMB_PAIR(0x98A1AA82, 0xB17C4BE8), LIMB_PAIR(0x7A94D7E1, 0x2B21D42A), LIMB_PAIR(0xD38E3B49, 0x461B848F), LIMB_PAIR(0x563A87E7, 0x76AF1BD6), LIMB_PARTIAL(0x0E8)
+        },
+        {   // 3 * 16^87 * G
+            LIMB_PAIR(0xAE0F18F7, 0xC7DDD089), LIMB_PAIR(0x2D964B17, 0x95EAB6D8), LIMB_PAIR(0xB46505F3, 0x009F85D7), LIMB_PAIR(0xA9A1C11A, 0xB67945A0),
+            LIMB_PAIR(0x1BBBC573, 0xD9FF1202), LIMB_PAIR(0xB7362ADA, 0x6BD2CCC2), LIMB_PAIR(0x01DD0F97, 0x4CCE7E08), LIMB_PAIR(0x07812CB0, 0x561695F0), LIMB_PARTIAL(0x06F),
+            LIMB_PAIR(0xF3215E8A, 0xA077FDA2), LIMB_PAIR(0x500D446B, 0x6AF16D30), LIMB_PAIR(0xC74FCC40, 0xA41A906F), LIMB_PAIR(0x522A4CF3, 0x4134CE42),
+            LIMB_PAIR(0xA915D9FF, 0xBC3D327C), LIMB_PAIR(0xCEEA5A67, 0xB337C069), LIMB_PAIR(0x18026771, 0x887DB117), LIMB_PAIR(0x8BEBAC88, 0x5CF16393), LIMB_PARTIAL(0x172)
+        },
+        {   // 4 * 16^87 * G
+            LIMB_PAIR(0x8D71EF32, 0x5A4AB9C1), LIMB_PAIR(0xF4F4CF75, 0x08205F9B), LIMB_PAIR(0xB34A8C55, 0xFE64565D), LIMB_PAIR(0x169994BF, 0xD12BE047),
+            LIMB_PAIR(0x43F91E62, 0xD3C3F84F), LIMB_PAIR(0x2601B686, 0x1DAE2E73), LIMB_PAIR(0x2DEE30E1, 0x2A07FCBE), LIMB_PAIR(0x9A754926, 0x25E56245), LIMB_PARTIAL(0x174),
+            LIMB_PAIR(0x2CE4D340, 0x288455F3), LIMB_PAIR(0xE321170D, 0xA1F4E6B0), LIMB_PAIR(0x90039106, 0x9A36BAC3), LIMB_PAIR(0x98C7ED01, 0x1682B04D),
+            LIMB_PAIR(0xE9EBEF5E, 0x27166C68), LIMB_PAIR(0x01CA803D, 0x41EFE4F0), LIMB_PAIR(0x460A4C5E, 0xF76898AC), LIMB_PAIR(0x1ACBCDA4, 0x6A787FC3), LIMB_PARTIAL(0x103)
+        },
+        {   // 5 * 16^87 * G
+            LIMB_PAIR(0x6978F0DB, 0x5F68A1AC), LIMB_PAIR(0x005885E7, 0xB3329BA5), LIMB_PAIR(0x5DEDCA85, 0xD266D61D), LIMB_PAIR(0x36D128CC, 0x51FCCA0B),
+            LIMB_PAIR(0xC3025CAD, 0x8BEE0599), LIMB_PAIR(0x78E1C6B3, 0x0D3AA61C), LIMB_PAIR(0x3FAB73E4, 0xE030DAEB), LIMB_PAIR(0x2FA127E7, 0xDC536F28), LIMB_PARTIAL(0x16A),
+            LIMB_PAIR(0x4549F784, 0x803482FC), LIMB_PAIR(0x741BD062, 0x0D6EC627), LIMB_PAIR(0x5A834635, 0xA16F16F8), LIMB_PAIR(0xC99B1275, 0x59E41E2A),
+            LIMB_PAIR(0x252F28F5, 0x9B758008), LIMB_PAIR(0xD3B85B44, 0x26784958), LIMB_PAIR(0x740E330F, 0xD1BF7AEB), LIMB_PAIR(0x62CE2EC0, 0x438AD021), LIMB_PARTIAL(0x1B4)
+        },
+        {   // 6 * 16^87 * G
+            LIMB_PAIR(0x3E2DC0A7, 0x7F533532), LIMB_PAIR(0x9EB1C84B, 0x8437FEB7), LIMB_PAIR(0xD63CDFDF, 0x9AFD2F9E), LIMB_PAIR(0xB598BB40, 0xF277BB5D),
+            LIMB_PAIR(0xFE4E83E7, 0xC466C261), LIMB_PAIR(0x851A0675, 0x980A851E), LIMB_PAIR(0x731AB1E1, 0xCF2D8DD5), LIMB_PAIR(0x1925037C, 0xD3AD1804), LIMB_PARTIAL(0x122),
+            LIMB_PAIR(0x50637C5C, 0x58589CCA), LIMB_PAIR(0x09F80DE5, 0x426EE8FF), LIMB_PAIR(0x960F1B39, 0x91D105EB), LIMB_PAIR(0x63D1A564, 0x303BF404),
+            LIMB_PAIR(0x57FACE6D, 0xBCBEFB9F), LIMB_PAIR(0xB1EA2EB3, 0x28A5BE6C), LIMB_PAIR(0xAD4D1BC8, 0x8093F327), LIMB_PAIR(0xF18706B1, 0xB4F34986), LIMB_PARTIAL(0x158)
+        },
+        {   // 7 * 16^87 * G
+            LIMB_PAIR(0x968B2D8F, 0x687BBDFD), LIMB_PAIR(0x08974650, 0x1D287808), LIMB_PAIR(0x5C7B12CB, 0xBC35D66E), LIMB_PAIR(0x81E92ABE, 0x0CA1ACB1),
+            LIMB_PAIR(0xADFEB821, 0x0086135D), LIMB_PAIR(0x0EBEF769, 0xE0E0E15B), LIMB_PAIR(0x86A2ADCC, 0x9E38C067), LIMB_PAIR(0xA2CCD0EB, 0x8DA847D1), LIMB_PARTIAL(0x16E),
+            LIMB_PAIR(0x07F500C3, 0xF1951534), LIMB_PAIR(0x80A5D232, 0x73384195), LIMB_PAIR(0xF6C3D6D7, 0x71E668C1), LIMB_PAIR(0x315DCA1F, 0x8C3510E7),
+            LIMB_PAIR(0xBC78C67D, 0xE2E86FE8), LIMB_PAIR(0x98E98452, 0x690CDF9E), LIMB_PAIR(0x8D2345B3, 0x8FE94C96), LIMB_PAIR(0xC152008C, 0xACA25C4D), LIMB_PARTIAL(0x0F3)
+        },
+        {   // 8 * 16^87 * G
+            LIMB_PAIR(0xEB86608E, 0xDCAED4E0), LIMB_PAIR(0x8D7BA967, 0xFDFD2168), LIMB_PAIR(0x866E3436, 0xD4793142), LIMB_PAIR(0xF9E22704, 0x259B748B),
+            LIMB_PAIR(0xAC039548, 0x86914896), LIMB_PAIR(0xD7C7EEC2, 0x2236C40D), LIMB_PAIR(0xA1C8873E, 0xD76953AE), LIMB_PAIR(0x9CD08A3E, 0xF3E9F953), LIMB_PARTIAL(0x13C),
+            LIMB_PAIR(0x535C50C7, 0x2D653796), LIMB_PAIR(0x3478F1C4, 0xCB8B6A75), LIMB_PAIR(0xCF0AD848, 0xA2ABFB2A), LIMB_PAIR(0x7FC08E6D, 0x9CD60FBF),
+            LIMB_PAIR(0x49F48743, 0x3706C387), LIMB_PAIR(0x3E0781E3, 0x3EA91A1D), LIMB_PAIR(0xD007F364, 0x8C19973B), LIMB_PAIR(0x22E5F10A, 0x566D7CB5), LIMB_PARTIAL(0x103)
+        }
+    },
+#endif
+#if (88 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^88 * G
+            LIMB_PAIR(0x0261ADA4, 0x674E392F), LIMB_PAIR(0x5BB103A8, 0x5AF762F5), LIMB_PAIR(0xC9E8BF69, 0x281AD6A5), LIMB_PAIR(0x5C57AF63, 0xA88AD2E4),
+            LIMB_PAIR(0x3B909CE5, 0x7FBCE1F2), LIMB_PAIR(0x4A8C86DA, 0x37883DA8), LIMB_PAIR(0x8FC8357A, 0x94F7C570), LIMB_PAIR(0xC7C21EA8, 0xA1F2FB59), LIMB_PARTIAL(0x1AC),
+            LIMB_PAIR(0x1CBA57C5, 0x30C79E7B), LIMB_PAIR(0x6062FA39, 0xF71D84BE), LIMB_PAIR(0xE2B9C131, 0x8FB70B03), LIMB_PAIR(0xCD862B12, 0xBB0F27E7),
+            LIMB_PAIR(0x4FFD6A0A, 0x2FEA1087), LIMB_PAIR(0x2A7A7B08, 0x17787158), LIMB_PAIR(0x8653CE49, 0xF79606CC), LIMB_PAIR(0x629A5FF9, 0x9514C960), LIMB_PARTIAL(0x1A0)
+        },
+        {   // 2 * 16^88 * G
+            LIMB_PAIR(0x534DE721, 0x1FB30B26), LIMB_PAIR(0x4123D0BC, 0x46732866), LIMB_PAIR(0x3A143F8E, 0xE4E83C0D), LIMB_PAIR(0x691180E2, 0xE1F5F92A),
+            LIMB_PAIR(0x081F7230, 0x5FB00E76), LIMB_PAIR(0x083C3776, 0x0E4E513D), LIMB_PAIR(0xEB042C2D, 0x5B81EA91), LIMB_PAIR(0x00AF7F4E, 0x7A221CB2), LIMB_PARTIAL(0x0E4),
+            LIMB_PAIR(0x31E75C9D, 0x7BFD3F91), LIMB_PAIR(0xA2C68D12, 0x8545ADAD), LIMB_PAIR(0xF986AD9F, 0x01C295B9), LIMB_PAIR(0x41EB1F2F, 0x186952A5),
+            LIMB_PAIR(0xE802FFC8, 0x6F7E3E3E), LIMB_PAIR(0xB98FC92C, 0x704E75D0), LIMB_PAIR(0x4800A8FB, 0xC233AFEE), LIMB_PAIR(0x549D5FA9, 0xD0111A57), LIMB_PARTIAL(0x10B)
+        },
+        {   // 3 * 16^88 * G
+            LIMB_PAIR(0xE5375E53, 0x238D0F45), LIMB_PAIR(0x60B1447C, 0xB576C6CA), LIMB_PAIR(0x62216556, 0xA3A372A6), LIMB_PAIR(0x8649C9D5, 0xA36F6C4A),
+            LIMB_PAIR(0xAB50C2CB, 0x00E80B35), LIMB_PAIR(0x2556C5A2, 0x11E5520E), LIMB_PAIR(0xD3AA02DF, 0xAC58D6F1), LIMB_PAIR(0x8B95FDDF, 0xD56BF822), LIMB_PARTIAL(0x094),
+            LIMB_PAIR(0x2A513CC5, 0xD172331A), LIMB_PAIR(0x5EF6A6BA, 0x35EEE697), LIMB_PAIR(0xB0ACDC95, 0x4F02B17F), LIMB_PAIR(0x1EB68058, 0x07EC621E),
+            LIMB_PAIR(0xDAC73D4C, 0xF266346C), LIMB_PAIR(0xECAB7DDA, 0xBE978E8A), LIMB_PAIR(0x968C2EB6, 0xDA0244E8), LIMB_PAIR(0xCEE91ED9, 0x50B38345), LIMB_PARTIAL(0x14B)
+        },
+        {   // 4 * 16^88 * G
+            LIMB_PAIR(0xF8816103, 0x01188022), LIMB_PAIR(0xDB3855D8, 0x64E1C614), LIMB_PAIR(0x29A7C0D2, 0xCD4BD4C2), LIMB_PAIR(0x4D5ECE84, 0xD7EC4289),
+            LIMB_PAIR(0x722FC703, 0x947A8BDC), LIMB_PAIR(0xBFEBACFF, 0xA4C09186), LIMB_PAIR(0xDCF3B746, 0xF7FDA81E), LIMB_PAIR(0x435034FC, 0x3BF6DC1B), LIMB_PARTIAL(0x0C8),
+            LIMB_PAIR(0x878B4418, 0x319FC666), LIMB_PAIR(0xCFA14A68, 0xD600347C), LIMB_PAIR(0x912B3C2B, 0x5ABCF8FC), LIMB_PAIR(0xC5CD581D, 0xC82C5E12),
+            LIMB_PAIR(0x50A27865, 0x022F767C), LIMB_PAIR(0xEAD1F5F7, 0x5C606862), LIMB_PAIR(0x2259D674, 0x2702E819), LIMB_PAIR(0xE02204AB, 0xAE371A48), LIMB_PARTIAL(0x01B)
+        },
+        {   // 5 * 16^88 * G
+            LIMB_PAIR(0x1D6F6E88, 0x2AF67B2B), LIMB_PAIR(0x58551562, 0x02B012D3), LIMB_PAIR(0xCAFA5D8A, 0x6B82B1FE), LIMB_PAIR(0xE6FEFE9B, 0x7F82B4E2),
+            LIMB_PAIR(0xE6B8BBDC, 0xAC91D292), LIMB_PAIR(0xAEB0467D, 0x1E330708), LIMB_PAIR(0xD2226EC1, 0xE5723339), LIMB_PAIR(0x11CE4198, 0xDCB1DFC4), LIMB_PARTIAL(0x17C),
+            LIMB_PAIR(0xA74E39FB, 0x4C55853A), LIMB_PAIR(0x3E55ADD6, 0xDEADB934), LIMB_PAIR(0x4D9052CE, 0xBB7F6B23), LIMB_PAIR(0x2F3E7BAD, 0xC3959003),
+            LIMB_PAIR(0xAD990758, 0x78636279), LIMB_PAIR(0x34BCB90B, 0xC476679E), LIMB_PAIR(0xF9FE3F2A, 0x9AB2BADC), LIMB_PAIR(0x1B69EF65, 0x414A32C0), LIMB_PARTIAL(0x0C1)
+        },
+        {   // 6 * 16^88 * G
+            LIMB_PAIR(0x27F2F67E, 0x114453E7), LIMB_PAIR(0x46EDB75A, 0x71999602), LIMB_PAIR(0x0714F2EC, 0x481CFC65), LIMB_PAIR(0xBD48C221, 0x7A359E11),
+            LIMB_PAIR(0xBF80FBDC, 0x6807F0B5), LIMB_PAIR(0x51B3A6FD, 0xDFE57FFF), LIMB_PAIR(0xB6794229, 0xE58F3C47), LIMB_PAIR(0xDEF683BA, 0x7F22CF6A), LIMB_PARTIAL(0x1A6),
+            LIMB_PAIR(0x8C39F9AF, 0x551BBAE2), LIMB_PAIR(0xB1E075DB, 0x5057C3A7), LIMB_PAIR(0x9E0D386A, 0xEEEDD600), LIMB_PAIR(0x715B2507, 0x8D60B730),
+            LIMB_PAIR(0x840BE62E, 0xD65F990B), LIMB_PAIR(0x287CC361, 0x666437B2), LIMB_PAIR(0x9CFE886B, 0x11C2019C), LIMB_PAIR(0xEBF4CE61, 0xBEEF8EB4), LIMB_PARTIAL(0x008)
+        },
+        {   // 7 * 16^88 * G
+            LIMB_PAIR(0xE2CCE69E, 0x422833D5), LIMB_PAIR(0x69FF8B37, 0x3C1C8BDB), LIMB_PAIR(0xC9FB427F, 0x44D41DFB), LIMB_PAIR(0xC54A1824, 0x15BEE2DD),
+            LIMB_PAIR(0xE8CE4AEE, 0x9C804025), LIMB_PAIR(0x9E5665B2, 0x5BCC7E5D), LIMB_PAIR(0x40B6270D, 0xF38636A0), LIMB_PAIR(0x60B6778E, 0x84CADA1A), LIMB_PARTIAL(0x14B),
+            LIMB_PAIR(0x9B47CCBB, 0x28B4411B), LIMB_PAIR(0x6C368197, 0xE4BC1E91), LIMB_PAIR(0x2562C900, 0xC0F36E6B), LIMB_PAIR(0x88C55430, 0xC60D5628),
+            LIMB_PAIR(0xFB81C20F, 0x2E9613DF), LIMB_PAIR(0x56872B5C, 0xFDD934ED), LIMB_PAIR(0x187BBDDD, 0x6BACD3AD), LIMB_PAIR(0xD1E42D9B, 0xF6F821D7), LIMB_PARTIAL(0x12E)
+        },
+        {   // 8 * 16^88 * G
+            LIMB_PAIR(0xDE0D59FD, 0x15581925), LIMB_PAIR(0x1E668987, 0x861DBEF2), LIMB_PAIR(0x81FDAEA7, 0x000CA036), LIMB_PAIR(0xB5007BF9, 0xEE45E5ED),
+            LIMB_PAIR(0x9485C5FB, 0xD9868050), LIMB_PAIR(0xE2A800B9, 0xD58CA541), LIMB_PAIR(0x05E1BF66, 0xA0D643DF), LIMB_PAIR(0xBDCF7DA2, 0x3DB52CBF), LIMB_PARTIAL(0x11C),
+            LIMB_PAIR(0x87AF7109, 0x0A1DB943), LIMB_PAIR(0xFD35138C, 0x33754C60), LIMB_PAIR(0xFC19982A, 0x2BDFF118), LIMB_PAIR(0xD22CCC69, 0x2E8EB645),
+            LIMB_PAIR(0xC73E39D4, 0xA7873CD2), LIMB_PAIR(0x1D04FF18, 0xD024363E), LIMB_PAIR(0x0CC6ABDB, 0x492503D6), LIMB_PAIR(0x185AB722, 0xADE16418), LIMB_PARTIAL(0x15D)
+        }
+    },
+#endif
+#if (89 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^89 * G
+            LIMB_PAIR(0xEA2E4075, 0x58E8CA2C), LIMB_PAIR(0xF271D545, 0x5307BA37), LIMB_PAIR(0x7AE7AD07, 0x14DE3B6E), LIMB_PAIR(0x169EFEB3, 0x6BF3DAC6),
+            LIMB_PAIR(0xF0996AC4, 0x7BE665B6), LIMB_PAIR(0x60A81EA5, 0x3CBD0766), LIMB_PAIR(0xB0876044, 0x93369D84), LIMB_PAIR(0x8A489412, 0x33CD68DC), LIMB_PARTIAL(0x133),
+            LIMB_PAIR(0xDCA5B802, 0x44912D16), LIMB_PAIR(0x808DB8C1, 0x3C30F445), LIMB_PAIR(0x4D2B7D5C, 0xD59E9290), LIMB_PAIR(0x2697A600, 0xC1E20A6B),
+            LIMB_PAIR(0x3A028772, 0xFBBE023C), LIMB_PAIR(0xC6E3B099, 0x8873D0BB), LIMB_PAIR(0x050828AD, 0x5FE76AC9), LIMB_PAIR(0xC0AB0AB0, 0xCF2AC286), LIMB_PARTIAL(0x03E)
+        },
+        {   // 2 * 16^89 * G
+            LIMB_PAIR(0x0076C379, 0x5FC88513), LIMB_PAIR(0xF31E63D1, 0x85E6F65C), LIMB_PAIR(0xEBC87B34, 0x5DEF4F28), LIMB_PAIR(0xED0BE6EF, 0x74D28F51),
+            LIMB_PAIR(0x38771840, 0x1B83692D), LIMB_PAIR(0xA859B7BE, 0xD791F738), LIMB_PAIR(0xA02D058E, 0xED0CC1FE), LIMB_PAIR(0xFECD2E54, 0x2B1BEFC5), LIMB_PARTIAL(0x1A5),
+            LIMB_PAIR(0x48CCA591, 0x63864B89), LIMB_PAIR(0x29335913, 0x38195D61), LIMB_PAIR(0xC799AAE4, 0x8DC688BC), LIMB_PAIR(0x417331B4, 0xB6D23959),
+            LIMB_PAIR(0x743F8E65, 0x3D08B4F2), LIMB_PAIR(0x4FEC2809, 0xD46215B2), LIMB_PAIR(0x0497E0F5, 0xB37D1700), LIMB_PAIR(0x26EE48A6, 0x6BB17CC0), LIMB_PARTIAL(0x1E7)
+        },
+        {   // 3 * 16^89 * G
+            LIMB_PAIR(0xA1E93E26, 0x38F34463), LIMB_PAIR(0xA933AD7B, 0x536F9FE3), LIMB_PAIR(0xEEAF58FD, 0x49AA8A6C), LIMB_PAIR(0x8548A60B, 0x590A9014),
+            LIMB_PAIR(0xC34B6A3E, 0xDA53DFA8), LIMB_PAIR(0x2393CD71, 0x92A83FCD), LIMB_PAIR(0x21D4394A, 0x802A7CC9), LIMB_PAIR(0xA00B1E13, 0xC565B327), LIMB_PARTIAL(0x036),
+            LIMB_PAIR(0x8143ECFE, 0x155DB782), LIMB_PAIR(0x7DE2CD53, 0x17CB85EB), LIMB_PAIR(0xAF4AB2EA, 0x74B165A8), LIMB_PAIR(0xB2D9F719, 0x9B27A18B),
+            LIMB_PAIR(0x7F45F2A2, 0xDAE468E1), LIMB_PAIR(0x6F20B170, 0x4F0B09ED), LIMB_PAIR(0xAB1E2351, 0x5A15A831), LIMB_PAIR(0x3B7FC656, 0x7D64FE68), LIMB_PARTIAL(0x149)
+        },
+        {   // 4 * 16^89 * G
+            LIMB_PAIR(0x80C55F68, 0x59614F85), LIMB_PAIR(0x60CED87B, 0x9DCD662C), LIMB_PAIR(0xF852F5AE, 0xE6DC932B), LIMB_PAIR(0x4F45A31E, 0x9DB84A91),
+            LIMB_PAIR(0xBABEA7AC, 0x6062B2D6), LIMB_PAIR(0x28B65906, 0x54A5881D), LIMB_PAIR(0xB0F80DBF, 0x551E0B60), LIMB_PAIR(0xB286F88C, 0xDB468350), LIMB_PARTIAL(0x05B),
+            LIMB_PAIR(0x6BBB805F, 0x90565610), LIMB_PAIR(0x6668E10C, 0xE38F65A4), LIMB_PAIR(0x57F2578F, 0xE6192566), LIMB_PAIR(0x2A72A1AB, 0xC26D8092),
+            LIMB_PAIR(0x5119D939, 0x904A9A52), LIMB_PAIR(0xD6709295, 0x622F5869), LIMB_PAIR(0x74543616, 0x0A6ED429), LIMB_PAIR(0x1C388E75, 0x8DAD3C36), LIMB_PARTIAL(0x135)
+        },
+        {   // 5 * 16^89 * G
+            LIMB_PAIR(0xE4DA7574, 0x457DB9FD), LIMB_PAIR(0x5885E55E, 0x7A0A2897), LIMB_PAIR(0xA9B51665, 0x9AB3CD5E), LIMB_PAIR(0xD9477C8E, 0x321E2F08),
+            LIMB_PAIR(0xF8F37F58, 0x41E7C2FC), LIMB_PAIR(0xA87D975D, 0xF32D7426), LIMB_PAIR(0xCE959A1F, 0xF4BEB557), LIMB_PAIR(0x4DD97BC4, 0x858A6D9D), LIMB_PARTIAL(0x0A9),
+            LIMB_PAIR(0xE8C2F351, 0x5F10563C), LIMB_PAIR(0x36E2FAC5, 0x112B7D63), LIMB_PAIR(0xAA08B49C, 0x32951764), LIMB_PAIR(0x6E6CD71E, 0x3E39AA16),
+            LIMB_PAIR(0x7B47C211, 0x63E54AF6), LIMB_PAIR(0xC9ECE8D1, 0x8C05ED23), LIMB_PAIR(0x12ED9538, 0xB315B2D3), LIMB_PAIR(0xFC0BCA7D, 0x1CFFFB33), LIMB_PARTIAL(0x133)
+        },
+        {   // 6 * 16^89 * G
+            LIMB_PAIR(0x6DAE890D, 0x8BF2FD7E), LIMB_PAIR(0xC9028F7E, 0x6B675C1F), LIMB_PAIR(0x10D1A8C4, 0x627B27A8), LIMB_PAIR(0xF522E753, 0xD24C988B),
+            LIMB_PAIR(0xE0BE9869, 0xAB18F36A), LIMB_PAIR(0x962CDFA1, 0x9FF0E1FA), LIMB_PAIR(0x5945DB5E, 0x14911EF5), LIMB_PAIR(0x7652AB6D, 0x6FD48FB3), LIMB_PARTIAL(0x1DE),
+            LIMB_PAIR(0xFBB2E5EB, 0xF8184CE8), LIMB_PAIR(0xB09791ED, 0x02056B25), LIMB_PAIR(0x24ABEE11, 0x2E112640), LIMB_PAIR(0xC5119309, 0xCF22E0FE),
+            LIMB_PAIR(0x136A9CD4, 0x64E4ED26), LIMB_PAIR(0x3E9B4BAA, 0x16BBCC71), LIMB_PAIR(0x83D64789, 0xF2970B1F), LIMB_PAIR(0xEC9A3758, 0x82C66547), LIMB_PARTIAL(0x1CF)
+        },
+        {   // 7 * 16^89 * G
+            LIMB_PAIR(0x19230651, 0x7D1CB4E1), LIMB_PAIR(0x3F601E3B, 0xD2B97137), LIMB_PAIR(0x5FD38F46, 0x0B69955D), LIMB_PAIR(0xD816E924, 0xDE4097AD),
+            LIMB_PAIR(0xC04A98EA, 0x3A34E753), LIMB_PAIR(0x48839FAA, 0x522AC82A), LIMB_PAIR(0x1A571619, 0x9BB3D26E), LIMB_PAIR(0xA1E9BDC7, 0x637F4B56), LIMB_PARTIAL(0x18B),
+            LIMB_PAIR(0x45AF1D3B, 0x7156BAA6), LIMB_PAIR(0xB7F8AAF1, 0x72FF3815), LIMB_PAIR(0xA19C4F45, 0xAAE7E5AB), LIMB_PAIR(0x9C736939, 0xDC47A5D2),
+            LIMB_PAIR(0x77A2B40D, 0x1AC3D442), LIMB_PAIR(0x373A68E1, 0xE3EB3CAC), LIMB_PAIR(0xF6AED8C4, 0xD28A0E83), LIMB_PAIR(0x51A2CD35, 0x4DD537B0), LIMB_PARTIAL(0x0AC)
+        },
+        {   // 8 * 16^89 * G
+            LIMB_PAIR(0x10205C46, 0x9BF40D71), LIMB_PAIR(0x161DF55D, 0x10F27886), LIMB_PAIR(0x4763C7B1, 0xDDA5B762), LIMB_PAIR(0x0FBE9F17, 0x4BCE5511),
+            LIMB_PAIR(0x4BD30A7D, 0x8FA95448), LIMB_PAIR(0x1D27E799, 0x302E33B3), LIMB_PAIR(0x9752FFD2, 0x4DDDE60F), LIMB_PAIR(0xCDED611D, 0x98DDB153), LIMB_PARTIAL(0x069),
+            LIMB_PAIR(0x3E817CAE, 0xDD9ABCBB), LIMB_PAIR(0x52C627C2, 0x3C6B3FFD), LIMB_PAIR(0xE28C3DFC, 0x3209E7B3), LIMB_PAIR(0xEDB287BD, 0x376F4071),
+            LIMB_PAIR(0xAF0FAB10, 0x9DDAAA58), LIMB_PAIR(0xF859B34E, 0x969074CF), LIMB_PAIR(0xC87E6EF9, 0xE16AEC58), LIMB_PAIR(0xD113B6E0, 0xC5C7D470), LIMB_PARTIAL(0x066)
+        }
+    },
+#endif
+#if (90 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^90 * G
+            LIMB_PAIR(0xF8ECE594, 0x9DAE6D7A), LIMB_PAIR(0xCCE0B041, 0x7AD12F48), LIMB_PAIR(0xE7374970, 0x9D97EFC7), LIMB_PAIR(0x311F5E2E, 0x7B8B1668),
+            LIMB_PAIR(0xBB741640, 0x0D68A7B6), LIMB_PAIR(0x9BE65AA4, 0xF9EA3DEA), LIMB_PAIR(0xA11C78A5, 0xAA3E6811), LIMB_PAIR(0x0AC6E65E, 0x155AD4E5), LIMB_PARTIAL(0x062),
+            LIMB_PAIR(0xFEBBFAD7, 0x5936D4FE), LIMB_PAIR(0xA30ED6C6, 0xC94F1262), LIMB_PAIR(0xB2081A7D, 0x6013FAF4), LIMB_PAIR(0x85A4E883, 0x684FFDBF),
+            LIMB_PAIR(0x19DBDAD1, 0xAAFF2438), LIMB_PAIR(0x1F91E40F, 0x8F348444), LIMB_PAIR(0x1ECEA707, 0x145D06F6), LIMB_PAIR(0xECBADE82, 0xEB7A4980), LIMB_PARTIAL(0x04D)
+        },
+        {   // 2 * 16^90 * G
+            LIMB_PAIR(0x5BB88603, 0x600C5B05), LIMB_PAIR(0x9BE3B3FB, 0x9E4B5B73), LIMB_PAIR(0x4844AB63, 0xD485D76B), LIMB_PAIR(0x20CD3B55, 0xFFA20A33),
+            LIMB_PAIR(0xE40EC83B, 0x6003AD11), LIMB_PAIR(0xEED37AC2, 0xEB5423B4), LIMB_PAIR(0x9D4A0F44, 0xC25C87C0), LIMB_PAIR(0x03C0E7D4, 0x2DE4BFE7), LIMB_PARTIAL(0x1EE),
+            LIMB_PAIR(0x14BC1043, 0xAA9EE44D), LIMB_PAIR(0x24C86D4E, 0x9FC3875A), LIMB_PAIR(0xB7405EE2, 0x8F9BC8B6), LIMB_PAIR(0xB46A336F, 0xAEDE13E5),
+            LIMB_PAIR(0x6651C1F8, 0xBF5DE69F), LIMB_PAIR(0x70DC1E30, 0xB8E7A340), LIMB_PAIR(0xF4D76655, 0x437D3592), LIMB_PAIR(0xBEEE67B4, 0x2D2C90E1), LIMB_PARTIAL(0x1C6)
+        },
+        {   // 3 * 16^90 * G
+            LIMB_PAIR(0x008164D4, 0xEAA998A0), LIMB_PAIR(0x413F4FF0, 0x15D52DCD), LIMB_PAIR(0xE4FF76A9, 0x3B180C19), LIMB_PAIR(0xC30ECBF4, 0x879FDC34),
+            LIMB_PAIR(0x518FD432, 0x7EC379CD), LIMB_PAIR(0xE6161641, 0x8A51BB32), LIMB_PAIR(0xD582E0E8, 0x92E85885), LIMB_PAIR(0xE00847A0, 0x5503550A), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0x039B003C, 0xDDF4C5CC), LIMB_PAIR(0xC4814D97, 0x0C8D3F93), LIMB_PAIR(0x02075F02, 0x213CA9B5), LIMB_PAIR(0x88920F8E, 0x347D87B9),
+            LIMB_PAIR(0x96DBF1B7, 0x96EF11C8), LIMB_PAIR(0xCF927DC6, 0xB092BA1C), LIMB_PAIR(0xD068F694, 0x6A12DCC7), LIMB_PAIR(0x16A6E447, 0xE98DB68D), LIMB_PARTIAL(0x0AE)
+        },
+        {   // 4 * 16^90 * G
+            LIMB_PAIR(0x06C9837E, 0x46F9436C), LIMB_PAIR(0x08FEA5BB, 0xA4FEB9D5), LIMB_PAIR(0xAA2FF650, 0xC733EF31), LIMB_PAIR(0x205E0F43, 0xA58F3FFE),
+            LIMB_PAIR(0xBF567988, 0x54D1150F), LIMB_PAIR(0x16052B8B, 0x78C0AC92), LIMB_PAIR(0xA2F59A1B, 0xED2E587B), LIMB_PAIR(0x2D6B5969, 0xF80D6E5C), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0x207FF447, 0x5029C675), LIMB_PAIR(0xDEDC6A4C, 0xD8842988), LIMB_PAIR(0xCF78D639, 0x5C3B90E4), LIMB_PAIR(0x6E8E9794, 0xA008AE41),
+            LIMB_PAIR(0x29023BD6, 0x098D2FE7), LIMB_PAIR(0x003E7A86, 0xF4BC574A), LIMB_PAIR(0x3D4FFA1E, 0xA7A02499), LIMB_PAIR(0x8D521BD5, 0xD5564109), LIMB_PARTIAL(0x1E8)
+        },
+        {   // 5 * 16^90 * G
+            LIMB_PAIR(0xEB78796F, 0x8B335FA8), LIMB_PAIR(0x98C921FE, 0x632A1E35), LIMB_PAIR(0x13EBB873, 0x8A81E3DC), LIMB_PAIR(0x392AC9A2, 0x6EA0A1CA),
+            LIMB_PAIR(0x7A111FE3, 0x12AC8F7D), LIMB_PAIR(0x1B74982F, 0xE8019E48), LIMB_PAIR(0x372BD012, 0x970840AB), LIMB_PAIR(0x8030B6BA, 0xF08F4677), LIMB_PARTIAL(0x191),
+            LIMB_PAIR(0xFF6CA70B, 0xF1DAFF85), LIMB_PAIR(0xC4C98B48, 0x83A30831), LIMB_PAIR(0x4B44F090, 0xB3D1402F), LIMB_PAIR(0xFFC5FC43, 0xEA42A852),
+            LIMB_PAIR(0x5ADB2237, 0x64FB5A0E), LIMB_PAIR(0xEF91D510, 0xA3F97D5C), LIMB_PAIR(0xF0D6D405, 0xAA8A0026), LIMB_PAIR(0xFEDCD04A, 0xA9DB41BE), LIMB_PARTIAL(0x061)
+        },
+        {   // 6 * 16^90 * G
+            LIMB_PAIR(0xA79FEC2F, 0x56F46AEE), LIMB_PAIR(0xCAA8072E, 0xAE7420E6), LIMB_PAIR(0xE0909A51, 0xA8D82818), LIMB_PAIR(0xD53B908D, 0xB6FDE2A2),
+            LIMB_PAIR(0xAA4B288A, 0x2C291216), LIMB_PAIR(0x315BC370, 0x522C8BE8), LIMB_PAIR(0x48CBE4C9, 0x27D342ED), LIMB_PAIR(0x82BDA6ED, 0xCC7E7D22), LIMB_PARTIAL(0x179),
+            LIMB_PAIR(0x26B789CB, 0x28C243B8), LIMB_PAIR(0x736B8F95, 0x0EE9307A), LIMB_PAIR(0x17C8D0AB, 0x6BB00263), LIMB_PAIR(0x96C50F3F, 0xFB2563CB),
+            LIMB_PAIR(0xFF006875, 0xDA495D9A), LIMB_PAIR(0x06B90869, 0x4FB2A947), LIMB_PAIR(0x4AEC98D5, 0xF00CD1A6), LIMB_PAIR(0x8BD40482, 0x0EFF72F2), LIMB_PARTIAL(0x197)
+        },
+        {   // 7 * 16^90 * G
+            LIMB_PAIR(0x26762E69, 0x4ADE586F), LIMB_PAIR(0x5C5452E9, 0xA4D590D7), LIMB_PAIR(0xA3D17B63, 0x866D96D7), LIMB_PAIR(0x54373909, 0x4820299B),
+            LIMB_PAIR(0x71889F59, 0x9C4970F0), LIMB_PAIR(0xA47395C5, 0xBE409EA4), LIMB_PAIR(0x960A0EA2, 0xA1C14B17), LIMB_PAIR(0x307327B7, 0x4A33C8A0), LIMB_PARTIAL(0x102),
+            LIMB_PAIR(0x2B54A6C6, 0xE590FE7C), LIMB_PAIR(0xC8F7ED0C, 0xB4A1AB5B), LIMB_PAIR(0x0051C927, 0x91F19A29), LIMB_PAIR(0x8EAC2400, 0xD9F5D607),
+            LIMB_PAIR(0xF0CF556B, 0x9BC268F6), LIMB_PAIR(0x4112A75F, 0x823C7740), LIMB_PAIR(0x7D3647C4, 0x1A816849), LIMB_PAIR(0xB3B45D09, 0x46F70E49), LIMB_PARTIAL(0x050)
+        },
+        {   // 8 * 16^90 * G
+            LIMB_PAIR(0xF74FB22C, 0x768ED0F6), LIMB_PAIR(0x7E169C57, 0xC967F656), LIMB_PAIR(0xE59559C1, 0xF6C74D22), LIMB_PAIR(0x556961CD, 0x0A419045),
+            LIMB_PAIR(0x61C6F540, 0x97E83EF2), LIMB_PAIR(0xF523B49B, 0x434D28D7), LIMB_PAIR(0x17AC09EA, 0x0F83E171), LIMB_PAIR(0x4A281F4E, 0xFB02352B), LIMB_PARTIAL(0x160),
+            LIMB_PAIR(0x666031B0, 0x78577044), LIMB_PAIR(0xD401794D, 0x2AA75F54), LIMB_PAIR(0xDE68D202, 0xABF814BB), LIMB_PAIR(0xFD8F841D, 0xC1D18B79),
+            LIMB_PAIR(0x8C8449BD, 0xB68EDC5E), LIMB_PAIR(0x88A85D15, 0x837B65B0), LIMB_PAIR(0x13249FA7, 0x31A2C34E), LIMB_PAIR(0x54BE5F59, 0x2E20348E), LIMB_PARTIAL(0x148)
+        }
+    },
+#endif
+#if (91 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^91 * G
+            LIMB_PAIR(0x91609A61, 0x1D40359E), LIMB_PAIR(0x6890616D, 0x9ADF4E08), LIMB_PAIR(0x8B14A62E, 0x89DD6635), LIMB_PAIR(0x49ADEB20, 0xFAA34C0A),
+            LIMB_PAIR(0x105A9BF0, 0x174689F7), LIMB_PAIR(0xA83A1154, 0xBF727A3D), LIMB_PAIR(0x0D6D5D50, 0x4AFE90C1), LIMB_PAIR(0x1F2FE4FF, 0x9954D9D0), LIMB_PARTIAL(0x126),
+            LIMB_PAIR(0x5D2AC4B2, 0x027DF255), LIMB_PAIR(0x83078809, 0xA61A5557), LIMB_PAIR(0x0237C9BD, 0x6F5D2CD4), LIMB_PAIR(0xCEF7C441, 0x7CD9F911),
+            LIMB_PAIR(0xABC19578, 0x0D5256EF), LIMB_PAIR(0xF338DB58, 0xD86047AF), LIMB_PAIR(0x14D7C98E, 0xAA2A1B50), LIMB_PAIR(0xF5E65A3A, 0xBE9EDFFA), LIMB_PARTIAL(0x1BD)
+        },
+        {   // 2 * 16^91 * G
+            LIMB_PAIR(0x43D7F5D4, 0xFD4AC9A3), LIMB_PAIR(0xC99E0960, 0xEFAF0979), LIMB_PAIR(0x309E568C, 0x49F0CEE8), LIMB_PAIR(0x0E83B629, 0x72B9D277),
+            LIMB_PAIR(0x6B2C1601, 0xC9462E6B), LIMB_PAIR(0x9014EDF5, 0x20FD87A5), LIMB_PAIR(0x4589A246, 0xF153AE0A), LIMB_PAIR(0xD0AD9B0C, 0xDFC0C033), LIMB_PARTIAL(0x034),
+            LIMB_PAIR(0x87ABE460, 0xEA4CFB11), LIMB_PAIR(0x8E491E8B, 0xDE9D0BF0), LIMB_PAIR(0xE7B44C51, 0x8B4F7381), LIMB_PAIR(0x582FC6F2, 0x5B470FD4),
+            LIMB_PAIR(0x9BD31114, 0x351D31D0), LIMB_PAIR(0x21911E42, 0xAE868705), LIMB_PAIR(0x99C6CCEA, 0x8C25EAD6), LIMB_PAIR(0xF6408194, 0x6372BB04), LIMB_PARTIAL(0x12D)
+        },
+        {   // 3 * 16^91 * G
+            LIMB_PAIR(0x2648A187, 0xF76D94EA), LIMB_PAIR(0x841945B5, 0x65CD1ED8), LIMB_PAIR(0x6D3B41CC, 0xA8B8B52C), LIMB_PAIR(0xC03E31C3, 0x729F4F50),
+            LIMB_PAIR(0x4D930A40, 0x2B315B9D), LIMB_PAIR(0x7C78DB5B, 0x32C50364), LIMB_PAIR(0xE0CAB657, 0x53B03B69), LIMB_PAIR(0xD343324A, 0x1CB16125), LIMB_PARTIAL(0x07A),
+            LIMB_PAIR(0xCBBA148C, 0x0D0CC220), LIMB_PAIR(0x066281E5, 0x21E13A15), LIMB_PAIR(0xAE6BB049, 0x304904E6), LIMB_PAIR(0x580464DA, 0x9ED34CF1),
+            LIMB_PAIR(0x84A6CDAE, 0xB1C66D46), LIMB_PAIR(0x751E42A6, 0x6AD36012), LIMB_PAIR(0xC89EDBBE, 0xFEEED4DC), LIMB_PAIR(0xA31A337D, 0xD9897853), LIMB_PARTIAL(0x002)
+        },
+        {   // 4 * 16^91 * G
+            LIMB_PAIR(0x7DE96AD8, 0x9F89743C), LIMB_PAIR(0xB0E3C020, 0xB36AF506), LIMB_PAIR(0x9DA8C48E, 0x92BA9B36), LIMB_PAIR(0x14E3DDA7, 0x3B06A6C9),
+            LIMB_PAIR(0xD035A505, 0x4AD7DBD9), LIMB_PAIR(0x5825E565, 0xFD87C28A), LIMB_PAIR(0x5633716C, 0x1F117E6B), LIMB_PAIR(0xDCD99A7F, 0xCEF5E5D6), LIMB_PARTIAL(0x1E9),
+            LIMB_PAIR(0x7FED2CEC, 0x839BA695), LIMB_PAIR(0x132C54CC, 0xBA25C337), LIMB_PAIR(0x857C3815, 0xF032353E), LIMB_PAIR(0xB3B42940, 0x9119F2E5),
+            LIMB_PAIR(0xFECBF8F8, 0xCF21D2C0), LIMB_PAIR(0xB5BAFB4F, 0x66B09AB9), LIMB_PAIR(0x3946FF07, 0xDBE05A70), LIMB_PAIR(0x2D9BA878, 0xB83571FC), LIMB_PARTIAL(0x018)
+        },
+        {   // 5 * 16^91 * G
+            LIMB_PAIR(0x97DE0E00, 0xF62C03A3), LIMB_PAIR(0x2611619D, 0xF48D1DE8), LIMB_PAIR(0x721BC870, 0x15D1A317), LIMB_PAIR(0x4ED06BF2, 0x6AC60D81),
+            LIMB_PAIR(0x890CDBD6, 0xB8BC2CE0), LIMB_PAIR(0x46F4B48F, 0x78108228), LIMB_PAIR(0x287C7697, 0x04EF830C), LIMB_PAIR(0xA49838DA, 0x32961E64), LIMB_PARTIAL(0x0FE),
+            LIMB_PAIR(0xD8551D19, 0x97CD5E96), LIMB_PAIR(0xB2B1FD05, 0x68053374), LIMB_PAIR(0xCCF9A8F2, 0xE3013CFC), LIMB_PAIR(0x981FA6C1, 0xCEFDD29F),
+            LIMB_PAIR(0x02683FFB, 0xEF3A4BA4), LIMB_PAIR(0x55EDC412, 0x2E945F58), LIMB_PAIR(0xBFD433F1, 0xA4A58E25), LIMB_PAIR(0x513F74F4, 0x621EF049), LIMB_PARTIAL(0x120)
+        },
+        {   // 6 * 16^91 * G
+            LIMB_PAIR(0x16822E74, 0x9E1FADFB), LIMB_PAIR(0xE2FDE79B, 0x601A0218), LIMB_PAIR(0xCC11FB66, 0xFAF91C0F), LIMB_PAIR(0x38141AA4, 0x39B3D9CD),
+            LIMB_PAIR(0x7B5E91A7, 0xAECEE423), LIMB_PAIR(0xA418FF4A, 0xE78C36BA), LIMB_PAIR(0x7F084D25, 0x97FFC63F), LIMB_PAIR(0x4160AB02, 0x8D9F7B52), LIMB_PARTIAL(0x079),
+            LIMB_PAIR(0x27772A7B, 0x4460A503), LIMB_PAIR(0x7BB4B563, 0xCA164BAF), LIMB_PAIR(0xCF894432, 0x576F7498), LIMB_PAIR(0xB7C21EF1, 0x62AF7B73),
+            LIMB_PAIR(0xA1FF287D, 0x6559CD67), LIMB_PAIR(0x0189B834, 0x366D4903), LIMB_PAIR(0x02496D3D, 0xCE4F2DD6), LIMB_PAIR(0xD27B4FFD, 0x140A8383), LIMB_PARTIAL(0x125)
+        },
+        {   // 7 * 16^91 * G
+            LIMB_PAIR(0x0847C82E, 0x16A82634), LIMB_PAIR(0x5F9A9912, 0xB7004254), LIMB_PAIR(0x8D0B4DFF, 0x798F9E62), LIMB_PAIR(0x03C638D1, 0x65342A65),
+            LIMB_PAIR(0x5C54E53F, 0x4F20EEBE), LIMB_PAIR(0xF840E2CC, 0xC14BBFC9), LIMB_PAIR(0xBF5122A8, 0xB7BDAEC4), LIMB_PAIR(0x47B6EE89, 0x36F77704), LIMB_PARTIAL(0x14C),
+            LIMB_PAIR(0x452878A4, 0x1A055B39), LIMB_PAIR(0xA4357006, 0xEC912E63), LIMB_PAIR(0xFFC61CED, 0xFA8318C8), LIMB_PAIR(0xF05C5661, 0x2B0D1441),
+            LIMB_PAIR(0xF197AB70, 0x0B31A6B7), LIMB_PAIR(0x99BC8257, 0x69D91F59), LIMB_PAIR(0x6B1FE057, 0x62CE7782), LIMB_PAIR(0x8FBF4A9F, 0xCC37B64E), LIMB_PARTIAL(0x160)
+        },
+        {   // 8 * 16^91 * G
+            LIMB_PAIR(0x32BF47DB, 0x73C9CA8C), LIMB_PAIR(0x3827DF79, 0x9914D586), LIMB_PAIR(0x7E5D5D65, 0x59440090), LIMB_PAIR(0xCC1F4322, 0x1FE4F4BD),
+            LIMB_PAIR(0x38AD9FFE, 0x8E14F73D), LIMB_PAIR(0xEEA079B5, 0x4B47C892), LIMB_PAIR(0xC9BD577B, 0x753F974A), LIMB_PAIR(0xC3271DFC, 0x4231EF4E), LIMB_PARTIAL(0x0BB),
+            LIMB_PAIR(0x14BCAEFD, 0x871424AC), LIMB_PAIR(0x97355E9D, 0xB1B24D5C), LIMB_PAIR(0x6B934706, 0xD3849639), LIMB_PAIR(0xA8C892F6, 0xE90A821C),
+            LIMB_PAIR(0x145AA180, 0x884DF6CC), LIMB_PAIR(0x4C7DCB49, 0x0DC1730E), LIMB_PAIR(0x67744185, 0xDAD8A1EF), LIMB_PAIR(0xADD5CA97, 0x444DE13B), LIMB_PARTIAL(0x008)
+        }
+    },
+#endif
+#if (92 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^92 * G
+            LIMB_PAIR(0x75804DA9, 0x2A7E8AC1), LIMB_PAIR(0x8D50BDC6, 0x0B41F611), LIMB_PAIR(0xD8FAFB1C, 0xCFA0A757), LIMB_PAIR(0xD231A6B0, 0x75540D94),
+            LIMB_PAIR(0x0C4FE03D, 0x524440FB), LIMB_PAIR(0xCE9738DD, 0xB8665FBF), LIMB_PAIR(0x8F1BD64F, 0xBB74F6A8), LIMB_PAIR(0xBB8D6C67, 0x063AFA3C), LIMB_PARTIAL(0x189),
+            LIMB_PAIR(0xA864385F, 0x259B9DA4), LIMB_PAIR(0x17C2597B, 0xDBAFC55C), LIMB_PAIR(0x56BF5D23, 0xDE890ACB), LIMB_PAIR(0xF8455B59, 0xE51182C0),
+            LIMB_PAIR(0xC456E1C7, 0x75D51A03), LIMB_PAIR(0xB318E747, 0x9C7929C6), LIMB_PAIR(0x39B3ED84, 0xAF23A7F1), LIMB_PAIR(0x910F4AB2, 0xEE136A2B), LIMB_PARTIAL(0x1AC)
+        },
+        {   // 2 * 16^92 * G
+            LIMB_PAIR(0x35E16743, 0x6E1B7D0B), LIMB_PAIR(0x54D72C65, 0xCAD975B3), LIMB_PAIR(0x453B8906, 0x78F7434A), LIMB_PAIR(0x9690FA05, 0x8D140CAE),
+            LIMB_PAIR(0x31FE6BFF, 0x6C8E152A), LIMB_PAIR(0x418E415A, 0x1721155E), LIMB_PAIR(0x77693D9F, 0x73B115DC), LIMB_PAIR(0x9BBECDF1, 0x1274EA40), LIMB_PARTIAL(0x134),
+            LIMB_PAIR(0xF3354B80, 0x5953C5FE), LIMB_PAIR(0xBCDA146A, 0x1E60A291), LIMB_PAIR(0x71EBE5D6, 0x1E20C5C5), LIMB_PAIR(0xCE4DFD53, 0x0BD949BF),
+            LIMB_PAIR(0x83280185, 0xE489A644), LIMB_PAIR(0x3743F2A4, 0x81908288), LIMB_PAIR(0x81EC227D, 0x6126ED35), LIMB_PAIR(0x7FF6CFEF, 0xA4AAB290), LIMB_PARTIAL(0x12B)
+        },
+        {   // 3 * 16^92 * G
+            LIMB_PAIR(0xEF873F3E, 0x5D8C23C4), LIMB_PAIR(0xCE7BAE33, 0x2A29D680), LIMB_PAIR(0xBC00FC8E, 0x5109E098), LIMB_PAIR(0x3CFAD961, 0x9BF92EFC),
+            LIMB_PAIR(0x62036BCF, 0x272DFA33), LIMB_PAIR(0xC2B13688, 0x5ABB516C), LIMB_PAIR(0xDDCB08AB, 0xBFAD4CCC), LIMB_PAIR(0x4F260709, 0x05945B93), LIMB_PARTIAL(0x043),
+            LIMB_PAIR(0x08A5F87F, 0x67FE093B), LIMB_PAIR(0x6C6FE1B1, 0x5F8E248A), LIMB_PAIR(0xA3B887A2, 0xF54F710B), LIMB_PAIR(0x90F7E972, 0x12E1B687),
+            LIMB_PAIR(0x429CD6C6, 0x7002BD70), LIMB_PAIR(0xE896B58B, 0x0F010D4A), LIMB_PAIR(0x1A7F5713, 0x44FB054B), LIMB_PAIR(0x65508714, 0xB9F30268), LIMB_PARTIAL(0x173)
+        },
+        {   // 4 * 16^92 * G
+            LIMB_PAIR(0xA567339C, 0xD414309F), LIMB_PAIR(0xDFF5FBCA, 0x4EE5C7A8), LIMB_PAIR(0x064CC887, 0x33D8E6C3), LIMB_PAIR(0xCA553CBD, 0x15992EB4),
+            LIMB_PAIR(0x459DA20D, 0x3D733BB4), LIMB_PAIR(0xA682B305, 0x98C2DE2E), LIMB_PAIR(0x5602ED92, 0x68C13BED), LIMB_PAIR(0xC3BF7B46, 0x639B79F1), LIMB_PARTIAL(0x0B5),
+            LIMB_PAIR(0x289407E1, 0x93DE5E06), LIMB_PAIR(0xB05A27BE, 0xA8F2B4E1), LIMB_PAIR(0x9F5A6BE0, 0x9D07927A), LIMB_PAIR(0xF1B97F94, 0x9A5D02E2),
+            LIMB_PAIR(0xF2DABBB9, 0x320DB20D), LIMB_PAIR(0x0C14980B, 0x99131333), LIMB_PAIR(0xF888E761, 0x44845E16), LIMB_PAIR(0x63A5538F, 0x1BAEB180), LIMB_PARTIAL(0x196)
+        },
+        {   // 5 * 16^92 * G
+            LIMB_PAIR(0x9510D278, 0xF41D38D4), LIMB_PAIR(0x2C1AA285, 0xFA2C2B94), LIMB_PAIR(0xD512246E, 0xDF7BB55C), LIMB_PAIR(0xCB15D14D, 0x980B046A),
+            LIMB_PAIR(0xDBAF8AD4, 0x3FE4F4D4), LIMB_PAIR(0xD3D4F7AC, 0x6CBFCE0E), LIMB_PAIR(0xDEBBBC9C, 0x81FF0F46), LIMB_PAIR(0x6F1AADAB, 0x2550BC94), LIMB_PARTIAL(0x0AC),
+            LIMB_PAIR(0x7488849F, 0x2CC18103), LIMB_PAIR(0xC1DD8868, 0x78DD9FB3), LIMB_PAIR(0x37790AF2, 0xB433B8ED), LIMB_PAIR(0x896219FB, 0xFF3689C4),
+            LIMB_PAIR(0x0151C7D3, 0x0AAA321E), LIMB_PAIR(0xCDE3D282, 0x1F39B461), LIMB_PAIR(0x5BE49EC6, 0x10B3783A), LIMB_PAIR(0x5462C805, 0xB8B801D3), LIMB_PARTIAL(0x13A)
+        },
+        {   // 6 * 16^92 * G
+            LIMB_PAIR(0x2553A1AF, 0x46EC5A84), LIMB_PAIR(0x9B9F05BD, 0xD41C6348), LIMB_PAIR(0xB10D500C, 0x8FF28519), LIMB_PAIR(0xEBC991AB, 0xFF4F8D03),
+            LIMB_PAIR(0xD997D9BC, 0x57B6A954), LIMB_PAIR(0x8588D18D, 0x9FACDD08), LIMB_PAIR(0xD61A6BD6, 0x7FB43E8B), LIMB_PAIR(0xACDD98C5, 0x62C8A561), LIMB_PARTIAL(0x047),
+            LIMB_PAIR(0x52C911AA, 0x7CF6F1E1), LIMB_PAIR(0x8B0BDE06, 0xF9270C1E), LIMB_PAIR(0x999F3E7E, 0xEE6D0874), LIMB_PAIR(0xA5F058AD, 0x85530601),
+            LIMB_PAIR(0x288B8E87, 0xF1A1D2CA), LIMB_PAIR(0x2EE84682, 0x13FDCD5B), LIMB_PAIR(0x61AFA5FF, 0x031E7459), LIMB_PAIR(0x7D25B91E, 0xEED38B2D), LIMB_PARTIAL(0x10F)
+        },
+        {   // 7 * 16^92 * G
+            LIMB_PAIR(0x51D8C679, 0x976B0EB7), LIMB_PAIR(0xA55BEB39, 0x5308C32C), LIMB_PAIR(0xB935189B, 0x43F46AE2), LIMB_PAIR(0x18420B08, 0xC29299EE),
+            LIMB_PAIR(0x94DC4570, 0xFE346CF4), LIMB_PAIR(0x53C6C99E, 0xC6207E3E), LIMB_PAIR(0x5D708240, 0x3E202EC2), LIMB_PAIR(0x5D608C48, 0xC790BEC7), LIMB_PARTIAL(0x082),
+            LIMB_PAIR(0xDB07B8AC, 0x6F30F944), LIMB_PAIR(0x6C090BC2, 0x7B4F2213), LIMB_PAIR(0x2D325DCA, 0xD03A6097), LIMB_PAIR(0x3DAA7EC7, 0xD079042D),
+            LIMB_PAIR(0x039AEFCB, 0x959BF843), LIMB_PAIR(0x84ADD69C, 0x956DA50C), LIMB_PAIR(0xBA49D06D, 0x2F47DAB7), LIMB_PAIR(0x7F80AC00, 0xA57F444F), LIMB_PARTIAL(0x0D4)
+        },
+        {   // 8 * 16^92 * G
+            LIMB_PAIR(0x525ABF32, 0x55417FFA), LIMB_PAIR(0x78067DFC, 0x1FF40E16), LIMB_PAIR(0x2795EA6A, 0x431A0AE1), LIMB_PAIR(0xEF54C597, 0xC3DE691C),
+            LIMB_PAIR(0x95F9D2BB, 0x60A0C51B), LIMB_PAIR(0x82772F1A, 0x30840CA9), LIMB_PAIR(0x96EB0344, 0xDDAF4604), LIMB_PAIR(0x8615D783, 0x03A9F6F4), LIMB_PARTIAL(0x035),
+            LIMB_PAIR(0x33EDCFA4, 0x74598CB2), LIMB_PAIR(0xDE9DCCDE, 0xBB866BC9), LIMB_PAIR(0x2A673BB2, 0x0C483116), LIMB_PAIR(0xFEE306A7, 0x3EDDD388),
+            LIMB_PAIR(0xC80EB5B9, 0x8785A002), LIMB_PAIR(0x1937371F, 0xE2BD81F7), LIMB_PAIR(0x5684A105, 0x50164859), LIMB_PAIR(0x1F26E0DB, 0xF0F3FDDE), LIMB_PARTIAL(0x119)
+        }
+    },
+#endif
+#if (93 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^93 * G
+            LIMB_PAIR(0x76BCD267, 0xA8C68B9D), LIMB_PAIR(0x96362C64, 0x95F78CA8), LIMB_PAIR(0x03603F09, 0xBB8302F3), LIMB_PAIR(0x272622B9, 0xF15B0D54),
+            LIMB_PAIR(0x97692826, 0x4CEBFCD1), LIMB_PAIR(0x19C758FC, 0x4D29D2B1), LIMB_PAIR(0xE11AC4FE, 0x4703BB56), LIMB_PAIR(0x36B53BDB, 0x7152ABD5), LIMB_PARTIAL(0x060),
+            LIMB_PAIR(0x27BEDE63, 0x68AC9834), LIMB_PAIR(0xE54A999B, 0xD5C6C405), LIMB_PAIR(0x231E8EB0, 0x3D763E32), LIMB_PAIR(0x47C7EDB7, 0xE36CA2FF),
+            LIMB_PAIR(0x8D2B6016, 0xD9F18505), LIMB_PAIR(0x60D55105, 0x4E576EB0), LIMB_PAIR(0x76E3F591, 0xE3E9F249), LIMB_PAIR(0x83EA6A2C, 0xD5BF8F00), LIMB_PARTIAL(0x157)
+        },
+        {   // 2 * 16^93 * G
+            LIMB_PAIR(0x02079397, 0x43164D3A), LIMB_PAIR(0x490D948F, 0x2A3FD379), LIMB_PAIR(0x635E0C5A, 0x79AD8714), LIMB_PAIR(0x71B5CF85, 0x5BA92898),
+            LIMB_PAIR(0x956BEAD4, 0x1BABC5A1), LIMB_PAIR(0xFF6D701D, 0x5408A355), LIMB_PAIR(0x69570FE3, 0xD924D7A3), LIMB_PAIR(0x831755AF, 0x60D41A46), LIMB_PARTIAL(0x00C),
+            LIMB_PAIR(0xEC2F26C2, 0x7CCFE1A4), LIMB_PAIR(0x85EBC29B, 0x549A32BE), LIMB_PAIR(0xD46E8B7B, 0xE183FF35), LIMB_PAIR(0xD421604E, 0x0E8DFC66),
+            LIMB_PAIR(0xB30DDEE6, 0x1AB4332C), LIMB_PAIR(0x6C35CEA0, 0xAD4B6B31), LIMB_PAIR(0x856F9258, 0x1D9C4DF7), LIMB_PAIR(0x850F81E4, 0x65882C90), LIMB_PARTIAL(0x052)
+        },
+        {   // 3 * 16^93 * G
+            LIMB_PAIR(0x9278F093, 0x14B97DA0), LIMB_PAIR(0xAAF50774, 0x77B62EB2), LIMB_PAIR(0x595788EB, 0xC94C47E5), LIMB_PAIR(0xE78A7ACB, 0x3F6FBF17),
+            LIMB_PAIR(0xD648CDAE, 0x8BEAED91), LIMB_PAIR(0xB0281EEA, 0x1402478D), LIMB_PAIR(0x057A9CC4, 0x06F48D3E), LIMB_PAIR(0x56F972CF, 0x9A75CB7B), LIMB_PARTIAL(0x01F),
+            LIMB_PAIR(0xA7049117, 0x74749B84), LIMB_PAIR(0x275EFA96, 0xEE6187DF), LIMB_PAIR(0xA7DAEFB7, 0xC8A4DD7F), LIMB_PAIR(0xF26B4DEE, 0xC2A5680F),
+            LIMB_PAIR(0x02C8ED96, 0xE64AE238), LIMB_PAIR(0xC75AB457, 0x55D8E7BD), LIMB_PAIR(0x13DAAD11, 0xC29F93F6), LIMB_PAIR(0x10EF96B4, 0x7E485B3F), LIMB_PARTIAL(0x01C)
+        },
+        {   // 4 * 16^93 * G
+            LIMB_PAIR(0x1F91A935, 0x27CDF012), LIMB_PAIR(0x9B1DA866, 0xA3A2D0AB), LIMB_PAIR(0x20C6250C, 0x62BC6AD5), LIMB_PAIR(0x35233AAA, 0xE637B6B2),
+            LIMB_PAIR(0xE5109B06, 0x3921E6A2), LIMB_PAIR(0x58D73641, 0xA24B99C5), LIMB_PAIR(0xD3BD99F7, 0x33073B25), LIMB_PAIR(0xC0498CFA, 0x60FAD5FE), LIMB_PARTIAL(0x14A),
+            LIMB_PAIR(0x63080BDA, 0xB1871852), LIMB_PAIR(0x12D3FCF0, 0x82707391), LIMB_PAIR(0x7B3CD673, 0x770B113C), LIMB_PAIR(0xCA843432, 0x2CF6E741),
+            LIMB_PAIR(0xD75AF1C0, 0x77C74D8D), LIMB_PAIR(0xA0C24279, 0x979E1FD4), LIMB_PAIR(0xF335EF51, 0xBF05A641), LIMB_PAIR(0x26B269B7, 0xD7EC205D), LIMB_PARTIAL(0x1E0)
+        },
+        {   // 5 * 16^93 * G
+            LIMB_PAIR(0xCDF52775, 0x12DF8924), LIMB_PAIR(0x6E3BC06F, 0xD8974966), LIMB_PAIR(0x3E68CF93, 0x7F3310CE), LIMB_PAIR(0x97117FE2, 0x0A012C7F),
+            LIMB_PAIR(0xA16ADBB8, 0x65288F5B), LIMB_PAIR(0x92BC7054, 0xB1E26BB8), LIMB_PAIR(0x8A63D1C7, 0xA6833AC9), LIMB_PAIR(0x5DE7F156, 0x5F3B945A), LIMB_PARTIAL(0x176),
+            LIMB_PAIR(0x0DD3A366, 0xEB895899), LIMB_PAIR(0x958AA6F3, 0xEF27B635), LIMB_PAIR(0x1DABEC19, 0x8EF1DF5F), LIMB_PAIR(0x0F53BDD9, 0x871FEC8B),
+            LIMB_PAIR(0x9EFE0C6A, 0xFBB413BE), LIMB_PAIR(0xAA16ADD4, 0x06E372B6), LIMB_PAIR(0xA945E423, 0xDD08C66F), LIMB_PAIR(0xF3B12FEB, 0x66C1B806), LIMB_PARTIAL(0x166)
+        },
+        {   // 6 * 16^93 * G
+            LIMB_PAIR(0xFC3DE00D, 0xA200E9EE), LIMB_PAIR(0xD3A22751, 0xE02A24D1), LIMB_PAIR(0xAD1898F2, 0xC793C92E), LIMB_PAIR(0xB70F915E, 0x46AB743B),
+            LIMB_PAIR(0xD9A716C3, 0x274FED3C), LIMB_PAIR(0x5C0D17A2, 0x292A4353), LIMB_PAIR(0x7874C664, 0xE7619F93), LIMB_PAIR(0x3E3C8169, 0xF21DBAB5), LIMB_PARTIAL(0x19C),
+            LIMB_PAIR(0x10F6E0D1, 0x6D19C5DE), LIMB_PAIR(0xDDFFA70C, 0xC8D263FF), LIMB_PAIR(0x40A77AEF, 0xAC7886E6), LIMB_PAIR(0xD4A9191F, 0x22BD9CF6),
+            LIMB_PAIR(0x624532D3, 0xC53A3301), LIMB_PAIR(0xFA74A13E, 0x8EDFA100), LIMB_PAIR(0x57701DD1, 0x15F04D33), LIMB_PAIR(0x793D4DA4, 0xD5CFD2ED), LIMB_PARTIAL(0x170)
+        },
+        {   // 7 * 16^93 * G
+            LIMB_PAIR(0x51ED20EC, 0x627F65FD), LIMB_PAIR(0x6DEC3A4E, 0x1C31D4A3), LIMB_PAIR(0xEA76B32C, 0x8F222EC0), LIMB_PAIR(0xBD5A76A5, 0x890E15C3),
+            LIMB_PAIR(0x7A3E2D67, 0x23617469), LIMB_PAIR(0xD8178F45, 0xBED29D6D), LIMB_PAIR(0xC90E2DF7, 0xD61F7707), LIMB_PAIR(0x91BE7739, 0x31C286DD), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0xE3D9F5A5, 0x7EA9AE7C), LIMB_PAIR(0x9DDA23C5, 0xCC26143E), LIMB_PAIR(0xFD1EF741, 0xC231022E), LIMB_PAIR(0xDC1FA1DC, 0x66E91F63),
+            LIMB_PAIR(0x364D03E9, 0xE831781E), LIMB_PAIR(0x629AF703, 0xF2247B2B), LIMB_PAIR(0xAE2B773B, 0x08F7EB82), LIMB_PAIR(0xA0A208B0, 0x7C543051), LIMB_PARTIAL(0x1D3)
+        },
+        {   // 8 * 16^93 * G
+            LIMB_PAIR(0x30239552, 0x55A64B0A), LIMB_PAIR(0x4BFAB408, 0x447C6E08), LIMB_PAIR(0x7063035C, 0x43CB4327), LIMB_PAIR(0xD293B9EE, 0x68AFE121),
+            LIMB_PAIR(0xED50A41C, 0xA975707B), LIMB_PAIR(0x4488F96C, 0x15A6A8BE), LIMB_PAIR(0x1BF798E4, 0xDBB6A3D8), LIMB_PAIR(0xB5E600C9, 0x0DE2F103), LIMB_PARTIAL(0x1F0),
+            LIMB_PAIR(0x45BB5352, 0xC070DAB4), LIMB_PAIR(0xAFDAC74C, 0xD590D895), LIMB_PAIR(0x37BFADE9, 0x679FD21D), LIMB_PAIR(0xA0AEDD41, 0xE8DC87E7),
+            LIMB_PAIR(0xB31DBD72, 0x9E48F870), LIMB_PAIR(0xC7EA78B4, 0x21AFACD8), LIMB_PAIR(0xFBCF9D22, 0x8AC51F26), LIMB_PAIR(0xDE2B01DB, 0xB52293AF), LIMB_PARTIAL(0x1F8)
+        }
+    },
+#endif
+#if (94 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^94 * G
+            LIMB_PAIR(0xA2FDA60F, 0x0079A845), LIMB_PAIR(0xDA8DB63A, 0x6DFDF102), LIMB_PAIR(0x0148A559, 0x7D275960), LIMB_PAIR(0x684B9737, 0xE089C346),
+            LIMB_PAIR(0x820BDB1C, 0x09F865B2), LIMB_PAIR(0x891AE57E, 0x000DAEF6), LIMB_PAIR(0xA4F64F15, 0x384F5EEE), LIMB_PAIR(0x3DA7E79C, 0xDD68E490), LIMB_PARTIAL(0x13A),
+            LIMB_PAIR(0x514AC5DB, 0x20B7457D), LIMB_PAIR(0x954721FD, 0xA03028FB), LIMB_PAIR(0x5C77CB17, 0x6F20D518), LIMB_PAIR(0xAD74495A, 0x28F92697),
+            LIMB_PAIR(0x6B327DC8, 0x630E0156), LIMB_PAIR(0x65832CA9, 0x6C5067D6), LIMB_PAIR(0xD3F6DB89, 0x9C9305FB), LIMB_PAIR(0x905FFFDF, 0x681013FA), LIMB_PARTIAL(0x188)
+        },
+        {   // 2 * 16^94 * G
+            LIMB_PAIR(0x2A708597, 0x9D590CA7), LIMB_PAIR(0x17C45D92, 0x5EA564A2), LIMB_PAIR(0x09F8D031, 0xA7098CA4), LIMB_PAIR(0x17A9A6D9, 0x231C7161),
+            LIMB_PAIR(0x951ECC81, 0x5919A777), LIMB_PAIR(0x7AB0CD85, 0x9FB5DF36), LIMB_PAIR(0x2B6B445C, 0x7F4D2D7A), LIMB_PAIR(0x68251F9D, 0x73A27646), LIMB_PARTIAL(0x037),
+            LIMB_PAIR(0xE9E14113, 0x7BC56153), LIMB_PAIR(0x030AF56B, 0x4747084F), LIMB_PAIR(0x1EFA69EC, 0x865ABBE9), LIMB_PAIR(0xDA5D565F, 0xAF6534B5),
+            LIMB_PAIR(0xB0001866, 0x40549F0B), LIMB_PAIR(0x812351AF, 0xC451348F), LIMB_PAIR(0x190EB107, 0xE7323AE9), LIMB_PAIR(0xBFC098F1, 0xFB3FD76F), LIMB_PARTIAL(0x01A)
+        },
+        {   // 3 * 16^94 * G
+            LIMB_PAIR(0x318448E6, 0x7A10BE40), LIMB_PAIR(0xCE412830, 0xA09AB497), LIMB_PAIR(0x70D88770, 0xE31C4343), LIMB_PAIR(0xE8D30D6D, 0xA52FBA9F),
+            LIMB_PAIR(0x228558D5, 0x121E6D15), LIMB_PAIR(0xFD0D7D5E, 0xD2435C13), LIMB_PAIR(0x18AA5676, 0x600DD279), LIMB_PAIR(0xE5179D2A, 0xA6F5C318), LIMB_PARTIAL(0x1A4),
+            LIMB_PAIR(0x2AD8D75E, 0xE822AF01), LIMB_PAIR(0x858BEFF4, 0x30E19389), LIMB_PAIR(0x83D74ABD, 0xF9F942FD), LIMB_PAIR(0x1696C1EA, 0xC9219982),
+            LIMB_PAIR(0xC3198D4D, 0xD3153B60), LIMB_PAIR(0xFCBE0073, 0xEA6C2263), LIMB_PAIR(0x2E1B79E1, 0x85754D63), LIMB_PAIR(0xC26E0148, 0xB1B80018), LIMB_PARTIAL(0x1CA)
+        },
+        {   // 4 * 16^94 * G
+            LIMB_PAIR(0xCF0F33CA, 0x7EF1F62C), LIMB_PAIR(0x184DE5D6, 0x225317B7), LIMB_PAIR(0x260FC821, 0xBA7645C1), LIMB_PAIR(0xD057844C, 0x522C34F2),
+            LIMB_PAIR(0xC4A6DFF0, 0x53282114), LIMB_PAIR(0x5F6DBDBD, 0x6D3D8400), LIMB_PAIR(0xF3FB787A, 0x165E4194), LIMB_PAIR(0xC8C575EB, 0x210A607A), LIMB_PARTIAL(0x0FB),
+            LIMB_PAIR(0x832C8DEE, 0x68C834C2), LIMB_PAIR(0x1602F932, 0xCC4FF861), LIMB_PAIR(0x456ED4BB, 0xDCFA537D), LIMB_PAIR(0x0C079647, 0x68F20175),
+            LIMB_PAIR(0x8F28ECD5, 0x972D770B), LIMB_PAIR(0x2D099800, 0xAA8FDBE8), LIMB_PAIR(0xECADDB29, 0x06285716), LIMB_PAIR(0xD5DC6040, 0x67FA9A61), LIMB_PARTIAL(0x15B)
+        },
+        {   // 5 * 16^94 * G
+            LIMB_PAIR(0x8DF57790, 0x128BC3C6), LIMB_PAIR(0xEC53BC56, 0x43C56BC0), LIMB_PAIR(0xCAE49EED, 0x7910B88B), LIMB_PAIR(0x18A0D687, 0x3EA6A0DF),
+            LIMB_PAIR(0x448F5D7A, 0xB28B1D89), LIMB_PAIR(0x89351D2E, 0x3F03FDD1), LIMB_PAIR(0x2C3E495B, 0x139D03DF), LIMB_PAIR(0x6F18F00F, 0x7C088A9A), LIMB_PARTIAL(0x173),
+            LIMB_PAIR(0x241D777B, 0x719FC61A), LIMB_PAIR(0x4539225E, 0x1F0CE653), LIMB_PAIR(0x7A4FCA8E, 0xEA96D552), LIMB_PAIR(0xF9CFEF0B, 0x37858C68),
+            LIMB_PAIR(0x38DD070D, 0x052382D0), LIMB_PAIR(0x12A26448, 0xF14D02BF), LIMB_PAIR(0xA98265AE, 0xCAE30526), LIMB_PAIR(0x2B32266A, 0xE9694DB2), LIMB_PARTIAL(0x0B0)
+        },
+        {   // 6 * 16^94 * G
+            LIMB_PAIR(0x99548073, 0xF3FBCFF1), LIMB_PAIR(0xACBD6713, 0x118F9094), LIMB_PAIR(0x8288B675, 0x1C416C44), LIMB_PAIR(0xF3636371, 0x5B1B6008),
+            LIMB_PAIR(0xD2B9B9C4, 0xFC6D212C), LIMB_PAIR(0x4E026405, 0x4D4CDA91), LIMB_PAIR(0xC6E27757, 0xD0D1C15F), LIMB_PAIR(0xB3536CB7, 0x9C68F492), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0x71718D8A, 0x4C27FC7C), LIMB_PAIR(0x2DA77A01, 0x565B59DC), LIMB_PAIR(0xA34E7517, 0xA1BBCEBE), LIMB_PAIR(0xB3163BD9, 0x433ABABA),
+            LIMB_PAIR(0x5DB1C3F3, 0xDA5EBB98), LIMB_PAIR(0xD8ED0CE9, 0x06C8AF6C), LIMB_PAIR(0xE2F6F034, 0x29B3FA8A), LIMB_PAIR(0x5C79ABD6, 0xC6298DD7), LIMB_PARTIAL(0x061)
+        },
+        {   // 7 * 16^94 * G
+            LIMB_PAIR(0xDE58C7C3, 0x8D1A5A77), LIMB_PAIR(0x442B5CAF, 0xD0A69124), LIMB_PAIR(0x8EC7DC07, 0x941A596A), LIMB_PAIR(0x03F666F4, 0xFA464087),
+            LIMB_PAIR(0x2E2444E8, 0x517C887B), LIMB_PAIR(0xCC4FED90, 0x23336FB2), LIMB_PAIR(0xF6D6BEDA, 0x42E16757), LIMB_PAIR(0x0334867A, 0x31028CFC), LIMB_PARTIAL(0x069),
+            LIMB_PAIR(0x28D45D76, 0x23AF4719), LIMB_PAIR(0x3F620742, 0x32FBDF65), LIMB_PAIR(0xC8FA6CEB, 0x049C2152), LIMB_PAIR(0xBFBDFB05, 0x3ADA0B48),
+            LIMB_PAIR(0x729E6FE5, 0xB8A01F53), LIMB_PAIR(0xFC1183C6, 0xC0204462), LIMB_PAIR(0xDDB24298, 0x5F9A9454), LIMB_PAIR(0xDA7DC145, 0xCD9A5C6E), LIMB_PARTIAL(0x074)
+        },
+        {   // 8 * 16^94 * G
+            LIMB_PAIR(0x622ED5C2, 0xE12B714E), LIMB_PAIR(0xCB699185, 0xB1E036A7), LIMB_PAIR(0x1AB44645, 0x3920A737), LIMB_PAIR(0xF5A325E1, 0x9844C8D9),
+            LIMB_PAIR(0xC02DE758, 0xA91BEA02), LIMB_PAIR(0x18ADE985, 0xAAE624A0), LIMB_PAIR(0xCC31937D, 0x3A700E40), LIMB_PAIR(0xBFDEA449, 0x47C0B398), LIMB_PARTIAL(0x0CA),
+            LIMB_PAIR(0xA9E1B74E, 0x04213750), LIMB_PAIR(0xB3F7FF5B, 0xA1D25057), LIMB_PAIR(0x259DC673, 0xF8C7FDCC), LIMB_PAIR(0x953CA2B9, 0xA837E675),
+            LIMB_PAIR(0xABF04630, 0xE23E1E1F), LIMB_PAIR(0x9889EA3B, 0xAFE1F1B9), LIMB_PAIR(0xC4DB25CB, 0x40988791), LIMB_PAIR(0xF18669B8, 0xEC8592E4), LIMB_PARTIAL(0x14A)
+        }
+    },
+#endif
+#if (95 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^95 * G
+            LIMB_PAIR(0xEFBF6B21, 0x18CAFF50), LIMB_PAIR(0x51F2BA1D, 0x0EEB65EC), LIMB_PAIR(0x296C458B, 0x2CD8A43F), LIMB_PAIR(0x9747CEAB, 0x04D795B2),
+            LIMB_PAIR(0xDC306C57, 0x52B0BCA6), LIMB_PAIR(0x17EC9C28, 0x39FE8AD5), LIMB_PAIR(0x81A0CB57, 0xA4A9E3FB), LIMB_PAIR(0xA638D6F5, 0xDD6933A9), LIMB_PARTIAL(0x17D),
+            LIMB_PAIR(0xD39AC021, 0x9893EB50), LIMB_PAIR(0x39BD296B, 0x3BF70873), LIMB_PAIR(0x792DEC05, 0xA10440A7), LIMB_PAIR(0xA67AD18F, 0x96BE97E7),
+            LIMB_PAIR(0x17AE5F6D, 0xCF2175AE), LIMB_PAIR(0x0B6F0503, 0x70FBB8BF), LIMB_PAIR(0xF7A755AD, 0xBB565FAD), LIMB_PAIR(0x93CCFD37, 0x8904F9A0), LIMB_PARTIAL(0x0F8)
+        },
+        {   // 2 * 16^95 * G
+            LIMB_PAIR(0x2B72359F, 0xC7C5D424), LIMB_PAIR(0xD89718F9, 0x9AEDFA4E), LIMB_PAIR(0x858B335C, 0x74773E4F), LIMB_PAIR(0xB5020D9E, 0xCCCF6730),
+            LIMB_PAIR(0xAAA8BEE0, 0x7F2B567B), LIMB_PAIR(0xD1D4C7CB, 0x929B3D35), LIMB_PAIR(0x1D6602B4, 0xBF1C5559), LIMB_PAIR(0x4782966D, 0x58FD9615), LIMB_PARTIAL(0x1C2),
+            LIMB_PAIR(0x7095C048, 0xF87AA9D8), LIMB_PAIR(0x67C5DC33, 0x145AF97F), LIMB_PAIR(0x5808379C, 0x1541A34B), LIMB_PAIR(0x72F16AFC, 0xD5BE2045),
+            LIMB_PAIR(0xA10E4D9E, 0x008A4AA0), LIMB_PAIR(0xADB03C27, 0xF75936EF), LIMB_PAIR(0xA6D93005, 0xCDA58468), LIMB_PAIR(0xD0CFA2CC, 0x1817E5BA), LIMB_PARTIAL(0x078)
+        },
+        {   // 3 * 16^95 * G
+            LIMB_PAIR(0x2CFF741F, 0xF669C458), LIMB_PAIR(0xCB12D0F3, 0x558296D0), LIMB_PAIR(0x70BE227A, 0x4CA064D7), LIMB_PAIR(0xCF89F9F2, 0x02B8D5CA),
+            LIMB_PAIR(0x8F1E5A13, 0xB4E06660), LIMB_PAIR(0x9C08B765, 0xA030D85A), LIMB_PAIR(0x922E04E8, 0xDFEB77D6), LIMB_PAIR(0x9603967A, 0x65930C72), LIMB_PARTIAL(0x15D),
+            LIMB_PAIR(0x4FF2E952, 0x70CDEAFF), LIMB_PAIR(0x8B6332A9, 0xBAA81BA8), LIMB_PAIR(0x798836FD, 0xE573D5B4), LIMB_PAIR(0x605C5ECC, 0x5B68B878),
+            LIMB_PAIR(0x47BC37EB, 0x3F0A6ABD), LIMB_PAIR(0xDFA7F440, 0x823A54E1), LIMB_PAIR(0x5C500937, 0x2FC0AA7A), LIMB_PAIR(0x35953C9B, 0xB97B588C), LIMB_PARTIAL(0x1AB)
+        },
+        {   // 4 * 16^95 * G
+            LIMB_PAIR(0x1BA719B6, 0xD89DE804), LIMB_PAIR(0x5B7139E2, 0x9A84D614), LIMB_PAIR(0xD16E4F4B, 0xC2F91C87), LIMB_PAIR(0xBB8175EA, 0x7ADCB047),
+            LIMB_PAIR(0x3C2FE568, 0x4C301C4B), LIMB_PAIR(0xE6E82790, 0xEC7DEA0C), LIMB_PAIR(0x9CE824AB, 0xCC2C7886), LIMB_PAIR(0x64E12C47, 0xAA0F82DC), LIMB_PARTIAL(0x16A),
+            LIMB_PAIR(0xA0B4332D, 0x3C6DCA8E), LIMB_PAIR(0xD82DC4DC, 0xB161C4E9), LIMB_PAIR(0x63029487, 0xFDA87290), LIMB_PAIR(0x34209806, 0xACE5D0B6),
+            LIMB_PAIR(0x8968AC6E, 0xB8C940B7), LIMB_PAIR(0xD0C0973F, 0xB61329E9), LIMB_PAIR(0xB1AA99B6, 0xBCB0A143), LIMB_PAIR(0x2211AE06, 0x96B83193), LIMB_PARTIAL(0x057)
+        },
+        {   // 5 * 16^95 * G
+            LIMB_PAIR(0x2FD93AD6, 0x39A64D5D), LIMB_PAIR(0x2637E7F1, 0x667FF12D), LIMB_PAIR(0x5151441B, 0xED31162E), LIMB_PAIR(0x8277E2BB, 0x9ABDF916),
+            LIMB_PAIR(0xEC0A5F93, 0x1B7630F0), LIMB_PAIR(0x5B002930, 0x89A828CC), LIMB_PAIR(0xB246BEFA, 0x912428AD), LIMB_PAIR(0x765DBFE1, 0x632B0787), LIMB_PARTIAL(0x18D),
+            LIMB_PAIR(0x6693BAFA, 0xEBF44BA8), LIMB_PAIR(0x8A12BB84, 0x3AD44731), LIMB_PAIR(0x5D02D2FD, 0xC0E12ABB), LIMB_PAIR(0x9AC44290, 0xCCDCBC00),
+            LIMB_PAIR(0xEA70A61B, 0xFCC3F910), LIMB_PAIR(0x7DBBD680, 0xCAED5619), LIMB_PAIR(0x2D159763, 0xECA08D0B), LIMB_PAIR(0x6D9DC6DB, 0x4F51A9AF), LIMB_PARTIAL(0x095)
+        },
+        {   // 6 * 16^95 * G
+            LIMB_PAIR(0x24FF803A, 0x63722459), LIMB_PAIR(0x7C6401E9, 0x4C674396), LIMB_PAIR(0x8EFB71AD, 0x322820A8), LIMB_PAIR(0x18386499, 0x49A9BB7E),
+            LIMB_PAIR(0x011BE153, 0x809F13B4), LIMB_PAIR(0x1CAA0E61, 0x21EA3BED), LIMB_PAIR(0xCB8A3C34, 0x062A8EB9), LIMB_PAIR(0xD371B482, 0xDAD37CA0), LIMB_PARTIAL(0x04D),
+            LIMB_PAIR(0x425737BD, 0x517E7E99), LIMB_PAIR(0x74652EA7, 0xF0D5129C), LIMB_PAIR(0x493390DD, 0x46E5F98B), LIMB_PAIR(0xACCD9071, 0x889C952F),
+            LIMB_PAIR(0x732246DD, 0xC01D4483), LIMB_PAIR(0x191B7F2A, 0x6E3982CA), LIMB_PAIR(0xEC4FFA9D, 0xEF390898), LIMB_PAIR(0x4DCF0CA9, 0xAC0C5604), LIMB_PARTIAL(0x11D)
+        },
+        {   // 7 * 16^95 * G
+            LIMB_PAIR(0x4DD2D2D3, 0xF0B9EDE3), LIMB_PAIR(0x8C4D1CEE, 0xB0607939), LIMB_PAIR(0x0611DF8F, 0x1CA4EC57), LIMB_PAIR(0x53B914D6, 0x7F32D197),
+            LIMB_PAIR(0xDFA4DF49, 0x99B6F882), LIMB_PAIR(0xB265F518, 0xFBE161CF), LIMB_PAIR(0x40C76BBC, 0xC6DB288E), LIMB_PAIR(0x281437B1, 0xC8970E3F), LIMB_PARTIAL(0x139),
+            LIMB_PAIR(0x1A18DB0A, 0x9D76D4A5), LIMB_PAIR(0x238445C6, 0x59E76809), LIMB_PAIR(0x6A48DEAE, 0xA0F52E64), LIMB_PAIR(0x338904D4, 0x3692A8A8),
+            LIMB_PAIR(0xBA28D02A, 0x3FE48D48), LIMB_PAIR(0xB958B23D, 0x9F2130AA), LIMB_PAIR(0xCF8CD8E9, 0x210A547E), LIMB_PAIR(0x5179029A, 0x46E7623E), LIMB_PARTIAL(0x0BC)
+        },
+        {   // 8 * 16^95 * G
+            LIMB_PAIR(0x503CFE9A, 0xBE58970D), LIMB_PAIR(0x2DD620A9, 0x72000A86), LIMB_PAIR(0x6D0EF833, 0x5825B283), LIMB_PAIR(0xC706F2C7, 0xB88D53B7),
+            LIMB_PAIR(0x0501F0F7, 0x5F7DF7CD), LIMB_PAIR(0x2FA3B809, 0xF1FD2E3B), LIMB_PAIR(0x557798C9, 0xF3AFD9FB), LIMB_PAIR(0xB970A87D, 0x9254426A), LIMB_PARTIAL(0x135),
+            LIMB_PAIR(0xE8947E84, 0x577560BE), LIMB_PAIR(0xB0F49A8C, 0xC60B998C), LIMB_PAIR(0x9829431B, 0x81D18BEF), LIMB_PAIR(0x5F48ADA5, 0xEAA5FA38),
+            LIMB_PAIR(0x12DB61AF, 0xBA2CB726), LIMB_PAIR(0xF3D26BBE, 0xFA9DE7DD), LIMB_PAIR(0x26881C14, 0x97876D06), LIMB_PAIR(0x8C84185D, 0xAEC86663), LIMB_PARTIAL(0x15B)
+        }
+    },
+#endif
+#if (96 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^96 * G
+            LIMB_PAIR(0x0BCF3B88, 0x442EBF30), LIMB_PAIR(0xDC5BFD2B, 0x4B863857), LIMB_PAIR(0xC50960C2, 0x632A1056), LIMB_PAIR(0xC9D74020, 0xDBF49444),
+            LIMB_PAIR(0x78287D19, 0x335F464B), LIMB_PAIR(0x5C490A63, 0x0CF8D5C7), LIMB_PAIR(0xD7D2D2C6, 0x4F9D9BD7), LIMB_PAIR(0xAD52D8A9, 0x1490FB61), LIMB_PARTIAL(0x0EB),
+            LIMB_PAIR(0x34A088DB, 0x42AABE74), LIMB_PAIR(0x9E5B69EE, 0x871248C8), LIMB_PAIR(0x55A87EDB, 0x7D624D6E), LIMB_PAIR(0xBAEE4473, 0x81BC0BCF),
+            LIMB_PAIR(0x9559A1B0, 0xF450C5AD), LIMB_PAIR(0xDF4C738C, 0xA604379C), LIMB_PAIR(0x10EC0574, 0x36B304E2), LIMB_PAIR(0x8D8CF3D9, 0x948A50D3), LIMB_PARTIAL(0x18E)
+        },
+        {   // 2 * 16^96 * G
+            LIMB_PAIR(0x5565EB6E, 0xC6ECF2F5), LIMB_PAIR(0x2B260A3D, 0x05E89460), LIMB_PAIR(0x32C54616, 0x459E2604), LIMB_PAIR(0x47DD43AC, 0xFBF40AAB),
+            LIMB_PAIR(0x9AD0B934, 0x54D5949F), LIMB_PAIR(0xCEA0EEF4, 0x992295A5), LIMB_PAIR(0xD5520B7A, 0x8A5AF63C), LIMB_PAIR(0xA7F1FFDD, 0x536AE69F), LIMB_PARTIAL(0x17B),
+            LIMB_PAIR(0x3F0BC9F5, 0xDDD868A7), LIMB_PAIR(0xBB82DC6D, 0xB33A39D1), LIMB_PAIR(0x48953CE8, 0x878D8AA0), LIMB_PAIR(0x9802F566, 0xF2A35CE2),
+            LIMB_PAIR(0x07F25B60, 0xA2B9188A), LIMB_PAIR(0x0933CA89, 0xD01FED06), LIMB_PAIR(0x3114F728, 0x89013FCE), LIMB_PAIR(0x87828FAD, 0x8128FDBE), LIMB_PARTIAL(0x054)
+        },
+        {   // 3 * 16^96 * G
+            LIMB_PAIR(0x58FEAF6B, 0x005D8EA9), LIMB_PAIR(0xF524807D, 0x9D2B24C0), LIMB_PAIR(0x21D9535D, 0x96AF717B), LIMB_PAIR(0x4FBD0106, 0x5F9A6F42),
+            LIMB_PAIR(0xBA7D83DC, 0xA9DAC62A), LIMB_PAIR(0x62347736, 0xE2E5FF33), LIMB_PAIR(0xB6605428, 0x1621A6D5), LIMB_PAIR(0xBC4BB252, 0xFC96AE5E), LIMB_PARTIAL(0x19B),
+            LIMB_PAIR(0x21D079D5, 0x878EE5E4), LIMB_PAIR(0x2C46177F, 0x40395449), LIMB_PAIR(0x183F779D, 0x334B26FA), LIMB_PAIR(0xCA226599, 0x8C07F237),
+            LIMB_PAIR(0x018C83CE, 0xE079FD96), LIMB_PAIR(0x664AB781, 0x62391DF0), LIMB_PAIR(0x0B9565EC, 0xC3D390E3), LIMB_PAIR(0x8698FF98, 0x98227C5B), LIMB_PARTIAL(0x1BB)
+        },
+        {   // 4 * 16^96 * G
+            LIMB_PAIR(0x3F9FA837, 0xF20E17F1), LIMB_PAIR(0x07DB1380, 0x0F664948), LIMB_PAIR(0x87F0C342, 0x5BCDC631), LIMB_PAIR(0xBD3F369B, 0x56C64ECC),
+            LIMB_PAIR(0x11C76666, 0x5E2DD968), LIMB_PAIR(0xDC4303EC, 0x77A37823), LIMB_PAIR(0x74B208CF, 0xA88173A1), LIMB_PAIR(0x1AF41E96, 0x1C626895), LIMB_PARTIAL(0x1C5),
+            LIMB_PAIR(0x65467B39, 0x72DA3514), LIMB_PAIR(0xCE45ABDB, 0xA97A3735), LIMB_PAIR(0xC98EEE0C, 0xA1CB4A2C), LIMB_PAIR(0x94C63A07, 0x03DD02D4),
+            LIMB_PAIR(0x3B2689F6, 0xD22B087A), LIMB_PAIR(0x3043678E, 0x5A50B83C), LIMB_PAIR(0x844A417C, 0x069ADF5F), LIMB_PAIR(0x983FCFC1, 0xA9EB7A19), LIMB_PARTIAL(0x0C6)
+        },
+        {   // 5 * 16^96 * G
+            LIMB_PAIR(0x0CC43FA1, 0x07AF0A7A), LIMB_PAIR(0xAC346374, 0x577DCC1C), LIMB_PAIR(0xDC46A3EF, 0x0430BA5A), LIMB_PAIR(0x51D77F50, 0x19623A33),
+            LIMB_PAIR(0xC47EC055, 0xBB69E56E), LIMB_PAIR(0x367B694A, 0xADDDDE29), LIMB_PAIR(0x7334CDC3, 0xBCC27634), LIMB_PAIR(0xB6DBBDAF, 0x3605A214), LIMB_PARTIAL(0x08C),
+            LIMB_PAIR(0x333A23D4, 0xB9E26813), LIMB_PAIR(0x9DFD1C2E, 0xB4084043), LIMB_PAIR(0x5948F69C, 0xB26958AA), LIMB_PAIR(0x836B04E9, 0x4E0E41CE),
+            LIMB_PAIR(0xAD2F0F9C, 0xE8781517), LIMB_PAIR(0xF398EADE, 0x44411CEB), LIMB_PAIR(0x7CCA9C3D, 0xE0394B52), LIMB_PAIR(0x184812F2, 0x3692BB42), LIMB_PARTIAL(0x1A5)
+        },
+        {   // 6 * 16^96 * G
+            LIMB_PAIR(0x80E0C811, 0x4ABF6DE4), LIMB_PAIR(0xCF33E5AE, 0xFB0DB238), LIMB_PAIR(0x65638F5A, 0x3F651318), LIMB_PAIR(0x41078C4B, 0x93E5D62E),
+            LIMB_PAIR(0xB4B44D9B, 0x53EC3D90), LIMB_PAIR(0x7DDCF3B9, 0x9FE56460), LIMB_PAIR(0x79848B05, 0x47143850), LIMB_PAIR(0x9E60315D, 0xBD3495A9), LIMB_PARTIAL(0x144),
+            LIMB_PAIR(0x670BEDEF, 0x90409B61), LIMB_PAIR(0xB61F1014, 0xF0B1BAF0), LIMB_PAIR(0xCC4AD55F, 0xED3CCB5C), LIMB_PAIR(0xEBC6A449, 0x391B2125),
+            LIMB_PAIR(0xC399DDD3, 0x9F49AB65), LIMB_PAIR(0x03EDDC81, 0xF7706CA4), LIMB_PAIR(0x579211FD, 0xE42D1379), LIMB_PAIR(0x1EDE88C3, 0x9452B0D1), LIMB_PARTIAL(0x1FB)
+        },
+        {   // 7 * 16^96 * G
+            LIMB_PAIR(0x9B5E849C, 0x96D64AF4), LIMB_PAIR(0x7D8BC95A, 0xF994BF47), LIMB_PAIR(0x437F36AE, 0x75A4E5C0), LIMB_PAIR(0x7C7BCEC9, 0xEE75C710),
+            LIMB_PAIR(0x437C8987, 0x40F1BEBC), LIMB_PAIR(0xDB220F60, 0xEA8288DC), LIMB_PAIR(0x1353D1D9, 0xF9C197BA), LIMB_PAIR(0x196C5B7E, 0x8128EC86), LIMB_PARTIAL(0x1AE),
+            LIMB_PAIR(0xF41CCE83, 0x608268BD), LIMB_PAIR(0x49DBD8B9, 0xB061D942), LIMB_PAIR(0x846039D6, 0x71A2710A), LIMB_PAIR(0x972580E9, 0xE2F432B4),
+            LIMB_PAIR(0x9BE7C986, 0x34F1A711), LIMB_PAIR(0xC02E5EDE, 0xEADEF54D), LIMB_PAIR(0x8E9FCB26, 0xE215A5E8), LIMB_PAIR(0x1D8C7C29, 0x9A2A4F76), LIMB_PARTIAL(0x1B4)
+        },
+        {   // 8 * 16^96 * G
+            LIMB_PAIR(0xE0EA0BAE, 0x984DA95D), LIMB_PAIR(0x3AB813BA, 0x7769CFFA), LIMB_PAIR(0x84CC8B68, 0x02FD64A7), LIMB_PAIR(0x5EA90ED5, 0x138655F2),
+            LIMB_PAIR(0x40B410C4, 0x71074C7C), LIMB_PAIR(0x4A05F173, 0xF3971B00), LIMB_PAIR(0xD36B4F4D, 0x113D8242), LIMB_PAIR(0x4CDD1B0E, 0x63BD460F), LIMB_PARTIAL(0x15B),
+            LIMB_PAIR(0x6DB9FE99, 0x26BFAF81), LIMB_PAIR(0x0A3C3A72, 0x001943C4), LIMB_PAIR(0x8ADF321F, 0x258ECCEC), LIMB_PAIR(0xF50D775C, 0x8BF97F30),
+            LIMB_PAIR(0xE6899FBF, 0xA7B60597), LIMB_PAIR(0x49EABD50, 0x622BF2CB), LIMB_PAIR(0xB19E9649, 0x9FF457E9), LIMB_PAIR(0xE2DBB651, 0x607570FD), LIMB_PARTIAL(0x10A)
+        }
+    },
+#endif
+#if (97 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^97 * G
+            LIMB_PAIR(0x74BA879A, 0x51318AC9), LIMB_PAIR(0xA68B584C, 0x23723B6D), LIMB_PAIR(0x02AC441E, 0xA7872BF0), LIMB_PAIR(0x65C7B9F4, 0x1E0C8FD6),
+            LIMB_PAIR(0xB893449D, 0xE8E3BC24), LIMB_PAIR(0xF06E02A6, 0x2E83C6B8), LIMB_PAIR(0x78D50EF5, 0xBA754C01), LIMB_PAIR(0x2C547C38, 0x7C6C06EF), LIMB_PARTIAL(0x132),
+            LIMB_PAIR(0x6DEE6431, 0xABBFE426), LIMB_PAIR(0x12FD88EA, 0x2D51AAC6), LIMB_PAIR(0x1C83591E, 0xC6F21525), LIMB_PAIR(0x9EE42180, 0x85C550E5),
+            LIMB_PAIR(0xA8CD1C50, 0xE1A4297D), LIMB_PAIR(0xB55723CF, 0x28F07CF6), LIMB_PAIR(0x4113977B, 0xBEDE788E), LIMB_PAIR(0xBEDAEEAB, 0x8C7572FC), LIMB_PARTIAL(0x1AB)
+        },
+        {   // 2 * 16^97 * G
+            LIMB_PAIR(0x4E6DF03B, 0x72916BE7), LIMB_PAIR(0x090A7B6F, 0xB14241ED), LIMB_PAIR(0xCF5E6F43, 0xEC0532FB), LIMB_PAIR(0x680383C6, 0x750CD95B),
+            LIMB_PAIR(0xC7CD9543, 0x2892D449), LIMB_PAIR(0xD5D3AD9B, 0xF0550587), LIMB_PAIR(0xE9C29C0D, 0x3B330694), LIMB_PAIR(0xBFE6860D, 0x6FA03173), LIMB_PARTIAL(0x111),
+            LIMB_PAIR(0xAB75C854, 0x6D55B870), LIMB_PAIR(0x02F049F7, 0x156F9A40), LIMB_PAIR(0xFA48732A, 0x72E2093B), LIMB_PAIR(0x9A3C272D, 0x4BA2D6CB),
+            LIMB_PAIR(0xD89BA292, 0x58102BE5), LIMB_PAIR(0xB3C5C3B0, 0x4074F320), LIMB_PAIR(0xE462C677, 0xB478C05E), LIMB_PAIR(0x97182FE6, 0xEBD4978F), LIMB_PARTIAL(0x182)
+        },
+        {   // 3 * 16^97 * G
+            LIMB_PAIR(0x2B1148CC, 0x32C0CF8F), LIMB_PAIR(0xC2086AA9, 0x881D8C7C), LIMB_PAIR(0x7C9FD47B, 0x6B25DAF5), LIMB_PAIR(0xCD5EC48B, 0xBFBB7226),
+            LIMB_PAIR(0x9F2307BA, 0xF2B79DEB), LIMB_PAIR(0x5FCFB278, 0x03D30DE5), LIMB_PAIR(0x71EF137B, 0x4B2D3A46), LIMB_PAIR(0xCAD4495C, 0x4E4A24B1), LIMB_PARTIAL(0x173),
+            LIMB_PAIR(0x1ECFC10C, 0x36316047), LIMB_PAIR(0x75C27AAD, 0x8A4AC3BD), LIMB_PAIR(0xCA6F6103, 0x6FD1ABEF), LIMB_PAIR(0xB741C7CC, 0x6AB15369),
+            LIMB_PAIR(0x86719621, 0xDB25D3CD), LIMB_PAIR(0xEE85249B, 0xE0D34A98), LIMB_PAIR(0x370EFC6A, 0x25BEECEA), LIMB_PAIR(0xA2CEFBF6, 0x7D8A2FFC), LIMB_PARTIAL(0x057)
+        },
+        {   // 4 * 16^97 * G
+            LIMB_PAIR(0x1B27F40B, 0x70148A3A), LIMB_PAIR(0xB7C6CC7F, 0x4CE48C61), LIMB_PAIR(0xE7BEAAD3, 0xF6EE8026), LIMB_PAIR(0xD11AB074, 0x37EAEC76),
+            LIMB_PAIR(0x99C1A334, 0x060F2EDE), LIMB_PAIR(0x69150184, 0xE9CE92E4), LIMB_PAIR(0x52D73BB0, 0xF90E4848), LIMB_PAIR(0x01B5AE4D, 0x0436A9BF), LIMB_PARTIAL(0x1AB),
+            LIMB_PAIR(0x40D46948, 0x3F833816), LIMB_PAIR(0xFC39FCCC, 0x318236B2), LIMB_PAIR(0x122BCC3F, 0x8835B602), LIMB_PAIR(0x965AC801, 0xA430B37B),
+            LIMB_PAIR(0xBD0585FD, 0xF448EA0F), LIMB_PAIR(0x252BB5DF, 0x49E52F74), LIMB_PAIR(0x1085ACE7, 0x810768AE), LIMB_PAIR(0x9242E43F, 0xA8CEB329), LIMB_PARTIAL(0x189)
+        },
+        {   // 5 * 16^97 * G
+            LIMB_PAIR(0x504F8B28, 0xE929B729), LIMB_PAIR(0xB887EF71, 0xE706657C), LIMB_PAIR(0x0B83DB33, 0xB4BD5CDA), LIMB_PAIR(0xE761913C, 0x465187F0),
+            LIMB_PAIR(0x040B98AF, 0xBD632BD6), LIMB_PAIR(0x91C37379, 0xD82BF2AF), LIMB_PAIR(0x5380AEC9, 0xCC1058B1), LIMB_PAIR(0xC506F0BD, 0x243967A1), LIMB_PARTIAL(0x0D1),
+            LIMB_PAIR(0x87D73C34, 0xB2984426), LIMB_PAIR(0x46CBE44A, 0x5FFA94EA), LIMB_PAIR(0x20DDB255, 0x5814A34F), LIMB_PAIR(0x89B68F69, 0x8EA54368),
+            LIMB_PAIR(0xD26B66C6, 0xE21603B0), LIMB_PAIR(0x320B6862, 0x4695DFF2), LIMB_PAIR(0x42D53E67, 0xA5D53327), LIMB_PAIR(0xA5931FD7, 0xF17DF48A), LIMB_PARTIAL(0x1BB)
+        },
+        {   // 6 * 16^97 * G
+            LIMB_PAIR(0x976E030D, 0xA63BBEC0), LIMB_PAIR(0xE65327EF, 0x7A81CE08), LIMB_PAIR(0xA7C90248, 0x0AC6397F), LIMB_PAIR(0x488F9BA1, 0x14EF2887),
+            LIMB_PAIR(0x497ADD24, 0xB2B47A2F), LIMB_PAIR(0x40274DE2, 0xA86A3857), LIMB_PAIR(0x12374808, 0x25ACDB8C), LIMB_PAIR(0x2C57A8B1, 0x96F4EF89), LIMB_PARTIAL(0x050),
+            LIMB_PAIR(0x85199966, 0x3A8D6BFB), LIMB_PAIR(0xFBF35493, 0x78BF5C36), LIMB_PAIR(0x5BD8876B, 0x8F1DB78B), LIMB_PAIR(0xB2BECDA0, 0xB8EA47B6),
+            LIMB_PAIR(0x13992438, 0x5DECD86D), LIMB_PAIR(0x50DC68C1, 0xC0ABE6D2), LIMB_PAIR(0x3EACA155, 0x85B05DA7), LIMB_PAIR(0xB1BD9E0B, 0xF8095622), LIMB_PARTIAL(0x104)
+        },
+        {   // 7 * 16^97 * G
+            LIMB_PAIR(0x8D00DA24, 0x1B50FA62), LIMB_PAIR(0x0A0590BC, 0x98C7AC50), LIMB_PAIR(0x6C101946, 0xC33C9F7F), LIMB_PAIR(0x0C4EAF7D, 0x653848C3),
+            LIMB_PAIR(0xDC892656, 0x7AB38C79), LIMB_PAIR(0x420316CE, 0x2CE0AE53), LIMB_PAIR(0x7012D563, 0x9DF9A008), LIMB_PAIR(0x6D51BD57, 0x130CD565), LIMB_PARTIAL(0x0B7),
+            LIMB_PAIR(0x78FFE5EF, 0x21A2C950), LIMB_PAIR(0x7B991B38, 0xBC330A09), LIMB_PAIR(0x2D4A375B, 0xC5151E1B), LIMB_PAIR(0x80C0F67A, 0x70A29D10),
+            LIMB_PAIR(0x2247B284, 0x2E75A55F), LIMB_PAIR(0x58F332F1, 0xC95A6380), LIMB_PAIR(0xA8FE1CC9, 0x0D7A5242), LIMB_PAIR(0xA712A8CE, 0xC0B1176C), LIMB_PARTIAL(0x035)
+        },
+        {   // 8 * 16^97 * G
+            LIMB_PAIR(0xFD998A0A, 0x7B0373E4), LIMB_PAIR(0xC37E7937, 0x0BDDAC80), LIMB_PAIR(0x8EECCC27, 0xB979FDCA), LIMB_PAIR(0xE82B945A, 0x150C3141),
+            LIMB_PAIR(0xCEBF1156, 0xCF88A830), LIMB_PAIR(0xBBEF5C8F, 0x649C7C1A), LIMB_PAIR(0xF10104EA, 0x3199E1C5), LIMB_PAIR(0x898B7FD0, 0x31E4FD39), LIMB_PARTIAL(0x11D),
+            LIMB_PAIR(0x449BCD85, 0xC24063DE), LIMB_PAIR(0xB96FEF39, 0xB0CC16E1), LIMB_PAIR(0xB2F631B2, 0xFA391388), LIMB_PAIR(0x1F4A449B, 0xD39C21B4),
+            LIMB_PAIR(0x35F5045A, 0xD036CB31), LIMB_PAIR(0x367F428D, 0x58A0729C), LIMB_PAIR(0x55C42FB9, 0x7DDE8306), LIMB_PAIR(0xF68C64FA, 0xD14AB2FE), LIMB_PARTIAL(0x163)
+        }
+    },
+#endif
+#if (98 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^98 * G
+            LIMB_PAIR(0xA308E123, 0x5663F565), LIMB_PAIR(0x157C2290, 0x91A48983), LIMB_PAIR(0xC054408A, 0x222F7F93), LIMB_PAIR(0xB839A520, 0xD8694963),
+            LIMB_PAIR(0xD314DA50, 0x864B491D), LIMB_PAIR(0xD675CC09, 0xA315D96E), LIMB_PAIR(0x390531B6, 0x32964930), LIMB_PAIR(0x21E11F6E, 0x93876719), LIMB_PARTIAL(0x1D0),
+            LIMB_PAIR(0x0C3477FA, 0x20F4598E), LIMB_PAIR(0xCCF7F114, 0x14C758B4), LIMB_PAIR(0x051B875E, 0x0C83F642), LIMB_PAIR(0x1B290E7D, 0x14AB1B50),
+            LIMB_PAIR(0xF1B18FA8, 0x99F812C7), LIMB_PAIR(0x88CA8E75, 0xAA60F399), LIMB_PAIR(0xB9C6C5F7, 0x00DE2BD0), LIMB_PAIR(0x28703A2A, 0x765DA973), LIMB_PARTIAL(0x015)
+        },
+        {   // 2 * 16^98 * G
+            LIMB_PAIR(0x2934ED82, 0x05A704CC), LIMB_PAIR(0x989EDD8C, 0x647089FB), LIMB_PAIR(0x0CE7C62D, 0xE0B239D4), LIMB_PAIR(0x105A5EFF, 0x4C892EA6),
+            LIMB_PAIR(0xD5ED6B04, 0xA519395F), LIMB_PAIR(0x509ED794, 0x806C7003), LIMB_PAIR(0xE70CE5C4, 0x882E9886), LIMB_PAIR(0xFF01F6A9, 0x50730CA1), LIMB_PARTIAL(0x088),
+            LIMB_PAIR(0xDBCC5484, 0x90A78A16), LIMB_PAIR(0xFD454B50, 0xC1AB078C), LIMB_PAIR(0xCB09E525, 0x6F488252), LIMB_PAIR(0xE19B2ED7, 0xDD663F53),
+            LIMB_PAIR(0xA67BF59C, 0x16B10DA1), LIMB_PAIR(0x36BB770A, 0xB47F6B95), LIMB_PAIR(0x777B2BCE, 0x6BDC8428), LIMB_PAIR(0x561553F8, 0xCD02AE3D), LIMB_PARTIAL(0x017)
+        },
+        {   // 3 * 16^98 * G
+            LIMB_PAIR(0xEE2F1290, 0x06BA35C1), LIMB_PAIR(0xD403D1E7, 0xEC34093F), LIMB_PAIR(0xA659075E, 0xC1B8ED8F), LIMB_PAIR(0xBFE99020, 0xEA322AD8),
+            LIMB_PAIR(0xD5148B86, 0x3B7A95D8), LIMB_PAIR(0xC2CD9ADE, 0x979D99BE), LIMB_PAIR(0x85DBA94C, 0x89A6A552), LIMB_PAIR(0xE090E6A7, 0xA5B7E51B), LIMB_PARTIAL(0x120),
+            LIMB_PAIR(0xAF82552A, 0x033B73CE), LIMB_PAIR(0x5CA604C1, 0x8C98E0B5), LIMB_PAIR(0x533ADDF7, 0x177A92E5), LIMB_PAIR(0xED1AD360, 0x6EAB8277),
+            LIMB_PAIR(0xBFB8E3E1, 0x05937E24), LIMB_PAIR(0xD061128A, 0x4193E5CF), LIMB_PAIR(0xFC1326FC, 0x4F781B5D), LIMB_PAIR(0x9D0056BF, 0x74403EB1), LIMB_PARTIAL(0x1F1)
+        },
+        {   // 4 * 16^98 * G
+            LIMB_PAIR(0x1EDC1498, 0x36DA34D1), LIMB_PAIR(0x18D4C455, 0x7BA9673C), LIMB_PAIR(0x724EB3FD, 0x9ACD94FF), LIMB_PAIR(0xD31CFBC2, 0x5DB71C7A),
+            LIMB_PAIR(0xD49A2214, 0x64357011), LIMB_PAIR(0x0AAE0C21, 0x80B6101F), LIMB_PAIR(0x9853D1F0, 0xEFFEC620), LIMB_PAIR(0xEDA4FB5B, 0xF928ED94), LIMB_PARTIAL(0x1BC),
+            LIMB_PAIR(0xE3DB108E, 0x0031C5CC), LIMB_PAIR(0x5110EB67, 0x2663B3AA), LIMB_PAIR(0x3B2D50C5, 0xC0432C4F), LIMB_PAIR(0x3D94B4FC, 0xE5B812AB),
+            LIMB_PAIR(0xE9828D03, 0x031FCBE4), LIMB_PAIR(0x7A08492D, 0x048DEC90), LIMB_PAIR(0xEA50D639, 0x7420A4ED), LIMB_PAIR(0x76EEF289, 0x0BD4BDD0), LIMB_PARTIAL(0x15F)
+        },
+        {   // 5 * 16^98 * G
+            LIMB_PAIR(0xDF3566EC, 0xE7718E9B), LIMB_PAIR(0xD1D77E5E, 0x2ACD4C45), LIMB_PAIR(0xD9787985, 0xC78694AD), LIMB_PAIR(0xF645C923, 0xC7C600C5),
+            LIMB_PAIR(0xC393F54B, 0xCD1E697A), LIMB_PAIR(0x20054D6E, 0x7928ED5B), LIMB_PAIR(0x3CAFEABF, 0xD3C839E0), LIMB_PAIR(0xC46A4425, 0xBFAAFDCE), LIMB_PARTIAL(0x196),
+            LIMB_PAIR(0xE1804D34, 0x6BAEECA1), LIMB_PAIR(0x70AA5E48, 0x6996DB6C), LIMB_PAIR(0xB9577C2E, 0x24E11983), LIMB_PAIR(0x04335832, 0x3966F9A1),
+            LIMB_PAIR(0x50889C2A, 0x5654CBDD), LIMB_PAIR(0x32DF0DEA, 0xEE86177F), LIMB_PAIR(0xF8D76ECF, 0x7E9C591D), LIMB_PAIR(0xDDBAC362, 0x57DE93BF), LIMB_PARTIAL(0x022)
+        },
+        {   // 6 * 16^98 * G
+            LIMB_PAIR(0xA92D6561, 0x78709A5C), LIMB_PAIR(0x0880BC8E, 0x36B5D1F1), LIMB_PAIR(0x0AF2078A, 0xF980CEBC), LIMB_PAIR(0x14EDAAB5, 0x4B5E964A),
+            LIMB_PAIR(0x63AFD322, 0xD526F785), LIMB_PAIR(0x68E17240, 0xF5A9D4C6), LIMB_PAIR(0x19FC5026, 0x0C420E28), LIMB_PAIR(0x03459B12, 0x33275409), LIMB_PARTIAL(0x157),
+            LIMB_PAIR(0xC4D6BB5D, 0xAE433226), LIMB_PAIR(0x13EA6565, 0x5E39057B), LIMB_PAIR(0x7AAF08E1, 0xEB7729AF), LIMB_PAIR(0x012567F2, 0xA74C0ED7),
+            LIMB_PAIR(0xB6E89ABE, 0x65B64576), LIMB_PAIR(0xF2498699, 0x6B025E87), LIMB_PAIR(0xC229C0F1, 0xBC92A03C), LIMB_PAIR(0x0F1F67C7, 0xC54DA03B), LIMB_PARTIAL(0x01D)
+        },
+        {   // 7 * 16^98 * G
+            LIMB_PAIR(0x07D2778E, 0xEB525FBB), LIMB_PAIR(0xC965143E, 0x4CD96634), LIMB_PAIR(0x742E1FCB, 0xB2EA802D), LIMB_PAIR(0x75BC3CD4, 0xA2F1EC4C),
+            LIMB_PAIR(0x125EBAF8, 0xE778F1E1), LIMB_PAIR(0x650B81EB, 0xC700E4E4), LIMB_PAIR(0x9C841F1B, 0x66D593A5), LIMB_PAIR(0x8D2984C9, 0x4DA41757), LIMB_PARTIAL(0x0A1),
+            LIMB_PAIR(0x57D4A16E, 0x6E9ED77D), LIMB_PAIR(0x1C1696AE, 0xEFB8F94C), LIMB_PAIR(0x8ACBC2A6, 0xF2961D2C), LIMB_PAIR(0xE1D5DE1F, 0x8FC9352D),
+            LIMB_PAIR(0xA7B8579C, 0x786158D1), LIMB_PAIR(0xFDCBAC8A, 0x3AB33268), LIMB_PAIR(0xD583ED20, 0xF237B433), LIMB_PAIR(0xE4C10D57, 0x3EDCC184), LIMB_PARTIAL(0x0CD)
+        },
+        {   // 8 * 16^98 * G
+            LIMB_PAIR(0x1E96A885, 0x8EC9A415), LIMB_PAIR(0x7E63CB24, 0xC95EC1EF), LIMB_PAIR(0xC506A04D, 0x8A77BEF7), LIMB_PAIR(0x0AD06B3F, 0x4E4DD410),
+            LIMB_PAIR(0xDC28FD42, 0xC2EB62E4), LIMB_PAIR(0x54040FAB, 0x7CB22394), LIMB_PAIR(0x64595D06, 0x74A3429A), LIMB_PAIR(0x26FD26D9, 0x05983DFA), LIMB_PARTIAL(0x151),
+            LIMB_PAIR(0x291BA5B5, 0x56ACB9C1), LIMB_PAIR(0x11C55994, 0x9967485F), LIMB_PAIR(0xB23CD929, 0xFC8EEB0B), LIMB_PAIR(0x39D78FB1, 0x0FE8DB6B),
+            LIMB_PAIR(0x46F04210, 0x3D7281E8), LIMB_PAIR(0x5D9FE1F9, 0xE7F29C80), LIMB_PAIR(0xF78B31A2, 0x2EA28B7E), LIMB_PAIR(0x4DFE2D5F, 0x594D39EE), LIMB_PARTIAL(0x087)
+        }
+    },
+#endif
+#if (99 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^99 * G
+            LIMB_PAIR(0x5A53C22B, 0x1BD8CE7B), LIMB_PAIR(0x7CAB446A, 0x78733FCD), LIMB_PAIR(0x48ACB394, 0xC44CA4E2), LIMB_PAIR(0xA38C790F, 0xA9888B1E),
+            LIMB_PAIR(0x15C34237, 0x36AFB6EB), LIMB_PAIR(0xFB702063, 0xB913B8A8), LIMB_PAIR(0x917508FA, 0x34B77CC5), LIMB_PAIR(0xF9E4732B, 0xA931D7A7), LIMB_PARTIAL(0x050),
+            LIMB_PAIR(0x56D21D18, 0xA90A4290), LIMB_PAIR(0x55B410A1, 0x82666307), LIMB_PAIR(0x894A6B05, 0xB4684A8B), LIMB_PAIR(0x828CF75C, 0x8A1ADE63),
+            LIMB_PAIR(0x127702A3, 0x4FB2F85A), LIMB_PAIR(0xADF7B709, 0x83FF7D05), LIMB_PAIR(0xA68D1DB6, 0x1D3F5A92), LIMB_PAIR(0xC093CD5C, 0x243CE1DB), LIMB_PARTIAL(0x0F5)
+        },
+        {   // 2 * 16^99 * G
+            LIMB_PAIR(0x4AAE7354, 0x8B3DC3D0), LIMB_PAIR(0x4A8F62B0, 0x9CCBF6CE), LIMB_PAIR(0x60C73A7E, 0xB3713C00), LIMB_PAIR(0x349EC6A0, 0xF6F73585),
+            LIMB_PAIR(0xFC30467F, 0xA995A64C), LIMB_PAIR(0xFAD776D0, 0x877334FE), LIMB_PAIR(0xB236DCF3, 0x84588E41), LIMB_PAIR(0xE9CCBD7D, 0xDCFDB088), LIMB_PARTIAL(0x181),
+            LIMB_PAIR(0xFB36E7AE, 0x188DB860), LIMB_PAIR(0xF45EA4FF, 0xE7A0DF8D), LIMB_PAIR(0x5CA6F9F7, 0x110245AC), LIMB_PAIR(0x7A7031AF, 0xD4C3509D),
+            LIMB_PAIR(0x34DF0623, 0xF4AA648F), LIMB_PAIR(0x7E664BD5, 0x462AA949), LIMB_PAIR(0xE2F0138F, 0x415012B4), LIMB_PAIR(0x1C60732A, 0xEC3DAFA0), LIMB_PARTIAL(0x0BE)
+        },
+        {   // 3 * 16^99 * G
+            LIMB_PAIR(0xC1F9124F, 0xF77AFC9E), LIMB_PAIR(0x5D958392, 0x010AF17A), LIMB_PAIR(0xEEB66CB6, 0xA9AA7D55), LIMB_PAIR(0x816DEA76, 0xB41570CA),
+            LIMB_PAIR(0xA983B39C, 0xB2138D58), LIMB_PAIR(0xCD6CBAA5, 0x0FD404CF), LIMB_PAIR(0x40C224CC, 0x29C1F2FD), LIMB_PAIR(0x99C23815, 0x1E263CAB), LIMB_PARTIAL(0x0E0),
+            LIMB_PAIR(0x7649D2FF, 0x371CD093), LIMB_PAIR(0x02038FF9, 0x7C79D3CC), LIMB_PAIR(0x5CA5E1B9, 0xEF326185), LIMB_PAIR(0xE02C0478, 0x1BEB030B),
+            LIMB_PAIR(0xF859FD4A, 0x134D0C94), LIMB_PAIR(0xEE41B919, 0xA767FAA5), LIMB_PAIR(0xD5D9E3C5, 0x8D957AAC), LIMB_PAIR(0x191FCA35, 0x4B1C1DEB), LIMB_PARTIAL(0x175)
+        },
+        {   // 4 * 16^99 * G
+            LIMB_PAIR(0xE80649C8, 0x1379B176), LIMB_PAIR(0xB7FDB132, 0xAA0C2DC8), LIMB_PAIR(0x1134FFD2, 0x3F3050EF), LIMB_PAIR(0xD4A76F0C, 0x28D4E288),
+            LIMB_PAIR(0xCD9B7F91, 0x22CA05F7), LIMB_PAIR(0x6E7B9EE5, 0x9174BEE0), LIMB_PAIR(0x6B341CB3, 0xC0DDC635), LIMB_PAIR(0xEEA9DA0E, 0x1CD07D05), LIMB_PARTIAL(0x0BD),
+            LIMB_PAIR(0xBBAA1DF4, 0x423EC36B), LIMB_PAIR(0xE74C741E, 0x33CCC8AD), LIMB_PAIR(0x49B5CD06, 0x598D4662), LIMB_PAIR(0x8FA121CB, 0xD8BFC7E5),
+            LIMB_PAIR(0x91BEC4BA, 0x2CBE86B9), LIMB_PAIR(0xE8453F40, 0xBF1FE841), LIMB_PAIR(0x392592B5, 0xA35FF85D), LIMB_PAIR(0x9C5807B2, 0x8DE9F3DF), LIMB_PARTIAL(0x0FC)
+        },
+        {   // 5 * 16^99 * G
+            LIMB_PAIR(0x690C9C13, 0x91B8719F), LIMB_PAIR(0x6D91DE54, 0x1932A953), LIMB_PAIR(0xCACBDC0E, 0xA4B86387), LIMB_PAIR(0x8BAF648F, 0x706CA7DD),
+            LIMB_PAIR(0x819C8BBA, 0xBE6702B5), LIMB_PAIR(0x006BE63E, 0xD8E503A8), LIMB_PAIR(0x2DFAEE90, 0x7CA8DD6A), LIMB_PAIR(0x8DC428B7, 0x15BC698C), LIMB_PARTIAL(0x03A),
+            LIMB_PAIR(0x865E5E1B, 0x1FECF27E), LIMB_PAIR(0x56BDA0E8, 0x20F26B44), LIMB_PAIR(0x88DCE3FF, 0x274CD07A), LIMB_PAIR(0xDC3EDDA0, 0x89B8BFDD),
+            LIMB_PAIR(0x22CF062D, 0xADC93A6E), LIMB_PAIR(0xF57D091D, 0x2092780F), LIMB_PAIR(0xB799B1AE, 0xC7D33C53), LIMB_PAIR(0xD6272724, 0x803E54D7), LIMB_PARTIAL(0x1E2)
+        },
+        {   // 6 * 16^99 * G
+            LIMB_PAIR(0x27C0B1D7, 0x18821930), LIMB_PAIR(0x9D9B1A2E, 0x488BDF62), LIMB_PAIR(0x955F6A87, 0x64A37425), LIMB_PAIR(0x58ECCD62, 0xB1DC88D2),
+            LIMB_PAIR(0xE69EE6D4, 0x9F3E8326), LIMB_PAIR(0xE736DA3D, 0x5C58741F), LIMB_PAIR(0x93A2D8B0, 0x0E9C23BA), LIMB_PAIR(0xCA94A979, 0x8F42DF2B), LIMB_PARTIAL(0x044),
+            LIMB_PAIR(0x2C37DB33, 0x70B7CD7C), LIMB_PAIR(0x8233255B, 0x87256329), LIMB_PAIR(0x4FA0552E, 0xABBA168E), LIMB_PAIR(0xF09FB826, 0x2EF3FF3D),
+            LIMB_PAIR(0x79A38600, 0x431B83B7), LIMB_PAIR(0xA6C1EE12, 0x57FEAEC2), LIMB_PAIR(0x9B219D9C, 0x568EE543), LIMB_PAIR(0xAF9410B6, 0x0508BC77), LIMB_PARTIAL(0x01B)
+        },
+        {   // 7 * 16^99 * G
+            LIMB_PAIR(0x638F4BF3, 0xEDC83F7D), LIMB_PAIR(0x76E89AE1, 0xA14F5465), LIMB_PAIR(0xCC6EF43E, 0x38C36854), LIMB_PAIR(0x94C010C2, 0xD26DE664),
+            LIMB_PAIR(0xB8403839, 0x79410987), LIMB_PAIR(0x1B6E018B, 0x3119056E), LIMB_PAIR(0xE195E68F, 0xFC6CEBFD), LIMB_PAIR(0x2EE4BC5B, 0x23FF26C7), LIMB_PARTIAL(0x0EB),
+            LIMB_PAIR(0xBB1A38ED, 0xFE4D342C), LIMB_PAIR(0x3F7C3D26, 0xDC6B99B8), LIMB_PAIR(0xBB6301BF, 0xEBA992E8), LIMB_PAIR(0x8D9B6AA8, 0xDA145FDF),
+            LIMB_PAIR(0x99A9D166, 0x568ECE4D), LIMB_PAIR(0x07CB01EF, 0xFE783E6F), LIMB_PAIR(0xBA0F3663, 0x3156339C), LIMB_PAIR(0x092139DA, 0x909FA7E5), LIMB_PARTIAL(0x1FB)
+        },
+        {   // 8 * 16^99 * G
+            LIMB_PAIR(0x15B26E6A, 0x40F66D19), LIMB_PAIR(0x64400D78, 0xFD654E8A), LIMB_PAIR(0x66AD9DE7, 0xE4083653), LIMB_PAIR(0x686C1B2E, 0xA64CA69B),
+            LIMB_PAIR(0xA80066E2, 0x698749FF), LIMB_PAIR(0xB76196C5, 0x197528A4), LIMB_PAIR(0x7BF835DF, 0x2BCFCF64), LIMB_PAIR(0x60E478BF, 0x1A83FE84), LIMB_PARTIAL(0x020),
+            LIMB_PAIR(0xC46D1075, 0x948F3E0A), LIMB_PAIR(0xE5C05FCF, 0x3CCD3DC1), LIMB_PAIR(0x6414EB04, 0x11B825B2), LIMB_PAIR(0x21E3F864, 0x2B7A9A55),
+            LIMB_PAIR(0x6DABA159, 0x2A24F570), LIMB_PAIR(0xDE3EB61E, 0x51900D4A), LIMB_PAIR(0xA6A6766B, 0xADDC9096), LIMB_PAIR(0xE9DC3B6B, 0x357EABF9), LIMB_PARTIAL(0x07C)
+        }
+    },
+#endif
+#if (100 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^100 * G
+            LIMB_PAIR(0x90185363, 0xF5C1A4C6), LIMB_PAIR(0x20C04ED5, 0x15F58FD9), LIMB_PAIR(0xE913A1B2, 0xA7B46E0C), LIMB_PAIR(0x36F1D8C5, 0x1E7167C6),
+            LIMB_PAIR(0xBF5FCFB1, 0xF4FE6BFE), LIMB_PAIR(0xA6C2027B, 0xC46FAF10), LIMB_PAIR(0x4E1F12F4, 0x45D59300), LIMB_PAIR(0x12185485, 0x46BCC873), LIMB_PARTIAL(0x0CA),
+            LIMB_PAIR(0x6432C12B, 0x7C518071), LIMB_PAIR(0x90AE7556, 0xB7E004AD), LIMB_PAIR(0xD8532693, 0xDF847160), LIMB_PAIR(0xA18B3802, 0x4D8C7B8A),
+            LIMB_PAIR(0x96872AF8, 0x90E25045), LIMB_PAIR(0xAECB6FAD, 0xE69D4894), LIMB_PAIR(0x17D0FE85, 0x6DDAA06C), LIMB_PAIR(0x340C3528, 0x49F1A466), LIMB_PARTIAL(0x0D9)
+        },
+        {   // 2 * 16^100 * G
+            LIMB_PAIR(0x6DA18F9E, 0x64782A47), LIMB_PAIR(0x4A496E02, 0xB89E0B65), LIMB_PAIR(0x501C3A88, 0x437A49F6), LIMB_PAIR(0x48A19F6E, 0xAE9EA087),
+            LIMB_PAIR(0x346D2069, 0xA787948B), LIMB_PAIR(0x532EED3D, 0xA6B9A3F1), LIMB_PAIR(0x8AD26937, 0x728AB35E), LIMB_PAIR(0x041F4F43, 0x3CF24801), LIMB_PARTIAL(0x1B0),
+            LIMB_PAIR(0xCBBAB58E, 0x5E272327), LIMB_PAIR(0xF8705FFB, 0xE4A3C5F9), LIMB_PAIR(0xEDD26EE4, 0x2EDC1C8E), LIMB_PAIR(0xF26D033F, 0x1BD46FF5),
+            LIMB_PAIR(0xD87192FC, 0xCC566431), LIMB_PAIR(0x11764C8A, 0x03C7E406), LIMB_PAIR(0x882A69AB, 0xEBB80E34), LIMB_PAIR(0x61A08D84, 0x7A7F6943), LIMB_PARTIAL(0x11E)
+        },
+        {   // 3 * 16^100 * G
+            LIMB_PAIR(0x58B77137, 0x68F4A4E0), LIMB_PAIR(0xF12F5BBF, 0xD8A34E67), LIMB_PAIR(0x1E0619C2, 0x1781240F), LIMB_PAIR(0x498328BD, 0x44495373),
+            LIMB_PAIR(0x545B7D41, 0x98E9F61A), LIMB_PAIR(0x602A0C48, 0x767DB401), LIMB_PAIR(0x806301DE, 0xE138E5E8), LIMB_PAIR(0x4B21AA89, 0x65A3883B), LIMB_PARTIAL(0x12D),
+            LIMB_PAIR(0x0423FE94, 0x647B0078), LIMB_PAIR(0xFD276310, 0x424F483F), LIMB_PAIR(0xD6A06303, 0xACA222FB), LIMB_PAIR(0xFFA52C17, 0x47162ACB),
+            LIMB_PAIR(0x9DE267FE, 0x7AE0C501), LIMB_PAIR(0x667A30C8, 0x998DC9BB), LIMB_PAIR(0xAF48C727, 0x988CF192), LIMB_PAIR(0xDFA23A3F, 0x0A270986), LIMB_PARTIAL(0x1FC)
+        },
+        {   // 4 * 16^100 * G
+            LIMB_PAIR(0xC4646439, 0x5C9209C1), LIMB_PAIR(0x86C5D6BD, 0xCEB66985), LIMB_PAIR(0x29E415B4, 0xA5F52258), LIMB_PAIR(0xE95D2A27, 0x18FFF2C1),
+            LIMB_PAIR(0xBE40C8D9, 0x21D464F1), LIMB_PAIR(0x059828CF, 0x11B4696E), LIMB_PAIR(0x70F76AEC, 0x5C1F73C5), LIMB_PAIR(0x273E3F5B, 0x6019FADB), LIMB_PARTIAL(0x12C),
+            LIMB_PAIR(0x3EEFAB44, 0x6D1FF591), LIMB_PAIR(0xBA2986B4, 0xF913524C), LIMB_PAIR(0x290DCF2A, 0x96FC0B7A), LIMB_PAIR(0x061DF2A2, 0xF9E7AB52),
+            LIMB_PAIR(0xD47330A6, 0x66401173), LIMB_PAIR(0x8B9F749F, 0xFF2ACA18), LIMB_PAIR(0x1AB42AC3, 0x8D4AC80F), LIMB_PAIR(0xA1378039, 0x10EC329E), LIMB_PARTIAL(0x1AA)
+        },
+        {   // 5 * 16^100 * G
+            LIMB_PAIR(0x9C1D86CC, 0xA5FC51EF), LIMB_PAIR(0x0B3FAAD3, 0x66A9B898), LIMB_PAIR(0x21D124ED, 0x96C73C25), LIMB_PAIR(0x050626CE, 0x392440DB),
+            LIMB_PAIR(0x50A4A12A, 0x02BFB1AC), LIMB_PAIR(0x1742DDDD, 0xC70A3074), LIMB_PAIR(0x47FE811D, 0xF1F9DAA6), LIMB_PAIR(0xFB3CE6CC, 0xD4BAA6B1), LIMB_PARTIAL(0x16E),
+            LIMB_PAIR(0x09D96CE7, 0x09042D75), LIMB_PAIR(0x3315F77A, 0x4C92CE69), LIMB_PAIR(0xA9C0D9F6, 0x4992B1F9), LIMB_PAIR(0xD18EC980, 0x7C0FFBAC),
+            LIMB_PAIR(0xA008AB38, 0x53D205DC), LIMB_PAIR(0xC908481D, 0xF0A098F7), LIMB_PAIR(0x0BA397BE, 0x2BFFD363), LIMB_PAIR(0x49003F86, 0xCA36E99F), LIMB_PARTIAL(0x0A2)
+        },
+        {   // 6 * 16^100 * G
+            LIMB_PAIR(0xBE4BADB6, 0xA074FDB7), LIMB_PAIR(0x0DF5F046, 0x97B05495), LIMB_PAIR(0xEAC3A8B1, 0x5A3F64E4), LIMB_PAIR(0x2971FAA1, 0xAFC5E013),
+            LIMB_PAIR(0x568E4A3A, 0xE6D4AE36), LIMB_PAIR(0x97479A2A, 0xEB0324BB), LIMB_PAIR(0x66A2C69B, 0x2DCAF3D8), LIMB_PAIR(0x813F21EE, 0x9F9B5551), LIMB_PARTIAL(0x0FD),
+            LIMB_PAIR(0xA13D686C, 0xEA8F05C8), LIMB_PAIR(0x3BDBD1DE, 0xF27EDB76), LIMB_PAIR(0x5C65B0F4, 0xB2E5FD40), LIMB_PAIR(0x6CBD964F, 0x5E959C01),
+            LIMB_PAIR(0xDBC193A1, 0x02CCB301), LIMB_PAIR(0x013B972D, 0x34CA7ED9), LIMB_PAIR(0x7EDE3F2F, 0x7191CD28), LIMB_PAIR(0x98BF4E0C, 0x1D07F457), LIMB_PARTIAL(0x057)
+        },
+        {   // 7 * 16^100 * G
+            LIMB_PAIR(0x20F12986, 0x284E98F3), LIMB_PAIR(0x749EA8D5, 0x3112BF24), LIMB_PAIR(0x2782914D, 0x5FC7A2C4), LIMB_PAIR(0xD94786AF, 0xB2F7C229),
+            LIMB_PAIR(0xC7158280, 0x4B17BCAE), LIMB_PAIR(0xE6189A46, 0xA139D563), LIMB_PAIR(0x83CC9173, 0x9C72E9C5), LIMB_PAIR(0xBE56B6A8, 0x5CD5A6A0), LIMB_PARTIAL(0x1A5),
+            LIMB_PAIR(0x235A8051, 0x51F0E802), LIMB_PAIR(0xC4C5FB7C, 0x153DC987), LIMB_PAIR(0x9868A706, 0xB549E9C7), LIMB_PAIR(0x9BDF5C1F, 0x71739008),
+            LIMB_PAIR(0xCCBEC99B, 0x0D04F60C), LIMB_PAIR(0x7F4BD294, 0xDE66C961), LIMB_PAIR(0x51156724, 0xA787D95E), LIMB_PAIR(0xAE12B9B3, 0x7CE4B4A5), LIMB_PARTIAL(0x091)
+        },
+        {   // 8 * 16^100 * G
+            LIMB_PAIR(0xFB6618BD, 0xE7F35808), LIMB_PAIR(0x732EF576, 0x6ABB67E1), LIMB_PAIR(0xCD0BFD8A, 0xACCABB44), LIMB_PAIR(0x83459746, 0x176FFA91),
+            LIMB_PAIR(0x85B88B2A, 0xCC129585), LIMB_PAIR(0xFFF151CE, 0x28D94486), LIMB_PAIR(0x4C84BB00, 0xF55FCA16), LIMB_PAIR(0x9C3A42B6, 0x07CBC841), LIMB_PARTIAL(0x0C6),
+            LIMB_PAIR(0x78788C39, 0x488400D0), LIMB_PAIR(0xD8EB1FDC, 0x15EBB100), LIMB_PAIR(0xBDC05F72, 0x58DECAE3), LIMB_PAIR(0x5D56A2CF, 0x3BFDA4A7),
+            LIMB_PAIR(0x5AE6701E, 0x7EA3F8EC), LIMB_PAIR(0x3AAACAB3, 0x652E7E0B), LIMB_PAIR(0x28609228, 0x267D2752), LIMB_PAIR(0x912EFD7E, 0x52DDC983), LIMB_PARTIAL(0x029)
+        }
+    },
+#endif
+#if (101 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^101 * G
+            LIMB_PAIR(0xE2ECA03C, 0xFED9B067), LIMB_PAIR(0xEB3230B2, 0x34FF6F2A), LIMB_PAIR(0x31BC82BE, 0xDA83B96A), LIMB_PAIR(0xCC89C862, 0x3B138D2C),
+            LIMB_PAIR(0xEBD59505, 0xF4A27AEE), LIMB_PAIR(0x8BB49DDA, 0x29DF153A), LIMB_PAIR(0x50A555BA, 0x2DFFEC46), LIMB_PAIR(0x0FEC5D80, 0xC899108D), LIMB_PARTIAL(0x0BF),
+            LIMB_PAIR(0x88DA1A0F, 0xC834E659), LIMB_PAIR(0xEEBE47A8, 0xB9BFBA08), LIMB_PAIR(0x7B3A2B73, 0xF59D3393), LIMB_PAIR(0x8DECF4E4, 0xFFC7CB5D),
+            LIMB_PAIR(0x83DC5F4E, 0x72477DD5), LIMB_PAIR(0x43AC64EB, 0x0A59E11E), LIMB_PAIR(0xCB10A6AB, 0xDA8AA16C), LIMB_PAIR(0x3759C37C, 0xE571EC8C), LIMB_PARTIAL(0x047)
+        },
+        {   // 2 * 16^101 * G
+            LIMB_PAIR(0x3FFE4858, 0xB4C4AC14), LIMB_PAIR(0xBAAB1296, 0x3D9C1B48), LIMB_PAIR(0x5791E378, 0xB28B5F0A), LIMB_PAIR(0x2A5D32CA, 0x3AA34DE8),
+            LIMB_PAIR(0xE76FB3F0, 0x8E90308A), LIMB_PAIR(0xC85D002B, 0xB74A7ED3), LIMB_PAIR(0x65840CD3, 0x48A246AB), LIMB_PAIR(0x771D3F2C, 0xC8494718), LIMB_PARTIAL(0x1B8),
+            LIMB_PAIR(0xA28DA023, 0xB3F57D14), LIMB_PAIR(0x1D078F91, 0xDBC8B8D9), LIMB_PAIR(0xBA67F27F, 0xFA5F5A7A), LIMB_PAIR(0xFC60DF70, 0x4908ADC3),
+            LIMB_PAIR(0x618486CF, 0x4FCDD3E0), LIMB_PAIR(0xEB3C5855, 0x2E725571), LIMB_PAIR(0xC5D9DD01, 0xDAFD1EF5), LIMB_PAIR(0x19B9CFB7, 0x806554EE), LIMB_PARTIAL(0x125)
+        },
+        {   // 3 * 16^101 * G
+            LIMB_PAIR(0x1FD309B5, 0x2B6C0EF3), LIMB_PAIR(0xEF2D0448, 0x9CF760A0), LIMB_PAIR(0xB66BC99E, 0x9C5D587B), LIMB_PAIR(0xABC086A2, 0xEBE5D8E7),
+            LIMB_PAIR(0x589F8B4D, 0x52E78ABB), LIMB_PAIR(0xD3B36CD6, 0xB7FA2135), LIMB_PAIR(0xCF0922AF, 0x5286FA97), LIMB_PAIR(0x9AF4A905, 0xA703ACC1), LIMB_PARTIAL(0x061),
+            LIMB_PAIR(0x44A79B6B, 0xE82D9ECA), LIMB_PAIR(0xD825AE14, 0x706ABBAD), LIMB_PAIR(0x4AD3D59F, 0xAAF59C1E), LIMB_PAIR(0xCE6FDDB8, 0x3DACB4E4),
+            LIMB_PAIR(0xF253EF2F, 0x0B975484), LIMB_PAIR(0xF625AD33, 0xAE33BF3E), LIMB_PAIR(0xEC2ED026, 0x049256C1), LIMB_PAIR(0x44B5CB48, 0xA50EBA55), LIMB_PARTIAL(0x113)
+        },
+        {   // 4 * 16^101 * G
+            LIMB_PAIR(0xFDB2DD1D, 0xC5F56D18), LIMB_PAIR(0x72B373E7, 0xCB313879), LIMB_PAIR(0xD85C69FC, 0x2FBFA499), LIMB_PAIR(0x04211367, 0x49EF4E55),
+            LIMB_PAIR(0x9F9F852B, 0x307A9A32), LIMB_PAIR(0x3D586D9A, 0x00BE6801), LIMB_PAIR(0x9BEA9584, 0x6AB9C670), LIMB_PAIR(0x4B06F588, 0xBCB478E2), LIMB_PARTIAL(0x1FA),
+            LIMB_PAIR(0x2B1E18C4, 0xB6D09556), LIMB_PAIR(0x3A783993, 0x2AF8B923), LIMB_PAIR(0x78CA9E44, 0xAFCF8AE6), LIMB_PAIR(0x6CFEC34B, 0x9139A837),
+            LIMB_PAIR(0x583EF0DB, 0xCE8CD219), LIMB_PAIR(0xABE307ED, 0x8BF49E56), LIMB_PAIR(0xE83C9968, 0x89BA853B), LIMB_PAIR(0x008B52D3, 0xC5694A20), LIMB_PARTIAL(0x063)
+        },
+        {   // 5 * 16^101 * G
+            LIMB_PAIR(0x6E626779, 0xAAFAE901), LIMB_PAIR(0x0084ACC1, 0xDE9BED6C), LIMB_PAIR(0xB706FC75, 0xA585BA05), LIMB_PAIR(0x7AB4BF6B, 0x3FC03160),
+            LIMB_PAIR(0x62E10B42, 0xA78E2644), LIMB_PAIR(0x95A748A5, 0x6068DA6E), LIMB_PAIR(0x49B03550, 0x2E139CF7), LIMB_PAIR(0xBCE94653, 0x7D92002D), LIMB_PARTIAL(0x1CF),
+            LIMB_PAIR(0x14423E00, 0x73334D5E), LIMB_PAIR(0xAF33C5A1, 0xB8E759DC), LIMB_PAIR(0xC9FF5513, 0x6E3953C3), LIMB_PAIR(0x3182B2E8, 0x198EF797),
+            LIMB_PAIR(0xD49664FC, 0x2F8D699D), LIMB_PAIR(0x117AD6EC, 0x7F629506), LIMB_PAIR(0x9149E5F5, 0x23E8B6F5), LIMB_PAIR(0x6F8D2609, 0xDDBB61C0), LIMB_PARTIAL(0x059)
+        },
+        {   // 6 * 16^101 * G
+            LIMB_PAIR(0xA994A7B1, 0x0D8E9A7B), LIMB_PAIR(0xEFB1AA26, 0xD01AB035), LIMB_PAIR(0xD705E07C, 0x99417D38), LIMB_PAIR(0x59B74F10, 0xC5C6E415),
+            LIMB_PAIR(0x67EB2AB8, 0x995B35AC), LIMB_PAIR(0x9A0CF438, 0xC78AA190), LIMB_PAIR(0xC49DDCA9, 0x7ECF6A9F), LIMB_PAIR(0x1C633B7C, 0xF72F3DE5), LIMB_PARTIAL(0x166),
+            LIMB_PAIR(0xB96F6D73, 0x4EB78FAE), LIMB_PAIR(0xD695514A, 0x53E814BC), LIMB_PAIR(0x62AD9BF5, 0x25A385CD), LIMB_PAIR(0xCA3E9433, 0x3012502D),
+            LIMB_PAIR(0x9295FA16, 0x684F5201), LIMB_PAIR(0x3A1F62D6, 0xDDF4A21F), LIMB_PAIR(0x1F316813, 0x95C8C613), LIMB_PAIR(0xE7B55DA7, 0xE0E7009A), LIMB_PARTIAL(0x066)
+        },
+        {   // 7 * 16^101 * G
+            LIMB_PAIR(0x508B6ADE, 0xD96C3210), LIMB_PAIR(0xE6DEF561, 0xFBF4D8DD), LIMB_PAIR(0xFA051F03, 0x452B0895), LIMB_PAIR(0x3D760C1B, 0xB2DC6399),
+            LIMB_PAIR(0xD6F24232, 0xB6611865), LIMB_PAIR(0x2A2EA820, 0x6D21C3D5), LIMB_PAIR(0x10EA1E0C, 0x043DD2C8), LIMB_PAIR(0x46F07714, 0x57A65B70), LIMB_PARTIAL(0x183),
+            LIMB_PAIR(0x994F580D, 0xAB35EF1D), LIMB_PAIR(0xD6A54985, 0xAEB0EFB1), LIMB_PAIR(0x6CFA6133, 0xA90CD196), LIMB_PAIR(0xEAE0B601, 0xEAA90355),
+            LIMB_PAIR(0x4EF4EA24, 0x78171BBA), LIMB_PAIR(0xAE78D9F4, 0x7ED15BA8), LIMB_PAIR(0xEBD06C49, 0xC07D39C4), LIMB_PAIR(0x7CFDD13D, 0x4F90FAF0), LIMB_PARTIAL(0x160)
+        },
+        {   // 8 * 16^101 * G
+            LIMB_PAIR(0x75276D10, 0xC3974B76), LIMB_PAIR(0x07BB3D19, 0xB6E1836C), LIMB_PAIR(0xB1619E9E, 0x2B1BA75D), LIMB_PAIR(0x5C4A2EBF, 0x1E89C2BD),
+            LIMB_PAIR(0x7285EB6E, 0x4C2EF54B), LIMB_PAIR(0xDF72938A, 0xBA22A605), LIMB_PAIR(0x57474591, 0x51152A26), LIMB_PAIR(0x997713F2, 0x70C745FF), LIMB_PARTIAL(0x06B),
+            LIMB_PAIR(0x0835DB88, 0xA7AB6379), LIMB_PAIR(0x753370F0, 0x2A6D5526), LIMB_PAIR(0x4B2E4EDC, 0x157E790A), LIMB_PAIR(0x911F4047, 0x0B56220A),
+            LIMB_PAIR(0xD7C0FB09, 0xDEDAA43B), LIMB_PAIR(0x5A31E2DA, 0xC6FF25E3), LIMB_PAIR(0xA78AB4A8, 0x6B0EE7BF), LIMB_PAIR(0x36D00945, 0xCBAFB788), LIMB_PARTIAL(0x165)
+        }
+    },
+#endif
+#if (102 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^102 * G
+            LIMB_PAIR(0x512E743F, 0xBCA656EB), LIMB_PAIR(0xBA4F85EC, 0xCD94FC24), LIMB_PAIR(0x048BDF6F, 0xF4383AD0), LIMB_PAIR(0x587F47A6, 0xDB10E381),
+            LIMB_PAIR(0xDA3EC391, 0x47F244E7), LIMB_PAIR(0x0C33624B, 0x5F337E38), LIMB_PAIR(0x82A3C375, 0x9259425F), LIMB_PAIR(0xF276BF73, 0x509E56C3), LIMB_PARTIAL(0x014),
+            LIMB_PAIR(0xD94CB899, 0x2D65148D), LIMB_PAIR(0x3B28185E, 0xCAC38630), LIMB_PAIR(0xE102ADB5, 0xA36BB7BD), LIMB_PAIR(0xFF3FFFB6, 0xA1E7E0B5),
+            LIMB_PAIR(0xE628E1AF, 0xC842CEAC), LIMB_PAIR(0x8647613E, 0x8E6DFA7C), LIMB_PAIR(0x84ADE38B, 0xEAFD7585), LIMB_PAIR(0x00188D5E, 0x7C4C0B0A), LIMB_PARTIAL(0x151)
+        },
+        {   // 2 * 16^102 * G
+            LIMB_PAIR(0x5B3E313B, 0xE5D4DEFB), LIMB_PAIR(0x272AC52D, 0xA821692C), LIMB_PAIR(0x853D75EB, 0x63E8DB0D), LIMB_PAIR(0x774DA98D, 0xE135B25B),
+            LIMB_PAIR(0xC0EA0962, 0x5019813B), LIMB_PAIR(0x93D92BDD, 0xA03D6D8F), LIMB_PAIR(0x0EC90C8F, 0x63AD9B32), LIMB_PAIR(0x21967233, 0x674E973C), LIMB_PARTIAL(0x02E),
+            LIMB_PAIR(0x98494014, 0x6CFDFEA7), LIMB_PAIR(0x4F03D4BC, 0xB9F9C0CE), LIMB_PAIR(0x8A4CDE4E, 0xB30273DB), LIMB_PAIR(0x3C413325, 0x81DFAA1B),
+            LIMB_PAIR(0xB3964D85, 0xF7BC31E7), LIMB_PAIR(0xFA47FCD0, 0xF73996C8), LIMB_PAIR(0xA94E35B2, 0x1D5FE418), LIMB_PAIR(0x9FA4F44B, 0x7CD3986E), LIMB_PARTIAL(0x17E)
+        },
+        {   // 3 * 16^102 * G
+            LIMB_PAIR(0x5E3F9A6F, 0x72B02324), LIMB_PAIR(0x08DEFDB5, 0xC8893745), LIMB_PAIR(0x2ACD0AF4, 0xAB723536), LIMB_PAIR(0x5D02BACE, 0x7CE916A8),
+            LIMB_PAIR(0x96314AE6, 0xB2ABE9DD), LIMB_PAIR(0xCC74749E, 0x6B664D88), LIMB_PAIR(0xA5595E97, 0x59F417BE), LIMB_PAIR(0x52EF341A, 0xE77F2E3B), LIMB_PARTIAL(0x03C),
+            LIMB_PAIR(0xE3AA5B6D, 0x1F57CEBB), LIMB_PAIR(0x8901CD97, 0x870522A6), LIMB_PAIR(0x57CF5E3A, 0x926CE7D9), LIMB_PAIR(0x31E15A34, 0x2D8FC693),
+            LIMB_PAIR(0x009B6274, 0xC3A756AD), LIMB_PAIR(0xF82857A8, 0x498748F3), LIMB_PAIR(0xB5531159, 0x7B27D095), LIMB_PAIR(0xC7E359A7, 0xE2783284), LIMB_PARTIAL(0x082)
+        },
+        {   // 4 * 16^102 * G
+            LIMB_PAIR(0x46045461, 0x78D9E7F4), LIMB_PAIR(0x7430D61E, 0x841C793E), LIMB_PAIR(0xDD245666, 0xF77B63B8), LIMB_PAIR(0x844F837F, 0x4B39BDD5),
+            LIMB_PAIR(0xAB70F0F5, 0xCE7BB287), LIMB_PAIR(0x74B7CBC6, 0xEF4B6AA2), LIMB_PAIR(0x981FDF5C, 0x9821F978), LIMB_PAIR(0xE506A31C, 0xB63E67A8), LIMB_PARTIAL(0x12E),
+            LIMB_PAIR(0x1FC1DA54, 0x1D229604), LIMB_PAIR(0xD0C4B6BD, 0xA5B7E873), LIMB_PAIR(0xF59127B7, 0xEB72B87B), LIMB_PAIR(0x9FBC54B7, 0x8DB0F385),
+            LIMB_PAIR(0x61462A53, 0x534EBF94), LIMB_PAIR(0x80B9D20B, 0x97099E75), LIMB_PAIR(0x88AAA712, 0x0ED2D96A), LIMB_PAIR(0x6A1B85D7, 0x415CA08A), LIMB_PARTIAL(0x091)
+        },
+        {   // 5 * 16^102 * G
+            LIMB_PAIR(0xB6501DC3, 0x039C81F5), LIMB_PAIR(0xD507075B, 0xBEAED737), LIMB_PAIR(0x5C367A46, 0x080BA34A), LIMB_PAIR(0xECD54633, 0x06A583C5),
+            LIMB_PAIR(0x20EFF4CB, 0x2085119B), LIMB_PAIR(0xA193A015, 0x26F27B7A), LIMB_PAIR(0x37B34FB1, 0xA2DD99C9), LIMB_PAIR(0xFFF66C7F, 0x99227938), LIMB_PARTIAL(0x107),
+            LIMB_PAIR(0x1CEC40F8, 0xEE87C18E), LIMB_PAIR(0x65532DA1, 0x760E880D), LIMB_PAIR(0xBE9ED489, 0x78D00F69), LIMB_PAIR(0x8CC9BE51, 0xF6111494),
+            LIMB_PAIR(0xAAFD71E2, 0x79D826AB), LIMB_PAIR(0x9F39CD9F, 0x831BC305), LIMB_PAIR(0xC214629C, 0xFFFEBC7E), LIMB_PAIR(0xC0A202E7, 0xAB14A5CD), LIMB_PARTIAL(0x083)
+        },
+        {   // 6 * 16^102 * G
+            LIMB_PAIR(0x04DE7536, 0xC1B7A8F7), LIMB_PAIR(0x8570DA46, 0x4B9E6943), LIMB_PAIR(0x337106BD, 0x7724C0C2), LIMB_PAIR(0x054B2F07, 0x6F1367D3),
+            LIMB_PAIR(0x04200225, 0xD7D30E20), LIMB_PAIR(0x8573567C, 0xD722D2FF), LIMB_PAIR(0x741D03AE, 0x3B1A8A31), LIMB_PAIR(0x878FF79A, 0x41474E1B), LIMB_PARTIAL(0x059),
+            LIMB_PAIR(0xFCF8A2FB, 0x3CE983C9), LIMB_PAIR(0x7940D19E, 0xE3C71ED6), LIMB_PAIR(0x434DF786, 0x7347AF8B), LIMB_PAIR(0x08D0762A, 0xA187AA1D),
+            LIMB_PAIR(0x48CC16F9, 0x618FC81D), LIMB_PAIR(0x3B0E7F5D, 0xFECC6257), LIMB_PAIR(0xFE7D47E5, 0xCB1F9E26), LIMB_PAIR(0xCE3918A5, 0x9DDB1566), LIMB_PARTIAL(0x047)
+        },
+        {   // 7 * 16^102 * G
+            LIMB_PAIR(0x4F244783, 0x810305AB), LIMB_PAIR(0x0E2C1A83, 0x99471C5A), LIMB_PAIR(0x9BD2BA8D, 0xBB3BEEB3), LIMB_PAIR(0x9C189A01, 0xE7FE7B92),
+            LIMB_PAIR(0x667F8683, 0x0F5A31C9), LIMB_PAIR(0xFB7BFBB0, 0x28EE1A59), LIMB_PAIR(0x8E14240E, 0x4CB86E09), LIMB_PAIR(0x9BAB970C, 0x47039EC2), LIMB_PARTIAL(0x183),
+            LIMB_PAIR(0xF4EA7190, 0x09B761F8), LIMB_PAIR(0x637F19C3, 0x5B109E93), LIMB_PAIR(0xEDD588D7, 0xE40AA435), LIMB_PAIR(0x81A3B4AE, 0x6B257378),
+            LIMB_PAIR(0x591F5CAE, 0xF5B5CC60), LIMB_PAIR(0x811B80FE, 0x2E787D34), LIMB_PAIR(0xB0D84075, 0x28BE1DB7), LIMB_PAIR(0xA4DB6982, 0x2579D623), LIMB_PARTIAL(0x0B8)
+        },
+        {   // 8 * 16^102 * G
+            LIMB_PAIR(0x5244ADF3, 0x48A6060B), LIMB_PAIR(0x9F9C1646, 0x196C42F9), LIMB_PAIR(0x3946D4DB, 0x1DEA9FAC), LIMB_PAIR(0x183C46DA, 0x30563642),
+            LIMB_PAIR(0xC9E4A634, 0xE5C58915), LIMB_PAIR(0xCCE36F63, 0x3E71B542), LIMB_PAIR(0x39EAADA5, 0x4D91D55C), LIMB_PAIR(0x1C43907F, 0xD3F5AF0F), LIMB_PARTIAL(0x0C4),
+            LIMB_PAIR(0x3080DB73, 0x1152F141), LIMB_PAIR(0xB4BDA7AB, 0x3D5031A2), LIMB_PAIR(0xD0F0DAF0, 0x0DF9C2BC), LIMB_PAIR(0x0D01895A, 0xAF4AA1F3),
+            LIMB_PAIR(0x2B137ACD, 0xFE828130), LIMB_PAIR(0xF072EDA7, 0xFCDBFEFF), LIMB_PAIR(0x11D578DF, 0x8F3E3139), LIMB_PAIR(0x92662C8E, 0x37D9CE5B), LIMB_PARTIAL(0x086)
+        }
+    },
+#endif
+#if (103 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^103 * G
+            LIMB_PAIR(0xE63885D6, 0xF7593760), LIMB_PAIR(0x86E546CA, 0xCE5054BB), LIMB_PAIR(0x6E9567B2, 0x5910AD52), LIMB_PAIR(0xE420AFF3, 0xE812CF7B),
+            LIMB_PAIR(0x904E9676, 0x266049FD), LIMB_PAIR(0x2C8B34AD, 0x42D0E2AB), LIMB_PAIR(0xA4382F29, 0xF79F8F91), LIMB_PAIR(0x41D531DE, 0xF8CDE3ED), LIMB_PARTIAL(0x035),
+            LIMB_PAIR(0xB16CC1F3, 0xE514497F), LIMB_PAIR(0x627DB2F6, 0xBC044F39), LIMB_PAIR(0xA1FA2BDC, 0x76FA5148), LIMB_PAIR(0x5FE3FD7A, 0xCF7EB72E),
+            LIMB_PAIR(0xEE3D45E6, 0x83236C11), LIMB_PAIR(0xC4EDDB54, 0xA02D7E92), LIMB_PAIR(0x4D4982A5, 0xCFB5BB89), LIMB_PAIR(0x7C217EA5, 0xEE6AC2A2), LIMB_PARTIAL(0x0BD)
+        },
+        {   // 2 * 16^103 * G
+            LIMB_PAIR(0x2F3CDB19, 0x1E5E4293), LIMB_PAIR(0x87214E3B, 0x99203167), LIMB_PAIR(0x93D885A3, 0xBA80FBFE), LIMB_PAIR(0xB25A2700, 0x58F3ECAC),
+            LIMB_PAIR(0x69F5D172, 0x2C4A14D3), LIMB_PAIR(0x816EBAF0, 0x478313D4), LIMB_PAIR(0xC93F7738, 0x41018D31), LIMB_PAIR(0x06AC6002, 0x5DB7131E), LIMB_PARTIAL(0x1B4),
+            LIMB_PAIR(0x95B8EDBC, 0xA5D36872), LIMB_PAIR(0x945B9473, 0x47931810), LIMB_PAIR(0xA82C5F49, 0xEA5B3FFE), LIMB_PAIR(0xF491BC9B, 0x5ED84F08),
+            LIMB_PAIR(0x9B3B994D, 0x1492E534), LIMB_PAIR(0xDA6C1225, 0x4788372D), LIMB_PAIR(0x40022D06, 0xFDA45214), LIMB_PAIR(0xFBCA3D03, 0xFB0BCF49), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 3 * 16^103 * G
+            LIMB_PAIR(0x5751A4F4, 0x38FF6EA3), LIMB_PAIR(0x0F0EC448, 0x0D3B2CB1), LIMB_PAIR(0x93A502C0, 0x5BC5BAA3), LIMB_PAIR(0xC62E3061, 0x87D6A136),
+            LIMB_PAIR(0x130F3523, 0x1B970DF2), LIMB_PAIR(0xFD691595, 0x89787BDC), LIMB_PAIR(0x517EF324, 0x0C8E0A70), LIMB_PAIR(0x97924054, 0x3BABDBF6), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0x491F0B40, 0xD425EA77), LIMB_PAIR(0x5C253856, 0x9C214D2B), LIMB_PAIR(0xDBB65488, 0xF74A9B15), LIMB_PAIR(0x17BED5D9, 0x87369E1D),
+            LIMB_PAIR(0xE589A38F, 0x67CC0214), LIMB_PAIR(0xBFA1E6E7, 0x6A141AB9), LIMB_PAIR(0xD193C133, 0xA3253AA2), LIMB_PAIR(0x7E63917D, 0xDFF0A10F), LIMB_PARTIAL(0x057)
+        },
+        {   // 4 * 16^103 * G
+            LIMB_PAIR(0x25144121, 0x8A4AF8AE), LIMB_PAIR(0xEC215026, 0xD89467B7), LIMB_PAIR(0xE013FBA2, 0x3AB6CB7F), LIMB_PAIR(0x35F18F1E, 0xC15A0569),
+            LIMB_PAIR(0x70933BEA, 0x8BD48A1D), LIMB_PAIR(0x5B8C61F6, 0x6A40474A), LIMB_PAIR(0xB5158AFC, 0xAD967B15), LIMB_PAIR(0x6D7F6E5F, 0x119A0EE9), LIMB_PARTIAL(0x10B),
+            LIMB_PAIR(0xA548551E, 0x895E3E94), LIMB_PAIR(0xEB65FA7E, 0xFCFE2882), LIMB_PAIR(0x3582920B, 0xAFA1800F), LIMB_PAIR(0xBF58E02E, 0x5CDA388E),
+            LIMB_PAIR(0xFB270F11, 0xE7AAD6F7), LIMB_PAIR(0xB7E27667, 0x95A2636F), LIMB_PAIR(0xA3BE4195, 0xDEC591D7), LIMB_PAIR(0x808C1315, 0xDE0E7440), LIMB_PARTIAL(0x1B5)
+        },
+        {   // 5 * 16^103 * G
+            LIMB_PAIR(0x517A4CD0, 0x641FBE08), LIMB_PAIR(0x890D5388, 0x71973104), LIMB_PAIR(0xB3E7BD17, 0x390AA2B5), LIMB_PAIR(0x1F861153, 0xF9B38BD4),
+            LIMB_PAIR(0x42796670, 0xD2617A18), LIMB_PAIR(0xFBBE6DC1, 0x7D3C4EBE), LIMB_PAIR(0x161342D4, 0x418D3DA1), LIMB_PAIR(0x25BFF257, 0x3009DDA8), LIMB_PARTIAL(0x089),
+            LIMB_PAIR(0x6369DA47, 0x04888A4D), LIMB_PAIR(0xF9BC50E5, 0x10975F89), LIMB_PAIR(0x7415D98B, 0xFD1BDA69), LIMB_PAIR(0xDEFA1DBE, 0x978021E9),
+            LIMB_PAIR(0x0B97FCD4, 0x4AF400C9), LIMB_PAIR(0x062345E4, 0x66EB174E), LIMB_PAIR(0x643339AE, 0x5A8E92D0), LIMB_PAIR(0x1EBDC132, 0x2E36B35E), LIMB_PARTIAL(0x176)
+        },
+        {   // 6 * 16^103 * G
+            LIMB_PAIR(0x3A771403, 0x57B9DA07), LIMB_PAIR(0xAB21FE58, 0xDE6EE702), LIMB_PAIR(0x843AACAB, 0x60D32DE6), LIMB_PAIR(0x9064DFBB, 0xE522B956),
+            LIMB_PAIR(0x7EA0DCAD, 0xB4B42920), LIMB_PAIR(0xA3F46A45, 0x4222697A), LIMB_PAIR(0x3BE7A95B, 0x1557D30B), LIMB_PAIR(0x9FA83859, 0x712CA747), LIMB_PARTIAL(0x153),
+            LIMB_PAIR(0x15FB1AC0, 0x162516D4), LIMB_PAIR(0xEE7BE87A, 0x44B19CB0), LIMB_PAIR(0x3D9D86B1, 0xCE8815EB), LIMB_PAIR(0x57331615, 0xCE8F13F9),
+            LIMB_PAIR(0xF71FAAC1, 0x78E8539E), LIMB_PAIR(0x8E5CA8BC, 0x29154B09), LIMB_PAIR(0x312E4C96, 0x45B36262), LIMB_PAIR(0x80940F73, 0x2E03EE86), LIMB_PARTIAL(0x1C2)
+        },
+        {   // 7 * 16^103 * G
+            LIMB_PAIR(0xD6FF5A2D, 0x081FE748), LIMB_PAIR(0xB93AFA57, 0x52B184A6), LIMB_PAIR(0x46E11AB9, 0x83C0C666), LIMB_PAIR(0x5350A841, 0x274DF41F),
+            LIMB_PAIR(0x4A3FEE0E, 0xED23080B), LIMB_PAIR(0xBF0ABB4E, 0x4BC1FB50), LIMB_PAIR(0xA37D4E7B, 0x4CA11F49), LIMB_PAIR(0xBB6C8307, 0x3A7284A1), LIMB_PARTIAL(0x1B7),
+            LIMB_PAIR(0x2A535E97, 0x340E4AA0), LIMB_PAIR(0x01A36DA4, 0x6A0F9700), LIMB_PAIR(0x94F67DDC, 0x140F4676), LIMB_PAIR(0x51D24551, 0x81F3A138),
+            LIMB_PAIR(0x1F5481CA, 0xF8930765), LIMB_PAIR(0xDB6865A1, 0x23007EA9), LIMB_PAIR(0x9C46AD26, 0xB37376C9), LIMB_PAIR(0xC2FA4CCE, 0x53C8F29C), LIMB_PARTIAL(0x00F)
+        },
+        {   // 8 * 16^103 * G
+            LIMB_PAIR(0xEF05EF2D, 0xE95AB9E7), LIMB_PAIR(0xFD5CC417, 0x29EC067F), LIMB_PAIR(0x39402B0A, 0x67C10BC7), LIMB_PAIR(0x1E9CA8AC, 0x109F7D51),
+            LIMB_PAIR(0xF8EFE529, 0x0B10550B), LIMB_PAIR(0xF18C8DEC, 0x0BF3624C), LIMB_PAIR(0x3746474A, 0x42F686F3), LIMB_PAIR(0x40052446, 0x0F8A8311), LIMB_PARTIAL(0x1F4),
+            LIMB_PAIR(0x329ED806, 0x56303452), LIMB_PAIR(0x654F22D9, 0x1D80C752), LIMB_PAIR(0x9F61F3EC, 0xF41FE172), LIMB_PAIR(0x0CD5FE42, 0x7D4AD71E),
+            LIMB_PAIR(0xDD164DA0, 0xFFDA94AD), LIMB_PAIR(0x7F19C583, 0x260A2BDF), LIMB_PAIR(0x5D6229DA, 0x8E867324), LIMB_PAIR(0x2FC87AE8, 0x1D13D05C), LIMB_PARTIAL(0x0BA)
+        }
+    },
+#endif
+#if (104 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^104 * G
+            LIMB_PAIR(0x8FE6F511, 0x141838BF), LIMB_PAIR(0xEE745E2E, 0x8E9FF343), LIMB_PAIR(0x02325306, 0x71DA9FD5), LIMB_PAIR(0xF0D0D68E, 0xA527B9BA),
+            LIMB_PAIR(0x31144649, 0xCE19B22C), LIMB_PAIR(0x0BFAA46C, 0xCA9B778B), LIMB_PAIR(0x6CE31145, 0x66E689A7), LIMB_PAIR(0xD8D1DA21, 0xED43460D), LIMB_PARTIAL(0x0BF),
+            LIMB_PAIR(0xC1669168, 0x241323F7), LIMB_PAIR(0x79B94B5A, 0x9934B3DE), LIMB_PAIR(0xD9F9A406, 0xD332C1A2), LIMB_PAIR(0xE4A49EAC, 0xBE3EBE21),
+            LIMB_PAIR(0x678BE3ED, 0x4A00648E), LIMB_PAIR(0xFF09DB31, 0xC9F534EA), LIMB_PAIR(0x5EFDD859, 0x2DE77406), LIMB_PAIR(0x00F5C7A5, 0x2C218CD8), LIMB_PARTIAL(0x152)
+        },
+        {   // 2 * 16^104 * G
+            LIMB_PAIR(0xEFD5CF86, 0xFE1B039A), LIMB_PAIR(0xC0945B5A, 0xC7FBCA26), LIMB_PAIR(0x887A27A1, 0x6B30E2E0), LIMB_PAIR(0xE7CC98D9, 0x0883A38B),
+            LIMB_PAIR(0xFB2138F5, 0xA646C35B), LIMB_PAIR(0x74F0C200, 0x735769DF), LIMB_PAIR(0x2AB20E1D, 0x9FCDF60A), LIMB_PAIR(0x1F2E11DC, 0x4E0ACC80), LIMB_PARTIAL(0x13A),
+            LIMB_PAIR(0x15ABD8EA, 0x00CAF225), LIMB_PAIR(0xCB2E6E92, 0xE5F47384), LIMB_PAIR(0xBE14FF19, 0xA9186F93), LIMB_PAIR(0x16CA5BB6, 0x4620D2C9),
+            LIMB_PAIR(0xBDDDE27B, 0x22D4FC0E), LIMB_PAIR(0xA1C81269, 0xD6F04A09), LIMB_PAIR(0xFAC277D4, 0x25D65811), LIMB_PAIR(0x322AB775, 0x803293DB), LIMB_PARTIAL(0x1E4)
+        },
+        {   // 3 * 16^104 * G
+            LIMB_PAIR(0x0A823516, 0x323E1B7F), LIMB_PAIR(0x673254F7, 0x8F4E9152), LIMB_PAIR(0x41599B9C, 0x5E5D7190), LIMB_PAIR(0xA1198ACC, 0x96BFBA24),
+            LIMB_PAIR(0xBBFCD72C, 0xB1B6E75B), LIMB_PAIR(0xF4894626, 0xFD5955F2), LIMB_PAIR(0x898BBBFD, 0x109EDFEA), LIMB_PAIR(0x1F468074, 0xD3692904), LIMB_PARTIAL(0x16A),
+            LIMB_PAIR(0x9BB7D749, 0x089D12A9), LIMB_PAIR(0x4FFC33D9, 0x893EBF25), LIMB_PAIR(0x9097FF49, 0x6ED72C60), LIMB_PAIR(0xB4E1D91D, 0x9291E1EE),
+            LIMB_PAIR(0x72A07882, 0x0DBFE582), LIMB_PAIR(0xBE0636EC, 0xAC41065F), LIMB_PAIR(0xF4234BD5, 0x43D74F8B), LIMB_PAIR(0x0A28FDEF, 0x01BFB085), LIMB_PARTIAL(0x0B5)
+        },
+        {   // 4 * 16^104 * G
+            LIMB_PAIR(0x1EC238D2, 0x9D0DBABB), LIMB_PAIR(0x37E67E7E, 0x3F6C4AF3), LIMB_PAIR(0x64DEC6E9, 0xF7A6B094), LIMB_PAIR(0x2C2724CC, 0x1F53FD50),
+            LIMB_PAIR(0x51BCAA0C, 0x5F333D47), LIMB_PAIR(0xEBAE3589, 0x63CC89BA), LIMB_PAIR(0xF0632831, 0x2B90AF90), LIMB_PAIR(0x4D18CFD3, 0x8F6AF6CD), LIMB_PARTIAL(0x1CE),
+            LIMB_PAIR(0x76940E65, 0x8B34E445), LIMB_PAIR(0xC1C34C11, 0x264A0D8F), LIMB_PAIR(0x4120AFC2, 0xD433303F), LIMB_PAIR(0xF7E738B8, 0x240A12D6),
+            LIMB_PAIR(0x6E921883, 0x574FA715), LIMB_PAIR(0x02D74E8C, 0x6B2BB33C), LIMB_PAIR(0x0FE8E9B8, 0x7B193E24), LIMB_PAIR(0x506CC6D4, 0xBE954BAD), LIMB_PARTIAL(0x11E)
+        },
+        {   // 5 * 16^104 * G
+            LIMB_PAIR(0xD1A4A65E, 0x4054B365), LIMB_PAIR(0xA04B2F59, 0xFA395E2A), LIMB_PAIR(0xBF63D17A, 0x1C6C3B41), LIMB_PAIR(0xABE2AAD0, 0xA639FB26),
+            LIMB_PAIR(0x0C9A565D, 0x008F8160), LIMB_PAIR(0x91061E61, 0xF5EFA9E6), LIMB_PAIR(0x6E881F7F, 0x7731C2F7), LIMB_PAIR(0x9074B4AA, 0x3623CD7C), LIMB_PARTIAL(0x016),
+            LIMB_PAIR(0x1037873E, 0x20BA924B), LIMB_PAIR(0xABCFD34E, 0x7B7107AC), LIMB_PAIR(0x05E13406, 0xB492EBB9), LIMB_PAIR(0xF08FD2FA, 0x6DCC3342),
+            LIMB_PAIR(0x64126080, 0x08F3A1D3), LIMB_PAIR(0xFB5BF009, 0x8FB54869), LIMB_PAIR(0x82442DCD, 0x5E661632), LIMB_PAIR(0x5C21D62A, 0xBAB2D8DD), LIMB_PARTIAL(0x03D)
+        },
+        {   // 6 * 16^104 * G
+            LIMB_PAIR(0x84C1985A, 0xC296B1F6), LIMB_PAIR(0xAA4F7132, 0x971547C5), LIMB_PAIR(0x83E168CF, 0xE3705E11), LIMB_PAIR(0xC935A3DE, 0x8D00E588),
+            LIMB_PAIR(0x5262789B, 0x85315423), LIMB_PAIR(0x005F7C35, 0x46F2C2CA), LIMB_PAIR(0x17EA733E, 0xFBFBADD2), LIMB_PAIR(0xC9E496A6, 0xB32A38B6), LIMB_PARTIAL(0x0D8),
+            LIMB_PAIR(0xCEC8D3F9, 0xA82E95E5), LIMB_PAIR(0xE378BE9D, 0x8A1EFCA3), LIMB_PAIR(0x8080D874, 0x6E114D07), LIMB_PAIR(0xFB9C056A, 0x514DC754),
+            LIMB_PAIR(0x66EF6C48, 0x5781BE89), LIMB_PAIR(0x34B1EBE3, 0x0586BD38), LIMB_PAIR(0x8A8B161E, 0x0E31B44F), LIMB_PAIR(0xD4D62DD5, 0x20C2B78A), LIMB_PARTIAL(0x1DB)
+        },
+        {   // 7 * 16^104 * G
+            LIMB_PAIR(0xAEB0D0F0, 0xEA6E467A), LIMB_PAIR(0xEB5EE813, 0x9FA030D9), LIMB_PAIR(0x515CDBF8, 0x9BE99873), LIMB_PAIR(0xA805D16A, 0xE608DB63),
+            LIMB_PAIR(0x9CE2F64B, 0x5E6255DD), LIMB_PAIR(0x7418BB31, 0x2D88FB42), LIMB_PAIR(0xE7AC60BF, 0x147C74FE), LIMB_PAIR(0x672B0F90, 0x34DF0171), LIMB_PARTIAL(0x04D),
+            LIMB_PAIR(0x77F1F4FE, 0x6C1F2671), LIMB_PAIR(0x138FA188, 0xF64D4242), LIMB_PAIR(0x4C0097CA, 0x55AB5DDD), LIMB_PAIR(0xBDBDB465, 0x354BB5F3),
+            LIMB_PAIR(0x79060E68, 0xAD6142D5), LIMB_PAIR(0x1017B5FB, 0xD9ADC110), LIMB_PAIR(0x9F510299, 0x656FFC3A), LIMB_PAIR(0x741EBE49, 0x568945BD), LIMB_PARTIAL(0x09F)
+        },
+        {   // 8 * 16^104 * G
+            LIMB_PAIR(0x63D7540B, 0x61D252DA), LIMB_PAIR(0xBA87605E, 0x5977687D), LIMB_PAIR(0xF8F3558E, 0x53BE7D04), LIMB_PAIR(0x99F1AAF0, 0x76C4C49C),
+            LIMB_PAIR(0xCE8BF731, 0x129E0BFF), LIMB_PAIR(0x66A1555B, 0xCDDE32A1), LIMB_PAIR(0xD4BC5B6A, 0xEDB9E9E5), LIMB_PAIR(0x52BC3C6F, 0x675B5D12), LIMB_PARTIAL(0x130),
+            LIMB_PAIR(0x91B491F4, 0xFB3DABAE), LIMB_PAIR(0x9EA0B6D1, 0xEF1967C3), LIMB_PAIR(0xE6370D8E, 0xB68A0E75), LIMB_PAIR(0xE2FFB7B5, 0x6DD017FC),
+            LIMB_PAIR(0x06D66169, 0x7E3DC826), LIMB_PAIR(0x56271658, 0x802B2690), LIMB_PAIR(0xC3DA3C9F, 0x117A4EE3), LIMB_PAIR(0x167D09AF, 0x80BB9FCF), LIMB_PARTIAL(0x0D0)
+        }
+    },
+#endif
+#if (105 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^105 * G
+            LIMB_PAIR(0x10A8C4FB, 0x73A6BA38), LIMB_PAIR(0xECC93E5D, 0x5153D959), LIMB_PAIR(0xB59E9871, 0x7CA58012), LIMB_PAIR(0xAFD442F1, 0xEDC0DBEF),
+            LIMB_PAIR(0xB9CF7691, 0xB9050A22), LIMB_PAIR(0x464D017D, 0x3D1E96FE), LIMB_PAIR(0x82074DCA, 0x541781A4), LIMB_PAIR(0x8B355413, 0xEDCE0DB3), LIMB_PARTIAL(0x06B),
+            LIMB_PAIR(0xAE2B39C2, 0x1A13E3EE), LIMB_PAIR(0x3C218179, 0xC431081D), LIMB_PAIR(0xAE68B7C6, 0x5CBC14C1), LIMB_PAIR(0x9005A304, 0xCF2559BB),
+            LIMB_PAIR(0x2EC7AED5, 0x14D7C1E9), LIMB_PAIR(0x1E2E2F0D, 0x5C379BFE), LIMB_PAIR(0x886F0CF9, 0xFC33E4D2), LIMB_PAIR(0xAC4E1D17, 0x2F14E7D0), LIMB_PARTIAL(0x071)
+        },
+        {   // 2 * 16^105 * G
+            LIMB_PAIR(0x2C82D5C0, 0x27E639C9), LIMB_PAIR(0x104B9D44, 0x035527B8), LIMB_PAIR(0x8A17BE05, 0xD0A7F3C8), LIMB_PAIR(0x813CB246, 0x3C529B91),
+            LIMB_PAIR(0xB8E54B08, 0x296074B2), LIMB_PAIR(0x8DCA703C, 0x66011857), LIMB_PAIR(0x41606A8D, 0xFA30E9DE), LIMB_PAIR(0x9AD1D94A, 0x2652C08C), LIMB_PARTIAL(0x06E),
+            LIMB_PAIR(0xD42D26B2, 0x09724BA6), LIMB_PAIR(0x25EECAB7, 0xC0A02C2E), LIMB_PAIR(0x45E7FB83, 0xB0041748), LIMB_PAIR(0x4503354E, 0x24E80B60),
+            LIMB_PAIR(0xDA55516D, 0x4F3045F9), LIMB_PAIR(0xCC7B2627, 0x97D76335), LIMB_PAIR(0xB380F10F, 0xC8BFD79B), LIMB_PAIR(0x2BECBC27, 0x98739652), LIMB_PARTIAL(0x146)
+        },
+        {   // 3 * 16^105 * G
+            LIMB_PAIR(0x0093FD88, 0x9394910F), LIMB_PAIR(0x547FC3E1, 0xFF7760D2), LIMB_PAIR(0xA904C24E, 0x7B81FCF5), LIMB_PAIR(0xFD80644C, 0x120A558D),
+            LIMB_PAIR(0xA715D6FC, 0xFAD07009), LIMB_PAIR(0xABF6246F, 0x24BD3AD8), LIMB_PAIR(0x79C968A7, 0x7C5B04C7), LIMB_PAIR(0x108AD586, 0xC7DF9266), LIMB_PARTIAL(0x0D3),
+            LIMB_PAIR(0xB655B6E1, 0xE37DB2E0), LIMB_PAIR(0x568C6373, 0x0A029277), LIMB_PAIR(0x428A6B69, 0x0BD0526F), LIMB_PAIR(0x3D4F3847, 0x54BD7B9B),
+            LIMB_PAIR(0xCB6BD60F, 0x42CACA2F), LIMB_PAIR(0x6D10BFA6, 0x657B0F1F), LIMB_PAIR(0x0FEF238D, 0x97F9F99D), LIMB_PAIR(0xCC3795A8, 0x93171B4D), LIMB_PARTIAL(0x09D)
+        },
+        {   // 4 * 16^105 * G
+            LIMB_PAIR(0x0DDD2BA9, 0x83FA275B), LIMB_PAIR(0xBADDBDEE, 0x71F5B43D), LIMB_PAIR(0x2244290B, 0xB6781411), LIMB_PAIR(0x1244C56C, 0x07558060),
+            LIMB_PAIR(0x2CE4FC6B, 0xFDD85CCE), LIMB_PAIR(0xE53B1502, 0x7FC52DAC), LIMB_PAIR(0x55A68467, 0x3243B952), LIMB_PAIR(0x40900CEF, 0x06EF6A65), LIMB_PARTIAL(0x09F),
+            LIMB_PAIR(0x65457F82, 0x562D06AC), LIMB_PAIR(0x9A9E8E58, 0x9DBD6351), LIMB_PAIR(0x496D9349, 0x0D218265), LIMB_PAIR(0xA218EC30, 0x940BF3F4),
+            LIMB_PAIR(0xD605883D, 0x1E9C0AA3), LIMB_PAIR(0x427F8A5C, 0x2CB9BCC6), LIMB_PAIR(0x3685376C, 0xBA3119B2), LIMB_PAIR(0xF0C5783F, 0xFC2C2F0D), LIMB_PARTIAL(0x0DC)
+        },
+        {   // 5 * 16^105 * G
+            LIMB_PAIR(0xA73A1AA4, 0xB7B63D0F), LIMB_PAIR(0x5532EC0F, 0xFADBA595), LIMB_PAIR(0xFF9E47D6, 0x19A61405), LIMB_PAIR(0xAA210AFC, 0xD9A44EF1),
+            LIMB_PAIR(0x3C3E2B07, 0xCAB8BD2C), LIMB_PAIR(0x4E1428A8, 0xDD8F8D15), LIMB_PAIR(0x91F63FF2, 0xA5EABCC5), LIMB_PAIR(0x66F368C9, 0x7DD96356), LIMB_PARTIAL(0x18A),
+            LIMB_PAIR(0xD84C056D, 0xB35C9E17), LIMB_PAIR(0xEDDFF5DE, 0x0F27CD01), LIMB_PAIR(0x2C0D1066, 0x855C10A9), LIMB_PAIR(0xB4BFB648, 0xC7AEE7FE),
+            LIMB_PAIR(0x5803338B, 0x9F9D978D), LIMB_PAIR(0x4F4F2B95, 0xFCA5A25F), LIMB_PAIR(0xADF37F8A, 0x9D5D5FBF), LIMB_PAIR(0x5059C65C, 0x13482B1E), LIMB_PARTIAL(0x1A4)
+        },
+        {   // 6 * 16^105 * G
+            LIMB_PAIR(0xFDA1FFDF, 0x6E95A3AE), LIMB_PAIR(0xEA5AED3B, 0xC4014EBC), LIMB_PAIR(0x62B64816, 0x915719F8), LIMB_PAIR(0xDE90B2F6, 0x2EA08A71),
+            LIMB_PAIR(0x1B4836DF, 0xD2B45D30), LIMB_PAIR(0x21840212, 0x56475800), LIMB_PAIR(0xFFCA7E1A, 0x169110F6), LIMB_PAIR(0xF5F43DFD, 0xB32EE8A9), LIMB_PARTIAL(0x1BB),
+            LIMB_PAIR(0x1962C792, 0x7BA4DCD7), LIMB_PAIR(0x5FDDDA2D, 0x539FABAC), LIMB_PAIR(0xCFC7B6C2, 0x48913D37), LIMB_PAIR(0x09D93B9F, 0xAA2E0FB0),
+            LIMB_PAIR(0x63F79F1E, 0xA625455B), LIMB_PAIR(0x7C45060A, 0x0F26F80B), LIMB_PAIR(0x93EE96FB, 0xDBA77C67), LIMB_PAIR(0x8711AFCB, 0x54BA3740), LIMB_PARTIAL(0x1EE)
+        },
+        {   // 7 * 16^105 * G
+            LIMB_PAIR(0x7500F10A, 0x95DA5444), LIMB_PAIR(0xA6B14D2A, 0x6935CA2A), LIMB_PAIR(0x30DC9660, 0x58F4555C), LIMB_PAIR(0xAC954B30, 0x949EC82A),
+            LIMB_PAIR(0xE7FA5C4D, 0x94027576), LIMB_PAIR(0x21960C7F, 0x035D525A), LIMB_PAIR(0xC2092C76, 0xE3ED1E66), LIMB_PAIR(0xDF9779A1, 0xBD151AA3), LIMB_PARTIAL(0x12C),
+            LIMB_PAIR(0xE59368FE, 0xDA7D7C3D), LIMB_PAIR(0x8DDCE4FC, 0xB4C24064), LIMB_PAIR(0x47EB7A34, 0x05360BF8), LIMB_PAIR(0x700D30FD, 0xE0889804),
+            LIMB_PAIR(0x07F447F6, 0x99E1ADD2), LIMB_PAIR(0x4A4E8762, 0x30E5B757), LIMB_PAIR(0x3329B2FD, 0xEE9F0695), LIMB_PAIR(0x6894A597, 0xBB6FD0FC), LIMB_PARTIAL(0x1A6)
+        },
+        {   // 8 * 16^105 * G
+            LIMB_PAIR(0xEE12880E, 0xB70F255C), LIMB_PAIR(0x02831C27, 0x0FCFF024), LIMB_PAIR(0x87241978, 0xD92706FE), LIMB_PAIR(0xFB475DAA, 0x75C7A550),
+            LIMB_PAIR(0x889E3BE2, 0x128971BB), LIMB_PAIR(0x51F95444, 0x032C8D26), LIMB_PAIR(0x7251B1C7, 0xABE4D7DD), LIMB_PAIR(0x332E627C, 0x8C903FAE), LIMB_PARTIAL(0x1FA),
+            LIMB_PAIR(0x32B6FC85, 0xD00F7BFC), LIMB_PAIR(0x56E1CD16, 0x33EBF5C2), LIMB_PAIR(0x42B24457, 0x0CB224FD), LIMB_PAIR(0xA0EC189C, 0xFD0D2136),
+            LIMB_PAIR(0x6CCE225D, 0x4718B173), LIMB_PAIR(0xE04D9E2D, 0x403528F6), LIMB_PAIR(0xE6E6E81D, 0xC7312B00), LIMB_PAIR(0x02202A72, 0x3D146F60), LIMB_PARTIAL(0x1B1)
+        }
+    },
+#endif
+#if (106 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^106 * G
+            LIMB_PAIR(0x4E1080A4, 0x7D6E4240), LIMB_PAIR(0xE1ADB078, 0x5CF6C427), LIMB_PAIR(0x3D594E28, 0xE74EC603), LIMB_PAIR(0xBDF853F2, 0xC0185404),
+            LIMB_PAIR(0xC3335717, 0x287D94DE), LIMB_PAIR(0xC3179807, 0xF735656A), LIMB_PAIR(0x604E93F7, 0xD356F2BF), LIMB_PAIR(0xCBE27815, 0xB1FDC2F2), LIMB_PARTIAL(0x151),
+            LIMB_PAIR(0xDA1D3EA1, 0x7B17E356), LIMB_PAIR(0xA7AF9610, 0x0ED57D7E), LIMB_PAIR(0x3AE89C0E, 0x4A6AC3E5), LIMB_PAIR(0x5F82B4A3, 0xC8F722B8),
+            LIMB_PAIR(0x7F0850FA, 0x453D5A4A), LIMB_PAIR(0x7B3AC4A3, 0xD6F79D23), LIMB_PAIR(0x0DBAE800, 0xE1C9DFC2), LIMB_PAIR(0xC4B9258E, 0x56E4F0F5), LIMB_PARTIAL(0x1CA)
+        },
+        {   // 2 * 16^106 * G
+            LIMB_PAIR(0xB5F54682, 0xC3C84FD2), LIMB_PAIR(0x32C3A3D6, 0x3488244E), LIMB_PAIR(0xC1F6E2A1, 0x08C89D9E), LIMB_PAIR(0x957EF7DE, 0x9A8AADAC),
+            LIMB_PAIR(0x07CCA3E8, 0x0A54F7FA), LIMB_PAIR(0xBA97BB36, 0x42AD7295), LIMB_PAIR(0x871AE976, 0xD82CAE54), LIMB_PAIR(0x04BF46D8, 0x0EB93572), LIMB_PARTIAL(0x09C),
+            LIMB_PAIR(0x45AE741D, 0x2A3AA55F), LIMB_PAIR(0x9034B489, 0x9B2168B7), LIMB_PAIR(0x21F91264, 0x66C66F09), LIMB_PAIR(0x70703195, 0x6823B0FB),
+            LIMB_PAIR(0x96E215B9, 0x5E43EFAD), LIMB_PAIR(0x4CA42901, 0xE1940D5A), LIMB_PAIR(0x294CCDE6, 0x792CDC63), LIMB_PAIR(0x4446EBB1, 0x5BE5AF8A), LIMB_PARTIAL(0x0B8)
+        },
+        {   // 3 * 16^106 * G
+            LIMB_PAIR(0x6A52747D, 0xC7D45418), LIMB_PAIR(0x523D74D6, 0x034CB6D1), LIMB_PAIR(0x0E2B859B, 0x073A404E), LIMB_PAIR(0x9345DA73, 0x9A38E6D8),
+            LIMB_PAIR(0xC7FDCCE3, 0x4C4771D5), LIMB_PAIR(0x025C1423, 0xAEE8C00C), LIMB_PAIR(0xD7203E0C, 0x10C94E72), LIMB_PAIR(0x4547289C, 0xEA9F58BB), LIMB_PARTIAL(0x00A),
+            LIMB_PAIR(0x31B952A7, 0x030C1DF5), LIMB_PAIR(0x1D47E37E, 0x8177A6E1), LIMB_PAIR(0xDE6F3C0E, 0x9E2222B0), LIMB_PAIR(0x1399560F, 0x1ED75C87),
+            LIMB_PAIR(0x829AF1E8, 0x9B818C5D), LIMB_PAIR(0x45DB80A1, 0x75C77519), LIMB_PAIR(0xD73C446A, 0xFAC13445), LIMB_PAIR(0x62844292, 0x91A27413), LIMB_PARTIAL(0x027)
+        },
+        {   // 4 * 16^106 * G
+            LIMB_PAIR(0x6A81C377, 0x3D239C6B), LIMB_PAIR(0x7BCF552F, 0xBF4D092E), LIMB_PAIR(0xABD2CAE8, 0x3D2AF909), LIMB_PAIR(0xEBEF1533, 0x3D5AE04C),
+            LIMB_PAIR(0xC7D656CE, 0x9C57DDD8), LIMB_PAIR(0xC552693E, 0xA345AC44), LIMB_PAIR(0xB604FF42, 0xC66E8710), LIMB_PAIR(0x18CB68B4, 0x5743B433), LIMB_PARTIAL(0x170),
+            LIMB_PAIR(0x427E80C7, 0x2AE332C9), LIMB_PAIR(0xDCAED647, 0xC3C529D4), LIMB_PAIR(0x73F44043, 0x1D1A1834), LIMB_PAIR(0x3B71F27D, 0x4F5155D6),
+            LIMB_PAIR(0x73EE7E4C, 0x42390744), LIMB_PAIR(0x4E09E697, 0xB23433B8), LIMB_PAIR(0xA60C57C2, 0x9A4264DA), LIMB_PAIR(0x486992EB, 0xA7F72FF8), LIMB_PARTIAL(0x0B7)
+        },
+        {   // 5 * 16^106 * G
+            LIMB_PAIR(0xA421DED8, 0x8CC7E786), LIMB_PAIR(0xE860A431, 0xA5A125F9), LIMB_PAIR(0x48983574, 0xB7A8D712), LIMB_PAIR(0xE8B35B3B, 0xC6002B7E),
+            LIMB_PAIR(0xCE6EEA34, 0x8F665648), LIMB_PAIR(0x1034CBA8, 0x752979DA), LIMB_PAIR(0x5C5CBEC8, 0xE2630CDA), LIMB_PAIR(0x52E8924F, 0x3EC97990), LIMB_PARTIAL(0x1AE),
+            LIMB_PAIR(0xACC3A394, 0x5273DC9C), LIMB_PAIR(0x49B36AE6, 0xB909BF20), LIMB_PAIR(0x82B3EBEA, 0x171849E5), LIMB_PAIR(0x02F14020, 0xBCD415DE),
+            LIMB_PAIR(0x6FD2DFE5, 0xBF3CFDDB), LIMB_PAIR(0xFF83E32B, 0xB148440C), LIMB_PAIR(0x12FD66EF, 0x47B5DB03), LIMB_PAIR(0x649E2453, 0x1405294D), LIMB_PARTIAL(0x119)
+        },
+        {   // 6 * 16^106 * G
+            LIMB_PAIR(0xD6DF08C2, 0x03F9DF37), LIMB_PAIR(0xD5DB8EA4, 0xB12D3F4F), LIMB_PAIR(0xBA73BF57, 0x22C50890), LIMB_PAIR(0x531E84A4, 0x28B68334),
+            LIMB_PAIR(0x1B30B785, 0xA81E0773), LIMB_PAIR(0x525F3204, 0xB9052F7C), LIMB_PAIR(0xFA3EB3F6, 0x37F84B24), LIMB_PAIR(0x86C05A6F, 0x1F3CBD65), LIMB_PARTIAL(0x14A),
+            LIMB_PAIR(0x2512657A, 0x8FFE4E48), LIMB_PAIR(0x0E33D293, 0xC8838924), LIMB_PAIR(0xBE309839, 0xAEF4F8F7), LIMB_PAIR(0x1D8123A9, 0xDAD04DA0),
+            LIMB_PAIR(0x037D1A50, 0xCA24B672), LIMB_PAIR(0xFB4BFB1B, 0xE38138DA), LIMB_PAIR(0x09E0B0F6, 0x7B144015), LIMB_PAIR(0x847D97A2, 0xE6BC949C), LIMB_PARTIAL(0x045)
+        },
+        {   // 7 * 16^106 * G
+            LIMB_PAIR(0x1BE22FD8, 0x0ADB4AE0), LIMB_PAIR(0x983C07A7, 0xBBE623DD), LIMB_PAIR(0x7AD35FDE, 0x7A3CCB04), LIMB_PAIR(0x88139DA7, 0x940147B2),
+            LIMB_PAIR(0xCFD6AD33, 0x6CA7BC83), LIMB_PAIR(0x2522E444, 0xDAF6805E), LIMB_PAIR(0xB7A5DC1B, 0x81EDD301), LIMB_PAIR(0x2775213E, 0x962222CC), LIMB_PARTIAL(0x0D0),
+            LIMB_PAIR(0xF3F1F2E9, 0xB66DA30E), LIMB_PAIR(0x3DD69CFC, 0x1CECA804), LIMB_PAIR(0x8E011253, 0x216FE23A), LIMB_PAIR(0xA1BC0755, 0x1FA58241),
+            LIMB_PAIR(0x765CDF24, 0xDDBBFB9E), LIMB_PAIR(0x52772AFC, 0x8ADC0268), LIMB_PAIR(0xAA6C3528, 0xB2F7C543), LIMB_PAIR(0xCE8978C5, 0x6571DB8B), LIMB_PARTIAL(0x00B)
+        },
+        {   // 8 * 16^106 * G
+            LIMB_PAIR(0xA2839E80, 0x1352B764), LIMB_PAIR(0x16058B22, 0x61A50D97), LIMB_PAIR(0x9D6AE08D, 0xBD02C687), LIMB_PAIR(0x6679516F, 0x1349EE8B),
+            LIMB_PAIR(0xBC4C2FA2, 0x3D7E69C9), LIMB_PAIR(0x0D24E1FC, 0x4C2E12A1), LIMB_PAIR(0x47436039, 0xC69535A1), LIMB_PAIR(0x0CA25C70, 0xA477F86B), LIMB_PARTIAL(0x11D),
+            LIMB_PAIR(0x2A4C1871, 0x756E379C), LIMB_PAIR(0x5943DF83, 0x4D0B08B3), LIMB_PAIR(0xCD8F5ABB, 0xD8A9B302), LIMB_PAIR(0x8C240617, 0x53865D1E),
+            LIMB_PAIR(0x14A2E093, 0xD422A9B1), LIMB_PAIR(0x03014FDF, 0xBDBC3D7D), LIMB_PAIR(0x11578DD8, 0xA4C8B35A), LIMB_PAIR(0x7A3AFBC1, 0xE4427EF8), LIMB_PARTIAL(0x1C1)
+        }
+    },
+#endif
+#if (107 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^107 * G
+            LIMB_PAIR(0x7D874400, 0x8AF346C5), LIMB_PAIR(0x71098F45, 0xD9E98CB5), LIMB_PAIR(0x79565740, 0xDB400810), LIMB_PAIR(0xED9A7DCF, 0x0F7625EB),
+            LIMB_PAIR(0xC93D2542, 0x5D1415D0), LIMB_PAIR(0x688D0692, 0xF87F74B4), LIMB_PAIR(0x9F648523, 0x9FA2E31B), LIMB_PAIR(0xCB387129, 0x4E505024), LIMB_PARTIAL(0x006),
+            LIMB_PAIR(0x446E7206, 0xE2087F9C), LIMB_PAIR(0xB48BB585, 0x60F69447), LIMB_PAIR(0x2020BBF2, 0xDA365862), LIMB_PAIR(0x3CD51256, 0xC8A26367),
+            LIMB_PAIR(0xC62F7C5E, 0x8CC663B1), LIMB_PAIR(0xE72BBD20, 0xC86D4165), LIMB_PAIR(0xAAC68BE3, 0xFFCE9039), LIMB_PAIR(0xC3C360A8, 0x6C6C747C), LIMB_PARTIAL(0x1D4)
+        },
+        {   // 2 * 16^107 * G
+            LIMB_PAIR(0x781F48A0, 0x290E4FF1), LIMB_PAIR(0x66D6F7EB, 0x020D9E3D), LIMB_PAIR(0x084D19D4, 0x1C0DA98E), LIMB_PAIR(0x030DD190, 0x42C64660),
+            LIMB_PAIR(0x29AA0EB8, 0x996602DD), LIMB_PAIR(0x5D0D86E5, 0x7719FB10), LIMB_PAIR(0x9145140A, 0xE2003262), LIMB_PAIR(0x97E687A2, 0xD2DC210C), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0x18C76449, 0xE704ECDB), LIMB_PAIR(0x44131380, 0x30A43770), LIMB_PAIR(0x372CF9A8, 0xAEC3CF4B), LIMB_PAIR(0x3DF882A5, 0x4033C8C0),
+            LIMB_PAIR(0x969AF81F, 0xA5E23683), LIMB_PAIR(0x80263B3A, 0xF42C5B95), LIMB_PAIR(0x9323C9C4, 0xBFF4ED55), LIMB_PAIR(0x00EF132E, 0xA1D992B8), LIMB_PARTIAL(0x100)
+        },
+        {   // 3 * 16^107 * G
+            LIMB_PAIR(0x1842EB75, 0xAD854BDE), LIMB_PAIR(0xFD913403, 0x52D44A39), LIMB_PAIR(0x964BF528, 0xDE2D5FDD), LIMB_PAIR(0xBE2D138F, 0x00FC48B0),
+            LIMB_PAIR(0x7968E858, 0x49777828), LIMB_PAIR(0x79B5F778, 0x326F8A63), LIMB_PAIR(0x026EE753, 0xB093B6D8), LIMB_PAIR(0x067C336F, 0x36BD9300), LIMB_PARTIAL(0x0B7),
+            LIMB_PAIR(0x3D3B0373, 0xF63D269D), LIMB_PAIR(0x8901CE7A, 0x7FD4555E), LIMB_PAIR(0xF0C00754, 0xFEB8A5AB), LIMB_PAIR(0xD1E4F38A, 0x2B855524),
+            LIMB_PAIR(0x10593EA9, 0xEB245C9A), LIMB_PAIR(0x5303AE29, 0x8D042891), LIMB_PAIR(0x7BE4EC45, 0xCC86C461), LIMB_PAIR(0xB1A35C03, 0xD05D843B), LIMB_PARTIAL(0x1A0)
+        },
+        {   // 4 * 16^107 * G
+            LIMB_PAIR(0x5A80EEA6, 0x4A3BA7D3), LIMB_PAIR(0x138ED8A4, 0xAFABC45F), LIMB_PAIR(0x08955EB2, 0x8500A36B), LIMB_PAIR(0x17A6C2AF, 0x3D6B2EC6),
+            LIMB_PAIR(0x58D5E66D, 0x23470F59), LIMB_PAIR(0xA1DF0EAC, 0x5DB86555), LIMB_PAIR(0x9974C9BC, 0x3A2E1617), LIMB_PAIR(0xB4DFE2E6, 0x08480D1E), LIMB_PARTIAL(0x1D8),
+            LIMB_PAIR(0xC3DCA584, 0x89EC8A91), LIMB_PAIR(0xF2AAC2BE, 0x6C06D419), LIMB_PAIR(0xA57E58C9, 0x427CEA3C), LIMB_PAIR(0x7B0B1B12, 0x54AE1A69),
+            LIMB_PAIR(0x3965CE2B, 0x40B5C77E), LIMB_PAIR(0x3CE07598, 0x3223C7E5), LIMB_PAIR(0x46948FF6, 0xC2DF8931), LIMB_PAIR(0x55D12AF0, 0xFD997C86), LIMB_PARTIAL(0x155)
+        },
+        {   // 5 * 16^107 * G
+            LIMB_PAIR(0x1BF64AAB, 0x615A13D9), LIMB_PAIR(0xEE125E48, 0xAD0C56A0), LIMB_PAIR(0x2F1AB618, 0x5622DF0D), LIMB_PAIR(0x7E465F36, 0x7331C9B9),
+            LIMB_PAIR(0x5E69238F, 0xE9F79F23), LIMB_PAIR(0x22200715, 0xE71D8ADE), LIMB_PAIR(0xC1111751, 0x0F2C7539), LIMB_PAIR(0xB9287B5E, 0x0A3E1894), LIMB_PARTIAL(0x172),
+            LIMB_PAIR(0x311C0623, 0x20E9E6D2), LIMB_PAIR(0x1CC824F0, 0x2D2EA9D9), LIMB_PAIR(0x344E1B73, 0x4F188539), LIMB_PAIR(0xA32CE555, 0x468983B4),
+            LIMB_PAIR(0xB185EFC3, 0x5A610F7A), LIMB_PAIR(0xDFF9F69B, 0xA65ED115), LIMB_PAIR(0xF79D8BE4, 0x61F20B69), LIMB_PAIR(0x21D50124, 0xA4968021), LIMB_PARTIAL(0x036)
+        },
+        {   // 6 * 16^107 * G
+            LIMB_PAIR(0x1C4E903A, 0xF393BDB4), LIMB_PAIR(0x356E8B65, 0x7C7BE529), LIMB_PAIR(0x5B85085B, 0x17CB86BB), LIMB_PAIR(0x9224B373, 0xDA649381),
+            LIMB_PAIR(0x10832B05, 0x53B88EB8), LIMB_PAIR(0x98C0250A, 0xFC02CB47), LIMB_PAIR(0x0F0221EC, 0xF46C4994), LIMB_PAIR(0xEAC2FFC9, 0x28376E37), LIMB_PARTIAL(0x02D),
+            LIMB_PAIR(0xAFC8827C, 0x2F6C2FF9), LIMB_PAIR(0x17EF8723, 0x12FF0F59), LIMB_PAIR(0x2455917D, 0xAC1AA2D2), LIMB_PAIR(0xF8910F17, 0xAD3764B0),
+            LIMB_PAIR(0x3BDF893D, 0x5D4A355C), LIMB_PAIR(0xEEEE0B8F, 0x7387C7A3), LIMB_PAIR(0x4356038E, 0x9B3E2F88), LIMB_PAIR(0xC75003B5, 0xF4AFFAFD), LIMB_PARTIAL(0x1AA)
+        },
+        {   // 7 * 16^107 * G
+            LIMB_PAIR(0xFC9BE442, 0xD7DE8CD0), LIMB_PAIR(0xC9DDE6A1, 0x0A52E40F), LIMB_PAIR(0x1C7149BC, 0x05A4FF64), LIMB_PAIR(0x5F2F3AA5, 0xCC966D0D),
+            LIMB_PAIR(0x6E2D25CD, 0x5ECE6A19), LIMB_PAIR(0xF6441A77, 0xCD0A1086), LIMB_PAIR(0x85904D79, 0x1C273600), LIMB_PAIR(0xCF8C85AC, 0x44A59F2E), LIMB_PARTIAL(0x0AA),
+            LIMB_PAIR(0xDB6BFCDE, 0x266FA397), LIMB_PAIR(0x8BF6394F, 0xF68D7A36), LIMB_PAIR(0x14A079D4, 0x0D191622), LIMB_PAIR(0x3F93FDE7, 0x3FC59BD3),
+            LIMB_PAIR(0x691C417F, 0x9EDBB13E), LIMB_PAIR(0x4B6D9AA9, 0x50A5045A), LIMB_PAIR(0xA35B9642, 0xF5F738D8), LIMB_PAIR(0x471D4F3C, 0xD0FAB4F3), LIMB_PARTIAL(0x13A)
+        },
+        {   // 8 * 16^107 * G
+            LIMB_PAIR(0xAD5B7E60, 0x85C4BD23), LIMB_PAIR(0xF41A63B8, 0x9A21B0B0), LIMB_PAIR(0x1991539D, 0x368399F1), LIMB_PAIR(0x7B2B3B1A, 0x67F2C921),
+            LIMB_PAIR(0x38B4A267, 0x7DC05133), LIMB_PAIR(0x41104A8F, 0x3EBEE987), LIMB_PAIR(0xF8687167, 0xE73DA9A9), LIMB_PAIR(0x155F4EB5, 0x04B9F294), LIMB_PARTIAL(0x07F),
+            LIMB_PAIR(0x53DCBF7E, 0x1ADB7A14), LIMB_PAIR(0x08B7789E, 0xFBC526AE), LIMB_PAIR(0xA1F9C5CD, 0x004FBF8F), LIMB_PAIR(0x48B46608, 0x7CA3FF9B),
+            LIMB_PAIR(0x83829A47, 0x08A90D30), LIMB_PAIR(0xFE3C66DA, 0x90A442AD), LIMB_PAIR(0x4C69B3FB, 0x36D2D6BD), LIMB_PAIR(0x67675CC3, 0xD5307E6B), LIMB_PARTIAL(0x00A)
+        }
+    },
+#endif
+#if (108 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^108 * G
+            LIMB_PAIR(0xD6E1BD72, 0xA66CCCC8), LIMB_PAIR(0x4AE2FA5C, 0x1EA4E921), LIMB_PAIR(0x2D021FA7, 0x66775AF2), LIMB_PAIR(0x2A4C4677, 0x6D711DFB),
+            LIMB_PAIR(0x5AE380B3, 0xDDAAE8BB), LIMB_PAIR(0x600F11FC, 0x53158994), LIMB_PAIR(0xDA94D443, 0xFEB122DB), LIMB_PAIR(0xDFFC21DD, 0x7CBF1AFA), LIMB_PARTIAL(0x006),
+            LIMB_PAIR(0x834BF891, 0x03CFA731), LIMB_PAIR(0x630B8032, 0x4E016085), LIMB_PAIR(0x49DB4D96, 0x90CF9B59), LIMB_PAIR(0x335C9DDD, 0x96FD2614),
+            LIMB_PAIR(0x8E3B98FB, 0xC0214510), LIMB_PAIR(0x1DA2EA2F, 0x6DED0633), LIMB_PAIR(0x9D0EAD76, 0x2BDA6D76), LIMB_PAIR(0xF3E4FBF2, 0x4BA00E99), LIMB_PARTIAL(0x169)
+        },
+        {   // 2 * 16^108 * G
+            LIMB_PAIR(0xEE70E781, 0x5FBF73AD), LIMB_PAIR(0x67793CF9, 0x29A81E4F), LIMB_PAIR(0x80BF503E, 0xD7E9CCDF), LIMB_PAIR(0xD6EDDA9D, 0x6C06D49C),
+            LIMB_PAIR(0xD96E70F7, 0xC33C7EE6), LIMB_PAIR(0xEF6114B1, 0x30D7D644), LIMB_PAIR(0xAB81AF49, 0x0615B576), LIMB_PAIR(0x5A09A31F, 0x56B8AF44), LIMB_PARTIAL(0x076),
+            LIMB_PAIR(0x75CAC764, 0x32E0B334), LIMB_PAIR(0xDC2D7E31, 0x0B123DA0), LIMB_PAIR(0xD11B58EA, 0x67D72E7A), LIMB_PAIR(0x961098ED, 0x93165A21),
+            LIMB_PAIR(0xDD1D2B8C, 0x4AE95E5A), LIMB_PAIR(0x7EE3715F, 0xC26794A0), LIMB_PAIR(0xCD333782, 0x6887F532), LIMB_PAIR(0xAF37AEDE, 0x67E608D5), LIMB_PARTIAL(0x179)
+        },
+        {   // 3 * 16^108 * G
+            LIMB_PAIR(0x54203519, 0x20E1DBCB), LIMB_PAIR(0x6854FA65, 0x4731F4A6), LIMB_PAIR(0xF769FD0A, 0x79D73800), LIMB_PAIR(0x86246CCE, 0x248F6752),
+            LIMB_PAIR(0x6D04D079, 0xB63DCA39), LIMB_PAIR(0x0FE5DE22, 0xC90D6EB8), LIMB_PAIR(0x0760287E, 0x0BD86EE3), LIMB_PAIR(0x035A202B, 0x1687F7CC), LIMB_PARTIAL(0x073),
+            LIMB_PAIR(0x5D18000D, 0x34FCAD34), LIMB_PAIR(0x9808E5C8, 0x8E27D9D2), LIMB_PAIR(0x5483836F, 0x5A3199E5), LIMB_PAIR(0x62C5CAE8, 0xE786EC7C),
+            LIMB_PAIR(0x82F509DB, 0x22D732EE), LIMB_PAIR(0xB6898EAF, 0xDE5C5E2C), LIMB_PAIR(0x8BB31048, 0x0F051A38), LIMB_PAIR(0xB732B905, 0x69536133), LIMB_PARTIAL(0x003)
+        },
+        {   // 4 * 16^108 * G
+            LIMB_PAIR(0xECFA8831, 0xAC333E4A), LIMB_PAIR(0x8A6D6E93, 0x9D08F6EF), LIMB_PAIR(0xEA97FB6A, 0xF2EED835), LIMB_PAIR(0x070C46F2, 0xDDF44417),
+            LIMB_PAIR(0x37694EA3, 0x1E3159BF), LIMB_PAIR(0x8B7D6A05, 0xB0C4319C), LIMB_PAIR(0x61F314FB, 0x0ABC7572), LIMB_PAIR(0x01A6047E, 0x0057F6C7), LIMB_PARTIAL(0x1E7),
+            LIMB_PAIR(0x6AF8283B, 0x204CB3DD), LIMB_PAIR(0x44AB9EA7, 0x4EEDFA16), LIMB_PAIR(0x93B7D9E5, 0x79F15699), LIMB_PAIR(0xD29DCC8A, 0xAAC8F0C7),
+            LIMB_PAIR(0x4800F5E5, 0xE293FD27), LIMB_PAIR(0xE22DA004, 0x6EC0A739), LIMB_PAIR(0xB903094C, 0x8CBEE62F), LIMB_PAIR(0xA88C3BCE, 0x86DCB1FD), LIMB_PARTIAL(0x1CC)
+        },
+        {   // 5 * 16^108 * G
+            LIMB_PAIR(0x39E84CE3, 0x2373EAEB), LIMB_PAIR(0x0B9EC7B3, 0xBA04CA2E), LIMB_PAIR(0xBD2194BD, 0xE2B50DD2), LIMB_PAIR(0x513F5EB8, 0xC663BB29),
+            LIMB_PAIR(0xB8E768D2, 0x46B010AC), LIMB_PAIR(0x9514B2AE, 0xC8DD6993), LIMB_PAIR(0xAC22E17C, 0xF90F39CA), LIMB_PAIR(0xAC54AF6B, 0xA1420DC6), LIMB_PARTIAL(0x16B),
+            LIMB_PAIR(0x8AF82DBB, 0x60F5772F), LIMB_PAIR(0xF75E8910, 0x7E43A57C), LIMB_PAIR(0x233CEA7B, 0xC53B8A3C), LIMB_PAIR(0x98AF58B7, 0xE43935A7),
+            LIMB_PAIR(0xF772327B, 0xBF5354E9), LIMB_PAIR(0xD8F71CCC, 0xA022B423), LIMB_PAIR(0x8037F9C6, 0x58E76A75), LIMB_PAIR(0x0DD3213E, 0x502B6D11), LIMB_PARTIAL(0x001)
+        },
+        {   // 6 * 16^108 * G
+            LIMB_PAIR(0x02ACD87A, 0xAE8B54D9), LIMB_PAIR(0x621F7759, 0xB4FADA66), LIMB_PAIR(0x20D45BAA, 0xBBD22844), LIMB_PAIR(0x03FA5B60, 0xFFA85046),
+            LIMB_PAIR(0x365BD0A3, 0x1319EE91), LIMB_PAIR(0x140575E6, 0x0AC098DE), LIMB_PAIR(0x59D35E15, 0xF6110984), LIMB_PAIR(0x60C4C232, 0x2AE56DC4), LIMB_PARTIAL(0x1D1),
+            LIMB_PAIR(0xE5CA8913, 0xF0B1A965), LIMB_PAIR(0xBBDCEBAA, 0x1332685C), LIMB_PAIR(0x4BC1D2A7, 0xD1E5D6E8), LIMB_PAIR(0x77A5D9B2, 0x5397B197),
+            LIMB_PAIR(0x0E3ABC64, 0x531B98D7), LIMB_PAIR(0x8EB05CD1, 0x40852921), LIMB_PAIR(0x9BC7332E, 0xB1FF6C73), LIMB_PAIR(0xE26BD5D8, 0x18369F7A), LIMB_PARTIAL(0x18B)
+        },
+        {   // 7 * 16^108 * G
+            LIMB_PAIR(0xB04B2D70, 0x2600BAC3), LIMB_PAIR(0x4CF3F9F9, 0xA595B33F), LIMB_PAIR(0xD99E871D, 0x21660D3E), LIMB_PAIR(0xA9394803, 0xEB5E976D),
+            LIMB_PAIR(0x8A1ED4EF, 0xE205F3CF), LIMB_PAIR(0x81DFBB0C, 0xAA94C332), LIMB_PAIR(0x055BB2D8, 0x00F0CD08), LIMB_PAIR(0x5AFC00FB, 0xAD655248), LIMB_PARTIAL(0x0A2),
+            LIMB_PAIR(0xA2BF8AFB, 0x9B28D5EB), LIMB_PAIR(0x4A8A5D19, 0x2196D770), LIMB_PAIR(0xE884658E, 0x0ABD9B8D), LIMB_PAIR(0x16799F11, 0xADA571E8),
+            LIMB_PAIR(0x87CA21A3, 0xBE86DC57), LIMB_PAIR(0x3FE855DB, 0xAA5680F6), LIMB_PAIR(0x1DB10908, 0x0B830860), LIMB_PAIR(0x8DCEB82A, 0x3ED53BC2), LIMB_PARTIAL(0x0B4)
+        },
+        {   // 8 * 16^108 * G
+            LIMB_PAIR(0x85F45EDD, 0x3A44DDE0), LIMB_PAIR(0x98309156, 0xC543BB64), LIMB_PAIR(0x7597D0D0, 0x82D1CE82), LIMB_PAIR(0x8106CA3E, 0xB2DC0F22),
+            LIMB_PAIR(0x2C3A313A, 0x66F39447), LIMB_PAIR(0xA6CF2E03, 0xD8F6FCDA), LIMB_PAIR(0x9E6BF40B, 0xED6E0E27), LIMB_PAIR(0x5B9A41AF, 0x7DCD3A30), LIMB_PARTIAL(0x095),
+            LIMB_PAIR(0x12BE5B78, 0x0A870CEC), LIMB_PAIR(0x1406E140, 0x912C21C5), LIMB_PAIR(0xD5E13CA1, 0x977417FD), LIMB_PAIR(0xB9E21E28, 0x9EDBAE8A),
+            LIMB_PAIR(0x13B2F069, 0x9FCE45EA), LIMB_PAIR(0x84F3CBF2, 0x25BD760B), LIMB_PAIR(0x2489FD01, 0x29E0C3CE), LIMB_PAIR(0xEC62A766, 0xE16D31C1), LIMB_PARTIAL(0x061)
+        }
+    },
+#endif
+#if (109 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^109 * G
+            LIMB_PAIR(0xEE32E2FF, 0x6985BBD6), LIMB_PAIR(0x3C35A00B, 0xE69F0F22), LIMB_PAIR(0x0EDE3C1B, 0xB1ABB4AE), LIMB_PAIR(0x93D96532, 0xA3D7ECDE),
+            LIMB_PAIR(0x4F693CAB, 0x69EAE259), LIMB_PAIR(0xFE3665F9, 0x52E38B65), LIMB_PAIR(0xF2FA7A85, 0x17664E93), LIMB_PAIR(0xA5300907, 0xE1A2FEBF), LIMB_PARTIAL(0x000),
+            LIMB_PAIR(0xA538774A, 0xBB35EF0C), LIMB_PAIR(0x2B28E6FB, 0xAC9AA3CE), LIMB_PAIR(0x0A801EDB, 0x57E02D06), LIMB_PAIR(0x94847324, 0x69775443),
+            LIMB_PAIR(0x29DD0A3B, 0xB526BB19), LIMB_PAIR(0xC468815F, 0xAED93900), LIMB_PAIR(0x221DF814, 0x3EB1B9B2), LIMB_PAIR(0xD9472DAF, 0xE421E27A), LIMB_PARTIAL(0x0B9)
+        },
+        {   // 2 * 16^109 * G
+            LIMB_PAIR(0xDCC0C55D, 0x823A3093), LIMB_PAIR(0x8667BD82, 0x48E4F42C), LIMB_PAIR(0xDD036949, 0x6483B8AC), LIMB_PAIR(0x154B38E9, 0x0D3F6E52),
+            LIMB_PAIR(0xCB96DB0A, 0x713A6450), LIMB_PAIR(0xAC907250, 0x791EFD97), LIMB_PAIR(0x2130C99C, 0xE491A519), LIMB_PAIR(0x7DF593FD, 0x333277E5), LIMB_PARTIAL(0x0CE),
+            LIMB_PAIR(0xD7D90A84, 0x4DEB4D72), LIMB_PAIR(0xA13778C5, 0x7F39203E), LIMB_PAIR(0x7BB79168, 0x2308CD8A), LIMB_PAIR(0xA710BD28, 0x470CEF35),
+            LIMB_PAIR(0x13BA5C45, 0x6DB6B1A2), LIMB_PAIR(0xE9E55EC1, 0xE35B95DD), LIMB_PAIR(0x7819AF5B, 0x68F023AB), LIMB_PAIR(0x6770441F, 0x50D44989), LIMB_PARTIAL(0x187)
+        },
+        {   // 3 * 16^109 * G
+            LIMB_PAIR(0xC03C8A93, 0xFD2C6BA8), LIMB_PAIR(0x255A51A6, 0x6287BAAE), LIMB_PAIR(0xFC336858, 0x6CDE095E), LIMB_PAIR(0xACB5FB8C, 0x668C6F54),
+            LIMB_PAIR(0x568A5789, 0x26B65582), LIMB_PAIR(0xFCFEB7BA, 0xD51684EF), LIMB_PAIR(0x8DFE63FD, 0xB5D91D3D), LIMB_PAIR(0x560188B9, 0xD366CAE7), LIMB_PARTIAL(0x1C6),
+            LIMB_PAIR(0x9844367E, 0x587D06CC), LIMB_PAIR(0x589D9ACA, 0x527A075F), LIMB_PAIR(0x4F88CCDB, 0xD581AD9F), LIMB_PAIR(0x3A56CA59, 0x3499E807),
+            LIMB_PAIR(0xD6328D96, 0x50B8B14D), LIMB_PAIR(0x5936A744, 0x9B06CE84), LIMB_PAIR(0xE693DA36, 0xAB46F398), LIMB_PAIR(0xBC55F498, 0x4C5E0D9A), LIMB_PARTIAL(0x1E0)
+        },
+        {   // 4 * 16^109 * G
+            LIMB_PAIR(0xE8CF496B, 0x6CDF7285), LIMB_PAIR(0xE1460283, 0xA27BECAE), LIMB_PAIR(0xA8331004, 0x0291E5E3), LIMB_PAIR(0x957E58FC, 0x436D8DEA),
+            LIMB_PAIR(0x8F6A37B3, 0x52ADE576), LIMB_PAIR(0x08CA0BF7, 0x4C31E9EB), LIMB_PAIR(0x547BB960, 0xD918C8A0), LIMB_PAIR(0x4394F6D3, 0x85CEB100), LIMB_PARTIAL(0x07B),
+            LIMB_PAIR(0x62DB1E32, 0xF7961008), LIMB_PAIR(0xC20F8B1E, 0x875FA000), LIMB_PAIR(0xE621E53E, 0xBD4BB865), LIMB_PAIR(0x7235CF42, 0x9346C7C5),
+            LIMB_PAIR(0x92CD8C70, 0x8AE88A56), LIMB_PAIR(0xC68AB6D4, 0x06B82E3A), LIMB_PAIR(0x736A6B71, 0xD0DEA99A), LIMB_PAIR(0x8C6A1235, 0xA54CEAA4), LIMB_PARTIAL(0x12D)
+        },
+        {   // 5 * 16^109 * G
+            LIMB_PAIR(0x89B694F7, 0x14DE1069), LIMB_PAIR(0x453ED74E, 0xFA202A91), LIMB_PAIR(0xB7C462B0, 0x19344093), LIMB_PAIR(0x9D5F7733, 0xDDB9F115),
+            LIMB_PAIR(0x6E71EFCB, 0x6110F1CD), LIMB_PAIR(0xD27D9F95, 0xE9DBC336), LIMB_PAIR(0x1BA3BB66, 0xD9B29E01), LIMB_PAIR(0xA9677CF4, 0x7B218536), LIMB_PARTIAL(0x178),
+            LIMB_PAIR(0x0EAFDB07, 0x7FE68784), LIMB_PAIR(0x1C0D642F, 0xDE335A45), LIMB_PAIR(0x208D5237, 0x11B4B98A), LIMB_PAIR(0x36B0801D, 0x53F2C202),
+            LIMB_PAIR(0x5CDE08E1, 0xF07F2093), LIMB_PAIR(0x0F34078D, 0x5E0E5D3A), LIMB_PAIR(0x80286B22, 0xF1FC7F34), LIMB_PAIR(0xC48E9216, 0x4C305A8B), LIMB_PARTIAL(0x0F4)
+        },
+        {   // 6 * 16^109 * G
+            LIMB_PAIR(0x8294CC29, 0xDB8A02D1), LIMB_PAIR(0x9A9A5709, 0x6ACA02EC), LIMB_PAIR(0xD554C17C, 0xEE2B10E6), LIMB_PAIR(0x81C661CC, 0x29AA1818),
+            LIMB_PAIR(0x1FD10EAE, 0xBE522AF7), LIMB_PAIR(0x2B5589F7, 0x3C4BB524), LIMB_PAIR(0x681236A9, 0x5A5600B1), LIMB_PAIR(0x7F235A88, 0xF7FFD091), LIMB_PARTIAL(0x007),
+            LIMB_PAIR(0x8AD17511, 0xFDFB0926), LIMB_PAIR(0xBA2B0A60, 0xC8964821), LIMB_PAIR(0x33608D96, 0xA6EDC264), LIMB_PAIR(0x18D1B857, 0xD98937DE),
+            LIMB_PAIR(0x85A5A3B9, 0x0FEECAAD), LIMB_PAIR(0x1F102192, 0x567BBB02), LIMB_PAIR(0x441B4A0A, 0x89147837), LIMB_PAIR(0x4E0F3D86, 0xAA471610), LIMB_PARTIAL(0x1B9)
+        },
+        {   // 7 * 16^109 * G
+            LIMB_PAIR(0x814ABC1C, 0xE030FEB9), LIMB_PAIR(0x7387FCFD, 0xAA7EF742), LIMB_PAIR(0x47E5CE93, 0x134E4EA8), LIMB_PAIR(0x2949FFB0, 0xCE9F3CB5),
+            LIMB_PAIR(0x3E11A1C5, 0xA83252A8), LIMB_PAIR(0xBA0F2644, 0x2B308229), LIMB_PAIR(0xEA75A292, 0x1EB76FB7), LIMB_PAIR(0x73CF1481, 0x0D9BD36B), LIMB_PARTIAL(0x021),
+            LIMB_PAIR(0xC50E223B, 0x45BDD68D), LIMB_PAIR(0xA6C0BE76, 0xC6A83635), LIMB_PAIR(0xC0E1F910, 0xAA61EA3F), LIMB_PAIR(0xE8FD27FB, 0x7AD38095),
+            LIMB_PAIR(0x796C8EFE, 0x2DEAA3B2), LIMB_PAIR(0xD099BCDA, 0x9AD0A578), LIMB_PAIR(0x2A953EA1, 0x5819856A), LIMB_PAIR(0x593D3E2D, 0x2B7B7793), LIMB_PARTIAL(0x0DD)
+        },
+        {   // 8 * 16^109 * G
+            LIMB_PAIR(0x470D7E36, 0x88FBC549), LIMB_PAIR(0xE079762F, 0xF091232A), LIMB_PAIR(0x027A4477, 0x8E84CE7E), LIMB_PAIR(0xB704F424, 0x21E570DF),
+            LIMB_PAIR(0xD36FC205, 0x51E89CA1), LIMB_PAIR(0xCB04C0F3, 0x52451D98), LIMB_PAIR(0x9A256B13, 0x4233A356), LIMB_PAIR(0x22636D07, 0x42F33C24), LIMB_PARTIAL(0x186),
+            LIMB_PAIR(0x0445345A, 0x88D6F4D6), LIMB_PAIR(0x0C2FAA71, 0x8B03B9F6), LIMB_PAIR(0xC3BAF6D7, 0xA45AB219), LIMB_PAIR(0xB9BEB6D6, 0x67C7EBA1),
+            LIMB_PAIR(0x9C8FCF22, 0x3EB7BEB9), LIMB_PAIR(0x71D9A1AE, 0xB35DFC43), LIMB_PAIR(0x58436E2F, 0xC1204AF5), LIMB_PAIR(0x8DD710F6, 0x543E4F31), LIMB_PARTIAL(0x096)
+        }
+    },
+#endif
+#if (110 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^110 * G
+            LIMB_PAIR(0x4C7F31F1, 0xA0F946B3), LIMB_PAIR(0x004B810D, 0x122B97EC), LIMB_PAIR(0x831A9CB2, 0x98F876D1), LIMB_PAIR(0xAEBD922B, 0x6690030A),
+            LIMB_PAIR(0xA21B0412, 0x12A235D1), LIMB_PAIR(0xE097208F, 0x5CED8104), LIMB_PAIR(0x49D32FB6, 0x049B33ED), LIMB_PAIR(0x87B187EB, 0x2E88D762), LIMB_PARTIAL(0x07F),
+            LIMB_PAIR(0xAEAAA0D2, 0x08801D4E), LIMB_PAIR(0x6FC2830A, 0x3B052B0A), LIMB_PAIR(0x6FEF40C1, 0x4E02318F), LIMB_PAIR(0x06F38ABB, 0x5A24478A),
+            LIMB_PAIR(0x6DEDD4F3, 0xC90C5392), LIMB_PAIR(0xFF07397B, 0x402E4A9E), LIMB_PAIR(0xF1BDEC37, 0xDE13D7BF), LIMB_PAIR(0x727EB837, 0x8A363CCB), LIMB_PARTIAL(0x14D)
+        },
+        {   // 2 * 16^110 * G
+            LIMB_PAIR(0x1ACCB5D0, 0xA749F266), LIMB_PAIR(0xBCC9460E, 0x8EE12C7E), LIMB_PAIR(0x3D25E73C, 0xF3A52FDF), LIMB_PAIR(0x00C5540F, 0x187BBE71),
+            LIMB_PAIR(0x561BEB89, 0xCDCC3CC1), LIMB_PAIR(0x8EACFCAB, 0xE54DF2B4), LIMB_PAIR(0xCDA02530, 0xBE6D1874), LIMB_PAIR(0xD072A684, 0xBB717F8F), LIMB_PARTIAL(0x0BB),
+            LIMB_PAIR(0x04BD7407, 0x79DE2D65), LIMB_PAIR(0xCCEA6B74, 0xD8AE0921), LIMB_PAIR(0x695DE295, 0x358CF798), LIMB_PAIR(0xB81C02A2, 0x004E73B2),
+            LIMB_PAIR(0x9E6CAEA2, 0xD252441E), LIMB_PAIR(0xAAAF568B, 0x557F228C), LIMB_PAIR(0x357D9E37, 0x6F92EC1D), LIMB_PAIR(0xE91FD306, 0x31EFD9BF), LIMB_PARTIAL(0x0DF)
+        },
+        {   // 3 * 16^110 * G
+            LIMB_PAIR(0x02073B42, 0x9339BCD4), LIMB_PAIR(0x508C4450, 0x464A00B7), LIMB_PAIR(0x46920E8E, 0x682F569B), LIMB_PAIR(0x60F834A4, 0x8A375EA9),
+            LIMB_PAIR(0x4FC9FFA6, 0xCAA2DE7F), LIMB_PAIR(0x7FE428F9, 0xA459885F), LIMB_PAIR(0x7E3615F8, 0x8E021946), LIMB_PAIR(0x96B9672B, 0x5D474ACC), LIMB_PARTIAL(0x009),
+            LIMB_PAIR(0x1CAD08CC, 0x2C82B730), LIMB_PAIR(0x436617AB, 0x6946F74B), LIMB_PAIR(0xD7609D10, 0x504929FD), LIMB_PAIR(0x3A2F7D9E, 0x1B8D9D65),
+            LIMB_PAIR(0xA7334A68, 0x1E950D1A), LIMB_PAIR(0x02579D4A, 0xF54624EC), LIMB_PAIR(0x8ED35507, 0xA140CA97), LIMB_PAIR(0x719B1CCA, 0x57D56BD4), LIMB_PARTIAL(0x17B)
+        },
+        {   // 4 * 16^110 * G
+            LIMB_PAIR(0x94A7EFD8, 0x650E3A26), LIMB_PAIR(0xC739B54F, 0x0E18083D), LIMB_PAIR(0x9367E306, 0x4EF3232E), LIMB_PAIR(0xF0838EDB, 0x2DE3D70C),
+            LIMB_PAIR(0xCA8715D2, 0x1364E843), LIMB_PAIR(0x1C25B1C8, 0x854DCA36), LIMB_PAIR(0xBC117070, 0x73C011BC), LIMB_PAIR(0x051286E9, 0xE83BD36F), LIMB_PARTIAL(0x19B),
+            LIMB_PAIR(0xC0F59BFD, 0xF1226611), LIMB_PAIR(0x4287520C, 0xB910F5B6), LIMB_PAIR(0xFFCDBB02, 0xA408790B), LIMB_PAIR(0x1A0BC553, 0x9D56F34D),
+            LIMB_PAIR(0xCE9A67A7, 0x1530C726), LIMB_PAIR(0xDCE794F5, 0x96F5FA25), LIMB_PAIR(0x077377AA, 0xD5A224C8), LIMB_PAIR(0xD016E05D, 0x2E9D8E98), LIMB_PARTIAL(0x093)
+        },
+        {   // 5 * 16^110 * G
+            LIMB_PAIR(0x80C28BF4, 0xABBA86CF), LIMB_PAIR(0x871CF3FA, 0x9538A468), LIMB_PAIR(0xA1F3F1D1, 0x1E2585F5), LIMB_PAIR(0xF4E26D02, 0xD8B5E352),
+            LIMB_PAIR(0x1D575767, 0x6B0AC27A), LIMB_PAIR(0x67B4036F, 0x5BE4D5D9), LIMB_PAIR(0x02A0F315, 0x9D395B76), LIMB_PAIR(0x35500539, 0x61FD5FE0), LIMB_PARTIAL(0x02E),
+            LIMB_PAIR(0x4BD2A24C, 0xC7BBD9A0), LIMB_PAIR(0x59228721, 0xABD2E4B6), LIMB_PAIR(0x70C8F092, 0xCC7DA00A), LIMB_PAIR(0x851F19B5, 0x4BBDB0C1),
+            LIMB_PAIR(0x733CEE95, 0x983BB01F), LIMB_PAIR(0x0F0A976E, 0x55C1E41E), LIMB_PAIR(0x22B03859, 0x3ED74ECD), LIMB_PAIR(0x581A900D, 0xCB950E0E), LIMB_PARTIAL(0x169)
+        },
+        {   // 6 * 16^110 * G
+            LIMB_PAIR(0xE71BEDEB, 0x3E884116), LIMB_PAIR(0xD8E683D2, 0xC43114F0), LIMB_PAIR(0x709DB235, 0xC65277B4), LIMB_PAIR(0x63401611, 0x135E6233),
+            LIMB_PAIR(0x4CECCD3C, 0x5E6CC4CA), LIMB_PAIR(0xF73E6E64, 0x9D481FA0), LIMB_PAIR(0x5C253AEC, 0xD5223623), LIMB_PAIR(0x91F70B82, 0xD60D8499), LIMB_PARTIAL(0x1C4),
+            LIMB_PAIR(0x632F8EB2, 0x5DB01DD6), LIMB_PAIR(0xA948669B, 0xC4695BBF), LIMB_PAIR(0x7FEF1AC0, 0x143AE756), LIMB_PAIR(0x21487FF3, 0x3958CD3F),
+            LIMB_PAIR(0x7DA2EC59, 0x00C79F33), LIMB_PAIR(0x07F9A8BD, 0xCE54451E), LIMB_PAIR(0x62F7EEA0, 0xFC1017FB), LIMB_PAIR(0x62F0F204, 0x6BB256B4), LIMB_PARTIAL(0x008)
+        },
+        {   // 7 * 16^110 * G
+            LIMB_PAIR(0x5FC08E46, 0x103AE8BB), LIMB_PAIR(0x42569A60, 0xA91E2786), LIMB_PAIR(0xF28AF01E, 0x0BC29EA3), LIMB_PAIR(0x20B341B1, 0xDA612528),
+            LIMB_PAIR(0x388F1E0D, 0x84CA3C31), LIMB_PAIR(0x4DD18EA0, 0xD6DDC0F4), LIMB_PAIR(0x4296A5E6, 0xBFBD8013), LIMB_PAIR(0x88C34065, 0x91F3F3E3), LIMB_PARTIAL(0x1A9),
+            LIMB_PAIR(0xFE14A17D, 0xD7D6DEA4), LIMB_PAIR(0x574EDC98, 0xFFA3FB5B), LIMB_PAIR(0x13730FF8, 0x92012332), LIMB_PAIR(0x42AB408F, 0xADE8B732),
+            LIMB_PAIR(0x4D2FC00D, 0x1BC6FC5B), LIMB_PAIR(0x7179A2E8, 0x70CFE234), LIMB_PAIR(0x3727D19C, 0x77D164A1), LIMB_PAIR(0x60B6C0A0, 0x99CDE7AD), LIMB_PARTIAL(0x032)
+        },
+        {   // 8 * 16^110 * G
+            LIMB_PAIR(0x777A2DD1, 0x3E9A969A), LIMB_PAIR(0xF0B88AA3, 0xA928FCA6), LIMB_PAIR(0x5F56EEC8, 0x7282DE35), LIMB_PAIR(0x076833B3, 0x6FC69CD1),
+            LIMB_PAIR(0x11751566, 0xB082AE04), LIMB_PAIR(0xCEEE94FC, 0x09A31956), LIMB_PAIR(0x158A2CB5, 0x6D3A6221), LIMB_PAIR(0x788752EF, 0xB29C6AE7), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0xBD125523, 0x44EE879A), LIMB_PAIR(0x4E8990B5, 0x8297EAA0), LIMB_PAIR(0xD7723740, 0x9DEEE7C4), LIMB_PAIR(0x9A8BF178, 0x3C603717),
+            LIMB_PAIR(0x1207191F, 0xA851306B), LIMB_PAIR(0xBEBCB461, 0x13EEE334), LIMB_PAIR(0xB8CCE34C, 0xC13D695E), LIMB_PAIR(0x0FF4755B, 0xF3F594A5), LIMB_PARTIAL(0x196)
+        }
+    },
+#endif
+#if (111 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^111 * G
+            LIMB_PAIR(0x8114885D, 0xBF07E90D), LIMB_PAIR(0x9F39A562, 0x76D513B2), LIMB_PAIR(0x7E5446A1, 0xD98AE4F7), LIMB_PAIR(0x6264B6C0, 0x7E3314E9),
+            LIMB_PAIR(0x6F3A7560, 0xE634DEE7), LIMB_PAIR(0xA08D539E, 0x1DFA2392), LIMB_PAIR(0xBDAE3C53, 0x45764812), LIMB_PAIR(0xD824E9AC, 0x858B836F), LIMB_PARTIAL(0x03E),
+            LIMB_PAIR(0xE324EA11, 0x9BDD0365), LIMB_PAIR(0x1117CDC2, 0x9625D01B), LIMB_PAIR(0x7F6C259C, 0x491EA642), LIMB_PAIR(0x125826F0, 0x61B79486),
+            LIMB_PAIR(0x18A56486, 0x573DEBC8), LIMB_PAIR(0x0D31132A, 0xE224DD3B), LIMB_PAIR(0x80BE8263, 0x075C3BF7), LIMB_PAIR(0xB84A07FA, 0x0ECED67A), LIMB_PARTIAL(0x10E)
+        },
+        {   // 2 * 16^111 * G
+            LIMB_PAIR(0x9C4CD8DD, 0x486D3C48), LIMB_PAIR(0xF7E8160B, 0x2CEED6F8), LIMB_PAIR(0xA76FC3C5, 0xFB38315D), LIMB_PAIR(0x7863C459, 0x521AC7BB),
+            LIMB_PAIR(0x576F783D, 0x17252331), LIMB_PAIR(0x3E6D4BCA, 0xF0FCAAF2), LIMB_PAIR(0xE6F8E385, 0x8DB1CFFC), LIMB_PAIR(0x78C49EEB, 0x2E2EF7F4), LIMB_PARTIAL(0x01A),
+            LIMB_PAIR(0xF690D5AA, 0xA3C3C341), LIMB_PAIR(0x41E05923, 0xC14CFFB0), LIMB_PAIR(0xA2C02F22, 0x2C7E4BCB), LIMB_PAIR(0xC38AAFE2, 0x79352516),
+            LIMB_PAIR(0xDAF3E5F9, 0x67BF3709), LIMB_PAIR(0x74D2AAD4, 0xFD7C30A9), LIMB_PAIR(0x8B971591, 0xB4688687), LIMB_PAIR(0xB5F34FD8, 0x7ADF565A), LIMB_PARTIAL(0x132)
+        },
+        {   // 3 * 16^111 * G
+            LIMB_PAIR(0xAFFBD971, 0x82E9010D), LIMB_PAIR(0xC7AC3199, 0xAB6FEA0B), LIMB_PAIR(0x50383D27, 0x8D388940), LIMB_PAIR(0xBE775398, 0xC37AB3B3),
+            LIMB_PAIR(0x54BF74AA, 0x8EF10AF1), LIMB_PAIR(0x52AEAF9B, 0xA1C39ED4), LIMB_PAIR(0x70F42D7A, 0xCD2B6EE6), LIMB_PAIR(0x38A53A34, 0xCB576437), LIMB_PARTIAL(0x087),
+            LIMB_PAIR(0x6F80E03F, 0x5A141699), LIMB_PAIR(0x408678E3, 0x0D7A7AB1), LIMB_PAIR(0x7D279AA8, 0x33DB44D8), LIMB_PAIR(0x32A33193, 0x25E82C90),
+            LIMB_PAIR(0x7FA96201, 0xC68F4373), LIMB_PAIR(0x1C15C8C4, 0x4E2FBE8A), LIMB_PAIR(0x5429A403, 0x5B5CE805), LIMB_PAIR(0xF6543E19, 0x1DC2F304), LIMB_PARTIAL(0x0D0)
+        },
+        {   // 4 * 16^111 * G
+            LIMB_PAIR(0x518C2B4E, 0x074092B0), LIMB_PAIR(0x226849EC, 0x4EFD0358), LIMB_PAIR(0xC8582D0F, 0x384EC468), LIMB_PAIR(0x1B6530EC, 0x6348E93A),
+            LIMB_PAIR(0x86723E53, 0x752F0515), LIMB_PAIR(0x18B6D228, 0xC0124A0A), LIMB_PAIR(0xF16144B5, 0x8E61DB8A), LIMB_PAIR(0xC57AD828, 0xA3B3BCDB), LIMB_PARTIAL(0x096),
+            LIMB_PAIR(0xD5D72677, 0x7B5EAAC0), LIMB_PAIR(0xC826ACDC, 0xC6A4FD2F), LIMB_PAIR(0x83835C84, 0x06F12695), LIMB_PAIR(0x66C70474, 0x287EB118),
+            LIMB_PAIR(0x6FB32F64, 0x824E4C57), LIMB_PAIR(0x3326B6D2, 0x6AAB9048), LIMB_PAIR(0x9DDDF339, 0xEFEF96E4), LIMB_PAIR(0xDF13705D, 0x8E113990), LIMB_PARTIAL(0x0FE)
+        },
+        {   // 5 * 16^111 * G
+            LIMB_PAIR(0x4319C263, 0x75605B03), LIMB_PAIR(0x9E4740E2, 0x887FDFBB), LIMB_PAIR(0xD43F9B89, 0xDE488A31), LIMB_PAIR(0x8E84F79C, 0xB0E69166),
+            LIMB_PAIR(0x70A03015, 0x8AD2CF65), LIMB_PAIR(0x9151CB55, 0x20C0C8A4), LIMB_PAIR(0x0538315F, 0x9C4D5810), LIMB_PAIR(0x12204FA8, 0x18B7EB27), LIMB_PARTIAL(0x1C0),
+            LIMB_PAIR(0xCD3D6255, 0x2701F40C), LIMB_PAIR(0x684DB0FB, 0xB6302374), LIMB_PAIR(0x5986C5A4, 0x1934BD38), LIMB_PAIR(0xAC3EB927, 0x277CA623),
+            LIMB_PAIR(0x3C9260CA, 0x1F8E83F3), LIMB_PAIR(0xCDD488C6, 0x1D42B0B1), LIMB_PAIR(0x02069BED, 0x03DD5062), LIMB_PAIR(0x0713FB4C, 0x1EDF5BE8), LIMB_PARTIAL(0x12D)
+        },
+        {   // 6 * 16^111 * G
+            LIMB_PAIR(0xA4C2A3F0, 0x3FE0ADAC), LIMB_PAIR(0x929E1F33, 0xE8679478), LIMB_PAIR(0x705B8214, 0x4779B883), LIMB_PAIR(0xE23C0CFF, 0x00776735),
+            LIMB_PAIR(0x8F766BD9, 0xF663F815), LIMB_PAIR(0xC30B548A, 0xAAB22B6B), LIMB_PAIR(0xD56597DA, 0x089032B0), LIMB_PAIR(0x51D92E66, 0xD72918F2), LIMB_PARTIAL(0x04C),
+            LIMB_PAIR(0x026CCD7F, 0x152AF75D), LIMB_PAIR(0xDC3E849E, 0x9E12B11D), LIMB_PAIR(0x64244B05, 0x5D6F7B86), LIMB_PAIR(0x1D80629B, 0xBC9C468B),
+            LIMB_PAIR(0xF2F109C9, 0xA14ED1A1), LIMB_PAIR(0xAB8403F8, 0x49E6D42C), LIMB_PAIR(0xE34A6F68, 0xBFE90229), LIMB_PAIR(0x4234D819, 0xECEC8448), LIMB_PARTIAL(0x101)
+        },
+        {   // 7 * 16^111 * G
+            LIMB_PAIR(0xAFA6274E, 0x8C466EC6), LIMB_PAIR(0xE57D9338, 0x935AC8E6), LIMB_PAIR(0x7B5CA188, 0x3FFE008E), LIMB_PAIR(0xDFBB530A, 0xFFD8BA41),
+            LIMB_PAIR(0x67D0B3E8, 0x9504DBC0), LIMB_PAIR(0x622F0B00, 0x95EBDE8C), LIMB_PAIR(0x209C6309, 0x984BC63C), LIMB_PAIR(0x6B23D9DB, 0xB2BDAF4A), LIMB_PARTIAL(0x1F8),
+            LIMB_PAIR(0x0E2BB6E9, 0x24836324), LIMB_PAIR(0x65CC3116, 0xCEF90F5C), LIMB_PAIR(0x16BBF8DD, 0x4C71C808), LIMB_PAIR(0x8DE8D626, 0x0D6CCBC3),
+            LIMB_PAIR(0x60C000D7, 0x6E51FC29), LIMB_PAIR(0xDFFF70D3, 0x1E3116E3), LIMB_PAIR(0xDD570C6E, 0xF3D91182), LIMB_PAIR(0x6827D006, 0xF02FBB1B), LIMB_PARTIAL(0x191)
+        },
+        {   // 8 * 16^111 * G
+            LIMB_PAIR(0x63840645, 0x560ED5E2), LIMB_PAIR(0xB99FFE18, 0xAC6C9D02), LIMB_PAIR(0xBF7B7FE0, 0x0510A7B7), LIMB_PAIR(0x56AEC190, 0xE1DC1083),
+            LIMB_PAIR(0x27581115, 0x29B4AD95), LIMB_PAIR(0x26A12461, 0xA8021A60), LIMB_PAIR(0x45144AA0, 0xFBBCCEE8), LIMB_PAIR(0xDED40B1C, 0x2C93CED8), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0xF3FB0D14, 0x2C841A6E), LIMB_PAIR(0xB1F67B7C, 0xE8B8B8EC), LIMB_PAIR(0x19E26083, 0xBD4C9A22), LIMB_PAIR(0xC1C6A093, 0xECE8DC33),
+            LIMB_PAIR(0x948AEAE7, 0xFB47210F), LIMB_PAIR(0x1569C5FC, 0x98A8B021), LIMB_PAIR(0x399C9D0E, 0xC92CB9C7), LIMB_PAIR(0xB0F6F23A, 0xDAA97144), LIMB_PARTIAL(0x145)
+        }
+    },
+#endif
+#if (112 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^112 * G
+            LIMB_PAIR(0x8F69079E, 0x6D7EEDC4), LIMB_PAIR(0x4F03B92F, 0xF02E8E40), LIMB_PAIR(0xCB76B181, 0xDF751116), LIMB_PAIR(0x234C1925, 0xC255EB2C),
+            LIMB_PAIR(0xA94AF9B2, 0xAF997D5E), LIMB_PAIR(0xD1374A41, 0x797F3DF0), LIMB_PAIR(0x23986CDA, 0x357FD20B), LIMB_PAIR(0x1540ADB8, 0xF1CACCDA), LIMB_PARTIAL(0x07D),
+            LIMB_PAIR(0xC01605A9, 0x2A04363C), LIMB_PAIR(0x7D7D1E54, 0x0D7CC0D8), LIMB_PAIR(0xA0F9FD2B, 0x0515EB70), LIMB_PAIR(0xBB4EC5E8, 0x725D12A9),
+            LIMB_PAIR(0x3A6EB09A, 0xD1B5B8A3), LIMB_PAIR(0x87027D7B, 0xB6C836B1), LIMB_PAIR(0xAAF9CD03, 0xF4773322), LIMB_PAIR(0x2500C647, 0x2FB3354E), LIMB_PARTIAL(0x081)
+        },
+        {   // 2 * 16^112 * G
+            LIMB_PAIR(0x41750B74, 0x83DA529B), LIMB_PAIR(0x76E28BF5, 0x9E431A5C), LIMB_PAIR(0x7FDE2491, 0x225E2EB9), LIMB_PAIR(0xE7C469BC, 0x951E2CED),
+            LIMB_PAIR(0xF0E10C32, 0x35F384CA), LIMB_PAIR(0x2B1AADBC, 0xB8ED4A31), LIMB_PAIR(0x7B797492, 0xD39393BA), LIMB_PAIR(0x47597F4B, 0xC82685F8), LIMB_PARTIAL(0x0C9),
+            LIMB_PAIR(0x436E2563, 0xB04E1261), LIMB_PAIR(0x2DE3E4E7, 0xDC3E8305), LIMB_PAIR(0xEE3DBBF4, 0xA32102BD), LIMB_PAIR(0x45F15EFB, 0xDFB53789),
+            LIMB_PAIR(0x6246965E, 0x34904B0B), LIMB_PAIR(0xAAC06CA8, 0xCD645C46), LIMB_PAIR(0x358398F3, 0xD4E3F322), LIMB_PAIR(0xA54F3311, 0xAEBFE7C7), LIMB_PARTIAL(0x1F3)
+        },
+        {   // 3 * 16^112 * G
+            LIMB_PAIR(0xF2AFAE47, 0xFF2FA49C), LIMB_PAIR(0xF9F2B257, 0xA2C86068), LIMB_PAIR(0x46CB76EE, 0x73DD56A4), LIMB_PAIR(0x7DC0A64C, 0xBFFB9F01),
+            LIMB_PAIR(0x44B4A4EE, 0x0EE2B60D), LIMB_PAIR(0x37C5959F, 0x49939F08), LIMB_PAIR(0x78603DE3, 0xB302FCD1), LIMB_PAIR(0x4017C122, 0x03C2A220), LIMB_PARTIAL(0x0A7),
+            LIMB_PAIR(0x57413107, 0x48ACDA97), LIMB_PAIR(0x4C01CAF8, 0xBD8F584D), LIMB_PAIR(0x1AC29755, 0x38F448A7), LIMB_PAIR(0x6D29BF3E, 0xCC388483),
+            LIMB_PAIR(0x74401FED, 0x15C4BAF9), LIMB_PAIR(0x9023BC05, 0x7826E5CD), LIMB_PAIR(0x4F459413, 0xC7A70D09), LIMB_PAIR(0x31896429, 0x1DE803C6), LIMB_PARTIAL(0x0B8)
+        },
+        {   // 4 * 16^112 * G
+            LIMB_PAIR(0xCEF34144, 0xABB0D91D), LIMB_PAIR(0x42B2A8BB, 0xBC5903FA), LIMB_PAIR(0x38E4C5FA, 0xE279EF56), LIMB_PAIR(0x6D5B04EB, 0xB3416E9E),
+            LIMB_PAIR(0x7BB923CE, 0x44781918), LIMB_PAIR(0x2914A3A4, 0x58FEFA21), LIMB_PAIR(0xE2C19F36, 0xB0456B2E), LIMB_PAIR(0xE92C1E50, 0x176361BB), LIMB_PARTIAL(0x0B3),
+            LIMB_PAIR(0x824FDE34, 0xBC56A1AF), LIMB_PAIR(0x098A50FC, 0x33BFBFB3), LIMB_PAIR(0xAB9CFA73, 0x6E720F55), LIMB_PAIR(0x08E4DFA2, 0xF1E104B9),
+            LIMB_PAIR(0x77865B2F, 0xB96B8ABD), LIMB_PAIR(0xA36740D1, 0x69EB257A), LIMB_PAIR(0x26A50F43, 0xD73B946D), LIMB_PAIR(0x70CD91E7, 0x588E4A14), LIMB_PARTIAL(0x07A)
+        },
+        {   // 5 * 16^112 * G
+            LIMB_PAIR(0x13DC8B45, 0xD1DA41A1), LIMB_PAIR(0x8A639B8D, 0xF4886D24), LIMB_PAIR(0xDEF9C5C3, 0xF3431CCE), LIMB_PAIR(0x8C204A2F, 0xAE07317D),
+            LIMB_PAIR(0xF3D6383A, 0xCBBD49A1), LIMB_PAIR(0x29BBE61E, 0x43D35932), LIMB_PAIR(0x9643A1A8, 0x6BFA0609), LIMB_PAIR(0x2005A71F, 0x391499B2), LIMB_PARTIAL(0x188),
+            LIMB_PAIR(0x79D0771B, 0x40774A7E), LIMB_PAIR(0x595038A1, 0x31987151), LIMB_PAIR(0xC48B5063, 0xFF6DF557), LIMB_PAIR(0xC3751769, 0x26C03269),
+            LIMB_PAIR(0xD2D0CE99, 0x660C36CE), LIMB_PAIR(0xD3D79EA0, 0x71378E21), LIMB_PAIR(0x30BE88EA, 0x7B2EC7EA), LIMB_PAIR(0xEAED0F73, 0x1B342D41), LIMB_PARTIAL(0x16D)
+        },
+        {   // 6 * 16^112 * G
+            LIMB_PAIR(0xE2C08642, 0x0F1B2A0E), LIMB_PAIR(0x19FBFFF6, 0xC1102275), LIMB_PAIR(0x04574825, 0x3E491421), LIMB_PAIR(0x99552FDF, 0x058232D5),
+            LIMB_PAIR(0x0E083797, 0xA83F1A2F), LIMB_PAIR(0x860ACBCD, 0x7C387D90), LIMB_PAIR(0xD59D4FFE, 0x7D8440D7), LIMB_PAIR(0x78F12D73, 0x45111FC7), LIMB_PARTIAL(0x0A5),
+            LIMB_PAIR(0x28E9B450, 0x77ACF98E), LIMB_PAIR(0xA8129A6E, 0x0823B735), LIMB_PAIR(0x8D1F0EF3, 0x1ABAA0F9), LIMB_PAIR(0xDEC36172, 0xC2FB1108),
+            LIMB_PAIR(0x855585E0, 0x4D486FD4), LIMB_PAIR(0x9D440B52, 0x27D00254), LIMB_PAIR(0x5B964BAC, 0xC2B55613), LIMB_PAIR(0xA29F6FDE, 0x251AD413), LIMB_PARTIAL(0x142)
+        },
+        {   // 7 * 16^112 * G
+            LIMB_PAIR(0xE138D37E, 0x47DE9D47), LIMB_PAIR(0x3E7E1C87, 0x7387F369), LIMB_PAIR(0x0A48AF71, 0x9C00813E), LIMB_PAIR(0xE8829FCD, 0x9DF47C63),
+            LIMB_PAIR(0x19E24A68, 0x7DC7C048), LIMB_PAIR(0x6942E130, 0x3D1823E1), LIMB_PAIR(0xA2CD6199, 0x2F4440FF), LIMB_PAIR(0x98168AA8, 0xEBF60BE0), LIMB_PARTIAL(0x049),
+            LIMB_PAIR(0x3B5F346C, 0x98969007), LIMB_PAIR(0xB79AE683, 0x00A0ECF9), LIMB_PAIR(0xF8FB676F, 0x1B6F0DDB), LIMB_PAIR(0x7998C836, 0xD536D371),
+            LIMB_PAIR(0x9C4BC7CD, 0xE1DBDA54), LIMB_PAIR(0x71E12239, 0x2B752CA3), LIMB_PAIR(0xC296C03D, 0xD633D0EE), LIMB_PAIR(0x9F6A0015, 0x548B37C5), LIMB_PARTIAL(0x03F)
+        },
+        {   // 8 * 16^112 * G
+            LIMB_PAIR(0x6ED0892B, 0x6ED1BBB7), LIMB_PAIR(0xB788BEF7, 0x4921306B), LIMB_PAIR(0xBF3CDBDB, 0x7200D473), LIMB_PAIR(0xEEFDCE6C, 0xF1CB448F),
+            LIMB_PAIR(0x836591B0, 0x199B07A2), LIMB_PAIR(0x48FC6659, 0x804FF009), LIMB_PAIR(0x3B8F405A, 0x69760059), LIMB_PAIR(0x9EF63732, 0x14755BE5), LIMB_PARTIAL(0x103),
+            LIMB_PAIR(0x23383B1A, 0xD0A6D1B3), LIMB_PAIR(0xAE42CA1E, 0x50C7E33B), LIMB_PAIR(0x2563BD12, 0x564B4655), LIMB_PAIR(0xFE7BAF1E, 0x48640D21),
+            LIMB_PAIR(0xF7717825, 0x6A0B495E), LIMB_PAIR(0xC7DF9FC0, 0x9E4AD9AE), LIMB_PAIR(0xE038E19E, 0x4CEEA6A6), LIMB_PAIR(0x010887DE, 0xEA0E3BF8), LIMB_PARTIAL(0x1DD)
+        }
+    },
+#endif
+#if (113 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^113 * G
+            LIMB_PAIR(0x6EA09A93, 0xD7C0EFA3), LIMB_PAIR(0xFB01C2B3, 0x95F69E09), LIMB_PAIR(0xD43150E2, 0x021B1721), LIMB_PAIR(0x5879BC51, 0x39FF07E0),
+            LIMB_PAIR(0x6CF50CE3, 0x0DD73C32), LIMB_PAIR(0x5758870F, 0x9D69D32A), LIMB_PAIR(0x1C0E91D9, 0x5DF4CC8C), LIMB_PAIR(0x15DF54AB, 0x00335088), LIMB_PARTIAL(0x182),
+            LIMB_PAIR(0xF2DC12F5, 0xBB656A89), LIMB_PAIR(0x5C46FCF4, 0x6C4A32BB), LIMB_PAIR(0x70E7A152, 0xF324462C), LIMB_PAIR(0x1F7EAAD2, 0x4B1D509A),
+            LIMB_PAIR(0x76E51583, 0x3DA87FA7), LIMB_PAIR(0x19FC86CC, 0x9A435E20), LIMB_PAIR(0x9EAB8DE3, 0xB97D3F44), LIMB_PAIR(0x8F92304B, 0xC56C7C98), LIMB_PARTIAL(0x0A8)
+        },
+        {   // 2 * 16^113 * G
+            LIMB_PAIR(0x9B09AC83, 0x30B495FF), LIMB_PAIR(0x05D9C9EB, 0x7767E8A1), LIMB_PAIR(0x1690A79E, 0xB15ECB0A), LIMB_PAIR(0x1B301763, 0xA7B87CCE),
+            LIMB_PAIR(0xF28B14D2, 0xC6849DEA), LIMB_PAIR(0x5E5C94F2, 0x16D0B158), LIMB_PAIR(0x1AEE3CA8, 0xBFDA4524), LIMB_PAIR(0x5D737C3E, 0xE5296163), LIMB_PARTIAL(0x1F1),
+            LIMB_PAIR(0x589B8AE6, 0x339F76CC), LIMB_PAIR(0xE02EA428, 0xA133954A), LIMB_PAIR(0x980481AC, 0xF11E77F7), LIMB_PAIR(0x87596275, 0x890C3C2C),
+            LIMB_PAIR(0x80B79BF7, 0xE0CFDACE), LIMB_PAIR(0xA3E3906B, 0x0031DB26), LIMB_PAIR(0xA1C31197, 0xEDF2E3DD), LIMB_PAIR(0x2BC3F1A4, 0x888F1219), LIMB_PARTIAL(0x06F)
+        },
+        {   // 3 * 16^113 * G
+            LIMB_PAIR(0xDC831AC0, 0xBA0A5D23), LIMB_PAIR(0xBD41CFA5, 0xCF0FE6FC), LIMB_PAIR(0xADEE7925, 0x11D490D3), LIMB_PAIR(0x491D988A, 0xA8C359FC),
+            LIMB_PAIR(0x3FF98345, 0xB97A48A5), LIMB_PAIR(0x1B8BB845, 0x6C8AC5F2), LIMB_PAIR(0x5F157746, 0xA9C9F2A8), LIMB_PAIR(0xCF6AD9A4, 0x79125887), LIMB_PARTIAL(0x1AA),
+            LIMB_PAIR(0xE8469532, 0x3DC5DB89), LIMB_PAIR(0x639DF36B, 0xA9610220), LIMB_PAIR(0x828BABAB, 0x5806F730), LIMB_PAIR(0x60EF0FBE, 0x5AD5E58F),
+            LIMB_PAIR(0xAAD0A654, 0xBCDFE863), LIMB_PAIR(0x34F936DA, 0x818CDC61), LIMB_PAIR(0xD47DD376, 0x3B6839B4), LIMB_PAIR(0xBE99035F, 0x80DB0098), LIMB_PARTIAL(0x02A)
+        },
+        {   // 4 * 16^113 * G
+            LIMB_PAIR(0xAF579E74, 0x394CDAF5), LIMB_PAIR(0x9F0656A6, 0x892CB483), LIMB_PAIR(0x3E8E1495, 0x0ECD401F), LIMB_PAIR(0x4CAF97C0, 0x655F0152),
+            LIMB_PAIR(0x81912568, 0x9712D158), LIMB_PAIR(0x89DBDB52, 0xD16E997A), LIMB_PAIR(0x1A8C4097, 0xEEC17A55), LIMB_PAIR(0x322BBB31, 0xBC19E865), LIMB_PARTIAL(0x03D),
+            LIMB_PAIR(0x7CFB9654, 0x6B181FB6), LIMB_PAIR(0x2D651201, 0x3AFDCA35), LIMB_PAIR(0x61453278, 0x19D26AF4), LIMB_PAIR(0x3EBEAF7E, 0xEBA73D69),
+            LIMB_PAIR(0x1832E1E3, 0x39F7171E), LIMB_PAIR(0x31A9F559, 0x84B46C0E), LIMB_PAIR(0xD89DB3C3, 0xAEA096CD), LIMB_PAIR(0x6C409761, 0x193C91E7), LIMB_PARTIAL(0x1FD)
+        },
+        {   // 5 * 16^113 * G
+            LIMB_PAIR(0x43FD6EA9, 0xE0D1A684), LIMB_PAIR(0x4B132B1C, 0x3C786285), LIMB_PAIR(0xE1183223, 0xE70C8B50), LIMB_PAIR(0x67064358, 0xAF7CE546),
+            LIMB_PAIR(0x20FB8E29, 0xF14E5473), LIMB_PAIR(0xAEB37723, 0xD26E97D6), LIMB_PAIR(0x357A9627, 0x1B6CFAED), LIMB_PAIR(0x7D572C73, 0x86CBFA6C), LIMB_PARTIAL(0x127),
+            LIMB_PAIR(0x615A655A, 0x41863BAA), LIMB_PAIR(0xC0B8C8B5, 0xA1E46018), LIMB_PAIR(0x1848E283, 0x91F9506A), LIMB_PAIR(0x24F30ED9, 0x86311713),
+            LIMB_PAIR(0x73FF5192, 0x0E29095F), LIMB_PAIR(0xA154AE3E, 0x7D174A6D), LIMB_PAIR(0x56F418FF, 0x6D82FCA2), LIMB_PAIR(0x6758E6DE, 0x169D74DE), LIMB_PARTIAL(0x025)
+        },
+        {   // 6 * 16^113 * G
+            LIMB_PAIR(0x7FE215DA, 0x32781385), LIMB_PAIR(0x3B7CAFE7, 0x7375D6F0), LIMB_PAIR(0x72CB61C5, 0xBB8B7A96), LIMB_PAIR(0x1F240B9E, 0xCB2EB8DC),
+            LIMB_PAIR(0xF9E57F19, 0xBA8E3561), LIMB_PAIR(0xA8775D3E, 0x4598E545), LIMB_PAIR(0x795F431E, 0x766AF205), LIMB_PAIR(0x392B223C, 0x29EECA78), LIMB_PARTIAL(0x186),
+            LIMB_PAIR(0xAD908BFA, 0x10F6A1B2), LIMB_PAIR(0x4237E6C3, 0x705580FE), LIMB_PAIR(0x136800F8, 0xA2FCFE9E), LIMB_PAIR(0x0B7BDC9E, 0x4ADBEBD2),
+            LIMB_PAIR(0x6D1A3870, 0x4DF50D52), LIMB_PAIR(0xEADA6F88, 0xD4B714FB), LIMB_PAIR(0xDF56DD84, 0x39F59383), LIMB_PAIR(0x8EAB9BFD, 0x7C802A7F), LIMB_PARTIAL(0x15F)
+        },
+        {   // 7 * 16^113 * G
+            LIMB_PAIR(0x9421BA81, 0x9F890CFD), LIMB_PAIR(0xEB89C503, 0x170442E3), LIMB_PAIR(0x0F6BB510, 0xB9A7CCFF), LIMB_PAIR(0xCAC864BC, 0xE381C120),
+            LIMB_PAIR(0xDECBAF8C, 0x2DBE97AD), LIMB_PAIR(0xD26D2BB5, 0x635D5914), LIMB_PAIR(0xEDCF3B9B, 0xE101D55E), LIMB_PAIR(0xB30B7B2D, 0x80BE6609), LIMB_PARTIAL(0x008),
+            LIMB_PAIR(0x11095C14, 0x89D01827), LIMB_PAIR(0xFCABD0F0, 0xC1A8BC5E), LIMB_PAIR(0x54AFA2FD, 0x3208EB50), LIMB_PAIR(0xDF626743, 0xF8A273C7),
+            LIMB_PAIR(0x3F970409, 0x5E12751A), LIMB_PAIR(0xFBE47F1D, 0x4EA70FC5), LIMB_PAIR(0x5D85D582, 0xB03CEFDB), LIMB_PAIR(0x92740E84, 0x31B9A796), LIMB_PARTIAL(0x090)
+        },
+        {   // 8 * 16^113 * G
+            LIMB_PAIR(0xC56CAAE5, 0xFB24C5B4), LIMB_PAIR(0x71A1A7F6, 0x3855473B), LIMB_PAIR(0x0CF6FF1D, 0x225A7937), LIMB_PAIR(0xB5ACE9E5, 0x3CDB0634),
+            LIMB_PAIR(0x26B6384F, 0x46DE798D), LIMB_PAIR(0xEBC11704, 0xF1EDE134), LIMB_PAIR(0x554519F9, 0xE80E4E37), LIMB_PAIR(0x6349EEBF, 0x812E76DB), LIMB_PARTIAL(0x179),
+            LIMB_PAIR(0x3B354956, 0xB0B69F32), LIMB_PAIR(0xFC0D2A5D, 0x27C782EC), LIMB_PAIR(0xA0DFF80F, 0x2BB2EBEF), LIMB_PAIR(0x2C887AC2, 0xAE8E5826),
+            LIMB_PAIR(0x0CA3BF38, 0x2E488617), LIMB_PAIR(0x34C9E517, 0x77B1B7B4), LIMB_PAIR(0xDB708DE3, 0x5D42CA18), LIMB_PAIR(0x4305EAC5, 0xC1B0482A), LIMB_PARTIAL(0x091)
+        }
+    },
+#endif
+#if (114 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^114 * G
+            LIMB_PAIR(0xD6A37BAB, 0x4331CDCD), LIMB_PAIR(0x85C741C8, 0x67B89137), LIMB_PAIR(0x4FC72389, 0xAEFFCBDB), LIMB_PAIR(0x1C7AE6DD, 0xCC12E59A),
+            LIMB_PAIR(0xEE1E838B, 0x4A35540B), LIMB_PAIR(0xECD3E84D, 0x6148FB60), LIMB_PAIR(0xB2290730, 0x7319E868), LIMB_PAIR(0x4DE5208B, 0x4321BAAE), LIMB_PARTIAL(0x160),
+            LIMB_PAIR(0x87717BB9, 0x10C813E9), LIMB_PAIR(0xCFB9252A, 0xD9E1F5A8), LIMB_PAIR(0xD7BDE47C, 0x0983C1F7), LIMB_PAIR(0x5474E52D, 0x7446023B),
+            LIMB_PAIR(0x1941B518, 0x1F189DE8), LIMB_PAIR(0xB425810A, 0x1997C69B), LIMB_PAIR(0x58BCA332, 0xE15B5F1E), LIMB_PAIR(0x49092985, 0x715DA4C9), LIMB_PARTIAL(0x076)
+        },
+        {   // 2 * 16^114 * G
+            LIMB_PAIR(0x7600C9F1, 0x3E592753), LIMB_PAIR(0xE4653ACA, 0x115DA68A), LIMB_PAIR(0xA21C03B3, 0xA83D3CDE), LIMB_PAIR(0x80477C90, 0x58215157),
+            LIMB_PAIR(0xC43DF921, 0x876E0150), LIMB_PAIR(0x410801F2, 0x176767D6), LIMB_PAIR(0xB0B638ED, 0x95E1B6C9), LIMB_PAIR(0x979E84C6, 0xCDA8E401), LIMB_PARTIAL(0x01E),
+            LIMB_PAIR(0x85CB274F, 0x5500C69C), LIMB_PAIR(0xDE004D59, 0x5F2D975B), LIMB_PAIR(0xA005B4DE, 0xCD545D2A), LIMB_PAIR(0x4E3B1B94, 0x4D3D02AE),
+            LIMB_PAIR(0xB8EC522B, 0x53E64CCD), LIMB_PAIR(0x12EFBB9E, 0xACC3386F), LIMB_PAIR(0x1CBD540F, 0xC8F529C2), LIMB_PAIR(0x2F854A91, 0x8428942D), LIMB_PARTIAL(0x182)
+        },
+        {   // 3 * 16^114 * G
+            LIMB_PAIR(0x33430EDB, 0x2CDA3987), LIMB_PAIR(0xEE487EB9, 0x7F0593F8), LIMB_PAIR(0xD8765895, 0xE458E275), LIMB_PAIR(0x11BE3DF5, 0x45C2E093),
+            LIMB_PAIR(0x51450F54, 0x32545B1E), LIMB_PAIR(0x49D52CFA, 0xF35BC1EE), LIMB_PAIR(0xDA91CEC2, 0x59B8B719), LIMB_PAIR(0xAB7FE631, 0x4426171B), LIMB_PARTIAL(0x135),
+            LIMB_PAIR(0xE00A5618, 0x17C4E11C), LIMB_PAIR(0xFE8BE941, 0x7A6FF5B1), LIMB_PAIR(0x2C90C5D3, 0x72E91C8C), LIMB_PAIR(0x80CFDF98, 0x9F450879),
+            LIMB_PAIR(0x06CE62FB, 0xB0D5D0D1), LIMB_PAIR(0x57FA7188, 0xD9DEB715), LIMB_PAIR(0xAC85D50B, 0xF1D09702), LIMB_PAIR(0xA170E75E, 0x65AB22B5), LIMB_PARTIAL(0x18C)
+        },
+        {   // 4 * 16^114 * G
+            LIMB_PAIR(0x0BEC2201, 0x92C099D2), LIMB_PAIR(0xB67FF463, 0x364FA15A), LIMB_PAIR(0xB02F7E0B, 0xFB32FFD0), LIMB_PAIR(0x9D4C9F2A, 0x5B57F993),
+            LIMB_PAIR(0x4996B151, 0xBA5F437E), LIMB_PAIR(0x431462E9, 0x961BD5FC), LIMB_PAIR(0xDCD39411, 0x1FDA019F), LIMB_PAIR(0xCCDFBE62, 0x8FF5288E), LIMB_PARTIAL(0x0DD),
+            LIMB_PAIR(0x8EF349AC, 0x43F49A31), LIMB_PAIR(0x301BAE8F, 0xE4F5A626), LIMB_PAIR(0xD2681847, 0x945E6A62), LIMB_PAIR(0x857C09BE, 0x8EF66B51),
+            LIMB_PAIR(0x3F15435D, 0xDAFF6474), LIMB_PAIR(0x3DB84E5D, 0x215793CD), LIMB_PAIR(0xAB1BB6C2, 0xB2044D4B), LIMB_PAIR(0x580855CE, 0x4C7AC000), LIMB_PARTIAL(0x1B8)
+        },
+        {   // 5 * 16^114 * G
+            LIMB_PAIR(0xC2A1B7ED, 0x52BEA9DB), LIMB_PAIR(0xE0D786E2, 0x7844CD85), LIMB_PAIR(0x4D565A2E, 0x17168D7A), LIMB_PAIR(0x155AFFB4, 0x1213C72B),
+            LIMB_PAIR(0x606A308E, 0x26A4857D), LIMB_PAIR(0xB55B0018, 0x6F0560D6), LIMB_PAIR(0x74E1B9CD, 0x7C8549E8), LIMB_PAIR(0x9DEEEC3D, 0x322BA062), LIMB_PARTIAL(0x1CF),
+            LIMB_PAIR(0xF59FD1D3, 0x0A7016B8), LIMB_PAIR(0xAEEBDF96, 0xA81CE2F8), LIMB_PAIR(0x0F7E145A, 0x3AC89A8A), LIMB_PAIR(0x70351907, 0x3FE8A38D),
+            LIMB_PAIR(0xBF10697A, 0xA636FD48), LIMB_PAIR(0x7F93878C, 0x4C0F860D), LIMB_PAIR(0x957D25E3, 0x546E63F5), LIMB_PAIR(0x1DF8262A, 0x1FD01E4A), LIMB_PARTIAL(0x1BA)
+        },
+        {   // 6 * 16^114 * G
+            LIMB_PAIR(0xC64F9C9B, 0x37E766A6), LIMB_PAIR(0x16C4CE5A, 0x6CF5E0B6), LIMB_PAIR(0x7BBE708E, 0x31A2B1E2), LIMB_PAIR(0x91E24F0F, 0xF784A552),
+            LIMB_PAIR(0x1FD25709, 0x1CDF807A), LIMB_PAIR(0x70CED72F, 0x2669D802), LIMB_PAIR(0xD49751DF, 0x79E4492D), LIMB_PAIR(0x7E7F3162, 0x7FE014D8), LIMB_PARTIAL(0x0B4),
+            LIMB_PAIR(0xADA43F51, 0xE0A2BE33), LIMB_PAIR(0x45F6E16C, 0xBC883569), LIMB_PAIR(0xC5873251, 0xB3D2248E), LIMB_PAIR(0xE3F9B61F, 0xD1118266),
+            LIMB_PAIR(0xF6D1DD12, 0xC427E30B), LIMB_PAIR(0x0D8313A1, 0x43F0925B), LIMB_PAIR(0x39EDF59D, 0x729DFE2A), LIMB_PAIR(0xFF4B7293, 0x7189F5A4), LIMB_PARTIAL(0x0B1)
+        },
+        {   // 7 * 16^114 * G
+            LIMB_PAIR(0x8F3110B8, 0xE4EA02CF), LIMB_PAIR(0xDE50A1E9, 0xFED60231), LIMB_PAIR(0x0A8FE01A, 0x62BDA5E8), LIMB_PAIR(0xADE31339, 0x882F5313),
+            LIMB_PAIR(0x26F12837, 0x30102CB9), LIMB_PAIR(0xC1851E44, 0xBBFCD761), LIMB_PAIR(0x073B2AE5, 0x6E1C5D2B), LIMB_PAIR(0x357AD561, 0x1542324C), LIMB_PARTIAL(0x0FA),
+            LIMB_PAIR(0xC37D1A01, 0xA8EAC464), LIMB_PAIR(0xAEEDD902, 0x8E5B465D), LIMB_PAIR(0xFDAF7257, 0x7F7B68F5), LIMB_PAIR(0xB4BADB28, 0xD88A2CF6),
+            LIMB_PAIR(0xE4102B12, 0xE0DFDE89), LIMB_PAIR(0xAB851C47, 0x9ED8DAB7), LIMB_PAIR(0xB4865D1E, 0xBB44BD5D), LIMB_PAIR(0x7F2F666A, 0x0C6D69D5), LIMB_PARTIAL(0x04B)
+        },
+        {   // 8 * 16^114 * G
+            LIMB_PAIR(0x7A2AE93E, 0x9FB0A0D2), LIMB_PAIR(0x14D3224A, 0x89C9DFA3), LIMB_PAIR(0x1EC1EA92, 0xE70F39EF), LIMB_PAIR(0xAD2DFD78, 0x8C7C0024),
+            LIMB_PAIR(0x3C5B7C09, 0xC285ED1C), LIMB_PAIR(0x1FB27511, 0xCE6436D1), LIMB_PAIR(0xE3D07577, 0x65F427AD), LIMB_PAIR(0x6827554F, 0x22AE30D2), LIMB_PARTIAL(0x1DB),
+            LIMB_PAIR(0xFE772F97, 0x35AB2A33), LIMB_PAIR(0xB6B12767, 0xB26D3F9D), LIMB_PAIR(0x6C9DA0FC, 0x0A55E68E), LIMB_PAIR(0x65D2662B, 0xB481A8F8),
+            LIMB_PAIR(0xED1FC69A, 0xA670CB04), LIMB_PAIR(0xF1C98C0C, 0x77E568A7), LIMB_PAIR(0x952DB9E8, 0x85C30516), LIMB_PAIR(0xF15C664A, 0x8A4EA765), LIMB_PARTIAL(0x12A)
+        }
+    },
+#endif
+#if (115 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^115 * G
+            LIMB_PAIR(0xC4DD900C, 0x6AD03106), LIMB_PAIR(0x7CA08923, 0x8227FB5D), LIMB_PAIR(0x863BA5D9, 0x2E3C1E7F), LIMB_PAIR(0xB5BE20D0, 0x5F76D6BF),
+            LIMB_PAIR(0x9492569A, 0x841DC1D2), LIMB_PAIR(0x47E0DC0D, 0xFDA5B20E), LIMB_PAIR(0x2D720DC5, 0x65ABA106), LIMB_PAIR(0x03E6765E, 0x9EAB8FFB), LIMB_PARTIAL(0x046),
+            LIMB_PAIR(0x497DA0C6, 0x32D92252), LIMB_PAIR(0xBEB7B1F1, 0xA2D4C8B1), LIMB_PAIR(0xF01C7409, 0xEDE29968), LIMB_PAIR(0xDA06607F, 0xAD902EB5),
+            LIMB_PAIR(0x5C1E7D9E, 0x2C60236C), LIMB_PAIR(0x17A3B1F0, 0x51F51DDD), LIMB_PAIR(0x40AB7CB8, 0xB71B393F), LIMB_PAIR(0xA16AC6BD, 0x710FC9F9), LIMB_PARTIAL(0x1CC)
+        },
+        {   // 2 * 16^115 * G
+            LIMB_PAIR(0xCDCD741B, 0x8A3E381C), LIMB_PAIR(0x14E8F964, 0x2C5ACC0B), LIMB_PAIR(0x29621441, 0x209D0404), LIMB_PAIR(0x2995C3B4, 0xD27A65CB),
+            LIMB_PAIR(0x6EC13968, 0x3A776FF0), LIMB_PAIR(0xDB4F8A0B, 0xA2D95CA7), LIMB_PAIR(0x6C04EA3B, 0xFDBC547D), LIMB_PAIR(0xDB40F58C, 0x30BA75A8), LIMB_PARTIAL(0x1AD),
+            LIMB_PAIR(0x84115D90, 0xF6406A6B), LIMB_PAIR(0x0F228B65, 0x7D2E26AC), LIMB_PAIR(0x9029A8AB, 0x1E17672B), LIMB_PAIR(0x3ECF05FB, 0xEAA84D81),
+            LIMB_PAIR(0xB5F5B798, 0x9E16E91D), LIMB_PAIR(0xE978749D, 0x7287DBD5), LIMB_PAIR(0x7FE092AA, 0x85880F45), LIMB_PAIR(0x514AFDCA, 0x80B3126C), LIMB_PARTIAL(0x0E0)
+        },
+        {   // 3 * 16^115 * G
+            LIMB_PAIR(0x7748701A, 0xB87CE581), LIMB_PAIR(0xA987513B, 0x78DA1F78), LIMB_PAIR(0x9BAC7437, 0x31ECC1E5), LIMB_PAIR(0x5EC57E2A, 0xCB7EBF5E),
+            LIMB_PAIR(0xCEE4F44F, 0x2C8D057F), LIMB_PAIR(0x7BDFD6F6, 0xD84AFB46), LIMB_PAIR(0x656BDE81, 0x565D12C2), LIMB_PAIR(0xF2D41D20, 0x64CDDB9D), LIMB_PARTIAL(0x160),
+            LIMB_PAIR(0x5104E3C7, 0x33049CD3), LIMB_PAIR(0x8A8F3D05, 0x6EC3C08A), LIMB_PAIR(0xE2434E6E, 0x63EEA672), LIMB_PAIR(0x5D7D27C7, 0xC7596815),
+            LIMB_PAIR(0xEE0FB5A8, 0xDB96E435), LIMB_PAIR(0xC2A4663A, 0xCA501829), LIMB_PAIR(0xCAAA6091, 0x5A013B22), LIMB_PAIR(0x38EC2555, 0x1A0E1D49), LIMB_PARTIAL(0x0AD)
+        },
+        {   // 4 * 16^115 * G
+            LIMB_PAIR(0xAF2ED12F, 0xADBF4F9F), LIMB_PAIR(0xF380FD8A, 0xCE1D19E4), LIMB_PAIR(0xA39E81AE, 0x0957BDB5), LIMB_PAIR(0x626EF6BC, 0xF9833321),
+            LIMB_PAIR(0x0CF5B28D, 0x110AE5EA), LIMB_PAIR(0x20392CD4, 0xAB159450), LIMB_PAIR(0x6BC67855, 0x67C49887), LIMB_PAIR(0xA3FD61C6, 0xCE7E5938), LIMB_PARTIAL(0x04A),
+            LIMB_PAIR(0x28C7DEA9, 0x59C5B9EF), LIMB_PAIR(0x0A6A7184, 0xD02F95BA), LIMB_PAIR(0x8202769C, 0x034DC257), LIMB_PAIR(0x94DD6896, 0x213B0B08),
+            LIMB_PAIR(0xB5DEA95A, 0x03730B7F), LIMB_PAIR(0x617CA889, 0xFE243ED0), LIMB_PAIR(0xFB1BA052, 0x16CF4D17), LIMB_PAIR(0x226F96DA, 0xD8691D6B), LIMB_PARTIAL(0x1C0)
+        },
+        {   // 5 * 16^115 * G
+            LIMB_PAIR(0xB979B88B, 0x07C4D08B), LIMB_PAIR(0x1639BBBB, 0x2D169E14), LIMB_PAIR(0xC125D4C7, 0xCDCE5A6B), LIMB_PAIR(0x3BB896E3, 0xD8BDA07E),
+            LIMB_PAIR(0x2CD77F48, 0x8EDDF8B4), LIMB_PAIR(0xC16BED6F, 0x70F6F21B), LIMB_PAIR(0x88A26D82, 0x468A156C), LIMB_PAIR(0xCE174F12, 0x97B788EC), LIMB_PARTIAL(0x0E9),
+            LIMB_PAIR(0x5C89D533, 0x95F38019), LIMB_PAIR(0xC2F6C63C, 0x81B5D1CB), LIMB_PAIR(0x23901AA3, 0x797C11DD), LIMB_PAIR(0x126C2418, 0x79008348),
+            LIMB_PAIR(0x8D61DB44, 0x2B5B4E68), LIMB_PAIR(0xA2804DE4, 0x27F6CC87), LIMB_PAIR(0xDF7586F0, 0x636D1764), LIMB_PAIR(0x9D1F8E00, 0x40650017), LIMB_PARTIAL(0x0A1)
+        },
+        {   // 6 * 16^115 * G
+            LIMB_PAIR(0xDCFC1DC4, 0x3E43CC8B), LIMB_PAIR(0x60D46E73, 0x7A25626F), LIMB_PAIR(0x10092DD3, 0xAA1AB12C), LIMB_PAIR(0x747E4D4B, 0x3C7E6E0B),
+            LIMB_PAIR(0x940102F8, 0x724E943A), LIMB_PAIR(0x010CD49A, 0x2F881A5A), LIMB_PAIR(0xE28D7E06, 0x8E3D40C9), LIMB_PAIR(0xD0249C5D, 0xAE405982), LIMB_PARTIAL(0x1D6),
+            LIMB_PAIR(0xF1E2D126, 0x626C5C9E), LIMB_PAIR(0x295A547F, 0xB2CAB943), LIMB_PAIR(0x810044A4, 0x31F3B4BE), LIMB_PAIR(0x4D8378B1, 0xA7DBFFB1),
+            LIMB_PAIR(0x2788F2EA, 0xDBC4164F), LIMB_PAIR(0x4E6107C4, 0x7B26E83D), LIMB_PAIR(0x452E34A6, 0xA4406B65), LIMB_PAIR(0x58C1CA9F, 0x667D71FD), LIMB_PARTIAL(0x0F0)
+        },
+        {   // 7 * 16^115 * G
+            LIMB_PAIR(0x76B30FF1, 0x2AC801BD), LIMB_PAIR(0x4DD813C6, 0x047ECDAA), LIMB_PAIR(0xF17A07C0, 0xAE2B98AA), LIMB_PAIR(0x33E55DAF, 0x19938061),
+            LIMB_PAIR(0x2F94190B, 0x4AA0D688), LIMB_PAIR(0x69BEAE5D, 0x41FF7A47), LIMB_PAIR(0x8BB828E8, 0xCA57BFC1), LIMB_PAIR(0x61465132, 0x537A689D), LIMB_PARTIAL(0x1E7),
+            LIMB_PAIR(0xC35AFA1A, 0x77564B28), LIMB_PAIR(0xB3494FCD, 0x54513990), LIMB_PAIR(0xE61C567A, 0xC5227210), LIMB_PAIR(0xDC29D37C, 0x2099E39E),
+            LIMB_PAIR(0x608B4F87, 0x659953B5), LIMB_PAIR(0x87BC7D59, 0x873ED054), LIMB_PAIR(0xB05875F4, 0x0F5CE1A9), LIMB_PAIR(0x523BD9A3, 0x61F3E3A4), LIMB_PARTIAL(0x0C6)
+        },
+        {   // 8 * 16^115 * G
+            LIMB_PAIR(0x27A668AB, 0x15A257C5), LIMB_PAIR(0xC920D8DF, 0xA437F499), LIMB_PAIR(0xD4CD271A, 0x297B6764), LIMB_PAIR(0x87CE8D52, 0xCBEDD33B),
+            LIMB_PAIR(0x10385C75, 0x4AB3B761), LIMB_PAIR(0x23436B58, 0xCA686123), LIMB_PAIR(0x8D52F4E5, 0x44D5A94D), LIMB_PAIR(0x605BBA0E, 0xD125E021), LIMB_PARTIAL(0x01E),
+            LIMB_PAIR(0x35E40C74, 0x578CD283), LIMB_PAIR(0x244EA58E, 0x898F4684), LIMB_PAIR(0x154FC334, 0x158AE785), LIMB_PAIR(0xD8D62231, 0x466C1C29),
+            LIMB_PAIR(0xC48B1013, 0xEF781790), LIMB_PAIR(0xC3253275, 0x7A902E83), LIMB_PAIR(0xB1AEAE85, 0xD0AAB751), LIMB_PAIR(0x0ECD9B0E, 0x89248D12), LIMB_PARTIAL(0x0E7)
+        }
+    },
+#endif
+#if (116 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^116 * G
+            LIMB_PAIR(0xCD5F918F, 0xE12D8922), LIMB_PAIR(0x49F73F1B, 0xEC7C1763), LIMB_PAIR(0xC744EB3D, 0xCC5A3A14), LIMB_PAIR(0x782DBDA1, 0x2B96F342),
+            LIMB_PAIR(0xAB68DDE4, 0x87284905), LIMB_PAIR(0xE720668A, 0x647354B9), LIMB_PAIR(0x739C4393, 0xE07DA694), LIMB_PAIR(0x2CC145F9, 0xBAE499BF), LIMB_PARTIAL(0x1AE),
+            LIMB_PAIR(0x77C16DB0, 0x74EEEAA4), LIMB_PAIR(0xEB22CE92, 0x297624E8), LIMB_PAIR(0x45098C91, 0x9D3944BC), LIMB_PAIR(0xFA4DC50C, 0x6FF31FA0),
+            LIMB_PAIR(0xCC40C211, 0x3C7FB6DA), LIMB_PAIR(0x96B4CD1C, 0x74D95DEC), LIMB_PAIR(0xA6388941, 0x829423DB), LIMB_PAIR(0xFC3123B5, 0xAA2B7D45), LIMB_PARTIAL(0x119)
+        },
+        {   // 2 * 16^116 * G
+            LIMB_PAIR(0x33849BA6, 0x404216DB), LIMB_PAIR(0x7B42813F, 0x7979AB02), LIMB_PAIR(0x117E27AA, 0xB0CABF29), LIMB_PAIR(0x5A0AB76D, 0x3E449CB6),
+            LIMB_PAIR(0x460B6964, 0x34EFBA77), LIMB_PAIR(0x6FEAD00B, 0x7553E0A6), LIMB_PAIR(0x16963CF0, 0x8AC88571), LIMB_PAIR(0x017AD9D1, 0x01716CBE), LIMB_PARTIAL(0x1F8),
+            LIMB_PAIR(0xD21FBD36, 0x30CFE5C1), LIMB_PAIR(0xDF1FE3B4, 0xC7A0E466), LIMB_PAIR(0xC8EA2C29, 0xCA38FD1C), LIMB_PAIR(0x4E54630F, 0xDE2E2039),
+            LIMB_PAIR(0x885B124F, 0x3B152EC3), LIMB_PAIR(0xD39818C8, 0x704A1D76), LIMB_PAIR(0x5207D2C2, 0x0E74A982), LIMB_PAIR(0xEC4D71A5, 0x2B2DC7C8), LIMB_PARTIAL(0x1F8)
+        },
+        {   // 3 * 16^116 * G
+            LIMB_PAIR(0x16E0F612, 0x01EF33CF), LIMB_PAIR(0xEEB7A33D, 0xBCCC51C3), LIMB_PAIR(0x46A12C50, 0xCC35C1E3), LIMB_PAIR(0xB915B370, 0xD2151223),
+            LIMB_PAIR(0x3AFF625F, 0xB0303014), LIMB_PAIR(0xB76ED5C4, 0xB7E34E67), LIMB_PAIR(0x10B988F7, 0xD5B48E22), LIMB_PAIR(0x57F1882F, 0x5EDADA05), LIMB_PARTIAL(0x1EE),
+            LIMB_PAIR(0x26A93C88, 0x70919A61), LIMB_PAIR(0x11491A74, 0x2729BAF1), LIMB_PAIR(0x541B2E39, 0x895470B5), LIMB_PAIR(0xC85FEF39, 0x88E52A03),
+            LIMB_PAIR(0x5B35AD5A, 0x605D4808), LIMB_PAIR(0x87561036, 0x3203783C), LIMB_PAIR(0x546E9DE2, 0xAC1C8568), LIMB_PAIR(0x62D3BC75, 0x61C5703C), LIMB_PARTIAL(0x192)
+        },
+        {   // 4 * 16^116 * G
+            LIMB_PAIR(0xCE43380A, 0x493D8A3F), LIMB_PAIR(0x1511E823, 0x27D1657B), LIMB_PAIR(0xE6112ECE, 0xF09125A7), LIMB_PAIR(0x18C2DDC1, 0xAFD3F482),
+            LIMB_PAIR(0x602AB092, 0xC1207AC1), LIMB_PAIR(0xF80FE3F9, 0x22FDFE83), LIMB_PAIR(0xF479C304, 0x736AD27F), LIMB_PAIR(0x784CA960, 0xD1FC1905), LIMB_PARTIAL(0x08F),
+            LIMB_PAIR(0x7FB35409, 0xE87798D2), LIMB_PAIR(0x61CFFD40, 0x86B02571), LIMB_PAIR(0x63058303, 0x12D991F9), LIMB_PAIR(0x033F10C9, 0xEF9E933E),
+            LIMB_PAIR(0xB298A118, 0x8221774C), LIMB_PAIR(0x80DC2858, 0x95DCFD10), LIMB_PAIR(0x68BFAA1F, 0x83747D71), LIMB_PAIR(0xA213129B, 0x03567035), LIMB_PARTIAL(0x1DC)
+        },
+        {   // 5 * 16^116 * G
+            LIMB_PAIR(0xD5AC5D48, 0x15AEA420), LIMB_PAIR(0x178C5A77, 0x6E11BF30), LIMB_PAIR(0x2651DEE6, 0x01F1180D), LIMB_PAIR(0x59E7A8F6, 0xD7602ED4),
+            LIMB_PAIR(0xDE3746DE, 0x5D3EC901), LIMB_PAIR(0xE2400304, 0x314D1580), LIMB_PAIR(0x65F15588, 0x08F82592), LIMB_PAIR(0xD9FFE64C, 0x22E8FF88), LIMB_PARTIAL(0x1D2),
+            LIMB_PAIR(0x99E0F136, 0xF3F23ABC), LIMB_PAIR(0x0F1AE78C, 0xEF5D9484), LIMB_PAIR(0xF6E34CA1, 0x616E957F), LIMB_PAIR(0x80B7054A, 0xE2E237B0),
+            LIMB_PAIR(0x92BAA214, 0x79877615), LIMB_PAIR(0xDD291296, 0xCD321299), LIMB_PAIR(0x20D8BCF6, 0xF9B74ADB), LIMB_PAIR(0x31661404, 0xEFCF3236), LIMB_PARTIAL(0x0E6)
+        },
+        {   // 6 * 16^116 * G
+            LIMB_PAIR(0xF084380F, 0xEAA89410), LIMB_PAIR(0x458AB9E4, 0x9491F70E), LIMB_PAIR(0x1D8EC684, 0x6B677205), LIMB_PAIR(0x1EF7E9ED, 0x1A9FC795),
+            LIMB_PAIR(0xB05C41EF, 0xC47E84EF), LIMB_PAIR(0xC6014E09, 0xEE377F78), LIMB_PAIR(0x521171EB, 0x91D14A75), LIMB_PAIR(0x32361217, 0x1B11FBBC), LIMB_PARTIAL(0x111),
+            LIMB_PAIR(0xA63BC7A1, 0xF789CC6B), LIMB_PAIR(0x9393B5CB, 0xBBD74F35), LIMB_PAIR(0x0BB024A4, 0xB43FF617), LIMB_PAIR(0xA844508C, 0x73800410),
+            LIMB_PAIR(0xC5468780, 0x93A28632), LIMB_PAIR(0x2AEFA8C1, 0xC96C62E5), LIMB_PAIR(0x7DF9B61F, 0xA500CE0B), LIMB_PAIR(0x369F304A, 0xB59527F2), LIMB_PARTIAL(0x172)
+        },
+        {   // 7 * 16^116 * G
+            LIMB_PAIR(0x052D2EA5, 0x68B81BE9), LIMB_PAIR(0x05294D6E, 0xEADFB531), LIMB_PAIR(0xA3258647, 0xCD41F773), LIMB_PAIR(0xD70FD9D0, 0xF6B1C867),
+            LIMB_PAIR(0x7BE523E7, 0x9A89CC01), LIMB_PAIR(0x487EBF56, 0x2499D793), LIMB_PAIR(0xC0D072A2, 0xC82CEFE8), LIMB_PAIR(0xE82CB4F8, 0x91C2BFBB), LIMB_PARTIAL(0x105),
+            LIMB_PAIR(0x6705DCE5, 0xD705CF5A), LIMB_PAIR(0x4462A67C, 0xFCBE204E), LIMB_PAIR(0x430D627F, 0x5E198BC3), LIMB_PAIR(0xE765991F, 0xE13DA562),
+            LIMB_PAIR(0x7032C5F8, 0xB6CFCA28), LIMB_PAIR(0x1783308A, 0x0868D9AB), LIMB_PAIR(0xC8050C8C, 0xC5B628C6), LIMB_PAIR(0x3A93A8DE, 0x243E2EC1), LIMB_PARTIAL(0x139)
+        },
+        {   // 8 * 16^116 * G
+            LIMB_PAIR(0x910F4978, 0x461C1512), LIMB_PAIR(0x63D2EC28, 0x8CA7F0DD), LIMB_PAIR(0x607CE3C5, 0xDA9297D2), LIMB_PAIR(0x81BB2DBB, 0x592BA13F),
+            LIMB_PAIR(0xF740C331, 0x157D4AC7), LIMB_PAIR(0x82C49AE7, 0x1D5311E7), LIMB_PAIR(0x3BEC9A94, 0x5C304671), LIMB_PAIR(0x0A23AB8D, 0xD81FA25B), LIMB_PARTIAL(0x1EE),
+            LIMB_PAIR(0xF51614FF, 0x6D8C6EFA), LIMB_PAIR(0x868B4FBC, 0x20CFD353), LIMB_PAIR(0x2201AAC2, 0x9B9DBA15), LIMB_PAIR(0x8D1900D7, 0x6BBD8DED),
+            LIMB_PAIR(0xFA946925, 0x6CA3E71A), LIMB_PAIR(0xA0C3735A, 0x7381E45A), LIMB_PAIR(0xB93D4FEE, 0xCD9DB7A2), LIMB_PAIR(0x45BDCE69, 0xAE401151), LIMB_PARTIAL(0x1BB)
+        }
+    },
+#endif
+#if (117 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^117 * G
+            LIMB_PAIR(0xAB7A841F, 0x2BF35F94), LIMB_PAIR(0x78E3FB0D, 0xDCBDA338), LIMB_PAIR(0xA0195F98, 0xB913947A), LIMB_PAIR(0x4370E51D, 0xC8E30A9C),
+            LIMB_PAIR(0xF0E558EE, 0x8A403E1F), LIMB_PAIR(0x606DB1DC, 0x7DD167C4), LIMB_PAIR(0x5827EF91, 0xAA343CBE), LIMB_PAIR(0xAACE0F43, 0x1404F2D6), LIMB_PARTIAL(0x1AC),
+            LIMB_PAIR(0x3DB1C500, 0xDFE19EA5), LIMB_PAIR(0x48EF4A56, 0xDD047171), LIMB_PAIR(0xB9A5EC76, 0x38AB939E), LIMB_PAIR(0x5648F852, 0x8F2D5685),
+            LIMB_PAIR(0x2726F67E, 0x7F81313F), LIMB_PAIR(0xF68F54BB, 0x41CF3794), LIMB_PAIR(0xDE14D6EC, 0x9D400E52), LIMB_PAIR(0x4C9EB1BA, 0xC046FDA1), LIMB_PARTIAL(0x08A)
+        },
+        {   // 2 * 16^117 * G
+            LIMB_PAIR(0x87744684, 0x563F57FF), LIMB_PAIR(0x6562CE2C, 0xD8F2F147), LIMB_PAIR(0xCE7B4B70, 0xBF323B07), LIMB_PAIR(0x9098ED36, 0x67B2111A),
+            LIMB_PAIR(0x0B687259, 0x0C8A85C1), LIMB_PAIR(0x45D51E50, 0x23A569D7), LIMB_PAIR(0x88D97057, 0x6643F19B), LIMB_PAIR(0x875181D0, 0x1EAB273A), LIMB_PARTIAL(0x13E),
+            LIMB_PAIR(0x18A1BFFB, 0xBD33DE94), LIMB_PAIR(0x9700AC60, 0x3EDD0DF8), LIMB_PAIR(0x61839145, 0x3757DBEB), LIMB_PAIR(0x1A59A97C, 0xD31A9AAB),
+            LIMB_PAIR(0xFAF790EB, 0xCAFFAFA2), LIMB_PAIR(0x14676E8B, 0x9F36C134), LIMB_PAIR(0x18545787, 0xEF6EDA5B), LIMB_PAIR(0x09AC46A4, 0x806A74C5), LIMB_PARTIAL(0x05D)
+        },
+        {   // 3 * 16^117 * G
+            LIMB_PAIR(0xFF4EA449, 0xCAEA17BB), LIMB_PAIR(0x91F114A1, 0x42EBAB1A), LIMB_PAIR(0xEB7FFC78, 0xE9489571), LIMB_PAIR(0xB86D5BDA, 0x6C12E907),
+            LIMB_PAIR(0x1FB55F3E, 0xD483CA52), LIMB_PAIR(0x1E51DCD5, 0xFE15CA3E), LIMB_PAIR(0x0DAD4105, 0xAD186B4C), LIMB_PAIR(0x1700D1C6, 0x7ACE5778), LIMB_PARTIAL(0x0B6),
+            LIMB_PAIR(0x11878A42, 0x41B44850), LIMB_PAIR(0xCE2799E7, 0x4DC4219D), LIMB_PAIR(0xAFE8A462, 0x44C093F5), LIMB_PAIR(0x18CB2F21, 0x279646F9),
+            LIMB_PAIR(0x7058E005, 0xD6722EA9), LIMB_PAIR(0x02536EB9, 0x837D0A0C), LIMB_PAIR(0x5AF19397, 0x6DAF4C15), LIMB_PAIR(0x5BC8A5F5, 0xC4DC5D39), LIMB_PARTIAL(0x14A)
+        },
+        {   // 4 * 16^117 * G
+            LIMB_PAIR(0x0DE2A07C, 0xE6B23630), LIMB_PAIR(0x6E52BA0E, 0x64D21992), LIMB_PAIR(0x68D1E768, 0xE5786EDA), LIMB_PAIR(0xCB6A04F5, 0xAD163F8E),
+            LIMB_PAIR(0x101039E2, 0x5A09908A), LIMB_PAIR(0x11A5F49E, 0x87083276), LIMB_PAIR(0x5446A61A, 0x231D61FB), LIMB_PAIR(0xE7DDBBA8, 0x39E98AD1), LIMB_PARTIAL(0x185),
+            LIMB_PAIR(0x3861F6E7, 0x54CA5F0F), LIMB_PAIR(0xD20D86E6, 0x0E0F1667), LIMB_PAIR(0x13D9ADAE, 0xCF229FD6), LIMB_PAIR(0xC488EC9F, 0xC8852AED),
+            LIMB_PAIR(0xEE1061E2, 0xFEE0C03D), LIMB_PAIR(0x35298521, 0x7167271A), LIMB_PAIR(0xFC0CFD1C, 0xF4FCF268), LIMB_PAIR(0xDF809AF6, 0x645A9D2F), LIMB_PARTIAL(0x057)
+        },
+        {   // 5 * 16^117 * G
+            LIMB_PAIR(0xEB2A9463, 0x26AD8924), LIMB_PAIR(0x65239D57, 0x0050762D), LIMB_PAIR(0x455C9F95, 0xEED3D2E9), LIMB_PAIR(0x2D4455C7, 0xFB1C7435),
+            LIMB_PAIR(0xFE101F88, 0x830EB782), LIMB_PAIR(0x57709E8B, 0xE63914BD), LIMB_PAIR(0xC5E4CC3B, 0xFE87CD37), LIMB_PAIR(0x1F4CC628, 0x762CF1BA), LIMB_PARTIAL(0x04B),
+            LIMB_PAIR(0x61622EA8, 0x4DD6AB01), LIMB_PAIR(0xBE0AD8A3, 0x7A53FB7D), LIMB_PAIR(0xC33A6AE5, 0xD58DAAEA), LIMB_PAIR(0xDAF8D9C8, 0xE23B2139),
+            LIMB_PAIR(0x22B6A3FA, 0xC6AD81D8), LIMB_PAIR(0xD183D49A, 0x0065CBD7), LIMB_PAIR(0xBAEF9EF4, 0x323363CC), LIMB_PAIR(0x591BB7D9, 0x595C7048), LIMB_PARTIAL(0x09C)
+        },
+        {   // 6 * 16^117 * G
+            LIMB_PAIR(0xA021CA92, 0x38C2B6BC), LIMB_PAIR(0x2D1C900F, 0x715F2BF7), LIMB_PAIR(0x5DCE0826, 0x79D4428F), LIMB_PAIR(0x55B0F95A, 0x74661803),
+            LIMB_PAIR(0x059F6B0C, 0x59D9BA60), LIMB_PAIR(0x1CAD0687, 0xA3A157EB), LIMB_PAIR(0xEACFD2E4, 0xCB4E3F7A), LIMB_PAIR(0x1E36AD17, 0xDEA5CBCB), LIMB_PARTIAL(0x090),
+            LIMB_PAIR(0x4040F60E, 0x49B0C5BE), LIMB_PAIR(0xCADC11BB, 0xD354D658), LIMB_PAIR(0x8B5AB35F, 0xB17F1AA4), LIMB_PAIR(0x856BDC09, 0x09956859),
+            LIMB_PAIR(0xF18DA95B, 0x4BDD06FF), LIMB_PAIR(0x235E890A, 0xBF66D16D), LIMB_PAIR(0x76201868, 0x57D83D00), LIMB_PAIR(0x91E1A0C3, 0x0BB0291F), LIMB_PARTIAL(0x0E6)
+        },
+        {   // 7 * 16^117 * G
+            LIMB_PAIR(0xD962CB5F, 0xF6C5E153), LIMB_PAIR(0x008897A9, 0x02C33715), LIMB_PAIR(0x353A9BA0, 0x8334420A), LIMB_PAIR(0x27081621, 0x0369DE7F),
+            LIMB_PAIR(0x89AE3E70, 0xDAEC4337), LIMB_PAIR(0x320628A4, 0xD0D2FD4E), LIMB_PAIR(0xB527C311, 0xCEEED59F), LIMB_PAIR(0xE4C12CF6, 0x3111DE80), LIMB_PARTIAL(0x127),
+            LIMB_PAIR(0x4D578154, 0xEEF5D048), LIMB_PAIR(0x35E6A046, 0x2A752CC8), LIMB_PAIR(0xABB9ED8E, 0x1DCC194A), LIMB_PAIR(0x98C92EFC, 0x6E2E65BB),
+            LIMB_PAIR(0xBAE89E78, 0x780C6AF3), LIMB_PAIR(0x9892D5E9, 0x6C0509E6), LIMB_PAIR(0x01F3BE0A, 0x4C2CF9EA), LIMB_PAIR(0xB1563854, 0xC9C5FD50), LIMB_PARTIAL(0x1AA)
+        },
+        {   // 8 * 16^117 * G
+            LIMB_PAIR(0x3B407EFC, 0x7A6B3FCB), LIMB_PAIR(0x063CED31, 0x05F6D0A3), LIMB_PAIR(0xF3F03BF3, 0x4A79C880), LIMB_PAIR(0x7A1438C8, 0x94181FFF),
+            LIMB_PAIR(0x56106ED0, 0x47FA4E49), LIMB_PAIR(0xFAF7201F, 0xAA97355D), LIMB_PAIR(0x02F7C119, 0x1264069E), LIMB_PAIR(0x4D06B273, 0xF702C7F0), LIMB_PARTIAL(0x187),
+            LIMB_PAIR(0xE7E258BF, 0x368DCB7A), LIMB_PAIR(0xE8E4597B, 0x5F8A64EA), LIMB_PAIR(0x6F13BCCE, 0x98BBCF2B), LIMB_PAIR(0x7D099F3A, 0xC00C8E62),
+            LIMB_PAIR(0x5E326891, 0x4803C400), LIMB_PAIR(0x342BADBB, 0x229DEEC9), LIMB_PAIR(0x49E0992C, 0x3B810A6F), LIMB_PAIR(0x63758695, 0xFB55C6CD), LIMB_PARTIAL(0x02F)
+        }
+    },
+#endif
+#if (118 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^118 * G
+            LIMB_PAIR(0x5F7ABAEA, 0x02FB84FD), LIMB_PAIR(0xE991E445, 0xA238AD04), LIMB_PAIR(0x7C972ADD, 0x0D9B2D41), LIMB_PAIR(0x478C558A, 0xAC2439F9),
+            LIMB_PAIR(0x1EC86ED8, 0xC3C78A2C), LIMB_PAIR(0x2D3B2F29, 0x3735839B), LIMB_PAIR(0x50317454, 0x259728D4), LIMB_PAIR(0xE2377ABA, 0x7B53A9CB), LIMB_PARTIAL(0x179),
+            LIMB_PAIR(0x5E4846CE, 0x95F44ADD), LIMB_PAIR(0x7211225E, 0x85D2A8E8), LIMB_PAIR(0x091A6646, 0xCBF0ABD8), LIMB_PAIR(0x102DEEAA, 0x9D8B3475),
+            LIMB_PAIR(0x602BA91C, 0xE2A0A4AB), LIMB_PAIR(0x131DE0D4, 0xA6276D7F), LIMB_PAIR(0x5F215C70, 0xBB90D117), LIMB_PAIR(0x07E3AA82, 0x49A60E3E), LIMB_PARTIAL(0x019)
+        },
+        {   // 2 * 16^118 * G
+            LIMB_PAIR(0x18E71DD8, 0xCB300761), LIMB_PAIR(0x04886B27, 0x01D26846), LIMB_PAIR(0x7CC1D69E, 0x22871D7B), LIMB_PAIR(0xD0B3CAF9, 0x1D138A47),
+            LIMB_PAIR(0x00A7C0B0, 0x53AEB974), LIMB_PAIR(0x262F9366, 0x712AA1A2), LIMB_PAIR(0x6BCAE07A, 0x58C84DA4), LIMB_PAIR(0xAE8708B5, 0x521B7DBC), LIMB_PARTIAL(0x045),
+            LIMB_PAIR(0x8D3CD884, 0x03BD3643), LIMB_PAIR(0x1D62A335, 0x20A737EE), LIMB_PAIR(0x904F5C53, 0x37E1775F), LIMB_PAIR(0x3BAA91FD, 0xB76783DD),
+            LIMB_PAIR(0x9A84E971, 0x7C552118), LIMB_PAIR(0x4488EDE7, 0xD085796E), LIMB_PAIR(0x5068D6DC, 0xB418E708), LIMB_PAIR(0xE5275A73, 0x4417E81A), LIMB_PARTIAL(0x0D2)
+        },
+        {   // 3 * 16^118 * G
+            LIMB_PAIR(0x76F521D5, 0xEE2CA82B), LIMB_PAIR(0x8D54184C, 0x404C95B9), LIMB_PAIR(0xD43E178E, 0x7EF78330), LIMB_PAIR(0x05F36BD2, 0xED67F943),
+            LIMB_PAIR(0x45F09837, 0xD734F6B8), LIMB_PAIR(0xBD8F5A29, 0x8760F0F7), LIMB_PAIR(0x12059285, 0x2E7CF021), LIMB_PAIR(0xEC54D3AF, 0x8D0BE801), LIMB_PARTIAL(0x0A6),
+            LIMB_PAIR(0x71042440, 0x51BA60C9), LIMB_PAIR(0x614A4512, 0xEA9C35AE), LIMB_PAIR(0x1D410F81, 0x006BBCA5), LIMB_PAIR(0x1170157D, 0x3D31AC43),
+            LIMB_PAIR(0xFC7E723B, 0x69B0BE25), LIMB_PAIR(0x38276789, 0x6DA152BA), LIMB_PAIR(0x93492808, 0xBE486C05), LIMB_PAIR(0x80AFA598, 0x3FD119D9), LIMB_PARTIAL(0x08C)
+        },
+        {   // 4 * 16^118 * G
+            LIMB_PAIR(0xD6C5B0B9, 0x099C2888), LIMB_PAIR(0x1FFE8A3B, 0xE35CE138), LIMB_PAIR(0x74939411, 0x133C35CA), LIMB_PAIR(0x2FF27AE3, 0x13521B32),
+            LIMB_PAIR(0xF760A06E, 0xBDE73625), LIMB_PAIR(0x5EE54408, 0x19934071), LIMB_PAIR(0x02F9B217, 0x69DB07E1), LIMB_PAIR(0x86A5E6A5, 0x1389C235), LIMB_PARTIAL(0x112),
+            LIMB_PAIR(0xCA1AA74F, 0xCF5B0E89), LIMB_PAIR(0x5D844CCF, 0x0CFA7632), LIMB_PAIR(0x65C3286F, 0x04BE199C), LIMB_PAIR(0xD204E249, 0x483E0FF9),
+            LIMB_PAIR(0x04C424B5, 0x9DF8CE97), LIMB_PAIR(0xC05C0793, 0xE35CDA3E), LIMB_PAIR(0xF2798180, 0x8A595DF3), LIMB_PAIR(0xFBE7F5C9, 0x7522B808), LIMB_PARTIAL(0x09C)
+        },
+        {   // 5 * 16^118 * G
+            LIMB_PAIR(0xE92E85B5, 0x14596043), LIMB_PAIR(0x309BCC86, 0xE3CAA4F1), LIMB_PAIR(0x6A004131, 0x0946EECD), LIMB_PAIR(0x5D559370, 0xA8F39A0A),
+            LIMB_PAIR(0x9DD39852, 0x2907F0FB), LIMB_PAIR(0xB3624B6C, 0xD26639C2), LIMB_PAIR(0x034709B8, 0xB45F0D32), LIMB_PAIR(0x8065C9D8, 0x0AE962D4), LIMB_PARTIAL(0x144),
+            LIMB_PAIR(0xD521ED0E, 0x3DE036A5), LIMB_PAIR(0x22E88BED, 0x5CE09900), LIMB_PAIR(0x527F6BE6, 0x2170357D), LIMB_PAIR(0x5B47A6C2, 0x7CC9E9FF),
+            LIMB_PAIR(0x9748EB94, 0x801FF33B), LIMB_PAIR(0x372D1840, 0xCB3961D6), LIMB_PAIR(0xBDA53A97, 0xC3DB0B3B), LIMB_PAIR(0x9BD74F00, 0xFFF1A078), LIMB_PARTIAL(0x127)
+        },
+        {   // 6 * 16^118 * G
+            LIMB_PAIR(0x23509208, 0xB758F2CD), LIMB_PAIR(0x88BA1557, 0xD4F7AF50), LIMB_PAIR(0xE472D9FE, 0x8FF26BBD), LIMB_PAIR(0x8960AC4A, 0x07172386),
+            LIMB_PAIR(0x9025DE52, 0xF63E404E), LIMB_PAIR(0xCACBCA10, 0x05053C3F), LIMB_PAIR(0xE90CDFB2, 0x55AD71F0), LIMB_PAIR(0x80E65089, 0x25D57165), LIMB_PARTIAL(0x125),
+            LIMB_PAIR(0x19A94651, 0x5DE65084), LIMB_PAIR(0x1BF9C999, 0x9AA2DBC0), LIMB_PAIR(0x37D94752, 0xC97A2377), LIMB_PAIR(0xA4D21F9C, 0x9963D33C),
+            LIMB_PAIR(0xD92C494A, 0x679F837F), LIMB_PAIR(0x69FC4047, 0x1876A9CC), LIMB_PAIR(0xCA690225, 0x028E4EDF), LIMB_PAIR(0x8359A44B, 0xA4947416), LIMB_PARTIAL(0x04B)
+        },
+        {   // 7 * 16^118 * G
+            LIMB_PAIR(0x1AA88055, 0xCC51CB4B), LIMB_PAIR(0x6DAC9C77, 0x55C2DFC4), LIMB_PAIR(0xFB5E8DE9, 0x4E0019AF), LIMB_PAIR(0xD0D60937, 0xD686F86D),
+            LIMB_PAIR(0x2F3AC7DB, 0xFE4BCB52), LIMB_PAIR(0x1CBD8B5B, 0x102ADF66), LIMB_PAIR(0xF89AD228, 0xFE830C11), LIMB_PAIR(0x969B169B, 0xB635E0E1), LIMB_PARTIAL(0x1A6),
+            LIMB_PAIR(0xD5B1C229, 0x6B51C9AB), LIMB_PAIR(0x9EE262CA, 0x1D2912BE), LIMB_PAIR(0x838C6D6E, 0x6208F3DD), LIMB_PAIR(0xD6E11544, 0xC3B9A9E5),
+            LIMB_PAIR(0x6A2696E9, 0xB88E9933), LIMB_PAIR(0xEA9D3206, 0x81B5B9C8), LIMB_PAIR(0x43123369, 0xA7F2F302), LIMB_PAIR(0x73BC3A3B, 0xBB51E486), LIMB_PARTIAL(0x113)
+        },
+        {   // 8 * 16^118 * G
+            LIMB_PAIR(0x70BE25D7, 0x5EA6D7EC), LIMB_PAIR(0x18497519, 0x71239514), LIMB_PAIR(0x661279B0, 0x86EC4211), LIMB_PAIR(0xD41DEB71, 0x3C673364),
+            LIMB_PAIR(0x1884DB68, 0xC7F5BF95), LIMB_PAIR(0x77ECEC04, 0x17EB082E), LIMB_PAIR(0x4CCEF5A8, 0xEC159BB1), LIMB_PAIR(0xEE69D948, 0x630D61DC), LIMB_PARTIAL(0x130),
+            LIMB_PAIR(0xC1A69DF7, 0x0D0DB8B4), LIMB_PAIR(0xCFC11ACF, 0x28590B46), LIMB_PAIR(0xB19D5A7D, 0x5137B85B), LIMB_PAIR(0xA376813A, 0x6069874D),
+            LIMB_PAIR(0x2AB28149, 0x87112609), LIMB_PAIR(0x69E6D09C, 0xDDC19000), LIMB_PAIR(0x0114F9BB, 0x7B3544C7), LIMB_PAIR(0xE842291E, 0xAE2D081F), LIMB_PARTIAL(0x110)
+        }
+    },
+#endif
+#if (119 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^119 * G
+            LIMB_PAIR(0x09B5947B, 0xC7CC50FB), LIMB_PAIR(0xD5EAE02F, 0xE166A9AF), LIMB_PAIR(0xDA349C90, 0x47C7953F), LIMB_PAIR(0x21C0984D, 0xC3D4BCAE),
+            LIMB_PAIR(0x45FF2419, 0xCEE13C2F), LIMB_PAIR(0x47780DDC, 0x334CC1F1), LIMB_PAIR(0xF1157180, 0x21381FB6), LIMB_PAIR(0xEAEDE87B, 0x28FF4F86), LIMB_PARTIAL(0x17D),
+            LIMB_PAIR(0x60E096A3, 0x10C72B82), LIMB_PAIR(0x5FF796BA, 0xC73306EC), LIMB_PAIR(0xFECC17EC, 0xB3F60666), LIMB_PAIR(0x46F82C8D, 0xB9E0D51F),
+            LIMB_PAIR(0x296DA50C, 0x6CBE5C7E), LIMB_PAIR(0x4FA6C1CE, 0x87CB1104), LIMB_PAIR(0x491F9B8B, 0x5D5E0F6D), LIMB_PAIR(0x70EB3D18, 0x187BAF69), LIMB_PARTIAL(0x103)
+        },
+        {   // 2 * 16^119 * G
+            LIMB_PAIR(0x189A0360, 0x2FAFC73F), LIMB_PAIR(0xA68509E8, 0xE08428F1), LIMB_PAIR(0x3A2AF597, 0x4700E3EB), LIMB_PAIR(0x4B298188, 0x143C0BF1),
+            LIMB_PAIR(0xF0B9B8F6, 0x9FB03775), LIMB_PAIR(0x2653D193, 0x7C9E5A3A), LIMB_PAIR(0xD1F8AB93, 0x41109C62), LIMB_PAIR(0x434536B8, 0x8AD7CB71), LIMB_PARTIAL(0x073),
+            LIMB_PAIR(0xAA844EDD, 0x82C43B2D), LIMB_PAIR(0x3CAFB62D, 0xAD5BE7AC), LIMB_PAIR(0x4A5B4B0C, 0x8DD99C5B), LIMB_PAIR(0x31C113AA, 0x2A11DC41),
+            LIMB_PAIR(0x3390E968, 0xE62332E9), LIMB_PAIR(0x4B073B39, 0xA912CDEA), LIMB_PAIR(0xBC11CB2C, 0xBB0B8141), LIMB_PAIR(0xC9DCA239, 0x504272D1), LIMB_PARTIAL(0x07F)
+        },
+        {   // 3 * 16^119 * G
+            LIMB_PAIR(0x0689CA3F, 0xDE032403), LIMB_PAIR(0x14FD0202, 0x4584FD97), LIMB_PAIR(0xC84BFE39, 0xBEA63186), LIMB_PAIR(0xABA48F51, 0x0E579AAD),
+            LIMB_PAIR(0xC1A4C309, 0xCDA28545), LIMB_PAIR(0xFD645C90, 0x33629507), LIMB_PAIR(0x27B58E13, 0x0C77CD56), LIMB_PAIR(0x64DDA00F, 0x4D843136), LIMB_PARTIAL(0x16C),
+            LIMB_PAIR(0xE91A439C, 0x281CDDF1), LIMB_PAIR(0x38BF386B, 0xAEDC15D5), LIMB_PAIR(0xF35EA657, 0xF2F22343), LIMB_PAIR(0x18A01F1F, 0xF9FE82EA),
+            LIMB_PAIR(0x0B5A27BD, 0x04F9F473), LIMB_PAIR(0x025DF338, 0xD296626D), LIMB_PAIR(0x633DCA68, 0x45B950BA), LIMB_PAIR(0x19F73B2E, 0xEEEF58AD), LIMB_PARTIAL(0x008)
+        },
+        {   // 4 * 16^119 * G
+            LIMB_PAIR(0x6573F504, 0xD92A04C2), LIMB_PAIR(0x85DE7CE9, 0xB69C2DBB), LIMB_PAIR(0xA2A36153, 0xB2B82853), LIMB_PAIR(0x6AF7FEB5, 0x2899BD37),
+            LIMB_PAIR(0x433C9010, 0x301805E5), LIMB_PAIR(0xB616D5DF, 0x5BED8ACA), LIMB_PAIR(0x70E4B63E, 0xC8AFDA42), LIMB_PAIR(0x48CCE468, 0x496EB132), LIMB_PARTIAL(0x103),
+            LIMB_PAIR(0x0973771C, 0x6EBCD050), LIMB_PAIR(0x474E651B, 0x6377D971), LIMB_PAIR(0x0F6DEA19, 0x7D0A936B), LIMB_PAIR(0x0AEAF504, 0xF7CF4FCE),
+            LIMB_PAIR(0x170C2FBA, 0xCEE2076C), LIMB_PAIR(0x3AF78646, 0x15844826), LIMB_PAIR(0xE27F2225, 0x67737E06), LIMB_PAIR(0x4601BD5B, 0xDFFF84AF), LIMB_PARTIAL(0x0C1)
+        },
+        {   // 5 * 16^119 * G
+            LIMB_PAIR(0x9DF3894B, 0x035D0A01), LIMB_PAIR(0xC2F36A07, 0xFCFB77C6), LIMB_PAIR(0xC9319662, 0x04957358), LIMB_PAIR(0x0E0FBE5B, 0x52FB2C65),
+            LIMB_PAIR(0xCF3EBED5, 0x26D1FB01), LIMB_PAIR(0x6F338B83, 0x3A417DC0), LIMB_PAIR(0xD11A9621, 0xFB234B48), LIMB_PAIR(0xDB3F5CBB, 0xBBA96393), LIMB_PARTIAL(0x0D1),
+            LIMB_PAIR(0x95129FF9, 0x78B95F14), LIMB_PAIR(0x4D5F0ABE, 0x10504DE1), LIMB_PAIR(0x3F4DDE14, 0xE8C7250D), LIMB_PAIR(0xEA00AC99, 0x20C04AB4),
+            LIMB_PAIR(0x6EB2143B, 0xFAED1168), LIMB_PAIR(0x544284B5, 0x23E32BF4), LIMB_PAIR(0xBAD3ACB7, 0x0512A28D), LIMB_PAIR(0x86D008A6, 0xAA1926AA), LIMB_PARTIAL(0x192)
+        },
+        {   // 6 * 16^119 * G
+            LIMB_PAIR(0x75E0A1F7, 0x81F919BC), LIMB_PAIR(0xCD6A017D, 0x89DE5DD7), LIMB_PAIR(0xC9A96FCF, 0x14D88451), LIMB_PAIR(0x6C5B2967, 0xF3F61D04),
+            LIMB_PAIR(0x453A4189, 0xD21B7E9C), LIMB_PAIR(0xC8B7BF46, 0x18E9C74D), LIMB_PAIR(0x63921EE6, 0xF8903F4F), LIMB_PAIR(0x25060DE5, 0x1CABB3F0), LIMB_PARTIAL(0x06A),
+            LIMB_PAIR(0xC291F1CB, 0xF15CD5C8), LIMB_PAIR(0xD0311E2D, 0x26C8A484), LIMB_PAIR(0xD9E366C1, 0x1E5D93B9), LIMB_PAIR(0x812FD505, 0xB037CBDD),
+            LIMB_PAIR(0x0C567514, 0x8614127C), LIMB_PAIR(0x4256930A, 0x4125BC9B), LIMB_PAIR(0x6A0A82AC, 0x84F62F97), LIMB_PAIR(0x8DBD5C67, 0x5B12E21E), LIMB_PARTIAL(0x192)
+        },
+        {   // 7 * 16^119 * G
+            LIMB_PAIR(0xCAF7FFF7, 0xBE5764C9), LIMB_PAIR(0x6D606B04, 0x16CC873D), LIMB_PAIR(0x4268CDFB, 0x6A6F2078), LIMB_PAIR(0x27BD5738, 0x06CD7CE6),
+            LIMB_PAIR(0x42E47936, 0x532D5C42), LIMB_PAIR(0x7D0F8758, 0x704F0B2A), LIMB_PAIR(0x6D2E977A, 0x6046D9F3), LIMB_PAIR(0x1327C874, 0x53FEB41A), LIMB_PARTIAL(0x0FB),
+            LIMB_PAIR(0x013EF2BE, 0x9425B4D1), LIMB_PAIR(0x98A45194, 0x98B50C6E), LIMB_PAIR(0x9DF34265, 0xBF181A2B), LIMB_PAIR(0xC2DE575C, 0x39C40CE4),
+            LIMB_PAIR(0x883B4DCC, 0x6757DAEB), LIMB_PAIR(0xF8B5EFBC, 0xCB224D4B), LIMB_PAIR(0xED49A2A0, 0x2DCF10AE), LIMB_PAIR(0x9FFDA898, 0x9C1FFF7A), LIMB_PARTIAL(0x0EC)
+        },
+        {   // 8 * 16^119 * G
+            LIMB_PAIR(0x3E0C991E, 0x7D263605), LIMB_PAIR(0x275DB80F, 0xEE3ED571), LIMB_PAIR(0x561DD429, 0xF20CF648), LIMB_PAIR(0xF12BDDC2, 0xED7EA515),
+            LIMB_PAIR(0x0A544F33, 0xB84130BD), LIMB_PAIR(0x7832D23A, 0xD56FB729), LIMB_PAIR(0x0BBD7452, 0x728EBEEC), LIMB_PAIR(0x28216463, 0x6006394D), LIMB_PARTIAL(0x0D2),
+            LIMB_PAIR(0x228B41F1, 0x43B5561B), LIMB_PAIR(0x19B17767, 0x90EBA778), LIMB_PAIR(0xA2533AC2, 0xCA1AC49E), LIMB_PAIR(0x5EE9175A, 0x23B080F7),
+            LIMB_PAIR(0x73A70BB7, 0x98A94707), LIMB_PAIR(0x15CECBEB, 0x4CA74D08), LIMB_PAIR(0xB4A97B7C, 0x5141DB56), LIMB_PAIR(0xF1450CAE, 0x758FE34E), LIMB_PARTIAL(0x111)
+        }
+    },
+#endif
+#if (120 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^120 * G
+            LIMB_PAIR(0x3FBADC57, 0x62A1F73E), LIMB_PAIR(0xB1BA2D35, 0xEABF4B68), LIMB_PAIR(0x76F3BDE7, 0x711D7F63), LIMB_PAIR(0xB31C3FB3, 0x162F5183),
+            LIMB_PAIR(0xD7D716F7, 0x0DCD66FE), LIMB_PAIR(0xE46816D9, 0x6E1DBB78), LIMB_PAIR(0xF833A6F7, 0x532831B8), LIMB_PAIR(0x4CFED0CF, 0x64191CCB), LIMB_PARTIAL(0x190),
+            LIMB_PAIR(0x6D7824AD, 0xDB376339), LIMB_PAIR(0xB16A391B, 0x6B948AEF), LIMB_PAIR(0x4AE9013E, 0x2D174FD6), LIMB_PAIR(0x16A57DE2, 0x9B5C22EE),
+            LIMB_PAIR(0x9E857A25, 0x3BFED1DA), LIMB_PAIR(0x4D644BBD, 0x635187A6), LIMB_PAIR(0x6FE288AC, 0x94786E3A), LIMB_PAIR(0xECE25962, 0x827C8B03), LIMB_PARTIAL(0x092)
+        },
+        {   // 2 * 16^120 * G
+            LIMB_PAIR(0xD35B5ACD, 0x027F4FF2), LIMB_PAIR(0x9EEE8CAF, 0x0E0FEC35), LIMB_PAIR(0x544C2A44, 0xA99AA6E2), LIMB_PAIR(0xA9DE5EE3, 0x0548945F),
+            LIMB_PAIR(0xC4C5263F, 0x02EE7FB3), LIMB_PAIR(0xC75A400D, 0x3FAE05EE), LIMB_PAIR(0x3640DFC6, 0x50ECFF53), LIMB_PAIR(0xC0CECB87, 0xE57C180F), LIMB_PARTIAL(0x0C2),
+            LIMB_PAIR(0x87BA8E83, 0x22B35043), LIMB_PAIR(0x1C652199, 0x6C47F5D2), LIMB_PAIR(0x19F3260D, 0x2EC15D3D), LIMB_PAIR(0xE95FAEA6, 0xCF9E5050),
+            LIMB_PAIR(0xA4F5D193, 0x7ADC35CC), LIMB_PAIR(0x3DDEE652, 0xA7B0F1F3), LIMB_PAIR(0x6E213C07, 0xDFB75124), LIMB_PAIR(0x7946DDC3, 0xE33A115A), LIMB_PARTIAL(0x09F)
+        },
+        {   // 3 * 16^120 * G
+            LIMB_PAIR(0xEF4B1B98, 0x6E965255), LIMB_PAIR(0x8BA97BF6, 0x3F63B6BD), LIMB_PAIR(0x19BB0BA0, 0xC6CACADB), LIMB_PAIR(0x3C8EDCC4, 0x9F88F0C8),
+            LIMB_PAIR(0x1A489ACE, 0x3A2D4BC5), LIMB_PAIR(0x5529BB67, 0xAA3075B7), LIMB_PAIR(0xFFBBD2BF, 0xCDB0C4D6), LIMB_PAIR(0x3A568FD4, 0x4A3B41D3), LIMB_PARTIAL(0x146),
+            LIMB_PAIR(0xEFFA56AE, 0x46442711), LIMB_PAIR(0x47ACC062, 0x941858D8), LIMB_PAIR(0x7434D565, 0x9480D79C), LIMB_PAIR(0x43322ECC, 0xA92E8859),
+            LIMB_PAIR(0x5F82931E, 0x650CD6DE), LIMB_PAIR(0x97876156, 0x4EF5D483), LIMB_PAIR(0xAAF946F4, 0x04CA704A), LIMB_PAIR(0x0A95E02C, 0x75258AAC), LIMB_PARTIAL(0x132)
+        },
+        {   // 4 * 16^120 * G
+            LIMB_PAIR(0xD3CB8E9F, 0x7AAA8F37), LIMB_PAIR(0x1A73D853, 0x8F3B48A9), LIMB_PAIR(0xEF285A53, 0x783EBBE7), LIMB_PAIR(0x1C3EF389, 0x4F9D9729),
+            LIMB_PAIR(0x6453DA69, 0x130F276C), LIMB_PAIR(0x834FACED, 0x76683273), LIMB_PAIR(0xAF5AF17C, 0x026A3722), LIMB_PAIR(0xF08A5E50, 0xD588AA37), LIMB_PARTIAL(0x16D),
+            LIMB_PAIR(0xBBDC76B3, 0x81B6610B), LIMB_PAIR(0x563A6902, 0x406785DD), LIMB_PAIR(0xED775283, 0xE0755F6C), LIMB_PAIR(0x53B16D0A, 0x08D6C847),
+            LIMB_PAIR(0x654F906A, 0x48EBB570), LIMB_PAIR(0x184B373C, 0x3F0C62B7), LIMB_PAIR(0x314D776A, 0xD6BB91B6), LIMB_PAIR(0x224744A7, 0xAB9BFB3A), LIMB_PARTIAL(0x12F)
+        },
+        {   // 5 * 16^120 * G
+            LIMB_PAIR(0xE4DC6C47, 0xA5566CAF), LIMB_PAIR(0xFD8F2789, 0x17226EF0), LIMB_PAIR(0xC66FEEA4, 0xF6F20C86), LIMB_PAIR(0x54F41B79, 0x19F5E459),
+            LIMB_PAIR(0xA05AEA83, 0x4288C4B4), LIMB_PAIR(0xD8D42617, 0x107C800C), LIMB_PAIR(0x2425EA3A, 0xA83D33A4), LIMB_PAIR(0xEEC9D772, 0x8DEA172B), LIMB_PARTIAL(0x132),
+            LIMB_PAIR(0x9EF2A747, 0xF75FEE0F), LIMB_PAIR(0xBF360B7B, 0x107D2B54), LIMB_PAIR(0x4C4DD036, 0x6A0B32F0), LIMB_PAIR(0xE843BDF6, 0x4733A40D),
+            LIMB_PAIR(0xAE53A7D2, 0x5B17B282), LIMB_PAIR(0x2070F209, 0xE15AF19E), LIMB_PAIR(0xDC178326, 0x800540EC), LIMB_PAIR(0x8A9691E5, 0x13D38AAC), LIMB_PARTIAL(0x04E)
+        },
+        {   // 6 * 16^120 * G
+            LIMB_PAIR(0x285F37AD, 0x3B8CF734), LIMB_PAIR(0xA37C1F2F, 0x9C65B1F8), LIMB_PAIR(0x996231F0, 0x6D946DF3), LIMB_PAIR(0xF3574FEB, 0x201EACBC),
+            LIMB_PAIR(0xFA5BEC75, 0x2C6287F9), LIMB_PAIR(0xB736EA2A, 0x0BF3E245), LIMB_PAIR(0x0C02BCBF, 0x8915EDB1), LIMB_PAIR(0xCFB7E1CF, 0xEE1762B6), LIMB_PARTIAL(0x0E2),
+            LIMB_PAIR(0x7E9B5EBB, 0x75DF9F82), LIMB_PAIR(0x75856008, 0x212082C2), LIMB_PAIR(0xCFA5D8C1, 0x6F396D2A), LIMB_PAIR(0x6BCBDFE9, 0x08311CAF),
+            LIMB_PAIR(0xA0BB9F1C, 0x388B553B), LIMB_PAIR(0x020D8CEB, 0x8C674F9B), LIMB_PAIR(0x9709618D, 0x2C668AD2), LIMB_PAIR(0x1FE83DCF, 0x119B437B), LIMB_PARTIAL(0x12F)
+        },
+        {   // 7 * 16^120 * G
+            LIMB_PAIR(0x373055FD, 0x28B3C1E7), LIMB_PAIR(0x066CC9BF, 0x8B5A5FDE), LIMB_PAIR(0x4C213824, 0xF1F38698), LIMB_PAIR(0xE7069ACA, 0xD3F812F6),
+            LIMB_PAIR(0x410B8E51, 0x7AF66243), LIMB_PAIR(0xCCDBEB09, 0xB0B2C6CA), LIMB_PAIR(0xF5EB1DAA, 0x3C31D93A), LIMB_PAIR(0x8FCFD3FA, 0x487DA2D2), LIMB_PARTIAL(0x03B),
+            LIMB_PAIR(0xD1091BCE, 0x111B77E8), LIMB_PAIR(0x8F9A76F9, 0x12FD3BAE), LIMB_PAIR(0x100340A2, 0x737049CE), LIMB_PAIR(0x577FED17, 0xF514BE2E),
+            LIMB_PAIR(0xBAA6A384, 0x40E9F3E8), LIMB_PAIR(0x4DF98480, 0xCB4AF017), LIMB_PAIR(0xA9C0A1AF, 0x3A5E3983), LIMB_PAIR(0x05B9D797, 0x7CA6BDAF), LIMB_PARTIAL(0x05F)
+        },
+        {   // 8 * 16^120 * G
+            LIMB_PAIR(0x2D7E7BE5, 0x5ABD7021), LIMB_PAIR(0xB01CCA76, 0x5AE72DD6), LIMB_PAIR(0x99FA6345, 0xBA2A1794), LIMB_PAIR(0xB5D0CB9B, 0xBD22D699),
+            LIMB_PAIR(0xFCE9C6B9, 0xDE336ADF), LIMB_PAIR(0xFB816436, 0x602DC43C), LIMB_PAIR(0x33B17E66, 0x9D86318F), LIMB_PAIR(0xDCDD628D, 0x43F8EE75), LIMB_PARTIAL(0x0E6),
+            LIMB_PAIR(0x3D223930, 0x1BF13BBA), LIMB_PAIR(0x3B6B0034, 0xD77BBB12), LIMB_PAIR(0xBE34BAC8, 0xA4EA21C4), LIMB_PAIR(0xAAB61589, 0x95E5F221),
+            LIMB_PAIR(0x9D411C28, 0xB4494EB7), LIMB_PAIR(0xCBE6FAA1, 0xA423C6F5), LIMB_PAIR(0xA6E4E735, 0xAB882EE7), LIMB_PAIR(0x546545B3, 0xB36EACDB), LIMB_PARTIAL(0x0C2)
+        }
+    },
+#endif
+#if (121 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^121 * G
+            LIMB_PAIR(0x13B42E63, 0x651B47C8), LIMB_PAIR(0x16BEE2B6, 0xE7054413), LIMB_PAIR(0x86A71AC0, 0xDCF60CA3), LIMB_PAIR(0xE3BAF787, 0xABDDB357),
+            LIMB_PAIR(0x81A2DB2D, 0x99D631D1), LIMB_PAIR(0xC8C9B834, 0x3F1E3C7F), LIMB_PAIR(0x61ADF4D7, 0x3B30FA18), LIMB_PAIR(0x14B9F46B, 0xD1D8D980), LIMB_PARTIAL(0x139),
+            LIMB_PAIR(0xF6AF1252, 0xAE6F6B72), LIMB_PAIR(0x4FF8A00B, 0x0FC58398), LIMB_PAIR(0xA81FD641, 0x1B2C0CC5), LIMB_PAIR(0xE68B6FBA, 0xBDCAABE6),
+            LIMB_PAIR(0x70B14E44, 0xD1AF82FE), LIMB_PAIR(0xE55CE735, 0xE9C35419), LIMB_PAIR(0x01DCEFB9, 0x3C83D9DC), LIMB_PAIR(0xFB5824C9, 0x42604200), LIMB_PARTIAL(0x11F)
+        },
+        {   // 2 * 16^121 * G
+            LIMB_PAIR(0x4D245501, 0xC4C1D506), LIMB_PAIR(0x1083602A, 0xC7C62E34), LIMB_PAIR(0x61F152C7, 0xD5D68959), LIMB_PAIR(0x906E6F00, 0x3B142866),
+            LIMB_PAIR(0x3468335B, 0xFA4D7AEC), LIMB_PAIR(0xF4687F7F, 0x6C36DA5C), LIMB_PAIR(0x0DC658DA, 0x6643389B), LIMB_PAIR(0xD8447DE8, 0x99CB5866), LIMB_PARTIAL(0x037),
+            LIMB_PAIR(0x807A703E, 0x0FECFBAB), LIMB_PAIR(0xEE68C875, 0xECA0BD01), LIMB_PAIR(0x20D8BDD0, 0x375589C9), LIMB_PAIR(0x14025692, 0xC0FBD62F),
+            LIMB_PAIR(0xE6B70D27, 0xBF5A0C1E), LIMB_PAIR(0x9CBBB1AE, 0xF9630AED), LIMB_PAIR(0xBA99B392, 0x9776ABEB), LIMB_PAIR(0xC97978C6, 0x883C8B53), LIMB_PARTIAL(0x095)
+        },
+        {   // 3 * 16^121 * G
+            LIMB_PAIR(0xE22F1171, 0x753CE74A), LIMB_PAIR(0x15F959EE, 0xAE29377F), LIMB_PAIR(0xDACE4BDC, 0x90D8C9C5), LIMB_PAIR(0xAB4DCFFC, 0x45F210F7),
+            LIMB_PAIR(0xE1283166, 0x32135E10), LIMB_PAIR(0x32072197, 0x23A06109), LIMB_PAIR(0x4D767572, 0x4D3CCCB7), LIMB_PAIR(0x807A50D1, 0xCCDC43A3), LIMB_PARTIAL(0x0E5),
+            LIMB_PAIR(0x6880D712, 0x6A553420), LIMB_PAIR(0xDD80C4CB, 0x92B60F04), LIMB_PAIR(0xDCC9D35D, 0xF3538BA2), LIMB_PAIR(0xD0787305, 0xD3166FAF),
+            LIMB_PAIR(0xB7D68560, 0xD2A1B177), LIMB_PAIR(0x5E9F7915, 0x847AAF90), LIMB_PAIR(0x5B83CC7A, 0x210046E5), LIMB_PAIR(0xB4964926, 0xD26CE0BD), LIMB_PARTIAL(0x179)
+        },
+        {   // 4 * 16^121 * G
+            LIMB_PAIR(0xE5F5826E, 0xDCBFBB8B), LIMB_PAIR(0x2954969B, 0x31FBD1C0), LIMB_PAIR(0x09536E44, 0x452C254D), LIMB_PAIR(0x36CD821C, 0x6B733E3B),
+            LIMB_PAIR(0x2D8260F9, 0x8FDFE02F), LIMB_PAIR(0x0E2A44E3, 0x26163D81), LIMB_PAIR(0x3E2E3A4F, 0x23E435A3), LIMB_PAIR(0x777BAA61, 0xCD8529B5), LIMB_PARTIAL(0x1C0),
+            LIMB_PAIR(0xA246D14E, 0x634DD97A), LIMB_PAIR(0xD443A978, 0xDFED13A7), LIMB_PAIR(0x8752BEC5, 0x4668E97A), LIMB_PAIR(0x26A0F8E7, 0x1F52F428),
+            LIMB_PAIR(0x308DDFF1, 0x0D69A760), LIMB_PAIR(0x591ED51E, 0x54602BF7), LIMB_PAIR(0x3BBAB1B8, 0x223E342B), LIMB_PAIR(0xD5003EF7, 0x1CF905CB), LIMB_PARTIAL(0x132)
+        },
+        {   // 5 * 16^121 * G
+            LIMB_PAIR(0xDED7931A, 0xDEBD96EC), LIMB_PAIR(0xDFDB9955, 0x409A230C), LIMB_PAIR(0xB65C48E6, 0x0EAE02D5), LIMB_PAIR(0x3515EDC3, 0x3AB3DFF8),
+            LIMB_PAIR(0x3D119F82, 0x0440A0C5), LIMB_PAIR(0xF7B8048F, 0x7601D278), LIMB_PAIR(0x53655D73, 0x3E0DA581), LIMB_PAIR(0x42C66D32, 0xA04162F3), LIMB_PARTIAL(0x0B9),
+            LIMB_PAIR(0xE0D030B2, 0xDC305022), LIMB_PAIR(0xAF7D339E, 0xB812C6A1), LIMB_PAIR(0x91973A30, 0xF845455F), LIMB_PAIR(0x54ADE939, 0x3A40C4D4),
+            LIMB_PAIR(0x1E0972BF, 0x7D5B0F69), LIMB_PAIR(0x8839861A, 0x7EADF7A2), LIMB_PAIR(0x7D36E5A8, 0x87A2E706), LIMB_PAIR(0xD13C7670, 0xA25554C5), LIMB_PARTIAL(0x055)
+        },
+        {   // 6 * 16^121 * G
+            LIMB_PAIR(0x7E791A5F, 0xFC6E3ABD), LIMB_PAIR(0x394F9865, 0x8B60A8B7), LIMB_PAIR(0xB0F31984, 0xF07F164C), LIMB_PAIR(0x35FBCDD5, 0x3B0F7BE1),
+            LIMB_PAIR(0xC372E0EC, 0xFA914A53), LIMB_PAIR(0x0392F749, 0x6142002A), LIMB_PAIR(0x952CCAB5, 0x8F7DDC3B), LIMB_PAIR(0xA5E85E1D, 0xCEC17DDF), LIMB_PARTIAL(0x1A1),
+            LIMB_PAIR(0x3BFB6450, 0x376E182E), LIMB_PAIR(0x5874742E, 0x34275E3B), LIMB_PAIR(0x36FD4D5B, 0xC6C3BBC4), LIMB_PAIR(0x17024A3F, 0xD5359A5F),
+            LIMB_PAIR(0xBE783D99, 0x690901D1), LIMB_PAIR(0xBE92B949, 0xD98F0714), LIMB_PAIR(0xFA44B971, 0xD7FF8E0F), LIMB_PAIR(0xA248A978, 0xAE0B1EA4), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 7 * 16^121 * G
+            LIMB_PAIR(0x2C79E1E7, 0x8EC2BC82), LIMB_PAIR(0xFFB8B4D4, 0xEC5C692C), LIMB_PAIR(0x0846B9F3, 0xA0D4D509), LIMB_PAIR(0x33456629, 0x41EACCAC),
+            LIMB_PAIR(0xD484F510, 0x43E23429), LIMB_PAIR(0x5018896D, 0x0BF959D3), LIMB_PAIR(0xF257DAF3, 0xA817BFED), LIMB_PAIR(0xA1FB8E26, 0xCD04BC49), LIMB_PARTIAL(0x0BC),
+            LIMB_PAIR(0xD92BCED4, 0xDA060441), LIMB_PAIR(0x5D4EF4F0, 0x278C04C9), LIMB_PAIR(0x396B753D, 0x8B6F0231), LIMB_PAIR(0x4533E041, 0xF68CAA50),
+            LIMB_PAIR(0xD52BC9BC, 0x49D2F5F1), LIMB_PAIR(0x0141E329, 0x83AC5515), LIMB_PAIR(0xC866B038, 0x453951C6), LIMB_PAIR(0x79ACDC69, 0x09B032D4), LIMB_PARTIAL(0x196)
+        },
+        {   // 8 * 16^121 * G
+            LIMB_PAIR(0xE9933309, 0x1AE0819B), LIMB_PAIR(0x232A74BF, 0xDF8BDB84), LIMB_PAIR(0x756981F5, 0xE0CD42AC), LIMB_PAIR(0x6734B942, 0x65812818),
+            LIMB_PAIR(0xF4ACCF5F, 0x6B63D0A2), LIMB_PAIR(0x55294162, 0x4DC5D87A), LIMB_PAIR(0x30BC9A8A, 0x0BA927B2), LIMB_PAIR(0xD8E36A78, 0xCDAAE01E), LIMB_PARTIAL(0x13B),
+            LIMB_PAIR(0x8E1F565F, 0xBB632BFE), LIMB_PAIR(0x53E94443, 0x29EBFDDA), LIMB_PAIR(0xE10D165B, 0x1F98A0D3), LIMB_PAIR(0x637C795F, 0x9F82830C),
+            LIMB_PAIR(0x40E0C47B, 0x3B331287), LIMB_PAIR(0xF4BEE639, 0x8940D375), LIMB_PAIR(0x8B8AD839, 0x05CC4DC3), LIMB_PAIR(0x10D505EA, 0x3B4D9DBE), LIMB_PARTIAL(0x117)
+        }
+    },
+#endif
+#if (122 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^122 * G
+            LIMB_PAIR(0x66BC31A5, 0x8DD33D1C), LIMB_PAIR(0x9D19C1C0, 0x80A07495), LIMB_PAIR(0xE03A1EE5, 0xDA13C485), LIMB_PAIR(0x68ACFD38, 0x316D85F9),
+            LIMB_PAIR(0x0D9D6273, 0x8617C80D), LIMB_PAIR(0xF94D5F22, 0x6DDEBB71), LIMB_PAIR(0x8EFD0A44, 0x1C345203), LIMB_PAIR(0x7B3746E3, 0x7CA0B406), LIMB_PARTIAL(0x07B),
+            LIMB_PAIR(0x87436D56, 0xBEC7B150), LIMB_PAIR(0xA01F6C04, 0x07CF1192), LIMB_PAIR(0xF73971B0, 0x047B37F6), LIMB_PAIR(0x5AE1F9D4, 0x7E7D8B9B),
+            LIMB_PAIR(0xCA1A9900, 0x0E311B4F), LIMB_PAIR(0x6A81FB38, 0x5DC55F3D), LIMB_PAIR(0x2956AF04, 0xE257401A), LIMB_PAIR(0xF66AE95F, 0x90C2AD09), LIMB_PARTIAL(0x16B)
+        },
+        {   // 2 * 16^122 * G
+            LIMB_PAIR(0x027EFFAA, 0xA949016C), LIMB_PAIR(0xE691A213, 0xD4FB4288), LIMB_PAIR(0x7FCDFD96, 0xD18A53B1), LIMB_PAIR(0x0CE4CAC9, 0x6808BF4C),
+            LIMB_PAIR(0xBED1F520, 0x7E7DC551), LIMB_PAIR(0x2DB78FFE, 0xB84F242F), LIMB_PAIR(0x4261FDBD, 0x7E6D15D3), LIMB_PAIR(0xA8FFC498, 0x836F8254), LIMB_PARTIAL(0x0F0),
+            LIMB_PAIR(0xABE4E4F2, 0x029233DA), LIMB_PAIR(0xD0327536, 0x9617F000), LIMB_PAIR(0xDE62E889, 0x444FDC65), LIMB_PAIR(0x69512DC4, 0xF9170A99),
+            LIMB_PAIR(0x4E765028, 0xA37EDB8D), LIMB_PAIR(0x0852DC5D, 0x7C003AD0), LIMB_PAIR(0x7CDF14EF, 0x62875644), LIMB_PAIR(0x9B509913, 0x87AE7BB5), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 3 * 16^122 * G
+            LIMB_PAIR(0xA3FAA4B9, 0x15C0760B), LIMB_PAIR(0x62D67946, 0xAC263E6F), LIMB_PAIR(0x0E0F2550, 0x3F5E1ECF), LIMB_PAIR(0xFE856EC7, 0xD6F9E25D),
+            LIMB_PAIR(0x89E42E60, 0xDB3156F4), LIMB_PAIR(0x9D08DD80, 0x944CCCE2), LIMB_PAIR(0xD586A10E, 0x241B875D), LIMB_PAIR(0x8556ADCB, 0xE47CB500), LIMB_PARTIAL(0x035),
+            LIMB_PAIR(0x4F99CE2F, 0x9C259AA7), LIMB_PAIR(0x17FE9E72, 0x74198282), LIMB_PAIR(0xCE9D9617, 0x53B45886), LIMB_PAIR(0x9541BD1F, 0xBC7EE9C5),
+            LIMB_PAIR(0x91A3D63E, 0x0B985162), LIMB_PAIR(0x358B75AB, 0x6E75F3F8), LIMB_PAIR(0x2440CCDF, 0x34AFDC0E), LIMB_PAIR(0x47A18648, 0x0F8D214F), LIMB_PARTIAL(0x15C)
+        },
+        {   // 4 * 16^122 * G
+            LIMB_PAIR(0x088A01D8, 0x51199E42), LIMB_PAIR(0x0E6C6197, 0xA9C97019), LIMB_PAIR(0xEC9F00DF, 0xCC8BBA8A), LIMB_PAIR(0xA3534E0A, 0xDB0E728A),
+            LIMB_PAIR(0xB74D62E5, 0x4F130E04), LIMB_PAIR(0x0368BF53, 0x3E26ABBA), LIMB_PAIR(0x99D4743F, 0xF97571A5), LIMB_PAIR(0xC7EB2500, 0x64863A87), LIMB_PARTIAL(0x03A),
+            LIMB_PAIR(0xA3D02698, 0x0CBB2434), LIMB_PAIR(0x72EB32AE, 0x3C375455), LIMB_PAIR(0x8806B951, 0xF8555F57), LIMB_PAIR(0xCE2DBE0A, 0x11215434),
+            LIMB_PAIR(0x0470FB38, 0xF0D7A7F0), LIMB_PAIR(0x2707CB8E, 0xC4E0AD47), LIMB_PAIR(0xC03C9C3E, 0x4CAEF200), LIMB_PAIR(0x46612DE4, 0x5BA38938), LIMB_PARTIAL(0x1B2)
+        },
+        {   // 5 * 16^122 * G
+            LIMB_PAIR(0x2D86220C, 0x5940D1D3), LIMB_PAIR(0xF17EBB24, 0x0745F4C7), LIMB_PAIR(0x611DA884, 0x043B323D), LIMB_PAIR(0xE09E3BE1, 0x3AA9CC05),
+            LIMB_PAIR(0x9DCF7703, 0x357E6B9A), LIMB_PAIR(0x4C13C6E5, 0xF9AC02BE), LIMB_PAIR(0x3D1CCB65, 0x38212531), LIMB_PAIR(0x9AE3BF3D, 0xED41DBB9), LIMB_PARTIAL(0x074),
+            LIMB_PAIR(0x4139B92E, 0xFB7FC637), LIMB_PAIR(0xA50A76AD, 0x46D5B8DE), LIMB_PAIR(0x07BE1EB9, 0x281AC30F), LIMB_PAIR(0xCB7414A9, 0x059DEB0C),
+            LIMB_PAIR(0x1CCEC832, 0xEA9DF76D), LIMB_PAIR(0x0DC155E1, 0x0BD186D0), LIMB_PAIR(0x329513CF, 0xF39D6482), LIMB_PAIR(0x10911066, 0xAB97B70C), LIMB_PARTIAL(0x163)
+        },
+        {   // 6 * 16^122 * G
+            LIMB_PAIR(0xCA6A97A2, 0xDB80EDC1), LIMB_PAIR(0x0D490A50, 0x86308030), LIMB_PAIR(0xDA57ED02, 0x66962687), LIMB_PAIR(0xB1645904, 0xD2115BA4),
+            LIMB_PAIR(0xF4BB7C96, 0x22E6F7E8), LIMB_PAIR(0x78A63416, 0x2C2BAE60), LIMB_PAIR(0x7453ACA0, 0x5D403C20), LIMB_PAIR(0xB8D26275, 0x67DECD07), LIMB_PARTIAL(0x068),
+            LIMB_PAIR(0x9C022066, 0x1F8495A9), LIMB_PAIR(0x484C73A5, 0x1BCD937E), LIMB_PAIR(0x1F4739A7, 0xDD61F1FB), LIMB_PAIR(0x701D4E57, 0x415B3726),
+            LIMB_PAIR(0x8F336F93, 0xBD90443F), LIMB_PAIR(0x222DB3B1, 0x594A77CA), LIMB_PAIR(0x420A4C80, 0x59358763), LIMB_PAIR(0x972EEF54, 0x8AE41A9C), LIMB_PARTIAL(0x1EC)
+        },
+        {   // 7 * 16^122 * G
+            LIMB_PAIR(0x8EEEF2D6, 0x8943A18F), LIMB_PAIR(0x8399362C, 0x2E5273F6), LIMB_PAIR(0x41DEB9C1, 0x4DBB9BEF), LIMB_PAIR(0x1088C6F4, 0x9E34C73E),
+            LIMB_PAIR(0xCC859471, 0x66047479), LIMB_PAIR(0xFB704F9B, 0xEDE1B31E), LIMB_PAIR(0xA4F3DDCF, 0x7C8FCEC4), LIMB_PAIR(0x68AACAA4, 0xC8D156E3), LIMB_PARTIAL(0x069),
+            LIMB_PAIR(0xC3D5F95F, 0x5C60E434), LIMB_PAIR(0xD2BE9D81, 0x4CDF7439), LIMB_PAIR(0x27745B69, 0xCDE0DFDD), LIMB_PAIR(0x1DE6CA4B, 0x2F64DF96),
+            LIMB_PAIR(0xD1580DF0, 0x6604CBB6), LIMB_PAIR(0xD0239649, 0x7F10BEE9), LIMB_PAIR(0xCAA1F385, 0x5A5F9B06), LIMB_PAIR(0x5287281E, 0x6C0D20A3), LIMB_PARTIAL(0x1F4)
+        },
+        {   // 8 * 16^122 * G
+            LIMB_PAIR(0xA1E703A9, 0x4F3C3BC3), LIMB_PAIR(0x0F4D9E8B, 0x134EDAC8), LIMB_PAIR(0xFE4727CD, 0x55DA5480), LIMB_PAIR(0x4C37A7B2, 0xA8F98D58),
+            LIMB_PAIR(0xC5F9592A, 0x06BC173C), LIMB_PAIR(0x5220EE93, 0xD1F2103C), LIMB_PAIR(0x7ACF01BB, 0x956EFEF6), LIMB_PAIR(0x6C878B89, 0x55746C42), LIMB_PARTIAL(0x1A2),
+            LIMB_PAIR(0x35DD9B7B, 0x19273954), LIMB_PAIR(0x2A61252B, 0xB81EF648), LIMB_PAIR(0x18236F94, 0x508F2CB8), LIMB_PAIR(0x31B04F92, 0x655EC86D),
+            LIMB_PAIR(0x381743AE, 0xDC06CE6A), LIMB_PAIR(0x37E92347, 0x46059E36), LIMB_PAIR(0xBE6A29D8, 0x6DAC815F), LIMB_PAIR(0x0B369888, 0x4B4FCF72), LIMB_PARTIAL(0x181)
+        }
+    },
+#endif
+#if (123 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^123 * G
+            LIMB_PAIR(0x72E2518A, 0x61064029), LIMB_PAIR(0x7B5FBFC1, 0xFACD33FA), LIMB_PAIR(0x7632AD67, 0xD50F7771), LIMB_PAIR(0x1F0D2282, 0xBA868807),
+            LIMB_PAIR(0x04D90803, 0xACACD911), LIMB_PAIR(0x51496EE8, 0xF94B3E0F), LIMB_PAIR(0xECE3C365, 0xFB8A5406), LIMB_PAIR(0x620400F2, 0x96F5C5E7), LIMB_PARTIAL(0x109),
+            LIMB_PAIR(0x36988CBA, 0x7389F3DD), LIMB_PAIR(0x762CA5F4, 0x4AB5C460), LIMB_PAIR(0xB5CF8989, 0x9B96CF82), LIMB_PAIR(0x158A4C79, 0x2FFA0DB5),
+            LIMB_PAIR(0x3A3D24F4, 0xB5821B1A), LIMB_PAIR(0xF8C464D0, 0x17771CB7), LIMB_PAIR(0x62C59A09, 0x9FFD7646), LIMB_PAIR(0xDC162385, 0x0EEFA35F), LIMB_PARTIAL(0x1E1)
+        },
+        {   // 2 * 16^123 * G
+            LIMB_PAIR(0x035B25A2, 0xFA050BBD), LIMB_PAIR(0x36EE92FB, 0x2A14076E), LIMB_PAIR(0x2F514218, 0x3E95A7EB), LIMB_PAIR(0xEA3B77D3, 0x8A67615D),
+            LIMB_PAIR(0x1DA9263E, 0xE2764F07), LIMB_PAIR(0x92B51D79, 0x47BBF1FF), LIMB_PAIR(0x59DF9EAC, 0x82CD0656), LIMB_PAIR(0x5E020E6F, 0xC80BB0F0), LIMB_PARTIAL(0x0B2),
+            LIMB_PAIR(0xA7560919, 0x7DAC49E7), LIMB_PAIR(0xC82B9DA0, 0x7238FA6E), LIMB_PAIR(0xFF7CACEC, 0x3FFCF645), LIMB_PAIR(0xBE9302CE, 0x72087198),
+            LIMB_PAIR(0x513BA920, 0x13094B5C), LIMB_PAIR(0x43EB77DE, 0x8CCA51F3), LIMB_PAIR(0x60B89283, 0xEFFE0E7D), LIMB_PAIR(0xDF9075DE, 0x036368BF), LIMB_PARTIAL(0x19D)
+        },
+        {   // 3 * 16^123 * G
+            LIMB_PAIR(0xEA39D3BE, 0x2FF0F1CB), LIMB_PAIR(0xC7F3195B, 0xA756A96E), LIMB_PAIR(0xDEB42713, 0x1DFBDEDF), LIMB_PAIR(0x4A87567A, 0x7CB9E1BE),
+            LIMB_PAIR(0x0D2CEC73, 0x64541AA3), LIMB_PAIR(0x0A0327B0, 0x8EEC2269), LIMB_PAIR(0x0C157F20, 0x967B1BC1), LIMB_PAIR(0x2D8969E0, 0x2A6F1A40), LIMB_PARTIAL(0x181),
+            LIMB_PAIR(0xC471C0CB, 0x42547F4C), LIMB_PAIR(0x815EF0F1, 0xB990B1A2), LIMB_PAIR(0xFBC29AAB, 0x672398CB), LIMB_PAIR(0x104AC38F, 0xFB7E649B),
+            LIMB_PAIR(0xE9CF1E5A, 0xF0BA1354), LIMB_PAIR(0x2CD48A07, 0xB0C191DA), LIMB_PAIR(0xB41854F5, 0x1FC70FCD), LIMB_PAIR(0x2504091B, 0xF1129546), LIMB_PARTIAL(0x195)
+        },
+        {   // 4 * 16^123 * G
+            LIMB_PAIR(0xA1BD56CC, 0xB8A3F6BD), LIMB_PAIR(0x2E598D13, 0x3B8F16BD), LIMB_PAIR(0xDC92BF6D, 0x304CD218), LIMB_PAIR(0xAC0B947E, 0xEC30D12D),
+            LIMB_PAIR(0xCF12510B, 0xF7FA65EC), LIMB_PAIR(0x7F2DF1DB, 0x9C45D10C), LIMB_PAIR(0xCC89CBBD, 0xAF49AAC9), LIMB_PAIR(0xA3936FF0, 0x7771C58A), LIMB_PARTIAL(0x141),
+            LIMB_PAIR(0xCD4E00AA, 0x486B202A), LIMB_PAIR(0xE9CC0CFF, 0xD4CE59C3), LIMB_PAIR(0x10DCC4F2, 0xDC299E61), LIMB_PAIR(0x559569CB, 0x64F83481),
+            LIMB_PAIR(0x297AD136, 0x005FDA65), LIMB_PAIR(0x7CAD3258, 0x929EB220), LIMB_PAIR(0x62647BF0, 0xFD85773D), LIMB_PAIR(0x177AF6A3, 0x776FBAFF), LIMB_PARTIAL(0x1A4)
+        },
+        {   // 5 * 16^123 * G
+            LIMB_PAIR(0xF794BFED, 0x49082B82), LIMB_PAIR(0xA7508BA4, 0x090AD58D), LIMB_PAIR(0xABF36DE8, 0x016C6C61), LIMB_PAIR(0xC17D97E8, 0x69744E76),
+            LIMB_PAIR(0x5087CCE7, 0x64BA471F), LIMB_PAIR(0xF3FD22DA, 0x45BAC2BB), LIMB_PAIR(0xE8F6671E, 0x1BBC08F0), LIMB_PAIR(0x268427BE, 0x6E45905D), LIMB_PARTIAL(0x07C),
+            LIMB_PAIR(0xD810AB70, 0xFDC632D4), LIMB_PAIR(0xF9546668, 0x2D68F73C), LIMB_PAIR(0x178148AB, 0xF506EF8B), LIMB_PAIR(0x162C23C7, 0x95DB78DF),
+            LIMB_PAIR(0x33DBAE55, 0x4DF86CB9), LIMB_PAIR(0x7D81EDC1, 0xE47825B7), LIMB_PAIR(0x56E1496E, 0xBE784190), LIMB_PAIR(0x48F497EC, 0xD707FA3A), LIMB_PARTIAL(0x008)
+        },
+        {   // 6 * 16^123 * G
+            LIMB_PAIR(0x77528DA4, 0xC2EC5AEE), LIMB_PAIR(0xB12E7DA5, 0x3C8C6F50), LIMB_PAIR(0x75E8FD04, 0xE36D0B47), LIMB_PAIR(0x7E0189C5, 0x49AFFCE8),
+            LIMB_PAIR(0xE166E234, 0x2C23922D), LIMB_PAIR(0x7E52C62F, 0x44F5033A), LIMB_PAIR(0x0E1DD67D, 0x1D3B1A48), LIMB_PAIR(0x80FF9F3A, 0xC5306935), LIMB_PARTIAL(0x12F),
+            LIMB_PAIR(0xF94695A9, 0xFACFB18B), LIMB_PAIR(0x3A8C9298, 0xDA2EA390), LIMB_PAIR(0xB18C310A, 0xF8A29D06), LIMB_PAIR(0x046BD445, 0x10BEE839),
+            LIMB_PAIR(0x094093BC, 0xA78643A0), LIMB_PAIR(0xA2C10FCA, 0x77CD1796), LIMB_PAIR(0x5AC6C799, 0x5FCFED6A), LIMB_PAIR(0x82907CAE, 0x8331B5B7), LIMB_PARTIAL(0x0A7)
+        },
+        {   // 7 * 16^123 * G
+            LIMB_PAIR(0x14198957, 0x9A9D1B19), LIMB_PAIR(0xB8B27468, 0x09272B36), LIMB_PAIR(0x78D8695E, 0xA8ADB294), LIMB_PAIR(0x28E6B551, 0xB2A77EF9),
+            LIMB_PAIR(0x71983BBD, 0xB92C59A1), LIMB_PAIR(0x37661116, 0xAE272180), LIMB_PAIR(0x9058858F, 0x8AEDB3DD), LIMB_PAIR(0x716B7A4D, 0x2EA5BEBD), LIMB_PARTIAL(0x188),
+            LIMB_PAIR(0xB534AC3F, 0x43BCD03E), LIMB_PAIR(0x8D025A80, 0x0A3A6429), LIMB_PAIR(0xDCAA5EA0, 0x3E6A0674), LIMB_PAIR(0x2A7BED53, 0xA0B44692),
+            LIMB_PAIR(0x7D1D2FDC, 0x962C4543), LIMB_PAIR(0xE3EC4A2C, 0x4651CCF2), LIMB_PAIR(0xA883B3F8, 0xAA08F169), LIMB_PAIR(0x513A5D60, 0xBCD939E4), LIMB_PARTIAL(0x1B8)
+        },
+        {   // 8 * 16^123 * G
+            LIMB_PAIR(0xB2648196, 0xAF9BF352), LIMB_PAIR(0x042FE760, 0x00A9569D), LIMB_PAIR(0xB9D94444, 0x43854E69), LIMB_PAIR(0x6E3392B7, 0xA01A2645),
+            LIMB_PAIR(0x86C0702C, 0x43D8AE36), LIMB_PAIR(0xDD0F9617, 0xB658EDEE), LIMB_PAIR(0x8B270AB3, 0x0676B0EF), LIMB_PAIR(0x02072F7C, 0x71CEBA8F), LIMB_PARTIAL(0x1DA),
+            LIMB_PAIR(0x4D9BC7BB, 0xAF1B398D), LIMB_PAIR(0x30E4A71E, 0xE6F033C9), LIMB_PAIR(0x1C8D3FD5, 0x38919B42), LIMB_PAIR(0x31065BB9, 0x4DCA8A1F),
+            LIMB_PAIR(0x0BD4BEA3, 0xBA5A637E), LIMB_PAIR(0x9A42D432, 0x30F886EB), LIMB_PAIR(0x000FCD13, 0x1E7C0FA3), LIMB_PAIR(0x7299786B, 0x9DFFAC1D), LIMB_PARTIAL(0x0DA)
+        }
+    },
+#endif
+#if (124 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^124 * G
+            LIMB_PAIR(0x945039AC, 0x0CE1F2D1), LIMB_PAIR(0xFDF94D41, 0x1D1E6504), LIMB_PAIR(0x8752D630, 0xF36EAFD5), LIMB_PAIR(0xEFBF0132, 0x24477F7F),
+            LIMB_PAIR(0xC02BF85B, 0xAE8FBA2C), LIMB_PAIR(0xEB510E61, 0x53A24CA8), LIMB_PAIR(0x9C2C453D, 0xEADBC7F7), LIMB_PAIR(0x310EDA46, 0xCFDBC9DC), LIMB_PARTIAL(0x1A9),
+            LIMB_PAIR(0xD8F82B51, 0xFBF287C8), LIMB_PAIR(0x7F0ECADA, 0xB7CA6096), LIMB_PAIR(0x15242666, 0x1DC411B7), LIMB_PAIR(0x3DC6ED96, 0xEBF82D6C),
+            LIMB_PAIR(0xD0A92B49, 0x8F82229D), LIMB_PAIR(0x9DAC585A, 0x75A6A4A7), LIMB_PAIR(0xC839248A, 0x443AE75E), LIMB_PAIR(0x1BA7C9C3, 0x4DEFB89F), LIMB_PARTIAL(0x1B5)
+        },
+        {   // 2 * 16^124 * G
+            LIMB_PAIR(0x72925756, 0x20E2FE19), LIMB_PAIR(0x32CE7832, 0x4815AE33), LIMB_PAIR(0xEB8F4EB7, 0x183D90C3), LIMB_PAIR(0x2A8045D9, 0x0E088AF5),
+            LIMB_PAIR(0xDA04790F, 0xF8232956), LIMB_PAIR(0xEA0118C0, 0xC24661B5), LIMB_PAIR(0xA72924A6, 0xE4152695), LIMB_PAIR(0x40AB56B7, 0xFFCB2778), LIMB_PARTIAL(0x120),
+            LIMB_PAIR(0xAAE9AF57, 0x1C766208), LIMB_PAIR(0x239689E7, 0x21769DDA), LIMB_PAIR(0x235ECF56, 0x9DC2194A), LIMB_PAIR(0xCF83A067, 0x930E993F),
+            LIMB_PAIR(0x32913E2A, 0xB6725AD3), LIMB_PAIR(0xFC942B50, 0x09BD9FF9), LIMB_PAIR(0x600D426D, 0xDFB47D67), LIMB_PAIR(0x9DEF7175, 0x4CC06C58), LIMB_PARTIAL(0x03B)
+        },
+        {   // 3 * 16^124 * G
+            LIMB_PAIR(0x065D6929, 0x68205CA5), LIMB_PAIR(0x039168C3, 0x15F79567), LIMB_PAIR(0x74DD0EFE, 0x055D11E3), LIMB_PAIR(0x980ED709, 0x13D65191),
+            LIMB_PAIR(0x91CB9DAE, 0xC819A8BF), LIMB_PAIR(0xC7A39E18, 0xD1EF1626), LIMB_PAIR(0x274C7AD7, 0x1CFED493), LIMB_PAIR(0xAA0280F5, 0xB2FF9CC1), LIMB_PARTIAL(0x1A0),
+            LIMB_PAIR(0x82BBE037, 0xAFEE1166), LIMB_PAIR(0x5DD65916, 0xF54D3BF0), LIMB_PAIR(0x47DA6A80, 0xCF8D694E), LIMB_PAIR(0x787E892E, 0xC350309B),
+            LIMB_PAIR(0xF87D2CA5, 0x13A4BDBF), LIMB_PAIR(0x0ABC535B, 0xE5C927D1), LIMB_PAIR(0x8D2B5113, 0x5532B565), LIMB_PAIR(0xD904BB5C, 0xC0F0222F), LIMB_PARTIAL(0x1F5)
+        },
+        {   // 4 * 16^124 * G
+            LIMB_PAIR(0x39926493, 0x9C3F0829), LIMB_PAIR(0xE3D0F530, 0x6BF1089E), LIMB_PAIR(0x7D7D5B4C, 0x3E91285D), LIMB_PAIR(0x02BB958A, 0xD8D70F1B),
+            LIMB_PAIR(0xBDBD2B6E, 0xE4B0E8C1), LIMB_PAIR(0x9239F187, 0xEA70F107), LIMB_PAIR(0x27D37CA6, 0xD30F4ADA), LIMB_PAIR(0xC88EDA99, 0x0358F6B3), LIMB_PARTIAL(0x10C),
+            LIMB_PAIR(0xE385AC45, 0x8957EA97), LIMB_PAIR(0xB4FF3D17, 0x707E7445), LIMB_PAIR(0x40A361CF, 0x4A6D4DC8), LIMB_PAIR(0x13AAE7DB, 0xD086353B),
+            LIMB_PAIR(0xA478B479, 0xD856F4C9), LIMB_PAIR(0x4D7CF67D, 0xF687400F), LIMB_PAIR(0xCE52336B, 0xFA3000B6), LIMB_PAIR(0xD0B88A94, 0x805459D7), LIMB_PARTIAL(0x1EC)
+        },
+        {   // 5 * 16^124 * G
+            LIMB_PAIR(0x48237525, 0x532BD215), LIMB_PAIR(0xF826B4E5, 0xBB14742D), LIMB_PAIR(0x4D9F4791, 0xDDADBE44), LIMB_PAIR(0x6344CDDF, 0xCDD681D7),
+            LIMB_PAIR(0xB5AF617C, 0x721F15A2), LIMB_PAIR(0x7433253C, 0x2740BC18), LIMB_PAIR(0xA3C6809A, 0x727759A2), LIMB_PAIR(0xE802EB9E, 0x2128A7A5), LIMB_PARTIAL(0x07D),
+            LIMB_PAIR(0xD9C2052A, 0x41B7109E), LIMB_PAIR(0x71A26434, 0xA0CB7262), LIMB_PAIR(0xACA51897, 0x50F1DC72), LIMB_PAIR(0x67067A10, 0x28CACA35),
+            LIMB_PAIR(0xCD61B985, 0xAB969C93), LIMB_PAIR(0x491A61D2, 0xD3986E20), LIMB_PAIR(0xDC034A35, 0xCFD5713C), LIMB_PAIR(0x0525F8AA, 0x6FAD3626), LIMB_PARTIAL(0x1B3)
+        },
+        {   // 6 * 16^124 * G
+            LIMB_PAIR(0xABE029FD, 0x96632B75), LIMB_PAIR(0x57AAA853, 0x38280DBD), LIMB_PAIR(0x56556BF7, 0x2A49FF19), LIMB_PAIR(0x017AD9E7, 0x76AF8029),
+            LIMB_PAIR(0x65EA6EDF, 0xE2319792), LIMB_PAIR(0x9CBB4069, 0x71B0793C), LIMB_PAIR(0xF62D86DD, 0x1F89D54D), LIMB_PAIR(0x52809190, 0x48601CBD), LIMB_PARTIAL(0x116),
+            LIMB_PAIR(0x95F5317C, 0x825A9EC2), LIMB_PAIR(0x5B568F34, 0x9AF04499), LIMB_PAIR(0x70C96172, 0x0A74E926), LIMB_PAIR(0x9CBE4CA2, 0xA87FCC84),
+            LIMB_PAIR(0x17B5587B, 0x409E58C0), LIMB_PAIR(0x686599F1, 0xAE221D81), LIMB_PAIR(0x9B04AE84, 0xDB87C25E), LIMB_PAIR(0xF9A49CB1, 0x2A847873), LIMB_PARTIAL(0x19A)
+        },
+        {   // 7 * 16^124 * G
+            LIMB_PAIR(0x0ADFEE2F, 0x8104E371), LIMB_PAIR(0x3A0AAF8B, 0x021A434F), LIMB_PAIR(0xA2908065, 0xD2A2E82C), LIMB_PAIR(0x1E0D4B4D, 0x770F059D),
+            LIMB_PAIR(0x962BA072, 0x7B4DEFE2), LIMB_PAIR(0x31DD59BE, 0x81835947), LIMB_PAIR(0xD6638F80, 0xDA69E9A5), LIMB_PAIR(0x114759D3, 0x58F0BCA6), LIMB_PARTIAL(0x154),
+            LIMB_PAIR(0x9EF7A0C7, 0x0DB1AA52), LIMB_PAIR(0x16F4ABF3, 0xB2450BD8), LIMB_PAIR(0xAD0D02AA, 0x0670492C), LIMB_PAIR(0xE2C5C42B, 0x6CDB3460),
+            LIMB_PAIR(0xDDF42A06, 0x663BD232), LIMB_PAIR(0xF76EBEF0, 0x23550ED5), LIMB_PAIR(0x8D9CCB9C, 0x0FC63284), LIMB_PAIR(0xD425EF44, 0xEB0B313F), LIMB_PARTIAL(0x01A)
+        },
+        {   // 8 * 16^124 * G
+            LIMB_PAIR(0xBEB4F9F1, 0xE862A17B), LIMB_PAIR(0x310C4B65, 0x5E701369), LIMB_PAIR(0x3377F678, 0x01EF6625), LIMB_PAIR(0xDA8BEB61, 0x56157709),
+            LIMB_PAIR(0x9EF7DA41, 0x7CA21B04), LIMB_PAIR(0x88E486A6, 0x9F776DAC), LIMB_PAIR(0x8AED6F6C, 0x53DD04CF), LIMB_PAIR(0x953C2D95, 0x4A7DF43E), LIMB_PARTIAL(0x158),
+            LIMB_PAIR(0x1FCC4484, 0xE5BC0DED), LIMB_PAIR(0xEF6D0E8A, 0xB337EB4E), LIMB_PAIR(0xDABF0D9E, 0x02208B42), LIMB_PAIR(0x467BFC55, 0xE64C8529),
+            LIMB_PAIR(0x2E141810, 0x0CF40959), LIMB_PAIR(0x56FA0BAD, 0xA34AF9D6), LIMB_PAIR(0x5345141C, 0xF3471D5A), LIMB_PAIR(0x1FF7597E, 0x89A7A82C), LIMB_PARTIAL(0x14E)
+        }
+    },
+#endif
+#if (125 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^125 * G
+            LIMB_PAIR(0x3C80F820, 0x4270A797), LIMB_PAIR(0xD8E3DB55, 0xE1455E1C), LIMB_PAIR(0xC31EEA36, 0xFC7D04B5), LIMB_PAIR(0x8237619E, 0x86D4B43D),
+            LIMB_PAIR(0x5696AC8B, 0xCA90FEAD), LIMB_PAIR(0xBE0A5D49, 0xD1DF350D), LIMB_PAIR(0xAEA06270, 0x844E818F), LIMB_PAIR(0xD89CC1DC, 0xFA19B70B), LIMB_PARTIAL(0x0FB),
+            LIMB_PAIR(0x52FE816F, 0xBAE72FF5), LIMB_PAIR(0x9A5A3747, 0x7B5D9E52), LIMB_PAIR(0xA689A68A, 0x7A7EADCC), LIMB_PAIR(0x330BA649, 0x18DEC239),
+            LIMB_PAIR(0xEB30BD8F, 0xAFC49E4C), LIMB_PAIR(0x80C1A715, 0x25042716), LIMB_PAIR(0xBF6E92D9, 0x4D5AAFFF), LIMB_PAIR(0x7577CC4F, 0x94AF51FB), LIMB_PARTIAL(0x1B9)
+        },
+        {   // 2 * 16^125 * G
+            LIMB_PAIR(0x60637AB1, 0x513A0C62), LIMB_PAIR(0x92C5B308, 0x4A25BEE0), LIMB_PAIR(0x65D8B6A4, 0xCD3DDE92), LIMB_PAIR(0x60EA70D4, 0xCE8ECE9B),
+            LIMB_PAIR(0xAF5D779F, 0x289B7557), LIMB_PAIR(0xFF6459CF, 0x1DF029A4), LIMB_PAIR(0xCE09288B, 0xD00AC6D5), LIMB_PAIR(0x9A9F5B92, 0x9A9F9685), LIMB_PARTIAL(0x06F),
+            LIMB_PAIR(0xB5B63CD8, 0x18CB0922), LIMB_PAIR(0x26FD1C21, 0xD4753FF1), LIMB_PAIR(0x1080DAC9, 0xA4D1F357), LIMB_PAIR(0x24DE88C3, 0x7FE4F3AC),
+            LIMB_PAIR(0x3E60655C, 0x4BA767DA), LIMB_PAIR(0x36C75E45, 0xAF4A6474), LIMB_PAIR(0x95F2505F, 0x4854EB21), LIMB_PAIR(0xFE3B33EF, 0x831446CF), LIMB_PARTIAL(0x16D)
+        },
+        {   // 3 * 16^125 * G
+            LIMB_PAIR(0x3E0BEF3F, 0x8E1A6C2F), LIMB_PAIR(0x14018B23, 0xB715403E), LIMB_PAIR(0x613F0C37, 0xEFC99827), LIMB_PAIR(0x13170A30, 0x92437B56),
+            LIMB_PAIR(0x9468E300, 0xE84CBE8F), LIMB_PAIR(0x4BAB3970, 0xE69B08F1), LIMB_PAIR(0x1558E9D6, 0xFCB78F77), LIMB_PAIR(0xAF25ED50, 0xC0140529), LIMB_PARTIAL(0x17E),
+            LIMB_PAIR(0x168134C6, 0xFF3FA668), LIMB_PAIR(0x2BCC2E99, 0x46E8EDC7), LIMB_PAIR(0x86BFBF06, 0xBBEBB21C), LIMB_PAIR(0xF204DD32, 0x6B7D6159),
+            LIMB_PAIR(0x1FC7E40A, 0x75BB85EC), LIMB_PAIR(0xAD14C187, 0x0F3E1043), LIMB_PAIR(0x000A86BA, 0x44187117), LIMB_PAIR(0x13D09DEF, 0x556420BB), LIMB_PARTIAL(0x177)
+        },
+        {   // 4 * 16^125 * G
+            LIMB_PAIR(0xA9AFF80C, 0xEDBB59DC), LIMB_PAIR(0x305107CC, 0xB32F9F1D), LIMB_PAIR(0x99D4D1F8, 0x7A0DE3D1), LIMB_PAIR(0x0637729E, 0x701B0485),
+            LIMB_PAIR(0xB86C08AF, 0x13D85CC4), LIMB_PAIR(0xCD43B0E7, 0xFE4B62A8), LIMB_PAIR(0x8A012627, 0xBA8BA3F3), LIMB_PAIR(0x2168BDF6, 0xA589240B), LIMB_PARTIAL(0x073),
+            LIMB_PAIR(0xD8F16B56, 0x028C8C11), LIMB_PAIR(0x53816648, 0xFF6F2AA7), LIMB_PAIR(0x29BBD5AB, 0x677B98AB), LIMB_PAIR(0x221F17F2, 0x492513B8),
+            LIMB_PAIR(0xA5ECA5AA, 0x828FA4BA), LIMB_PAIR(0x560D8196, 0x15B65B2B), LIMB_PAIR(0x77FE2F2D, 0x737CDF43), LIMB_PAIR(0xC044CC80, 0xCB1BC918), LIMB_PARTIAL(0x138)
+        },
+        {   // 5 * 16^125 * G
+            LIMB_PAIR(0x3B50A230, 0xF0FA90D8), LIMB_PAIR(0xFD95910F, 0xDD15885F), LIMB_PAIR(0x48038A64, 0x4105A4E1), LIMB_PAIR(0xAE07FCD1, 0x2F69D817),
+            LIMB_PAIR(0xD0484F76, 0x0536353F), LIMB_PAIR(0xB8D64BAA, 0xB3BEB1EE), LIMB_PAIR(0x58ADC510, 0x2FF37FF5), LIMB_PAIR(0x49F78E1F, 0x5677B991), LIMB_PARTIAL(0x1B0),
+            LIMB_PAIR(0x43B8275E, 0xE22BF1CE), LIMB_PAIR(0xB7BC2931, 0x5EC18F04), LIMB_PAIR(0xF01FA620, 0xCB53D3E0), LIMB_PAIR(0x9587E525, 0x49DB793F),
+            LIMB_PAIR(0x5C884F2D, 0x7F1E4CA3), LIMB_PAIR(0x59437624, 0x5AD4E4C4), LIMB_PAIR(0x4994207A, 0xA1E3329F), LIMB_PAIR(0x88594AEF, 0xE4CB938F), LIMB_PARTIAL(0x1CE)
+        },
+        {   // 6 * 16^125 * G
+            LIMB_PAIR(0xAAFD5467, 0x00A2AD7E), LIMB_PAIR(0xF9741F30, 0xA8290D94), LIMB_PAIR(0xA3D3ADC7, 0x6173F2E7), LIMB_PAIR(0x68875A74, 0x0AD6AB54),
+            LIMB_PAIR(0x24328133, 0x48E49F03), LIMB_PAIR(0x19E27E19, 0x2D2D704A), LIMB_PAIR(0xDE1ED374, 0x3BD63D36), LIMB_PAIR(0xC0AC7774, 0xDEBC4384), LIMB_PARTIAL(0x195),
+            LIMB_PAIR(0x6FD61140, 0xEABAFCE8), LIMB_PAIR(0x22938DF5, 0xEF8C38AF), LIMB_PAIR(0x3C98D287, 0x407C6D24), LIMB_PAIR(0x85564DD7, 0x75BC6986),
+            LIMB_PAIR(0x4C9D6C14, 0x240A470C), LIMB_PAIR(0x8AECA79E, 0x9CDC41FF), LIMB_PAIR(0xE1DD8F22, 0xCF08ACAE), LIMB_PAIR(0x0D69225A, 0x2D99CBE5), LIMB_PARTIAL(0x0DF)
+        },
+        {   // 7 * 16^125 * G
+            LIMB_PAIR(0x734C5662, 0xCD2CDD2E), LIMB_PAIR(0x52FCD5A2, 0x086508DD), LIMB_PAIR(0x65545779, 0xD1789E1F), LIMB_PAIR(0x3EBF0E2E, 0xA3E5A37A),
+            LIMB_PAIR(0x21F33614, 0xA648B511), LIMB_PAIR(0x000154BE, 0xC1B816D4), LIMB_PAIR(0xA8F82A71, 0x7D9C4292), LIMB_PAIR(0x6F43867B, 0xF0F81CB8), LIMB_PARTIAL(0x01B),
+            LIMB_PAIR(0x2B51C7D5, 0x1FE1F996), LIMB_PAIR(0x06A54F1C, 0x5C77E780), LIMB_PAIR(0xDCFA901B, 0x79DC60E2), LIMB_PAIR(0xBBD1244E, 0x2C548507),
+            LIMB_PAIR(0x15CA7601, 0x59CCE9C3), LIMB_PAIR(0x8F106B96, 0x2EC82571), LIMB_PAIR(0xF5DC4E24, 0xC1EBCF8D), LIMB_PAIR(0x1448C529, 0xB785EE5F), LIMB_PARTIAL(0x0D5)
+        },
+        {   // 8 * 16^125 * G
+            LIMB_PAIR(0xDB0E34F0, 0xBF2B204C), LIMB_PAIR(0xB55297CF, 0x177EE402), LIMB_PAIR(0x0905589D, 0x1008722A), LIMB_PAIR(0x965EF825, 0x92BE4754),
+            LIMB_PAIR(0xEEEF76A6, 0x4CE902BD), LIMB_PAIR(0x4F318009, 0x55B91071), LIMB_PAIR(0x1484B98F, 0x96BEAE61), LIMB_PAIR(0x35B88659, 0x5D84B615), LIMB_PARTIAL(0x15A),
+            LIMB_PAIR(0x1D78D96A, 0x43C74CE3), LIMB_PAIR(0xA17753BA, 0x131FBC58), LIMB_PAIR(0xDC789AAC, 0x4E430AF6), LIMB_PAIR(0xE9AF4951, 0x31F38805),
+            LIMB_PAIR(0xA61CBB24, 0x834DE4AA), LIMB_PAIR(0xF678C74A, 0x8437617E), LIMB_PAIR(0xE030372E, 0x411E5009), LIMB_PAIR(0xA2047BCF, 0xBE15903C), LIMB_PARTIAL(0x01A)
+        }
+    },
+#endif
+#if (126 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^126 * G
+            LIMB_PAIR(0x9DA7BB54, 0xFC5BA8D5), LIMB_PAIR(0xA7C7FBCB, 0x29F3E817), LIMB_PAIR(0xA40AD3FC, 0x31A34412), LIMB_PAIR(0x2D1711B0, 0xE17B9369),
+            LIMB_PAIR(0x16EE6505, 0x41C7BC17), LIMB_PAIR(0x3D1DB8CA, 0x5FEECFFD), LIMB_PAIR(0x02F9E04E, 0xCBB93378), LIMB_PAIR(0x091DB41E, 0xAEB67B8B), LIMB_PARTIAL(0x187),
+            LIMB_PAIR(0x4C695615, 0x611FE09D), LIMB_PAIR(0x323B6DCC, 0x087334F6), LIMB_PAIR(0xD53BCFDC, 0xF7BD51BB), LIMB_PAIR(0x5A8BCDB4, 0x98AB5C92),
+            LIMB_PAIR(0xCCCD6F6A, 0xE7E9D273), LIMB_PAIR(0x24B4A3EA, 0x2582B219), LIMB_PAIR(0xF22C4405, 0xF8FEA0E3), LIMB_PAIR(0xD3E5A701, 0x42C0F700), LIMB_PARTIAL(0x06D)
+        },
+        {   // 2 * 16^126 * G
+            LIMB_PAIR(0xCF6368A6, 0xE9F67439), LIMB_PAIR(0x4C1C8628, 0xF570101A), LIMB_PAIR(0xC652A95D, 0xF3CCE189), LIMB_PAIR(0x75CEDBF5, 0x85A1AF6B),
+            LIMB_PAIR(0x68D0FFBC, 0x8B7F513D), LIMB_PAIR(0x136394BE, 0xC71778FB), LIMB_PAIR(0xD99C9F74, 0xD0E7F981), LIMB_PAIR(0x6471443B, 0x6A4AE0F4), LIMB_PARTIAL(0x18E),
+            LIMB_PAIR(0x1F3F2C6D, 0x702BF663), LIMB_PAIR(0xCEDAD859, 0xC1233CDE), LIMB_PAIR(0x98C674EA, 0xA8EA4A83), LIMB_PAIR(0xF3C423C5, 0x338B3334),
+            LIMB_PAIR(0xDC103DC3, 0xBEA2BBF7), LIMB_PAIR(0x0FBD8A4C, 0xD49C4A62), LIMB_PAIR(0x57B93DA1, 0xA73566DE), LIMB_PAIR(0xF56838B4, 0x0AD24597), LIMB_PARTIAL(0x127)
+        },
+        {   // 3 * 16^126 * G
+            LIMB_PAIR(0x76F468B8, 0x38E5B06F), LIMB_PAIR(0xC79FA86D, 0xEAB47690), LIMB_PAIR(0x6EF8CD4A, 0x990E59DE), LIMB_PAIR(0x6884D059, 0x826C78E8),
+            LIMB_PAIR(0x341B20F7, 0x951732FE), LIMB_PAIR(0x449DDAE6, 0xF249FAE4), LIMB_PAIR(0xA30A08AF, 0x32C4B1E5), LIMB_PAIR(0x15BE777B, 0x79FB2CAB), LIMB_PARTIAL(0x027),
+            LIMB_PAIR(0xC3F609D4, 0x1C65411B), LIMB_PAIR(0x6194FA7E, 0x4A8EC137), LIMB_PAIR(0xA41C5F89, 0x025DD9CA), LIMB_PAIR(0xE9D5AA4B, 0x878F8D01),
+            LIMB_PAIR(0x0F364D3B, 0x34C9E12E), LIMB_PAIR(0x344CF712, 0x5F4403D0), LIMB_PAIR(0x5BEA60C3, 0xE66BB782), LIMB_PAIR(0xD40E673A, 0x4DC50E44), LIMB_PARTIAL(0x125)
+        },
+        {   // 4 * 16^126 * G
+            LIMB_PAIR(0xF8CB0CDF, 0x104E0C37), LIMB_PAIR(0xB934F03F, 0xBA344BC4), LIMB_PAIR(0x0A5AA9D6, 0xF963FC25), LIMB_PAIR(0x662E69CB, 0x8BBF6E9E),
+            LIMB_PAIR(0x16FCA9B1, 0x5B9945C9), LIMB_PAIR(0x682C739F, 0x6805ABD3), LIMB_PAIR(0xC3F18432, 0x3D1EE371), LIMB_PAIR(0x05E69189, 0x4708B55C), LIMB_PARTIAL(0x1E8),
+            LIMB_PAIR(0x143EC89C, 0x9682D9D3), LIMB_PAIR(0xB2B5914F, 0x519A8B7A), LIMB_PAIR(0xFA9D63C6, 0x7FB197F1), LIMB_PAIR(0xD19FD1D8, 0x6C4D61EE),
+            LIMB_PAIR(0xD637793D, 0x3A2A488E), LIMB_PAIR(0x1FFC620D, 0x1DBB1B1A), LIMB_PAIR(0x4B551244, 0x66EAB052), LIMB_PAIR(0x434C6CC1, 0x290E50FD), LIMB_PARTIAL(0x0CF)
+        },
+        {   // 5 * 16^126 * G
+            LIMB_PAIR(0x6221C6F8, 0x4515DA10), LIMB_PAIR(0xBD34CAF6, 0xBF5FD8E5), LIMB_PAIR(0xC7A869A1, 0x9174AD19), LIMB_PAIR(0x57152EF1, 0x3E327C13),
+            LIMB_PAIR(0x222CBBE4, 0x58656B31), LIMB_PAIR(0x1C4191EF, 0x11189214), LIMB_PAIR(0xB7143EC8, 0xA5E5AD3E), LIMB_PAIR(0x4536E2FD, 0xE0646AFA), LIMB_PARTIAL(0x0E9),
+            LIMB_PAIR(0x6D16BAE5, 0xB13D2448), LIMB_PAIR(0xAF57B380, 0x42431B34), LIMB_PAIR(0x5E097FD6, 0xCAFE4101), LIMB_PAIR(0xE5B0937F, 0x5F794CD6),
+            LIMB_PAIR(0x55270A50, 0x4DE1813D), LIMB_PAIR(0xB660BC2B, 0xCA0A5C09), LIMB_PAIR(0x76579886, 0x08F20F6B), LIMB_PAIR(0x2ADA1C30, 0x21268E68), LIMB_PARTIAL(0x0B1)
+        },
+        {   // 6 * 16^126 * G
+            LIMB_PAIR(0x98C439D0, 0x9793778B), LIMB_PAIR(0x2AF8CE86, 0x79788F59), LIMB_PAIR(0x146D0C4F, 0xC1520A86), LIMB_PAIR(0x596B5B59, 0x541063DA),
+            LIMB_PAIR(0x9EBA6471, 0x47823A1E), LIMB_PAIR(0x1D23923F, 0x7F66A389), LIMB_PAIR(0x452ECBDB, 0x4B23C930), LIMB_PAIR(0xE30657BE, 0x40C7D3DD), LIMB_PARTIAL(0x0F0),
+            LIMB_PAIR(0x77D535C7, 0xB63D974A), LIMB_PAIR(0xCA31932F, 0x2E16AC32), LIMB_PAIR(0x2B8664B1, 0x68DA3CD1), LIMB_PAIR(0xCEE5478D, 0xC895A61F),
+            LIMB_PAIR(0x42C0AC31, 0x34BBAC90), LIMB_PAIR(0xA3267F5E, 0x5CDBD70D), LIMB_PAIR(0xB4A7AE31, 0x8B4D75BE), LIMB_PAIR(0xF43C9C86, 0x1555CAF3), LIMB_PARTIAL(0x039)
+        },
+        {   // 7 * 16^126 * G
+            LIMB_PAIR(0xC0D037F7, 0x50714FB3), LIMB_PAIR(0x8C050618, 0x071BFA5B), LIMB_PAIR(0x9D15E2F1, 0x7F179826), LIMB_PAIR(0x29E730FA, 0x20810397),
+            LIMB_PAIR(0xB45794D1, 0x7948C181), LIMB_PAIR(0x171227AC, 0xC8FBDEE3), LIMB_PAIR(0x45DA4E9C, 0x1FAA4670), LIMB_PAIR(0x0D3FE74B, 0x565405C0), LIMB_PARTIAL(0x07C),
+            LIMB_PAIR(0x3F42236A, 0x353FC94A), LIMB_PAIR(0x7BC40D6C, 0x684A11C2), LIMB_PAIR(0x52826E75, 0x182CA3AF), LIMB_PAIR(0xD4058F7F, 0x7B24ECCC),
+            LIMB_PAIR(0x82386F7B, 0x6CADB9BA), LIMB_PAIR(0x3567D0EA, 0xEEBCDEB5), LIMB_PAIR(0x1E8C8CE2, 0x904FD55C), LIMB_PAIR(0x6B578B37, 0x43FD20DB), LIMB_PARTIAL(0x0A5)
+        },
+        {   // 8 * 16^126 * G
+            LIMB_PAIR(0x310BE81B, 0x842E5742), LIMB_PAIR(0x815531F2, 0x9CD6A5AC), LIMB_PAIR(0x37F9F02F, 0x1C8179B8), LIMB_PAIR(0x4FAC713B, 0x009CFA29),
+            LIMB_PAIR(0xD2AA2C79, 0x091F5101), LIMB_PAIR(0xEF9256C6, 0x70360695), LIMB_PAIR(0xFAD0A22A, 0xD8D52D11), LIMB_PAIR(0x40FF5EE7, 0xF395FEF2), LIMB_PARTIAL(0x1AB),
+            LIMB_PAIR(0x46CCCDE9, 0xFBD0E2D7), LIMB_PAIR(0xF8D82FE8, 0x8E8A81F7), LIMB_PAIR(0xC0766BF2, 0x63BB8CE1), LIMB_PAIR(0xC70E96E5, 0x917BA75A),
+            LIMB_PAIR(0x93D4D0FE, 0x2BAF9FA4), LIMB_PAIR(0xC28324D4, 0xA203F382), LIMB_PAIR(0xB1B2C7D3, 0x36385F59), LIMB_PAIR(0x2C80EE37, 0x746BCE12), LIMB_PARTIAL(0x1E1)
+        }
+    },
+#endif
+#if (127 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^127 * G
+            LIMB_PAIR(0xA3A2BE76, 0x312DC896), LIMB_PAIR(0x61DA109B, 0x9E77C0C3), LIMB_PAIR(0xBF0993BE, 0xB1C5379D), LIMB_PAIR(0xB7BCC4DD, 0x9272B9E8),
+            LIMB_PAIR(0x09337D54, 0x5437F625), LIMB_PAIR(0xCF735302, 0x5C897A61), LIMB_PAIR(0x002DB288, 0x368E21CA), LIMB_PAIR(0x184AEE4A, 0x33197CC1), LIMB_PARTIAL(0x1AF),
+            LIMB_PAIR(0xE5C35F69, 0x76EC7312), LIMB_PAIR(0xC07874D4, 0x6832A65A), LIMB_PAIR(0xC121E8C9, 0x398DAB5A), LIMB_PAIR(0x97B47C38, 0xF88AA2C8),
+            LIMB_PAIR(0x07678CF3, 0xFC77E1C0), LIMB_PAIR(0x345A9B89, 0x7327A90F), LIMB_PAIR(0x49240B3E, 0x267417A0), LIMB_PAIR(0xE3912921, 0x3AA3EA97), LIMB_PARTIAL(0x116)
+        },
+        {   // 2 * 16^127 * G
+            LIMB_PAIR(0x92E6CD70, 0x11771BFC), LIMB_PAIR(0x65C65A34, 0xF5BD487F), LIMB_PAIR(0x081B98D1, 0x1B3CB720), LIMB_PAIR(0x026B378F, 0x32485EC4),
+            LIMB_PAIR(0x529C1313, 0xE3C71A99), LIMB_PAIR(0x3526EF07, 0xC85BDE7D), LIMB_PAIR(0x84E3DBEB, 0xA85C138B), LIMB_PAIR(0xA239B5A7, 0xE6E886AF), LIMB_PARTIAL(0x0F4),
+            LIMB_PAIR(0x6E2040FE, 0xF65240A5), LIMB_PAIR(0x16AF1685, 0x1596F108), LIMB_PAIR(0xB90B3A9C, 0x20B38D3E), LIMB_PAIR(0x9C3FDF7A, 0x81A30FEB),
+            LIMB_PAIR(0x3731C3BF, 0x04031BB3), LIMB_PAIR(0xAD2B6D6E, 0xADFE3FB3), LIMB_PAIR(0x0FEE06E0, 0x243B3623), LIMB_PAIR(0x25D016E6, 0x2BC6DF92), LIMB_PARTIAL(0x053)
+        },
+        {   // 3 * 16^127 * G
+            LIMB_PAIR(0xDBA3263A, 0x29D30CCF), LIMB_PAIR(0x58F319D0, 0x3DDEC6F4), LIMB_PAIR(0xAA8889DE, 0x6859BE59), LIMB_PAIR(0x37E57788, 0xD21B5A3F),
+            LIMB_PAIR(0x8E56E5F0, 0x0BC2F50B), LIMB_PAIR(0x2B8C2B6D, 0xB76D24E4), LIMB_PAIR(0x5731D66F, 0xD7B4C557), LIMB_PAIR(0x8A0E50A1, 0x59D33A6E), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0x57DC5E0B, 0x4DECDB8E), LIMB_PAIR(0xD8E33978, 0xE1FD10AE), LIMB_PAIR(0x17F26C32, 0xBC70D10B), LIMB_PAIR(0xA9D2255D, 0x15026720),
+            LIMB_PAIR(0xFB625FFA, 0x68A1E644), LIMB_PAIR(0x0B24BB44, 0xDD3DCA9F), LIMB_PAIR(0xF8932BC0, 0x3A192D90), LIMB_PAIR(0x76268713, 0x0F7120B4), LIMB_PARTIAL(0x0D5)
+        },
+        {   // 4 * 16^127 * G
+            LIMB_PAIR(0x7D7D3912, 0xFA594425), LIMB_PAIR(0xF57DC595, 0x208AF690), LIMB_PAIR(0x8287E9A5, 0xA277E980), LIMB_PAIR(0xD556FA0B, 0xFE15C6E2),
+            LIMB_PAIR(0x81A8260C, 0x4B4612EE), LIMB_PAIR(0xCDA05AB2, 0x6E171BD7), LIMB_PAIR(0xDE584E28, 0xC417D3D1), LIMB_PAIR(0x8EFF9FF5, 0xAFF5E9B9), LIMB_PARTIAL(0x188),
+            LIMB_PAIR(0xC6C3151A, 0xB0700568), LIMB_PAIR(0x1F049293, 0xCCD55DC0), LIMB_PAIR(0x443D10A0, 0x7C6E61AB), LIMB_PAIR(0x0A4546A9, 0x9C2C964B),
+            LIMB_PAIR(0x7FA4474D, 0xF470D97E), LIMB_PAIR(0x74B749FD, 0x378D416F), LIMB_PAIR(0x1D9FEA8F, 0xC821766F), LIMB_PAIR(0x2E3D8DD9, 0x71C9FAB0), LIMB_PARTIAL(0x027)
+        },
+        {   // 5 * 16^127 * G
+            LIMB_PAIR(0x8CE85B23, 0x24B869A6), LIMB_PAIR(0x63B5011F, 0xCAEDAAFF), LIMB_PAIR(0x82987CA1, 0xC8B5D84E), LIMB_PAIR(0xA44A8BBB, 0xC6960DFE),
+            LIMB_PAIR(0x9FDC95CE, 0x83D1EC6B), LIMB_PAIR(0x2D666E45, 0xF30C2D5E), LIMB_PAIR(0x6D92A25B, 0xEB743DA7), LIMB_PAIR(0xBAF0F20B, 0x3F4AC0F3), LIMB_PARTIAL(0x1EC),
+            LIMB_PAIR(0x10321910, 0x5DD95183), LIMB_PAIR(0x1DD9D170, 0xFB9C06AD), LIMB_PAIR(0xD5F9DBC6, 0x020AC2DA), LIMB_PAIR(0x372D2ADE, 0x9A9E842B),
+            LIMB_PAIR(0x09A85C7F, 0xD62D4C64), LIMB_PAIR(0xCCD72A88, 0xF12BFF21), LIMB_PAIR(0x7FEE26FA, 0xDB1876D4), LIMB_PAIR(0xC202BE11, 0x27913F5C), LIMB_PARTIAL(0x1A1)
+        },
+        {   // 6 * 16^127 * G
+            LIMB_PAIR(0x02E1C728, 0x44CC7FB1), LIMB_PAIR(0x34A729F4, 0xA957A60D), LIMB_PAIR(0xDFC2755F, 0xED0B434A), LIMB_PAIR(0x959B558E, 0x4E195EA0),
+            LIMB_PAIR(0x651796C4, 0x5162B567), LIMB_PAIR(0x1BE4A6BA, 0x4B5E7FE6), LIMB_PAIR(0xB5A306D4, 0xB280A035), LIMB_PAIR(0x547F4D84, 0x321DF371), LIMB_PARTIAL(0x020),
+            LIMB_PAIR(0x7641D9B6, 0xC86D0154), LIMB_PAIR(0x04BC36BF, 0x4261B77D), LIMB_PAIR(0xCB4B8484, 0x054BD171), LIMB_PAIR(0xA159E1B8, 0x7ADA14DD),
+            LIMB_PAIR(0xA575A44A, 0x2EF6737A), LIMB_PAIR(0x8F7DD923, 0x8C0B3BDF), LIMB_PAIR(0xB01C493C, 0xA656A2A7), LIMB_PAIR(0x0C530D3F, 0x83D77F41), LIMB_PARTIAL(0x1CB)
+        },
+        {   // 7 * 16^127 * G
+            LIMB_PAIR(0xE6C5B553, 0x5438F933), LIMB_PAIR(0x1C80ACAC, 0x6F01A8A4), LIMB_PAIR(0x9EB0B0F8, 0x5A25BD9B), LIMB_PAIR(0x12959E24, 0xDF47BE5C),
+            LIMB_PAIR(0xE5B854AC, 0x10D9338F), LIMB_PAIR(0xE7C3F1FD, 0x8545EB47), LIMB_PAIR(0xD5A20D8A, 0x18E1F37B), LIMB_PAIR(0x7A837AA9, 0x222A7056), LIMB_PARTIAL(0x155),
+            LIMB_PAIR(0xA2862A80, 0x213B368C), LIMB_PAIR(0x668758C8, 0x67A67CFA), LIMB_PAIR(0x0E3C7BAD, 0xB262ABB1), LIMB_PAIR(0xED814AA0, 0xD310888E),
+            LIMB_PAIR(0x6BDE422B, 0x1F258409), LIMB_PAIR(0xD8D5E8DF, 0x7505C265), LIMB_PAIR(0x12EB7885, 0xBC7CC14E), LIMB_PAIR(0x9B41D8C0, 0xA78E6416), LIMB_PARTIAL(0x097)
+        },
+        {   // 8 * 16^127 * G
+            LIMB_PAIR(0x88468571, 0xBBA0D1F9), LIMB_PAIR(0x14EDF415, 0x4B15325D), LIMB_PAIR(0x5B315437, 0xBA40AD2E), LIMB_PAIR(0x5214DEB0, 0x4CCE24B4),
+            LIMB_PAIR(0xF3217CA3, 0x33CCC948), LIMB_PAIR(0x8D2D7D56, 0xC9A387C8), LIMB_PAIR(0x1569445E, 0x19C90892), LIMB_PAIR(0xC50A9417, 0x6B925FF0), LIMB_PARTIAL(0x1AF),
+            LIMB_PAIR(0x7FA33215, 0x55FCFC76), LIMB_PAIR(0x3E2B25B5, 0x2B7B6638), LIMB_PAIR(0x602D0860, 0xB765A15B), LIMB_PAIR(0x1A252B65, 0xEFDEBACE),
+            LIMB_PAIR(0xF315947E, 0x8117E367), LIMB_PAIR(0x501FA6A2, 0xBDD3A76A), LIMB_PAIR(0xF4B0CC16, 0x0F224474), LIMB_PAIR(0x515F0DCB, 0x694E2254), LIMB_PARTIAL(0x13E)
+        }
+    },
+#endif
+#if (128 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^128 * G
+            LIMB_PAIR(0x56B092A2, 0x22B8ECCB), LIMB_PAIR(0x736EA9AA, 0x0A47D70E), LIMB_PAIR(0xD64A7D08, 0x3EEFC772), LIMB_PAIR(0xBB2E0F14, 0x85408CEC),
+            LIMB_PAIR(0x285CB70E, 0x73047AFD), LIMB_PAIR(0x63297A2A, 0x1732F016), LIMB_PAIR(0x4CF37EAC, 0x4DFE656A), LIMB_PAIR(0xC0EC357B, 0x147D6D66), LIMB_PARTIAL(0x0C7),
+            LIMB_PAIR(0x3C115125, 0x1F3E5910), LIMB_PAIR(0xBFB07241, 0x0D2D18FC), LIMB_PAIR(0xBA4B009D, 0x5D6AA860), LIMB_PAIR(0x806FF8ED, 0x8D0D9368),
+            LIMB_PAIR(0x1A05C049, 0xCC5CA370), LIMB_PAIR(0xE9AB4C41, 0x7BF21CAE), LIMB_PAIR(0x001D5CCA, 0x6632C3E0), LIMB_PAIR(0xB60E5593, 0x3A4F99B6), LIMB_PARTIAL(0x008)
+        },
+        {   // 2 * 16^128 * G
+            LIMB_PAIR(0xE6B2853F, 0xAED7666A), LIMB_PAIR(0xBE96140B, 0xA1FC0332), LIMB_PAIR(0x1C1E38B1, 0xB99A5DC8), LIMB_PAIR(0xF38C5243, 0x56194675),
+            LIMB_PAIR(0x80D38681, 0x16C6F80E), LIMB_PAIR(0x14205F46, 0x11178413), LIMB_PAIR(0x6EE03089, 0xD2DC67BC), LIMB_PAIR(0xD3DAD965, 0x5E18245E), LIMB_PARTIAL(0x1E3),
+            LIMB_PAIR(0xFDA7741E, 0x389E59CA), LIMB_PAIR(0x259E4DCB, 0xF341D649), LIMB_PAIR(0x260B32B0, 0xEC15D27A), LIMB_PAIR(0x07640CEA, 0xF3A1A082),
+            LIMB_PAIR(0x6E811313, 0x15AC3145), LIMB_PAIR(0x7CF68896, 0xB9027CE4), LIMB_PAIR(0x7008A356, 0xB43E4FD7), LIMB_PAIR(0x640C2C60, 0x541AA5B4), LIMB_PARTIAL(0x1C3)
+        },
+        {   // 3 * 16^128 * G
+            LIMB_PAIR(0x4CB99695, 0x3C32F4E3), LIMB_PAIR(0xC1241E0C, 0x0DB56646), LIMB_PAIR(0x28515D66, 0xA4CEA13B), LIMB_PAIR(0x5F3AB5DC, 0x1C8F6397),
+            LIMB_PAIR(0x4DEFD3EB, 0xD466A1B3), LIMB_PAIR(0xE6D860D2, 0xCDBB66B5), LIMB_PAIR(0xFE87183E, 0x26FC2FD5), LIMB_PAIR(0xD18233A9, 0x02D81A03), LIMB_PARTIAL(0x0D2),
+            LIMB_PAIR(0xCAA08959, 0xDC570644), LIMB_PAIR(0xCF763C20, 0x7791CC35), LIMB_PAIR(0x272A1068, 0x3C0DC132), LIMB_PAIR(0xC8A74578, 0xD7AD702C),
+            LIMB_PAIR(0xADA1D72C, 0x7689C46E), LIMB_PAIR(0x2B8B4369, 0xBFC2E06F), LIMB_PAIR(0xC0BBD6C4, 0xDE85E36E), LIMB_PAIR(0xF9849084, 0xD879E086), LIMB_PARTIAL(0x077)
+        },
+        {   // 4 * 16^128 * G
+            LIMB_PAIR(0xDBA16581, 0xEF192AED), LIMB_PAIR(0x2E8DB0FD, 0xFF134211), LIMB_PAIR(0xBDCA8D0D, 0x32551C61), LIMB_PAIR(0xC55B9AA3, 0x96E1FF06),
+            LIMB_PAIR(0x7E4C635F, 0xA211B110), LIMB_PAIR(0x7C4B6B4A, 0x2708E542), LIMB_PAIR(0xA6575526, 0x70FF7C3F), LIMB_PAIR(0x36092EC8, 0xD26E2DB6), LIMB_PARTIAL(0x1AE),
+            LIMB_PAIR(0x533251D0, 0x1FAFD3C2), LIMB_PAIR(0x8A9A439D, 0x1602462D), LIMB_PAIR(0x1CC5AF27, 0xC057595A), LIMB_PAIR(0xBE839C9A, 0xA27197F3),
+            LIMB_PAIR(0xBFC1318A, 0x03C1CC4B), LIMB_PAIR(0x34D0A378, 0xB78C7B7F), LIMB_PAIR(0x161B4257, 0x0F9D754E), LIMB_PAIR(0xF355D916, 0x8DCF43CB), LIMB_PARTIAL(0x194)
+        },
+        {   // 5 * 16^128 * G
+            LIMB_PAIR(0xDC3577EC, 0x51DF490D), LIMB_PAIR(0x7E28BE3E, 0x6D8A70E9), LIMB_PAIR(0x1DE95E73, 0xD87A7ED3), LIMB_PAIR(0xA6C7086E, 0xF97C968D),
+            LIMB_PAIR(0x6B4AFE00, 0xC47B64DC), LIMB_PAIR(0x8B432676, 0x489F1D98), LIMB_PAIR(0xF72C2153, 0x9F2B7996), LIMB_PAIR(0xF820AF70, 0x4ACD5AE8), LIMB_PARTIAL(0x1A9),
+            LIMB_PAIR(0xD7263FCF, 0xA5CC854B), LIMB_PAIR(0x864FEBF7, 0x7BD94B2F), LIMB_PAIR(0x9460C5D4, 0xB3DEF0FF), LIMB_PAIR(0x042D47B5, 0x5F0766B5),
+            LIMB_PAIR(0x8AE51B32, 0x9E8484F2), LIMB_PAIR(0xF8C729E7, 0x26EC4EA6), LIMB_PAIR(0x6C2AD315, 0xF279D733), LIMB_PAIR(0xDAC3E8D0, 0xB2D22E6E), LIMB_PARTIAL(0x0F6)
+        },
+        {   // 6 * 16^128 * G
+            LIMB_PAIR(0x5967B43C, 0xB2B4D408), LIMB_PAIR(0xF35923D2, 0xC660C6C1), LIMB_PAIR(0xA27FDE01, 0x696D9140), LIMB_PAIR(0x259432A9, 0xFCD766EB),
+            LIMB_PAIR(0xCAD2A4E0, 0x6831FDE1), LIMB_PAIR(0x928838EA, 0xA157BE88), LIMB_PAIR(0x791D2740, 0x4B31C1D6), LIMB_PAIR(0x850A1760, 0xF1958BBA), LIMB_PARTIAL(0x085),
+            LIMB_PAIR(0xD777E0D8, 0x23A6800E), LIMB_PAIR(0x71CB04D2, 0x84D2780D), LIMB_PAIR(0xD7A8F688, 0x691076F7), LIMB_PAIR(0xE2237B7F, 0xCFF1A453),
+            LIMB_PAIR(0x0A9037D4, 0xB1D9DD8F), LIMB_PAIR(0xD9199814, 0xFACE3A31), LIMB_PAIR(0xDA563993, 0xFF7BFC81), LIMB_PAIR(0xC61DD36E, 0xA0F655AB), LIMB_PARTIAL(0x111)
+        },
+        {   // 7 * 16^128 * G
+            LIMB_PAIR(0x5D73ED9A, 0x43C5BDF1), LIMB_PAIR(0xE71C6E7F, 0xE3766738), LIMB_PAIR(0x3947EA97, 0x625CB8C4), LIMB_PAIR(0x82241BA7, 0xADF7CCC0),
+            LIMB_PAIR(0x07329130, 0x629F45B3), LIMB_PAIR(0x8D0C281A, 0x9CFAC174), LIMB_PAIR(0x7D14CA06, 0x92069E57), LIMB_PAIR(0xDC9F83A5, 0xCA121495), LIMB_PARTIAL(0x0CF),
+            LIMB_PAIR(0x7DE97FCC, 0xF4E6DA37), LIMB_PAIR(0x025D39DF, 0xD3A271B7), LIMB_PAIR(0x389E12EA, 0xBF2EBFE8), LIMB_PAIR(0x32F184F2, 0xF434F299),
+            LIMB_PAIR(0x366EF539, 0xFBC3CCB9), LIMB_PAIR(0xCDEF4A8F, 0x4E159CDA), LIMB_PAIR(0xB0F0BB8E, 0xC311BD82), LIMB_PAIR(0x779669AD, 0x380B2EB1), LIMB_PARTIAL(0x0B8)
+        },
+        {   // 8 * 16^128 * G
+            LIMB_PAIR(0x1C2DF559, 0x9A0062D3), LIMB_PAIR(0x2D4E9996, 0xC130A85D), LIMB_PAIR(0x370A02F6, 0xB226E6CF), LIMB_PAIR(0x7386B10F, 0x3FA94ADE),
+            LIMB_PAIR(0xD4576547, 0xDDEC1E75), LIMB_PAIR(0x1DBA7F8F, 0x0251109D), LIMB_PAIR(0xC3A003A9, 0x9A3F5313), LIMB_PAIR(0xAB26E65E, 0x4742778B), LIMB_PARTIAL(0x094),
+            LIMB_PAIR(0xFB997E14, 0x828CA5AD), LIMB_PAIR(0x65001ED7, 0x3826B0BE), LIMB_PAIR(0xCFEC55A5, 0x53FB9CD3), LIMB_PAIR(0x31A1B7E7, 0x53E96D28),
+            LIMB_PAIR(0x24F2DFB5, 0xB5CBFDE9), LIMB_PAIR(0xE944F4A4, 0x3A26A665), LIMB_PAIR(0x34E527B2, 0xD6376398), LIMB_PAIR(0xEDADF5B8, 0x709E156D), LIMB_PARTIAL(0x18A)
+        }
+    },
+#endif
+#if (129 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^129 * G
+            LIMB_PAIR(0xDD04AFCE, 0x1D45C5C8), LIMB_PAIR(0xBBD9C392, 0xCE141A50), LIMB_PAIR(0xC9E0FC05, 0x44CA5FA5), LIMB_PAIR(0x60CCFB3C, 0x4B9496FF),
+            LIMB_PAIR(0xDB5552A6, 0xBE260BC6), LIMB_PAIR(0x7D3A7A09, 0xA0EABFDD), LIMB_PAIR(0x1C77C1F9, 0xE9CC06AE), LIMB_PAIR(0x2AABEE9E, 0xFA792D04), LIMB_PARTIAL(0x1DB),
+            LIMB_PAIR(0x72765171, 0xF2224E6F), LIMB_PAIR(0x11B89E04, 0x3F9EA548), LIMB_PAIR(0x138F1A43, 0x1E07C6EB), LIMB_PAIR(0x621F1F7E, 0xD9B61817),
+            LIMB_PAIR(0x2F69AF1A, 0x08E851AA), LIMB_PAIR(0xC0D63F32, 0x3E75DA6F), LIMB_PAIR(0xF0F0D74D, 0x49A72D31), LIMB_PAIR(0xC516A10C, 0xFCCFC561), LIMB_PARTIAL(0x09F)
+        },
+        {   // 2 * 16^129 * G
+            LIMB_PAIR(0xBC1BD2EE, 0x41B3EB86), LIMB_PAIR(0x50368484, 0x71E8430C), LIMB_PAIR(0xF2B93AD3, 0xB214E9CB), LIMB_PAIR(0x138E0EBF, 0x13F89335),
+            LIMB_PAIR(0x5E690118, 0xEC96C9C2), LIMB_PAIR(0x2C22CD4C, 0xDE786D18), LIMB_PAIR(0xE819E310, 0x5B1554AB), LIMB_PAIR(0xD01892D1, 0x399BFAB4), LIMB_PARTIAL(0x0C5),
+            LIMB_PAIR(0x2005A9F2, 0x2EFAEE91), LIMB_PAIR(0xB39471D0, 0x9CB43E2E), LIMB_PAIR(0x5CEB35C2, 0x0B0D1B56), LIMB_PAIR(0x56825120, 0x3BFF1940),
+            LIMB_PAIR(0x39A0DD54, 0xAD49B057), LIMB_PAIR(0x0E83D425, 0x35DEC8AF), LIMB_PAIR(0x687D1AC8, 0x50B91634), LIMB_PAIR(0x2F25A98D, 0x2FB0D9E4), LIMB_PARTIAL(0x07D)
+        },
+        {   // 3 * 16^129 * G
+            LIMB_PAIR(0x237051F4, 0x6DC021EF), LIMB_PAIR(0x7316F0B0, 0x5A76D8D3), LIMB_PAIR(0x9F26CF74, 0x48521AA0), LIMB_PAIR(0xC106BD9D, 0xBA0C42B0),
+            LIMB_PAIR(0x58C48BE7, 0x17BCCC45), LIMB_PAIR(0x2A7CE241, 0x434AA5B0), LIMB_PAIR(0x239AEFA5, 0xBEF8A59B), LIMB_PAIR(0xFC6FD78F, 0xCD8E682C), LIMB_PARTIAL(0x1F0),
+            LIMB_PAIR(0xEC41E617, 0x54DA0BFB), LIMB_PAIR(0x9384DBD3, 0x1D0EBCF1), LIMB_PAIR(0x3FDE74FA, 0x59EAFAB0), LIMB_PAIR(0x5E7E3E8B, 0xED3A369E),
+            LIMB_PAIR(0x2DA9F712, 0xC3F1456A), LIMB_PAIR(0x1C55F4E2, 0x62E6394A), LIMB_PAIR(0xD3D53150, 0xC54CF34A), LIMB_PAIR(0x13B480D3, 0x3849A2B2), LIMB_PARTIAL(0x1F9)
+        },
+        {   // 4 * 16^129 * G
+            LIMB_PAIR(0x9C13146E, 0x58333C8C), LIMB_PAIR(0xD5D37A5D, 0x213C8896), LIMB_PAIR(0x8FD07282, 0x18E2132D), LIMB_PAIR(0xCD7D66C7, 0x606E8133),
+            LIMB_PAIR(0x8743874B, 0x21C19A12), LIMB_PAIR(0x6DD96309, 0xE375D1F5), LIMB_PAIR(0x3E1D629C, 0xE0C48D6D), LIMB_PAIR(0xDEE22453, 0xED6ADA6C), LIMB_PARTIAL(0x15C),
+            LIMB_PAIR(0x47B194A6, 0xEA1C9745), LIMB_PAIR(0x850241E9, 0xDD549898), LIMB_PAIR(0x407CB796, 0x0E225368), LIMB_PAIR(0x427AD8D3, 0x17B59EDB),
+            LIMB_PAIR(0xC43F0A43, 0x08D4629E), LIMB_PAIR(0x5201D0A4, 0x27F4063D), LIMB_PAIR(0xA5003274, 0xF6E1518F), LIMB_PAIR(0xA3286E2C, 0xB6196E3E), LIMB_PARTIAL(0x1B8)
+        },
+        {   // 5 * 16^129 * G
+            LIMB_PAIR(0x3C9D1905, 0x24707838), LIMB_PAIR(0x3A2217ED, 0x5548F703), LIMB_PAIR(0x501C6819, 0xC62BD196), LIMB_PAIR(0xEB4FC9ED, 0xCB2C0893),
+            LIMB_PAIR(0x67C77ED0, 0x1A54E6DB), LIMB_PAIR(0x04675183, 0xA985B167), LIMB_PAIR(0xD572B956, 0x15EDCE42), LIMB_PAIR(0x744F68CE, 0xF506A80A), LIMB_PARTIAL(0x191),
+            LIMB_PAIR(0xF0E799EF, 0x8DD93D2B), LIMB_PAIR(0x5C4B3712, 0x5919D9A9), LIMB_PAIR(0x0604D46A, 0xCEE768C7), LIMB_PAIR(0x9E299096, 0x4FDB86AE),
+            LIMB_PAIR(0xF3C22CE6, 0x5B300487), LIMB_PAIR(0x45D1A7F8, 0x6C1738B1), LIMB_PAIR(0xCF13684C, 0x890F8E55), LIMB_PAIR(0xC87097D5, 0x634577CB), LIMB_PARTIAL(0x073)
+        },
+        {   // 6 * 16^129 * G
+            LIMB_PAIR(0xC2C3A0EF, 0xE2F7D8E0), LIMB_PAIR(0x7E893C1A, 0xD5486F1A), LIMB_PAIR(0x64EAA79A, 0x412EB098), LIMB_PAIR(0xFDA0477F, 0x2065D3D9),
+            LIMB_PAIR(0x7FCCCC26, 0x03BCE695), LIMB_PAIR(0x4A498C46, 0xF9AF6B2E), LIMB_PAIR(0xD14415AC, 0xC97B3036), LIMB_PAIR(0xC663AFB1, 0x135E84A3), LIMB_PARTIAL(0x094),
+            LIMB_PAIR(0xD7A1F341, 0x43441426), LIMB_PAIR(0x80DED50A, 0x22F40FD3), LIMB_PAIR(0x82EE0268, 0xB9858162), LIMB_PAIR(0x9FD98CC4, 0xE03926A6),
+            LIMB_PAIR(0x1D2E85CD, 0x4B79A6D3), LIMB_PAIR(0x52E4959D, 0x6AA9AA87), LIMB_PAIR(0x0419DAA9, 0xA99798EF), LIMB_PAIR(0x5820B4F2, 0x0475D721), LIMB_PARTIAL(0x175)
+        },
+        {   // 7 * 16^129 * G
+            LIMB_PAIR(0x4D4F6808, 0x5606F4CA), LIMB_PAIR(0xA466BD01, 0x98877BEE), LIMB_PAIR(0x351ECBE2, 0x313D57A2), LIMB_PAIR(0xF5249F37, 0xED501E47),
+            LIMB_PAIR(0xDB5B0E12, 0x8802E3E2), LIMB_PAIR(0x55588A9C, 0xC6B81A77), LIMB_PAIR(0xE68E0972, 0x3950C7E1), LIMB_PAIR(0xBECA361C, 0x9EBB46A2), LIMB_PARTIAL(0x182),
+            LIMB_PAIR(0x149CBE81, 0x9EAFD084), LIMB_PAIR(0x908FC649, 0x3130D39D), LIMB_PAIR(0x1B65FC3E, 0xF11BDD64), LIMB_PAIR(0xE249304F, 0x782F4890),
+            LIMB_PAIR(0x9CC68884, 0x052AD050), LIMB_PAIR(0x737F47FC, 0x4D830021), LIMB_PAIR(0xC4DDC5A8, 0x97E5B00E), LIMB_PAIR(0x5EAD892D, 0x01D91F25), LIMB_PARTIAL(0x1F3)
+        },
+        {   // 8 * 16^129 * G
+            LIMB_PAIR(0x8E41277F, 0x593CF410), LIMB_PAIR(0x925C9D91, 0x3AE7DB6E), LIMB_PAIR(0xA37A388E, 0x68519CA7), LIMB_PAIR(0x5BD94E48, 0xA93A2E81),
+            LIMB_PAIR(0x00EF816F, 0x2B8CDBAC), LIMB_PAIR(0xEB2796F5, 0x6FC3CAE6), LIMB_PAIR(0xF8DEDDE4, 0x253FE0D4), LIMB_PAIR(0x95ECC14F, 0x38405B30), LIMB_PARTIAL(0x092),
+            LIMB_PAIR(0x7882DF12, 0x27A7D0F6), LIMB_PAIR(0x46332549, 0x14B32642), LIMB_PAIR(0xEDA10498, 0xB8D8C3E6), LIMB_PAIR(0x2AA1CC1A, 0x6861E53C),
+            LIMB_PAIR(0xA37D7254, 0xF2BD03E3), LIMB_PAIR(0xD78B5623, 0x175C04F6), LIMB_PAIR(0x0B18C14F, 0xB3D5202F), LIMB_PAIR(0x967F2B7B, 0x30B9B0F6), LIMB_PARTIAL(0x12F)
+        }
+    },
+#endif
+#if (130 % P521_BASE_TABLE_SPACING) == 0
+    {
+        {   // 1 * 16^130 * G
+            LIMB_PAIR(0xCE8F9A17, 0x61829972), LIMB_PAIR(0xE0FDA47E, 0x2D21913C), LIMB_PAIR(0x52466C05, 0x84CB9DA2), LIMB_PAIR(0x9FD85710, 0xFCC4EAAB),
+            LIMB_PAIR(0x2F56FB90, 0xAB1EC541), LIMB_PAIR(0x6A231D4A, 0xBB435BEC), LIMB_PAIR(0xE16D3C47, 0xE1FFFEAE), LIMB_PAIR(0x0F023A36, 0xA7DB0284), LIMB_PARTIAL(0x02D),
+            LIMB_PAIR(0x38D77A9E, 0x7259E719), LIMB_PAIR(0xA3661199, 0xCD2278B1), LIMB_PAIR(0xBF6DFC59, 0xCF7FDF77), LIMB_PAIR(0x96A2B632, 0x6265F9CB),
+            LIMB_PAIR(0x4EB09C8A, 0x1365E44A), LIMB_PAIR(0x2B23BF87, 0xC1AC3054), LIMB_PAIR(0x5AAEC208, 0x3161A2C0), LIMB_PAIR(0x55DB8AE9, 0x1AF3A614), LIMB_PARTIAL(0x098)
+        },
+        {   // 2 * 16^130 * G
+            LIMB_PAIR(0x6B4C3F67, 0x82E05142), LIMB_PAIR(0x3FC34315, 0x83049259), LIMB_PAIR(0x972D1C60, 0x2B17027D), LIMB_PAIR(0x06941699, 0x650BD0DF),
+            LIMB_PAIR(0xBF06DEA4, 0xC960BCA9), LIMB_PAIR(0xF6BF6453, 0xC9B131EE), LIMB_PAIR(0x6E2A0BD0, 0xC7865C90), LIMB_PAIR(0x5D5F6799, 0xFFB964E0), LIMB_PARTIAL(0x033),
+            LIMB_PAIR(0xE9FA9189, 0x32DB85F6), LIMB_PAIR(0xB5544031, 0x3F0DEB0E), LIMB_PAIR(0x704E30BD, 0x848456BD), LIMB_PAIR(0x862032CC, 0xADE1BB0E),
+            LIMB_PAIR(0xFCF305AD, 0x8DEAE33A), LIMB_PAIR(0xC089CD96, 0x918CEA68), LIMB_PAIR(0x05A4A146, 0xEA115FB8), LIMB_PAIR(0x3633D8A2, 0x978F3A2F), LIMB_PARTIAL(0x083)
+        },
+        {   // 3 * 16^130 * G
+            LIMB_PAIR(0xB3F18230, 0x93012BBD), LIMB_PAIR(0xBE563374, 0x69B59C81), LIMB_PAIR(0x8FBD8070, 0x0FCCC941), LIMB_PAIR(0xDD353C6D, 0xB2E3E5FD),
+            LIMB_PAIR(0x65DCE413, 0x290F2D40), LIMB_PAIR(0x6598620E, 0xB79D8741), LIMB_PAIR(0x0CFA916C, 0x855ECA8C), LIMB_PAIR(0x97EFEBB1, 0x45029EA1), LIMB_PARTIAL(0x051),
+            LIMB_PAIR(0x90438BAE, 0x7C09EEF3), LIMB_PAIR(0x9EC6217D, 0x898440C5), LIMB_PAIR(0x30D90670, 0x89F13313), LIMB_PAIR(0x26AE644C, 0x15887287),
+            LIMB_PAIR(0xE83D85F0, 0x353E5BFA), LIMB_PAIR(0x456B1253, 0xE8F21860), LIMB_PAIR(0xCC75E379, 0xEB0FEDEA), LIMB_PAIR(0x19348CEC, 0x215AC252), LIMB_PARTIAL(0x057)
+        },
+        {   // 4 * 16^130 * G
+            LIMB_PAIR(0xF6F04DE3, 0xFD4ABDB4), LIMB_PAIR(0x2708B32F, 0x2D3399BB), LIMB_PAIR(0xAE7EA987, 0xE3F7A82F), LIMB_PAIR(0x11C3B0B2, 0x63F0093E),
+            LIMB_PAIR(0x50E1DC6C, 0x4E771CCB), LIMB_PAIR(0x9B91C6A3, 0xED365547), LIMB_PAIR(0x332028A9, 0x97C1FD0B), LIMB_PAIR(0x4A65ACB3, 0xE8199FE2), LIMB_PARTIAL(0x137),
+            LIMB_PAIR(0xED4F5410, 0xFF2F102F), LIMB_PAIR(0xBED8C3C0, 0xE2EC543C), LIMB_PAIR(0xD4BBFF64, 0x7C79A798), LIMB_PAIR(0xBD61BEBA, 0x5BAA5D12),
+            LIMB_PAIR(0xACCB68DD, 0xA4766859), LIMB_PAIR(0x0F18B724, 0x79FE6726), LIMB_PAIR(0xC404245D, 0xFBAA1890), LIMB_PAIR(0x1E4BE8EE, 0xEBAE71DE), LIMB_PARTIAL(0x16F)
+        },
+        {   // 5 * 16^130 * G
+            LIMB_PAIR(0x1BDD31FC, 0x895A3623), LIMB_PAIR(0xA499D99F, 0x3FF4B814), LIMB_PAIR(0xAE8418DA, 0x3B0B3BC1), LIMB_PAIR(0x5EAAA723, 0x3F6E8A89),
+            LIMB_PAIR(0x03ADBDF0, 0xF4F87E13), LIMB_PAIR(0x01852F42, 0x989FCECD), LIMB_PAIR(0xA4426BC1, 0x6DCAF5ED), LIMB_PAIR(0xA43A2BBC, 0x36F55EFE), LIMB_PARTIAL(0x0FF),
+            LIMB_PAIR(0x18832A17, 0xC7180D58), LIMB_PAIR(0x29C58F84, 0x47D76D93), LIMB_PAIR(0x6EB5288A, 0xE54ECA93), LIMB_PAIR(0x621C57B6, 0x4E7A0AE6),
+            LIMB_PAIR(0xCDAD70AF, 0x475C9919), LIMB_PAIR(0x13D73C3C, 0x5E0D5C86), LIMB_PAIR(0x15DB8108, 0xEE24C9F3), LIMB_PAIR(0x286DDBDB, 0x80FF5E2C), LIMB_PARTIAL(0x02B)
+        },
+        {   // 6 * 16^130 * G
+            LIMB_PAIR(0x871F197C, 0x2E6AD1A9), LIMB_PAIR(0xB4A58092, 0x0AF63210), LIMB_PAIR(0x42A3B0FA, 0xCB9252C2), LIMB_PAIR(0x9D528C5B, 0x06DBC314),
+            LIMB_PAIR(0x0601BB88, 0xDC521615), LIMB_PAIR(0xAA3178B4, 0x9DB07C32), LIMB_PAIR(0xC4212F12, 0xBB13186B), LIMB_PAIR(0xEEF4E9B1, 0x18BDFE06), LIMB_PARTIAL(0x11F),
+            LIMB_PAIR(0x713BBFA1, 0xF7E64B81), LIMB_PAIR(0xB932B514, 0x26344818), LIMB_PAIR(0xE7CA294A, 0x3316DD2A), LIMB_PAIR(0x2F30F1CB, 0x4B266D27),
+            LIMB_PAIR(0x0DE790F7, 0xA2642AF2), LIMB_PAIR(0x79D5ABFE, 0xCB114212), LIMB_PAIR(0x7785C36E, 0x78079048), LIMB_PAIR(0x9DB40AB5, 0x8B8A691D), LIMB_PARTIAL(0x1BB)
+        },
+        {   // 7 * 16^130 * G
+            LIMB_PAIR(0x9A44620F, 0x97169646), LIMB_PAIR(0xFCFA2EA4, 0x3523058D), LIMB_PAIR(0x167C4C8D, 0x8C3E30D1), LIMB_PAIR(0xE93A3A6A, 0xF3DE3D61),
+            LIMB_PAIR(0x642614F1, 0x56E42C97), LIMB_PAIR(0x80CC3DCE, 0x3C9C8D24), LIMB_PAIR(0x8CE9A9D8, 0x68D62A52), LIMB_PAIR(0xDF7BE32A, 0x482041D2), LIMB_PARTIAL(0x127),
+            LIMB_PAIR(0x67C7FD4B, 0xEB4439EA), LIMB_PAIR(0x0A384DB6, 0x35011732), LIMB_PAIR(0x2046F5D4, 0x19F9A338), LIMB_PAIR(0x72CACC46, 0x5DBF9FCC),
+            LIMB_PAIR(0x9BB26921, 0x732CAA31), LIMB_PAIR(0xCA05B118, 0xCD7C2088), LIMB_PAIR(0xDBC0CA1B, 0x6C815494), LIMB_PAIR(0x825890F6, 0x5334AFAB), LIMB_PARTIAL(0x053)
+        },
+        {   // 8 * 16^130 * G
+            LIMB_PAIR(0xC0F8ABEC, 0xDCD089E5), LIMB_PAIR(0x81F91EC5, 0x2D110320), LIMB_PAIR(0x8D76055E, 0x244CEF5D), LIMB_PAIR(0x1C9BDD43, 0x7202652D),
+            LIMB_PAIR(0x643F3CA7, 0x396EBF25), LIMB_PAIR(0xC983AC57, 0x811A3695), LIMB_PAIR(0x1E6E64CA, 0x7D1F29A4), LIMB_PAIR(0x80827AE1, 0x7CB13CEC), LIMB_PARTIAL(0x0C5),
+            LIMB_PAIR(0x2D5C560B, 0x16B59E9C), LIMB_PAIR(0x9DD105E4, 0x18B069A0), LIMB_PAIR(0xB6BC0C3F, 0xB7FC826B), LIMB_PAIR(0x85EA8193, 0xF6AB6C74),
+            LIMB_PAIR(0x1C4CDC7E, 0x9C768EA0), LIMB_PAIR(0xD223CCA5, 0xA7A149B4), LIMB_PAIR(0x8789B618, 0xA54DAFDC), LIMB_PAIR(0xB17328C0, 0x2656CB46), LIMB_PARTIAL(0x100)
+        }
+    },
+#endif
+};
+
+static limb_t const P521_baseOddTable[32][2 * NUM_LIMBS_521BIT] PROGMEM = {
+    {   // 1 * G
+        LIMB_PAIR(0xC2E5BD66, 0xF97E7E31), LIMB_PAIR(0x856A429B, 0x3348B3C1), LIMB_PAIR(0xA2FFA8DE, 0xFE1DC127), LIMB_PAIR(0xEFE75928, 0xA14B5E77),
+        LIMB_PAIR(0x6B4D3DBA, 0xF828AF60), LIMB_PAIR(0x053FB521, 0x9C648139), LIMB_PAIR(0x2395B442, 0x9E3ECB66), LIMB_PAIR(0x0404E9CD, 0x858E06B7), LIMB_PARTIAL(0x0C6),
+        LIMB_PAIR(0x9FD16650, 0x88BE9476), LIMB_PAIR(0xA272C240, 0x353C7086), LIMB_PAIR(0x3FAD0761, 0xC550B901), LIMB_PAIR(0x5EF42640, 0x97EE7299),
+        LIMB_PAIR(0x273E662C, 0x17AFBD17), LIMB_PAIR(0x579B4468, 0x98F54449), LIMB_PAIR(0x2C7D1BD9, 0x5C8A5FB4), LIMB_PAIR(0x9A3BC004, 0x39296A78), LIMB_PARTIAL(0x118)
+    },
+    {   // 3 * G
+        LIMB_PAIR(0xDE37AD7D, 0xA5919D2E), LIMB_PAIR(0x2C32EA05, 0xAEB49086), LIMB_PAIR(0xB59FE21B, 0x1DA6BD16), LIMB_PAIR(0x3A483205, 0xAD3F164A),
+        LIMB_PAIR(0x2D7A8DD1, 0xE5AD7A11), LIMB_PAIR(0x123D9AB9, 0xB52A6E5B), LIMB_PAIR(0xB5959479, 0xD91D6A64), LIMB_PAIR(0xDE29195D, 0x3D352443), LIMB_PARTIAL(0x1A7),
+        LIMB_PAIR(0xEE86C0E5, 0x5F588CA1), LIMB_PAIR(0x93A59042, 0xF105C9BC), LIMB_PAIR(0xDEC3C70C, 0x2D5ACED1), LIMB_PAIR(0x8DC575B0, 0x2E2DD4CF),
+        LIMB_PAIR(0xA355CEEC, 0xD2F8AB1F), LIMB_PAIR(0x2A9D0317, 0xF1557FA8), LIMB_PAIR(0xCAB814F2, 0x979F86C6), LIMB_PAIR(0xFA62DDD9, 0x9B03B97D), LIMB_PARTIAL(0x13E)
+    },
+    {   // 5 * G
+        LIMB_PAIR(0xEC8F3078, 0xD5AB5096), LIMB_PAIR(0xD8931738, 0x29D7E1E6), LIMB_PAIR(0x137E79A3, 0x7112FEAF), LIMB_PAIR(0x5E301423, 0x383C0C6D),
+        LIMB_PAIR(0xF177ACE4, 0xCF03DAB8), LIMB_PAIR(0xB53F0D24, 0x7A596EFD), LIMB_PAIR(0xC04EB0BF, 0x3DBC3391), LIMB_PAIR(0x27A432C7, 0x2BF3C529), LIMB_PARTIAL(0x065),
+        LIMB_PAIR(0xDEB090CB, 0x173CC3E8), LIMB_PAIR(0x7354F7F8, 0xD1F00725), LIMB_PAIR(0x1CF5FF79, 0x31154021), LIMB_PAIR(0x072CF374, 0xBB6897C9),
+        LIMB_PAIR(0xA0347087, 0xEDD817C9), LIMB_PAIR(0x872E0051, 0x1CD8FE8E), LIMB_PAIR(0x4A811291, 0x8A2B7311), LIMB_PAIR(0x6601D6EC, 0xE6EF1BDD), LIMB_PARTIAL(0x15B)
+    },
+    {   // 7 * G
+        LIMB_PAIR(0x2816ECD4, 0x01CEAD88), LIMB_PAIR(0xFDC2619A, 0x6F953F50), LIMB_PAIR(0xDCE3BBC4, 0xC9A6DF30), LIMB_PAIR(0xBFC698D8, 0x8C308D0A),
+        LIMB_PAIR(0xF7114C5D, 0xF018D2C2), LIMB_PAIR(0xF5483228, 0x5F22E0E8), LIMB_PAIR(0x0B073A0C, 0xEEB65FDA), LIMB_PAIR(0x5B7F6346, 0xD5D1D99D), LIMB_PARTIAL(0x056),
+        LIMB_PAIR(0x0525251B, 0x5C6B8BC9), LIMB_PAIR(0x5DDEFC7B, 0x9E76712A), LIMB_PAIR(0x91CE1A5F, 0x9523A345), LIMB_PAIR(0xCDEC9E2B, 0x6BD0F293),
+        LIMB_PAIR(0x26CBDE55, 0x71DBD98A), LIMB_PAIR(0x2824F0DD, 0xB5C582D0), LIMB_PAIR(0x39D68478, 0xD1D8317A), LIMB_PAIR(0xAAA2A110, 0x2D1B7D9B), LIMB_PARTIAL(0x03D)
+    },
+    {   // 9 * G
+        LIMB_PAIR(0x67CBE207, 0x1F456279), LIMB_PAIR(0x85CD2866, 0x4F50BABD), LIMB_PAIR(0x725A318F, 0xF3C556DF), LIMB_PAIR(0x6134DA35, 0x7429E139),
+        LIMB_PAIR(0xB8C6B665, 0x2C4AB145), LIMB_PAIR(0x98874699, 0xED34541B), LIMB_PAIR(0x7156D488, 0xA2F5BF15), LIMB_PAIR(0xE1E21826, 0x5389E359), LIMB_PARTIAL(0x158),
+        LIMB_PAIR(0xB9AD2A4E, 0x3AA0EA86), LIMB_PAIR(0x28880F34, 0x736C2AE9), LIMB_PAIR(0x4ABFD87D, 0x0FF56ECF), LIMB_PAIR(0x6057AC84, 0x0D69E575),
+        LIMB_PAIR(0x3DDB446E, 0xC825BA26), LIMB_PAIR(0xEE1CEBB6, 0x3088A654), LIMB_PAIR(0x27AE938E, 0x0B55557A), LIMB_PAIR(0x8AEDF39F, 0x2E618C9A), LIMB_PARTIAL(0x02A)
+    },
+    {   // 11 * G
+        LIMB_PAIR(0xDA0CDB9A, 0xECC0E02D), LIMB_PAIR(0xA4C9A902, 0x015C024F), LIMB_PAIR(0xE3191085, 0xD19B1AEB), LIMB_PAIR(0x2663DA1B, 0xF3DBC533),
+        LIMB_PAIR(0xF2991652, 0x43EF2C54), LIMB_PAIR(0x7C178495, 0xED5DC7ED), LIMB_PAIR(0x3B4315CF, 0x6F1A3957), LIMB_PAIR(0xFDEDFF54, 0x75841259), LIMB_PARTIAL(0x08A),
+        LIMB_PAIR(0xCE48C808, 0x58874F92), LIMB_PAIR(0xF4819B5D, 0xDCAC80E3), LIMB_PAIR(0x14A95336, 0x38923319), LIMB_PAIR(0x8B42A4AB, 0x1BC8A90E),
+        LIMB_PAIR(0xE0B9B82B, 0xED2E95D4), LIMB_PAIR(0x10BD0493, 0x3ADD5662), LIMB_PAIR(0x054FB229, 0x9D0CA877), LIMB_PAIR(0xBA212984, 0xFB303FCB), LIMB_PARTIAL(0x096)
+    },
+    {   // 13 * G
+        LIMB_PAIR(0x32FBCDA7, 0x1887848D), LIMB_PAIR(0xAB38EFF8, 0x4BEC3B00), LIMB_PAIR(0x9AB88EE9, 0x3550A5E7), LIMB_PAIR(0xE03C996A, 0x32C45908),
+        LIMB_PAIR(0xAF5B8661, 0x4EEDD2BE), LIMB_PAIR(0xE1B4C238, 0x93F736CD), LIMB_PAIR(0x4924861A, 0xD7865D2B), LIMB_PAIR(0xC396AD9C, 0x3E98F984), LIMB_PARTIAL(0x07E),
+        LIMB_PAIR(0x022A71C9, 0x291A01FB), LIMB_PAIR(0x9117E9F7, 0x6199EAAF), LIMB_PAIR(0x1CBFBBC3, 0x26DFDD35), LIMB_PAIR(0x38BC763F, 0xC1BD5D58),
+        LIMB_PAIR(0x5C1E212A, 0x9C7A67AE), LIMB_PAIR(0x6D5421C6, 0xCED50A38), LIMB_PAIR(0xA3ED5A08, 0x1A1926DA), LIMB_PAIR(0x781FEDA9, 0xEE58EB6D), LIMB_PARTIAL(0x108)
+    },
+    {   // 15 * G
+        LIMB_PAIR(0xBCB8DB55, 0xE9AFE337), LIMB_PAIR(0x1E3F92BD, 0x9B8D9698), LIMB_PAIR(0x8FC0331D, 0x7875BD1C), LIMB_PAIR(0xDBD00FFE, 0xB91CCE27),
+        LIMB_PAIR(0xDF128E11, 0xD697B532), LIMB_PAIR(0xB40A0852, 0xB8FBCC30), LIMB_PAIR(0x46D4300F, 0x41558FC5), LIMB_PAIR(0xB92465F0, 0x6AD89ABC), LIMB_PARTIAL(0x06B),
+        LIMB_PAIR(0xA1475465, 0x56343480), LIMB_PAIR(0x446ABDD9, 0x46FD90CC), LIMB_PAIR(0x2C96C992, 0x2148E223), LIMB_PAIR(0x99470A80, 0x7E9062C8),
+        LIMB_PAIR(0x97485ED5, 0x4B621069), LIMB_PAIR(0xBAD20CBA, 0xDF0496A9), LIMB_PAIR(0x33EDBF63, 0x7CE64D23), LIMB_PAIR(0x71391D6A, 0x68DA2715), LIMB_PARTIAL(0x1B4)
+    },
+    {   // 17 * G
+        LIMB_PAIR(0x53110AE0, 0x76F817A8), LIMB_PAIR(0xF0D1A410, 0xF8C3042A), LIMB_PAIR(0x5681380F, 0xDF4E799B), LIMB_PAIR(0x74FE0287, 0x760A69E6),
+        LIMB_PAIR(0x69250858, 0xD66524F2), LIMB_PAIR(0x9FA2B3B4, 0x99EE9E26), LIMB_PAIR(0x5923906A, 0xA0B87464), LIMB_PAIR(0x130EDA13, 0x0DDB707F), LIMB_PARTIAL(0x1B0),
+        LIMB_PAIR(0x70E64647, 0x35B9CB7C), LIMB_PAIR(0xC2B755F5, 0xE6905594), LIMB_PAIR(0x16ADF420, 0xD2F6757F), LIMB_PAIR(0xF6DD0BF0, 0xF9DA564E),
+        LIMB_PAIR(0x22A1323D, 0x8D68AC2B), LIMB_PAIR(0xF69910A9, 0xB799534C), LIMB_PAIR(0xAEDDD106, 0xC111D4E4), LIMB_PAIR(0xB16576DB, 0x683F1D7D), LIMB_PARTIAL(0x085)
+    },
+    {   // 19 * G
+        LIMB_PAIR(0x18D6A19B, 0x78FF0B24), LIMB_PAIR(0x725BBDE4, 0xFECF431E), LIMB_PAIR(0x7A45970D, 0x9232557D), LIMB_PAIR(0x36266967, 0xFA3B3096),
+        LIMB_PAIR(0x3790E7F1, 0xFFF0ACDB), LIMB_PAIR(0x55DF547E, 0x45B77E07), LIMB_PAIR(0xD5A1A072, 0xC0F948C2), LIMB_PAIR(0x419C3487, 0x8DCCE486), LIMB_PARTIAL(0x099),
+        LIMB_PAIR(0x5BFD0575, 0xA9091A69), LIMB_PAIR(0xA9FBFE44, 0xF5A4D89E), LIMB_PAIR(0x1631C377, 0xB0EC3999), LIMB_PAIR(0xF2EB8CF9, 0x73AD963F),
+        LIMB_PAIR(0x65457727, 0xCC50EEE3), LIMB_PAIR(0x2B7BCF4A, 0x67D28AEE), LIMB_PAIR(0x535B245D, 0xC3942497), LIMB_PAIR(0xA021ED5C, 0xD5DA0626), LIMB_PARTIAL(0x137)
+    },
+    {   // 21 * G
+        LIMB_PAIR(0x93C8C9ED, 0x42EF3996), LIMB_PAIR(0x93A46D2D, 0x37AC9203), LIMB_PAIR(0xD827D75B, 0xD9497EAE), LIMB_PAIR(0x4D62A309, 0x46257EAE),
+        LIMB_PAIR(0x9C467FA9, 0x19523E75), LIMB_PAIR(0x2ED15E98, 0x268BB98C), LIMB_PAIR(0x59ED3B10, 0x3CC85508), LIMB_PAIR(0x742BD2FB, 0xCBB2C11A), LIMB_PARTIAL(0x1A1),
+        LIMB_PAIR(0x9CBA4DF5, 0xE60BC43C), LIMB_PAIR(0x649CCB61, 0x7C9B0F17), LIMB_PAIR(0x2C63EEC5, 0xBEB43A37), LIMB_PAIR(0xDA483295, 0xDF741A53),
+        LIMB_PAIR(0x6BAFA7F7, 0x180A296F), LIMB_PAIR(0xC5193E6C, 0xE83C0059), LIMB_PAIR(0x5E40CE62, 0x2C12DA7C), LIMB_PAIR(0x8EEB3D48, 0x209D7D4F), LIMB_PARTIAL(0x11A)
+    },
+    {   // 23 * G
+        LIMB_PAIR(0xE2AF535C, 0xA1C6A5EC), LIMB_PAIR(0x26AE5806, 0x07E1F1AC), LIMB_PAIR(0xA5EC53E2, 0xE9E3F8E9), LIMB_PAIR(0x9AF5B0AF, 0x1F6F83FC),
+        LIMB_PAIR(0x0CDD4510, 0x490D234D), LIMB_PAIR(0x785FB282, 0xEE7A39BA), LIMB_PAIR(0x5F547B8E, 0xDB1CACEC), LIMB_PAIR(0x90159376, 0x0B275D72), LIMB_PARTIAL(0x1AE),
+        LIMB_PAIR(0x6FA0D000, 0xD815C353), LIMB_PAIR(0xA8D23856, 0x213B4450), LIMB_PAIR(0xB07DD0C2, 0x3C27B27B), LIMB_PAIR(0xEE97FCF4, 0x10843361),
+        LIMB_PAIR(0x44C2DC0E, 0xB4316478), LIMB_PAIR(0x90D05832, 0x7D759FF8), LIMB_PAIR(0xC068471C, 0x68A2858F), LIMB_PAIR(0x53853806, 0xC97A825E), LIMB_PARTIAL(0x0F2)
+    },
+    {   // 25 * G
+        LIMB_PAIR(0xBF70ACE0, 0x3F8C2460), LIMB_PAIR(0xC25D3FB1, 0xE41E0EB1), LIMB_PAIR(0xA648FF27, 0x56E87E2A), LIMB_PAIR(0x7C36EE4D, 0xA9185691),
+        LIMB_PAIR(0x5499994A, 0x1C772C8C), LIMB_PAIR(0x51B107B1, 0x00731026), LIMB_PAIR(0xF5DFF9D2, 0xA35874A6), LIMB_PAIR(0x5A9A1834, 0xE84C6D5C), LIMB_PARTIAL(0x154),
+        LIMB_PAIR(0x04C78230, 0x4325BCE4), LIMB_PAIR(0x672E6B6D, 0xEEDE2A54), LIMB_PAIR(0x6A5972F5, 0xD1E2370A), LIMB_PAIR(0x72FBC1A0, 0xDEE35435),
+        LIMB_PAIR(0x151666A6, 0xF66C2888), LIMB_PAIR(0x0022A0C7, 0x15A923EB), LIMB_PAIR(0x0BB60D3F, 0xE22A28F8), LIMB_PAIR(0x1910473A, 0x0FDCE917), LIMB_PARTIAL(0x0CD)
+    },
+    {   // 27 * G
+        LIMB_PAIR(0x7002D68B, 0x35764301), LIMB_PAIR(0x92EC4568, 0xB2156044), LIMB_PAIR(0xA0D3163C, 0x51353AED), LIMB_PAIR(0xA719D483, 0x80B2123D),
+        LIMB_PAIR(0xE135854D, 0x33F35187), LIMB_PAIR(0x0E4F862C, 0x8739535D), LIMB_PAIR(0x889E646F, 0x62A4D4EB), LIMB_PAIR(0x18F9B6A7, 0x373EDF82), LIMB_PARTIAL(0x160),
+        LIMB_PAIR(0x5D90B740, 0xF3E6AECA), LIMB_PAIR(0x9D45ACB3, 0x463FFE70), LIMB_PAIR(0xA8BB572E, 0x13B874F4), LIMB_PAIR(0xD92EBC54, 0x1EFA491E),
+        LIMB_PAIR(0x1A1B2201, 0x4A56F78E), LIMB_PAIR(0xCF52C3BB, 0x9FD193C5), LIMB_PAIR(0xAC06A3FA, 0xE5828401), LIMB_PAIR(0x4DCFE1C5, 0x59705001), LIMB_PARTIAL(0x0F1)
+    },
+    {   // 29 * G
+        LIMB_PAIR(0x8EDA25DC, 0x2C392761), LIMB_PAIR(0xD51F6D96, 0xF33D8595), LIMB_PAIR(0x847FFB9E, 0x4003AB8E), LIMB_PAIR(0x876D7291, 0x5CA9BC06),
+        LIMB_PAIR(0x7664A130, 0x28BEF38F), LIMB_PAIR(0xE86265EC, 0xF9F45131), LIMB_PAIR(0xB65A085F, 0xB3C1FBFC), LIMB_PAIR(0x4B68287D, 0xC644D6C9), LIMB_PARTIAL(0x174),
+        LIMB_PAIR(0x821A0C30, 0x187BBBC4), LIMB_PAIR(0x26EBBFBD, 0x0679927C), LIMB_PAIR(0x706D303F, 0x50C2732D), LIMB_PAIR(0x2CE0D90B, 0xBE0E2195),
+        LIMB_PAIR(0x95AD34B7, 0xB5CF5EB7), LIMB_PAIR(0xCB6441FC, 0x0233EF8F), LIMB_PAIR(0x41B7B782, 0x05ACC95B), LIMB_PAIR(0x7F419E68, 0xF3A7C2F8), LIMB_PARTIAL(0x11A)
+    },
+    {   // 31 * G
+        LIMB_PAIR(0xC16A8803, 0x2257D0E0), LIMB_PAIR(0x88E24812, 0x0DCFB5E4), LIMB_PAIR(0x09CD6B22, 0xFC14C1AC), LIMB_PAIR(0x04C9D429, 0xD65543A9),
+        LIMB_PAIR(0xA5E7726C, 0x7260A83C), LIMB_PAIR(0x57C2A661, 0xB5745896), LIMB_PAIR(0xB7307B7D, 0x006A58CD), LIMB_PAIR(0x0F0C6615, 0xE9920CF3), LIMB_PARTIAL(0x0D8),
+        LIMB_PAIR(0x39792D19, 0xCA4677C7), LIMB_PAIR(0x7B54318A, 0xAA1BD97C), LIMB_PAIR(0xAE4CC263, 0x139A868C), LIMB_PAIR(0x44D14790, 0xF76B8C32),
+        LIMB_PAIR(0xBED1AA30, 0x0AEFB72C), LIMB_PAIR(0x8F10C806, 0x8B540632), LIMB_PAIR(0x214A30EC, 0xDF09C13A), LIMB_PAIR(0x4A663987, 0xB023B545), LIMB_PARTIAL(0x127)
+    },
+    {   // 33 * G
+        LIMB_PAIR(0x649F308D, 0x5EA2E1FC), LIMB_PAIR(0x6B2ED12D, 0xA5EC5918), LIMB_PAIR(0x7AA53AC2, 0xE9A519A5), LIMB_PAIR(0x2B77EF1A, 0xABDBEA7E),
+        LIMB_PAIR(0x74236DF0, 0xF381421A), LIMB_PAIR(0x2BE92613, 0x52086D48), LIMB_PAIR(0x3C76F58E, 0x8C76EB4E), LIMB_PAIR(0x8FB969E6, 0x4195F097), LIMB_PARTIAL(0x028),
+        LIMB_PAIR(0xD3E11C4D, 0x6BE95A3D), LIMB_PAIR(0x228B58F3, 0x88EFFD5C), LIMB_PAIR(0xC16DEB3A, 0x00BD7216), LIMB_PAIR(0xF3D138BF, 0xE7656ECB),
+        LIMB_PAIR(0x614AC5F2, 0x9E016769), LIMB_PAIR(0xE063C663, 0x24D513AB), LIMB_PAIR(0x69056D3A, 0x7B7A3BC8), LIMB_PAIR(0x56DC636B, 0x43EB08C6), LIMB_PARTIAL(0x07E)
+    },
+    {   // 35 * G
+        LIMB_PAIR(0xCCD7D718, 0xDC1039C9), LIMB_PAIR(0xB5DCC8D8, 0xA92FF614), LIMB_PAIR(0x08F6B2CE, 0xEE4A6186), LIMB_PAIR(0xFDA74023, 0xB4806C84),
+        LIMB_PAIR(0x6F97392B, 0xC4A780B5), LIMB_PAIR(0xB593E0BF, 0xA267A642), LIMB_PAIR(0x9E0BA392, 0x398B6206), LIMB_PAIR(0x49630A78, 0xC3007575), LIMB_PARTIAL(0x0DD),
+        LIMB_PAIR(0x241E07F4, 0x3EB1D3EF), LIMB_PAIR(0x22640A4D, 0xDEBA4DB4), LIMB_PAIR(0xEE69E797, 0x5C212522), LIMB_PAIR(0xD2C70142, 0x9AB1178B),
+        LIMB_PAIR(0x1A31DB50, 0x46279659), LIMB_PAIR(0xB5D85BCF, 0xA510936C), LIMB_PAIR(0x0C30DBBF, 0x1B83431F), LIMB_PAIR(0xAC7FC5CC, 0xBD2D07F6), LIMB_PARTIAL(0x0C1)
+    },
+    {   // 37 * G
+        LIMB_PAIR(0xB557A36F, 0xF1AC4D59), LIMB_PAIR(0xE4780273, 0x8C64E76A), LIMB_PAIR(0xE0980DF2, 0x0E58E26E), LIMB_PAIR(0xA2885604, 0xBD445763),
+        LIMB_PAIR(0xAF9D5749, 0x29ED0AE6), LIMB_PAIR(0xC1D59E42, 0xC35C5D56), LIMB_PAIR(0x2DED5867, 0x39E79835), LIMB_PAIR(0x1832B671, 0x4F64A6C2), LIMB_PARTIAL(0x094),
+        LIMB_PAIR(0x94FB2A03, 0x312BF983), LIMB_PAIR(0x56988296, 0x31A4BE40), LIMB_PAIR(0x95A057C3, 0xB85C5649), LIMB_PAIR(0x71C83F81, 0xDCBDBC24),
+        LIMB_PAIR(0xB7991305, 0x26317DA6), LIMB_PAIR(0x1865F859, 0xFE4E6FF2), LIMB_PAIR(0xF26CB192, 0x0C4B9624), LIMB_PAIR(0x028AB741, 0xB7EE1B02), LIMB_PARTIAL(0x150)
+    },
+    {   // 39 * G
+        LIMB_PAIR(0xEE33B77C, 0x0B704119), LIMB_PAIR(0x8083AF67, 0x5B4FA1D4), LIMB_PAIR(0xE5FA3179, 0xAC0BF434), LIMB_PAIR(0x8626A1E2, 0x256B0CC5),
+        LIMB_PAIR(0x359C6EA7, 0x38D9FD62), LIMB_PAIR(0x9B5B9072, 0x9E9661A4), LIMB_PAIR(0x56A49902, 0x52641263), LIMB_PAIR(0xFBAD6075, 0xA0B8F411), LIMB_PARTIAL(0x124),
+        LIMB_PAIR(0x228B61A6, 0xD8DCDC61), LIMB_PAIR(0x698E40AB, 0xF212E74B), LIMB_PAIR(0x5944E762, 0xA3CAF241), LIMB_PAIR(0xB96825AA, 0x18DC59FE),
+        LIMB_PAIR(0xC690DB48, 0xDC0B1240), LIMB_PAIR(0x8796154C, 0x68937BAA), LIMB_PAIR(0x6BBD399C, 0x602A9A40), LIMB_PAIR(0x7335DCE3, 0x29616EDC), LIMB_PARTIAL(0x010)
+    },
+    {   // 41 * G
+        LIMB_PAIR(0x2624381E, 0x8E00CE95), LIMB_PAIR(0x22CC2AF6, 0xDDFDA1A5), LIMB_PAIR(0xC8297BFA, 0x4C08C3DD), LIMB_PAIR(0xF495CCCE, 0x16B931EA),
+        LIMB_PAIR(0x864A60C8, 0x85B85F23), LIMB_PAIR(0xB28998A6, 0x52A523E4), LIMB_PAIR(0x28830825, 0x63EBFD9D), LIMB_PAIR(0xE85E24A7, 0xA140ED79), LIMB_PARTIAL(0x175),
+        LIMB_PAIR(0xC1028ECF, 0xEBEB760E), LIMB_PAIR(0xE7F3A3EC, 0xF75DD758), LIMB_PAIR(0x1FA28EBD, 0x052A6E55), LIMB_PAIR(0xECF327DA, 0xB39E0E11),
+        LIMB_PAIR(0x22C82111, 0x23DE821B), LIMB_PAIR(0xE9EE5632, 0xAB59E580), LIMB_PAIR(0xCA399BE7, 0x36F21343), LIMB_PAIR(0x55E2D4ED, 0x9696D718), LIMB_PARTIAL(0x1B0)
+    },
+    {   // 43 * G
+        LIMB_PAIR(0x224F497E, 0x713E3083), LIMB_PAIR(0xDEE07D20, 0x51F0B62F), LIMB_PAIR(0x9B3D85CA, 0xA3A74E7A), LIMB_PAIR(0xED7D37DD, 0xFC66AD7A),
+        LIMB_PAIR(0x38FEA396, 0x8EF0F944), LIMB_PAIR(0xEC1419AF, 0x70678AA2), LIMB_PAIR(0x0544D8A0, 0xD55022D9), LIMB_PAIR(0xEC58E4FE, 0x0148A165), LIMB_PARTIAL(0x18C),
+        LIMB_PAIR(0x7683ADBF, 0x89582906), LIMB_PAIR(0x76B688D2, 0x94EDB92F), LIMB_PAIR(0x547CE17A, 0x932D602B), LIMB_PAIR(0x879B1CF1, 0x67FD6098),
+        LIMB_PAIR(0x9F1A0BEC, 0x7A303781), LIMB_PAIR(0xB1D144CD, 0x2677E91D), LIMB_PAIR(0x7AA3BF24, 0xEBF7A83C), LIMB_PAIR(0x9E78869A, 0xBBAA1F09), LIMB_PARTIAL(0x10A)
+    },
+    {   // 45 * G
+        LIMB_PAIR(0x0FC95C1A, 0xA32DEC60), LIMB_PAIR(0xB66B70C4, 0xC2954607), LIMB_PAIR(0xE5703F0F, 0xDC8EA1AC), LIMB_PAIR(0xF8A1F2D9, 0x79189B7D),
+        LIMB_PAIR(0xF1972867, 0x7B2DF5E3), LIMB_PAIR(0x8C147CC0, 0x7A58F7F2), LIMB_PAIR(0xFF2BC020, 0x79596B8F), LIMB_PAIR(0xA09E53B8, 0x69D186AC), LIMB_PARTIAL(0x049),
+        LIMB_PAIR(0x000903A9, 0x9498A7CD), LIMB_PAIR(0x0B37564F, 0x3463F5D9), LIMB_PAIR(0x9BE328E1, 0xE6ED9E87), LIMB_PAIR(0x2EADAE85, 0xB8D5B280),
+        LIMB_PAIR(0xBCDB40A9, 0x35584A1B), LIMB_PAIR(0x32708841, 0x15862A42), LIMB_PAIR(0x3149FC7B, 0x4D6AC21F), LIMB_PAIR(0xD8D3847D, 0x1EC9B50C), LIMB_PARTIAL(0x1E8)
+    },
+    {   // 47 * G
+        LIMB_PAIR(0xABD59D11, 0x2FDA63C9), LIMB_PAIR(0xD1ECBB67, 0x0A56A130), LIMB_PAIR(0xA9C4DD66, 0x9CEE75A3), LIMB_PAIR(0xB9E922AC, 0x381864A0),
+        LIMB_PAIR(0xC71DD0B2, 0x97233106), LIMB_PAIR(0x14033FF8, 0xE4E4FE27), LIMB_PAIR(0xCC35882C, 0x9CF5083E), LIMB_PAIR(0x048AFD5F, 0xE31F8907), LIMB_PARTIAL(0x0AF),
+        LIMB_PAIR(0x1D90E1D6, 0xD3065D2F), LIMB_PAIR(0x9F10673B, 0x11CA4159), LIMB_PAIR(0x78D825E7, 0xEBB760F4), LIMB_PAIR(0x904982A6, 0x9276080B),
+        LIMB_PAIR(0x76F06497, 0xECEA7F32), LIMB_PAIR(0x49209F88, 0x605F0793), LIMB_PAIR(0xB54FF69A, 0xB4290CBB), LIMB_PAIR(0x7275FE9D, 0xF95DC865), LIMB_PARTIAL(0x012)
+    },
+    {   // 49 * G
+        LIMB_PAIR(0x49EFC0AD, 0x0C8CB450), LIMB_PAIR(0xAC4C04CA, 0x7258DAB1), LIMB_PAIR(0x2E345FA8, 0x91D8C84E), LIMB_PAIR(0x52F62842, 0x6BC2A2DF),
+        LIMB_PAIR(0x11DEA9EB, 0xF581B8B1), LIMB_PAIR(0xAE499839, 0x9D45C347), LIMB_PAIR(0xBBABA0D3, 0xCBA40A63), LIMB_PAIR(0x0B8C1D57, 0xCB98FA3C), LIMB_PARTIAL(0x0A5),
+        LIMB_PAIR(0x2C8884B4, 0x0B9BF46A), LIMB_PAIR(0xB0B88B1D, 0x4B963FBF), LIMB_PAIR(0xEBB72BB4, 0x0C10F2CE), LIMB_PAIR(0x43D575C2, 0x5DD97755),
+        LIMB_PAIR(0x9DA8BF83, 0xB072C39D), LIMB_PAIR(0x877E5B7E, 0x749EE467), LIMB_PAIR(0xF72E151B, 0x1409B01B), LIMB_PAIR(0x90D77B97, 0xDC956540), LIMB_PARTIAL(0x015)
+    },
+    {   // 51 * G
+        LIMB_PAIR(0xFBCC9504, 0xA8D916FF), LIMB_PAIR(0x1D7BE2DD, 0xFBA689EF), LIMB_PAIR(0x1054CBC0, 0x1321AE1B), LIMB_PAIR(0xF07390DF, 0xC2EDFE6A),
+        LIMB_PAIR(0xF9BEEA26, 0x3BA316CB), LIMB_PAIR(0xE34FE9BA, 0xFDF9F5BD), LIMB_PAIR(0x8145F3CC, 0x025D93B6), LIMB_PAIR(0x278415A2, 0x395BA51E), LIMB_PARTIAL(0x168),
+        LIMB_PAIR(0xDD5C087B, 0x8EB9C45E), LIMB_PAIR(0xD3A89E18, 0x0600AABE), LIMB_PAIR(0x6E3AEBA5, 0x849C3609), LIMB_PAIR(0xBADB600C, 0x97BC2B68),
+        LIMB_PAIR(0xADEB9B3C, 0x24E5B174), LIMB_PAIR(0x21C480CE, 0x52DD878F), LIMB_PAIR(0x42D3F579, 0x39D95319), LIMB_PAIR(0x041A2456, 0xCC10F3CA), LIMB_PARTIAL(0x071)
+    },
+    {   // 53 * G
+        LIMB_PAIR(0xCCB69906, 0x6285684C), LIMB_PAIR(0xC9880816, 0x08153DA9), LIMB_PAIR(0xBA4FE12B, 0xD3AF581F), LIMB_PAIR(0x7209A78E, 0x4E210E63),
+        LIMB_PAIR(0x948100C4, 0x27E82F6F), LIMB_PAIR(0x16895FB7, 0xF8688BE9), LIMB_PAIR(0x310306DF, 0x7B3D0FFD), LIMB_PAIR(0x5EE693F7, 0xF6E24919), LIMB_PARTIAL(0x143),
+        LIMB_PAIR(0xD40C7861, 0xFD6DDADD), LIMB_PAIR(0xC4ABEE6A, 0x040A3DFB), LIMB_PAIR(0xE3B4CF8C, 0x0F6A7A9D), LIMB_PAIR(0x03CF3BB3, 0x4FDF64F5),
+        LIMB_PAIR(0x53D10CB1, 0x35437E80), LIMB_PAIR(0xE42C2169, 0x7DC73FDD), LIMB_PAIR(0x57510987, 0xC5611A02), LIMB_PAIR(0x18EB2A74, 0x3E8FCC96), LIMB_PARTIAL(0x105)
+    },
+    {   // 55 * G
+        LIMB_PAIR(0xBD470F5E, 0x84AD7CCE), LIMB_PAIR(0xDA96AC4E, 0x7FE9AB4B), LIMB_PAIR(0x1E0B549A, 0xBE17486B), LIMB_PAIR(0x7CAD27E6, 0x8CCA9391),
+        LIMB_PAIR(0x8E8DA1A1, 0x6472D402), LIMB_PAIR(0xD9D0A79D, 0x7CB03E9F), LIMB_PAIR(0x5C6DACA9, 0xB551E415), LIMB_PAIR(0x310CE7C4, 0x52FC4B6D), LIMB_PARTIAL(0x04B),
+        LIMB_PAIR(0x30A36EF2, 0x7A196CD2), LIMB_PAIR(0x06A096EA, 0xFA03A230), LIMB_PAIR(0x45B53586, 0xD69609E3), LIMB_PAIR(0x5C5A084C, 0x10AA8589),
+        LIMB_PAIR(0x7DBAE155, 0x00FB114A), LIMB_PAIR(0x1A16A0B6, 0x619F4431), LIMB_PAIR(0x7A1A7B2E, 0x385EA790), LIMB_PAIR(0x1461AE21, 0x85E54FE8), LIMB_PARTIAL(0x035)
+    },
+    {   // 57 * G
+        LIMB_PAIR(0x4E9A13E2, 0x3475330A), LIMB_PAIR(0xF95C8450, 0x8372C8FF), LIMB_PAIR(0x64B8A520, 0xF66FD5BC), LIMB_PAIR(0xDE9118B2, 0x4AF300BB),
+        LIMB_PAIR(0xA521B9F8, 0xEF3C6D77), LIMB_PAIR(0x2E6DBF85, 0x5A8DEFE7), LIMB_PAIR(0xEFB25FFA, 0x4463DA75), LIMB_PAIR(0xF3C902E0, 0x53C3E7FC), LIMB_PARTIAL(0x0DC),
+        LIMB_PAIR(0xD9C4248F, 0x33AD7F7F), LIMB_PAIR(0xC62A5532, 0xA9493190), LIMB_PAIR(0x6A929F73, 0x4A3F8205), LIMB_PAIR(0x0D3BD86A, 0x3482530D),
+        LIMB_PAIR(0x90DFF3EA, 0xB62E7EB3), LIMB_PAIR(0xCAF9D989, 0xB13D0DD2), LIMB_PAIR(0xC4D4F8F7, 0x68073EE6), LIMB_PAIR(0xFDBD992B, 0xE88FCCD4), LIMB_PARTIAL(0x074)
+    },
+    {   // 59 * G
+        LIMB_PAIR(0xEB16686B, 0x63BE8A26), LIMB_PAIR(0xC3472088, 0xCBA8524E), LIMB_PAIR(0x64373A8A, 0x1A90342D), LIMB_PAIR(0xB1344C69, 0x055693C9),
+        LIMB_PAIR(0x4C222920, 0xAAE5C293), LIMB_PAIR(0x98901999, 0xC7223C5D), LIMB_PAIR(0x2DF29EAD, 0x063C6034), LIMB_PAIR(0x31876773, 0xAEB454AD), LIMB_PARTIAL(0x035),
+        LIMB_PAIR(0x5381FA2E, 0xCF4AA03C), LIMB_PAIR(0xFAFFE51A, 0xFD82C38C), LIMB_PAIR(0xD64FFEC3, 0xC9FD5FDD), LIMB_PAIR(0xBC83D0B8, 0xB8CF8C44),
+        LIMB_PAIR(0xCB6EFD45, 0xE22F2EF3), LIMB_PAIR(0x660903F4, 0x15A48DB3), LIMB_PAIR(0xAFF1BA7F, 0xDB0B0CA0), LIMB_PAIR(0x7E7E43B4, 0x7ECBEC14), LIMB_PARTIAL(0x018)
+    },
+    {   // 61 * G
+        LIMB_PAIR(0xCFC376A1, 0xCB53D8CF), LIMB_PAIR(0x71543C41, 0x952BAD16), LIMB_PAIR(0x9A7B32D7, 0xA5E7FCE5), LIMB_PAIR(0x77DC0B39, 0x7193C11A),
+        LIMB_PAIR(0xBE8B1717, 0x4CD724B1), LIMB_PAIR(0x5B660D1A, 0x8B6CD17D), LIMB_PAIR(0x2A1C7D8F, 0x92CA7C73), LIMB_PAIR(0x1407425C, 0x544C4A01), LIMB_PARTIAL(0x115),
+        LIMB_PAIR(0x4A17604B, 0xB8EFF8CD), LIMB_PAIR(0xC3FE5E24, 0x56F22EE9), LIMB_PAIR(0x3AFA032B, 0xA834FF60), LIMB_PAIR(0xB7F553A8, 0x03F78D54),
+        LIMB_PAIR(0xED58C6A0, 0xEC097A3A), LIMB_PAIR(0xEF422CBF, 0x79AF485F), LIMB_PAIR(0x399C872C, 0x07996D2A), LIMB_PAIR(0xAC6485B3, 0x3DF9C6C0), LIMB_PARTIAL(0x115)
+    },
+    {   // 63 * G
+        LIMB_PAIR(0xCE8888E5, 0x0F5BEB6F), LIMB_PAIR(0x5770AC8D, 0x75AF7D02), LIMB_PAIR(0x7586265E, 0xC6399684), LIMB_PAIR(0x308E125E, 0x3AE99661),
+        LIMB_PAIR(0xD51B0845, 0xE7F54FE4), LIMB_PAIR(0xFFA0DDC1, 0x1CA21B5A), LIMB_PAIR(0xCB0A6E8E, 0xE82F799A), LIMB_PAIR(0x640C457F, 0x32753B64), LIMB_PARTIAL(0x1C1),
+        LIMB_PAIR(0xA03DBA15, 0xE9D15AD2), LIMB_PAIR(0xF664A2AC, 0xAF657B5B), LIMB_PAIR(0xF0071283, 0x13F78F82), LIMB_PAIR(0xEC1896BC, 0x05D3DBDC),
+        LIMB_PAIR(0x3AA22380, 0x595E8C35), LIMB_PAIR(0x86414006, 0x1A9E0932), LIMB_PAIR(0xB205D796, 0x6D81AC89), LIMB_PAIR(0x7A053817, 0x47E18419), LIMB_PARTIAL(0x153)
+    }
+};
+
+#endif